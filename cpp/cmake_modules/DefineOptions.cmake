@@ -284,6 +284,10 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
 
   define_option(ARROW_WITH_BACKTRACE "Build with backtrace support" ON)
 
+  define_option(ARROW_WITH_IO_URING
+                "Build with io_uring support for batched local file reads (Linux only)"
+                OFF)
+
   define_option(ARROW_USE_GLOG "Build libraries with glog support for pluggable logging"
                 OFF)
 
@@ -361,6 +365,10 @@ Always OFF if building binaries" OFF)
   define_option(ARROW_EXTRA_ERROR_CONTEXT
                 "Compile with extra error context (line numbers, code)" OFF)
 
+  define_option(ARROW_WITH_TRACING
+                "Compile tracing spans into readers, kernels and the dataset scanner"
+                OFF)
+
   define_option(ARROW_OPTIONAL_INSTALL
                 "If enabled install ONLY targets that have already been built. Please be;\
 advised that if this is enabled 'install' will fail silently on components;\
@@ -319,6 +319,12 @@ if(ARROW_CPU_FLAG STREQUAL "x86" AND ARROW_USE_SIMD)
     set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} ${ARROW_SSE4_2_FLAG}")
     add_definitions(-DARROW_HAVE_SSE4_2)
   endif()
+
+  # Some kernels are also compiled for AVX2 and selected at runtime using CpuInfo
+  if(CXX_SUPPORTS_AVX2 AND NOT ARROW_SIMD_LEVEL STREQUAL "AVX512")
+    set(ARROW_HAVE_RUNTIME_AVX2 ON)
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+  endif()
 endif()
 
 if(ARROW_CPU_FLAG STREQUAL "ppc" AND ARROW_USE_SIMD)
@@ -337,6 +343,7 @@ if(ARROW_CPU_FLAG STREQUAL "arm")
   set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} ${ARROW_ARMV8_ARCH_FLAG}")
 
   if(ARROW_USE_SIMD)
+    set(ARROW_HAVE_NEON ON)
     add_definitions(-DARROW_HAVE_NEON)
   endif()
 
@@ -19,7 +19,9 @@
 #include "arrow/adapters/orc/adapter_util.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <exception>
 #include <list>
 #include <memory>
 #include <sstream>
@@ -32,6 +34,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -47,6 +50,7 @@
 
 #include "orc/Exceptions.hh"
 #include "orc/OrcFile.hh"
+#include "orc/Statistics.hh"
 
 // alias to not interfere with nested orc namespace
 namespace liborc = orc;
@@ -163,6 +167,76 @@ class OrcStripeReader : public RecordBatchReader {
   int64_t batch_size_;
 };
 
+template <typename Value>
+Status SetBounds(const std::shared_ptr<DataType>& type, Value min, Value max,
+                 StripeFieldStatistics* out) {
+  RETURN_NOT_OK(MakeScalar(type, min).Value(&out->min));
+  return MakeScalar(type, max).Value(&out->max);
+}
+
+// Convert the statistics of a column, leaving the bounds unset for the types
+// whose statistics don't map to scalars of the Arrow type
+Status GetFieldStatistics(const liborc::Type& type,
+                          const liborc::ColumnStatistics& statistics,
+                          const std::shared_ptr<DataType>& arrow_type,
+                          StripeFieldStatistics* out) {
+  out->num_values = static_cast<int64_t>(statistics.getNumberOfValues());
+  out->has_null = statistics.hasNull();
+
+  switch (type.getKind()) {
+    case liborc::BYTE:
+    case liborc::SHORT:
+    case liborc::INT:
+    case liborc::LONG: {
+      auto integer_statistics =
+          dynamic_cast<const liborc::IntegerColumnStatistics*>(&statistics);
+      if (integer_statistics != nullptr && integer_statistics->hasMinimum() &&
+          integer_statistics->hasMaximum()) {
+        return SetBounds(arrow_type, integer_statistics->getMinimum(),
+                         integer_statistics->getMaximum(), out);
+      }
+      break;
+    }
+    case liborc::FLOAT:
+    case liborc::DOUBLE: {
+      auto double_statistics =
+          dynamic_cast<const liborc::DoubleColumnStatistics*>(&statistics);
+      if (double_statistics != nullptr && double_statistics->hasMinimum() &&
+          double_statistics->hasMaximum() &&
+          !std::isnan(double_statistics->getMinimum()) &&
+          !std::isnan(double_statistics->getMaximum())) {
+        return SetBounds(arrow_type, double_statistics->getMinimum(),
+                         double_statistics->getMaximum(), out);
+      }
+      break;
+    }
+    case liborc::STRING:
+    case liborc::VARCHAR: {
+      auto string_statistics =
+          dynamic_cast<const liborc::StringColumnStatistics*>(&statistics);
+      if (string_statistics != nullptr && string_statistics->hasMinimum() &&
+          string_statistics->hasMaximum()) {
+        out->min = std::make_shared<StringScalar>(string_statistics->getMinimum());
+        out->max = std::make_shared<StringScalar>(string_statistics->getMaximum());
+      }
+      break;
+    }
+    case liborc::DATE: {
+      auto date_statistics =
+          dynamic_cast<const liborc::DateColumnStatistics*>(&statistics);
+      if (date_statistics != nullptr && date_statistics->hasMinimum() &&
+          date_statistics->hasMaximum()) {
+        return SetBounds(arrow_type, date_statistics->getMinimum(),
+                         date_statistics->getMaximum(), out);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  return Status::OK();
+}
+
 class ORCFileReader::Impl {
  public:
   Impl() {}
@@ -406,6 +480,73 @@ class ORCFileReader::Impl {
     return NextStripeReader(batch_size, {}, out);
   }
 
+  Status GetStripeReader(int64_t stripe, int64_t batch_size,
+                         const std::vector<int>& include_indices,
+                         std::shared_ptr<RecordBatchReader>* out) {
+    liborc::RowReaderOptions opts;
+    if (!include_indices.empty()) {
+      RETURN_NOT_OK(SelectIndices(&opts, include_indices));
+    }
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+    std::unique_ptr<liborc::RowReader> row_reader;
+    try {
+      row_reader = reader_->createRowReader(opts);
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+
+    *out = std::shared_ptr<RecordBatchReader>(
+        new OrcStripeReader(std::move(row_reader), schema, batch_size, pool_));
+    return Status::OK();
+  }
+
+  Status ReadStripeStatistics(int64_t stripe, std::vector<StripeFieldStatistics>* out) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(&schema));
+
+    std::unique_ptr<liborc::StripeStatistics> stripe_statistics;
+    try {
+      stripe_statistics = reader_->getStripeStatistics(static_cast<uint64_t>(stripe));
+    } catch (const std::exception& e) {
+      // e.g. files written without stripe statistics
+      return Status::IOError(e.what());
+    }
+
+    const liborc::Type& type = reader_->getType();
+    std::vector<StripeFieldStatistics> statistics(schema->num_fields());
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      const liborc::Type* field_type = type.getSubtype(i);
+      const auto column_id = static_cast<uint32_t>(field_type->getColumnId());
+      if (column_id >= stripe_statistics->getNumberOfColumns()) {
+        continue;
+      }
+      RETURN_NOT_OK(GetFieldStatistics(*field_type,
+                                       *stripe_statistics->getColumnStatistics(column_id),
+                                       schema->field(i)->type(), &statistics[i]));
+    }
+    *out = std::move(statistics);
+    return Status::OK();
+  }
+
+  Status GetFieldIndices(std::vector<int>* out) {
+    const liborc::Type& type = reader_->getType();
+    if (type.getKind() != liborc::STRUCT) {
+      return Status::NotImplemented(
+          "Only ORC files with a top-level struct "
+          "can be handled");
+    }
+    std::vector<int> indices;
+    for (uint64_t i = 0; i < type.getSubtypeCount(); ++i) {
+      indices.push_back(static_cast<int>(type.getSubtype(i)->getColumnId()));
+    }
+    *out = std::move(indices);
+    return Status::OK();
+  }
+
  private:
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
@@ -456,6 +597,21 @@ Status ORCFileReader::ReadStripe(int64_t stripe, const std::vector<int>& include
   return impl_->ReadStripe(stripe, include_indices, out);
 }
 
+Status ORCFileReader::GetStripeReader(int64_t stripe, int64_t batch_size,
+                                      const std::vector<int>& include_indices,
+                                      std::shared_ptr<RecordBatchReader>* out) {
+  return impl_->GetStripeReader(stripe, batch_size, include_indices, out);
+}
+
+Status ORCFileReader::ReadStripeStatistics(int64_t stripe,
+                                           std::vector<StripeFieldStatistics>* out) {
+  return impl_->ReadStripeStatistics(stripe, out);
+}
+
+Status ORCFileReader::GetFieldIndices(std::vector<int>* out) {
+  return impl_->GetFieldIndices(out);
+}
+
 Status ORCFileReader::Seek(int64_t row_number) { return impl_->Seek(row_number); }
 
 Status ORCFileReader::NextStripeReader(int64_t batch_sizes,
@@ -24,6 +24,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/visibility.h"
@@ -34,6 +35,16 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief The statistics of a top-level field in a stripe
+struct ARROW_EXPORT StripeFieldStatistics {
+  /// The bounds of the non-null values, or null if unknown (e.g. for nested types)
+  std::shared_ptr<Scalar> min, max;
+  /// The number of non-null values
+  int64_t num_values = 0;
+  /// Whether the stripe may contain nulls
+  bool has_null = true;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -101,6 +112,34 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Get a record batch iterator over a single stripe
+  ///
+  /// Unlike NextStripeReader, this doesn't depend on the current row, so the
+  /// stripes can be read in any order.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] batch_size the number of rows each record batch contains
+  /// \param[in] include_indices the selected field indices to read, or empty to
+  ///            read all the fields
+  /// \param[out] out the returned stripe reader
+  Status GetStripeReader(int64_t stripe, int64_t batch_size,
+                         const std::vector<int>& include_indices,
+                         std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Read the statistics of a stripe
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[out] out the statistics of each top-level field of the schema
+  Status ReadStripeStatistics(int64_t stripe, std::vector<StripeFieldStatistics>* out);
+
+  /// \brief Return the indices which select each top-level field of the schema
+  ///
+  /// The indices passed as include_indices are ORC type ids, in which nested
+  /// fields are numbered too. Selecting a field also selects its children.
+  ///
+  /// \param[out] out the index of each top-level field
+  Status GetFieldIndices(std::vector<int>* out);
+
   /// \brief Seek to designated row. Invoke NextStripeReader() after seek
   ///        will return stripe reader starting from designated row.
   ///
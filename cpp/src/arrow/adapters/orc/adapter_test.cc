@@ -157,4 +157,87 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+TEST(TestAdapter, readStripeStatisticsAndStripes) {
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  ORC_UNIQUE_PTR<liborc::Type> type(
+      liborc::Type::buildTypeFromString("struct<col1:int,col2:double>"));
+
+  constexpr uint64_t stripe_size = 1024;  // 1K
+  constexpr uint64_t stripe_count = 3;
+  constexpr uint64_t stripe_row_count = 65535;
+
+  auto writer = CreateWriter(stripe_size, *type, &mem_stream);
+  auto batch = writer->createRowBatch(stripe_row_count);
+  auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+  auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+  auto double_batch = dynamic_cast<liborc::DoubleVectorBatch*>(struct_batch->fields[1]);
+  int64_t accumulated = 0;
+
+  for (uint64_t j = 0; j < stripe_count; ++j) {
+    for (uint64_t i = 0; i < stripe_row_count; ++i) {
+      long_batch->data[i] = accumulated;
+      double_batch->data[i] = static_cast<double>(-accumulated);
+      accumulated++;
+    }
+    struct_batch->numElements = stripe_row_count;
+    long_batch->numElements = stripe_row_count;
+    double_batch->numElements = stripe_row_count;
+
+    writer->add(*batch);
+  }
+
+  writer->close();
+
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream.getData()),
+                               static_cast<int64_t>(mem_stream.getLength()))));
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_TRUE(
+      adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool(), &reader).ok());
+  ASSERT_EQ(stripe_count, reader->NumberOfStripes());
+
+  std::vector<int> field_indices;
+  ASSERT_TRUE(reader->GetFieldIndices(&field_indices).ok());
+  ASSERT_EQ(std::vector<int>({1, 2}), field_indices);
+
+  for (int64_t j = 0; j < static_cast<int64_t>(stripe_count); ++j) {
+    const int64_t first = j * stripe_row_count, last = first + stripe_row_count - 1;
+
+    std::vector<adapters::orc::StripeFieldStatistics> statistics;
+    ASSERT_TRUE(reader->ReadStripeStatistics(j, &statistics).ok());
+    ASSERT_EQ(2, statistics.size());
+    EXPECT_EQ(static_cast<int64_t>(stripe_row_count), statistics[0].num_values);
+    EXPECT_FALSE(statistics[0].has_null);
+    ASSERT_NE(nullptr, statistics[0].min);
+    EXPECT_TRUE(statistics[0].min->Equals(Int32Scalar(static_cast<int32_t>(first))));
+    EXPECT_TRUE(statistics[0].max->Equals(Int32Scalar(static_cast<int32_t>(last))));
+    ASSERT_NE(nullptr, statistics[1].min);
+    EXPECT_TRUE(statistics[1].min->Equals(DoubleScalar(static_cast<double>(-last))));
+    EXPECT_TRUE(statistics[1].max->Equals(DoubleScalar(static_cast<double>(-first))));
+
+    // Read the stripes backwards, with only the first column
+    const int64_t stripe = stripe_count - 1 - j;
+    std::shared_ptr<RecordBatchReader> stripe_reader;
+    ASSERT_TRUE(reader->GetStripeReader(stripe, 1024, {field_indices[0]}, &stripe_reader)
+                    .ok());
+    ASSERT_EQ(1, stripe_reader->schema()->num_fields());
+    int64_t expected = stripe * stripe_row_count;
+    std::shared_ptr<RecordBatch> record_batch;
+    EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
+    while (record_batch) {
+      auto int32_array = std::dynamic_pointer_cast<Int32Array>(record_batch->column(0));
+      for (int i = 0; i < record_batch->num_rows(); ++i) {
+        EXPECT_EQ(expected++, int32_array->Value(i));
+      }
+      EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
+    }
+    EXPECT_EQ((stripe + 1) * static_cast<int64_t>(stripe_row_count), expected);
+  }
+
+  std::vector<adapters::orc::StripeFieldStatistics> statistics;
+  EXPECT_FALSE(reader->ReadStripeStatistics(stripe_count, &statistics).ok());
+}
+
 }  // namespace arrow
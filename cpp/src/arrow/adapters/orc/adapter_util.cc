@@ -19,12 +19,14 @@
 #include <vector>
 
 #include "arrow/adapters/orc/adapter_util.h"
+
+#include <algorithm>
+
 #include "arrow/array/builder_base.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
-#include "arrow/util/range.h"
 
 #include "orc/Exceptions.hh"
 #include "orc/OrcFile.hh"
@@ -43,6 +45,28 @@ using internal::checked_cast;
 // The numer of nanoseconds in a second
 constexpr int64_t kOneSecondNanos = 1000000000LL;
 
+// The number of values converted at a time into a stack buffer, before being
+// appended in bulk
+constexpr int64_t kConvertChunkSize = 1024;
+
+// Append the values transform(0), ..., transform(length - 1), converted by chunks
+// so that the builder copies them and packs the valid bytes in bulk.
+template <class target_type, class builder_type, class Transform>
+Status AppendConverted(builder_type* builder, int64_t length, const uint8_t* valid_bytes,
+                       Transform&& transform) {
+  RETURN_NOT_OK(builder->Reserve(length));
+  target_type chunk[kConvertChunkSize];
+  for (int64_t start = 0; start < length; start += kConvertChunkSize) {
+    const int64_t chunk_length = std::min(kConvertChunkSize, length - start);
+    for (int64_t i = 0; i < chunk_length; i++) {
+      chunk[i] = transform(start + i);
+    }
+    RETURN_NOT_OK(builder->AppendValues(
+        chunk, chunk_length, valid_bytes == nullptr ? nullptr : valid_bytes + start));
+  }
+  return Status::OK();
+}
+
 Status AppendStructBatch(const liborc::Type* type, liborc::ColumnVectorBatch* cbatch,
                          int64_t offset, int64_t length, ArrayBuilder* abuilder) {
   auto builder = checked_cast<StructBuilder*>(abuilder);
@@ -142,13 +166,9 @@ Status AppendNumericBatchCast(liborc::ColumnVectorBatch* cbatch, int64_t offset,
     valid_bytes = reinterpret_cast<const uint8_t*>(batch->notNull.data()) + offset;
   }
   const source_type* source = batch->data.data() + offset;
-  auto cast_iter = internal::MakeLazyRange(
-      [&source](int64_t index) { return static_cast<target_type>(source[index]); },
-      length);
-
-  RETURN_NOT_OK(builder->AppendValues(cast_iter.begin(), cast_iter.end(), valid_bytes));
-
-  return Status::OK();
+  return AppendConverted<target_type>(builder, length, valid_bytes, [source](int64_t i) {
+    return static_cast<target_type>(source[i]);
+  });
 }
 
 Status AppendBoolBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset, int64_t length,
@@ -165,13 +185,9 @@ Status AppendBoolBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset, int64_
     valid_bytes = reinterpret_cast<const uint8_t*>(batch->notNull.data()) + offset;
   }
   const int64_t* source = batch->data.data() + offset;
-
-  auto cast_iter = internal::MakeLazyRange(
-      [&source](int64_t index) { return static_cast<bool>(source[index]); }, length);
-
-  RETURN_NOT_OK(builder->AppendValues(cast_iter.begin(), cast_iter.end(), valid_bytes));
-
-  return Status::OK();
+  return AppendConverted<uint8_t>(builder, length, valid_bytes, [source](int64_t i) {
+    return static_cast<uint8_t>(source[i] != 0);
+  });
 }
 
 Status AppendTimestampBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
@@ -191,15 +207,9 @@ Status AppendTimestampBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   const int64_t* seconds = batch->data.data() + offset;
   const int64_t* nanos = batch->nanoseconds.data() + offset;
 
-  auto transform_timestamp = [seconds, nanos](int64_t index) {
-    return seconds[index] * kOneSecondNanos + nanos[index];
-  };
-
-  auto transform_range = internal::MakeLazyRange(transform_timestamp, length);
-
-  RETURN_NOT_OK(
-      builder->AppendValues(transform_range.begin(), transform_range.end(), valid_bytes));
-  return Status::OK();
+  return AppendConverted<int64_t>(
+      builder, length, valid_bytes,
+      [seconds, nanos](int64_t i) { return seconds[i] * kOneSecondNanos + nanos[i]; });
 }
 
 template <class builder_type>
@@ -208,13 +218,23 @@ Status AppendBinaryBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   auto builder = checked_cast<builder_type*>(abuilder);
   auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
+  // Reserve the offsets and the character data of the whole range up front,
+  // the batch buffers being reused by the reader for the next batch
   const bool has_nulls = batch->hasNulls;
+  int64_t data_length = 0;
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(
-          builder->Append(batch->data[i], static_cast<int32_t>(batch->length[i])));
+      data_length += batch->length[i];
+    }
+  }
+  RETURN_NOT_OK(builder->Reserve(length));
+  RETURN_NOT_OK(builder->ReserveData(data_length));
+
+  for (int64_t i = offset; i < length + offset; i++) {
+    if (!has_nulls || batch->notNull[i]) {
+      builder->UnsafeAppend(batch->data[i], static_cast<int32_t>(batch->length[i]));
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -225,12 +245,13 @@ Status AppendFixedBinaryBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   auto builder = checked_cast<FixedSizeBinaryBuilder*>(abuilder);
   auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
+  RETURN_NOT_OK(builder->Reserve(length));
   const bool has_nulls = batch->hasNulls;
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(builder->Append(batch->data[i]));
+      builder->UnsafeAppend(reinterpret_cast<const uint8_t*>(batch->data[i]));
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -155,8 +155,6 @@ Status AdaptiveIntBuilder::CommitPendingData() {
   return Status::OK();
 }
 
-static constexpr int64_t kAdaptiveIntChunkSize = 8192;
-
 Status AdaptiveIntBuilder::AppendValuesInternal(const int64_t* values, int64_t length,
                                                 const uint8_t* valid_bytes) {
   if (pending_pos_ > 0) {
@@ -165,51 +163,41 @@ Status AdaptiveIntBuilder::AppendValuesInternal(const int64_t* values, int64_t l
     length_ -= pending_pos_;
   }
 
-  while (length > 0) {
-    // In case `length` is very large, we don't want to trash the cache by
-    // scanning it twice (first to detect int width, second to copy the data).
-    // Instead, process data in L2-cacheable chunks.
-    const int64_t chunk_size = std::min(length, kAdaptiveIntChunkSize);
-
-    uint8_t new_int_size;
-    new_int_size = internal::DetectIntWidth(values, valid_bytes, chunk_size, int_size_);
-
-    DCHECK_GE(new_int_size, int_size_);
-    if (new_int_size > int_size_) {
-      // This updates int_size_
-      RETURN_NOT_OK(ExpandIntSize(new_int_size));
-    }
-
-    switch (int_size_) {
-      case 1:
-        internal::DowncastInts(values, reinterpret_cast<int8_t*>(raw_data_) + length_,
-                               chunk_size);
-        break;
-      case 2:
-        internal::DowncastInts(values, reinterpret_cast<int16_t*>(raw_data_) + length_,
-                               chunk_size);
-        break;
-      case 4:
-        internal::DowncastInts(values, reinterpret_cast<int32_t*>(raw_data_) + length_,
-                               chunk_size);
-        break;
-      case 8:
-        internal::DowncastInts(values, reinterpret_cast<int64_t*>(raw_data_) + length_,
-                               chunk_size);
-        break;
-      default:
-        DCHECK(false);
-    }
-
-    // UnsafeAppendToBitmap increments length_ by chunk_size
-    ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, chunk_size);
-    values += chunk_size;
-    if (valid_bytes != nullptr) {
-      valid_bytes += chunk_size;
-    }
-    length -= chunk_size;
+  // Detect the width needed by the whole block first, so that the values already
+  // appended are widened at most once, then narrow the block in a single pass.
+  // Detection stops scanning as soon as the widest type is needed.
+  const uint8_t new_int_size =
+      internal::DetectIntWidth(values, valid_bytes, length, int_size_);
+
+  DCHECK_GE(new_int_size, int_size_);
+  if (new_int_size > int_size_) {
+    // This updates int_size_
+    RETURN_NOT_OK(ExpandIntSize(new_int_size));
+  }
+
+  switch (int_size_) {
+    case 1:
+      internal::DowncastInts(values, reinterpret_cast<int8_t*>(raw_data_) + length_,
+                             length);
+      break;
+    case 2:
+      internal::DowncastInts(values, reinterpret_cast<int16_t*>(raw_data_) + length_,
+                             length);
+      break;
+    case 4:
+      internal::DowncastInts(values, reinterpret_cast<int32_t*>(raw_data_) + length_,
+                             length);
+      break;
+    case 8:
+      internal::DowncastInts(values, reinterpret_cast<int64_t*>(raw_data_) + length_,
+                             length);
+      break;
+    default:
+      DCHECK(false);
   }
 
+  // UnsafeAppendToBitmap increments length_ by length
+  ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
   return Status::OK();
 }
 
@@ -291,54 +279,45 @@ Status AdaptiveUIntBuilder::AppendValuesInternal(const uint64_t* values, int64_t
     length_ -= pending_pos_;
   }
 
-  while (length > 0) {
-    // See AdaptiveIntBuilder::AppendValuesInternal
-    const int64_t chunk_size = std::min(length, kAdaptiveIntChunkSize);
-
-    uint8_t new_int_size;
-    new_int_size = internal::DetectUIntWidth(values, valid_bytes, chunk_size, int_size_);
-
-    DCHECK_GE(new_int_size, int_size_);
-    if (new_int_size > int_size_) {
-      // This updates int_size_
-      RETURN_NOT_OK(ExpandIntSize(new_int_size));
-    }
-
-    switch (int_size_) {
-      case 1:
-        internal::DowncastUInts(values, reinterpret_cast<uint8_t*>(raw_data_) + length_,
-                                chunk_size);
-        break;
-      case 2:
-        internal::DowncastUInts(values, reinterpret_cast<uint16_t*>(raw_data_) + length_,
-                                chunk_size);
-        break;
-      case 4:
-        internal::DowncastUInts(values, reinterpret_cast<uint32_t*>(raw_data_) + length_,
-                                chunk_size);
-        break;
-      case 8:
-        internal::DowncastUInts(values, reinterpret_cast<uint64_t*>(raw_data_) + length_,
-                                chunk_size);
-        break;
-      default:
-        DCHECK(false);
-    }
-
-    // UnsafeAppendToBitmap increments length_ by chunk_size
-    ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, chunk_size);
-    values += chunk_size;
-    if (valid_bytes != nullptr) {
-      valid_bytes += chunk_size;
-    }
-    length -= chunk_size;
+  // See AdaptiveIntBuilder::AppendValuesInternal
+  const uint8_t new_int_size =
+      internal::DetectUIntWidth(values, valid_bytes, length, int_size_);
+
+  DCHECK_GE(new_int_size, int_size_);
+  if (new_int_size > int_size_) {
+    // This updates int_size_
+    RETURN_NOT_OK(ExpandIntSize(new_int_size));
   }
 
+  switch (int_size_) {
+    case 1:
+      internal::DowncastUInts(values, reinterpret_cast<uint8_t*>(raw_data_) + length_,
+                              length);
+      break;
+    case 2:
+      internal::DowncastUInts(values, reinterpret_cast<uint16_t*>(raw_data_) + length_,
+                              length);
+      break;
+    case 4:
+      internal::DowncastUInts(values, reinterpret_cast<uint32_t*>(raw_data_) + length_,
+                              length);
+      break;
+    case 8:
+      internal::DowncastUInts(values, reinterpret_cast<uint64_t*>(raw_data_) + length_,
+                              length);
+      break;
+    default:
+      DCHECK(false);
+  }
+
+  // UnsafeAppendToBitmap increments length_ by length
+  ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
   return Status::OK();
 }
 
 Status AdaptiveUIntBuilder::AppendValues(const uint64_t* values, int64_t length,
                                          const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(CommitPendingData());
   RETURN_NOT_OK(Reserve(length));
 
   return AppendValuesInternal(values, length, valid_bytes);
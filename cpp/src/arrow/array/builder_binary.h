@@ -222,6 +222,36 @@ class BaseBinaryBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a sequence of values stored contiguously, e.g. the data of
+  /// another binary array or a parser buffer, in one shot.
+  ///
+  /// The data of the i-th value spans data[offsets[i]:offsets[i + 1]], and is
+  /// copied even if the value is null.
+  ///
+  /// \param[in] offsets length + 1 offsets into data
+  /// \param[in] data the contiguous value data
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const offset_type* offsets, const uint8_t* data, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR) {
+    const int64_t data_length = static_cast<int64_t>(offsets[length] - offsets[0]);
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(data_length));
+
+    const int64_t rebase = value_data_builder_.length() - offsets[0];
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + rebase));
+    }
+    // Safety check for UBSAN.
+    if (ARROW_PREDICT_TRUE(data_length > 0)) {
+      value_data_builder_.UnsafeAppend(data + offsets[0], data_length);
+    }
+    UnsafeAppendToBitmap(valid_bytes, length);
+    return Status::OK();
+  }
+
   void Reset() override {
     ArrayBuilder::Reset();
     offsets_builder_.Reset();
@@ -253,6 +283,20 @@ class BaseBinaryBuilder : public ArrayBuilder {
                                           : Status::OK();
   }
 
+  /// \brief Reserve value data for the indicated number of values, estimated
+  /// from the average length of the values appended so far
+  ///
+  /// This is a no-op if no value was appended yet.  The estimate is capped to
+  /// the remaining capacity of the builder.
+  Status ReserveEstimatedData(int64_t num_values) {
+    if (length_ == 0 || num_values <= 0) {
+      return Status::OK();
+    }
+    const int64_t average_length = (value_data_length() + length_ - 1) / length_;
+    return ReserveData(std::min(num_values * average_length,
+                                memory_limit() - value_data_length()));
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
     // Write final offset (values length)
     ARROW_RETURN_NOT_OK(AppendNextOffset());
@@ -79,9 +79,7 @@ Status BooleanBuilder::AppendValues(const uint8_t* values, int64_t length,
                                     const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
 
-  int64_t i = 0;
-  data_builder_.UnsafeAppend<false>(length,
-                                    [values, &i]() -> bool { return values[i++] != 0; });
+  data_builder_.UnsafeAppend(values, length);
   ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
   return Status::OK();
 }
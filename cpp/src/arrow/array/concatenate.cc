@@ -18,6 +18,7 @@
 #include "arrow/array/concatenate.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -26,7 +27,9 @@
 #include "arrow/array.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/visibility.h"
 #include "arrow/visitor_inline.h"
 
@@ -53,27 +56,99 @@ struct Bitmap {
   bool AllSet() const { return data == nullptr; }
 };
 
+// Inputs of at least this many bytes are copied in parallel, if requested.
+constexpr int64_t kMinParallelCopyBytes = 1 << 20;
+
+// Call copy_range(begin, end) on the ranges of a partition of [0, length), whose
+// bounds are multiples of alignment.  The ranges are copied in parallel on the
+// CPU thread pool if use_threads is true and the copy spans enough bytes.
+template <typename CopyRange>
+static Status CopyRanges(bool use_threads, int64_t length, int64_t alignment,
+                         int64_t num_bytes, CopyRange&& copy_range) {
+  int num_tasks = 1;
+  if (use_threads && num_bytes >= kMinParallelCopyBytes) {
+    num_tasks = internal::GetCpuThreadPool()->GetCapacity();
+  }
+  if (num_tasks <= 1) {
+    copy_range(0, length);
+    return Status::OK();
+  }
+
+  const int64_t range_length =
+      BitUtil::RoundUp(BitUtil::CeilDiv(length, num_tasks), alignment);
+  num_tasks = static_cast<int>(BitUtil::CeilDiv(length, range_length));
+  return internal::ParallelFor(num_tasks, [&](int i) {
+    copy_range(i * range_length, std::min(length, (i + 1) * range_length));
+    return Status::OK();
+  });
+}
+
+// Given the positions of consecutive pieces of the output (with a final
+// position for the end of the last piece), call
+// visit(piece_index, offset_in_piece, out_offset, length) on each part of a
+// piece which overlaps the output range [begin, end).
+template <typename Visit>
+static void VisitPieces(const std::vector<int64_t>& positions, int64_t begin,
+                        int64_t end, Visit&& visit) {
+  size_t i = std::upper_bound(positions.begin(), positions.end(), begin) -
+             positions.begin() - 1;
+  for (; i + 1 < positions.size() && positions[i] < end; ++i) {
+    const int64_t piece_begin = std::max(begin, positions[i]);
+    const int64_t piece_end = std::min(end, positions[i + 1]);
+    if (piece_end > piece_begin) {
+      visit(i, piece_begin - positions[i], piece_begin, piece_end - piece_begin);
+    }
+  }
+}
+
+// Allocate a buffer and concatenate buffers into it.
+static Status ConcatenateBuffersImpl(const BufferVector& buffers, bool use_threads,
+                                     MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  std::vector<int64_t> positions(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    positions[i + 1] = positions[i] + buffers[i]->size();
+  }
+  const int64_t out_length = positions.back();
+  ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer(out_length, pool));
+  uint8_t* dst = (*out)->mutable_data();
+
+  auto copy_range = [&](int64_t begin, int64_t end) {
+    VisitPieces(positions, begin, end,
+                [&](size_t i, int64_t offset, int64_t out_offset, int64_t length) {
+                  std::memcpy(dst + out_offset, buffers[i]->data() + offset,
+                              static_cast<size_t>(length));
+                });
+  };
+  return CopyRanges(use_threads, out_length, /*alignment=*/1, out_length, copy_range);
+}
+
 // Allocate a buffer and concatenate bitmaps into it.
-static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool* pool,
-                                 std::shared_ptr<Buffer>* out) {
-  int64_t out_length = 0;
+static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, bool use_threads,
+                                 MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  std::vector<int64_t> positions(bitmaps.size() + 1, 0);
   for (size_t i = 0; i < bitmaps.size(); ++i) {
-    out_length += bitmaps[i].range.length;
+    positions[i + 1] = positions[i] + bitmaps[i].range.length;
   }
+  const int64_t out_length = positions.back();
   ARROW_ASSIGN_OR_RAISE(*out, AllocateBitmap(out_length, pool));
   uint8_t* dst = (*out)->mutable_data();
 
-  int64_t bitmap_offset = 0;
-  for (size_t i = 0; i < bitmaps.size(); ++i) {
-    auto bitmap = bitmaps[i];
-    if (bitmap.AllSet()) {
-      BitUtil::SetBitsTo(dst, bitmap_offset, bitmap.range.length, true);
-    } else {
-      internal::CopyBitmap(bitmap.data, bitmap.range.offset, bitmap.range.length, dst,
-                           bitmap_offset, false);
-    }
-    bitmap_offset += bitmap.range.length;
-  }
+  // The output is split on byte boundaries, so that no byte is written by two
+  // parallel copies
+  auto copy_range = [&](int64_t begin, int64_t end) {
+    VisitPieces(positions, begin, end,
+                [&](size_t i, int64_t offset, int64_t out_offset, int64_t length) {
+                  const auto& bitmap = bitmaps[i];
+                  if (bitmap.AllSet()) {
+                    BitUtil::SetBitsTo(dst, out_offset, length, true);
+                  } else {
+                    internal::CopyBitmap(bitmap.data, bitmap.range.offset + offset,
+                                         length, dst, out_offset, false);
+                  }
+                });
+  };
+  RETURN_NOT_OK(CopyRanges(use_threads, out_length, /*alignment=*/8,
+                           BitUtil::BytesForBits(out_length), copy_range));
 
   // finally (if applicable) zero out any trailing bits
   if (auto preceding_bits = BitUtil::kPrecedingBitmask[out_length % 8]) {
@@ -82,70 +157,62 @@ static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool*
   return Status::OK();
 }
 
-// Write offsets in src into dst, adjusting them such that first_offset
-// will be the first offset written.
-template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range);
-
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
+// The offsets of each buffer are adjusted so that they start at the
+// cumulative length of values spanned by the previous buffers.
 template <typename Offset>
-static Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
-                                 std::shared_ptr<Buffer>* out,
+static Status ConcatenateOffsets(const BufferVector& buffers, bool use_threads,
+                                 MemoryPool* pool, std::shared_ptr<Buffer>* out,
                                  std::vector<Range>* values_ranges) {
   values_ranges->resize(buffers.size());
 
-  // allocate output buffer
-  int64_t out_length = 0;
+  std::vector<int64_t> positions(buffers.size() + 1, 0);
+  std::vector<Offset> adjustments(buffers.size());
+  Offset values_length = 0;
   for (size_t i = 0; i < buffers.size(); ++i) {
-    out_length += buffers[i]->size() / sizeof(Offset);
+    positions[i + 1] = positions[i] + buffers[i]->size() / sizeof(Offset);
+
+    // Compute the range of values which is spanned by this range of offsets
+    const auto& src = buffers[i];
+    auto src_begin = reinterpret_cast<const Offset*>(src->data());
+    auto src_end = reinterpret_cast<const Offset*>(src->data() + src->size());
+    Range* values_range = &values_ranges->at(i);
+    values_range->offset = src_begin[0];
+    values_range->length = *src_end - values_range->offset;
+    if (values_length > std::numeric_limits<Offset>::max() - values_range->length) {
+      return Status::Invalid("offset overflow while concatenating arrays");
+    }
+    adjustments[i] = values_length - src_begin[0];
+    values_length += static_cast<Offset>(values_range->length);
   }
+
+  // allocate output buffer
+  const int64_t out_length = positions.back();
   ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer((out_length + 1) * sizeof(Offset), pool));
   auto dst = reinterpret_cast<Offset*>((*out)->mutable_data());
 
-  int64_t elements_length = 0;
-  Offset values_length = 0;
-  for (size_t i = 0; i < buffers.size(); ++i) {
-    // the first offset from buffers[i] will be adjusted to values_length
-    // (the cumulative length of values spanned by offsets in previous buffers)
-    RETURN_NOT_OK(PutOffsets<Offset>(buffers[i], values_length, &dst[elements_length],
-                                     &values_ranges->at(i)));
-    elements_length += buffers[i]->size() / sizeof(Offset);
-    values_length += static_cast<Offset>(values_ranges->at(i).length);
-  }
+  auto copy_range = [&](int64_t begin, int64_t end) {
+    VisitPieces(positions, begin, end,
+                [&](size_t i, int64_t offset, int64_t out_offset, int64_t length) {
+                  auto src = reinterpret_cast<const Offset*>(buffers[i]->data()) + offset;
+                  const Offset adjustment = adjustments[i];
+                  std::transform(src, src + length, dst + out_offset,
+                                 [adjustment](Offset v) { return v + adjustment; });
+                });
+  };
+  RETURN_NOT_OK(CopyRanges(use_threads, out_length, /*alignment=*/1,
+                           out_length * sizeof(Offset), copy_range));
 
   // the final element in dst is the length of all values spanned by the offsets
   dst[out_length] = values_length;
   return Status::OK();
 }
 
-template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range) {
-  // Get the range of offsets to transfer from src
-  auto src_begin = reinterpret_cast<const Offset*>(src->data());
-  auto src_end = reinterpret_cast<const Offset*>(src->data() + src->size());
-
-  // Compute the range of values which is spanned by this range of offsets
-  values_range->offset = src_begin[0];
-  values_range->length = *src_end - values_range->offset;
-  if (first_offset > std::numeric_limits<Offset>::max() - values_range->length) {
-    return Status::Invalid("offset overflow while concatenating arrays");
-  }
-
-  // Write offsets into dst, ensuring that the first offset written is
-  // first_offset
-  auto adjustment = first_offset - src_begin[0];
-  std::transform(src_begin, src_end, dst,
-                 [adjustment](Offset offset) { return offset + adjustment; });
-  return Status::OK();
-}
-
 class ConcatenateImpl {
  public:
-  ConcatenateImpl(const std::vector<ArrayData>& in, MemoryPool* pool)
-      : in_(in), pool_(pool) {
+  ConcatenateImpl(const std::vector<ArrayData>& in, MemoryPool* pool, bool use_threads)
+      : in_(in), pool_(pool), use_threads_(use_threads) {
     out_.type = in[0].type;
     for (size_t i = 0; i < in_.size(); ++i) {
       out_.length += in[i].length;
@@ -164,7 +231,8 @@ class ConcatenateImpl {
 
   Status Concatenate(ArrayData* out) && {
     if (out_.null_count != 0) {
-      RETURN_NOT_OK(ConcatenateBitmaps(Bitmaps(0), pool_, &out_.buffers[0]));
+      RETURN_NOT_OK(
+          ConcatenateBitmaps(Bitmaps(0), use_threads_, pool_, &out_.buffers[0]));
     }
     RETURN_NOT_OK(VisitTypeInline(*out_.type, this));
     *out = std::move(out_);
@@ -174,52 +242,56 @@ class ConcatenateImpl {
   Status Visit(const NullType&) { return Status::OK(); }
 
   Status Visit(const BooleanType&) {
-    return ConcatenateBitmaps(Bitmaps(1), pool_, &out_.buffers[1]);
+    return ConcatenateBitmaps(Bitmaps(1), use_threads_, pool_, &out_.buffers[1]);
   }
 
   Status Visit(const FixedWidthType& fixed) {
     // handles numbers, decimal128, fixed_size_binary
-    return ConcatenateBuffers(Buffers(1, fixed), pool_).Value(&out_.buffers[1]);
+    return ConcatenateBuffersImpl(Buffers(1, fixed), use_threads_, pool_,
+                                  &out_.buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
     std::vector<Range> value_ranges;
-    RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateBuffers(Buffers(2, value_ranges), pool_).Value(&out_.buffers[2]);
+    RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), use_threads_,
+                                              pool_, &out_.buffers[1], &value_ranges));
+    return ConcatenateBuffersImpl(Buffers(2, value_ranges), use_threads_, pool_,
+                                  &out_.buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
     std::vector<Range> value_ranges;
-    RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateBuffers(Buffers(2, value_ranges), pool_).Value(&out_.buffers[2]);
+    RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), use_threads_,
+                                              pool_, &out_.buffers[1], &value_ranges));
+    return ConcatenateBuffersImpl(Buffers(2, value_ranges), use_threads_, pool_,
+                                  &out_.buffers[2]);
   }
 
   Status Visit(const ListType&) {
     std::vector<Range> value_ranges;
-    RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateImpl(ChildData(0, value_ranges), pool_)
+    RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), use_threads_,
+                                              pool_, &out_.buffers[1], &value_ranges));
+    return ConcatenateImpl(ChildData(0, value_ranges), pool_, use_threads_)
         .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const LargeListType&) {
     std::vector<Range> value_ranges;
-    RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateImpl(ChildData(0, value_ranges), pool_)
+    RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), use_threads_,
+                                              pool_, &out_.buffers[1], &value_ranges));
+    return ConcatenateImpl(ChildData(0, value_ranges), pool_, use_threads_)
         .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const FixedSizeListType&) {
-    return ConcatenateImpl(ChildData(0), pool_).Concatenate(out_.child_data[0].get());
+    return ConcatenateImpl(ChildData(0), pool_, use_threads_)
+        .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const StructType& s) {
     for (int i = 0; i < s.num_children(); ++i) {
-      RETURN_NOT_OK(
-          ConcatenateImpl(ChildData(i), pool_).Concatenate(out_.child_data[i].get()));
+      RETURN_NOT_OK(ConcatenateImpl(ChildData(i), pool_, use_threads_)
+                        .Concatenate(out_.child_data[i].get()));
     }
     return Status::OK();
   }
@@ -240,7 +312,8 @@ class ConcatenateImpl {
 
     if (dictionaries_same) {
       out_.dictionary = in_[0].dictionary;
-      return ConcatenateBuffers(Buffers(1, *fixed), pool_).Value(&out_.buffers[1]);
+      return ConcatenateBuffersImpl(Buffers(1, *fixed), use_threads_, pool_,
+                                    &out_.buffers[1]);
     } else {
       return Status::NotImplemented("Concat with dictionary unification NYI");
     }
@@ -353,11 +426,17 @@ class ConcatenateImpl {
 
   const std::vector<ArrayData>& in_;
   MemoryPool* pool_;
+  bool use_threads_;
   ArrayData out_;
 };
 
 Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
                    std::shared_ptr<Array>* out) {
+  return Concatenate(arrays, pool, /*use_threads=*/false, out);
+}
+
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool, bool use_threads,
+                   std::shared_ptr<Array>* out) {
   if (arrays.size() == 0) {
     return Status::Invalid("Must pass at least one array");
   }
@@ -374,7 +453,7 @@ Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
   }
 
   ArrayData out_data;
-  RETURN_NOT_OK(ConcatenateImpl(data, pool).Concatenate(&out_data));
+  RETURN_NOT_OK(ConcatenateImpl(data, pool, use_threads).Concatenate(&out_data));
   *out = MakeArray(std::make_shared<ArrayData>(std::move(out_data)));
   return Status::OK();
 }
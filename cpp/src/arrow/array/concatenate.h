@@ -36,4 +36,19 @@ ARROW_EXPORT
 Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
                    std::shared_ptr<Array>* out);
 
+/// \brief Concatenate arrays, optionally in parallel
+///
+/// If use_threads is true, the buffers of large inputs are copied into the
+/// output in parallel on the CPU thread pool.  This waits for the copies, so
+/// it should not be called with use_threads from a task of the CPU thread pool.
+///
+/// \param[in] arrays a vector of arrays to be concatenated
+/// \param[in] pool memory to store the result will be allocated from this memory pool
+/// \param[in] use_threads whether to copy the buffers in parallel
+/// \param[out] out the resulting concatenated array
+/// \return Status
+ARROW_EXPORT
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool, bool use_threads,
+                   std::shared_ptr<Array>* out);
+
 }  // namespace arrow
@@ -232,6 +232,37 @@ TEST_F(ConcatenateTest, DISABLED_UnionType) {
   });
 }
 
+TEST_F(ConcatenateTest, UseThreads) {
+  // Large enough for the buffers to be copied in parallel, in many slices
+  const int32_t size = 1 << 18;
+  auto offsets = this->Offsets<int32_t>(size, 1000);
+  for (auto null_probability : {0.0, 0.3}) {
+    std::vector<std::shared_ptr<Array>> arrays = {
+        GeneratePrimitive<BooleanType>(size * 40, null_probability),
+        GeneratePrimitive<Int64Type>(size, null_probability),
+        rng_.String(size, /*min_length =*/0, /*max_length =*/15, null_probability)};
+    for (const auto& array : arrays) {
+      const int64_t scale = array->length() / size;
+      std::vector<int32_t> array_offsets(offsets.size());
+      std::transform(offsets.begin(), offsets.end(), array_offsets.begin(),
+                     [scale](int32_t offset) { return offset * scale; });
+      auto expected = array->Slice(array_offsets.front(),
+                                   array_offsets.back() - array_offsets.front());
+      std::shared_ptr<Array> actual;
+      ASSERT_OK(Concatenate(Slices(array, array_offsets), default_memory_pool(),
+                            /*use_threads=*/true, &actual));
+      ASSERT_OK(actual->ValidateFull());
+      AssertArraysEqual(*expected, *actual);
+      if (actual->data()->buffers[0]) {
+        CheckTrailingBitsAreZeroed(actual->data()->buffers[0], actual->length());
+      }
+      if (actual->type_id() == Type::BOOL) {
+        CheckTrailingBitsAreZeroed(actual->data()->buffers[1], actual->length());
+      }
+    }
+  }
+}
+
 TEST_F(ConcatenateTest, OffsetOverflow) {
   auto fake_long = ArrayFromJSON(utf8(), "[\"\"]");
   fake_long->data()->GetMutableValues<int32_t>(1)[1] =
@@ -203,7 +203,7 @@ Result<std::shared_ptr<Array>> DictionaryArray::Transpose(
   // Default path: compute a buffer of transposed indices.
   ARROW_ASSIGN_OR_RAISE(
       auto out_buffer,
-      AllocateBuffer(data_->length * out_index_type.bit_width() * CHAR_BIT, pool));
+      AllocateBuffer(data_->length * out_index_type.bit_width() / CHAR_BIT, pool));
 
   // Shift null buffer if the original offset is non-zero
   std::shared_ptr<Buffer> null_bitmap;
@@ -17,10 +17,13 @@
 
 #include "arrow/array/validate.h"
 
+#include <algorithm>
+
 #include "arrow/array.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -363,6 +366,15 @@ Status ValidateArray(const Array& array) {
 
 namespace {
 
+// The number of values checked at once by the branch-free, vectorizable loops
+// below.  A block failing the check is rescanned value by value to find and
+// report the error.
+constexpr int64_t kValidationBlockSize = 1024;
+
+// Validating fewer values than this in total isn't worth spreading over
+// the CPU thread pool
+constexpr int64_t kParallelValidationThreshold = 1 << 16;
+
 struct BoundsCheckVisitor {
   int64_t min_value_;
   int64_t max_value_;
@@ -374,7 +386,31 @@ struct BoundsCheckVisitor {
 
   template <typename T>
   Status Visit(const NumericArray<T>& array) {
-    for (int64_t i = 0; i < array.length(); ++i) {
+    const auto* values = array.raw_values();
+    for (int64_t block_start = 0; block_start < array.length();
+         block_start += kValidationBlockSize) {
+      const int64_t block_end =
+          std::min(block_start + kValidationBlockSize, array.length());
+      // Null slots may hold any value, so they are only skipped when a block
+      // has values out of bounds
+      auto block_min = static_cast<int64_t>(values[block_start]);
+      auto block_max = block_min;
+      for (int64_t i = block_start + 1; i < block_end; ++i) {
+        const auto v = static_cast<int64_t>(values[i]);
+        block_min = std::min(block_min, v);
+        block_max = std::max(block_max, v);
+      }
+      if (block_min < min_value_ || block_max > max_value_) {
+        RETURN_NOT_OK(CheckBlock(array, block_start, block_end));
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  Status CheckBlock(const NumericArray<T>& array, int64_t block_start,
+                    int64_t block_end) {
+    for (int64_t i = block_start; i < block_end; ++i) {
       if (!array.IsNull(i)) {
         const auto v = static_cast<int64_t>(array.Value(i));
         if (v < min_value_ || v > max_value_) {
@@ -495,24 +531,41 @@ struct ValidateArrayDataVisitor {
       return Status::Invalid("non-empty array but value_offsets_ is null");
     }
 
-    auto prev_offset = array.value_offset(0);
-    if (prev_offset < 0) {
+    const auto* offsets = array.raw_value_offsets();
+    if (offsets[0] < 0) {
       return Status::Invalid(
           "Offset invariant failure: array starts at negative "
           "offset ",
-          prev_offset);
+          offsets[0]);
+    }
+    for (int64_t block_start = 0; block_start < array.length();
+         block_start += kValidationBlockSize) {
+      const int64_t block_end =
+          std::min(block_start + kValidationBlockSize, array.length());
+      bool monotonic = true;
+      for (int64_t i = block_start; i < block_end; ++i) {
+        monotonic &= offsets[i + 1] >= offsets[i];
+      }
+      // Monotonic offsets are bounded by the last one of the block
+      if (!monotonic || offsets[block_end] > offset_limit) {
+        return CheckOffsetsBlock(offsets, block_start, block_end, offset_limit);
+      }
     }
-    for (int64_t i = 1; i <= array.length(); ++i) {
-      auto current_offset = array.value_offset(i);
-      if (current_offset < prev_offset) {
+    return Status::OK();
+  }
+
+  template <typename offset_type>
+  Status CheckOffsetsBlock(const offset_type* offsets, int64_t block_start,
+                           int64_t block_end, int64_t offset_limit) {
+    for (int64_t i = block_start + 1; i <= block_end; ++i) {
+      if (offsets[i] < offsets[i - 1]) {
         return Status::Invalid("Offset invariant failure: non-monotonic offset at slot ",
-                               i, ": ", current_offset, " < ", prev_offset);
+                               i, ": ", offsets[i], " < ", offsets[i - 1]);
       }
-      if (current_offset > offset_limit) {
+      if (offsets[i] > offset_limit) {
         return Status::Invalid("Offset invariant failure: offset for slot ", i,
-                               " out of bounds: ", current_offset, " > ", offset_limit);
+                               " out of bounds: ", offsets[i], " > ", offset_limit);
       }
-      prev_offset = current_offset;
     }
     return Status::OK();
   }
@@ -531,5 +584,12 @@ Status ValidateArrayData(const Array& array) {
   return VisitArrayInline(array, &visitor);
 }
 
+ARROW_EXPORT
+bool ValidateInParallel(int num_arrays, int64_t length) {
+  // Don't block a CPU pool worker on other tasks of the pool
+  return num_arrays > 1 && num_arrays * length >= kParallelValidationThreshold &&
+         !GetCpuThreadPool()->OwnsThisThread();
+}
+
 }  // namespace internal
 }  // namespace arrow
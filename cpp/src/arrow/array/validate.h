@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -35,5 +36,10 @@ Status ValidateArray(const Array& array);
 ARROW_EXPORT
 Status ValidateArrayData(const Array& array);
 
+// Whether to call ValidateArrayData() on 'num_arrays' arrays of 'length'
+// values each in parallel on the CPU thread pool, rather than sequentially.
+ARROW_EXPORT
+bool ValidateInParallel(int num_arrays, int64_t length);
+
 }  // namespace internal
 }  // namespace arrow
@@ -395,6 +395,45 @@ class TestStringBuilder : public TestBuilder {
     CheckStringArray(*result_, strings, valid_bytes, reps);
   }
 
+  void TestAppendContiguousValues() {
+    // The values "bb", "a", null, "", "ccc", and the offsets of a slice
+    const std::string data = "xxbbayyccc";
+    std::vector<offset_type> offsets = {2, 4, 5, 7, 7, 10};
+    std::vector<uint8_t> valid_bytes = {1, 1, 0, 1, 1};
+
+    int N = static_cast<int>(valid_bytes.size());
+    int reps = 100;
+
+    ASSERT_OK(builder_->Append("z"));
+    for (int j = 0; j < reps; ++j) {
+      ASSERT_OK(builder_->AppendValues(offsets.data(),
+                                       reinterpret_cast<const uint8_t*>(data.data()), N,
+                                       valid_bytes.data()));
+    }
+    ASSERT_OK(builder_->AppendValues(offsets.data(),
+                                     reinterpret_cast<const uint8_t*>(data.data()), 0));
+    ASSERT_OK(builder_->AppendValues(offsets.data() + 2,
+                                     reinterpret_cast<const uint8_t*>(data.data()), 2));
+    Done();
+
+    // The data of the null value is copied too
+    ASSERT_EQ(1 + reps * N + 2, result_->length());
+    ASSERT_EQ(reps, result_->null_count());
+    ASSERT_EQ(1 + reps * 8 + 2, result_->value_data()->size());
+
+    ASSERT_EQ(result_->GetString(0), "z");
+    for (int j = 0; j < reps; ++j) {
+      const int64_t base = 1 + j * N;
+      ASSERT_EQ(result_->GetString(base), "bb");
+      ASSERT_EQ(result_->GetString(base + 1), "a");
+      ASSERT_TRUE(result_->IsNull(base + 2));
+      ASSERT_EQ(result_->GetString(base + 3), "");
+      ASSERT_EQ(result_->GetString(base + 4), "ccc");
+    }
+    ASSERT_EQ(result_->GetString(1 + reps * N), "yy");
+    ASSERT_EQ(result_->GetString(2 + reps * N), "");
+  }
+
   void TestAppendCStringsWithValidBytes() {
     const char* strings[] = {nullptr, "aaa", nullptr, "ignored", ""};
     std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
@@ -473,6 +512,27 @@ class TestStringBuilder : public TestBuilder {
     ASSERT_EQ(reps * 40, result_->value_data()->size());
   }
 
+  void TestReserveEstimatedData() {
+    // Nothing to estimate from
+    ASSERT_OK(builder_->ReserveEstimatedData(1000));
+    ASSERT_EQ(0, builder_->value_data_capacity());
+
+    ASSERT_OK(builder_->Append("aaaaaaaaaa"));
+    ASSERT_OK(builder_->AppendNull());
+    ASSERT_OK(builder_->ReserveEstimatedData(100));
+    ASSERT_GE(builder_->value_data_capacity(), 10 + 100 * 5);
+
+    const int64_t capacity = builder_->value_data_capacity();
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_OK(builder_->Append("bbbbb"));
+    }
+    ASSERT_EQ(capacity, builder_->value_data_capacity());
+    Done();
+
+    ASSERT_EQ(102, result_->length());
+    ASSERT_EQ(1, result_->null_count());
+  }
+
   void TestZeroLength() {
     // All buffers are null
     Done();
@@ -493,6 +553,10 @@ TYPED_TEST(TestStringBuilder, TestScalarAppendUnsafe) { this->TestScalarAppendUn
 
 TYPED_TEST(TestStringBuilder, TestVectorAppend) { this->TestVectorAppend(); }
 
+TYPED_TEST(TestStringBuilder, TestAppendContiguousValues) {
+  this->TestAppendContiguousValues();
+}
+
 TYPED_TEST(TestStringBuilder, TestAppendCStringsWithValidBytes) {
   this->TestAppendCStringsWithValidBytes();
 }
@@ -503,6 +567,10 @@ TYPED_TEST(TestStringBuilder, TestAppendCStringsWithoutValidBytes) {
 
 TYPED_TEST(TestStringBuilder, TestCapacityReserve) { this->TestCapacityReserve(); }
 
+TYPED_TEST(TestStringBuilder, TestReserveEstimatedData) {
+  this->TestReserveEstimatedData();
+}
+
 TYPED_TEST(TestStringBuilder, TestZeroLength) { this->TestZeroLength(); }
 
 // ----------------------------------------------------------------------
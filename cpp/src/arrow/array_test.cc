@@ -1782,6 +1782,24 @@ TEST_F(TestAdaptiveIntBuilder, TestAppendValues) {
   this->template TestAppendValues<Int8Type>();
 }
 
+TEST_F(TestAdaptiveIntBuilder, TestAppendValuesAfterAppend) {
+  // Scalar appends still pending when a bulk append widens the builder
+  std::vector<int64_t> values(3000, -1);
+  values[2999] = std::numeric_limits<int32_t>::min();
+  std::vector<int32_t> expected_values = {1, -2, 3};
+  expected_values.insert(expected_values.end(), values.begin(), values.end());
+
+  ASSERT_OK(builder_->Append(1));
+  ASSERT_OK(builder_->Append(-2));
+  ASSERT_OK(builder_->Append(3));
+  ASSERT_OK(builder_->AppendValues(values.data(), values.size()));
+  AssertTypeEqual(*builder_->type(), *int32());
+  Done();
+
+  ArrayFromVector<Int32Type, int32_t>(expected_values, &expected_);
+  AssertArraysEqual(*expected_, *result_);
+}
+
 TEST_F(TestAdaptiveIntBuilder, TestAssertZeroPadded) {
   std::vector<int64_t> values(
       {0, static_cast<int64_t>(std::numeric_limits<int32_t>::max()) + 1});
@@ -1984,6 +2002,24 @@ TEST_F(TestAdaptiveUIntBuilder, TestAppendValues) {
   this->template TestAppendValues<UInt8Type>();
 }
 
+TEST_F(TestAdaptiveUIntBuilder, TestAppendValuesAfterAppend) {
+  // Scalar appends still pending when a bulk append widens the builder
+  std::vector<uint64_t> values(3000, 1);
+  values[2999] = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> expected_values = {7, 8, 9};
+  expected_values.insert(expected_values.end(), values.begin(), values.end());
+
+  ASSERT_OK(builder_->Append(7));
+  ASSERT_OK(builder_->Append(8));
+  ASSERT_OK(builder_->Append(9));
+  ASSERT_OK(builder_->AppendValues(values.data(), values.size()));
+  AssertTypeEqual(*builder_->type(), *uint32());
+  Done();
+
+  ArrayFromVector<UInt32Type, uint32_t>(expected_values, &expected_);
+  AssertArraysEqual(*expected_, *result_);
+}
+
 TEST_F(TestAdaptiveUIntBuilder, TestAssertZeroPadded) {
   std::vector<uint64_t> values(
       {0, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1});
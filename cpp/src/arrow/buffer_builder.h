@@ -211,7 +211,7 @@ class TypedBufferBuilder<
   }
 
   Status Append(const int64_t num_copies, T value) {
-    ARROW_RETURN_NOT_OK(Reserve(num_copies + length()));
+    ARROW_RETURN_NOT_OK(Reserve(num_copies));
     UnsafeAppend(num_copies, value);
     return Status::OK();
   }
@@ -301,12 +301,9 @@ class TypedBufferBuilder<bool> {
 
   void UnsafeAppend(const uint8_t* bytes, int64_t num_elements) {
     if (num_elements == 0) return;
-    int64_t i = 0;
-    internal::GenerateBitsUnrolled(mutable_data(), bit_length_, num_elements, [&] {
-      bool value = bytes[i++];
-      false_count_ += !value;
-      return value;
-    });
+    const int64_t true_count =
+        internal::PackBytesToBitmap(bytes, num_elements, mutable_data(), bit_length_);
+    false_count_ += num_elements - true_count;
     bit_length_ += num_elements;
   }
 
@@ -342,6 +342,42 @@ static void BuildStringDictionaryArray(
   BenchmarkDictionaryArray<BinaryDictionaryBuilder>(state, fodder, fodder_nbytes);
 }
 
+// Build a small batch of a few columns, appending a row at a time
+static void BenchmarkSmallBatch(benchmark::State& state,  // NOLINT non-const reference
+                                bool use_arena) {
+  constexpr int64_t kBatchRows = 1000;
+  for (auto _ : state) {
+    std::shared_ptr<ArenaMemoryPool> arena;
+    MemoryPool* pool = default_memory_pool();
+    if (use_arena) {
+      arena = ArenaMemoryPool::Make();
+      pool = arena.get();
+    }
+    Int64Builder int_builder(pool);
+    StringBuilder string_builder(pool);
+    BooleanBuilder boolean_builder(pool);
+    for (int64_t i = 0; i < kBatchRows; i++) {
+      ABORT_NOT_OK(int_builder.Append(i));
+      ABORT_NOT_OK(string_builder.Append(kBinaryView.substr(0, 1 + i % 8)));
+      ABORT_NOT_OK(boolean_builder.Append(i % 2 == 0));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(int_builder.Finish(&out));
+    ABORT_NOT_OK(string_builder.Finish(&out));
+    ABORT_NOT_OK(boolean_builder.Finish(&out));
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatchRows);
+}
+
+static void BuildSmallBatch(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkSmallBatch(state, /*use_arena=*/false);
+}
+
+static void BuildSmallBatchArena(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkSmallBatch(state, /*use_arena=*/true);
+}
+
 static void ArrayDataConstructDestruct(
     benchmark::State& state) {  // NOLINT non-const reference
   std::vector<std::shared_ptr<ArrayData>> arrays;
@@ -448,6 +484,9 @@ BENCHMARK(BuildInt64DictionaryArraySequential);
 BENCHMARK(BuildInt64DictionaryArraySimilar);
 BENCHMARK(BuildStringDictionaryArray);
 
+BENCHMARK(BuildSmallBatch);
+BENCHMARK(BuildSmallBatchArena);
+
 BENCHMARK(ArrayDataConstructDestruct);
 
 }  // namespace arrow
@@ -16,6 +16,9 @@
 // under the License.
 
 #include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -146,14 +149,62 @@ static void ExportImportRecordBatch(
   state.SetItemsProcessed(state.iterations());
 }
 
+// Stream the same record batch a number of times, to measure the per-batch
+// overhead of the C stream interface
+constexpr int64_t kNumStreamBatches = 100;
+
+std::shared_ptr<RecordBatchReader> ExampleRecordBatchReader() {
+  auto batch = ExampleRecordBatch();
+  std::vector<std::shared_ptr<RecordBatch>> batches(kNumStreamBatches, batch);
+  return *MakeRecordBatchReader(std::move(batches), batch->schema());
+}
+
+static void ExportRecordBatchReader(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArrayStream c_stream;
+  struct ArrowArray c_array;
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(ExportRecordBatchReader(ExampleRecordBatchReader(), &c_stream));
+    while (true) {
+      if (c_stream.get_next(&c_stream, &c_array) != 0) {
+        std::abort();
+      }
+      if (ArrowArrayIsReleased(&c_array)) {
+        break;
+      }
+      ArrowArrayRelease(&c_array);
+    }
+    ArrowArrayStreamRelease(&c_stream);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumStreamBatches);
+}
+
+static void ExportImportRecordBatchReader(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArrayStream c_stream;
+  std::shared_ptr<RecordBatch> batch;
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(ExportRecordBatchReader(ExampleRecordBatchReader(), &c_stream));
+    auto reader = ImportRecordBatchReader(&c_stream).ValueOrDie();
+    do {
+      ABORT_NOT_OK(reader->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumStreamBatches);
+}
+
 BENCHMARK(ExportType);
 BENCHMARK(ExportSchema);
 BENCHMARK(ExportArray);
 BENCHMARK(ExportRecordBatch);
+BENCHMARK(ExportRecordBatchReader);
 
 BENCHMARK(ExportImportType);
 BENCHMARK(ExportImportSchema);
 BENCHMARK(ExportImportArray);
 BENCHMARK(ExportImportRecordBatch);
+BENCHMARK(ExportImportRecordBatchReader);
 
 }  // namespace arrow
@@ -0,0 +1,305 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::CpuInfo;
+
+namespace compute {
+
+namespace {
+
+// Pieces start at multiples of 64 values, so that bitmaps of pieces start on byte
+// (and word) boundaries of the bitmaps of their chunks
+constexpr int64_t kPieceAlignment = 64;
+
+// The width in bits of the values of a type, or 0 if they aren't fixed-width
+int ValueBitWidth(const DataType& type) {
+  if (!is_fixed_width(type.id()) || type.id() == Type::DICTIONARY) {
+    return 0;
+  }
+  return checked_cast<const FixedWidthType&>(type).bit_width();
+}
+
+int64_t ValueBufferSize(int bit_width, int64_t length) {
+  if (bit_width == 1) {
+    return BitUtil::BytesForBits(length);
+  }
+  return length * (bit_width / 8);
+}
+
+class UnaryChainExecutor {
+ public:
+  UnaryChainExecutor(FunctionContext* ctx, const std::vector<UnaryKernel*>& kernels,
+                     const ExecOptions& options)
+      : ctx_(ctx), kernels_(kernels), options_(options) {}
+
+  Status Execute(const Datum& input, Datum* out) {
+    if (kernels_.empty()) {
+      return Status::Invalid("ExecuteUnaryKernels needs at least one kernel");
+    }
+    if (!input.is_arraylike()) {
+      return Status::Invalid("ExecuteUnaryKernels expects array-like input");
+    }
+    for (auto kernel : kernels_) {
+      const int bit_width = ValueBitWidth(*kernel->out_type());
+      if (bit_width == 0 || (bit_width != 1 && bit_width % 8 != 0)) {
+        return Status::NotImplemented(
+            "ExecuteUnaryKernels needs kernels with fixed-width outputs, got ",
+            *kernel->out_type());
+      }
+    }
+    out_type_ = kernels_.back()->out_type();
+    out_bit_width_ = ValueBitWidth(*out_type_);
+
+    const int64_t piece_length = PieceLength(*input.type());
+    chunks_ = input.chunks();
+    outputs_.resize(chunks_.size());
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      const int64_t length = chunks_[i]->length();
+      if (input.is_array() && out->is_array() && out->array()->buffers.size() > 1 &&
+          out->array()->buffers[1] != nullptr) {
+        RETURN_NOT_OK(UsePreallocated(length, out->array()));
+      } else {
+        outputs_[i] = ArrayData::Make(out_type_, length, {nullptr, nullptr});
+        RETURN_NOT_OK(ctx_->Allocate(ValueBufferSize(out_bit_width_, length),
+                                     &outputs_[i]->buffers[1]));
+      }
+      for (int64_t offset = 0; offset < length; offset += piece_length) {
+        pieces_.push_back({static_cast<int>(i), offset,
+                           std::min(piece_length, length - offset), nullptr, 0, 0});
+      }
+    }
+
+    // Each worker goes through a contiguous range of pieces with scratch
+    // buffers of its own
+    const int num_pieces = static_cast<int>(pieces_.size());
+    int num_workers = 1;
+    if (options_.use_threads) {
+      num_workers = std::max(
+          1, std::min(num_pieces, internal::GetCpuThreadPool()->GetCapacity()));
+    }
+    RETURN_NOT_OK(internal::OptionalParallelFor(
+        num_workers > 1, num_workers, [&](int worker) {
+          return ExecutePieces(piece_length, num_pieces * worker / num_workers,
+                               num_pieces * (worker + 1) / num_workers);
+        }));
+
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      RETURN_NOT_OK(AssembleValidity(static_cast<int>(i)));
+    }
+    if (input.is_array()) {
+      *out = outputs_[0];
+    } else {
+      ArrayVector out_chunks;
+      for (const auto& output : outputs_) {
+        out_chunks.push_back(MakeArray(output));
+      }
+      *out = std::make_shared<ChunkedArray>(std::move(out_chunks), out_type_);
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Piece {
+    int chunk;
+    int64_t offset;
+    int64_t length;
+    // The validity of the output of the piece
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_bitmap_offset;
+    int64_t null_count;
+  };
+
+  int64_t PieceLength(const DataType& input_type) const {
+    int64_t length = options_.piece_length;
+    if (length <= 0) {
+      // Variable-width inputs are assumed to take 8 bytes per value
+      int64_t bits_per_value = ValueBitWidth(input_type);
+      if (bits_per_value == 0) {
+        bits_per_value = 64;
+      }
+      for (auto kernel : kernels_) {
+        bits_per_value += ValueBitWidth(*kernel->out_type());
+      }
+      const int64_t l2_size = ctx_->cpu_info()->CacheSize(CpuInfo::L2_CACHE);
+      length = l2_size / 2 * 8 / bits_per_value;
+    }
+    return std::max(kPieceAlignment, BitUtil::RoundUp(length, kPieceAlignment));
+  }
+
+  Status UsePreallocated(int64_t length, const std::shared_ptr<ArrayData>& out) {
+    const auto& values = out->buffers[1];
+    if (!values->is_mutable() ||
+        values->size() < ValueBufferSize(out_bit_width_, length) || out->offset != 0) {
+      return Status::Invalid(
+          "Preallocated output must have a mutable value buffer of at least ",
+          ValueBufferSize(out_bit_width_, length), " bytes and no offset");
+    }
+    out->type = out_type_;
+    out->length = length;
+    out->buffers.resize(2);
+    out->buffers[0] = nullptr;
+    out->null_count = 0;
+    outputs_[0] = out;
+    return Status::OK();
+  }
+
+  Status ExecutePieces(int64_t piece_length, int begin, int end) {
+    // Errors are reported to the context by some kernels, which must not be
+    // shared between threads
+    FunctionContext ctx(ctx_->memory_pool());
+    std::vector<std::shared_ptr<Buffer>> scratch(kernels_.size() - 1);
+    for (size_t i = 0; i < scratch.size(); ++i) {
+      const int bit_width = ValueBitWidth(*kernels_[i]->out_type());
+      RETURN_NOT_OK(ctx.Allocate(ValueBufferSize(bit_width, piece_length), &scratch[i]));
+    }
+    for (int i = begin; i < end; ++i) {
+      RETURN_NOT_OK(ExecutePiece(&ctx, scratch, &pieces_[i]));
+    }
+    return Status::OK();
+  }
+
+  Status ExecutePiece(FunctionContext* ctx,
+                      const std::vector<std::shared_ptr<Buffer>>& scratch,
+                      Piece* piece) {
+    Datum current(chunks_[piece->chunk]->Slice(piece->offset, piece->length));
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      const bool last = i + 1 == kernels_.size();
+      const auto& out_type = kernels_[i]->out_type();
+      const int bit_width = ValueBitWidth(*out_type);
+      const int64_t size = ValueBufferSize(bit_width, piece->length);
+
+      std::shared_ptr<Buffer> values;
+      if (last) {
+        values = SliceMutableBuffer(outputs_[piece->chunk]->buffers[1],
+                                    ValueBufferSize(bit_width, piece->offset), size);
+      } else {
+        values = SliceMutableBuffer(scratch[i], 0, size);
+      }
+      if (bit_width == 1 && size > 0) {
+        // As PrimitiveAllocatingUnaryKernel does, for kernels reading the
+        // trailing bits of the last byte
+        values->mutable_data()[size - 1] = 0;
+      }
+
+      Datum result(ArrayData::Make(out_type, piece->length, {nullptr, values}));
+      RETURN_NOT_OK(kernels_[i]->Call(ctx, current, &result));
+      ARROW_RETURN_IF_ERROR(ctx);
+      if (!result.is_array() || result.array()->buffers.size() < 2 ||
+          result.array()->buffers[1] == nullptr) {
+        return Status::Invalid("Kernel producing ", *out_type,
+                               " didn't produce an array with a value buffer");
+      }
+      if (last) {
+        const ArrayData& data = *result.array();
+        CopyValuesIfElsewhere(data, bit_width, values.get());
+        piece->null_count = data.GetNullCount();
+        if (piece->null_count > 0) {
+          piece->null_bitmap = data.buffers[0];
+          piece->null_bitmap_offset = data.offset;
+        }
+      }
+      current = std::move(result);
+    }
+    return Status::OK();
+  }
+
+  // Kernels may produce results elsewhere than in the preallocated buffer,
+  // e.g. zero-copy from their input
+  static void CopyValuesIfElsewhere(const ArrayData& data, int bit_width, Buffer* dest) {
+    const uint8_t* values = data.buffers[1]->data();
+    if (bit_width == 1) {
+      if (values != dest->data() || data.offset != 0) {
+        internal::CopyBitmap(values, data.offset, data.length, dest->mutable_data(), 0);
+      }
+    } else {
+      values += data.offset * (bit_width / 8);
+      if (values != dest->data()) {
+        std::memcpy(dest->mutable_data(), values, static_cast<size_t>(dest->size()));
+      }
+    }
+  }
+
+  Status AssembleValidity(int chunk) {
+    ArrayData* output = outputs_[chunk].get();
+    int64_t null_count = 0;
+    for (const auto& piece : pieces_) {
+      if (piece.chunk == chunk) null_count += piece.null_count;
+    }
+    output->null_count = null_count;
+    if (null_count == 0) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(ctx_->Allocate(BitUtil::BytesForBits(output->length),
+                                 &output->buffers[0]));
+    uint8_t* bitmap = output->buffers[0]->mutable_data();
+    for (const auto& piece : pieces_) {
+      if (piece.chunk != chunk) continue;
+      if (piece.null_count == 0) {
+        BitUtil::SetBitsTo(bitmap, piece.offset, piece.length, true);
+      } else {
+        internal::CopyBitmap(piece.null_bitmap->data(), piece.null_bitmap_offset,
+                             piece.length, bitmap, piece.offset);
+      }
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  const std::vector<UnaryKernel*>& kernels_;
+  const ExecOptions& options_;
+  std::shared_ptr<DataType> out_type_;
+  int out_bit_width_ = 0;
+  ArrayVector chunks_;
+  std::vector<std::shared_ptr<ArrayData>> outputs_;
+  std::vector<Piece> pieces_;
+};
+
+}  // namespace
+
+Status ExecuteUnaryKernels(FunctionContext* ctx, const std::vector<UnaryKernel*>& kernels,
+                           const Datum& input, const ExecOptions& options, Datum* out) {
+  UnaryChainExecutor executor(ctx, kernels, options);
+  return executor.Execute(input, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class UnaryKernel;
+
+/// \class ExecOptions
+///
+/// Parameters of ExecuteUnaryKernels.
+struct ARROW_EXPORT ExecOptions {
+  static ExecOptions Defaults() { return ExecOptions(); }
+
+  /// The number of values the input is split into pieces of.  If 0, the length
+  /// is chosen so that the values of a piece at every step of the chain fit in
+  /// half of the L2 cache.  Rounded up to a multiple of 64, so that pieces of
+  /// bitmaps start on byte boundaries.
+  int64_t piece_length = 0;
+
+  /// Whether to execute pieces in parallel on the CPU thread pool, which
+  /// requires the kernels to support concurrent calls
+  bool use_threads = false;
+};
+
+/// \brief Execute a chain of unary kernels over an array-like datum, each
+/// kernel applied to the output of the previous one
+///
+/// The input is split into pieces, each of which goes through the whole chain
+/// before the next one is started, so that the intermediate results of a piece
+/// stay in cache.  Intermediate results are written into scratch buffers which
+/// are reused from one piece to the next, and the results of the last kernel
+/// into output buffers which are allocated once for the whole input.  Each
+/// chunk of a chunked array input yields a chunk of the output.
+///
+/// The kernels must write their results into the value buffer preallocated in
+/// the output ArrayData they are called with, as the delegates of
+/// detail::PrimitiveAllocatingUnaryKernel do, and set its validity bitmap,
+/// e.g. with detail::PropagateNulls.  Their output types must therefore be
+/// fixed-width.  Results written elsewhere are copied into place.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] kernels the kernels to apply, in order, at least one
+/// \param[in] input the input, expecting Array or ChunkedArray
+/// \param[in] options see ExecOptions
+/// \param[in,out] out the output datum.  If the input is an Array, out may be an
+///   Array with a mutable value buffer large enough for the output, which
+///   is then written into instead of allocating one.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ExecuteUnaryKernels(FunctionContext* ctx, const std::vector<UnaryKernel*>& kernels,
+                           const Datum& input, const ExecOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestExecuteUnaryKernels : public ComputeFixture, public ::testing::Test {
+ protected:
+  // Cast through each of the types in turn, keeping the kernels alive
+  std::vector<UnaryKernel*> CastChain(std::shared_ptr<DataType> in_type,
+                                      const std::vector<std::shared_ptr<DataType>>& types,
+                                      const CastOptions& options = CastOptions()) {
+    std::vector<UnaryKernel*> kernels;
+    for (const auto& type : types) {
+      std::unique_ptr<UnaryKernel> kernel;
+      ARROW_EXPECT_OK(GetCastFunction(*in_type, type, options, &kernel));
+      kernels.push_back(kernel.get());
+      kernels_.push_back(std::move(kernel));
+      in_type = type;
+    }
+    return kernels;
+  }
+
+  // The result of the chain, by casting the whole input at each step
+  Datum ExpectedResult(Datum value, const std::vector<std::shared_ptr<DataType>>& types) {
+    for (const auto& type : types) {
+      ARROW_EXPECT_OK(Cast(&ctx_, value, type, CastOptions(), &value));
+    }
+    return value;
+  }
+
+  void CheckChain(const Datum& input, const std::vector<std::shared_ptr<DataType>>& types,
+                  const ExecOptions& options) {
+    auto kernels = CastChain(input.type(), types);
+    Datum out;
+    ASSERT_OK(ExecuteUnaryKernels(&ctx_, kernels, input, options, &out));
+    Datum expected = ExpectedResult(input, types);
+    ASSERT_EQ(expected.kind(), out.kind());
+    if (out.is_array()) {
+      ASSERT_OK(out.make_array()->ValidateFull());
+      AssertArraysEqual(*expected.make_array(), *out.make_array());
+    } else {
+      ASSERT_OK(out.chunked_array()->ValidateFull());
+      AssertChunkedEqual(*expected.chunked_array(), *out.chunked_array());
+    }
+  }
+
+  std::vector<std::unique_ptr<UnaryKernel>> kernels_;
+};
+
+TEST_F(TestExecuteUnaryKernels, Chain) {
+  auto rand = random::RandomArrayGenerator(0x5eed);
+  const std::vector<std::shared_ptr<DataType>> types = {int64(), float64(), int16()};
+  for (double null_probability : {0.0, 0.2}) {
+    auto values = rand.Int32(1000, -1000, 1000, null_probability);
+    for (int64_t piece_length : {0, 64, 100, 2000}) {
+      for (bool use_threads : {false, true}) {
+        ExecOptions options;
+        options.piece_length = piece_length;
+        options.use_threads = use_threads;
+        CheckChain(values, types, options);
+        CheckChain(values->Slice(3, 900), types, options);
+        CheckChain(std::make_shared<ChunkedArray>(
+                       ArrayVector{values->Slice(0, 10), values->Slice(10, 0),
+                                   values->Slice(10, 990)}),
+                   types, options);
+      }
+    }
+  }
+}
+
+TEST_F(TestExecuteUnaryKernels, BooleanAndZeroCopyResults) {
+  ExecOptions options;
+  options.piece_length = 64;
+  auto values = ArrayFromJSON(int32(), "[0, 1, null, 2, 0, 3]");
+  auto large = std::make_shared<ChunkedArray>(ArrayVector(20, values));
+
+  // Bitmap outputs, and intermediate results
+  CheckChain(values, {boolean()}, options);
+  CheckChain(large, {boolean(), int8()}, options);
+  // Identity casts return their input rather than writing into the output
+  CheckChain(values, {int32()}, options);
+  CheckChain(large, {int64(), int64()}, options);
+}
+
+TEST_F(TestExecuteUnaryKernels, Preallocated) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(ctx_.Allocate(4 * sizeof(int64_t), &buffer));
+  Datum out(ArrayData::Make(int64(), 4, {nullptr, buffer}));
+  ASSERT_OK(ExecuteUnaryKernels(&ctx_, CastChain(int32(), {int64()}), values,
+                                ExecOptions::Defaults(), &out));
+  ASSERT_EQ(buffer, out.array()->buffers[1]);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, null, 4]"), *out.make_array());
+
+  // Too small
+  Datum small(ArrayData::Make(int64(), 2, {nullptr, SliceBuffer(buffer, 0, 16)}));
+  ASSERT_RAISES(Invalid, ExecuteUnaryKernels(&ctx_, CastChain(int32(), {int64()}),
+                                             values, ExecOptions::Defaults(), &small));
+}
+
+TEST_F(TestExecuteUnaryKernels, Errors) {
+  Datum out;
+  auto values = ArrayFromJSON(int32(), "[1, 1000]");
+  ASSERT_RAISES(Invalid, ExecuteUnaryKernels(&ctx_, {}, values,
+                                             ExecOptions::Defaults(), &out));
+  ASSERT_RAISES(NotImplemented, ExecuteUnaryKernels(&ctx_, CastChain(int32(), {utf8()}),
+                                                    values, ExecOptions::Defaults(),
+                                                    &out));
+  // Errors reported by kernels through their context
+  ASSERT_RAISES(Invalid, ExecuteUnaryKernels(&ctx_, CastChain(int32(), {int8()}),
+                                             values, ExecOptions::Defaults(), &out));
+  ASSERT_FALSE(ctx_.HasError());
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -15,10 +15,21 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
 
 namespace arrow {
 namespace compute {
@@ -84,5 +95,252 @@ std::shared_ptr<DataType> AggregateUnaryKernel::out_type() const {
   return aggregate_function_->out_type();
 }
 
+namespace {
+
+// Size of the chunks consumed by fused aggregates, small enough for a chunk to
+// stay in the L2 cache while all the aggregates read it
+constexpr int64_t kFusedChunkBytes = 64 * 1024;
+constexpr int64_t kMinFusedChunkLength = 1024;
+
+int64_t FusedChunkLength(const DataType& type) {
+  const auto* fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+  if (fixed_width == nullptr || fixed_width->bit_width() == 0) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  return std::max(kFusedChunkBytes * 8 / fixed_width->bit_width(),
+                  kMinFusedChunkLength);
+}
+
+// Consume an array into the states of several aggregates, reading it once.
+// Each chunk is consumed by every aggregate into its scratch state, as
+// Consume() overwrites its state, which is then merged into its state.
+Status ConsumeFused(const std::vector<const AggregateFunction*>& functions,
+                    const Array& array, const std::vector<void*>& scratch_states,
+                    const std::vector<void*>& states) {
+  const int64_t length = array.length();
+  const int64_t chunk_length =
+      functions.size() > 1 ? FusedChunkLength(*array.type()) : length;
+  int64_t offset = 0;
+  do {
+    std::shared_ptr<Array> slice;
+    const Array* chunk = &array;
+    if (chunk_length < length) {
+      slice = array.Slice(offset, chunk_length);
+      chunk = slice.get();
+    }
+    // Count the nulls of the chunk once for all the aggregates: the count is
+    // cached by the chunk's ArrayData
+    chunk->null_count();
+    for (size_t i = 0; i < functions.size(); ++i) {
+      functions[i]->Delete(scratch_states[i]);
+      functions[i]->New(scratch_states[i]);
+      RETURN_NOT_OK(functions[i]->Consume(*chunk, scratch_states[i]));
+      RETURN_NOT_OK(functions[i]->Merge(scratch_states[i], states[i]));
+    }
+    offset += chunk->length();
+  } while (offset < length);
+  return Status::OK();
+}
+
+}  // namespace
+
+class BatchAggregator::Impl {
+ public:
+  Impl(FunctionContext* ctx, std::vector<BatchAggregate> aggregates)
+      : ctx_(ctx), aggregates_(std::move(aggregates)) {
+    // Group the aggregates by column, in order of first appearance
+    std::unordered_map<std::string, size_t> column_indices;
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      if (aggregates_[i].function == nullptr) {
+        continue;
+      }
+      auto it = column_indices.emplace(aggregates_[i].field_name, columns_.size()).first;
+      if (it->second == columns_.size()) {
+        columns_.push_back({aggregates_[i].field_name, {}});
+      }
+      columns_[it->second].aggregates.push_back(i);
+    }
+  }
+
+  Status Consume(const RecordBatch& batch) {
+    ThreadStates* thread_states = nullptr;
+    RETURN_NOT_OK(GetThreadStates(&thread_states));
+    std::vector<const AggregateFunction*> functions;
+    std::vector<void*> batch_states, states;
+    for (const auto& column : columns_) {
+      const int index = batch.schema()->GetFieldIndex(column.field_name);
+      if (index == -1) {
+        return Status::Invalid("No field named '", column.field_name,
+                               "' in batch to aggregate");
+      }
+      functions.clear();
+      batch_states.clear();
+      states.clear();
+      for (size_t i : column.aggregates) {
+        functions.push_back(aggregates_[i].function.get());
+        batch_states.push_back(thread_states->batch_states[i]->mutable_data());
+        states.push_back(thread_states->states[i]->mutable_data());
+      }
+      RETURN_NOT_OK(ConsumeFused(functions, *batch.column(index), batch_states, states));
+    }
+    num_rows_ += batch.num_rows();
+    return Status::OK();
+  }
+
+  Status Finish(std::vector<Datum>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ThreadStates merged;
+    RETURN_NOT_OK(MakeStates(&merged.states));
+    for (const auto& entry : thread_states_) {
+      for (size_t i = 0; i < aggregates_.size(); ++i) {
+        if (aggregates_[i].function != nullptr) {
+          RETURN_NOT_OK(aggregates_[i].function->Merge(
+              entry.second->states[i]->mutable_data(), merged.states[i]->mutable_data()));
+        }
+      }
+    }
+    out->clear();
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      Datum result;
+      if (aggregates_[i].function == nullptr) {
+        result = Datum(std::make_shared<Int64Scalar>(num_rows_.load()));
+      } else {
+        RETURN_NOT_OK(
+            aggregates_[i].function->Finalize(merged.states[i]->mutable_data(), &result));
+      }
+      out->push_back(std::move(result));
+    }
+    return Status::OK();
+  }
+
+  int64_t num_rows() const { return num_rows_.load(); }
+
+ private:
+  // The aggregates of a column, which consume it together
+  struct FusedColumn {
+    std::string field_name;
+    std::vector<size_t> aggregates;
+  };
+
+  struct ThreadStates {
+    // The states accumulated by the thread, one per aggregate (null for row
+    // counts)
+    std::vector<std::shared_ptr<ManagedAggregateState>> states;
+    // Scratch states consuming one batch
+    std::vector<std::shared_ptr<ManagedAggregateState>> batch_states;
+  };
+
+  Status MakeStates(std::vector<std::shared_ptr<ManagedAggregateState>>* out) {
+    out->clear();
+    for (auto& aggregate : aggregates_) {
+      std::shared_ptr<ManagedAggregateState> state;
+      if (aggregate.function != nullptr) {
+        state = ManagedAggregateState::Make(aggregate.function, ctx_->memory_pool());
+        if (!state) {
+          return Status::OutOfMemory("AggregateState allocation failed");
+        }
+      }
+      out->push_back(std::move(state));
+    }
+    return Status::OK();
+  }
+
+  Status GetThreadStates(ThreadStates** out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto thread_id = std::this_thread::get_id();
+    auto it = thread_states_.find(thread_id);
+    if (it == thread_states_.end()) {
+      // Only registered once complete, Finish() must not see partial states
+      std::unique_ptr<ThreadStates> new_states(new ThreadStates);
+      RETURN_NOT_OK(MakeStates(&new_states->states));
+      RETURN_NOT_OK(MakeStates(&new_states->batch_states));
+      it = thread_states_.emplace(thread_id, std::move(new_states)).first;
+    }
+    *out = it->second.get();
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::vector<BatchAggregate> aggregates_;
+  std::vector<FusedColumn> columns_;
+  std::atomic<int64_t> num_rows_{0};
+
+  // Only held to look up (or merge) the states of the threads
+  std::mutex mutex_;
+  std::unordered_map<std::thread::id, std::unique_ptr<ThreadStates>> thread_states_;
+};
+
+BatchAggregator::BatchAggregator(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+BatchAggregator::~BatchAggregator() {}
+
+Status BatchAggregator::Consume(const RecordBatch& batch) {
+  return impl_->Consume(batch);
+}
+
+Status BatchAggregator::Finish(std::vector<Datum>* out) { return impl_->Finish(out); }
+
+int64_t BatchAggregator::num_rows() const { return impl_->num_rows(); }
+
+Status BatchAggregator::Make(FunctionContext* ctx, std::vector<BatchAggregate> aggregates,
+                             std::unique_ptr<BatchAggregator>* out) {
+  out->reset(new BatchAggregator(
+      std::unique_ptr<Impl>(new Impl(ctx, std::move(aggregates)))));
+  return Status::OK();
+}
+
+Status MultiAggregate(FunctionContext* ctx,
+                      const std::vector<std::shared_ptr<AggregateFunction>>& functions,
+                      const Datum& value, std::vector<Datum>* out) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("MultiAggregate expects Array or ChunkedArray datum");
+  }
+  std::vector<std::shared_ptr<ManagedAggregateState>> managed_states;
+  std::vector<const AggregateFunction*> raw_functions;
+  std::vector<void*> scratch_states, states;
+  for (auto function : functions) {
+    if (function == nullptr) {
+      return Status::Invalid("MultiAggregate expects non-null aggregate functions");
+    }
+    auto scratch_state = ManagedAggregateState::Make(function, ctx->memory_pool());
+    auto state = ManagedAggregateState::Make(function, ctx->memory_pool());
+    if (!scratch_state || !state) {
+      return Status::OutOfMemory("AggregateState allocation failed");
+    }
+    raw_functions.push_back(function.get());
+    scratch_states.push_back(scratch_state->mutable_data());
+    states.push_back(state->mutable_data());
+    managed_states.push_back(std::move(scratch_state));
+    managed_states.push_back(std::move(state));
+  }
+
+  for (const auto& chunk : value.chunks()) {
+    RETURN_NOT_OK(ConsumeFused(raw_functions, *chunk, scratch_states, states));
+  }
+
+  out->clear();
+  for (size_t i = 0; i < functions.size(); ++i) {
+    Datum result;
+    RETURN_NOT_OK(functions[i]->Finalize(states[i], &result));
+    out->push_back(std::move(result));
+  }
+  return Status::OK();
+}
+
+Status Aggregate(FunctionContext* ctx, RecordBatchReader* reader,
+                 std::vector<BatchAggregate> aggregates, std::vector<Datum>* out) {
+  std::unique_ptr<BatchAggregator> aggregator;
+  RETURN_NOT_OK(BatchAggregator::Make(ctx, std::move(aggregates), &aggregator));
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(aggregator->Consume(*batch));
+  }
+  return aggregator->Finish(out);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,13 +17,19 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 
 namespace arrow {
 
 class Array;
+class RecordBatch;
+class RecordBatchReader;
 class Status;
 
 namespace compute {
@@ -111,5 +117,95 @@ class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
   std::shared_ptr<AggregateFunction> aggregate_function_;
 };
 
+/// \class BatchAggregate
+///
+/// An aggregation computed by a BatchAggregator over one column of a stream
+/// of record batches.
+struct ARROW_EXPORT BatchAggregate {
+  BatchAggregate(std::string field_name, std::shared_ptr<AggregateFunction> function)
+      : field_name(std::move(field_name)), function(std::move(function)) {}
+
+  /// \brief The number of rows, as an int64 scalar (SQL's COUNT(*))
+  static BatchAggregate CountAll() { return BatchAggregate("", NULLPTR); }
+
+  /// Name of the aggregated column
+  std::string field_name;
+  /// The aggregate function, or null to count rows
+  std::shared_ptr<AggregateFunction> function;
+};
+
+/// \brief Aggregate columns over a stream of record batches
+///
+/// A BatchAggregator is thread-safe: batches may be consumed from several
+/// threads at once, e.g. from the tasks of a dataset scan.  Each thread
+/// consumes into aggregate states of its own, without holding a lock, and
+/// the states of all threads are merged by Finish().  Batches are never
+/// retained, so aggregating a stream doesn't materialize it.
+///
+/// Aggregates of the same column are fused, as by MultiAggregate: the column
+/// is read once, one cache-sized chunk at a time, for all of them.
+class ARROW_EXPORT BatchAggregator {
+ public:
+  ~BatchAggregator();
+
+  /// \brief Consume a batch, which must have the fields of the aggregates
+  Status Consume(const RecordBatch& batch);
+
+  /// \brief Merge the states of all threads and compute the final results
+  ///
+  /// \param[out] out one scalar datum per aggregate
+  Status Finish(std::vector<Datum>* out);
+
+  /// \brief The number of rows consumed so far
+  int64_t num_rows() const;
+
+  /// \brief Create a BatchAggregator
+  ///
+  /// \param[in] ctx the FunctionContext, whose memory pool holds the states
+  /// \param[in] aggregates the aggregates to compute
+  /// \param[out] out the BatchAggregator
+  static Status Make(FunctionContext* ctx, std::vector<BatchAggregate> aggregates,
+                     std::unique_ptr<BatchAggregator>* out);
+
+ private:
+  class Impl;
+
+  explicit BatchAggregator(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Compute several aggregates of the same values in a single pass
+///
+/// The values are consumed one cache-sized chunk at a time, each chunk by all
+/// the aggregates in turn, so that e.g. the sum, count, min / max and mean of
+/// a column only read it from memory once.  The null count of each chunk is
+/// computed once and shared by the aggregates.
+///
+/// \param[in] ctx the FunctionContext, whose memory pool holds the states
+/// \param[in] functions the aggregates to compute
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[out] out one datum per aggregate, as returned by its Finalize()
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MultiAggregate(FunctionContext* ctx,
+                      const std::vector<std::shared_ptr<AggregateFunction>>& functions,
+                      const Datum& value, std::vector<Datum>* out);
+
+/// \brief Aggregate columns over the batches of a RecordBatchReader
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] reader the batches to aggregate, read until exhausted
+/// \param[in] aggregates the aggregates to compute
+/// \param[out] out one scalar datum per aggregate
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Aggregate(FunctionContext* ctx, RecordBatchReader* reader,
+                 std::vector<BatchAggregate> aggregates, std::vector<Datum>* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -23,6 +23,10 @@
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/count.h"
+#include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
@@ -307,12 +311,14 @@ BENCHMARK_TEMPLATE(ReferenceSum, SumBitmapVectorizeUnroll<int64_t>)
     ->Apply(BenchmarkSetArgs);
 #endif  // ARROW_WITH_BENCHMARKS_REFERENCE
 
+template <typename ArrowType>
 static void SumKernel(benchmark::State& state) {
-  const int64_t array_size = state.range(0) / sizeof(int64_t);
-  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(CType);
   auto rand = random::RandomArrayGenerator(1923);
-  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
+  auto array = rand.Numeric<ArrowType>(array_size, -100, 100, args.null_proportion);
 
   FunctionContext ctx;
   for (auto _ : state) {
@@ -320,13 +326,78 @@ static void SumKernel(benchmark::State& state) {
     ABORT_NOT_OK(Sum(&ctx, Datum(array), &out));
     benchmark::DoNotOptimize(out);
   }
+}
 
-  state.counters["size"] = static_cast<double>(state.range(0));
-  state.counters["null_percent"] = static_cast<double>(state.range(1));
-  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+static void SumKernelInt8(benchmark::State& state) { SumKernel<Int8Type>(state); }
+
+static void SumKernelInt64(benchmark::State& state) { SumKernel<Int64Type>(state); }
+
+static void SumKernelFloat(benchmark::State& state) { SumKernel<FloatType>(state); }
+
+static void SumKernelDouble(benchmark::State& state) { SumKernel<DoubleType>(state); }
+
+static void MeanKernelDouble(benchmark::State& state) {
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(double);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Float64(array_size, -100, 100, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Mean(&ctx, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+// Sum, count, min / max and mean of a column, as a describe() would compute
+static std::vector<std::shared_ptr<AggregateFunction>> DescribeFunctions(
+    FunctionContext* ctx) {
+  return {MakeSumAggregateFunction(*float64(), ctx),
+          MakeCount(ctx, CountOptions(CountOptions::COUNT_ALL)),
+          MakeMinMaxAggregateFunction(*float64(), ctx, MinMaxOptions()),
+          MakeMeanAggregateFunction(*float64(), ctx)};
+}
+
+static void DescribeSeparateDouble(benchmark::State& state) {
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(double);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Float64(array_size, -100, 100, args.null_proportion);
+
+  FunctionContext ctx;
+  auto functions = DescribeFunctions(&ctx);
+  for (auto _ : state) {
+    for (auto& function : functions) {
+      Datum out;
+      ABORT_NOT_OK(AggregateUnaryKernel(function).Call(&ctx, Datum(array), &out));
+      benchmark::DoNotOptimize(out);
+    }
+  }
+}
+
+static void DescribeFusedDouble(benchmark::State& state) {
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(double);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Float64(array_size, -100, 100, args.null_proportion);
+
+  FunctionContext ctx;
+  auto functions = DescribeFunctions(&ctx);
+  for (auto _ : state) {
+    std::vector<Datum> out;
+    ABORT_NOT_OK(MultiAggregate(&ctx, functions, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
 }
 
-BENCHMARK(SumKernel)->Apply(RegressionSetArgs);
+BENCHMARK(SumKernelInt8)->Apply(RegressionSetArgs);
+BENCHMARK(SumKernelInt64)->Apply(RegressionSetArgs);
+BENCHMARK(SumKernelFloat)->Apply(RegressionSetArgs);
+BENCHMARK(SumKernelDouble)->Apply(RegressionSetArgs);
+BENCHMARK(MeanKernelDouble)->Apply(RegressionSetArgs);
+BENCHMARK(DescribeSeparateDouble)->Apply(RegressionSetArgs);
+BENCHMARK(DescribeFusedDouble)->Apply(RegressionSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
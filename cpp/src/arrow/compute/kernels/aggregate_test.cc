@@ -17,13 +17,19 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
 #include "arrow/compute/kernels/minmax.h"
@@ -209,6 +215,40 @@ TYPED_TEST(TestRandomNumericSumKernel, RandomSliceArraySum) {
   }
 }
 
+TYPED_TEST(TestRandomNumericSumKernel, RandomSliceBlocksSum) {
+  // Slices spanning several 64 value blocks at every bitmap alignment
+  auto rand = random::RandomArrayGenerator(0x94378165);
+  const int64_t length = 1000;
+  for (auto null_probability : {0.0, 0.01, 0.5, 0.99}) {
+    auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+    for (int64_t offset = 0; offset < 70; offset += 3) {
+      for (int64_t slice_length : {63, 64, 65, 128, 500}) {
+        ValidateSum<TypeParam>(&this->ctx_, *array->Slice(offset, slice_length));
+      }
+    }
+  }
+}
+
+TEST(TestSumKernel, PairwiseDoubleSum) {
+  // Summing 0.1 one value at a time drifts by about 1e-6 over 2^20 values
+  const int64_t length = 1 << 20;
+  DoubleBuilder builder;
+  ASSERT_OK(builder.Reserve(length));
+  for (int64_t i = 0; i < length; ++i) {
+    builder.UnsafeAppend(0.1);
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+
+  FunctionContext ctx;
+  Datum out;
+  ASSERT_OK(Sum(&ctx, *array, &out));
+  ASSERT_NEAR(checked_cast<const DoubleScalar&>(*out.scalar()).value, 104857.6, 1e-8);
+
+  ASSERT_OK(Mean(&ctx, *array, &out));
+  ASSERT_NEAR(checked_cast<const DoubleScalar&>(*out.scalar()).value, 0.1, 1e-14);
+}
+
 ///
 /// Mean
 ///
@@ -472,5 +512,256 @@ TYPED_TEST(TestFloatingMinMaxKernel, Floats) {
   this->AssertMinMaxIsNull(chunked_input3, options);
 }
 
+///
+/// MultiAggregate
+///
+
+class TestMultiAggregate : public ComputeFixture, public TestBase {
+ protected:
+  std::vector<std::shared_ptr<AggregateFunction>> MakeFunctions(const DataType& type) {
+    return {MakeSumAggregateFunction(type, &ctx_),
+            MakeCount(&ctx_, CountOptions(CountOptions::COUNT_ALL)),
+            MakeCount(&ctx_, CountOptions(CountOptions::COUNT_NULL)),
+            MakeMinMaxAggregateFunction(type, &ctx_, MinMaxOptions()),
+            MakeMeanAggregateFunction(type, &ctx_)};
+  }
+
+  // Check the fused aggregates against the kernels computed one by one
+  void AssertMultiAggregate(const Datum& value) {
+    std::vector<Datum> results;
+    ASSERT_OK(MultiAggregate(&ctx_, MakeFunctions(*value.type()), value, &results));
+    ASSERT_EQ(results.size(), 5);
+
+    Datum expected;
+    ASSERT_OK(Sum(&ctx_, value, &expected));
+    AssertDatumsEqual(expected, results[0]);
+    ASSERT_OK(Count(&ctx_, CountOptions(CountOptions::COUNT_ALL), value, &expected));
+    AssertDatumsEqual(expected, results[1]);
+    ASSERT_OK(Count(&ctx_, CountOptions(CountOptions::COUNT_NULL), value, &expected));
+    AssertDatumsEqual(expected, results[2]);
+    ASSERT_OK(MinMax(&ctx_, MinMaxOptions(), value, &expected));
+    ASSERT_TRUE(expected.Equals(results[3]));
+    ASSERT_OK(Mean(&ctx_, value, &expected));
+    AssertDatumsEqual(expected, results[4]);
+  }
+};
+
+TEST_F(TestMultiAggregate, Array) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  // Spans several chunks of the fused pass
+  const int64_t length = 100000;
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto array = rand.Int64(length, -1000, 1000, null_probability);
+    AssertMultiAggregate(array);
+    AssertMultiAggregate(array->Slice(13, length - 100));
+    AssertMultiAggregate(array->Slice(0, 0));
+  }
+}
+
+TEST_F(TestMultiAggregate, ChunkedArray) {
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  ArrayVector chunks = {rand.Int32(70000, -1000, 1000, 0.1),
+                        rand.Int32(0, -1000, 1000, 0.1),
+                        rand.Int32(1000, -1000, 1000, 0.0)};
+  std::shared_ptr<Array> array;
+  ASSERT_OK(Concatenate(chunks, default_memory_pool(), &array));
+  AssertMultiAggregate(array);
+
+  // Count doesn't accept chunked arrays, compare with the concatenation
+  std::vector<Datum> expected, results;
+  ASSERT_OK(MultiAggregate(&ctx_, MakeFunctions(*int32()), array, &expected));
+  ASSERT_OK(MultiAggregate(&ctx_, MakeFunctions(*int32()),
+                           std::make_shared<ChunkedArray>(chunks), &results));
+  ASSERT_EQ(expected.size(), results.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_TRUE(expected[i].Equals(results[i]));
+  }
+}
+
+TEST_F(TestMultiAggregate, Invalid) {
+  auto rand = random::RandomArrayGenerator(0x5487657);
+  std::vector<Datum> results;
+  ASSERT_RAISES(Invalid, MultiAggregate(&ctx_, MakeFunctions(*int64()),
+                                        Datum(std::make_shared<Int64Scalar>(1)),
+                                        &results));
+  ASSERT_RAISES(Invalid, MultiAggregate(&ctx_, {nullptr},
+                                        Datum(rand.Int64(10, 0, 100)), &results));
+}
+
+///
+/// BatchAggregator
+///
+
+// A pool whose allocations fail on demand
+class FailingMemoryPool : public MemoryPool {
+ public:
+  Status Allocate(int64_t size, uint8_t** out) override {
+    if (fail_) {
+      return Status::OutOfMemory("allocation of size ", size, " failed on purpose");
+    }
+    return default_memory_pool()->Allocate(size, out);
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+    if (fail_) {
+      return Status::OutOfMemory("reallocation of size ", new_size, " failed on purpose");
+    }
+    return default_memory_pool()->Reallocate(old_size, new_size, ptr);
+  }
+
+  void Free(uint8_t* buffer, int64_t size) override {
+    default_memory_pool()->Free(buffer, size);
+  }
+
+  int64_t bytes_allocated() const override { return -1; }
+
+  std::string backend_name() const override { return "failing"; }
+
+  void set_fail(bool fail) { fail_ = fail; }
+
+ private:
+  bool fail_ = false;
+};
+
+class TestBatchAggregator : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    schema_ = schema({field("x", int32()), field("y", utf8())});
+    batches_ = {RecordBatchFromJSON(schema_, R"([{"x": 1, "y": "a"},
+                                                 {"x": 2, "y": null},
+                                                 {"x": null, "y": "c"}])"),
+                RecordBatchFromJSON(schema_, R"([{"x": 4, "y": null}])"),
+                RecordBatchFromJSON(schema_, "[]")};
+  }
+
+  std::vector<BatchAggregate> MakeAggregates() {
+    return {BatchAggregate("x", MakeSumAggregateFunction(*int32(), &ctx_)),
+            BatchAggregate("y", MakeCount(&ctx_, CountOptions(CountOptions::COUNT_ALL))),
+            BatchAggregate::CountAll()};
+  }
+
+  void AssertResults(const std::vector<Datum>& results, int64_t sum, int64_t count,
+                     int64_t num_rows) {
+    ASSERT_EQ(results.size(), 3);
+    ASSERT_EQ(sum, Int64Value(results[0]));
+    ASSERT_EQ(count, Int64Value(results[1]));
+    ASSERT_EQ(num_rows, Int64Value(results[2]));
+  }
+
+  static int64_t Int64Value(const Datum& datum) {
+    return checked_cast<const Int64Scalar&>(*datum.scalar()).value;
+  }
+
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+};
+
+TEST_F(TestBatchAggregator, Reader) {
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeRecordBatchReader(batches_, schema_));
+  std::vector<Datum> results;
+  ASSERT_OK(Aggregate(&ctx_, reader.get(), MakeAggregates(), &results));
+  AssertResults(results, 7, 2, 4);
+}
+
+TEST_F(TestBatchAggregator, Empty) {
+  std::unique_ptr<BatchAggregator> aggregator;
+  ASSERT_OK(BatchAggregator::Make(&ctx_, MakeAggregates(), &aggregator));
+  std::vector<Datum> results;
+  ASSERT_OK(aggregator->Finish(&results));
+  ASSERT_EQ(results.size(), 3);
+  ASSERT_FALSE(results[0].scalar()->is_valid);
+  ASSERT_EQ(0, Int64Value(results[1]));
+  ASSERT_EQ(0, Int64Value(results[2]));
+}
+
+TEST_F(TestBatchAggregator, Threads) {
+  std::unique_ptr<BatchAggregator> aggregator;
+  ASSERT_OK(BatchAggregator::Make(&ctx_, MakeAggregates(), &aggregator));
+
+  const int kNumThreads = 4;
+  const int kNumRepetitions = 25;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kNumRepetitions; ++j) {
+        for (const auto& batch : batches_) {
+          ASSERT_OK(aggregator->Consume(*batch));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(aggregator->num_rows(), 4 * kNumThreads * kNumRepetitions);
+
+  std::vector<Datum> results;
+  ASSERT_OK(aggregator->Finish(&results));
+  AssertResults(results, 7 * kNumThreads * kNumRepetitions,
+                2 * kNumThreads * kNumRepetitions, 4 * kNumThreads * kNumRepetitions);
+}
+
+TEST_F(TestBatchAggregator, FailedStateAllocation) {
+  FailingMemoryPool pool;
+  FunctionContext ctx(&pool);
+  std::unique_ptr<BatchAggregator> aggregator;
+  ASSERT_OK(BatchAggregator::Make(&ctx, MakeAggregates(), &aggregator));
+
+  pool.set_fail(true);
+  ASSERT_RAISES(OutOfMemory, aggregator->Consume(*batches_[0]));
+  // The thread's incomplete states were not kept
+  pool.set_fail(false);
+  std::vector<Datum> results;
+  ASSERT_OK(aggregator->Finish(&results));
+  ASSERT_EQ(results.size(), 3);
+  ASSERT_FALSE(results[0].scalar()->is_valid);
+  ASSERT_EQ(0, Int64Value(results[1]));
+  ASSERT_EQ(0, Int64Value(results[2]));
+
+  ASSERT_OK(aggregator->Consume(*batches_[0]));
+  ASSERT_OK(aggregator->Finish(&results));
+  AssertResults(results, 3, 2, 3);
+}
+
+TEST_F(TestBatchAggregator, FusedColumn) {
+  // Several aggregates of a column spanning several chunks of the fused pass
+  auto rand = random::RandomArrayGenerator(0x5487658);
+  auto x = rand.Int32(50000, -1000, 1000, 0.1);
+  auto batch = RecordBatch::Make(schema({field("x", int32())}), x->length(), {x});
+
+  std::unique_ptr<BatchAggregator> aggregator;
+  ASSERT_OK(BatchAggregator::Make(
+      &ctx_,
+      {BatchAggregate("x", MakeSumAggregateFunction(*int32(), &ctx_)),
+       BatchAggregate::CountAll(),
+       BatchAggregate("x", MakeCount(&ctx_, CountOptions(CountOptions::COUNT_NULL))),
+       BatchAggregate("x", MakeMinMaxAggregateFunction(*int32(), &ctx_,
+                                                       MinMaxOptions()))},
+      &aggregator));
+  ASSERT_OK(aggregator->Consume(*batch));
+  ASSERT_OK(aggregator->Consume(*batch->Slice(7)));
+  std::vector<Datum> results;
+  ASSERT_OK(aggregator->Finish(&results));
+  ASSERT_EQ(results.size(), 4);
+
+  auto x_slice = x->Slice(7);
+  Datum expected, expected_slice;
+  ASSERT_OK(Sum(&ctx_, x, &expected));
+  ASSERT_OK(Sum(&ctx_, x_slice, &expected_slice));
+  ASSERT_EQ(Int64Value(expected) + Int64Value(expected_slice), Int64Value(results[0]));
+  ASSERT_EQ(2 * x->length() - 7, Int64Value(results[1]));
+  ASSERT_EQ(x->null_count() + x_slice->null_count(), Int64Value(results[2]));
+  ASSERT_OK(MinMax(&ctx_, MinMaxOptions(), x, &expected));
+  ASSERT_TRUE(expected.Equals(results[3]));
+}
+
+TEST_F(TestBatchAggregator, MissingField) {
+  std::unique_ptr<BatchAggregator> aggregator;
+  ASSERT_OK(BatchAggregator::Make(
+      &ctx_, {BatchAggregate("z", MakeSumAggregateFunction(*int32(), &ctx_))},
+      &aggregator));
+  ASSERT_RAISES(Invalid, aggregator->Consume(*batches_[0]));
+}
+
 }  // namespace compute
 }  // namespace arrow
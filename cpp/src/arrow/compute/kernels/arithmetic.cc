@@ -0,0 +1,876 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/decimal_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/macros.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+using detail::DecimalWords;
+
+namespace {
+
+// Failures are looked for once per block of values, so that the loop over the
+// values of a block has no early exit and can be vectorized
+constexpr int64_t kBlockSize = 256;
+
+template <typename T, typename R = T>
+using enable_if_signed_t =
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                            R>::type;
+
+template <typename T, typename R = T>
+using enable_if_unsigned_t =
+    typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value,
+                            R>::type;
+
+template <typename T, typename R = T>
+using enable_if_integral_t = typename std::enable_if<std::is_integral<T>::value, R>::type;
+
+template <typename T, typename R = T>
+using enable_if_floating_t =
+    typename std::enable_if<std::is_floating_point<T>::value, R>::type;
+
+// Integer operations are done on unsigned values, which wrap around rather
+// than being undefined on overflow
+template <typename T>
+using Unsigned = typename std::make_unsigned<T>::type;
+
+template <typename T>
+enable_if_integral_t<T> WrappingNegate(T value) {
+  return static_cast<T>(Unsigned<T>(0) - static_cast<Unsigned<T>>(value));
+}
+
+struct AddOp {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<Unsigned<T>>(left) +
+                          static_cast<Unsigned<T>>(right));
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right) {
+    return left + right;
+  }
+
+  // Whether the operands have the same sign, differing from the result's
+  template <typename T>
+  static enable_if_signed_t<T, bool> Overflows(T left, T right, T result) {
+    return ((left ^ result) & (right ^ result)) < 0;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T, bool> Overflows(T left, T right, T result) {
+    return result < left;
+  }
+};
+
+struct SubtractOp {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<Unsigned<T>>(left) -
+                          static_cast<Unsigned<T>>(right));
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right) {
+    return left - right;
+  }
+
+  // Whether the operands have different signs, the result's differing from
+  // the left one's
+  template <typename T>
+  static enable_if_signed_t<T, bool> Overflows(T left, T right, T result) {
+    return ((left ^ right) & (left ^ result)) < 0;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T, bool> Overflows(T left, T right, T result) {
+    return left < right;
+  }
+};
+
+struct MultiplyOp {
+  // Products of values narrower than 64 bits are computed exactly in 64 bits
+  template <typename T>
+  using Wide = typename std::conditional<std::is_signed<T>::value, int64_t,
+                                         uint64_t>::type;
+
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<Unsigned<Wide<T>>>(left) *
+                          static_cast<Unsigned<Wide<T>>>(right));
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right) {
+    return left * right;
+  }
+
+  template <typename T>
+  static enable_if_integral_t<T, bool> Overflows(T left, T right, T result) {
+    return Overflows64(left, right, result,
+                       std::integral_constant<bool, (sizeof(T) < 8)>());
+  }
+
+  template <typename T>
+  static bool Overflows64(T left, T right, T result, std::true_type) {
+    return static_cast<Wide<T>>(left) * static_cast<Wide<T>>(right) !=
+           static_cast<Wide<T>>(result);
+  }
+
+  template <typename T>
+  static bool Overflows64(T left, T right, T result, std::false_type) {
+#if defined(__GNUC__) || defined(__clang__)
+    T product;
+    return __builtin_mul_overflow(left, right, &product);
+#else
+    if (left == 0) {
+      return false;
+    }
+    if (std::is_signed<T>::value && left == -1) {
+      return right == std::numeric_limits<T>::min();
+    }
+    return result / left != right;
+#endif
+  }
+};
+
+struct DivideOp {
+  template <typename T>
+  static enable_if_signed_t<T> Call(T left, T right) {
+    // Dividing the minimum by -1 overflows, and division by zero is reported
+    // as an error
+    if (right == -1) {
+      return WrappingNegate(left);
+    }
+    return right == 0 ? 0 : left / right;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T> Call(T left, T right) {
+    return right == 0 ? 0 : left / right;
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right) {
+    return left / right;
+  }
+
+  template <typename T>
+  static enable_if_signed_t<T, bool> Overflows(T left, T right, T result) {
+    return left == std::numeric_limits<T>::min() && right == -1;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T, bool> Overflows(T left, T right, T result) {
+    return false;
+  }
+};
+
+template <typename Op>
+const char* OperatorName();
+
+template <>
+const char* OperatorName<AddOp>() {
+  return "addition";
+}
+
+template <>
+const char* OperatorName<SubtractOp>() {
+  return "subtraction";
+}
+
+template <>
+const char* OperatorName<MultiplyOp>() {
+  return "multiplication";
+}
+
+template <>
+const char* OperatorName<DivideOp>() {
+  return "division";
+}
+
+// Whether computing left op right is an error
+template <typename Op, bool kCheckOverflow, typename T>
+enable_if_integral_t<T, bool> BinaryFails(T left, T right, T result) {
+  return (std::is_same<Op, DivideOp>::value && right == 0) ||
+         (kCheckOverflow && Op::Overflows(left, right, result));
+}
+
+template <typename Op, bool kCheckOverflow, typename T>
+enable_if_floating_t<T, bool> BinaryFails(T left, T right, T result) {
+  return false;
+}
+
+template <typename Op, typename T>
+Status BinaryFailure(T left, T right) {
+  if (std::is_same<Op, DivideOp>::value && right == 0) {
+    return Status::Invalid("Integer division by zero");
+  }
+  return Status::Invalid("Integer overflow in ", OperatorName<Op>());
+}
+
+// Write left(i) op right(i) into out, values in null slots (per valid_bits,
+// which may be null if there are none) not being checked for failures
+template <typename Op, bool kCheckOverflow, typename T, typename Left, typename Right>
+Status ApplyBinary(Left&& left, Right&& right, int64_t length, const uint8_t* valid_bits,
+                   T* out) {
+  for (int64_t start = 0; start < length; start += kBlockSize) {
+    const int64_t end = std::min(length, start + kBlockSize);
+    bool failed = false;
+    for (int64_t i = start; i < end; ++i) {
+      const T l = left(i);
+      const T r = right(i);
+      out[i] = Op::template Call<T>(l, r);
+      failed |= BinaryFails<Op, kCheckOverflow>(l, r, out[i]);
+    }
+    if (ARROW_PREDICT_FALSE(failed)) {
+      for (int64_t i = start; i < end; ++i) {
+        if ((valid_bits == nullptr || BitUtil::GetBit(valid_bits, i)) &&
+            BinaryFails<Op, kCheckOverflow>(left(i), right(i), out[i])) {
+          return BinaryFailure<Op>(left(i), right(i));
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+const uint8_t* ValidBits(const ArrayData& data) {
+  return data.GetNullCount() == 0 ? nullptr : data.buffers[0]->data();
+}
+
+// Assign the validity of the output of an operation between an array and a
+// scalar.  The output is all null for a null scalar, its values zeroed.
+Status AssignNulls(FunctionContext* ctx, const ArrayData& array, const Scalar& scalar,
+                   ArrayData* out) {
+  if (scalar.is_valid) {
+    return detail::PropagateNulls(ctx, array, out);
+  }
+  const int byte_width = checked_cast<const FixedWidthType&>(*out->type).bit_width() / 8;
+  std::memset(out->buffers[1]->mutable_data(), 0,
+              static_cast<size_t>(out->length * byte_width));
+  return detail::SetAllNulls(ctx, array, out);
+}
+
+template <typename ArrowType, typename Op, bool kCheckOverflow>
+class ArithmeticKernel final : public BinaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  explicit ArithmeticKernel(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out_datum) override {
+    ArrayData* out = out_datum->array().get();
+    T* out_values = out->GetMutableValues<T>(1);
+
+    if (left.is_array() && right.is_array()) {
+      RETURN_NOT_OK(
+          detail::AssignNullIntersection(ctx, *left.array(), *right.array(), out));
+      const T* left_values = left.array()->GetValues<T>(1);
+      const T* right_values = right.array()->GetValues<T>(1);
+      return ApplyBinary<Op, kCheckOverflow>(
+          [left_values](int64_t i) { return left_values[i]; },
+          [right_values](int64_t i) { return right_values[i]; }, out->length,
+          ValidBits(*out), out_values);
+    }
+
+    if (left.is_array() && right.is_scalar()) {
+      RETURN_NOT_OK(AssignNulls(ctx, *left.array(), *right.scalar(), out));
+      if (!right.scalar()->is_valid) {
+        return Status::OK();
+      }
+      const T* left_values = left.array()->GetValues<T>(1);
+      const T right_value = checked_cast<const ScalarType&>(*right.scalar()).value;
+      return ApplyBinary<Op, kCheckOverflow>(
+          [left_values](int64_t i) { return left_values[i]; },
+          [right_value](int64_t) { return right_value; }, out->length, ValidBits(*out),
+          out_values);
+    }
+
+    if (left.is_scalar() && right.is_array()) {
+      RETURN_NOT_OK(AssignNulls(ctx, *right.array(), *left.scalar(), out));
+      if (!left.scalar()->is_valid) {
+        return Status::OK();
+      }
+      const T left_value = checked_cast<const ScalarType&>(*left.scalar()).value;
+      const T* right_values = right.array()->GetValues<T>(1);
+      return ApplyBinary<Op, kCheckOverflow>(
+          [left_value](int64_t) { return left_value; },
+          [right_values](int64_t i) { return right_values[i]; }, out->length,
+          ValidBits(*out), out_values);
+    }
+
+    return Status::Invalid("Invalid datum signature for ArithmeticKernel::Call");
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+// ----------------------------------------------------------------------
+// Decimals
+
+// The operations on 128-bit values, wrapping around on overflow
+template <typename Op>
+struct DecimalOp;
+
+template <>
+struct DecimalOp<AddOp> {
+  static DecimalWords Call(DecimalWords left, DecimalWords right) {
+    return detail::WrappingAdd(left, right);
+  }
+
+  static bool Overflows(DecimalWords left, DecimalWords right, DecimalWords result) {
+    return AddOp::Overflows(left.high, right.high, result.high);
+  }
+};
+
+template <>
+struct DecimalOp<SubtractOp> {
+  static DecimalWords Call(DecimalWords left, DecimalWords right) {
+    return detail::WrappingSubtract(left, right);
+  }
+
+  static bool Overflows(DecimalWords left, DecimalWords right, DecimalWords result) {
+    return SubtractOp::Overflows(left.high, right.high, result.high);
+  }
+};
+
+template <>
+struct DecimalOp<MultiplyOp> {
+  static DecimalWords Call(DecimalWords left, DecimalWords right) {
+    return detail::FromBasicDecimal(detail::ToBasicDecimal(left) *
+                                    detail::ToBasicDecimal(right));
+  }
+
+  static bool Overflows(DecimalWords left, DecimalWords right, DecimalWords result) {
+    const BasicDecimal128 left_value = detail::ToBasicDecimal(left);
+    return left_value != 0 &&
+           detail::ToBasicDecimal(result) / left_value != detail::ToBasicDecimal(right);
+  }
+};
+
+// Whether the result overflows 128 bits or has more than 38 digits
+template <typename Op>
+bool DecimalFails(DecimalWords left, DecimalWords right, DecimalWords result) {
+  static const DecimalWords max_value =
+      detail::FromBasicDecimal(BasicDecimal128::GetMaxValue());
+  static const DecimalWords min_value =
+      detail::WrappingSubtract(DecimalWords{0, 0}, max_value);
+  return DecimalOp<Op>::Overflows(left, right, result) || result > max_value ||
+         result < min_value;
+}
+
+// As ApplyBinary, for decimals.  Each block of values is first computed with
+// 64-bit arithmetic if try_int64, and again with 128-bit arithmetic if any of
+// its operands or results doesn't fit in 64 bits.
+template <typename Op, bool kCheckOverflow, typename Left, typename Right>
+Status ApplyDecimalBinary(Left&& left, Right&& right, int64_t length,
+                          const uint8_t* valid_bits, bool try_int64, DecimalWords* out) {
+  for (int64_t start = 0; start < length; start += kBlockSize) {
+    const int64_t end = std::min(length, start + kBlockSize);
+    bool slow = !try_int64;
+    if (try_int64) {
+      for (int64_t i = start; i < end; ++i) {
+        const DecimalWords l = left(i);
+        const DecimalWords r = right(i);
+        const auto l64 = static_cast<int64_t>(l.low);
+        const auto r64 = static_cast<int64_t>(r.low);
+        const int64_t result = Op::template Call<int64_t>(l64, r64);
+        out[i] = detail::DecimalWordsFromInt64(result);
+        slow |= !detail::FitsInInt64(l) | !detail::FitsInInt64(r) |
+                Op::Overflows(l64, r64, result);
+      }
+    }
+    if (!ARROW_PREDICT_FALSE(slow)) {
+      continue;
+    }
+    bool failed = false;
+    for (int64_t i = start; i < end; ++i) {
+      out[i] = DecimalOp<Op>::Call(left(i), right(i));
+      failed |= kCheckOverflow && DecimalFails<Op>(left(i), right(i), out[i]);
+    }
+    if (ARROW_PREDICT_FALSE(failed)) {
+      for (int64_t i = start; i < end; ++i) {
+        if ((valid_bits == nullptr || BitUtil::GetBit(valid_bits, i)) &&
+            DecimalFails<Op>(left(i), right(i), out[i])) {
+          return Status::Invalid("Decimal overflow in ", OperatorName<Op>());
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+// The operands are rescaled to the scale of the output for additions and
+// subtractions
+template <typename Op, bool kCheckOverflow>
+class DecimalArithmeticKernel final : public BinaryKernel {
+ public:
+  DecimalArithmeticKernel(std::shared_ptr<DataType> type, int32_t left_delta_scale,
+                          int32_t right_delta_scale, bool try_int64)
+      : type_(std::move(type)),
+        left_delta_scale_(left_delta_scale),
+        right_delta_scale_(right_delta_scale),
+        try_int64_(try_int64) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out_datum) override {
+    ArrayData* out = out_datum->array().get();
+    DecimalWords* out_values = out->GetMutableValues<DecimalWords>(1);
+    std::shared_ptr<Buffer> left_scratch, right_scratch;
+
+    if (left.is_array() && right.is_array()) {
+      RETURN_NOT_OK(
+          detail::AssignNullIntersection(ctx, *left.array(), *right.array(), out));
+      const DecimalWords* left_values;
+      const DecimalWords* right_values;
+      RETURN_NOT_OK(
+          GetValues(ctx, *left.array(), left_delta_scale_, &left_scratch, &left_values));
+      RETURN_NOT_OK(GetValues(ctx, *right.array(), right_delta_scale_, &right_scratch,
+                              &right_values));
+      return ApplyDecimalBinary<Op, kCheckOverflow>(
+          [left_values](int64_t i) { return left_values[i]; },
+          [right_values](int64_t i) { return right_values[i]; }, out->length,
+          ValidBits(*out), try_int64_, out_values);
+    }
+
+    if (left.is_array() && right.is_scalar()) {
+      RETURN_NOT_OK(AssignNulls(ctx, *left.array(), *right.scalar(), out));
+      if (!right.scalar()->is_valid) {
+        return Status::OK();
+      }
+      const DecimalWords* left_values;
+      DecimalWords right_value;
+      RETURN_NOT_OK(
+          GetValues(ctx, *left.array(), left_delta_scale_, &left_scratch, &left_values));
+      RETURN_NOT_OK(GetValue(*right.scalar(), right_delta_scale_, &right_value));
+      return ApplyDecimalBinary<Op, kCheckOverflow>(
+          [left_values](int64_t i) { return left_values[i]; },
+          [right_value](int64_t) { return right_value; }, out->length, ValidBits(*out),
+          try_int64_, out_values);
+    }
+
+    if (left.is_scalar() && right.is_array()) {
+      RETURN_NOT_OK(AssignNulls(ctx, *right.array(), *left.scalar(), out));
+      if (!left.scalar()->is_valid) {
+        return Status::OK();
+      }
+      DecimalWords left_value;
+      const DecimalWords* right_values;
+      RETURN_NOT_OK(GetValue(*left.scalar(), left_delta_scale_, &left_value));
+      RETURN_NOT_OK(GetValues(ctx, *right.array(), right_delta_scale_, &right_scratch,
+                              &right_values));
+      return ApplyDecimalBinary<Op, kCheckOverflow>(
+          [left_value](int64_t) { return left_value; },
+          [right_values](int64_t i) { return right_values[i]; }, out->length,
+          ValidBits(*out), try_int64_, out_values);
+    }
+
+    return Status::Invalid("Invalid datum signature for DecimalArithmeticKernel::Call");
+  }
+
+ private:
+  // The values of the array, rescaled into scratch if needed
+  static Status GetValues(FunctionContext* ctx, const ArrayData& array,
+                          int32_t delta_scale, std::shared_ptr<Buffer>* scratch,
+                          const DecimalWords** out) {
+    if (delta_scale == 0) {
+      *out = array.GetValues<DecimalWords>(1);
+      return Status::OK();
+    }
+    RETURN_NOT_OK(ctx->Allocate(array.length * sizeof(DecimalWords), scratch));
+    auto values = reinterpret_cast<DecimalWords*>((*scratch)->mutable_data());
+    RETURN_NOT_OK(detail::RescaleDecimals(array, delta_scale, kCheckOverflow, values));
+    *out = values;
+    return Status::OK();
+  }
+
+  static Status GetValue(const Scalar& scalar, int32_t delta_scale, DecimalWords* out) {
+    Decimal128 value = checked_cast<const Decimal128Scalar&>(scalar).value;
+    if (delta_scale != 0) {
+      if (kCheckOverflow) {
+        const int32_t scale = checked_cast<const Decimal128Type&>(*scalar.type).scale();
+        ARROW_ASSIGN_OR_RAISE(value, value.Rescale(scale, scale + delta_scale));
+      } else {
+        value = value.IncreaseScaleBy(delta_scale);
+      }
+    }
+    *out = detail::FromBasicDecimal(value);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> type_;
+  int32_t left_delta_scale_;
+  int32_t right_delta_scale_;
+  bool try_int64_;
+};
+
+constexpr int32_t kMaxInt64Precision = 18;
+
+template <typename Op>
+Status MakeDecimalKernel(std::shared_ptr<DataType> type, int32_t left_delta_scale,
+                         int32_t right_delta_scale, bool check_overflow, bool try_int64,
+                         std::unique_ptr<BinaryKernel>* out) {
+  if (check_overflow) {
+    out->reset(new DecimalArithmeticKernel<Op, true>(
+        std::move(type), left_delta_scale, right_delta_scale, try_int64));
+  } else {
+    out->reset(new DecimalArithmeticKernel<Op, false>(
+        std::move(type), left_delta_scale, right_delta_scale, try_int64));
+  }
+  return Status::OK();
+}
+
+// Results can only have more than 38 digits, and therefore need checking,
+// when their precision is capped
+Status MakeDecimalKernel(ArithmeticOperator op, const DataType& left_type,
+                         const DataType& right_type, const ArithmeticOptions& options,
+                         std::unique_ptr<BinaryKernel>* out) {
+  if (left_type.id() != Type::DECIMAL || right_type.id() != Type::DECIMAL) {
+    return Status::TypeError("Arithmetic operations on decimals expect decimal ",
+                             "operands, got ", left_type, " and ", right_type);
+  }
+  const auto& left = checked_cast<const Decimal128Type&>(left_type);
+  const auto& right = checked_cast<const Decimal128Type&>(right_type);
+  const int32_t max_precision = Decimal128Type::kMaxPrecision;
+
+  switch (op) {
+    case ArithmeticOperator::ADD:
+    case ArithmeticOperator::SUBTRACT: {
+      const int32_t scale = std::max(left.scale(), right.scale());
+      const int32_t left_precision = left.precision() + scale - left.scale();
+      const int32_t right_precision = right.precision() + scale - right.scale();
+      const int32_t precision = std::max(left_precision, right_precision) + 1;
+      auto type = decimal(std::min(precision, max_precision), scale);
+      const bool check_overflow = options.check_overflow && precision > max_precision;
+      const bool try_int64 =
+          std::max(left_precision, right_precision) <= kMaxInt64Precision;
+      if (op == ArithmeticOperator::ADD) {
+        return MakeDecimalKernel<AddOp>(type, scale - left.scale(), scale - right.scale(),
+                                        check_overflow, try_int64, out);
+      }
+      return MakeDecimalKernel<SubtractOp>(type, scale - left.scale(),
+                                           scale - right.scale(), check_overflow,
+                                           try_int64, out);
+    }
+    case ArithmeticOperator::MULTIPLY: {
+      const int32_t scale = left.scale() + right.scale();
+      if (scale > max_precision) {
+        return Status::Invalid("Decimal multiplication result scale ", scale,
+                               " exceeds the maximum precision");
+      }
+      const int32_t precision = left.precision() + right.precision() + 1;
+      auto type = decimal(std::min(precision, max_precision), scale);
+      const bool check_overflow = options.check_overflow && precision > max_precision;
+      const bool try_int64 = precision - 1 <= kMaxInt64Precision;
+      return MakeDecimalKernel<MultiplyOp>(type, 0, 0, check_overflow, try_int64, out);
+    }
+    case ArithmeticOperator::DIVIDE:
+      return Status::NotImplemented("Decimal division");
+  }
+  return Status::Invalid("Invalid arithmetic operator");
+}
+
+struct NegateOp {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T value) {
+    return WrappingNegate(value);
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T value) {
+    return -value;
+  }
+
+  template <typename T>
+  static enable_if_signed_t<T, bool> Overflows(T value) {
+    return value == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T, bool> Overflows(T value) {
+    return value != 0;
+  }
+};
+
+struct AbsOp {
+  template <typename T>
+  static enable_if_signed_t<T> Call(T value) {
+    return value < 0 ? WrappingNegate(value) : value;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T> Call(T value) {
+    return value;
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T value) {
+    return std::abs(value);
+  }
+
+  template <typename T>
+  static enable_if_signed_t<T, bool> Overflows(T value) {
+    return value == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T, bool> Overflows(T value) {
+    return false;
+  }
+};
+
+template <>
+const char* OperatorName<NegateOp>() {
+  return "negation";
+}
+
+template <>
+const char* OperatorName<AbsOp>() {
+  return "absolute value";
+}
+
+template <typename Op, bool kCheckOverflow, typename T>
+enable_if_integral_t<T, bool> UnaryFails(T value) {
+  return kCheckOverflow && Op::Overflows(value);
+}
+
+template <typename Op, bool kCheckOverflow, typename T>
+enable_if_floating_t<T, bool> UnaryFails(T value) {
+  return false;
+}
+
+// As ApplyBinary, for a unary operator
+template <typename Op, bool kCheckOverflow, typename T>
+Status ApplyUnary(const T* values, int64_t length, const uint8_t* valid_bits, T* out) {
+  for (int64_t start = 0; start < length; start += kBlockSize) {
+    const int64_t end = std::min(length, start + kBlockSize);
+    bool failed = false;
+    for (int64_t i = start; i < end; ++i) {
+      out[i] = Op::template Call<T>(values[i]);
+      failed |= UnaryFails<Op, kCheckOverflow>(values[i]);
+    }
+    if (ARROW_PREDICT_FALSE(failed)) {
+      for (int64_t i = start; i < end; ++i) {
+        if ((valid_bits == nullptr || BitUtil::GetBit(valid_bits, i)) &&
+            UnaryFails<Op, kCheckOverflow>(values[i])) {
+          return Status::Invalid("Integer overflow in ", OperatorName<Op>());
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+template <typename ArrowType, typename Op, bool kCheckOverflow>
+class UnaryArithmeticKernel final : public UnaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+
+  explicit UnaryArithmeticKernel(std::shared_ptr<DataType> type)
+      : type_(std::move(type)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    if (!input.is_array()) {
+      return Status::Invalid("UnaryArithmeticKernel expects array values");
+    }
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, *input.array(), out));
+    return ApplyUnary<Op, kCheckOverflow>(input.array()->GetValues<T>(1), out->length,
+                                          ValidBits(*out), out->GetMutableValues<T>(1));
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+template <template <typename, typename, bool> class Kernel, typename Op,
+          typename KernelBase>
+struct MakeKernelVisitor {
+  template <typename ArrowType>
+  enable_if_number<ArrowType, Status> Visit(const ArrowType&) {
+    if (check_overflow) {
+      out->reset(new Kernel<ArrowType, Op, true>(type));
+    } else {
+      out->reset(new Kernel<ArrowType, Op, false>(type));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType&) { return NotImplemented(); }
+
+  Status Visit(const DataType&) { return NotImplemented(); }
+
+  Status NotImplemented() {
+    return Status::NotImplemented("Arithmetic operations on ", *type, " arrays");
+  }
+
+  std::shared_ptr<DataType> type;
+  bool check_overflow;
+  std::unique_ptr<KernelBase>* out;
+};
+
+template <typename Op>
+Status MakeBinaryKernel(const std::shared_ptr<DataType>& type,
+                        const ArithmeticOptions& options,
+                        std::unique_ptr<BinaryKernel>* out) {
+  MakeKernelVisitor<ArithmeticKernel, Op, BinaryKernel> visitor{
+      type, options.check_overflow, out};
+  return VisitTypeInline(*type, &visitor);
+}
+
+Status MakeBinaryKernel(ArithmeticOperator op, const std::shared_ptr<DataType>& type,
+                        const ArithmeticOptions& options,
+                        std::unique_ptr<BinaryKernel>* out) {
+  switch (op) {
+    case ArithmeticOperator::ADD:
+      return MakeBinaryKernel<AddOp>(type, options, out);
+    case ArithmeticOperator::SUBTRACT:
+      return MakeBinaryKernel<SubtractOp>(type, options, out);
+    case ArithmeticOperator::MULTIPLY:
+      return MakeBinaryKernel<MultiplyOp>(type, options, out);
+    case ArithmeticOperator::DIVIDE:
+      return MakeBinaryKernel<DivideOp>(type, options, out);
+  }
+  return Status::Invalid("Invalid arithmetic operator");
+}
+
+// Apply the kernel to each chunk of the array-like datum against the scalar
+Status InvokeArrayScalarKernel(FunctionContext* ctx, BinaryKernel* kernel,
+                               const Datum& array_like, const Datum& scalar,
+                               bool scalar_left, Datum* out) {
+  std::vector<Datum> outputs;
+  for (const auto& chunk : array_like.chunks()) {
+    Datum output(ArrayData::Make(kernel->out_type(), chunk->length()));
+    Datum array(chunk->data());
+    if (scalar_left) {
+      RETURN_NOT_OK(kernel->Call(ctx, scalar, array, &output));
+    } else {
+      RETURN_NOT_OK(kernel->Call(ctx, array, scalar, &output));
+    }
+    outputs.push_back(std::move(output));
+  }
+  *out = detail::WrapDatumsLike(array_like, kernel->out_type(), outputs);
+  return Status::OK();
+}
+
+template <typename Op>
+Status ExecuteUnary(FunctionContext* ctx, const Datum& value,
+                    const ArithmeticOptions& options, Datum* out) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Unary arithmetic operations expect array-like values");
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  MakeKernelVisitor<UnaryArithmeticKernel, Op, UnaryKernel> visitor{
+      value.type(), options.check_overflow, &kernel};
+  RETURN_NOT_OK(VisitTypeInline(*value.type(), &visitor));
+
+  detail::PrimitiveAllocatingUnaryKernel allocating(kernel.get());
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &allocating, value, &outputs));
+  *out = detail::WrapDatumsLike(value, kernel->out_type(), outputs);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Arithmetic(FunctionContext* ctx, ArithmeticOperator op, const Datum& left,
+                  const Datum& right, const ArithmeticOptions& options, Datum* out) {
+  std::unique_ptr<BinaryKernel> kernel;
+  if (left.type()->id() == Type::DECIMAL || right.type()->id() == Type::DECIMAL) {
+    // Decimal operands may have differing precisions and scales
+    RETURN_NOT_OK(MakeDecimalKernel(op, *left.type(), *right.type(), options, &kernel));
+  } else if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("Arithmetic operations expect operands of the same type, ",
+                             "got ", *left.type(), " and ", *right.type());
+  } else {
+    RETURN_NOT_OK(MakeBinaryKernel(op, left.type(), options, &kernel));
+  }
+  detail::PrimitiveAllocatingBinaryKernel allocating(kernel.get());
+
+  if (left.is_arraylike() && right.is_arraylike()) {
+    if (left.kind() == Datum::CHUNKED_ARRAY || right.kind() == Datum::CHUNKED_ARRAY) {
+      // Chunked if either operand is
+      std::vector<Datum> outputs;
+      RETURN_NOT_OK(
+          detail::InvokeBinaryArrayKernel(ctx, &allocating, left, right, &outputs));
+      std::vector<std::shared_ptr<Array>> chunks;
+      for (const auto& output : outputs) {
+        chunks.push_back(output.make_array());
+      }
+      *out = std::make_shared<ChunkedArray>(std::move(chunks), kernel->out_type());
+      return Status::OK();
+    }
+    return detail::InvokeBinaryArrayKernel(ctx, &allocating, left, right, out);
+  }
+  if (left.is_arraylike() && right.is_scalar()) {
+    return InvokeArrayScalarKernel(ctx, &allocating, left, right, false, out);
+  }
+  if (left.is_scalar() && right.is_arraylike()) {
+    return InvokeArrayScalarKernel(ctx, &allocating, right, left, true, out);
+  }
+  return Status::Invalid("Invalid datum signature for Arithmetic");
+}
+
+Status Negate(FunctionContext* ctx, const Datum& value, const ArithmeticOptions& options,
+              Datum* out) {
+  return ExecuteUnary<NegateOp>(ctx, value, options, out);
+}
+
+Status Abs(FunctionContext* ctx, const Datum& value, const ArithmeticOptions& options,
+           Datum* out) {
+  return ExecuteUnary<AbsOp>(ctx, value, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+enum ArithmeticOperator {
+  ADD,
+  SUBTRACT,
+  MULTIPLY,
+  DIVIDE,
+};
+
+struct ARROW_EXPORT ArithmeticOptions {
+  ArithmeticOptions() {}
+
+  static ArithmeticOptions Defaults() { return ArithmeticOptions(); }
+
+  /// Whether integer overflow is an error.  If false, integer results wrap
+  /// around.  Integer division by zero is always an error.  Decimal results
+  /// which exceed 38 digits are an error too, as are operands rescaled with
+  /// data loss.
+  bool check_overflow = false;
+};
+
+/// \brief Apply an arithmetic operator to numeric arrays, or to a numeric
+/// array and a scalar
+///
+/// Both operands must have the same type, which is the type of the output.
+/// A slot of the output is null if either operand is null there, so that the
+/// output is all null if an operand is a null scalar.  Floating point
+/// operations follow ieee-754 semantics.
+///
+/// Decimal operands may have differing precisions and scales.  Additions and
+/// subtractions rescale both operands to the larger scale, with a precision of
+/// one more digit than the larger integral part.  Multiplications add the
+/// scales and the precisions, plus one.  The output precision is capped at 38.
+/// Division of decimals is not supported.
+///
+/// For example given left = [1, null, 3], right = [4, 5, 6] and SUBTRACT, the
+/// output will be [-3, null, -3]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] op the operator, computing left op right
+/// \param[in] left Array, ChunkedArray or Scalar
+/// \param[in] right Array, ChunkedArray or Scalar, at most one of left and
+///            right being a Scalar
+/// \param[in] options see ArithmeticOptions
+/// \param[out] out resulting datum, chunked if either operand is
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Arithmetic(FunctionContext* ctx, ArithmeticOperator op, const Datum& left,
+                  const Datum& right, const ArithmeticOptions& options, Datum* out);
+
+/// \brief Negate the values of a numeric array
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value Array or ChunkedArray
+/// \param[in] options see ArithmeticOptions.  Negating a non-zero unsigned
+///            integer overflows.
+/// \param[out] out resulting datum of the same type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Negate(FunctionContext* ctx, const Datum& value, const ArithmeticOptions& options,
+              Datum* out);
+
+/// \brief Compute the absolute values of a numeric array
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value Array or ChunkedArray
+/// \param[in] options see ArithmeticOptions
+/// \param[out] out resulting datum of the same type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Abs(FunctionContext* ctx, const Datum& value, const ArithmeticOptions& options,
+           Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
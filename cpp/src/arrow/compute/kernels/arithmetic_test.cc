@@ -0,0 +1,434 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/decimal.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename ArrowType>
+class TestArithmetic : public ComputeFixture, public TestBase {
+ protected:
+  using CType = typename ArrowType::c_type;
+
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<Scalar> MakeScalar(CType value) {
+    return *arrow::MakeScalar(type(), value);
+  }
+
+  std::shared_ptr<Array> MakeArray(const std::vector<CType>& values) {
+    std::shared_ptr<Array> out;
+    ArrayFromVector<ArrowType>(values, &out);
+    return out;
+  }
+
+  void AssertOutput(const Datum& actual, const std::shared_ptr<Array>& expected) {
+    ASSERT_TRUE(actual.is_array());
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysEqual(*expected, *actual.make_array());
+  }
+
+  void AssertBinary(ArithmeticOperator op, const Datum& left, const Datum& right,
+                    const std::string& expected,
+                    ArithmeticOptions options = ArithmeticOptions::Defaults()) {
+    Datum actual;
+    ASSERT_OK(Arithmetic(&this->ctx_, op, left, right, options, &actual));
+    AssertOutput(actual, ArrayFromJSON(type(), expected));
+  }
+
+  void AssertBinary(ArithmeticOperator op, const std::string& left,
+                    const std::string& right, const std::string& expected) {
+    AssertBinary(op, ArrayFromJSON(type(), left), ArrayFromJSON(type(), right),
+                 expected);
+  }
+
+  void AssertBinaryRaises(ArithmeticOperator op, const Datum& left, const Datum& right,
+                          bool check_overflow) {
+    ArithmeticOptions options;
+    options.check_overflow = check_overflow;
+    Datum actual;
+    ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, op, left, right, options, &actual));
+  }
+};
+
+template <typename ArrowType>
+class TestArithmeticNumeric : public TestArithmetic<ArrowType> {};
+TYPED_TEST_SUITE(TestArithmeticNumeric, NumericArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticIntegral : public TestArithmetic<ArrowType> {};
+TYPED_TEST_SUITE(TestArithmeticIntegral, IntegralArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticReal : public TestArithmetic<ArrowType> {};
+TYPED_TEST_SUITE(TestArithmeticReal, RealArrowTypes);
+
+class TestArithmeticMisc : public ComputeFixture, public TestBase {};
+
+TYPED_TEST(TestArithmeticNumeric, ArrayArray) {
+  this->AssertBinary(ADD, "[]", "[]", "[]");
+  this->AssertBinary(ADD, "[1, 2, null, 4, null]", "[5, null, 7, 8, null]",
+                     "[6, null, null, 12, null]");
+  this->AssertBinary(SUBTRACT, "[10, 20, null, 40]", "[1, 2, 3, null]",
+                     "[9, 18, null, null]");
+  this->AssertBinary(MULTIPLY, "[1, 2, null, 4]", "[5, 6, 7, 8]", "[5, 12, null, 32]");
+  this->AssertBinary(DIVIDE, "[8, 60, null, 9]", "[2, 3, 4, null]",
+                     "[4, 20, null, null]");
+}
+
+TYPED_TEST(TestArithmeticNumeric, ArrayScalar) {
+  auto values = ArrayFromJSON(this->type(), "[10, null, 4]");
+  this->AssertBinary(SUBTRACT, values, this->MakeScalar(2), "[8, null, 2]");
+  this->AssertBinary(SUBTRACT, this->MakeScalar(20), values, "[10, null, 16]");
+  this->AssertBinary(DIVIDE, values, this->MakeScalar(2), "[5, null, 2]");
+  this->AssertBinary(DIVIDE, this->MakeScalar(40), values, "[4, null, 10]");
+  this->AssertBinary(MULTIPLY, values->Slice(1), this->MakeScalar(3), "[null, 12]");
+
+  // A null scalar makes the output all null, even dividing by it
+  auto null_scalar = MakeNullScalar(this->type());
+  this->AssertBinary(ADD, values, null_scalar, "[null, null, null]");
+  this->AssertBinary(DIVIDE, values, null_scalar, "[null, null, null]");
+  this->AssertBinary(DIVIDE, null_scalar, values, "[null, null, null]");
+}
+
+TYPED_TEST(TestArithmeticNumeric, Chunked) {
+  auto left = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(this->type(), "[1, 2]"),
+                  ArrayFromJSON(this->type(), "[3, null, 5]")});
+  auto right = ArrayFromJSON(this->type(), "[10, 20, 30, 40, null]");
+  auto expected = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(this->type(), "[11, 22]"),
+                  ArrayFromJSON(this->type(), "[33, null, null]")});
+
+  for (const auto& args : std::vector<std::pair<Datum, Datum>>{{left, right},
+                                                                 {right, left}}) {
+    Datum actual;
+    ASSERT_OK(Arithmetic(&this->ctx_, ADD, args.first, args.second,
+                         ArithmeticOptions::Defaults(), &actual));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, actual.kind());
+    AssertChunkedEqual(*expected, *actual.chunked_array());
+  }
+
+  Datum actual;
+  ASSERT_OK(Arithmetic(&this->ctx_, MULTIPLY, left, this->MakeScalar(2),
+                       ArithmeticOptions::Defaults(), &actual));
+  AssertChunkedEqual(ChunkedArray({ArrayFromJSON(this->type(), "[2, 4]"),
+                                   ArrayFromJSON(this->type(), "[6, null, 10]")}),
+                     *actual.chunked_array());
+}
+
+TYPED_TEST(TestArithmeticNumeric, Random) {
+  using CType = typename TestFixture::CType;
+  // Bounds for which no operation overflows, except subtracting unsigned values
+  const auto bound = static_cast<CType>(
+      std::sqrt(static_cast<double>(std::numeric_limits<CType>::max())) / 2);
+  auto rand = random::RandomArrayGenerator(0x5eed);
+  const int64_t length = 1000;
+  auto left = rand.Numeric<TypeParam>(length, CType(0), bound, 0.1);
+  auto right = rand.Numeric<TypeParam>(length, CType(1), bound, 0.1);
+  const auto* left_values = left->data()->template GetValues<CType>(1);
+  const auto* right_values = right->data()->template GetValues<CType>(1);
+
+  for (auto op : {ADD, SUBTRACT, MULTIPLY, DIVIDE}) {
+    std::vector<bool> is_valid(length);
+    std::vector<CType> values(length);
+    for (int64_t i = 0; i < length; ++i) {
+      const CType l = left_values[i];
+      const CType r = right_values[i];
+      is_valid[i] = left->IsValid(i) && right->IsValid(i);
+      values[i] = static_cast<CType>(op == ADD        ? l + r
+                                     : op == SUBTRACT ? l - r
+                                     : op == MULTIPLY ? l * r
+                                                      : l / r);
+    }
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<TypeParam>(is_valid, values, &expected);
+
+    ArithmeticOptions options;
+    for (bool check_overflow : {false, true}) {
+      if (check_overflow && op == SUBTRACT) continue;
+      options.check_overflow = check_overflow;
+      Datum actual;
+      ASSERT_OK(Arithmetic(&this->ctx_, op, left, right, options, &actual));
+      this->AssertOutput(actual, expected);
+      ASSERT_OK(Arithmetic(&this->ctx_, op, left->Slice(300), right->Slice(300),
+                           options, &actual));
+      this->AssertOutput(actual, expected->Slice(300));
+    }
+  }
+}
+
+TYPED_TEST(TestArithmeticIntegral, Overflow) {
+  using CType = typename TestFixture::CType;
+  const CType min = std::numeric_limits<CType>::min();
+  const CType max = std::numeric_limits<CType>::max();
+  auto left = this->MakeArray({max, 1});
+  auto one = this->MakeScalar(1);
+
+  // Results wrap around unless checked
+  Datum actual;
+  ASSERT_OK(Arithmetic(&this->ctx_, ADD, left, one, ArithmeticOptions::Defaults(),
+                       &actual));
+  this->AssertOutput(actual, this->MakeArray({min, 2}));
+  this->AssertBinaryRaises(ADD, left, one, true);
+  this->AssertBinaryRaises(SUBTRACT, this->MakeArray({1, min}), one, true);
+  this->AssertBinaryRaises(MULTIPLY, left, this->MakeScalar(2), true);
+
+  // Overflowing values in null slots are ignored
+  std::shared_ptr<Array> with_null;
+  ArrayFromVector<TypeParam>({false, true}, {max, 1}, &with_null);
+  ArithmeticOptions options;
+  options.check_overflow = true;
+  ASSERT_OK(Arithmetic(&this->ctx_, ADD, with_null, one, options, &actual));
+  this->AssertOutput(actual, ArrayFromJSON(this->type(), "[null, 2]"));
+
+  // Failures are found after the first block of values
+  std::vector<CType> values(1000, 1);
+  values.back() = max;
+  this->AssertBinaryRaises(ADD, this->MakeArray(values), one, true);
+}
+
+TYPED_TEST(TestArithmeticIntegral, DivideByZero) {
+  auto left = ArrayFromJSON(this->type(), "[1, 2, 3]");
+  this->AssertBinaryRaises(DIVIDE, left, ArrayFromJSON(this->type(), "[1, 0, 3]"),
+                           false);
+  this->AssertBinaryRaises(DIVIDE, left, this->MakeScalar(0), false);
+  this->AssertBinary(DIVIDE, "[1, 2, 3]", "[1, null, 3]", "[1, null, 1]");
+}
+
+TYPED_TEST(TestArithmeticReal, SpecialValues) {
+  this->AssertBinary(DIVIDE, "[1, -1, 0]", "[0, 0, 1]", "[Inf, -Inf, 0]");
+  this->AssertBinary(MULTIPLY, "[Inf, 1.5]", "[-1, 2.5]", "[-Inf, 3.75]");
+}
+
+TEST_F(TestArithmeticMisc, SignedOverflow) {
+  ArithmeticOptions options;
+  options.check_overflow = true;
+  Datum actual;
+  auto min = ArrayFromJSON(int32(), "[-2147483648]");
+  auto minus_one = *MakeScalar(int32(), -1);
+  ASSERT_OK(Arithmetic(&ctx_, DIVIDE, min, minus_one, ArithmeticOptions::Defaults(),
+                       &actual));
+  AssertArraysEqual(*min, *actual.make_array());
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, DIVIDE, min, minus_one, options, &actual));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, MULTIPLY, min, minus_one, options, &actual));
+  ASSERT_OK(Arithmetic(&ctx_, MULTIPLY, ArrayFromJSON(int64(), "[-4611686018427387904]"),
+                       *MakeScalar(int64(), 2), options, &actual));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, MULTIPLY,
+                                    ArrayFromJSON(int64(), "[4611686018427387904]"),
+                                    *MakeScalar(int64(), 2), options, &actual));
+}
+
+TYPED_TEST(TestArithmeticNumeric, NegateAndAbs) {
+  auto values = ArrayFromJSON(this->type(), "[0, 1, null, 100]");
+  Datum actual;
+  ASSERT_OK(Abs(&this->ctx_, values, ArithmeticOptions::Defaults(), &actual));
+  this->AssertOutput(actual, values);
+  ASSERT_OK(Negate(&this->ctx_, values, ArithmeticOptions::Defaults(), &actual));
+  ASSERT_OK(Negate(&this->ctx_, actual, ArithmeticOptions::Defaults(), &actual));
+  this->AssertOutput(actual, values);
+}
+
+TEST_F(TestArithmeticMisc, NegateAndAbsSigned) {
+  ArithmeticOptions options;
+  options.check_overflow = true;
+  Datum actual;
+  auto values = ArrayFromJSON(int8(), "[-128, -5, null, 0, 7]");
+  ASSERT_OK(Negate(&ctx_, values->Slice(1), options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[5, null, 0, -7]"), *actual.make_array());
+  ASSERT_OK(Abs(&ctx_, values, ArithmeticOptions::Defaults(), &actual));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[-128, 5, null, 0, 7]"),
+                    *actual.make_array());
+  ASSERT_RAISES(Invalid, Negate(&ctx_, values, options, &actual));
+  ASSERT_RAISES(Invalid, Abs(&ctx_, values, options, &actual));
+  // Negating non-zero unsigned values overflows
+  auto unsigned_values = ArrayFromJSON(uint8(), "[0, 1]");
+  ASSERT_RAISES(Invalid, Negate(&ctx_, unsigned_values, options, &actual));
+
+  ASSERT_OK(Abs(&ctx_, ArrayFromJSON(float64(), "[-1.5, 0, null, 2]"),
+                ArithmeticOptions::Defaults(), &actual));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1.5, 0, null, 2]"), *actual.make_array());
+}
+
+TEST_F(TestArithmeticMisc, Errors) {
+  Datum actual;
+  const auto options = ArithmeticOptions::Defaults();
+  ASSERT_RAISES(TypeError, Arithmetic(&ctx_, ADD, ArrayFromJSON(int8(), "[1]"),
+                                      ArrayFromJSON(int16(), "[1]"), options, &actual));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ADD, ArrayFromJSON(int8(), "[1]"),
+                                    ArrayFromJSON(int8(), "[1, 2]"), options, &actual));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ADD, *MakeScalar(int8(), 1),
+                                    *MakeScalar(int8(), 1), options, &actual));
+  ASSERT_RAISES(NotImplemented,
+                Arithmetic(&ctx_, ADD, ArrayFromJSON(utf8(), "[\"a\"]"),
+                           ArrayFromJSON(utf8(), "[\"b\"]"), options, &actual));
+  ASSERT_RAISES(NotImplemented,
+                Negate(&ctx_, ArrayFromJSON(boolean(), "[true]"), options, &actual));
+}
+
+class TestArithmeticDecimal : public ComputeFixture, public TestBase {
+ protected:
+  // Decimals from strings, "null" being a null slot
+  std::shared_ptr<Array> MakeArray(const std::shared_ptr<DataType>& type,
+                                   const std::vector<std::string>& values) {
+    std::vector<Decimal128> decimals;
+    std::vector<bool> is_valid;
+    for (const auto& value : values) {
+      is_valid.push_back(value != "null");
+      decimals.push_back(value == "null" ? Decimal128(0) : Decimal128(value));
+    }
+    std::shared_ptr<Array> out;
+    ArrayFromVector<Decimal128Type, Decimal128>(type, is_valid, decimals, &out);
+    return out;
+  }
+
+  Datum MakeScalar(const std::shared_ptr<DataType>& type, const std::string& value) {
+    return Datum(std::make_shared<Decimal128Scalar>(Decimal128(value), type));
+  }
+
+  void AssertBinary(ArithmeticOperator op, const Datum& left, const Datum& right,
+                    const std::shared_ptr<Array>& expected, bool check_overflow = false) {
+    ArithmeticOptions options;
+    options.check_overflow = check_overflow;
+    Datum actual;
+    ASSERT_OK(Arithmetic(&ctx_, op, left, right, options, &actual));
+    ASSERT_TRUE(actual.is_array());
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysEqual(*expected, *actual.make_array());
+  }
+};
+
+TEST_F(TestArithmeticDecimal, AddSubtract) {
+  auto left = MakeArray(decimal(5, 2), {"1.25", "null", "-3.10", "999.99"});
+  auto right = MakeArray(decimal(4, 1), {"2.5", "1.0", "0.1", "999.9"});
+
+  AssertBinary(ADD, left, right,
+               MakeArray(decimal(6, 2), {"3.75", "null", "-3.00", "1999.89"}));
+  AssertBinary(SUBTRACT, left, right,
+               MakeArray(decimal(6, 2), {"-1.25", "null", "-3.20", "0.09"}));
+  AssertBinary(SUBTRACT, right, left,
+               MakeArray(decimal(6, 2), {"1.25", "null", "3.20", "-0.09"}));
+  AssertBinary(ADD, left, MakeScalar(decimal(3, 0), "100"),
+               MakeArray(decimal(6, 2), {"101.25", "null", "96.90", "1099.99"}));
+  AssertBinary(SUBTRACT, MakeScalar(decimal(3, 3), "0.001"), right,
+               MakeArray(decimal(7, 3), {"-2.499", "-0.999", "-0.099", "-999.899"}));
+  AssertBinary(ADD, left, Datum(std::make_shared<Decimal128Scalar>(decimal(3, 0))),
+               MakeArray(decimal(6, 2), {"null", "null", "null", "null"}));
+
+  // Beyond 64 bits
+  auto big = MakeArray(decimal(30, 0), {"123456789012345678901234567890", "-1", "null"});
+  AssertBinary(ADD, big->Slice(0, 1), MakeArray(decimal(2, 1), {"0.1"}),
+               MakeArray(decimal(32, 1), {"123456789012345678901234567890.1"}));
+  AssertBinary(SUBTRACT, big->Slice(1),
+               MakeArray(decimal(20, 0), {"9999999999999999999", "1"}),
+               MakeArray(decimal(31, 0), {"-10000000000000000000", "null"}));
+}
+
+TEST_F(TestArithmeticDecimal, Multiply) {
+  auto left = MakeArray(decimal(5, 2), {"1.25", "null", "-3.10", "999.99"});
+  auto right = MakeArray(decimal(3, 1), {"2.5", "1.0", "-0.1", "99.9"});
+  AssertBinary(MULTIPLY, left, right,
+               MakeArray(decimal(9, 3), {"3.125", "null", "0.310", "99899.001"}));
+  AssertBinary(MULTIPLY, MakeScalar(decimal(1, 0), "-2"), right,
+               MakeArray(decimal(5, 1), {"-5.0", "-2.0", "0.2", "-199.8"}));
+
+  auto big = MakeArray(decimal(20, 0), {"1234567890123456789", "-9999999999999999999"});
+  AssertBinary(MULTIPLY, big, big,
+               MakeArray(decimal(38, 0), {"1524157875323883675019051998750190521",
+                                          "99999999999999999980000000000000000001"}));
+}
+
+TEST_F(TestArithmeticDecimal, Blocks) {
+  // Enough values for several blocks, with precisions within 18 digits and beyond
+  for (int32_t precision : {8, 18}) {
+    std::vector<std::string> left, right, sums, products;
+    for (int i = 0; i < 1000; ++i) {
+      const Decimal128 l = Decimal128(i - 500) * Decimal128("1e4");
+      const Decimal128 r = Decimal128(i % 37 - 18);
+      const Decimal128 sum = l + r * Decimal128(100);
+      const Decimal128 product = l * r;
+      left.push_back(i % 13 == 0 ? "null" : l.ToString(2));
+      right.push_back(r.ToString(0));
+      sums.push_back(i % 13 == 0 ? "null" : sum.ToString(2));
+      products.push_back(i % 13 == 0 ? "null" : product.ToString(2));
+    }
+    auto left_array = MakeArray(decimal(precision, 2), left);
+    auto right_array = MakeArray(decimal(precision, 0), right);
+    AssertBinary(ADD, left_array, right_array,
+                 MakeArray(decimal(precision + 3, 2), sums));
+    AssertBinary(MULTIPLY, left_array, right_array,
+                 MakeArray(decimal(2 * precision + 1, 2), products));
+  }
+}
+
+TEST_F(TestArithmeticDecimal, Overflow) {
+  const std::string max_value(38, '9');
+  auto left = MakeArray(decimal(38, 0), {"1", max_value, "null"});
+  auto right = MakeArray(decimal(38, 0), {"1", "1", "1"});
+  ArithmeticOptions options;
+  options.check_overflow = true;
+  Datum actual;
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ADD, left, right, options, &actual));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, MULTIPLY, left, left, options, &actual));
+  AssertBinary(ADD, left->Slice(2), right->Slice(2),
+               MakeArray(decimal(38, 0), {"null"}), /*check_overflow=*/true);
+  AssertBinary(SUBTRACT, left, right,
+               MakeArray(decimal(38, 0), {"0", std::string(37, '9') + "8", "null"}),
+               /*check_overflow=*/true);
+
+  // Rescaling an operand beyond 38 digits
+  auto scaled = MakeArray(decimal(38, 10), {"1.5"});
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ADD, scaled, left->Slice(1, 1), options,
+                                    &actual));
+}
+
+TEST_F(TestArithmeticDecimal, Errors) {
+  Datum actual;
+  const auto options = ArithmeticOptions::Defaults();
+  auto values = MakeArray(decimal(5, 2), {"1.25"});
+  ASSERT_RAISES(TypeError, Arithmetic(&ctx_, ADD, values, ArrayFromJSON(int64(), "[1]"),
+                                      options, &actual));
+  ASSERT_RAISES(NotImplemented, Arithmetic(&ctx_, DIVIDE, values, values, options,
+                                           &actual));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, MULTIPLY, MakeArray(decimal(38, 20), {"1"}),
+                                    MakeArray(decimal(38, 20), {"1"}), options,
+                                    &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
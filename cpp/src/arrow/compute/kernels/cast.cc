@@ -17,6 +17,7 @@
 
 #include "arrow/compute/kernels/cast.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -39,11 +40,13 @@
 #include "arrow/util/macros.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
 #include "arrow/util/time.h"
+#include "arrow/util/tracing.h"
 #include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/decimal_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 
 #ifdef ARROW_EXTRA_ERROR_CONTEXT
@@ -415,73 +418,43 @@ struct CastFunctor<O, Decimal128Type, enable_if_t<is_integer_type<O>::value>> {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
     using out_type = typename O::c_type;
+    using detail::DecimalWords;
     const auto& in_type_inst = checked_cast<const Decimal128Type&>(*input.type);
-    auto in_scale = in_type_inst.scale();
 
-    auto out_data = output->GetMutableValues<out_type>(1);
+    // The values are first rescaled to integers, as a whole
+    std::shared_ptr<Buffer> scratch;
+    Status status = ctx->Allocate(input.length * sizeof(DecimalWords), &scratch);
+    if (status.ok()) {
+      status = detail::RescaleDecimals(
+          input, -in_type_inst.scale(), !options.allow_decimal_truncate,
+          reinterpret_cast<DecimalWords*>(scratch->mutable_data()));
+    }
+    if (ARROW_PREDICT_FALSE(!status.ok())) {
+      ctx->SetStatus(status);
+      return;
+    }
+    const auto values = reinterpret_cast<const DecimalWords*>(scratch->data());
 
+    auto out_data = output->GetMutableValues<out_type>(1);
+    bool out_of_bounds = false;
     constexpr auto min_value = std::numeric_limits<out_type>::min();
     constexpr auto max_value = std::numeric_limits<out_type>::max();
-    constexpr auto zero = out_type{};
-
-    if (options.allow_decimal_truncate) {
-      if (in_scale < 0) {
-        // Unsafe upscale
-        auto convert_value = [&](util::optional<util::string_view> v) {
-          *out_data = zero;
-          if (v.has_value()) {
-            auto dec_value = Decimal128(reinterpret_cast<const uint8_t*>(v->data()));
-            auto converted = dec_value.IncreaseScaleBy(-in_scale);
-            if (!options.allow_int_overflow &&
-                ARROW_PREDICT_FALSE(converted < min_value || converted > max_value)) {
-              ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
-            } else {
-              *out_data = static_cast<out_type>(converted.low_bits());
-            }
-          }
-          ++out_data;
-        };
-        VisitArrayDataInline<Decimal128Type>(input, std::move(convert_value));
-      } else {
-        // Unsafe downscale
-        auto convert_value = [&](util::optional<util::string_view> v) {
-          *out_data = zero;
-          if (v.has_value()) {
-            auto dec_value = Decimal128(reinterpret_cast<const uint8_t*>(v->data()));
-            auto converted = dec_value.ReduceScaleBy(in_scale, false);
-            if (!options.allow_int_overflow &&
-                ARROW_PREDICT_FALSE(converted < min_value || converted > max_value)) {
-              ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
-            } else {
-              *out_data = static_cast<out_type>(converted.low_bits());
-            }
-          }
-          ++out_data;
-        };
-        VisitArrayDataInline<Decimal128Type>(input, std::move(convert_value));
-      }
-    } else {
-      // Safe rescale
-      auto convert_value = [&](util::optional<util::string_view> v) {
-        *out_data = zero;
-        if (v.has_value()) {
-          auto dec_value = Decimal128(reinterpret_cast<const uint8_t*>(v->data()));
-          auto result = dec_value.Rescale(in_scale, 0);
-          if (ARROW_PREDICT_FALSE(!result.ok())) {
-            ctx->SetStatus(result.status());
-          } else {
-            auto converted = *std::move(result);
-            if (!options.allow_int_overflow &&
-                ARROW_PREDICT_FALSE(converted < min_value || converted > max_value)) {
-              ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
-            } else {
-              *out_data = static_cast<out_type>(converted.low_bits());
-            }
-          }
+    const DecimalWords min_words = detail::DecimalWordsFromInt64(min_value);
+    const DecimalWords max_words = {static_cast<uint64_t>(max_value), 0};
+    for (int64_t i = 0; i < input.length; ++i) {
+      out_data[i] = static_cast<out_type>(values[i].low);
+      out_of_bounds |= (values[i] < min_words) | (values[i] > max_words);
+    }
+    if (!options.allow_int_overflow && ARROW_PREDICT_FALSE(out_of_bounds)) {
+      const uint8_t* valid_bits =
+          input.GetNullCount() == 0 ? NULLPTR : input.buffers[0]->data();
+      for (int64_t i = 0; i < input.length; ++i) {
+        if ((valid_bits == NULLPTR || BitUtil::GetBit(valid_bits, input.offset + i)) &&
+            (values[i] < min_words || values[i] > max_words)) {
+          ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
+          return;
         }
-        ++out_data;
-      };
-      VisitArrayDataInline<Decimal128Type>(input, std::move(convert_value));
+      }
     }
   }
 };
@@ -494,57 +467,13 @@ struct CastFunctor<Decimal128Type, Decimal128Type> {
                   const ArrayData& input, ArrayData* output) {
     const auto& in_type_inst = checked_cast<const Decimal128Type&>(*input.type);
     const auto& out_type_inst = checked_cast<const Decimal128Type&>(*output->type);
-    auto in_scale = in_type_inst.scale();
-    auto out_scale = out_type_inst.scale();
-
-    auto out_data = output->GetMutableValues<uint8_t>(1);
-
-    const auto write_zero = [](uint8_t* out_data) { memset(out_data, 0, 16); };
-
-    if (options.allow_decimal_truncate) {
-      if (in_scale < out_scale) {
-        // Unsafe upscale
-        auto convert_value = [&](util::optional<util::string_view> v) {
-          if (v.has_value()) {
-            auto dec_value = Decimal128(reinterpret_cast<const uint8_t*>(v->data()));
-            dec_value.IncreaseScaleBy(out_scale - in_scale).ToBytes(out_data);
-          } else {
-            write_zero(out_data);
-          }
-          out_data += 16;
-        };
-        VisitArrayDataInline<Decimal128Type>(input, std::move(convert_value));
-      } else {
-        // Unsafe downscale
-        auto convert_value = [&](util::optional<util::string_view> v) {
-          if (v.has_value()) {
-            auto dec_value = Decimal128(reinterpret_cast<const uint8_t*>(v->data()));
-            dec_value.ReduceScaleBy(in_scale - out_scale, false).ToBytes(out_data);
-          } else {
-            write_zero(out_data);
-          }
-          out_data += 16;
-        };
-        VisitArrayDataInline<Decimal128Type>(input, std::move(convert_value));
-      }
-    } else {
-      // Safe rescale
-      auto convert_value = [&](util::optional<util::string_view> v) {
-        if (v.has_value()) {
-          auto dec_value = Decimal128(reinterpret_cast<const uint8_t*>(v->data()));
-          auto result = dec_value.Rescale(in_scale, out_scale);
-          if (ARROW_PREDICT_FALSE(!result.ok())) {
-            ctx->SetStatus(result.status());
-            write_zero(out_data);
-          } else {
-            (*std::move(result)).ToBytes(out_data);
-          }
-        } else {
-          write_zero(out_data);
-        }
-        out_data += 16;
-      };
-      VisitArrayDataInline<Decimal128Type>(input, std::move(convert_value));
+
+    Status status = detail::RescaleDecimals(
+        input, out_type_inst.scale() - in_type_inst.scale(),
+        !options.allow_decimal_truncate,
+        output->GetMutableValues<detail::DecimalWords>(1));
+    if (ARROW_PREDICT_FALSE(!status.ok())) {
+      ctx->SetStatus(status);
     }
   }
 };
@@ -552,6 +481,36 @@ struct CastFunctor<Decimal128Type, Decimal128Type> {
 // ----------------------------------------------------------------------
 // From one timestamp to another
 
+// Values are converted in blocks, and the checks of a block are combined into
+// a single flag so that the conversion loops have no early exit and can be
+// vectorized.  The offending value is only looked for when a block fails.
+constexpr int64_t kShiftTimeBlockSize = 1024;
+
+// Return the index of the first non-null value in [start, end) for which
+// `is_invalid` returns true, or -1 if there is none
+template <typename in_type, typename Predicate>
+int64_t FindInvalidTime(const ArrayData& input, int64_t start, int64_t end,
+                        Predicate&& is_invalid) {
+  const in_type* in_data = input.GetValues<in_type>(1);
+  if (input.null_count == 0) {
+    for (int64_t i = start; i < end; i++) {
+      if (is_invalid(in_data[i])) {
+        return i;
+      }
+    }
+    return -1;
+  }
+  internal::BitmapReader bit_reader(input.buffers[0]->data(), input.offset + start,
+                                    end - start);
+  for (int64_t i = start; i < end; i++) {
+    if (bit_reader.IsSet() && is_invalid(in_data[i])) {
+      return i;
+    }
+    bit_reader.Next();
+  }
+  return -1;
+}
+
 template <typename in_type, typename out_type>
 void ShiftTime(FunctionContext* ctx, const CastOptions& options,
                const util::DivideOrMultiply factor_op, const int64_t factor,
@@ -569,35 +528,32 @@ void ShiftTime(FunctionContext* ctx, const CastOptions& options,
         out_data[i] = static_cast<out_type>(in_data[i] * factor);
       }
     } else {
-#define RAISE_OVERFLOW_CAST(VAL)                                                  \
-  ctx->SetStatus(Status::Invalid("Casting from ", input.type->ToString(), " to ", \
-                                 output->type->ToString(), " would result in ",   \
-                                 "out of bounds timestamp: ", VAL));
+      const int64_t max_val = std::numeric_limits<int64_t>::max() / factor;
+      const int64_t min_val = std::numeric_limits<int64_t>::min() / factor;
+      auto out_of_bounds = [min_val, max_val](in_type value) {
+        return value < min_val || value > max_val;
+      };
 
-      int64_t max_val = std::numeric_limits<int64_t>::max() / factor;
-      int64_t min_val = std::numeric_limits<int64_t>::min() / factor;
-      if (input.null_count != 0) {
-        internal::BitmapReader bit_reader(input.buffers[0]->data(), input.offset,
-                                          input.length);
-        for (int64_t i = 0; i < input.length; i++) {
-          if (bit_reader.IsSet() && (in_data[i] < min_val || in_data[i] > max_val)) {
-            RAISE_OVERFLOW_CAST(in_data[i]);
-            break;
-          }
+      for (int64_t start = 0; start < input.length; start += kShiftTimeBlockSize) {
+        const int64_t end = std::min(start + kShiftTimeBlockSize, input.length);
+        bool block_out_of_bounds = false;
+        for (int64_t i = start; i < end; i++) {
+          block_out_of_bounds |= (in_data[i] < min_val) | (in_data[i] > max_val);
           out_data[i] = static_cast<out_type>(in_data[i] * factor);
-          bit_reader.Next();
         }
-      } else {
-        for (int64_t i = 0; i < input.length; i++) {
-          if (in_data[i] < min_val || in_data[i] > max_val) {
-            RAISE_OVERFLOW_CAST(in_data[i]);
-            break;
+        if (ARROW_PREDICT_FALSE(block_out_of_bounds)) {
+          // Null slots may hold any value, only fail on a non-null one
+          const int64_t invalid =
+              FindInvalidTime<in_type>(input, start, end, out_of_bounds);
+          if (invalid >= 0) {
+            ctx->SetStatus(Status::Invalid(
+                "Casting from ", input.type->ToString(), " to ",
+                output->type->ToString(),
+                " would result in out of bounds timestamp: ", in_data[invalid]));
+            return;
           }
-          out_data[i] = static_cast<out_type>(in_data[i] * factor);
         }
       }
-
-#undef RAISE_OVERFLOW_CAST
     }
   } else {
     if (options.allow_time_truncate) {
@@ -605,32 +561,27 @@ void ShiftTime(FunctionContext* ctx, const CastOptions& options,
         out_data[i] = static_cast<out_type>(in_data[i] / factor);
       }
     } else {
-#define RAISE_INVALID_CAST(VAL)                                                   \
-  ctx->SetStatus(Status::Invalid("Casting from ", input.type->ToString(), " to ", \
-                                 output->type->ToString(), " would lose data: ", VAL));
+      auto loses_data = [factor](in_type value) {
+        return static_cast<out_type>(value / factor) * factor != value;
+      };
 
-      if (input.null_count != 0) {
-        internal::BitmapReader bit_reader(input.buffers[0]->data(), input.offset,
-                                          input.length);
-        for (int64_t i = 0; i < input.length; i++) {
+      for (int64_t start = 0; start < input.length; start += kShiftTimeBlockSize) {
+        const int64_t end = std::min(start + kShiftTimeBlockSize, input.length);
+        bool block_loses_data = false;
+        for (int64_t i = start; i < end; i++) {
           out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (bit_reader.IsSet() && (out_data[i] * factor != in_data[i])) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
-          }
-          bit_reader.Next();
+          block_loses_data |= (out_data[i] * factor) != in_data[i];
         }
-      } else {
-        for (int64_t i = 0; i < input.length; i++) {
-          out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (out_data[i] * factor != in_data[i]) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
+        if (ARROW_PREDICT_FALSE(block_loses_data)) {
+          const int64_t invalid = FindInvalidTime<in_type>(input, start, end, loses_data);
+          if (invalid >= 0) {
+            ctx->SetStatus(Status::Invalid("Casting from ", input.type->ToString(),
+                                           " to ", output->type->ToString(),
+                                           " would lose data: ", in_data[invalid]));
+            return;
           }
         }
       }
-
-#undef RAISE_INVALID_CAST
     }
   }
 }
@@ -787,7 +738,10 @@ class CastKernelBase : public UnaryKernel {
   std::shared_ptr<DataType> out_type_;
 };
 
-bool NeedToPreallocate(const DataType& type) { return is_fixed_width(type.id()); }
+// Dictionary casts produce their output from buffers of the input
+bool NeedToPreallocate(const DataType& type) {
+  return is_fixed_width(type.id()) && type.id() != Type::DICTIONARY;
+}
 
 Status InvokeWithAllocation(FunctionContext* ctx, UnaryKernel* func, const Datum& input,
                             Datum* out) {
@@ -1062,7 +1016,76 @@ struct CastFunctor<T, DictionaryType> {
 };
 
 // ----------------------------------------------------------------------
-// String to Number
+// String to Number / Boolean / Timestamp
+
+// Make the i-th output value null, giving the output a validity bitmap of its
+// own first if it shares the input's or has none
+Status SetOutputNull(FunctionContext* ctx, const ArrayData& input, ArrayData* output,
+                     int64_t i) {
+  auto& validity = output->buffers[0];
+  if (validity == nullptr || validity == input.buffers[0]) {
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(
+        ctx->Allocate(BitUtil::BytesForBits(output->offset + input.length), &buffer));
+    if (validity != nullptr) {
+      internal::CopyBitmap(validity->data(), output->offset, input.length,
+                           buffer->mutable_data(), output->offset);
+    } else {
+      BitUtil::SetBitsTo(buffer->mutable_data(), output->offset, input.length, true);
+    }
+    validity = std::move(buffer);
+  }
+  BitUtil::ClearBit(validity->mutable_data(), output->offset + i);
+  ++output->null_count;
+  return Status::OK();
+}
+
+// Call `parse(i, data, length)` on the non-null values of a string-like array,
+// in a single pass over the offsets.  A value that can't be parsed fails the
+// cast, or is made null if CastOptions::null_on_parse_error is set.
+template <typename I, typename ParseFunc>
+Status ParseStringValues(FunctionContext* ctx, const CastOptions& options,
+                         const ArrayData& input, ArrayData* output, ParseFunc&& parse) {
+  using offset_type = typename I::offset_type;
+
+  const offset_type* offsets = input.GetValues<offset_type>(1);
+  const char* data = input.buffers[2] == nullptr
+                         ? ""
+                         : reinterpret_cast<const char*>(input.buffers[2]->data());
+
+  // Out of line, so that the parsing loops stay tight
+  auto on_error = [&](int64_t i) -> Status {
+    if (!options.null_on_parse_error) {
+      const auto length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+      return Status::Invalid("Failed to cast String '",
+                             util::string_view(data + offsets[i], length), "' into ",
+                             output->type->ToString());
+    }
+    return SetOutputNull(ctx, input, output, i);
+  };
+
+  if (input.GetNullCount() == 0) {
+    for (int64_t i = 0; i < input.length; ++i) {
+      const auto length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+      if (ARROW_PREDICT_FALSE(!parse(i, data + offsets[i], length))) {
+        RETURN_NOT_OK(on_error(i));
+      }
+    }
+  } else {
+    internal::BitmapReader valid_reader(input.buffers[0]->data(), input.offset,
+                                        input.length);
+    for (int64_t i = 0; i < input.length; ++i) {
+      if (valid_reader.IsSet()) {
+        const auto length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+        if (ARROW_PREDICT_FALSE(!parse(i, data + offsets[i], length))) {
+          RETURN_NOT_OK(on_error(i));
+        }
+      }
+      valid_reader.Next();
+    }
+  }
+  return Status::OK();
+}
 
 template <typename I, typename O>
 struct CastFunctor<
@@ -1071,98 +1094,75 @@ struct CastFunctor<
                   const ArrayData& input, ArrayData* output) {
     using out_type = typename O::c_type;
 
-    typename TypeTraits<I>::ArrayType input_array(input.Copy());
     auto out_data = output->GetMutableValues<out_type>(1);
     internal::StringConverter<O> converter;
 
-    for (int64_t i = 0; i < input.length; ++i, ++out_data) {
-      if (input_array.IsNull(i)) {
-        continue;
-      }
-
-      auto str = input_array.GetView(i);
-      if (!converter(str.data(), str.length(), out_data)) {
-        ctx->SetStatus(Status::Invalid("Failed to cast String '", str, "' into ",
-                                       output->type->ToString()));
-        return;
-      }
-    }
+    FUNC_RETURN_NOT_OK(ParseStringValues<I>(
+        ctx, options, input, output, [&](int64_t i, const char* s, size_t length) {
+          if (ARROW_PREDICT_TRUE(converter(s, length, out_data + i))) {
+            return true;
+          }
+          out_data[i] = out_type{};
+          return false;
+        }));
   }
 };
 
-// ----------------------------------------------------------------------
-// String to Boolean
-
 template <typename I>
 struct CastFunctor<BooleanType, I, enable_if_t<is_string_like_type<I>::value>> {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
-    typename TypeTraits<I>::ArrayType input_array(input.Copy());
-    internal::FirstTimeBitmapWriter writer(output->buffers[1]->mutable_data(),
-                                           output->offset, input.length);
+    uint8_t* out_bitmap = output->buffers[1]->mutable_data();
+    BitUtil::SetBitsTo(out_bitmap, output->offset, input.length, false);
     internal::StringConverter<BooleanType> converter;
 
-    for (int64_t i = 0; i < input.length; ++i) {
-      if (input_array.IsNull(i)) {
-        writer.Next();
-        continue;
-      }
-
-      bool value;
-      auto str = input_array.GetView(i);
-      if (!converter(str.data(), str.length(), &value)) {
-        ctx->SetStatus(Status::Invalid("Failed to cast String '",
-                                       input_array.GetString(i), "' into ",
-                                       output->type->ToString()));
-        return;
-      }
-
-      if (value) {
-        writer.Set();
-      } else {
-        writer.Clear();
-      }
-      writer.Next();
-    }
-    writer.Finish();
+    FUNC_RETURN_NOT_OK(ParseStringValues<I>(
+        ctx, options, input, output, [&](int64_t i, const char* s, size_t length) {
+          bool value;
+          if (ARROW_PREDICT_FALSE(!converter(s, length, &value))) {
+            return false;
+          }
+          if (value) {
+            BitUtil::SetBit(out_bitmap, output->offset + i);
+          }
+          return true;
+        }));
   }
 };
 
-// ----------------------------------------------------------------------
-// String to Timestamp
-
 template <typename I>
 struct CastFunctor<TimestampType, I, enable_if_t<is_string_like_type<I>::value>> {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
     using out_type = TimestampType::c_type;
 
-    typename TypeTraits<I>::ArrayType input_array(input.Copy());
     auto out_data = output->GetMutableValues<out_type>(1);
     internal::StringConverter<TimestampType> converter(output->type);
 
-    for (int64_t i = 0; i < input.length; ++i, ++out_data) {
-      if (input_array.IsNull(i)) {
-        continue;
-      }
-
-      const auto str = input_array.GetView(i);
-      if (!converter(str.data(), str.length(), out_data)) {
-        ctx->SetStatus(Status::Invalid("Failed to cast String '", str, "' into ",
-                                       output->type->ToString()));
-        return;
-      }
-    }
+    FUNC_RETURN_NOT_OK(ParseStringValues<I>(
+        ctx, options, input, output, [&](int64_t i, const char* s, size_t length) {
+          if (ARROW_PREDICT_TRUE(converter(s, length, out_data + i))) {
+            return true;
+          }
+          out_data[i] = 0;
+          return false;
+        }));
   }
 };
 
 // ----------------------------------------------------------------------
 // Number / Boolean to String
 
+template <typename I>
+using is_formatted_in_bulk =
+    std::integral_constant<bool, std::is_same<I, FloatType>::value ||
+                                     std::is_same<I, DoubleType>::value>;
+
 template <typename I, typename O>
 struct CastFunctor<O, I,
                    enable_if_t<is_string_like_type<O>::value &&
-                               (is_number_type<I>::value || is_boolean_type<I>::value)>> {
+                               (is_number_type<I>::value || is_boolean_type<I>::value) &&
+                               !is_formatted_in_bulk<I>::value>> {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
     ctx->SetStatus(Convert(ctx, options, input, output));
@@ -1193,6 +1193,30 @@ struct CastFunctor<O, I,
   }
 };
 
+template <typename I, typename O>
+struct CastFunctor<O, I,
+                   enable_if_t<is_string_like_type<O>::value &&
+                               is_formatted_in_bulk<I>::value>> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    ctx->SetStatus(Convert(ctx, input, output));
+  }
+
+  Status Convert(FunctionContext* ctx, const ArrayData& input, ArrayData* output) {
+    using ArrayType = typename TypeTraits<I>::ArrayType;
+    using BuilderType = typename TypeTraits<O>::BuilderType;
+
+    BuilderType builder(ctx->memory_pool());
+    RETURN_NOT_OK(internal::FormatFloats(
+        ArrayType(std::make_shared<ArrayData>(input)), &builder));
+
+    std::shared_ptr<Array> output_array;
+    RETURN_NOT_OK(builder.Finish(&output_array));
+    *output = std::move(*output_array->data());
+    return Status::OK();
+  }
+};
+
 // ----------------------------------------------------------------------
 // Binary to String
 //
@@ -1328,6 +1352,72 @@ class ExtensionCastKernel : public CastKernelBase {
   std::unique_ptr<UnaryKernel> storage_caster_;
 };
 
+// ----------------------------------------------------------------------
+// Dictionary to dictionary
+
+// Only the dictionary values are cast, and the indices are shared with the
+// input unless the index type changes.
+class DictionaryToDictionaryCastKernel : public CastKernelBase {
+ public:
+  static Status Make(const DataType& in_type, std::shared_ptr<DataType> out_type,
+                     const CastOptions& options,
+                     std::unique_ptr<CastKernelBase>* kernel) {
+    const auto& in_dict_type = checked_cast<const DictionaryType&>(in_type);
+    const auto& out_dict_type = checked_cast<const DictionaryType&>(*out_type);
+
+    std::unique_ptr<UnaryKernel> values_caster;
+    RETURN_NOT_OK(GetCastFunction(*in_dict_type.value_type(),
+                                  out_dict_type.value_type(), options, &values_caster));
+    std::unique_ptr<UnaryKernel> indices_caster;
+    if (!in_dict_type.index_type()->Equals(out_dict_type.index_type())) {
+      RETURN_NOT_OK(GetCastFunction(*in_dict_type.index_type(),
+                                    out_dict_type.index_type(), options,
+                                    &indices_caster));
+    }
+    kernel->reset(new DictionaryToDictionaryCastKernel(
+        std::move(values_caster), std::move(indices_caster), std::move(out_type)));
+    return Status::OK();
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    const ArrayData& in_data = *input.array();
+    DCHECK_EQ(Type::DICTIONARY, in_data.type->id());
+
+    std::shared_ptr<ArrayData> result;
+    if (indices_caster_ != nullptr) {
+      auto indices = in_data.Copy();
+      indices->type = checked_cast<const DictionaryType&>(*in_data.type).index_type();
+      indices->dictionary = nullptr;
+      Datum casted_indices;
+      RETURN_NOT_OK(
+          InvokeWithAllocation(ctx, indices_caster_.get(), indices, &casted_indices));
+      result = casted_indices.array()->Copy();
+    } else {
+      result = in_data.Copy();
+    }
+    result->type = out_type_;
+
+    Datum casted_dictionary;
+    RETURN_NOT_OK(InvokeWithAllocation(ctx, values_caster_.get(),
+                                       in_data.dictionary->data(), &casted_dictionary));
+    result->dictionary = MakeArray(casted_dictionary.array());
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+ protected:
+  DictionaryToDictionaryCastKernel(std::unique_ptr<UnaryKernel> values_caster,
+                                   std::unique_ptr<UnaryKernel> indices_caster,
+                                   std::shared_ptr<DataType> out_type)
+      : CastKernelBase(std::move(out_type)),
+        values_caster_(std::move(values_caster)),
+        indices_caster_(std::move(indices_caster)) {}
+
+  std::unique_ptr<UnaryKernel> values_caster_;
+  std::unique_ptr<UnaryKernel> indices_caster_;
+};
+
 class CastKernel : public CastKernelBase {
  public:
   CastKernel(const CastOptions& options, const CastFunction& func,
@@ -1501,7 +1591,14 @@ Status GetCastFunction(const DataType& in_type, std::shared_ptr<DataType> out_ty
     CAST_FUNCTION_CASE(StringType);
     CAST_FUNCTION_CASE(LargeBinaryType);
     CAST_FUNCTION_CASE(LargeStringType);
-    CAST_FUNCTION_CASE(DictionaryType);
+    case Type::DICTIONARY:
+      if (out_type->id() == Type::DICTIONARY) {
+        RETURN_NOT_OK(DictionaryToDictionaryCastKernel::Make(in_type, out_type, options,
+                                                             &cast_kernel));
+      } else {
+        cast_kernel = GetDictionaryTypeCastFunc(out_type, options);
+      }
+      break;
     case Type::NA:
       cast_kernel.reset(new FromNullCastKernel(out_type));
       break;
@@ -1531,6 +1628,7 @@ Status GetCastFunction(const DataType& in_type, std::shared_ptr<DataType> out_ty
 
 Status Cast(FunctionContext* ctx, const Datum& value, std::shared_ptr<DataType> out_type,
             const CastOptions& options, Datum* out) {
+  ARROW_TRACE_SPAN("compute::Cast");
   const DataType& in_type = *value.type();
 
   // Dynamic dispatch to obtain right cast function
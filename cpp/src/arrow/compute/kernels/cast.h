@@ -40,7 +40,8 @@ struct ARROW_EXPORT CastOptions {
         allow_time_overflow(false),
         allow_decimal_truncate(false),
         allow_float_truncate(false),
-        allow_invalid_utf8(false) {}
+        allow_invalid_utf8(false),
+        null_on_parse_error(false) {}
 
   explicit CastOptions(bool safe)
       : allow_int_overflow(!safe),
@@ -48,7 +49,8 @@ struct ARROW_EXPORT CastOptions {
         allow_time_overflow(!safe),
         allow_decimal_truncate(!safe),
         allow_float_truncate(!safe),
-        allow_invalid_utf8(!safe) {}
+        allow_invalid_utf8(!safe),
+        null_on_parse_error(false) {}
 
   static CastOptions Safe() { return CastOptions(true); }
 
@@ -62,6 +64,9 @@ struct ARROW_EXPORT CastOptions {
   // Indicate if conversions from Binary/FixedSizeBinary to string must
   // validate the utf8 payload.
   bool allow_invalid_utf8;
+  // Indicate if conversions from String to Number/Boolean/Timestamp emit
+  // a null for a value that can't be parsed, rather than failing.
+  bool null_on_parse_error;
 };
 
 /// \since 0.7.0
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -780,6 +781,54 @@ TEST_F(TestCast, DecimalToDecimal) {
       decimal(28, 0), e23, is_valid3, decimal(38, 10), f23, options);
 }
 
+TEST_F(TestCast, DecimalRescaleBlocks) {
+  // Enough values for several blocks, with precisions within 18 digits and beyond
+  CastOptions options;
+  const int64_t length = 1000;
+  for (int32_t precision : {18, 38}) {
+    const Decimal128 base = precision == 18 ? Decimal128(7) : Decimal128("1e25");
+    std::vector<Decimal128> values, upscaled, truncated;
+    std::vector<bool> is_valid;
+    for (int64_t i = 0; i < length; ++i) {
+      const Decimal128 value = base * Decimal128(i - length / 2) + Decimal128(i % 100);
+      values.push_back(value);
+      upscaled.push_back(value * Decimal128(100));
+      truncated.push_back(value / Decimal128(100));
+      is_valid.push_back(i % 5 != 0);
+    }
+    SCOPED_TRACE(::testing::Message() << "precision " << precision);
+    CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+        decimal(precision - 2, 2), values, is_valid, decimal(precision, 4), upscaled,
+        options);
+    CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+        decimal(precision, 4), upscaled, is_valid, decimal(precision - 2, 2), values,
+        options);
+
+    // Truncation is only an error for valid values
+    std::shared_ptr<Array> input, expected, result;
+    ArrayFromVector<Decimal128Type, Decimal128>(decimal(precision, 2), values, &input);
+    ArrayFromVector<Decimal128Type, Decimal128>(decimal(precision, 0), truncated,
+                                                &expected);
+    options.allow_decimal_truncate = false;
+    ASSERT_RAISES(Invalid, Cast(&ctx_, *input, decimal(precision, 0), options, &result));
+    options.allow_decimal_truncate = true;
+    CheckPass(*input, *expected, decimal(precision, 0), options);
+
+    std::vector<bool> is_round;
+    for (int64_t i = 0; i < length; ++i) {
+      is_round.push_back(i % 100 == 0);
+    }
+    std::shared_ptr<Array> round_input, round_expected;
+    ArrayFromVector<Decimal128Type, Decimal128>(decimal(precision, 0), is_round,
+                                                truncated, &round_expected);
+    std::shared_ptr<Buffer> null_bitmap = round_expected->data()->buffers[0];
+    round_input = std::make_shared<Decimal128Array>(
+        decimal(precision, 2), length, input->data()->buffers[1], null_bitmap);
+    options.allow_decimal_truncate = false;
+    CheckPass(*round_input, *round_expected, decimal(precision, 0), options);
+  }
+}
+
 TEST_F(TestCast, TimestampToTimestamp) {
   CastOptions options;
 
@@ -873,6 +922,57 @@ TEST_F(TestCast, TimestampToTimestamp) {
                             timestamp(TimeUnit::NANO), options);
 }
 
+TEST_F(TestCast, TimestampToTimestampMultipleBlocks) {
+  // Checks are done per block of values, make sure they find the invalid values
+  // of any block and disregard null slots
+  const int64_t length = 3000;
+  std::vector<bool> is_valid(length, true);
+  std::vector<int64_t> v_seconds(length), e_millis(length);
+  for (int64_t i = 0; i < length; ++i) {
+    v_seconds[i] = i;
+    e_millis[i] = i * 1000;
+  }
+  is_valid[2500] = false;
+  v_seconds[2500] = std::numeric_limits<int64_t>::max();
+  e_millis[2500] = 0;
+
+  CastOptions options;
+  options.allow_time_overflow = false;
+  options.allow_time_truncate = false;
+
+  std::shared_ptr<Array> input, expected, result;
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::SECOND), is_valid,
+                                          v_seconds, &input);
+  ASSERT_OK(Cast(&ctx_, *input, timestamp(TimeUnit::MILLI), options, &result));
+  ASSERT_OK(result->ValidateFull());
+  ASSERT_EQ(result->null_count(), 1);
+  for (int64_t i = 0; i < length; ++i) {
+    if (i != 2500) {
+      ASSERT_EQ(checked_cast<const TimestampArray&>(*result).Value(i), e_millis[i]);
+    }
+  }
+  // Round trip, the invalid value of the null slot is now 0
+  ASSERT_OK(Cast(&ctx_, *result, timestamp(TimeUnit::SECOND), options, &result));
+  ASSERT_EQ(checked_cast<const TimestampArray&>(*result).Value(1234), 1234);
+
+  is_valid[2500] = true;
+  CheckFails<TimestampType>(timestamp(TimeUnit::SECOND), v_seconds, is_valid,
+                            timestamp(TimeUnit::MILLI), options);
+  std::vector<int64_t> v_lossy = e_millis;
+  v_lossy[2500] = 2500001;
+  CheckFails<TimestampType>(timestamp(TimeUnit::MILLI), v_lossy, is_valid,
+                            timestamp(TimeUnit::SECOND), options);
+
+  // A lossy value in a null slot is disregarded too
+  std::vector<int64_t> v_millis = e_millis;
+  v_millis[2500] = 1;
+  is_valid[2500] = false;
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), is_valid,
+                                          v_millis, &input);
+  ASSERT_OK(Cast(&ctx_, *input, timestamp(TimeUnit::SECOND), options, &result));
+  ASSERT_EQ(checked_cast<const TimestampArray&>(*result).Value(2999), 2999);
+}
+
 TEST_F(TestCast, TimestampToDate32_Date64) {
   CastOptions options;
 
@@ -1411,6 +1511,59 @@ TEST_F(TestCast, StringToTimestampErrors) {
   }
 }
 
+TEST_F(TestCast, StringToNumberNullOnParseError) {
+  CastOptions options;
+  options.null_on_parse_error = true;
+
+  std::vector<std::string> v = {"1", "z", "", "-4", "300", "7"};
+  std::shared_ptr<Array> input, input_no_nulls, expected;
+  ArrayFromVector<StringType, std::string>(utf8(), {true, true, false, true, true, true},
+                                           v, &input);
+  ArrayFromVector<StringType, std::string>(utf8(), v, &input_no_nulls);
+  ArrayFromVector<Int8Type, int8_t>(int8(), {true, false, false, true, false, true},
+                                    {1, 0, 0, -4, 0, 7}, &expected);
+  CheckPass(*input, *expected, int8(), options);
+  CheckPass(*input->Slice(1), *expected->Slice(1), int8(), options);
+  CheckPass(*input_no_nulls, *expected, int8(), options);
+
+  // The input is left untouched
+  ASSERT_EQ(1, input->null_count());
+  ASSERT_EQ(0, input_no_nulls->null_count());
+
+  ArrayFromVector<LargeStringType, std::string>(large_utf8(), {"1.5", "x", "-2"},
+                                                &input);
+  ArrayFromVector<DoubleType, double>(float64(), {true, false, true}, {1.5, 0, -2},
+                                      &expected);
+  CheckPass(*input, *expected, float64(), options);
+}
+
+TEST_F(TestCast, StringToBooleanNullOnParseError) {
+  CastOptions options;
+  options.null_on_parse_error = true;
+
+  std::vector<bool> is_valid = {true, false, true, true, true};
+  std::vector<std::string> v = {"true", "true", "T", "false", "1"};
+  std::shared_ptr<Array> input, expected;
+  ArrayFromVector<StringType, std::string>(utf8(), is_valid, v, &input);
+  ArrayFromVector<BooleanType, bool>(boolean(), {true, false, false, true, true},
+                                     {true, false, false, false, true}, &expected);
+  CheckPass(*input, *expected, boolean(), options);
+  CheckPass(*input->Slice(2), *expected->Slice(2), boolean(), options);
+}
+
+TEST_F(TestCast, StringToTimestampNullOnParseError) {
+  CastOptions options;
+  options.null_on_parse_error = true;
+
+  auto type = timestamp(TimeUnit::SECOND);
+  std::shared_ptr<Array> input, expected;
+  ArrayFromVector<StringType, std::string>(utf8(), {"1970-01-01", "xxx", "1970-01-02"},
+                                           &input);
+  ArrayFromVector<TimestampType, int64_t>(type, {true, false, true}, {0, 0, 86400},
+                                          &expected);
+  CheckPass(*input, *expected, type, options);
+}
+
 TEST_F(TestCast, BinaryToString) { TestCastBinaryToString<BinaryType, StringType>(); }
 
 TEST_F(TestCast, LargeBinaryToLargeString) {
@@ -1651,6 +1804,60 @@ TYPED_TEST(TestDictionaryCast, OutTypeError) {
                 GetCastFunction(*in_type, out_type, CastOptions(), &kernel));
 }
 
+TEST_F(TestCast, DictionaryToDictionary) {
+  std::shared_ptr<Array> values, indices, expected_values;
+  ArrayFromVector<Int32Type, int32_t>(int32(), {1, 2, 1000}, &values);
+  ArrayFromVector<Int8Type, int8_t>(int8(), {true, true, false, true, true},
+                                    {0, 1, 0, 2, 0}, &indices);
+  auto dict_array = std::make_shared<DictionaryArray>(dictionary(int8(), int32()),
+                                                      indices, values);
+
+  // Only the dictionary values are cast, the indices are reused
+  std::shared_ptr<Array> result;
+  auto out_type = dictionary(int8(), int64());
+  ASSERT_OK(Cast(&ctx_, *dict_array, out_type, {}, &result));
+  ASSERT_OK(result->ValidateFull());
+  ASSERT_TRUE(result->type()->Equals(*out_type));
+  ArrayFromVector<Int64Type, int64_t>(int64(), {1, 2, 1000}, &expected_values);
+  const auto& dict_result = checked_cast<const DictionaryArray&>(*result);
+  ASSERT_ARRAYS_EQUAL(*expected_values, *dict_result.dictionary());
+  AssertBufferSame(*dict_array, *result, 0);
+  AssertBufferSame(*dict_array, *result, 1);
+
+  // Sliced input
+  ASSERT_OK(Cast(&ctx_, *dict_array->Slice(1, 3), out_type, {}, &result));
+  ASSERT_OK(result->ValidateFull());
+  ASSERT_EQ(result->offset(), 1);
+  ASSERT_EQ(result->null_count(), 1);
+  AssertBufferSame(*dict_array, *result, 1);
+
+  // The indices are cast if the index type changes
+  out_type = dictionary(int32(), int32());
+  ASSERT_OK(Cast(&ctx_, *dict_array, out_type, {}, &result));
+  ASSERT_OK(result->ValidateFull());
+  std::shared_ptr<Array> expected_indices;
+  ArrayFromVector<Int32Type, int32_t>(int32(), {true, true, false, true, true},
+                                      {0, 1, 0, 2, 0}, &expected_indices);
+  ASSERT_ARRAYS_EQUAL(*expected_indices,
+                      *checked_cast<const DictionaryArray&>(*result).indices());
+  ASSERT_ARRAYS_EQUAL(*values,
+                      *checked_cast<const DictionaryArray&>(*result).dictionary());
+
+  // Errors casting the values are propagated
+  ASSERT_RAISES(Invalid,
+                Cast(&ctx_, *dict_array, dictionary(int8(), int8()), {}, &result));
+  CastOptions options;
+  options.allow_int_overflow = true;
+  ASSERT_OK(Cast(&ctx_, *dict_array, dictionary(int8(), int8()), options, &result));
+  ASSERT_OK(result->ValidateFull());
+
+  // Unsupported value casts are reported as such
+  std::unique_ptr<UnaryKernel> kernel;
+  ASSERT_RAISES(NotImplemented, GetCastFunction(*dict_array->type(),
+                                                dictionary(int8(), list(int32())),
+                                                CastOptions(), &kernel));
+}
+
 /*TYPED_TEST(TestDictionaryCast, Reverse) {
   CastOptions options;
   std::shared_ptr<Array> plain_array =
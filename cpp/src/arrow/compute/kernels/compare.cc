@@ -21,17 +21,22 @@
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/compare_internal.h"
+#include "arrow/compute/kernels/decimal_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
 
 using internal::checked_cast;
 using internal::checked_pointer_cast;
+using internal::CpuInfo;
 using util::string_view;
 
 namespace compute {
@@ -140,6 +145,10 @@ RangeType MakeRange(const internal::PrimitiveScalar<T>& scalar) {
   return RangeType{scalar.value};
 }
 
+RepeatedValue<detail::DecimalWords> MakeRange(const Decimal128Scalar& scalar) {
+  return {detail::FromBasicDecimal(scalar.value)};
+}
+
 RepeatedBufferAsStringView MakeRange(const BaseBinaryScalar& scalar) {
   return RepeatedBufferAsStringView{*scalar.value};
 }
@@ -155,6 +164,11 @@ RangeType MakeRange(const NumericArray<T>& array) {
   return RangeType{array.raw_values()};
 }
 
+DereferenceIncrementPointer<detail::DecimalWords> MakeRange(
+    const Decimal128Array& array) {
+  return {reinterpret_cast<const detail::DecimalWords*>(array.raw_values())};
+}
+
 template <typename T, typename RangeType = GetViewFromStringLikeArray<BaseBinaryArray<T>>>
 RangeType MakeRange(const BaseBinaryArray<T>& array) {
   return RangeType{&array};
@@ -172,7 +186,7 @@ inline Status AssignNulls(FunctionContext* ctx, const Array& left, const Array&
 }
 
 template <CompareOperator Op, typename L, typename R>
-Status Compare(L&& get_left, R&& get_right, ArrayData* out) {
+Status Compare(L get_left, R get_right, ArrayData* out) {
   auto out_bitmap = out->buffers[1]->mutable_data();
   internal::GenerateBitsUnrolled(out_bitmap, 0, out->length, [&]() -> bool {
     return Comparator<decltype(get_left()), Op>::Compare(get_left(), get_right());
@@ -180,6 +194,76 @@ Status Compare(L&& get_left, R&& get_right, ArrayData* out) {
   return Status::OK();
 }
 
+// Fixed-width values are compared in blocks, using the AVX2 kernels when the
+// running CPU supports them
+template <CompareOperator Op, typename T>
+struct CompareBitmap {
+  using Blocks = detail::CompareBitmapBlocks<detail::CompareSimdLevel::NONE, Op, T>;
+  using ArrayArrayFunc = void (*)(const T*, const T*, int64_t, uint8_t*);
+  using ArrayScalarFunc = void (*)(const T*, T, int64_t, uint8_t*);
+
+  static ArrayArrayFunc ArrayArray() {
+    static const ArrayArrayFunc func = [] {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+        return &detail::CompareArrayArrayAvx2<Op, T>;
+      }
+#endif
+      return &Blocks::ArrayArray;
+    }();
+    return func;
+  }
+
+  static ArrayScalarFunc ArrayScalar() {
+    static const ArrayScalarFunc func = [] {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+        return &detail::CompareArrayScalarAvx2<Op, T>;
+      }
+#endif
+      return &Blocks::ArrayScalar;
+    }();
+    return func;
+  }
+};
+
+template <CompareOperator Op, typename T>
+Status Compare(DereferenceIncrementPointer<T> left, DereferenceIncrementPointer<T> right,
+               ArrayData* out) {
+  CompareBitmap<Op, T>::ArrayArray()(left.ptr_, right.ptr_, out->length,
+                                     out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
+template <CompareOperator Op, typename T>
+Status Compare(DereferenceIncrementPointer<T> left, RepeatedValue<T> right,
+               ArrayData* out) {
+  CompareBitmap<Op, T>::ArrayScalar()(left.ptr_, right.value_, out->length,
+                                      out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
+// Decimals are compared in blocks with the branch-free comparisons of their
+// words.  There are no AVX2 kernels for them.
+template <CompareOperator Op>
+Status Compare(DereferenceIncrementPointer<detail::DecimalWords> left,
+               DereferenceIncrementPointer<detail::DecimalWords> right, ArrayData* out) {
+  using Blocks = detail::CompareBitmapBlocks<detail::CompareSimdLevel::NONE, Op,
+                                             detail::DecimalWords>;
+  Blocks::ArrayArray(left.ptr_, right.ptr_, out->length, out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
+template <CompareOperator Op>
+Status Compare(DereferenceIncrementPointer<detail::DecimalWords> left,
+               RepeatedValue<detail::DecimalWords> right, ArrayData* out) {
+  using Blocks = detail::CompareBitmapBlocks<detail::CompareSimdLevel::NONE, Op,
+                                             detail::DecimalWords>;
+  Blocks::ArrayScalar(left.ptr_, right.value_, out->length,
+                      out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
 template <typename ArrowType, CompareOperator Op>
 class CompareKernel final : public BinaryKernel {
  public:
@@ -272,12 +356,16 @@ struct UnpackType {
     return Status::OK();
   }
 
+  Status Visit(const Decimal128Type& t) {
+    *out_ = UnpackOperator<Decimal128Type>(options_.op);
+    return Status::OK();
+  }
+
   Status Visit(const DictionaryType& t) { return NotImplemented(t); }
   Status Visit(const DayTimeIntervalType& t) { return NotImplemented(t); }
   Status Visit(const MonthIntervalType& t) { return NotImplemented(t); }
   Status Visit(const FixedSizeBinaryType& t) { return NotImplemented(t); }
   Status Visit(const DurationType& t) { return NotImplemented(t); }
-  Status Visit(const Decimal128Type& t) { return NotImplemented(t); }
   Status Visit(const ListType& t) { return NotImplemented(t); }
   Status Visit(const LargeListType& t) { return NotImplemented(t); }
   Status Visit(const MapType& t) { return NotImplemented(t); }
@@ -309,6 +397,7 @@ inline Status FinishCompare(FunctionContext* context, const Datum& left,
 
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                CompareOptions options, Datum* out) {
+  ARROW_TRACE_SPAN("compute::Compare");
   if (!left.type()->Equals(right.type())) {
     return Status::TypeError("Cannot compare data of differing type ", *left.type(),
                              " vs ", *right.type());
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with ARROW_AVX2_FLAG; see src/arrow/CMakeLists.txt.
+
+#include "arrow/compute/kernels/compare_internal.h"
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace compute {
+namespace detail {
+
+// Shift each 0/1 byte into its sign bit and gather the sign bits with movemask
+template <>
+struct PackCompareBytes<CompareSimdLevel::AVX2> {
+  static void Pack(const uint8_t* bytes, int64_t num_out_bytes, uint8_t* out_bitmap) {
+    const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+    const __m256i high =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + 32));
+    const uint64_t word =
+        static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(low, 7))) |
+        static_cast<uint64_t>(static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_slli_epi16(high, 7))))
+            << 32;
+    std::memcpy(out_bitmap, &word, static_cast<size_t>(num_out_bytes));
+  }
+};
+
+template <CompareOperator Op, typename T>
+void CompareArrayArrayAvx2(const T* left, const T* right, int64_t length,
+                           uint8_t* out_bitmap) {
+  CompareBitmapBlocks<CompareSimdLevel::AVX2, Op, T>::ArrayArray(left, right, length,
+                                                                out_bitmap);
+}
+
+template <CompareOperator Op, typename T>
+void CompareArrayScalarAvx2(const T* left, T right, int64_t length,
+                            uint8_t* out_bitmap) {
+  CompareBitmapBlocks<CompareSimdLevel::AVX2, Op, T>::ArrayScalar(left, right, length,
+                                                                 out_bitmap);
+}
+
+#define INSTANTIATE_COMPARE_AVX2_OP(OP, T)                                    \
+  template void CompareArrayArrayAvx2<CompareOperator::OP, T>(                \
+      const T* left, const T* right, int64_t length, uint8_t* out_bitmap);    \
+  template void CompareArrayScalarAvx2<CompareOperator::OP, T>(               \
+      const T* left, T right, int64_t length, uint8_t* out_bitmap);
+
+#define INSTANTIATE_COMPARE_AVX2(T)             \
+  INSTANTIATE_COMPARE_AVX2_OP(EQUAL, T)         \
+  INSTANTIATE_COMPARE_AVX2_OP(NOT_EQUAL, T)     \
+  INSTANTIATE_COMPARE_AVX2_OP(GREATER, T)       \
+  INSTANTIATE_COMPARE_AVX2_OP(GREATER_EQUAL, T) \
+  INSTANTIATE_COMPARE_AVX2_OP(LESS, T)          \
+  INSTANTIATE_COMPARE_AVX2_OP(LESS_EQUAL, T)
+
+INSTANTIATE_COMPARE_AVX2(uint8_t)
+INSTANTIATE_COMPARE_AVX2(int8_t)
+INSTANTIATE_COMPARE_AVX2(uint16_t)
+INSTANTIATE_COMPARE_AVX2(int16_t)
+INSTANTIATE_COMPARE_AVX2(uint32_t)
+INSTANTIATE_COMPARE_AVX2(int32_t)
+INSTANTIATE_COMPARE_AVX2(uint64_t)
+INSTANTIATE_COMPARE_AVX2(int64_t)
+INSTANTIATE_COMPARE_AVX2(float)
+INSTANTIATE_COMPARE_AVX2(double)
+
+#undef INSTANTIATE_COMPARE_AVX2
+#undef INSTANTIATE_COMPARE_AVX2_OP
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
@@ -31,37 +31,42 @@ namespace compute {
 
 constexpr auto kSeed = 0x94378165;
 
-static void CompareArrayScalarKernel(benchmark::State& state) {
+template <typename ArrowType>
+static void CompareArrayScalar(benchmark::State& state) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
   const int64_t memory_size = state.range(0);
-  const int64_t array_size = memory_size / sizeof(int64_t);
+  const int64_t array_size = memory_size / sizeof(CType);
   const double null_percent = static_cast<double>(state.range(1)) / 100.0;
   auto rand = random::RandomArrayGenerator(kSeed);
-  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
+  auto array = rand.Numeric<ArrowType>(array_size, -100, 100, null_percent);
+  auto zero = std::make_shared<ScalarType>(static_cast<CType>(0));
 
   CompareOptions ge{GREATER_EQUAL};
 
   FunctionContext ctx;
   for (auto _ : state) {
     Datum out;
-    ABORT_NOT_OK(Compare(&ctx, Datum(array), Datum(int64_t(0)), ge, &out));
+    ABORT_NOT_OK(Compare(&ctx, Datum(array), Datum(zero), ge, &out));
     benchmark::DoNotOptimize(out);
   }
 
   state.counters["size"] = static_cast<double>(memory_size);
   state.counters["null_percent"] = static_cast<double>(state.range(1));
-  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(CType));
 }
 
-static void CompareArrayArrayKernel(benchmark::State& state) {
+template <typename ArrowType>
+static void CompareArrayArray(benchmark::State& state) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
   const int64_t memory_size = state.range(0);
-  const int64_t array_size = memory_size / sizeof(int64_t);
+  const int64_t array_size = memory_size / sizeof(CType);
   const double null_percent = static_cast<double>(state.range(1)) / 100.0;
   auto rand = random::RandomArrayGenerator(kSeed);
-  auto lhs = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
-  auto rhs = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
+  auto lhs = rand.Numeric<ArrowType>(array_size, -100, 100, null_percent);
+  auto rhs = rand.Numeric<ArrowType>(array_size, -100, 100, null_percent);
 
   CompareOptions ge(GREATER_EQUAL);
 
@@ -74,11 +79,44 @@ static void CompareArrayArrayKernel(benchmark::State& state) {
 
   state.counters["size"] = static_cast<double>(memory_size);
   state.counters["null_percent"] = static_cast<double>(state.range(1));
-  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t) * 2);
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(CType) * 2);
+}
+
+static void CompareArrayScalarKernel(benchmark::State& state) {
+  CompareArrayScalar<Int64Type>(state);
+}
+
+static void CompareArrayArrayKernel(benchmark::State& state) {
+  CompareArrayArray<Int64Type>(state);
+}
+
+static void CompareArrayScalarKernelInt8(benchmark::State& state) {
+  CompareArrayScalar<Int8Type>(state);
+}
+
+static void CompareArrayScalarKernelInt32(benchmark::State& state) {
+  CompareArrayScalar<Int32Type>(state);
+}
+
+static void CompareArrayScalarKernelDouble(benchmark::State& state) {
+  CompareArrayScalar<DoubleType>(state);
+}
+
+static void CompareArrayArrayKernelInt32(benchmark::State& state) {
+  CompareArrayArray<Int32Type>(state);
+}
+
+static void CompareArrayArrayKernelDouble(benchmark::State& state) {
+  CompareArrayArray<DoubleType>(state);
 }
 
 BENCHMARK(CompareArrayScalarKernel)->Apply(RegressionSetArgs);
 BENCHMARK(CompareArrayArrayKernel)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarKernelInt8)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarKernelInt32)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarKernelDouble)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayArrayKernelInt32)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayArrayKernelDouble)->Apply(RegressionSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
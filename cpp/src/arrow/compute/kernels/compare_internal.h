@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace compute {
+namespace detail {
+
+// Instruction set a copy of the bitmap compare kernels is compiled for.  Every
+// level is instantiated in its own translation unit with its own compiler flags;
+// the template argument keeps the symbols of those copies apart.
+enum class CompareSimdLevel { NONE, AVX2 };
+
+// Pack 64 bytes of 0 or 1 into the first num_out_bytes bytes of a bitmap.  The
+// AVX2 translation unit specializes this.
+template <CompareSimdLevel Level>
+struct PackCompareBytes {
+  static void Pack(const uint8_t* bytes, int64_t num_out_bytes, uint8_t* out_bitmap) {
+    // The multiplication moves byte k of the little-endian word to bit 56 + k;
+    // no two partial products overlap, so no carries disturb the top byte.
+    for (int64_t k = 0; k < num_out_bytes; ++k) {
+      uint64_t word;
+      std::memcpy(&word, bytes + k * 8, sizeof(word));
+      word = BitUtil::FromLittleEndian(word);
+      out_bitmap[k] = static_cast<uint8_t>((word * 0x0102040810204080ULL) >> 56);
+    }
+  }
+};
+
+// Compare fixed-width values into a bitmap (starting at bit 0), 64 values at a
+// time.  Each block is first compared into a byte per value, a loop the compiler
+// vectorizes for whatever instruction set the translation unit targets, and then
+// packed into 8 bitmap bytes by PackCompareBytes.
+template <CompareSimdLevel Level, CompareOperator Op, typename T>
+struct CompareBitmapBlocks {
+  static constexpr int64_t kBlockSize = 64;
+
+  static void ArrayArray(const T* left, const T* right, int64_t length,
+                         uint8_t* out_bitmap) {
+    Run(left, [right](int64_t i) { return right[i]; }, length, out_bitmap);
+  }
+
+  static void ArrayScalar(const T* left, T right, int64_t length, uint8_t* out_bitmap) {
+    Run(left, [right](int64_t) { return right; }, length, out_bitmap);
+  }
+
+ private:
+  static bool Compare(T lhs, T rhs) {
+    switch (Op) {
+      case CompareOperator::EQUAL:
+        return lhs == rhs;
+      case CompareOperator::NOT_EQUAL:
+        return lhs != rhs;
+      case CompareOperator::GREATER:
+        return lhs > rhs;
+      case CompareOperator::GREATER_EQUAL:
+        return lhs >= rhs;
+      case CompareOperator::LESS:
+        return lhs < rhs;
+      case CompareOperator::LESS_EQUAL:
+        return lhs <= rhs;
+    }
+    return false;
+  }
+
+  template <typename GetRight>
+  static void Run(const T* left, GetRight&& get_right, int64_t length,
+                  uint8_t* out_bitmap) {
+    uint8_t bytes[kBlockSize];
+    int64_t i = 0;
+    for (; i + kBlockSize <= length; i += kBlockSize) {
+      for (int64_t j = 0; j < kBlockSize; ++j) {
+        bytes[j] = Compare(left[i + j], get_right(i + j));
+      }
+      PackCompareBytes<Level>::Pack(bytes, kBlockSize / 8, out_bitmap);
+      out_bitmap += kBlockSize / 8;
+    }
+
+    const int64_t remaining = length - i;
+    if (remaining > 0) {
+      std::memset(bytes, 0, sizeof(bytes));
+      for (int64_t j = 0; j < remaining; ++j) {
+        bytes[j] = Compare(left[i + j], get_right(i + j));
+      }
+      PackCompareBytes<Level>::Pack(bytes, BitUtil::BytesForBits(remaining), out_bitmap);
+    }
+  }
+};
+
+template <CompareSimdLevel Level, CompareOperator Op, typename T>
+constexpr int64_t CompareBitmapBlocks<Level, Op, T>::kBlockSize;
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+
+// AVX2 copies of CompareBitmapBlocks, defined in compare_avx2.cc for all
+// numeric C types.  The caller must check that the running CPU supports AVX2.
+template <CompareOperator Op, typename T>
+void CompareArrayArrayAvx2(const T* left, const T* right, int64_t length,
+                           uint8_t* out_bitmap);
+
+template <CompareOperator Op, typename T>
+void CompareArrayScalarAvx2(const T* left, T right, int64_t length,
+                            uint8_t* out_bitmap);
+
+#endif
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
@@ -31,6 +31,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -39,6 +40,7 @@
 namespace arrow {
 namespace compute {
 
+using internal::checked_cast;
 using util::string_view;
 
 template <typename ArrowType>
@@ -423,6 +425,26 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TYPED_TEST(TestNumericCompareKernel, RandomCompareSlicedArrays) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  // Lengths and offsets that are not multiples of the 64-value blocks
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  auto fifty = Datum(std::make_shared<ScalarType>(CType(50)));
+  for (int64_t length : {1, 63, 64, 65, 127, 200, 1001}) {
+    for (int64_t offset : {0, 1, 13}) {
+      auto lhs = rand.Numeric<TypeParam>(length + offset, 0, 100, 0.1)->Slice(offset);
+      auto rhs = rand.Numeric<TypeParam>(length + offset, 0, 100, 0.1)->Slice(offset);
+      for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+        auto options = CompareOptions(op);
+        ValidateCompare<TypeParam>(&this->ctx_, options, Datum(lhs), Datum(rhs));
+        ValidateCompare<TypeParam>(&this->ctx_, options, Datum(lhs), fifty);
+      }
+    }
+  }
+}
+
 class TestStringCompareKernel : public ComputeFixture, public TestBase {};
 
 TEST_F(TestStringCompareKernel, SimpleCompareArrayScalar) {
@@ -552,5 +574,84 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+class TestDecimalCompareKernel : public ComputeFixture, public TestBase {
+ protected:
+  // Values across several bitmap blocks, some beyond 64 bits and some equal to
+  // the scalar
+  std::shared_ptr<Array> MakeValues(int64_t length, int64_t seed) {
+    std::vector<Decimal128> values;
+    std::vector<bool> is_valid;
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t n = (i * seed) % 7 - 3;
+      values.push_back(i % 3 == 0 ? Decimal128("1e30") * Decimal128(n) : Decimal128(n));
+      is_valid.push_back((i + seed) % 11 != 0);
+    }
+    std::shared_ptr<Array> out;
+    ArrayFromVector<Decimal128Type, Decimal128>(decimal(38, 2), is_valid, values, &out);
+    return out;
+  }
+
+  void AssertCompare(CompareOperator op, const Datum& lhs, const Datum& rhs) {
+    auto value = [](const Datum& datum, int64_t i) -> Decimal128 {
+      if (datum.is_scalar()) {
+        return checked_cast<const Decimal128Scalar&>(*datum.scalar()).value;
+      }
+      return Decimal128(checked_cast<const Decimal128Array&>(*datum.make_array())
+                            .GetValue(i));
+    };
+    auto is_valid = [](const Datum& datum, int64_t i) -> bool {
+      return datum.is_scalar() ? datum.scalar()->is_valid
+                               : datum.make_array()->IsValid(i);
+    };
+    const int64_t length = lhs.is_array() ? lhs.length() : rhs.length();
+    std::vector<bool> expected_valid, expected_values;
+    for (int64_t i = 0; i < length; ++i) {
+      expected_valid.push_back(is_valid(lhs, i) && is_valid(rhs, i));
+      expected_values.push_back(SlowCompare(op, value(lhs, i), value(rhs, i)));
+    }
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<BooleanType>(expected_valid, expected_values, &expected);
+    ValidateCompare<Decimal128Type>(&ctx_, CompareOptions(op), lhs, rhs, expected);
+  }
+};
+
+TEST_F(TestDecimalCompareKernel, Simple) {
+  std::shared_ptr<Array> lhs, rhs;
+  ArrayFromVector<Decimal128Type, Decimal128>(
+      decimal(20, 2), {true, true, false, true},
+      {Decimal128("1.00"), Decimal128("-2.50"), Decimal128(0),
+       Decimal128("123456789012345678.90")},
+      &lhs);
+  ArrayFromVector<Decimal128Type, Decimal128>(
+      decimal(20, 2),
+      {Decimal128("1.00"), Decimal128("-2.49"), Decimal128(0),
+       Decimal128("-123456789012345678.90")},
+      &rhs);
+  Datum one(std::make_shared<Decimal128Scalar>(Decimal128("1.00"), decimal(20, 2)));
+
+  ValidateCompare<Decimal128Type>(&ctx_, CompareOptions(EQUAL), lhs, rhs,
+                                  ArrayFromJSON(boolean(), "[1, 0, null, 0]"));
+  ValidateCompare<Decimal128Type>(&ctx_, CompareOptions(LESS), lhs, rhs,
+                                  ArrayFromJSON(boolean(), "[0, 1, null, 0]"));
+  ValidateCompare<Decimal128Type>(&ctx_, CompareOptions(GREATER_EQUAL), lhs, one,
+                                  ArrayFromJSON(boolean(), "[1, 0, null, 1]"));
+  ValidateCompare<Decimal128Type>(&ctx_, CompareOptions(NOT_EQUAL), one, rhs,
+                                  ArrayFromJSON(boolean(), "[0, 1, 1, 1]"));
+}
+
+TEST_F(TestDecimalCompareKernel, ArrayArrayAndScalar) {
+  auto lhs = MakeValues(1000, 3);
+  auto rhs = MakeValues(1000, 5);
+  Datum zero(std::make_shared<Decimal128Scalar>(Decimal128(0), decimal(38, 2)));
+  Datum big(std::make_shared<Decimal128Scalar>(Decimal128("2e30"), decimal(38, 2)));
+  for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+    SCOPED_TRACE(::testing::Message() << "operator " << op);
+    AssertCompare(op, lhs, rhs);
+    AssertCompare(op, lhs->Slice(3), rhs->Slice(3));
+    AssertCompare(op, lhs, zero);
+    AssertCompare(op, big, rhs->Slice(5));
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,479 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/conditional.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+constexpr int kWordBits = 64;
+
+uint64_t LowBits(int length) {
+  return length == kWordBits ? ~static_cast<uint64_t>(0)
+                             : (static_cast<uint64_t>(1) << length) - 1;
+}
+
+uint64_t GetWord(const std::shared_ptr<Buffer>& bitmap, int64_t offset, int length) {
+  return bitmap == nullptr ? LowBits(length)
+                           : BitUtil::GetBitsAsWord(bitmap->data(), offset, length);
+}
+
+// A value operand of a selection.  A Scalar is broadcast to one word worth of
+// values, from which every word of the output reads.
+struct Operand {
+  std::shared_ptr<ArrayData> data;
+  std::shared_ptr<Scalar> scalar;
+
+  bool is_scalar() const { return scalar != nullptr; }
+
+  // Position in data of the value at the start of the output word at position
+  int64_t WordStart(int64_t position) const {
+    return is_scalar() ? data->offset : data->offset + position;
+  }
+
+  uint64_t ValidWord(int64_t position, int length) const {
+    return GetWord(data->buffers[0], WordStart(position), length);
+  }
+
+  bool HasNulls() const { return data->GetNullCount() > 0; }
+};
+
+Status MakeOperand(FunctionContext* ctx, const Datum& datum, Operand* out) {
+  if (datum.is_array()) {
+    out->data = datum.array();
+    out->scalar = nullptr;
+  } else if (datum.is_scalar()) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto array, MakeArrayFromScalar(*datum.scalar(), kWordBits, ctx->memory_pool()));
+    out->data = array->data();
+    out->scalar = datum.scalar();
+  } else {
+    return Status::Invalid("Conditional kernels expect Array or Scalar operands");
+  }
+  return Status::OK();
+}
+
+// Writers of the values of each layout, one word of the output at a time.
+// The bits of `select` choose the left operand, its cleared bits the right,
+// and the bits of `valid` are the validity of the output.
+
+class BooleanWriter {
+ public:
+  BooleanWriter(const Operand& left, const Operand& right) : left_(left), right_(right) {}
+
+  Status Init(FunctionContext* ctx, int64_t length) {
+    ARROW_ASSIGN_OR_RAISE(values_, AllocateEmptyBitmap(length, ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  Status Write(int64_t position, int length, uint64_t select, uint64_t) {
+    const uint64_t left = GetWord(left_.data->buffers[1], left_.WordStart(position),
+                                  length);
+    const uint64_t right = GetWord(right_.data->buffers[1], right_.WordStart(position),
+                                   length);
+    const uint64_t word = BitUtil::ToLittleEndian((select & left) | (~select & right));
+    std::memcpy(values_->mutable_data() + position / 8, &word,
+                static_cast<size_t>(BitUtil::BytesForBits(length)));
+    return Status::OK();
+  }
+
+  Status Finish(ArrayData* out) {
+    out->buffers.push_back(std::move(values_));
+    return Status::OK();
+  }
+
+ private:
+  const Operand& left_;
+  const Operand& right_;
+  std::shared_ptr<Buffer> values_;
+};
+
+// Values of a byte width, moved as CType (or byte by byte for other widths)
+template <typename CType>
+class FixedWidthWriter {
+ public:
+  FixedWidthWriter(const Operand& left, const Operand& right)
+      : left_(left), right_(right), byte_width_(ByteWidth(*left.data->type)) {}
+
+  Status Init(FunctionContext* ctx, int64_t length) {
+    ARROW_ASSIGN_OR_RAISE(values_,
+                          AllocateBuffer(length * byte_width_, ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  Status Write(int64_t position, int length, uint64_t select, uint64_t) {
+    uint8_t* out = values_->mutable_data() + position * byte_width_;
+    const uint8_t* left = Values(left_, position);
+    const uint8_t* right = Values(right_, position);
+    if (select == LowBits(length)) {
+      std::memcpy(out, left, length * byte_width_);
+    } else if (select == 0) {
+      std::memcpy(out, right, length * byte_width_);
+    } else {
+      SelectValues(out, left, right, length, select);
+    }
+    return Status::OK();
+  }
+
+  Status Finish(ArrayData* out) {
+    out->buffers.push_back(std::move(values_));
+    return Status::OK();
+  }
+
+ private:
+  static int64_t ByteWidth(const DataType& type) {
+    return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+  }
+
+  const uint8_t* Values(const Operand& operand, int64_t position) const {
+    return operand.data->buffers[1]->data() + operand.WordStart(position) * byte_width_;
+  }
+
+  template <typename T = CType>
+  enable_if_t<!std::is_same<T, void>::value> SelectValues(uint8_t* out,
+                                                          const uint8_t* left,
+                                                          const uint8_t* right,
+                                                          int length,
+                                                          uint64_t select) const {
+    auto out_values = reinterpret_cast<T*>(out);
+    auto left_values = reinterpret_cast<const T*>(left);
+    auto right_values = reinterpret_cast<const T*>(right);
+    for (int i = 0; i < length; ++i) {
+      out_values[i] = ((select >> i) & 1) ? left_values[i] : right_values[i];
+    }
+  }
+
+  template <typename T = CType>
+  enable_if_t<std::is_same<T, void>::value> SelectValues(uint8_t* out,
+                                                         const uint8_t* left,
+                                                         const uint8_t* right,
+                                                         int length,
+                                                         uint64_t select) const {
+    for (int i = 0; i < length; ++i) {
+      const uint8_t* value = ((select >> i) & 1) ? left : right;
+      std::memcpy(out + i * byte_width_, value + i * byte_width_, byte_width_);
+    }
+  }
+
+  const Operand& left_;
+  const Operand& right_;
+  const int64_t byte_width_;
+  std::shared_ptr<Buffer> values_;
+};
+
+template <typename Type>
+class BinaryWriter {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  BinaryWriter(const Operand& left, const Operand& right) : left_(left), right_(right) {}
+
+  Status Init(FunctionContext* ctx, int64_t length) {
+    offsets_.reset(new TypedBufferBuilder<offset_type>(ctx->memory_pool()));
+    data_.reset(new BufferBuilder(ctx->memory_pool()));
+    RETURN_NOT_OK(offsets_->Reserve(length + 1));
+    offsets_->UnsafeAppend(0);
+    return Status::OK();
+  }
+
+  // Null values of the output are left empty
+  Status Write(int64_t position, int length, uint64_t select, uint64_t valid) {
+    if (valid == LowBits(length)) {
+      if (select == valid) {
+        return AppendRun(left_, position, length);
+      } else if (select == 0) {
+        return AppendRun(right_, position, length);
+      }
+    }
+    for (int i = 0; i < length; ++i) {
+      if ((valid >> i) & 1) {
+        RETURN_NOT_OK(AppendRun(((select >> i) & 1) ? left_ : right_, position + i, 1));
+      } else {
+        offsets_->UnsafeAppend(static_cast<offset_type>(data_->length()));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finish(ArrayData* out) {
+    out->buffers.emplace_back();
+    RETURN_NOT_OK(offsets_->Finish(&out->buffers.back()));
+    out->buffers.emplace_back();
+    return data_->Finish(&out->buffers.back());
+  }
+
+ private:
+  // Append the values [position, position + length) of the output, which are
+  // in the same word, from an operand
+  Status AppendRun(const Operand& operand, int64_t position, int length) {
+    const int64_t start =
+        operand.WordStart(position - position % kWordBits) + position % kWordBits;
+    const offset_type* offsets = operand.data->GetValues<offset_type>(1, 0) + start;
+    const int64_t num_bytes = offsets[length] - offsets[0];
+    if (data_->length() + num_bytes > std::numeric_limits<offset_type>::max()) {
+      return Status::CapacityError("Result of conditional kernel is too large for ",
+                                   *operand.data->type);
+    }
+    const offset_type delta = static_cast<offset_type>(data_->length()) - offsets[0];
+    for (int i = 1; i <= length; ++i) {
+      offsets_->UnsafeAppend(offsets[i] + delta);
+    }
+    if (num_bytes > 0) {
+      RETURN_NOT_OK(
+          data_->Append(operand.data->buffers[2]->data() + offsets[0], num_bytes));
+    }
+    return Status::OK();
+  }
+
+  const Operand& left_;
+  const Operand& right_;
+  std::unique_ptr<TypedBufferBuilder<offset_type>> offsets_;
+  std::unique_ptr<BufferBuilder> data_;
+};
+
+// Compute the values and validity of the output one word at a time.  The
+// output is null where the bits of `valid_word` are cleared.
+template <typename Writer, typename SelectWord, typename ValidWord>
+Status SelectWith(FunctionContext* ctx, int64_t length, SelectWord&& select_word,
+                  ValidWord&& valid_word, const Operand& left, const Operand& right,
+                  std::shared_ptr<ArrayData>* out) {
+  Writer writer(left, right);
+  RETURN_NOT_OK(writer.Init(ctx, length));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> validity,
+                        AllocateEmptyBitmap(length, ctx->memory_pool()));
+
+  int64_t valid_count = 0;
+  for (int64_t position = 0; position < length; position += kWordBits) {
+    const int word_length =
+        static_cast<int>(std::min<int64_t>(kWordBits, length - position));
+    const uint64_t select = select_word(position, word_length);
+    const uint64_t valid = valid_word(position, word_length) &
+                           ((select & left.ValidWord(position, word_length)) |
+                            (~select & right.ValidWord(position, word_length)));
+    RETURN_NOT_OK(writer.Write(position, word_length, select, valid));
+    const uint64_t valid_le = BitUtil::ToLittleEndian(valid);
+    std::memcpy(validity->mutable_data() + position / 8, &valid_le,
+                static_cast<size_t>(BitUtil::BytesForBits(word_length)));
+    valid_count += BitUtil::PopCount(valid);
+  }
+
+  const int64_t null_count = length - valid_count;
+  *out = ArrayData::Make(left.data->type, length,
+                         {null_count > 0 ? std::move(validity) : nullptr}, null_count);
+  return writer.Finish(out->get());
+}
+
+template <typename SelectWord, typename ValidWord>
+Status Select(FunctionContext* ctx, int64_t length, SelectWord&& select_word,
+              ValidWord&& valid_word, const Operand& left, const Operand& right,
+              std::shared_ptr<ArrayData>* out) {
+  const DataType& type = *left.data->type;
+  if (!type.Equals(*right.data->type)) {
+    return Status::TypeError("Conditional kernels expect operands of the same type, ",
+                             "got ", type, " and ", *right.data->type);
+  }
+
+#define SELECT_WITH(WRITER) \
+  SelectWith<WRITER>(ctx, length, select_word, valid_word, left, right, out)
+
+  switch (type.id()) {
+    case Type::BOOL:
+      return SELECT_WITH(BooleanWriter);
+    case Type::STRING:
+      return SELECT_WITH(BinaryWriter<StringType>);
+    case Type::BINARY:
+      return SELECT_WITH(BinaryWriter<BinaryType>);
+    case Type::LARGE_STRING:
+      return SELECT_WITH(BinaryWriter<LargeStringType>);
+    case Type::LARGE_BINARY:
+      return SELECT_WITH(BinaryWriter<LargeBinaryType>);
+    case Type::DICTIONARY:
+    case Type::EXTENSION:
+      break;
+    default:
+      if (!is_fixed_width(type.id())) {
+        break;
+      }
+      switch (checked_cast<const FixedWidthType&>(type).bit_width()) {
+        case 8:
+          return SELECT_WITH(FixedWidthWriter<uint8_t>);
+        case 16:
+          return SELECT_WITH(FixedWidthWriter<uint16_t>);
+        case 32:
+          return SELECT_WITH(FixedWidthWriter<uint32_t>);
+        case 64:
+          return SELECT_WITH(FixedWidthWriter<uint64_t>);
+        default:
+          if (checked_cast<const FixedWidthType&>(type).bit_width() % 8 == 0) {
+            return SELECT_WITH(FixedWidthWriter<void>);
+          }
+          break;
+      }
+  }
+
+#undef SELECT_WITH
+
+  return Status::NotImplemented("Conditional kernels not implemented for type ", type);
+}
+
+int64_t OperandsLength(const std::vector<Operand>& operands) {
+  for (const auto& operand : operands) {
+    if (!operand.is_scalar()) {
+      return operand.data->length;
+    }
+  }
+  return -1;
+}
+
+Status CoalesceOperands(FunctionContext* ctx, const std::vector<Operand>& operands,
+                        std::shared_ptr<ArrayData>* out) {
+  const int64_t length = OperandsLength(operands);
+  if (length < 0) {
+    return Status::Invalid("Coalesce expects at least one Array");
+  }
+  for (const auto& operand : operands) {
+    if (!operand.data->type->Equals(*operands[0].data->type)) {
+      return Status::TypeError("Coalesce expects values of the same type, got ",
+                               *operands[0].data->type, " and ", *operand.data->type);
+    }
+    if (!operand.is_scalar() && operand.data->length != length) {
+      return Status::Invalid("Coalesce expects Arrays of the same length");
+    }
+  }
+
+  Operand current = operands[0];
+  for (size_t i = 1; i < operands.size(); ++i) {
+    if (!current.HasNulls()) {
+      break;
+    }
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(Select(
+        ctx, length,
+        [&](int64_t position, int word_length) {
+          return current.ValidWord(position, word_length);
+        },
+        [](int64_t, int word_length) { return LowBits(word_length); }, current,
+        operands[i], &result));
+    current.data = std::move(result);
+    current.scalar = nullptr;
+  }
+
+  if (current.is_scalar()) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto array, MakeArrayFromScalar(*current.scalar, length, ctx->memory_pool()));
+    *out = array->data();
+  } else {
+    *out = std::move(current.data);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status IfElse(FunctionContext* ctx, const Datum& cond, const Datum& left,
+              const Datum& right, Datum* out) {
+  if (!cond.is_array() || cond.type()->id() != Type::BOOL) {
+    return Status::Invalid("IfElse expects a boolean Array condition");
+  }
+  const ArrayData& cond_data = *cond.array();
+  Operand left_operand, right_operand;
+  RETURN_NOT_OK(MakeOperand(ctx, left, &left_operand));
+  RETURN_NOT_OK(MakeOperand(ctx, right, &right_operand));
+  for (const Operand* operand : {&left_operand, &right_operand}) {
+    if (!operand->is_scalar() && operand->data->length != cond_data.length) {
+      return Status::Invalid("IfElse expects Arrays of the length of the condition");
+    }
+  }
+
+  const std::shared_ptr<Buffer> cond_validity =
+      cond_data.GetNullCount() > 0 ? cond_data.buffers[0] : nullptr;
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(Select(
+      ctx, cond_data.length,
+      [&](int64_t position, int word_length) {
+        return BitUtil::GetBitsAsWord(cond_data.buffers[1]->data(),
+                                      cond_data.offset + position, word_length);
+      },
+      [&](int64_t position, int word_length) {
+        return GetWord(cond_validity, cond_data.offset + position, word_length);
+      },
+      left_operand, right_operand, &result));
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status Coalesce(FunctionContext* ctx, const std::vector<Datum>& values, Datum* out) {
+  std::vector<Operand> operands(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    RETURN_NOT_OK(MakeOperand(ctx, values[i], &operands[i]));
+  }
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(CoalesceOperands(ctx, operands, &result));
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status FillNull(FunctionContext* ctx, const Datum& values, const Datum& fill_value,
+                Datum* out) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("FillNull expects Array or ChunkedArray values");
+  }
+  if (!fill_value.is_scalar()) {
+    return Status::Invalid("FillNull expects a Scalar fill value");
+  }
+  std::vector<Operand> operands(2);
+  RETURN_NOT_OK(MakeOperand(ctx, fill_value, &operands[1]));
+
+  std::vector<Datum> outputs;
+  for (const auto& chunk : values.chunks()) {
+    operands[0].data = chunk->data();
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(CoalesceOperands(ctx, operands, &result));
+    outputs.emplace_back(std::move(result));
+  }
+  *out = detail::WrapDatumsLike(values, values.type(), outputs);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Choose each value from one of two datums according to a condition
+///
+/// The output is `left` where `cond` is true, `right` where it is false and
+/// null where it is null.  For example given cond [true, false, null],
+/// left [1, 2, 3] and right [4, null, 6], the output will be [1, null, null].
+///
+/// The condition is processed one 64-bit word at a time: words that are all
+/// true or all false copy a run of values at once.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] cond boolean Array
+/// \param[in] left Array of the same length as cond, or Scalar
+/// \param[in] right Array of the same length as cond, or Scalar, of the type
+///            of left.  Boolean, numeric, temporal, fixed size binary,
+///            decimal, binary and string types are supported.
+/// \param[out] out resulting Array of the type of left
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status IfElse(FunctionContext* ctx, const Datum& cond, const Datum& left,
+              const Datum& right, Datum* out);
+
+/// \brief Choose each value from the first of several datums where it is not
+/// null
+///
+/// For example given [1, null, null], [null, 2, null] and [3, 3, null], the
+/// output will be [1, 2, null].  The datums are consumed one by one, one
+/// 64-bit word of the validity bitmap of the output so far at a time, and the
+/// consumption stops once the output has no nulls.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values Arrays of the same length, or Scalars, of the same type.
+///            At least one of them must be an Array.  Supported types are
+///            those of IfElse.
+/// \param[out] out resulting Array of the type of the values
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Coalesce(FunctionContext* ctx, const std::vector<Datum>& values, Datum* out);
+
+/// \brief Replace the nulls of a datum with a value
+///
+/// For example given [1, null, 3] and 0, the output will be [1, 0, 3].  This
+/// is Coalesce of the values and the fill value, applied to each chunk of a
+/// ChunkedArray.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values Array or ChunkedArray.  Supported types are those of
+///            IfElse.
+/// \param[in] fill_value Scalar of the type of values
+/// \param[out] out resulting datum of the kind and type of values
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status FillNull(FunctionContext* ctx, const Datum& values, const Datum& fill_value,
+                Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,268 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/conditional.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestConditional : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<Array> Concat(const ArrayVector& slices) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Concatenate(slices, default_memory_pool(), &out));
+    return out;
+  }
+
+  // Choose each value by slicing the operands
+  std::shared_ptr<Array> NaiveIfElse(const Array& cond, const Array& left,
+                                     const Array& right) {
+    const auto& cond_values = checked_cast<const BooleanArray&>(cond);
+    ArrayVector slices;
+    for (int64_t i = 0; i < cond.length(); ++i) {
+      if (cond.IsNull(i)) {
+        slices.push_back(*MakeArrayOfNull(left.type(), 1));
+      } else {
+        slices.push_back((cond_values.Value(i) ? left : right).Slice(i, 1));
+      }
+    }
+    return Concat(slices);
+  }
+
+  std::shared_ptr<Array> NaiveCoalesce(const ArrayVector& values) {
+    ArrayVector slices;
+    for (int64_t i = 0; i < values[0]->length(); ++i) {
+      auto slice = values.back()->Slice(i, 1);
+      for (const auto& value : values) {
+        if (value->IsValid(i)) {
+          slice = value->Slice(i, 1);
+          break;
+        }
+      }
+      slices.push_back(slice);
+    }
+    return Concat(slices);
+  }
+
+  // Conditions mixing words that are all true, all false and mixed
+  std::shared_ptr<Array> RandomCondition(int64_t length, double null_probability) {
+    auto rand = random::RandomArrayGenerator(0x3f8e7a);
+    const int64_t run = length / 4;
+    return Concat({rand.Boolean(run, 1.0, null_probability),
+                   rand.Boolean(run, 0.0, null_probability),
+                   rand.Boolean(length - 2 * run, 0.5, null_probability)});
+  }
+
+  void CheckIfElse(const std::shared_ptr<Array>& left,
+                   const std::shared_ptr<Array>& right) {
+    for (auto null_probability : {0.0, 0.2}) {
+      auto cond = RandomCondition(left->length() + 3, null_probability)->Slice(3);
+      Datum out;
+      ASSERT_OK(IfElse(&ctx_, cond, left, right, &out));
+      ASSERT_OK(out.make_array()->ValidateFull());
+      AssertArraysEqual(*NaiveIfElse(*cond, *left, *right), *out.make_array());
+    }
+  }
+
+  void CheckIfElseScalar(const std::shared_ptr<Array>& values,
+                         const std::shared_ptr<Scalar>& scalar) {
+    auto cond = RandomCondition(values->length(), 0.1);
+    ASSERT_OK_AND_ASSIGN(auto broadcast, MakeArrayFromScalar(*scalar, values->length()));
+    Datum out;
+    ASSERT_OK(IfElse(&ctx_, cond, values, scalar, &out));
+    ASSERT_OK(out.make_array()->ValidateFull());
+    AssertArraysEqual(*NaiveIfElse(*cond, *values, *broadcast), *out.make_array());
+    ASSERT_OK(IfElse(&ctx_, cond, scalar, values, &out));
+    ASSERT_OK(out.make_array()->ValidateFull());
+    AssertArraysEqual(*NaiveIfElse(*cond, *broadcast, *values), *out.make_array());
+  }
+
+  void CheckCoalesce(const ArrayVector& values) {
+    std::vector<Datum> datums(values.begin(), values.end());
+    Datum out;
+    ASSERT_OK(Coalesce(&ctx_, datums, &out));
+    ASSERT_OK(out.make_array()->ValidateFull());
+    AssertArraysEqual(*NaiveCoalesce(values), *out.make_array());
+  }
+
+  void CheckRandom(const std::function<std::shared_ptr<Array>(double)>& make_values) {
+    const auto left = make_values(0.1);
+    const auto right = make_values(0.3);
+    CheckIfElse(left, right);
+    const int64_t sliced_length = length_ - 10;
+    CheckIfElse(left->Slice(5, sliced_length), right->Slice(7, sliced_length));
+    CheckCoalesce({left, right});
+    CheckCoalesce({make_values(0.5), make_values(0.5), make_values(0.0)});
+    CheckCoalesce({make_values(1.0)->Slice(3, sliced_length),
+                   left->Slice(1, sliced_length), right->Slice(2, sliced_length)});
+  }
+
+  random::RandomArrayGenerator rand_{0x7a1c3e};
+  const int64_t length_ = 500;
+};
+
+TEST_F(TestConditional, IfElseBasics) {
+  auto cond = ArrayFromJSON(boolean(), "[true, false, null, true]");
+  auto left = ArrayFromJSON(int32(), "[1, 2, 3, null]");
+  auto right = ArrayFromJSON(int32(), "[5, null, 7, 8]");
+  Datum out;
+  ASSERT_OK(IfElse(&ctx_, cond, left, right, &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, null, null, null]"), *out.make_array());
+
+  ASSERT_OK(IfElse(&ctx_, cond, left, Datum(int32_t(0)), &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 0, null, null]"), *out.make_array());
+
+  ASSERT_OK(IfElse(&ctx_, ArrayFromJSON(boolean(), "[]"), ArrayFromJSON(utf8(), "[]"),
+                   ArrayFromJSON(utf8(), "[]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), "[]"), *out.make_array());
+}
+
+TEST_F(TestConditional, IfElseInvalid) {
+  auto cond = ArrayFromJSON(boolean(), "[true, false]");
+  Datum out;
+  ASSERT_RAISES(Invalid, IfElse(&ctx_, ArrayFromJSON(int8(), "[1, 0]"),
+                                ArrayFromJSON(int8(), "[1, 2]"),
+                                ArrayFromJSON(int8(), "[3, 4]"), &out));
+  ASSERT_RAISES(Invalid, IfElse(&ctx_, cond, ArrayFromJSON(int8(), "[1]"),
+                                ArrayFromJSON(int8(), "[3, 4]"), &out));
+  ASSERT_RAISES(TypeError, IfElse(&ctx_, cond, ArrayFromJSON(int8(), "[1, 2]"),
+                                  ArrayFromJSON(int16(), "[3, 4]"), &out));
+}
+
+TEST_F(TestConditional, Numeric) {
+  CheckRandom([&](double p) { return rand_.Int8(length_, -100, 100, p); });
+  CheckRandom([&](double p) { return rand_.UInt16(length_, 0, 1000, p); });
+  CheckRandom([&](double p) { return rand_.Int32(length_, -1000, 1000, p); });
+  CheckRandom([&](double p) { return rand_.Int64(length_, -1000, 1000, p); });
+  CheckRandom([&](double p) { return rand_.Float64(length_, -1, 1, p); });
+
+  auto values = rand_.Int64(length_, -1000, 1000, 0.2);
+  CheckIfElseScalar(values, std::make_shared<Int64Scalar>(42));
+  CheckIfElseScalar(values, MakeNullScalar(int64()));
+}
+
+TEST_F(TestConditional, Boolean) {
+  CheckRandom([&](double p) { return rand_.Boolean(length_, 0.5, p); });
+  CheckIfElseScalar(rand_.Boolean(length_, 0.5, 0.2),
+                    std::make_shared<BooleanScalar>(true));
+}
+
+TEST_F(TestConditional, FixedSizeBinary) {
+  // Not a machine word width
+  auto type = fixed_size_binary(3);
+  CheckRandom([&](double p) {
+    auto bytes = rand_.UInt8(length_ * 3, 0, 255, 0.0);
+    auto null_bitmap = checked_cast<const BooleanArray&>(*rand_.Boolean(length_, 1 - p))
+                           .values();
+    return std::make_shared<FixedSizeBinaryArray>(type, length_,
+                                                  bytes->data()->buffers[1], null_bitmap);
+  });
+}
+
+TEST_F(TestConditional, String) {
+  CheckRandom([&](double p) { return rand_.String(length_, 0, 10, p); });
+  CheckRandom([&](double p) { return rand_.LargeString(length_, 0, 10, p); });
+  CheckIfElseScalar(rand_.String(length_, 0, 10, 0.2),
+                    std::make_shared<StringScalar>("fill"));
+}
+
+TEST_F(TestConditional, CoalesceBasics) {
+  Datum out;
+  ASSERT_OK(Coalesce(&ctx_,
+                     {ArrayFromJSON(int32(), "[1, null, null, null]"),
+                      ArrayFromJSON(int32(), "[null, 2, null, null]"),
+                      Datum(std::make_shared<Int32Scalar>())},
+                     &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, null, null]"), *out.make_array());
+
+  ASSERT_OK(Coalesce(&ctx_,
+                     {ArrayFromJSON(utf8(), R"([null, "b", null])"),
+                      Datum(std::make_shared<StringScalar>("z"))},
+                     &out));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["z", "b", "z"])"), *out.make_array());
+
+  // The first values without nulls are the output
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_OK(Coalesce(&ctx_, {values, ArrayFromJSON(int32(), "[3, 4]")}, &out));
+  ASSERT_EQ(values->data(), out.array());
+
+  ASSERT_OK(Coalesce(&ctx_,
+                     {Datum(std::make_shared<Int32Scalar>(7)),
+                      ArrayFromJSON(int32(), "[null, 1]")},
+                     &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[7, 7]"), *out.make_array());
+
+  ASSERT_RAISES(Invalid, Coalesce(&ctx_, {Datum(std::make_shared<Int32Scalar>(7))},
+                                  &out));
+  ASSERT_RAISES(TypeError, Coalesce(&ctx_,
+                                    {ArrayFromJSON(int32(), "[null, 1]"),
+                                     ArrayFromJSON(int64(), "[1, 1]")},
+                                    &out));
+}
+
+TEST_F(TestConditional, FillNull) {
+  Datum out;
+  ASSERT_OK(FillNull(&ctx_, ArrayFromJSON(int32(), "[1, null, 3, null]"),
+                     Datum(int32_t(0)), &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 0, 3, 0]"), *out.make_array());
+
+  ASSERT_OK(FillNull(&ctx_, ArrayFromJSON(boolean(), "[true, null, false]"),
+                     Datum(true), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true, false]"),
+                    *out.make_array());
+
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["a", null])"),
+                  ArrayFromJSON(utf8(), R"([null, null, "d"])")});
+  ASSERT_OK(FillNull(&ctx_, chunked, Datum(std::make_shared<StringScalar>("")), &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  AssertChunkedEqual(ChunkedArray({ArrayFromJSON(utf8(), R"(["a", ""])"),
+                                   ArrayFromJSON(utf8(), R"(["", "", "d"])")}),
+                     *out.chunked_array());
+
+  auto values = rand_.Float64(length_, -1, 1, 0.3);
+  ASSERT_OK(FillNull(&ctx_, values, Datum(2.0), &out));
+  ASSERT_EQ(out.make_array()->null_count(), 0);
+  ASSERT_OK_AND_ASSIGN(auto fill, MakeArrayFromScalar(DoubleScalar(2.0), length_));
+  AssertArraysEqual(*NaiveCoalesce({values, fill}), *out.make_array());
+
+  ASSERT_RAISES(Invalid, FillNull(&ctx_, values, values, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
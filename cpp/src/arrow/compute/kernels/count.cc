@@ -91,8 +91,8 @@ class CountAggregateFunction final : public AggregateFunctionStaticState<CountSt
   CountOptions options_;
 };
 
-std::shared_ptr<AggregateFunction> MakeCountAggregateFunction(
-    FunctionContext* context, const CountOptions& options) {
+std::shared_ptr<AggregateFunction> MakeCount(FunctionContext* context,
+                                             const CountOptions& options) {
   return std::make_shared<CountAggregateFunction>(options);
 }
 
@@ -100,7 +100,7 @@ Status Count(FunctionContext* context, const CountOptions& options, const Datum&
              Datum* out) {
   if (!value.is_array()) return Status::Invalid("Count is expecting an array datum.");
 
-  auto aggregate = MakeCountAggregateFunction(context, options);
+  auto aggregate = MakeCount(context, options);
   auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
 
   return kernel->Call(context, value, out);
@@ -0,0 +1,185 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/decimal.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+constexpr int64_t kDecimalSize = 16;
+
+// Decimals with values up to 10^6 scaled by a factor, so that those of a
+// precision beyond 18 don't fit in 64 bits
+static std::shared_ptr<Array> MakeDecimals(int64_t length, int32_t precision,
+                                           int32_t scale, double null_probability,
+                                           int64_t seed) {
+  auto rand = random::RandomArrayGenerator(seed);
+  auto integers = std::static_pointer_cast<Int64Array>(
+      rand.Int64(length, -1000000, 1000000, null_probability));
+  const Decimal128 factor = precision > 18 ? Decimal128("1e20") : Decimal128(1);
+
+  Decimal128Builder builder(decimal(precision, scale));
+  ABORT_NOT_OK(builder.Reserve(length));
+  for (int64_t i = 0; i < length; ++i) {
+    if (integers->IsNull(i)) {
+      builder.UnsafeAppendNull();
+    } else {
+      builder.UnsafeAppend(Decimal128(integers->Value(i)) * factor);
+    }
+  }
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return out;
+}
+
+static void DecimalArithmetic(benchmark::State& state, ArithmeticOperator op,
+                              int32_t precision) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / kDecimalSize;
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  // The right operand has a lower scale, so that it is rescaled for additions
+  auto left = MakeDecimals(array_size, precision, 2, null_percent, kSeed);
+  auto right = MakeDecimals(array_size, precision - 1, 1, null_percent, kSeed + 1);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Arithmetic(&ctx, op, Datum(left), Datum(right),
+                            ArithmeticOptions::Defaults(), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * kDecimalSize * 2);
+}
+
+static void DecimalCompareArrayArray(benchmark::State& state, int32_t precision) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / kDecimalSize;
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto lhs = MakeDecimals(array_size, precision, 2, null_percent, kSeed);
+  auto rhs = MakeDecimals(array_size, precision, 2, null_percent, kSeed + 1);
+
+  CompareOptions ge(GREATER_EQUAL);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Compare(&ctx, Datum(lhs), Datum(rhs), ge, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * kDecimalSize * 2);
+}
+
+// Values of scale 2 rescaled to out_scale, with as many more digits of
+// precision as needed
+static void DecimalRescale(benchmark::State& state, int32_t precision,
+                           int32_t out_scale) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / kDecimalSize;
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto values = MakeDecimals(array_size, precision, 2, null_percent, kSeed);
+  const int32_t out_precision = std::min(precision + std::max(out_scale - 2, 0), 38);
+  auto out_type = decimal(out_precision, out_scale);
+
+  CastOptions options;
+  options.allow_decimal_truncate = true;
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Cast(&ctx, *values, out_type, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * kDecimalSize);
+}
+
+static void DecimalAdd18(benchmark::State& state) { DecimalArithmetic(state, ADD, 18); }
+
+static void DecimalAdd38(benchmark::State& state) { DecimalArithmetic(state, ADD, 38); }
+
+static void DecimalSubtract18(benchmark::State& state) {
+  DecimalArithmetic(state, SUBTRACT, 18);
+}
+
+static void DecimalSubtract38(benchmark::State& state) {
+  DecimalArithmetic(state, SUBTRACT, 38);
+}
+
+static void DecimalMultiply9(benchmark::State& state) {
+  DecimalArithmetic(state, MULTIPLY, 9);
+}
+
+static void DecimalMultiply38(benchmark::State& state) {
+  DecimalArithmetic(state, MULTIPLY, 38);
+}
+
+static void DecimalCompare18(benchmark::State& state) {
+  DecimalCompareArrayArray(state, 18);
+}
+
+static void DecimalCompare38(benchmark::State& state) {
+  DecimalCompareArrayArray(state, 38);
+}
+
+static void DecimalUpscale16(benchmark::State& state) { DecimalRescale(state, 16, 4); }
+
+static void DecimalUpscale36(benchmark::State& state) { DecimalRescale(state, 36, 4); }
+
+static void DecimalDownscale18(benchmark::State& state) { DecimalRescale(state, 18, 0); }
+
+static void DecimalDownscale38(benchmark::State& state) { DecimalRescale(state, 38, 0); }
+
+BENCHMARK(DecimalAdd18)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalAdd38)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalSubtract18)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalSubtract38)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalMultiply9)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalMultiply38)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalCompare18)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalCompare38)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalUpscale16)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalUpscale36)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalDownscale18)->Apply(RegressionSetArgs);
+BENCHMARK(DecimalDownscale38)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/decimal_internal.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include "arrow/array.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace detail {
+
+namespace {
+
+// Data loss is looked for once per block of values, so that the loop over the
+// values of a block has no early exit
+constexpr int64_t kBlockSize = 256;
+
+constexpr int64_t kInt64PowersOfTen[] = {1LL,
+                                         10LL,
+                                         100LL,
+                                         1000LL,
+                                         10000LL,
+                                         100000LL,
+                                         1000000LL,
+                                         10000000LL,
+                                         100000000LL,
+                                         1000000000LL,
+                                         10000000000LL,
+                                         100000000000LL,
+                                         1000000000000LL,
+                                         10000000000000LL,
+                                         100000000000000LL,
+                                         1000000000000000LL,
+                                         10000000000000000LL,
+                                         100000000000000000LL,
+                                         1000000000000000000LL};
+
+constexpr int32_t kMaxInt64Exponent = 18;
+
+// Whether the value of slot i is valid, valid_bits being null if all are
+class ValidityChecker {
+ public:
+  explicit ValidityChecker(const ArrayData& data)
+      : valid_bits_(data.GetNullCount() == 0 ? NULLPTR : data.buffers[0]->data()),
+        offset_(data.offset) {}
+
+  bool IsValid(int64_t i) const {
+    return valid_bits_ == NULLPTR || BitUtil::GetBit(valid_bits_, offset_ + i);
+  }
+
+ private:
+  const uint8_t* valid_bits_;
+  int64_t offset_;
+};
+
+Status DataLoss() {
+  return Status::Invalid("Rescaling decimal value would cause data loss");
+}
+
+Status Upscale(const ArrayData& input, int32_t delta_scale, bool check_data_loss,
+               DecimalWords* out) {
+  const DecimalWords* values = input.GetValues<DecimalWords>(1);
+  const int32_t precision = checked_cast<const Decimal128Type&>(*input.type).precision();
+  const BasicDecimal128& multiplier = BasicDecimal128::GetScaleMultiplier(delta_scale);
+  // The largest magnitude which can be scaled up without exceeding 128 bits
+  const BasicDecimal128 max_value =
+      BasicDecimal128(std::numeric_limits<int64_t>::max(),
+                      std::numeric_limits<uint64_t>::max()) /
+      multiplier;
+  BasicDecimal128 min_value = max_value;
+  min_value.Negate();
+  auto loses_data = [&](DecimalWords value) {
+    const BasicDecimal128 decimal = ToBasicDecimal(value);
+    return decimal > max_value || decimal < min_value;
+  };
+
+  const bool try_int64 = precision + delta_scale <= kMaxInt64Exponent;
+  const int64_t factor = try_int64 ? kInt64PowersOfTen[delta_scale] : 1;
+  const int64_t max_int64 = std::numeric_limits<int64_t>::max() / factor;
+
+  const ValidityChecker validity(input);
+  for (int64_t start = 0; start < input.length; start += kBlockSize) {
+    const int64_t end = std::min(input.length, start + kBlockSize);
+    bool slow = !try_int64;
+    if (try_int64) {
+      for (int64_t i = start; i < end; ++i) {
+        const auto value = static_cast<int64_t>(values[i].low);
+        out[i] = DecimalWordsFromInt64(
+            static_cast<int64_t>(static_cast<uint64_t>(value) * factor));
+        slow |= !FitsInInt64(values[i]) | (value > max_int64) | (value < -max_int64);
+      }
+    }
+    if (ARROW_PREDICT_FALSE(slow)) {
+      bool lost = false;
+      for (int64_t i = start; i < end; ++i) {
+        out[i] = FromBasicDecimal(ToBasicDecimal(values[i]) * multiplier);
+        lost |= loses_data(values[i]);
+      }
+      if (check_data_loss && lost) {
+        for (int64_t i = start; i < end; ++i) {
+          if (validity.IsValid(i) && loses_data(values[i])) {
+            return DataLoss();
+          }
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status Downscale(const ArrayData& input, int32_t delta_scale, bool check_data_loss,
+                 DecimalWords* out) {
+  const DecimalWords* values = input.GetValues<DecimalWords>(1);
+  const int32_t precision = checked_cast<const Decimal128Type&>(*input.type).precision();
+  const BasicDecimal128& divisor = BasicDecimal128::GetScaleMultiplier(delta_scale);
+  auto loses_data = [&](DecimalWords value) {
+    return ToBasicDecimal(value) % divisor != 0;
+  };
+
+  const bool try_int64 =
+      precision <= kMaxInt64Exponent && delta_scale <= kMaxInt64Exponent;
+  const int64_t int64_divisor = try_int64 ? kInt64PowersOfTen[delta_scale] : 1;
+
+  const ValidityChecker validity(input);
+  for (int64_t start = 0; start < input.length; start += kBlockSize) {
+    const int64_t end = std::min(input.length, start + kBlockSize);
+    bool slow = !try_int64;
+    bool lost = false;
+    if (try_int64) {
+      for (int64_t i = start; i < end; ++i) {
+        const auto value = static_cast<int64_t>(values[i].low);
+        const int64_t quotient = value / int64_divisor;
+        out[i] = DecimalWordsFromInt64(quotient);
+        slow |= !FitsInInt64(values[i]);
+        lost |= quotient * int64_divisor != value;
+      }
+    }
+    if (ARROW_PREDICT_FALSE(slow)) {
+      lost = false;
+      for (int64_t i = start; i < end; ++i) {
+        BasicDecimal128 quotient, remainder;
+        ToBasicDecimal(values[i]).Divide(divisor, &quotient, &remainder);
+        out[i] = FromBasicDecimal(quotient);
+        lost |= remainder != 0;
+      }
+    }
+    if (check_data_loss && ARROW_PREDICT_FALSE(lost)) {
+      for (int64_t i = start; i < end; ++i) {
+        if (validity.IsValid(i) && loses_data(values[i])) {
+          return DataLoss();
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+int64_t Int64PowerOfTen(int32_t exponent) {
+  DCHECK_GE(exponent, 0);
+  DCHECK_LE(exponent, kMaxInt64Exponent);
+  return kInt64PowersOfTen[exponent];
+}
+
+Status RescaleDecimals(const ArrayData& input, int32_t delta_scale, bool check_data_loss,
+                       DecimalWords* out) {
+  if (std::abs(delta_scale) > 38) {
+    return Status::Invalid("Cannot rescale decimals by more than 38 digits, got ",
+                           delta_scale);
+  }
+  if (delta_scale == 0) {
+    if (input.length > 0) {
+      std::memcpy(out, input.GetValues<DecimalWords>(1),
+                  static_cast<size_t>(input.length) * sizeof(DecimalWords));
+    }
+    return Status::OK();
+  }
+  if (delta_scale > 0) {
+    return Upscale(input, delta_scale, check_data_loss, out);
+  }
+  return Downscale(input, -delta_scale, check_data_loss, out);
+}
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/status.h"
+#include "arrow/util/basic_decimal.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+struct ArrayData;
+
+namespace compute {
+namespace detail {
+
+// A Decimal128 value as laid out in the value buffer of a Decimal128Array, on
+// little-endian platforms.  Kernels read and write the buffer as an array of
+// these rather than constructing a Decimal128 from the bytes of each value.
+struct DecimalWords {
+  uint64_t low;
+  int64_t high;
+};
+
+static_assert(sizeof(DecimalWords) == 16, "DecimalWords must have no padding");
+
+inline DecimalWords DecimalWordsFromInt64(int64_t value) {
+  return {static_cast<uint64_t>(value), value >> 63};
+}
+
+// Whether the value is the sign extension of its low word, so that arithmetic
+// on it can be done in 64 bits
+inline bool FitsInInt64(DecimalWords value) {
+  return value.high == (static_cast<int64_t>(value.low) >> 63);
+}
+
+inline BasicDecimal128 ToBasicDecimal(DecimalWords value) {
+  return BasicDecimal128(value.high, value.low);
+}
+
+inline DecimalWords FromBasicDecimal(const BasicDecimal128& value) {
+  return {value.low_bits(), value.high_bits()};
+}
+
+// The comparisons and the additions have no branches, unlike those of
+// BasicDecimal128, so that loops of them are vectorized
+
+inline bool operator==(DecimalWords left, DecimalWords right) {
+  return ((left.low ^ right.low) | static_cast<uint64_t>(left.high ^ right.high)) == 0;
+}
+
+inline bool operator!=(DecimalWords left, DecimalWords right) {
+  return !(left == right);
+}
+
+inline bool operator<(DecimalWords left, DecimalWords right) {
+  return (left.high < right.high) | ((left.high == right.high) & (left.low < right.low));
+}
+
+inline bool operator>(DecimalWords left, DecimalWords right) { return right < left; }
+
+inline bool operator<=(DecimalWords left, DecimalWords right) {
+  return !(right < left);
+}
+
+inline bool operator>=(DecimalWords left, DecimalWords right) {
+  return !(left < right);
+}
+
+// Two's complement sum and difference, wrapping around on overflow
+inline DecimalWords WrappingAdd(DecimalWords left, DecimalWords right) {
+  const uint64_t low = left.low + right.low;
+  const uint64_t carry = low < left.low;
+  return {low, static_cast<int64_t>(static_cast<uint64_t>(left.high) +
+                                    static_cast<uint64_t>(right.high) + carry)};
+}
+
+inline DecimalWords WrappingSubtract(DecimalWords left, DecimalWords right) {
+  const uint64_t low = left.low - right.low;
+  const uint64_t borrow = left.low < right.low;
+  return {low, static_cast<int64_t>(static_cast<uint64_t>(left.high) -
+                                    static_cast<uint64_t>(right.high) - borrow)};
+}
+
+/// \brief 10 to the power of exponent, from 0 to 18
+ARROW_EXPORT
+int64_t Int64PowerOfTen(int32_t exponent);
+
+/// \brief Multiply or divide the values of a Decimal128 array by a power of
+/// ten, as for converting them to a scale differing by delta_scale
+///
+/// Values are scaled down by truncating towards zero.  If check_data_loss,
+/// scaling a non-null value down with a non-zero remainder, or up beyond 128
+/// bits, is an error.  Otherwise values scaled up wrap around.
+///
+/// Blocks of values which fit in 64 bits, as all values of decimals with a
+/// precision up to 18 do, are rescaled with 64-bit arithmetic.
+///
+/// \param[in] input the Decimal128 array data
+/// \param[in] delta_scale the difference of the output scale with the input's,
+///            from -38 to 38
+/// \param[in] check_data_loss whether to report data loss as an error
+/// \param[out] out where to write input.length values
+ARROW_EXPORT
+Status RescaleDecimals(const ArrayData& input, int32_t delta_scale, bool check_data_loss,
+                       DecimalWords* out);
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
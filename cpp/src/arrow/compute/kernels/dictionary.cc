@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/kernels/dictionary.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+bool HaveSameDictionary(const ChunkedArray& array) {
+  const auto& dictionary0 =
+      checked_cast<const DictionaryArray&>(*array.chunk(0)).dictionary();
+  for (const auto& chunk : array.chunks()) {
+    const auto& dictionary = checked_cast<const DictionaryArray&>(*chunk).dictionary();
+    if (dictionary != dictionary0 && !dictionary->Equals(*dictionary0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+Status UnifyDictionaries(FunctionContext* ctx, const std::shared_ptr<ChunkedArray>& array,
+                         bool use_threads, std::shared_ptr<ChunkedArray>* out) {
+  if (array->type()->id() != Type::DICTIONARY) {
+    return Status::TypeError("UnifyDictionaries expects a dictionary type, got ",
+                             *array->type());
+  }
+  if (array->num_chunks() <= 1 || HaveSameDictionary(*array)) {
+    *out = array;
+    return Status::OK();
+  }
+
+  // Build the unified dictionary, in chunk order
+  const auto& dict_type = checked_cast<const DictionaryType&>(*array->type());
+  ARROW_ASSIGN_OR_RAISE(auto unifier, DictionaryUnifier::Make(dict_type.value_type(),
+                                                              ctx->memory_pool()));
+  const int num_chunks = array->num_chunks();
+  std::vector<std::shared_ptr<Buffer>> transpose_maps(num_chunks);
+  for (int i = 0; i < num_chunks; ++i) {
+    const auto& chunk = checked_cast<const DictionaryArray&>(*array->chunk(i));
+    RETURN_NOT_OK(unifier->Unify(*chunk.dictionary(), &transpose_maps[i]));
+  }
+  std::shared_ptr<DataType> unified_type;
+  std::shared_ptr<Array> dictionary;
+  RETURN_NOT_OK(unifier->GetResult(&unified_type, &dictionary));
+
+  const auto& index_type =
+      checked_cast<const FixedWidthType&>(*dict_type.index_type());
+  const int64_t max_index =
+      (static_cast<uint64_t>(1) << (index_type.bit_width() - 1)) - 1;
+  if (dictionary->length() - 1 > max_index) {
+    return Status::CapacityError("Unified dictionary of ", dictionary->length(),
+                                 " values does not fit index type ",
+                                 *dict_type.index_type());
+  }
+
+  // Transpose the indices of the chunks, which are independent of each other
+  ArrayVector chunks(num_chunks);
+  RETURN_NOT_OK(internal::OptionalParallelFor(use_threads, num_chunks, [&](int i) {
+    const auto& chunk = checked_cast<const DictionaryArray&>(*array->chunk(i));
+    return chunk
+        .Transpose(array->type(), dictionary,
+                   reinterpret_cast<const int32_t*>(transpose_maps[i]->data()),
+                   ctx->memory_pool())
+        .Value(&chunks[i]);
+  }));
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), array->type());
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Give all the chunks of a dictionary-encoded ChunkedArray the same
+/// dictionary
+///
+/// The dictionaries of the chunks are unified sequentially, in chunk order,
+/// then the indices of each chunk are transposed to the unified dictionary.
+/// The chunks keep their index type, and those already indexing into a prefix
+/// of the unified dictionary (e.g. the first chunk) keep their index buffers.
+/// If all the chunks already share a dictionary, `array` is returned as is.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] array a ChunkedArray of dictionary type
+/// \param[in] use_threads whether to transpose the chunks in parallel
+/// \param[out] out the ChunkedArray with a single dictionary
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status UnifyDictionaries(FunctionContext* ctx, const std::shared_ptr<ChunkedArray>& array,
+                         bool use_threads, std::shared_ptr<ChunkedArray>* out);
+
+}  // namespace compute
+}  // namespace arrow
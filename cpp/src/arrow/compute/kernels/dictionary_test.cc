@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/dictionary.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestUnifyDictionaries : public ComputeFixture, public TestBase {
+ public:
+  std::shared_ptr<Array> MakeChunk(const std::shared_ptr<DataType>& type,
+                                   const std::string& indices_json,
+                                   const std::string& dictionary_json) {
+    const auto& dict_type = checked_cast<const DictionaryType&>(*type);
+    return *DictionaryArray::FromArrays(
+        type, ArrayFromJSON(dict_type.index_type(), indices_json),
+        ArrayFromJSON(dict_type.value_type(), dictionary_json));
+  }
+};
+
+TEST_F(TestUnifyDictionaries, Basics) {
+  auto type = dictionary(int16(), utf8());
+  auto array = std::make_shared<ChunkedArray>(
+      ArrayVector{MakeChunk(type, "[0, 1, null, 1]", R"(["a", "b"])"),
+                  MakeChunk(type, "[1, 0, 0]", R"(["c", "b"])"),
+                  MakeChunk(type, "[]", R"(["e"])"),
+                  MakeChunk(type, "[null, 2, 1, 0]", R"(["b", "d", "a"])")});
+
+  for (bool use_threads : {false, true}) {
+    std::shared_ptr<ChunkedArray> unified;
+    ASSERT_OK(UnifyDictionaries(&ctx_, array, use_threads, &unified));
+    ASSERT_OK(unified->ValidateFull());
+    ASSERT_TRUE(unified->type()->Equals(*type));
+    ASSERT_EQ(array->num_chunks(), unified->num_chunks());
+
+    auto expected_dictionary = ArrayFromJSON(utf8(), R"(["a", "b", "c", "e", "d"])");
+    std::vector<std::string> expected_indices = {"[0, 1, null, 1]", "[1, 2, 2]", "[]",
+                                                 "[null, 0, 4, 1]"};
+    const auto& first_chunk = checked_cast<const DictionaryArray&>(*unified->chunk(0));
+    for (int i = 0; i < unified->num_chunks(); ++i) {
+      const auto& chunk = checked_cast<const DictionaryArray&>(*unified->chunk(i));
+      AssertArraysEqual(*expected_dictionary, *chunk.dictionary());
+      AssertArraysEqual(*ArrayFromJSON(int16(), expected_indices[i]), *chunk.indices());
+      // All the chunks share the same dictionary
+      ASSERT_EQ(first_chunk.dictionary(), chunk.dictionary());
+    }
+
+    // The first chunk keeps its index buffer
+    const auto& input_chunk = checked_cast<const DictionaryArray&>(*array->chunk(0));
+    ASSERT_EQ(input_chunk.indices()->data()->buffers[1],
+              first_chunk.indices()->data()->buffers[1]);
+  }
+}
+
+TEST_F(TestUnifyDictionaries, SameDictionary) {
+  auto type = dictionary(int8(), int32());
+  auto array = std::make_shared<ChunkedArray>(ArrayVector{
+      MakeChunk(type, "[0, 1]", "[5, 6]"), MakeChunk(type, "[1, null]", "[5, 6]")});
+
+  std::shared_ptr<ChunkedArray> unified;
+  ASSERT_OK(UnifyDictionaries(&ctx_, array, /*use_threads=*/true, &unified));
+  ASSERT_EQ(array, unified);
+
+  auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, type);
+  ASSERT_OK(UnifyDictionaries(&ctx_, empty, /*use_threads=*/true, &unified));
+  ASSERT_EQ(empty, unified);
+}
+
+TEST_F(TestUnifyDictionaries, IndexOverflow) {
+  auto type = dictionary(int8(), int32());
+  std::string first = "[", second = "[";
+  for (int i = 0; i < 100; ++i) {
+    first += (i ? ", " : "") + std::to_string(i);
+    second += (i ? ", " : "") + std::to_string(i + 100);
+  }
+  first += "]";
+  second += "]";
+  auto array = std::make_shared<ChunkedArray>(
+      ArrayVector{MakeChunk(type, "[0]", first), MakeChunk(type, "[0]", second)});
+
+  std::shared_ptr<ChunkedArray> unified;
+  ASSERT_RAISES(CapacityError,
+                UnifyDictionaries(&ctx_, array, /*use_threads=*/false, &unified));
+}
+
+TEST_F(TestUnifyDictionaries, NotDictionary) {
+  auto array = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[1]"), ArrayFromJSON(int32(), "[2]")});
+  std::shared_ptr<ChunkedArray> unified;
+  ASSERT_RAISES(TypeError,
+                UnifyDictionaries(&ctx_, array, /*use_threads=*/false, &unified));
+}
+
+}  // namespace compute
+}  // namespace arrow
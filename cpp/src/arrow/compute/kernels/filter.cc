@@ -17,7 +17,10 @@
 
 #include "arrow/compute/kernels/filter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -27,8 +30,10 @@
 #include "arrow/compute/kernels/take_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace compute {
@@ -185,14 +190,164 @@ Status FilterKernel::Call(FunctionContext* ctx, const Datum& values, const Datum
   return Status::OK();
 }
 
+// Write the positions of set bits in a bitmap (starting at bit 0) a word at a time,
+// so that runs of unselected values are skipped and fully selected words copied
+// without examining individual bits
+template <typename IndexCType>
+static void WriteSetBitPositions(const uint8_t* bitmap, int64_t length,
+                                 IndexCType* out) {
+  for (int64_t base = 0; base < length; base += 64) {
+    const int64_t num_bits = std::min<int64_t>(64, length - base);
+    uint64_t word = 0;
+    std::memcpy(&word, bitmap + base / 8, BitUtil::BytesForBits(num_bits));
+    word = BitUtil::FromLittleEndian(word);
+    if (num_bits < 64) {
+      word &= (uint64_t(1) << num_bits) - 1;
+    }
+
+    if (word == ~uint64_t(0)) {
+      for (int64_t i = 0; i < 64; ++i) {
+        *out++ = static_cast<IndexCType>(base + i);
+      }
+      continue;
+    }
+    while (word != 0) {
+      *out++ = static_cast<IndexCType>(base + BitUtil::CountTrailingZeros(word));
+      word &= word - 1;
+    }
+  }
+}
+
+template <typename IndexType>
+static Status FilterToIndices(FunctionContext* ctx, const BooleanArray& filter,
+                              FilterOptions options, std::shared_ptr<Array>* out) {
+  using IndexCType = typename IndexType::c_type;
+
+  MemoryPool* pool = ctx->memory_pool();
+  const int64_t length = filter.length();
+  const int64_t offset = filter.offset();
+  const uint8_t* values = filter.values()->data();
+  const bool emit_null =
+      options.null_selection_behavior == FilterOptions::EMIT_NULL &&
+      filter.null_count() > 0;
+
+  // bitmap of the filter positions which produce an output slot
+  std::shared_ptr<Buffer> selected;
+  const uint8_t* validity = filter.null_bitmap_data();
+  if (filter.null_count() == 0) {
+    ARROW_ASSIGN_OR_RAISE(selected, internal::CopyBitmap(pool, values, offset, length));
+  } else if (emit_null) {
+    ARROW_ASSIGN_OR_RAISE(auto nulls,
+                          internal::InvertBitmap(pool, validity, offset, length));
+    ARROW_ASSIGN_OR_RAISE(selected, internal::BitmapOr(pool, values, offset,
+                                                       nulls->data(), 0, length, 0));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(selected, internal::BitmapAnd(pool, values, offset, validity,
+                                                        offset, length, 0));
+  }
+
+  const int64_t out_length = internal::CountSetBits(selected->data(), 0, length);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                        AllocateBuffer(out_length * sizeof(IndexCType), pool));
+  auto raw_indices = reinterpret_cast<IndexCType*>(indices->mutable_data());
+  WriteSetBitPositions(selected->data(), length, raw_indices);
+
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count = 0;
+  if (emit_null) {
+    ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateEmptyBitmap(out_length, pool));
+    auto raw_null_bitmap = null_bitmap->mutable_data();
+    for (int64_t i = 0; i < out_length; ++i) {
+      if (filter.IsValid(raw_indices[i])) {
+        BitUtil::SetBit(raw_null_bitmap, i);
+      } else {
+        ++null_count;
+      }
+    }
+  }
+
+  *out = MakeArray(ArrayData::Make(TypeTraits<IndexType>::type_singleton(), out_length,
+                                   {std::move(null_bitmap), std::move(indices)},
+                                   null_count));
+  return Status::OK();
+}
+
+Status GetFilterIndices(FunctionContext* ctx, const BooleanArray& filter,
+                        FilterOptions options, std::shared_ptr<Array>* out) {
+  if (filter.length() <= std::numeric_limits<int32_t>::max()) {
+    return FilterToIndices<Int32Type>(ctx, filter, options, out);
+  }
+  return FilterToIndices<Int64Type>(ctx, filter, options, out);
+}
+
+// Gather values at indices produced by GetFilterIndices, which are always in bounds
+template <typename IndexType>
+static Status TakeFilterIndices(FunctionContext* ctx, const Array& values,
+                                const Array& indices, std::shared_ptr<Array>* out) {
+  if (values.null_count() == 0 && indices.null_count() == 0 &&
+      CanTakeFixedWidth(*values.type())) {
+    const auto& typed_indices = checked_cast<const NumericArray<IndexType>&>(indices);
+    return TakeFixedWidth(ctx->memory_pool(), values, typed_indices.raw_values(),
+                          typed_indices.length(), /*check_bounds=*/false, out);
+  }
+
+  std::unique_ptr<Taker<ArrayIndexSequence<IndexType>>> taker;
+  RETURN_NOT_OK(Taker<ArrayIndexSequence<IndexType>>::Make(values.type(), &taker));
+  RETURN_NOT_OK(taker->SetContext(ctx));
+
+  ArrayIndexSequence<IndexType> sequence(indices);
+  sequence.set_never_out_of_bounds();
+  RETURN_NOT_OK(taker->Take(values, sequence));
+  return taker->Finish(out);
+}
+
+static Status TakeFilterIndices(FunctionContext* ctx, const Array& values,
+                                const Array& indices, std::shared_ptr<Array>* out) {
+  if (indices.type_id() == Type::INT32) {
+    return TakeFilterIndices<Int32Type>(ctx, values, indices, out);
+  }
+  return TakeFilterIndices<Int64Type>(ctx, values, indices, out);
+}
+
 Status FilterTable(FunctionContext* ctx, const Table& table, const Datum& filter,
                    FilterOptions options, std::shared_ptr<Table>* out) {
-  auto new_columns = table.columns();
+  if (!filter.is_arraylike()) {
+    return Status::Invalid("Cannot filter a Table with a filter of kind ",
+                           filter.kind());
+  }
+  RETURN_NOT_OK(CheckFilterType(filter.type()));
+  RETURN_NOT_OK(CheckFilterValuesLengths(table.num_rows(), filter.length()));
+
+  // Columns are usually chunked identically, so the indices of each filter slice
+  // are computed once and shared between columns. Slices are keyed by their
+  // position in the filter.
+  std::map<std::pair<int64_t, int64_t>, std::shared_ptr<Array>> slice_indices;
+  auto filter_chunks = filter.chunks();
 
+  auto new_columns = table.columns();
   for (auto& column : new_columns) {
-    Datum out_column;
-    RETURN_NOT_OK(Filter(ctx, Datum(column), filter, options, &out_column));
-    column = out_column.chunked_array();
+    auto chunks = internal::RechunkArraysConsistently({column->chunks(), filter_chunks});
+    auto value_chunks = std::move(chunks[0]);
+    const auto& filter_slices = chunks[1];
+
+    int64_t position = 0;
+    std::vector<std::shared_ptr<Array>> out_chunks;
+    for (size_t i = 0; i < value_chunks.size(); ++i) {
+      const int64_t slice_length = filter_slices[i]->length();
+      auto& indices = slice_indices[std::make_pair(position, slice_length)];
+      position += slice_length;
+      if (indices == nullptr) {
+        RETURN_NOT_OK(GetFilterIndices(
+            ctx, checked_cast<const BooleanArray&>(*filter_slices[i]), options,
+            &indices));
+      }
+      if (indices->length() == 0) continue;
+
+      std::shared_ptr<Array> out_chunk;
+      RETURN_NOT_OK(TakeFilterIndices(ctx, *value_chunks[i], *indices, &out_chunk));
+      out_chunks.push_back(std::move(out_chunk));
+    }
+    column = std::make_shared<ChunkedArray>(std::move(out_chunks), column->type());
   }
 
   *out = Table::Make(table.schema(), std::move(new_columns));
@@ -203,27 +358,24 @@ Status FilterRecordBatch(FunctionContext* ctx, const RecordBatch& batch,
                          const Array& filter, FilterOptions options,
                          std::shared_ptr<RecordBatch>* out) {
   RETURN_NOT_OK(CheckFilterType(filter.type()));
-  const auto& filter_array = checked_cast<const BooleanArray&>(filter);
+  RETURN_NOT_OK(CheckFilterValuesLengths(batch.num_rows(), filter.length()));
 
-  std::vector<std::unique_ptr<FilterKernel>> kernels(batch.num_columns());
-  for (int i = 0; i < batch.num_columns(); ++i) {
-    RETURN_NOT_OK(
-        FilterKernel::Make(batch.schema()->field(i)->type(), options, &kernels[i]));
-  }
+  std::shared_ptr<Array> indices;
+  RETURN_NOT_OK(GetFilterIndices(ctx, checked_cast<const BooleanArray&>(filter), options,
+                                 &indices));
 
   std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
-  auto out_length = OutputSize(options, filter_array);
   for (int i = 0; i < batch.num_columns(); ++i) {
-    RETURN_NOT_OK(
-        kernels[i]->Filter(ctx, *batch.column(i), filter_array, out_length, &columns[i]));
+    RETURN_NOT_OK(TakeFilterIndices(ctx, *batch.column(i), *indices, &columns[i]));
   }
 
-  *out = RecordBatch::Make(batch.schema(), out_length, columns);
+  *out = RecordBatch::Make(batch.schema(), indices->length(), std::move(columns));
   return Status::OK();
 }
 
 Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter,
               FilterOptions options, Datum* out) {
+  ARROW_TRACE_SPAN("compute::Filter");
   if (values.kind() == Datum::RECORD_BATCH) {
     if (!filter.is_array()) {
       return Status::Invalid("Cannot filter a RecordBatch with a filter of kind ",
@@ -65,6 +65,27 @@ ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter,
               FilterOptions options, Datum* out);
 
+/// \brief Convert a boolean selection filter to the indices it selects
+///
+/// Taking the resulting indices from an array of the filter's length is
+/// equivalent to filtering it, so a filter applied to many arrays (for example
+/// the columns of a RecordBatch) only needs to be scanned once. The indices are
+/// int32 if the filter's length allows it and int64 otherwise. Nulls in the
+/// filter are dropped or yield null indices based on
+/// options.null_selection_behavior.
+///
+/// For example given filter = [0, 1, 1, 0, null, 1], the output will be
+/// (null_selection_behavior == DROP)      = [1, 2, 5]
+/// (null_selection_behavior == EMIT_NULL) = [1, 2, null, 5]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] filter indicates which values should be filtered out
+/// \param[in] options configures null_selection_behavior
+/// \param[out] out resulting indices
+ARROW_EXPORT
+Status GetFilterIndices(FunctionContext* ctx, const BooleanArray& filter,
+                        FilterOptions options, std::shared_ptr<Array>* out);
+
 /// \brief BinaryKernel implementing Filter operation
 class ARROW_EXPORT FilterKernel : public BinaryKernel {
  public:
@@ -17,6 +17,9 @@
 
 #include "benchmark/benchmark.h"
 
+#include <string>
+#include <vector>
+
 #include "arrow/compute/kernels/filter.h"
 
 #include "arrow/compute/benchmark_util.h"
@@ -95,6 +98,31 @@ static void FilterString(benchmark::State& state) {
   }
 }
 
+static void FilterRecordBatchInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  // the filter is shared by many narrow columns
+  const int num_columns = 200;
+  const int64_t num_rows = args.size / sizeof(int64_t) / num_columns;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < num_columns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int64()));
+    columns.push_back(rand.Int64(num_rows, -100, 100, args.null_proportion));
+  }
+  auto batch = RecordBatch::Make(schema(fields), num_rows, columns);
+  auto filter = rand.Boolean(num_rows, 0.75, args.null_proportion);
+
+  FilterOptions options;
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Filter(&ctx, Datum(batch), Datum(filter), options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
 BENCHMARK(FilterInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -109,6 +137,13 @@ BENCHMARK(FilterFixedSizeList1Int64)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(FilterRecordBatchInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 BENCHMARK(FilterString)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -33,6 +33,7 @@
 namespace arrow {
 namespace compute {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 using util::string_view;
 
@@ -584,6 +585,97 @@ TEST_F(TestFilterKernelWithRecordBatch, FilterRecordBatch) {
   ])");
 }
 
+TEST_F(TestFilterKernelWithRecordBatch, FilterRandomRecordBatch) {
+  // many columns sharing one filter, compared to filtering each column alone
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = 1000;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < 20; ++i) {
+    fields.push_back(field("f" + std::to_string(i), i % 2 ? utf8() : int64()));
+    columns.push_back(i % 2 ? rand.String(length, 0, 8, 0.1)
+                            : rand.Numeric<Int64Type>(length, -50, 50, 0.1));
+  }
+  auto batch = RecordBatch::Make(schema(fields), length, columns);
+
+  for (auto probability : {0.0, 0.01, 0.5, 0.99, 1.0}) {
+    auto filter = rand.Boolean(length, probability, 0.1);
+    for (auto options : {this->emit_null_, this->drop_}) {
+      Datum out_datum;
+      ASSERT_OK(arrow::compute::Filter(&this->ctx_, batch, filter, options, &out_datum));
+      auto actual = out_datum.record_batch();
+      ASSERT_OK(actual->ValidateFull());
+      for (int i = 0; i < batch->num_columns(); ++i) {
+        Datum expected;
+        ASSERT_OK(arrow::compute::Filter(&this->ctx_, batch->column(i), filter, options,
+                                         &expected));
+        AssertArraysEqual(*expected.make_array(), *actual->column(i));
+      }
+    }
+  }
+}
+
+class TestGetFilterIndices : public ComputeFixture, public TestBase {
+ public:
+  void AssertIndices(const std::string& filter, FilterOptions::NullSelectionBehavior
+                                                    null_selection_behavior,
+                     const std::string& expected) {
+    FilterOptions options;
+    options.null_selection_behavior = null_selection_behavior;
+    std::shared_ptr<Array> actual;
+    auto filter_array = ArrayFromJSON(boolean(), filter);
+    ASSERT_OK(GetFilterIndices(&this->ctx_,
+                               checked_cast<const BooleanArray&>(*filter_array), options,
+                               &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(int32(), expected), *actual);
+  }
+};
+
+TEST_F(TestGetFilterIndices, Basics) {
+  AssertIndices("[]", FilterOptions::DROP, "[]");
+  AssertIndices("[0, 0, 0]", FilterOptions::EMIT_NULL, "[]");
+  AssertIndices("[1, 1, 1]", FilterOptions::DROP, "[0, 1, 2]");
+  AssertIndices("[0, 1, 1, 0, null, 1]", FilterOptions::DROP, "[1, 2, 5]");
+  AssertIndices("[0, 1, 1, 0, null, 1]", FilterOptions::EMIT_NULL, "[1, 2, null, 5]");
+  AssertIndices("[null, null]", FilterOptions::DROP, "[]");
+  AssertIndices("[null, null]", FilterOptions::EMIT_NULL, "[null, null]");
+}
+
+TEST_F(TestGetFilterIndices, Random) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  for (int64_t offset : {0, 3}) {
+    for (auto probability : {0.0, 0.1, 0.9, 1.0}) {
+      for (auto null_probability : {0.0, 0.2}) {
+        auto filter = checked_pointer_cast<BooleanArray>(
+            rand.Boolean(offset + 333, probability, null_probability)->Slice(offset));
+
+        for (auto behavior : {FilterOptions::DROP, FilterOptions::EMIT_NULL}) {
+          FilterOptions options;
+          options.null_selection_behavior = behavior;
+          std::shared_ptr<Array> actual;
+          ASSERT_OK(GetFilterIndices(&this->ctx_, *filter, options, &actual));
+          ASSERT_OK(actual->ValidateFull());
+
+          Int32Builder builder;
+          for (int64_t i = 0; i < filter->length(); ++i) {
+            if (filter->IsNull(i)) {
+              if (behavior == FilterOptions::EMIT_NULL) {
+                ASSERT_OK(builder.AppendNull());
+              }
+            } else if (filter->Value(i)) {
+              ASSERT_OK(builder.Append(static_cast<int32_t>(i)));
+            }
+          }
+          std::shared_ptr<Array> expected;
+          ASSERT_OK(builder.Finish(&expected));
+          AssertArraysEqual(*expected, *actual);
+        }
+      }
+    }
+  }
+}
+
 class TestFilterKernelWithChunkedArray : public TestFilterKernel<ChunkedArray> {
  public:
   void AssertFilter(const std::shared_ptr<DataType>& type,
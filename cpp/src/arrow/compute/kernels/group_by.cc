@@ -0,0 +1,573 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group_by.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/grouper_internal.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Per-group aggregate states
+
+class GroupedAggregate {
+ public:
+  virtual ~GroupedAggregate() = default;
+
+  // Make room for states of groups up to `num_groups`
+  virtual void Resize(int64_t num_groups) = 0;
+
+  // Update states of the groups given by `group_ids` with the values of `data`
+  virtual void Consume(const ArrayData& data, const int32_t* group_ids) = 0;
+
+  // Merge states of `other`, whose group g maps to group `group_id_mapping[g]` here
+  virtual void Merge(const GroupedAggregate& other, const int32_t* group_id_mapping) = 0;
+
+  virtual Status Finalize(std::shared_ptr<Array>* out) = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+// Call `visit(group_id, value)` for each non-null value of `data`
+template <typename CType, typename Visit>
+void VisitGroupedValues(const ArrayData& data, const int32_t* group_ids, Visit&& visit) {
+  const CType* values = data.GetValues<CType>(1);
+  if (data.GetNullCount() == 0) {
+    for (int64_t i = 0; i < data.length; ++i) {
+      visit(group_ids[i], values[i]);
+    }
+  } else {
+    internal::BitmapReader reader(data.buffers[0]->data(), data.offset, data.length);
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (reader.IsSet()) {
+        visit(group_ids[i], values[i]);
+      }
+      reader.Next();
+    }
+  }
+}
+
+class GroupedCount : public GroupedAggregate {
+ public:
+  void Resize(int64_t num_groups) override { counts_.resize(num_groups, 0); }
+
+  void Consume(const ArrayData& data, const int32_t* group_ids) override {
+    if (data.GetNullCount() == 0) {
+      for (int64_t i = 0; i < data.length; ++i) {
+        ++counts_[group_ids[i]];
+      }
+    } else if (data.type->id() != Type::NA) {
+      internal::BitmapReader reader(data.buffers[0]->data(), data.offset, data.length);
+      for (int64_t i = 0; i < data.length; ++i) {
+        counts_[group_ids[i]] += reader.IsSet();
+        reader.Next();
+      }
+    }
+  }
+
+  void Merge(const GroupedAggregate& other, const int32_t* group_id_mapping) override {
+    const auto& other_counts = checked_cast<const GroupedCount&>(other).counts_;
+    for (size_t g = 0; g < other_counts.size(); ++g) {
+      counts_[group_id_mapping[g]] += other_counts[g];
+    }
+  }
+
+  Status Finalize(std::shared_ptr<Array>* out) override {
+    auto length = static_cast<int64_t>(counts_.size());
+    ARROW_ASSIGN_OR_RAISE(auto data, AllocateBuffer(length * sizeof(int64_t)));
+    std::copy(counts_.begin(), counts_.end(),
+              reinterpret_cast<int64_t*>(data->mutable_data()));
+    *out = std::make_shared<Int64Array>(length, std::move(data));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ protected:
+  std::vector<int64_t> counts_;
+};
+
+// Sum and mean of values, using the same accumulator type as the Sum and Mean kernels
+template <typename ArrowType, bool is_mean>
+class GroupedSum : public GroupedAggregate {
+ public:
+  using CType = typename ArrowType::c_type;
+  using AccType = typename FindAccumulatorType<ArrowType>::Type;
+  using AccCType = typename AccType::c_type;
+  using OutType = typename std::conditional<is_mean, DoubleType, AccType>::type;
+
+  explicit GroupedSum(MemoryPool* pool) : pool_(pool) {}
+
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  void Consume(const ArrayData& data, const int32_t* group_ids) override {
+    VisitGroupedValues<CType>(data, group_ids, [this](int32_t g, CType value) {
+      sums_[g] += value;
+      ++counts_[g];
+    });
+  }
+
+  void Merge(const GroupedAggregate& other, const int32_t* group_id_mapping) override {
+    const auto& other_sum = checked_cast<const GroupedSum&>(other);
+    for (size_t g = 0; g < other_sum.sums_.size(); ++g) {
+      sums_[group_id_mapping[g]] += other_sum.sums_[g];
+      counts_[group_id_mapping[g]] += other_sum.counts_[g];
+    }
+  }
+
+  Status Finalize(std::shared_ptr<Array>* out) override {
+    NumericBuilder<OutType> builder(pool_);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(sums_.size())));
+    for (size_t g = 0; g < sums_.size(); ++g) {
+      if (counts_[g] == 0) {
+        builder.UnsafeAppendNull();
+      } else if (is_mean) {
+        builder.UnsafeAppend(static_cast<double>(sums_[g]) /
+                             static_cast<double>(counts_[g]));
+      } else {
+        builder.UnsafeAppend(static_cast<typename OutType::c_type>(sums_[g]));
+      }
+    }
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<OutType>::type_singleton();
+  }
+
+ protected:
+  MemoryPool* pool_;
+  std::vector<AccCType> sums_;
+  std::vector<int64_t> counts_;
+};
+
+// Min or max of values, with the same NaN semantics as the MinMax kernel
+template <typename ArrowType, bool is_min, typename Enable = void>
+struct MinMaxOp {
+  using CType = typename ArrowType::c_type;
+
+  static CType Apply(CType a, CType b) {
+    return is_min ? std::min(a, b) : std::max(a, b);
+  }
+};
+
+template <typename ArrowType, bool is_min>
+struct MinMaxOp<ArrowType, is_min, enable_if_floating_point<ArrowType>> {
+  using CType = typename ArrowType::c_type;
+
+  static CType Apply(CType a, CType b) {
+    return is_min ? std::fmin(a, b) : std::fmax(a, b);
+  }
+};
+
+template <typename ArrowType, bool is_min>
+class GroupedMinMax : public GroupedAggregate {
+ public:
+  using CType = typename ArrowType::c_type;
+  using Op = MinMaxOp<ArrowType, is_min>;
+
+  GroupedMinMax(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool) {}
+
+  void Resize(int64_t num_groups) override {
+    values_.resize(num_groups, CType{});
+    has_values_.resize(num_groups, false);
+  }
+
+  void Consume(const ArrayData& data, const int32_t* group_ids) override {
+    VisitGroupedValues<CType>(data, group_ids,
+                              [this](int32_t g, CType value) { Update(g, value); });
+  }
+
+  void Merge(const GroupedAggregate& other, const int32_t* group_id_mapping) override {
+    const auto& other_minmax = checked_cast<const GroupedMinMax&>(other);
+    for (size_t g = 0; g < other_minmax.values_.size(); ++g) {
+      if (other_minmax.has_values_[g]) {
+        Update(group_id_mapping[g], other_minmax.values_[g]);
+      }
+    }
+  }
+
+  Status Finalize(std::shared_ptr<Array>* out) override {
+    NumericBuilder<ArrowType> builder(type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(values_.size())));
+    for (size_t g = 0; g < values_.size(); ++g) {
+      if (has_values_[g]) {
+        builder.UnsafeAppend(values_[g]);
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ protected:
+  void Update(int32_t g, CType value) {
+    if (has_values_[g]) {
+      values_[g] = Op::Apply(values_[g], value);
+    } else {
+      values_[g] = value;
+      has_values_[g] = true;
+    }
+  }
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  std::vector<CType> values_;
+  std::vector<bool> has_values_;
+};
+
+Status MakeGroupedAggregate(const GroupAggregate& aggregate,
+                            const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                            std::unique_ptr<GroupedAggregate>* out) {
+  if (aggregate.kind == GroupAggregate::COUNT) {
+    out->reset(new GroupedCount());
+    return Status::OK();
+  }
+
+  switch (type->id()) {
+#define NUMERIC_CASE(InType)                                           \
+  case InType::type_id:                                                \
+    switch (aggregate.kind) {                                          \
+      case GroupAggregate::SUM:                                        \
+        out->reset(new GroupedSum<InType, false>(pool));               \
+        return Status::OK();                                           \
+      case GroupAggregate::MEAN:                                       \
+        out->reset(new GroupedSum<InType, true>(pool));                \
+        return Status::OK();                                           \
+      case GroupAggregate::MIN:                                        \
+        out->reset(new GroupedMinMax<InType, true>(type, pool));       \
+        return Status::OK();                                           \
+      case GroupAggregate::MAX:                                        \
+        out->reset(new GroupedMinMax<InType, false>(type, pool));      \
+        return Status::OK();                                           \
+      default:                                                         \
+        return Status::Invalid("Invalid group aggregate kind");        \
+    }
+
+    NUMERIC_CASE(UInt8Type)
+    NUMERIC_CASE(Int8Type)
+    NUMERIC_CASE(UInt16Type)
+    NUMERIC_CASE(Int16Type)
+    NUMERIC_CASE(UInt32Type)
+    NUMERIC_CASE(Int32Type)
+    NUMERIC_CASE(UInt64Type)
+    NUMERIC_CASE(Int64Type)
+    NUMERIC_CASE(FloatType)
+    NUMERIC_CASE(DoubleType)
+#undef NUMERIC_CASE
+    default:
+      break;
+  }
+  return Status::NotImplemented("Grouped aggregation of type ", type->ToString(),
+                                " not implemented");
+}
+
+std::string AggregateKindName(GroupAggregate::Kind kind) {
+  switch (kind) {
+    case GroupAggregate::SUM:
+      return "sum";
+    case GroupAggregate::COUNT:
+      return "count";
+    case GroupAggregate::MIN:
+      return "min";
+    case GroupAggregate::MAX:
+      return "max";
+    case GroupAggregate::MEAN:
+      return "mean";
+  }
+  return "<unknown>";
+}
+
+// ----------------------------------------------------------------------
+// GroupByAggregator implementation
+
+class GroupByAggregatorImpl : public GroupByAggregator {
+ public:
+  Status Init(FunctionContext* ctx,
+              const std::vector<std::shared_ptr<DataType>>& key_types,
+              const std::vector<std::shared_ptr<DataType>>& argument_types,
+              const std::vector<GroupAggregate>& aggregates) {
+    if (key_types.empty()) {
+      return Status::Invalid("GroupBy needs at least one key column");
+    }
+    if (argument_types.size() != aggregates.size()) {
+      return Status::Invalid("GroupBy got ", argument_types.size(),
+                             " arguments for ", aggregates.size(), " aggregates");
+    }
+    ctx_ = ctx;
+    key_types_ = key_types;
+    argument_types_ = argument_types;
+    RETURN_NOT_OK(grouper_.Init(ctx, key_types));
+
+    std::vector<std::shared_ptr<Field>> fields;
+    for (size_t i = 0; i < key_types.size(); ++i) {
+      fields.push_back(field("key_" + std::to_string(i), key_types[i]));
+    }
+    aggregates_.resize(aggregates.size());
+    for (size_t i = 0; i < aggregates.size(); ++i) {
+      RETURN_NOT_OK(MakeGroupedAggregate(aggregates[i], argument_types[i],
+                                         ctx->memory_pool(), &aggregates_[i]));
+      const auto& name = aggregates[i].name.empty()
+                             ? AggregateKindName(aggregates[i].kind)
+                             : aggregates[i].name;
+      fields.push_back(field(name, aggregates_[i]->out_type()));
+    }
+    out_type_ = struct_(std::move(fields));
+    return Status::OK();
+  }
+
+  Status Consume(const ArrayVector& keys, const ArrayVector& arguments) override {
+    RETURN_NOT_OK(CheckInputs(keys, key_types_, "key"));
+    RETURN_NOT_OK(CheckInputs(arguments, argument_types_, "argument"));
+    const int64_t length = keys[0]->length();
+    for (const auto& column : keys) {
+      RETURN_NOT_OK(CheckLength(*column, length));
+    }
+    for (const auto& column : arguments) {
+      RETURN_NOT_OK(CheckLength(*column, length));
+    }
+
+    RETURN_NOT_OK(grouper_.Consume(keys, length, &group_ids_));
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      aggregates_[i]->Resize(grouper_.num_groups());
+      aggregates_[i]->Consume(*arguments[i]->data(), group_ids_.data());
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const GroupByAggregator& other_base) override {
+    const auto& other = checked_cast<const GroupByAggregatorImpl&>(other_base);
+    if (!other.out_type_->Equals(*out_type_)) {
+      return Status::Invalid("Cannot merge GroupByAggregator of type ",
+                             other.out_type_->ToString(), " into one of type ",
+                             out_type_->ToString());
+    }
+    // Look up (or create) the groups of `other` in this aggregator
+    ArrayVector other_keys;
+    RETURN_NOT_OK(other.grouper_.GetUniques(&other_keys));
+    std::vector<int32_t> group_id_mapping;
+    RETURN_NOT_OK(
+        grouper_.Consume(other_keys, other.grouper_.num_groups(), &group_id_mapping));
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      aggregates_[i]->Resize(grouper_.num_groups());
+      aggregates_[i]->Merge(*other.aggregates_[i], group_id_mapping.data());
+    }
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return grouper_.num_groups(); }
+
+  Status Finish(std::shared_ptr<Array>* out) override {
+    ArrayVector columns;
+    RETURN_NOT_OK(grouper_.GetUniques(&columns));
+    for (auto& aggregate : aggregates_) {
+      // Groups may have been created by keys without any arguments
+      aggregate->Resize(grouper_.num_groups());
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(aggregate->Finalize(&column));
+      columns.push_back(std::move(column));
+    }
+    ARROW_ASSIGN_OR_RAISE(*out, StructArray::Make(columns, out_type_->children()));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ protected:
+  static Status CheckInputs(const ArrayVector& columns,
+                            const std::vector<std::shared_ptr<DataType>>& types,
+                            const char* kind) {
+    if (columns.size() != types.size()) {
+      return Status::Invalid("GroupByAggregator expected ", types.size(), " ", kind,
+                             " columns, got ", columns.size());
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+      if (!columns[i]->type()->Equals(*types[i])) {
+        return Status::TypeError("GroupByAggregator expected ", kind, " column #", i,
+                                 " of type ", types[i]->ToString(), ", got ",
+                                 columns[i]->type()->ToString());
+      }
+    }
+    return Status::OK();
+  }
+
+  static Status CheckLength(const Array& column, int64_t length) {
+    if (column.length() != length) {
+      return Status::Invalid("GroupBy columns must all have the same length");
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<std::shared_ptr<DataType>> argument_types_;
+  std::shared_ptr<DataType> out_type_;
+  detail::Grouper grouper_;
+  std::vector<std::unique_ptr<GroupedAggregate>> aggregates_;
+  // Scratch space for the group ids of the current batch
+  std::vector<int32_t> group_ids_;
+};
+
+// Split array-like datums into aligned chunks (columns x chunks)
+Status GetAlignedChunks(const std::vector<Datum>& columns,
+                        std::vector<ArrayVector>* out_chunks) {
+  out_chunks->resize(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    const auto& column = columns[i];
+    if (column.is_array()) {
+      (*out_chunks)[i] = {column.make_array()};
+    } else if (column.kind() == Datum::CHUNKED_ARRAY) {
+      (*out_chunks)[i] = column.chunked_array()->chunks();
+    } else {
+      return Status::Invalid("GroupBy expects Array or ChunkedArray datums");
+    }
+  }
+  for (size_t i = 1; i < columns.size(); ++i) {
+    const auto& chunks = (*out_chunks)[i];
+    const auto& first_chunks = (*out_chunks)[0];
+    bool aligned = chunks.size() == first_chunks.size();
+    for (size_t j = 0; aligned && j < chunks.size(); ++j) {
+      aligned = chunks[j]->length() == first_chunks[j]->length();
+    }
+    if (!aligned) {
+      return Status::Invalid("GroupBy columns must all have the same chunk layout");
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status GroupByAggregator::Make(
+    FunctionContext* ctx, const std::vector<std::shared_ptr<DataType>>& key_types,
+    const std::vector<std::shared_ptr<DataType>>& argument_types,
+    const std::vector<GroupAggregate>& aggregates,
+    std::unique_ptr<GroupByAggregator>* out) {
+  std::unique_ptr<GroupByAggregatorImpl> impl(new GroupByAggregatorImpl());
+  RETURN_NOT_OK(impl->Init(ctx, key_types, argument_types, aggregates));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<Datum>& arguments, const GroupByOptions& options,
+               std::shared_ptr<Array>* out) {
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy needs at least one key column");
+  }
+  std::vector<Datum> columns = keys;
+  columns.insert(columns.end(), arguments.begin(), arguments.end());
+  std::vector<ArrayVector> chunks;
+  RETURN_NOT_OK(GetAlignedChunks(columns, &chunks));
+
+  std::vector<std::shared_ptr<DataType>> key_types, argument_types;
+  for (const auto& key : keys) {
+    key_types.push_back(key.type());
+  }
+  for (const auto& argument : arguments) {
+    argument_types.push_back(argument.type());
+  }
+
+  // Gather the columns of the given chunk, as expected by Consume()
+  auto get_chunk = [&](size_t chunk_index, ArrayVector* chunk_keys,
+                       ArrayVector* chunk_arguments) {
+    chunk_keys->clear();
+    chunk_arguments->clear();
+    for (size_t i = 0; i < columns.size(); ++i) {
+      auto* dest = i < keys.size() ? chunk_keys : chunk_arguments;
+      dest->push_back(chunks[i][chunk_index]);
+    }
+  };
+
+  const size_t num_chunks = chunks[0].size();
+  size_t num_partials = 1;
+  auto thread_pool = internal::GetCpuThreadPool();
+  if (options.use_threads) {
+    num_partials = std::min(num_chunks, static_cast<size_t>(thread_pool->GetCapacity()));
+    num_partials = std::max<size_t>(num_partials, 1);
+  }
+
+  // Each partial aggregator consumes a contiguous range of the chunks, and the
+  // partials are merged in chunk order, such that the groups keep their order
+  // of first appearance whatever the parallelism
+  std::vector<std::unique_ptr<GroupByAggregator>> partials(num_partials);
+  for (auto& partial : partials) {
+    RETURN_NOT_OK(GroupByAggregator::Make(ctx, key_types, argument_types,
+                                          options.aggregates, &partial));
+  }
+  auto consume_chunks = [&](size_t partial_index) -> Status {
+    ArrayVector chunk_keys, chunk_arguments;
+    const size_t begin = partial_index * num_chunks / num_partials;
+    const size_t end = (partial_index + 1) * num_chunks / num_partials;
+    for (size_t j = begin; j < end; ++j) {
+      get_chunk(j, &chunk_keys, &chunk_arguments);
+      RETURN_NOT_OK(partials[partial_index]->Consume(chunk_keys, chunk_arguments));
+    }
+    return Status::OK();
+  };
+
+  if (num_partials == 1) {
+    RETURN_NOT_OK(consume_chunks(0));
+  } else {
+    auto task_group = internal::TaskGroup::MakeThreaded(thread_pool);
+    for (size_t i = 0; i < num_partials; ++i) {
+      task_group->Append([&, i] { return consume_chunks(i); });
+    }
+    RETURN_NOT_OK(task_group->Finish());
+    for (size_t i = 1; i < num_partials; ++i) {
+      RETURN_NOT_OK(partials[0]->Merge(*partials[i]));
+    }
+  }
+  return partials[0]->Finish(out);
+}
+
+}  // namespace compute
+}  // namespace arrow
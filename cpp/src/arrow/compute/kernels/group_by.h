@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+/// \class GroupAggregate
+///
+/// An aggregation computed for each group by GroupBy, over one argument column.
+/// Null argument values are skipped.
+struct ARROW_EXPORT GroupAggregate {
+  enum Kind {
+    /// Sum of values, as int64, uint64 or double (null if no values)
+    SUM = 0,
+    /// Number of non-null values, as int64
+    COUNT,
+    /// Smallest value, with the argument type (null if no values)
+    MIN,
+    /// Largest value, with the argument type (null if no values)
+    MAX,
+    /// Arithmetic mean of values, as double (null if no values)
+    MEAN
+  };
+
+  explicit GroupAggregate(Kind kind, std::string name = "")
+      : kind(kind), name(std::move(name)) {}
+
+  Kind kind;
+  /// Name of the output field.  If empty, the kind name (e.g. "sum") is used.
+  std::string name;
+};
+
+/// \class GroupByOptions
+struct ARROW_EXPORT GroupByOptions {
+  explicit GroupByOptions(std::vector<GroupAggregate> aggregates = {},
+                          bool use_threads = true)
+      : aggregates(std::move(aggregates)), use_threads(use_threads) {}
+
+  /// One aggregate per argument column
+  std::vector<GroupAggregate> aggregates;
+  /// Whether to aggregate chunks of ChunkedArray inputs in parallel
+  bool use_threads;
+};
+
+/// \brief Incremental hash-based grouped aggregation
+///
+/// A GroupByAggregator assigns a dense group id to each distinct combination
+/// of key values (null being a distinct key value), and maintains for each
+/// aggregate a vector of per-group states indexed by group id.
+///
+/// A GroupByAggregator is not thread-safe.  To aggregate in parallel, give
+/// each thread its own partial GroupByAggregator (created with the same key
+/// types, argument types and aggregates), Consume() disjoint sets of rows
+/// on each, then Merge() the partial aggregators together before calling
+/// Finish().  No lock is held while consuming.
+class ARROW_EXPORT GroupByAggregator {
+ public:
+  virtual ~GroupByAggregator() = default;
+
+  /// \brief Consume a batch of rows
+  ///
+  /// \param[in] keys one array per key column
+  /// \param[in] arguments one array per aggregate, of the same length as the keys
+  virtual Status Consume(const ArrayVector& keys, const ArrayVector& arguments) = 0;
+
+  /// \brief Merge the groups and states of another partial aggregator into this one
+  ///
+  /// `other` is left untouched.
+  virtual Status Merge(const GroupByAggregator& other) = 0;
+
+  /// \brief The number of groups seen so far
+  virtual int64_t num_groups() const = 0;
+
+  /// \brief Compute the final aggregation results
+  ///
+  /// The result is a StructArray with one row per group, in order of first
+  /// appearance.  Its fields are the key columns (named "key_0", "key_1"...)
+  /// followed by one field per aggregate.
+  virtual Status Finish(std::shared_ptr<Array>* out) = 0;
+
+  /// \brief The type of the StructArray returned by Finish()
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+
+  /// \brief Create a GroupByAggregator
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] key_types the types of the key columns (at least one)
+  /// \param[in] argument_types the types of the aggregate arguments
+  /// \param[in] aggregates the aggregates, one per argument
+  /// \param[out] out the GroupByAggregator
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     const std::vector<std::shared_ptr<DataType>>& argument_types,
+                     const std::vector<GroupAggregate>& aggregates,
+                     std::unique_ptr<GroupByAggregator>* out);
+};
+
+/// \brief Compute aggregates for each group of distinct key values
+///
+/// For example given keys = [["a", "b", "a", null]],
+/// arguments = [[1, 2, 3, 4]] and aggregates = [SUM], the output
+/// will be [{"key_0": "a", "sum": 4}, {"key_0": "b", "sum": 2},
+/// {"key_0": null, "sum": 4}].
+///
+/// If the inputs are ChunkedArrays (which must then all have the same chunk
+/// layout) and `options.use_threads` is true, chunks are aggregated in
+/// parallel on the CPU thread pool into partial aggregators, which are
+/// merged at the end.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] keys key columns, as Array or ChunkedArray datums
+/// \param[in] arguments aggregate arguments, of the same length as the keys
+/// \param[in] options the aggregates to compute, one per argument
+/// \param[out] out StructArray of keys and aggregates, one row per group
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<Datum>& arguments, const GroupByOptions& options,
+               std::shared_ptr<Array>* out);
+
+}  // namespace compute
+}  // namespace arrow
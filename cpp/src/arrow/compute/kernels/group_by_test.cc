@@ -0,0 +1,257 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestGroupBy : public ComputeFixture, public ::testing::Test {
+ protected:
+  void CheckGroupBy(const std::vector<Datum>& keys, const std::vector<Datum>& arguments,
+                    const std::vector<GroupAggregate>& aggregates,
+                    const std::shared_ptr<DataType>& expected_type,
+                    const std::string& expected_json) {
+    for (bool use_threads : {false, true}) {
+      std::shared_ptr<Array> actual;
+      GroupByOptions options(aggregates, use_threads);
+      ASSERT_OK(GroupBy(&ctx_, keys, arguments, options, &actual));
+      ASSERT_OK(actual->ValidateFull());
+      AssertArraysEqual(*ArrayFromJSON(expected_type, expected_json), *actual,
+                        /*verbose=*/true);
+    }
+  }
+};
+
+TEST_F(TestGroupBy, SingleKey) {
+  auto keys = ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "b", "a", null])");
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3, 4, null, 6, null]");
+
+  auto expected_type =
+      struct_({field("key_0", utf8()), field("sum", int64()), field("count", int64()),
+               field("min", int32()), field("max", int32()), field("mean", float64())});
+  CheckGroupBy({keys}, {values, values, values, values, values},
+               {GroupAggregate(GroupAggregate::SUM),
+                GroupAggregate(GroupAggregate::COUNT),
+                GroupAggregate(GroupAggregate::MIN), GroupAggregate(GroupAggregate::MAX),
+                GroupAggregate(GroupAggregate::MEAN)},
+               expected_type, R"([
+    {"key_0": "a", "sum": 10, "count": 3, "min": 1, "max": 6, "mean": 3.3333333333333335},
+    {"key_0": "b", "sum": 2, "count": 1, "min": 2, "max": 2, "mean": 2.0},
+    {"key_0": null, "sum": 4, "count": 1, "min": 4, "max": 4, "mean": 4.0}
+  ])");
+}
+
+TEST_F(TestGroupBy, NoValuesInGroup) {
+  auto keys = ArrayFromJSON(int64(), "[1, 2, 1]");
+  auto values = ArrayFromJSON(float64(), "[1.5, null, 2.5]");
+
+  auto expected_type = struct_({field("key_0", int64()), field("total", float64()),
+                                field("count", int64()), field("min", float64())});
+  CheckGroupBy({keys}, {values, values, values},
+               {GroupAggregate(GroupAggregate::SUM, "total"),
+                GroupAggregate(GroupAggregate::COUNT),
+                GroupAggregate(GroupAggregate::MIN)},
+               expected_type, R"([
+    {"key_0": 1, "total": 4.0, "count": 2, "min": 1.5},
+    {"key_0": 2, "total": null, "count": 0, "min": null}
+  ])");
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  auto key0 = ArrayFromJSON(int32(), "[1, 1, 2, 1, 2, null, null]");
+  auto key1 = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", "x", "y", "y"])");
+  auto values = ArrayFromJSON(uint8(), "[1, 2, 3, 4, 5, 6, 7]");
+
+  auto expected_type = struct_(
+      {field("key_0", int32()), field("key_1", utf8()), field("sum", uint64())});
+  CheckGroupBy({key0, key1}, {values}, {GroupAggregate(GroupAggregate::SUM)},
+               expected_type, R"([
+    {"key_0": 1, "key_1": "x", "sum": 5},
+    {"key_0": 1, "key_1": "y", "sum": 2},
+    {"key_0": 2, "key_1": "x", "sum": 8},
+    {"key_0": null, "key_1": "y", "sum": 13}
+  ])");
+}
+
+TEST_F(TestGroupBy, NoAggregates) {
+  auto keys = ArrayFromJSON(boolean(), "[true, false, null, true]");
+  CheckGroupBy({keys}, {}, {}, struct_({field("key_0", boolean())}),
+               R"([{"key_0": true}, {"key_0": false}, {"key_0": null}])");
+}
+
+TEST_F(TestGroupBy, ChunkedArrays) {
+  auto keys = ChunkedArrayFromJSON(int8(), {"[1, 2]", "[2, 3, 1]", "[]", "[3, 3]"});
+  auto values = ChunkedArrayFromJSON(int16(), {"[10, 20]", "[30, 40, 50]", "[]",
+                                               "[60, null]"});
+
+  // Whatever the parallelism, groups appear in order of first appearance
+  auto expected_type = struct_({field("key_0", int8()), field("sum", int64()),
+                                field("max", int16())});
+  CheckGroupBy({keys}, {values, values},
+               {GroupAggregate(GroupAggregate::SUM), GroupAggregate(GroupAggregate::MAX)},
+               expected_type, R"([
+    {"key_0": 1, "sum": 60, "max": 50},
+    {"key_0": 2, "sum": 50, "max": 30},
+    {"key_0": 3, "sum": 100, "max": 60}
+  ])");
+}
+
+TEST_F(TestGroupBy, MergePartials) {
+  std::vector<std::shared_ptr<DataType>> key_types = {utf8(), int64()};
+  std::vector<std::shared_ptr<DataType>> argument_types = {int64(), int64()};
+  std::vector<GroupAggregate> aggregates = {GroupAggregate(GroupAggregate::COUNT),
+                                            GroupAggregate(GroupAggregate::MIN)};
+
+  std::unique_ptr<GroupByAggregator> left, right;
+  ASSERT_OK(GroupByAggregator::Make(&ctx_, key_types, argument_types, aggregates, &left));
+  ASSERT_OK(
+      GroupByAggregator::Make(&ctx_, key_types, argument_types, aggregates, &right));
+
+  auto values = ArrayFromJSON(int64(), "[5, 4, 3]");
+  ASSERT_OK(left->Consume({ArrayFromJSON(utf8(), R"(["a", "b", "a"])"),
+                           ArrayFromJSON(int64(), "[1, 1, 2]")},
+                          {values, values}));
+  ASSERT_OK(right->Consume({ArrayFromJSON(utf8(), R"(["c", "a", "b"])"),
+                            ArrayFromJSON(int64(), "[1, 2, 1]")},
+                           {values, values}));
+  ASSERT_EQ(left->num_groups(), 3);
+  ASSERT_EQ(right->num_groups(), 3);
+
+  ASSERT_OK(left->Merge(*right));
+  ASSERT_EQ(left->num_groups(), 4);
+
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(left->Finish(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  AssertTypeEqual(*left->out_type(), *actual->type());
+  auto expected = ArrayFromJSON(left->out_type(), R"([
+    {"key_0": "a", "key_1": 1, "count": 1, "min": 5},
+    {"key_0": "b", "key_1": 1, "count": 2, "min": 3},
+    {"key_0": "a", "key_1": 2, "count": 2, "min": 3},
+    {"key_0": "c", "key_1": 1, "count": 1, "min": 5}
+  ])");
+  AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+}
+
+TEST_F(TestGroupBy, ParallelMatchesSerial) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const int64_t chunk_size = 1000;
+  ArrayVector key_chunks, value_chunks;
+  for (int i = 0; i < 16; ++i) {
+    key_chunks.push_back(rand.Int32(chunk_size, 0, 50, /*null_probability=*/0.1));
+    value_chunks.push_back(rand.Int64(chunk_size, -1000, 1000, 0.1));
+  }
+  auto keys = std::make_shared<ChunkedArray>(key_chunks);
+  auto values = std::make_shared<ChunkedArray>(value_chunks);
+  std::vector<GroupAggregate> aggregates = {GroupAggregate(GroupAggregate::SUM),
+                                            GroupAggregate(GroupAggregate::COUNT),
+                                            GroupAggregate(GroupAggregate::MIN),
+                                            GroupAggregate(GroupAggregate::MAX)};
+  std::vector<Datum> arguments(aggregates.size(), values);
+
+  std::shared_ptr<Array> serial, parallel;
+  ASSERT_OK(
+      GroupBy(&ctx_, {keys}, arguments, GroupByOptions(aggregates, false), &serial));
+  ASSERT_OK(
+      GroupBy(&ctx_, {keys}, arguments, GroupByOptions(aggregates, true), &parallel));
+  ASSERT_OK(parallel->ValidateFull());
+  AssertArraysEqual(*serial, *parallel);
+}
+
+TEST_F(TestGroupBy, ParallelOrderOfFirstAppearance) {
+  // Every chunk introduces new groups (in decreasing order) and revisits one of
+  // the previous chunk: the order of the groups must not depend on the thread
+  // count
+  const int num_chunks = 13;
+  ArrayVector key_chunks;
+  std::string expected_json;
+  for (int i = 0; i < num_chunks; ++i) {
+    std::string chunk_json;
+    for (int k = 2; k >= 0; --k) {
+      const std::string key = std::to_string(100 * i + k);
+      const bool revisited = k == 1 && i < num_chunks - 1;
+      chunk_json += key + ", ";
+      expected_json += (expected_json.empty() ? "" : ", ") +
+                       std::string(R"({"key_0": )") + key +
+                       R"(, "count": )" + (revisited ? "2" : "1") + "}";
+    }
+    if (i == 0) expected_json += R"(, {"key_0": null, "count": 0})";
+    chunk_json += i == 0 ? "null" : std::to_string(100 * (i - 1) + 1);
+    key_chunks.push_back(ArrayFromJSON(int32(), "[" + chunk_json + "]"));
+  }
+  auto keys = std::make_shared<ChunkedArray>(key_chunks);
+  std::vector<GroupAggregate> aggregates = {GroupAggregate(GroupAggregate::COUNT)};
+  auto expected = ArrayFromJSON(
+      struct_({field("key_0", int32()), field("count", int64())}),
+      "[" + expected_json + "]");
+
+  const int capacity = GetCpuThreadPoolCapacity();
+  for (int threads : {1, 2, 3, 5, 8, num_chunks}) {
+    ASSERT_OK(SetCpuThreadPoolCapacity(threads));
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(
+        GroupBy(&ctx_, {keys}, {keys}, GroupByOptions(aggregates, true), &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+  }
+  ASSERT_OK(SetCpuThreadPoolCapacity(capacity));
+}
+
+TEST_F(TestGroupBy, Errors) {
+  auto keys = ArrayFromJSON(int32(), "[1, 2]");
+  std::shared_ptr<Array> out;
+  // No keys
+  ASSERT_RAISES(Invalid, GroupBy(&ctx_, {}, {keys},
+                                 GroupByOptions({GroupAggregate(GroupAggregate::SUM)}),
+                                 &out));
+  // Mismatching number of arguments and aggregates
+  ASSERT_RAISES(Invalid, GroupBy(&ctx_, {keys}, {keys, keys},
+                                 GroupByOptions({GroupAggregate(GroupAggregate::SUM)}),
+                                 &out));
+  // Mismatching lengths
+  ASSERT_RAISES(Invalid, GroupBy(&ctx_, {keys}, {ArrayFromJSON(int32(), "[1]")},
+                                 GroupByOptions({GroupAggregate(GroupAggregate::SUM)}),
+                                 &out));
+  // Unsupported argument type
+  ASSERT_RAISES(NotImplemented,
+                GroupBy(&ctx_, {keys}, {ArrayFromJSON(utf8(), R"(["a", "b"])")},
+                        GroupByOptions({GroupAggregate(GroupAggregate::SUM)}), &out));
+  // Unsupported key type
+  ASSERT_RAISES(NotImplemented,
+                GroupBy(&ctx_, {ArrayFromJSON(list(int32()), "[[1], [2]]")}, {},
+                        GroupByOptions(), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
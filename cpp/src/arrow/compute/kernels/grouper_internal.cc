@@ -0,0 +1,359 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/grouper_internal.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/hashing.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::DictionaryTraits;
+using internal::HashTraits;
+
+namespace compute {
+namespace detail {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding: map the values of one key column to dense ids
+
+class KeyEncoder {
+ public:
+  virtual ~KeyEncoder() = default;
+
+  // Write the key id of each value of `data` to `ids`, adding unseen values
+  virtual Status Encode(const ArrayData& data, int32_t* ids) = 0;
+
+  // Write the key id of each value of `data` to `ids`, or -1 for unseen values
+  virtual Status Lookup(const ArrayData& data, int32_t* ids) const = 0;
+
+  // The number of distinct values seen so far
+  virtual int32_t size() const = 0;
+
+  // The distinct values seen so far, in key id order
+  virtual Status GetUniques(std::shared_ptr<ArrayData>* out) const = 0;
+};
+
+template <typename Type, typename Scalar>
+class RegularKeyEncoder : public KeyEncoder {
+ public:
+  RegularKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(pool, 0) {}
+
+  Status Encode(const ArrayData& data, int32_t* ids) override {
+    auto visit_value = [&](util::optional<Scalar> v) -> Status {
+      if (v.has_value()) {
+        return memo_table_.GetOrInsert(*v, ids++);
+      } else {
+        *ids++ = memo_table_.GetOrInsertNull();
+        return Status::OK();
+      }
+    };
+    return VisitArrayDataInline<Type>(data, std::move(visit_value));
+  }
+
+  Status Lookup(const ArrayData& data, int32_t* ids) const override {
+    auto visit_value = [&](util::optional<Scalar> v) -> Status {
+      *ids++ = v.has_value() ? memo_table_.Get(*v) : memo_table_.GetNull();
+      return Status::OK();
+    };
+    return VisitArrayDataInline<Type>(data, std::move(visit_value));
+  }
+
+  int32_t size() const override { return memo_table_.size(); }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) const override {
+    return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, memo_table_,
+                                                          0 /* start_offset */, out);
+  }
+
+ protected:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  MemoTable memo_table_;
+};
+
+class NullKeyEncoder : public KeyEncoder {
+ public:
+  Status Encode(const ArrayData& data, int32_t* ids) override {
+    std::fill(ids, ids + data.length, 0);
+    seen_ = seen_ || data.length > 0;
+    return Status::OK();
+  }
+
+  Status Lookup(const ArrayData& data, int32_t* ids) const override {
+    std::fill(ids, ids + data.length, seen_ ? 0 : internal::kKeyNotFound);
+    return Status::OK();
+  }
+
+  int32_t size() const override { return seen_ ? 1 : 0; }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) const override {
+    *out = std::make_shared<NullArray>(size())->data();
+    return Status::OK();
+  }
+
+ protected:
+  bool seen_ = false;
+};
+
+template <typename Type, typename Enable = void>
+struct KeyEncoderTraits {};
+
+template <typename Type>
+struct KeyEncoderTraits<Type, enable_if_null<Type>> {
+  using EncoderType = NullKeyEncoder;
+};
+
+template <typename Type>
+struct KeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using EncoderType = RegularKeyEncoder<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct KeyEncoderTraits<Type, enable_if_has_string_view<Type>> {
+  using EncoderType = RegularKeyEncoder<Type, util::string_view>;
+};
+
+template <typename EncoderType>
+std::unique_ptr<KeyEncoder> MakeKeyEncoderImpl(const std::shared_ptr<DataType>& type,
+                                               MemoryPool* pool) {
+  return std::unique_ptr<KeyEncoder>(new EncoderType(type, pool));
+}
+
+template <>
+std::unique_ptr<KeyEncoder> MakeKeyEncoderImpl<NullKeyEncoder>(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool) {
+  return std::unique_ptr<KeyEncoder>(new NullKeyEncoder());
+}
+
+#define PROCESS_SUPPORTED_KEY_TYPES(PROCESS) \
+  PROCESS(NullType)                          \
+  PROCESS(BooleanType)                       \
+  PROCESS(UInt8Type)                         \
+  PROCESS(Int8Type)                          \
+  PROCESS(UInt16Type)                        \
+  PROCESS(Int16Type)                         \
+  PROCESS(UInt32Type)                        \
+  PROCESS(Int32Type)                         \
+  PROCESS(UInt64Type)                        \
+  PROCESS(Int64Type)                         \
+  PROCESS(FloatType)                         \
+  PROCESS(DoubleType)                        \
+  PROCESS(Date32Type)                        \
+  PROCESS(Date64Type)                        \
+  PROCESS(Time32Type)                        \
+  PROCESS(Time64Type)                        \
+  PROCESS(TimestampType)                     \
+  PROCESS(BinaryType)                        \
+  PROCESS(LargeBinaryType)                   \
+  PROCESS(StringType)                        \
+  PROCESS(LargeStringType)                   \
+  PROCESS(FixedSizeBinaryType)               \
+  PROCESS(Decimal128Type)
+
+Status MakeKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                      std::unique_ptr<KeyEncoder>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                                            \
+  case InType::type_id:                                                            \
+    *out = MakeKeyEncoderImpl<typename KeyEncoderTraits<InType>::EncoderType>(type, \
+                                                                            pool); \
+    return Status::OK();
+
+    PROCESS_SUPPORTED_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("Grouping by key of type ", type->ToString(),
+                                " not implemented");
+}
+
+#undef PROCESS_SUPPORTED_KEY_TYPES
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Grouper implementation
+
+class Grouper::Impl {
+ public:
+  Status Init(FunctionContext* ctx, const std::vector<std::shared_ptr<DataType>>& types) {
+    ctx_ = ctx;
+    encoders_.resize(types.size());
+    for (size_t i = 0; i < types.size(); ++i) {
+      RETURN_NOT_OK(MakeKeyEncoder(types[i], ctx->memory_pool(), &encoders_[i]));
+    }
+    if (types.size() > 1) {
+      composite_memo_table_.reset(new CompositeMemoTable(ctx->memory_pool(), 0));
+      group_key_ids_.resize(types.size());
+    }
+    return Status::OK();
+  }
+
+  int32_t num_groups() const {
+    if (composite_memo_table_) {
+      return composite_memo_table_->size();
+    }
+    return encoders_[0]->size();
+  }
+
+  Status Consume(const ArrayVector& keys, int64_t length,
+                 std::vector<int32_t>* group_ids) {
+    group_ids->resize(length);
+    if (!composite_memo_table_) {
+      // Single key: its key ids are the group ids
+      return encoders_[0]->Encode(*keys[0]->data(), group_ids->data());
+    }
+
+    // Several keys: encode each key column separately, then memoize the
+    // concatenation of the per-column key ids
+    const size_t num_keys = keys.size();
+    key_ids_.resize(num_keys);
+    for (size_t i = 0; i < num_keys; ++i) {
+      key_ids_[i].resize(length);
+      RETURN_NOT_OK(encoders_[i]->Encode(*keys[i]->data(), key_ids_[i].data()));
+    }
+    // Lay the key ids out row by row, and memoize all rows in one batch
+    rows_.resize(length * num_keys);
+    for (size_t i = 0; i < num_keys; ++i) {
+      for (int64_t row = 0; row < length; ++row) {
+        rows_[row * num_keys + i] = key_ids_[i][row];
+      }
+    }
+    const auto row_size = num_keys * sizeof(int32_t);
+    const char* rows = reinterpret_cast<const char*>(rows_.data());
+    const int32_t first_new_group = composite_memo_table_->size();
+    RETURN_NOT_OK(composite_memo_table_->GetOrInsertBatch(
+        length,
+        [&](int64_t row) { return util::string_view(rows + row * row_size, row_size); },
+        group_ids->data()));
+
+    // New groups are numbered in the order of their first rows
+    int32_t next_new_group = first_new_group;
+    for (int64_t row = 0; row < length; ++row) {
+      if ((*group_ids)[row] == next_new_group) {
+        for (size_t i = 0; i < num_keys; ++i) {
+          group_key_ids_[i].push_back(key_ids_[i][row]);
+        }
+        ++next_new_group;
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Lookup(const ArrayVector& keys, int64_t length,
+                std::vector<int32_t>* group_ids) const {
+    group_ids->resize(length);
+    if (!composite_memo_table_) {
+      return encoders_[0]->Lookup(*keys[0]->data(), group_ids->data());
+    }
+
+    const size_t num_keys = keys.size();
+    std::vector<std::vector<int32_t>> key_ids(num_keys);
+    for (size_t i = 0; i < num_keys; ++i) {
+      key_ids[i].resize(length);
+      RETURN_NOT_OK(encoders_[i]->Lookup(*keys[i]->data(), key_ids[i].data()));
+    }
+    std::vector<int32_t> row_ids(num_keys);
+    const auto row_size = static_cast<int32_t>(num_keys * sizeof(int32_t));
+    for (int64_t row = 0; row < length; ++row) {
+      bool found = true;
+      for (size_t i = 0; i < num_keys; ++i) {
+        row_ids[i] = key_ids[i][row];
+        found = found && row_ids[i] != internal::kKeyNotFound;
+      }
+      // If any key value is unseen, so is the combination
+      (*group_ids)[row] = found ? composite_memo_table_->Get(row_ids.data(), row_size)
+                                : internal::kKeyNotFound;
+    }
+    return Status::OK();
+  }
+
+  Status GetUniques(ArrayVector* out) const {
+    out->resize(encoders_.size());
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      std::shared_ptr<ArrayData> uniques;
+      RETURN_NOT_OK(encoders_[i]->GetUniques(&uniques));
+      if (!composite_memo_table_) {
+        (*out)[i] = MakeArray(uniques);
+        continue;
+      }
+      // Several keys: take the key values of each group from the uniques
+      Int32Array indices(static_cast<int64_t>(group_key_ids_[i].size()),
+                         Buffer::Wrap(group_key_ids_[i]));
+      RETURN_NOT_OK(Take(ctx_, *MakeArray(uniques), indices, TakeOptions(), &(*out)[i]));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  using CompositeMemoTable = internal::BinaryMemoTable<BinaryBuilder>;
+
+  FunctionContext* ctx_;
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+  // Only used with several key columns
+  std::unique_ptr<CompositeMemoTable> composite_memo_table_;
+  std::vector<std::vector<int32_t>> group_key_ids_;
+  std::vector<std::vector<int32_t>> key_ids_;
+  std::vector<int32_t> rows_;
+};
+
+Grouper::Grouper() : impl_(new Impl()) {}
+
+Grouper::~Grouper() {}
+
+Status Grouper::Init(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& types) {
+  return impl_->Init(ctx, types);
+}
+
+int32_t Grouper::num_groups() const { return impl_->num_groups(); }
+
+Status Grouper::Consume(const ArrayVector& keys, int64_t length,
+                        std::vector<int32_t>* group_ids) {
+  return impl_->Consume(keys, length, group_ids);
+}
+
+Status Grouper::Lookup(const ArrayVector& keys, int64_t length,
+                       std::vector<int32_t>* group_ids) const {
+  return impl_->Lookup(keys, length, group_ids);
+}
+
+Status Grouper::GetUniques(ArrayVector* out) const { return impl_->GetUniques(out); }
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
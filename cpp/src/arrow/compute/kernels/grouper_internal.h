@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+namespace detail {
+
+/// \brief Map each row of one or more key columns to a dense group id
+///
+/// Group ids are assigned in order of first appearance, starting from 0.
+/// A null key value is a distinct key value.  Key columns are hashed with
+/// the memo tables from arrow/util/hashing.h.
+class ARROW_EXPORT Grouper {
+ public:
+  Grouper();
+  ~Grouper();
+
+  Status Init(FunctionContext* ctx, const std::vector<std::shared_ptr<DataType>>& types);
+
+  /// \brief The number of groups seen so far
+  int32_t num_groups() const;
+
+  /// \brief Compute the group id of each row, creating new groups as needed
+  Status Consume(const ArrayVector& keys, int64_t length,
+                 std::vector<int32_t>* group_ids);
+
+  /// \brief Compute the group id of each row, without creating new groups
+  ///
+  /// Rows whose key values were never consumed get group id -1.
+  Status Lookup(const ArrayVector& keys, int64_t length,
+                std::vector<int32_t>* group_ids) const;
+
+  /// \brief The key values of each group, one array per key column
+  Status GetUniques(ArrayVector* out) const;
+
+ protected:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
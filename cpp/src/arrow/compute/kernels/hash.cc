@@ -29,18 +29,25 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/dict_internal.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash64.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
 #include "arrow/visitor_inline.h"
 
@@ -612,6 +619,259 @@ Status ValueCounts(FunctionContext* ctx, const Datum& value,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Partitioned, multi-threaded hash kernels
+
+constexpr int32_t ParallelHashOptions::kMaxPartitions;
+
+namespace {
+
+// Another mixing round (MurmurHash3's finalizer) before the partition is taken
+// from the high bits of a hash.  The memo table of a partition indexes its
+// slots with the low bits of the same hashes, which must stay well
+// distributed within the partition, and the high bits of Hash64() for
+// integers only depend on the low byte of the value.
+inline uint64_t MixHash(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb53fe1a85ec3ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+Status GetNumPartitions(const ParallelHashOptions& options, int32_t* out) {
+  int32_t num_partitions = options.num_partitions;
+  if (num_partitions == 0) {
+    const int64_t capacity = internal::GetCpuThreadPool()->GetCapacity();
+    num_partitions = static_cast<int32_t>(std::min<int64_t>(
+        BitUtil::NextPower2(std::max<int64_t>(capacity, 1)),
+        ParallelHashOptions::kMaxPartitions));
+  } else if (num_partitions < 0 ||
+             num_partitions > ParallelHashOptions::kMaxPartitions ||
+             !BitUtil::IsPowerOf2(static_cast<int64_t>(num_partitions))) {
+    return Status::Invalid("The number of partitions must be a power of two no greater ",
+                           "than ", ParallelHashOptions::kMaxPartitions, ", got ",
+                           num_partitions);
+  }
+  *out = num_partitions;
+  return Status::OK();
+}
+
+// The chunks of a datum, each reordered by hash partition with a single
+// Take(), so that the values of partition p in a chunk are a zero-copy slice
+// of the reordered chunk.
+class HashPartitions {
+ public:
+  HashPartitions(FunctionContext* ctx, int32_t num_partitions)
+      : ctx_(ctx), num_partitions_(num_partitions) {}
+
+  Status Init(const Datum& value) {
+    DCHECK_GT(num_partitions_, 1);
+    type_ = value.type();
+    if (value.kind() == Datum::ARRAY) {
+      chunks_ = {value.make_array()};
+    } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+      chunks_ = value.chunked_array()->chunks();
+    } else {
+      return Status::Invalid("Expected array-like input");
+    }
+    const int num_chunks = static_cast<int>(chunks_.size());
+    indices_.resize(num_chunks);
+    offsets_.resize(num_chunks);
+    sorted_chunks_.resize(num_chunks);
+    return internal::OptionalParallelFor(num_chunks > 1, num_chunks,
+                                         [this](int i) { return PartitionChunk(i); });
+  }
+
+  int num_chunks() const { return static_cast<int>(chunks_.size()); }
+
+  // The values of partition p, with one (possibly empty) chunk per chunk of
+  // the input
+  std::shared_ptr<ChunkedArray> partition(int32_t p) const {
+    ArrayVector slices;
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      slices.push_back(
+          sorted_chunks_[i]->Slice(offsets_[i][p], offsets_[i][p + 1] - offsets_[i][p]));
+    }
+    return std::make_shared<ChunkedArray>(std::move(slices), type_);
+  }
+
+  // Assemble the dictionary-encoded chunk i from the encoded partitions,
+  // whose indices are shifted by the offsets of their dictionaries into the
+  // concatenated one.  Nulls are encoded as nulls, so the validity bitmap is
+  // that of the input.
+  Status ScatterIndices(int i, const std::vector<std::shared_ptr<ChunkedArray>>& encoded,
+                        const std::vector<int32_t>& dictionary_offsets,
+                        const std::shared_ptr<DataType>& dict_type,
+                        const std::shared_ptr<Array>& dict,
+                        std::shared_ptr<Array>* out) const {
+    const Array& chunk = *chunks_[i];
+    const int64_t length = chunk.length();
+    MemoryPool* pool = ctx_->memory_pool();
+    std::shared_ptr<Buffer> validity;
+    if (chunk.null_count() > 0) {
+      if (chunk.null_bitmap_data() != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(validity,
+                              internal::CopyBitmap(pool, chunk.null_bitmap_data(),
+                                                   chunk.offset(), length));
+      } else {
+        // Null type
+        ARROW_ASSIGN_OR_RAISE(validity, AllocateEmptyBitmap(length, pool));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices_buf,
+                          AllocateBuffer(length * sizeof(int32_t), pool));
+    auto indices = reinterpret_cast<int32_t*>(indices_buf->mutable_data());
+
+    const int64_t* positions = indices_[i]->data()->GetValues<int64_t>(1);
+    for (int32_t p = 0; p < num_partitions_; ++p) {
+      const auto& encoded_chunk =
+          checked_cast<const DictionaryArray&>(*encoded[p]->chunk(i));
+      const int32_t* partition_indices =
+          encoded_chunk.indices()->data()->GetValues<int32_t>(1);
+      const int64_t* partition_positions = positions + offsets_[i][p];
+      for (int64_t j = 0; j < encoded_chunk.length(); ++j) {
+        indices[partition_positions[j]] = partition_indices[j] + dictionary_offsets[p];
+      }
+    }
+    auto indices_array = std::make_shared<Int32Array>(length, std::move(indices_buf),
+                                                      std::move(validity),
+                                                      chunk.null_count());
+    *out = std::make_shared<DictionaryArray>(dict_type, indices_array, dict);
+    return Status::OK();
+  }
+
+ private:
+  Status PartitionChunk(int i) {
+    const Array& chunk = *chunks_[i];
+    std::shared_ptr<Array> hashes;
+    RETURN_NOT_OK(Hash64(ctx_, chunk, &hashes));
+
+    // Radix-partition on the high bits of the hashes, in place
+    const int shift = 64 - BitUtil::Log2(static_cast<uint64_t>(num_partitions_));
+    auto ids = hashes->data()->GetMutableValues<uint64_t>(1);
+    for (int64_t j = 0; j < hashes->length(); ++j) {
+      ids[j] = MixHash(ids[j]) >> shift;
+    }
+    RETURN_NOT_OK(
+        PartitionIndices(ctx_, *hashes, num_partitions_, &indices_[i], &offsets_[i]));
+    return Take(ctx_, chunk, *indices_[i], TakeOptions(), &sorted_chunks_[i]);
+  }
+
+  FunctionContext* ctx_;
+  int32_t num_partitions_;
+  std::shared_ptr<DataType> type_;
+  ArrayVector chunks_;
+  ArrayVector indices_;
+  std::vector<std::vector<int64_t>> offsets_;
+  ArrayVector sorted_chunks_;
+};
+
+}  // namespace
+
+Status ParallelUnique(FunctionContext* ctx, const ParallelHashOptions& options,
+                      const Datum& value, std::shared_ptr<Array>* out) {
+  int32_t num_partitions;
+  RETURN_NOT_OK(GetNumPartitions(options, &num_partitions));
+  if (num_partitions == 1) {
+    return Unique(ctx, value, out);
+  }
+  HashPartitions partitions(ctx, num_partitions);
+  RETURN_NOT_OK(partitions.Init(value));
+
+  ArrayVector uniques(num_partitions);
+  RETURN_NOT_OK(internal::ParallelFor(num_partitions, [&](int p) {
+    return Unique(ctx, partitions.partition(p), &uniques[p]);
+  }));
+  return Concatenate(uniques, ctx->memory_pool(), out);
+}
+
+Status ParallelValueCounts(FunctionContext* ctx, const ParallelHashOptions& options,
+                           const Datum& value, std::shared_ptr<Array>* counts) {
+  int32_t num_partitions;
+  RETURN_NOT_OK(GetNumPartitions(options, &num_partitions));
+  if (num_partitions == 1) {
+    return ValueCounts(ctx, value, counts);
+  }
+  HashPartitions partitions(ctx, num_partitions);
+  RETURN_NOT_OK(partitions.Init(value));
+
+  std::vector<ArrayVector> fields(2, ArrayVector(num_partitions));
+  RETURN_NOT_OK(internal::ParallelFor(num_partitions, [&](int p) {
+    std::shared_ptr<Array> partition_counts;
+    RETURN_NOT_OK(ValueCounts(ctx, partitions.partition(p), &partition_counts));
+    const auto& struct_array = checked_cast<const StructArray&>(*partition_counts);
+    fields[kValuesFieldIndex][p] = struct_array.field(kValuesFieldIndex);
+    fields[kCountsFieldIndex][p] = struct_array.field(kCountsFieldIndex);
+    return Status::OK();
+  }));
+
+  std::shared_ptr<Array> uniques, value_counts;
+  RETURN_NOT_OK(Concatenate(fields[kValuesFieldIndex], ctx->memory_pool(), &uniques));
+  RETURN_NOT_OK(
+      Concatenate(fields[kCountsFieldIndex], ctx->memory_pool(), &value_counts));
+  auto data_type = std::make_shared<StructType>(std::vector<std::shared_ptr<Field>>{
+      std::make_shared<Field>(kValuesFieldName, uniques->type()),
+      std::make_shared<Field>(kCountsFieldName, int64())});
+  *counts = std::make_shared<StructArray>(
+      data_type, uniques->length(),
+      std::vector<std::shared_ptr<Array>>{uniques, value_counts});
+  return Status::OK();
+}
+
+Status ParallelDictionaryEncode(FunctionContext* ctx, const ParallelHashOptions& options,
+                                const Datum& value, Datum* out) {
+  int32_t num_partitions;
+  RETURN_NOT_OK(GetNumPartitions(options, &num_partitions));
+  if (num_partitions == 1) {
+    return DictionaryEncode(ctx, value, out);
+  }
+  HashPartitions partitions(ctx, num_partitions);
+  RETURN_NOT_OK(partitions.Init(value));
+
+  // Encode each partition against a dictionary of its own
+  std::vector<std::shared_ptr<ChunkedArray>> encoded(num_partitions);
+  RETURN_NOT_OK(internal::ParallelFor(num_partitions, [&](int p) {
+    Datum partition_encoded;
+    RETURN_NOT_OK(DictionaryEncode(ctx, partitions.partition(p), &partition_encoded));
+    encoded[p] = partition_encoded.chunked_array();
+    return Status::OK();
+  }));
+
+  // Concatenate the dictionaries; the indices of partition p are shifted by
+  // the lengths of the dictionaries before it
+  ArrayVector dictionaries(num_partitions);
+  std::vector<int32_t> dictionary_offsets(num_partitions, 0);
+  for (int32_t p = 0; p < num_partitions; ++p) {
+    const auto& type = checked_cast<const DictionaryType&>(*encoded[p]->type());
+    if (encoded[p]->num_chunks() > 0) {
+      dictionaries[p] = checked_cast<const DictionaryArray&>(*encoded[p]->chunk(0))
+                            .dictionary();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(dictionaries[p],
+                            MakeArrayOfNull(type.value_type(), 0, ctx->memory_pool()));
+    }
+    if (p + 1 < num_partitions) {
+      dictionary_offsets[p + 1] =
+          dictionary_offsets[p] + static_cast<int32_t>(dictionaries[p]->length());
+    }
+  }
+  std::shared_ptr<Array> dict;
+  RETURN_NOT_OK(Concatenate(dictionaries, ctx->memory_pool(), &dict));
+  auto dict_type = dictionary(int32(), dict->type());
+
+  // Remap the indices and scatter them back to the positions of their values
+  ArrayVector dict_chunks(partitions.num_chunks());
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      partitions.num_chunks() > 1, partitions.num_chunks(), [&](int i) {
+        return partitions.ScatterIndices(i, encoded, dictionary_offsets, dict_type,
+                                         dict, &dict_chunks[i]);
+      }));
+  *out = detail::WrapArraysLike(value, dict_type, dict_chunks);
+  return Status::OK();
+}
+
 #undef PROCESS_SUPPORTED_HASH_TYPES
 
 }  // namespace compute
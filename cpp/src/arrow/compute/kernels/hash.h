@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "arrow/compute/kernel.h"
@@ -79,6 +80,81 @@ Status ValueCounts(FunctionContext* context, const Datum& value,
 ARROW_EXPORT
 Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out);
 
+/// \class ParallelHashOptions
+///
+/// Parameters of the partitioned, multi-threaded hash kernels.
+struct ARROW_EXPORT ParallelHashOptions {
+  static constexpr int32_t kMaxPartitions = 256;
+
+  explicit ParallelHashOptions(int32_t num_partitions = 0)
+      : num_partitions(num_partitions) {}
+
+  /// The number of partitions, a power of two no greater than kMaxPartitions,
+  /// or 0 to pick the capacity of the CPU thread pool rounded up to a power
+  /// of two
+  int32_t num_partitions;
+};
+
+/// \brief Compute unique elements from an array-like object, using several
+/// threads
+///
+/// Values are radix-partitioned by hash, so that equal values fall into the
+/// same partition, and the unique values of each partition are computed
+/// concurrently on the CPU thread pool, each into a hash table of its own.
+/// The result holds the same values as Unique(), but grouped by partition
+/// rather than in order of first occurrence.  With a single partition, this
+/// is Unique().
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options see ParallelHashOptions
+/// \param[in] datum array-like input
+/// \param[out] out result as Array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ParallelUnique(FunctionContext* context, const ParallelHashOptions& options,
+                      const Datum& datum, std::shared_ptr<Array>* out);
+
+/// \brief Return counts of unique elements from an array-like object, using
+/// several threads
+///
+/// See ParallelUnique().  The result holds the same <"values", "counts">
+/// structs as ValueCounts(), grouped by partition.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options see ParallelHashOptions
+/// \param[in] value array-like input
+/// \param[out] counts An array of  <input type "Values", int64_t "Counts"> structs.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ParallelValueCounts(FunctionContext* context, const ParallelHashOptions& options,
+                           const Datum& value, std::shared_ptr<Array>* counts);
+
+/// \brief Dictionary-encode values in an array-like object, using several
+/// threads
+///
+/// The values of each partition (see ParallelUnique()) are encoded
+/// concurrently against a dictionary of their own.  The dictionaries are
+/// concatenated, and the indices remapped into the concatenated dictionary
+/// and scattered back to the positions of their values.  The result
+/// represents the same values as DictionaryEncode(), with the dictionary
+/// grouped by partition.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options see ParallelHashOptions
+/// \param[in] data array-like input
+/// \param[out] out result with same shape and type as input
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ParallelDictionaryEncode(FunctionContext* context,
+                                const ParallelHashOptions& options, const Datum& data,
+                                Datum* out);
+
 // TODO(wesm): Define API for incremental dictionary encoding
 
 // TODO(wesm): Define API for regularizing DictionaryArray objects with
@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/compute/kernels/hash64.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// The hash of all nulls
+constexpr uint64_t kNullHash = 0x9e3779b97f4a7c15ULL;
+
+inline uint64_t HashInteger(uint64_t value) {
+  return internal::ScalarHelper<uint64_t, 0>::ComputeHash(value);
+}
+
+// As boost::hash_combine, widened to 64 bits
+inline uint64_t CombineHashes(uint64_t seed, uint64_t hash) {
+  return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+// Writes the hash of each value of an array to out.  Fixed-width values are
+// hashed in branch-free loops over the raw values, which compilers
+// vectorize; nulls are patched afterwards.
+class ArrayHasher {
+ public:
+  ArrayHasher(FunctionContext* ctx, const ArrayData& data, uint64_t* out)
+      : ctx_(ctx), data_(data), out_(out) {}
+
+  Status Hash() {
+    RETURN_NOT_OK(VisitTypeInline(*data_.type, this));
+    // Null and dictionary arrays handle nulls themselves
+    if (data_.type->id() != Type::NA && data_.type->id() != Type::DICTIONARY &&
+        data_.GetNullCount() > 0) {
+      PatchNulls(data_, out_);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    std::fill(out_, out_ + data_.length, kNullHash);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const uint8_t* bits = data_.buffers[1]->data();
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = HashInteger(BitUtil::GetBit(bits, data_.offset + i));
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<has_c_type<T>::value && !is_boolean_type<T>::value &&
+                  std::is_integral<typename T::c_type>::value,
+              Status>
+  Visit(const T&) {
+    using c_type = typename T::c_type;
+    const c_type* values = data_.GetValues<c_type>(1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = HashInteger(static_cast<uint64_t>(values[i]));
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_physical_floating_point<T, Status> Visit(const T&) {
+    using c_type = typename T::c_type;
+    using UInt = typename std::conditional<sizeof(c_type) == 4, uint32_t, uint64_t>::type;
+    const c_type* values = data_.GetValues<c_type>(1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      // Equal values must hash alike: map -0.0 to 0.0 and all NaNs to one
+      c_type value = values[i] == 0 ? 0 : values[i];
+      value = std::isnan(value) ? std::numeric_limits<c_type>::quiet_NaN() : value;
+      UInt bits;
+      memcpy(&bits, &value, sizeof(bits));
+      out_[i] = HashInteger(bits);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DayTimeIntervalType&) {
+    const uint64_t* values = data_.GetValues<uint64_t>(1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      uint64_t value;
+      memcpy(&value, values + i, sizeof(value));
+      out_[i] = HashInteger(value);
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    using offset_type = typename T::offset_type;
+    const offset_type* offsets = data_.GetValues<offset_type>(1);
+    const uint8_t* values = data_.buffers[2] ? data_.buffers[2]->data() : nullptr;
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = internal::ComputeStringHash<0>(values + offsets[i],
+                                               offsets[i + 1] - offsets[i]);
+    }
+    return Status::OK();
+  }
+
+  // Also handles decimals
+  template <typename T>
+  enable_if_fixed_size_binary<T, Status> Visit(const T& type) {
+    const int32_t byte_width = type.byte_width();
+    const uint8_t* values = data_.GetValues<uint8_t>(1, data_.offset * byte_width);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = internal::ComputeStringHash<0>(values + i * byte_width, byte_width);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    // Hash each dictionary value once, then gather the hashes by index
+    const Array& dictionary = *data_.dictionary;
+    ARROW_ASSIGN_OR_RAISE(
+        auto dictionary_hashes,
+        AllocateBuffer(dictionary.length() * sizeof(uint64_t), ctx_->memory_pool()));
+    auto raw_dictionary_hashes =
+        reinterpret_cast<uint64_t*>(dictionary_hashes->mutable_data());
+    RETURN_NOT_OK(
+        ArrayHasher(ctx_, *dictionary.data(), raw_dictionary_hashes).Hash());
+
+    switch (type.index_type()->id()) {
+      case Type::INT8:
+        return GatherHashes<int8_t>(raw_dictionary_hashes);
+      case Type::INT16:
+        return GatherHashes<int16_t>(raw_dictionary_hashes);
+      case Type::INT32:
+        return GatherHashes<int32_t>(raw_dictionary_hashes);
+      case Type::INT64:
+        return GatherHashes<int64_t>(raw_dictionary_hashes);
+      default:
+        return Status::TypeError("Invalid dictionary index type: ", *type.index_type());
+    }
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Hash64 of values of type ", type);
+  }
+
+ private:
+  template <typename IndexType>
+  Status GatherHashes(const uint64_t* dictionary_hashes) {
+    const IndexType* indices = data_.GetValues<IndexType>(1);
+    if (data_.GetNullCount() == 0) {
+      for (int64_t i = 0; i < data_.length; ++i) {
+        out_[i] = dictionary_hashes[indices[i]];
+      }
+    } else {
+      // The indices of null slots may be out of bounds
+      const uint8_t* validity = data_.buffers[0]->data();
+      for (int64_t i = 0; i < data_.length; ++i) {
+        out_[i] = BitUtil::GetBit(validity, data_.offset + i)
+                      ? dictionary_hashes[indices[i]]
+                      : kNullHash;
+      }
+    }
+    return Status::OK();
+  }
+
+  static void PatchNulls(const ArrayData& data, uint64_t* out) {
+    auto patch = [&](bool valid) {
+      if (!valid) {
+        *out = kNullHash;
+      }
+      ++out;
+    };
+    internal::VisitBitsUnrolled(data.buffers[0]->data(), data.offset, data.length,
+                                patch);
+  }
+
+  FunctionContext* ctx_;
+  const ArrayData& data_;
+  uint64_t* out_;
+};
+
+}  // namespace
+
+Status Hash64(FunctionContext* ctx, const Array& values, std::shared_ptr<Array>* hashes) {
+  return Hash64(ctx, ArrayVector{MakeArray(values.data())}, hashes);
+}
+
+Status Hash64(FunctionContext* ctx, const ArrayVector& keys,
+              std::shared_ptr<Array>* hashes) {
+  if (keys.empty()) {
+    return Status::Invalid("Hash64 needs at least one key column");
+  }
+  const int64_t length = keys[0]->length();
+  for (const auto& key : keys) {
+    if (key->length() != length) {
+      return Status::Invalid("Hash64 key columns must have the same length");
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out,
+                        AllocateBuffer(length * sizeof(uint64_t), ctx->memory_pool()));
+  auto raw_out = reinterpret_cast<uint64_t*>(out->mutable_data());
+  RETURN_NOT_OK(ArrayHasher(ctx, *keys[0]->data(), raw_out).Hash());
+
+  if (keys.size() > 1) {
+    // Hash the other columns one at a time into scratch space, combining
+    // each into the output in a separate loop, so that both loops stay tight
+    ARROW_ASSIGN_OR_RAISE(
+        auto scratch, AllocateBuffer(length * sizeof(uint64_t), ctx->memory_pool()));
+    auto raw_scratch = reinterpret_cast<uint64_t*>(scratch->mutable_data());
+    for (size_t k = 1; k < keys.size(); ++k) {
+      RETURN_NOT_OK(ArrayHasher(ctx, *keys[k]->data(), raw_scratch).Hash());
+      for (int64_t i = 0; i < length; ++i) {
+        raw_out[i] = CombineHashes(raw_out[i], raw_scratch[i]);
+      }
+    }
+  }
+
+  *hashes = std::make_shared<UInt64Array>(length, std::move(out));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
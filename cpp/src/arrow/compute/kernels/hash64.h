@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Compute a 64-bit hash of each value of an array
+///
+/// Equal values get equal hashes, which makes the hashes suitable for hash
+/// partitioning, joins, group-by and Bloom filters.  In particular, values of
+/// a dictionary array are hashed through their dictionary, -0.0 and 0.0 hash
+/// alike, and so do all NaNs.  All nulls get the same hash; the output has no
+/// nulls.  The hashes are not stable across Arrow versions.
+///
+/// Supported types are null, boolean, integer, floating point, temporal,
+/// (large) binary and string, fixed size binary, decimal and dictionary of
+/// those.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to hash
+/// \param[out] hashes uint64 array of the same length as values
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Hash64(FunctionContext* ctx, const Array& values, std::shared_ptr<Array>* hashes);
+
+/// \brief Compute a 64-bit hash of each row of one or more key columns
+///
+/// The hashes of the columns, computed as by Hash64() on a single array, are
+/// combined row by row in an order-dependent way.  Hashing a single column
+/// gives the same result as Hash64() on that column.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] keys arrays of the same length to hash
+/// \param[out] hashes uint64 array of the same length as the keys
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Hash64(FunctionContext* ctx, const ArrayVector& keys,
+              std::shared_ptr<Array>* hashes);
+
+}  // namespace compute
+}  // namespace arrow
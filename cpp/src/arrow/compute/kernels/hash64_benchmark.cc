@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash64.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+static void BenchmarkHash64(benchmark::State& state,  // NOLINT non-const reference
+                            const ArrayVector& keys, int64_t nbytes) {
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> hashes;
+    ABORT_NOT_OK(Hash64(&ctx, keys, &hashes));
+    benchmark::DoNotOptimize(hashes);
+  }
+
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * nbytes);
+  state.SetItemsProcessed(state.iterations() * keys[0]->length());
+}
+
+template <typename ArrowType>
+static void Hash64Numeric(benchmark::State& state) {  // NOLINT non-const reference
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(CType);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Numeric<ArrowType>(array_size, -100, 100, null_percent);
+
+  BenchmarkHash64(state, {values}, memory_size);
+}
+
+static void Hash64Int64(benchmark::State& state) {  // NOLINT non-const reference
+  Hash64Numeric<Int64Type>(state);
+}
+
+static void Hash64Int32(benchmark::State& state) {  // NOLINT non-const reference
+  Hash64Numeric<Int32Type>(state);
+}
+
+static void Hash64Double(benchmark::State& state) {  // NOLINT non-const reference
+  Hash64Numeric<DoubleType>(state);
+}
+
+static void Hash64String(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t memory_size = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  // Strings of 0 to 32 bytes, 16 on average
+  auto values = rand.String(memory_size / 16, 0, 32, null_percent);
+
+  BenchmarkHash64(state, {values}, memory_size);
+}
+
+static void Hash64ThreeColumns(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / (2 * sizeof(int64_t) + 16);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  ArrayVector keys = {rand.Numeric<Int64Type>(array_size, -100, 100, null_percent),
+                      rand.String(array_size, 0, 32, null_percent),
+                      rand.Numeric<DoubleType>(array_size, -100, 100, null_percent)};
+
+  BenchmarkHash64(state, keys, memory_size);
+}
+
+BENCHMARK(Hash64Int64)->Apply(RegressionSetArgs);
+BENCHMARK(Hash64Int32)->Apply(RegressionSetArgs);
+BENCHMARK(Hash64Double)->Apply(RegressionSetArgs);
+BENCHMARK(Hash64String)->Apply(RegressionSetArgs);
+BENCHMARK(Hash64ThreeColumns)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
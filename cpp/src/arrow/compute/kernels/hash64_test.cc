@@ -0,0 +1,191 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash64.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestHash64 : public ComputeFixture, public ::testing::Test {
+ protected:
+  std::vector<uint64_t> Hashes(const ArrayVector& keys) {
+    std::shared_ptr<Array> hashes;
+    ARROW_EXPECT_OK(Hash64(&ctx_, keys, &hashes));
+    ARROW_EXPECT_OK(hashes->ValidateFull());
+    EXPECT_TRUE(hashes->type()->Equals(uint64()));
+    EXPECT_EQ(hashes->length(), keys[0]->length());
+    EXPECT_EQ(hashes->null_count(), 0);
+    const auto& typed_hashes = checked_cast<const UInt64Array&>(*hashes);
+    return std::vector<uint64_t>(typed_hashes.raw_values(),
+                                 typed_hashes.raw_values() + hashes->length());
+  }
+
+  std::vector<uint64_t> Hashes(const std::shared_ptr<Array>& values) {
+    return Hashes(ArrayVector{values});
+  }
+
+  // Check that equal values, and only them, hash alike
+  void CheckHashes(const std::shared_ptr<DataType>& type, const std::string& json) {
+    auto values = ArrayFromJSON(type, json);
+    auto hashes = Hashes(values);
+    for (int64_t i = 0; i < values->length(); ++i) {
+      for (int64_t j = 0; j < values->length(); ++j) {
+        ASSERT_EQ(values->RangeEquals(i, i + 1, j, values), hashes[i] == hashes[j])
+            << "values " << i << " and " << j << " of " << *values;
+      }
+    }
+
+    // Slices hash as the values they contain
+    auto sliced_hashes = Hashes(values->Slice(1));
+    ASSERT_EQ(sliced_hashes, std::vector<uint64_t>(hashes.begin() + 1, hashes.end()));
+  }
+};
+
+TEST_F(TestHash64, Integers) {
+  for (const auto& type : {int8(), uint8(), int16(), uint16(), int32(), uint32(),
+                           int64(), uint64()}) {
+    CheckHashes(type, "[1, 2, null, 0, 1, 127, null, 2]");
+  }
+}
+
+TEST_F(TestHash64, Temporal) {
+  CheckHashes(date32(), "[1, 2, null, 0, 1]");
+  CheckHashes(date64(), "[86400000, 0, null, 86400000]");
+  CheckHashes(timestamp(TimeUnit::SECOND), "[1, 2, null, 0, 1]");
+  CheckHashes(time64(TimeUnit::NANO), "[1, 2, null, 0, 1]");
+}
+
+TEST_F(TestHash64, Boolean) {
+  CheckHashes(boolean(), "[true, false, null, false, true, null]");
+}
+
+TEST_F(TestHash64, Null) {
+  auto hashes = Hashes(ArrayFromJSON(null(), "[null, null, null]"));
+  ASSERT_EQ(hashes[0], hashes[1]);
+  ASSERT_EQ(hashes[0], hashes[2]);
+  // Nulls of any type hash alike
+  ASSERT_EQ(hashes[0], Hashes(ArrayFromJSON(utf8(), "[null]"))[0]);
+  ASSERT_EQ(hashes[0], Hashes(ArrayFromJSON(int32(), "[null]"))[0]);
+}
+
+template <typename ArrowType>
+class TestHash64FloatingPoint : public TestHash64 {};
+
+using FloatingPointTypes = ::testing::Types<FloatType, DoubleType>;
+
+TYPED_TEST_SUITE(TestHash64FloatingPoint, FloatingPointTypes);
+
+TYPED_TEST(TestHash64FloatingPoint, Basics) {
+  using c_type = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  this->CheckHashes(type, "[1.5, 2.0, null, 0.0, 1.5, -1.5]");
+
+  // Equal values hash alike, whatever their bit representation
+  const c_type nan = std::numeric_limits<c_type>::quiet_NaN();
+  std::shared_ptr<Array> values;
+  ArrayFromVector<TypeParam, c_type>({0, -static_cast<c_type>(0), nan, -nan, 1},
+                                     &values);
+  auto hashes = this->Hashes(values);
+  ASSERT_EQ(hashes[0], hashes[1]);
+  ASSERT_EQ(hashes[2], hashes[3]);
+  ASSERT_NE(hashes[0], hashes[2]);
+  ASSERT_NE(hashes[0], hashes[4]);
+}
+
+TEST_F(TestHash64, Binary) {
+  for (const auto& type : {binary(), utf8(), large_binary(), large_utf8()}) {
+    CheckHashes(type, R"(["foo", "", null, "bar", "foo", "a much longer value", ""])");
+  }
+  // Binary and string values hash alike, regardless of the offset width
+  ASSERT_EQ(Hashes(ArrayFromJSON(utf8(), R"(["foo"])")),
+            Hashes(ArrayFromJSON(large_binary(), R"(["foo"])")));
+}
+
+TEST_F(TestHash64, FixedSizeBinary) {
+  CheckHashes(fixed_size_binary(3), R"(["foo", "bar", null, "foo", "baz"])");
+  CheckHashes(decimal(10, 2), R"(["1.23", "-4.56", null, "1.23", "0.00"])");
+}
+
+TEST_F(TestHash64, Dictionary) {
+  auto dict_type = dictionary(int16(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["b", null, "a"])");
+  auto indices = ArrayFromJSON(int16(), "[0, 2, null, 1, 0]");
+  ASSERT_OK_AND_ASSIGN(auto values,
+                       DictionaryArray::FromArrays(dict_type, indices, dict));
+
+  // Dictionary values hash as the values they stand for
+  auto expected = Hashes(ArrayFromJSON(utf8(), R"(["b", "a", null, null, "b"])"));
+  ASSERT_EQ(Hashes(values), expected);
+  ASSERT_EQ(Hashes(values->Slice(2)),
+            std::vector<uint64_t>(expected.begin() + 2, expected.end()));
+}
+
+TEST_F(TestHash64, MultipleColumns) {
+  auto a = ArrayFromJSON(int32(), "[1, 1, 2, null, 1, null]");
+  auto b = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", "x", "x"])");
+  auto hashes = Hashes({a, b});
+  // Rows 0 and 4 are equal, rows 3 and 5 too
+  ASSERT_EQ(hashes[0], hashes[4]);
+  ASSERT_EQ(hashes[3], hashes[5]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[2]);
+  ASSERT_NE(hashes[0], hashes[3]);
+
+  // A single column hashes as Hash64() on an array
+  ASSERT_EQ(Hashes(ArrayVector{a}), Hashes(a));
+
+  // The combination depends on the order of the columns
+  auto c = ArrayFromJSON(int32(), "[3, 4, 5, 6, 7, 8]");
+  auto d = ArrayFromJSON(int32(), "[8, 7, 6, 5, 4, 3]");
+  auto cd = Hashes({c, d});
+  auto dc = Hashes({d, c});
+  for (size_t i = 0; i < cd.size(); ++i) {
+    ASSERT_NE(cd[i], dc[i]);
+  }
+}
+
+TEST_F(TestHash64, Errors) {
+  std::shared_ptr<Array> hashes;
+  ASSERT_RAISES(Invalid, Hash64(&ctx_, ArrayVector{}, &hashes));
+  ASSERT_RAISES(Invalid, Hash64(&ctx_,
+                                {ArrayFromJSON(int32(), "[1, 2]"),
+                                 ArrayFromJSON(int32(), "[1, 2, 3]")},
+                                &hashes));
+  ASSERT_RAISES(NotImplemented,
+                Hash64(&ctx_, *ArrayFromJSON(list(int32()), "[[1], [2]]"), &hashes));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,276 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_join.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/grouper_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+std::vector<std::shared_ptr<DataType>> ColumnTypes(const Table& table) {
+  std::vector<std::shared_ptr<DataType>> types;
+  for (const auto& field : table.schema()->fields()) {
+    types.push_back(field->type());
+  }
+  return types;
+}
+
+Status CheckKeys(const Table& left_keys, const Table& right_keys) {
+  if (left_keys.num_columns() == 0) {
+    return Status::Invalid("HashJoin needs at least one key column");
+  }
+  if (left_keys.num_columns() != right_keys.num_columns()) {
+    return Status::Invalid("HashJoin got ", left_keys.num_columns(),
+                           " left key columns and ", right_keys.num_columns(),
+                           " right key columns");
+  }
+  for (int i = 0; i < left_keys.num_columns(); ++i) {
+    const auto& left_type = left_keys.schema()->field(i)->type();
+    const auto& right_type = right_keys.schema()->field(i)->type();
+    if (!left_type->Equals(*right_type)) {
+      return Status::TypeError("HashJoin key column #", i, " has type ",
+                               left_type->ToString(), " on the left and ",
+                               right_type->ToString(), " on the right");
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Build side: for each distinct key, the (ascending) indices of the right
+// rows having that key
+
+class JoinHashTable {
+ public:
+  Status Build(FunctionContext* ctx, const Table& keys) {
+    RETURN_NOT_OK(grouper_.Init(ctx, ColumnTypes(keys)));
+
+    // Group id of each right row, or -1 if it has a null key value
+    std::vector<int32_t> row_group_ids;
+    row_group_ids.reserve(static_cast<size_t>(keys.num_rows()));
+    std::vector<int32_t> group_ids;
+    TableBatchReader reader(keys);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      const auto columns = batch->columns();
+      RETURN_NOT_OK(grouper_.Consume(columns, batch->num_rows(), &group_ids));
+      for (const auto& column : columns) {
+        if (column->null_count() == 0) {
+          continue;
+        }
+        for (int64_t i = 0; i < column->length(); ++i) {
+          if (column->IsNull(i)) {
+            group_ids[i] = -1;
+          }
+        }
+      }
+      row_group_ids.insert(row_group_ids.end(), group_ids.begin(), group_ids.end());
+    }
+
+    // Lay out the row indices of each group contiguously (counting sort)
+    const int32_t num_groups = grouper_.num_groups();
+    group_offsets_.assign(num_groups + 1, 0);
+    for (int32_t group_id : row_group_ids) {
+      if (group_id >= 0) {
+        ++group_offsets_[group_id + 1];
+      }
+    }
+    for (int32_t i = 0; i < num_groups; ++i) {
+      group_offsets_[i + 1] += group_offsets_[i];
+    }
+    row_indices_.resize(static_cast<size_t>(group_offsets_[num_groups]));
+    std::vector<int64_t> positions(group_offsets_.begin(), group_offsets_.end() - 1);
+    for (size_t row = 0; row < row_group_ids.size(); ++row) {
+      const int32_t group_id = row_group_ids[row];
+      if (group_id >= 0) {
+        row_indices_[positions[group_id]++] = static_cast<int64_t>(row);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Compute the group id of each row of `keys`, or -1 if there is none
+  Status Probe(const ArrayVector& keys, int64_t length,
+               std::vector<int32_t>* group_ids) const {
+    // Groups of keys having a null value have no rows, hence never match
+    return grouper_.Lookup(keys, length, group_ids);
+  }
+
+  // The right row indices of group `group_id`, as a [begin, end) range
+  const int64_t* begin(int32_t group_id) const {
+    return row_indices_.data() + group_offsets_[group_id];
+  }
+  const int64_t* end(int32_t group_id) const {
+    return row_indices_.data() + group_offsets_[group_id + 1];
+  }
+
+ protected:
+  detail::Grouper grouper_;
+  std::vector<int64_t> group_offsets_;
+  std::vector<int64_t> row_indices_;
+};
+
+Status SelectColumns(const Table& table, const std::vector<std::string>& names,
+                     std::shared_ptr<Table>* out) {
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (const auto& name : names) {
+    const int index = table.schema()->GetFieldIndex(name);
+    if (index == -1) {
+      return Status::Invalid("HashJoin key column '", name, "' not found in ",
+                             table.schema()->ToString());
+    }
+    fields.push_back(table.schema()->field(index));
+    columns.push_back(table.column(index));
+  }
+  *out = Table::Make(schema(std::move(fields)), std::move(columns), table.num_rows());
+  return Status::OK();
+}
+
+}  // namespace
+
+Status HashJoinIndices(FunctionContext* ctx, HashJoinOptions::JoinType join_type,
+                       const Table& left_keys, const Table& right_keys,
+                       std::shared_ptr<Array>* left_indices,
+                       std::shared_ptr<Array>* right_indices) {
+  RETURN_NOT_OK(CheckKeys(left_keys, right_keys));
+
+  JoinHashTable hash_table;
+  RETURN_NOT_OK(hash_table.Build(ctx, right_keys));
+
+  const bool emit_pairs =
+      join_type == HashJoinOptions::INNER || join_type == HashJoinOptions::LEFT_OUTER;
+  Int64Builder left_builder(ctx->memory_pool());
+  Int64Builder right_builder(ctx->memory_pool());
+  RETURN_NOT_OK(left_builder.Reserve(left_keys.num_rows()));
+  if (emit_pairs) {
+    RETURN_NOT_OK(right_builder.Reserve(left_keys.num_rows()));
+  }
+
+  std::vector<int32_t> group_ids;
+  TableBatchReader reader(left_keys);
+  std::shared_ptr<RecordBatch> batch;
+  int64_t row_offset = 0;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    const int64_t length = batch->num_rows();
+    RETURN_NOT_OK(hash_table.Probe(batch->columns(), length, &group_ids));
+    for (int64_t i = 0; i < length; ++i) {
+      const int32_t group_id = group_ids[i];
+      const int64_t* begin = group_id >= 0 ? hash_table.begin(group_id) : nullptr;
+      const int64_t* end = group_id >= 0 ? hash_table.end(group_id) : nullptr;
+      const int64_t left_index = row_offset + i;
+      switch (join_type) {
+        case HashJoinOptions::INNER:
+        case HashJoinOptions::LEFT_OUTER:
+          for (const int64_t* it = begin; it != end; ++it) {
+            RETURN_NOT_OK(left_builder.Append(left_index));
+            RETURN_NOT_OK(right_builder.Append(*it));
+          }
+          if (begin == end && join_type == HashJoinOptions::LEFT_OUTER) {
+            RETURN_NOT_OK(left_builder.Append(left_index));
+            RETURN_NOT_OK(right_builder.AppendNull());
+          }
+          break;
+        case HashJoinOptions::LEFT_SEMI:
+          if (begin != end) {
+            RETURN_NOT_OK(left_builder.Append(left_index));
+          }
+          break;
+        case HashJoinOptions::LEFT_ANTI:
+          if (begin == end) {
+            RETURN_NOT_OK(left_builder.Append(left_index));
+          }
+          break;
+      }
+    }
+    row_offset += length;
+  }
+
+  RETURN_NOT_OK(left_builder.Finish(left_indices));
+  if (emit_pairs) {
+    RETURN_NOT_OK(right_builder.Finish(right_indices));
+  } else {
+    right_indices->reset();
+  }
+  return Status::OK();
+}
+
+Status HashJoin(FunctionContext* ctx, const Table& left, const Table& right,
+                const HashJoinOptions& options, std::shared_ptr<Table>* out) {
+  if (options.left_keys.size() != options.right_keys.size()) {
+    return Status::Invalid("HashJoin got ", options.left_keys.size(),
+                           " left keys and ", options.right_keys.size(),
+                           " right keys");
+  }
+  std::shared_ptr<Table> left_keys, right_keys;
+  RETURN_NOT_OK(SelectColumns(left, options.left_keys, &left_keys));
+  RETURN_NOT_OK(SelectColumns(right, options.right_keys, &right_keys));
+
+  std::shared_ptr<Array> left_indices, right_indices;
+  RETURN_NOT_OK(HashJoinIndices(ctx, options.join_type, *left_keys, *right_keys,
+                                &left_indices, &right_indices));
+
+  std::shared_ptr<Table> left_taken;
+  RETURN_NOT_OK(Take(ctx, left, *left_indices, TakeOptions(), &left_taken));
+  if (right_indices == nullptr) {
+    *out = std::move(left_taken);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Table> right_taken;
+  RETURN_NOT_OK(Take(ctx, right, *right_indices, TakeOptions(), &right_taken));
+  auto fields = left.schema()->fields();
+  auto columns = left_taken->columns();
+  for (int i = 0; i < right.num_columns(); ++i) {
+    auto field = right.schema()->field(i);
+    if (options.join_type == HashJoinOptions::LEFT_OUTER) {
+      field = field->WithNullable(true);
+    }
+    fields.push_back(std::move(field));
+    columns.push_back(right_taken->column(i));
+  }
+  *out = Table::Make(schema(std::move(fields)), std::move(columns),
+                     left_indices->length());
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+/// \class HashJoinOptions
+struct ARROW_EXPORT HashJoinOptions {
+  enum JoinType {
+    /// Emit a row for each pair of matching left and right rows
+    INNER = 0,
+    /// Like INNER, but also emit unmatched left rows, with null right columns
+    LEFT_OUTER,
+    /// Emit each left row having at least one match, with left columns only
+    LEFT_SEMI,
+    /// Emit each left row having no match, with left columns only
+    LEFT_ANTI
+  };
+
+  HashJoinOptions(JoinType join_type, std::vector<std::string> left_keys,
+                  std::vector<std::string> right_keys)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)) {}
+
+  JoinType join_type;
+  /// Names of the key columns in the left table
+  std::vector<std::string> left_keys;
+  /// Names of the key columns in the right table, one per left key column
+  std::vector<std::string> right_keys;
+};
+
+/// \brief Compute the row indices of matching rows of two sets of key columns
+///
+/// A hash table is built over the right keys, and probed with the left keys.
+/// Two rows match if all their key values are equal; a null key value
+/// never matches.  The matches are returned as two parallel int64 arrays
+/// of row indices, suitable for passing to Take(), in left row order:
+/// - for INNER, the indices of each matching (left, right) pair;
+/// - for LEFT_OUTER, the same as INNER plus (left, null) for each unmatched
+///   left row;
+/// - for LEFT_SEMI and LEFT_ANTI, only left indices are computed and
+///   `right_indices` is set to null.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] join_type the kind of join
+/// \param[in] left_keys table of the left key columns
+/// \param[in] right_keys table of the right key columns, with the same types
+/// \param[out] left_indices row indices into the left table
+/// \param[out] right_indices row indices into the right table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoinIndices(FunctionContext* ctx, HashJoinOptions::JoinType join_type,
+                       const Table& left_keys, const Table& right_keys,
+                       std::shared_ptr<Array>* left_indices,
+                       std::shared_ptr<Array>* right_indices);
+
+/// \brief Join two tables on equality of key columns
+///
+/// The output has the columns of the left table followed, except for
+/// LEFT_SEMI and LEFT_ANTI joins, by the columns of the right table.
+/// It is materialized by calling Take() on both tables with the indices
+/// computed by HashJoinIndices().
+///
+/// For example given left = {"k": [1, 2, 3], "x": ["a", "b", "c"]},
+/// right = {"k": [3, 1, 1], "y": [true, false, null]} and an INNER join
+/// on "k", the output will be
+/// {"k": [1, 1, 3], "x": ["a", "a", "c"], "k": [1, 1, 3], "y": [false, null, true]}.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the left (probe) table
+/// \param[in] right the right (build) table
+/// \param[in] options the join type and key columns
+/// \param[out] out the joined table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const Table& left, const Table& right,
+                const HashJoinOptions& options, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,176 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ComputeFixture, public ::testing::Test {
+ protected:
+  void SetUp() override {
+    left_ = TableFromJSON(schema({field("k", int32()), field("x", utf8())}),
+                          {R"([{"k": 1, "x": "a"}, {"k": 2, "x": "b"}])",
+                           R"([{"k": 3, "x": "c"}, {"k": null, "x": "d"},
+                               {"k": 1, "x": "e"}])"});
+    right_ = TableFromJSON(schema({field("k", int32()), field("y", boolean())}),
+                           {R"([{"k": 3, "y": true}, {"k": 1, "y": false}])",
+                            R"([{"k": null, "y": true}, {"k": 1, "y": null}])"});
+  }
+
+  void CheckIndices(HashJoinOptions::JoinType join_type, const Table& left_keys,
+                    const Table& right_keys, const std::string& expected_left,
+                    const std::string& expected_right) {
+    std::shared_ptr<Array> left_indices, right_indices;
+    ASSERT_OK(HashJoinIndices(&ctx_, join_type, left_keys, right_keys, &left_indices,
+                              &right_indices));
+    ASSERT_OK(left_indices->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(int64(), expected_left), *left_indices,
+                      /*verbose=*/true);
+    if (expected_right.empty()) {
+      ASSERT_EQ(right_indices, nullptr);
+    } else {
+      ASSERT_OK(right_indices->ValidateFull());
+      AssertArraysEqual(*ArrayFromJSON(int64(), expected_right), *right_indices,
+                        /*verbose=*/true);
+    }
+  }
+
+  void CheckJoin(HashJoinOptions::JoinType join_type,
+                 const std::shared_ptr<Schema>& expected_schema,
+                 const std::string& expected_json) {
+    std::shared_ptr<Table> actual;
+    HashJoinOptions options(join_type, {"k"}, {"k"});
+    ASSERT_OK(HashJoin(&ctx_, *left_, *right_, options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertTablesEqual(*TableFromJSON(expected_schema, {expected_json}), *actual,
+                      /*same_chunk_layout=*/false);
+  }
+
+  std::shared_ptr<Table> left_, right_;
+};
+
+TEST_F(TestHashJoin, Indices) {
+  auto left_keys = TableFromJSON(schema({field("k", utf8())}),
+                                 {R"([{"k": "a"}, {"k": "b"}, {"k": null}])",
+                                  R"([{"k": "c"}, {"k": "a"}])"});
+  auto right_keys = TableFromJSON(
+      schema({field("k", utf8())}),
+      {R"([{"k": "a"}, {"k": null}, {"k": "c"}, {"k": "a"}])"});
+
+  CheckIndices(HashJoinOptions::INNER, *left_keys, *right_keys, "[0, 0, 3, 4, 4]",
+               "[0, 3, 2, 0, 3]");
+  CheckIndices(HashJoinOptions::LEFT_OUTER, *left_keys, *right_keys,
+               "[0, 0, 1, 2, 3, 4, 4]", "[0, 3, null, null, 2, 0, 3]");
+  CheckIndices(HashJoinOptions::LEFT_SEMI, *left_keys, *right_keys, "[0, 3, 4]", "");
+  CheckIndices(HashJoinOptions::LEFT_ANTI, *left_keys, *right_keys, "[1, 2]", "");
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  auto key_schema = schema({field("a", int64()), field("b", utf8())});
+  auto left_keys = TableFromJSON(key_schema, {R"([
+    {"a": 1, "b": "x"}, {"a": 1, "b": "y"}, {"a": 2, "b": "x"},
+    {"a": null, "b": "x"}, {"a": 3, "b": "z"}
+  ])"});
+  auto right_keys = TableFromJSON(key_schema, {R"([
+    {"a": 2, "b": "x"}, {"a": 1, "b": "x"}, {"a": null, "b": "x"},
+    {"a": 1, "b": "z"}, {"a": 2, "b": "x"}
+  ])"});
+
+  CheckIndices(HashJoinOptions::INNER, *left_keys, *right_keys, "[0, 2, 2]",
+               "[1, 0, 4]");
+  CheckIndices(HashJoinOptions::LEFT_ANTI, *left_keys, *right_keys, "[1, 3, 4]", "");
+}
+
+TEST_F(TestHashJoin, EmptyTables) {
+  auto empty = TableFromJSON(schema({field("k", int32())}), {"[]"});
+  auto keys = TableFromJSON(schema({field("k", int32())}), {R"([{"k": 1}])"});
+
+  CheckIndices(HashJoinOptions::INNER, *keys, *empty, "[]", "[]");
+  CheckIndices(HashJoinOptions::LEFT_OUTER, *keys, *empty, "[0]", "[null]");
+  CheckIndices(HashJoinOptions::LEFT_ANTI, *keys, *empty, "[0]", "");
+  CheckIndices(HashJoinOptions::INNER, *empty, *keys, "[]", "[]");
+}
+
+TEST_F(TestHashJoin, Inner) {
+  auto expected_schema = schema({field("k", int32()), field("x", utf8()),
+                                 field("k", int32()), field("y", boolean())});
+  CheckJoin(HashJoinOptions::INNER, expected_schema, R"([
+    [1, "a", 1, false],
+    [1, "a", 1, null],
+    [3, "c", 3, true],
+    [1, "e", 1, false],
+    [1, "e", 1, null]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  auto expected_schema = schema({field("k", int32()), field("x", utf8()),
+                                 field("k", int32()), field("y", boolean())});
+  CheckJoin(HashJoinOptions::LEFT_OUTER, expected_schema, R"([
+    [1, "a", 1, false],
+    [1, "a", 1, null],
+    [2, "b", null, null],
+    [3, "c", 3, true],
+    [null, "d", null, null],
+    [1, "e", 1, false],
+    [1, "e", 1, null]
+  ])");
+}
+
+TEST_F(TestHashJoin, SemiAndAnti) {
+  auto expected_schema = left_->schema();
+  CheckJoin(HashJoinOptions::LEFT_SEMI, expected_schema,
+            R"([[1, "a"], [3, "c"], [1, "e"]])");
+  CheckJoin(HashJoinOptions::LEFT_ANTI, expected_schema, R"([[2, "b"], [null, "d"]])");
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::shared_ptr<Table> out;
+  // Unknown key column
+  ASSERT_RAISES(Invalid, HashJoin(&ctx_, *left_, *right_,
+                                  HashJoinOptions(HashJoinOptions::INNER, {"z"}, {"k"}),
+                                  &out));
+  // Mismatching number of keys
+  ASSERT_RAISES(Invalid, HashJoin(&ctx_, *left_, *right_,
+                                  HashJoinOptions(HashJoinOptions::INNER, {"k", "x"},
+                                                  {"k"}),
+                                  &out));
+  // No keys
+  ASSERT_RAISES(Invalid, HashJoin(&ctx_, *left_, *right_,
+                                  HashJoinOptions(HashJoinOptions::INNER, {}, {}), &out));
+  // Mismatching key types
+  ASSERT_RAISES(TypeError, HashJoin(&ctx_, *left_, *right_,
+                                    HashJoinOptions(HashJoinOptions::INNER, {"x"}, {"k"}),
+                                    &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -21,6 +21,7 @@
 #include <functional>
 #include <locale>
 #include <memory>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -43,6 +44,8 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/test_util.h"
 
@@ -685,5 +688,153 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+// ----------------------------------------------------------------------
+// Partitioned, multi-threaded hash kernels
+
+class TestParallelHashKernel : public ComputeFixture, public ::testing::Test {
+ protected:
+  // Chunks of random values, with duplicates and nulls
+  std::shared_ptr<ChunkedArray> RandomValues(const std::shared_ptr<DataType>& type,
+                                             int num_chunks, int64_t chunk_length) {
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int32_t> value_dist(0, 1000);
+    std::bernoulli_distribution null_dist(0.05);
+    ArrayVector chunks;
+    for (int i = 0; i < num_chunks; ++i) {
+      std::vector<bool> is_valid(chunk_length);
+      std::vector<int64_t> values(chunk_length);
+      std::vector<std::string> strings(chunk_length);
+      for (int64_t j = 0; j < chunk_length; ++j) {
+        is_valid[j] = !null_dist(engine);
+        values[j] = value_dist(engine) * 256;
+        strings[j] = "value" + std::to_string(values[j]);
+      }
+      std::shared_ptr<Array> chunk;
+      if (type->id() == Type::STRING) {
+        ArrayFromVector<StringType, std::string>(is_valid, strings, &chunk);
+      } else {
+        ArrayFromVector<Int64Type, int64_t>(is_valid, values, &chunk);
+      }
+      chunks.push_back(chunk);
+    }
+    return std::make_shared<ChunkedArray>(chunks, type);
+  }
+
+  // The parallel kernels group their results by partition
+  std::shared_ptr<Array> SortIndices(const Array& values) {
+    std::shared_ptr<Array> indices;
+    ABORT_NOT_OK(SortToIndices(&ctx_, values, &indices));
+    return indices;
+  }
+
+  std::shared_ptr<Array> Sorted(const Array& values, const Array& indices) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Take(&ctx_, values, indices, TakeOptions(), &out));
+    return out;
+  }
+
+  void CheckUnique(const Datum& values, const ParallelHashOptions& options) {
+    std::shared_ptr<Array> expected, result;
+    ASSERT_OK(Unique(&ctx_, values, &expected));
+    ASSERT_OK(ParallelUnique(&ctx_, options, values, &result));
+    ASSERT_OK(result->ValidateFull());
+    AssertArraysEqual(*Sorted(*expected, *SortIndices(*expected)),
+                      *Sorted(*result, *SortIndices(*result)));
+  }
+
+  void CheckValueCounts(const Datum& values, const ParallelHashOptions& options) {
+    std::shared_ptr<Array> expected, result;
+    ASSERT_OK(ValueCounts(&ctx_, values, &expected));
+    ASSERT_OK(ParallelValueCounts(&ctx_, options, values, &result));
+    ASSERT_OK(result->ValidateFull());
+    ASSERT_TRUE(result->type()->Equals(expected->type()));
+    const auto& expected_struct = checked_cast<const StructArray&>(*expected);
+    const auto& result_struct = checked_cast<const StructArray&>(*result);
+    auto expected_indices = SortIndices(*expected_struct.field(kValuesFieldIndex));
+    auto result_indices = SortIndices(*result_struct.field(kValuesFieldIndex));
+    for (int32_t i : {kValuesFieldIndex, kCountsFieldIndex}) {
+      AssertArraysEqual(*Sorted(*expected_struct.field(i), *expected_indices),
+                        *Sorted(*result_struct.field(i), *result_indices));
+    }
+  }
+
+  void CheckDictionaryEncode(const Datum& values, const ParallelHashOptions& options) {
+    Datum expected, result;
+    ASSERT_OK(DictionaryEncode(&ctx_, values, &expected));
+    ASSERT_OK(ParallelDictionaryEncode(&ctx_, options, values, &result));
+    ASSERT_EQ(result.kind(), values.kind());
+    ASSERT_TRUE(result.type()->Equals(expected.type()));
+
+    ArrayVector value_chunks, expected_chunks, result_chunks;
+    if (values.kind() == Datum::ARRAY) {
+      value_chunks = {values.make_array()};
+      expected_chunks = {expected.make_array()};
+      result_chunks = {result.make_array()};
+    } else {
+      value_chunks = values.chunked_array()->chunks();
+      expected_chunks = expected.chunked_array()->chunks();
+      result_chunks = result.chunked_array()->chunks();
+    }
+    ASSERT_EQ(result_chunks.size(), value_chunks.size());
+    for (size_t i = 0; i < result_chunks.size(); ++i) {
+      ASSERT_OK(result_chunks[i]->ValidateFull());
+      const auto& dict_array = checked_cast<const DictionaryArray&>(*result_chunks[i]);
+      // All chunks share one dictionary, without duplicates
+      const auto& dict = dict_array.dictionary();
+      ASSERT_EQ(dict.get(), checked_cast<const DictionaryArray&>(*result_chunks[0])
+                                .dictionary()
+                                .get());
+      ASSERT_EQ(dict->length(),
+                checked_cast<const DictionaryArray&>(*expected_chunks[i])
+                    .dictionary()
+                    ->length());
+
+      // Decoding gives back the values
+      AssertArraysEqual(*value_chunks[i], *Sorted(*dict, *dict_array.indices()));
+    }
+  }
+
+  void CheckAll(const Datum& values, const ParallelHashOptions& options) {
+    CheckUnique(values, options);
+    CheckValueCounts(values, options);
+    CheckDictionaryEncode(values, options);
+  }
+};
+
+TEST_F(TestParallelHashKernel, Basics) {
+  auto values = ArrayFromJSON(int64(), "[3, 1, null, 3, 2, 1, 1, null]");
+  for (int32_t num_partitions : {0, 1, 2, 4, 16}) {
+    ParallelHashOptions options(num_partitions);
+    CheckAll(values, options);
+    CheckAll(std::make_shared<ChunkedArray>(ArrayVector{values, values->Slice(2, 3)}),
+             options);
+    CheckAll(std::make_shared<ChunkedArray>(ArrayVector{}, int64()), options);
+    CheckAll(ArrayFromJSON(utf8(), R"(["a", "bc", null, "a", ""])"), options);
+  }
+}
+
+TEST_F(TestParallelHashKernel, Random) {
+  for (const auto& type : {int64(), utf8()}) {
+    auto values = RandomValues(type, 5, 2000);
+    for (int32_t num_partitions : {2, 8, 256}) {
+      ParallelHashOptions options(num_partitions);
+      CheckAll(values, options);
+      CheckAll(values->chunk(0)->Slice(3), options);
+    }
+  }
+}
+
+TEST_F(TestParallelHashKernel, InvalidOptions) {
+  auto values = ArrayFromJSON(int64(), "[1, 2]");
+  std::shared_ptr<Array> out;
+  Datum datum_out;
+  for (int32_t num_partitions : {-1, 3, 512}) {
+    ParallelHashOptions options(num_partitions);
+    ASSERT_RAISES(Invalid, ParallelUnique(&ctx_, options, values, &out));
+    ASSERT_RAISES(Invalid, ParallelValueCounts(&ctx_, options, values, &out));
+    ASSERT_RAISES(Invalid, ParallelDictionaryEncode(&ctx_, options, values, &datum_out));
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
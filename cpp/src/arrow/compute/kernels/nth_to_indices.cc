@@ -18,10 +18,16 @@
 #include "arrow/compute/kernels/nth_to_indices.h"
 
 #include <algorithm>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/string_view.h"
 
 namespace arrow {
 
@@ -136,5 +142,231 @@ Status NthToIndices(FunctionContext* ctx, const Array& values, int64_t n,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Top-K selection
+
+namespace {
+
+using internal::checked_cast;
+
+// How candidate values are retained: views into binary arrays can't outlive
+// the consumed batch, so these values are copied
+template <typename ArrowType, typename Enable = void>
+struct TopKValueTraits {
+  using ValueType = typename ArrowType::c_type;
+  using ViewType = ValueType;
+
+  static ValueType Copy(ViewType v) { return v; }
+  static ViewType View(const ValueType& v) { return v; }
+};
+
+template <typename ArrowType>
+struct TopKValueTraits<ArrowType, enable_if_base_binary<ArrowType>> {
+  using ValueType = std::string;
+  using ViewType = util::string_view;
+
+  static ValueType Copy(ViewType v) { return ValueType(v.data(), v.size()); }
+  static ViewType View(const ValueType& v) { return ViewType(v); }
+};
+
+template <typename ArrowType>
+class TopKSelectorImpl final : public TopKSelector {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using Traits = TopKValueTraits<ArrowType>;
+  using ValueType = typename Traits::ValueType;
+  using ViewType = typename Traits::ViewType;
+
+  struct Candidate {
+    ValueType value;
+    int64_t index;
+  };
+
+ public:
+  TopKSelectorImpl(std::shared_ptr<DataType> type, int64_t k, SortOrder order)
+      : type_(std::move(type)), k_(k), descending_(order == SortOrder::DESCENDING) {}
+
+  Status Consume(const Array& values, int64_t offset) override {
+    if (!values.type()->Equals(*type_)) {
+      return Status::TypeError("TopKSelector expected values of type ", *type_,
+                               ", got ", *values.type());
+    }
+    if (k_ == 0) {
+      return Status::OK();
+    }
+    const auto& array = checked_cast<const ArrayType&>(values);
+    const bool may_have_nulls = array.null_count() > 0;
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (may_have_nulls && array.IsNull(i)) {
+        AddNull(offset + i);
+        continue;
+      }
+      const ViewType value = array.GetView(i);
+      // Once pruned, values worse than the K-th kept candidate can be skipped.
+      // Equal values are kept, as batches may be consumed out of order.
+      if (has_threshold_ && IsBetter(Traits::View(threshold_), value)) {
+        continue;
+      }
+      candidates_.push_back(Candidate{Traits::Copy(value), offset + i});
+      if (static_cast<int64_t>(candidates_.size()) >= 2 * k_) {
+        PruneCandidates();
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const TopKSelector& other) override {
+    if (&other == this) {
+      return Status::Invalid("Cannot merge a TopKSelector into itself");
+    }
+    auto other_impl = dynamic_cast<const TopKSelectorImpl*>(&other);
+    if (other_impl == NULLPTR || !other_impl->type_->Equals(*type_) ||
+        other_impl->k_ != k_ || other_impl->descending_ != descending_) {
+      return Status::Invalid(
+          "Can only merge TopKSelectors with the same type, K and order");
+    }
+    if (k_ == 0) {
+      return Status::OK();
+    }
+    for (const auto& candidate : other_impl->candidates_) {
+      candidates_.push_back(candidate);
+      if (static_cast<int64_t>(candidates_.size()) >= 2 * k_) {
+        PruneCandidates();
+      }
+    }
+    for (const auto index : other_impl->null_indices_) {
+      AddNull(index);
+    }
+    return Status::OK();
+  }
+
+  Status Finish(FunctionContext* ctx, std::shared_ptr<Array>* offsets) override {
+    if (static_cast<int64_t>(candidates_.size()) > k_) {
+      PruneCandidates();
+    }
+    auto better = [this](const Candidate& left, const Candidate& right) {
+      return IsBetter(left, right);
+    };
+    std::sort(candidates_.begin(), candidates_.end(), better);
+
+    // Nulls only complete the selection if there are less than K values
+    const int64_t num_values = static_cast<int64_t>(candidates_.size());
+    const int64_t num_nulls = std::min(static_cast<int64_t>(null_indices_.size()),
+                                       k_ - num_values);
+    std::partial_sort(null_indices_.begin(), null_indices_.begin() + num_nulls,
+                      null_indices_.end());
+
+    const int64_t length = num_values + num_nulls;
+    ARROW_ASSIGN_OR_RAISE(auto indices_buf,
+                          AllocateBuffer(length * sizeof(uint64_t), ctx->memory_pool()));
+    auto indices = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
+    for (int64_t i = 0; i < num_values; ++i) {
+      indices[i] = candidates_[i].index;
+    }
+    std::copy(null_indices_.begin(), null_indices_.begin() + num_nulls,
+              indices + num_values);
+    *offsets = std::make_shared<UInt64Array>(length, std::move(indices_buf));
+    return Status::OK();
+  }
+
+ private:
+  bool IsBetter(ViewType left, ViewType right) const {
+    return descending_ ? right < left : left < right;
+  }
+
+  bool IsBetter(const Candidate& left, const Candidate& right) const {
+    const ViewType left_value = Traits::View(left.value);
+    const ViewType right_value = Traits::View(right.value);
+    if (IsBetter(left_value, right_value)) {
+      return true;
+    }
+    if (IsBetter(right_value, left_value)) {
+      return false;
+    }
+    return left.index < right.index;
+  }
+
+  // Keep the K best candidates, and remember the worst of them
+  void PruneCandidates() {
+    auto better = [this](const Candidate& left, const Candidate& right) {
+      return IsBetter(left, right);
+    };
+    auto kth = candidates_.begin() + (k_ - 1);
+    std::nth_element(candidates_.begin(), kth, candidates_.end(), better);
+    candidates_.erase(kth + 1, candidates_.end());
+    threshold_ = kth->value;
+    has_threshold_ = true;
+  }
+
+  void AddNull(int64_t index) {
+    null_indices_.push_back(index);
+    if (static_cast<int64_t>(null_indices_.size()) >= 2 * k_) {
+      // Keep the K first nulls
+      std::nth_element(null_indices_.begin(), null_indices_.begin() + (k_ - 1),
+                       null_indices_.end());
+      null_indices_.resize(k_);
+    }
+  }
+
+  std::shared_ptr<DataType> type_;
+  const int64_t k_;
+  const bool descending_;
+  std::vector<Candidate> candidates_;
+  std::vector<int64_t> null_indices_;
+  bool has_threshold_ = false;
+  ValueType threshold_{};
+};
+
+}  // namespace
+
+#define TOPK_MAKE_CASE(T)                                \
+  case T::type_id:                                       \
+    out->reset(new TopKSelectorImpl<T>(type, k, order)); \
+    return Status::OK();
+
+Status TopKSelector::Make(const std::shared_ptr<DataType>& type, int64_t k,
+                          SortOrder order, std::unique_ptr<TopKSelector>* out) {
+  if (k < 0) {
+    return Status::Invalid("TopKSelector needs a non-negative K, got ", k);
+  }
+  switch (type->id()) {
+    TOPK_MAKE_CASE(UInt8Type);
+    TOPK_MAKE_CASE(Int8Type);
+    TOPK_MAKE_CASE(UInt16Type);
+    TOPK_MAKE_CASE(Int16Type);
+    TOPK_MAKE_CASE(UInt32Type);
+    TOPK_MAKE_CASE(Int32Type);
+    TOPK_MAKE_CASE(UInt64Type);
+    TOPK_MAKE_CASE(Int64Type);
+    TOPK_MAKE_CASE(FloatType);
+    TOPK_MAKE_CASE(DoubleType);
+    TOPK_MAKE_CASE(BinaryType);
+    TOPK_MAKE_CASE(StringType);
+    default:
+      return Status::TypeError("No TopK selection for this type ", *type);
+  }
+}
+
+#undef TOPK_MAKE_CASE
+
+Status TopKToIndices(FunctionContext* ctx, const Array& values, int64_t k,
+                     SortOrder order, std::shared_ptr<Array>* offsets) {
+  std::unique_ptr<TopKSelector> selector;
+  RETURN_NOT_OK(TopKSelector::Make(values.type(), k, order, &selector));
+  RETURN_NOT_OK(selector->Consume(values, 0));
+  return selector->Finish(ctx, offsets);
+}
+
+Status TopKToIndices(FunctionContext* ctx, const ChunkedArray& values, int64_t k,
+                     SortOrder order, std::shared_ptr<Array>* offsets) {
+  std::unique_ptr<TopKSelector> selector;
+  RETURN_NOT_OK(TopKSelector::Make(values.type(), k, order, &selector));
+  int64_t offset = 0;
+  for (const auto& chunk : values.chunks()) {
+    RETURN_NOT_OK(selector->Consume(*chunk, offset));
+    offset += chunk->length();
+  }
+  return selector->Finish(ctx, offsets);
+}
+
 }  // namespace compute
 }  // namespace arrow
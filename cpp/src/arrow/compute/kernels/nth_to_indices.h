@@ -20,7 +20,9 @@
 #include <memory>
 
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -49,5 +51,68 @@ ARROW_EXPORT
 Status NthToIndices(FunctionContext* ctx, const Array& values, int64_t n,
                     std::shared_ptr<Array>* offsets);
 
+/// \brief Streaming selection of the K first values of a sequence in sort order
+///
+/// A TopKSelector consumes values batch by batch, while only retaining a
+/// bounded number of candidates (at most 2 * K values and 2 * K nulls).
+/// Candidates are pruned with the same partitioning as NthToIndices().
+/// Independent selectors (e.g. one per thread) can be merged at the end.
+///
+/// The selected indices are those of the first K values of a stable sort of
+/// the whole sequence: ties are broken by index, and nulls are ordered after
+/// all non-null values.
+class ARROW_EXPORT TopKSelector {
+ public:
+  virtual ~TopKSelector() = default;
+
+  /// \brief Create a selector for values of the given type
+  ///
+  /// \param[in] type type of the values to select from
+  /// \param[in] k number of values to select
+  /// \param[in] order ASCENDING selects the K smallest values,
+  ///            DESCENDING the K largest
+  /// \param[out] out created selector
+  static Status Make(const std::shared_ptr<DataType>& type, int64_t k, SortOrder order,
+                     std::unique_ptr<TopKSelector>* out);
+
+  /// \brief Consume a batch of values
+  ///
+  /// \param[in] values the values
+  /// \param[in] offset index of the first value in the whole sequence
+  virtual Status Consume(const Array& values, int64_t offset) = 0;
+
+  /// \brief Consume the candidates of another selector
+  ///
+  /// The other selector must have the same type, K and order.
+  virtual Status Merge(const TopKSelector& other) = 0;
+
+  /// \brief Return the indices of the selected values, in sort order
+  ///
+  /// The output holds min(K, number of consumed values) indices.
+  virtual Status Finish(FunctionContext* ctx, std::shared_ptr<Array>* offsets) = 0;
+};
+
+/// \brief Returns the indices of the K first values of an array in sort order
+///
+/// This is equivalent to taking the K first indices of a stable
+/// SortToIndices() on the values, in the given order and with nulls at the
+/// end, but doesn't need to sort the whole array.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to select from
+/// \param[in] k number of values to select
+/// \param[in] order ASCENDING selects the K smallest values, DESCENDING the K largest
+/// \param[out] offsets sorted indices of the selected values
+ARROW_EXPORT
+Status TopKToIndices(FunctionContext* ctx, const Array& values, int64_t k,
+                     SortOrder order, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the K first values of a chunked array in sort order
+///
+/// Like TopKToIndices() on an Array, with indices spanning all chunks.
+ARROW_EXPORT
+Status TopKToIndices(FunctionContext* ctx, const ChunkedArray& values, int64_t k,
+                     SortOrder order, std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
@@ -52,6 +52,26 @@ static void NthToIndicesInt64(benchmark::State& state) {
   NthToIndicesBenchmark(state, values, array_size / 2);
 }
 
+// ORDER BY ... DESC LIMIT 100
+static void TopKToIndicesInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto min = std::numeric_limits<int64_t>::min();
+  auto max = std::numeric_limits<int64_t>::max();
+  auto values = rand.Int64(array_size, min, max, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(TopKToIndices(&ctx, *values, 100, SortOrder::DESCENDING, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * values->length());
+}
+
 BENCHMARK(NthToIndicesInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -59,5 +79,12 @@ BENCHMARK(NthToIndicesInt64)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(TopKToIndicesInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
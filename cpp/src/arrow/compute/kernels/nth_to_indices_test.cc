@@ -22,7 +22,10 @@
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/nth_to_indices.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -171,5 +174,116 @@ TYPED_TEST(TestNthToIndicesKernelRandom, NthRandomValues) {
   }
 }
 
+class TestTopKToIndices : public ComputeFixture, public TestBase {
+ protected:
+  void AssertTopK(const Array& values, int64_t k, SortOrder order,
+                  const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopKToIndices(&this->ctx_, values, k, order, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+
+  void AssertTopK(const ChunkedArray& values, int64_t k, SortOrder order,
+                  const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopKToIndices(&this->ctx_, values, k, order, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestTopKToIndices, Array) {
+  auto values = ArrayFromJSON(int32(), "[5, null, 1, 3, 1, null, 7]");
+  AssertTopK(*values, 0, SortOrder::ASCENDING, "[]");
+  AssertTopK(*values, 3, SortOrder::ASCENDING, "[2, 4, 3]");
+  AssertTopK(*values, 3, SortOrder::DESCENDING, "[6, 0, 3]");
+  AssertTopK(*values, 6, SortOrder::ASCENDING, "[2, 4, 3, 0, 6, 1]");
+  AssertTopK(*values, 10, SortOrder::DESCENDING, "[6, 0, 3, 2, 4, 1, 5]");
+
+  values = ArrayFromJSON(utf8(), R"(["b", "a", null, "ccc", "a", "bb"])");
+  AssertTopK(*values, 2, SortOrder::ASCENDING, "[1, 4]");
+  AssertTopK(*values, 3, SortOrder::DESCENDING, "[3, 5, 0]");
+
+  AssertTopK(*ArrayFromJSON(float64(), "[]"), 5, SortOrder::ASCENDING, "[]");
+}
+
+TEST_F(TestTopKToIndices, ChunkedArray) {
+  auto values =
+      ChunkedArrayFromJSON(int64(), {"[3, 1]", "[]", "[4, 1, 5]", "[9, null, 2]"});
+  AssertTopK(*values, 4, SortOrder::DESCENDING, "[5, 4, 2, 0]");
+  AssertTopK(*values, 4, SortOrder::ASCENDING, "[1, 3, 7, 0]");
+  AssertTopK(*values, 9, SortOrder::ASCENDING, "[1, 3, 7, 0, 2, 4, 5, 6]");
+}
+
+TEST_F(TestTopKToIndices, Errors) {
+  std::unique_ptr<TopKSelector> selector, other;
+  ASSERT_RAISES(Invalid,
+                TopKSelector::Make(int32(), -1, SortOrder::ASCENDING, &selector));
+  ASSERT_RAISES(TypeError,
+                TopKSelector::Make(boolean(), 1, SortOrder::ASCENDING, &selector));
+
+  ASSERT_OK(TopKSelector::Make(int32(), 2, SortOrder::ASCENDING, &selector));
+  ASSERT_RAISES(TypeError, selector->Consume(*ArrayFromJSON(int64(), "[1]"), 0));
+  ASSERT_OK(TopKSelector::Make(int32(), 3, SortOrder::ASCENDING, &other));
+  ASSERT_RAISES(Invalid, selector->Merge(*other));
+  ASSERT_RAISES(Invalid, selector->Merge(*selector));
+}
+
+template <typename ArrowType>
+class TestTopKToIndicesRandom : public ComputeFixture, public TestBase {
+ protected:
+  // The reference result: the K first indices of a stable sort
+  std::shared_ptr<Array> ExpectedTopK(const std::shared_ptr<Array>& values, int64_t k,
+                                      SortOrder order) {
+    auto batch = RecordBatch::Make(schema({field("x", values->type())}),
+                                   values->length(), {values});
+    std::shared_ptr<Array> sorted;
+    ABORT_NOT_OK(SortToIndices(&this->ctx_, *batch, {SortKey("x", order)}, &sorted));
+    return sorted->Slice(0, std::min(k, sorted->length()));
+  }
+};
+
+TYPED_TEST_SUITE(TestTopKToIndicesRandom, NthToIndicesableTypes);
+
+TYPED_TEST(TestTopKToIndicesRandom, RandomValues) {
+  Random<TypeParam> rand(0x61549226);
+  const int64_t length = 2000;
+  const int64_t chunk_length = 300;
+  for (auto null_probability : {0.0, 0.1, 0.9}) {
+    auto values = rand.Generate(length, null_probability);
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < length; offset += chunk_length) {
+      chunks.push_back(values->Slice(offset, chunk_length));
+    }
+    ChunkedArray chunked(chunks);
+
+    for (auto order : {SortOrder::ASCENDING, SortOrder::DESCENDING}) {
+      for (int64_t k : {1, 10, 250, 1500, 2500}) {
+        auto expected = this->ExpectedTopK(values, k, order);
+
+        std::shared_ptr<Array> actual;
+        ASSERT_OK(TopKToIndices(&this->ctx_, *values, k, order, &actual));
+        AssertArraysEqual(*expected, *actual);
+        ASSERT_OK(TopKToIndices(&this->ctx_, chunked, k, order, &actual));
+        AssertArraysEqual(*expected, *actual);
+
+        // Per-thread style selection: chunks are consumed out of order by
+        // two selectors, which are merged at the end
+        std::unique_ptr<TopKSelector> selectors[2];
+        for (auto& selector : selectors) {
+          ASSERT_OK(TopKSelector::Make(values->type(), k, order, &selector));
+        }
+        for (int i = static_cast<int>(chunks.size()) - 1; i >= 0; --i) {
+          ASSERT_OK(selectors[i % 2]->Consume(*chunks[i], i * chunk_length));
+        }
+        ASSERT_OK(selectors[1]->Merge(*selectors[0]));
+        ASSERT_OK(selectors[1]->Finish(&this->ctx_, &actual));
+        AssertArraysEqual(*expected, *actual);
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/compute/kernels/partition.h"
+
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash64.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+template <typename IdType>
+Status CountingSort(const ArrayData& partition_ids, int32_t num_partitions,
+                    int64_t* indices, std::vector<int64_t>* offsets) {
+  const IdType* ids = partition_ids.GetValues<IdType>(1);
+  const int64_t length = partition_ids.length;
+
+  // Count the rows of each partition, shifted by one so that the prefix sum
+  // gives the start offset of each partition
+  std::vector<int64_t> counts(num_partitions + 1, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    // Negative ids wrap around to large unsigned values
+    if (ARROW_PREDICT_FALSE(static_cast<uint64_t>(ids[i]) >=
+                            static_cast<uint64_t>(num_partitions))) {
+      return Status::IndexError("Partition id ", static_cast<int64_t>(ids[i]),
+                                " out of bounds for ", num_partitions, " partitions");
+    }
+    ++counts[ids[i] + 1];
+  }
+  for (int32_t p = 0; p < num_partitions; ++p) {
+    counts[p + 1] += counts[p];
+  }
+  *offsets = counts;
+
+  // Scatter the row indices, reusing the counts as write cursors
+  for (int64_t i = 0; i < length; ++i) {
+    indices[counts[ids[i]]++] = i;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status PartitionIndices(FunctionContext* ctx, const Array& partition_ids,
+                        int32_t num_partitions, std::shared_ptr<Array>* indices,
+                        std::vector<int64_t>* offsets) {
+  if (num_partitions <= 0) {
+    return Status::Invalid("The number of partitions must be positive, got ",
+                           num_partitions);
+  }
+  if (partition_ids.null_count() > 0) {
+    return Status::Invalid("Partition ids must not be null");
+  }
+
+  const int64_t length = partition_ids.length();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices_buf,
+                        AllocateBuffer(length * sizeof(int64_t), ctx->memory_pool()));
+  auto raw_indices = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
+  const ArrayData& ids = *partition_ids.data();
+
+  switch (partition_ids.type_id()) {
+    case Type::INT8:
+      RETURN_NOT_OK(CountingSort<int8_t>(ids, num_partitions, raw_indices, offsets));
+      break;
+    case Type::UINT8:
+      RETURN_NOT_OK(CountingSort<uint8_t>(ids, num_partitions, raw_indices, offsets));
+      break;
+    case Type::INT16:
+      RETURN_NOT_OK(CountingSort<int16_t>(ids, num_partitions, raw_indices, offsets));
+      break;
+    case Type::UINT16:
+      RETURN_NOT_OK(CountingSort<uint16_t>(ids, num_partitions, raw_indices, offsets));
+      break;
+    case Type::INT32:
+      RETURN_NOT_OK(CountingSort<int32_t>(ids, num_partitions, raw_indices, offsets));
+      break;
+    case Type::UINT32:
+      RETURN_NOT_OK(CountingSort<uint32_t>(ids, num_partitions, raw_indices, offsets));
+      break;
+    case Type::INT64:
+      RETURN_NOT_OK(CountingSort<int64_t>(ids, num_partitions, raw_indices, offsets));
+      break;
+    case Type::UINT64:
+      RETURN_NOT_OK(CountingSort<uint64_t>(ids, num_partitions, raw_indices, offsets));
+      break;
+    default:
+      return Status::TypeError("Partition ids must be integers, got ",
+                               *partition_ids.type());
+  }
+
+  *indices = std::make_shared<Int64Array>(length, std::move(indices_buf));
+  return Status::OK();
+}
+
+Status Partition(FunctionContext* ctx, const RecordBatch& batch,
+                 const Array& partition_ids, int32_t num_partitions,
+                 RecordBatchVector* out) {
+  if (partition_ids.length() != batch.num_rows()) {
+    return Status::Invalid("Partition ids must have as many values as the batch rows");
+  }
+  std::shared_ptr<Array> indices;
+  std::vector<int64_t> offsets;
+  RETURN_NOT_OK(PartitionIndices(ctx, partition_ids, num_partitions, &indices, &offsets));
+
+  std::shared_ptr<RecordBatch> reordered;
+  RETURN_NOT_OK(Take(ctx, batch, *indices, TakeOptions(), &reordered));
+
+  out->resize(num_partitions);
+  for (int32_t p = 0; p < num_partitions; ++p) {
+    (*out)[p] = reordered->Slice(offsets[p], offsets[p + 1] - offsets[p]);
+  }
+  return Status::OK();
+}
+
+Status HashPartition(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<std::string>& keys, int32_t num_partitions,
+                     RecordBatchVector* out) {
+  if (num_partitions <= 0) {
+    return Status::Invalid("The number of partitions must be positive, got ",
+                           num_partitions);
+  }
+  ArrayVector key_columns;
+  for (const auto& name : keys) {
+    const int index = batch.schema()->GetFieldIndex(name);
+    if (index == -1) {
+      return Status::Invalid("HashPartition key column '", name, "' not found in ",
+                             batch.schema()->ToString());
+    }
+    key_columns.push_back(batch.column(index));
+  }
+
+  std::shared_ptr<Array> hashes;
+  RETURN_NOT_OK(Hash64(ctx, key_columns, &hashes));
+
+  // Map the hashes to [0, num_partitions), in place: fold them to 32 bits,
+  // so that all their bits count, then take the high half of their product
+  // with num_partitions (Lemire's fast alternative to the modulo reduction)
+  auto ids = hashes->data()->GetMutableValues<uint64_t>(1);
+  for (int64_t i = 0; i < hashes->length(); ++i) {
+    const uint64_t folded = (ids[i] ^ (ids[i] >> 32)) & 0xffffffffULL;
+    ids[i] = (folded * static_cast<uint64_t>(num_partitions)) >> 32;
+  }
+  return Partition(ctx, batch, *hashes, num_partitions, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
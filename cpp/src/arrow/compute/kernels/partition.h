@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Compute the row indices grouping the rows of each partition
+///
+/// This is a counting sort of the partition ids: a first pass counts the
+/// rows of each partition, a second one writes each row index at its place.
+/// The indices of partition p are indices[offsets[p], offsets[p + 1]),
+/// in increasing order.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] partition_ids integer array of partition ids, without nulls,
+/// in [0, num_partitions)
+/// \param[in] num_partitions the number of partitions
+/// \param[out] indices int64 array of the same length as partition_ids
+/// \param[out] offsets num_partitions + 1 offsets into indices
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status PartitionIndices(FunctionContext* ctx, const Array& partition_ids,
+                        int32_t num_partitions, std::shared_ptr<Array>* indices,
+                        std::vector<int64_t>* offsets);
+
+/// \brief Scatter the rows of a record batch into partitions given by id
+///
+/// Rows keep their relative order within each partition.  The batch is
+/// reordered with a single Take() on the indices computed by
+/// PartitionIndices(), so each column is gathered once whatever the number
+/// of partitions; the partitions are zero-copy slices of the result.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to partition
+/// \param[in] partition_ids the partition of each row, as for PartitionIndices()
+/// \param[in] num_partitions the number of partitions
+/// \param[out] out num_partitions record batches, possibly empty
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Partition(FunctionContext* ctx, const RecordBatch& batch,
+                 const Array& partition_ids, int32_t num_partitions,
+                 RecordBatchVector* out);
+
+/// \brief Scatter the rows of a record batch into partitions by hash of keys
+///
+/// The key columns are hashed with Hash64(), and the hashes mapped to
+/// [0, num_partitions).  Rows with equal keys, including null keys, end up
+/// in the same partition, whatever the batch they come from.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to partition
+/// \param[in] keys the names of the columns to hash
+/// \param[in] num_partitions the number of partitions
+/// \param[out] out num_partitions record batches, possibly empty
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status HashPartition(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<std::string>& keys, int32_t num_partitions,
+                     RecordBatchVector* out);
+
+}  // namespace compute
+}  // namespace arrow
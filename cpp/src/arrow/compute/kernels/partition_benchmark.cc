@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+constexpr int64_t kNumRows = 1 << 20;
+
+static std::shared_ptr<RecordBatch> MakeBatch() {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto schema = arrow::schema(
+      {field("key", int64()), field("x", float64()), field("s", utf8())});
+  return RecordBatch::Make(schema, kNumRows,
+                           {rand.Numeric<Int64Type>(kNumRows, 0, 1 << 30, 0.0),
+                            rand.Numeric<DoubleType>(kNumRows, -100, 100, 0.1),
+                            rand.String(kNumRows, 0, 16, 0.1)});
+}
+
+static void PartitionByIds(benchmark::State& state) {  // NOLINT non-const reference
+  const auto num_partitions = static_cast<int32_t>(state.range(0));
+  auto batch = MakeBatch();
+  auto rand = random::RandomArrayGenerator(kSeed + 1);
+  auto ids = rand.Numeric<Int32Type>(kNumRows, 0, num_partitions - 1, 0.0);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    RecordBatchVector partitions;
+    ABORT_NOT_OK(Partition(&ctx, *batch, *ids, num_partitions, &partitions));
+    benchmark::DoNotOptimize(partitions);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void PartitionByHash(benchmark::State& state) {  // NOLINT non-const reference
+  const auto num_partitions = static_cast<int32_t>(state.range(0));
+  auto batch = MakeBatch();
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    RecordBatchVector partitions;
+    ABORT_NOT_OK(HashPartition(&ctx, *batch, {"key"}, num_partitions, &partitions));
+    benchmark::DoNotOptimize(partitions);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+// Argument: the number of partitions
+BENCHMARK(PartitionByIds)
+    ->RangeMultiplier(8)
+    ->Range(2, 1024)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(PartitionByHash)
+    ->RangeMultiplier(8)
+    ->Range(2, 1024)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestPartition : public ComputeFixture, public ::testing::Test {
+ protected:
+  void SetUp() override {
+    schema_ = schema({field("k", int32()), field("v", utf8())});
+    batch_ = RecordBatchFromJSON(schema_, R"([{"k": 1, "v": "a"},
+                                              {"k": 2, "v": "b"},
+                                              {"k": null, "v": "c"},
+                                              {"k": 1, "v": null},
+                                              {"k": 3, "v": "e"}])");
+  }
+
+  void CheckPartition(const std::string& ids_json, int32_t num_partitions,
+                      const std::vector<std::string>& expected_json) {
+    RecordBatchVector partitions;
+    ASSERT_OK(Partition(&ctx_, *batch_, *ArrayFromJSON(int8(), ids_json), num_partitions,
+                        &partitions));
+    ASSERT_EQ(partitions.size(), expected_json.size());
+    for (size_t p = 0; p < partitions.size(); ++p) {
+      ASSERT_OK(partitions[p]->ValidateFull());
+      AssertBatchesEqual(*RecordBatchFromJSON(schema_, expected_json[p]), *partitions[p]);
+    }
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestPartition, PartitionIndices) {
+  for (const auto& type : {int8(), uint16(), int32(), uint64()}) {
+    std::shared_ptr<Array> indices;
+    std::vector<int64_t> offsets;
+    ASSERT_OK(PartitionIndices(&ctx_, *ArrayFromJSON(type, "[2, 0, 1, 0, 2, 0]"), 4,
+                               &indices, &offsets));
+    ASSERT_OK(indices->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 3, 5, 2, 0, 4]"), *indices);
+    ASSERT_EQ(offsets, std::vector<int64_t>({0, 3, 4, 6, 6}));
+  }
+}
+
+TEST_F(TestPartition, PartitionIndicesErrors) {
+  std::shared_ptr<Array> indices;
+  std::vector<int64_t> offsets;
+  auto ids = ArrayFromJSON(int32(), "[0, 1]");
+  ASSERT_RAISES(Invalid, PartitionIndices(&ctx_, *ids, 0, &indices, &offsets));
+  ASSERT_RAISES(IndexError, PartitionIndices(&ctx_, *ids, 1, &indices, &offsets));
+  ASSERT_RAISES(IndexError, PartitionIndices(&ctx_, *ArrayFromJSON(int32(), "[0, -1]"),
+                                             2, &indices, &offsets));
+  ASSERT_RAISES(Invalid, PartitionIndices(&ctx_, *ArrayFromJSON(int32(), "[0, null]"),
+                                          2, &indices, &offsets));
+  ASSERT_RAISES(TypeError, PartitionIndices(&ctx_, *ArrayFromJSON(float64(), "[0, 1]"),
+                                            2, &indices, &offsets));
+}
+
+TEST_F(TestPartition, Partition) {
+  CheckPartition("[1, 0, 1, 2, 0]", 4,
+                 {R"([{"k": 2, "v": "b"}, {"k": 3, "v": "e"}])",
+                  R"([{"k": 1, "v": "a"}, {"k": null, "v": "c"}])",
+                  R"([{"k": 1, "v": null}])", "[]"});
+  CheckPartition("[0, 0, 0, 0, 0]", 1,
+                 {R"([{"k": 1, "v": "a"}, {"k": 2, "v": "b"}, {"k": null, "v": "c"},
+                      {"k": 1, "v": null}, {"k": 3, "v": "e"}])"});
+
+  RecordBatchVector partitions;
+  ASSERT_RAISES(Invalid, Partition(&ctx_, *batch_, *ArrayFromJSON(int8(), "[0, 0]"), 1,
+                                   &partitions));
+}
+
+TEST_F(TestPartition, HashPartition) {
+  const int32_t num_partitions = 3;
+  RecordBatchVector partitions;
+  ASSERT_OK(HashPartition(&ctx_, *batch_, {"k"}, num_partitions, &partitions));
+  ASSERT_EQ(partitions.size(), num_partitions);
+
+  // Every row is in the partition of its key, and in no other
+  auto partition_of = [&](const std::string& key_json) {
+    RecordBatchVector key_partitions;
+    auto key_batch =
+        RecordBatchFromJSON(schema_, "[{\"k\": " + key_json + ", \"v\": \"z\"}]");
+    ARROW_EXPECT_OK(
+        HashPartition(&ctx_, *key_batch, {"k"}, num_partitions, &key_partitions));
+    for (int32_t p = 0; p < num_partitions; ++p) {
+      if (key_partitions[p]->num_rows() == 1) {
+        return p;
+      }
+    }
+    return -1;
+  };
+  int64_t num_rows = 0;
+  for (int32_t p = 0; p < num_partitions; ++p) {
+    ASSERT_OK(partitions[p]->ValidateFull());
+    num_rows += partitions[p]->num_rows();
+    const auto& keys = checked_cast<const Int32Array&>(*partitions[p]->column(0));
+    for (int64_t i = 0; i < keys.length(); ++i) {
+      const std::string key_json =
+          keys.IsNull(i) ? "null" : std::to_string(keys.Value(i));
+      ASSERT_EQ(partition_of(key_json), p);
+    }
+  }
+  ASSERT_EQ(num_rows, batch_->num_rows());
+
+  ASSERT_RAISES(Invalid, HashPartition(&ctx_, *batch_, {"x"}, 2, &partitions));
+  ASSERT_RAISES(Invalid, HashPartition(&ctx_, *batch_, {"k"}, 0, &partitions));
+}
+
+}  // namespace compute
+}  // namespace arrow
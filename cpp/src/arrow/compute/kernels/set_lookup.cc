@@ -0,0 +1,339 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/set_lookup.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::HashTraits;
+
+namespace compute {
+
+static Status CheckLookupType(const SetLookup& lookup, const Datum& values) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("Input to set lookup was not array-like");
+  }
+  if (!values.type()->Equals(*lookup.type())) {
+    return Status::TypeError("Cannot look up values of type ", *values.type(),
+                             " in a set of type ", *lookup.type());
+  }
+  return Status::OK();
+}
+
+static Status InvokeIsIn(FunctionContext* ctx, UnaryKernel* kernel, const Datum& values,
+                         Datum* out) {
+  std::vector<Datum> outputs;
+  detail::PrimitiveAllocatingUnaryKernel allocating_kernel(kernel);
+  RETURN_NOT_OK(
+      detail::InvokeUnaryArrayKernel(ctx, &allocating_kernel, values, &outputs));
+  *out = detail::WrapDatumsLike(values, boolean(), outputs);
+  return Status::OK();
+}
+
+static Status InvokeMatch(FunctionContext* ctx, UnaryKernel* kernel, const Datum& values,
+                          Datum* out) {
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel, values, &outputs));
+  *out = detail::WrapDatumsLike(values, int32(), outputs);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Hash table backed lookups
+
+template <typename Type, typename Scalar>
+class HashSetLookup : public SetLookup {
+ public:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  HashSetLookup(std::shared_ptr<DataType> type, MemoryPool* pool)
+      : SetLookup(std::move(type), 0), memo_table_(new MemoTable(pool, 0)) {}
+
+  Status Init(const Datum& value_set) {
+    // nulls are memoized too so that Match yields their position in the set
+    auto insert_value = [&](util::optional<Scalar> v) {
+      if (v.has_value()) {
+        int32_t unused_memo_index;
+        return memo_table_->GetOrInsert(*v, &unused_memo_index);
+      }
+      ++null_count_;
+      memo_table_->GetOrInsertNull();
+      return Status::OK();
+    };
+
+    for (const auto& chunk : value_set.chunks()) {
+      RETURN_NOT_OK(VisitArrayDataInline<Type>(*chunk->data(), insert_value));
+    }
+    return Status::OK();
+  }
+
+  Status IsIn(FunctionContext* ctx, const Datum& values, Datum* out) const override {
+    RETURN_NOT_OK(CheckLookupType(*this, values));
+    IsInKernel kernel(this);
+    return InvokeIsIn(ctx, &kernel, values, out);
+  }
+
+  Status Match(FunctionContext* ctx, const Datum& values, Datum* out) const override {
+    RETURN_NOT_OK(CheckLookupType(*this, values));
+    MatchKernel kernel(this);
+    return InvokeMatch(ctx, &kernel, values, out);
+  }
+
+ private:
+  class IsInKernel : public UnaryKernel {
+   public:
+    explicit IsInKernel(const HashSetLookup* lookup) : lookup_(lookup) {}
+
+    // null values are members of the set if it contains null, otherwise the
+    // output is null
+    Status Call(FunctionContext* ctx, const Datum& values, Datum* out) override {
+      const ArrayData& values_data = *values.array();
+      ArrayData* output = out->array().get();
+      output->type = boolean();
+
+      internal::FirstTimeBitmapWriter writer(output->buffers[1]->mutable_data(),
+                                             output->offset, values_data.length);
+      const MemoTable& memo_table = *lookup_->memo_table_;
+      VisitArrayDataInline<Type>(values_data, [&](util::optional<Scalar> v) {
+        if (!v.has_value() || memo_table.Get(*v) != -1) {
+          writer.Set();
+        } else {
+          writer.Clear();
+        }
+        writer.Next();
+      });
+      writer.Finish();
+
+      if (lookup_->null_count() == 0 && values_data.GetNullCount() != 0) {
+        RETURN_NOT_OK(detail::PropagateNulls(ctx, values_data, output));
+      }
+      return Status::OK();
+    }
+
+    std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+   private:
+    const HashSetLookup* lookup_;
+  };
+
+  class MatchKernel : public UnaryKernel {
+   public:
+    explicit MatchKernel(const HashSetLookup* lookup) : lookup_(lookup) {}
+
+    // values not found in the set yield null; null values match a null in the set
+    Status Call(FunctionContext* ctx, const Datum& values, Datum* out) override {
+      const MemoTable& memo_table = *lookup_->memo_table_;
+
+      Int32Builder indices_builder(ctx->memory_pool());
+      RETURN_NOT_OK(indices_builder.Reserve(values.length()));
+      VisitArrayDataInline<Type>(*values.array(), [&](util::optional<Scalar> v) {
+        const int32_t index = v.has_value() ? memo_table.Get(*v) : memo_table.GetNull();
+        if (index != -1) {
+          indices_builder.UnsafeAppend(index);
+        } else {
+          indices_builder.UnsafeAppendNull();
+        }
+      });
+
+      std::shared_ptr<ArrayData> out_data;
+      RETURN_NOT_OK(indices_builder.FinishInternal(&out_data));
+      out->value = std::move(out_data);
+      return Status::OK();
+    }
+
+    std::shared_ptr<DataType> out_type() const override { return int32(); }
+
+   private:
+    const HashSetLookup* lookup_;
+  };
+
+  std::unique_ptr<MemoTable> memo_table_;
+};
+
+// ----------------------------------------------------------------------
+// (NullType has a separate implementation)
+
+class NullSetLookup : public SetLookup {
+ public:
+  NullSetLookup(std::shared_ptr<DataType> type, MemoryPool*)
+      : SetLookup(std::move(type), 0) {}
+
+  Status Init(const Datum& value_set) {
+    null_count_ = value_set.length();
+    return Status::OK();
+  }
+
+  Status IsIn(FunctionContext* ctx, const Datum& values, Datum* out) const override {
+    RETURN_NOT_OK(CheckLookupType(*this, values));
+    IsInKernel kernel(null_count_);
+    return InvokeIsIn(ctx, &kernel, values, out);
+  }
+
+  Status Match(FunctionContext* ctx, const Datum& values, Datum* out) const override {
+    RETURN_NOT_OK(CheckLookupType(*this, values));
+    MatchKernel kernel(null_count_);
+    return InvokeMatch(ctx, &kernel, values, out);
+  }
+
+ private:
+  // every value is null: all are members if the set contains null, otherwise the
+  // output is null
+  class IsInKernel : public UnaryKernel {
+   public:
+    explicit IsInKernel(int64_t set_null_count) : set_null_count_(set_null_count) {}
+
+    Status Call(FunctionContext* ctx, const Datum& values, Datum* out) override {
+      const ArrayData& values_data = *values.array();
+      ArrayData* output = out->array().get();
+      output->type = boolean();
+
+      if (values_data.GetNullCount() != 0 && set_null_count_ == 0) {
+        return detail::PropagateNulls(ctx, values_data, output);
+      }
+      BitUtil::SetBitsTo(output->buffers[1]->mutable_data(), output->offset,
+                         values_data.length, true);
+      return Status::OK();
+    }
+
+    std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+   private:
+    int64_t set_null_count_;
+  };
+
+  // every value is null and matches the first (null) entry of the set if any
+  class MatchKernel : public UnaryKernel {
+   public:
+    explicit MatchKernel(int64_t set_null_count) : set_null_count_(set_null_count) {}
+
+    Status Call(FunctionContext* ctx, const Datum& values, Datum* out) override {
+      Int32Builder indices_builder(ctx->memory_pool());
+      if (values.length() != 0) {
+        if (set_null_count_ == 0) {
+          RETURN_NOT_OK(indices_builder.AppendNulls(values.length()));
+        } else {
+          RETURN_NOT_OK(indices_builder.Reserve(values.length()));
+          for (int64_t i = 0; i < values.length(); ++i) {
+            indices_builder.UnsafeAppend(0);
+          }
+        }
+      }
+
+      std::shared_ptr<ArrayData> out_data;
+      RETURN_NOT_OK(indices_builder.FinishInternal(&out_data));
+      out->value = std::move(out_data);
+      return Status::OK();
+    }
+
+    std::shared_ptr<DataType> out_type() const override { return int32(); }
+
+   private:
+    int64_t set_null_count_;
+  };
+};
+
+// ----------------------------------------------------------------------
+
+template <typename Type, typename Enable = void>
+struct SetLookupTraits {};
+
+template <typename Type>
+struct SetLookupTraits<Type, enable_if_null<Type>> {
+  using SetLookupImpl = NullSetLookup;
+};
+
+template <typename Type>
+struct SetLookupTraits<Type, enable_if_has_c_type<Type>> {
+  using SetLookupImpl = HashSetLookup<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct SetLookupTraits<Type, enable_if_has_string_view<Type>> {
+  using SetLookupImpl = HashSetLookup<Type, util::string_view>;
+};
+
+template <typename Type>
+static Status MakeSetLookup(FunctionContext* ctx, const Datum& value_set,
+                            std::shared_ptr<SetLookup>* out) {
+  using SetLookupImpl = typename SetLookupTraits<Type>::SetLookupImpl;
+  auto lookup = std::make_shared<SetLookupImpl>(value_set.type(), ctx->memory_pool());
+  RETURN_NOT_OK(lookup->Init(value_set));
+  *out = std::move(lookup);
+  return Status::OK();
+}
+
+Status SetLookup::Make(FunctionContext* ctx, const Datum& value_set,
+                       std::shared_ptr<SetLookup>* out) {
+  if (!value_set.is_arraylike()) {
+    return Status::Invalid("Value set input to set lookup was not array-like");
+  }
+
+#define SET_LOOKUP_CASE(InType) \
+  case InType::type_id:         \
+    return MakeSetLookup<InType>(ctx, value_set, out)
+
+  switch (value_set.type()->id()) {
+    SET_LOOKUP_CASE(NullType);
+    SET_LOOKUP_CASE(BooleanType);
+    SET_LOOKUP_CASE(UInt8Type);
+    SET_LOOKUP_CASE(Int8Type);
+    SET_LOOKUP_CASE(UInt16Type);
+    SET_LOOKUP_CASE(Int16Type);
+    SET_LOOKUP_CASE(UInt32Type);
+    SET_LOOKUP_CASE(Int32Type);
+    SET_LOOKUP_CASE(UInt64Type);
+    SET_LOOKUP_CASE(Int64Type);
+    SET_LOOKUP_CASE(FloatType);
+    SET_LOOKUP_CASE(DoubleType);
+    SET_LOOKUP_CASE(Date32Type);
+    SET_LOOKUP_CASE(Date64Type);
+    SET_LOOKUP_CASE(Time32Type);
+    SET_LOOKUP_CASE(Time64Type);
+    SET_LOOKUP_CASE(TimestampType);
+    SET_LOOKUP_CASE(BinaryType);
+    SET_LOOKUP_CASE(StringType);
+    SET_LOOKUP_CASE(FixedSizeBinaryType);
+    SET_LOOKUP_CASE(Decimal128Type);
+    default:
+      break;
+  }
+#undef SET_LOOKUP_CASE
+
+  return Status::NotImplemented("Set lookup is not implemented for ",
+                                value_set.type()->ToString());
+}
+
+}  // namespace compute
+}  // namespace arrow
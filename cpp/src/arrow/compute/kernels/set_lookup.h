@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+/// \brief A value set prepared for repeated IsIn and Match lookups
+///
+/// IsIn and Match spend most of their time hashing the value set. A SetLookup
+/// builds that hash table once so that many arrays (for example every batch of
+/// a scan) can be looked up against the same set. Once built, a SetLookup is
+/// immutable and may be used concurrently from several threads.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT SetLookup {
+ public:
+  virtual ~SetLookup() = default;
+
+  /// \brief Build a SetLookup from an array-like value set
+  ///
+  /// The hash table is allocated from the context's memory pool.
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] value_set array-like set of values to look up
+  /// \param[out] out the prepared value set
+  static Status Make(FunctionContext* ctx, const Datum& value_set,
+                     std::shared_ptr<SetLookup>* out);
+
+  /// \brief The type of the values in the set
+  const std::shared_ptr<DataType>& type() const { return type_; }
+
+  /// \brief The number of nulls in the value set
+  int64_t null_count() const { return null_count_; }
+
+  /// \brief Check which values are members of the set, as IsIn(values, value_set)
+  virtual Status IsIn(FunctionContext* ctx, const Datum& values, Datum* out) const = 0;
+
+  /// \brief Look up the index of each value in the set, as Match(values, value_set)
+  virtual Status Match(FunctionContext* ctx, const Datum& values, Datum* out) const = 0;
+
+ protected:
+  SetLookup(std::shared_ptr<DataType> type, int64_t null_count)
+      : type_(std::move(type)), null_count_(null_count) {}
+
+  std::shared_ptr<DataType> type_;
+  int64_t null_count_;
+};
+
+}  // namespace compute
+}  // namespace arrow
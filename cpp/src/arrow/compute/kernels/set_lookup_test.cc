@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/isin.h"
+#include "arrow/compute/kernels/match.h"
+#include "arrow/compute/kernels/set_lookup.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+class TestSetLookup : public ComputeFixture, public TestBase {};
+
+TEST_F(TestSetLookup, ReuseAcrossArrays) {
+  std::shared_ptr<SetLookup> lookup;
+  ASSERT_OK(SetLookup::Make(&ctx_, ArrayFromJSON(int32(), "[3, null, 5, 3]"), &lookup));
+  ASSERT_TRUE(lookup->type()->Equals(int32()));
+  ASSERT_EQ(lookup->null_count(), 1);
+
+  Datum out;
+  ASSERT_OK(lookup->IsIn(&ctx_, ArrayFromJSON(int32(), "[1, 3, null, 5]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, true, true]"),
+                    *out.make_array());
+  ASSERT_OK(lookup->IsIn(&ctx_, ArrayFromJSON(int32(), "[5, 6]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false]"), *out.make_array());
+
+  ASSERT_OK(lookup->Match(&ctx_, ArrayFromJSON(int32(), "[1, 3, null, 5]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[null, 0, 1, 2]"), *out.make_array());
+
+  auto chunked = ChunkedArrayFromJSON(int32(), {"[3]", "[]", "[4, 5]"});
+  ASSERT_OK(lookup->IsIn(&ctx_, chunked, &out));
+  AssertChunkedEqual(*ChunkedArrayFromJSON(boolean(), {"[true]", "[]", "[false, true]"}),
+                     *out.chunked_array());
+}
+
+TEST_F(TestSetLookup, ChunkedValueSet) {
+  std::shared_ptr<SetLookup> lookup;
+  ASSERT_OK(SetLookup::Make(&ctx_, ChunkedArrayFromJSON(utf8(), {R"(["a"])", R"(["b"])"}),
+                            &lookup));
+  ASSERT_EQ(lookup->null_count(), 0);
+
+  Datum out;
+  ASSERT_OK(lookup->IsIn(&ctx_, ArrayFromJSON(utf8(), R"(["b", null, "c"])"), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, null, false]"), *out.make_array());
+}
+
+TEST_F(TestSetLookup, ConcurrentLookups) {
+  auto rand = random::RandomArrayGenerator(0x5e7);
+  auto value_set = rand.Int64(1000, 0, 2000, 0.01);
+  std::shared_ptr<SetLookup> lookup;
+  ASSERT_OK(SetLookup::Make(&ctx_, value_set, &lookup));
+
+  std::vector<std::shared_ptr<Array>> inputs;
+  std::vector<Datum> expected(8);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    inputs.push_back(rand.Int64(5000, 0, 2000, 0.1));
+    ASSERT_OK(IsIn(&ctx_, inputs[i], value_set, &expected[i]));
+  }
+
+  std::vector<Datum> actual(inputs.size());
+  std::vector<Status> statuses(inputs.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    threads.emplace_back([&, i] {
+      FunctionContext ctx;
+      statuses[i] = lookup->IsIn(&ctx, inputs[i], &actual[i]);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    ASSERT_OK(statuses[i]);
+    AssertArraysEqual(*expected[i].make_array(), *actual[i].make_array());
+  }
+}
+
+TEST_F(TestSetLookup, Errors) {
+  std::shared_ptr<SetLookup> lookup;
+  ASSERT_RAISES(NotImplemented,
+                SetLookup::Make(&ctx_, ArrayFromJSON(list(int32()), "[]"), &lookup));
+  ASSERT_RAISES(Invalid, SetLookup::Make(&ctx_, Datum(int32_t(1)), &lookup));
+
+  ASSERT_OK(SetLookup::Make(&ctx_, ArrayFromJSON(int32(), "[1]"), &lookup));
+  Datum out;
+  ASSERT_RAISES(TypeError, lookup->IsIn(&ctx_, ArrayFromJSON(int64(), "[1]"), &out));
+  ASSERT_RAISES(TypeError, lookup->Match(&ctx_, ArrayFromJSON(utf8(), "[]"), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,446 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/sketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/hash64.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+constexpr int32_t ApproxCountDistinctOptions::kMinPrecision;
+constexpr int32_t ApproxCountDistinctOptions::kMaxPrecision;
+
+// ----------------------------------------------------------------------
+// HyperLogLog
+//
+// Philippe Flajolet, Eric Fusy, Olivier Gandouet, Frederic Meunier,
+// "HyperLogLog: the analysis of a near-optimal cardinality estimation
+// algorithm", AofA 2007.
+//
+// The first `precision` bits of the hash of a value select a register,
+// which keeps the largest number of leading zeros (plus one) seen in the
+// remaining bits.  As hashes are 64 bits wide, no large range correction
+// is needed.
+
+struct HyperLogLogState {
+  // Empty until the first value or merge
+  std::vector<uint8_t> registers;
+};
+
+class ApproxCountDistinctAggregateFunction final
+    : public AggregateFunctionStaticState<HyperLogLogState> {
+ public:
+  ApproxCountDistinctAggregateFunction(FunctionContext* ctx, int32_t precision)
+      : ctx_(ctx), precision_(precision) {}
+
+  Status Consume(const Array& input, HyperLogLogState* state) const override {
+    state->registers.assign(num_registers(), 0);
+    std::shared_ptr<Array> hashes;
+    RETURN_NOT_OK(Hash64(ctx_, input, &hashes));
+    const uint64_t* values = checked_cast<const UInt64Array&>(*hashes).raw_values();
+    uint8_t* registers = state->registers.data();
+    if (input.null_count() == 0) {
+      for (int64_t i = 0; i < input.length(); ++i) {
+        Update(values[i], registers);
+      }
+    } else {
+      internal::BitmapReader reader(input.null_bitmap_data(), input.offset(),
+                                    input.length());
+      for (int64_t i = 0; i < input.length(); ++i) {
+        if (reader.IsSet()) {
+          Update(values[i], registers);
+        }
+        reader.Next();
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const HyperLogLogState& src, HyperLogLogState* dst) const override {
+    if (dst->registers.empty()) {
+      dst->registers = src.registers;
+    } else if (!src.registers.empty()) {
+      for (size_t i = 0; i < dst->registers.size(); ++i) {
+        dst->registers[i] = std::max(dst->registers[i], src.registers[i]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(const HyperLogLogState& src, Datum* output) const override {
+    *output = Datum(Estimate(src));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  int64_t num_registers() const { return int64_t(1) << precision_; }
+
+  void Update(uint64_t hash, uint8_t* registers) const {
+    // Hash64() hashes integers with a single multiplication, whose bits are
+    // too regular for HyperLogLog: mix them further (with MurmurHash3's
+    // finalizer, a bijection, so that equal values still collide).
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    const uint64_t index = hash >> (64 - precision_);
+    const uint64_t rest = hash << precision_;
+    const uint8_t rank =
+        rest == 0 ? static_cast<uint8_t>(64 - precision_ + 1)
+                  : static_cast<uint8_t>(BitUtil::CountLeadingZeros(rest) + 1);
+    registers[index] = std::max(registers[index], rank);
+  }
+
+  int64_t Estimate(const HyperLogLogState& state) const {
+    if (state.registers.empty()) {
+      return 0;
+    }
+    const double m = static_cast<double>(num_registers());
+    double alpha;
+    switch (precision_) {
+      case 4:
+        alpha = 0.673;
+        break;
+      case 5:
+        alpha = 0.697;
+        break;
+      case 6:
+        alpha = 0.709;
+        break;
+      default:
+        alpha = 0.7213 / (1 + 1.079 / m);
+        break;
+    }
+    double sum = 0;
+    int64_t num_zeros = 0;
+    for (uint8_t reg : state.registers) {
+      sum += std::ldexp(1.0, -reg);
+      num_zeros += reg == 0;
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && num_zeros > 0) {
+      // Small range correction (linear counting)
+      estimate = m * std::log(m / static_cast<double>(num_zeros));
+    }
+    return static_cast<int64_t>(std::llround(estimate));
+  }
+
+  FunctionContext* ctx_;
+  int32_t precision_;
+};
+
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinctAggregateFunction(
+    FunctionContext* ctx, const ApproxCountDistinctOptions& options) {
+  if (options.precision < ApproxCountDistinctOptions::kMinPrecision ||
+      options.precision > ApproxCountDistinctOptions::kMaxPrecision) {
+    return nullptr;
+  }
+  return std::make_shared<ApproxCountDistinctAggregateFunction>(ctx, options.precision);
+}
+
+Status ApproxCountDistinct(FunctionContext* ctx,
+                           const ApproxCountDistinctOptions& options, const Datum& value,
+                           Datum* out) {
+  auto aggregate = MakeApproxCountDistinctAggregateFunction(ctx, options);
+  if (!aggregate) {
+    return Status::Invalid("ApproxCountDistinct precision must be between ",
+                           ApproxCountDistinctOptions::kMinPrecision, " and ",
+                           ApproxCountDistinctOptions::kMaxPrecision, ", got ",
+                           options.precision);
+  }
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(ctx, value, out);
+}
+
+// ----------------------------------------------------------------------
+// t-digest
+//
+// Ted Dunning, Otmar Ertl, "Computing Extremely Accurate Quantiles Using
+// t-Digests", 2019.
+//
+// This is the "merging" variant: values are appended to a buffer, which is
+// sorted and merged into the centroids when full.  Adjacent centroids are
+// merged as long as the k1 scale function, k(q) = compression / (2 pi) *
+// asin(2q - 1), grows by at most 1 over the merged centroid, which keeps
+// centroids small near the extreme quantiles.
+
+constexpr double kPi = 3.14159265358979323846;
+
+struct TDigestState {
+  struct Centroid {
+    double mean;
+    double weight;
+  };
+
+  // Sorted by mean
+  std::vector<Centroid> centroids;
+  // Not yet merged into the centroids
+  std::vector<Centroid> buffer;
+  double total_weight = 0;
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+};
+
+class TDigestImpl {
+ public:
+  TDigestImpl(FunctionContext* ctx, const TDigestOptions& options)
+      : ctx_(ctx),
+        quantiles_(options.quantiles),
+        compression_(options.compression),
+        buffer_capacity_(static_cast<size_t>(4 * options.compression)) {}
+
+  void Add(TDigestState* state, double mean, double weight) const {
+    state->buffer.push_back({mean, weight});
+    state->total_weight += weight;
+    if (state->buffer.size() >= buffer_capacity_) {
+      Compress(state);
+    }
+  }
+
+  void Compress(TDigestState* state) const {
+    if (state->buffer.empty()) {
+      return;
+    }
+    std::vector<TDigestState::Centroid> all = std::move(state->buffer);
+    state->buffer.clear();
+    all.insert(all.end(), state->centroids.begin(), state->centroids.end());
+    std::sort(all.begin(), all.end(),
+              [](const TDigestState::Centroid& l, const TDigestState::Centroid& r) {
+                return l.mean < r.mean;
+              });
+
+    auto& out = state->centroids;
+    out.clear();
+    const double total = state->total_weight;
+    TDigestState::Centroid current = all[0];
+    double weight_before = 0;
+    double limit = WeightLimit(0);
+    for (size_t i = 1; i < all.size(); ++i) {
+      const auto& next = all[i];
+      if ((weight_before + current.weight + next.weight) / total <= limit) {
+        current.weight += next.weight;
+        current.mean += (next.mean - current.mean) * next.weight / current.weight;
+      } else {
+        weight_before += current.weight;
+        out.push_back(current);
+        limit = WeightLimit(weight_before / total);
+        current = next;
+      }
+    }
+    out.push_back(current);
+  }
+
+  double Quantile(const TDigestState& state, double q) const {
+    const auto& c = state.centroids;
+    if (q <= 0) {
+      return state.min;
+    }
+    if (q >= 1) {
+      return state.max;
+    }
+    const double target = q * state.total_weight;
+    // Interpolate between the centers of the centroids, and between min (max)
+    // and the center of the first (last) centroid
+    if (target < c[0].weight / 2) {
+      return Interpolate(state.min, c[0].mean, target / (c[0].weight / 2));
+    }
+    double weight_before = 0;
+    for (size_t i = 0; i + 1 < c.size(); ++i) {
+      const double left = weight_before + c[i].weight / 2;
+      const double right = weight_before + c[i].weight + c[i + 1].weight / 2;
+      if (target < right) {
+        return Interpolate(c[i].mean, c[i + 1].mean, (target - left) / (right - left));
+      }
+      weight_before += c[i].weight;
+    }
+    const auto& last = c.back();
+    const double left = state.total_weight - last.weight / 2;
+    return Interpolate(last.mean, state.max, (target - left) / (last.weight / 2));
+  }
+
+  Status Finalize(const TDigestState& src, Datum* output) const {
+    TDigestState state = src;
+    Compress(&state);
+    DoubleBuilder builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(quantiles_.size()));
+    for (double q : quantiles_) {
+      if (state.total_weight == 0) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(Quantile(state, q));
+      }
+    }
+    std::shared_ptr<Array> out;
+    RETURN_NOT_OK(builder.Finish(&out));
+    *output = Datum(out);
+    return Status::OK();
+  }
+
+ private:
+  // The largest normalized cumulative weight up to which a centroid starting
+  // at normalized cumulative weight q may extend: k^-1(k(q) + 1)
+  double WeightLimit(double q) const {
+    const double k = compression_ / (2 * kPi) * std::asin(2 * q - 1) + 1;
+    const double angle = 2 * kPi * k / compression_;
+    if (angle >= kPi / 2) {
+      return 1;
+    }
+    return (std::sin(angle) + 1) / 2;
+  }
+
+  static double Interpolate(double left, double right, double fraction) {
+    return left + (right - left) * std::min(std::max(fraction, 0.0), 1.0);
+  }
+
+  FunctionContext* ctx_;
+  std::vector<double> quantiles_;
+  double compression_;
+  size_t buffer_capacity_;
+};
+
+template <typename ArrowType>
+class TDigestAggregateFunction final
+    : public AggregateFunctionStaticState<TDigestState> {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  TDigestAggregateFunction(FunctionContext* ctx, const TDigestOptions& options)
+      : impl_(ctx, options) {}
+
+  Status Consume(const Array& input, TDigestState* state) const override {
+    *state = TDigestState();
+    const auto values = checked_cast<const ArrayType&>(input).raw_values();
+    if (input.null_count() == 0) {
+      for (int64_t i = 0; i < input.length(); ++i) {
+        AddValue(state, static_cast<double>(values[i]));
+      }
+    } else {
+      internal::BitmapReader reader(input.null_bitmap_data(), input.offset(),
+                                    input.length());
+      for (int64_t i = 0; i < input.length(); ++i) {
+        if (reader.IsSet()) {
+          AddValue(state, static_cast<double>(values[i]));
+        }
+        reader.Next();
+      }
+    }
+    impl_.Compress(state);
+    return Status::OK();
+  }
+
+  Status Merge(const TDigestState& src, TDigestState* dst) const override {
+    for (const auto& centroid : src.centroids) {
+      impl_.Add(dst, centroid.mean, centroid.weight);
+    }
+    for (const auto& centroid : src.buffer) {
+      impl_.Add(dst, centroid.mean, centroid.weight);
+    }
+    dst->min = std::min(dst->min, src.min);
+    dst->max = std::max(dst->max, src.max);
+    return Status::OK();
+  }
+
+  Status Finalize(const TDigestState& src, Datum* output) const override {
+    return impl_.Finalize(src, output);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  void AddValue(TDigestState* state, double value) const {
+    if (std::isnan(value)) {
+      return;
+    }
+    state->min = std::min(state->min, value);
+    state->max = std::max(state->max, value);
+    impl_.Add(state, value, 1);
+  }
+
+  TDigestImpl impl_;
+};
+
+#define TDIGEST_AGG_FN_CASE(T)                          \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<TDigestAggregateFunction<T>>(ctx, options));
+
+std::shared_ptr<AggregateFunction> MakeTDigestAggregateFunction(
+    const DataType& type, FunctionContext* ctx, const TDigestOptions& options) {
+  if (!(options.compression >= 10)) {
+    return nullptr;
+  }
+  for (double q : options.quantiles) {
+    if (!(q >= 0 && q <= 1)) {
+      return nullptr;
+    }
+  }
+  switch (type.id()) {
+    TDIGEST_AGG_FN_CASE(UInt8Type);
+    TDIGEST_AGG_FN_CASE(Int8Type);
+    TDIGEST_AGG_FN_CASE(UInt16Type);
+    TDIGEST_AGG_FN_CASE(Int16Type);
+    TDIGEST_AGG_FN_CASE(UInt32Type);
+    TDIGEST_AGG_FN_CASE(Int32Type);
+    TDIGEST_AGG_FN_CASE(UInt64Type);
+    TDIGEST_AGG_FN_CASE(Int64Type);
+    TDIGEST_AGG_FN_CASE(FloatType);
+    TDIGEST_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+
+#undef TDIGEST_AGG_FN_CASE
+}
+
+Status TDigest(FunctionContext* ctx, const TDigestOptions& options, const Datum& value,
+               Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+  auto aggregate = MakeTDigestAggregateFunction(*data_type, ctx, options);
+  if (!aggregate) {
+    return Status::Invalid("No t-digest for type ", *data_type,
+                           " or invalid options (compression must be at least 10 ",
+                           "and quantiles between 0 and 1)");
+  }
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(ctx, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
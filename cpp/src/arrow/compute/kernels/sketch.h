@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class Status;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class ApproxCountDistinctOptions
+///
+/// Parameters of the HyperLogLog sketch estimating the number of distinct
+/// values.
+struct ARROW_EXPORT ApproxCountDistinctOptions {
+  static constexpr int32_t kMinPrecision = 4;
+  static constexpr int32_t kMaxPrecision = 18;
+
+  explicit ApproxCountDistinctOptions(int32_t precision = 12) : precision(precision) {}
+
+  /// The base-2 logarithm of the number of registers, between kMinPrecision
+  /// and kMaxPrecision.  A sketch takes 2^precision bytes, and the relative
+  /// standard error of the estimate is about 1.04 / sqrt(2^precision), i.e.
+  /// 1.6% for the default precision.
+  int32_t precision;
+};
+
+/// \brief Return an aggregate function estimating the number of distinct
+/// non-null values
+///
+/// Values are hashed as by Hash64() into a HyperLogLog sketch of fixed
+/// size, so that memory usage doesn't depend on the number of values.
+/// Sketches can be merged into the sketch of the union of their values,
+/// e.g. the per-thread states of a BatchAggregator.  The result is an int64
+/// scalar.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxCountDistinctOptions
+/// \return the aggregate function, or null if the precision is out of range
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinctAggregateFunction(
+    FunctionContext* ctx, const ApproxCountDistinctOptions& options);
+
+/// \brief Estimate the number of distinct non-null values of an array
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxCountDistinctOptions
+/// \param[in] value datum to count, expecting Array or ChunkedArray
+/// \param[out] out int64 scalar datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxCountDistinct(FunctionContext* ctx,
+                           const ApproxCountDistinctOptions& options, const Datum& value,
+                           Datum* out);
+
+/// \class TDigestOptions
+///
+/// Parameters of the t-digest sketch estimating quantiles.
+struct ARROW_EXPORT TDigestOptions {
+  explicit TDigestOptions(std::vector<double> quantiles = {0.5},
+                          double compression = 100)
+      : quantiles(std::move(quantiles)), compression(compression) {}
+
+  /// The quantiles to estimate, between 0 and 1
+  std::vector<double> quantiles;
+  /// Bounds the number of centroids a sketch keeps, which is about
+  /// `compression`, and must be at least 10.  Larger values give more
+  /// accurate estimates.
+  double compression;
+};
+
+/// \brief Return an aggregate function estimating quantiles of numeric
+/// values
+///
+/// Non-null, non-NaN values are summarized as weighted centroids by a
+/// t-digest, whose size is bounded by the compression, so that memory usage
+/// doesn't depend on the number of values.  Estimates are most accurate
+/// near the extreme quantiles.  Sketches can be merged, e.g. the per-thread
+/// states of a BatchAggregator.
+///
+/// The result is a double array with one estimate per quantile, all null
+/// if there are no values.
+///
+/// \param[in] type the type of the values, which must be numeric
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see TDigestOptions
+/// \return the aggregate function, or null if the type isn't supported or
+///   the options are invalid
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeTDigestAggregateFunction(
+    const DataType& type, FunctionContext* ctx, const TDigestOptions& options);
+
+/// \brief Estimate quantiles of the values of a numeric array
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see TDigestOptions
+/// \param[in] value datum to summarize, expecting Array or ChunkedArray
+/// \param[out] out double array datum, one estimate per quantile
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TDigest(FunctionContext* ctx, const TDigestOptions& options, const Datum& value,
+               Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/sketch.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+static std::shared_ptr<Array> Int64Values(const std::vector<int64_t>& values) {
+  std::shared_ptr<Array> out;
+  ArrayFromVector<Int64Type>(values, &out);
+  return out;
+}
+
+static std::shared_ptr<Array> Sequence(int64_t start, int64_t stop) {
+  std::vector<int64_t> values(stop - start);
+  for (int64_t i = start; i < stop; ++i) {
+    values[i - start] = i;
+  }
+  return Int64Values(values);
+}
+
+class TestApproxCountDistinct : public ComputeFixture, public ::testing::Test {
+ protected:
+  int64_t Count(const Datum& value, const ApproxCountDistinctOptions& options =
+                                        ApproxCountDistinctOptions()) {
+    Datum out;
+    ARROW_EXPECT_OK(ApproxCountDistinct(&ctx_, options, value, &out));
+    return checked_cast<const Int64Scalar&>(*out.scalar()).value;
+  }
+};
+
+TEST_F(TestApproxCountDistinct, Small) {
+  ASSERT_EQ(0, Count(ArrayFromJSON(int32(), "[]")));
+  ASSERT_EQ(0, Count(ArrayFromJSON(int32(), "[null, null]")));
+  ASSERT_EQ(3, Count(ArrayFromJSON(int32(), "[1, 2, null, 1, 3, 2]")));
+  ASSERT_EQ(2, Count(ArrayFromJSON(utf8(), R"(["a", "bc", null, "a"])")));
+  ASSERT_EQ(2, Count(ArrayFromJSON(float64(), "[0.0, -0.0, 1.5]")));
+}
+
+TEST_F(TestApproxCountDistinct, Large) {
+  const int64_t n = 100000;
+  for (int32_t precision : {10, 12, 14}) {
+    ApproxCountDistinctOptions options(precision);
+    // Within 4 standard errors
+    const double tolerance = 4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    ASSERT_NEAR(n, Count(Sequence(0, n), options), tolerance * n);
+
+    // Duplicates and chunks: each chunk is consumed into a sketch of its
+    // own, and the sketches are merged
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{Sequence(0, n / 2), Sequence(n / 4, n), Sequence(0, n)});
+    ASSERT_NEAR(n, Count(chunked, options), tolerance * n);
+  }
+}
+
+TEST_F(TestApproxCountDistinct, Errors) {
+  Datum out;
+  auto values = ArrayFromJSON(int32(), "[1]");
+  ASSERT_RAISES(Invalid,
+                ApproxCountDistinct(&ctx_, ApproxCountDistinctOptions(3), values, &out));
+  ASSERT_RAISES(Invalid,
+                ApproxCountDistinct(&ctx_, ApproxCountDistinctOptions(19), values, &out));
+  ASSERT_EQ(nullptr, MakeApproxCountDistinctAggregateFunction(
+                         &ctx_, ApproxCountDistinctOptions(0)));
+}
+
+class TestTDigest : public ComputeFixture, public ::testing::Test {
+ protected:
+  std::shared_ptr<Array> Quantiles(const Datum& value, const TDigestOptions& options) {
+    Datum out;
+    ARROW_EXPECT_OK(TDigest(&ctx_, options, value, &out));
+    return out.make_array();
+  }
+
+  std::vector<double> QuantileValues(const Datum& value, const TDigestOptions& options) {
+    auto array = Quantiles(value, options);
+    ARROW_EXPECT_OK(array->ValidateFull());
+    EXPECT_EQ(array->null_count(), 0);
+    const auto& doubles = checked_cast<const DoubleArray&>(*array);
+    return std::vector<double>(doubles.raw_values(),
+                               doubles.raw_values() + doubles.length());
+  }
+};
+
+TEST_F(TestTDigest, Small) {
+  TDigestOptions options({0, 0.5, 1});
+  ASSERT_EQ(QuantileValues(ArrayFromJSON(int32(), "[5]"), options),
+            std::vector<double>({5, 5, 5}));
+  ASSERT_EQ(QuantileValues(ArrayFromJSON(float64(), "[3, null, 1, NaN, 2]"), options),
+            std::vector<double>({1, 2, 3}));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[null, null, null]"),
+                    *Quantiles(ArrayFromJSON(uint8(), "[null]"), options));
+}
+
+TEST_F(TestTDigest, Large) {
+  const int64_t n = 100000;
+  std::vector<int64_t> values(n);
+  for (int64_t i = 0; i < n; ++i) {
+    values[i] = i + 1;
+  }
+  std::shuffle(values.begin(), values.end(), std::default_random_engine(42));
+  ArrayVector chunks;
+  for (int64_t i = 0; i < n; i += n / 8) {
+    chunks.push_back(Int64Values(
+        std::vector<int64_t>(values.begin() + i, values.begin() + i + n / 8)));
+  }
+
+  TDigestOptions options({0, 0.001, 0.01, 0.25, 0.5, 0.75, 0.99, 0.999, 1});
+  for (const Datum& value :
+       {Datum(Int64Values(values)), Datum(std::make_shared<ChunkedArray>(chunks))}) {
+    auto estimates = QuantileValues(value, options);
+    ASSERT_EQ(estimates.size(), options.quantiles.size());
+    ASSERT_EQ(estimates.front(), 1);
+    ASSERT_EQ(estimates.back(), n);
+    for (size_t i = 1; i + 1 < estimates.size(); ++i) {
+      const double q = options.quantiles[i];
+      // Centroids span at most about 2 pi / compression * sqrt(q (1 - q)) in
+      // rank, and estimates are interpolated between their centers
+      const double tolerance = 3.1416 / 100 * std::sqrt(q * (1 - q));
+      ASSERT_NEAR(q * n, estimates[i], tolerance * n) << "quantile " << q;
+    }
+  }
+}
+
+TEST_F(TestTDigest, Errors) {
+  Datum out;
+  auto values = ArrayFromJSON(int32(), "[1]");
+  ASSERT_RAISES(Invalid, TDigest(&ctx_, TDigestOptions({1.5}), values, &out));
+  ASSERT_RAISES(Invalid, TDigest(&ctx_, TDigestOptions({0.5}, 5), values, &out));
+  ASSERT_RAISES(Invalid,
+                TDigest(&ctx_, TDigestOptions(), ArrayFromJSON(utf8(), "[]"), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -18,8 +18,11 @@
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <limits>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -27,7 +30,11 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -146,9 +153,116 @@ class CountSorter {
   }
 };
 
-// Sort integers with counting sort or comparison based sorting algorithm
+static constexpr int kRadixBits = 8;
+static constexpr int kRadix = 1 << kRadixBits;
+
+template <typename KeyType>
+static int RadixDigit(KeyType key, int pass) {
+  return static_cast<int>((key >> (pass * kRadixBits)) & (kRadix - 1));
+}
+
+// Sort unsigned keys along with their indices with a least significant digit
+// radix sort, one byte at a time over their num_passes lowest bytes.  Passes
+// where all keys share the same byte are skipped.  Each pass is stable, so the
+// whole sort is.
+template <typename KeyType>
+static void RadixSortKeys(std::vector<KeyType>* keys, int64_t* indices, int num_passes) {
+  static constexpr int kMaxPasses = sizeof(KeyType);
+  const int64_t length = static_cast<int64_t>(keys->size());
+
+  // Compute the histograms of all passes at once
+  std::array<std::array<int64_t, kRadix>, kMaxPasses> counts{};
+  for (const KeyType key : *keys) {
+    for (int pass = 0; pass < num_passes; ++pass) {
+      ++counts[pass][RadixDigit(key, pass)];
+    }
+  }
+
+  std::vector<KeyType> keys_scratch(length);
+  std::vector<int64_t> indices_scratch(length);
+  KeyType* src_keys = keys->data();
+  KeyType* dest_keys = keys_scratch.data();
+  int64_t* src_indices = indices;
+  int64_t* dest_indices = indices_scratch.data();
+
+  for (int pass = 0; pass < num_passes; ++pass) {
+    auto& offsets = counts[pass];
+    if (offsets[RadixDigit(src_keys[0], pass)] == length) {
+      // All keys have the same digit, the pass wouldn't change anything
+      continue;
+    }
+    int64_t offset = 0;
+    for (auto& count : offsets) {
+      const int64_t next_offset = offset + count;
+      count = offset;
+      offset = next_offset;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t pos = offsets[RadixDigit(src_keys[i], pass)]++;
+      dest_keys[pos] = src_keys[i];
+      dest_indices[pos] = src_indices[i];
+    }
+    std::swap(src_keys, dest_keys);
+    std::swap(src_indices, dest_indices);
+  }
+
+  if (src_indices != indices) {
+    std::copy(src_indices, src_indices + length, indices);
+  }
+  if (src_keys != keys->data()) {
+    keys->swap(keys_scratch);
+  }
+}
+
+// Sort integers with a radix sort.  Values are rebased on their minimum, so
+// that only the bytes spanned by the value range need a pass.
+template <typename ArrowType>
+class RadixSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using c_type = typename ArrowType::c_type;
+  using KeyType = typename std::make_unsigned<c_type>::type;
+
+ public:
+  void SetMinMax(c_type min, c_type max) {
+    min_ = min;
+    range_ = static_cast<KeyType>(static_cast<KeyType>(max) - static_cast<KeyType>(min));
+  }
+
+  void Sort(int64_t* indices_begin, int64_t* indices_end, const ArrayType& values) {
+    const int64_t non_null_count = values.length() - values.null_count();
+    std::vector<KeyType> keys(non_null_count);
+
+    // Gather the rebased keys, and put the nulls last in original order
+    int64_t index = 0;
+    int64_t non_null_pos = 0;
+    int64_t null_pos = non_null_count;
+    auto gather = [&](util::optional<c_type> v) {
+      if (v.has_value()) {
+        keys[non_null_pos] =
+            static_cast<KeyType>(static_cast<KeyType>(*v) - static_cast<KeyType>(min_));
+        indices_begin[non_null_pos++] = index++;
+      } else {
+        indices_begin[null_pos++] = index++;
+      }
+    };
+    VisitArrayDataInline<ArrowType>(*values.data(), std::move(gather));
+
+    int num_passes = 0;
+    for (uint64_t range = range_; range != 0; range >>= kRadixBits) {
+      ++num_passes;
+    }
+    RadixSortKeys(&keys, indices_begin, num_passes);
+  }
+
+ private:
+  c_type min_{0};
+  KeyType range_{0};
+};
+
+// Sort integers with counting sort, radix sort or comparison based sorting
 // - Use O(n) counting sort if values are in a small range
-// - Use O(nlogn) std::stable_sort otherwise
+// - Use O(n) radix sort on long arrays otherwise
+// - Use O(nlogn) std::stable_sort on short arrays
 template <typename ArrowType>
 class CountOrCompareSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
@@ -175,6 +289,11 @@ class CountOrCompareSorter {
         count_sorter_.Sort(indices_begin, indices_end, values);
         return;
       }
+      if (values.length() - values.null_count() >= radixsort_min_len_) {
+        radix_sorter_.SetMinMax(min, max);
+        radix_sorter_.Sort(indices_begin, indices_end, values);
+        return;
+      }
     }
 
     compare_sorter_.Sort(indices_begin, indices_end, values);
@@ -183,6 +302,7 @@ class CountOrCompareSorter {
  private:
   CompareSorter<ArrowType> compare_sorter_;
   CountSorter<ArrowType> count_sorter_;
+  RadixSorter<ArrowType> radix_sorter_;
 
   // Cross point to prefer counting sort than stl::stable_sort(merge sort)
   // - array to be sorted is longer than "count_min_len_"
@@ -195,8 +315,111 @@ class CountOrCompareSorter {
   // See https://issues.apache.org/jira/browse/ARROW-1571 for detailed analysis.
   static const uint32_t countsort_min_len_ = 1024;
   static const uint32_t countsort_max_range_ = 4096;
+  // Radix sort needs a few passes over the values whatever their count, which
+  // only pays off against std::stable_sort on longer arrays.
+  static const uint32_t radixsort_min_len_ = 1024;
 };
 
+// Sort strings on normalized keys: 8 of their bytes, zero padded and read
+// big-endian so that the order of the keys is that of the bytes.  The keys are
+// radix sorted in a contiguous array, rather than chasing pointers into the
+// value buffer for each comparison.  Runs of strings sharing a key are sorted
+// the same way on their next 8 bytes, until they are short enough for
+// std::stable_sort.
+template <typename ArrowType>
+class PrefixSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  static constexpr int64_t kPrefixSize = sizeof(uint64_t);
+
+ public:
+  void Sort(int64_t* indices_begin, int64_t* indices_end, const ArrayType& values) {
+    const int64_t non_null_count = values.length() - values.null_count();
+    if (non_null_count < prefixsort_min_len_) {
+      compare_sorter_.Sort(indices_begin, indices_end, values);
+      return;
+    }
+
+    // Put the nulls last in original order
+    int64_t non_null_pos = 0;
+    int64_t null_pos = non_null_count;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsNull(i)) {
+        indices_begin[null_pos++] = i;
+      } else {
+        indices_begin[non_null_pos++] = i;
+      }
+    }
+    SortRun(values, indices_begin, indices_begin + non_null_count, 0);
+  }
+
+ private:
+  // Sort strings sharing their first depth bytes
+  void SortRun(const ArrayType& values, int64_t* begin, int64_t* end, int64_t depth) {
+    const int64_t length = end - begin;
+    if (length < prefixsort_min_run_ || depth >= prefixsort_max_depth_) {
+      std::stable_sort(begin, end, [&values](int64_t left, int64_t right) {
+        return values.GetView(left) < values.GetView(right);
+      });
+      return;
+    }
+
+    std::vector<uint64_t> keys(length);
+    for (int64_t i = 0; i < length; ++i) {
+      const auto value = values.GetView(begin[i]);
+      uint64_t prefix = 0;
+      if (static_cast<int64_t>(value.size()) > depth) {
+        std::memcpy(&prefix, value.data() + depth,
+                    static_cast<size_t>(std::min(
+                        static_cast<int64_t>(value.size()) - depth, kPrefixSize)));
+      }
+      keys[i] = BitUtil::FromBigEndian(prefix);
+    }
+    RadixSortKeys(&keys, begin, kPrefixSize);
+
+    // Break the ties between strings longer than their key, or with trailing
+    // zero bytes
+    int64_t run_start = 0;
+    for (int64_t i = 1; i <= length; ++i) {
+      if (i < length && keys[i] == keys[run_start]) {
+        continue;
+      }
+      if (i - run_start > 1) {
+        SortTies(values, begin + run_start, begin + i, depth + kPrefixSize);
+      }
+      run_start = i;
+    }
+  }
+
+  // Sort strings sharing their first depth bytes, if any has more of them.  A
+  // string which has no more is a prefix of the others, sorting before them.
+  void SortTies(const ArrayType& values, int64_t* begin, int64_t* end, int64_t depth) {
+    bool all_ended = true;
+    for (auto it = begin; it != end; ++it) {
+      all_ended &= static_cast<int64_t>(values.GetView(*it).size()) <= depth;
+    }
+    if (all_ended) {
+      std::stable_sort(begin, end, [&values](int64_t left, int64_t right) {
+        return values.GetView(left).size() < values.GetView(right).size();
+      });
+    } else {
+      SortRun(values, begin, end, depth);
+    }
+  }
+
+  CompareSorter<ArrowType> compare_sorter_;
+
+  // Radix sorting the keys takes up to 8 passes, which only pays off against
+  // std::stable_sort on longer arrays and runs.  Runs sharing a long prefix
+  // are left to std::stable_sort too, bounding the recursion.
+  static const uint32_t prefixsort_min_len_ = 1024;
+  static const uint32_t prefixsort_min_run_ = 64;
+  static const uint32_t prefixsort_max_depth_ = 64;
+};
+
+template <typename ArrowType>
+constexpr int64_t PrefixSorter<ArrowType>::kPrefixSize;
+
 template <typename ArrowType, typename Sorter>
 class SortToIndicesKernelImpl : public SortToIndicesKernel {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
@@ -254,6 +477,11 @@ static SortToIndicesKernelImpl<ArrowType, Sorter>* MakeCountOrCompareKernel() {
   return new SortToIndicesKernelImpl<ArrowType, Sorter>(Sorter());
 }
 
+template <typename ArrowType, typename Sorter = PrefixSorter<ArrowType>>
+static SortToIndicesKernelImpl<ArrowType, Sorter>* MakePrefixKernel() {
+  return new SortToIndicesKernelImpl<ArrowType, Sorter>(Sorter());
+}
+
 Status SortToIndicesKernel::Make(const std::shared_ptr<DataType>& value_type,
                                  std::unique_ptr<SortToIndicesKernel>* out) {
   SortToIndicesKernel* kernel;
@@ -289,10 +517,10 @@ Status SortToIndicesKernel::Make(const std::shared_ptr<DataType>& value_type,
       kernel = MakeCompareKernel<DoubleType>();
       break;
     case Type::BINARY:
-      kernel = MakeCompareKernel<BinaryType>();
+      kernel = MakePrefixKernel<BinaryType>();
       break;
     case Type::STRING:
-      kernel = MakeCompareKernel<StringType>();
+      kernel = MakePrefixKernel<StringType>();
       break;
     default:
       return Status::NotImplemented("Sorting of ", *value_type, " arrays");
@@ -315,5 +543,207 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Multi-column sort
+
+namespace {
+
+using internal::checked_cast;
+
+// Locate the chunk holding a given row of a chunked column
+class ChunkResolver {
+ public:
+  explicit ChunkResolver(const ArrayVector& chunks) : offsets_(chunks.size() + 1, 0) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      offsets_[i + 1] = offsets_[i] + chunks[i]->length();
+    }
+  }
+
+  // Return the number of the chunk holding `index`, and rebase `index` on it
+  int64_t Resolve(int64_t* index) const {
+    // Consecutive lookups are most often in the same chunk
+    if (*index < offsets_[cached_chunk_] || *index >= offsets_[cached_chunk_ + 1]) {
+      auto it = std::upper_bound(offsets_.begin(), offsets_.end(), *index);
+      cached_chunk_ = static_cast<int64_t>(it - offsets_.begin()) - 1;
+    }
+    *index -= offsets_[cached_chunk_];
+    return cached_chunk_;
+  }
+
+ private:
+  std::vector<int64_t> offsets_;
+  mutable int64_t cached_chunk_ = 0;
+};
+
+// Compare the rows of one sort key column
+class ColumnComparator {
+ public:
+  virtual ~ColumnComparator() = default;
+
+  // Return a negative value, zero or a positive value if row `left` sorts
+  // respectively before, the same as, or after row `right`
+  virtual int Compare(int64_t left, int64_t right) const = 0;
+};
+
+template <typename ArrowType>
+class ConcreteColumnComparator : public ColumnComparator {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  ConcreteColumnComparator(const ArrayVector& chunks, const SortKey& key)
+      : left_resolver_(chunks),
+        right_resolver_(chunks),
+        has_nulls_(false),
+        descending_(key.order == SortOrder::DESCENDING),
+        null_order_(key.null_placement == NullPlacement::AT_END ? 1 : -1) {
+    for (const auto& chunk : chunks) {
+      chunks_.push_back(checked_cast<const ArrayType*>(chunk.get()));
+      has_nulls_ = has_nulls_ || chunk->null_count() > 0;
+    }
+  }
+
+  int Compare(int64_t left, int64_t right) const override {
+    // Use separate resolvers, so that each keeps its cached chunk: the two
+    // sides are usually in different parts of the column
+    const ArrayType& left_array = *chunks_[left_resolver_.Resolve(&left)];
+    const ArrayType& right_array = *chunks_[right_resolver_.Resolve(&right)];
+    if (has_nulls_) {
+      const bool left_null = left_array.IsNull(left);
+      const bool right_null = right_array.IsNull(right);
+      if (left_null || right_null) {
+        if (left_null && right_null) {
+          return 0;
+        }
+        return left_null ? null_order_ : -null_order_;
+      }
+    }
+    const auto left_value = left_array.GetView(left);
+    const auto right_value = right_array.GetView(right);
+    int result = 0;
+    if (left_value < right_value) {
+      result = -1;
+    } else if (right_value < left_value) {
+      result = 1;
+    }
+    return descending_ ? -result : result;
+  }
+
+ private:
+  ChunkResolver left_resolver_;
+  ChunkResolver right_resolver_;
+  std::vector<const ArrayType*> chunks_;
+  bool has_nulls_;
+  const bool descending_;
+  const int null_order_;
+};
+
+Status MakeColumnComparator(const DataType& type, const ArrayVector& chunks,
+                            const SortKey& key, std::unique_ptr<ColumnComparator>* out) {
+  switch (type.id()) {
+#define COMPARATOR_CASE(TYPE_CLASS)                                          \
+  case TYPE_CLASS##Type::type_id:                                            \
+    out->reset(new ConcreteColumnComparator<TYPE_CLASS##Type>(chunks, key)); \
+    break;
+
+    COMPARATOR_CASE(UInt8)
+    COMPARATOR_CASE(Int8)
+    COMPARATOR_CASE(UInt16)
+    COMPARATOR_CASE(Int16)
+    COMPARATOR_CASE(UInt32)
+    COMPARATOR_CASE(Int32)
+    COMPARATOR_CASE(UInt64)
+    COMPARATOR_CASE(Int64)
+    COMPARATOR_CASE(Float)
+    COMPARATOR_CASE(Double)
+    COMPARATOR_CASE(Binary)
+    COMPARATOR_CASE(String)
+
+#undef COMPARATOR_CASE
+
+    default:
+      return Status::NotImplemented("Sorting of ", type, " arrays");
+  }
+  return Status::OK();
+}
+
+// Sort rows lexicographically on the given columns, one per key
+Status SortColumnsToIndices(FunctionContext* ctx, int64_t num_rows,
+                            const std::vector<std::shared_ptr<DataType>>& types,
+                            const std::vector<ArrayVector>& columns,
+                            const std::vector<SortKey>& keys,
+                            std::shared_ptr<Array>* offsets) {
+  std::vector<std::unique_ptr<ColumnComparator>> comparators(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    RETURN_NOT_OK(MakeColumnComparator(*types[i], columns[i], keys[i], &comparators[i]));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto indices_buf, AllocateBuffer(num_rows * sizeof(uint64_t),
+                                                         ctx->memory_pool()));
+  int64_t* indices_begin = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
+  int64_t* indices_end = indices_begin + num_rows;
+  std::iota(indices_begin, indices_end, 0);
+
+  std::stable_sort(indices_begin, indices_end,
+                   [&comparators](int64_t left, int64_t right) {
+                     // Compare key by key, stopping at the first difference
+                     for (const auto& comparator : comparators) {
+                       const int result = comparator->Compare(left, right);
+                       if (result != 0) {
+                         return result < 0;
+                       }
+                     }
+                     return false;
+                   });
+
+  *offsets = std::make_shared<UInt64Array>(num_rows, std::move(indices_buf));
+  return Status::OK();
+}
+
+Status ResolveSortKeys(const Schema& schema, const std::vector<SortKey>& keys,
+                       std::vector<int>* field_indices) {
+  if (keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  for (const auto& key : keys) {
+    const int field_index = schema.GetFieldIndex(key.name);
+    if (field_index < 0) {
+      return Status::Invalid("Cannot sort on column '", key.name,
+                             "': no unique column of that name in schema");
+    }
+    field_indices->push_back(field_index);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets) {
+  std::vector<int> field_indices;
+  RETURN_NOT_OK(ResolveSortKeys(*batch.schema(), keys, &field_indices));
+
+  std::vector<std::shared_ptr<DataType>> types;
+  std::vector<ArrayVector> columns;
+  for (int field_index : field_indices) {
+    types.push_back(batch.schema()->field(field_index)->type());
+    columns.push_back({batch.column(field_index)});
+  }
+  return SortColumnsToIndices(ctx, batch.num_rows(), types, columns, keys, offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets) {
+  std::vector<int> field_indices;
+  RETURN_NOT_OK(ResolveSortKeys(*table.schema(), keys, &field_indices));
+
+  std::vector<std::shared_ptr<DataType>> types;
+  std::vector<ArrayVector> columns;
+  for (int field_index : field_indices) {
+    types.push_back(table.schema()->field(field_index)->type());
+    columns.push_back(table.column(field_index)->chunks());
+  }
+  return SortColumnsToIndices(ctx, table.num_rows(), types, columns, keys, offsets);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,9 +18,13 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -47,5 +51,61 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+enum class SortOrder {
+  ASCENDING,
+  DESCENDING,
+};
+
+enum class NullPlacement {
+  /// Nulls are ordered after all non-null values
+  AT_END,
+  /// Nulls are ordered before all non-null values
+  AT_START,
+};
+
+/// \brief One key of a multi-column sort
+struct ARROW_EXPORT SortKey {
+  explicit SortKey(std::string name, SortOrder order = SortOrder::ASCENDING,
+                   NullPlacement null_placement = NullPlacement::AT_END)
+      : name(std::move(name)), order(order), null_placement(null_placement) {}
+
+  /// The name of the column to sort on
+  std::string name;
+  /// How to order the values of the column
+  SortOrder order;
+  /// Where to order the nulls of the column, regardless of `order`
+  NullPlacement null_placement;
+};
+
+/// \brief Returns the indices that would sort a record batch.
+///
+/// Perform an indirect lexicographic sort of the batch's rows: rows are
+/// ordered by the first key, ties are broken by the second key, and so on.
+/// The sort is stable, so rows which compare equal on all keys keep their
+/// relative order.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to sort
+/// \param[in] keys the columns to sort on, by decreasing priority
+/// \param[out] offsets indices that would sort the batch, suitable for Take()
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort a table.
+///
+/// Like SortToIndices() on a RecordBatch.  The table's columns are compared
+/// chunk-wise, without being concatenated first.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table table to sort
+/// \param[in] keys the columns to sort on, by decreasing priority
+/// \param[out] offsets indices that would sort the table, suitable for Take()
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include "arrow/compute/kernels/sort_to_indices.h"
 
+#include "arrow/builder.h"
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -63,6 +64,85 @@ static void SortToIndicesInt64Compare(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+template <typename ArrowType>
+static void SortToIndicesRange(benchmark::State& state,
+                               typename ArrowType::c_type min,
+                               typename ArrowType::c_type max) {
+  using CType = typename ArrowType::c_type;
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(CType);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.Numeric<ArrowType>(array_size, min, max, args.null_proportion);
+
+  SortToIndicesBenchmark(state, values);
+}
+
+// Values spanning 3 bytes: radix sort with 3 passes
+static void SortToIndicesInt64Medium(benchmark::State& state) {
+  SortToIndicesRange<Int64Type>(state, -(1 << 20), 1 << 20);
+}
+
+static void SortToIndicesInt32(benchmark::State& state) {
+  SortToIndicesRange<Int32Type>(state, std::numeric_limits<int32_t>::min(),
+                                std::numeric_limits<int32_t>::max());
+}
+
+static void SortToIndicesInt16(benchmark::State& state) {
+  SortToIndicesRange<Int16Type>(state, std::numeric_limits<int16_t>::min(),
+                                std::numeric_limits<int16_t>::max());
+}
+
+static void SortToIndicesUInt8(benchmark::State& state) {
+  SortToIndicesRange<UInt8Type>(state, 0, 255);
+}
+
+// Too short for counting or radix sort: std::stable_sort
+static void SortToIndicesInt64Short(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(512, std::numeric_limits<int64_t>::min(),
+                           std::numeric_limits<int64_t>::max(), args.null_proportion);
+
+  SortToIndicesBenchmark(state, values);
+}
+
+// Strings of 8 to 32 bytes, mostly told apart by their 8-byte prefix
+static void SortToIndicesString(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / 20;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.String(array_size, 8, 32, args.null_proportion);
+
+  SortToIndicesBenchmark(state, values);
+}
+
+// Strings sharing a long prefix, so that the ties of the prefix sort are broken
+// by full comparisons
+static void SortToIndicesStringCommonPrefix(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / 20;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto suffixes = std::static_pointer_cast<StringArray>(
+      rand.String(array_size, 0, 12, args.null_proportion));
+  StringBuilder builder;
+  for (int64_t i = 0; i < array_size; ++i) {
+    if (suffixes->IsNull(i)) {
+      ABORT_NOT_OK(builder.AppendNull());
+    } else {
+      ABORT_NOT_OK(builder.Append("common_prefix_" + suffixes->GetString(i)));
+    }
+  }
+  std::shared_ptr<Array> values;
+  ABORT_NOT_OK(builder.Finish(&values));
+
+  SortToIndicesBenchmark(state, values);
+}
+
 BENCHMARK(SortToIndicesInt64Count)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -77,5 +157,47 @@ BENCHMARK(SortToIndicesInt64Compare)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(SortToIndicesInt64Medium)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesInt32)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesInt16)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesUInt8)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesString)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesStringCommonPrefix)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesInt64Short)
+    ->Apply(RegressionSetArgs)
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
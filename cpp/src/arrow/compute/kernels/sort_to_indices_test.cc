@@ -17,12 +17,15 @@
 
 #include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -32,6 +35,7 @@
 namespace arrow {
 namespace compute {
 
+using arrow::internal::checked_cast;
 using arrow::internal::checked_pointer_cast;
 
 template <typename ArrowType>
@@ -129,6 +133,9 @@ class TestSortToIndicesKernelRandomCount : public ComputeFixture, public TestBas
 template <typename ArrowType>
 class TestSortToIndicesKernelRandomCompare : public ComputeFixture, public TestBase {};
 
+template <typename ArrowType>
+class TestSortToIndicesKernelRandomRadix : public ComputeFixture, public TestBase {};
+
 using SortToIndicesableTypes =
     ::testing::Types<UInt8Type, UInt16Type, UInt32Type, UInt64Type, Int8Type, Int16Type,
                      Int32Type, Int64Type, FloatType, DoubleType, StringType>;
@@ -245,7 +252,8 @@ TYPED_TEST(TestSortToIndicesKernelRandomCount, SortRandomValuesCount) {
   }
 }
 
-// Long array with big value range: std::stable_sort
+// Long array with big value range: radix sort
+// - length >= 1024(CountOrCompareSorter::radixsort_min_len_)
 TYPED_TEST_SUITE(TestSortToIndicesKernelRandomCompare, IntegralArrowTypes);
 
 TYPED_TEST(TestSortToIndicesKernelRandomCompare, SortRandomValuesCompare) {
@@ -265,5 +273,223 @@ TYPED_TEST(TestSortToIndicesKernelRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+// Long array with medium value ranges: radix sort with a varying number of passes
+TYPED_TEST_SUITE(TestSortToIndicesKernelRandomRadix, IntegralArrowTypes);
+
+TYPED_TEST(TestSortToIndicesKernelRandomRadix, SortRandomValuesRadix) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  RandomRange<TypeParam> rand(0x5487658);
+  for (int length : {1100, 5000}) {
+    for (int range : {5000, 70000, 1 << 25}) {
+      for (auto null_probability : {0.0, 0.1, 0.5}) {
+        auto array = rand.Generate(length, range, null_probability);
+        std::shared_ptr<Array> offsets;
+        ASSERT_OK(arrow::compute::SortToIndices(&this->ctx_, *array, &offsets));
+        ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array),
+                                  *checked_pointer_cast<UInt64Array>(offsets));
+      }
+    }
+  }
+}
+
+// Long arrays of strings: prefix sort.  Strings over a small alphabet
+// including zero bytes, so that many share their 8-byte key and ties between
+// keys are broken on their length or their next bytes.  A common prefix makes
+// whole arrays share their first keys.
+template <typename ArrowType>
+class TestSortToIndicesKernelRandomPrefix : public ComputeFixture, public TestBase {};
+using PrefixSortableTypes = ::testing::Types<StringType, BinaryType>;
+TYPED_TEST_SUITE(TestSortToIndicesKernelRandomPrefix, PrefixSortableTypes);
+
+TYPED_TEST(TestSortToIndicesKernelRandomPrefix, SortRandomValuesPrefix) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+  using BuilderType = typename TypeTraits<TypeParam>::BuilderType;
+
+  std::default_random_engine engine(0x5487659);
+  std::uniform_int_distribution<int> size_dist(0, 12);
+  std::uniform_int_distribution<int> char_dist(0, 2);
+  std::uniform_real_distribution<double> null_dist(0.0, 1.0);
+  const char alphabet[] = {'\0', 'a', 'b'};
+  for (int length : {1100, 5000}) {
+    for (auto null_probability : {0.0, 0.1, 0.5}) {
+      for (size_t prefix_size : {0, 20, 70}) {
+        SCOPED_TRACE(::testing::Message() << "prefix size " << prefix_size);
+        BuilderType builder;
+        for (int i = 0; i < length; ++i) {
+          if (null_dist(engine) < null_probability) {
+            ASSERT_OK(builder.AppendNull());
+            continue;
+          }
+          std::string value(size_dist(engine), '\0');
+          for (auto& c : value) {
+            c = alphabet[char_dist(engine)];
+          }
+          value = std::string(prefix_size, 'x') + value;
+          ASSERT_OK(builder.Append(value));
+        }
+        std::shared_ptr<Array> array, offsets;
+        ASSERT_OK(builder.Finish(&array));
+        ASSERT_OK(arrow::compute::SortToIndices(&this->ctx_, *array, &offsets));
+        ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array),
+                                  *checked_pointer_cast<UInt64Array>(offsets));
+        ASSERT_OK(arrow::compute::SortToIndices(&this->ctx_, *array->Slice(7), &offsets));
+        ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array->Slice(7)),
+                                  *checked_pointer_cast<UInt64Array>(offsets));
+      }
+    }
+  }
+}
+
+class TestSortToIndicesMultiKey : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const RecordBatch& batch, const std::vector<SortKey>& keys,
+                           const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, batch, keys, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+
+  void AssertSortToIndices(const Table& table, const std::vector<SortKey>& keys,
+                           const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, table, keys, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+
+  std::shared_ptr<Schema> schema_ =
+      schema({field("a", int32()), field("b", utf8()), field("c", float64())});
+};
+
+TEST_F(TestSortToIndicesMultiKey, RecordBatch) {
+  auto batch = RecordBatchFromJSON(schema_, R"([
+    {"a": 2,    "b": "x",  "c": 1.5},
+    {"a": 1,    "b": "y",  "c": null},
+    {"a": null, "b": "x",  "c": 2.5},
+    {"a": 2,    "b": null, "c": 0.5},
+    {"a": 1,    "b": "x",  "c": 3.5},
+    {"a": 2,    "b": "x",  "c": 0.5}
+  ])");
+
+  AssertSortToIndices(*batch, {SortKey("a")}, "[1, 4, 0, 3, 5, 2]");
+  AssertSortToIndices(*batch, {SortKey("a"), SortKey("b")}, "[4, 1, 0, 5, 3, 2]");
+  AssertSortToIndices(*batch, {SortKey("a"), SortKey("b"), SortKey("c")},
+                      "[4, 1, 5, 0, 3, 2]");
+  AssertSortToIndices(*batch,
+                      {SortKey("a", SortOrder::DESCENDING), SortKey("b"),
+                       SortKey("c", SortOrder::DESCENDING)},
+                      "[0, 5, 3, 4, 1, 2]");
+  // Nulls can be placed first, whatever the order
+  AssertSortToIndices(*batch,
+                      {SortKey("a", SortOrder::ASCENDING, NullPlacement::AT_START),
+                       SortKey("b", SortOrder::DESCENDING, NullPlacement::AT_START)},
+                      "[2, 1, 4, 3, 0, 5]");
+  AssertSortToIndices(*batch, {SortKey("c", SortOrder::DESCENDING)},
+                      "[4, 2, 0, 3, 5, 1]");
+}
+
+TEST_F(TestSortToIndicesMultiKey, Table) {
+  // The same rows as in the RecordBatch test, across uneven chunks
+  auto table = TableFromJSON(schema_, {R"([
+    {"a": 2,    "b": "x",  "c": 1.5},
+    {"a": 1,    "b": "y",  "c": null}
+  ])",
+                                       R"([])", R"([
+    {"a": null, "b": "x",  "c": 2.5}
+  ])",
+                                       R"([
+    {"a": 2,    "b": null, "c": 0.5},
+    {"a": 1,    "b": "x",  "c": 3.5},
+    {"a": 2,    "b": "x",  "c": 0.5}
+  ])"});
+
+  AssertSortToIndices(*table, {SortKey("a"), SortKey("b"), SortKey("c")},
+                      "[4, 1, 5, 0, 3, 2]");
+  AssertSortToIndices(*table,
+                      {SortKey("a", SortOrder::DESCENDING), SortKey("b"),
+                       SortKey("c", SortOrder::DESCENDING)},
+                      "[0, 5, 3, 4, 1, 2]");
+  AssertSortToIndices(*TableFromJSON(schema_, {}), {SortKey("a")}, "[]");
+}
+
+TEST_F(TestSortToIndicesMultiKey, RandomChunkedTable) {
+  // Sorting a chunked table gives the same result as sorting its
+  // concatenation, and yields rows in lexicographic order
+  random::RandomArrayGenerator rand(0x5487659);
+  const int64_t length = 5000;
+  auto a = rand.Int16(length, 0, 20, /*null_probability=*/0.1);
+  auto b = rand.String(length, 0, 2, /*null_probability=*/0.1);
+  auto c = rand.Float64(length, -1.0, 1.0, /*null_probability=*/0.1);
+  auto full_schema =
+      schema({field("a", int16()), field("b", utf8()), field("c", float64())});
+  auto batch = RecordBatch::Make(full_schema, length, {a, b, c});
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t offset = 0; offset < length; offset += 700) {
+    batches.push_back(batch->Slice(offset, 700));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+
+  std::vector<SortKey> keys = {
+      SortKey("a", SortOrder::DESCENDING),
+      SortKey("b", SortOrder::ASCENDING, NullPlacement::AT_START), SortKey("c")};
+  std::shared_ptr<Array> batch_offsets, table_offsets;
+  ASSERT_OK(SortToIndices(&this->ctx_, *batch, keys, &batch_offsets));
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, keys, &table_offsets));
+  AssertArraysEqual(*batch_offsets, *table_offsets);
+
+  // Check that consecutive rows are ordered, key by key
+  const auto& offsets = checked_cast<const UInt64Array&>(*batch_offsets);
+  const auto& a_values = checked_cast<const Int16Array&>(*a);
+  const auto& b_values = checked_cast<const StringArray&>(*b);
+  const auto& c_values = checked_cast<const DoubleArray&>(*c);
+  for (int64_t i = 1; i < length; ++i) {
+    const auto left = offsets.Value(i - 1);
+    const auto right = offsets.Value(i);
+    // a: descending, nulls at end
+    if (a_values.IsNull(left) != a_values.IsNull(right)) {
+      ASSERT_TRUE(a_values.IsNull(right));
+      continue;
+    }
+    if (a_values.IsValid(left) && a_values.Value(left) != a_values.Value(right)) {
+      ASSERT_GT(a_values.Value(left), a_values.Value(right));
+      continue;
+    }
+    // b: ascending, nulls at start
+    if (b_values.IsNull(left) != b_values.IsNull(right)) {
+      ASSERT_TRUE(b_values.IsNull(left));
+      continue;
+    }
+    if (b_values.IsValid(left) && b_values.GetView(left) != b_values.GetView(right)) {
+      ASSERT_LT(b_values.GetView(left), b_values.GetView(right));
+      continue;
+    }
+    // c: ascending, nulls at end, then stable
+    if (c_values.IsNull(left) != c_values.IsNull(right)) {
+      ASSERT_TRUE(c_values.IsNull(right));
+      continue;
+    }
+    if (c_values.IsValid(left) && c_values.Value(left) != c_values.Value(right)) {
+      ASSERT_LT(c_values.Value(left), c_values.Value(right));
+      continue;
+    }
+    ASSERT_LT(left, right);
+  }
+}
+
+TEST_F(TestSortToIndicesMultiKey, Errors) {
+  auto batch = RecordBatchFromJSON(schema_, R"([{"a": 1, "b": "x", "c": 1.5}])");
+  std::shared_ptr<Array> offsets;
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *batch, {}, &offsets));
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *batch, {SortKey("d")}, &offsets));
+
+  auto bool_batch =
+      RecordBatchFromJSON(schema({field("a", boolean())}), R"([{"a": true}])");
+  ASSERT_RAISES(NotImplemented,
+                SortToIndices(&this->ctx_, *bool_batch, {SortKey("a")}, &offsets));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,314 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string_ops.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Accessors for the offsets and value data of a binary-like ArrayData
+template <typename Type>
+struct StringData {
+  using offset_type = typename Type::offset_type;
+
+  explicit StringData(const ArrayData& data)
+      : offsets(data.GetValues<offset_type>(1)),
+        data(data.buffers[2] == nullptr ? nullptr : data.buffers[2]->data()),
+        length(data.length) {}
+
+  offset_type value_length(int64_t i) const { return offsets[i + 1] - offsets[i]; }
+
+  const uint8_t* value(int64_t i) const { return data + offsets[i]; }
+
+  // offsets[0..length], relative to the array offset
+  const offset_type* offsets;
+  const uint8_t* data;
+  int64_t length;
+};
+
+template <typename Type>
+class StringLengthKernel final : public UnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+  using OutType =
+      typename std::conditional<sizeof(offset_type) == 4, Int32Type, Int64Type>::type;
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<OutType>::type_singleton();
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& in = *input.array();
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in, out));
+
+    const offset_type* offsets = in.GetValues<offset_type>(1);
+    offset_type* lengths = out->GetMutableValues<offset_type>(1);
+    for (int64_t i = 0; i < in.length; ++i) {
+      lengths[i] = offsets[i + 1] - offsets[i];
+    }
+    return Status::OK();
+  }
+};
+
+// Map the ASCII letters of length bytes, without branches so that the loop is
+// vectorized
+template <bool kUpper>
+void MapAsciiCase(const uint8_t* in, int64_t length, uint8_t* out) {
+  const uint8_t first = kUpper ? 'a' : 'A';
+  for (int64_t i = 0; i < length; ++i) {
+    const uint8_t c = in[i];
+    out[i] = static_cast<uint8_t>(c ^ ((static_cast<uint8_t>(c - first) < 26) << 5));
+  }
+}
+
+template <typename Type, bool kUpper>
+class AsciiCaseKernel final : public UnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit AsciiCaseKernel(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  // The output is built in a single pass over the value data, into buffers of
+  // the exact sizes known from the input offsets
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& in = *input.array();
+    const StringData<Type> strings(in);
+    ArrayData* out = out_datum->array().get();
+    out->buffers.resize(3);
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in, out));
+
+    // Offsets are shared unless they need to be rebased to start at zero
+    const offset_type first_offset = strings.offsets[0];
+    const int64_t offsets_size = (in.length + 1) * sizeof(offset_type);
+    if (first_offset == 0) {
+      out->buffers[1] = SliceBuffer(in.buffers[1], in.offset * sizeof(offset_type),
+                                    offsets_size);
+    } else {
+      RETURN_NOT_OK(ctx->Allocate(offsets_size, &out->buffers[1]));
+      auto out_offsets = out->GetMutableValues<offset_type>(1);
+      for (int64_t i = 0; i <= in.length; ++i) {
+        out_offsets[i] = strings.offsets[i] - first_offset;
+      }
+    }
+
+    const int64_t data_size = strings.offsets[in.length] - first_offset;
+    RETURN_NOT_OK(ctx->Allocate(data_size, &out->buffers[2]));
+    if (data_size > 0) {
+      MapAsciiCase<kUpper>(strings.data + first_offset, data_size,
+                           out->buffers[2]->mutable_data());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+// Find the strings containing the pattern by scanning the value data of all the
+// strings with memchr for the first byte of the pattern, and checking candidate
+// positions against the rest of it.  Strings are skipped as soon as they match.
+template <typename Type>
+void FindContaining(const StringData<Type>& strings, const std::string& pattern,
+                    uint8_t* out_bitmap) {
+  using offset_type = typename Type::offset_type;
+  const auto* pattern_data = reinterpret_cast<const uint8_t*>(pattern.data());
+  const auto pattern_length = static_cast<offset_type>(pattern.size());
+  const offset_type* offsets = strings.offsets;
+  const offset_type* offsets_end = offsets + strings.length + 1;
+  const offset_type end = offsets[strings.length];
+
+  offset_type position = offsets[0];
+  int64_t i = 0;
+  while (end - position >= pattern_length) {
+    const void* found =
+        std::memchr(strings.data + position, pattern_data[0], end - position);
+    if (found == nullptr) {
+      break;
+    }
+    position = static_cast<offset_type>(static_cast<const uint8_t*>(found) -
+                                        strings.data);
+    // The string containing the candidate, skipping any which have none
+    i = std::upper_bound(offsets + i + 1, offsets_end, position) - offsets - 1;
+    if (offsets[i + 1] - position >= pattern_length &&
+        std::memcmp(strings.data + position + 1, pattern_data + 1,
+                    pattern_length - 1) == 0) {
+      BitUtil::SetBit(out_bitmap, i);
+      position = offsets[++i];
+    } else {
+      ++position;
+    }
+  }
+}
+
+template <typename Type>
+class MatchSubstringKernel final : public UnaryKernel {
+ public:
+  explicit MatchSubstringKernel(MatchSubstringOptions options)
+      : options_(std::move(options)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& in = *input.array();
+    const StringData<Type> strings(in);
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in, out));
+    uint8_t* out_bitmap = out->buffers[1]->mutable_data();
+
+    const std::string& pattern = options_.pattern;
+    const auto pattern_length = static_cast<int64_t>(pattern.size());
+    if (pattern_length == 0) {
+      BitUtil::SetBitsTo(out_bitmap, 0, in.length, true);
+      return Status::OK();
+    }
+
+    switch (options_.mode) {
+      case MatchSubstringOptions::CONTAINS:
+        BitUtil::SetBitsTo(out_bitmap, 0, in.length, false);
+        FindContaining(strings, pattern, out_bitmap);
+        break;
+      case MatchSubstringOptions::STARTS_WITH: {
+        int64_t i = 0;
+        internal::GenerateBitsUnrolled(out_bitmap, 0, in.length, [&] {
+          const bool match = strings.value_length(i) >= pattern_length &&
+                             std::memcmp(strings.value(i), pattern.data(),
+                                         pattern_length) == 0;
+          ++i;
+          return match;
+        });
+        break;
+      }
+      case MatchSubstringOptions::ENDS_WITH: {
+        int64_t i = 0;
+        internal::GenerateBitsUnrolled(out_bitmap, 0, in.length, [&] {
+          const bool match =
+              strings.value_length(i) >= pattern_length &&
+              std::memcmp(strings.value(i + 1) - pattern_length, pattern.data(),
+                          pattern_length) == 0;
+          ++i;
+          return match;
+        });
+        break;
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  MatchSubstringOptions options_;
+};
+
+template <typename Type>
+using AsciiUpperKernel = AsciiCaseKernel<Type, true>;
+
+template <typename Type>
+using AsciiLowerKernel = AsciiCaseKernel<Type, false>;
+
+// Make a kernel for the binary-like type of the values, constructed with args
+template <template <typename> class Kernel, typename... Args>
+Status MakeStringKernel(const char* name, const Datum& values,
+                        std::unique_ptr<UnaryKernel>* out, Args&&... args) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid(name, " expects array-like values");
+  }
+  switch (values.type()->id()) {
+    case Type::STRING:
+      out->reset(new Kernel<StringType>(std::forward<Args>(args)...));
+      break;
+    case Type::BINARY:
+      out->reset(new Kernel<BinaryType>(std::forward<Args>(args)...));
+      break;
+    case Type::LARGE_STRING:
+      out->reset(new Kernel<LargeStringType>(std::forward<Args>(args)...));
+      break;
+    case Type::LARGE_BINARY:
+      out->reset(new Kernel<LargeBinaryType>(std::forward<Args>(args)...));
+      break;
+    default:
+      return Status::NotImplemented(name, " not implemented for type ", *values.type());
+  }
+  return Status::OK();
+}
+
+// Invoke the kernel on each chunk of the values.  Fixed-width outputs are
+// preallocated, others are allocated by the kernel.
+Status InvokeStringKernel(FunctionContext* ctx, UnaryKernel* kernel, const Datum& values,
+                          Datum* out) {
+  std::vector<Datum> outputs;
+  if (is_fixed_width(kernel->out_type()->id())) {
+    detail::PrimitiveAllocatingUnaryKernel allocating(kernel);
+    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &allocating, values, &outputs));
+  } else {
+    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel, values, &outputs));
+  }
+  *out = detail::WrapDatumsLike(values, kernel->out_type(), outputs);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status StringLength(FunctionContext* ctx, const Datum& strings, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<StringLengthKernel>("StringLength", strings, &kernel));
+  return InvokeStringKernel(ctx, kernel.get(), strings, out);
+}
+
+Status AsciiUpper(FunctionContext* ctx, const Datum& strings, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(
+      MakeStringKernel<AsciiUpperKernel>("AsciiUpper", strings, &kernel, strings.type()));
+  return InvokeStringKernel(ctx, kernel.get(), strings, out);
+}
+
+Status AsciiLower(FunctionContext* ctx, const Datum& strings, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(
+      MakeStringKernel<AsciiLowerKernel>("AsciiLower", strings, &kernel, strings.type()));
+  return InvokeStringKernel(ctx, kernel.get(), strings, out);
+}
+
+Status MatchSubstring(FunctionContext* ctx, const Datum& strings,
+                      const MatchSubstringOptions& options, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<MatchSubstringKernel>("MatchSubstring", strings,
+                                                       &kernel, options));
+  return InvokeStringKernel(ctx, kernel.get(), strings, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
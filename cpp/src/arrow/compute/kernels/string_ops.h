@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Compute the length in bytes of each string
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] strings Array or ChunkedArray of string, binary, large_string or
+///            large_binary type
+/// \param[out] out resulting datum of int32 type, or int64 for large types.
+///             Null strings have null lengths.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StringLength(FunctionContext* ctx, const Datum& strings, Datum* out);
+
+/// \brief Convert the ASCII letters of each string to upper case
+///
+/// Other bytes, including those of non-ASCII UTF-8 characters, are copied
+/// unchanged.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] strings Array or ChunkedArray of string, binary, large_string or
+///            large_binary type
+/// \param[out] out resulting datum of the same type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiUpper(FunctionContext* ctx, const Datum& strings, Datum* out);
+
+/// \brief Convert the ASCII letters of each string to lower case
+///
+/// \see AsciiUpper
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiLower(FunctionContext* ctx, const Datum& strings, Datum* out);
+
+struct ARROW_EXPORT MatchSubstringOptions {
+  enum Mode {
+    /// the pattern occurs anywhere in the string
+    CONTAINS,
+    /// the string starts with the pattern
+    STARTS_WITH,
+    /// the string ends with the pattern
+    ENDS_WITH,
+  };
+
+  explicit MatchSubstringOptions(std::string pattern, Mode mode = CONTAINS)
+      : pattern(std::move(pattern)), mode(mode) {}
+
+  /// The bytes to look for, matched exactly
+  std::string pattern;
+  Mode mode;
+};
+
+/// \brief Check whether each string contains, starts or ends with a pattern
+///
+/// Looking for the pattern anywhere scans the value data of all strings at
+/// once for the first byte of the pattern, rather than each string in turn.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] strings Array or ChunkedArray of string, binary, large_string or
+///            large_binary type
+/// \param[in] options the pattern and where to look for it
+/// \param[out] out resulting datum of boolean type.  Null strings yield null.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MatchSubstring(FunctionContext* ctx, const Datum& strings,
+                      const MatchSubstringOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/string_ops.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename ArrowType>
+class TestStringKernels : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<DataType> length_type() {
+    return sizeof(typename ArrowType::offset_type) == 4 ? int32() : int64();
+  }
+
+  void AssertOutput(const Datum& actual, const std::shared_ptr<Array>& expected) {
+    ASSERT_TRUE(actual.is_array());
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysEqual(*expected, *actual.make_array());
+  }
+
+  void AssertMatch(const std::shared_ptr<Array>& strings, const std::string& pattern,
+                   MatchSubstringOptions::Mode mode, const std::string& expected) {
+    Datum actual;
+    ASSERT_OK(MatchSubstring(&this->ctx_, strings, MatchSubstringOptions(pattern, mode),
+                             &actual));
+    AssertOutput(actual, ArrayFromJSON(boolean(), expected));
+  }
+
+  void AssertMatch(const std::string& strings, const std::string& pattern,
+                   MatchSubstringOptions::Mode mode, const std::string& expected) {
+    AssertMatch(ArrayFromJSON(type(), strings), pattern, mode, expected);
+  }
+};
+
+typedef ::testing::Types<StringType, LargeStringType, BinaryType, LargeBinaryType>
+    StringLikeTypes;
+
+TYPED_TEST_SUITE(TestStringKernels, StringLikeTypes);
+
+TYPED_TEST(TestStringKernels, Length) {
+  auto strings = ArrayFromJSON(this->type(), R"(["", "a", null, "hello", "hé"])");
+  Datum actual;
+  ASSERT_OK(StringLength(&this->ctx_, strings, &actual));
+  this->AssertOutput(actual, ArrayFromJSON(this->length_type(), "[0, 1, null, 5, 3]"));
+  ASSERT_OK(StringLength(&this->ctx_, strings->Slice(2), &actual));
+  this->AssertOutput(actual, ArrayFromJSON(this->length_type(), "[null, 5, 3]"));
+
+  auto chunked =
+      std::make_shared<ChunkedArray>(ArrayVector{strings->Slice(0, 2), strings->Slice(2)});
+  ASSERT_OK(StringLength(&this->ctx_, chunked, &actual));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, actual.kind());
+  AssertChunkedEqual(ChunkedArray({ArrayFromJSON(this->length_type(), "[0, 1]"),
+                                   ArrayFromJSON(this->length_type(), "[null, 5, 3]")}),
+                     *actual.chunked_array());
+}
+
+TYPED_TEST(TestStringKernels, AsciiCase) {
+  auto strings =
+      ArrayFromJSON(this->type(), R"(["aBc@[`{Zz", null, "", "héLLo", "09"])");
+  Datum actual;
+  ASSERT_OK(AsciiUpper(&this->ctx_, strings, &actual));
+  this->AssertOutput(actual, ArrayFromJSON(this->type(),
+                                           R"(["ABC@[`{ZZ", null, "", "HéLLO", "09"])"));
+  ASSERT_OK(AsciiLower(&this->ctx_, strings, &actual));
+  this->AssertOutput(actual, ArrayFromJSON(this->type(),
+                                           R"(["abc@[`{zz", null, "", "héllo", "09"])"));
+
+  // Offsets of sliced values are rebased
+  ASSERT_OK(AsciiUpper(&this->ctx_, strings->Slice(3), &actual));
+  ASSERT_EQ(0, actual.array()->GetValues<typename TypeParam::offset_type>(1)[0]);
+  this->AssertOutput(actual, ArrayFromJSON(this->type(), R"(["HéLLO", "09"])"));
+}
+
+TYPED_TEST(TestStringKernels, Contains) {
+  const auto mode = MatchSubstringOptions::CONTAINS;
+  this->AssertMatch("[]", "ab", mode, "[]");
+  this->AssertMatch(R"(["ab", "cd", null, "xaab", "", "b", "abab"])", "ab", mode,
+                    "[true, false, null, true, false, false, true]");
+  // Matches don't span strings
+  this->AssertMatch(R"(["a", "bc", "ab", "c"])", "abc", mode,
+                    "[false, false, false, false]");
+  this->AssertMatch(R"(["xa", "b"])", "ab", mode, "[false, false]");
+  this->AssertMatch(R"(["", "x", null])", "", mode, "[true, true, null]");
+  auto strings = ArrayFromJSON(this->type(), R"(["ab", "xxab", "xa", "b"])");
+  this->AssertMatch(strings->Slice(1, 2), "ab", mode, "[true, false]");
+  this->AssertMatch(strings->Slice(2), "ab", mode, "[false, false]");
+}
+
+TYPED_TEST(TestStringKernels, StartsAndEndsWith) {
+  const auto strings = R"(["abc", "ab", null, "a", "", "cab", "abab"])";
+  this->AssertMatch(strings, "ab", MatchSubstringOptions::STARTS_WITH,
+                    "[true, true, null, false, false, false, true]");
+  this->AssertMatch(strings, "ab", MatchSubstringOptions::ENDS_WITH,
+                    "[false, true, null, false, false, true, true]");
+  this->AssertMatch(strings, "", MatchSubstringOptions::ENDS_WITH,
+                    "[true, true, null, true, true, true, true]");
+}
+
+TYPED_TEST(TestStringKernels, RandomContains) {
+  std::mt19937 engine(0x5eed);
+  std::uniform_int_distribution<int> length_dist(0, 12);
+  std::uniform_int_distribution<int> char_dist('a', 'd');
+  const int64_t length = 2000;
+  std::vector<std::string> values(length);
+  std::vector<bool> is_valid(length);
+  for (int64_t i = 0; i < length; ++i) {
+    for (int j = length_dist(engine); j > 0; --j) {
+      values[i] += static_cast<char>(char_dist(engine));
+    }
+    is_valid[i] = i % 7 != 0;
+  }
+  std::shared_ptr<Array> strings;
+  ArrayFromVector<TypeParam, std::string>(is_valid, values, &strings);
+
+  for (const std::string pattern : {"a", "ab", "dca", "abcab"}) {
+    std::vector<bool> expected_values(length);
+    for (int64_t i = 0; i < length; ++i) {
+      expected_values[i] = values[i].find(pattern) != std::string::npos;
+    }
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<BooleanType, bool>(is_valid, expected_values, &expected);
+
+    Datum actual;
+    ASSERT_OK(MatchSubstring(&this->ctx_, strings, MatchSubstringOptions(pattern),
+                             &actual));
+    this->AssertOutput(actual, expected);
+    ASSERT_OK(MatchSubstring(&this->ctx_, strings->Slice(333),
+                             MatchSubstringOptions(pattern), &actual));
+    this->AssertOutput(actual, expected->Slice(333));
+  }
+}
+
+TEST(TestStringKernelErrors, Errors) {
+  FunctionContext ctx;
+  Datum actual;
+  auto ints = ArrayFromJSON(int32(), "[1]");
+  ASSERT_RAISES(NotImplemented, StringLength(&ctx, ints, &actual));
+  ASSERT_RAISES(NotImplemented, AsciiUpper(&ctx, ints, &actual));
+  ASSERT_RAISES(NotImplemented,
+                MatchSubstring(&ctx, ints, MatchSubstringOptions("a"), &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
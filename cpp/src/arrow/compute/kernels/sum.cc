@@ -19,6 +19,7 @@
 
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace compute {
@@ -93,6 +94,7 @@ static Status GetSumKernel(FunctionContext* ctx, const DataType& type,
 }
 
 Status Sum(FunctionContext* ctx, const Datum& value, Datum* out) {
+  ARROW_TRACE_SPAN("compute::Sum");
   std::shared_ptr<AggregateUnaryKernel> kernel;
 
   auto data_type = value.type();
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 
@@ -54,17 +56,65 @@ struct FindAccumulatorType<I, enable_if_floating_point<I>> {
   using Type = DoubleType;
 };
 
+// Combines the sums of consecutive blocks of values.  Integer sums are exact and
+// simply added up.
+template <typename SumCType, typename Enable = void>
+class BlockSumAccumulator {
+ public:
+  void Add(SumCType block_sum) { sum_ += block_sum; }
+
+  SumCType Finish() const { return sum_; }
+
+ private:
+  SumCType sum_ = 0;
+};
+
+// Floating point block sums are combined by pairwise summation: the partial sums
+// form a binary counter where partial_sums_[level] holds the sum of 2^level
+// blocks, and two partial sums of a level are added before being carried to the
+// next one.  The rounding error then grows with the logarithm of the number of
+// values instead of linearly, at the cost of a few additions per block.
+template <typename SumCType>
+class BlockSumAccumulator<SumCType,
+                          enable_if_t<std::is_floating_point<SumCType>::value>> {
+ public:
+  void Add(SumCType block_sum) {
+    int level = 0;
+    while (occupied_ & (uint64_t(1) << level)) {
+      block_sum += partial_sums_[level];
+      occupied_ &= ~(uint64_t(1) << level);
+      ++level;
+    }
+    partial_sums_[level] = block_sum;
+    occupied_ |= uint64_t(1) << level;
+  }
+
+  SumCType Finish() const {
+    SumCType sum = 0;
+    for (int level = 0; level < 64; ++level) {
+      if (occupied_ & (uint64_t(1) << level)) {
+        sum += partial_sums_[level];
+      }
+    }
+    return sum;
+  }
+
+ private:
+  SumCType partial_sums_[64];
+  uint64_t occupied_ = 0;
+};
+
 template <typename ArrowType, typename StateType>
 class SumAggregateFunction final : public AggregateFunctionStaticState<StateType> {
   using CType = typename TypeTraits<ArrowType>::CType;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using SumCType = decltype(StateType().sum);
 
-  // A small number of elements rounded to the next cacheline. This should
-  // amount to a maximum of 4 cachelines when dealing with 8 bytes elements.
-  static constexpr int64_t kTinyThreshold = 32;
-  static_assert(kTinyThreshold >= (2 * CHAR_BIT) + 1,
-                "ConsumeSparse requires 3 bytes of null bitmap, and 17 is the"
-                "required minimum number of bits/elements to cover 3 bytes.");
+  // Values are consumed in blocks of 64, one word of the validity bitmap.  Each
+  // block is summed into kLanes independent accumulators, a loop the compiler
+  // vectorizes even for floating point (where it may not reorder additions).
+  static constexpr int64_t kBlockSize = 64;
+  static constexpr int64_t kLanes = 8;
 
  public:
   Status Consume(const Array& input, StateType* state) const override {
@@ -72,10 +122,6 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
 
     if (input.null_count() == 0) {
       *state = ConsumeDense(array);
-    } else if (input.length() <= kTinyThreshold) {
-      // In order to simplify ConsumeSparse implementation (requires at least 3
-      // bytes of bitmap data), small arrays are handled differently.
-      *state = ConsumeTiny(array);
     } else {
       *state = ConsumeSparse(array);
     }
@@ -96,112 +142,131 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
   std::shared_ptr<DataType> out_type() const override { return StateType::out_type(); }
 
  private:
-  StateType ConsumeDense(const ArrayType& array) const {
-    StateType local;
+  static SumCType ReduceLanes(const SumCType* lanes) {
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+           ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+  }
 
-    const auto values = array.raw_values();
-    const int64_t length = array.length();
-    for (int64_t i = 0; i < length; i++) {
-      local.sum += values[i];
+  static SumCType SumBlock(const CType* values) {
+    SumCType lanes[kLanes] = {};
+    for (int64_t i = 0; i < kBlockSize; i += kLanes) {
+      for (int64_t j = 0; j < kLanes; ++j) {
+        lanes[j] += values[i + j];
+      }
     }
+    return ReduceLanes(lanes);
+  }
 
-    local.count = length;
-
-    return local;
+  // Select a value or zero without branching, in a way the compiler vectorizes.
+  // Integers are multiplied by the validity bit.
+  template <typename T = CType>
+  static enable_if_t<std::is_integral<T>::value, SumCType> MaskedValue(unsigned valid,
+                                                                       T value) {
+    return static_cast<SumCType>(value) * static_cast<SumCType>(valid);
   }
 
-  StateType ConsumeTiny(const ArrayType& array) const {
-    StateType local;
+  // Floating point values are masked bitwise instead, since a multiplication
+  // would turn a NaN or infinity behind a null slot into NaN.
+  template <typename T = CType>
+  static enable_if_t<std::is_floating_point<T>::value, SumCType> MaskedValue(
+      unsigned valid, T value) {
+    using UInt = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+    UInt raw;
+    std::memcpy(&raw, &value, sizeof(raw));
+    raw &= static_cast<UInt>(0) - static_cast<UInt>(valid);
+    std::memcpy(&value, &raw, sizeof(raw));
+    return static_cast<SumCType>(value);
+  }
 
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
-                                  array.length());
-    const auto values = array.raw_values();
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (reader.IsSet()) {
-        local.sum += values[i];
-        local.count++;
+  static SumCType MaskedSumBlock(uint64_t valid_bits, const CType* values) {
+    SumCType lanes[kLanes] = {};
+    for (int64_t i = 0; i < kBlockSize; i += kLanes) {
+      const auto bits = static_cast<unsigned>((valid_bits >> i) & 0xFF);
+      for (int64_t j = 0; j < kLanes; ++j) {
+        lanes[j] += MaskedValue((bits >> j) & 1, values[i + j]);
       }
-      reader.Next();
     }
+    return ReduceLanes(lanes);
+  }
 
-    return local;
+  static SumCType MaskedSumPartialBlock(uint64_t valid_bits, const CType* values,
+                                        int64_t length) {
+    SumCType sum = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      sum += MaskedValue(static_cast<unsigned>((valid_bits >> i) & 1), values[i]);
+    }
+    return sum;
   }
 
-  // While this is not branchless, gcc needs this to be in a different function
-  // for it to generate cmov which ends to be slightly faster than
-  // multiplication but safe for handling NaN with doubles.
-  inline CType MaskedValue(bool valid, CType value) const { return valid ? value : 0; }
+  // Load the 64 bits of a bitmap starting at an arbitrary bit offset.
+  static uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t bit_offset) {
+    const uint8_t* bytes = bitmap + bit_offset / 8;
+    const int64_t bit_shift = bit_offset % 8;
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    if (bit_shift != 0) {
+      word = (word >> bit_shift) | (static_cast<uint64_t>(bytes[8]) << (64 - bit_shift));
+    }
+    return word;
+  }
 
-  inline StateType UnrolledSum(uint8_t bits, const CType* values) const {
-    StateType local;
+  StateType ConsumeDense(const ArrayType& array) const {
+    const auto values = array.raw_values();
+    const int64_t length = array.length();
 
-    if (bits < 0xFF) {
-      // Some nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += MaskedValue(bits & (1U << i), values[i]);
-      }
-      local.count += BitUtil::kBytePopcount[bits];
-    } else {
-      // No nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += values[i];
-      }
-      local.count += 8;
+    BlockSumAccumulator<SumCType> sum;
+    int64_t i = 0;
+    for (; i + kBlockSize <= length; i += kBlockSize) {
+      sum.Add(SumBlock(&values[i]));
+    }
+    SumCType tail_sum = 0;
+    for (; i < length; ++i) {
+      tail_sum += values[i];
     }
+    sum.Add(tail_sum);
 
+    StateType local;
+    local.sum = sum.Finish();
+    local.count = static_cast<size_t>(length);
     return local;
   }
 
   StateType ConsumeSparse(const ArrayType& array) const {
-    StateType local;
-
-    // Sliced bitmaps on non-byte positions induce problem with the branchless
-    // unrolled technique. Thus extra padding is added on both left and right
-    // side of the slice such that both ends are byte-aligned. The first and
-    // last bitmap are properly masked to ignore extra values induced by
-    // padding.
-    //
-    // The execution is divided in 3 sections.
-    //
-    // 1. Compute the sum of the first masked byte.
-    // 2. Compute the sum of the middle bytes
-    // 3. Compute the sum of the last masked byte.
-
-    const int64_t length = array.length();
+    const auto values = array.raw_values();
+    const auto bitmap = array.null_bitmap_data();
     const int64_t offset = array.offset();
+    const int64_t length = array.length();
 
-    // The number of bytes covering the range, this includes partial bytes.
-    // This number bounded by `<= (length / 8) + 2`, e.g. a possible extra byte
-    // on the left, and on the right.
-    const int64_t covering_bytes = BitUtil::CoveringBytes(offset, length);
-    DCHECK_GE(covering_bytes, 3);
-
-    // Align values to the first batch of 8 elements. Note that raw_values() is
-    // already adjusted with the offset, thus we rewind a little to align to
-    // the closest 8-batch offset.
-    const auto values = array.raw_values() - (offset % 8);
-
-    // Align bitmap at the first consumable byte.
-    const auto bitmap = array.null_bitmap_data() + BitUtil::RoundDown(offset, 8) / 8;
-
-    // Consume the first (potentially partial) byte.
-    const uint8_t first_mask = BitUtil::kTrailingBitmask[offset % 8];
-    local += UnrolledSum(bitmap[0] & first_mask, values);
-
-    // Consume the (full) middle bytes. The loop iterates in unit of
-    // batches of 8 values and 1 byte of bitmap.
-    for (int64_t i = 1; i < covering_bytes - 1; i++) {
-      local += UnrolledSum(bitmap[i], &values[i * 8]);
+    BlockSumAccumulator<SumCType> sum;
+    int64_t count = 0;
+    int64_t i = 0;
+    for (; i + kBlockSize <= length; i += kBlockSize) {
+      const uint64_t valid_bits = LoadBitmapWord(bitmap, offset + i);
+      if (valid_bits == ~uint64_t(0)) {
+        sum.Add(SumBlock(&values[i]));
+        count += kBlockSize;
+      } else if (valid_bits != 0) {
+        sum.Add(MaskedSumBlock(valid_bits, &values[i]));
+        count += BitUtil::PopCount(valid_bits);
+      }
     }
 
-    // Consume the last (potentially partial) byte.
-    const int64_t last_idx = covering_bytes - 1;
-    const uint8_t last_mask = BitUtil::kPrecedingWrappingBitmask[(offset + length) % 8];
-    local += UnrolledSum(bitmap[last_idx] & last_mask, &values[last_idx * 8]);
+    // The last partial block is read bit by bit so as not to read past the end
+    // of the bitmap.
+    uint64_t valid_bits = 0;
+    for (int64_t j = 0; i + j < length; ++j) {
+      valid_bits |= static_cast<uint64_t>(BitUtil::GetBit(bitmap, offset + i + j)) << j;
+    }
+    sum.Add(MaskedSumPartialBlock(valid_bits, &values[i], length - i));
+    count += BitUtil::PopCount(valid_bits);
 
+    StateType local;
+    local.sum = sum.Finish();
+    local.count = static_cast<size_t>(count);
     return local;
   }
-};  // namespace compute
+};
 
 }  // namespace compute
 }  // namespace arrow
@@ -15,15 +15,20 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 #include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -41,6 +46,12 @@ class TakeKernelImpl : public TakeKernel {
 
   Status Take(FunctionContext* ctx, const Array& values, const Array& indices_array,
               std::shared_ptr<Array>* out) override {
+    if (values.null_count() == 0 && indices_array.null_count() == 0 &&
+        CanTakeFixedWidth(*values.type())) {
+      const auto& indices = checked_cast<const NumericArray<IndexType>&>(indices_array);
+      return TakeFixedWidth(ctx->memory_pool(), values, indices.raw_values(),
+                            indices.length(), /*check_bounds=*/true, out);
+    }
     RETURN_NOT_OK(taker_->SetContext(ctx));
     RETURN_NOT_OK(taker_->Take(values, ArrayIndexSequence<IndexType>(indices_array)));
     return taker_->Finish(out);
@@ -96,51 +107,193 @@ Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
 
 Status Take(FunctionContext* ctx, const Datum& values, const Datum& indices,
             const TakeOptions& options, Datum* out) {
+  ARROW_TRACE_SPAN("compute::Take");
   std::unique_ptr<TakeKernel> kernel;
   RETURN_NOT_OK(TakeKernel::Make(values.type(), indices.type(), &kernel));
   return kernel->Call(ctx, values, indices, out);
 }
 
-Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
-            const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
+// Take from chunked values at indices of the given integer type.  Each index is
+// resolved to its chunk and rebased to an int64 index into that chunk.  If the
+// indices visit each chunk in at most one run, e.g. sorted indices, each run is
+// taken from its chunk into an output chunk of its own.  Otherwise the indices are
+// grouped by chunk and taken from each chunk, and the concatenated results, as long
+// as the non-null indices rather than the values, are put back in index order by a
+// final Take.
+template <typename IndexType>
+static Status TakeChunked(FunctionContext* ctx, const ChunkedArray& values,
+                          const Array& indices, const TakeOptions& options,
+                          std::shared_ptr<ChunkedArray>* out) {
+  const auto* raw_indices =
+      checked_cast<const NumericArray<IndexType>&>(indices).raw_values();
+  MemoryPool* pool = ctx->memory_pool();
+  const int64_t length = indices.length();
+  const int num_chunks = values.num_chunks();
+
+  // The chunk of each index.  Null indices belong to the run they are in, or are
+  // left at -1 before the first non-null index.
+  std::vector<int> index_chunks(length);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> local_buffer,
+                        AllocateBuffer(length * sizeof(int64_t), pool));
+  auto local = reinterpret_cast<int64_t*>(local_buffer->mutable_data());
+
+  ChunkResolver resolver(values.chunks());
+  int64_t num_runs = 0;
+  int last_chunk = -1;
+  for (int64_t i = 0; i < length; ++i) {
+    if (indices.IsNull(i)) {
+      local[i] = 0;
+      index_chunks[i] = last_chunk;
+      continue;
+    }
+    const auto index = static_cast<int64_t>(raw_indices[i]);
+    if (index < 0 || index >= resolver.length()) {
+      return Status::IndexError("take index out of bounds");
+    }
+    const int chunk = resolver.Resolve(index);
+    local[i] = index - resolver.chunk_offset(chunk);
+    index_chunks[i] = chunk;
+    if (chunk != last_chunk) {
+      ++num_runs;
+      last_chunk = chunk;
+    }
+  }
+
+  std::shared_ptr<Buffer> null_bitmap;
+  if (indices.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(null_bitmap,
+                          internal::CopyBitmap(pool, indices.null_bitmap_data(),
+                                               indices.offset(), length));
+  }
+  Int64Array local_indices(length, local_buffer, null_bitmap, indices.null_count());
 
-  // Case 1: `values` has a single chunk, so just use it
-  if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
+  std::vector<std::shared_ptr<Array>> new_chunks;
+  if (num_runs <= num_chunks) {
+    int64_t run_start = 0;
+    int run_chunk = -1;
+    auto TakeRun = [&](int64_t run_end) {
+      std::shared_ptr<Array> new_chunk;
+      RETURN_NOT_OK(Take(ctx, *values.chunk(std::max(run_chunk, 0)),
+                         *local_indices.Slice(run_start, run_end - run_start), options,
+                         &new_chunk));
+      new_chunks.push_back(std::move(new_chunk));
+      return Status::OK();
+    };
+    for (int64_t i = 0; i < length; ++i) {
+      const int chunk = index_chunks[i];
+      if (chunk == -1 || chunk == run_chunk) continue;
+      if (run_chunk != -1) {
+        RETURN_NOT_OK(TakeRun(i));
+        run_start = i;
+      }
+      run_chunk = chunk;
+    }
+    // Empty or all-null indices yield a single chunk taken from the first one
+    RETURN_NOT_OK(TakeRun(length));
   } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
+    // Group the non-null local indices by chunk with a counting sort, and record
+    // where each index lands among the grouped results
+    std::vector<int64_t> chunk_starts(num_chunks + 1, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      if (indices.IsValid(i)) {
+        ++chunk_starts[index_chunks[i] + 1];
+      }
+    }
+    std::partial_sum(chunk_starts.begin(), chunk_starts.end(), chunk_starts.begin());
+    const int64_t num_valid = chunk_starts.back();
 
-    // Case 4: Else, concatenate chunks and call Array Take
-    RETURN_NOT_OK(Concatenate(values.chunks(), default_memory_pool(), &current_chunk));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> grouped_buffer,
+                          AllocateBuffer(num_valid * sizeof(int64_t), pool));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> positions_buffer,
+                          AllocateBuffer(length * sizeof(int64_t), pool));
+    auto grouped = reinterpret_cast<int64_t*>(grouped_buffer->mutable_data());
+    auto positions = reinterpret_cast<int64_t*>(positions_buffer->mutable_data());
+    std::vector<int64_t> next_positions(chunk_starts.begin(), chunk_starts.end() - 1);
+    for (int64_t i = 0; i < length; ++i) {
+      if (indices.IsNull(i)) {
+        positions[i] = 0;
+        continue;
+      }
+      const int64_t position = next_positions[index_chunks[i]]++;
+      grouped[position] = local[i];
+      positions[i] = position;
+    }
+
+    Int64Array grouped_indices(num_valid, grouped_buffer);
+    std::vector<std::shared_ptr<Array>> pieces;
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+      const int64_t piece_length = chunk_starts[chunk + 1] - chunk_starts[chunk];
+      if (piece_length == 0) continue;
+      std::shared_ptr<Array> piece;
+      RETURN_NOT_OK(Take(ctx, *values.chunk(chunk),
+                         *grouped_indices.Slice(chunk_starts[chunk], piece_length),
+                         options, &piece));
+      pieces.push_back(std::move(piece));
+    }
+    std::shared_ptr<Array> grouped_values;
+    RETURN_NOT_OK(Concatenate(pieces, pool, &grouped_values));
+
+    Int64Array position_indices(length, positions_buffer, null_bitmap,
+                                indices.null_count());
+    new_chunks.emplace_back();
+    RETURN_NOT_OK(
+        Take(ctx, *grouped_values, position_indices, options, &new_chunks.back()));
   }
-  // Call Array Take on our single chunk
-  RETURN_NOT_OK(Take(ctx, *current_chunk, indices, options, &new_chunks[0]));
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  *out = std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
   return Status::OK();
 }
 
+struct TakeChunkedVisitor {
+  template <typename IndexType>
+  enable_if_integer<IndexType, Status> Visit(const IndexType&) {
+    return TakeChunked<IndexType>(ctx, values, indices, options, out);
+  }
+
+  Status Visit(const DataType& other) {
+    return Status::TypeError("index type not supported: ", other);
+  }
+
+  FunctionContext* ctx;
+  const ChunkedArray& values;
+  const Array& indices;
+  const TakeOptions& options;
+  std::shared_ptr<ChunkedArray>* out;
+};
+
+Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
+            const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
+  ARROW_TRACE_SPAN("compute::Take");
+  auto num_chunks = values.num_chunks();
+  if (num_chunks <= 1) {
+    std::shared_ptr<Array> current_chunk;
+    if (num_chunks == 1) {
+      current_chunk = values.chunk(0);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(current_chunk,
+                            MakeArrayOfNull(values.type(), 0, ctx->memory_pool()));
+    }
+    std::vector<std::shared_ptr<Array>> new_chunks(1);
+    RETURN_NOT_OK(Take(ctx, *current_chunk, indices, options, &new_chunks[0]));
+    *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+    return Status::OK();
+  }
+  // Chunks are never concatenated: indices are resolved to the chunks they fall in
+  TakeChunkedVisitor visitor{ctx, values, indices, options, out};
+  return VisitTypeInline(*indices.type(), &visitor);
+}
+
 Status Take(FunctionContext* ctx, const ChunkedArray& values, const ChunkedArray& indices,
             const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = indices.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
+  std::vector<std::shared_ptr<Array>> new_chunks;
   std::shared_ptr<ChunkedArray> current_chunk;
 
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &current_chunk));
-    // Concatenate the result to make a single array for this chunk
-    RETURN_NOT_OK(
-        Concatenate(current_chunk->chunks(), default_memory_pool(), &new_chunks[i]));
+  for (const auto& indices_chunk : indices.chunks()) {
+    // Take with that indices chunk, which yields at least one chunk
+    RETURN_NOT_OK(Take(ctx, values, *indices_chunk, options, &current_chunk));
+    new_chunks.insert(new_chunks.end(), current_chunk->chunks().begin(),
+                      current_chunk->chunks().end());
   }
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  *out = std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
   return Status::OK();
 }
 
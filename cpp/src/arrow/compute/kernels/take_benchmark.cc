@@ -118,9 +118,13 @@ static void TakeString(benchmark::State& state) {
   TakeBenchmark(state, values, indices);
 }
 
+// Null-free values and indices take the fixed-width fast path, compare with
+// null_percent > 0
 BENCHMARK(TakeInt64)
     ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 0})
     ->Args({1 << 20, 1})
+    ->Args({1 << 23, 0})
     ->Args({1 << 23, 1})
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <type_traits>
@@ -30,6 +31,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -183,6 +185,138 @@ class Taker {
   std::shared_ptr<DataType> type_;
 };
 
+// Whether values of a type can be gathered by TakeFixedWidth: values of a whole
+// number of bytes, stored contiguously in the second buffer
+static inline bool CanTakeFixedWidth(const DataType& type) {
+  if (type.id() == Type::NA || type.id() == Type::BOOL) {
+    return false;
+  }
+  return is_primitive(type.id()) || type.id() == Type::FIXED_SIZE_BINARY ||
+         type.id() == Type::DECIMAL;
+}
+
+// Gather values at indices known to be in bounds.  The loop is unrolled, and
+// when the values don't fit in cache, the values of upcoming indices are
+// prefetched, which hides much of the latency of random gathers.
+template <typename ValueCType, typename IndexCType>
+static void GatherFixedWidth(const ValueCType* values, int64_t values_length,
+                             const IndexCType* indices, int64_t length,
+                             ValueCType* out) {
+  constexpr int64_t kPrefetchDistance = 32;
+  constexpr int64_t kPrefetchMinBytes = 1 << 20;
+  int64_t i = 0;
+  if (values_length * static_cast<int64_t>(sizeof(ValueCType)) >= kPrefetchMinBytes) {
+    for (; i + kPrefetchDistance < length; ++i) {
+      ARROW_PREFETCH(values + indices[i + kPrefetchDistance]);
+      out[i] = values[indices[i]];
+    }
+  }
+  for (; i + 4 <= length; i += 4) {
+    out[i] = values[indices[i]];
+    out[i + 1] = values[indices[i + 1]];
+    out[i + 2] = values[indices[i + 2]];
+    out[i + 3] = values[indices[i + 3]];
+  }
+  for (; i < length; ++i) {
+    out[i] = values[indices[i]];
+  }
+}
+
+/// \brief Take fixed-width values, none of them null, at indices none of which
+/// are null
+///
+/// This bypasses the builders and per-element validity checks of the Takers.
+/// \param[in] pool to allocate the output from
+/// \param[in] values array to take from, CanTakeFixedWidth(*values.type()) must hold
+/// \param[in] indices the indices
+/// \param[in] length the number of indices
+/// \param[in] check_bounds whether to check the indices are in bounds, or assume it
+/// \param[out] out the taken values
+template <typename IndexCType>
+Status TakeFixedWidth(MemoryPool* pool, const Array& values, const IndexCType* indices,
+                      int64_t length, bool check_bounds, std::shared_ptr<Array>* out) {
+  DCHECK(CanTakeFixedWidth(*values.type()));
+  DCHECK_EQ(values.null_count(), 0);
+  if (check_bounds) {
+    // Negative indices wrap around to large unsigned values
+    uint64_t max_index = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      max_index = std::max(max_index,
+                           static_cast<uint64_t>(static_cast<int64_t>(indices[i])));
+    }
+    if (length > 0 && max_index >= static_cast<uint64_t>(values.length())) {
+      return Status::IndexError("take index out of bounds");
+    }
+  }
+
+  const int64_t byte_width =
+      checked_cast<const FixedWidthType&>(*values.type()).bit_width() / 8;
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out_values,
+                        AllocateBuffer(length * byte_width, pool));
+  const auto& in_values = values.data()->buffers[1];
+  // Empty arrays may have no values buffer, but then there are no indices either
+  const uint8_t* in = in_values == nullptr
+                          ? nullptr
+                          : in_values->data() + values.offset() * byte_width;
+  uint8_t* dest = out_values->mutable_data();
+
+#define GATHER_CASE(WIDTH, CTYPE)                                                   \
+  case WIDTH:                                                                       \
+    GatherFixedWidth(reinterpret_cast<const CTYPE*>(in), values.length(), indices, \
+                     length, reinterpret_cast<CTYPE*>(dest));                      \
+    break;
+
+  switch (byte_width) {
+    GATHER_CASE(1, uint8_t)
+    GATHER_CASE(2, uint16_t)
+    GATHER_CASE(4, uint32_t)
+    GATHER_CASE(8, uint64_t)
+    default:
+      for (int64_t i = 0; i < length; ++i) {
+        std::memcpy(dest + i * byte_width, in + indices[i] * byte_width, byte_width);
+      }
+      break;
+  }
+
+#undef GATHER_CASE
+
+  *out = MakeArray(
+      ArrayData::Make(values.type(), length, {nullptr, std::move(out_values)}, 0));
+  return Status::OK();
+}
+
+// Resolves logical indices into the chunks of a ChunkedArray by binary search
+// over the chunk offsets.  The last chunk found is checked first, so that runs of
+// indices into the same chunk, e.g. sorted indices, resolve in constant time.
+class ChunkResolver {
+ public:
+  explicit ChunkResolver(const ArrayVector& chunks) : offsets_(chunks.size() + 1, 0) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      offsets_[i + 1] = offsets_[i] + chunks[i]->length();
+    }
+  }
+
+  int64_t length() const { return offsets_.back(); }
+
+  int64_t chunk_offset(int chunk) const { return offsets_[chunk]; }
+
+  // Return the chunk containing an index, which must be in [0, length())
+  int Resolve(int64_t index) {
+    DCHECK_GE(index, 0);
+    DCHECK_LT(index, length());
+    if (index < offsets_[cached_chunk_] || index >= offsets_[cached_chunk_ + 1]) {
+      // The last chunk whose offset is <= index, which skips empty chunks
+      auto it = std::upper_bound(offsets_.begin(), offsets_.end(), index);
+      cached_chunk_ = static_cast<int>(it - offsets_.begin()) - 1;
+    }
+    return cached_chunk_;
+  }
+
+ private:
+  std::vector<int64_t> offsets_;
+  int cached_chunk_ = 0;
+};
+
 // an IndexSequence which yields indices from a specified range
 // or yields null for the length of that range
 class RangeIndexSequence {
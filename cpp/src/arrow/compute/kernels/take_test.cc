@@ -21,6 +21,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
@@ -182,6 +183,42 @@ TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomNumericNoNulls) {
+  // Null-free values and indices are gathered directly, prefetching the values
+  // once they are large
+  using CType = typename TypeParam::c_type;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = (1 << 20) / static_cast<int64_t>(sizeof(CType)) + 3;
+  auto values = rand.Numeric<TypeParam>(length, 0, 127, /*null_probability=*/0.0);
+  for (int64_t offset : {0, 3}) {
+    auto sliced = values->Slice(offset);
+    auto max_index = static_cast<int32_t>(sliced->length() - 1);
+    this->ValidateTake(sliced, rand.Int32(1000, 0, max_index, /*null_probability=*/0.0));
+  }
+}
+
+TEST(TestTakeKernelWithFixedSizeBinary, TakeNoNulls) {
+  FunctionContext ctx;
+  FixedSizeBinaryBuilder builder(fixed_size_binary(3));
+  for (const char* value : {"aaa", "bbb", "ccc", "ddd"}) {
+    ASSERT_OK(builder.Append(value));
+  }
+  std::shared_ptr<Array> values, expected, actual;
+  ASSERT_OK(builder.Finish(&values));
+  ASSERT_OK(builder.Append("ddd"));
+  ASSERT_OK(builder.Append("bbb"));
+  ASSERT_OK(builder.Append("ddd"));
+  ASSERT_OK(builder.Finish(&expected));
+
+  ASSERT_OK(Take(&ctx, *values->Slice(1), *ArrayFromJSON(int8(), "[2, 0, 2]"),
+                 TakeOptions(), &actual));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*expected, *actual);
+
+  ASSERT_RAISES(IndexError, Take(&ctx, *values->Slice(1),
+                                 *ArrayFromJSON(int8(), "[3]"), TakeOptions(), &actual));
+}
+
 using StringTypes =
     ::testing::Types<BinaryType, StringType, LargeBinaryType, LargeStringType>;
 
@@ -640,6 +677,60 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArrayRuns) {
+  // Indices visiting each chunk in a single run yield one output chunk per run
+  this->AssertTake(int8(), {"[7]", "[8, 9]", "[10]"}, "[0, 1, 2, null, 3]",
+                   {"[7]", "[8, 9, null]", "[10]"});
+  this->AssertTake(int8(), {"[7]", "[8, 9]"}, "[null, 2, 1]", {"[null, 9, 8]"});
+  this->AssertTake(int8(), {"[]", "[7]", "[]", "[8, 9]"}, "[2, 0]", {"[9]", "[7]"});
+  this->AssertTake(int8(), {"[7]", "[8, 9]"}, "[null, null]", {"[null, null]"});
+  this->AssertTake(int8(), {"[7]", "[8, 9]"}, "[]", {"[]"});
+  this->AssertTake(int8(), {}, "[null]", {"[null]"});
+
+  // Otherwise the output is a single chunk
+  this->AssertTake(int8(), {"[7]", "[8, 9]"}, "[2, null, 0, 1, 0]",
+                   {"[9, null, 7, 8, 7]"});
+  this->AssertChunkedTake(int8(), {"[7]", "[8, 9]"}, {"[0, 2]", "[1, 0, 2, 0]"},
+                          {"[7]", "[9]", "[8, 7, 9, 7]"});
+
+  std::shared_ptr<ChunkedArray> arr;
+  ASSERT_RAISES(IndexError, this->TakeWithArray(int8(), {}, "[0]", &arr));
+  ASSERT_RAISES(IndexError,
+                this->TakeWithArray(int8(), {"[7]", "[8, 9]"}, "[1, -1]", &arr));
+}
+
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArrayRandom) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t chunk_length = 100;
+  ArrayVector chunks;
+  for (int i = 0; i < 10; ++i) {
+    chunks.push_back(rand.Int32(chunk_length, 0, 1000, 0.1));
+  }
+  ChunkedArray values(chunks);
+  std::shared_ptr<Array> concatenated;
+  ASSERT_OK(Concatenate(chunks, default_memory_pool(), &concatenated));
+
+  const int32_t max_index = static_cast<int32_t>(values.length() - 1);
+  for (auto null_probability : {0.0, 0.1}) {
+    auto indices = rand.Int32(500, 0, max_index, null_probability);
+    std::shared_ptr<Array> sorted_indices;
+    ArrayFromVector<Int32Type, int32_t>({0, 1, 99, 100, 550, 551, 998, 999},
+                                        &sorted_indices);
+    for (const auto& index_array : {indices, sorted_indices}) {
+      std::shared_ptr<ChunkedArray> actual;
+      ASSERT_OK(arrow::compute::Take(&this->ctx_, values, *index_array, TakeOptions(),
+                                     &actual));
+      ASSERT_OK(actual->ValidateFull());
+      ASSERT_LE(actual->num_chunks(), values.num_chunks());
+
+      std::shared_ptr<Array> expected;
+      ASSERT_OK(arrow::compute::Take(&this->ctx_, *concatenated, *index_array,
+                                     TakeOptions(), &expected));
+      ASSERT_TRUE(actual->Equals(ChunkedArray({expected})));
+    }
+  }
+}
+
 class TestTakeKernelWithTable : public TestTakeKernel<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
@@ -690,8 +781,10 @@ TEST_F(TestTakeKernelWithTable, TakeTable) {
       "[{\"a\": 2, \"b\": \"hello\"},{\"a\": 4, \"b\": \"eh\"}]"};
 
   this->AssertTake(schm, table_json, "[]", {"[]"});
+  // One output chunk per run of indices into the same chunk
   std::vector<std::string> expected_310 = {
-      "[{\"a\": 4, \"b\": \"eh\"},{\"a\": 1, \"b\": \"\"},{\"a\": null, \"b\": \"yo\"}]"};
+      "[{\"a\": 4, \"b\": \"eh\"}]",
+      "[{\"a\": 1, \"b\": \"\"},{\"a\": null, \"b\": \"yo\"}]"};
   this->AssertTake(schm, table_json, "[3, 1, 0]", expected_310);
   this->AssertChunkedTake(schm, table_json, {"[0, 1]", "[2, 3]"}, table_json);
 }
@@ -0,0 +1,556 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/temporal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/macros.h"
+#include "arrow/vendored/datetime.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+constexpr int64_t kSecondsPerDay = 86400;
+
+// Division rounding towards negative infinity, for values before the epoch.
+// The divisor must be positive.
+inline int64_t FloorDiv(int64_t value, int64_t divisor) {
+  const int64_t quotient = value / divisor;
+  return quotient - (value - quotient * divisor < 0);
+}
+
+// The civil date of a number of days since 1970-01-01, after Howard Hinnant's
+// days_from_civil algorithms (http://howardhinnant.github.io/date_algorithms.html),
+// without branches so that loops over arrays of values are vectorized
+struct CivilDate {
+  int64_t year;
+  int64_t month;
+  int64_t day;
+};
+
+inline CivilDate CivilFromDays(int64_t days) {
+  // Days since 0000-03-01, in eras of 400 years
+  const int64_t shifted = days + 719468;
+  const int64_t era = FloorDiv(shifted, 146097);
+  const int64_t day_of_era = shifted - era * 146097;
+  const int64_t year_of_era =
+      (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const int64_t day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  // Months from March, so that leap days are at the end of the year
+  const int64_t shifted_month = (5 * day_of_year + 2) / 153;
+  const int64_t after_february = shifted_month >= 10;
+  return {year_of_era + era * 400 + after_february,
+          shifted_month + 3 - 12 * after_february,
+          day_of_year - (153 * shifted_month + 2) / 5 + 1};
+}
+
+inline int64_t DaysFromCivil(int64_t year, int64_t month, int64_t day) {
+  const int64_t before_march = month <= 2;
+  year -= before_march;
+  const int64_t era = FloorDiv(year, 400);
+  const int64_t year_of_era = year - era * 400;
+  const int64_t shifted_month = month - 3 + 12 * before_march;
+  const int64_t day_of_year = (153 * shifted_month + 2) / 5 + day - 1;
+  const int64_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+// ----------------------------------------------------------------------
+// UTC offsets of time zones
+
+// The UTC offsets of a time zone, as a table of the intervals during which
+// each of them applies
+class ZoneOffsets {
+ public:
+  struct Interval {
+    // In seconds since the epoch, UTC
+    int64_t begin;
+    int64_t end;
+    int64_t offset;
+  };
+
+  // Look up the offsets of a time zone, building their table on first use
+  static Status Get(const std::string& timezone,
+                    std::shared_ptr<const ZoneOffsets>* out) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const ZoneOffsets>> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(timezone);
+    if (it == cache.end()) {
+      std::shared_ptr<ZoneOffsets> offsets(new ZoneOffsets());
+      RETURN_NOT_OK(offsets->Init(timezone));
+      it = cache.emplace(timezone, std::move(offsets)).first;
+    }
+    *out = it->second;
+    return Status::OK();
+  }
+
+  // The interval containing a point in time
+  Interval Find(int64_t seconds) const {
+    if (ARROW_PREDICT_TRUE(seconds >= starts_.front() && seconds < end_)) {
+      const auto i = std::upper_bound(starts_.begin(), starts_.end(), seconds) - 1 -
+                     starts_.begin();
+      const int64_t end = i + 1 < static_cast<int64_t>(starts_.size()) ? starts_[i + 1]
+                                                                        : end_;
+      return {starts_[i], end, offsets_[i]};
+    }
+    // Outside of the table, which is only possible for named zones.  The
+    // range supported by the tz library is about 32767 years around the epoch.
+    constexpr int64_t kLimit = 1000000000000LL;
+    seconds = std::max(-kLimit, std::min(kLimit, seconds));
+    const auto info = zone_->get_info(
+        arrow_vendored::date::sys_seconds(std::chrono::seconds(seconds)));
+    return {info.begin.time_since_epoch().count(), info.end.time_since_epoch().count(),
+            info.offset.count()};
+  }
+
+ private:
+  ZoneOffsets() = default;
+
+  Status Init(const std::string& timezone) {
+    if (!timezone.empty() && (timezone[0] == '+' || timezone[0] == '-')) {
+      return InitFixed(timezone);
+    }
+    try {
+      zone_ = arrow_vendored::date::locate_zone(timezone);
+    } catch (const std::exception& e) {
+      return Status::Invalid("Cannot locate time zone '", timezone, "': ", e.what());
+    }
+
+    // The transitions of the years 1900 to 2100 are tabulated, merging the
+    // intervals which only differ in abbreviation or daylight saving status
+    constexpr int64_t kTableBegin = -2208988800LL;
+    constexpr int64_t kTableEnd = 4102444800LL;
+    using arrow_vendored::date::sys_seconds;
+    auto info = zone_->get_info(sys_seconds(std::chrono::seconds(kTableBegin)));
+    starts_.push_back(kTableBegin);
+    offsets_.push_back(info.offset.count());
+    while (info.end.time_since_epoch().count() < kTableEnd) {
+      const int64_t start = info.end.time_since_epoch().count();
+      info = zone_->get_info(info.end);
+      if (info.offset.count() != offsets_.back()) {
+        starts_.push_back(start);
+        offsets_.push_back(info.offset.count());
+      }
+    }
+    end_ = kTableEnd;
+    return Status::OK();
+  }
+
+  // A fixed offset of the form "+HH:MM" or "-HH:MM"
+  Status InitFixed(const std::string& timezone) {
+    auto digit = [&](size_t i) { return timezone[i] - '0'; };
+    auto is_digit = [&](size_t i) { return timezone[i] >= '0' && timezone[i] <= '9'; };
+    if (timezone.size() != 6 || !is_digit(1) || !is_digit(2) || timezone[3] != ':' ||
+        !is_digit(4) || !is_digit(5)) {
+      return Status::Invalid("Cannot parse time zone offset '", timezone,
+                             "', expected +HH:MM or -HH:MM");
+    }
+    const int64_t hours = digit(1) * 10 + digit(2);
+    const int64_t minutes = digit(4) * 10 + digit(5);
+    if (hours > 23 || minutes > 59) {
+      return Status::Invalid("Time zone offset '", timezone, "' is out of range");
+    }
+    const int64_t offset = (hours * 3600 + minutes * 60) * (timezone[0] == '-' ? -1 : 1);
+    starts_.push_back(std::numeric_limits<int64_t>::min());
+    offsets_.push_back(offset);
+    end_ = std::numeric_limits<int64_t>::max();
+    return Status::OK();
+  }
+
+  // starts_[i] is the start of the interval during which offsets_[i] applies,
+  // which lasts until starts_[i + 1], or end_ for the last one
+  std::vector<int64_t> starts_;
+  std::vector<int64_t> offsets_;
+  int64_t end_ = 0;
+  const arrow_vendored::date::time_zone* zone_ = NULLPTR;
+};
+
+// Remembers the interval of the last value looked up, as consecutive values
+// are usually close in time
+template <int64_t kUnitsPerSecond>
+class OffsetCursor {
+ public:
+  explicit OffsetCursor(const ZoneOffsets& zone) : zone_(zone) {}
+
+  // The UTC offset at a point in time, both in units
+  int64_t Offset(int64_t value) {
+    if (ARROW_PREDICT_FALSE(value < begin_ || value >= end_)) {
+      const auto interval = zone_.Find(FloorDiv(value, kUnitsPerSecond));
+      begin_ = ToUnits(interval.begin);
+      end_ = ToUnits(interval.end);
+      offset_ = interval.offset * kUnitsPerSecond;
+    }
+    return offset_;
+  }
+
+ private:
+  static int64_t ToUnits(int64_t seconds) {
+    constexpr int64_t kMax = std::numeric_limits<int64_t>::max();
+    constexpr int64_t kMin = std::numeric_limits<int64_t>::min();
+    if (seconds >= kMax / kUnitsPerSecond) return kMax;
+    if (seconds <= kMin / kUnitsPerSecond) return kMin;
+    return seconds * kUnitsPerSecond;
+  }
+
+  const ZoneOffsets& zone_;
+  int64_t begin_ = 0;
+  int64_t end_ = 0;
+  int64_t offset_ = 0;
+};
+
+// ----------------------------------------------------------------------
+// Components
+
+// Extract(days, second_of_day) computes a component from the days since the
+// epoch and the seconds since the start of the day.  Truncate(value) rounds a
+// value in units down to the start of the component.
+
+struct YearOp {
+  static int64_t Extract(int64_t days, int64_t) { return CivilFromDays(days).year; }
+
+  template <int64_t kUnitsPerDay, int64_t kUnitsPerSecond>
+  static int64_t Truncate(int64_t value) {
+    const int64_t year = CivilFromDays(FloorDiv(value, kUnitsPerDay)).year;
+    return DaysFromCivil(year, 1, 1) * kUnitsPerDay;
+  }
+};
+
+struct MonthOp {
+  static int64_t Extract(int64_t days, int64_t) { return CivilFromDays(days).month; }
+
+  template <int64_t kUnitsPerDay, int64_t kUnitsPerSecond>
+  static int64_t Truncate(int64_t value) {
+    const int64_t days = FloorDiv(value, kUnitsPerDay);
+    return (days - CivilFromDays(days).day + 1) * kUnitsPerDay;
+  }
+};
+
+struct DayOp {
+  static int64_t Extract(int64_t days, int64_t) { return CivilFromDays(days).day; }
+
+  template <int64_t kUnitsPerDay, int64_t kUnitsPerSecond>
+  static int64_t Truncate(int64_t value) {
+    return FloorDiv(value, kUnitsPerDay) * kUnitsPerDay;
+  }
+};
+
+struct DayOfWeekOp {
+  // 1970-01-01 was a Thursday
+  static int64_t Extract(int64_t days, int64_t) {
+    const int64_t shifted = days + 3;
+    return shifted - FloorDiv(shifted, 7) * 7;
+  }
+};
+
+struct DayOfYearOp {
+  static int64_t Extract(int64_t days, int64_t) {
+    return days - DaysFromCivil(CivilFromDays(days).year, 1, 1) + 1;
+  }
+};
+
+template <int64_t kSeconds, int64_t kModulo>
+struct ClockOp {
+  static int64_t Extract(int64_t, int64_t second_of_day) {
+    return second_of_day / kSeconds % kModulo;
+  }
+
+  template <int64_t kUnitsPerDay, int64_t kUnitsPerSecond>
+  static int64_t Truncate(int64_t value) {
+    return FloorDiv(value, kSeconds * kUnitsPerSecond) * kSeconds * kUnitsPerSecond;
+  }
+};
+
+using HourOp = ClockOp<3600, 24>;
+using MinuteOp = ClockOp<60, 60>;
+using SecondOp = ClockOp<1, 60>;
+
+// ----------------------------------------------------------------------
+// Kernels
+
+// The kernels are instantiated for the units of the input type.  Dates in days
+// are taken as values in units of both days and seconds, which are always at
+// the start of a day.
+template <typename ArrowType, int64_t kUnitsPerDay, int64_t kUnitsPerSecond, typename Op>
+class ExtractTemporalKernel final : public UnaryKernel {
+ public:
+  using c_type = typename ArrowType::c_type;
+
+  ExtractTemporalKernel(std::shared_ptr<DataType> /*type*/,
+                        std::shared_ptr<const ZoneOffsets> zone)
+      : zone_(std::move(zone)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& in = *input.array();
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in, out));
+
+    const c_type* values = in.GetValues<c_type>(1);
+    int64_t* out_values = out->GetMutableValues<int64_t>(1);
+    if (zone_ == NULLPTR) {
+      for (int64_t i = 0; i < in.length; ++i) {
+        out_values[i] = Extract(values[i]);
+      }
+    } else {
+      OffsetCursor<kUnitsPerSecond> cursor(*zone_);
+      for (int64_t i = 0; i < in.length; ++i) {
+        out_values[i] = Extract(values[i] + cursor.Offset(values[i]));
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  static int64_t Extract(int64_t value) {
+    const int64_t days = FloorDiv(value, kUnitsPerDay);
+    return Op::Extract(days, (value - days * kUnitsPerDay) / kUnitsPerSecond);
+  }
+
+  std::shared_ptr<const ZoneOffsets> zone_;
+};
+
+template <typename ArrowType, int64_t kUnitsPerDay, int64_t kUnitsPerSecond, typename Op>
+class TruncateTemporalKernel final : public UnaryKernel {
+ public:
+  using c_type = typename ArrowType::c_type;
+
+  TruncateTemporalKernel(std::shared_ptr<DataType> type,
+                         std::shared_ptr<const ZoneOffsets> zone)
+      : type_(std::move(type)), zone_(std::move(zone)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& in = *input.array();
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in, out));
+
+    const c_type* values = in.GetValues<c_type>(1);
+    c_type* out_values = out->GetMutableValues<c_type>(1);
+    if (zone_ == NULLPTR) {
+      for (int64_t i = 0; i < in.length; ++i) {
+        out_values[i] = static_cast<c_type>(Truncate(values[i]));
+      }
+      return Status::OK();
+    }
+
+    OffsetCursor<kUnitsPerSecond> cursor(*zone_);
+    for (int64_t i = 0; i < in.length; ++i) {
+      const int64_t offset = cursor.Offset(values[i]);
+      const int64_t local = Truncate(values[i] + offset);
+      // The offset at the truncated time differs if a transition lies in
+      // between, in which case the offset before the transition applies
+      int64_t truncated = local - offset;
+      const int64_t truncated_offset = cursor.Offset(truncated);
+      if (ARROW_PREDICT_FALSE(truncated_offset != offset)) {
+        truncated = local - truncated_offset;
+      }
+      out_values[i] = static_cast<c_type>(truncated);
+    }
+    return Status::OK();
+  }
+
+ private:
+  static int64_t Truncate(int64_t value) {
+    return Op::template Truncate<kUnitsPerDay, kUnitsPerSecond>(value);
+  }
+
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<const ZoneOffsets> zone_;
+};
+
+template <template <typename, int64_t, int64_t, typename> class Kernel, typename Op>
+Status MakeTemporalKernel(const std::shared_ptr<DataType>& type,
+                          std::shared_ptr<const ZoneOffsets> zone,
+                          std::unique_ptr<UnaryKernel>* out) {
+  switch (type->id()) {
+    case Type::DATE32:
+      out->reset(new Kernel<Date32Type, 1, 1, Op>(type, std::move(zone)));
+      break;
+    case Type::DATE64:
+      out->reset(new Kernel<Date64Type, kSecondsPerDay * 1000, 1000, Op>(
+          type, std::move(zone)));
+      break;
+    case Type::TIMESTAMP:
+      switch (checked_cast<const TimestampType&>(*type).unit()) {
+        case TimeUnit::SECOND:
+          out->reset(
+              new Kernel<TimestampType, kSecondsPerDay, 1, Op>(type, std::move(zone)));
+          break;
+        case TimeUnit::MILLI:
+          out->reset(new Kernel<TimestampType, kSecondsPerDay * 1000, 1000, Op>(
+              type, std::move(zone)));
+          break;
+        case TimeUnit::MICRO:
+          out->reset(new Kernel<TimestampType, kSecondsPerDay * 1000000, 1000000, Op>(
+              type, std::move(zone)));
+          break;
+        case TimeUnit::NANO:
+          out->reset(
+              new Kernel<TimestampType, kSecondsPerDay * 1000000000, 1000000000, Op>(
+                  type, std::move(zone)));
+          break;
+      }
+      break;
+    default:
+      return Status::NotImplemented("Temporal kernels not implemented for type ", *type);
+  }
+  return Status::OK();
+}
+
+// Check the type of the values, and look up the offsets of their time zone if
+// they have one
+Status GetZone(const char* name, const Datum& values,
+               std::shared_ptr<const ZoneOffsets>* out) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid(name, " expects array-like values");
+  }
+  const DataType& type = *values.type();
+  if (type.id() == Type::TIMESTAMP) {
+    const std::string& timezone = checked_cast<const TimestampType&>(type).timezone();
+    if (!timezone.empty()) {
+      return ZoneOffsets::Get(timezone, out);
+    }
+  } else if (type.id() != Type::DATE32 && type.id() != Type::DATE64) {
+    return Status::NotImplemented(name, " not implemented for type ", type);
+  }
+  return Status::OK();
+}
+
+Status InvokeTemporalKernel(FunctionContext* ctx, UnaryKernel* kernel,
+                            const Datum& values, Datum* out) {
+  detail::PrimitiveAllocatingUnaryKernel allocating(kernel);
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &allocating, values, &outputs));
+  *out = detail::WrapDatumsLike(values, kernel->out_type(), outputs);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status ExtractTemporal(FunctionContext* ctx, TemporalComponent component,
+                       const Datum& values, Datum* out) {
+  std::shared_ptr<const ZoneOffsets> zone;
+  RETURN_NOT_OK(GetZone("ExtractTemporal", values, &zone));
+
+  const auto& type = values.type();
+  std::unique_ptr<UnaryKernel> kernel;
+  Status status;
+  switch (component) {
+    case YEAR:
+      status = MakeTemporalKernel<ExtractTemporalKernel, YearOp>(type, zone, &kernel);
+      break;
+    case MONTH:
+      status = MakeTemporalKernel<ExtractTemporalKernel, MonthOp>(type, zone, &kernel);
+      break;
+    case DAY:
+      status = MakeTemporalKernel<ExtractTemporalKernel, DayOp>(type, zone, &kernel);
+      break;
+    case DAY_OF_WEEK:
+      status =
+          MakeTemporalKernel<ExtractTemporalKernel, DayOfWeekOp>(type, zone, &kernel);
+      break;
+    case DAY_OF_YEAR:
+      status =
+          MakeTemporalKernel<ExtractTemporalKernel, DayOfYearOp>(type, zone, &kernel);
+      break;
+    case HOUR:
+      status = MakeTemporalKernel<ExtractTemporalKernel, HourOp>(type, zone, &kernel);
+      break;
+    case MINUTE:
+      status = MakeTemporalKernel<ExtractTemporalKernel, MinuteOp>(type, zone, &kernel);
+      break;
+    case SECOND:
+      status = MakeTemporalKernel<ExtractTemporalKernel, SecondOp>(type, zone, &kernel);
+      break;
+    default:
+      return Status::Invalid("Unknown temporal component ", static_cast<int>(component));
+  }
+  RETURN_NOT_OK(status);
+  return InvokeTemporalKernel(ctx, kernel.get(), values, out);
+}
+
+Status TruncateTemporal(FunctionContext* ctx, TemporalComponent component,
+                        const Datum& values, Datum* out) {
+  std::shared_ptr<const ZoneOffsets> zone;
+  RETURN_NOT_OK(GetZone("TruncateTemporal", values, &zone));
+
+  const auto& type = values.type();
+  if (type->id() != Type::TIMESTAMP &&
+      (component == HOUR || component == MINUTE || component == SECOND)) {
+    return Status::Invalid("Cannot truncate values of type ", *type,
+                           " to units finer than a day");
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  Status status;
+  switch (component) {
+    case YEAR:
+      status = MakeTemporalKernel<TruncateTemporalKernel, YearOp>(type, zone, &kernel);
+      break;
+    case MONTH:
+      status = MakeTemporalKernel<TruncateTemporalKernel, MonthOp>(type, zone, &kernel);
+      break;
+    case DAY:
+      status = MakeTemporalKernel<TruncateTemporalKernel, DayOp>(type, zone, &kernel);
+      break;
+    case HOUR:
+      status = MakeTemporalKernel<TruncateTemporalKernel, HourOp>(type, zone, &kernel);
+      break;
+    case MINUTE:
+      status = MakeTemporalKernel<TruncateTemporalKernel, MinuteOp>(type, zone, &kernel);
+      break;
+    case SECOND:
+      status = MakeTemporalKernel<TruncateTemporalKernel, SecondOp>(type, zone, &kernel);
+      break;
+    default:
+      return Status::Invalid("Cannot truncate to temporal component ",
+                             static_cast<int>(component));
+  }
+  RETURN_NOT_OK(status);
+  return InvokeTemporalKernel(ctx, kernel.get(), values, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+enum TemporalComponent {
+  /// the proleptic Gregorian year, e.g. 2020
+  YEAR,
+  /// the month, from 1 (January) to 12
+  MONTH,
+  /// the day of the month, from 1
+  DAY,
+  /// the day of the week, from 0 (Monday) to 6 (Sunday)
+  DAY_OF_WEEK,
+  /// the day of the year, from 1 (January 1st) to 366
+  DAY_OF_YEAR,
+  /// the hour of the day, from 0 to 23
+  HOUR,
+  /// the minute of the hour, from 0 to 59
+  MINUTE,
+  /// the second of the minute, from 0 to 59
+  SECOND,
+};
+
+/// \brief Extract a calendar or clock component from each date or timestamp
+///
+/// Timestamps with a time zone are converted to the local time of that zone,
+/// which may be a name of the tz database, e.g. "Europe/Paris", or a fixed
+/// offset, e.g. "+05:30".  The UTC offsets of a zone are looked up in a table
+/// of its transitions, built once and cached for the lifetime of the process.
+/// Timestamps without a time zone are taken as they are.
+///
+/// For example given timestamps ["2020-02-29 23:30:00", null] and HOUR, the
+/// output will be [23, null]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] component the component to extract
+/// \param[in] values Array or ChunkedArray of timestamp, date32 or date64 type.
+///            Components finer than DAY are 0 for dates.
+/// \param[out] out resulting datum of int64 type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ExtractTemporal(FunctionContext* ctx, TemporalComponent component,
+                       const Datum& values, Datum* out);
+
+/// \brief Round each date or timestamp down to the start of its year, month,
+/// day, hour, minute or second
+///
+/// Timestamps with a time zone are truncated in the local time of that zone,
+/// as in ExtractTemporal, and converted back to UTC.  A local start that is
+/// skipped by a daylight saving time transition is mapped with the UTC offset
+/// in effect before the transition.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] component the unit to truncate to.  DAY_OF_WEEK and DAY_OF_YEAR
+///            aren't supported, nor units finer than DAY for dates.
+/// \param[in] values Array or ChunkedArray of timestamp, date32 or date64 type
+/// \param[out] out resulting datum of the same type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TruncateTemporal(FunctionContext* ctx, TemporalComponent component,
+                        const Datum& values, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
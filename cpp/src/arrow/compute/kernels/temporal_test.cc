@@ -0,0 +1,333 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/temporal.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/vendored/datetime.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+namespace date = arrow_vendored::date;
+
+static const std::vector<TemporalComponent> kComponents = {
+    YEAR, MONTH, DAY, DAY_OF_WEEK, DAY_OF_YEAR, HOUR, MINUTE, SECOND};
+
+static const std::vector<TemporalComponent> kTruncateComponents = {YEAR,   MONTH,
+                                                                   DAY,    HOUR,
+                                                                   MINUTE, SECOND};
+
+// Components and truncations of a point in time in seconds, computed value by
+// value with the date library
+class Reference {
+ public:
+  explicit Reference(const date::time_zone* zone) : zone_(zone) {}
+
+  int64_t Extract(TemporalComponent component, int64_t seconds) const {
+    const auto local = ToLocal(seconds);
+    const auto day = date::floor<date::days>(local);
+    const date::year_month_day ymd(day);
+    const auto time = date::make_time(local - day);
+    switch (component) {
+      case YEAR:
+        return static_cast<int>(ymd.year());
+      case MONTH:
+        return static_cast<unsigned>(ymd.month());
+      case DAY:
+        return static_cast<unsigned>(ymd.day());
+      case DAY_OF_WEEK:
+        return date::weekday(day).iso_encoding() - 1;
+      case DAY_OF_YEAR:
+        return (day - date::local_days(ymd.year() / 1 / 1)).count() + 1;
+      case HOUR:
+        return time.hours().count();
+      case MINUTE:
+        return time.minutes().count();
+      case SECOND:
+        return time.seconds().count();
+    }
+    return -1;
+  }
+
+  int64_t Truncate(TemporalComponent component, int64_t seconds) const {
+    const auto local = ToLocal(seconds);
+    const auto day = date::floor<date::days>(local);
+    const date::year_month_day ymd(day);
+    date::local_seconds truncated;
+    switch (component) {
+      case YEAR:
+        truncated = date::local_days(ymd.year() / 1 / 1);
+        break;
+      case MONTH:
+        truncated = date::local_days(ymd.year() / ymd.month() / 1);
+        break;
+      case DAY:
+        truncated = day;
+        break;
+      case HOUR:
+        truncated = date::floor<std::chrono::hours>(local);
+        break;
+      case MINUTE:
+        truncated = date::floor<std::chrono::minutes>(local);
+        break;
+      default:
+        truncated = local;
+        break;
+    }
+    if (zone_ == nullptr) {
+      return truncated.time_since_epoch().count();
+    }
+    // The offset of the original time if it applies at the truncated one
+    const auto offset = zone_->get_info(ToSys(seconds)).offset;
+    const auto info = zone_->get_info(truncated);
+    auto truncated_offset = info.first.offset;
+    if (info.result == date::local_info::ambiguous && info.second.offset == offset) {
+      truncated_offset = offset;
+    }
+    return (truncated.time_since_epoch() - truncated_offset).count();
+  }
+
+ private:
+  static date::sys_seconds ToSys(int64_t seconds) {
+    return date::sys_seconds(std::chrono::seconds(seconds));
+  }
+
+  date::local_seconds ToLocal(int64_t seconds) const {
+    if (zone_ == nullptr) {
+      return date::local_seconds(std::chrono::seconds(seconds));
+    }
+    return zone_->to_local(ToSys(seconds));
+  }
+
+  const date::time_zone* zone_;
+};
+
+class TestTemporalKernels : public ComputeFixture, public TestBase {
+ protected:
+  void AssertOutput(const Datum& actual, const std::shared_ptr<Array>& expected) {
+    ASSERT_TRUE(actual.is_array());
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysEqual(*expected, *actual.make_array());
+  }
+
+  void AssertExtract(const std::shared_ptr<Array>& values, TemporalComponent component,
+                     const std::string& expected) {
+    Datum actual;
+    ASSERT_OK(ExtractTemporal(&ctx_, component, values, &actual));
+    AssertOutput(actual, ArrayFromJSON(int64(), expected));
+  }
+
+  void AssertTruncate(const std::shared_ptr<Array>& values, TemporalComponent component,
+                      const std::string& expected) {
+    Datum actual;
+    ASSERT_OK(TruncateTemporal(&ctx_, component, values, &actual));
+    AssertOutput(actual, ArrayFromJSON(values->type(), expected));
+  }
+
+  // Compare the kernels to the reference on random timestamps of each unit
+  void CheckRandom(const std::string& timezone) {
+    const date::time_zone* zone =
+        timezone.empty() ? nullptr : date::locate_zone(timezone);
+    const Reference reference(zone);
+    std::default_random_engine engine(42);
+
+    for (auto unit : {TimeUnit::SECOND, TimeUnit::MILLI, TimeUnit::MICRO,
+                      TimeUnit::NANO}) {
+      SCOPED_TRACE(::testing::Message()
+                   << "unit = " << unit << ", timezone = " << timezone);
+      int64_t units_per_second = 1;
+      for (int i = 0; i < static_cast<int>(unit); ++i) {
+        units_per_second *= 1000;
+      }
+      // From 1494 to 2445, which is beyond the transitions tabulated for
+      // zones, or from 1843 to 2096 for nanoseconds
+      const int64_t max_seconds = unit == TimeUnit::NANO ? 4000000000LL : 15000000000LL;
+      std::uniform_int_distribution<int64_t> seconds_dist(-max_seconds, max_seconds);
+      std::uniform_int_distribution<int64_t> units_dist(0, units_per_second - 1);
+      // Runs of close values, as in a sorted column
+      std::uniform_int_distribution<int64_t> step_dist(0, 4 * 86400);
+
+      std::vector<int64_t> seconds, values;
+      int64_t current = 0;
+      for (int i = 0; i < 2000; ++i) {
+        current = i % 100 == 0 ? seconds_dist(engine) : current + step_dist(engine);
+        seconds.push_back(current);
+        values.push_back(current * units_per_second + units_dist(engine));
+      }
+      std::shared_ptr<Array> array;
+      ArrayFromVector<TimestampType, int64_t>(timestamp(unit, timezone), values, &array);
+
+      for (auto component : kComponents) {
+        SCOPED_TRACE(::testing::Message() << "component = " << component);
+        std::vector<int64_t> expected;
+        for (int64_t s : seconds) {
+          expected.push_back(reference.Extract(component, s));
+        }
+        Datum actual;
+        ASSERT_OK(ExtractTemporal(&ctx_, component, array, &actual));
+        AssertArraysEqual(*_MakeArray<Int64Type, int64_t>(int64(), expected, {}),
+                          *actual.make_array());
+      }
+      for (auto component : kTruncateComponents) {
+        SCOPED_TRACE(::testing::Message() << "truncate to " << component);
+        std::vector<int64_t> expected;
+        for (int64_t s : seconds) {
+          expected.push_back(reference.Truncate(component, s) * units_per_second);
+        }
+        Datum actual;
+        ASSERT_OK(TruncateTemporal(&ctx_, component, array, &actual));
+        AssertArraysEqual(
+            *_MakeArray<TimestampType, int64_t>(array->type(), expected, {}),
+            *actual.make_array());
+      }
+    }
+  }
+};
+
+TEST_F(TestTemporalKernels, Extract) {
+  // 1970-01-01 00:00:00, 1969-12-31 23:59:59, 2000-02-29 01:02:03
+  auto values = ArrayFromJSON(timestamp(TimeUnit::SECOND), "[0, -1, null, 951786123]");
+  AssertExtract(values, YEAR, "[1970, 1969, null, 2000]");
+  AssertExtract(values, MONTH, "[1, 12, null, 2]");
+  AssertExtract(values, DAY, "[1, 31, null, 29]");
+  AssertExtract(values, DAY_OF_WEEK, "[3, 2, null, 1]");
+  AssertExtract(values, DAY_OF_YEAR, "[1, 365, null, 60]");
+  AssertExtract(values, HOUR, "[0, 23, null, 1]");
+  AssertExtract(values, MINUTE, "[0, 59, null, 2]");
+  AssertExtract(values, SECOND, "[0, 59, null, 3]");
+
+  values = ArrayFromJSON(timestamp(TimeUnit::MILLI), "[-1, 951786123999]");
+  AssertExtract(values, SECOND, "[59, 3]");
+  AssertExtract(values->Slice(1), DAY_OF_WEEK, "[1]");
+}
+
+TEST_F(TestTemporalKernels, Truncate) {
+  auto values = ArrayFromJSON(timestamp(TimeUnit::SECOND), "[0, -1, null, 951786123]");
+  AssertTruncate(values, YEAR, "[0, -31536000, null, 946684800]");
+  AssertTruncate(values, MONTH, "[0, -2678400, null, 949363200]");
+  AssertTruncate(values, DAY, "[0, -86400, null, 951782400]");
+  AssertTruncate(values, HOUR, "[0, -3600, null, 951786000]");
+  AssertTruncate(values, MINUTE, "[0, -60, null, 951786120]");
+  AssertTruncate(values, SECOND, "[0, -1, null, 951786123]");
+
+  values = ArrayFromJSON(timestamp(TimeUnit::MICRO), "[-1, 951786123456789]");
+  AssertTruncate(values, SECOND, "[-1000000, 951786123000000]");
+  AssertTruncate(values, DAY, "[-86400000000, 951782400000000]");
+
+  Datum out;
+  ASSERT_RAISES(Invalid, TruncateTemporal(&ctx_, DAY_OF_WEEK, values, &out));
+}
+
+TEST_F(TestTemporalKernels, Random) {
+  CheckRandom("");
+  CheckRandom("UTC");
+  CheckRandom("America/New_York");
+  CheckRandom("America/Sao_Paulo");
+  CheckRandom("Australia/Lord_Howe");
+  CheckRandom("Asia/Kolkata");
+}
+
+TEST_F(TestTemporalKernels, TimeZones) {
+  // The clocks go from 01:59:59 EST to 03:00:00 EDT
+  auto values = ArrayFromJSON(timestamp(TimeUnit::SECOND, "America/New_York"),
+                              "[1583650799, 1583650800, null]");
+  AssertExtract(values, HOUR, "[1, 3, null]");
+  AssertTruncate(values, HOUR, "[1583647200, 1583650800, null]");
+  AssertTruncate(values, DAY, "[1583643600, 1583643600, null]");
+
+  // The clocks went from 00:00 to 01:00, so that the day started at 01:00
+  values = ArrayFromJSON(timestamp(TimeUnit::SECOND, "America/Sao_Paulo"),
+                         "[1541340000]");
+  AssertExtract(values, HOUR, "[12]");
+  AssertTruncate(values, DAY, "[1541300400]");
+
+  values = ArrayFromJSON(timestamp(TimeUnit::SECOND, "+05:30"), "[0, -19801]");
+  AssertExtract(values, HOUR, "[5, 23]");
+  AssertExtract(values, MINUTE, "[30, 59]");
+  AssertTruncate(values, DAY, "[-19800, -106200]");
+  values = ArrayFromJSON(timestamp(TimeUnit::SECOND, "-08:00"), "[0]");
+  AssertExtract(values, DAY, "[31]");
+  AssertTruncate(values, DAY, "[-57600]");
+
+  Datum out;
+  for (std::string timezone : {"Mars/Olympus_Mons", "+5:30", "+05:60", "05:00"}) {
+    ASSERT_RAISES(Invalid,
+                  ExtractTemporal(&ctx_, HOUR,
+                                  ArrayFromJSON(timestamp(TimeUnit::SECOND, timezone),
+                                                "[0]"),
+                                  &out));
+  }
+}
+
+TEST_F(TestTemporalKernels, Dates) {
+  // 1970-01-01, 1969-12-31, 2000-02-29
+  auto values = ArrayFromJSON(date32(), "[0, -1, null, 11016]");
+  AssertExtract(values, YEAR, "[1970, 1969, null, 2000]");
+  AssertExtract(values, DAY_OF_YEAR, "[1, 365, null, 60]");
+  AssertExtract(values, HOUR, "[0, 0, null, 0]");
+  AssertTruncate(values, MONTH, "[0, -31, null, 10988]");
+  AssertTruncate(values, DAY, "[0, -1, null, 11016]");
+
+  values = ArrayFromJSON(date64(), "[0, -86400000, null, 951782400000]");
+  AssertExtract(values, DAY_OF_WEEK, "[3, 2, null, 1]");
+  AssertTruncate(values, YEAR, "[0, -31536000000, null, 946684800000]");
+
+  Datum out;
+  ASSERT_RAISES(Invalid, TruncateTemporal(&ctx_, HOUR, values, &out));
+  ASSERT_RAISES(NotImplemented,
+                ExtractTemporal(&ctx_, YEAR, ArrayFromJSON(int64(), "[0]"), &out));
+}
+
+TEST_F(TestTemporalKernels, ChunkedArray) {
+  auto values = ArrayFromJSON(timestamp(TimeUnit::SECOND, "Asia/Kolkata"),
+                              "[0, null, 951786123]");
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 1), values->Slice(1, 0), values->Slice(1)});
+  Datum actual;
+  ASSERT_OK(ExtractTemporal(&ctx_, HOUR, chunked, &actual));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, actual.kind());
+  AssertChunkedEqual(ChunkedArray({ArrayFromJSON(int64(), "[5]"),
+                                   ArrayFromJSON(int64(), "[]"),
+                                   ArrayFromJSON(int64(), "[null, 6]")}),
+                     *actual.chunked_array());
+
+  ASSERT_OK(TruncateTemporal(&ctx_, DAY, chunked, &actual));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, actual.kind());
+  AssertChunkedEqual(ChunkedArray({ArrayFromJSON(values->type(), "[-19800]"),
+                                   ArrayFromJSON(values->type(), "[]"),
+                                   ArrayFromJSON(values->type(), "[null, 951762600]")}),
+                     *actual.chunked_array());
+}
+
+}  // namespace compute
+}  // namespace arrow
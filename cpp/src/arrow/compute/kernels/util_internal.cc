@@ -287,7 +287,7 @@ Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
     output->null_count = kUnknownNullCount;
     output->GetNullCount();
     return Status::OK();
-  } else if (left.null_count != 0) {
+  } else if (left.GetNullCount() != 0) {
     return PropagateNulls(ctx, left, output);
   } else {
     // right has a positive null_count or both are zero.
@@ -34,16 +34,50 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/task_group.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace csv {
 
 class BlockParser;
 
+using internal::checked_cast;
 using internal::TaskGroup;
 
+// Remap the chunks of a dictionary column so that they share the same dictionary
+static Result<ArrayVector> UnifyDictionaryChunks(const ArrayVector& chunks,
+                                                 const std::shared_ptr<DataType>& type,
+                                                 MemoryPool* pool) {
+  if (chunks.size() <= 1) {
+    return chunks;
+  }
+  const auto& dict_type = checked_cast<const DictionaryType&>(*type);
+  ARROW_ASSIGN_OR_RAISE(auto unifier,
+                        DictionaryUnifier::Make(dict_type.value_type(), pool));
+  std::vector<std::shared_ptr<Buffer>> transpose_maps(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*chunks[i]);
+    RETURN_NOT_OK(unifier->Unify(*dict_array.dictionary(), &transpose_maps[i]));
+  }
+  std::shared_ptr<DataType> unified_type;
+  std::shared_ptr<Array> dictionary;
+  RETURN_NOT_OK(unifier->GetResult(&unified_type, &dictionary));
+
+  // Keep the original index type, so as not to change the column type
+  ArrayVector unified_chunks(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*chunks[i]);
+    const auto transpose_map =
+        reinterpret_cast<const int32_t*>(transpose_maps[i]->data());
+    ARROW_ASSIGN_OR_RAISE(unified_chunks[i],
+                          dict_array.Transpose(type, dictionary, transpose_map, pool));
+  }
+  return unified_chunks;
+}
+
 void ColumnBuilder::SetTaskGroup(const std::shared_ptr<internal::TaskGroup>& task_group) {
   task_group_ = task_group;
 }
@@ -161,7 +195,17 @@ class TypedColumnBuilder : public ColumnBuilder {
 };
 
 Status TypedColumnBuilder::Init() {
-  ARROW_ASSIGN_OR_RAISE(converter_, Converter::Make(type_, options_, pool_));
+  if (type_->id() == Type::DICTIONARY) {
+    const auto& dict_type = checked_cast<const DictionaryType&>(*type_);
+    if (dict_type.index_type()->id() != Type::INT32) {
+      return Status::NotImplemented("CSV conversion to ", type_->ToString(),
+                                    " is not supported");
+    }
+    ARROW_ASSIGN_OR_RAISE(converter_, DictionaryConverter::Make(dict_type.value_type(),
+                                                                options_, pool_));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(converter_, Converter::Make(type_, options_, pool_));
+  }
   return Status::OK();
 }
 
@@ -181,6 +225,10 @@ void TypedColumnBuilder::Insert(int64_t block_index,
 
   // We're careful that all references in the closure outlive the Append() call
   task_group_->Append([=]() -> Status {
+    ARROW_TRACE_SPAN_DETAIL(
+        "csv::ConvertChunk",
+        "column " + std::to_string(col_index_) + ", block " +
+            std::to_string(chunk_index));
     auto maybe_array = converter_->Convert(*parser, col_index_);
     if (!maybe_array.ok()) {
       return WrapConversionError(maybe_array.status());
@@ -203,6 +251,9 @@ Result<std::shared_ptr<ChunkedArray>> TypedColumnBuilder::Finish() {
       return Status::Invalid("a chunk failed converting for an unknown reason");
     }
   }
+  if (options_.unify_dictionaries && type_->id() == Type::DICTIONARY) {
+    ARROW_ASSIGN_OR_RAISE(chunks_, UnifyDictionaryChunks(chunks_, type_, pool_));
+  }
   return std::make_shared<ChunkedArray>(chunks_, type_);
 }
 
@@ -220,6 +271,7 @@ class InferringColumnBuilder : public ColumnBuilder {
         pool_(pool) {}
 
   Status Init();
+  Status InferFromSample(const BlockParser& sample);
 
   void Insert(int64_t block_index, const std::shared_ptr<BlockParser>& parser) override;
   Result<std::shared_ptr<ChunkedArray>> Finish() override;
@@ -266,6 +318,19 @@ Status InferringColumnBuilder::Init() {
   return UpdateType();
 }
 
+Status InferringColumnBuilder::InferFromSample(const BlockParser& sample) {
+  // No chunks yet, so loosening the type doesn't require any reconversion
+  DCHECK(chunks_.empty());
+  while (can_loosen_type_) {
+    auto maybe_array = converter_->Convert(sample, col_index_);
+    if (maybe_array.ok()) {
+      break;
+    }
+    RETURN_NOT_OK(LoosenType(maybe_array.status()));
+  }
+  return Status::OK();
+}
+
 Status InferringColumnBuilder::LoosenType(const Status& conversion_error) {
   // We are locked
 
@@ -371,7 +436,14 @@ Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
   DCHECK_NE(parser, nullptr);
 
   lock.unlock();
-  auto maybe_array = converter->Convert(*parser, col_index_);
+  Result<std::shared_ptr<Array>> maybe_array;
+  {
+    ARROW_TRACE_SPAN_DETAIL(
+        "csv::ConvertChunk",
+        "column " + std::to_string(col_index_) + ", block " +
+            std::to_string(chunk_index));
+    maybe_array = converter->Convert(*parser, col_index_);
+  }
   lock.lock();
 
   if (kind != infer_kind_) {
@@ -453,6 +525,9 @@ Result<std::shared_ptr<ChunkedArray>> InferringColumnBuilder::Finish() {
     DCHECK_EQ(chunk->type()->id(), infer_type_->id())
         << "Inference didn't equalize types!";
   }
+  if (options_.unify_dictionaries && infer_type_->id() == Type::DICTIONARY) {
+    ARROW_ASSIGN_OR_RAISE(chunks_, UnifyDictionaryChunks(chunks_, infer_type_, pool_));
+  }
   auto ptr = std::make_shared<ChunkedArray>(chunks_, infer_type_);
   chunks_.clear();
   parsers_.clear();
@@ -473,10 +548,13 @@ Result<std::shared_ptr<ColumnBuilder>> ColumnBuilder::Make(
 
 Result<std::shared_ptr<ColumnBuilder>> ColumnBuilder::Make(
     MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
-    const std::shared_ptr<TaskGroup>& task_group) {
+    const std::shared_ptr<TaskGroup>& task_group, const BlockParser* sample) {
   auto ptr =
       std::make_shared<InferringColumnBuilder>(col_index, options, pool, task_group);
   RETURN_NOT_OK(ptr->Init());
+  if (sample != nullptr) {
+    RETURN_NOT_OK(ptr->InferFromSample(*sample));
+  }
   return ptr;
 }
 
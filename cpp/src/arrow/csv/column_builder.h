@@ -66,9 +66,13 @@ class ARROW_EXPORT ColumnBuilder {
       const std::shared_ptr<internal::TaskGroup>& task_group);
 
   /// Construct a type-inferring ColumnBuilder.
+  ///
+  /// If `sample` is non-null, the initial type is inferred from the sample's
+  /// values, so that inserted blocks are rarely converted more than once.
   static Result<std::shared_ptr<ColumnBuilder>> Make(
       MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
-      const std::shared_ptr<internal::TaskGroup>& task_group);
+      const std::shared_ptr<internal::TaskGroup>& task_group,
+      const BlockParser* sample = NULLPTR);
 
   /// Construct a ColumnBuilder for a column of nulls
   /// (i.e. not present in the CSV file).
@@ -263,6 +263,31 @@ TEST(ColumnBuilder, EmptyChunks) {
                   ArrayFromJSON(int16(), "[]")});
 }
 
+TEST(ColumnBuilder, Dictionary) {
+  auto options = ConvertOptions::Defaults();
+  auto tg = TaskGroup::MakeSerial();
+  auto type = dictionary(int32(), utf8());
+  std::shared_ptr<ColumnBuilder> builder;
+  ASSERT_OK_AND_ASSIGN(builder,
+                       ColumnBuilder::Make(default_memory_pool(), type, 0, options, tg));
+
+  std::shared_ptr<ChunkedArray> actual;
+  AssertBuilding(builder, {{"ab", "cd", "ab"}, {"ef"}}, &actual);
+  ASSERT_EQ(actual->num_chunks(), 2);
+  AssertTypeEqual(*actual->type(), *type);
+  const auto& chunk0 = checked_cast<const DictionaryArray&>(*actual->chunk(0));
+  AssertArraysEqual(*chunk0.indices(), *ArrayFromJSON(int32(), "[0, 1, 0]"));
+  AssertArraysEqual(*chunk0.dictionary(), *ArrayFromJSON(utf8(), R"(["ab", "cd"])"));
+  const auto& chunk1 = checked_cast<const DictionaryArray&>(*actual->chunk(1));
+  AssertArraysEqual(*chunk1.indices(), *ArrayFromJSON(int32(), "[0]"));
+  AssertArraysEqual(*chunk1.dictionary(), *ArrayFromJSON(utf8(), R"(["ef"])"));
+
+  // Only int32 indices are supported
+  ASSERT_RAISES(NotImplemented,
+                ColumnBuilder::Make(default_memory_pool(), dictionary(int8(), utf8()), 0,
+                                    options, tg));
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Tests for type-inferring column builder
 
@@ -425,6 +450,31 @@ TEST(InferringColumnBuilder, MultipleChunkIntegerParallel) {
   CheckInferred(tg, {{"1", "2"}, {"3"}, {"4", "5"}, {"6", "7"}}, options, expected);
 }
 
+TEST(InferringColumnBuilder, InferFromSample) {
+  auto options = ConvertOptions::Defaults();
+  std::shared_ptr<BlockParser> sample;
+  std::shared_ptr<ColumnBuilder> builder;
+  std::shared_ptr<ChunkedArray> actual, expected;
+
+  // The sample makes the column real from the start
+  MakeColumnParser({"1", "", "2.5"}, &sample);
+  ASSERT_OK_AND_ASSIGN(builder,
+                       ColumnBuilder::Make(default_memory_pool(), 0, options,
+                                           TaskGroup::MakeSerial(), sample.get()));
+  AssertBuilding(builder, {{"1", "2"}, {"3"}}, &actual);
+  ChunkedArrayFromVector<DoubleType>({{1, 2}, {3}}, &expected);
+  AssertChunkedEqual(*actual, *expected);
+
+  // Values not in the sample still loosen the type
+  MakeColumnParser({"1", "2"}, &sample);
+  ASSERT_OK_AND_ASSIGN(builder,
+                       ColumnBuilder::Make(default_memory_pool(), 0, options,
+                                           TaskGroup::MakeSerial(), sample.get()));
+  AssertBuilding(builder, {{"1", "2"}, {"a"}}, &actual);
+  ChunkedArrayFromVector<StringType, std::string>({{"1", "2"}, {"a"}}, &expected);
+  AssertChunkedEqual(*actual, *expected);
+}
+
 void CheckAutoDictEncoded(const std::shared_ptr<TaskGroup>& tg, const ChunkData& csv_data,
                           const ConvertOptions& options,
                           std::vector<std::shared_ptr<Array>> expected_indices,
@@ -472,5 +522,26 @@ TEST(InferringColumnBuilder, SingleChunkBinaryAutoDict) {
                        {expected_dictionary});
 }
 
+TEST(InferringColumnBuilder, MultipleChunkUnifiedAutoDict) {
+  auto options = ConvertOptions::Defaults();
+  options.auto_dict_encode = true;
+  options.unify_dictionaries = true;
+  ChunkData csv_data = {{"ab", "cd", "ab"}, {"ef", "ab"}, {}, {"cd", "ef", "gh"}};
+
+  std::shared_ptr<Array> expected_dictionary;
+  ArrayFromVector<StringType, std::string>({"ab", "cd", "ef", "gh"},
+                                           &expected_dictionary);
+  std::vector<std::shared_ptr<Array>> expected_indices(4);
+  ArrayFromVector<Int32Type>({0, 1, 0}, &expected_indices[0]);
+  ArrayFromVector<Int32Type>({2, 0}, &expected_indices[1]);
+  ArrayFromVector<Int32Type>({}, &expected_indices[2]);
+  ArrayFromVector<Int32Type>({1, 2, 3}, &expected_indices[3]);
+
+  for (auto tg : {TaskGroup::MakeSerial(), TaskGroup::MakeThreaded(GetCpuThreadPool())}) {
+    CheckAutoDictEncoded(tg, csv_data, options, expected_indices,
+                         std::vector<std::shared_ptr<Array>>(4, expected_dictionary));
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include "arrow/csv/converter.h"
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
 #include <sstream>
@@ -30,7 +31,9 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
 #include "arrow/util/trie.h"
 #include "arrow/util/utf8.h"
@@ -80,33 +83,126 @@ inline void TrimWhiteSpace(const uint8_t** data_inout, uint32_t* size_inout) {
   }
 }
 
-Status InitializeTrie(const std::vector<std::string>& inputs, Trie* trie) {
-  TrieBuilder builder;
-  for (const auto& s : inputs) {
-    RETURN_NOT_OK(builder.Append(s, true /* allow_duplicates */));
+// A matcher for a set of spellings, such as those of nulls or booleans.
+//
+// Spellings of at most 8 bytes are bucketed by length and compared to a cell
+// as a single zero-padded 64-bit word, rather than walking a trie byte by
+// byte.  Cells whose length matches no spelling are rejected at once.
+// Longer spellings are looked up in a Trie.
+class ValueMatcher {
+ public:
+  static constexpr uint32_t kMaxShortLength = 8;
+
+  Status Init(const std::vector<std::string>& values) {
+    TrieBuilder builder;
+    for (const auto& value : values) {
+      const auto size = static_cast<uint32_t>(value.size());
+      const auto data = reinterpret_cast<const uint8_t*>(value.data());
+      length_mask_ |= 1 << std::min(size, kMaxShortLength + 1);
+      if (size > 0) {
+        first_bytes_[data[0]] = true;
+      }
+      if (size <= kMaxShortLength) {
+        short_values_[size].push_back(LoadWord(data, size));
+      } else {
+        RETURN_NOT_OK(builder.Append(value, true /* allow_duplicates */));
+      }
+    }
+    long_values_ = builder.Finish();
+    return Status::OK();
   }
-  *trie = builder.Finish();
-  return Status::OK();
-}
 
-class ConcreteConverterMixin {
- protected:
-  Status InitializeNullTrie(const ConvertOptions& options);
+  bool Match(const uint8_t* data, uint32_t size) const {
+    if (size > kMaxShortLength) {
+      return HasLength(size) &&
+             long_values_.Find(util::string_view(reinterpret_cast<const char*>(data),
+                                                 size)) >= 0;
+    }
+    if (!HasLength(size)) {
+      return false;
+    }
+    const uint64_t word = LoadWord(data, size);
+    for (const uint64_t value : short_values_[size]) {
+      if (value == word) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool matches_empty() const { return HasLength(0); }
 
-  bool IsNull(const uint8_t* data, uint32_t size, bool quoted) {
-    if (quoted) {
+  // Whether a non-empty cell of the given column may match, judging from
+  // the cells' lengths and first bytes only
+  bool MayMatchNonEmpty(const BlockParser& parser, int32_t col_index) const {
+    if (length_mask_ <= 1) {
       return false;
     }
-    return null_trie_.Find(
-               util::string_view(reinterpret_cast<const char*>(data), size)) >= 0;
+    bool may_match = false;
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      may_match |= !quoted && size > 0 && HasLength(size) && first_bytes_[data[0]];
+      return Status::OK();
+    };
+    ARROW_UNUSED(parser.VisitColumn(col_index, visit));
+    return may_match;
+  }
+
+ protected:
+  static uint64_t LoadWord(const uint8_t* data, uint32_t size) {
+    uint64_t word = 0;
+    std::memcpy(&word, data, size);
+    return word;
+  }
+
+  bool HasLength(uint32_t size) const {
+    return (length_mask_ >> std::min(size, kMaxShortLength + 1)) & 1;
+  }
+
+  // Bit i is set if a spelling has i bytes, bit 9 if one has more than 8 bytes
+  uint32_t length_mask_ = 0;
+  bool first_bytes_[256] = {};
+  std::vector<uint64_t> short_values_[kMaxShortLength + 1];
+  Trie long_values_;
+};
+
+constexpr uint32_t ValueMatcher::kMaxShortLength;
+
+class ConcreteConverterMixin {
+ protected:
+  // Null detection for the cells of a column in a block.  Detection is
+  // skipped altogether for non-empty cells if none of them may be null.
+  class NullChecker {
+   public:
+    NullChecker(const ValueMatcher& matcher, bool check_non_empty)
+        : matcher_(matcher), check_non_empty_(check_non_empty) {}
+
+    bool operator()(const uint8_t* data, uint32_t size, bool quoted) const {
+      if (quoted) {
+        return false;
+      }
+      if (size == 0) {
+        return matcher_.matches_empty();
+      }
+      return check_non_empty_ && matcher_.Match(data, size);
+    }
+
+   private:
+    const ValueMatcher& matcher_;
+    const bool check_non_empty_;
+  };
+
+  Status InitializeNullMatcher(const ConvertOptions& options);
+
+  NullChecker MakeNullChecker(const BlockParser& parser, int32_t col_index) const {
+    return NullChecker(null_matcher_, null_matcher_.MayMatchNonEmpty(parser, col_index));
   }
 
-  Trie null_trie_;
+  ValueMatcher null_matcher_;
 };
 
-Status ConcreteConverterMixin::InitializeNullTrie(const ConvertOptions& options) {
-  // TODO no need to build a separate Trie for each Converter instance
-  return InitializeTrie(options.null_values, &null_trie_);
+Status ConcreteConverterMixin::InitializeNullMatcher(const ConvertOptions& options) {
+  // TODO no need to build a separate matcher for each Converter instance
+  return null_matcher_.Init(options.null_values);
 }
 
 class ConcreteConverter : public Converter, public ConcreteConverterMixin {
@@ -114,7 +210,7 @@ class ConcreteConverter : public Converter, public ConcreteConverterMixin {
   using Converter::Converter;
 
  protected:
-  Status Initialize() override { return InitializeNullTrie(options_); }
+  Status Initialize() override { return InitializeNullMatcher(options_); }
 };
 
 class ConcreteDictionaryConverter : public DictionaryConverter,
@@ -123,7 +219,7 @@ class ConcreteDictionaryConverter : public DictionaryConverter,
   using DictionaryConverter::DictionaryConverter;
 
  protected:
-  Status Initialize() override { return InitializeNullTrie(options_); }
+  Status Initialize() override { return InitializeNullMatcher(options_); }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -137,8 +233,10 @@ class NullConverter : public ConcreteConverter {
                                          int32_t col_index) override {
     NullBuilder builder(pool_);
 
+    // All cells are expected to be null, so checking whether they may be is moot
+    const NullChecker is_null(null_matcher_, /*check_non_empty=*/true);
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      if (ARROW_PREDICT_TRUE(IsNull(data, size, quoted))) {
+      if (ARROW_PREDICT_TRUE(is_null(data, size, quoted))) {
         return builder.AppendNull();
       } else {
         return GenericConversionError(type_, data, size);
@@ -161,14 +259,13 @@ class BinaryConverter : public ConcreteConverter {
 
   Result<std::shared_ptr<Array>> Convert(const BlockParser& parser,
                                          int32_t col_index) override {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
     using BuilderType = typename TypeTraits<T>::BuilderType;
     BuilderType builder(pool_);
 
+    // UTF8 is validated once all values are appended, which is much faster
+    // than validating the (typically short) values one by one
     auto visit_non_null = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
-        return Status::Invalid("CSV conversion error to ", type_->ToString(),
-                               ": invalid UTF8 data");
-      }
       builder.UnsafeAppend(data, size);
       return Status::OK();
     };
@@ -177,8 +274,9 @@ class BinaryConverter : public ConcreteConverter {
     RETURN_NOT_OK(builder.ReserveData(parser.num_bytes()));
 
     if (options_.strings_can_be_null) {
+      const auto is_null = MakeNullChecker(parser, col_index);
       auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-        if (IsNull(data, size, false /* quoted */)) {
+        if (is_null(data, size, false /* quoted */)) {
           builder.UnsafeAppendNull();
           return Status::OK();
         } else {
@@ -192,6 +290,14 @@ class BinaryConverter : public ConcreteConverter {
 
     std::shared_ptr<Array> res;
     RETURN_NOT_OK(builder.Finish(&res));
+    if (CheckUTF8) {
+      const auto& array = internal::checked_cast<const ArrayType&>(*res);
+      if (ARROW_PREDICT_FALSE(!util::ValidateUTF8Strings(
+              array.value_data()->data(), array.raw_value_offsets(), array.length()))) {
+        return Status::Invalid("CSV conversion error to ", type_->ToString(),
+                               ": invalid UTF8 data");
+      }
+    }
     return res;
   }
 
@@ -229,8 +335,9 @@ class DictionaryBinaryConverter : public ConcreteDictionaryConverter {
     RETURN_NOT_OK(builder.Resize(parser.num_rows()));
 
     if (options_.strings_can_be_null) {
+      const auto is_null = MakeNullChecker(parser, col_index);
       auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-        if (IsNull(data, size, false /* quoted */)) {
+        if (is_null(data, size, false /* quoted */)) {
           return builder.AppendNull();
         } else {
           return visit_non_null(data, size, quoted);
@@ -298,19 +405,18 @@ class BooleanConverter : public ConcreteConverter {
                                          int32_t col_index) override {
     BooleanBuilder builder(type_, pool_);
 
+    const auto is_null = MakeNullChecker(parser, col_index);
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       // XXX should quoted values be allowed at all?
-      if (IsNull(data, size, quoted)) {
+      if (is_null(data, size, quoted)) {
         builder.UnsafeAppendNull();
         return Status::OK();
       }
-      if (false_trie_.Find(
-              util::string_view(reinterpret_cast<const char*>(data), size)) >= 0) {
+      if (false_matcher_.Match(data, size)) {
         builder.UnsafeAppend(false);
         return Status::OK();
       }
-      if (true_trie_.Find(util::string_view(reinterpret_cast<const char*>(data), size)) >=
-          0) {
+      if (true_matcher_.Match(data, size)) {
         builder.UnsafeAppend(true);
         return Status::OK();
       }
@@ -326,14 +432,14 @@ class BooleanConverter : public ConcreteConverter {
 
  protected:
   Status Initialize() override {
-    // TODO no need to build separate Tries for each BooleanConverter instance
-    RETURN_NOT_OK(InitializeTrie(options_.true_values, &true_trie_));
-    RETURN_NOT_OK(InitializeTrie(options_.false_values, &false_trie_));
+    // TODO no need to build separate matchers for each BooleanConverter instance
+    RETURN_NOT_OK(true_matcher_.Init(options_.true_values));
+    RETURN_NOT_OK(false_matcher_.Init(options_.false_values));
     return ConcreteConverter::Initialize();
   }
 
-  Trie true_trie_;
-  Trie false_trie_;
+  ValueMatcher true_matcher_;
+  ValueMatcher false_matcher_;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -352,10 +458,11 @@ class NumericConverter : public ConcreteConverter {
     BuilderType builder(type_, pool_);
     StringConverter<T> converter;
 
+    const auto is_null = MakeNullChecker(parser, col_index);
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       // XXX should quoted values be allowed at all?
       value_type value;
-      if (IsNull(data, size, quoted)) {
+      if (is_null(data, size, quoted)) {
         builder.UnsafeAppendNull();
         return Status::OK();
       }
@@ -392,9 +499,10 @@ class TimestampConverter : public ConcreteConverter {
     TimestampBuilder builder(type_, pool_);
     StringConverter<TimestampType> converter(type_);
 
+    const auto is_null = MakeNullChecker(parser, col_index);
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       value_type value = 0;
-      if (IsNull(data, size, quoted)) {
+      if (is_null(data, size, quoted)) {
         builder.UnsafeAppendNull();
         return Status::OK();
       }
@@ -425,8 +533,9 @@ class DecimalConverter : public ConcreteConverter {
                                          int32_t col_index) override {
     Decimal128Builder builder(type_, pool_);
 
+    const auto is_null = MakeNullChecker(parser, col_index);
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      if (IsNull(data, size, quoted)) {
+      if (is_null(data, size, quoted)) {
         builder.UnsafeAppendNull();
         return Status::OK();
       }
@@ -24,6 +24,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/csv/test_common.h"
+#include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 
 namespace arrow {
@@ -75,10 +76,16 @@ static std::shared_ptr<BlockParser> BuildStringData(int32_t num_rows) {
 static void BenchmarkConversion(benchmark::State& state,  // NOLINT non-const reference
                                 BlockParser& parser,
                                 const std::shared_ptr<DataType>& type,
-                                ConvertOptions options) {
+                                ConvertOptions options, bool use_arena = false) {
   std::shared_ptr<Converter> converter = *Converter::Make(type, options);
 
   while (state.KeepRunning()) {
+    // The converted batch is allocated from an arena of its own
+    std::shared_ptr<ArenaMemoryPool> arena;
+    if (use_arena) {
+      arena = ArenaMemoryPool::Make();
+      converter = *Converter::Make(type, options, arena.get());
+    }
     auto converted = *converter->Convert(parser, 0 /* col_index */);
     if (converted->length() != parser.num_rows()) {
       std::cerr << "Conversion incomplete\n";
@@ -119,10 +126,27 @@ static void StringConversion(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkConversion(state, *parser, utf8(), options);
 }
 
+static void Int64ConversionArena(benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = BuildInt64Data(num_rows);
+  auto options = ConvertOptions::Defaults();
+
+  BenchmarkConversion(state, *parser, int64(), options, /*use_arena=*/true);
+}
+
+static void StringConversionArena(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = BuildStringData(num_rows);
+  auto options = ConvertOptions::Defaults();
+
+  BenchmarkConversion(state, *parser, utf8(), options, /*use_arena=*/true);
+}
+
 BENCHMARK(Int64Conversion);
 BENCHMARK(FloatConversion);
 BENCHMARK(Decimal128Conversion);
 BENCHMARK(StringConversion);
+BENCHMARK(Int64ConversionArena);
+BENCHMARK(StringConversionArena);
 
 }  // namespace csv
 }  // namespace arrow
@@ -216,6 +216,8 @@ static void TestStringConversionErrors() {
   auto type = TypeTraits<T>::type_singleton();
   // Invalid UTF8 in column 0
   AssertConversionError(type, {"ab,cdé\n", "\xff,gh\n"}, {0});
+  // Valid UTF8 character split between two values of column 1
+  AssertConversionError(type, {"ab,cd\xc3\n", "ef,\xa9gh\n"}, {1});
 }
 
 TEST(StringConversion, Errors) { TestStringConversionErrors<StringType>(); }
@@ -286,6 +288,26 @@ TEST(IntegerConversion, CustomNulls) {
                                      options);
 }
 
+TEST(IntegerConversion, CustomNullsOfDifferentLengths) {
+  auto options = ConvertOptions::Defaults();
+  // Spellings of 0 to 9 bytes, several of a same length
+  options.null_values = {"", "-", "x", "NULL", "12345678", "missing_1"};
+
+  AssertConversion<Int64Type, int64_t>(
+      int64(), {"12345678,12345679\n", "missing_1,123456789\n", "-,x\n", ",NULL\n"},
+      {{0, 0, 0, 0}, {12345679, 123456789, 0, 0}},
+      {{false, false, false, false}, {true, true, false, false}}, options);
+
+  AssertConversionError(int64(), {"1,missing_2\n"}, {1}, options);
+  AssertConversionError(int64(), {"1,NUL\n"}, {1}, options);
+
+  // No null spellings at all
+  options.null_values = {};
+  AssertConversion<Int64Type, int64_t>(int64(), {"1,2\n", "3,4\n"}, {{1, 3}, {2, 4}},
+                                       options);
+  AssertConversionError(int64(), {"1,\n"}, {1}, options);
+}
+
 TEST(IntegerConversion, Whitespace) {
   AssertConversion<Int32Type, int32_t>(int32(), {" 12,34 \n", " 56 ,78\n"},
                                        {{12, 56}, {34, 78}});
@@ -341,6 +363,21 @@ TEST(BooleanConversion, CustomNulls) {
                                       {{true, false}, {false, true}}, options);
 }
 
+TEST(BooleanConversion, CustomValues) {
+  auto options = ConvertOptions::Defaults();
+  options.true_values = {"yes", "Y", "affirmative"};
+  options.false_values = {"no", "N", "negative"};
+
+  AssertConversion<BooleanType, bool>(boolean(), {"yes,N\n", "affirmative,no\n"},
+                                      {{true, true}, {false, false}}, options);
+  AssertConversion<BooleanType, bool>(boolean(), {"Y,negative\n", ",no\n"},
+                                      {{true, false}, {false, false}},
+                                      {{true, false}, {true, true}}, options);
+
+  AssertConversionError(boolean(), {"yes,true\n"}, {1}, options);
+  AssertConversionError(boolean(), {"yes,negativ\n"}, {1}, options);
+}
+
 TEST(TimestampConversion, Basics) {
   auto type = timestamp(TimeUnit::SECOND);
 
@@ -86,6 +86,21 @@ struct ARROW_EXPORT ConvertOptions {
   /// This setting is ignored for non-inferred columns (those in `column_types`).
   bool auto_dict_encode = false;
   int32_t auto_dict_max_cardinality = 50;
+  /// Whether all chunks of a dict-encoded column should share the same dictionary.
+  /// If true, the per-chunk dictionaries are unified once the column is finished,
+  /// and chunk indices are remapped into the unified dictionary.
+  ///
+  /// This applies both to auto-dict-encoded columns and to columns with a
+  /// dictionary type in `column_types`.  Note that `auto_dict_max_cardinality`
+  /// still applies per chunk, not to the unified dictionary.
+  bool unify_dictionaries = false;
+
+  /// If positive, the types of inferred columns are first guessed from up to
+  /// this many rows at the start of the CSV data (within the first block).
+  /// The data is then usually converted in a single pass, instead of
+  /// reconverting all chunks seen so far each time a wider type is detected.
+  /// Values that don't fit the guessed type still loosen it as usual.
+  int32_t inference_sample_rows = 0;
 
   // XXX Should we have a separate FilterOptions?
 
@@ -124,9 +139,39 @@ struct ARROW_EXPORT ReadOptions {
   /// If false, column names will be read from the first CSV row after `skip_rows`.
   bool autogenerate_column_names = false;
 
+  /// Byte range of the input to read, for splitting a CSV file between readers.
+  ///
+  /// If `range_start` is positive or `range_end` is non-negative, only the rows
+  /// whose first byte is in [range_start, range_end) are read (a negative
+  /// `range_end` means the end of the input).  Offsets are counted from the start
+  /// of the input, and the header (including any skipped rows) is always read
+  /// from there.  Reading consecutive ranges therefore yields each row exactly once.
+  ///
+  /// Row boundaries are found by looking for line separators, so byte ranges are
+  /// not supported if `ParseOptions::newlines_in_values` is true.
+  int64_t range_start = 0;
+  int64_t range_end = -1;
+
   /// Create read options with default values
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// Whether to write an initial line with the column names
+  bool include_header = true;
+  /// Field delimiter
+  char delimiter = ',';
+  /// Maximum number of rows formatted and written at once.  Larger record
+  /// batches are split accordingly.
+  int32_t batch_size = 1024;
+  /// Whether to use the global CPU thread pool to format columns in parallel
+  bool use_threads = true;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
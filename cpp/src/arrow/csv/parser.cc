@@ -19,12 +19,20 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 
+#if defined(ARROW_HAVE_AVX2)
+#include <immintrin.h>
+#elif defined(ARROW_HAVE_SSE4_2)
+#include <emmintrin.h>
+#endif
+
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -81,7 +89,7 @@ class BlockParser::PresizedParsedWriter {
  public:
   PresizedParsedWriter(MemoryPool* pool, uint32_t size)
       : parsed_size_(0), parsed_capacity_(size) {
-    parsed_buffer_ = *AllocateResizableBuffer(parsed_capacity_, pool);
+    parsed_buffer_ = *AllocateResizableBuffer(parsed_capacity_ + kCopyPadding, pool);
     parsed_ = parsed_buffer_->mutable_data();
   }
 
@@ -97,12 +105,27 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push nbytes from data; the source may be read up to data_end.
+  void PushFieldChars(const char* data, int64_t nbytes, const char* data_end) {
+    DCHECK_LE(parsed_size_ + nbytes, parsed_capacity_);
+    if (nbytes <= kCopyPadding && data_end - data >= kCopyPadding) {
+      // Fields are often short: a fixed-size copy is much cheaper than a
+      // variable-size one, and the excess bytes are overwritten later.
+      memcpy(parsed_ + parsed_size_, data, kCopyPadding);
+    } else {
+      memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(nbytes));
+    }
+    parsed_size_ += nbytes;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
   int64_t size() { return parsed_size_; }
 
  protected:
+  static constexpr int64_t kCopyPadding = 16;
+
   std::shared_ptr<ResizableBuffer> parsed_buffer_;
   uint8_t* parsed_;
   int64_t parsed_size_;
@@ -212,12 +235,182 @@ class BlockParser::PresizedValuesWriter {
   int64_t saved_values_size_;
 };
 
+// A helper class locating the bytes that are significant to the parsing state
+// machine ("structural" bytes), so that the runs of ordinary bytes in between
+// can be skipped over and copied in bulk.
+//
+// The data is scanned 64 bytes at a time, computing bitmasks of the
+// structural bytes' positions with SIMD comparisons where available.
+// Unlike in JSON, quote regions cannot be derived from the quote positions
+// alone (a quote is only significant at the start of a field), so no
+// prefix-XOR masking is done: instead, two bitmasks are computed for each
+// block, one for unquoted field contents (delimiter, CR, LF, escape) and one
+// for quoted field contents (quote, escape), and the state machine queries
+// the one matching its current state.
+class BlockParser::StructuralScanner {
+ public:
+  static constexpr int64_t kBlockSize = 64;
+
+  StructuralScanner(const ParseOptions& options, bool quoting, bool escaping)
+      : quoting_(quoting), escaping_(escaping), options_(options) {
+    memset(scalar_flags_, 0, sizeof(scalar_flags_));
+    scalar_flags_[static_cast<uint8_t>('\r')] |= kFieldFlag;
+    scalar_flags_[static_cast<uint8_t>('\n')] |= kFieldFlag;
+    scalar_flags_[static_cast<uint8_t>(options.delimiter)] |= kFieldFlag;
+    if (quoting) {
+      scalar_flags_[static_cast<uint8_t>(options.quote_char)] |= kQuotedFlag;
+    }
+    if (escaping) {
+      scalar_flags_[static_cast<uint8_t>(options.escape_char)] |=
+          kFieldFlag | kQuotedFlag;
+    }
+  }
+
+  // Return the first byte in [data, data_end) that is structural in an unquoted
+  // field, or data_end if there is none.
+  const char* NextInField(const char* data, const char* data_end) {
+    return Next<false>(data, data_end);
+  }
+
+  // Return the first byte in [data, data_end) that is structural in a quoted
+  // field, or data_end if there is none.
+  const char* NextInQuotedField(const char* data, const char* data_end) {
+    return Next<true>(data, data_end);
+  }
+
+ protected:
+  static constexpr uint8_t kFieldFlag = 1;
+  static constexpr uint8_t kQuotedFlag = 2;
+
+#if defined(ARROW_HAVE_AVX2) || defined(ARROW_HAVE_SSE4_2)
+  template <bool Quoted>
+  const char* Next(const char* data, const char* data_end) {
+    // Fast path: the current block has a structural byte at or after data
+    if (ARROW_PREDICT_TRUE(data >= block_start_ && data < block_end_)) {
+      const uint64_t mask = BlockMask<Quoted>() >> (data - block_start_);
+      if (ARROW_PREDICT_TRUE(mask != 0)) {
+        return data + BitUtil::CountTrailingZeros(mask);
+      }
+      data = block_end_;
+    }
+    return NextInNewBlocks<Quoted>(data, data_end);
+  }
+
+  template <bool Quoted>
+  ARROW_NOINLINE const char* NextInNewBlocks(const char* data, const char* data_end) {
+    while (data < data_end) {
+      ScanBlock(data, data_end);
+      const uint64_t mask = BlockMask<Quoted>();
+      if (mask != 0) {
+        return data + BitUtil::CountTrailingZeros(mask);
+      }
+      data = block_end_;
+    }
+    return data_end;
+  }
+
+  template <bool Quoted>
+  uint64_t BlockMask() const {
+    return Quoted ? quoted_mask_ : field_mask_;
+  }
+
+  void ScanBlock(const char* data, const char* data_end) {
+    block_start_ = data;
+    if (data_end - data >= kBlockSize) {
+      block_end_ = data + kBlockSize;
+      ScanFullBlock(data);
+    } else {
+      block_end_ = data_end;
+      ScanPartialBlock(data, data_end - data);
+    }
+  }
+
+  void ScanPartialBlock(const char* data, int64_t nbytes) {
+    field_mask_ = quoted_mask_ = 0;
+    for (int64_t i = 0; i < nbytes; ++i) {
+      const uint64_t flags = scalar_flags_[static_cast<uint8_t>(data[i])];
+      field_mask_ |= (flags & kFieldFlag) << i;
+      quoted_mask_ |= ((flags & kQuotedFlag) >> 1) << i;
+    }
+  }
+
+  template <typename MatchFunc>
+  void ComputeMasks(MatchFunc&& match) {
+    field_mask_ = match('\r') | match('\n') | match(options_.delimiter);
+    quoted_mask_ = quoting_ ? match(options_.quote_char) : 0;
+    if (escaping_) {
+      const uint64_t escape_mask = match(options_.escape_char);
+      field_mask_ |= escape_mask;
+      quoted_mask_ |= escape_mask;
+    }
+  }
+
+#if defined(ARROW_HAVE_AVX2)
+  void ScanFullBlock(const char* data) {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    auto match = [&](char c) -> uint64_t {
+      const __m256i needle = _mm256_set1_epi8(c);
+      const uint64_t lo_mask =
+          static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+      const uint64_t hi_mask =
+          static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+      return lo_mask | (hi_mask << 32);
+    };
+    ComputeMasks(match);
+  }
+#elif defined(ARROW_HAVE_SSE4_2)
+  void ScanFullBlock(const char* data) {
+    __m128i chunks[4];
+    for (int i = 0; i < 4; ++i) {
+      chunks[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i));
+    }
+    auto match = [&](char c) -> uint64_t {
+      const __m128i needle = _mm_set1_epi8(c);
+      uint64_t mask = 0;
+      for (int i = 0; i < 4; ++i) {
+        const uint64_t chunk_mask =
+            static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunks[i], needle)));
+        mask |= chunk_mask << (16 * i);
+      }
+      return mask;
+    };
+    ComputeMasks(match);
+  }
+#endif
+
+#else
+  // Without SIMD, building the bitmasks doesn't pay off: scan byte by byte
+  template <bool Quoted>
+  const char* Next(const char* data, const char* data_end) {
+    const uint8_t flag = Quoted ? kQuotedFlag : kFieldFlag;
+    while (data < data_end && !(scalar_flags_[static_cast<uint8_t>(*data)] & flag)) {
+      ++data;
+    }
+    return data;
+  }
+#endif
+
+  const bool quoting_;
+  const bool escaping_;
+  const ParseOptions& options_;
+  uint8_t scalar_flags_[256];
+  // The current block and its bitmasks
+  const char* block_start_ = nullptr;
+  const char* block_end_ = nullptr;
+  uint64_t field_mask_ = 0;
+  uint64_t quoted_mask_ = 0;
+};
+
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                              const char* data, const char* data_end, bool is_final,
+                              StructuralScanner* scanner, const char* data,
+                              const char* data_end, bool is_final,
                               const char** out_data) {
   int32_t num_cols = 0;
   char c;
+  const bool select_columns = !selected_columns_.empty();
+  const auto num_selectable_cols = static_cast<int32_t>(selected_columns_.size());
 
   DCHECK_GT(data_end, data);
 
@@ -246,6 +439,10 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
 FieldStart:
   // At the start of a field
+  if (select_columns &&
+      (num_cols >= num_selectable_cols || !selected_columns_[num_cols])) {
+    goto SkippedFieldStart;
+  }
   // Quoting is only recognized at start of field
   if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
     ++data;
@@ -258,6 +455,12 @@ FieldStart:
 
 InField:
   // Inside a non-quoted part of a field
+  {
+    // Copy the ordinary bytes up to the next structural byte in one go
+    const char* next = scanner->NextInField(data, data_end);
+    parsed_writer->PushFieldChars(data, next - data, data_end);
+    data = next;
+  }
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -290,6 +493,11 @@ InField:
 
 InQuotedField:
   // Inside a quoted part of a field
+  {
+    const char* next = scanner->NextInQuotedField(data, data_end);
+    parsed_writer->PushFieldChars(data, next - data, data_end);
+    data = next;
+  }
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -315,6 +523,72 @@ InQuotedField:
   parsed_writer->PushFieldChar(c);
   goto InQuotedField;
 
+SkippedFieldStart:
+  // At the start of a field in an unselected column: the field is delimited
+  // but its contents are not copied
+  if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
+    ++data;
+    values_writer->StartField(true /* quoted */);
+    goto InSkippedQuotedField;
+  } else {
+    values_writer->StartField(false /* quoted */);
+    goto InSkippedField;
+  }
+
+InSkippedField:
+  // Inside a non-quoted part of an unselected field
+  data = scanner->NextInField(data, data_end);
+  if (ARROW_PREDICT_FALSE(data == data_end)) {
+    goto AbortLine;
+  }
+  c = *data++;
+  if (SpecializedOptions::escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
+    ++data;
+    goto InSkippedField;
+  }
+  if (ARROW_PREDICT_FALSE(c == options_.delimiter)) {
+    goto FieldEnd;
+  }
+  if (c == '\r') {
+    if (ARROW_PREDICT_TRUE(data < data_end) && *data == '\n') {
+      data++;
+    }
+    goto LineEnd;
+  }
+  if (c == '\n') {
+    goto LineEnd;
+  }
+  goto InSkippedField;
+
+InSkippedQuotedField:
+  // Inside a quoted part of an unselected field
+  data = scanner->NextInQuotedField(data, data_end);
+  if (ARROW_PREDICT_FALSE(data == data_end)) {
+    goto AbortLine;
+  }
+  c = *data++;
+  if (SpecializedOptions::escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
+    ++data;
+    goto InSkippedQuotedField;
+  }
+  if (ARROW_PREDICT_FALSE(c == options_.quote_char)) {
+    if (options_.double_quote && ARROW_PREDICT_TRUE(data < data_end) &&
+        ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
+      // Double-quoting
+      ++data;
+    } else {
+      // End of single-quoting
+      goto InSkippedField;
+    }
+  }
+  goto InSkippedQuotedField;
+
 FieldEnd:
   // At the end of a field
   FinishField();
@@ -377,15 +651,16 @@ EmptyLine:
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                               const char* data, const char* data_end, bool is_final,
+                               StructuralScanner* scanner, const char* data,
+                               const char* data_end, bool is_final,
                                int32_t rows_in_chunk, const char** out_data,
                                bool* finished_parsing) {
   int32_t num_rows_deadline = num_rows_ + rows_in_chunk;
 
   while (data < data_end && num_rows_ < num_rows_deadline) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, scanner,
+                                                data, data_end, is_final, &line_end));
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -429,6 +704,8 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
     const char* data = view.data();
     const char* data_end = view.data() + view.length();
     bool finished_parsing = false;
+    StructuralScanner scanner(options_, SpecializedOptions::quoting,
+                              SpecializedOptions::escaping);
 
     if (num_cols_ == -1) {
       // Can't presize values when the number of columns is not known, first parse
@@ -437,9 +714,9 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       ResizableValuesWriter values_writer(pool_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+          &values_writer, &parsed_writer, &scanner, data, data_end, is_final,
+          rows_in_chunk, &data, &finished_parsing));
       if (num_cols_ == -1) {
         return ParseError("Empty CSV file or block: cannot infer number of columns");
       }
@@ -462,9 +739,9 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+          &values_writer, &parsed_writer, &scanner, data, data_end, is_final,
+          rows_in_chunk, &data, &finished_parsing));
     }
     DCHECK_GE(data, view.data());
     DCHECK_LE(data, data_end);
@@ -547,6 +824,21 @@ BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_col
       num_cols_(num_cols),
       max_num_rows_(max_num_rows) {}
 
+void BlockParser::SelectColumns(const std::vector<int32_t>& col_indices) {
+  selected_columns_.clear();
+  for (const auto col_index : col_indices) {
+    DCHECK_GE(col_index, 0);
+    if (static_cast<size_t>(col_index) >= selected_columns_.size()) {
+      selected_columns_.resize(col_index + 1, 0);
+    }
+    selected_columns_[col_index] = 1;
+  }
+  // An empty vector selects all columns, make sure it isn't mistaken for that
+  if (selected_columns_.empty()) {
+    selected_columns_.push_back(0);
+  }
+}
+
 BlockParser::BlockParser(ParseOptions options, int32_t num_cols, int32_t max_num_rows)
     : BlockParser(default_memory_pool(), options, num_cols, max_num_rows) {}
 
@@ -85,6 +85,13 @@ class ARROW_EXPORT BlockParser {
   /// Only the last block is allowed to be truncated.
   Status ParseFinal(const std::vector<util::string_view>& data, uint32_t* out_size);
 
+  /// \brief Restrict parsing to the given columns
+  ///
+  /// Fields in other columns are still delimited, so that the number of
+  /// columns can be checked, but their contents are not copied: they are
+  /// visited as empty values.  By default, all columns are parsed.
+  void SelectColumns(const std::vector<int32_t>& col_indices);
+
   /// \brief Return the number of parsed rows
   int32_t num_rows() const { return num_rows_; }
   /// \brief Return the number of parsed columns
@@ -137,16 +144,19 @@ class ARROW_EXPORT BlockParser {
   Status DoParseSpecialized(const std::vector<util::string_view>& data, bool is_final,
                             uint32_t* out_size);
 
+  class StructuralScanner;
+
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
   Status ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                    const char* data, const char* data_end, bool is_final,
-                    int32_t rows_in_chunk, const char** out_data, bool* finished_parsing);
+                    StructuralScanner* scanner, const char* data, const char* data_end,
+                    bool is_final, int32_t rows_in_chunk, const char** out_data,
+                    bool* finished_parsing);
 
   // Parse a single line from the data pointer
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
   Status ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                   const char* data, const char* data_end, bool is_final,
-                   const char** out_data);
+                   StructuralScanner* scanner, const char* data, const char* data_end,
+                   bool is_final, const char** out_data);
 
   MemoryPool* pool_;
   const ParseOptions options_;
@@ -156,6 +166,8 @@ class ARROW_EXPORT BlockParser {
   int32_t num_cols_;
   // The maximum number of rows to parse from this block
   int32_t max_num_rows_;
+  // Whether each column is parsed (empty if all columns are)
+  std::vector<uint8_t> selected_columns_;
 
   // Linear scratchpad for parsed values
   struct ValueDesc {
@@ -34,6 +34,9 @@ namespace csv {
 // >> For a static/global string constant, use a C style string instead
 const char* one_row = "abc,\"d,f\",12.34,\n";
 const char* one_row_escaped = "abc,d\\,f,12.34,\n";
+const char* one_row_long =
+    "12345,\"The quick brown fox jumps over the lazy dog, again and again\","
+    "some unquoted text spanning a few dozen bytes,3.14159265\n";
 
 const auto num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row));
 
@@ -130,6 +133,16 @@ static void ParseCSVQuotedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void ParseCSVLongFieldsBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_long, num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
 static void ParseCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const reference
   auto csv = BuildCSVData(one_row_escaped, num_rows);
   auto options = ParseOptions::Defaults();
@@ -144,6 +157,7 @@ BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
+BENCHMARK(ParseCSVLongFieldsBlock);
 
 }  // namespace csv
 }  // namespace arrow
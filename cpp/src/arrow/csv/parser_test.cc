@@ -605,6 +605,41 @@ TEST(BlockParser, LotsOfColumns) {
   AssertParseOk(parser, MakeLotsOfCsvColumns(1024 * 100));
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several scanning blocks, with special characters at
+  // varying positions
+  for (bool escaping : {false, true}) {
+    auto options = ParseOptions::Defaults();
+    options.escaping = escaping;
+
+    std::string csv;
+    std::vector<std::string> col1, col2, col3;
+    for (int i = 0; i < 150; ++i) {
+      std::string unquoted(i, static_cast<char>('a' + i % 26));
+      std::string raw_unquoted = unquoted;
+      if (escaping && i > 0) {
+        unquoted.insert(i / 2, ",");
+        raw_unquoted.insert(i / 2, "\\,");
+      }
+      std::string quoted(150 - i, 'b');
+      std::string raw_quoted = quoted;
+      const size_t pos = (i * 7) % quoted.size();
+      const char* special[] = {",", "\n", "\""};
+      quoted.insert(pos, special[i % 3]);
+      raw_quoted.insert(pos, i % 3 == 2 ? "\"\"" : special[i % 3]);
+
+      csv += raw_unquoted + ",\"" + raw_quoted + "\"," + std::to_string(i);
+      csv += (i % 2) ? "\r\n" : "\n";
+      col1.push_back(unquoted);
+      col2.push_back(quoted);
+      col3.push_back(std::to_string(i));
+    }
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {col1, col2, col3});
+  }
+}
+
 TEST(BlockParser, QuotedEscape) {
   auto options = ParseOptions::Defaults();
   options.escaping = true;
@@ -623,5 +658,36 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, SelectColumns) {
+  auto csv = MakeCSVData({"ab,\"c,d\",ef,gh\n", "\"i\"\"j\",k,\"l\nm\",n\n", "o,p,q,r"});
+  {
+    BlockParser parser(ParseOptions::Defaults());
+    parser.SelectColumns({1, 3});
+    AssertParseFinal(parser, csv);
+    AssertColumnsEq(parser,
+                    {{"", "", ""}, {"c,d", "k", "p"}, {"", "", ""}, {"gh", "n", "r"}},
+                    {{false, true, false},
+                     {true, false, false},
+                     {false, true, false},
+                     {false, false, false}} /* quoted */);
+  }
+  {
+    // Number of columns is still checked
+    uint32_t out_size;
+    BlockParser parser(ParseOptions::Defaults());
+    parser.SelectColumns({0});
+    auto csv = MakeCSVData({"a,b\nc,\"d,e\",f\n"});
+    ASSERT_RAISES(Invalid, Parse(parser, csv, &out_size));
+  }
+  {
+    auto options = ParseOptions::Defaults();
+    options.escaping = true;
+    BlockParser parser(options);
+    parser.SelectColumns({});
+    AssertParseOk(parser, MakeCSVData({"a\\,b,\"c\\\"d\"\n"}));
+    AssertColumnsEq(parser, {{""}, {""}}, {{false}, {true}} /* quoted */);
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -17,8 +17,10 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -33,6 +35,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
@@ -42,6 +45,7 @@
 #include "arrow/util/macros.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "arrow/util/utf8.h"
 
 namespace arrow {
@@ -59,24 +63,224 @@ namespace csv {
 using internal::GetCpuThreadPool;
 using internal::ThreadPool;
 
+/////////////////////////////////////////////////////////////////////////
+// Byte range support
+
+// An iterator restricting a stream of CSV blocks to the rows starting in a
+// byte range.  A row boundary is the end of the first line separator at or
+// after the byte preceding a range bound, so that consecutive ranges yield
+// each row exactly once.
+class ByteRangeIterator {
+ public:
+  // `first` (if non-null) is returned before the `source` blocks, `pos` is the
+  // input offset of the first byte returned, and `end` the input offset of the
+  // range end (or -1).  If `seek_start` is true, the data up to the first line
+  // separator belongs to a row starting before the range, and is skipped.
+  ByteRangeIterator(std::shared_ptr<Buffer> first, Iterator<std::shared_ptr<Buffer>> source,
+                    int64_t pos, bool seek_start, int64_t end)
+      : first_(std::move(first)),
+        source_(std::move(source)),
+        pos_(pos),
+        end_(end),
+        seeking_start_(seek_start) {}
+
+  Result<std::shared_ptr<Buffer>> Next() {
+    while (!done_) {
+      std::shared_ptr<Buffer> buf;
+      if (first_) {
+        buf = std::move(first_);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(buf, source_.Next());
+        if (buf == nullptr) {
+          break;
+        }
+      }
+      const int64_t buf_pos = pos_;
+      pos_ += buf->size();
+      const auto data = reinterpret_cast<const char*>(buf->data());
+      int64_t begin = 0;
+      int64_t stop = buf->size();
+
+      if (skip_lf_) {
+        // Skip the LF of a CRLF separator that straddles two blocks
+        skip_lf_ = false;
+        if (stop > 0 && data[0] == '\n') {
+          ++begin;
+        }
+      }
+      if (seeking_start_) {
+        const int64_t sep = FindSeparator(data, begin, stop);
+        if (sep == stop) {
+          continue;
+        }
+        seeking_start_ = false;
+        begin = sep + 1;
+        if (data[sep] == '\r') {
+          if (begin == stop) {
+            skip_lf_ = true;
+          } else if (data[begin] == '\n') {
+            ++begin;
+          }
+        }
+        if (end_ >= 0 && buf_pos + begin >= end_) {
+          // The first row starting after the range start is past the range end
+          break;
+        }
+      }
+      if (end_ >= 0) {
+        // Rows starting after the byte preceding `end_` are not in the range
+        const int64_t search_from = std::max(begin, end_ - 1 - buf_pos);
+        const int64_t sep = FindSeparator(data, search_from, stop);
+        if (sep < stop) {
+          stop = sep + 1;
+          done_ = true;
+        }
+      }
+      if (stop > begin) {
+        return SliceBuffer(buf, begin, stop - begin);
+      }
+    }
+    done_ = true;
+    return nullptr;
+  }
+
+ protected:
+  static int64_t FindSeparator(const char* data, int64_t pos, int64_t size) {
+    while (pos < size && data[pos] != '\r' && data[pos] != '\n') {
+      ++pos;
+    }
+    return pos;
+  }
+
+  std::shared_ptr<Buffer> first_;
+  Iterator<std::shared_ptr<Buffer>> source_;
+  int64_t pos_;
+  const int64_t end_;
+  bool seeking_start_;
+  bool skip_lf_ = false;
+  bool done_ = false;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
-class BaseTableReader : public csv::TableReader {
+class ReaderMixin {
  public:
-  BaseTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
-                  const ReadOptions& read_options, const ParseOptions& parse_options,
-                  const ConvertOptions& convert_options)
+  ReaderMixin(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+              const ReadOptions& read_options, const ParseOptions& parse_options,
+              const ConvertOptions& convert_options)
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
         convert_options_(convert_options),
         input_(std::move(input)) {}
 
-  virtual Status Init() = 0;
-
  protected:
+  // Description of a column to be produced by the reader
+  struct ConversionColumn {
+    std::string name;
+    // Physical column index in CSV file, or -1 if the column is missing
+    int32_t index;
+    // If set, convert the CSV column to this type.  If unset (and the column
+    // is not missing), infer the type from the CSV column.
+    std::shared_ptr<DataType> type;
+  };
+
+  bool HasByteRange() const {
+    return read_options_.range_start > 0 || read_options_.range_end >= 0;
+  }
+
+  // Create the iterator of input blocks, reading ahead up to `readahead` blocks
+  Status MakeBlockIterator(int32_t readahead) {
+    if (HasByteRange()) {
+      if (read_options_.range_start < 0 ||
+          (read_options_.range_end >= 0 &&
+           read_options_.range_end < read_options_.range_start)) {
+        return Status::Invalid("Invalid CSV byte range [", read_options_.range_start,
+                               ", ", read_options_.range_end, ")");
+      }
+      if (parse_options_.newlines_in_values) {
+        return Status::Invalid(
+            "CSV byte ranges are not supported with newlines_in_values");
+      }
+    }
+    readahead_ = readahead;
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+    if (HasByteRange()) {
+      // Don't read ahead until the input is positioned at the range start
+      // (see ApplyByteRange)
+      return Status::OK();
+    }
+    return MakeReadaheadIterator(std::move(block_iterator_), readahead_)
+        .Value(&block_iterator_);
+  }
+
+  // Restrict the data after the header to the requested byte range.  `rest`
+  // is the remainder of the first block and is replaced with the first block
+  // of data in the range.
+  Status ApplyByteRange(std::shared_ptr<Buffer>* rest) {
+    if (!HasByteRange()) {
+      return Status::OK();
+    }
+    // Input offset of the first row after the header
+    int64_t pos = first_block_size_ - (*rest)->size();
+    std::shared_ptr<Buffer> first = *rest;
+    bool seek_start = false;
+
+    if (read_options_.range_start > pos) {
+      // Look for a row boundary starting from the byte preceding the range start
+      const int64_t seek_pos = read_options_.range_start - 1;
+      seek_start = true;
+      if (seek_pos < first_block_size_) {
+        first = SliceBuffer(first, seek_pos - pos);
+      } else {
+        first.reset();
+        RETURN_NOT_OK(SkipInput(seek_pos - first_block_size_));
+      }
+      pos = seek_pos;
+    }
+    if (read_options_.range_end >= 0 && read_options_.range_end <= pos && !seek_start) {
+      // The range ends before the first row
+      *rest = std::make_shared<Buffer>("");
+      block_iterator_ = MakeEmptyIterator<std::shared_ptr<Buffer>>();
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          MakeReadaheadIterator(std::move(block_iterator_), readahead_));
+    block_iterator_ = Iterator<std::shared_ptr<Buffer>>(
+        ByteRangeIterator(std::move(first), std::move(block_iterator_), pos, seek_start,
+                          read_options_.range_end));
+    ARROW_ASSIGN_OR_RAISE(*rest, block_iterator_.Next());
+    if (*rest == nullptr) {
+      *rest = std::make_shared<Buffer>("");
+    }
+    return Status::OK();
+  }
+
+  // Skip bytes from the input stream, seeking if possible
+  Status SkipInput(int64_t nbytes) {
+    auto file = std::dynamic_pointer_cast<io::RandomAccessFile>(input_);
+    if (file) {
+      ARROW_ASSIGN_OR_RAISE(auto position, file->Tell());
+      return file->Seek(position + nbytes);
+    }
+    while (nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto buf, input_->Read(std::min<int64_t>(nbytes, read_options_.block_size)));
+      if (buf->size() == 0) {
+        break;
+      }
+      nbytes -= buf->size();
+    }
+    return Status::OK();
+  }
+
   Status ReadNextBlock(bool first_block, std::shared_ptr<Buffer>* out) {
+    ARROW_TRACE_SPAN("csv::ReadBlock");
     ARROW_ASSIGN_OR_RAISE(auto buf, block_iterator_.Next());
     if (buf == nullptr) {
       // EOF
@@ -86,6 +290,7 @@ class BaseTableReader : public csv::TableReader {
 
     int64_t offset = 0;
     if (first_block) {
+      first_block_size_ = buf->size();
       ARROW_ASSIGN_OR_RAISE(auto data, util::SkipUTF8BOM(buf->data(), buf->size()));
       offset += data - buf->data();
       DCHECK_GE(offset, 0);
@@ -112,7 +317,7 @@ class BaseTableReader : public csv::TableReader {
 
   Status ReadFirstBlock(std::shared_ptr<Buffer>* out) { return ReadNextBlock(true, out); }
 
-  // Read header and column names from buffer, create column builders
+  // Read header and column names from buffer, describe columns to produce
   Status ProcessHeader(const std::shared_ptr<Buffer>& buf,
                        std::shared_ptr<Buffer>* rest) {
     const uint8_t* data = buf->data();
@@ -169,26 +374,53 @@ class BaseTableReader : public csv::TableReader {
     DCHECK_GT(num_csv_cols_, 0);
 
     if (convert_options_.include_columns.empty()) {
-      return MakeColumnBuilders();
+      RETURN_NOT_OK(MakeConversionColumns());
     } else {
-      return MakeColumnBuilders(convert_options_.include_columns);
+      RETURN_NOT_OK(MakeConversionColumns(convert_options_.include_columns));
+    }
+    RETURN_NOT_OK(ApplyByteRange(rest));
+    return MakeInferenceSample(*rest);
+  }
+
+  // Parse the leading rows of the CSV data, to guess the types of inferred
+  // columns before converting any block
+  Status MakeInferenceSample(const std::shared_ptr<Buffer>& data) {
+    inference_sample_.reset();
+    if (convert_options_.inference_sample_rows <= 0) {
+      return Status::OK();
     }
+    bool any_inferred = false;
+    for (const auto& column : conversion_columns_) {
+      any_inferred |= (column.index >= 0 && column.type == nullptr);
+    }
+    if (!any_inferred) {
+      return Status::OK();
+    }
+    auto parser = std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_,
+                                                convert_options_.inference_sample_rows);
+    SelectColumns(parser.get());
+    uint32_t parsed_size = 0;
+    RETURN_NOT_OK(parser->Parse(util::string_view(*data), &parsed_size));
+    inference_sample_ = std::move(parser);
+    return Status::OK();
   }
 
-  // Make column builders, assuming inclusion of all columns in CSV file order
-  Status MakeColumnBuilders() {
+  std::shared_ptr<DataType> GetFixedType(const std::string& col_name) {
+    auto it = convert_options_.column_types.find(col_name);
+    return it == convert_options_.column_types.end() ? nullptr : it->second;
+  }
+
+  // Describe columns, assuming inclusion of all columns in CSV file order
+  Status MakeConversionColumns() {
     for (int32_t col_index = 0; col_index < num_csv_cols_; ++col_index) {
       const auto& col_name = column_names_[col_index];
-
-      ARROW_ASSIGN_OR_RAISE(auto builder, MakeCSVColumnBuilder(col_name, col_index));
-      column_builders_.push_back(builder);
-      builder_names_.push_back(col_name);
+      conversion_columns_.push_back({col_name, col_index, GetFixedType(col_name)});
     }
     return Status::OK();
   }
 
-  // Make column builders, assuming inclusion of columns in `include_columns` order
-  Status MakeColumnBuilders(const std::vector<std::string>& include_columns) {
+  // Describe columns, assuming inclusion of columns in `include_columns` order
+  Status MakeConversionColumns(const std::vector<std::string>& include_columns) {
     // Compute indices of columns in the CSV file
     std::unordered_map<std::string, int32_t> col_indices;
     col_indices.reserve(column_names_.size());
@@ -196,54 +428,62 @@ class BaseTableReader : public csv::TableReader {
       col_indices.emplace(column_names_[i], i);
     }
 
-    // For each column name in include_columns, build the corresponding ColumnBuilder
     for (const auto& col_name : include_columns) {
-      std::shared_ptr<ColumnBuilder> builder;
       auto it = col_indices.find(col_name);
       if (it != col_indices.end()) {
-        auto col_index = it->second;
-        ARROW_ASSIGN_OR_RAISE(builder, MakeCSVColumnBuilder(col_name, col_index));
+        conversion_columns_.push_back({col_name, it->second, GetFixedType(col_name)});
       } else {
         // Column not in the CSV file
         if (convert_options_.include_missing_columns) {
-          ARROW_ASSIGN_OR_RAISE(builder, MakeNullColumnBuilder(col_name));
+          // If the named column has a fixed type, use it, otherwise use null()
+          auto type = GetFixedType(col_name);
+          conversion_columns_.push_back({col_name, -1, type ? type : null()});
         } else {
           return Status::KeyError("Column '", col_name,
                                   "' in include_columns "
                                   "does not exist in CSV file");
         }
       }
-      column_builders_.push_back(builder);
-      builder_names_.push_back(col_name);
     }
     return Status::OK();
   }
 
-  // Make a column builder for the given CSV column name and index
-  Result<std::shared_ptr<ColumnBuilder>> MakeCSVColumnBuilder(const std::string& col_name,
-                                                              int32_t col_index) {
-    // Does the named column have a fixed type?
-    auto it = convert_options_.column_types.find(col_name);
-    if (it == convert_options_.column_types.end()) {
-      return ColumnBuilder::Make(pool_, col_index, convert_options_, task_group_);
-    } else {
-      return ColumnBuilder::Make(pool_, it->second, col_index, convert_options_,
-                                 task_group_);
+  // Let the parser skip over the contents of columns that are not converted
+  void SelectColumns(BlockParser* parser) {
+    if (convert_options_.include_columns.empty()) {
+      return;
+    }
+    std::vector<int32_t> col_indices;
+    for (const auto& column : conversion_columns_) {
+      if (column.index >= 0) {
+        col_indices.push_back(column.index);
+      }
     }
+    parser->SelectColumns(col_indices);
   }
 
-  // Make a column builder for a column of nulls
-  Result<std::shared_ptr<ColumnBuilder>> MakeNullColumnBuilder(
-      const std::string& col_name) {
-    std::shared_ptr<DataType> type;
-    // If the named column have a fixed type, use it, otherwise use null()
-    auto it = convert_options_.column_types.find(col_name);
-    if (it != convert_options_.column_types.end()) {
-      type = it->second;
-    } else {
-      type = null();
+  // Make one column builder per conversion column, attached to the given TaskGroup
+  Result<std::vector<std::shared_ptr<ColumnBuilder>>> MakeColumnBuilders(
+      const std::shared_ptr<internal::TaskGroup>& task_group) {
+    std::vector<std::shared_ptr<ColumnBuilder>> builders;
+    builders.reserve(conversion_columns_.size());
+    for (const auto& column : conversion_columns_) {
+      std::shared_ptr<ColumnBuilder> builder;
+      if (column.index < 0) {
+        ARROW_ASSIGN_OR_RAISE(builder,
+                              ColumnBuilder::MakeNull(pool_, column.type, task_group));
+      } else if (column.type != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(
+            builder, ColumnBuilder::Make(pool_, column.type, column.index,
+                                         convert_options_, task_group));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            builder, ColumnBuilder::Make(pool_, column.index, convert_options_,
+                                         task_group, inference_sample_.get()));
+      }
+      builders.push_back(std::move(builder));
     }
-    return ColumnBuilder::MakeNull(pool_, type, task_group_);
+    return builders;
   }
 
   std::vector<std::string> GenerateColumnNames(int32_t num_cols) {
@@ -257,13 +497,16 @@ class BaseTableReader : public csv::TableReader {
     return res;
   }
 
-  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
-                        const std::shared_ptr<Buffer>& completion,
-                        const std::shared_ptr<Buffer>& block, int64_t block_index,
-                        bool is_final, uint32_t* out_parsed_size = nullptr) {
+  Result<std::shared_ptr<BlockParser>> Parse(const std::shared_ptr<Buffer>& partial,
+                                             const std::shared_ptr<Buffer>& completion,
+                                             const std::shared_ptr<Buffer>& block,
+                                             bool is_final,
+                                             uint32_t* out_parsed_size = nullptr) {
+    ARROW_TRACE_SPAN("csv::ParseBlock");
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
     auto parser =
         std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
+    SelectColumns(parser.get());
 
     std::shared_ptr<Buffer> straddling;
     std::vector<util::string_view> views;
@@ -289,6 +532,58 @@ class BaseTableReader : public csv::TableReader {
     if (out_parsed_size) {
       *out_parsed_size = parsed_size;
     }
+    return parser;
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+
+  // Number of columns in the CSV file
+  int32_t num_csv_cols_ = -1;
+  // Column names in the CSV file
+  std::vector<std::string> column_names_;
+  // Columns to produce (not necessarily in CSV file order)
+  std::vector<ConversionColumn> conversion_columns_;
+  // Leading rows of the CSV data, if up-front type inference is enabled
+  std::shared_ptr<BlockParser> inference_sample_;
+
+  std::shared_ptr<io::InputStream> input_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  int32_t readahead_ = 1;
+  // Size of the first block read from the input
+  int64_t first_block_size_ = 0;
+
+  // Whether there was a trailing CR at the end of last parsed line
+  bool trailing_cr_ = false;
+};
+
+/////////////////////////////////////////////////////////////////////////
+// Base class for TableReader implementations
+
+class BaseTableReader : public ReaderMixin, public csv::TableReader {
+ public:
+  using ReaderMixin::ReaderMixin;
+
+  virtual Status Init() = 0;
+
+ protected:
+  // Read header and column names from buffer, create column builders
+  Status ProcessHeader(const std::shared_ptr<Buffer>& buf,
+                       std::shared_ptr<Buffer>* rest) {
+    RETURN_NOT_OK(ReaderMixin::ProcessHeader(buf, rest));
+    RETURN_NOT_OK(MakeColumnBuilders(task_group_).Value(&column_builders_));
+    inference_sample_.reset();
+    return Status::OK();
+  }
+
+  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
+                        const std::shared_ptr<Buffer>& completion,
+                        const std::shared_ptr<Buffer>& block, int64_t block_index,
+                        bool is_final, uint32_t* out_parsed_size = nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto parser,
+                          Parse(partial, completion, block, is_final, out_parsed_size));
     return ProcessData(parser, block_index);
   }
 
@@ -301,39 +596,22 @@ class BaseTableReader : public csv::TableReader {
   }
 
   Result<std::shared_ptr<Table>> MakeTable() {
-    DCHECK_EQ(column_builders_.size(), builder_names_.size());
+    DCHECK_EQ(column_builders_.size(), conversion_columns_.size());
 
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<ChunkedArray>> columns;
 
-    for (int32_t i = 0; i < static_cast<int32_t>(builder_names_.size()); ++i) {
+    for (int32_t i = 0; i < static_cast<int32_t>(column_builders_.size()); ++i) {
       ARROW_ASSIGN_OR_RAISE(auto array, column_builders_[i]->Finish());
-      fields.push_back(::arrow::field(builder_names_[i], array->type()));
+      fields.push_back(::arrow::field(conversion_columns_[i].name, array->type()));
       columns.emplace_back(std::move(array));
     }
     return Table::Make(schema(fields), columns);
   }
 
-  MemoryPool* pool_;
-  ReadOptions read_options_;
-  ParseOptions parse_options_;
-  ConvertOptions convert_options_;
-
-  // Number of columns in the CSV file
-  int32_t num_csv_cols_ = -1;
-  // Column names in the CSV file
-  std::vector<std::string> column_names_;
-  // Column builders for target Table (not necessarily in CSV file order)
+  // Column builders for target Table (in conversion_columns_ order)
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
-  // Names of columns, in same order as column_builders_
-  std::vector<std::string> builder_names_;
-
-  std::shared_ptr<io::InputStream> input_;
-  Iterator<std::shared_ptr<Buffer>> block_iterator_;
   std::shared_ptr<internal::TaskGroup> task_group_;
-
-  // Whether there was a trailing CR at the end of last parsed line
-  bool trailing_cr_ = false;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -344,13 +622,8 @@ class SerialTableReader : public BaseTableReader {
   using BaseTableReader::BaseTableReader;
 
   Status Init() override {
-    ARROW_ASSIGN_OR_RAISE(block_iterator_,
-                          io::MakeInputStreamIterator(input_, read_options_.block_size));
-
     // Since we're converting serially, no need to readahead more than one block
-    int32_t block_queue_size = 1;
-    return MakeReadaheadIterator(std::move(block_iterator_), block_queue_size)
-        .Value(&block_iterator_);
+    return MakeBlockIterator(1);
   }
 
   Result<std::shared_ptr<Table>> Read() override {
@@ -422,14 +695,7 @@ class ThreadedTableReader : public BaseTableReader {
     }
   }
 
-  Status Init() override {
-    ARROW_ASSIGN_OR_RAISE(block_iterator_,
-                          io::MakeInputStreamIterator(input_, read_options_.block_size));
-
-    int32_t block_queue_size = thread_pool_->GetCapacity();
-    return MakeReadaheadIterator(std::move(block_iterator_), block_queue_size)
-        .Value(&block_iterator_);
-  }
+  Status Init() override { return MakeBlockIterator(thread_pool_->GetCapacity()); }
 
   Result<std::shared_ptr<Table>> Read() override {
     task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
@@ -486,6 +752,173 @@ class ThreadedTableReader : public BaseTableReader {
   ThreadPool* thread_pool_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader implementation
+
+class StreamingReaderImpl : public ReaderMixin, public csv::StreamingReader {
+ public:
+  // If `thread_pool` is null, blocks are parsed and converted serially
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      const ReadOptions& read_options, const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : ReaderMixin(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool),
+        max_pending_blocks_(thread_pool ? std::max(1, thread_pool->GetCapacity()) : 1) {}
+
+  ~StreamingReaderImpl() override {
+    // In case of error or early destruction, make sure all pending tasks
+    // are finished before we start destroying members
+    for (auto& pending : pending_blocks_) {
+      ARROW_UNUSED(pending.task_group->Finish());
+    }
+  }
+
+  Status Init() {
+    RETURN_NOT_OK(MakeBlockIterator(max_pending_blocks_));
+
+    // Read first block and process header serially
+    RETURN_NOT_OK(ReadFirstBlock(&block_));
+    if (!block_) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(block_, &block_));
+    chunker_ = MakeChunker(parse_options_);
+    partial_ = std::make_shared<Buffer>("");
+
+    // Convert the first block with type inference, then freeze the inferred
+    // types so that the following blocks can be converted independently
+    // (skipping leading blocks without any rows, which wouldn't infer anything)
+    do {
+      RETURN_NOT_OK(LaunchNextBlock());
+      ARROW_ASSIGN_OR_RAISE(first_batch_, FinishNextBlock());
+    } while (first_batch_->num_rows() == 0 && block_);
+    inference_sample_.reset();
+    schema_ = first_batch_->schema();
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      conversion_columns_[i].type = schema_->field(i)->type();
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    while (true) {
+      // Keep the pipeline full, so that conversion of the following blocks
+      // overlaps with consumption of the current one
+      while (block_ && static_cast<int>(pending_blocks_.size()) < max_pending_blocks_) {
+        RETURN_NOT_OK(LaunchNextBlock());
+      }
+      std::shared_ptr<RecordBatch> next;
+      if (first_batch_) {
+        next = std::move(first_batch_);
+      } else if (pending_blocks_.empty()) {
+        // EOF
+        batch->reset();
+        return Status::OK();
+      } else {
+        ARROW_ASSIGN_OR_RAISE(next, FinishNextBlock());
+      }
+      // Don't bother returning empty batches (e.g. a block of empty lines)
+      if (next->num_rows() > 0) {
+        *batch = std::move(next);
+        return Status::OK();
+      }
+    }
+  }
+
+ protected:
+  // A block whose parsing and conversion has been spawned
+  struct PendingBlock {
+    std::shared_ptr<internal::TaskGroup> task_group;
+    std::vector<std::shared_ptr<ColumnBuilder>> builders;
+  };
+
+  std::shared_ptr<internal::TaskGroup> MakeTaskGroup() const {
+    if (thread_pool_) {
+      return internal::TaskGroup::MakeThreaded(thread_pool_);
+    } else {
+      return internal::TaskGroup::MakeSerial();
+    }
+  }
+
+  // Chunk the current block and spawn tasks to parse and convert it
+  Status LaunchNextBlock() {
+    DCHECK_NE(block_, nullptr);
+    std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
+
+    ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+    bool is_final = (next_block == nullptr);
+
+    if (is_final) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &completion,
+                                                 &starts_with_whole));
+
+      // Get a complete CSV block inside `partial + block`, and keep
+      // the rest for the next iteration.
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+
+    PendingBlock pending;
+    pending.task_group = MakeTaskGroup();
+    ARROW_ASSIGN_OR_RAISE(pending.builders, MakeColumnBuilders(pending.task_group));
+
+    // Each block gets its own builders, so it is always block #0 for them
+    auto builders = pending.builders;
+    auto partial = partial_;
+    pending.task_group->Append([this, builders, partial, completion, whole, is_final] {
+      ARROW_ASSIGN_OR_RAISE(auto parser, Parse(partial, completion, whole, is_final));
+      for (auto& builder : builders) {
+        builder->Insert(0, parser);
+      }
+      return Status::OK();
+    });
+    pending_blocks_.push_back(std::move(pending));
+
+    partial_ = next_partial;
+    block_ = next_block;
+    return Status::OK();
+  }
+
+  // Wait for the oldest pending block and turn it into a RecordBatch
+  Result<std::shared_ptr<RecordBatch>> FinishNextBlock() {
+    DCHECK(!pending_blocks_.empty());
+    auto pending = std::move(pending_blocks_.front());
+    pending_blocks_.pop_front();
+    RETURN_NOT_OK(pending.task_group->Finish());
+
+    DCHECK_EQ(pending.builders.size(), conversion_columns_.size());
+    std::vector<std::shared_ptr<Field>> fields;
+    ArrayVector arrays;
+    for (size_t i = 0; i < pending.builders.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto chunked, pending.builders[i]->Finish());
+      DCHECK_EQ(chunked->num_chunks(), 1);
+      fields.push_back(::arrow::field(conversion_columns_[i].name, chunked->type()));
+      arrays.push_back(chunked->chunk(0));
+    }
+    const int64_t num_rows = arrays.empty() ? 0 : arrays[0]->length();
+    auto batch_schema = schema_ ? schema_ : ::arrow::schema(std::move(fields));
+    return RecordBatch::Make(std::move(batch_schema), num_rows, std::move(arrays));
+  }
+
+  ThreadPool* thread_pool_;
+  const int max_pending_blocks_;
+
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<Chunker> chunker_;
+  // The next block to chunk, and the unparsed tail of the previous one
+  std::shared_ptr<Buffer> block_;
+  std::shared_ptr<Buffer> partial_;
+  std::deque<PendingBlock> pending_blocks_;
+  // Result of type inference over the first block, not yet consumed
+  std::shared_ptr<RecordBatch> first_batch_;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // TableReader factory function
 
@@ -505,5 +938,16 @@ Result<std::shared_ptr<TableReader>> TableReader::Make(
   return reader;
 }
 
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options) {
+  auto reader = std::make_shared<StreamingReaderImpl>(
+      pool, input, read_options, parse_options, convert_options,
+      read_options.use_threads ? GetCpuThreadPool() : nullptr);
+  RETURN_NOT_OK(reader->Init());
+  return reader;
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -47,5 +48,31 @@ class ARROW_EXPORT TableReader {
                                                    const ConvertOptions&);
 };
 
+/// \brief A class that reads a CSV file incrementally
+///
+/// Only a bounded number of blocks (of `ReadOptions::block_size` bytes each)
+/// are held in memory at any time, so arbitrarily large files can be read
+/// in constant memory.  If `ReadOptions::use_threads` is true, several
+/// blocks are parsed and converted in parallel ahead of the consumer.
+///
+/// Each call to ReadNext() returns the contents of one CSV block.
+///
+/// Caveat: column types are inferred from the first block and then frozen.
+/// If a later block contains values that do not fit those types, ReadNext()
+/// returns an error.  To make sure the right data types are inferred, either
+/// set `ReadOptions::block_size` to a large enough value, or use
+/// `ConvertOptions::column_types` to set the desired data types explicitly.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  /// Create a StreamingReader instance
+  ///
+  /// This involves reading, parsing and converting the first block, so as
+  /// to determine the schema.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+      const ReadOptions& read_options, const ParseOptions& parse_options,
+      const ConvertOptions& convert_options);
+};
+
 }  // namespace csv
 }  // namespace arrow
@@ -0,0 +1,225 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/test_common.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+std::shared_ptr<io::InputStream> MakeInput(std::vector<std::string> lines) {
+  return std::make_shared<io::BufferReader>(Buffer::FromString(MakeCSVData(lines)));
+}
+
+Result<std::shared_ptr<StreamingReader>> MakeStreamingReader(
+    std::vector<std::string> lines, bool use_threads, int32_t block_size,
+    const ConvertOptions& convert_options = ConvertOptions::Defaults()) {
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = use_threads;
+  read_options.block_size = block_size;
+  return StreamingReader::Make(default_memory_pool(), MakeInput(std::move(lines)),
+                               read_options, ParseOptions::Defaults(), convert_options);
+}
+
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ protected:
+  bool use_threads() const { return GetParam(); }
+};
+
+TEST_P(StreamingReaderTest, Basics) {
+  std::vector<std::string> lines = {"i,s\n", "1,ab\n", "2,cd\n", "3,\n",
+                                    "4,ef\n", "5,gh\n", "6,ij\n"};
+  // Small blocks => several batches
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeStreamingReader(lines, use_threads(), 12));
+  auto expected_schema = schema({field("i", int64()), field("s", utf8())});
+  AssertSchemaEqual(*reader->schema(), *expected_schema);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_GT(batches.size(), 1);
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_GT(batch->num_rows(), 0);
+  }
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(batches));
+  ASSERT_OK_AND_ASSIGN(actual, actual->CombineChunks());
+  auto expected = TableFromJSON(expected_schema, {R"([{"i": 1, "s": "ab"},
+                                                      {"i": 2, "s": "cd"},
+                                                      {"i": 3, "s": ""},
+                                                      {"i": 4, "s": "ef"},
+                                                      {"i": 5, "s": "gh"},
+                                                      {"i": 6, "s": "ij"}])"});
+  AssertTablesEqual(*expected, *actual);
+
+  // End of stream is sticky
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, SingleBlock) {
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       MakeStreamingReader({"a,b\n", "1,2\n"}, use_threads(), 1 << 20));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(batch, nullptr);
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(schema({field("a", int64()), field("b", int64())}),
+                           R"([{"a": 1, "b": 2}])"),
+      *batch);
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, HeaderOnly) {
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeStreamingReader({"a,b\n"}, use_threads(), 12));
+  AssertSchemaEqual(*reader->schema(), *schema({field("a", null()), field("b", null())}));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, Empty) {
+  ASSERT_RAISES(Invalid, MakeStreamingReader({}, use_threads(), 12));
+}
+
+TEST_P(StreamingReaderTest, TypesFrozenAfterFirstBlock) {
+  std::vector<std::string> lines = {"a\n", "1\n", "2\n", "3\n", "4\n",
+                                    "5\n", "6\n", "7\n", "xyz\n"};
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeStreamingReader(lines, use_threads(), 6));
+  AssertSchemaEqual(*reader->schema(), *schema({field("a", int64())}));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_RAISES(Invalid, reader->ReadAll(&batches));
+
+  // Explicit column types bypass inference
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.column_types["a"] = utf8();
+  ASSERT_OK_AND_ASSIGN(reader,
+                       MakeStreamingReader(lines, use_threads(), 6, convert_options));
+  batches.clear();
+  ASSERT_OK(reader->ReadAll(&batches));
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*batch->schema(), *schema({field("a", utf8())}));
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 8);
+}
+
+TEST_P(StreamingReaderTest, IncludeColumns) {
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.include_columns = {"b", "z"};
+  convert_options.include_missing_columns = true;
+  std::vector<std::string> lines = {"a,b\n", "1,2\n", "3,4\n", "5,6\n", "7,8\n"};
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       MakeStreamingReader(lines, use_threads(), 8, convert_options));
+  auto expected_schema = schema({field("b", int64()), field("z", null())});
+  AssertSchemaEqual(*reader->schema(), *expected_schema);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(batches));
+  ASSERT_OK_AND_ASSIGN(actual, actual->CombineChunks());
+  auto expected = TableFromJSON(expected_schema, {R"([{"b": 2}, {"b": 4},
+                                                      {"b": 6}, {"b": 8}])"});
+  AssertTablesEqual(*expected, *actual);
+}
+
+INSTANTIATE_TEST_SUITE_P(SerialStreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false));
+INSTANTIATE_TEST_SUITE_P(ThreadedStreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(true));
+
+class ByteRangeTest : public ::testing::TestWithParam<bool> {
+ protected:
+  Result<std::shared_ptr<Table>> ReadRange(const std::string& csv, int64_t start,
+                                           int64_t end, int32_t block_size) {
+    auto read_options = ReadOptions::Defaults();
+    read_options.use_threads = GetParam();
+    read_options.block_size = block_size;
+    read_options.range_start = start;
+    read_options.range_end = end;
+    auto convert_options = ConvertOptions::Defaults();
+    convert_options.column_types = {{"a", int64()}, {"b", utf8()}};
+    auto input = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader, TableReader::Make(default_memory_pool(), input, read_options,
+                                       ParseOptions::Defaults(), convert_options));
+    return reader->Read();
+  }
+};
+
+TEST_P(ByteRangeTest, ConsecutiveRanges) {
+  // Various line separators, quoted delimiters, an empty line, no trailing newline
+  const std::string csv =
+      "a,b\n1,\"x,y\"\r\n22,\"\"\n\n333,z\r4444,w\r\n55555,\"v\"\n6,u";
+  const auto csv_size = static_cast<int64_t>(csv.size());
+
+  for (int32_t block_size : {16, 1 << 20}) {
+    ASSERT_OK_AND_ASSIGN(auto expected, ReadRange(csv, 0, -1, block_size));
+    ASSERT_EQ(expected->num_rows(), 6);
+
+    for (int64_t range_size : {1, 2, 3, 5, 8, 13, 100}) {
+      std::vector<std::shared_ptr<Table>> tables;
+      for (int64_t start = 0; start < csv_size; start += range_size) {
+        ASSERT_OK_AND_ASSIGN(auto table,
+                             ReadRange(csv, start, start + range_size, block_size));
+        ASSERT_OK(table->ValidateFull());
+        tables.push_back(std::move(table));
+      }
+      ASSERT_OK_AND_ASSIGN(auto actual, ConcatenateTables(tables));
+      AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    }
+
+    // Open-ended range
+    ASSERT_OK_AND_ASSIGN(auto actual, ReadRange(csv, 13, -1, block_size));
+    ASSERT_EQ(actual->num_rows(), 5);
+  }
+}
+
+TEST_P(ByteRangeTest, Errors) {
+  const std::string csv = "a,b\n1,x\n";
+  ASSERT_RAISES(Invalid, ReadRange(csv, -1, 3, 16));
+  ASSERT_RAISES(Invalid, ReadRange(csv, 5, 3, 16));
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.range_start = 4;
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.newlines_in_values = true;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+  ASSERT_RAISES(Invalid, TableReader::Make(default_memory_pool(), input, read_options,
+                                           parse_options, ConvertOptions::Defaults()));
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteRangeTest, ByteRangeTest, ::testing::Values(false, true));
+
+}  // namespace csv
+}  // namespace arrow
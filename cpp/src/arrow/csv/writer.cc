@@ -0,0 +1,531 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/vendored/datetime.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::TaskGroup;
+
+namespace csv {
+
+namespace {
+
+// The formatted values of a column slice, stored contiguously
+class FormattedValues {
+ public:
+  explicit FormattedValues(MemoryPool* pool) : data_(pool), offsets_(1, 0) {}
+
+  // Clear the values, keeping the allocated memory
+  void Reset() {
+    data_.Rewind(0);
+    offsets_.resize(1);
+  }
+
+  Status Append(util::string_view value) {
+    return data_.Append(value.data(), static_cast<int64_t>(value.size()));
+  }
+
+  // Append the value between quotes, doubling the quotes it contains
+  Status AppendQuoted(util::string_view value) {
+    RETURN_NOT_OK(data_.Reserve(static_cast<int64_t>(value.size()) + 2));
+    data_.UnsafeAppend(1, '"');
+    size_t pos = 0;
+    for (size_t quote; (quote = value.find('"', pos)) != util::string_view::npos;
+         pos = quote + 1) {
+      RETURN_NOT_OK(Append(value.substr(pos, quote + 1 - pos)));
+      RETURN_NOT_OK(data_.Append(1, '"'));
+    }
+    RETURN_NOT_OK(Append(value.substr(pos)));
+    return data_.Append(1, '"');
+  }
+
+  // Terminate the current value
+  void FinishValue() { offsets_.push_back(data_.length()); }
+
+  int64_t num_values() const { return static_cast<int64_t>(offsets_.size()) - 1; }
+  int64_t num_bytes() const { return data_.length(); }
+
+  const uint8_t* value_data(int64_t i) const { return data_.data() + offsets_[i]; }
+  int64_t value_length(int64_t i) const { return offsets_[i + 1] - offsets_[i]; }
+
+  util::string_view value(int64_t i) const {
+    return util::string_view(reinterpret_cast<const char*>(value_data(i)),
+                             static_cast<size_t>(value_length(i)));
+  }
+
+ protected:
+  BufferBuilder data_;
+  std::vector<int64_t> offsets_;
+};
+
+// Formats arrays of a given type, nulls being formatted as empty values
+class ColumnFormatter {
+ public:
+  virtual ~ColumnFormatter() = default;
+
+  virtual Status Format(const Array& array, FormattedValues* out) = 0;
+};
+
+Result<std::unique_ptr<ColumnFormatter>> MakeColumnFormatter(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool);
+
+class NullFormatter : public ColumnFormatter {
+ public:
+  Status Format(const Array& array, FormattedValues* out) override {
+    for (int64_t i = 0; i < array.length(); ++i) {
+      out->FinishValue();
+    }
+    return Status::OK();
+  }
+};
+
+// Booleans and numbers, using the fast formatting routines also used by casts
+template <typename T>
+class PrimitiveFormatter : public ColumnFormatter {
+ public:
+  explicit PrimitiveFormatter(const std::shared_ptr<DataType>& type)
+      : formatter_(type) {}
+
+  Status Format(const Array& array, FormattedValues* out) override {
+    const auto& typed_array = checked_cast<const ArrayType&>(array);
+    auto append = [out](util::string_view formatted) { return out->Append(formatted); };
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (typed_array.IsValid(i)) {
+        RETURN_NOT_OK(formatter_(typed_array.Value(i), append));
+      }
+      out->FinishValue();
+    }
+    return Status::OK();
+  }
+
+ protected:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  internal::StringFormatter<T> formatter_;
+};
+
+template <typename T>
+class BinaryFormatter : public ColumnFormatter {
+ public:
+  Status Format(const Array& array, FormattedValues* out) override {
+    const auto& typed_array = checked_cast<const ArrayType&>(array);
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (typed_array.IsValid(i)) {
+        RETURN_NOT_OK(out->AppendQuoted(typed_array.GetView(i)));
+      }
+      out->FinishValue();
+    }
+    return Status::OK();
+  }
+
+ protected:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+};
+
+class DecimalFormatter : public ColumnFormatter {
+ public:
+  Status Format(const Array& array, FormattedValues* out) override {
+    const auto& typed_array = checked_cast<const Decimal128Array&>(array);
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (typed_array.IsValid(i)) {
+        RETURN_NOT_OK(out->Append(typed_array.FormatValue(i)));
+      }
+      out->FinishValue();
+    }
+    return Status::OK();
+  }
+};
+
+// Dates, times and timestamps, in ISO 8601 format (as in PrettyPrint)
+template <typename CType, typename Unit>
+class TemporalFormatter : public ColumnFormatter {
+ public:
+  TemporalFormatter(const char* format, bool since_epoch)
+      : format_(format), since_epoch_(since_epoch) {}
+
+  Status Format(const Array& array, FormattedValues* out) override {
+    using arrow_vendored::date::format;
+    static const arrow_vendored::date::sys_days epoch{arrow_vendored::date::jan / 1 /
+                                                      1970};
+    const CType* values = array.data()->GetValues<CType>(1);
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsValid(i)) {
+        const Unit value{values[i]};
+        RETURN_NOT_OK(out->Append(since_epoch_ ? format(format_, epoch + value)
+                                               : format(format_, value)));
+      }
+      out->FinishValue();
+    }
+    return Status::OK();
+  }
+
+ protected:
+  const char* format_;
+  const bool since_epoch_;
+};
+
+template <typename CType>
+std::unique_ptr<ColumnFormatter> MakeTemporalFormatter(TimeUnit::type unit,
+                                                       const char* format,
+                                                       bool since_epoch) {
+  switch (unit) {
+    case TimeUnit::SECOND:
+      return std::unique_ptr<ColumnFormatter>(
+          new TemporalFormatter<CType, std::chrono::seconds>(format, since_epoch));
+    case TimeUnit::MILLI:
+      return std::unique_ptr<ColumnFormatter>(
+          new TemporalFormatter<CType, std::chrono::milliseconds>(format, since_epoch));
+    case TimeUnit::MICRO:
+      return std::unique_ptr<ColumnFormatter>(
+          new TemporalFormatter<CType, std::chrono::microseconds>(format, since_epoch));
+    case TimeUnit::NANO:
+    default:
+      return std::unique_ptr<ColumnFormatter>(
+          new TemporalFormatter<CType, std::chrono::nanoseconds>(format, since_epoch));
+  }
+}
+
+// Formats the dictionary values once per distinct dictionary, then copies
+// them for each index
+class DictionaryFormatter : public ColumnFormatter {
+ public:
+  DictionaryFormatter(std::unique_ptr<ColumnFormatter> value_formatter,
+                      MemoryPool* pool)
+      : value_formatter_(std::move(value_formatter)), dictionary_values_(pool) {}
+
+  Status Format(const Array& array, FormattedValues* out) override {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(array);
+    auto dictionary = dict_array.dictionary();
+    if (dictionary != dictionary_) {
+      dictionary_values_.Reset();
+      RETURN_NOT_OK(value_formatter_->Format(*dictionary, &dictionary_values_));
+      dictionary_ = std::move(dictionary);
+    }
+
+    const auto& indices = *dict_array.indices();
+    switch (indices.type_id()) {
+      case Type::INT8:
+        return FormatIndices<Int8Type>(indices, out);
+      case Type::INT16:
+        return FormatIndices<Int16Type>(indices, out);
+      case Type::INT32:
+        return FormatIndices<Int32Type>(indices, out);
+      case Type::INT64:
+        return FormatIndices<Int64Type>(indices, out);
+      case Type::UINT8:
+        return FormatIndices<UInt8Type>(indices, out);
+      case Type::UINT16:
+        return FormatIndices<UInt16Type>(indices, out);
+      case Type::UINT32:
+        return FormatIndices<UInt32Type>(indices, out);
+      case Type::UINT64:
+        return FormatIndices<UInt64Type>(indices, out);
+      default:
+        return Status::TypeError("Invalid dictionary index type: ", *indices.type());
+    }
+  }
+
+ protected:
+  template <typename IndexType>
+  Status FormatIndices(const Array& indices, FormattedValues* out) {
+    const auto& typed_indices = checked_cast<const NumericArray<IndexType>&>(indices);
+    for (int64_t i = 0; i < indices.length(); ++i) {
+      if (typed_indices.IsValid(i)) {
+        RETURN_NOT_OK(out->Append(
+            dictionary_values_.value(static_cast<int64_t>(typed_indices.Value(i)))));
+      }
+      out->FinishValue();
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<ColumnFormatter> value_formatter_;
+  std::shared_ptr<Array> dictionary_;
+  FormattedValues dictionary_values_;
+};
+
+struct ColumnFormatterMaker {
+  Status Visit(const NullType&) {
+    out.reset(new NullFormatter());
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    out.reset(new PrimitiveFormatter<BooleanType>(type));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_integer<T, Status> Visit(const T&) {
+    out.reset(new PrimitiveFormatter<T>(type));
+    return Status::OK();
+  }
+
+  Status Visit(const FloatType&) {
+    out.reset(new PrimitiveFormatter<FloatType>(type));
+    return Status::OK();
+  }
+
+  Status Visit(const DoubleType&) {
+    out.reset(new PrimitiveFormatter<DoubleType>(type));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    out.reset(new BinaryFormatter<T>());
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryType&) {
+    out.reset(new BinaryFormatter<FixedSizeBinaryType>());
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal128Type&) {
+    out.reset(new DecimalFormatter());
+    return Status::OK();
+  }
+
+  Status Visit(const Date32Type&) {
+    out.reset(new TemporalFormatter<int32_t, arrow_vendored::date::days>("%F", true));
+    return Status::OK();
+  }
+
+  Status Visit(const Date64Type&) {
+    out.reset(new TemporalFormatter<int64_t, std::chrono::milliseconds>("%F", true));
+    return Status::OK();
+  }
+
+  Status Visit(const Time32Type& time_type) {
+    out = MakeTemporalFormatter<int32_t>(time_type.unit(), "%T", false);
+    return Status::OK();
+  }
+
+  Status Visit(const Time64Type& time_type) {
+    out = MakeTemporalFormatter<int64_t>(time_type.unit(), "%T", false);
+    return Status::OK();
+  }
+
+  Status Visit(const TimestampType& timestamp_type) {
+    out = MakeTemporalFormatter<int64_t>(timestamp_type.unit(), "%F %T", true);
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& dict_type) {
+    ARROW_ASSIGN_OR_RAISE(auto value_formatter,
+                          MakeColumnFormatter(dict_type.value_type(), pool));
+    out.reset(new DictionaryFormatter(std::move(value_formatter), pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("Unsupported data type for CSV writing: ", *type);
+  }
+
+  std::shared_ptr<DataType> type;
+  MemoryPool* pool;
+  std::unique_ptr<ColumnFormatter> out;
+};
+
+Result<std::unique_ptr<ColumnFormatter>> MakeColumnFormatter(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool) {
+  ColumnFormatterMaker maker{type, pool, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(*type, &maker));
+  return std::move(maker.out);
+}
+
+class StreamingWriterImpl : public StreamingWriter {
+ public:
+  StreamingWriterImpl(MemoryPool* pool, io::OutputStream* output,
+                      std::shared_ptr<Schema> schema, const WriteOptions& options)
+      : pool_(pool), output_(output), schema_(std::move(schema)), options_(options) {}
+
+  Status Init() {
+    if (options_.batch_size <= 0) {
+      return Status::Invalid("WriteOptions: batch_size must be strictly positive");
+    }
+    for (const auto& field : schema_->fields()) {
+      ARROW_ASSIGN_OR_RAISE(auto formatter, MakeColumnFormatter(field->type(), pool_));
+      formatters_.push_back(std::move(formatter));
+      column_values_.emplace_back(pool_);
+    }
+    if (options_.include_header) {
+      return WriteHeader();
+    }
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (closed_) {
+      return Status::Invalid("Cannot write to a closed CSV writer");
+    }
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Record batch schema does not match CSV writer schema");
+    }
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length =
+          std::min<int64_t>(options_.batch_size, batch.num_rows() - offset);
+      RETURN_NOT_OK(WriteRows(batch, offset, length));
+    }
+    return Status::OK();
+  }
+
+  Status WriteTable(const Table& table) override {
+    TableBatchReader reader(table);
+    reader.set_chunksize(options_.batch_size);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(WriteRecordBatch(*batch));
+    }
+  }
+
+  Status Close() override {
+    closed_ = true;
+    return Status::OK();
+  }
+
+ protected:
+  Status WriteHeader() {
+    FormattedValues names(pool_);
+    for (const auto& field : schema_->fields()) {
+      RETURN_NOT_OK(names.AppendQuoted(field->name()));
+      names.FinishValue();
+    }
+    std::string header;
+    for (int64_t i = 0; i < names.num_values(); ++i) {
+      if (i > 0) {
+        header += options_.delimiter;
+      }
+      header.append(names.value(i).data(), names.value(i).size());
+    }
+    header += '\n';
+    return output_->Write(header.data(), static_cast<int64_t>(header.size()));
+  }
+
+  // Write rows [offset, offset + length) of the batch
+  Status WriteRows(const RecordBatch& batch, int64_t offset, int64_t length) {
+    const int num_columns = batch.num_columns();
+
+    // Format each column separately, in parallel if possible
+    auto task_group = options_.use_threads && num_columns > 1
+                          ? TaskGroup::MakeThreaded(GetCpuThreadPool())
+                          : TaskGroup::MakeSerial();
+    for (int i = 0; i < num_columns; ++i) {
+      auto column = batch.column(i)->Slice(offset, length);
+      task_group->Append([this, i, column] {
+        column_values_[i].Reset();
+        return formatters_[i]->Format(*column, &column_values_[i]);
+      });
+    }
+    RETURN_NOT_OK(task_group->Finish());
+
+    // Assemble the rows in a buffer of the exact final size: each value is
+    // followed by either a delimiter or a line separator
+    int64_t output_size = length * std::max(num_columns, 1);
+    for (const auto& values : column_values_) {
+      DCHECK_EQ(values.num_values(), length);
+      output_size += values.num_bytes();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(output_size, pool_));
+    uint8_t* out = buffer->mutable_data();
+    for (int64_t row = 0; row < length; ++row) {
+      for (int i = 0; i < num_columns; ++i) {
+        const auto& values = column_values_[i];
+        const int64_t value_length = values.value_length(row);
+        memcpy(out, values.value_data(row), static_cast<size_t>(value_length));
+        out += value_length;
+        *out++ = static_cast<uint8_t>(i + 1 < num_columns ? options_.delimiter : '\n');
+      }
+      if (num_columns == 0) {
+        *out++ = '\n';
+      }
+    }
+    DCHECK_EQ(out, buffer->data() + output_size);
+    return output_->Write(std::move(buffer));
+  }
+
+  MemoryPool* pool_;
+  io::OutputStream* output_;
+  std::shared_ptr<Schema> schema_;
+  const WriteOptions options_;
+  std::vector<std::unique_ptr<ColumnFormatter>> formatters_;
+  std::vector<FormattedValues> column_values_;
+  bool closed_ = false;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<StreamingWriter>> StreamingWriter::Make(
+    MemoryPool* pool, io::OutputStream* output, std::shared_ptr<Schema> schema,
+    const WriteOptions& options) {
+  auto writer =
+      std::make_shared<StreamingWriterImpl>(pool, output, std::move(schema), options);
+  RETURN_NOT_OK(writer->Init());
+  return writer;
+}
+
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        StreamingWriter::Make(pool, output, table.schema(), options));
+  RETURN_NOT_OK(writer->WriteTable(table));
+  return writer->Close();
+}
+
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        StreamingWriter::Make(pool, output, batch.schema(), options));
+  RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+  return writer->Close();
+}
+
+}  // namespace csv
+}  // namespace arrow
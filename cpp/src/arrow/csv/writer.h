@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+/// \brief A class that writes CSV data incrementally, a record batch at a time
+///
+/// Each batch of up to `WriteOptions::batch_size` rows is formatted column by
+/// column (in parallel if `WriteOptions::use_threads` is true), then the rows
+/// are assembled in a single buffer and written out.
+///
+/// Null values are written as empty fields.  String and binary values are
+/// always quoted, so that empty values can be told apart from nulls.
+/// Nested types are not supported.
+class ARROW_EXPORT StreamingWriter {
+ public:
+  virtual ~StreamingWriter() = default;
+
+  /// \brief Write a record batch, which must have the writer's schema
+  virtual Status WriteRecordBatch(const RecordBatch& batch) = 0;
+
+  /// \brief Write a table, which must have the writer's schema
+  virtual Status WriteTable(const Table& table) = 0;
+
+  /// \brief Finish writing
+  ///
+  /// The output stream is not closed.
+  virtual Status Close() = 0;
+
+  /// Create a StreamingWriter instance
+  ///
+  /// The header line, if any, is written immediately.  The output stream
+  /// must outlive the writer.
+  static Result<std::shared_ptr<StreamingWriter>> Make(
+      MemoryPool* pool, io::OutputStream* output, std::shared_ptr<Schema> schema,
+      const WriteOptions& options);
+};
+
+/// \brief Write a table as CSV to the output stream
+///
+/// The output stream is not closed.
+ARROW_EXPORT
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+/// \brief Write a record batch as CSV to the output stream
+///
+/// The output stream is not closed.
+ARROW_EXPORT
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
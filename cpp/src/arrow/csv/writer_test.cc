@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+class WriterTest : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    options_ = WriteOptions::Defaults();
+    options_.use_threads = GetParam();
+  }
+
+  std::string WriteBatch(const RecordBatch& batch) {
+    auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+    ARROW_EXPECT_OK(WriteCSV(batch, options_, default_memory_pool(), out.get()));
+    return (*out->Finish())->ToString();
+  }
+
+  std::string WriteTable(const Table& table) {
+    auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+    ARROW_EXPECT_OK(WriteCSV(table, options_, default_memory_pool(), out.get()));
+    return (*out->Finish())->ToString();
+  }
+
+  WriteOptions options_;
+};
+
+TEST_P(WriterTest, Basics) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("i", int32()), field("s", utf8()), field("b", boolean()),
+              field("f", float64())}),
+      R"([[1, "ab", true, 1.5],
+          [null, "", false, null],
+          [-3, null, null, -0.25]])");
+  ASSERT_EQ(WriteBatch(*batch),
+            "\"i\",\"s\",\"b\",\"f\"\n"
+            "1,\"ab\",true,1.5\n"
+            ",\"\",false,\n"
+            "-3,,,-0.25\n");
+
+  options_.include_header = false;
+  options_.delimiter = ';';
+  ASSERT_EQ(WriteBatch(*batch),
+            "1;\"ab\";true;1.5\n"
+            ";\"\";false;\n"
+            "-3;;;-0.25\n");
+}
+
+TEST_P(WriterTest, Quoting) {
+  auto batch = RecordBatchFromJSON(schema({field("a\"b", utf8()), field("c", binary())}),
+                                   R"([["x\"y\"", "a,b\nc"], ["\"", "\"\""]])");
+  ASSERT_EQ(WriteBatch(*batch),
+            "\"a\"\"b\",\"c\"\n"
+            "\"x\"\"y\"\"\",\"a,b\nc\"\n"
+            "\"\"\"\",\"\"\"\"\"\"\n");
+}
+
+TEST_P(WriterTest, Temporal) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("d", date32()), field("t", time32(TimeUnit::SECOND)),
+              field("ts", timestamp(TimeUnit::SECOND))}),
+      R"([[0, 3723, 86401], [18000, null, null]])");
+  ASSERT_EQ(WriteBatch(*batch),
+            "\"d\",\"t\",\"ts\"\n"
+            "1970-01-01,01:02:03,1970-01-02 00:00:01\n"
+            "2019-04-14,,\n");
+}
+
+TEST_P(WriterTest, Dictionary) {
+  auto dict_type = dictionary(int8(), utf8());
+  auto array = DictArrayFromJSON(dict_type, "[1, 0, null, 1]", R"(["a", "b"])");
+  auto batch = RecordBatch::Make(schema({field("d", dict_type)}), 4, {array});
+  ASSERT_EQ(WriteBatch(*batch), "\"d\"\n\"b\"\n\"a\"\n\n\"b\"\n");
+}
+
+TEST_P(WriterTest, BatchSize) {
+  auto table = TableFromJSON(schema({field("i", int64()), field("s", utf8())}),
+                             {R"([[1, "a"], [2, "b"], [3, "c"]])", R"([[4, "d"]])"});
+  const std::string expected =
+      "\"i\",\"s\"\n1,\"a\"\n2,\"b\"\n3,\"c\"\n4,\"d\"\n";
+  for (int32_t batch_size : {1, 2, 3, 1000}) {
+    options_.batch_size = batch_size;
+    ASSERT_EQ(WriteTable(*table), expected);
+  }
+}
+
+TEST_P(WriterTest, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create(1024));
+
+  // Unsupported type
+  ASSERT_RAISES(NotImplemented,
+                StreamingWriter::Make(default_memory_pool(), out.get(),
+                                      schema({field("l", list(int32()))}), options_));
+
+  // Invalid options
+  auto options = options_;
+  options.batch_size = 0;
+  ASSERT_RAISES(Invalid, StreamingWriter::Make(default_memory_pool(), out.get(),
+                                               schema({field("i", int32())}), options));
+
+  // Schema mismatch
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       StreamingWriter::Make(default_memory_pool(), out.get(),
+                                             schema({field("i", int32())}), options_));
+  auto batch = RecordBatchFromJSON(schema({field("i", int64())}), "[[1]]");
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+
+  // Closed writer
+  ASSERT_OK(writer->Close());
+  batch = RecordBatchFromJSON(schema({field("i", int32())}), "[[1]]");
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+}
+
+INSTANTIATE_TEST_SUITE_P(WriterTest, WriterTest, ::testing::Values(false, true));
+
+}  // namespace csv
+}  // namespace arrow
@@ -37,6 +37,10 @@ const std::shared_ptr<Schema>& Fragment::schema() const {
   return scan_options_->schema();
 }
 
+Result<util::optional<int64_t>> Fragment::CountRows(std::shared_ptr<ScanContext>) {
+  return util::nullopt;
+}
+
 InMemoryFragment::InMemoryFragment(RecordBatchVector record_batches,
                                    std::shared_ptr<ScanOptions> scan_options)
     : Fragment(std::move(scan_options)), record_batches_(std::move(record_batches)) {}
@@ -63,6 +67,19 @@ Result<ScanTaskIterator> InMemoryFragment::Scan(std::shared_ptr<ScanContext> con
   return MakeMapIterator(fn, std::move(batches_it));
 }
 
+Result<util::optional<int64_t>> InMemoryFragment::CountRows(
+    std::shared_ptr<ScanContext>) {
+  if (!scan_options_->filter->Equals(true)) {
+    return util::nullopt;
+  }
+
+  int64_t num_rows = 0;
+  for (const auto& batch : record_batches_) {
+    num_rows += batch->num_rows();
+  }
+  return num_rows;
+}
+
 Result<std::shared_ptr<ScannerBuilder>> Dataset::NewScan(
     std::shared_ptr<ScanContext> context) {
   return std::make_shared<ScannerBuilder>(this->shared_from_this(), context);
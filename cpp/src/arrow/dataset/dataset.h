@@ -26,6 +26,7 @@
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/optional.h"
 
 namespace arrow {
 namespace dataset {
@@ -48,6 +49,13 @@ class ARROW_DS_EXPORT Fragment {
   /// To receive a record batch stream which is fully filtered and projected, use Scanner.
   virtual Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) = 0;
 
+  /// \brief Count the rows of this Fragment which satisfy its filter without scanning
+  /// them, e.g. from file metadata.
+  ///
+  /// Return nullopt if the count isn't available this way, in which case the Fragment
+  /// must be scanned. The default implementation always does.
+  virtual Result<util::optional<int64_t>> CountRows(std::shared_ptr<ScanContext> context);
+
   /// \brief Return true if the fragment can benefit from parallel scanning.
   virtual bool splittable() const = 0;
 
@@ -92,6 +100,9 @@ class ARROW_DS_EXPORT InMemoryFragment : public Fragment {
 
   Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override;
 
+  Result<util::optional<int64_t>> CountRows(
+      std::shared_ptr<ScanContext> context) override;
+
   bool splittable() const override { return false; }
 
   std::string type_name() const override { return "in-memory"; }
@@ -344,6 +344,53 @@ TEST(TestProjector, NonTrivial) {
   AssertBatchesEqual(*expected_batch, *reconciled_batch);
 }
 
+TEST(TestProjector, ReuseMissingColumns) {
+  auto to_schema =
+      schema({field("i32", int32()), field("f64", float64()), field("j32", int32())});
+  RecordBatchProjector projector(to_schema);
+
+  auto f64_schema = schema({field("f64", float64())});
+  auto data_buffer = [](const std::shared_ptr<RecordBatch>& batch, int i) {
+    return batch->column_data(i)->buffers[1]->data();
+  };
+
+  auto batch = ConstantArrayGenerator::Zeroes(100, f64_schema);
+  ASSERT_OK_AND_ASSIGN(auto projected, projector.Project(*batch));
+  ASSERT_OK(projected->ValidateFull());
+  ASSERT_EQ(projected->column(0)->null_count(), 100);
+  // Null columns of the same type share an array
+  ASSERT_EQ(data_buffer(projected, 0), data_buffer(projected, 2));
+  auto materialized = data_buffer(projected, 0);
+
+  // Shorter batches slice the materialized columns
+  ASSERT_OK_AND_ASSIGN(
+      projected, projector.Project(*ConstantArrayGenerator::Zeroes(60, f64_schema)));
+  ASSERT_OK(projected->ValidateFull());
+  ASSERT_EQ(data_buffer(projected, 0), materialized);
+
+  // Longer batches materialize them again, with room for growth
+  ASSERT_OK_AND_ASSIGN(
+      projected, projector.Project(*ConstantArrayGenerator::Zeroes(101, f64_schema)));
+  ASSERT_OK(projected->ValidateFull());
+  materialized = data_buffer(projected, 0);
+  ASSERT_OK_AND_ASSIGN(
+      projected, projector.Project(*ConstantArrayGenerator::Zeroes(150, f64_schema)));
+  ASSERT_OK(projected->ValidateFull());
+  ASSERT_EQ(data_buffer(projected, 0), materialized);
+
+  // Other columns go missing when the input schema changes
+  auto i32_schema = schema({field("i32", int32()), field("j32", int32())});
+  ASSERT_OK_AND_ASSIGN(
+      projected, projector.Project(*ConstantArrayGenerator::Zeroes(50, i32_schema)));
+  ASSERT_OK(projected->ValidateFull());
+  ASSERT_OK_AND_ASSIGN(auto null_f64, MakeArrayOfNull(float64(), 50));
+  AssertArraysEqual(*null_f64, *projected->column(1));
+  ASSERT_OK_AND_ASSIGN(
+      projected, projector.Project(*ConstantArrayGenerator::Zeroes(50, f64_schema)));
+  ASSERT_OK(projected->ValidateFull());
+  ASSERT_EQ(data_buffer(projected, 0), materialized);
+}
+
 class TestEndToEnd : public TestUnionDataset {
   void SetUp() override {
     bool nullable = false;
@@ -18,18 +18,31 @@
 #include "arrow/dataset/discovery.h"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
@@ -102,6 +115,181 @@ Result<std::shared_ptr<Dataset>> UnionDatasetFactory::Finish(FinishOptions optio
   return std::shared_ptr<Dataset>(new UnionDataset(options.schema, std::move(children)));
 }
 
+namespace {
+
+std::shared_ptr<Schema> FragmentMetadataCacheSchema() {
+  return schema({field("path", utf8(), /*nullable=*/false),
+                 field("format", utf8(), /*nullable=*/false),
+                 field("size", int64(), /*nullable=*/false),
+                 field("mtime", int64(), /*nullable=*/false),
+                 field("schema", binary(), /*nullable=*/false)});
+}
+
+bool IsCacheable(const fs::FileInfo& info) {
+  return info.IsFile() && info.size() != fs::kNoSize && info.mtime() != fs::kNoTime;
+}
+
+int64_t MtimeNanos(const fs::FileInfo& info) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             info.mtime().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+Result<std::shared_ptr<FragmentMetadataCache>> FragmentMetadataCache::Open(
+    std::shared_ptr<fs::FileSystem> filesystem, std::string path) {
+  std::shared_ptr<FragmentMetadataCache> cache(
+      new FragmentMetadataCache(std::move(filesystem), std::move(path)));
+  RETURN_NOT_OK(cache->Load());
+  return cache;
+}
+
+Status FragmentMetadataCache::Load() {
+  ARROW_ASSIGN_OR_RAISE(auto info, filesystem_->GetFileInfo(path_));
+  if (info.type() == fs::FileType::NotFound) {
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto file, filesystem_->OpenInputFile(path_));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(file));
+  if (!reader->schema()->Equals(*FragmentMetadataCacheSchema(),
+                                /*check_metadata=*/false)) {
+    return Status::Invalid("'", path_, "' is not a fragment metadata cache, ",
+                           "its schema is ", reader->schema()->ToString());
+  }
+
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    RETURN_NOT_OK(batch->ValidateFull());
+
+    const auto& paths = internal::checked_cast<const StringArray&>(*batch->column(0));
+    const auto& formats = internal::checked_cast<const StringArray&>(*batch->column(1));
+    const auto& sizes = internal::checked_cast<const Int64Array&>(*batch->column(2));
+    const auto& mtimes = internal::checked_cast<const Int64Array&>(*batch->column(3));
+    const auto& schemas = internal::checked_cast<const BinaryArray&>(*batch->column(4));
+
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      Entry entry;
+      entry.format = formats.GetString(row);
+      entry.size = sizes.Value(row);
+      entry.mtime = mtimes.Value(row);
+      entry.serialized_schema = SliceBuffer(
+          schemas.value_data(), schemas.value_offset(row), schemas.value_length(row));
+      entries_[paths.GetString(row)] = std::move(entry);
+    }
+  }
+
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Schema>> FragmentMetadataCache::Get(const fs::FileInfo& info,
+                                                          const FileFormat& format) {
+  if (!IsCacheable(info)) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(info.path());
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+
+  auto& entry = it->second;
+  if (entry.format != format.type_name() || entry.size != info.size() ||
+      entry.mtime != MtimeNanos(info)) {
+    return nullptr;
+  }
+
+  if (entry.schema == nullptr) {
+    io::BufferReader stream(entry.serialized_schema);
+    ipc::DictionaryMemo memo;
+    ARROW_ASSIGN_OR_RAISE(entry.schema, ipc::ReadSchema(&stream, &memo));
+  }
+  return entry.schema;
+}
+
+Status FragmentMetadataCache::Put(const fs::FileInfo& info, const FileFormat& format,
+                                  std::shared_ptr<Schema> schema) {
+  if (!IsCacheable(info)) {
+    return Status::OK();
+  }
+
+  Entry entry;
+  entry.format = format.type_name();
+  entry.size = info.size();
+  entry.mtime = MtimeNanos(info);
+  ipc::DictionaryMemo memo;
+  ARROW_ASSIGN_OR_RAISE(entry.serialized_schema, ipc::SerializeSchema(*schema, &memo));
+  entry.schema = std::move(schema);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_[info.path()] = std::move(entry);
+  modified_ = true;
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Schema>> FragmentMetadataCache::GetOrInspect(
+    const fs::FileInfo& info, fs::FileSystem* filesystem, const FileFormat& format) {
+  ARROW_ASSIGN_OR_RAISE(auto schema, Get(info, format));
+  if (schema != nullptr) {
+    return schema;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(schema, format.Inspect(FileSource(info, filesystem)));
+  RETURN_NOT_OK(Put(info, format, schema));
+  return schema;
+}
+
+Status FragmentMetadataCache::Save() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!modified_) {
+    return Status::OK();
+  }
+
+  StringBuilder paths, formats;
+  Int64Builder sizes, mtimes;
+  BinaryBuilder schemas;
+  for (const auto& path_entry : entries_) {
+    const auto& entry = path_entry.second;
+    RETURN_NOT_OK(paths.Append(path_entry.first));
+    RETURN_NOT_OK(formats.Append(entry.format));
+    RETURN_NOT_OK(sizes.Append(entry.size));
+    RETURN_NOT_OK(mtimes.Append(entry.mtime));
+    RETURN_NOT_OK(schemas.Append(entry.serialized_schema->data(),
+                                 entry.serialized_schema->size()));
+  }
+
+  ArrayVector columns(5);
+  RETURN_NOT_OK(paths.Finish(&columns[0]));
+  RETURN_NOT_OK(formats.Finish(&columns[1]));
+  RETURN_NOT_OK(sizes.Finish(&columns[2]));
+  RETURN_NOT_OK(mtimes.Finish(&columns[3]));
+  RETURN_NOT_OK(schemas.Finish(&columns[4]));
+  auto batch = RecordBatch::Make(FragmentMetadataCacheSchema(),
+                                 static_cast<int64_t>(entries_.size()), columns);
+
+  // Write next to the destination then move it in place, so that concurrent
+  // readers never observe a partially written cache.
+  auto temp_path = path_ + ".tmp";
+  {
+    ARROW_ASSIGN_OR_RAISE(auto stream, filesystem_->OpenOutputStream(temp_path));
+    ARROW_ASSIGN_OR_RAISE(auto writer, ipc::NewFileWriter(stream.get(), batch->schema()));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    RETURN_NOT_OK(writer->Close());
+    RETURN_NOT_OK(stream->Close());
+  }
+  RETURN_NOT_OK(filesystem_->Move(temp_path, path_));
+
+  modified_ = false;
+  return Status::OK();
+}
+
+int64_t FragmentMetadataCache::num_entries() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int64_t>(entries_.size());
+}
+
 FileSystemDatasetFactory::FileSystemDatasetFactory(
     std::shared_ptr<fs::FileSystem> filesystem, fs::PathForest forest,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options)
@@ -125,10 +313,36 @@ bool StartsWithAnyOf(const std::vector<std::string>& prefixes, const std::string
   return std::any_of(prefixes.cbegin(), prefixes.cend(), matches_prefix);
 }
 
+namespace {
+
+// Whether the path is excluded by ignore_prefixes once the selector's base
+// directory is walked, i.e. any of its components below base_dir matches.
+// Paths outside of base_dir are conservatively reported as excluded.
+bool IsIgnoredBelow(const std::vector<std::string>& prefixes, const std::string& base_dir,
+                    const std::string& path) {
+  auto relative = fs::internal::RemoveAncestor(base_dir, path);
+  if (!relative) {
+    return true;
+  }
+  auto matches_prefix = [&prefixes](const std::string& part) -> bool {
+    util::string_view name{part};
+    for (const auto& prefix : prefixes) {
+      if (!prefix.empty() && name.starts_with(prefix)) {
+        return true;
+      }
+    }
+    return false;
+  };
+  auto parts = fs::internal::SplitAbstractPath(relative->to_string());
+  return std::any_of(parts.cbegin(), parts.cend(), matches_prefix);
+}
+
+}  // namespace
+
 Result<fs::PathForest> FileSystemDatasetFactory::Filter(
     const std::shared_ptr<fs::FileSystem>& filesystem,
     const std::shared_ptr<FileFormat>& format, const FileSystemFactoryOptions& options,
-    fs::PathForest forest) {
+    fs::PathForest forest, const SupportedChecks& checks) {
   std::vector<fs::FileInfo> out;
 
   auto& infos = forest.infos();
@@ -140,8 +354,14 @@ Result<fs::PathForest> FileSystemDatasetFactory::Filter(
     }
 
     if (ref.info().IsFile() && options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(path, filesystem.get())));
+      bool supported;
+      auto check = checks.find(path);
+      if (check != checks.end()) {
+        ARROW_ASSIGN_OR_RAISE(supported, check->second.result());
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            supported, format->IsSupported(FileSource(ref.info(), filesystem.get())));
+      }
       if (!supported) {
         return fs::PathForest::Continue;
       }
@@ -189,11 +409,38 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
+  // Consume the listing as it streams in, checking the format of files which
+  // won't be ignored while the rest of the selection is still being walked.
+  // The checks read the files, so they run on the IO thread pool; Filter()
+  // waits for them, so they are left to it when already running on that pool.
+  auto io_thread_pool = io::internal::GetIOThreadPool();
+  const bool check_ahead =
+      options.exclude_invalid_files && !io_thread_pool->OwnsThisThread();
+  ARROW_ASSIGN_OR_RAISE(auto batches, filesystem->GetFileInfoIterator(selector));
+  std::vector<fs::FileInfo> files;
+  SupportedChecks checks;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, batches.Next());
+    if (batch.empty()) {
+      break;
+    }
+    for (auto& info : batch) {
+      if (check_ahead && info.IsFile() &&
+          !IsIgnoredBelow(options.ignore_prefixes, selector.base_dir, info.path())) {
+        checks.emplace(info.path(), io_thread_pool->SubmitAsFuture(
+                                        [filesystem, format, info]() {
+                                          return format->IsSupported(
+                                              FileSource(info, filesystem.get()));
+                                        }));
+      }
+      files.push_back(std::move(info));
+    }
+  }
 
   ARROW_ASSIGN_OR_RAISE(auto forest, fs::PathForest::Make(std::move(files)));
 
-  ARROW_ASSIGN_OR_RAISE(forest, Filter(filesystem, format, options, std::move(forest)));
+  ARROW_ASSIGN_OR_RAISE(forest,
+                        Filter(filesystem, format, options, std::move(forest), checks));
 
   // By automatically setting the options base_dir to the selector's base_dir,
   // we provide a better experience for user providing Partitioning that are
@@ -224,16 +471,49 @@ Result<std::shared_ptr<Schema>> FileSystemDatasetFactory::PartitionSchema() {
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
-
+  std::vector<fs::FileInfo> files;
   const bool has_fragments_limit = options.fragments >= 0;
   int fragments = options.fragments;
   for (const auto& f : forest_.infos()) {
     if (!f.IsFile()) continue;
     if (has_fragments_limit && fragments-- == 0) break;
-    FileSource src(f.path(), fs_.get());
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect(src));
-    schemas.push_back(schema);
+    files.push_back(f);
+  }
+
+  auto filesystem = fs_;
+  auto format = format_;
+  auto cache = options_.metadata_cache;
+  // FileInfo has no end of iteration value, hence the optional
+  using MaybeFileInfo = util::optional<fs::FileInfo>;
+  auto inspect = [filesystem, format,
+                  cache](MaybeFileInfo info) -> Result<std::shared_ptr<Schema>> {
+    if (cache != nullptr) {
+      return cache->GetOrInspect(*info, filesystem.get(), *format);
+    }
+    return format->Inspect(FileSource(std::move(*info), filesystem.get()));
+  };
+
+  ParallelMapOptions map_options;
+  map_options.max_in_flight = std::max(options.fragments_concurrency, 1);
+  map_options.thread_pool = io::internal::GetIOThreadPool();
+  auto schema_it = MakeParallelMapIterator(
+      std::move(inspect), MakeVectorOptionalIterator(std::move(files)), map_options);
+
+  // Unify as the schemas come in: a conflict ends the iteration, which stops
+  // inspecting the remaining fragments.
+  std::vector<std::shared_ptr<Schema>> schemas;
+  SchemaBuilder unified(SchemaBuilder::CONFLICT_MERGE);
+  for (auto maybe_schema : schema_it) {
+    ARROW_ASSIGN_OR_RAISE(auto schema, std::move(maybe_schema));
+    if (!schema->HasDistinctFieldNames()) {
+      return Status::Invalid("Can't unify schema with duplicate field names.");
+    }
+    RETURN_NOT_OK(unified.AddSchema(schema));
+    schemas.push_back(std::move(schema));
+  }
+
+  if (options_.metadata_cache != nullptr) {
+    RETURN_NOT_OK(options_.metadata_cache->Save());
   }
 
   ARROW_ASSIGN_OR_RAISE(auto partition_schema, PartitionSchema());
@@ -22,7 +22,10 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "arrow/dataset/partition.h"
@@ -31,6 +34,7 @@
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/result.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/variant.h"
 
@@ -53,6 +57,15 @@ struct InspectOptions {
   /// `kInspectAllFragments`. A value of `0` disables inspection of fragments
   /// altogether so only the partitioning schema will be inspected.
   int fragments = 1;
+
+  /// The maximum number of fragments inspected concurrently, on the I/O thread pool.
+  ///
+  /// Inspecting a fragment usually reads its footer or header, so on high latency
+  /// file systems it is dominated by round trips which overlap well. The fragments'
+  /// schemas are unified as they are inspected, in order, so that inspection stops
+  /// at the first fragment whose schema can't be unified with the previous ones.
+  /// A value of `1` inspects the fragments one after the other.
+  int fragments_concurrency = 8;
 };
 
 struct FinishOptions {
@@ -131,6 +144,66 @@ class ARROW_DS_EXPORT UnionDatasetFactory : public DatasetFactory {
   std::vector<std::shared_ptr<DatasetFactory>> factories_;
 };
 
+/// \brief A persistent cache of the schemas inspected from files
+///
+/// Entries are keyed on a file's path and are only used when the file's size,
+/// modification time and the inspecting FileFormat all match the ones recorded,
+/// so rewritten files are inspected again. Files whose size or modification time
+/// is unknown are never cached.
+///
+/// The cache is persisted as an Arrow IPC file, typically a sidecar stored next to
+/// the dataset (prefix its basename with "_" so that discovery ignores it). Loading
+/// it only reads the serialized schemas; those are deserialized on lookup.
+class ARROW_DS_EXPORT FragmentMetadataCache {
+ public:
+  /// \brief Load the cache persisted at `path`, or start an empty one if `path`
+  /// does not exist yet.
+  static Result<std::shared_ptr<FragmentMetadataCache>> Open(
+      std::shared_ptr<fs::FileSystem> filesystem, std::string path);
+
+  /// \brief Return the cached schema of a file, or null if no valid entry exists.
+  Result<std::shared_ptr<Schema>> Get(const fs::FileInfo& info,
+                                      const FileFormat& format);
+
+  /// \brief Record the schema of a file, replacing any previous entry.
+  Status Put(const fs::FileInfo& info, const FileFormat& format,
+             std::shared_ptr<Schema> schema);
+
+  /// \brief Return the cached schema of a file, inspecting and caching it on a miss.
+  Result<std::shared_ptr<Schema>> GetOrInspect(const fs::FileInfo& info,
+                                               fs::FileSystem* filesystem,
+                                               const FileFormat& format);
+
+  /// \brief Persist the cache to its path if it was modified since it was loaded.
+  Status Save();
+
+  /// \brief The number of cached entries, valid or not.
+  int64_t num_entries() const;
+
+  const std::string& path() const { return path_; }
+
+ private:
+  FragmentMetadataCache(std::shared_ptr<fs::FileSystem> filesystem, std::string path)
+      : filesystem_(std::move(filesystem)), path_(std::move(path)) {}
+
+  Status Load();
+
+  struct Entry {
+    std::string format;
+    int64_t size;
+    int64_t mtime;
+    std::shared_ptr<Buffer> serialized_schema;
+    std::shared_ptr<Schema> schema;
+  };
+
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  std::string path_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  bool modified_ = false;
+};
+
 struct FileSystemFactoryOptions {
   // Either an explicit Partitioning or a PartitioningFactory to discover one.
   //
@@ -178,6 +251,12 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  // If provided, the schemas of inspected files are looked up in this cache
+  // instead of being read from the files whenever they are still valid. Newly
+  // inspected schemas are added to the cache, which is saved once inspection
+  // completes.
+  std::shared_ptr<FragmentMetadataCache> metadata_cache;
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -222,10 +301,14 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
                            fs::PathForest forest, std::shared_ptr<FileFormat> format,
                            FileSystemFactoryOptions options);
 
+  /// Outcomes of FileFormat::IsSupported checks started ahead of Filter(), by path.
+  using SupportedChecks = std::unordered_map<std::string, Future<bool>>;
+
   static Result<fs::PathForest> Filter(const std::shared_ptr<fs::FileSystem>& filesystem,
                                        const std::shared_ptr<FileFormat>& format,
                                        const FileSystemFactoryOptions& options,
-                                       fs::PathForest forest);
+                                       fs::PathForest forest,
+                                       const SupportedChecks& checks = {});
 
   Result<std::shared_ptr<Schema>> PartitionSchema();
 
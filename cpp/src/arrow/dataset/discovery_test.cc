@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/discovery.h"
 
+#include <atomic>
 #include <memory>
 #include <utility>
 
@@ -25,6 +26,7 @@
 
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type_fwd.h"
@@ -302,6 +304,144 @@ TEST_F(FileSystemDatasetFactoryTest, InspectFragmentsLimit) {
   }
 }
 
+class CountingFileFormat : public DummyFileFormat {
+ public:
+  using DummyFileFormat::DummyFileFormat;
+
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override {
+    ++num_inspected;
+    return DummyFileFormat::Inspect(source);
+  }
+
+  mutable std::atomic<int> num_inspected{0};
+};
+
+// Yields a schema which can't be unified with the others for the file "conflict"
+class ConflictingFileFormat : public CountingFileFormat {
+ public:
+  using CountingFileFormat::CountingFileFormat;
+
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override {
+    ARROW_ASSIGN_OR_RAISE(auto schema, CountingFileFormat::Inspect(source));
+    if (source.path() == "conflict") {
+      return ::arrow::schema({field("f", utf8())});
+    }
+    return schema;
+  }
+};
+
+TEST_F(FileSystemDatasetFactoryTest, InspectConcurrently) {
+  auto s = schema({field("f", int32())});
+  auto format = std::make_shared<CountingFileFormat>(s);
+  format_ = format;
+  MakeFactory({fs::File("a"), fs::File("b"), fs::File("c"), fs::File("d"),
+               fs::File("e"), fs::File("f")});
+
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  for (int concurrency : {1, 2, 16}) {
+    options.fragments_concurrency = concurrency;
+    format->num_inspected = 0;
+    ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
+    AssertSchemasAre(schemas, {s, s, s, s, s, s, schema({})});
+    EXPECT_EQ(format->num_inspected, 6);
+  }
+
+  // The fragments limit applies as well
+  options.fragments = 4;
+  format->num_inspected = 0;
+  ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
+  EXPECT_THAT(schemas, SizeIs(5));
+  EXPECT_EQ(format->num_inspected, 4);
+}
+
+TEST_F(FileSystemDatasetFactoryTest, InspectStopsAtConflict) {
+  auto format = std::make_shared<ConflictingFileFormat>(schema({field("f", int32())}));
+  format_ = format;
+  MakeFactory({fs::File("a"), fs::File("b"), fs::File("conflict"), fs::File("d"),
+               fs::File("e"), fs::File("g")});
+
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  options.fragments_concurrency = 1;
+  ASSERT_RAISES(Invalid, factory_->InspectSchemas(options));
+  // The fragments after the conflicting one were not inspected
+  EXPECT_EQ(format->num_inspected, 3);
+
+  options.fragments_concurrency = 2;
+  ASSERT_RAISES(Invalid, factory_->Inspect(options));
+}
+
+class FragmentMetadataCacheTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<fs::internal::MockFileSystem>(
+        fs::TimePoint(fs::TimePoint::duration(42)));
+    ASSERT_OK(fs_->CreateFile("dataset/a", "aaa"));
+    ASSERT_OK(fs_->CreateFile("dataset/b", "bbb"));
+    selector_.base_dir = "dataset";
+    selector_.recursive = true;
+  }
+
+  void AssertInspectWithCache(const std::shared_ptr<FragmentMetadataCache>& cache,
+                              int expected_num_inspected) {
+    auto format = std::make_shared<CountingFileFormat>(schema_);
+    FileSystemFactoryOptions options;
+    options.metadata_cache = cache;
+    ASSERT_OK_AND_ASSIGN(auto factory,
+                         FileSystemDatasetFactory::Make(fs_, selector_, format, options));
+
+    InspectOptions inspect_options;
+    inspect_options.fragments = InspectOptions::kInspectAllFragments;
+    ASSERT_OK_AND_ASSIGN(auto schemas, factory->InspectSchemas(inspect_options));
+    AssertSchemasAre(schemas, {schema_, schema_, schema({})});
+    EXPECT_EQ(format->num_inspected, expected_num_inspected);
+  }
+
+ protected:
+  std::shared_ptr<fs::internal::MockFileSystem> fs_;
+  fs::FileSelector selector_;
+  std::shared_ptr<Schema> schema_ =
+      schema({field("f64", float64()), field("dict", dictionary(int32(), utf8()))});
+  std::string cache_path_ = "dataset/_metadata_cache.arrow";
+};
+
+TEST_F(FragmentMetadataCacheTest, WarmStartSkipsInspection) {
+  ASSERT_OK_AND_ASSIGN(auto cache, FragmentMetadataCache::Open(fs_, cache_path_));
+  ASSERT_EQ(cache->num_entries(), 0);
+  AssertInspectWithCache(cache, 2);
+  ASSERT_EQ(cache->num_entries(), 2);
+
+  // The sidecar was saved and is ignored by discovery
+  ASSERT_OK_AND_ASSIGN(cache, FragmentMetadataCache::Open(fs_, cache_path_));
+  ASSERT_EQ(cache->num_entries(), 2);
+  AssertInspectWithCache(cache, 0);
+}
+
+TEST_F(FragmentMetadataCacheTest, ModifiedFilesAreInspectedAgain) {
+  ASSERT_OK_AND_ASSIGN(auto cache, FragmentMetadataCache::Open(fs_, cache_path_));
+  AssertInspectWithCache(cache, 2);
+
+  ASSERT_OK(fs_->CreateFile("dataset/b", "a larger b"));
+  ASSERT_OK_AND_ASSIGN(cache, FragmentMetadataCache::Open(fs_, cache_path_));
+  AssertInspectWithCache(cache, 1);
+
+  ASSERT_OK_AND_ASSIGN(cache, FragmentMetadataCache::Open(fs_, cache_path_));
+  AssertInspectWithCache(cache, 0);
+}
+
+TEST_F(FragmentMetadataCacheTest, FilesWithoutMtimeAreNotCached) {
+  ASSERT_OK_AND_ASSIGN(auto cache, FragmentMetadataCache::Open(fs_, cache_path_));
+  auto info = fs::File("dataset/a");
+  info.set_size(3);
+  ASSERT_OK(cache->Put(info, CountingFileFormat(), schema_));
+  ASSERT_EQ(cache->num_entries(), 0);
+}
+
+TEST_F(FragmentMetadataCacheTest, OpenInvalidCache) {
+  ASSERT_RAISES(Invalid, FragmentMetadataCache::Open(fs_, "dataset/a"));
+}
+
 std::shared_ptr<DatasetFactory> DatasetFactoryFromSchemas(
     std::vector<std::shared_ptr<Schema>> schemas) {
   return std::make_shared<MockDatasetFactory>(schemas);
@@ -18,8 +18,16 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/grouper_internal.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
@@ -28,15 +36,19 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/task_group.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 namespace dataset {
 
 Result<std::shared_ptr<arrow::io::RandomAccessFile>> FileSource::Open() const {
   if (type() == PATH) {
-    return filesystem()->OpenInputFile(path());
+    return filesystem()->OpenInputFile(util::get<PATH>(impl_).info);
   }
 
   return std::make_shared<::arrow::io::BufferReader>(buffer());
@@ -55,6 +67,11 @@ Result<std::shared_ptr<arrow::io::OutputStream>> FileSource::OpenWritable() cons
   return std::make_shared<::arrow::io::BufferOutputStream>(b);
 }
 
+Result<util::optional<int64_t>> FileFormat::CountRows(
+    const FileSource&, std::shared_ptr<ScanContext>) const {
+  return util::nullopt;
+}
+
 Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
     FileSource source, std::shared_ptr<ScanOptions> options) {
   return MakeFragment(std::move(source), std::move(options), scalar(true));
@@ -73,22 +90,45 @@ Result<std::shared_ptr<WriteTask>> FileFormat::WriteFragment(
   return Status::NotImplemented("writing fragment of format ", type_name());
 }
 
+Result<std::shared_ptr<FileWriter>> FileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<ScanContext> context) {
+  return Status::NotImplemented("writing files of format ", type_name());
+}
+
 Result<ScanTaskIterator> FileFragment::Scan(std::shared_ptr<ScanContext> context) {
   return format_->ScanFile(source_, scan_options_, std::move(context));
 }
 
+Result<util::optional<int64_t>> FileFragment::CountRows(
+    std::shared_ptr<ScanContext> context) {
+  if (!scan_options_->filter->Equals(true)) {
+    return util::nullopt;
+  }
+  return format_->CountRows(source_, std::move(context));
+}
+
 FileSystemDataset::FileSystemDataset(std::shared_ptr<Schema> schema,
                                      std::shared_ptr<Expression> root_partition,
                                      std::shared_ptr<FileFormat> format,
                                      std::shared_ptr<fs::FileSystem> filesystem,
                                      fs::PathForest forest,
-                                     ExpressionVector file_partitions)
+                                     ExpressionVector file_partitions,
+                                     std::shared_ptr<PartitionKeyIndex> partition_index)
     : Dataset(std::move(schema), std::move(root_partition)),
       format_(std::move(format)),
       filesystem_(std::move(filesystem)),
       forest_(std::move(forest)),
-      partitions_(std::move(file_partitions)) {
+      partitions_(std::move(file_partitions)),
+      partition_index_(std::move(partition_index)) {
   DCHECK_EQ(static_cast<size_t>(forest_.size()), partitions_.size());
+  if (partition_index_ == nullptr) {
+    // If the keys can't be indexed, the forest is only pruned node by node
+    auto maybe_index = PartitionKeyIndex::Make(forest_, partitions_);
+    if (maybe_index.ok() && (*maybe_index)->keys()->num_columns() > 0) {
+      partition_index_ = std::move(maybe_index).ValueOrDie();
+    }
+  }
 }
 
 Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
@@ -123,7 +163,7 @@ Result<std::shared_ptr<Dataset>> FileSystemDataset::ReplaceSchema(
   RETURN_NOT_OK(CheckProjectable(*schema_, *schema));
   return std::shared_ptr<Dataset>(
       new FileSystemDataset(std::move(schema), partition_expression_, format_,
-                            filesystem_, forest_, partitions_));
+                            filesystem_, forest_, partitions_, partition_index_));
 }
 
 std::vector<std::string> FileSystemDataset::files() const {
@@ -174,7 +214,22 @@ FragmentIterator FileSystemDataset::GetFragmentsImpl(
 
   ExpressionVector fragment_partitions(forest_.size());
 
+  // Evaluate the filter against the partition keys of all the nodes at once,
+  // rather than simplifying it for each node to find those which can't
+  // satisfy it.  An error here means the filter can't be evaluated this way.
+  std::vector<bool> selected;
+  if (partition_index_ != nullptr && !root_options->filter->Equals(true)) {
+    auto maybe_selected = partition_index_->Select(*root_options->filter);
+    if (maybe_selected.ok()) {
+      selected = std::move(maybe_selected).ValueOrDie();
+    }
+  }
+
   auto collect_fragments = [&](fs::PathForest::Ref ref) -> fs::PathForest::MaybePrune {
+    if (!selected.empty() && !selected[ref.i]) {
+      return fs::PathForest::Prune;
+    }
+
     auto partition = partitions_[ref.i];
 
     // if available, copy parent's filter and projector
@@ -203,7 +258,7 @@ FragmentIterator FileSystemDataset::GetFragmentsImpl(
 
     if (ref.info().IsFile()) {
       // generate a fragment for this file
-      FileSource src(ref.info().path(), filesystem_.get());
+      FileSource src(ref.info(), filesystem_.get());
       ARROW_ASSIGN_OR_RAISE(auto fragment,
                             format_->MakeFragment(std::move(src), options[ref.i],
                                                   std::move(fragment_partitions[ref.i])));
@@ -268,6 +323,357 @@ Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Write(
               std::move(forest), std::move(partition_expressions));
 }
 
+namespace {
+
+// The value of a partition key column at a given row
+struct PartitionKeyScalarImpl {
+  template <typename T>
+  enable_if_t<is_number_type<T>::value || is_boolean_type<T>::value ||
+                  is_date_type<T>::value,
+              Status>
+  Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& array = internal::checked_cast<const ArrayType&>(array_);
+    return MakeScalar(array.type(), array.Value(i_)).Value(&out_);
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& array = internal::checked_cast<const ArrayType&>(array_);
+    return MakeScalar(array.type(), Buffer::FromString(array.GetString(i_))).Value(&out_);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("partitioning by field of type ", type);
+  }
+
+  Result<std::shared_ptr<Scalar>> Finish() && {
+    if (array_.IsNull(i_)) {
+      return Status::Invalid("null partition key in field of type ", *array_.type());
+    }
+    RETURN_NOT_OK(VisitTypeInline(*array_.type(), this));
+    return std::move(out_);
+  }
+
+  const Array& array_;
+  int64_t i_;
+  std::shared_ptr<Scalar> out_;
+};
+
+// A part of a record batch to be written to a partition
+struct PartitionedBatch {
+  std::string directory;
+  std::shared_ptr<Expression> partition_expression;
+  std::shared_ptr<RecordBatch> batch;
+};
+
+// Writes the record batches of each partition to files of its directory,
+// keeping at most max_open_files opened.  Batches may be written to
+// different partitions from different threads at the same time.
+class DatasetWriter {
+ public:
+  DatasetWriter(const FileSystemDatasetWriteOptions& options,
+                std::shared_ptr<fs::FileSystem> filesystem,
+                std::shared_ptr<Schema> file_schema,
+                std::shared_ptr<ScanContext> context)
+      : options_(options),
+        filesystem_(std::move(filesystem)),
+        file_schema_(std::move(file_schema)),
+        context_(std::move(context)),
+        base_dir_(fs::internal::EnsureTrailingSlash(options.base_dir)) {}
+
+  Status Write(const PartitionedBatch& part) {
+    while (true) {
+      std::shared_ptr<PartitionWriter> writer, evicted;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = writers_.find(part.directory);
+        if (it == writers_.end()) {
+          if (static_cast<int>(writers_.size()) >= std::max(options_.max_open_files, 1)) {
+            evicted = TakeLeastRecentlyUsed();
+          }
+          writer = std::make_shared<PartitionWriter>();
+          writer->path = NextFilePath(part.directory);
+          writer->partition_expression = part.partition_expression;
+          writers_.emplace(part.directory, writer);
+        } else {
+          writer = it->second;
+        }
+        writer->last_use = ++use_count_;
+      }
+      // Close the evicted file outside of the global lock, so that its I/O
+      // doesn't hold up the other partitions
+      if (evicted != nullptr) {
+        RETURN_NOT_OK(evicted->Close());
+      }
+
+      std::lock_guard<std::mutex> lock(writer->mutex);
+      if (writer->closed) {
+        // Closed by another thread in the meantime, open the next file
+        continue;
+      }
+      if (writer->file_writer == nullptr) {
+        // Open the file here rather than under the global lock
+        RETURN_NOT_OK(filesystem_->CreateDir(
+            fs::internal::GetAbstractPathParent(writer->path).first));
+        ARROW_ASSIGN_OR_RAISE(auto destination,
+                              filesystem_->OpenOutputStream(writer->path));
+        ARROW_ASSIGN_OR_RAISE(
+            writer->file_writer,
+            options_.format->MakeWriter(destination, file_schema_, context_));
+        // Only files which were actually opened make up the written dataset
+        AddFile(*writer);
+      }
+      return writer->file_writer->Write(*part.batch);
+    }
+  }
+
+  // Close all remaining files, in parallel
+  Status Finish(std::shared_ptr<internal::TaskGroup> task_group) {
+    WriterMap writers;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      writers.swap(writers_);
+    }
+    for (auto& directory_writer : writers) {
+      auto writer = directory_writer.second;
+      task_group->Append([writer] { return writer->Close(); });
+    }
+    return task_group->Finish();
+  }
+
+  std::vector<fs::FileInfo> files() const { return files_; }
+  ExpressionVector partitions() const { return partitions_; }
+
+ private:
+  struct PartitionWriter {
+    std::mutex mutex;
+    std::string path;
+    std::shared_ptr<Expression> partition_expression;
+    std::shared_ptr<FileWriter> file_writer;
+    uint64_t last_use = 0;
+    bool closed = false;
+
+    Status Close() {
+      std::lock_guard<std::mutex> lock(mutex);
+      closed = true;
+      if (file_writer == nullptr) {
+        return Status::OK();
+      }
+      auto file_writer_to_close = std::move(file_writer);
+      return file_writer_to_close->Finish();
+    }
+  };
+
+  using WriterMap = std::unordered_map<std::string, std::shared_ptr<PartitionWriter>>;
+
+  // Mutex must be held
+  std::string NextFilePath(const std::string& directory) {
+    std::string path = base_dir_;
+    if (!directory.empty()) {
+      path += directory + "/";
+    }
+    return path + "part-" + std::to_string(num_paths_++) + "." +
+           options_.format->type_name();
+  }
+
+  void AddFile(const PartitionWriter& writer) {
+    fs::FileInfo info;
+    info.set_type(fs::FileType::File);
+    info.set_path(writer.path);
+    std::lock_guard<std::mutex> lock(mutex_);
+    files_.push_back(std::move(info));
+    partitions_.push_back(writer.partition_expression);
+  }
+
+  // Mutex must be held. The returned writer is to be closed by the caller.
+  std::shared_ptr<PartitionWriter> TakeLeastRecentlyUsed() {
+    auto lru = std::min_element(
+        writers_.begin(), writers_.end(), [](const WriterMap::value_type& l,
+                                             const WriterMap::value_type& r) {
+          return l.second->last_use < r.second->last_use;
+        });
+    auto writer = lru->second;
+    writers_.erase(lru);
+    return writer;
+  }
+
+  const FileSystemDatasetWriteOptions& options_;
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  std::shared_ptr<Schema> file_schema_;
+  std::shared_ptr<ScanContext> context_;
+  std::string base_dir_;
+
+  std::mutex mutex_;
+  WriterMap writers_;
+  uint64_t use_count_ = 0;
+  int64_t num_paths_ = 0;
+  std::vector<fs::FileInfo> files_;
+  ExpressionVector partitions_;
+};
+
+// Splits record batches by the values of the partitioning's fields
+class BatchPartitioner {
+ public:
+  static Result<BatchPartitioner> Make(std::shared_ptr<Partitioning> partitioning,
+                                       const Schema& schema) {
+    BatchPartitioner partitioner;
+    partitioner.partitioning_ = std::move(partitioning);
+    std::vector<std::shared_ptr<Field>> file_fields = schema.fields();
+    if (partitioner.partitioning_ != nullptr) {
+      for (const auto& key_field : partitioner.partitioning_->schema()->fields()) {
+        int i = schema.GetFieldIndex(key_field->name());
+        if (i == -1) {
+          return Status::Invalid("partition field '", key_field->name(),
+                                 "' is not in the written schema ", schema);
+        }
+        partitioner.key_indices_.push_back(i);
+        partitioner.key_names_.push_back(key_field->name());
+      }
+    }
+    for (int i = schema.num_fields() - 1; i >= 0; --i) {
+      if (std::find(partitioner.key_indices_.begin(), partitioner.key_indices_.end(),
+                    i) != partitioner.key_indices_.end()) {
+        file_fields.erase(file_fields.begin() + i);
+      } else {
+        partitioner.file_indices_.insert(partitioner.file_indices_.begin(), i);
+      }
+    }
+    partitioner.file_schema_ = ::arrow::schema(std::move(file_fields));
+    return partitioner;
+  }
+
+  const std::shared_ptr<Schema>& file_schema() const { return file_schema_; }
+
+  Status Partition(compute::FunctionContext* ctx, const RecordBatch& batch,
+                   std::vector<PartitionedBatch>* out) const {
+    out->clear();
+    if (batch.num_rows() == 0) {
+      return Status::OK();
+    }
+    ArrayVector file_columns;
+    for (int i : file_indices_) {
+      file_columns.push_back(batch.column(i));
+    }
+    auto file_batch = RecordBatch::Make(file_schema_, batch.num_rows(), file_columns);
+    if (key_indices_.empty()) {
+      out->push_back({"", scalar(true), std::move(file_batch)});
+      return Status::OK();
+    }
+
+    // Group the rows by key values with the hash group-by kernel
+    ArrayVector keys;
+    std::vector<std::shared_ptr<DataType>> key_types;
+    for (int i : key_indices_) {
+      keys.push_back(batch.column(i));
+      key_types.push_back(batch.column(i)->type());
+    }
+    compute::detail::Grouper grouper;
+    RETURN_NOT_OK(grouper.Init(ctx, key_types));
+    std::vector<int32_t> group_ids;
+    RETURN_NOT_OK(grouper.Consume(keys, batch.num_rows(), &group_ids));
+    const int32_t num_groups = grouper.num_groups();
+    ArrayVector uniques;
+    RETURN_NOT_OK(grouper.GetUniques(&uniques));
+
+    // Sort the row indices by group, to take the rows of all groups at once
+    std::vector<int64_t> offsets(num_groups + 1, 0);
+    for (int32_t id : group_ids) {
+      ++offsets[id + 1];
+    }
+    for (int32_t g = 0; g < num_groups; ++g) {
+      offsets[g + 1] += offsets[g];
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> indices_buffer,
+        AllocateBuffer(batch.num_rows() * sizeof(int32_t), ctx->memory_pool()));
+    auto indices = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+    std::vector<int64_t> next = offsets;
+    for (int32_t row = 0; row < static_cast<int32_t>(group_ids.size()); ++row) {
+      indices[next[group_ids[row]]++] = row;
+    }
+    Int32Array indices_array(batch.num_rows(), indices_buffer);
+    std::shared_ptr<RecordBatch> sorted;
+    RETURN_NOT_OK(compute::Take(ctx, *file_batch, indices_array,
+                                compute::TakeOptions(), &sorted));
+
+    for (int32_t g = 0; g < num_groups; ++g) {
+      ExpressionVector equalities;
+      std::vector<std::string> segments;
+      for (size_t k = 0; k < key_names_.size(); ++k) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto value, (PartitionKeyScalarImpl{*uniques[k], g, nullptr}.Finish()));
+        auto equality = equal(field_ref(key_names_[k]), scalar(std::move(value)));
+        ARROW_ASSIGN_OR_RAISE(auto segment,
+                              partitioning_->Format(*equality, static_cast<int>(k)));
+        segments.push_back(std::move(segment));
+        equalities.push_back(std::move(equality));
+      }
+      out->push_back({fs::internal::JoinAbstractPath(segments), and_(equalities),
+                      sorted->Slice(offsets[g], offsets[g + 1] - offsets[g])});
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Partitioning> partitioning_;
+  std::vector<int> key_indices_;
+  std::vector<std::string> key_names_;
+  std::vector<int> file_indices_;
+  std::shared_ptr<Schema> file_schema_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Write(
+    const FileSystemDatasetWriteOptions& write_options,
+    std::shared_ptr<Scanner> scanner) {
+  if (write_options.format == nullptr) {
+    return Status::Invalid("no format given to write the dataset");
+  }
+  auto filesystem = write_options.filesystem;
+  if (filesystem == nullptr) {
+    filesystem = std::make_shared<fs::LocalFileSystem>();
+  }
+  const auto& scan_context = scanner->context();
+
+  ARROW_ASSIGN_OR_RAISE(auto partitioner, BatchPartitioner::Make(
+                                              write_options.partitioning,
+                                              *scanner->schema()));
+  DatasetWriter writer(write_options, filesystem, partitioner.file_schema(),
+                       scan_context);
+
+  ARROW_ASSIGN_OR_RAISE(auto scan_task_it, scanner->Scan());
+  auto task_group = scan_context->TaskGroup();
+  for (auto maybe_scan_task : scan_task_it) {
+    ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+
+    task_group->Append([&, scan_task] {
+      compute::FunctionContext ctx(scan_context->pool);
+      ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
+
+      std::vector<PartitionedBatch> parts;
+      for (auto maybe_batch : batch_it) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+        RETURN_NOT_OK(partitioner.Partition(&ctx, *batch, &parts));
+        for (const auto& part : parts) {
+          RETURN_NOT_OK(writer.Write(part));
+        }
+      }
+      return Status::OK();
+    });
+  }
+  Status st = task_group->Finish();
+  // Close the files even on error, but report the first error
+  Status finish_st = writer.Finish(scan_context->TaskGroup());
+  RETURN_NOT_OK(st);
+  RETURN_NOT_OK(finish_st);
+
+  return Make(scanner->schema(), scalar(true), write_options.format,
+              std::move(filesystem), writer.files(), writer.partitions());
+}
+
 Status WriteTask::CreateDestinationParentDir() const {
   if (auto filesystem = destination_.filesystem()) {
     auto parent = fs::internal::GetAbstractPathParent(destination_.path()).first;
@@ -49,7 +49,16 @@ class ARROW_DS_EXPORT FileSource {
   FileSource(std::string path, fs::FileSystem* filesystem,
              Compression::type compression = Compression::UNCOMPRESSED,
              bool writable = true)
-      : impl_(PathAndFileSystem{std::move(path), filesystem}),
+      : impl_(PathAndFileSystem{fs::FileInfo(std::move(path)), filesystem}),
+        compression_(compression),
+        writable_(writable) {}
+
+  /// \brief A file source of which the info is already known, e.g. from a
+  /// listing, so that opening it needn't query the filesystem for it again
+  FileSource(fs::FileInfo info, fs::FileSystem* filesystem,
+             Compression::type compression = Compression::UNCOMPRESSED,
+             bool writable = true)
+      : impl_(PathAndFileSystem{std::move(info), filesystem}),
         compression_(compression),
         writable_(writable) {}
 
@@ -87,7 +96,7 @@ class ARROW_DS_EXPORT FileSource {
   /// type is PATH
   const std::string& path() const {
     static std::string buffer_path = "<Buffer>";
-    return type() == PATH ? util::get<PATH>(impl_).path : buffer_path;
+    return type() == PATH ? util::get<PATH>(impl_).info.path() : buffer_path;
   }
 
   /// \brief Return the filesystem, if any. Only non null when file
@@ -111,7 +120,7 @@ class ARROW_DS_EXPORT FileSource {
 
  private:
   struct PathAndFileSystem {
-    std::string path;
+    fs::FileInfo info;
     fs::FileSystem* filesystem;
   };
 
@@ -142,6 +151,13 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
       const FileSource& source, std::shared_ptr<ScanOptions> options,
       std::shared_ptr<ScanContext> context) const = 0;
 
+  /// \brief Count the rows of a file from its metadata, if possible.
+  ///
+  /// Only called when no row can be filtered out. Return nullopt if the file must
+  /// be scanned instead, which is the default.
+  virtual Result<util::optional<int64_t>> CountRows(
+      const FileSource& source, std::shared_ptr<ScanContext> context) const;
+
   /// \brief Open a fragment
   virtual Result<std::shared_ptr<FileFragment>> MakeFragment(
       FileSource source, std::shared_ptr<ScanOptions> options,
@@ -155,6 +171,13 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   virtual Result<std::shared_ptr<WriteTask>> WriteFragment(
       FileSource destination, std::shared_ptr<Fragment> fragment,
       std::shared_ptr<ScanContext> scan_context);  // FIXME(bkietz) make this pure virtual
+
+  /// \brief Open a writer of record batches with the given schema to destination.
+  ///
+  /// Memory is allocated from the context's pool.
+  virtual Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<ScanContext> context);
 };
 
 /// \brief A Fragment that is stored in a file with a known format
@@ -162,6 +185,11 @@ class ARROW_DS_EXPORT FileFragment : public Fragment {
  public:
   Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override;
 
+  /// \brief Count the rows from the file's metadata if the filter is trivially true,
+  /// e.g. after being simplified by the partition expression.
+  Result<util::optional<int64_t>> CountRows(
+      std::shared_ptr<ScanContext> context) override;
+
   std::string type_name() const override { return format_->type_name(); }
   bool splittable() const override { return format_->splittable(); }
 
@@ -242,6 +270,20 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   static Result<std::shared_ptr<FileSystemDataset>> Write(
       const WritePlan& plan, std::shared_ptr<ScanContext> scan_context);
 
+  /// \brief Write the record batches of a scan to a partitioned directory structure.
+  ///
+  /// Each batch is split by the values of the partitioning's fields, each part being
+  /// appended to a file of the directory formatted from its partition expression.
+  /// Partition fields are not written to the files, as they can be recovered from the
+  /// paths. Scan tasks are executed in parallel if the scanner's context allows it.
+  ///
+  /// \param[in] write_options where and how to write the files.
+  /// \param[in] scanner the scan whose record batches will be written.
+  /// \return a FileSystemDataset of the written files.
+  static Result<std::shared_ptr<FileSystemDataset>> Write(
+      const FileSystemDatasetWriteOptions& write_options,
+      std::shared_ptr<Scanner> scanner);
+
   std::string type_name() const override { return "filesystem"; }
 
   Result<std::shared_ptr<Dataset>> ReplaceSchema(
@@ -262,12 +304,55 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
                     std::shared_ptr<Expression> root_partition,
                     std::shared_ptr<FileFormat> format,
                     std::shared_ptr<fs::FileSystem> filesystem, fs::PathForest forest,
-                    ExpressionVector file_partitions);
+                    ExpressionVector file_partitions,
+                    std::shared_ptr<PartitionKeyIndex> partition_index = NULLPTR);
 
   std::shared_ptr<FileFormat> format_;
   std::shared_ptr<fs::FileSystem> filesystem_;
   fs::PathForest forest_;
   ExpressionVector partitions_;
+  // Index of the partition keys of forest_, used to prune it in a single pass
+  std::shared_ptr<PartitionKeyIndex> partition_index_;
+};
+
+/// \brief Options for FileSystemDataset::Write of the record batches of a scan
+struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
+  /// The format into which record batches will be written
+  std::shared_ptr<FileFormat> format;
+
+  /// The FileSystem and base directory into which files will be written
+  std::shared_ptr<fs::FileSystem> filesystem;
+  std::string base_dir;
+
+  /// The partitioning by which record batches are split into directories.
+  ///
+  /// Must be a KeyValuePartitioning, such as HivePartitioning or
+  /// DirectoryPartitioning. If null, all batches are written to base_dir.
+  std::shared_ptr<Partitioning> partitioning;
+
+  /// The maximum number of files open for writing at once. When it is reached, the
+  /// least recently written file is closed and later batches of its partition go to a
+  /// new file.
+  int max_open_files = 1024;
+};
+
+/// \brief A writer of record batches to a single file.
+class ARROW_DS_EXPORT FileWriter {
+ public:
+  virtual ~FileWriter() = default;
+
+  /// \brief Append a record batch, which must have the writer's schema.
+  virtual Status Write(const RecordBatch& batch) = 0;
+
+  /// \brief Finish writing the file and close the destination.
+  virtual Status Finish() = 0;
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+ protected:
+  explicit FileWriter(std::shared_ptr<Schema> schema) : schema_(std::move(schema)) {}
+
+  std::shared_ptr<Schema> schema_;
 };
 
 /// \brief Write a fragment to a single OutputStream.
@@ -0,0 +1,252 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/parser.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace dataset {
+
+Result<std::shared_ptr<csv::StreamingReader>> OpenReader(
+    const FileSource& source, std::shared_ptr<io::InputStream> input,
+    const CsvFileFormat& format, const csv::ConvertOptions& convert_options,
+    MemoryPool* pool) {
+  auto read_options = format.read_options;
+  read_options.use_threads = false;
+
+  std::shared_ptr<csv::StreamingReader> reader;
+  auto status = csv::StreamingReader::Make(pool, std::move(input), read_options,
+                                           format.parse_options, convert_options)
+                    .Value(&reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open CSV input source '", source.path(),
+                              "': ", status.message());
+  }
+  return reader;
+}
+
+// Get the column names of a CSV file, from its header row unless they are given
+// or generated, without converting any value.
+Result<std::vector<std::string>> GetColumnNames(const csv::ReadOptions& read_options,
+                                                const csv::ParseOptions& parse_options,
+                                                io::RandomAccessFile* input) {
+  if (!read_options.column_names.empty()) {
+    return read_options.column_names;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto block, input->ReadAt(0, read_options.block_size));
+  const uint8_t* data = block->data();
+  const auto size = static_cast<uint32_t>(block->size());
+  if (csv::SkipRows(data, size, read_options.skip_rows, &data) <
+      read_options.skip_rows) {
+    return Status::Invalid("Could not skip initial ", read_options.skip_rows,
+                           " rows from CSV file");
+  }
+
+  csv::BlockParser parser(parse_options, /*num_cols=*/-1, /*max_num_rows=*/1);
+  util::string_view rest(reinterpret_cast<const char*>(data),
+                         block->data() + block->size() - data);
+  uint32_t parsed_size = 0;
+  if (block->size() < read_options.block_size) {
+    // The whole file was read, its last row may lack a line separator
+    RETURN_NOT_OK(parser.ParseFinal(rest, &parsed_size));
+  } else {
+    RETURN_NOT_OK(parser.Parse(rest, &parsed_size));
+  }
+  if (parser.num_rows() != 1) {
+    return Status::Invalid(
+        "Could not read first row from CSV file, either "
+        "file is too short or header is larger than block size");
+  }
+
+  std::vector<std::string> column_names;
+  if (read_options.autogenerate_column_names) {
+    for (int32_t i = 0; i < parser.num_cols(); ++i) {
+      column_names.push_back("f" + std::to_string(i));
+    }
+    return column_names;
+  }
+
+  auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+    column_names.emplace_back(reinterpret_cast<const char*>(data), size);
+    return Status::OK();
+  };
+  RETURN_NOT_OK(parser.VisitLastRow(visit));
+  return column_names;
+}
+
+/// \brief A ScanTask backed by a CSV file.
+class CsvScanTask : public ScanTask {
+ public:
+  CsvScanTask(FileSource source, std::shared_ptr<const CsvFileFormat> format,
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        format_(std::move(format)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    ARROW_ASSIGN_OR_RAISE(auto input, source_.Open());
+    ARROW_ASSIGN_OR_RAISE(auto column_names,
+                          GetColumnNames(format_->read_options, format_->parse_options,
+                                         input.get()));
+    RETURN_NOT_OK(input->Seek(0));
+
+    // Convert only the materialized fields present in the file, with the types of
+    // the scan schema; the others (e.g. partition fields) are added by the projector.
+    auto convert_options = format_->convert_options;
+    convert_options.include_columns.clear();
+    convert_options.include_missing_columns = false;
+    std::unordered_set<std::string> in_file(column_names.begin(), column_names.end());
+    for (const auto& name : options_->MaterializedFields()) {
+      if (in_file.erase(name) == 0) {
+        continue;
+      }
+      convert_options.include_columns.push_back(name);
+      if (auto field = options_->schema()->GetFieldByName(name)) {
+        convert_options.column_types[name] = field->type();
+      }
+    }
+    if (convert_options.include_columns.empty()) {
+      // Nothing to convert, but the rows must still be counted
+      convert_options.include_columns.push_back(column_names.front());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source_, std::move(input), *format_,
+                                                  convert_options, context_->pool));
+    return IteratorFromReader(std::move(reader));
+  }
+
+ private:
+  FileSource source_;
+  std::shared_ptr<const CsvFileFormat> format_;
+};
+
+class CsvScanTaskIterator {
+ public:
+  static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
+                                       std::shared_ptr<ScanContext> context,
+                                       FileSource source,
+                                       std::shared_ptr<const CsvFileFormat> format) {
+    return ScanTaskIterator(CsvScanTaskIterator(std::move(options), std::move(context),
+                                                std::move(source), std::move(format)));
+  }
+
+  Result<std::shared_ptr<ScanTask>> Next() {
+    if (once_) {
+      // Iteration is done.
+      return nullptr;
+    }
+
+    once_ = true;
+    return std::shared_ptr<ScanTask>(
+        new CsvScanTask(source_, format_, options_, context_));
+  }
+
+ private:
+  CsvScanTaskIterator(std::shared_ptr<ScanOptions> options,
+                      std::shared_ptr<ScanContext> context, FileSource source,
+                      std::shared_ptr<const CsvFileFormat> format)
+      : options_(std::move(options)),
+        context_(std::move(context)),
+        source_(std::move(source)),
+        format_(std::move(format)) {}
+
+  bool once_ = false;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+  FileSource source_;
+  std::shared_ptr<const CsvFileFormat> format_;
+};
+
+Result<bool> CsvFileFormat::IsSupported(const FileSource& source) const {
+  return Inspect(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> CsvFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(input), *this,
+                                                convert_options, default_memory_pool()));
+  return reader->schema();
+}
+
+Result<ScanTaskIterator> CsvFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  auto self = internal::checked_pointer_cast<const CsvFileFormat>(shared_from_this());
+  return CsvScanTaskIterator::Make(std::move(options), std::move(context), source,
+                                   std::move(self));
+}
+
+namespace {
+
+class CsvFileWriter : public FileWriter {
+ public:
+  CsvFileWriter(std::shared_ptr<io::OutputStream> destination,
+                std::shared_ptr<csv::StreamingWriter> writer,
+                std::shared_ptr<Schema> schema)
+      : FileWriter(std::move(schema)),
+        destination_(std::move(destination)),
+        writer_(std::move(writer)) {}
+
+  Status Write(const RecordBatch& batch) override {
+    return writer_->WriteRecordBatch(batch);
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<csv::StreamingWriter> writer_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<FileWriter>> CsvFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<ScanContext> context) {
+  auto options = write_options;
+  options.use_threads = false;
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        csv::StreamingWriter::Make(context->pool, destination.get(),
+                                                   schema, options));
+  return std::make_shared<CsvFileWriter>(std::move(destination), std::move(writer),
+                                         std::move(schema));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/csv/options.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A FileFormat implementation that reads from and writes to CSV files
+///
+/// Each file is scanned by a single ScanTask, so the files of a dataset are read in
+/// parallel by the scanner rather than by the CSV reader.  Only the columns of the
+/// file which are materialized by the scan are converted, and their types are taken
+/// from the scan schema (usually inferred once when the dataset is discovered) so
+/// that every file of a dataset yields the same types.
+class ARROW_DS_EXPORT CsvFileFormat : public FileFormat {
+ public:
+  std::string type_name() const override { return "csv"; }
+
+  /// Options affecting the parsing of CSV files
+  csv::ParseOptions parse_options = csv::ParseOptions::Defaults();
+
+  /// Options affecting the reading of CSV files. `use_threads` is ignored.
+  csv::ReadOptions read_options = csv::ReadOptions::Defaults();
+
+  /// Options affecting the conversion of CSV values. `include_columns`,
+  /// `include_missing_columns` and the types of the scanned columns are
+  /// overridden when scanning.
+  csv::ConvertOptions convert_options = csv::ConvertOptions::Defaults();
+
+  /// Options affecting the writing of CSV files. `use_threads` is ignored.
+  csv::WriteOptions write_options = csv::WriteOptions::Defaults();
+
+  Result<bool> IsSupported(const FileSource& source) const override;
+
+  /// \brief Return the schema of the file, as inferred from its first block.
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
+
+  /// \brief Open a file for scanning
+  Result<ScanTaskIterator> ScanFile(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context) const override;
+
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<ScanContext> context) override;
+};
+
+}  // namespace dataset
+}  // namespace arrow
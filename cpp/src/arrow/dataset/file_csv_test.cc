@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestCsvFileFormat : public ::testing::Test {
+ public:
+  std::unique_ptr<FileSource> GetFileSource(const std::string& csv) {
+    return internal::make_unique<FileSource>(Buffer::FromString(csv));
+  }
+
+  RecordBatchIterator Batches(ScanTaskIterator scan_task_it) {
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  RecordBatchIterator Batches(Fragment* fragment) {
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+    return Batches(std::move(scan_task_it));
+  }
+
+ protected:
+  std::shared_ptr<CsvFileFormat> format_ = std::make_shared<CsvFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestCsvFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource(R"(f64
+1.0
+
+N/A
+2)");
+  opts_ = ScanOptions::Make(schema({field("f64", float64())}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    AssertSchemaEqual(*batch->schema(), *opts_->schema());
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 3);
+}
+
+TEST_F(TestCsvFileFormat, Inspect) {
+  auto source = GetFileSource(R"(f64,str
+1.0,foo
+2.5,bar)");
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source.get()));
+  AssertSchemaEqual(*actual, Schema({field("f64", float64()), field("str", utf8())}));
+}
+
+TEST_F(TestCsvFileFormat, IsSupported) {
+  bool supported;
+
+  auto source = GetFileSource("");
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(*source));
+  ASSERT_EQ(supported, false);
+
+  source = GetFileSource(R"(f64
+1.0
+
+N/A
+2)");
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(*source));
+  ASSERT_EQ(supported, true);
+}
+
+TEST_F(TestCsvFileFormat, ScanProjectedAndTyped) {
+  auto source = GetFileSource(R"(i32,str,f64
+1,foo,1.5
+2,bar,2.5)");
+  // The types of the scan schema are used rather than inferred
+  auto dataset_schema = schema({field("i32", int32()), field("str", utf8()),
+                                field("f64", float64())});
+  opts_ = ScanOptions::Make(dataset_schema);
+  opts_->projector = RecordBatchProjector(SchemaFromColumnNames(dataset_schema, {"i32"}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    // Only the projected column is converted
+    AssertSchemaEqual(*batch->schema(), Schema({field("i32", int32())}));
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 2);
+}
+
+TEST_F(TestCsvFileFormat, ScanMissingColumns) {
+  auto source = GetFileSource(R"(f64
+1.0
+2.5)");
+  // Fields absent from the file (e.g. partition fields) are left to the projector
+  opts_ = ScanOptions::Make(schema({field("f64", float64()), field("part", int32())}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    AssertSchemaEqual(*batch->schema(), Schema({field("f64", float64())}));
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 2);
+}
+
+TEST_F(TestCsvFileFormat, ScanWithoutHeader) {
+  auto source = GetFileSource(R"(1,foo
+2,bar
+3,baz)");
+  format_->read_options.autogenerate_column_names = true;
+  opts_ = ScanOptions::Make(schema({field("f1", utf8())}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    AssertSchemaEqual(*batch->schema(), Schema({field("f1", utf8())}));
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 3);
+}
+
+TEST_F(TestCsvFileFormat, MakeWriter) {
+  auto schm = schema({field("i32", int32()), field("str", utf8())});
+  auto batch = RecordBatchFromJSON(schm, R"([[1, "foo"], [null, "bar"]])");
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, format_->MakeWriter(sink, schm, ctx_));
+  ASSERT_OK(writer->Write(*batch));
+  ASSERT_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // Read it back
+  FileSource source(buffer);
+  opts_ = ScanOptions::Make(schm);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+  RecordBatchVector batches;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto read, std::move(maybe_batch));
+    batches.push_back(read);
+  }
+  ASSERT_EQ(batches.size(), 1);
+  AssertBatchesEqual(*batch, *batches[0]);
+}
+
+}  // namespace dataset
+}  // namespace arrow
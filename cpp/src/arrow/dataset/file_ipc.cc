@@ -25,6 +25,8 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/file.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/util/iterator.h"
@@ -32,15 +34,28 @@
 namespace arrow {
 namespace dataset {
 
-Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
-    const FileSource& source, std::shared_ptr<io::RandomAccessFile> input = nullptr) {
-  if (input == nullptr) {
-    ARROW_ASSIGN_OR_RAISE(input, source.Open());
+// Memory-map the files of a LocalFileSystem if requested, otherwise open them
+// through their filesystem
+Result<std::shared_ptr<io::RandomAccessFile>> OpenInput(
+    const FileSource& source, const IpcFileFormat::ReaderOptions& options) {
+  if (options.use_mmap && source.type() == FileSource::PATH &&
+      source.filesystem()->type_name() == "local") {
+    ARROW_ASSIGN_OR_RAISE(auto file,
+                          io::MemoryMappedFile::Open(source.path(), io::FileMode::READ));
+    RETURN_NOT_OK(file->Advise(options.memory_advice));
+    return file;
   }
+  return source.Open();
+}
+
+Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
+    const FileSource& source, std::shared_ptr<io::RandomAccessFile> input,
+    util::optional<std::vector<int>> included_fields = util::nullopt) {
 
   std::shared_ptr<ipc::RecordBatchFileReader> reader;
   auto options = ipc::IpcReadOptions::Defaults();
   options.use_threads = false;
+  options.included_fields = std::move(included_fields);
 
   auto status =
       ipc::RecordBatchFileReader::Open(std::move(input), options).Value(&reader);
@@ -54,20 +69,25 @@ Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
 /// \brief A ScanTask backed by an Ipc file.
 class IpcScanTask : public ScanTask {
  public:
-  IpcScanTask(FileSource source, std::shared_ptr<ScanOptions> options,
-              std::shared_ptr<ScanContext> context)
-      : ScanTask(std::move(options), std::move(context)), source_(std::move(source)) {}
+  IpcScanTask(FileSource source, IpcFileFormat::ReaderOptions reader_options,
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        reader_options_(reader_options) {}
 
   Result<RecordBatchIterator> Execute() override {
     struct Impl {
       static Result<Impl> Make(const FileSource& source,
+                               const IpcFileFormat::ReaderOptions& reader_options,
                                const std::vector<std::string>& materialized_fields,
                                MemoryPool* pool) {
-        ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+        ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, reader_options));
+        ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(input)));
         auto materialized_schema =
             SchemaFromColumnNames(reader->schema(), materialized_fields);
         return Impl{std::move(reader),
-                    RecordBatchProjector(std::move(materialized_schema)), pool, 0};
+                    RecordBatchProjector(std::move(materialized_schema)), pool,
+                    reader_options.will_need_next_batch, 0};
       }
 
       Result<std::shared_ptr<RecordBatch>> Next() {
@@ -75,6 +95,10 @@ class IpcScanTask : public ScanTask {
           return nullptr;
         }
 
+        if (will_need_next_batch_ && i_ + 1 < reader_->num_record_batches()) {
+          RETURN_NOT_OK(reader_->WillNeedRecordBatch(i_ + 1));
+        }
+
         ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> batch,
                               reader_->ReadRecordBatch(i_++));
         return projector_.Project(*batch, pool_);
@@ -83,6 +107,7 @@ class IpcScanTask : public ScanTask {
       std::shared_ptr<ipc::RecordBatchFileReader> reader_;
       RecordBatchProjector projector_;
       MemoryPool* pool_;
+      bool will_need_next_batch_;
       int i_;
     };
 
@@ -92,22 +117,25 @@ class IpcScanTask : public ScanTask {
     auto unique_end = std::unique(fields.begin(), fields.end());
     fields.erase(unique_end, fields.end());
 
-    ARROW_ASSIGN_OR_RAISE(auto batch_it, Impl::Make(source_, fields, context_->pool));
+    ARROW_ASSIGN_OR_RAISE(auto batch_it,
+                          Impl::Make(source_, reader_options_, fields, context_->pool));
 
     return RecordBatchIterator(std::move(batch_it));
   }
 
  private:
   FileSource source_;
+  IpcFileFormat::ReaderOptions reader_options_;
 };
 
 class IpcScanTaskIterator {
  public:
   static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
                                        std::shared_ptr<ScanContext> context,
-                                       FileSource source) {
-    return ScanTaskIterator(
-        IpcScanTaskIterator(std::move(options), std::move(context), std::move(source)));
+                                       FileSource source,
+                                       IpcFileFormat::ReaderOptions reader_options) {
+    return ScanTaskIterator(IpcScanTaskIterator(std::move(options), std::move(context),
+                                                std::move(source), reader_options));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -117,36 +145,56 @@ class IpcScanTaskIterator {
     }
 
     once_ = true;
-    return std::shared_ptr<ScanTask>(new IpcScanTask(source_, options_, context_));
+    return std::shared_ptr<ScanTask>(
+        new IpcScanTask(source_, reader_options_, options_, context_));
   }
 
  private:
   IpcScanTaskIterator(std::shared_ptr<ScanOptions> options,
-                      std::shared_ptr<ScanContext> context, FileSource source)
+                      std::shared_ptr<ScanContext> context, FileSource source,
+                      IpcFileFormat::ReaderOptions reader_options)
       : options_(std::move(options)),
         context_(std::move(context)),
-        source_(std::move(source)) {}
+        source_(std::move(source)),
+        reader_options_(reader_options) {}
 
   bool once_ = false;
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   FileSource source_;
+  IpcFileFormat::ReaderOptions reader_options_;
 };
 
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
-  return OpenReader(source, input).ok();
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, reader_options));
+  return OpenReader(source, std::move(input)).ok();
 }
 
 Result<std::shared_ptr<Schema>> IpcFileFormat::Inspect(const FileSource& source) const {
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, reader_options));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(input)));
   return reader->schema();
 }
 
 Result<ScanTaskIterator> IpcFileFormat::ScanFile(
     const FileSource& source, std::shared_ptr<ScanOptions> options,
     std::shared_ptr<ScanContext> context) const {
-  return IpcScanTaskIterator::Make(options, context, source);
+  return IpcScanTaskIterator::Make(options, context, source, reader_options);
+}
+
+Result<util::optional<int64_t>> IpcFileFormat::CountRows(
+    const FileSource& source, std::shared_ptr<ScanContext> context) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, reader_options));
+  // Include no field, so that only the metadata of the record batches is decoded
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        OpenReader(source, std::move(input), std::vector<int>{}));
+
+  int64_t num_rows = 0;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    num_rows += batch->num_rows();
+  }
+  return num_rows;
 }
 
 Result<std::shared_ptr<WriteTask>> IpcFileFormat::WriteFragment(
@@ -189,5 +237,43 @@ Result<std::shared_ptr<WriteTask>> IpcFileFormat::WriteFragment(
                                 std::move(fragment), std::move(scan_context));
 }
 
+namespace {
+
+class IpcFileWriter : public FileWriter {
+ public:
+  IpcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                std::shared_ptr<ipc::RecordBatchWriter> writer,
+                std::shared_ptr<Schema> schema)
+      : FileWriter(std::move(schema)),
+        destination_(std::move(destination)),
+        writer_(std::move(writer)) {}
+
+  Status Write(const RecordBatch& batch) override {
+    return writer_->WriteRecordBatch(batch);
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<FileWriter>> IpcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<ScanContext> context) {
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.memory_pool = context->pool;
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::NewFileWriter(destination.get(), schema, options));
+  return std::make_shared<IpcFileWriter>(std::move(destination), std::move(writer),
+                                         std::move(schema));
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -23,6 +23,7 @@
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/io/type_fwd.h"
 #include "arrow/result.h"
 
 namespace arrow {
@@ -35,6 +36,22 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
 
   bool splittable() const override { return true; }
 
+  struct ReaderOptions {
+    /// Whether files of a LocalFileSystem are memory-mapped. Record batches are then
+    /// slices of the mapping, so that scanning them copies no buffers unless they
+    /// are compressed.
+    bool use_mmap = true;
+
+    /// \defgroup ipc-file-format-memory-advice hints given to the OS about the
+    /// access pattern of memory-mapped files.
+    ///
+    /// @{
+    io::MemoryAdvice memory_advice = io::MemoryAdvice::Sequential;
+    /// Whether each record batch is paged in ahead while the previous one is scanned
+    bool will_need_next_batch = true;
+    /// @}
+  } reader_options;
+
   Result<bool> IsSupported(const FileSource& source) const override;
 
   /// \brief Return the schema of the file if possible.
@@ -45,9 +62,18 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
                                     std::shared_ptr<ScanOptions> options,
                                     std::shared_ptr<ScanContext> context) const override;
 
+  /// \brief Count the rows of a file from the metadata of its record batches, without
+  /// reading any column.
+  Result<util::optional<int64_t>> CountRows(
+      const FileSource& source, std::shared_ptr<ScanContext> context) const override;
+
   Result<std::shared_ptr<WriteTask>> WriteFragment(
       FileSource destination, std::shared_ptr<Fragment> fragment,
       std::shared_ptr<ScanContext> context) override;
+
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<ScanContext> context) override;
 };
 
 }  // namespace dataset
@@ -21,16 +21,23 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
 
 namespace arrow {
 namespace dataset {
@@ -127,6 +134,21 @@ TEST_F(TestIpcFileFormat, ScanRecordBatchReader) {
   ASSERT_EQ(row_count, kNumRows);
 }
 
+TEST_F(TestIpcFileFormat, CountRows) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+  ASSERT_OK_AND_ASSIGN(auto num_rows, fragment->CountRows(ctx_));
+  ASSERT_EQ(num_rows, kNumRows);
+
+  opts_->filter = ("f64"_ > 0.0).Copy();
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment(*source, opts_));
+  ASSERT_OK_AND_ASSIGN(num_rows, fragment->CountRows(ctx_));
+  ASSERT_EQ(num_rows, util::nullopt);
+}
+
 TEST_F(TestIpcFileFormat, WriteRecordBatchReader) {
   std::shared_ptr<RecordBatchReader> reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
@@ -221,6 +243,199 @@ TEST_F(TestIpcFileSystemDataset, Write) {
                                    "new_root/bbb/1", "new_root/ccc/0", "new_root/ccc/1"));
 }
 
+class TestIpcFileSystemDatasetWrite : public TestIpcFileSystemDataset {
+ public:
+  void SetUp() override {
+    schema_ = schema({field("id", int32()), field("year", int32()),
+                      field("country", utf8())});
+    source_ = std::make_shared<InMemoryDataset>(
+        schema_, RecordBatchVector{RecordBatchFromJSON(schema_, R"([
+                                     [0, 2018, "US"],
+                                     [1, 2019, "CA"],
+                                     [2, 2018, "US"],
+                                     [3, 2019, "US"]
+                                   ])"),
+                                   RecordBatchFromJSON(schema_, R"([
+                                     [4, 2019, "CA"],
+                                     [5, 2018, "CA"],
+                                     [6, 2018, "US"]
+                                   ])")});
+    ASSERT_OK_AND_ASSIGN(fs_, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+
+    write_options_.format = format_;
+    write_options_.filesystem = fs_;
+    write_options_.base_dir = "new_root";
+  }
+
+  void DoWrite() {
+    ScannerBuilder builder(source_, ctx_);
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(written_, FileSystemDataset::Write(write_options_, scanner));
+  }
+
+  // Read back the written dataset, whose rows are compared in order of id
+  void AssertWrittenRowsEqualSource() {
+    ASSERT_OK_AND_ASSIGN(auto builder, written_->NewScan());
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+    ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+    ASSERT_OK_AND_ASSIGN(table, table->CombineChunks());
+
+    compute::FunctionContext ctx;
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(compute::SortToIndices(&ctx, *table->column(0)->chunk(0), &indices));
+    std::shared_ptr<Table> sorted;
+    ASSERT_OK(compute::Take(&ctx, *table, *indices, compute::TakeOptions(), &sorted));
+
+    ASSERT_OK_AND_ASSIGN(auto expected, source_->NewScan());
+    ASSERT_OK_AND_ASSIGN(auto expected_scanner, expected->Finish());
+    ASSERT_OK_AND_ASSIGN(auto expected_table, expected_scanner->ToTable());
+    AssertTablesEqual(*expected_table, *sorted, /*same_chunk_layout=*/false);
+  }
+
+  std::vector<std::string> ParentDirectories() const {
+    auto parent_directories = written_->files();
+    for (auto& path : parent_directories) {
+      EXPECT_EQ(fs::internal::GetAbstractPathExtension(path), "ipc");
+      path = fs::internal::GetAbstractPathParent(path).first;
+    }
+    return parent_directories;
+  }
+
+ protected:
+  std::shared_ptr<Dataset> source_;
+  FileSystemDatasetWriteOptions write_options_;
+  std::shared_ptr<FileSystemDataset> written_;
+};
+
+TEST_F(TestIpcFileSystemDatasetWrite, WriteUnpartitioned) {
+  DoWrite();
+
+  EXPECT_THAT(written_->files(), testing::ElementsAre("new_root/part-0.ipc"));
+  AssertWrittenRowsEqualSource();
+}
+
+TEST_F(TestIpcFileSystemDatasetWrite, WriteHivePartitioned) {
+  ctx_->use_threads = true;
+  write_options_.partitioning = std::make_shared<HivePartitioning>(
+      schema({field("year", int32()), field("country", utf8())}));
+  DoWrite();
+
+  EXPECT_THAT(ParentDirectories(),
+              testing::UnorderedElementsAre(
+                  "new_root/year=2018/country=CA", "new_root/year=2018/country=US",
+                  "new_root/year=2019/country=CA", "new_root/year=2019/country=US"));
+  using E = TestExpression;
+  std::vector<E> actual_partitions;
+  for (const auto& partition : written_->partitions()) {
+    actual_partitions.emplace_back(partition);
+  }
+  EXPECT_THAT(actual_partitions,
+              testing::UnorderedElementsAre(E{"year"_ == 2018 and "country"_ == "CA"},
+                                            E{"year"_ == 2018 and "country"_ == "US"},
+                                            E{"year"_ == 2019 and "country"_ == "CA"},
+                                            E{"year"_ == 2019 and "country"_ == "US"}));
+
+  // Partition fields are not written to the files
+  for (const auto& path : written_->files()) {
+    ASSERT_OK_AND_ASSIGN(auto file_schema, format_->Inspect({path, fs_.get()}));
+    AssertSchemaEqual(*schema({field("id", int32())}), *file_schema);
+  }
+
+  AssertWrittenRowsEqualSource();
+}
+
+TEST_F(TestIpcFileSystemDatasetWrite, WriteWithMaxOpenFiles) {
+  write_options_.partitioning = std::make_shared<DirectoryPartitioning>(
+      schema({field("year", int32()), field("country", utf8())}));
+  write_options_.max_open_files = 1;
+  DoWrite();
+
+  // Each switch to another partition closes the file of the previous one
+  EXPECT_THAT(written_->files(),
+              testing::ElementsAre("new_root/2018/CA/part-4.ipc",
+                                   "new_root/2018/US/part-0.ipc",
+                                   "new_root/2018/US/part-5.ipc",
+                                   "new_root/2019/CA/part-1.ipc",
+                                   "new_root/2019/CA/part-3.ipc",
+                                   "new_root/2019/US/part-2.ipc"));
+  // Only files which were opened are listed
+  for (const auto& path : written_->files()) {
+    ASSERT_OK_AND_ASSIGN(auto info, fs_->GetFileInfo(path));
+    ASSERT_EQ(info.type(), fs::FileType::File) << path;
+  }
+  AssertWrittenRowsEqualSource();
+}
+
+TEST_F(TestIpcFileSystemDatasetWrite, WriteMissingPartitionField) {
+  write_options_.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("month", int32())}));
+
+  ScannerBuilder builder(source_, ctx_);
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("'month'"),
+      FileSystemDataset::Write(write_options_, scanner).status());
+}
+
+class TestIpcFileFormatLocal : public TestIpcFileFormat {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, arrow::internal::TemporaryDir::Make("ipc-mmap-"));
+    path_ = temp_dir_->path().ToString() + "data.ipc";
+
+    auto reader = GetRecordBatchReader();
+    ASSERT_OK_AND_ASSIGN(auto out, io::FileOutputStream::Open(path_));
+    ASSERT_OK(out->Write(Write(reader.get())));
+    ASSERT_OK(out->Close());
+
+    opts_ = ScanOptions::Make(schema_);
+  }
+
+  // Scan the file's batches, returning the bytes allocated while holding them
+  int64_t ScanAndHoldBatches() {
+    const int64_t allocated_before = default_memory_pool()->bytes_allocated();
+    EXPECT_OK_AND_ASSIGN(auto fragment,
+                         format_->MakeFragment({path_, local_fs_.get()}, opts_));
+    RecordBatchVector batches;
+    int64_t row_count = 0;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+      batches.push_back(std::move(batch));
+    }
+    EXPECT_EQ(row_count, kNumRows);
+    return default_memory_pool()->bytes_allocated() - allocated_before;
+  }
+
+ protected:
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir_;
+  std::string path_;
+  std::shared_ptr<fs::FileSystem> local_fs_ = std::make_shared<fs::LocalFileSystem>();
+};
+
+TEST_F(TestIpcFileFormatLocal, ScanMemoryMapped) {
+  const int64_t data_size = kNumRows * sizeof(double);
+  for (auto advice : {io::MemoryAdvice::Sequential, io::MemoryAdvice::Random,
+                      io::MemoryAdvice::Normal}) {
+    for (bool will_need_next_batch : {true, false}) {
+      format_->reader_options.memory_advice = advice;
+      format_->reader_options.will_need_next_batch = will_need_next_batch;
+
+      // Record batches are slices of the mapping
+      EXPECT_LT(ScanAndHoldBatches(), data_size / 8);
+    }
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto schema, format_->Inspect({path_, local_fs_.get()}));
+  AssertSchemaEqual(*schema_, *schema);
+  ASSERT_OK_AND_EQ(true, format_->IsSupported({path_, local_fs_.get()}));
+}
+
+TEST_F(TestIpcFileFormatLocal, ScanWithoutMemoryMap) {
+  format_->reader_options.use_mmap = false;
+  EXPECT_GE(ScanAndHoldBatches(), kNumRows * static_cast<int64_t>(sizeof(double)));
+}
+
 TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
   std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
   auto result = format_->Inspect(FileSource(buf));
@@ -0,0 +1,345 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/range.h"
+
+namespace arrow {
+namespace dataset {
+
+using adapters::orc::ORCFileReader;
+using adapters::orc::StripeFieldStatistics;
+
+static Result<std::unique_ptr<ORCFileReader>> OpenReader(const FileSource& source,
+                                                         MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  std::unique_ptr<ORCFileReader> reader;
+  auto status = ORCFileReader::Open(std::move(input), pool, &reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return std::move(reader);
+}
+
+// The bounds of a field's values in a stripe, or `true` if they are unknown.
+static std::shared_ptr<Expression> StripeStatisticsAsExpression(
+    const Field& field, const StripeFieldStatistics& statistics) {
+  auto field_expr = field_ref(field.name());
+
+  // Optimize for corner case where all values are nulls
+  if (statistics.num_values == 0 && statistics.has_null) {
+    return equal(field_expr, scalar(MakeNullScalar(field.type())));
+  }
+
+  if (statistics.min == nullptr || statistics.max == nullptr) {
+    return scalar(true);
+  }
+
+  return and_(greater_equal(field_expr, scalar(statistics.min)),
+              less_equal(field_expr, scalar(statistics.max)));
+}
+
+// Select the stripes of a file which the filter doesn't rule out, using their
+// statistics.
+class StripeSkipper {
+ public:
+  static constexpr int kIterationDone = -1;
+
+  StripeSkipper(std::shared_ptr<Schema> schema, std::shared_ptr<Expression> filter,
+                std::vector<int> stripes, int num_stripes,
+                std::atomic<int64_t>* num_stripes_pruned = NULLPTR)
+      : schema_(std::move(schema)),
+        filter_(std::move(filter)),
+        stripe_idx_(0),
+        stripes_(std::move(stripes)),
+        num_stripes_(stripes_.empty() ? num_stripes
+                                      : static_cast<int>(stripes_.size())),
+        num_stripes_pruned_(num_stripes_pruned) {}
+
+  int Next(ORCFileReader* reader) {
+    while (stripe_idx_ < num_stripes_) {
+      const int stripe = stripes_.empty() ? stripe_idx_++ : stripes_[stripe_idx_++];
+
+      if (CanSkip(stripe, reader)) {
+        if (num_stripes_pruned_ != NULLPTR) {
+          ++*num_stripes_pruned_;
+        }
+        continue;
+      }
+
+      return stripe;
+    }
+
+    return kIterationDone;
+  }
+
+ private:
+  bool CanSkip(int stripe, ORCFileReader* reader) const {
+    if (filter_->Equals(true)) {
+      return false;
+    }
+
+    std::vector<StripeFieldStatistics> statistics;
+    // Errors with statistics are ignored and post-filtering will apply.
+    if (!reader->ReadStripeStatistics(stripe, &statistics).ok()) {
+      return false;
+    }
+
+    ExpressionVector expressions;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      expressions.push_back(
+          StripeStatisticsAsExpression(*schema_->field(i), statistics[i]));
+    }
+    if (expressions.empty()) {
+      return false;
+    }
+
+    auto expr = filter_->Assume(and_(expressions));
+    return expr->IsNull() || expr->Equals(false);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Expression> filter_;
+  int stripe_idx_;
+  std::vector<int> stripes_;
+  int num_stripes_;
+  // Optional counter of skipped stripes, e.g. ScanContext's
+  std::atomic<int64_t>* num_stripes_pruned_;
+};
+
+/// \brief A ScanTask backed by a stripe of an ORC file.
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(FileSource source, int stripe, std::vector<int> included_fields,
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        stripe_(stripe),
+        included_fields_(std::move(included_fields)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // Each task opens its own reader, since liborc readers are not thread-safe.
+    // Reading the footer again is cheap compared to decoding a stripe.
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source_, context_->pool));
+    std::shared_ptr<RecordBatchReader> stripe_reader;
+    RETURN_NOT_OK(reader->GetStripeReader(stripe_, options_->batch_size,
+                                          included_fields_, &stripe_reader));
+
+    // Keep the file's reader alive while batches are read from its stripe
+    std::shared_ptr<ORCFileReader> shared_reader = std::move(reader);
+    return MakeFunctionIterator([shared_reader, stripe_reader] {
+      return stripe_reader->Next();
+    });
+  }
+
+ private:
+  FileSource source_;
+  int stripe_;
+  std::vector<int> included_fields_;
+};
+
+class OrcScanTaskIterator {
+ public:
+  static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
+                                       std::shared_ptr<ScanContext> context,
+                                       FileSource source,
+                                       std::unique_ptr<ORCFileReader> reader,
+                                       const std::vector<int>& stripes) {
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(reader->ReadSchema(&schema));
+    ARROW_ASSIGN_OR_RAISE(auto included_fields,
+                          InferIncludedFields(*reader, *schema, *options));
+
+    StripeSkipper skipper(std::move(schema), options->filter, stripes,
+                          static_cast<int>(reader->NumberOfStripes()),
+                          &context->num_row_groups_pruned);
+
+    return ScanTaskIterator(OrcScanTaskIterator(
+        std::move(options), std::move(context), std::move(source), std::move(reader),
+        std::move(included_fields), std::move(skipper)));
+  }
+
+  Result<std::shared_ptr<ScanTask>> Next() {
+    auto stripe = skipper_.Next(reader_.get());
+
+    // Iteration is done.
+    if (stripe == StripeSkipper::kIterationDone) {
+      return nullptr;
+    }
+
+    return std::shared_ptr<ScanTask>(
+        new OrcScanTask(source_, stripe, included_fields_, options_, context_));
+  }
+
+ private:
+  // The ORC indices of the fields needed in either the projection or the filter.
+  // Fields missing from the file are padded by the scanner's projector.
+  static Result<std::vector<int>> InferIncludedFields(ORCFileReader& reader,
+                                                      const Schema& schema,
+                                                      const ScanOptions& options) {
+    std::vector<int> field_indices;
+    RETURN_NOT_OK(reader.GetFieldIndices(&field_indices));
+
+    auto fields_name = options.MaterializedFields();
+    std::unordered_set<std::string> materialized_fields{fields_name.cbegin(),
+                                                        fields_name.cend()};
+
+    std::vector<int> included_fields;
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      if (materialized_fields.count(schema.field(i)->name()) != 0) {
+        included_fields.push_back(field_indices[i]);
+      }
+    }
+    if (included_fields.empty() && !field_indices.empty()) {
+      // An empty selection reads all the fields, read a single one to count the rows
+      included_fields.push_back(field_indices[0]);
+    }
+    return included_fields;
+  }
+
+  OrcScanTaskIterator(std::shared_ptr<ScanOptions> options,
+                      std::shared_ptr<ScanContext> context, FileSource source,
+                      std::unique_ptr<ORCFileReader> reader,
+                      std::vector<int> included_fields, StripeSkipper skipper)
+      : options_(std::move(options)),
+        context_(std::move(context)),
+        source_(std::move(source)),
+        reader_(std::move(reader)),
+        included_fields_(std::move(included_fields)),
+        skipper_(std::move(skipper)) {}
+
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+  FileSource source_;
+  // Only used to read the stripes' statistics
+  std::shared_ptr<ORCFileReader> reader_;
+  std::vector<int> included_fields_;
+  StripeSkipper skipper_;
+};
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  return OpenReader(source, default_memory_pool()).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, default_memory_pool()));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  return schema;
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  return ScanFile(source, std::move(options), std::move(context), {});
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(const FileSource& source,
+                                                 std::shared_ptr<ScanOptions> options,
+                                                 std::shared_ptr<ScanContext> context,
+                                                 const std::vector<int>& stripes) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool));
+
+  for (int i : stripes) {
+    if (i >= reader->NumberOfStripes()) {
+      return Status::IndexError("trying to scan stripe ", i, " but ", source.path(),
+                                " only has ", reader->NumberOfStripes(), " stripes");
+    }
+  }
+
+  return OrcScanTaskIterator::Make(std::move(options), std::move(context), source,
+                                   std::move(reader), stripes);
+}
+
+Result<std::shared_ptr<FileFragment>> OrcFileFormat::MakeFragment(
+    FileSource source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<Expression> partition_expression, std::vector<int> stripes) {
+  return std::shared_ptr<FileFragment>(
+      new OrcFileFragment(std::move(source), shared_from_this(), std::move(options),
+                          std::move(partition_expression), std::move(stripes)));
+}
+
+Result<std::shared_ptr<FileFragment>> OrcFileFormat::MakeFragment(
+    FileSource source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<Expression> partition_expression) {
+  return std::shared_ptr<FileFragment>(
+      new OrcFileFragment(std::move(source), shared_from_this(), std::move(options),
+                          std::move(partition_expression), {}));
+}
+
+Result<FragmentIterator> OrcFileFormat::GetStripeFragments(
+    const OrcFileFragment& fragment, std::shared_ptr<Expression> extra_filter,
+    std::shared_ptr<ScanContext> context) {
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        OpenReader(fragment.source(), default_memory_pool()));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+
+  auto stripes = fragment.stripes();
+  if (stripes.empty()) {
+    stripes = internal::Iota(static_cast<int>(reader->NumberOfStripes()));
+  }
+  FragmentVector fragments(stripes.size());
+
+  auto new_options = std::make_shared<ScanOptions>(*fragment.scan_options());
+  if (!extra_filter->Equals(true)) {
+    new_options->filter = and_(std::move(extra_filter), std::move(new_options->filter));
+  }
+
+  StripeSkipper skipper(std::move(schema), new_options->filter, std::move(stripes),
+                        static_cast<int>(reader->NumberOfStripes()),
+                        context ? &context->num_row_groups_pruned : NULLPTR);
+
+  int i = 0;
+  for (int stripe = skipper.Next(reader.get()); stripe != StripeSkipper::kIterationDone;
+       stripe = skipper.Next(reader.get())) {
+    ARROW_ASSIGN_OR_RAISE(fragments[i++],
+                          MakeFragment(fragment.source(), new_options,
+                                       fragment.partition_expression(), {stripe}));
+  }
+  fragments.resize(i);
+
+  return MakeVectorIterator(std::move(fragments));
+}
+
+Result<ScanTaskIterator> OrcFileFragment::Scan(std::shared_ptr<ScanContext> context) {
+  return orc_format().ScanFile(source_, scan_options_, std::move(context), stripes_);
+}
+
+const OrcFileFormat& OrcFileFragment::orc_format() const {
+  return internal::checked_cast<const OrcFileFormat&>(*format_);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A FileFormat implementation that reads from ORC files
+///
+/// Each stripe of a file is scanned by its own ScanTask, so that the stripes are
+/// read in parallel. Stripes whose statistics contradict the scan's filter are
+/// skipped, and only the fields materialized by the scan are decoded.
+class ARROW_DS_EXPORT OrcFileFormat : public FileFormat {
+ public:
+  std::string type_name() const override { return "orc"; }
+
+  bool splittable() const override { return true; }
+
+  Result<bool> IsSupported(const FileSource& source) const override;
+
+  /// \brief Return the schema of the file if possible.
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
+
+  /// \brief Open a file for scanning
+  Result<ScanTaskIterator> ScanFile(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context) const override;
+
+  /// \brief Open a file for scanning, restricted to the specified stripes.
+  Result<ScanTaskIterator> ScanFile(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context,
+                                    const std::vector<int>& stripes) const;
+
+  using FileFormat::MakeFragment;
+
+  Result<std::shared_ptr<FileFragment>> MakeFragment(
+      FileSource source, std::shared_ptr<ScanOptions> options,
+      std::shared_ptr<Expression> partition_expression) override;
+
+  /// \brief Create a Fragment, restricted to the specified stripes.
+  Result<std::shared_ptr<FileFragment>> MakeFragment(
+      FileSource source, std::shared_ptr<ScanOptions> options,
+      std::shared_ptr<Expression> partition_expression, std::vector<int> stripes);
+
+  /// \brief Split an OrcFileFragment into a Fragment for each stripe.
+  /// Stripes whose statistics contradict the fragment's filter or the extra_filter
+  /// will be excluded, and counted in the num_row_groups_pruned of the optional
+  /// context.
+  Result<FragmentIterator> GetStripeFragments(
+      const OrcFileFragment& fragment,
+      std::shared_ptr<Expression> extra_filter = scalar(true),
+      std::shared_ptr<ScanContext> context = NULLPTR);
+};
+
+class ARROW_DS_EXPORT OrcFileFragment : public FileFragment {
+ public:
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override;
+
+  /// \brief The stripes viewed by this Fragment. This may be empty which signifies all
+  /// stripes are selected.
+  const std::vector<int>& stripes() const { return stripes_; }
+
+ private:
+  OrcFileFragment(FileSource source, std::shared_ptr<FileFormat> format,
+                  std::shared_ptr<ScanOptions> scan_options,
+                  std::shared_ptr<Expression> partition_expression,
+                  std::vector<int> stripes)
+      : FileFragment(std::move(source), std::move(format), std::move(scan_options),
+                     std::move(partition_expression)),
+        stripes_(std::move(stripes)) {}
+
+  const OrcFileFormat& orc_format() const;
+
+  std::vector<int> stripes_;
+
+  friend class OrcFileFormat;
+};
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,274 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/range.h"
+
+#include <orc/OrcFile.hh>
+
+// alias to not interfere with nested orc namespace
+namespace liborc = orc;
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kNumStripes = 4;
+constexpr int64_t kRowsPerStripe = 65535;
+
+class StringOutputStream : public liborc::OutputStream {
+ public:
+  uint64_t getLength() const override { return data_.size(); }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t size) override {
+    data_.append(reinterpret_cast<const char*>(buf), size);
+  }
+
+  const std::string& getName() const override { return name_; }
+
+  void close() override {}
+
+  std::string data_;
+  std::string name_ = "StringOutputStream";
+};
+
+class TestOrcFileFormat : public ::testing::Test {
+ public:
+  // Write a file of kNumStripes stripes of kRowsPerStripe rows, in which the
+  // values of "i64" are consecutive and "str" holds the index of the stripe.
+  std::unique_ptr<FileSource> GetFileSource() {
+    std::unique_ptr<liborc::Type> type(
+        liborc::Type::buildTypeFromString("struct<i64:bigint,str:string>"));
+    liborc::WriterOptions options;
+    // Small enough to write a stripe for each batch
+    options.setStripeSize(1024);
+    options.setCompressionBlockSize(1024);
+    options.setMemoryPool(liborc::getDefaultPool());
+    options.setRowIndexStride(0);
+
+    StringOutputStream stream;
+    auto writer = liborc::createWriter(*type, &stream, options);
+    auto batch = writer->createRowBatch(kRowsPerStripe);
+    auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+    auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+    auto str_batch = dynamic_cast<liborc::StringVectorBatch*>(struct_batch->fields[1]);
+
+    for (int64_t stripe = 0; stripe < kNumStripes; ++stripe) {
+      std::string str = std::to_string(stripe);
+      for (int64_t i = 0; i < kRowsPerStripe; ++i) {
+        long_batch->data[i] = stripe * kRowsPerStripe + i;
+        str_batch->data[i] = &str[0];
+        str_batch->length[i] = static_cast<int64_t>(str.size());
+      }
+      struct_batch->numElements = kRowsPerStripe;
+      long_batch->numElements = kRowsPerStripe;
+      str_batch->numElements = kRowsPerStripe;
+      writer->add(*batch);
+    }
+    writer->close();
+
+    return internal::make_unique<FileSource>(Buffer::FromString(stream.data_));
+  }
+
+  RecordBatchIterator Batches(ScanTaskIterator scan_task_it) {
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  void CountRowsAndTasksInScan(const std::shared_ptr<Fragment>& fragment,
+                               int64_t expected_rows, int64_t expected_tasks) {
+    int64_t actual_rows = 0;
+    int64_t actual_tasks = 0;
+
+    ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+    for (auto maybe_scan_task : scan_task_it) {
+      ASSERT_OK_AND_ASSIGN(auto scan_task, std::move(maybe_scan_task));
+      ASSERT_OK_AND_ASSIGN(auto batch_it, scan_task->Execute());
+      for (auto maybe_batch : batch_it) {
+        ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        actual_rows += batch->num_rows();
+      }
+      ++actual_tasks;
+    }
+
+    EXPECT_EQ(actual_rows, expected_rows);
+    EXPECT_EQ(actual_tasks, expected_tasks);
+  }
+
+  void CountStripesInFragment(const std::shared_ptr<FileFragment>& fragment,
+                              std::vector<int> expected, const Expression& filter) {
+    auto orc_fragment = internal::checked_pointer_cast<OrcFileFragment>(fragment);
+    ASSERT_OK_AND_ASSIGN(auto fragments,
+                         format_->GetStripeFragments(*orc_fragment, filter.Copy()));
+
+    std::vector<int> actual;
+    for (auto maybe_fragment : fragments) {
+      ASSERT_OK_AND_ASSIGN(auto fragment, std::move(maybe_fragment));
+      const auto& stripes =
+          internal::checked_pointer_cast<OrcFileFragment>(fragment)->stripes();
+      ASSERT_EQ(stripes.size(), 1);
+      actual.push_back(stripes[0]);
+    }
+    EXPECT_EQ(actual, expected);
+  }
+
+ protected:
+  std::shared_ptr<OrcFileFormat> format_ = std::make_shared<OrcFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+  std::shared_ptr<Schema> schema_ =
+      schema({field("i64", int64()), field("str", utf8())});
+};
+
+TEST_F(TestOrcFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource();
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  // A ScanTask per stripe
+  CountRowsAndTasksInScan(fragment, kNumStripes * kRowsPerStripe, kNumStripes);
+}
+
+TEST_F(TestOrcFileFormat, ScanRecordBatchReaderProjected) {
+  auto source = GetFileSource();
+
+  opts_ = ScanOptions::Make(schema_);
+  opts_->projector = RecordBatchProjector(SchemaFromColumnNames(schema_, {"i64"}));
+  opts_->filter = scalar(true);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(std::move(scan_task_it))) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    // "str" is not decoded
+    AssertSchemaEqual(*batch->schema(), *schema({field("i64", int64())}),
+                      /*check_metadata=*/false);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, kNumStripes * kRowsPerStripe);
+}
+
+TEST_F(TestOrcFileFormat, Inspect) {
+  auto source = GetFileSource();
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source.get()));
+  AssertSchemaEqual(*actual, *schema_, /*check_metadata=*/false);
+}
+
+TEST_F(TestOrcFileFormat, IsSupported) {
+  bool supported;
+
+  std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(FileSource(buf)));
+  ASSERT_EQ(supported, false);
+
+  buf = std::make_shared<Buffer>(util::string_view("corrupted"));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(FileSource(buf)));
+  ASSERT_EQ(supported, false);
+
+  auto source = GetFileSource();
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(*source));
+  EXPECT_EQ(supported, true);
+}
+
+TEST_F(TestOrcFileFormat, PredicatePushdown) {
+  auto source = GetFileSource();
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  // The Fragment doesn't post-filter, so whole stripes are returned
+  opts_->filter = scalar(true);
+  CountRowsAndTasksInScan(fragment, kNumStripes * kRowsPerStripe, kNumStripes);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 0);
+
+  for (int64_t i = 0; i < kNumStripes; ++i) {
+    opts_->filter = ("i64"_ == int64_t(i * kRowsPerStripe + 7)).Copy();
+    CountRowsAndTasksInScan(fragment, kRowsPerStripe, 1);
+  }
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), kNumStripes * (kNumStripes - 1));
+
+  opts_->filter = scalar(false);
+  CountRowsAndTasksInScan(fragment, 0, 0);
+  opts_->filter = ("i64"_ == int64_t(-1)).Copy();
+  CountRowsAndTasksInScan(fragment, 0, 0);
+  opts_->filter = ("str"_ == "1" and "i64"_ == int64_t(0)).Copy();
+  CountRowsAndTasksInScan(fragment, 0, 0);
+
+  opts_->filter = ("i64"_ >= int64_t(2 * kRowsPerStripe)).Copy();
+  CountRowsAndTasksInScan(fragment, 2 * kRowsPerStripe, 2);
+  opts_->filter = ("str"_ == "1" or "str"_ == "3").Copy();
+  CountRowsAndTasksInScan(fragment, 2 * kRowsPerStripe, 2);
+}
+
+TEST_F(TestOrcFileFormat, PredicatePushdownStripeFragments) {
+  auto source = GetFileSource();
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  CountStripesInFragment(fragment, internal::Iota(static_cast<int>(kNumStripes)),
+                         *scalar(true));
+  for (int i = 0; i < kNumStripes; ++i) {
+    CountStripesInFragment(fragment, {i}, "str"_ == std::to_string(i));
+  }
+  CountStripesInFragment(fragment, {}, *scalar(false));
+  CountStripesInFragment(fragment, {1, 2, 3}, "i64"_ >= int64_t(kRowsPerStripe));
+
+  // Pruned stripes are counted in the context
+  auto orc_fragment = internal::checked_pointer_cast<OrcFileFragment>(fragment);
+  ASSERT_OK(format_->GetStripeFragments(
+      *orc_fragment, ("i64"_ >= int64_t(kRowsPerStripe)).Copy(), ctx_));
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 1);
+}
+
+TEST_F(TestOrcFileFormat, ExplicitStripeSelection) {
+  auto source = GetFileSource();
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment,
+                       format_->MakeFragment(*source, opts_, scalar(true), {1, 3}));
+  CountRowsAndTasksInScan(fragment, 2 * kRowsPerStripe, 2);
+
+  // The selection and the filter are combined
+  opts_->filter = ("i64"_ < int64_t(2 * kRowsPerStripe)).Copy();
+  CountRowsAndTasksInScan(fragment, kRowsPerStripe, 1);
+
+  const int out_of_bounds = static_cast<int>(kNumStripes);
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment(*source, opts_, scalar(true),
+                                                       {out_of_bounds}));
+  ASSERT_RAISES(IndexError, fragment->Scan(ctx_));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,7 +17,13 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -25,12 +31,19 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -41,17 +54,337 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+// A range of rows of a RowGroup
+struct RowRange {
+  int64_t offset, length;
+};
+
+template <typename M>
+static Result<SchemaManifest> GetSchemaManifest(
+    const M& metadata, const parquet::ArrowReaderProperties& properties) {
+  SchemaManifest manifest;
+  const std::shared_ptr<const ::arrow::KeyValueMetadata>& key_value_metadata = nullptr;
+  RETURN_NOT_OK(
+      SchemaManifest::Make(metadata.schema(), key_value_metadata, properties, &manifest));
+  return manifest;
+}
+
+// The bounds of a field's values in a column chunk or a page, or `true` if the
+// statistics can't be converted.
+static std::shared_ptr<Expression> StatisticsAsExpression(
+    const Field& field, const parquet::Statistics& statistics) {
+  auto field_expr = field_ref(field.name());
+
+  // Optimize for corner case where all values are nulls
+  if (statistics.num_values() == 0 && statistics.null_count() > 0) {
+    return equal(field_expr, scalar(MakeNullScalar(field.type())));
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  if (!StatisticsAsScalars(statistics, &min, &max).ok()) {
+    return scalar(true);
+  }
+
+  return and_(greater_equal(field_expr, scalar(min)),
+              less_equal(field_expr, scalar(max)));
+}
+
+// The ranges of rows of a RowGroup which the page indexes of the fields
+// referenced by `filter` can't rule out.  Every row of a page whose bounds
+// contradict the filter is ruled out, for each top-level leaf field with a
+// page index.
+static std::vector<RowRange> PageIndexRowRanges(parquet::ParquetFileReader* reader,
+                                                int row_group,
+                                                const SchemaManifest& manifest,
+                                                const Expression& filter) {
+  const int64_t num_rows = reader->metadata()->RowGroup(row_group)->num_rows();
+  auto filter_names = FieldsInExpression(filter);
+  std::unordered_set<std::string> filter_fields{filter_names.cbegin(),
+                                                filter_names.cend()};
+
+  std::vector<RowRange> excluded;
+  for (const auto& schema_field : manifest.schema_fields) {
+    if (!schema_field.is_leaf() ||
+        filter_fields.find(schema_field.field->name()) == filter_fields.end()) {
+      continue;
+    }
+
+    std::unique_ptr<parquet::ColumnIndex> column_index;
+    std::unique_ptr<parquet::OffsetIndex> offset_index;
+    try {
+      auto row_group_reader = reader->RowGroup(row_group);
+      column_index = row_group_reader->GetColumnIndex(schema_field.column_index);
+      if (column_index != nullptr) {
+        offset_index = row_group_reader->GetOffsetIndex(schema_field.column_index);
+      }
+    } catch (const ::parquet::ParquetException&) {
+      // Errors with page indexes are ignored and post-filtering will apply.
+    }
+    if (offset_index == nullptr ||
+        offset_index->num_pages() != column_index->num_pages()) {
+      continue;
+    }
+
+    for (int i = 0; i < offset_index->num_pages(); ++i) {
+      const int64_t first_row = offset_index->page_locations()[i].first_row_index;
+      const int64_t page_num_rows = offset_index->page_num_rows(i, num_rows);
+      auto statistics = column_index->page_statistics(i, page_num_rows);
+      auto expr = filter.Assume(StatisticsAsExpression(*schema_field.field, *statistics));
+      if (expr->IsNull() || expr->Equals(false)) {
+        excluded.push_back({first_row, page_num_rows});
+      }
+    }
+  }
+
+  // Take the complement of the excluded pages
+  std::sort(excluded.begin(), excluded.end(),
+            [](const RowRange& a, const RowRange& b) { return a.offset < b.offset; });
+  std::vector<RowRange> ranges;
+  int64_t position = 0;
+  for (const auto& range : excluded) {
+    if (range.offset > position) {
+      ranges.push_back({position, range.offset - position});
+    }
+    position = std::max(position, range.offset + range.length);
+  }
+  if (position < num_rows) {
+    ranges.push_back({position, num_rows - position});
+  }
+  return ranges;
+}
+
+/// \brief Reads a RowGroup by first reading the fields referenced by the filter,
+/// then reading the other fields only for the rows which satisfy it.
+///
+/// The yielded batches contain the filter's fields followed by the other fields.
+/// Only the rows within row_ranges are read, the others are skipped by every
+/// field. Without late materialization, all fields are read as the other
+/// fields and the batches aren't filtered.
+class LateMaterializingReader {
+ public:
+  using FieldReaders = std::vector<std::shared_ptr<parquet::arrow::ColumnReader>>;
+
+  static Result<RecordBatchIterator> Make(
+      int row_group, const std::vector<int>& column_projection,
+      std::vector<RowRange> row_ranges, bool late_materialization,
+      std::shared_ptr<parquet::arrow::FileReader> reader,
+      std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context) {
+    FieldReaders field_readers;
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(reader->GetFieldReaders({row_group}, column_projection,
+                                          &field_readers, &schema));
+
+    std::unordered_set<std::string> filter_fields;
+    if (late_materialization) {
+      auto filter_names = FieldsInExpression(*options->filter);
+      filter_fields.insert(filter_names.cbegin(), filter_names.cend());
+    }
+
+    LateMaterializingReader out;
+    FieldVector filter_schema, other_schema;
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      const auto& field = schema->field(i);
+      if (filter_fields.find(field->name()) != filter_fields.end()) {
+        out.filter_readers_.push_back(std::move(field_readers[i]));
+        filter_schema.push_back(field);
+      } else {
+        out.other_readers_.push_back(std::move(field_readers[i]));
+        other_schema.push_back(field);
+      }
+    }
+    out.filter_schema_ = arrow::schema(filter_schema);
+    out.other_schema_ = arrow::schema(other_schema);
+    filter_schema.insert(filter_schema.end(), other_schema.begin(), other_schema.end());
+    out.schema_ = arrow::schema(std::move(filter_schema));
+
+    out.row_ranges_ = std::move(row_ranges);
+    out.row_range_ = 0;
+    out.position_ = 0;
+    out.batch_size_ = options->batch_size;
+    out.reader_ = std::move(reader);
+    out.options_ = std::move(options);
+    out.context_ = std::move(context);
+    return RecordBatchIterator(std::move(out));
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    while (row_range_ < row_ranges_.size()) {
+      const RowRange& row_range = row_ranges_[row_range_];
+      if (position_ == row_range.offset + row_range.length) {
+        ++row_range_;
+        continue;
+      }
+      if (position_ < row_range.offset) {
+        RETURN_NOT_OK(SkipRows(filter_readers_, row_range.offset - position_));
+        RETURN_NOT_OK(SkipRows(other_readers_, row_range.offset - position_));
+        position_ = row_range.offset;
+      }
+      const int64_t num_rows =
+          std::min(batch_size_, row_range.offset + row_range.length - position_);
+      position_ += num_rows;
+
+      if (filter_readers_.empty()) {
+        return ReadBatch(other_readers_, other_schema_, num_rows);
+      }
+
+      ARROW_ASSIGN_OR_RAISE(auto filter_batch,
+                            ReadBatch(filter_readers_, filter_schema_, num_rows));
+      ARROW_ASSIGN_OR_RAISE(auto selection,
+                            options_->evaluator->Evaluate(*options_->filter,
+                                                          *filter_batch, context_->pool));
+
+      if (selection.is_scalar()) {
+        const auto& value = *selection.scalar();
+        if (!value.is_valid || !checked_cast<const BooleanScalar&>(value).value) {
+          RETURN_NOT_OK(SkipRows(other_readers_, num_rows));
+          continue;
+        }
+        ARROW_ASSIGN_OR_RAISE(auto other_batch,
+                              ReadBatch(other_readers_, other_schema_, num_rows));
+        return Combine(*filter_batch, *other_batch);
+      }
+
+      auto mask = checked_pointer_cast<BooleanArray>(selection.make_array());
+      auto ranges = SelectedRanges(*mask);
+      if (ranges.empty()) {
+        RETURN_NOT_OK(SkipRows(other_readers_, num_rows));
+        continue;
+      }
+
+      // Read the other fields of the selected ranges only
+      std::vector<ArrayVector> chunks(other_readers_.size());
+      ArrayVector mask_chunks;
+      int64_t position = 0;
+      for (const auto& range : ranges) {
+        RETURN_NOT_OK(SkipRows(other_readers_, range.offset - position));
+        for (size_t i = 0; i < other_readers_.size(); ++i) {
+          ARROW_ASSIGN_OR_RAISE(auto column, ReadColumn(other_readers_[i], range.length));
+          chunks[i].push_back(std::move(column));
+        }
+        mask_chunks.push_back(mask->Slice(range.offset, range.length));
+        position = range.offset + range.length;
+      }
+      RETURN_NOT_OK(SkipRows(other_readers_, num_rows - position));
+
+      ArrayVector columns(other_readers_.size());
+      for (size_t i = 0; i < other_readers_.size(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(columns[i], Flatten(chunks[i]));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto read_mask, Flatten(mask_chunks));
+      auto other_batch = RecordBatch::Make(other_schema_, read_mask->length(), columns);
+
+      ARROW_ASSIGN_OR_RAISE(filter_batch, options_->evaluator->Filter(
+                                              selection, filter_batch, context_->pool));
+      ARROW_ASSIGN_OR_RAISE(other_batch,
+                            options_->evaluator->Filter(compute::Datum(read_mask),
+                                                        other_batch, context_->pool));
+      return Combine(*filter_batch, *other_batch);
+    }
+
+    return nullptr;
+  }
+
+ private:
+  // Shorter runs of rejected rows are read and filtered out rather than skipped,
+  // which avoids fragmenting the reads of the other fields
+  static constexpr int64_t kMinSkippedRows = 1024;
+
+  // The ranges of rows to read, covering every row selected by mask
+  static std::vector<RowRange> SelectedRanges(const BooleanArray& mask) {
+    std::vector<RowRange> ranges;
+    for (int64_t i = 0; i < mask.length(); ++i) {
+      if (!mask.IsValid(i) || !mask.Value(i)) {
+        continue;
+      }
+      if (!ranges.empty() &&
+          i - (ranges.back().offset + ranges.back().length) < kMinSkippedRows) {
+        ranges.back().length = i + 1 - ranges.back().offset;
+      } else {
+        ranges.push_back({i, 1});
+      }
+    }
+    return ranges;
+  }
+
+  Result<std::shared_ptr<Array>> Flatten(const ArrayVector& chunks) const {
+    if (chunks.size() == 1) {
+      return chunks[0];
+    }
+    std::shared_ptr<Array> out;
+    RETURN_NOT_OK(Concatenate(chunks, context_->pool, &out));
+    return out;
+  }
+
+  Result<std::shared_ptr<Array>> ReadColumn(
+      const std::shared_ptr<parquet::arrow::ColumnReader>& reader,
+      int64_t num_rows) const {
+    std::shared_ptr<ChunkedArray> column;
+    RETURN_NOT_OK(reader->NextBatch(num_rows, &column));
+    if (column->length() != num_rows) {
+      return Status::IOError("Expected to read ", num_rows,
+                             " rows from a row group but got ", column->length());
+    }
+    return Flatten(column->chunks());
+  }
+
+  Result<std::shared_ptr<RecordBatch>> ReadBatch(const FieldReaders& readers,
+                                                 const std::shared_ptr<Schema>& schema,
+                                                 int64_t num_rows) const {
+    ArrayVector columns(readers.size());
+    for (size_t i = 0; i < readers.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(columns[i], ReadColumn(readers[i], num_rows));
+    }
+    return RecordBatch::Make(schema, num_rows, std::move(columns));
+  }
+
+  static Status SkipRows(const FieldReaders& readers, int64_t num_rows) {
+    if (num_rows == 0) {
+      return Status::OK();
+    }
+    for (const auto& reader : readers) {
+      RETURN_NOT_OK(reader->Skip(num_rows));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<RecordBatch> Combine(const RecordBatch& filter_batch,
+                                       const RecordBatch& other_batch) const {
+    ArrayVector columns = filter_batch.columns();
+    for (const auto& column : other_batch.columns()) {
+      columns.push_back(column);
+    }
+    return RecordBatch::Make(schema_, filter_batch.num_rows(), std::move(columns));
+  }
+
+  FieldReaders filter_readers_, other_readers_;
+  std::shared_ptr<Schema> filter_schema_, other_schema_, schema_;
+  std::vector<RowRange> row_ranges_;
+  size_t row_range_;
+  int64_t position_, batch_size_;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+  // The field readers refer to the FileReader
+  std::shared_ptr<parquet::arrow::FileReader> reader_;
+};
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(int row_group, std::vector<int> column_projection,
+                  bool late_materialization,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
+                  parquet::ArrowReaderProperties arrow_properties,
                   std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
-        reader_(std::move(reader)) {}
+        late_materialization_(late_materialization),
+        reader_(std::move(reader)),
+        arrow_properties_(std::move(arrow_properties)) {}
 
   Result<RecordBatchIterator> Execute() override {
     // The construction of parquet's RecordBatchReader is deferred here to
@@ -60,6 +393,13 @@ class ParquetScanTask : public ScanTask {
     //
     // Thus the memory incurred by the RecordBatchReader is allocated when
     // Scan is called.
+    auto row_ranges = SelectedRowRanges();
+    if (late_materialization_ || row_ranges.size() != 1 || row_ranges[0].offset != 0 ||
+        row_ranges[0].length != num_rows()) {
+      return LateMaterializingReader::Make(row_group_, column_projection_,
+                                           std::move(row_ranges), late_materialization_,
+                                           reader_, options_, context_);
+    }
     std::unique_ptr<RecordBatchReader> record_batch_reader;
     RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
                                                 &record_batch_reader));
@@ -67,19 +407,163 @@ class ParquetScanTask : public ScanTask {
   }
 
  private:
+  int64_t num_rows() const {
+    return reader_->parquet_reader()->metadata()->RowGroup(row_group_)->num_rows();
+  }
+
+  // The rows which the page indexes of the filter's fields can't rule out
+  std::vector<RowRange> SelectedRowRanges() const {
+    if (options_->filter->Equals(true)) {
+      return {{0, num_rows()}};
+    }
+    auto maybe_manifest =
+        GetSchemaManifest(*reader_->parquet_reader()->metadata(), arrow_properties_);
+    if (!maybe_manifest.ok()) {
+      return {{0, num_rows()}};
+    }
+    return PageIndexRowRanges(reader_->parquet_reader(), row_group_, *maybe_manifest,
+                              *options_->filter);
+  }
+
   int row_group_;
   std::vector<int> column_projection_;
+  bool late_materialization_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  parquet::ArrowReaderProperties arrow_properties_;
 };
 
-static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
-    const FileSource& source, parquet::ReaderProperties properties) {
+static bool IsMetadataCacheable(const fs::FileInfo& info) {
+  return info.IsFile() && info.size() != fs::kNoSize && info.mtime() != fs::kNoTime;
+}
+
+static int64_t MtimeNanos(const fs::FileInfo& info) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             info.mtime().time_since_epoch())
+      .count();
+}
+
+// Filesystems are identified like FileSource does, by address
+static std::string MetadataCacheKey(const fs::FileSystem& filesystem,
+                                    const fs::FileInfo& info) {
+  return std::to_string(reinterpret_cast<uintptr_t>(&filesystem)) + ":" + info.path();
+}
+
+const std::shared_ptr<ParquetMetadataCache>& ParquetMetadataCache::Global() {
+  static std::shared_ptr<ParquetMetadataCache> cache =
+      std::make_shared<ParquetMetadataCache>();
+  return cache;
+}
+
+std::shared_ptr<parquet::FileMetaData> ParquetMetadataCache::Get(
+    const fs::FileSystem& filesystem, const fs::FileInfo& info) {
+  if (!IsMetadataCacheable(info)) {
+    ++misses_;
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(MetadataCacheKey(filesystem, info));
+  if (it == entries_.end() || it->second->size != info.size() ||
+      it->second->mtime != MtimeNanos(info)) {
+    ++misses_;
+    return nullptr;
+  }
+
+  lru_.splice(lru_.begin(), lru_, it->second);
+  ++hits_;
+  return it->second->metadata;
+}
+
+void ParquetMetadataCache::Put(const fs::FileSystem& filesystem,
+                               const fs::FileInfo& info,
+                               std::shared_ptr<parquet::FileMetaData> metadata) {
+  if (!IsMetadataCacheable(info) || metadata == nullptr) {
+    return;
+  }
+
+  Entry entry;
+  entry.key = MetadataCacheKey(filesystem, info);
+  entry.size = info.size();
+  entry.mtime = MtimeNanos(info);
+  entry.charge = static_cast<int64_t>(metadata->size());
+  entry.metadata = std::move(metadata);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(entry.key);
+  if (it != entries_.end()) {
+    total_charge_ -= it->second->charge;
+    lru_.erase(it->second);
+    entries_.erase(it);
+  }
+  total_charge_ += entry.charge;
+  lru_.push_front(std::move(entry));
+  entries_[lru_.front().key] = lru_.begin();
+  Evict();
+}
+
+void ParquetMetadataCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  lru_.clear();
+  entries_.clear();
+  total_charge_ = 0;
+}
+
+void ParquetMetadataCache::SetCapacity(int64_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  Evict();
+}
+
+int64_t ParquetMetadataCache::capacity() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return capacity_;
+}
+
+int64_t ParquetMetadataCache::num_entries() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int64_t>(entries_.size());
+}
+
+void ParquetMetadataCache::Evict() {
+  while (total_charge_ > capacity_ && !lru_.empty()) {
+    total_charge_ -= lru_.back().charge;
+    entries_.erase(lru_.back().key);
+    lru_.pop_back();
+  }
+}
+
+// Open a reader, reusing the footer cached for the source if any. May throw
+// parquet::ParquetException.
+static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReaderWithCache(
+    const FileSource& source, parquet::ReaderProperties properties,
+    ParquetMetadataCache* cache) {
+  // Decrypting a footer also sets up the reader's decryptor, so encrypted files
+  // are always parsed.
+  if (cache == nullptr || source.type() != FileSource::PATH ||
+      properties.file_decryption_properties() != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto info, source.filesystem()->GetFileInfo(source.path()));
+  auto metadata = cache->Get(*source.filesystem(), info);
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  auto reader =
+      parquet::ParquetFileReader::Open(std::move(input), std::move(properties), metadata);
+  if (metadata == nullptr) {
+    cache->Put(*source.filesystem(), info, reader->metadata());
+  }
+  return reader;
+}
+
+static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
+    const FileSource& source, parquet::ReaderProperties properties,
+    ParquetMetadataCache* cache) {
   try {
-    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    return OpenReaderWithCache(source, std::move(properties), cache);
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
@@ -113,16 +597,6 @@ static parquet::ArrowReaderProperties MakeArrowReaderProperties(
   return properties;
 }
 
-template <typename M>
-static Result<SchemaManifest> GetSchemaManifest(
-    const M& metadata, const parquet::ArrowReaderProperties& properties) {
-  SchemaManifest manifest;
-  const std::shared_ptr<const ::arrow::KeyValueMetadata>& key_value_metadata = nullptr;
-  RETURN_NOT_OK(
-      SchemaManifest::Make(metadata.schema(), key_value_metadata, properties, &manifest));
-  return manifest;
-}
-
 static std::shared_ptr<Expression> ColumnChunkStatisticsAsExpression(
     const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
   // For the remaining of this function, failure to extract/parse statistics
@@ -136,8 +610,6 @@ static std::shared_ptr<Expression> ColumnChunkStatisticsAsExpression(
   }
 
   auto column_metadata = metadata.ColumnChunk(schema_field.column_index);
-  auto field = schema_field.field;
-  auto field_expr = field_ref(field->name());
 
   // In case of missing statistics, return nothing.
   if (!column_metadata->is_stats_set()) {
@@ -149,18 +621,7 @@ static std::shared_ptr<Expression> ColumnChunkStatisticsAsExpression(
     return scalar(true);
   }
 
-  // Optimize for corner case where all values are nulls
-  if (statistics->num_values() == statistics->null_count()) {
-    return equal(field_expr, scalar(MakeNullScalar(field->type())));
-  }
-
-  std::shared_ptr<Scalar> min, max;
-  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
-    return scalar(true);
-  }
-
-  return and_(greater_equal(field_expr, scalar(min)),
-              less_equal(field_expr, scalar(max)));
+  return StatisticsAsExpression(*schema_field.field, *statistics);
 }
 
 static Result<std::shared_ptr<Expression>> RowGroupStatisticsAsExpression(
@@ -176,6 +637,206 @@ static Result<std::shared_ptr<Expression>> RowGroupStatisticsAsExpression(
   return expressions.empty() ? scalar(true) : and_(expressions);
 }
 
+template <typename ArrowType, typename PhysicalType>
+static uint64_t BloomFilterHashAs(const parquet::BloomFilter& bloom_filter,
+                                  const Array& values, int64_t i) {
+  const auto& typed_values = checked_cast<const NumericArray<ArrowType>&>(values);
+  return bloom_filter.Hash(static_cast<PhysicalType>(typed_values.Value(i)));
+}
+
+// Hash values[i] as the Parquet writer hashes values of the given physical
+// type into Bloom filters.  Returns false if the conversion from the Arrow
+// type to the physical type is not known, or if equality of the values is not
+// equality of their hashes (floating point).
+static bool BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                            parquet::Type::type physical_type, const Array& values,
+                            int64_t i, uint64_t* out) {
+  switch (physical_type) {
+    case parquet::Type::INT32:
+      switch (values.type_id()) {
+        case Type::INT8:
+          *out = BloomFilterHashAs<Int8Type, int32_t>(bloom_filter, values, i);
+          return true;
+        case Type::UINT8:
+          *out = BloomFilterHashAs<UInt8Type, int32_t>(bloom_filter, values, i);
+          return true;
+        case Type::INT16:
+          *out = BloomFilterHashAs<Int16Type, int32_t>(bloom_filter, values, i);
+          return true;
+        case Type::UINT16:
+          *out = BloomFilterHashAs<UInt16Type, int32_t>(bloom_filter, values, i);
+          return true;
+        case Type::INT32:
+          *out = BloomFilterHashAs<Int32Type, int32_t>(bloom_filter, values, i);
+          return true;
+        case Type::UINT32:
+          *out = BloomFilterHashAs<UInt32Type, int32_t>(bloom_filter, values, i);
+          return true;
+        case Type::DATE32:
+          *out = BloomFilterHashAs<Date32Type, int32_t>(bloom_filter, values, i);
+          return true;
+        default:
+          return false;
+      }
+    case parquet::Type::INT64:
+      switch (values.type_id()) {
+        case Type::UINT32:
+          *out = BloomFilterHashAs<UInt32Type, int64_t>(bloom_filter, values, i);
+          return true;
+        case Type::INT64:
+          *out = BloomFilterHashAs<Int64Type, int64_t>(bloom_filter, values, i);
+          return true;
+        case Type::UINT64:
+          *out = BloomFilterHashAs<UInt64Type, int64_t>(bloom_filter, values, i);
+          return true;
+        default:
+          return false;
+      }
+    case parquet::Type::FLOAT:
+    case parquet::Type::DOUBLE:
+      // Floating point values are hashed by their bit patterns, but -0.0 == 0.0
+      // and NaN != NaN: a missing hash cannot prove the value is absent.
+      return false;
+    case parquet::Type::BYTE_ARRAY: {
+      if (values.type_id() != Type::STRING && values.type_id() != Type::BINARY) {
+        return false;
+      }
+      parquet::ByteArray value(checked_cast<const BinaryArray&>(values).GetView(i));
+      *out = bloom_filter.Hash(&value);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// The Bloom filters of the column chunks of a row group, read on demand
+class RowGroupBloomFilters {
+ public:
+  RowGroupBloomFilters(parquet::ParquetFileReader* reader, int row_group,
+                       const SchemaManifest& manifest)
+      : reader_(reader),
+        row_group_(row_group),
+        manifest_(manifest),
+        metadata_(reader->metadata()->RowGroup(row_group)) {}
+
+  // Whether the field may contain any of `values`.  True whenever it cannot
+  // be decided, e.g. if the column chunk has no Bloom filter.
+  bool MayContainAny(const std::string& field_name, const Array& values) {
+    const SchemaField* schema_field = nullptr;
+    const parquet::BloomFilter* bloom_filter = nullptr;
+    if (!GetBloomFilter(field_name, &schema_field, &bloom_filter)) {
+      return true;
+    }
+    if (!values.type()->Equals(*schema_field->field->type())) {
+      return true;
+    }
+
+    auto physical_type = manifest_.descr->Column(schema_field->column_index)
+                             ->physical_type();
+    for (int64_t i = 0; i < values.length(); i++) {
+      uint64_t hash;
+      if (values.IsNull(i) ||
+          !BloomFilterHash(*bloom_filter, physical_type, values, i, &hash) ||
+          bloom_filter->FindHash(hash)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  bool GetBloomFilter(const std::string& field_name, const SchemaField** schema_field,
+                      const parquet::BloomFilter** bloom_filter) {
+    // Only top-level leaf columns are supported
+    for (const auto& field : manifest_.schema_fields) {
+      if (field.is_leaf() && field.field->name() == field_name) {
+        *schema_field = &field;
+        break;
+      }
+    }
+    if (*schema_field == nullptr) {
+      return false;
+    }
+
+    const int column_index = (*schema_field)->column_index;
+    if (!metadata_->ColumnChunk(column_index)->has_bloom_filter()) {
+      return false;
+    }
+
+    auto it = bloom_filters_.find(column_index);
+    if (it == bloom_filters_.end()) {
+      std::unique_ptr<parquet::BloomFilter> read_filter;
+      try {
+        read_filter = reader_->RowGroup(row_group_)->GetColumnBloomFilter(column_index);
+      } catch (const ::parquet::ParquetException&) {
+        // Errors with Bloom filters are ignored and post-filtering will apply.
+      }
+      it = bloom_filters_.emplace(column_index, std::move(read_filter)).first;
+    }
+    *bloom_filter = it->second.get();
+    return *bloom_filter != nullptr;
+  }
+
+  parquet::ParquetFileReader* reader_;
+  int row_group_;
+  const SchemaManifest& manifest_;
+  std::unique_ptr<parquet::RowGroupMetaData> metadata_;
+  std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters_;
+};
+
+// Whether Bloom filters prove that no row of a row group satisfies `expr`,
+// which is the case if an equality or IN predicate between a field and
+// literal values must be satisfied and none of the values are in the
+// field's Bloom filter.
+static bool BloomFiltersExclude(const Expression& expr,
+                                RowGroupBloomFilters* bloom_filters) {
+  switch (expr.type()) {
+    case ExpressionType::AND: {
+      const auto& and_expr = checked_cast<const AndExpression&>(expr);
+      return BloomFiltersExclude(*and_expr.left_operand(), bloom_filters) ||
+             BloomFiltersExclude(*and_expr.right_operand(), bloom_filters);
+    }
+    case ExpressionType::OR: {
+      const auto& or_expr = checked_cast<const OrExpression&>(expr);
+      return BloomFiltersExclude(*or_expr.left_operand(), bloom_filters) &&
+             BloomFiltersExclude(*or_expr.right_operand(), bloom_filters);
+    }
+    case ExpressionType::COMPARISON: {
+      const auto& comparison = checked_cast<const ComparisonExpression&>(expr);
+      if (comparison.op() != compute::CompareOperator::EQUAL) {
+        return false;
+      }
+      const Expression* lhs = comparison.left_operand().get();
+      const Expression* rhs = comparison.right_operand().get();
+      if (lhs->type() == ExpressionType::SCALAR) {
+        std::swap(lhs, rhs);
+      }
+      if (lhs->type() != ExpressionType::FIELD || rhs->type() != ExpressionType::SCALAR) {
+        return false;
+      }
+      const auto& value = checked_cast<const ScalarExpression&>(*rhs).value();
+      auto maybe_values = MakeArrayFromScalar(*value, 1);
+      if (!maybe_values.ok()) {
+        return false;
+      }
+      return !bloom_filters->MayContainAny(
+          checked_cast<const FieldExpression&>(*lhs).name(), **maybe_values);
+    }
+    case ExpressionType::IN: {
+      const auto& in_expr = checked_cast<const InExpression&>(expr);
+      if (in_expr.operand()->type() != ExpressionType::FIELD) {
+        return false;
+      }
+      return !bloom_filters->MayContainAny(
+          checked_cast<const FieldExpression&>(*in_expr.operand()).name(),
+          *in_expr.set());
+    }
+    default:
+      return false;
+  }
+}
+
 // Skip RowGroups with a filter and metadata
 class RowGroupSkipper {
  public:
@@ -183,14 +844,19 @@ class RowGroupSkipper {
 
   RowGroupSkipper(std::shared_ptr<parquet::FileMetaData> metadata,
                   parquet::ArrowReaderProperties arrow_properties,
-                  std::shared_ptr<Expression> filter, std::vector<int> row_groups)
+                  std::shared_ptr<Expression> filter, std::vector<int> row_groups,
+                  parquet::ParquetFileReader* reader = NULLPTR,
+                  std::atomic<int64_t>* num_row_groups_pruned = NULLPTR)
       : metadata_(std::move(metadata)),
         arrow_properties_(std::move(arrow_properties)),
         filter_(std::move(filter)),
         row_group_idx_(0),
         row_groups_(std::move(row_groups)),
         num_row_groups_(row_groups_.empty() ? metadata_->num_row_groups()
-                                            : static_cast<int>(row_groups_.size())) {}
+                                            : static_cast<int>(row_groups_.size())),
+        rows_skipped_(0),
+        reader_(reader),
+        num_row_groups_pruned_(num_row_groups_pruned) {}
 
   int Next() {
     while (row_group_idx_ < num_row_groups_) {
@@ -200,8 +866,11 @@ class RowGroupSkipper {
       const auto row_group_metadata = metadata_->RowGroup(row_group);
 
       const int64_t num_rows = row_group_metadata->num_rows();
-      if (CanSkip(*row_group_metadata)) {
+      if (CanSkip(row_group, *row_group_metadata)) {
         rows_skipped_ += num_rows;
+        if (num_row_groups_pruned_ != NULLPTR) {
+          ++*num_row_groups_pruned_;
+        }
         continue;
       }
 
@@ -212,7 +881,7 @@ class RowGroupSkipper {
   }
 
  private:
-  bool CanSkip(const parquet::RowGroupMetaData& metadata) const {
+  bool CanSkip(int row_group, const parquet::RowGroupMetaData& metadata) {
     auto maybe_stats_expr = RowGroupStatisticsAsExpression(metadata, arrow_properties_);
     // Errors with statistics are ignored and post-filtering will apply.
     if (!maybe_stats_expr.ok()) {
@@ -221,7 +890,27 @@ class RowGroupSkipper {
 
     auto stats_expr = maybe_stats_expr.ValueOrDie();
     auto expr = filter_->Assume(stats_expr);
-    return (expr->IsNull() || expr->Equals(false));
+    if (expr->IsNull() || expr->Equals(false)) {
+      return true;
+    }
+
+    // Statistics can't rule out point lookups on high-cardinality columns,
+    // Bloom filters can.
+    if (reader_ == NULLPTR) {
+      return false;
+    }
+    if (bloom_filter_manifest_ == NULLPTR) {
+      // Built once for all row groups
+      auto maybe_manifest = GetSchemaManifest(*metadata_, arrow_properties_);
+      if (!maybe_manifest.ok()) {
+        reader_ = NULLPTR;
+        return false;
+      }
+      bloom_filter_manifest_ =
+          std::make_shared<SchemaManifest>(std::move(maybe_manifest).ValueOrDie());
+    }
+    RowGroupBloomFilters bloom_filters(reader_, row_group, *bloom_filter_manifest_);
+    return BloomFiltersExclude(*filter_, &bloom_filters);
   }
 
   std::shared_ptr<parquet::FileMetaData> metadata_;
@@ -231,6 +920,12 @@ class RowGroupSkipper {
   std::vector<int> row_groups_;
   int num_row_groups_;
   int64_t rows_skipped_;
+  // Optional reader of the file's Bloom filters
+  parquet::ParquetFileReader* reader_;
+  // Schema manifest used to look up Bloom filters, built on first use
+  std::shared_ptr<SchemaManifest> bloom_filter_manifest_;
+  // Optional counter of skipped row groups, e.g. ScanContext's
+  std::atomic<int64_t>* num_row_groups_pruned_;
 };
 
 class ParquetScanTaskIterator {
@@ -239,21 +934,27 @@ class ParquetScanTaskIterator {
                                        std::shared_ptr<ScanContext> context,
                                        std::unique_ptr<parquet::ParquetFileReader> reader,
                                        parquet::ArrowReaderProperties arrow_properties,
-                                       const std::vector<int>& row_groups) {
+                                       const std::vector<int>& row_groups,
+                                       bool late_materialization) {
     auto metadata = reader->metadata();
 
     auto column_projection = InferColumnProjection(*metadata, arrow_properties, options);
+    late_materialization = late_materialization &&
+                           FilterSplitsProjection(*metadata, arrow_properties, *options);
 
+    // Owned by arrow_reader, itself owned by the ParquetScanTaskIterator
+    parquet::ParquetFileReader* parquet_reader = reader.get();
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
                                                    arrow_properties, &arrow_reader));
 
-    RowGroupSkipper skipper(std::move(metadata), std::move(arrow_properties),
-                            options->filter, row_groups);
+    RowGroupSkipper skipper(std::move(metadata), arrow_properties, options->filter,
+                            row_groups, parquet_reader, &context->num_row_groups_pruned);
 
     return ScanTaskIterator(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(column_projection),
-        std::move(skipper), std::move(arrow_reader)));
+        late_materialization, std::move(skipper), std::move(arrow_reader),
+        std::move(arrow_properties)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -265,7 +966,8 @@ class ParquetScanTaskIterator {
     }
 
     return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+        new ParquetScanTask(row_group, column_projection_, late_materialization_,
+                            reader_, arrow_properties_, options_, context_));
   }
 
  private:
@@ -303,6 +1005,40 @@ class ParquetScanTaskIterator {
     return columns_selection;
   }
 
+  // Late materialization only pays off when the filter references some, but
+  // not all, of the fields read from the file.
+  static bool FilterSplitsProjection(
+      const parquet::FileMetaData& metadata,
+      const parquet::ArrowReaderProperties& arrow_properties,
+      const ScanOptions& options) {
+    auto maybe_manifest = GetSchemaManifest(metadata, arrow_properties);
+    if (!maybe_manifest.ok()) {
+      return false;
+    }
+    auto manifest = std::move(maybe_manifest).ValueOrDie();
+
+    auto materialized_names = options.MaterializedFields();
+    std::unordered_set<std::string> materialized_fields{materialized_names.cbegin(),
+                                                        materialized_names.cend()};
+    auto filter_names = FieldsInExpression(*options.filter);
+    std::unordered_set<std::string> filter_fields{filter_names.cbegin(),
+                                                  filter_names.cend()};
+
+    bool reads_filter_field = false, reads_other_field = false;
+    for (const auto& schema_field : manifest.schema_fields) {
+      const auto& name = schema_field.field->name();
+      if (materialized_fields.find(name) == materialized_fields.end()) {
+        continue;
+      }
+      if (filter_fields.find(name) != filter_fields.end()) {
+        reads_filter_field = true;
+      } else {
+        reads_other_field = true;
+      }
+    }
+    return reads_filter_field && reads_other_field;
+  }
+
   static void AddColumnIndices(const SchemaField& schema_field,
                                std::vector<int>* column_projection) {
     if (schema_field.is_leaf()) {
@@ -317,19 +1053,25 @@ class ParquetScanTaskIterator {
 
   ParquetScanTaskIterator(std::shared_ptr<ScanOptions> options,
                           std::shared_ptr<ScanContext> context,
-                          std::vector<int> column_projection, RowGroupSkipper skipper,
-                          std::unique_ptr<parquet::arrow::FileReader> reader)
+                          std::vector<int> column_projection, bool late_materialization,
+                          RowGroupSkipper skipper,
+                          std::unique_ptr<parquet::arrow::FileReader> reader,
+                          parquet::ArrowReaderProperties arrow_properties)
       : options_(std::move(options)),
         context_(std::move(context)),
         column_projection_(std::move(column_projection)),
+        late_materialization_(late_materialization),
         skipper_(std::move(skipper)),
-        reader_(std::move(reader)) {}
+        reader_(std::move(reader)),
+        arrow_properties_(std::move(arrow_properties)) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   std::vector<int> column_projection_;
+  bool late_materialization_;
   RowGroupSkipper skipper_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  parquet::ArrowReaderProperties arrow_properties_;
 };
 
 ParquetFileFormat::ParquetFileFormat(const parquet::ReaderProperties& reader_properties) {
@@ -341,10 +1083,10 @@ ParquetFileFormat::ParquetFileFormat(const parquet::ReaderProperties& reader_pro
 
 Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
   try {
-    ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
     auto properties = MakeReaderProperties(*this);
-    auto reader =
-        parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          OpenReaderWithCache(source, std::move(properties),
+                                              reader_options.metadata_cache.get()));
     auto metadata = reader->metadata();
     return metadata != nullptr && metadata->can_decompress();
   } catch (const ::parquet::ParquetInvalidOrCorruptedFileException& e) {
@@ -361,7 +1103,8 @@ Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
 Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
     const FileSource& source) const {
   auto properties = MakeReaderProperties(*this);
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties)));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties),
+                                                reader_options.metadata_cache.get()));
 
   auto arrow_properties =
       MakeArrowReaderProperties(*this, parquet::kArrowDefaultBatchSize, *reader);
@@ -385,7 +1128,8 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     const FileSource& source, std::shared_ptr<ScanOptions> options,
     std::shared_ptr<ScanContext> context, const std::vector<int>& row_groups) const {
   auto properties = MakeReaderProperties(*this, context->pool);
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties)));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties),
+                                                reader_options.metadata_cache.get()));
 
   for (int i : row_groups) {
     if (i >= reader->metadata()->num_row_groups()) {
@@ -398,7 +1142,35 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
   auto arrow_properties = MakeArrowReaderProperties(*this, options->batch_size, *reader);
   return ParquetScanTaskIterator::Make(std::move(options), std::move(context),
                                        std::move(reader), std::move(arrow_properties),
-                                       row_groups);
+                                       row_groups, reader_options.late_materialization);
+}
+
+Result<util::optional<int64_t>> ParquetFileFormat::CountRows(
+    const FileSource& source, std::shared_ptr<ScanContext> context) const {
+  return CountRows(source, std::move(context), {});
+}
+
+Result<util::optional<int64_t>> ParquetFileFormat::CountRows(
+    const FileSource& source, std::shared_ptr<ScanContext> context,
+    const std::vector<int>& row_groups) const {
+  auto properties = MakeReaderProperties(*this, context->pool);
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties),
+                                                reader_options.metadata_cache.get()));
+  auto metadata = reader->metadata();
+
+  if (row_groups.empty()) {
+    return metadata->num_rows();
+  }
+
+  int64_t num_rows = 0;
+  for (int i : row_groups) {
+    if (i >= metadata->num_row_groups()) {
+      return Status::IndexError("trying to count row group ", i, " but ", source.path(),
+                                " only has ", metadata->num_row_groups(), " row groups");
+    }
+    num_rows += metadata->RowGroup(i)->num_rows();
+  }
+  return num_rows;
 }
 
 Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragment(
@@ -418,10 +1190,11 @@ Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragment(
 }
 
 Result<FragmentIterator> ParquetFileFormat::GetRowGroupFragments(
-    const ParquetFileFragment& fragment, std::shared_ptr<Expression> extra_filter) {
+    const ParquetFileFragment& fragment, std::shared_ptr<Expression> extra_filter,
+    std::shared_ptr<ScanContext> context) {
   auto properties = MakeReaderProperties(*this);
-  ARROW_ASSIGN_OR_RAISE(auto reader,
-                        OpenReader(fragment.source(), std::move(properties)));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(fragment.source(), std::move(properties),
+                                                reader_options.metadata_cache.get()));
 
   auto arrow_properties =
       MakeArrowReaderProperties(*this, parquet::kArrowDefaultBatchSize, *reader);
@@ -439,7 +1212,8 @@ Result<FragmentIterator> ParquetFileFormat::GetRowGroupFragments(
   }
 
   RowGroupSkipper skipper(std::move(metadata), std::move(arrow_properties),
-                          new_options->filter, std::move(row_groups));
+                          new_options->filter, std::move(row_groups), reader.get(),
+                          context ? &context->num_row_groups_pruned : NULLPTR);
 
   for (int i = 0, row_group = skipper.Next();
        row_group != RowGroupSkipper::kIterationDone; row_group = skipper.Next()) {
@@ -451,11 +1225,65 @@ Result<FragmentIterator> ParquetFileFormat::GetRowGroupFragments(
   return MakeVectorIterator(std::move(fragments));
 }
 
+namespace {
+
+class ParquetFileWriter : public FileWriter {
+ public:
+  ParquetFileWriter(std::shared_ptr<io::OutputStream> destination,
+                    std::unique_ptr<parquet::arrow::FileWriter> writer,
+                    std::shared_ptr<Schema> schema)
+      : FileWriter(std::move(schema)),
+        destination_(std::move(destination)),
+        writer_(std::move(writer)) {}
+
+  Status Write(const RecordBatch& batch) override {
+    return writer_->WriteRecordBatch(batch);
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::unique_ptr<parquet::arrow::FileWriter> writer_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<FileWriter>> ParquetFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<ScanContext> context) {
+  auto properties = writer_options.writer_properties;
+  if (properties == nullptr) {
+    properties = parquet::default_writer_properties();
+  }
+  auto arrow_properties = writer_options.arrow_writer_properties;
+  if (arrow_properties == nullptr) {
+    arrow_properties = parquet::default_arrow_writer_properties();
+  }
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*schema, context->pool, destination,
+                                                 std::move(properties),
+                                                 std::move(arrow_properties), &writer));
+  return std::make_shared<ParquetFileWriter>(std::move(destination), std::move(writer),
+                                             std::move(schema));
+}
+
 Result<ScanTaskIterator> ParquetFileFragment::Scan(std::shared_ptr<ScanContext> context) {
   return parquet_format().ScanFile(source_, scan_options_, std::move(context),
                                    row_groups_);
 }
 
+Result<util::optional<int64_t>> ParquetFileFragment::CountRows(
+    std::shared_ptr<ScanContext> context) {
+  if (!scan_options_->filter->Equals(true)) {
+    return util::nullopt;
+  }
+  return parquet_format().CountRows(source_, std::move(context), row_groups_);
+}
+
 const ParquetFileFormat& ParquetFileFragment::parquet_format() const {
   return internal::checked_cast<const ParquetFileFormat&>(*format_);
 }
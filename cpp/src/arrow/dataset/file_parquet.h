@@ -17,8 +17,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -34,12 +39,80 @@ class FileMetaData;
 class FileDecryptionProperties;
 class ReaderProperties;
 class ArrowReaderProperties;
+class WriterProperties;
+class ArrowWriterProperties;
 }  // namespace parquet
 
 namespace arrow {
 namespace dataset {
 
-/// \brief A FileFormat implementation that reads from Parquet files
+/// \brief A size-bounded, in-memory LRU cache of deserialized Parquet footers
+///
+/// Entries are keyed on a file's filesystem and path, and are only used when the
+/// file's size and modification time match the ones recorded, so rewritten files
+/// are parsed again. Files whose size or modification time is unknown are never
+/// cached. The capacity is expressed in bytes of serialized footers.
+///
+/// A ParquetFileFormat consults the cache set in its reader_options; Global()
+/// provides a cache shared by the whole process.
+class ARROW_DS_EXPORT ParquetMetadataCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 64 << 20;
+
+  explicit ParquetMetadataCache(int64_t capacity = kDefaultCapacity)
+      : capacity_(capacity) {}
+
+  /// \brief The process-wide cache.
+  static const std::shared_ptr<ParquetMetadataCache>& Global();
+
+  /// \brief Return the cached metadata of a file, or null if no valid entry exists.
+  std::shared_ptr<parquet::FileMetaData> Get(const fs::FileSystem& filesystem,
+                                             const fs::FileInfo& info);
+
+  /// \brief Record the metadata of a file, replacing any previous entry and evicting
+  /// the least recently used entries beyond the capacity.
+  void Put(const fs::FileSystem& filesystem, const fs::FileInfo& info,
+           std::shared_ptr<parquet::FileMetaData> metadata);
+
+  /// \brief Drop all entries. The counters are left untouched.
+  void Clear();
+
+  /// \brief Change the capacity, evicting entries as necessary.
+  void SetCapacity(int64_t capacity);
+
+  int64_t capacity() const;
+
+  /// \brief The number of cached entries, valid or not.
+  int64_t num_entries() const;
+
+  /// \brief The number of lookups which returned valid metadata.
+  int64_t hits() const { return hits_.load(); }
+
+  /// \brief The number of lookups which did not.
+  int64_t misses() const { return misses_.load(); }
+
+ private:
+  struct Entry {
+    std::string key;
+    int64_t size;
+    int64_t mtime;
+    int64_t charge;
+    std::shared_ptr<parquet::FileMetaData> metadata;
+  };
+
+  void Evict();
+
+  mutable std::mutex mutex_;
+  int64_t capacity_;
+  int64_t total_charge_ = 0;
+  // Most recently used first
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> entries_;
+
+  std::atomic<int64_t> hits_{0}, misses_{0};
+};
+
+/// \brief A FileFormat implementation that reads from and writes to Parquet files
 class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
  public:
   ParquetFileFormat() = default;
@@ -79,8 +152,28 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// @{
     std::unordered_set<std::string> dict_columns;
     /// @}
+
+    /// Read the columns referenced by the scan's filter ahead of the other
+    /// projected columns, then only decode the latter for rows which satisfy
+    /// the filter. Runs of rejected rows are skipped, including whole data
+    /// pages of flat columns. Pays off for selective filters.
+    bool late_materialization = false;
+
+    /// Cache of deserialized footers consulted when opening files stored in a
+    /// filesystem, so that files scanned repeatedly are only parsed once. Files
+    /// with decryption properties bypass it. Disabled if null.
+    std::shared_ptr<ParquetMetadataCache> metadata_cache;
   } reader_options;
 
+  /// Properties of the files opened by MakeWriter(). The memory pool is taken
+  /// from the ScanContext at write time.
+  struct WriterOptions {
+    /// Null for parquet::default_writer_properties()
+    std::shared_ptr<parquet::WriterProperties> writer_properties;
+    /// Null for parquet::default_arrow_writer_properties()
+    std::shared_ptr<parquet::ArrowWriterProperties> arrow_writer_properties;
+  } writer_options;
+
   Result<bool> IsSupported(const FileSource& source) const override;
 
   /// \brief Return the schema of the file if possible.
@@ -97,6 +190,16 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
                                     std::shared_ptr<ScanContext> context,
                                     const std::vector<int>& row_groups) const;
 
+  /// \brief Count the rows of a file from its FileMetaData.
+  Result<util::optional<int64_t>> CountRows(
+      const FileSource& source, std::shared_ptr<ScanContext> context) const override;
+
+  /// \brief Count the rows of the specified row groups of a file from its
+  /// FileMetaData.
+  Result<util::optional<int64_t>> CountRows(const FileSource& source,
+                                            std::shared_ptr<ScanContext> context,
+                                            const std::vector<int>& row_groups) const;
+
   using FileFormat::MakeFragment;
 
   Result<std::shared_ptr<FileFragment>> MakeFragment(
@@ -110,16 +213,26 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
 
   /// \brief Split a ParquetFileFragment into a Fragment for each row group.
   /// Row groups whose metadata contradicts the fragment's filter or the extra_filter
-  /// will be excluded.
+  /// will be excluded, and counted in the num_row_groups_pruned of the optional
+  /// context.
   Result<FragmentIterator> GetRowGroupFragments(
       const ParquetFileFragment& fragment,
-      std::shared_ptr<Expression> extra_filter = scalar(true));
+      std::shared_ptr<Expression> extra_filter = scalar(true),
+      std::shared_ptr<ScanContext> context = NULLPTR);
+
+  /// \brief Open a writer which writes each record batch as a row group.
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<ScanContext> context) override;
 };
 
 class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
  public:
   Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override;
 
+  Result<util::optional<int64_t>> CountRows(
+      std::shared_ptr<ScanContext> context) override;
+
   /// \brief The row groups viewed by this Fragment. This may be empty which signifies all
   /// row groups are selected.
   const std::vector<int>& row_groups() const { return row_groups_; }
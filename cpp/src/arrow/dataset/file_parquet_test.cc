@@ -17,13 +17,17 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/builder.h"
+#include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -31,6 +35,7 @@
 #include "arrow/type_fwd.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
 #include "parquet/metadata.h"
 
 namespace arrow {
@@ -47,7 +52,6 @@ using parquet::default_writer_properties;
 using parquet::WriterProperties;
 
 using parquet::CreateOutputStream;
-using parquet::arrow::FileWriter;
 using parquet::arrow::WriteTable;
 
 using testing::Pointee;
@@ -56,7 +60,8 @@ using internal::checked_pointer_cast;
 
 class ArrowParquetWriterMixin : public ::testing::Test {
  public:
-  Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
+  Status WriteRecordBatch(const RecordBatch& batch,
+                          parquet::arrow::FileWriter* writer) {
     auto schema = batch.schema();
     auto size = batch.num_rows();
 
@@ -74,7 +79,8 @@ class ArrowParquetWriterMixin : public ::testing::Test {
     return Status::OK();
   }
 
-  Status WriteRecordBatchReader(RecordBatchReader* reader, FileWriter* writer) {
+  Status WriteRecordBatchReader(RecordBatchReader* reader,
+                                parquet::arrow::FileWriter* writer) {
     auto schema = reader->schema();
 
     if (!schema->Equals(*writer->schema(), false)) {
@@ -95,9 +101,10 @@ class ArrowParquetWriterMixin : public ::testing::Test {
       const std::shared_ptr<WriterProperties>& properties = default_writer_properties(),
       const std::shared_ptr<ArrowWriterProperties>& arrow_properties =
           default_arrow_writer_properties()) {
-    std::unique_ptr<FileWriter> writer;
-    RETURN_NOT_OK(FileWriter::Open(*reader->schema(), pool, sink, properties,
-                                   arrow_properties, &writer));
+    std::unique_ptr<parquet::arrow::FileWriter> writer;
+    RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*reader->schema(), pool, sink,
+                                                   properties, arrow_properties,
+                                                   &writer));
     RETURN_NOT_OK(WriteRecordBatchReader(reader, writer.get()));
     return writer->Close();
   }
@@ -436,6 +443,216 @@ TEST_F(TestParquetFileFormat, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownPrunedCount) {
+  constexpr int64_t kNumRowGroups = 16;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  opts_->filter = scalar(true);
+  CountRowsAndBatchesInScan(fragment, kNumRowGroups * (kNumRowGroups + 1) / 2,
+                            kNumRowGroups);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 0);
+
+  opts_->filter = ("i64"_ == int64_t(3)).Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), kNumRowGroups - 1);
+
+  // The counter accumulates over scans sharing the context
+  opts_->filter = ("i64"_ < int64_t(6)).Copy();
+  CountRowsAndBatchesInScan(fragment, 5 * (5 + 1) / 2, 5);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 2 * kNumRowGroups - 6);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  // Every row group's statistics span the values of the filters below, only
+  // its Bloom filters can prove that it contains none of them.
+  auto table_schema = schema({field("i64", int64()), field("str", utf8())});
+  auto table = TableFromJSON(table_schema, {R"([{"i64": 1, "str": "a"},
+                                                {"i64": 5, "str": "e"},
+                                                {"i64": 3, "str": "c"},
+                                                {"i64": 2, "str": "b"},
+                                                {"i64": 6, "str": "f"},
+                                                {"i64": 4, "str": "d"}])"});
+
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+  ASSERT_OK(WriteTable(*table, pool, sink, /*chunk_size=*/3, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table_schema);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+
+  opts_->filter = ("i64"_ == int64_t(4)).Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 1);
+
+  opts_->filter = ("str"_ == "c").Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 2);
+
+  opts_->filter = ("i64"_ == int64_t(4) and "str"_ == "c").Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 4);
+
+  opts_->filter = ("i64"_ == int64_t(4) or "str"_ == "c").Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 4);
+
+  opts_->filter = "i64"_.In(ArrayFromJSON(int64(), "[2, 6]")).Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 5);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilterSignedZero) {
+  // -0.0 and 0.0 hash differently but compare equal, Bloom filters must not
+  // prune a row group holding only -0.0 from x == 0.0
+  auto table_schema = schema({field("x", float64())});
+  auto table = TableFromJSON(table_schema, {R"([{"x": -0.0}, {"x": -0.0}])"});
+
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+  ASSERT_OK(WriteTable(*table, pool, sink, /*chunk_size=*/2, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table_schema);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+
+  opts_->filter = ("x"_ == 0.0).Copy();
+  CountRowsAndBatchesInScan(fragment, 2, 1);
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), 0);
+}
+
+TEST_F(TestParquetFileFormat, LateMaterialization) {
+  constexpr int64_t kRows = 10000;
+  Int64Builder i64_builder;
+  DoubleBuilder f64_builder;
+  StringBuilder str_builder;
+  for (int64_t i = 0; i < kRows; ++i) {
+    ASSERT_OK(i64_builder.Append(i));
+    ASSERT_OK(f64_builder.Append(i / 2.0));
+    ASSERT_OK(i % 7 == 0 ? str_builder.AppendNull()
+                         : str_builder.Append(std::to_string(i)));
+  }
+  std::shared_ptr<Array> i64, f64, str;
+  ASSERT_OK(i64_builder.Finish(&i64));
+  ASSERT_OK(f64_builder.Finish(&f64));
+  ASSERT_OK(str_builder.Finish(&str));
+  auto table_schema =
+      schema({field("f64", float64()), field("i64", int64()), field("str", utf8())});
+  auto table = Table::Make(table_schema, {f64, i64, str});
+
+  // Small data pages, such that whole pages of "f64" and "str" are skipped
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  auto properties = WriterProperties::Builder().data_pagesize(1024)->build();
+  ASSERT_OK(WriteTable(*table, pool, sink, /*chunk_size=*/kRows, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  format_->reader_options.late_materialization = true;
+  opts_ = ScanOptions::Make(table_schema);
+  opts_->batch_size = 4096;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+
+  // Without a filter, every row is read
+  CountRowsAndBatchesInScan(fragment, kRows, 3);
+
+  // The third batch has no selected row and is not yielded
+  opts_->filter = (("i64"_ >= int64_t(1000) and "i64"_ < int64_t(1010)) or
+                   ("i64"_ >= int64_t(4000) and "i64"_ < int64_t(6000)))
+                      .Copy();
+  std::vector<int64_t> expected_rows;
+  for (int64_t i = 1000; i < 1010; ++i) {
+    expected_rows.push_back(i);
+  }
+  for (int64_t i = 4000; i < 6000; ++i) {
+    expected_rows.push_back(i);
+  }
+
+  auto expected_row = expected_rows.begin();
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    ASSERT_OK(batch->ValidateFull());
+
+    auto i64_column = checked_pointer_cast<Int64Array>(batch->GetColumnByName("i64"));
+    auto f64_column = checked_pointer_cast<DoubleArray>(batch->GetColumnByName("f64"));
+    auto str_column = checked_pointer_cast<StringArray>(batch->GetColumnByName("str"));
+    ASSERT_NE(i64_column, nullptr);
+    ASSERT_NE(f64_column, nullptr);
+    ASSERT_NE(str_column, nullptr);
+
+    for (int64_t j = 0; j < batch->num_rows(); ++j, ++expected_row) {
+      ASSERT_NE(expected_row, expected_rows.end());
+      int64_t i = *expected_row;
+      ASSERT_EQ(i64_column->Value(j), i);
+      ASSERT_EQ(f64_column->Value(j), i / 2.0);
+      if (i % 7 == 0) {
+        ASSERT_TRUE(str_column->IsNull(j));
+      } else {
+        ASSERT_EQ(str_column->GetString(j), std::to_string(i));
+      }
+    }
+  }
+  ASSERT_EQ(expected_row, expected_rows.end());
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownPageIndex) {
+  constexpr int64_t kRows = 10000;
+  Int64Builder i64_builder;
+  DoubleBuilder f64_builder;
+  for (int64_t i = 0; i < kRows; ++i) {
+    ASSERT_OK(i64_builder.Append(i));
+    ASSERT_OK(f64_builder.Append(i / 2.0));
+  }
+  std::shared_ptr<Array> i64, f64;
+  ASSERT_OK(i64_builder.Finish(&i64));
+  ASSERT_OK(f64_builder.Finish(&f64));
+  auto table_schema = schema({field("i64", int64()), field("f64", float64())});
+  auto table = Table::Make(table_schema, {i64, f64});
+
+  // A single RowGroup of many small data pages
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  auto properties =
+      WriterProperties::Builder().data_pagesize(1024)->enable_write_page_index()->build();
+  ASSERT_OK(WriteTable(*table, pool, sink, /*chunk_size=*/kRows, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table_schema);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+
+  // Only the pages which may hold the selected rows are read
+  opts_->filter = ("i64"_ >= int64_t(4000) and "i64"_ < int64_t(4010)).Copy();
+  int64_t num_rows = 0, num_selected_rows = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    ASSERT_OK(batch->ValidateFull());
+    auto i64_column = checked_pointer_cast<Int64Array>(batch->GetColumnByName("i64"));
+    auto f64_column = checked_pointer_cast<DoubleArray>(batch->GetColumnByName("f64"));
+    for (int64_t j = 0; j < batch->num_rows(); ++j) {
+      const int64_t i = i64_column->Value(j);
+      ASSERT_EQ(f64_column->Value(j), i / 2.0);
+      num_selected_rows += i >= 4000 && i < 4010;
+    }
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_selected_rows, 10);
+  ASSERT_LT(num_rows, kRows / 4);
+
+  // The RowGroup statistics don't rule out these rows, but the pages' bounds do
+  opts_->filter = ("i64"_ == int64_t(4000) and "f64"_ == 100.0).Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+}
+
 TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
   constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
@@ -472,6 +689,12 @@ TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragments) {
 
   CountRowGroupsInFragment(fragment, {5, 6, 7}, "i64"_ >= int64_t(6),
                            "i64"_ < int64_t(8));
+
+  // Pruned row groups are counted in the context
+  auto parquet_fragment = checked_pointer_cast<ParquetFileFragment>(fragment);
+  ASSERT_OK(format_->GetRowGroupFragments(*parquet_fragment,
+                                          ("i64"_ < int64_t(8)).Copy(), ctx_));
+  ASSERT_EQ(ctx_->num_row_groups_pruned.load(), kNumRowGroups - 3);
 }
 
 TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
@@ -520,5 +743,92 @@ TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
       row_groups_fragment({kNumRowGroups + 1})->Scan(ctx_));
 }
 
+TEST_F(TestParquetFileFormat, CountRows) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+
+  auto count_rows = [&](std::vector<int> row_groups) {
+    EXPECT_OK_AND_ASSIGN(auto fragment,
+                         format_->MakeFragment(*source, opts_, scalar(true), row_groups));
+    EXPECT_OK_AND_ASSIGN(auto num_rows, fragment->CountRows(ctx_));
+    return num_rows;
+  };
+
+  // Counted from the FileMetaData
+  ASSERT_EQ(count_rows({}), kTotalNumRows);
+  ASSERT_EQ(count_rows({2, 3, 4, 5}), 3 + 4 + 5 + 6);
+
+  // Rows may be filtered out, so the fragment has to be scanned
+  opts_->filter = ("i64"_ > int64_t(3)).Copy();
+  ASSERT_EQ(count_rows({}), util::nullopt);
+}
+
+TEST_F(TestParquetFileFormat, MetadataCache) {
+  auto cache = std::make_shared<ParquetMetadataCache>();
+  format_->reader_options.metadata_cache = cache;
+
+  auto write_file = [](fs::FileSystem* fs, const std::string& path,
+                       const Buffer& contents) {
+    ASSERT_OK_AND_ASSIGN(auto stream, fs->OpenOutputStream(path));
+    ASSERT_OK(stream->Write(contents.data(), contents.size()));
+    ASSERT_OK(stream->Close());
+  };
+
+  auto reader = GetRecordBatchReader();
+  auto buffer = Write(reader.get());
+  ASSERT_OK_AND_ASSIGN(auto fs, fs::internal::MockFileSystem::Make(
+                                    fs::kNoTime + std::chrono::seconds(1), {}));
+  write_file(fs.get(), "data.parquet", *buffer);
+  FileSource source("data.parquet", fs.get());
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(source));
+  AssertSchemaEqual(*actual, *schema_, /*check_metadata=*/false);
+  ASSERT_EQ(cache->misses(), 1);
+  ASSERT_EQ(cache->hits(), 0);
+  ASSERT_EQ(cache->num_entries(), 1);
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+  CountRowsAndBatchesInScan(fragment, kNumRows, kBatchRepetitions);
+  CountRowsAndBatchesInScan(fragment, kNumRows, kBatchRepetitions);
+  ASSERT_EQ(cache->misses(), 1);
+  ASSERT_EQ(cache->hits(), 2);
+
+  // A rewritten file is parsed again
+  schema_ = schema({field("i32", int32())});
+  reader = GetRecordBatchReader();
+  write_file(fs.get(), "data.parquet", *Write(reader.get()));
+  ASSERT_OK_AND_ASSIGN(actual, format_->Inspect(source));
+  AssertSchemaEqual(*actual, *schema_, /*check_metadata=*/false);
+  ASSERT_EQ(cache->misses(), 2);
+  ASSERT_EQ(cache->num_entries(), 1);
+
+  // In-memory sources aren't cached
+  ASSERT_OK(format_->Inspect(FileSource(buffer)).status());
+  ASSERT_EQ(cache->misses(), 2);
+  ASSERT_EQ(cache->hits(), 2);
+
+  // Least recently used entries are evicted beyond the capacity
+  write_file(fs.get(), "other.parquet", *buffer);
+  FileSource other_source("other.parquet", fs.get());
+  ASSERT_OK(format_->Inspect(other_source).status());
+  ASSERT_EQ(cache->num_entries(), 2);
+  auto metadata =
+      parquet::ParquetFileReader::Open(std::make_shared<io::BufferReader>(buffer))
+          ->metadata();
+  cache->SetCapacity(metadata->size());
+  ASSERT_EQ(cache->num_entries(), 1);
+  ASSERT_OK(format_->Inspect(other_source).status());
+  ASSERT_EQ(cache->hits(), 3);
+
+  cache->Clear();
+  ASSERT_EQ(cache->num_entries(), 0);
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -62,6 +62,23 @@ TEST(FileSource, PathBased) {
   ASSERT_EQ(source1, source3);
 }
 
+TEST(FileSource, InfoBased) {
+  fs::internal::MockFileSystem mockfs(fs::kNoTime);
+  fs::CreateFile(&mockfs, "path/to/file.ext", "some data");
+  ASSERT_OK_AND_ASSIGN(auto info, mockfs.GetFileInfo("path/to/file.ext"));
+
+  FileSource source(info, &mockfs);
+  ASSERT_EQ("path/to/file.ext", source.path());
+  ASSERT_EQ(&mockfs, source.filesystem());
+  ASSERT_EQ(FileSource::PATH, source.type());
+  ASSERT_EQ(FileSource("path/to/file.ext", &mockfs), source);
+
+  ASSERT_OK_AND_ASSIGN(auto file, source.Open());
+  ASSERT_OK_AND_EQ(9, file->GetSize());
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->Read(9));
+  AssertBufferEqual(*buffer, "some data");
+}
+
 TEST(FileSource, BufferBased) {
   std::string the_data = "this is the file contents";
   auto buf = std::make_shared<Buffer>(the_data);
@@ -180,6 +197,17 @@ TEST_F(TestFileSystemDataset, TreePartitionPruning) {
   // apply to inner partitions.
   options_->filter = ("city"_ == "Franklin").Copy();
   AssertFragmentsAreFromPath(dataset_->GetFragments(options_), franklins);
+
+  options_->filter = ("state"_ == "CA" or "city"_ == "New York").Copy();
+  AssertFragmentsAreFromPath(dataset_->GetFragments(options_),
+                             {"CA/San Francisco", "CA/Franklin", "NY/New York"});
+
+  // Predicates on other fields don't prune
+  options_->filter = ("state"_ == "NY" and "population"_ > 1000).Copy();
+  AssertFragmentsAreFromPath(dataset_->GetFragments(options_),
+                             {"NY/New York", "NY/Franklin"});
+  options_->filter = ("population"_.IsValid()).Copy();
+  AssertFragmentsAreFromPath(dataset_->GetFragments(options_), all_cities);
 }
 
 TEST_F(TestFileSystemDataset, FragmentPartitions) {
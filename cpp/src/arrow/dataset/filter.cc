@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <unordered_map>
@@ -33,7 +34,8 @@
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
-#include "arrow/compute/kernels/isin.h"
+#include "arrow/compute/kernels/set_lookup.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
@@ -556,10 +558,33 @@ std::shared_ptr<Expression> NotExpression::Assume(const Expression& given) const
   return Copy();
 }
 
+struct InExpression::SetLookupCache {
+  std::mutex mutex;
+  std::shared_ptr<compute::SetLookup> lookup;
+};
+
+InExpression::InExpression(std::shared_ptr<Expression> operand,
+                           std::shared_ptr<Array> set)
+    : ExpressionImpl(std::move(operand)),
+      set_(std::move(set)),
+      set_lookup_cache_(std::make_shared<SetLookupCache>()) {}
+
+Result<std::shared_ptr<compute::SetLookup>> InExpression::set_lookup() const {
+  std::lock_guard<std::mutex> lock(set_lookup_cache_->mutex);
+  if (set_lookup_cache_->lookup == nullptr) {
+    compute::FunctionContext ctx;
+    RETURN_NOT_OK(compute::SetLookup::Make(&ctx, set_, &set_lookup_cache_->lookup));
+  }
+  return set_lookup_cache_->lookup;
+}
+
 std::shared_ptr<Expression> InExpression::Assume(const Expression& given) const {
   auto operand = operand_->Assume(given);
   if (operand->type() != ExpressionType::SCALAR) {
-    return std::make_shared<InExpression>(std::move(operand), set_);
+    // keep sharing the prepared set with this expression
+    auto out = std::make_shared<InExpression>(*this);
+    out->operand_ = std::move(operand);
+    return std::move(out);
   }
 
   if (operand->IsNull()) {
@@ -596,6 +621,35 @@ std::shared_ptr<Expression> IsValidExpression::Assume(const Expression& given) c
   return std::make_shared<IsValidExpression>(std::move(operand));
 }
 
+// Match the pattern against a single string, as an array of length 1
+Result<std::shared_ptr<Scalar>> MatchSubstringScalar(
+    const Scalar& value, const compute::MatchSubstringOptions& options,
+    MemoryPool* pool) {
+  if (!value.is_valid) {
+    return std::make_shared<BooleanScalar>();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto values, MakeArrayFromScalar(value, 1, pool));
+  Datum out;
+  compute::FunctionContext ctx(pool);
+  RETURN_NOT_OK(compute::MatchSubstring(&ctx, values, options, &out));
+  return std::make_shared<BooleanScalar>(
+      checked_cast<const BooleanArray&>(*out.make_array()).Value(0));
+}
+
+std::shared_ptr<Expression> MatchSubstringExpression::Assume(
+    const Expression& given) const {
+  auto operand = operand_->Assume(given);
+  if (operand->type() == ExpressionType::SCALAR) {
+    const auto& value = checked_cast<const ScalarExpression&>(*operand).value();
+    auto maybe_matches = MatchSubstringScalar(*value, options_, default_memory_pool());
+    if (maybe_matches.ok()) {
+      return scalar(maybe_matches.MoveValueUnsafe());
+    }
+  }
+
+  return std::make_shared<MatchSubstringExpression>(std::move(operand), options_);
+}
+
 std::shared_ptr<Expression> CastExpression::Assume(const Expression& given) const {
   auto operand = operand_->Assume(given);
   if (arrow::util::holds_alternative<std::shared_ptr<DataType>>(to_)) {
@@ -682,6 +736,17 @@ std::string InExpression::ToString() const {
       {"(", operand_->ToString(), " is in ", set_->ToString(), ")"}, "");
 }
 
+std::string MatchSubstringExpression::ToString() const {
+  const char* mode = "contains";
+  if (options_.mode == compute::MatchSubstringOptions::STARTS_WITH) {
+    mode = "starts with";
+  } else if (options_.mode == compute::MatchSubstringOptions::ENDS_WITH) {
+    mode = "ends with";
+  }
+  return internal::JoinStrings(
+      {"(", operand_->ToString(), " ", mode, " \"", options_.pattern, "\")"}, "");
+}
+
 std::string CastExpression::ToString() const {
   std::string to;
   if (arrow::util::holds_alternative<std::shared_ptr<DataType>>(to_)) {
@@ -718,6 +783,16 @@ bool ComparisonExpression::Equals(const Expression& other) const {
          op_ == checked_cast<const ComparisonExpression&>(other).op_;
 }
 
+bool MatchSubstringExpression::Equals(const Expression& other) const {
+  if (!UnaryExpression::Equals(other)) {
+    return false;
+  }
+  const auto& other_options =
+      checked_cast<const MatchSubstringExpression&>(other).options_;
+  return options_.mode == other_options.mode &&
+         options_.pattern == other_options.pattern;
+}
+
 bool ScalarExpression::Equals(const Expression& other) const {
   return other.type() == ExpressionType::SCALAR &&
          value_->Equals(*checked_cast<const ScalarExpression&>(other).value_);
@@ -754,6 +829,11 @@ InExpression Expression::In(std::shared_ptr<Array> set) const {
 
 IsValidExpression Expression::IsValid() const { return IsValidExpression(Copy()); }
 
+MatchSubstringExpression Expression::MatchSubstring(
+    compute::MatchSubstringOptions options) const {
+  return MatchSubstringExpression(Copy(), std::move(options));
+}
+
 std::shared_ptr<Expression> FieldExpression::Copy() const {
   return std::make_shared<FieldExpression>(*this);
 }
@@ -823,6 +903,20 @@ CastExpression Expression::CastLike(const Expression& expr,
   return CastLike(expr.Copy(), std::move(options));
 }
 
+// Whether type is dictionary encoded with values of value_type
+bool IsDictionaryOf(const DataType& type, const DataType& value_type) {
+  return type.id() == Type::DICTIONARY &&
+         checked_cast<const DictionaryType&>(type).value_type()->Equals(value_type);
+}
+
+// The type of the values of a possibly dictionary encoded type
+std::shared_ptr<DataType> DecodedType(const std::shared_ptr<DataType>& type) {
+  if (type->id() == Type::DICTIONARY) {
+    return checked_cast<const DictionaryType&>(*type).value_type();
+  }
+  return type;
+}
+
 Result<std::shared_ptr<DataType>> ComparisonExpression::Validate(
     const Schema& schema) const {
   ARROW_ASSIGN_OR_RAISE(auto lhs_type, left_operand_->Validate(schema));
@@ -832,7 +926,9 @@ Result<std::shared_ptr<DataType>> ComparisonExpression::Validate(
     return boolean();
   }
 
-  if (!lhs_type->Equals(rhs_type)) {
+  // dictionary encoded operands may be compared to their values
+  if (!lhs_type->Equals(rhs_type) && !IsDictionaryOf(*lhs_type, *rhs_type) &&
+      !IsDictionaryOf(*rhs_type, *lhs_type)) {
     return Status::TypeError("cannot compare expressions of differing type, ", *lhs_type,
                              " vs ", *rhs_type);
   }
@@ -872,7 +968,8 @@ Result<std::shared_ptr<DataType>> NotExpression::Validate(const Schema& schema)
 
 Result<std::shared_ptr<DataType>> InExpression::Validate(const Schema& schema) const {
   ARROW_ASSIGN_OR_RAISE(auto operand_type, operand_->Validate(schema));
-  if (!operand_type->Equals(set_->type())) {
+  if (!operand_type->Equals(set_->type()) &&
+      !IsDictionaryOf(*operand_type, *set_->type())) {
     return Status::TypeError("mismatch: set type ", *set_->type(), " vs operand type ",
                              *operand_type);
   }
@@ -880,6 +977,22 @@ Result<std::shared_ptr<DataType>> InExpression::Validate(const Schema& schema) c
   return boolean();
 }
 
+Result<std::shared_ptr<DataType>> MatchSubstringExpression::Validate(
+    const Schema& schema) const {
+  ARROW_ASSIGN_OR_RAISE(auto operand_type, operand_->Validate(schema));
+  // dictionary encoded strings are matched through their dictionary
+  switch (DecodedType(operand_type)->id()) {
+    case Type::NA:
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      return boolean();
+    default:
+      return Status::TypeError("cannot match substrings of ", *operand_type);
+  }
+}
+
 Result<std::shared_ptr<DataType>> IsValidExpression::Validate(
     const Schema& schema) const {
   ARROW_ASSIGN_OR_RAISE(std::ignore, operand_->Validate(schema));
@@ -950,11 +1063,13 @@ struct InsertImplicitCastsImpl {
     ARROW_ASSIGN_OR_RAISE(auto op, InsertCastsAndValidate(*expr.operand()));
     auto set = expr.set();
 
-    if (!op.type->Equals(set->type())) {
+    // dictionary encoded operands are looked up by their values
+    auto value_type = DecodedType(op.type);
+    if (!value_type->Equals(set->type())) {
       // cast the set (which we assume to be small) to match op.type
       compute::FunctionContext ctx;
       const auto options = compute::CastOptions::Safe();
-      RETURN_NOT_OK(arrow::compute::Cast(&ctx, *set, op.type, options, &set));
+      RETURN_NOT_OK(arrow::compute::Cast(&ctx, *set, value_type, options, &set));
     }
 
     return std::make_shared<InExpression>(std::move(op.expr), std::move(set));
@@ -999,14 +1114,16 @@ struct InsertImplicitCastsImpl {
     ARROW_ASSIGN_OR_RAISE(auto lhs, InsertCastsAndValidate(*expr.left_operand()));
     ARROW_ASSIGN_OR_RAISE(auto rhs, InsertCastsAndValidate(*expr.right_operand()));
 
-    if (lhs.type->Equals(rhs.type)) {
+    if (lhs.type->Equals(rhs.type) || IsDictionaryOf(*lhs.type, *rhs.type) ||
+        IsDictionaryOf(*rhs.type, *lhs.type)) {
       return expr.Copy();
     }
 
+    // dictionary encoded operands are compared to their values
     if (lhs.expr->type() == ExpressionType::SCALAR) {
-      ARROW_ASSIGN_OR_RAISE(lhs.expr, Cast(rhs.type, *lhs.expr));
+      ARROW_ASSIGN_OR_RAISE(lhs.expr, Cast(DecodedType(rhs.type), *lhs.expr));
     } else {
-      ARROW_ASSIGN_OR_RAISE(rhs.expr, Cast(lhs.type, *rhs.expr));
+      ARROW_ASSIGN_OR_RAISE(rhs.expr, Cast(DecodedType(lhs.type), *rhs.expr));
     }
     return std::make_shared<ComparisonExpression>(expr.op(), std::move(lhs.expr),
                                                   std::move(rhs.expr));
@@ -1056,13 +1173,18 @@ std::vector<std::string> FieldsInExpression(const std::shared_ptr<Expression>& e
   return FieldsInExpression(*expr);
 }
 
+Result<std::shared_ptr<RecordBatch>> ExpressionEvaluator::FilterBatch(
+    const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  ARROW_ASSIGN_OR_RAISE(auto selection, Evaluate(filter, *batch, pool));
+  return Filter(selection, batch, pool);
+}
+
 RecordBatchIterator ExpressionEvaluator::FilterBatches(RecordBatchIterator unfiltered,
                                                        std::shared_ptr<Expression> filter,
                                                        MemoryPool* pool) {
   auto filter_batches = [filter, pool, this](std::shared_ptr<RecordBatch> unfiltered) {
-    auto filtered = Evaluate(*filter, *unfiltered, pool).Map([&](Datum selection) {
-      return Filter(selection, unfiltered, pool);
-    });
+    auto filtered = FilterBatch(*filter, unfiltered, pool);
 
     if (filtered.ok() && (*filtered)->num_rows() == 0) {
       // drop empty batches
@@ -1165,8 +1287,61 @@ struct TreeEvaluator::Impl {
     }
 
     DCHECK(operand_values.is_array());
+    ARROW_ASSIGN_OR_RAISE(auto set_lookup, expr.set_lookup());
+
+    if (IsDictionaryEncoded(operand_values)) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto out, EvaluateOnDictionary(operand_values, [&](const Datum& dictionary,
+                                                             Datum* out) {
+            return set_lookup->IsIn(&ctx_, dictionary, out);
+          }));
+
+      const auto& indices = *operand_values.array();
+      if (set_lookup->null_count() == 0 || indices.GetNullCount() == 0) {
+        return std::move(out);
+      }
+
+      // null indices are members of a set containing null
+      Datum is_null;
+      RETURN_NOT_OK(arrow::compute::Invert(
+          &ctx_,
+          Datum(std::make_shared<BooleanArray>(indices.length, indices.buffers[0],
+                                               nullptr, 0, indices.offset)),
+          &is_null));
+      Datum with_nulls;
+      RETURN_NOT_OK(arrow::compute::KleeneOr(&ctx_, out, is_null, &with_nulls));
+      return std::move(with_nulls);
+    }
+
     Datum out;
-    RETURN_NOT_OK(arrow::compute::IsIn(&ctx_, operand_values, expr.set(), &out));
+    RETURN_NOT_OK(set_lookup->IsIn(&ctx_, operand_values, &out));
+    return std::move(out);
+  }
+
+  Result<Datum> operator()(const MatchSubstringExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto operand_values, Evaluate(*expr.operand()));
+    if (IsNullDatum(operand_values)) {
+      return Datum(std::make_shared<BooleanScalar>());
+    }
+
+    if (operand_values.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto matches,
+                            MatchSubstringScalar(*operand_values.scalar(), expr.options(),
+                                                 ctx_.memory_pool()));
+      return Datum(std::move(matches));
+    }
+
+    DCHECK(operand_values.is_array());
+    if (IsDictionaryEncoded(operand_values)) {
+      return EvaluateOnDictionary(operand_values,
+                                  [&](const Datum& dictionary, Datum* out) {
+                                    return compute::MatchSubstring(&ctx_, dictionary,
+                                                                   expr.options(), out);
+                                  });
+    }
+
+    Datum out;
+    RETURN_NOT_OK(compute::MatchSubstring(&ctx_, operand_values, expr.options(), &out));
     return std::move(out);
   }
 
@@ -1212,10 +1387,50 @@ struct TreeEvaluator::Impl {
     }
 
     DCHECK(lhs.is_array());
+    const arrow::compute::CompareOptions options(expr.op());
+
+    if (IsDictionaryEncoded(lhs) && rhs.is_scalar()) {
+      return EvaluateOnDictionary(lhs, [&](const Datum& dictionary, Datum* out) {
+        return arrow::compute::Compare(&ctx_, dictionary, rhs, options, out);
+      });
+    }
+
+    ARROW_ASSIGN_OR_RAISE(lhs, Decode(std::move(lhs)));
+    ARROW_ASSIGN_OR_RAISE(rhs, Decode(std::move(rhs)));
+    Datum out;
+    RETURN_NOT_OK(arrow::compute::Compare(&ctx_, lhs, rhs, options, &out));
+    return std::move(out);
+  }
+
+  static bool IsDictionaryEncoded(const Datum& values) {
+    return values.is_array() && values.type()->id() == Type::DICTIONARY;
+  }
+
+  // Evaluate a predicate once on the dictionary of dictionary encoded values, then
+  // gather its result for each index. Null indices yield null.
+  template <typename Predicate>
+  Result<Datum> EvaluateOnDictionary(const Datum& values, Predicate&& predicate) const {
+    DictionaryArray dict_array(values.array());
+
+    Datum dictionary_result;
+    RETURN_NOT_OK(predicate(Datum(dict_array.dictionary()), &dictionary_result));
+
+    std::shared_ptr<Array> out;
+    RETURN_NOT_OK(arrow::compute::Take(&ctx_, *dictionary_result.make_array(),
+                                       *dict_array.indices(), {}, &out));
+    return Datum(std::move(out));
+  }
+
+  // Decode dictionary encoded arrays, leaving anything else as is
+  Result<Datum> Decode(Datum values) const {
+    if (!IsDictionaryEncoded(values)) {
+      return std::move(values);
+    }
 
+    const auto& value_type = DecodedType(values.type());
     Datum out;
-    RETURN_NOT_OK(arrow::compute::Compare(
-        &ctx_, lhs, rhs, arrow::compute::CompareOptions(expr.op()), &out));
+    RETURN_NOT_OK(arrow::compute::Cast(&ctx_, values, value_type,
+                                       compute::CastOptions::Safe(), &out));
     return std::move(out);
   }
 
@@ -27,6 +27,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/string_ops.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/result.h"
@@ -36,6 +37,13 @@
 #include "arrow/util/variant.h"
 
 namespace arrow {
+
+namespace compute {
+
+class SetLookup;
+
+}  // namespace compute
+
 namespace dataset {
 
 struct ExpressionType {
@@ -74,6 +82,9 @@ struct ExpressionType {
     /// check each element for membership in a set
     IN,
 
+    /// check each string for containing, starting or ending with a substring
+    MATCH_SUBSTRING,
+
     /// custom user defined expression
     CUSTOM,
   };
@@ -196,6 +207,8 @@ class ARROW_DS_EXPORT Expression {
 
   IsValidExpression IsValid() const;
 
+  MatchSubstringExpression MatchSubstring(compute::MatchSubstringOptions options) const;
+
   CastExpression CastTo(std::shared_ptr<DataType> type,
                         compute::CastOptions options = compute::CastOptions()) const;
 
@@ -335,8 +348,7 @@ class ARROW_DS_EXPORT IsValidExpression final
 class ARROW_DS_EXPORT InExpression final
     : public ExpressionImpl<UnaryExpression, InExpression, ExpressionType::IN> {
  public:
-  InExpression(std::shared_ptr<Expression> operand, std::shared_ptr<Array> set)
-      : ExpressionImpl(std::move(operand)), set_(std::move(set)) {}
+  InExpression(std::shared_ptr<Expression> operand, std::shared_ptr<Array> set);
 
   std::string ToString() const override;
 
@@ -347,8 +359,40 @@ class ARROW_DS_EXPORT InExpression final
   /// The set against which the operand will be compared
   const std::shared_ptr<Array>& set() const { return set_; }
 
+  /// The set prepared for repeated lookups. It is built on first use and shared
+  /// with copies of this expression, so evaluating the expression against many
+  /// batches hashes the set only once.
+  Result<std::shared_ptr<compute::SetLookup>> set_lookup() const;
+
  private:
+  struct SetLookupCache;
+
   std::shared_ptr<Array> set_;
+  std::shared_ptr<SetLookupCache> set_lookup_cache_;
+};
+
+/// Check whether each string contains, starts or ends with a pattern, evaluated by
+/// compute::MatchSubstring
+class ARROW_DS_EXPORT MatchSubstringExpression final
+    : public ExpressionImpl<UnaryExpression, MatchSubstringExpression,
+                            ExpressionType::MATCH_SUBSTRING> {
+ public:
+  MatchSubstringExpression(std::shared_ptr<Expression> operand,
+                           compute::MatchSubstringOptions options)
+      : ExpressionImpl(std::move(operand)), options_(std::move(options)) {}
+
+  std::string ToString() const override;
+
+  bool Equals(const Expression& other) const override;
+
+  Result<std::shared_ptr<DataType>> Validate(const Schema& schema) const override;
+
+  std::shared_ptr<Expression> Assume(const Expression& given) const override;
+
+  const compute::MatchSubstringOptions& options() const { return options_; }
+
+ private:
+  compute::MatchSubstringOptions options_;
 };
 
 /// Explicitly cast an expression to a different type
@@ -526,6 +570,9 @@ auto VisitExpression(const Expression& expr, Visitor&& visitor)
     case ExpressionType::IS_VALID:
       return visitor(internal::checked_cast<const IsValidExpression&>(expr));
 
+    case ExpressionType::MATCH_SUBSTRING:
+      return visitor(internal::checked_cast<const MatchSubstringExpression&>(expr));
+
     case ExpressionType::AND:
       return visitor(internal::checked_cast<const AndExpression&>(expr));
 
@@ -588,6 +635,15 @@ class ARROW_DS_EXPORT ExpressionEvaluator {
     return Filter(selection, batch, default_memory_pool());
   }
 
+  /// \brief Evaluate a filter expression against a batch and return the rows for
+  /// which it is true.
+  ///
+  /// The default implementation calls Evaluate() then Filter().  Evaluators which
+  /// compute selections in another form (e.g. as indices) may override it.
+  virtual Result<std::shared_ptr<RecordBatch>> FilterBatch(
+      const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+      MemoryPool* pool) const;
+
   /// \brief Wrap an iterator of record batches with a filter expression. The resulting
   /// iterator will yield record batches filtered by the given expression.
   ///
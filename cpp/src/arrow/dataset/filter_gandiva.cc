@@ -0,0 +1,333 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/filter_gandiva.h"
+
+#include <limits>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "gandiva/filter.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace arrow {
+namespace dataset {
+
+using gandiva::NodePtr;
+using gandiva::TreeExprBuilder;
+using internal::checked_cast;
+
+constexpr size_t GandivaEvaluator::kMaxCachedFilters;
+
+namespace {
+
+Status Unsupported(const Expression& expr) {
+  return Status::NotImplemented("Translating ", expr.ToString(), " to Gandiva");
+}
+
+template <typename ScalarType>
+NodePtr MakePrimitiveLiteral(const Scalar& scalar) {
+  return TreeExprBuilder::MakeLiteral(checked_cast<const ScalarType&>(scalar).value);
+}
+
+Result<NodePtr> ScalarToGandiva(const ScalarExpression& expr) {
+  const Scalar& scalar = *expr.value();
+  if (!scalar.is_valid) {
+    if (scalar.type->id() == Type::NA) {
+      return Unsupported(expr);
+    }
+    return TreeExprBuilder::MakeNull(scalar.type);
+  }
+
+  switch (scalar.type->id()) {
+    case Type::BOOL:
+      return MakePrimitiveLiteral<BooleanScalar>(scalar);
+    case Type::UINT8:
+      return MakePrimitiveLiteral<UInt8Scalar>(scalar);
+    case Type::UINT16:
+      return MakePrimitiveLiteral<UInt16Scalar>(scalar);
+    case Type::UINT32:
+      return MakePrimitiveLiteral<UInt32Scalar>(scalar);
+    case Type::UINT64:
+      return MakePrimitiveLiteral<UInt64Scalar>(scalar);
+    case Type::INT8:
+      return MakePrimitiveLiteral<Int8Scalar>(scalar);
+    case Type::INT16:
+      return MakePrimitiveLiteral<Int16Scalar>(scalar);
+    case Type::INT32:
+      return MakePrimitiveLiteral<Int32Scalar>(scalar);
+    case Type::INT64:
+      return MakePrimitiveLiteral<Int64Scalar>(scalar);
+    case Type::FLOAT:
+      return MakePrimitiveLiteral<FloatScalar>(scalar);
+    case Type::DOUBLE:
+      return MakePrimitiveLiteral<DoubleScalar>(scalar);
+    case Type::STRING:
+      return TreeExprBuilder::MakeStringLiteral(
+          checked_cast<const StringScalar&>(scalar).value->ToString());
+    case Type::BINARY:
+      return TreeExprBuilder::MakeBinaryLiteral(
+          checked_cast<const BinaryScalar&>(scalar).value->ToString());
+    default:
+      return Unsupported(expr);
+  }
+}
+
+const char* ComparisonFunction(compute::CompareOperator op) {
+  switch (op) {
+    case compute::CompareOperator::EQUAL:
+      return "equal";
+    case compute::CompareOperator::NOT_EQUAL:
+      return "not_equal";
+    case compute::CompareOperator::GREATER:
+      return "greater_than";
+    case compute::CompareOperator::GREATER_EQUAL:
+      return "greater_than_or_equal_to";
+    case compute::CompareOperator::LESS:
+      return "less_than";
+    case compute::CompareOperator::LESS_EQUAL:
+      return "less_than_or_equal_to";
+  }
+  return "";
+}
+
+// Return the Gandiva function for a cast which cannot fail or truncate, or nullptr
+const char* CastFunction(const DataType& from, const DataType& to) {
+  switch (to.id()) {
+    case Type::INT64:
+      return is_integer(from.id()) && from.id() != Type::UINT64 ? "castBIGINT" : nullptr;
+    case Type::FLOAT:
+      return is_integer(from.id()) || is_floating(from.id()) ? "castFLOAT4" : nullptr;
+    case Type::DOUBLE:
+      return is_integer(from.id()) || is_floating(from.id()) ? "castFLOAT8" : nullptr;
+    default:
+      return nullptr;
+  }
+}
+
+template <typename ArrayType, typename Value>
+void CollectSet(const Array& set, std::unordered_set<Value>* values) {
+  const auto& typed_set = checked_cast<const ArrayType&>(set);
+  for (int64_t i = 0; i < set.length(); ++i) {
+    values->insert(Value(typed_set.GetView(i)));
+  }
+}
+
+Result<NodePtr> InToGandiva(const InExpression& expr, NodePtr operand) {
+  const Array& set = *expr.set();
+  if (set.null_count() != 0) {
+    return Unsupported(expr);
+  }
+
+  switch (set.type_id()) {
+    case Type::INT32: {
+      std::unordered_set<int32_t> values;
+      CollectSet<Int32Array, int32_t>(set, &values);
+      return TreeExprBuilder::MakeInExpressionInt32(std::move(operand), values);
+    }
+    case Type::INT64: {
+      std::unordered_set<int64_t> values;
+      CollectSet<Int64Array, int64_t>(set, &values);
+      return TreeExprBuilder::MakeInExpressionInt64(std::move(operand), values);
+    }
+    case Type::STRING: {
+      std::unordered_set<std::string> values;
+      CollectSet<StringArray, std::string>(set, &values);
+      return TreeExprBuilder::MakeInExpressionString(std::move(operand), values);
+    }
+    case Type::BINARY: {
+      std::unordered_set<std::string> values;
+      CollectSet<BinaryArray, std::string>(set, &values);
+      return TreeExprBuilder::MakeInExpressionBinary(std::move(operand), values);
+    }
+    default:
+      return Unsupported(expr);
+  }
+}
+
+Result<NodePtr> ToGandiva(const Expression& expr, const Schema& schema) {
+  switch (expr.type()) {
+    case ExpressionType::FIELD: {
+      const auto& field_expr = checked_cast<const FieldExpression&>(expr);
+      auto field = schema.GetFieldByName(field_expr.name());
+      if (field == nullptr) {
+        // Evaluates to null, which the compute kernels handle
+        return Unsupported(expr);
+      }
+      return TreeExprBuilder::MakeField(std::move(field));
+    }
+
+    case ExpressionType::SCALAR:
+      return ScalarToGandiva(checked_cast<const ScalarExpression&>(expr));
+
+    case ExpressionType::COMPARISON: {
+      const auto& comparison = checked_cast<const ComparisonExpression&>(expr);
+      ARROW_ASSIGN_OR_RAISE(auto left, ToGandiva(*comparison.left_operand(), schema));
+      ARROW_ASSIGN_OR_RAISE(auto right, ToGandiva(*comparison.right_operand(), schema));
+      return TreeExprBuilder::MakeFunction(ComparisonFunction(comparison.op()),
+                                           {std::move(left), std::move(right)},
+                                           boolean());
+    }
+
+    case ExpressionType::AND:
+    case ExpressionType::OR: {
+      const auto& binary = checked_cast<const BinaryExpression&>(expr);
+      ARROW_ASSIGN_OR_RAISE(auto left, ToGandiva(*binary.left_operand(), schema));
+      ARROW_ASSIGN_OR_RAISE(auto right, ToGandiva(*binary.right_operand(), schema));
+      if (expr.type() == ExpressionType::AND) {
+        return TreeExprBuilder::MakeAnd({std::move(left), std::move(right)});
+      }
+      return TreeExprBuilder::MakeOr({std::move(left), std::move(right)});
+    }
+
+    case ExpressionType::NOT: {
+      const auto& not_ = checked_cast<const NotExpression&>(expr);
+      ARROW_ASSIGN_OR_RAISE(auto operand, ToGandiva(*not_.operand(), schema));
+      return TreeExprBuilder::MakeFunction("not", {std::move(operand)}, boolean());
+    }
+
+    case ExpressionType::IS_VALID: {
+      const auto& is_valid = checked_cast<const IsValidExpression&>(expr);
+      ARROW_ASSIGN_OR_RAISE(auto operand, ToGandiva(*is_valid.operand(), schema));
+      return TreeExprBuilder::MakeFunction("isnotnull", {std::move(operand)}, boolean());
+    }
+
+    case ExpressionType::IN: {
+      const auto& in = checked_cast<const InExpression&>(expr);
+      ARROW_ASSIGN_OR_RAISE(auto operand, ToGandiva(*in.operand(), schema));
+      return InToGandiva(in, std::move(operand));
+    }
+
+    case ExpressionType::CAST: {
+      const auto& cast = checked_cast<const CastExpression&>(expr);
+      ARROW_ASSIGN_OR_RAISE(auto from, cast.operand()->Validate(schema));
+      ARROW_ASSIGN_OR_RAISE(auto to, cast.Validate(schema));
+      if (from->Equals(to)) {
+        return ToGandiva(*cast.operand(), schema);
+      }
+      const char* function = CastFunction(*from, *to);
+      if (function == nullptr) {
+        return Unsupported(expr);
+      }
+      ARROW_ASSIGN_OR_RAISE(auto operand, ToGandiva(*cast.operand(), schema));
+      return TreeExprBuilder::MakeFunction(function, {std::move(operand)}, to);
+    }
+
+    default:
+      return Unsupported(expr);
+  }
+}
+
+// Make a selection vector able to hold the indices of all rows of the batch.
+Status MakeSelectionVector(int64_t num_rows, MemoryPool* pool,
+                           std::shared_ptr<gandiva::SelectionVector>* out) {
+  if (num_rows <= std::numeric_limits<uint16_t>::max()) {
+    return gandiva::SelectionVector::MakeInt16(num_rows, pool, out);
+  }
+  if (num_rows <= std::numeric_limits<uint32_t>::max()) {
+    return gandiva::SelectionVector::MakeInt32(num_rows, pool, out);
+  }
+  return gandiva::SelectionVector::MakeInt64(num_rows, pool, out);
+}
+
+}  // namespace
+
+Result<gandiva::ConditionPtr> ToGandivaCondition(const Expression& expr,
+                                                 const Schema& schema) {
+  ARROW_ASSIGN_OR_RAISE(auto root, ToGandiva(expr, schema));
+  return TreeExprBuilder::MakeCondition(std::move(root));
+}
+
+GandivaEvaluator::GandivaEvaluator(std::shared_ptr<gandiva::Configuration> configuration)
+    : configuration_(std::move(configuration)) {}
+
+Result<std::shared_ptr<gandiva::Filter>> GandivaEvaluator::GetFilter(
+    const Expression& filter, const std::shared_ptr<Schema>& schema) const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& cached : cache_) {
+      if (cached.expression->Equals(filter) && cached.schema->Equals(*schema)) {
+        return cached.filter;
+      }
+    }
+  }
+
+  // Compile outside the lock, so that batches of other schemas are not blocked.
+  // Gandiva has its own cache of compiled modules, so two threads compiling the
+  // same filter concurrently do not duplicate much work.
+  std::shared_ptr<gandiva::Filter> compiled;
+  auto condition = ToGandivaCondition(filter, *schema);
+  if (condition.ok()) {
+    if (!gandiva::Filter::Make(schema, *condition, configuration_, &compiled).ok()) {
+      // e.g. a function signature which Gandiva does not implement
+      compiled = nullptr;
+    }
+  } else if (!condition.status().IsNotImplemented()) {
+    return condition.status();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (cache_.size() >= kMaxCachedFilters) {
+    cache_.erase(cache_.begin());
+  }
+  cache_.push_back({filter.Copy(), schema, compiled});
+  return compiled;
+}
+
+Result<std::shared_ptr<RecordBatch>> GandivaEvaluator::FilterBatch(
+    const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  const int64_t num_rows = batch->num_rows();
+  if (num_rows == 0) {
+    return batch;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto gandiva_filter, GetFilter(filter, batch->schema()));
+  if (gandiva_filter == nullptr) {
+    return TreeEvaluator::FilterBatch(filter, batch, pool);
+  }
+
+  std::shared_ptr<gandiva::SelectionVector> selection;
+  RETURN_NOT_OK(MakeSelectionVector(num_rows, pool, &selection));
+  RETURN_NOT_OK(gandiva_filter->Evaluate(*batch, selection));
+
+  const int64_t num_selected = selection->GetNumSlots();
+  if (num_selected == num_rows) {
+    return batch;
+  }
+  if (num_selected == 0) {
+    return batch->Slice(0, 0);
+  }
+
+  std::shared_ptr<RecordBatch> filtered;
+  compute::FunctionContext ctx{pool};
+  RETURN_NOT_OK(compute::Take(&ctx, *batch, *selection->ToArray(),
+                              compute::TakeOptions(), &filtered));
+  return filtered;
+}
+
+}  // namespace dataset
+}  // namespace arrow
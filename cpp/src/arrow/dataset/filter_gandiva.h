@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+#include "gandiva/condition.h"
+#include "gandiva/configuration.h"
+
+namespace gandiva {
+
+class Filter;
+
+}  // namespace gandiva
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Translate a filter expression to a Gandiva condition.
+///
+/// Supported are field references, scalars of primitive, string and binary
+/// types, comparisons, and, or, not, is_valid, in (against a set of int32,
+/// int64, string or binary values without nulls) and casts to int32, int64,
+/// float and double. Other expressions return NotImplemented.
+///
+/// expr must be validated against the schema before calling this function.
+ARROW_DS_EXPORT Result<gandiva::ConditionPtr> ToGandivaCondition(const Expression& expr,
+                                                                 const Schema& schema);
+
+/// \brief An evaluator which filters record batches with JIT-compiled Gandiva
+/// filters.
+///
+/// FilterBatch() compiles the filter for the schema of each batch (the
+/// compiled filters are cached per filter expression and schema), computes a
+/// selection vector of the matching rows and takes them from the batch.  If
+/// the filter cannot be translated to Gandiva, batches are filtered with the
+/// compute kernels as by TreeEvaluator.  Evaluate() and Filter() are always
+/// those of TreeEvaluator.
+class ARROW_DS_EXPORT GandivaEvaluator : public TreeEvaluator {
+ public:
+  explicit GandivaEvaluator(std::shared_ptr<gandiva::Configuration> configuration =
+                                gandiva::ConfigurationBuilder::DefaultConfiguration());
+
+  Result<std::shared_ptr<RecordBatch>> FilterBatch(
+      const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+      MemoryPool* pool) const override;
+
+  /// \brief Return the compiled filter for a filter expression and schema, or
+  /// nullptr if the expression cannot be compiled.
+  Result<std::shared_ptr<gandiva::Filter>> GetFilter(
+      const Expression& filter, const std::shared_ptr<Schema>& schema) const;
+
+  /// Maximum number of compiled filters kept by an evaluator
+  static constexpr size_t kMaxCachedFilters = 64;
+
+ private:
+  struct CachedFilter {
+    std::shared_ptr<Expression> expression;
+    std::shared_ptr<Schema> schema;
+    // nullptr if the expression cannot be compiled
+    std::shared_ptr<gandiva::Filter> filter;
+  };
+
+  std::shared_ptr<gandiva::Configuration> configuration_;
+  mutable std::mutex mutex_;
+  mutable std::vector<CachedFilter> cache_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
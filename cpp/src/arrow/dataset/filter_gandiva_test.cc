@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/filter_gandiva.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/iterator.h"
+#include "gandiva/filter.h"
+
+namespace arrow {
+namespace dataset {
+
+// clang-format off
+using string_literals::operator"" _;
+// clang-format on
+
+class GandivaEvaluatorTest : public ::testing::Test {
+ public:
+  // Filter the batch with both evaluators and check that the results agree.
+  // Returns the compiled Gandiva filter, or nullptr if the expression was
+  // evaluated with the compute kernels.
+  std::shared_ptr<gandiva::Filter> AssertFilterAgrees(const Expression& expr,
+                                                      const std::string& batch_json) {
+    auto batch = RecordBatchFromJSON(schema_, batch_json);
+    EXPECT_OK_AND_ASSIGN(auto expr_type, expr.Validate(*schema_));
+    EXPECT_TRUE(expr_type->Equals(boolean()));
+
+    TreeEvaluator tree_evaluator;
+    EXPECT_OK_AND_ASSIGN(auto expected,
+                         tree_evaluator.FilterBatch(expr, batch, default_memory_pool()));
+    EXPECT_OK_AND_ASSIGN(auto actual,
+                         evaluator_.FilterBatch(expr, batch, default_memory_pool()));
+    AssertBatchesEqual(*expected, *actual);
+
+    EXPECT_OK_AND_ASSIGN(auto filter, evaluator_.GetFilter(expr, schema_));
+    return filter;
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ = schema(
+      {field("i32", int32()), field("i64", int64()), field("f64", float64()),
+       field("s", utf8())});
+  GandivaEvaluator evaluator_;
+
+  std::string batch_json_ = R"([
+      {"i32": 0, "i64": 10, "f64": -0.1, "s": "hello"},
+      {"i32": 1, "i64": null, "f64": 0.3, "s": "world"},
+      {"i32": 2, "i64": 12, "f64": null, "s": null},
+      {"i32": null, "i64": 13, "f64": 0.1, "s": ""},
+      {"i32": 4, "i64": -14, "f64": 1.0, "s": "foo"}
+  ])";
+};
+
+TEST_F(GandivaEvaluatorTest, Comparisons) {
+  ASSERT_NE(AssertFilterAgrees("i32"_ == 1, batch_json_), nullptr);
+  ASSERT_NE(AssertFilterAgrees("i32"_ != 1, batch_json_), nullptr);
+  ASSERT_NE(AssertFilterAgrees("i64"_ > int64_t(11), batch_json_), nullptr);
+  ASSERT_NE(AssertFilterAgrees("i64"_ >= int64_t(12), batch_json_), nullptr);
+  ASSERT_NE(AssertFilterAgrees("f64"_ < 0.2, batch_json_), nullptr);
+  ASSERT_NE(AssertFilterAgrees("f64"_ <= 0.3, batch_json_), nullptr);
+  ASSERT_NE(AssertFilterAgrees("s"_ == "world", batch_json_), nullptr);
+}
+
+TEST_F(GandivaEvaluatorTest, Logical) {
+  ASSERT_NE(AssertFilterAgrees("i32"_ > 0 and "f64"_ < 0.5, batch_json_), nullptr);
+  ASSERT_NE(AssertFilterAgrees("i32"_ == 0 or "i64"_ == int64_t(12), batch_json_),
+            nullptr);
+  ASSERT_NE(AssertFilterAgrees(!("i32"_ > 1), batch_json_), nullptr);
+  ASSERT_NE(AssertFilterAgrees("s"_.IsValid(), batch_json_), nullptr);
+}
+
+TEST_F(GandivaEvaluatorTest, InAndCast) {
+  ASSERT_NE(AssertFilterAgrees("s"_.In(ArrayFromJSON(utf8(), R"(["hello", "foo"])")),
+                               batch_json_),
+            nullptr);
+  ASSERT_NE(AssertFilterAgrees("i64"_.In(ArrayFromJSON(int64(), "[10, 13]")),
+                               batch_json_),
+            nullptr);
+  ASSERT_NE(AssertFilterAgrees("i32"_.CastTo(float64()) == 1.0, batch_json_), nullptr);
+}
+
+TEST_F(GandivaEvaluatorTest, FallsBackToComputeKernels) {
+  // Narrowing casts may fail, which Gandiva does not report
+  ASSERT_EQ(AssertFilterAgrees("i64"_.CastTo(int32()) == 12, batch_json_), nullptr);
+  // Sets with nulls
+  ASSERT_EQ(AssertFilterAgrees("i32"_.In(ArrayFromJSON(int32(), "[1, null]")),
+                               batch_json_),
+            nullptr);
+}
+
+TEST_F(GandivaEvaluatorTest, CachesFilters) {
+  auto expr = "i32"_ > 1;
+  ASSERT_OK_AND_ASSIGN(auto first, evaluator_.GetFilter(expr, schema_));
+  ASSERT_NE(first, nullptr);
+
+  // Equal expressions and schemas share the compiled filter
+  auto copy = ("i32"_ > 1).Copy();
+  auto schema_copy = schema(schema_->fields());
+  ASSERT_OK_AND_ASSIGN(auto second, evaluator_.GetFilter(*copy, schema_copy));
+  ASSERT_EQ(first, second);
+
+  ASSERT_OK_AND_ASSIGN(auto other, evaluator_.GetFilter("i32"_ > 2, schema_));
+  ASSERT_NE(first, other);
+}
+
+TEST_F(GandivaEvaluatorTest, FilterBatches) {
+  auto batch = RecordBatchFromJSON(schema_, batch_json_);
+  auto expected = RecordBatchFromJSON(schema_, R"([
+      {"i32": 2, "i64": 12, "f64": null, "s": null},
+      {"i32": 4, "i64": -14, "f64": 1.0, "s": "foo"}
+  ])");
+
+  auto it = evaluator_.FilterBatches(MakeVectorIterator(RecordBatchVector{batch, batch}),
+                                     ("i32"_ > 1).Copy());
+  ASSERT_OK_AND_ASSIGN(auto filtered, it.ToVector());
+  ASSERT_EQ(filtered.size(), 2);
+  AssertBatchesEqual(*expected, *filtered[0]);
+  AssertBatchesEqual(*expected, *filtered[1]);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -27,6 +27,7 @@
 
 #include "arrow/compute/api.h"
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/set_lookup.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
@@ -103,6 +104,15 @@ TEST_F(ExpressionsTest, Equality) {
 
   ASSERT_EQ(E("b"_ > 2 and "b"_ < 3), E("b"_ > 2 and "b"_ < 3));
   ASSERT_NE(E("b"_ > 2 and "b"_ < 3), E("b"_ < 3 and "b"_ > 2));
+
+  using compute::MatchSubstringOptions;
+  ASSERT_EQ(E{"s"_.MatchSubstring(MatchSubstringOptions("ab"))},
+            E{"s"_.MatchSubstring(MatchSubstringOptions("ab"))});
+  ASSERT_NE(E{"s"_.MatchSubstring(MatchSubstringOptions("ab"))},
+            E{"s"_.MatchSubstring(MatchSubstringOptions("abc"))});
+  ASSERT_NE(E{"s"_.MatchSubstring(MatchSubstringOptions("ab"))},
+            E{"s"_.MatchSubstring(
+                MatchSubstringOptions("ab", MatchSubstringOptions::STARTS_WITH))});
 }
 
 TEST_F(ExpressionsTest, SimplificationOfCompoundQuery) {
@@ -283,6 +293,52 @@ TEST_F(FilterTest, InExpression) {
   ])");
 }
 
+TEST_F(FilterTest, InExpressionSharesSetLookup) {
+  auto in = "s"_.In(ArrayFromJSON(utf8(), R"(["hello", "world"])"));
+  ASSERT_OK_AND_ASSIGN(auto set_lookup, in.set_lookup());
+  ASSERT_EQ(set_lookup->null_count(), 0);
+
+  auto copy = checked_pointer_cast<InExpression>(in.Copy());
+  ASSERT_OK_AND_ASSIGN(auto copy_set_lookup, copy->set_lookup());
+  ASSERT_EQ(set_lookup, copy_set_lookup);
+
+  auto assumed = checked_pointer_cast<InExpression>(in.Assume("a"_ == 3));
+  ASSERT_OK_AND_ASSIGN(auto assumed_set_lookup, assumed->set_lookup());
+  ASSERT_EQ(set_lookup, assumed_set_lookup);
+}
+
+TEST_F(FilterTest, MatchSubstringExpression) {
+  using compute::MatchSubstringOptions;
+  AssertFilter("s"_.MatchSubstring(MatchSubstringOptions("ll")), {field("s", utf8())},
+               R"([
+      {"s": "hello", "in": 1},
+      {"s": "world", "in": 0},
+      {"s": "",      "in": 0},
+      {"s": null,    "in": null},
+      {"s": "all",   "in": 1}
+  ])");
+
+  AssertFilter(
+      "s"_.MatchSubstring(MatchSubstringOptions("wo", MatchSubstringOptions::STARTS_WITH))
+          and not "s"_.MatchSubstring(
+                  MatchSubstringOptions("ld", MatchSubstringOptions::ENDS_WITH)),
+      {field("s", large_utf8())}, R"([
+      {"s": "hello", "in": 0},
+      {"s": "world", "in": 0},
+      {"s": "wood",  "in": 1},
+      {"s": null,    "in": null}
+  ])");
+
+  ASSERT_RAISES(TypeError, "i"_.MatchSubstring(MatchSubstringOptions("1"))
+                               .Validate(Schema({field("i", int32())})));
+
+  // matching against a scalar is simplified away
+  ASSERT_TRUE(scalar(std::string("hello"))
+                  ->MatchSubstring(MatchSubstringOptions("ell"))
+                  .Assume(*scalar(true))
+                  ->Equals(true));
+}
+
 TEST_F(FilterTest, IsValidExpression) {
   AssertFilter("s"_.IsValid(), {field("s", utf8())}, R"([
       {"s": "hello", "in": 1},
@@ -374,6 +430,37 @@ TEST_F(FilterTest, ImplicitCast) {
   ])");
 }
 
+TEST_F(FilterTest, DictionaryEncodedColumn) {
+  auto dict_type = dictionary(int32(), utf8());
+  Schema dict_schema({field("d", dict_type)});
+  auto column = DictArrayFromJSON(dict_type, "[0, 1, 2, 1, null, 3]",
+                                  R"(["a", "b", "c", null])");
+  auto batch = RecordBatch::Make(schema({field("d", dict_type)}), column->length(),
+                                 {column});
+
+  auto AssertEvaluatesTo = [&](const Expression& expr, const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto filter, InsertImplicitCasts(expr, dict_schema));
+    ASSERT_OK_AND_ASSIGN(auto type, filter->Validate(dict_schema));
+    ASSERT_TRUE(type->Equals(boolean()));
+    ASSERT_OK_AND_ASSIGN(auto mask, evaluator_->Evaluate(*filter, *batch));
+    ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(boolean(), expected), *mask.make_array());
+  };
+
+  // comparisons and set lookups are evaluated against the dictionary
+  AssertEvaluatesTo("d"_ == "b", "[false, true, false, true, null, null]");
+  AssertEvaluatesTo("d"_ < "c", "[true, true, false, true, null, null]");
+  AssertEvaluatesTo("d"_.In(ArrayFromJSON(utf8(), R"(["a", "c"])")),
+                    "[true, false, true, false, null, null]");
+
+  // nulls are members of sets containing null
+  AssertEvaluatesTo("d"_.In(ArrayFromJSON(utf8(), R"(["a", null])")),
+                    "[true, false, false, false, true, true]");
+
+  // as are substring matches
+  AssertEvaluatesTo("d"_.MatchSubstring(compute::MatchSubstringOptions("b")),
+                    "[false, true, false, true, null, null]");
+}
+
 TEST_F(FilterTest, ConditionOnAbsentColumn) {
   AssertFilter("a"_ == 0 and "b"_ > 0.0 and "b"_ < 1.0 and "absent"_ == 0,
                {field("a", int32()), field("b", float64())}, R"([
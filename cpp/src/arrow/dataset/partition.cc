@@ -22,15 +22,20 @@
 #include <map>
 #include <memory>
 #include <stack>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/builder.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
@@ -612,5 +617,181 @@ std::shared_ptr<PartitioningFactory> HivePartitioning::MakeFactory() {
   return std::shared_ptr<PartitioningFactory>(new HivePartitioningFactory());
 }
 
+namespace {
+
+struct ScalarPtrEquals {
+  bool operator()(const std::shared_ptr<Scalar>& l,
+                  const std::shared_ptr<Scalar>& r) const {
+    return l->Equals(*r);
+  }
+};
+
+// The values of a key field for all the nodes
+struct KeyColumn {
+  KeyColumn(std::string name, std::shared_ptr<DataType> type)
+      : name(std::move(name)), type(std::move(type)) {}
+
+  Result<std::shared_ptr<Array>> Finish() const {
+    Int32Builder indices_builder;
+    RETURN_NOT_OK(indices_builder.Reserve(indices.size()));
+    for (int32_t index : indices) {
+      if (index < 0) {
+        indices_builder.UnsafeAppendNull();
+      } else {
+        indices_builder.UnsafeAppend(index);
+      }
+    }
+    std::shared_ptr<Array> indices_array;
+    RETURN_NOT_OK(indices_builder.Finish(&indices_array));
+
+    ArrayVector singletons(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(singletons[i], MakeArrayFromScalar(*values[i], 1));
+    }
+    std::shared_ptr<Array> dictionary;
+    RETURN_NOT_OK(Concatenate(singletons, default_memory_pool(), &dictionary));
+
+    return DictionaryArray::FromArrays(arrow::dictionary(int32(), type), indices_array,
+                                       dictionary);
+  }
+
+  std::string name;
+  std::shared_ptr<DataType> type;
+  // Whether all the keys have the same type
+  bool consistent = true;
+  // The distinct values, and the index of the value of each node or -1
+  ScalarVector values;
+  std::unordered_map<std::shared_ptr<Scalar>, int32_t, Scalar::Hash, ScalarPtrEquals>
+      memo;
+  std::vector<int32_t> indices;
+};
+
+// Replace the predicates of a filter which can't be evaluated against the keys
+// with null, i.e. unknown.  As And, Or and Not follow Kleene logic, the result
+// is only false where the filter is false whatever the unknown values.
+std::shared_ptr<Expression> ReplaceUnknownPredicates(
+    const std::shared_ptr<Expression>& expr, const Schema& keys_schema) {
+  switch (expr->type()) {
+    case ExpressionType::AND: {
+      const auto& and_expr = checked_cast<const AndExpression&>(*expr);
+      return and_(ReplaceUnknownPredicates(and_expr.left_operand(), keys_schema),
+                  ReplaceUnknownPredicates(and_expr.right_operand(), keys_schema));
+    }
+    case ExpressionType::OR: {
+      const auto& or_expr = checked_cast<const OrExpression&>(*expr);
+      return or_(ReplaceUnknownPredicates(or_expr.left_operand(), keys_schema),
+                 ReplaceUnknownPredicates(or_expr.right_operand(), keys_schema));
+    }
+    case ExpressionType::NOT: {
+      const auto& not_expr = checked_cast<const NotExpression&>(*expr);
+      return not_(ReplaceUnknownPredicates(not_expr.operand(), keys_schema));
+    }
+    case ExpressionType::SCALAR:
+      return expr;
+    case ExpressionType::COMPARISON:
+    case ExpressionType::IN:
+    case ExpressionType::MATCH_SUBSTRING: {
+      // Unknown keys are null, which these predicates propagate
+      bool known = true;
+      for (const auto& name : FieldsInExpression(*expr)) {
+        known = known && keys_schema.GetFieldByName(name) != nullptr;
+      }
+      if (known) {
+        return expr;
+      }
+      break;
+    }
+    default:
+      // In particular, IsValid maps unknown keys to false
+      break;
+  }
+  return scalar(std::make_shared<BooleanScalar>());
+}
+
+}  // namespace
+
+Result<std::shared_ptr<PartitionKeyIndex>> PartitionKeyIndex::Make(
+    const fs::PathForest& forest, const ExpressionVector& partitions) {
+  DCHECK_EQ(static_cast<size_t>(forest.size()), partitions.size());
+  std::vector<KeyColumn> columns;
+  std::unordered_map<std::string, size_t> column_ids;
+
+  // Nodes are in depth first order, so that a node comes after its parent
+  for (int i = 0; i < forest.size(); ++i) {
+    auto parent = forest[i].parent();
+    for (auto& column : columns) {
+      column.indices.push_back(parent ? column.indices[parent.i] : -1);
+    }
+
+    RETURN_NOT_OK(KeyValuePartitioning::VisitKeys(
+        *partitions[i],
+        [&](const std::string& name, const std::shared_ptr<Scalar>& value) {
+          if (!value->is_valid) {
+            return Status::OK();
+          }
+          auto column_id = column_ids.emplace(name, columns.size());
+          if (column_id.second) {
+            columns.emplace_back(name, value->type);
+            columns.back().indices.resize(i + 1, -1);
+          }
+          auto& column = columns[column_id.first->second];
+          if (!column.type->Equals(*value->type)) {
+            column.consistent = false;
+            return Status::OK();
+          }
+          auto memo =
+              column.memo.emplace(value, static_cast<int32_t>(column.values.size()));
+          if (memo.second) {
+            column.values.push_back(value);
+          }
+          column.indices[i] = memo.first->second;
+          return Status::OK();
+        }));
+  }
+
+  std::vector<std::shared_ptr<Field>> fields;
+  ArrayVector arrays;
+  for (const auto& column : columns) {
+    if (!column.consistent) {
+      continue;
+    }
+    // Keys whose type can't be indexed are left unknown
+    auto maybe_array = column.Finish();
+    if (maybe_array.ok()) {
+      fields.push_back(field(column.name, (*maybe_array)->type()));
+      arrays.push_back(std::move(maybe_array).ValueOrDie());
+    }
+  }
+
+  auto keys =
+      RecordBatch::Make(schema(std::move(fields)), forest.size(), std::move(arrays));
+  return std::shared_ptr<PartitionKeyIndex>(new PartitionKeyIndex(std::move(keys)));
+}
+
+Result<std::vector<bool>> PartitionKeyIndex::Select(const Expression& filter) const {
+  const int64_t num_nodes = keys_->num_rows();
+  std::vector<bool> selected(num_nodes, true);
+
+  auto known_filter = ReplaceUnknownPredicates(filter.Copy(), *keys_->schema());
+  ARROW_ASSIGN_OR_RAISE(auto mask, TreeEvaluator().Evaluate(*known_filter, *keys_,
+                                                            default_memory_pool()));
+
+  if (mask.is_scalar()) {
+    const auto& value = checked_cast<const BooleanScalar&>(*mask.scalar());
+    if (value.is_valid && !value.value) {
+      selected.assign(num_nodes, false);
+    }
+    return selected;
+  }
+
+  BooleanArray values(mask.array());
+  for (int64_t i = 0; i < num_nodes; ++i) {
+    if (values.IsValid(i) && !values.Value(i)) {
+      selected[i] = false;
+    }
+  }
+  return selected;
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -252,6 +252,38 @@ class ARROW_DS_EXPORT FunctionPartitioning : public Partitioning {
 
 // TODO(bkietz) use RE2 and named groups to provide RegexpPartitioning
 
+/// \brief A columnar index of the partition keys of the nodes of a PathForest
+///
+/// The equality keys (see KeyValuePartitioning::VisitKeys) of the partition
+/// expressions of each node and its ancestors are gathered in one
+/// dictionary-encoded column per key field, null where a node has no key for
+/// the field.  A filter is then evaluated against all the nodes at once,
+/// instead of being simplified against the partition expression of each node.
+class ARROW_DS_EXPORT PartitionKeyIndex {
+ public:
+  /// \brief Index the keys of `partitions`, where partitions[i] is the
+  /// partition expression of forest[i].
+  static Result<std::shared_ptr<PartitionKeyIndex>> Make(
+      const fs::PathForest& forest, const ExpressionVector& partitions);
+
+  /// \brief Return whether each node may hold rows satisfying a filter.
+  ///
+  /// Predicates referencing other fields than the keys are unknown, as are
+  /// the keys a node doesn't have.  Nodes are only deselected if the filter is
+  /// false whatever the unknown values, so that the descendants of a
+  /// deselected node are deselected too.
+  Result<std::vector<bool>> Select(const Expression& filter) const;
+
+  /// The keys of the nodes, one row per node
+  const std::shared_ptr<RecordBatch>& keys() const { return keys_; }
+
+ private:
+  explicit PartitionKeyIndex(std::shared_ptr<RecordBatch> keys)
+      : keys_(std::move(keys)) {}
+
+  std::shared_ptr<RecordBatch> keys_;
+};
+
 /// \brief Either a Partitioning or a PartitioningFactory
 class ARROW_DS_EXPORT PartitioningOrFactory {
  public:
@@ -299,6 +299,78 @@ TEST_F(TestPartitioning, Range) {
                   ("z"_ > 1.5 and "z"_ <= 3.0));
 }
 
+class TestPartitionKeyIndex : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(auto forest, fs::PathForest::MakeFromPreSorted({
+                                          fs::Dir("CA"),
+                                          fs::File("CA/Franklin"),
+                                          fs::File("CA/San Francisco"),
+                                          fs::Dir("NY"),
+                                          fs::File("NY/Franklin"),
+                                          fs::File("NY/New York"),
+                                      }));
+    ExpressionVector partitions = {
+        ("state"_ == "CA").Copy(),           ("city"_ == "Franklin").Copy(),
+        ("city"_ == "San Francisco").Copy(), ("state"_ == "NY").Copy(),
+        ("city"_ == "Franklin").Copy(),      ("city"_ == "New York").Copy(),
+    };
+    ASSERT_OK_AND_ASSIGN(index_, PartitionKeyIndex::Make(forest, partitions));
+  }
+
+  void AssertSelect(const Expression& filter, std::vector<bool> expected) {
+    ASSERT_OK_AND_ASSIGN(auto selected, index_->Select(filter));
+    ASSERT_EQ(selected, expected) << filter.ToString();
+  }
+
+ protected:
+  std::shared_ptr<PartitionKeyIndex> index_;
+};
+
+TEST_F(TestPartitionKeyIndex, Keys) {
+  const auto& keys = *index_->keys();
+  ASSERT_OK(keys.ValidateFull());
+  ASSERT_EQ(keys.num_rows(), 6);
+  ASSERT_EQ(keys.schema()->ToString(),
+            "state: dictionary<values=string, indices=int32, ordered=0>\n"
+            "city: dictionary<values=string, indices=int32, ordered=0>");
+  // Keys are inherited from the parent directory
+  const auto& states = checked_cast<const DictionaryArray&>(*keys.column(0));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 0, 0, 1, 1, 1]"), *states.indices());
+  const auto& cities = checked_cast<const DictionaryArray&>(*keys.column(1));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[null, 0, 1, null, 0, 2]"),
+                    *cities.indices());
+  AssertArraysEqual(
+      *ArrayFromJSON(utf8(), R"(["Franklin", "San Francisco", "New York"])"),
+      *cities.dictionary());
+}
+
+TEST_F(TestPartitionKeyIndex, Select) {
+  AssertSelect("state"_ == "CA", {true, true, true, false, false, false});
+  AssertSelect(!("state"_ == "CA"), {false, false, false, true, true, true});
+  // Directories have no city: they are selected
+  AssertSelect("city"_ == "Franklin", {true, true, false, true, true, false});
+  AssertSelect("state"_ == "NY" and "city"_ == "Franklin",
+               {false, false, false, true, true, false});
+  AssertSelect("state"_ == "CA" or "city"_ == "Franklin",
+               {true, true, true, true, true, false});
+  AssertSelect("city"_.In(ArrayFromJSON(utf8(), R"(["New York", "Tucson"])")),
+               {true, false, false, true, false, true});
+  AssertSelect(*scalar(false), {false, false, false, false, false, false});
+}
+
+TEST_F(TestPartitionKeyIndex, SelectUnknown) {
+  // Predicates on other fields than the keys are unknown
+  AssertSelect("state"_ == "CA" and "x"_ > 3, {true, true, true, false, false, false});
+  AssertSelect("state"_ == "CA" or "x"_ > 3, {true, true, true, true, true, true});
+  AssertSelect("x"_.In(ArrayFromJSON(int32(), "[1, 2]")),
+               {true, true, true, true, true, true});
+  // IsValid would be false for the keys directories don't have
+  AssertSelect("city"_.IsValid(), {true, true, true, true, true, true});
+  AssertSelect("state"_ == "NY" and "city"_.IsValid(),
+               {false, false, false, true, true, true});
+}
+
 class TestPartitioningWritePlan : public ::testing::Test {
  protected:
   FragmentIterator MakeFragments(const ExpressionVector& partition_expressions) {
@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/projector.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -85,6 +86,7 @@ Status RecordBatchProjector::SetDefaultValue(FieldRef ref,
   }
 
   scalars_[index] = std::move(scalar);
+  missing_columns_[index] = nullptr;
   return Status::OK();
 }
 
@@ -95,7 +97,7 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
   }
 
   if (missing_columns_length_ < batch.num_rows()) {
-    RETURN_NOT_OK(ResizeMissingColumns(batch.num_rows(), pool));
+    ResizeMissingColumns(batch.num_rows());
   }
 
   std::vector<std::shared_ptr<Array>> columns(to_->num_fields());
@@ -103,9 +105,12 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
   for (int i = 0; i < to_->num_fields(); ++i) {
     if (column_indices_[i] != kNoMatch) {
       columns[i] = batch.column(column_indices_[i]);
-    } else {
-      columns[i] = missing_columns_[i]->Slice(0, batch.num_rows());
+      continue;
+    }
+    if (missing_columns_[i] == nullptr) {
+      RETURN_NOT_OK(MaterializeMissingColumn(i, pool));
     }
+    columns[i] = missing_columns_[i]->Slice(0, batch.num_rows());
   }
 
   return RecordBatch::Make(to_, batch.num_rows(), std::move(columns));
@@ -120,39 +125,35 @@ Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
     ARROW_ASSIGN_OR_RAISE(auto match,
                           FieldRef(to_->field(i)->name()).FindOneOrNone(*from_));
 
-    if (match.indices().empty()) {
-      // Mark column i as missing by setting missing_columns_[i]
-      // to a non-null placeholder.
-      ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
-                            MakeArrayOfNull(to_->field(i)->type(), 0, pool));
-      column_indices_[i] = kNoMatch;
-    } else {
-      // Mark column i as not missing by setting missing_columns_[i] to nullptr
-      missing_columns_[i] = nullptr;
-      column_indices_[i] = match.indices()[0];
-    }
+    // Missing columns materialized for a previous input schema are kept
+    column_indices_[i] = match.indices().empty() ? kNoMatch : match.indices()[0];
   }
   return Status::OK();
 }
 
-Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool* pool) {
-  // TODO(bkietz) MakeArrayOfNull could use fewer buffers by reusing a single zeroed
-  // buffer for every buffer in every column which is null
-  for (int i = 0; i < to_->num_fields(); ++i) {
-    if (missing_columns_[i] == nullptr) {
-      continue;
-    }
-    if (scalars_[i] == nullptr) {
-      ARROW_ASSIGN_OR_RAISE(
-          missing_columns_[i],
-          MakeArrayOfNull(missing_columns_[i]->type(), new_length, pool));
-      continue;
+void RecordBatchProjector::ResizeMissingColumns(int64_t min_length) {
+  // Grow geometrically, so that batches of increasing lengths don't each
+  // materialize the missing columns again
+  missing_columns_length_ = std::max(min_length, 2 * missing_columns_length_);
+  std::fill(missing_columns_.begin(), missing_columns_.end(), nullptr);
+}
+
+Status RecordBatchProjector::MaterializeMissingColumn(int i, MemoryPool* pool) {
+  if (scalars_[i] != nullptr) {
+    return MakeArrayFromScalar(*scalars_[i], missing_columns_length_, pool)
+        .Value(&missing_columns_[i]);
+  }
+
+  // Null columns of the same type share an array
+  const auto& type = to_->field(i)->type();
+  for (int j = 0; j < to_->num_fields(); ++j) {
+    if (missing_columns_[j] != nullptr && scalars_[j] == nullptr &&
+        missing_columns_[j]->type()->Equals(*type)) {
+      missing_columns_[i] = missing_columns_[j];
+      return Status::OK();
     }
-    ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
-                          MakeArrayFromScalar(*scalars_[i], new_length, pool));
   }
-  missing_columns_length_ = new_length;
-  return Status::OK();
+  return MakeArrayOfNull(type, missing_columns_length_, pool).Value(&missing_columns_[i]);
 }
 
 constexpr int RecordBatchProjector::kNoMatch;
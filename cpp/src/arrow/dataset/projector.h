@@ -38,6 +38,9 @@ ARROW_DS_EXPORT Status CheckProjectable(const Schema& from, const Schema& to);
 /// RecordBatchProjector is most efficient when projecting record batches with a
 /// consistent schema (for example batches from a table), but it can project record
 /// batches having any schema.
+///
+/// Added columns are slices of arrays materialized once and reused by later batches
+/// (and by copies of the projector), so that projection doesn't allocate per batch.
 class ARROW_DS_EXPORT RecordBatchProjector {
  public:
   static constexpr int kNoMatch = -1;
@@ -59,11 +62,15 @@ class ARROW_DS_EXPORT RecordBatchProjector {
                         MemoryPool* pool = default_memory_pool());
 
  private:
-  Status ResizeMissingColumns(int64_t new_length, MemoryPool* pool);
+  void ResizeMissingColumns(int64_t min_length);
+
+  Status MaterializeMissingColumn(int i, MemoryPool* pool);
 
   std::shared_ptr<Schema> from_, to_;
   int64_t missing_columns_length_ = 0;
   // these vectors are indexed parallel to to_->fields()
+  // missing_columns_[i] has missing_columns_length_ slots, or is null if column i
+  // wasn't materialized yet
   std::vector<std::shared_ptr<Array>> missing_columns_;
   std::vector<int> column_indices_;
   std::vector<std::shared_ptr<Scalar>> scalars_;
@@ -18,17 +18,22 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner_internal.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace dataset {
@@ -43,6 +48,8 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
   auto copy = ScanOptions::Make(std::move(schema));
   copy->filter = filter;
   copy->evaluator = evaluator;
+  copy->batch_size = batch_size;
+  copy->limit = limit;
   return copy;
 }
 
@@ -119,11 +126,24 @@ Status ScannerBuilder::Filter(std::shared_ptr<Expression> filter) {
 
 Status ScannerBuilder::Filter(const Expression& filter) { return Filter(filter.Copy()); }
 
+Status ScannerBuilder::Evaluator(std::shared_ptr<ExpressionEvaluator> evaluator) {
+  if (evaluator == nullptr) {
+    return Status::Invalid("Evaluator must not be null");
+  }
+  evaluator_ = std::move(evaluator);
+  return Status::OK();
+}
+
 Status ScannerBuilder::UseThreads(bool use_threads) {
   scan_context_->use_threads = use_threads;
   return Status::OK();
 }
 
+Status ScannerBuilder::UseAsync(bool use_async) {
+  scan_context_->use_async = use_async;
+  return Status::OK();
+}
+
 Status ScannerBuilder::BatchSize(int64_t batch_size) {
   if (batch_size <= 0) {
     return Status::Invalid("BatchSize must be greater than 0, got ", batch_size);
@@ -132,6 +152,14 @@ Status ScannerBuilder::BatchSize(int64_t batch_size) {
   return Status::OK();
 }
 
+Status ScannerBuilder::Limit(int64_t limit) {
+  if (limit < 0) {
+    return Status::Invalid("Limit must not be negative, got ", limit);
+  }
+  scan_options_->limit = limit;
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   std::shared_ptr<ScanOptions> scan_options;
   if (has_projection_ && !project_columns_.empty()) {
@@ -142,7 +170,8 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   }
 
   if (!scan_options->filter->Equals(true)) {
-    scan_options->evaluator = std::make_shared<TreeEvaluator>();
+    scan_options->evaluator =
+        evaluator_ != nullptr ? evaluator_ : std::make_shared<TreeEvaluator>();
   }
 
   return std::make_shared<Scanner>(dataset_, std::move(scan_options), scan_context_);
@@ -156,33 +185,405 @@ std::shared_ptr<internal::TaskGroup> ScanContext::TaskGroup() const {
   return internal::TaskGroup::MakeSerial();
 }
 
+namespace {
+
+int64_t BufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += BufferSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+// Note buffers shared between batches (for example slices of a larger
+// batch) are counted once per batch.
+int64_t BufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += BufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+/// \brief An iterator reading the batches of a sequence of ScanTasks ahead of
+/// the consumer, on a thread pool.
+///
+/// At most `readahead_tasks` ScanTasks are active at a time, each having at
+/// most one batch being read.  A batch read ahead is buffered until the
+/// consumer asks for it, and no new read is started while the buffered
+/// batches exceed `readahead_bytes`, except for the next batch in order.
+///
+/// Reads are started from the consumer thread or, when a read completes, from
+/// the thread pool, so that no thread ever blocks waiting for buffer space.
+class AsyncScanIterator {
+ public:
+  AsyncScanIterator(ScanTaskIterator scan_tasks, internal::ThreadPool* thread_pool,
+                    const ScanContext& context)
+      : state_(std::make_shared<State>(std::move(scan_tasks), thread_pool, context)) {}
+
+  AsyncScanIterator(AsyncScanIterator&&) = default;
+  AsyncScanIterator& operator=(AsyncScanIterator&&) = default;
+
+  ~AsyncScanIterator() {
+    if (state_ != nullptr) {
+      state_->Stop();
+    }
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() { return state_->Next(); }
+
+ protected:
+  struct ActiveTask {
+    explicit ActiveTask(std::shared_ptr<ScanTask> task) : task(std::move(task)) {}
+
+    std::shared_ptr<ScanTask> task;
+    // Groups the spans of the reads of the task, which run on various threads
+    const int64_t trace_task_id = util::tracing::NewTaskId();
+    // Only accessed by the (single) outstanding read
+    bool executed = false;
+    RecordBatchIterator batches;
+
+    std::deque<std::shared_ptr<RecordBatch>> buffered;
+    bool reading = false;
+    bool finished = false;
+  };
+
+  struct State : public std::enable_shared_from_this<State> {
+    State(ScanTaskIterator scan_tasks, internal::ThreadPool* thread_pool,
+          const ScanContext& context)
+        : scan_tasks(std::move(scan_tasks)),
+          thread_pool(thread_pool),
+          readahead_tasks(std::max(context.readahead_tasks, 1)),
+          readahead_bytes(context.readahead_bytes),
+          preserve_order(context.preserve_order) {}
+
+    Result<std::shared_ptr<RecordBatch>> Next() {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true) {
+        RETURN_NOT_OK(status);
+        // Forget about fully consumed tasks
+        for (auto it = active_tasks.begin(); it != active_tasks.end();) {
+          if ((*it)->finished && (*it)->buffered.empty()) {
+            it = active_tasks.erase(it);
+          } else {
+            ++it;
+          }
+        }
+        ScheduleUnlocked();
+        RETURN_NOT_OK(status);
+        // Only the first task can yield if the order is preserved
+        const size_t num_candidates =
+            preserve_order ? std::min<size_t>(active_tasks.size(), 1)
+                           : active_tasks.size();
+        for (size_t i = 0; i < num_candidates; ++i) {
+          auto& buffered = active_tasks[i]->buffered;
+          if (!buffered.empty()) {
+            auto batch = std::move(buffered.front());
+            buffered.pop_front();
+            bytes_buffered -= BufferSize(*batch);
+            ScheduleUnlocked();
+            return batch;
+          }
+        }
+        if (active_tasks.empty() && scan_tasks_exhausted) {
+          return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+        }
+        // Some read is outstanding: wait for it to complete
+        cv.wait(lock);
+      }
+    }
+
+    // Activate new tasks and start reads, as permitted by the limits.
+    // The mutex must be held.
+    void ScheduleUnlocked() {
+      while (static_cast<int32_t>(active_tasks.size()) < readahead_tasks &&
+             !scan_tasks_exhausted && status.ok()) {
+        auto maybe_task = scan_tasks.Next();
+        if (!maybe_task.ok()) {
+          status = maybe_task.status();
+          break;
+        }
+        auto task = std::move(maybe_task).ValueOrDie();
+        if (task == nullptr) {
+          scan_tasks_exhausted = true;
+        } else {
+          active_tasks.push_back(std::make_shared<ActiveTask>(std::move(task)));
+        }
+      }
+      bool head = true;
+      for (const auto& active_task : active_tasks) {
+        if (!status.ok()) {
+          break;
+        }
+        // The first unfinished task is always allowed one read (so that the
+        // next batch in order eventually arrives), unless it already holds
+        // a batch.
+        const bool allowed = bytes_buffered < readahead_bytes ||
+                             (head && active_task->buffered.empty());
+        if (!active_task->finished) {
+          if (!active_task->reading && allowed) {
+            StartRead(active_task);
+          }
+          head = false;
+        }
+      }
+    }
+
+    void StartRead(const std::shared_ptr<ActiveTask>& active_task) {
+      active_task->reading = true;
+      ++outstanding_reads;
+      auto self = shared_from_this();
+      auto st = thread_pool->Spawn([self, active_task] {
+        auto maybe_batch = ReadNext(active_task.get());
+        std::lock_guard<std::mutex> lock(self->mutex);
+        self->FinishRead(active_task.get(), std::move(maybe_batch));
+      });
+      if (!st.ok()) {
+        FinishRead(active_task.get(), st);
+      }
+    }
+
+    static Result<std::shared_ptr<RecordBatch>> ReadNext(ActiveTask* active_task) {
+      ARROW_TRACE_TASK(active_task->trace_task_id);
+      ARROW_TRACE_SPAN("dataset::ReadScanTask");
+      if (!active_task->executed) {
+        ARROW_ASSIGN_OR_RAISE(active_task->batches, active_task->task->Execute());
+        active_task->executed = true;
+      }
+      return active_task->batches.Next();
+    }
+
+    // The mutex must be held.
+    void FinishRead(ActiveTask* active_task,
+                    Result<std::shared_ptr<RecordBatch>> maybe_batch) {
+      active_task->reading = false;
+      --outstanding_reads;
+      if (!maybe_batch.ok()) {
+        status &= maybe_batch.status();
+      } else if (*maybe_batch == nullptr) {
+        active_task->finished = true;
+      } else {
+        bytes_buffered += BufferSize(**maybe_batch);
+        active_task->buffered.push_back(std::move(maybe_batch).ValueOrDie());
+      }
+      if (!stopped) {
+        ScheduleUnlocked();
+      }
+      cv.notify_all();
+    }
+
+    // Wait for the outstanding reads, which may access the ScanTasks
+    void Stop() {
+      std::unique_lock<std::mutex> lock(mutex);
+      stopped = true;
+      cv.wait(lock, [this] { return outstanding_reads == 0; });
+    }
+
+    ScanTaskIterator scan_tasks;
+    internal::ThreadPool* thread_pool;
+    const int32_t readahead_tasks;
+    const int64_t readahead_bytes;
+    const bool preserve_order;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::shared_ptr<ActiveTask>> active_tasks;
+    bool scan_tasks_exhausted = false;
+    bool stopped = false;
+    int64_t bytes_buffered = 0;
+    int outstanding_reads = 0;
+    Status status;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+/// \brief An iterator yielding the first `limit` rows of a sequence of batches.
+///
+/// The wrapped iterator is released as soon as the limit is reached, rather than
+/// at the end of the iteration, so that the ScanTasks it would execute next (or
+/// read ahead, in async mode) are never started.
+class LimitIterator {
+ public:
+  LimitIterator(RecordBatchIterator batches, int64_t limit)
+      : batches_(std::move(batches)), remaining_(limit) {
+    if (remaining_ == 0) {
+      batches_ = RecordBatchIterator();
+    }
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (remaining_ == 0) {
+      return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto batch, batches_.Next());
+    if (batch == nullptr) {
+      remaining_ = 0;
+    } else if (batch->num_rows() < remaining_) {
+      remaining_ -= batch->num_rows();
+      return batch;
+    } else {
+      batch = batch->Slice(0, remaining_);
+      remaining_ = 0;
+    }
+    batches_ = RecordBatchIterator();
+    return batch;
+  }
+
+ private:
+  RecordBatchIterator batches_;
+  int64_t remaining_;
+};
+
+}  // namespace
+
+Result<RecordBatchIterator> Scanner::ScanBatches() {
+  ARROW_ASSIGN_OR_RAISE(auto scan_task_it, Scan());
+
+  RecordBatchIterator batch_it;
+  if (scan_context_->use_async) {
+    batch_it = RecordBatchIterator(AsyncScanIterator(
+        std::move(scan_task_it), io::internal::GetIOThreadPool(), *scan_context_));
+  } else {
+    auto execute = [](std::shared_ptr<ScanTask> task) { return task->Execute(); };
+    batch_it =
+        MakeFlattenIterator(MakeMaybeMapIterator(execute, std::move(scan_task_it)));
+  }
+
+  if (scan_options_->limit >= 0) {
+    return RecordBatchIterator(LimitIterator(std::move(batch_it), scan_options_->limit));
+  }
+  return batch_it;
+}
+
 Result<std::shared_ptr<Table>> Scanner::ToTable() {
+  // A limited scan is read in order, which lets it stop after the first rows
+  // instead of executing every ScanTask concurrently.
+  if (scan_context_->use_async || scan_options_->limit >= 0) {
+    ARROW_ASSIGN_OR_RAISE(auto batch_it, ScanBatches());
+    RecordBatchVector batches;
+    for (auto maybe_batch : batch_it) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+      batches.emplace_back(std::move(batch));
+    }
+    return Table::FromRecordBatches(scan_options_->schema(), std::move(batches));
+  }
+
   ARROW_ASSIGN_OR_RAISE(auto scan_task_it, Scan());
-  std::mutex mutex;
-  RecordBatchVector batches;
+
+  // Each ScanTask is read in full by a single task, and its batches are
+  // collected in the order of the ScanTasks.
+  auto read = [](std::shared_ptr<ScanTask> scan_task) -> Result<RecordBatchIterator> {
+    ARROW_TRACE_TASK(util::tracing::NewTaskId());
+    ARROW_TRACE_SPAN("dataset::ScanTask");
+    ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
+    ARROW_ASSIGN_OR_RAISE(auto batches, batch_it.ToVector());
+    return MakeVectorIterator(std::move(batches));
+  };
+
+  Iterator<RecordBatchIterator> batch_its;
+  if (scan_context_->use_threads) {
+    batch_its = MakeParallelMapIterator(read, std::move(scan_task_it));
+  } else {
+    batch_its = MakeMaybeMapIterator(read, std::move(scan_task_it));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto batches,
+                        MakeFlattenIterator(std::move(batch_its)).ToVector());
+  return Table::FromRecordBatches(scan_options_->schema(), std::move(batches));
+}
+
+Result<int64_t> Scanner::CountRows() {
+  FragmentIterator fragment_it;
+  if (fragment_ != nullptr) {
+    fragment_it = MakeVectorIterator(FragmentVector{fragment_});
+  } else {
+    // Don't project any column, so that scanned fragments only read the columns
+    // referenced by the filter
+    fragment_it = GetFragmentsFromDatasets(
+        {dataset_}, scan_options_->ReplaceSchema(::arrow::schema({})));
+  }
 
   auto task_group = scan_context_->TaskGroup();
+  std::atomic<int64_t> total{0};
 
-  for (auto maybe_scan_task : scan_task_it) {
-    ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+  for (auto maybe_fragment : fragment_it) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, std::move(maybe_fragment));
 
-    task_group->Append([&batches, &mutex, scan_task] {
-      ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
+    task_group->Append([this, &total, fragment] {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_num_rows, fragment->CountRows(scan_context_));
+      if (maybe_num_rows.has_value()) {
+        total += *maybe_num_rows;
+        return Status::OK();
+      }
 
+      Scanner scanner(fragment, scan_context_);
+      ARROW_ASSIGN_OR_RAISE(auto batch_it, scanner.ScanBatches());
       for (auto maybe_batch : batch_it) {
         ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
-        std::lock_guard<std::mutex> lock(mutex);
-        batches.emplace_back(std::move(batch));
+        total += batch->num_rows();
       }
-
       return Status::OK();
     });
   }
 
   // Wait for all tasks to complete, or the first error.
   RETURN_NOT_OK(task_group->Finish());
+  if (scan_options_->limit >= 0) {
+    return std::min(total.load(), scan_options_->limit);
+  }
+  return total.load();
+}
 
-  return Table::FromRecordBatches(scan_options_->schema(), std::move(batches));
+Result<std::vector<compute::Datum>> Scanner::Aggregate(
+    std::vector<compute::BatchAggregate> aggregates) {
+  compute::FunctionContext ctx(scan_context_->pool);
+  std::unique_ptr<compute::BatchAggregator> aggregator;
+  RETURN_NOT_OK(compute::BatchAggregator::Make(&ctx, std::move(aggregates), &aggregator));
+
+  if (scan_context_->use_async || scan_options_->limit >= 0) {
+    ARROW_ASSIGN_OR_RAISE(auto batch_it, ScanBatches());
+    for (auto maybe_batch : batch_it) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+      RETURN_NOT_OK(aggregator->Consume(*batch));
+    }
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto scan_task_it, Scan());
+    auto task_group = scan_context_->TaskGroup();
+    compute::BatchAggregator* raw_aggregator = aggregator.get();
+
+    for (auto maybe_scan_task : scan_task_it) {
+      ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+
+      task_group->Append([raw_aggregator, scan_task] {
+        ARROW_TRACE_TASK(util::tracing::NewTaskId());
+        ARROW_TRACE_SPAN("dataset::AggregateScanTask");
+        ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
+
+        for (auto maybe_batch : batch_it) {
+          ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+          RETURN_NOT_OK(raw_aggregator->Consume(*batch));
+        }
+
+        return Status::OK();
+      });
+    }
+
+    // Wait for all tasks to complete, or the first error.
+    RETURN_NOT_OK(task_group->Finish());
+  }
+
+  std::vector<compute::Datum> out;
+  RETURN_NOT_OK(aggregator->Finish(&out));
+  return out;
 }
 
 }  // namespace dataset
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -24,6 +26,7 @@
 #include <vector>
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/aggregate.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/projector.h"
 #include "arrow/dataset/type_fwd.h"
@@ -48,6 +51,28 @@ struct ARROW_DS_EXPORT ScanContext {
   /// Indicate if the Scanner should make use of a ThreadPool.
   bool use_threads = false;
 
+  /// Indicate if the Scanner should execute ScanTasks asynchronously on the
+  /// I/O thread pool, reading batches ahead of the consumer.
+  bool use_async = false;
+
+  /// In async mode, the maximum number of ScanTasks being read concurrently.
+  int32_t readahead_tasks = 8;
+
+  /// In async mode, the maximum number of bytes held by batches read ahead but
+  /// not yet consumed.  The next batch in order is always read, whatever its
+  /// size, so that the scan makes progress.
+  int64_t readahead_bytes = 64 << 20;
+
+  /// In async mode, whether batches are yielded in ScanTask order.  If false,
+  /// batches are yielded as soon as they are read.
+  bool preserve_order = true;
+
+  /// The number of row groups which scans using this context, or splitting
+  /// fragments by row group with it, skipped because their statistics or Bloom
+  /// filters proved that no row could satisfy the filter.  ORC stripes are
+  /// counted as row groups; formats without either never increment it.
+  std::atomic<int64_t> num_row_groups_pruned{0};
+
   /// Return a threaded or serial TaskGroup according to use_threads.
   std::shared_ptr<internal::TaskGroup> TaskGroup() const;
 };
@@ -79,6 +104,13 @@ class ARROW_DS_EXPORT ScanOptions {
   // Maximum row count for scanned batches.
   int64_t batch_size = 1 << 15;
 
+  // Maximum number of rows yielded by the scan, or -1 for no limit.
+  //
+  // Once the limit is reached no further ScanTask is executed and the last batch
+  // is truncated.  Scan() itself yields ScanTasks and ignores the limit, which is
+  // applied by ScanBatches(), ToTable(), Aggregate() and CountRows().
+  int64_t limit = -1;
+
   // Return a vector of fields that requires materialization.
   //
   // This is usually the union of the fields referenced in the projection and the
@@ -168,12 +200,52 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Return an iterator over the scanned (filtered and projected)
+  /// RecordBatches.
+  ///
+  /// If ScanContext::use_async is set, ScanTasks are executed on the I/O thread
+  /// pool, up to ScanContext::readahead_tasks at a time, and batches are read
+  /// ahead of the consumer within the ScanContext::readahead_bytes limit.
+  /// Otherwise, the ScanTasks are executed serially when the iterator is
+  /// advanced.
+  ///
+  /// If ScanOptions::limit is set, the iterator ends after that many rows.  It
+  /// then releases the ScanTasks, so that no new read is started; in async mode
+  /// the reads already in flight are waited for and discarded.
+  Result<RecordBatchIterator> ScanBatches();
+
   /// \brief Convert a Scanner into a Table.
   ///
   /// Use this convenience utility with care. This will serially materialize the
   /// Scan result in memory before creating the Table.
+  ///
+  /// If ScanContext::use_async or ScanOptions::limit is set, the batches are read
+  /// by ScanBatches(), so that a limited scan stops reading once it has enough
+  /// rows.
   Result<std::shared_ptr<Table>> ToTable();
 
+  /// \brief Aggregate columns of the scanned (filtered and projected)
+  /// RecordBatches, without materializing them.
+  ///
+  /// The ScanTasks are executed as by ToTable(), each batch being consumed by
+  /// a compute::BatchAggregator as soon as it is read.  With use_threads,
+  /// each thread of the pool aggregates into states of its own, which are
+  /// merged at the end.
+  ///
+  /// \param[in] aggregates the aggregates to compute
+  /// \return one scalar datum per aggregate
+  Result<std::vector<compute::Datum>> Aggregate(
+      std::vector<compute::BatchAggregate> aggregates);
+
+  /// \brief Count the rows which satisfy the filter, without materializing them.
+  ///
+  /// Fragments whose filter is trivially true, e.g. because it only references
+  /// partition fields, are counted from their metadata when possible, such as the
+  /// FileMetaData of Parquet files. Other fragments are scanned, reading only the
+  /// columns referenced by the filter. With use_threads, fragments are counted
+  /// concurrently. The count is capped by ScanOptions::limit, if set.
+  Result<int64_t> CountRows();
+
   /// \brief GetFragments returns an iterator over all Fragments in this scan.
   FragmentIterator GetFragments();
 
@@ -225,10 +297,20 @@ class ARROW_DS_EXPORT ScannerBuilder {
   Status Filter(std::shared_ptr<Expression> filter);
   Status Filter(const Expression& filter);
 
+  /// \brief Set the evaluator used to apply the filter expression.
+  ///
+  /// By default, a TreeEvaluator is used.  See GandivaEvaluator for an evaluator
+  /// which JIT-compiles the filter.
+  Status Evaluator(std::shared_ptr<ExpressionEvaluator> evaluator);
+
   /// \brief Indicate if the Scanner should make use of the available
   ///        ThreadPool found in ScanContext;
   Status UseThreads(bool use_threads = true);
 
+  /// \brief Indicate if the Scanner should read ahead asynchronously on the
+  ///        I/O thread pool; see ScanContext::use_async.
+  Status UseAsync(bool use_async = true);
+
   /// \brief Set the maximum number of rows per RecordBatch.
   ///
   /// \param[in] batch_size the maximum number of rows.
@@ -237,6 +319,15 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// This option provides a control limiting the memory owned by any RecordBatch.
   Status BatchSize(int64_t batch_size);
 
+  /// \brief Set the maximum number of rows yielded by the scan.
+  ///
+  /// \param[in] limit the maximum number of rows, 0 included.
+  /// \returns An error if the limit is negative.
+  ///
+  /// Useful for previews of large datasets: scanning stops as soon as enough rows
+  /// passed the filter, see ScanOptions::limit.
+  Status Limit(int64_t limit);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
@@ -246,6 +337,7 @@ class ARROW_DS_EXPORT ScannerBuilder {
   std::shared_ptr<Dataset> dataset_;
   std::shared_ptr<ScanOptions> scan_options_;
   std::shared_ptr<ScanContext> scan_context_;
+  std::shared_ptr<ExpressionEvaluator> evaluator_;
   bool has_projection_ = false;
   std::vector<std::string> project_columns_;
 };
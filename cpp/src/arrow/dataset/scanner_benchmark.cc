@@ -0,0 +1,252 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/file_parquet.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/slow.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/io_util.h"
+
+#include "parquet/arrow/writer.h"
+
+namespace arrow {
+namespace dataset {
+
+using string_literals::operator"" _;
+
+// Environment variable overriding the average latency (in seconds) of every
+// simulated storage call, e.g. 0.02 to approach S3 from outside its region.
+static const char* kEnvLatency = "ARROW_DATASET_BENCHMARK_LATENCY";
+static constexpr double kDefaultLatency = 0.005;
+
+static constexpr int64_t kTotalRows = 1 << 20;
+static constexpr int64_t kBatchRows = 1 << 16;
+static constexpr int kNumValueColumns = 8;
+
+// The "key" column is uniform in [0, 100), so that a `key < N` filter selects
+// about N percent of the rows.
+static constexpr int64_t kKeyCardinality = 100;
+
+enum class BenchmarkFormat : int64_t { IPC = 0, PARQUET = 1 };
+
+static double AverageLatency() {
+  auto maybe_value = ::arrow::internal::GetEnvVar(kEnvLatency);
+  if (!maybe_value.ok()) {
+    return kDefaultLatency;
+  }
+  return std::stod(*maybe_value);
+}
+
+static std::shared_ptr<Schema> DataSchema() {
+  FieldVector fields = {field("key", int64())};
+  for (int i = 0; i < kNumValueColumns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), float64()));
+  }
+  return schema(std::move(fields));
+}
+
+static std::shared_ptr<Table> MakeFragmentTable(int64_t num_rows, int64_t seed) {
+  random::RandomArrayGenerator rand(static_cast<random::SeedType>(seed));
+  auto data_schema = DataSchema();
+
+  RecordBatchVector batches;
+  for (int64_t offset = 0; offset < num_rows; offset += kBatchRows) {
+    const int64_t length = std::min(kBatchRows, num_rows - offset);
+    ArrayVector columns = {rand.Int64(length, 0, kKeyCardinality - 1, 0)};
+    for (int i = 0; i < kNumValueColumns; ++i) {
+      columns.push_back(rand.Float64(length, -1e10, 1e10, 0.1));
+    }
+    batches.push_back(RecordBatch::Make(data_schema, length, std::move(columns)));
+  }
+  return *Table::FromRecordBatches(data_schema, std::move(batches));
+}
+
+static Status WriteFragment(fs::FileSystem* filesystem, const std::string& path,
+                            BenchmarkFormat format, const Table& table) {
+  ARROW_ASSIGN_OR_RAISE(auto sink, filesystem->OpenOutputStream(path));
+  if (format == BenchmarkFormat::PARQUET) {
+    RETURN_NOT_OK(
+        parquet::arrow::WriteTable(table, default_memory_pool(), sink, kBatchRows));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto writer, ipc::NewFileWriter(sink.get(), table.schema()));
+    RETURN_NOT_OK(writer->WriteTable(table, kBatchRows));
+    RETURN_NOT_OK(writer->Close());
+  }
+  return sink->Close();
+}
+
+/// Write kTotalRows rows as a Hive-partitioned dataset of `num_fragments` files
+/// in memory, and open it through a SlowFileSystem so that every file open and
+/// read pays the simulated storage latency.
+static Result<std::shared_ptr<Dataset>> MakeDataset(BenchmarkFormat format,
+                                                    int64_t num_fragments) {
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  const int64_t rows_per_fragment = kTotalRows / num_fragments;
+  for (int64_t i = 0; i < num_fragments; ++i) {
+    auto dir = "/dataset/part=" + std::to_string(i);
+    RETURN_NOT_OK(mock_fs->CreateDir(dir));
+    auto table = MakeFragmentTable(rows_per_fragment, i);
+    RETURN_NOT_OK(WriteFragment(mock_fs.get(), dir + "/data", format, *table));
+  }
+
+  auto slow_fs = std::make_shared<fs::SlowFileSystem>(
+      mock_fs, io::LatencyGenerator::Make(AverageLatency(), /*seed=*/42));
+
+  std::shared_ptr<FileFormat> file_format;
+  if (format == BenchmarkFormat::PARQUET) {
+    file_format = std::make_shared<ParquetFileFormat>();
+  } else {
+    file_format = std::make_shared<IpcFileFormat>();
+  }
+
+  fs::FileSelector selector;
+  selector.base_dir = "/dataset";
+  selector.recursive = true;
+
+  FileSystemFactoryOptions options;
+  options.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("part", int32())}));
+
+  ARROW_ASSIGN_OR_RAISE(auto factory,
+                        FileSystemDatasetFactory::Make(slow_fs, std::move(selector),
+                                                       file_format, std::move(options)));
+  return factory->Finish();
+}
+
+/// Datasets are generated once per (format, fragment count) and shared by all
+/// the benchmarks sweeping the other parameters.
+static std::shared_ptr<Dataset> GetDataset(BenchmarkFormat format,
+                                           int64_t num_fragments) {
+  static std::map<std::pair<BenchmarkFormat, int64_t>, std::shared_ptr<Dataset>> cache;
+  auto key = std::make_pair(format, num_fragments);
+  auto it = cache.find(key);
+  if (it == cache.end()) {
+    auto dataset = MakeDataset(format, num_fragments);
+    ABORT_NOT_OK(dataset);
+    it = cache.emplace(key, *std::move(dataset)).first;
+  }
+  return it->second;
+}
+
+/// Build a Scanner from the benchmark arguments:
+/// (format, fragments, projected value columns, filter selectivity %, parallel).
+static std::shared_ptr<Scanner> MakeScanner(const benchmark::State& state,
+                                            std::shared_ptr<ScanContext> context) {
+  auto format = static_cast<BenchmarkFormat>(state.range(0));
+  auto dataset = GetDataset(format, state.range(1));
+
+  auto builder = *dataset->NewScan(std::move(context));
+  std::vector<std::string> columns = {"key"};
+  for (int64_t i = 0; i < state.range(2); ++i) {
+    columns.push_back("f" + std::to_string(i));
+  }
+  ABORT_NOT_OK(builder->Project(std::move(columns)));
+  if (state.range(3) < kKeyCardinality) {
+    ABORT_NOT_OK(builder->Filter("key"_ < state.range(3)));
+  }
+  return *builder->Finish();
+}
+
+/// Read the whole dataset with Scanner::ToTable(), which executes the ScanTasks
+/// on the CPU thread pool if use_threads is set.
+static void ScanToTable(benchmark::State& state) {  // NOLINT non-const reference
+  auto context = std::make_shared<ScanContext>();
+  context->use_threads = state.range(4) != 0;
+  auto scanner = MakeScanner(state, std::move(context));
+
+  int64_t total_rows = 0;
+  for (auto _ : state) {
+    auto table = *scanner->ToTable();
+    total_rows += table->num_rows();
+  }
+  state.SetItemsProcessed(total_rows);
+}
+
+/// Stream the dataset with Scanner::ScanBatches(), which reads ahead on the I/O
+/// thread pool if use_async is set, and report how long the first batch takes
+/// to arrive.
+static void ScanBatches(benchmark::State& state) {  // NOLINT non-const reference
+  auto context = std::make_shared<ScanContext>();
+  context->use_async = state.range(4) != 0;
+  auto scanner = MakeScanner(state, std::move(context));
+
+  int64_t total_rows = 0;
+  double first_batch_seconds = 0;
+  for (auto _ : state) {
+    auto start = std::chrono::steady_clock::now();
+    auto batch_it = *scanner->ScanBatches();
+    bool first = true;
+    for (auto maybe_batch : batch_it) {
+      auto batch = *std::move(maybe_batch);
+      if (first) {
+        first_batch_seconds += std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
+        first = false;
+      }
+      total_rows += batch->num_rows();
+    }
+  }
+  state.SetItemsProcessed(total_rows);
+  state.counters["first_batch_seconds"] =
+      benchmark::Counter(first_batch_seconds, benchmark::Counter::kAvgIterations);
+}
+
+static void ScanArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"format", "fragments", "columns", "selectivity", "parallel"});
+  for (auto format : {BenchmarkFormat::IPC, BenchmarkFormat::PARQUET}) {
+    for (int64_t fragments : {1, 16, 64}) {
+      for (int64_t columns : {1, kNumValueColumns}) {
+        for (int64_t selectivity : {1, 10, 100}) {
+          for (int64_t parallel : {0, 1}) {
+            bench->Args({static_cast<int64_t>(format), fragments, columns, selectivity,
+                         parallel});
+          }
+        }
+      }
+    }
+  }
+}
+
+BENCHMARK(ScanToTable)->Apply(ScanArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(ScanBatches)->Apply(ScanArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace dataset
+}  // namespace arrow
@@ -23,6 +23,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace dataset {
@@ -32,9 +33,8 @@ inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it,
                                              const Expression& filter, MemoryPool* pool) {
   return MakeMaybeMapIterator(
       [&filter, &evaluator, pool](std::shared_ptr<RecordBatch> in) {
-        return evaluator.Evaluate(filter, *in, pool).Map([&](compute::Datum selection) {
-          return evaluator.Filter(selection, in);
-        });
+        ARROW_TRACE_SPAN("dataset::Filter");
+        return evaluator.FilterBatch(filter, in, pool);
       },
       std::move(it));
 }
@@ -44,6 +44,7 @@ inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
                                               MemoryPool* pool) {
   return MakeMaybeMapIterator(
       [=](std::shared_ptr<RecordBatch> in) {
+        ARROW_TRACE_SPAN("dataset::Project");
         // The RecordBatchProjector is shared accross ScanTasks of the same
         // Fragment. The resize operation of missing columns is not thread safe.
         // Ensure that each ScanTask gets his own projector.
@@ -76,6 +77,7 @@ inline ScanTaskIterator GetScanTaskIterator(FragmentIterator fragments,
                                             std::shared_ptr<ScanContext> context) {
   // Fragment -> ScanTaskIterator
   auto fn = [context](std::shared_ptr<Fragment> fragment) {
+    ARROW_TRACE_SPAN_DETAIL("dataset::ScanFragment", fragment->type_name());
     return fragment->Scan(context);
   };
 
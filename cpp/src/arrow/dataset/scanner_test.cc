@@ -17,15 +17,24 @@
 
 #include "arrow/dataset/scanner.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sum.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
 class TestScanner : public DatasetFixtureMixin {
@@ -147,6 +156,263 @@ TEST_F(TestScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST_F(TestScanner, Aggregate) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+
+  double value = 0.5;
+  ASSERT_OK_AND_ASSIGN(auto f64,
+                       ArrayFromBuilderVisitor(float64(), kBatchSize, kBatchSize / 2,
+                                               [&](DoubleBuilder* builder) {
+                                                 builder->UnsafeAppend(value);
+                                                 builder->UnsafeAppend(-value);
+                                                 value += 1.0;
+                                               }));
+  auto i32 = ConstantArrayGenerator::Zeroes(kBatchSize, int32());
+  auto batch = RecordBatch::Make(schema_, f64->length(), {i32, f64});
+
+  // SELECT sum(f64), count(*) WHERE f64 > 0
+  options_->filter = ("f64"_ > 0.0).Copy();
+  options_->evaluator = std::make_shared<TreeEvaluator>();
+  auto scanner = MakeScanner(batch);
+  compute::FunctionContext fn_ctx;
+
+  for (bool use_async : {false, true}) {
+    for (bool use_threads : {false, true}) {
+      ctx_->use_async = use_async;
+      ctx_->use_threads = use_threads;
+      ASSERT_OK_AND_ASSIGN(
+          auto results,
+          scanner.Aggregate(
+              {compute::BatchAggregate(
+                   "f64", compute::MakeSumAggregateFunction(*float64(), &fn_ctx)),
+               compute::BatchAggregate::CountAll()}));
+      ASSERT_EQ(results.size(), 2);
+      // Each batch contributes 0.5 + 1.5 + ... + 511.5
+      ASSERT_EQ(checked_cast<const DoubleScalar&>(*results[0].scalar()).value,
+                131072.0 * kNumberBatches * kNumberChildDatasets);
+      ASSERT_EQ(checked_cast<const Int64Scalar&>(*results[1].scalar()).value,
+                kBatchSize / 2 * kNumberBatches * kNumberChildDatasets);
+    }
+  }
+
+  auto sum_x = compute::BatchAggregate(
+      "x", compute::MakeSumAggregateFunction(*float64(), &fn_ctx));
+  ASSERT_RAISES(Invalid, scanner.Aggregate({sum_x}));
+}
+
+TEST_F(TestScanner, CountRows) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+
+  double value = 0.5;
+  ASSERT_OK_AND_ASSIGN(auto f64,
+                       ArrayFromBuilderVisitor(float64(), kBatchSize, kBatchSize / 2,
+                                               [&](DoubleBuilder* builder) {
+                                                 builder->UnsafeAppend(value);
+                                                 builder->UnsafeAppend(-value);
+                                                 value += 1.0;
+                                               }));
+  auto i32 = ConstantArrayGenerator::Zeroes(kBatchSize, int32());
+  auto batch = RecordBatch::Make(schema_, f64->length(), {i32, f64});
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+
+    // Counted from the fragments without scanning them
+    options_->filter = scalar(true);
+    ASSERT_OK_AND_ASSIGN(auto num_rows, MakeScanner(batch).CountRows());
+    ASSERT_EQ(num_rows, kBatchSize * kNumberBatches * kNumberChildDatasets);
+
+    options_->filter = ("f64"_ > 0.0).Copy();
+    options_->evaluator = std::make_shared<TreeEvaluator>();
+    ASSERT_OK_AND_ASSIGN(num_rows, MakeScanner(batch).CountRows());
+    ASSERT_EQ(num_rows, kBatchSize / 2 * kNumberBatches * kNumberChildDatasets);
+  }
+}
+
+TEST_F(TestScanner, ScanBatches) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  auto scanner = MakeScanner(batch);
+
+  for (bool use_async : {false, true}) {
+    ctx_->use_async = use_async;
+    ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatches());
+    int64_t num_batches = 0;
+    ASSERT_OK(batch_it.Visit([&](std::shared_ptr<RecordBatch> actual) {
+      AssertBatchesEqual(*batch, *actual);
+      ++num_batches;
+      return Status::OK();
+    }));
+    ASSERT_EQ(num_batches, kNumberChildDatasets * kNumberBatches);
+  }
+}
+
+class TestAsyncScanner : public DatasetFixtureMixin {
+ protected:
+  void SetUp() override {
+    SetSchema({field("i", int64())});
+    // Each fragment yields a few batches of consecutive integers
+    int64_t value = 0;
+    DatasetVector children;
+    for (int i = 0; i < 10; ++i) {
+      RecordBatchVector batches;
+      for (int j = 0; j < 3; ++j) {
+        ASSERT_OK_AND_ASSIGN(auto array, ArrayFromBuilderVisitor(
+                                             int64(), 100, [&](Int64Builder* builder) {
+                                               builder->UnsafeAppend(value++);
+                                             }));
+        batches.push_back(RecordBatch::Make(schema_, array->length(), {array}));
+      }
+      expected_batches_.insert(expected_batches_.end(), batches.begin(), batches.end());
+      children.push_back(std::make_shared<InMemoryDataset>(schema_, batches));
+    }
+    ASSERT_OK_AND_ASSIGN(dataset_, UnionDataset::Make(schema_, children));
+    ctx_->use_async = true;
+  }
+
+  Result<RecordBatchVector> ScanAll() {
+    Scanner scanner{dataset_, options_, ctx_};
+    ARROW_ASSIGN_OR_RAISE(auto batch_it, scanner.ScanBatches());
+    RecordBatchVector batches;
+    RETURN_NOT_OK(batch_it.Visit([&](std::shared_ptr<RecordBatch> batch) {
+      batches.push_back(std::move(batch));
+      return Status::OK();
+    }));
+    return batches;
+  }
+
+  void AssertOrderedScan() {
+    ASSERT_OK_AND_ASSIGN(auto batches, ScanAll());
+    ASSERT_EQ(batches.size(), expected_batches_.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      AssertBatchesEqual(*expected_batches_[i], *batches[i]);
+    }
+  }
+
+  std::shared_ptr<Dataset> dataset_;
+  RecordBatchVector expected_batches_;
+};
+
+TEST_F(TestAsyncScanner, PreserveOrder) {
+  AssertOrderedScan();
+
+  ctx_->readahead_tasks = 1;
+  AssertOrderedScan();
+
+  // Only the next batch in order can be read ahead
+  ctx_->readahead_tasks = 4;
+  ctx_->readahead_bytes = 0;
+  AssertOrderedScan();
+}
+
+TEST_F(TestAsyncScanner, Unordered) {
+  ctx_->preserve_order = false;
+  ctx_->readahead_bytes = 1000;
+  ASSERT_OK_AND_ASSIGN(auto batches, ScanAll());
+
+  // Each value is seen exactly once
+  std::vector<int64_t> values;
+  for (const auto& batch : batches) {
+    const auto& array = checked_cast<const Int64Array&>(*batch->column(0));
+    values.insert(values.end(), array.raw_values(), array.raw_values() + array.length());
+  }
+  std::sort(values.begin(), values.end());
+  ASSERT_EQ(values.size(), 3000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], static_cast<int64_t>(i));
+  }
+}
+
+TEST_F(TestAsyncScanner, ToTable) {
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(expected_batches_));
+  Scanner scanner{dataset_, options_, ctx_};
+  ASSERT_OK_AND_ASSIGN(auto actual, scanner.ToTable());
+  AssertTablesEqual(*expected, *actual);
+}
+
+TEST_F(TestAsyncScanner, EarlyDestruction) {
+  // Destroying the iterator before exhaustion waits for outstanding reads
+  Scanner scanner{dataset_, options_, ctx_};
+  ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatches());
+  ASSERT_OK_AND_ASSIGN(auto batch, batch_it.Next());
+  AssertBatchesEqual(*expected_batches_[0], *batch);
+}
+
+TEST_F(TestAsyncScanner, Limit) {
+  for (bool use_async : {false, true}) {
+    ctx_->use_async = use_async;
+
+    options_->limit = 250;
+    ASSERT_OK_AND_ASSIGN(auto batches, ScanAll());
+    ASSERT_EQ(batches.size(), 3);
+    AssertBatchesEqual(*expected_batches_[0], *batches[0]);
+    AssertBatchesEqual(*expected_batches_[1], *batches[1]);
+    AssertBatchesEqual(*expected_batches_[2]->Slice(0, 50), *batches[2]);
+
+    Scanner scanner{dataset_, options_, ctx_};
+    ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+    ASSERT_EQ(table->num_rows(), 250);
+    ASSERT_OK_AND_ASSIGN(auto num_rows, scanner.CountRows());
+    ASSERT_EQ(num_rows, 250);
+
+    // A limit at a batch boundary doesn't slice
+    options_->limit = 200;
+    ASSERT_OK_AND_ASSIGN(batches, ScanAll());
+    ASSERT_EQ(batches.size(), 2);
+    AssertBatchesEqual(*expected_batches_[1], *batches[1]);
+
+    options_->limit = 0;
+    ASSERT_OK_AND_ASSIGN(batches, ScanAll());
+    ASSERT_EQ(batches.size(), 0);
+
+    options_->limit = 1 << 20;
+    AssertOrderedScan();
+  }
+}
+
+// Counts the batches pulled from an InMemoryDataset, each of which becomes a
+// Fragment.
+class CountingBatchGenerator : public InMemoryDataset::RecordBatchGenerator {
+ public:
+  explicit CountingBatchGenerator(RecordBatchVector batches)
+      : batches_(std::move(batches)) {}
+
+  RecordBatchIterator Get() const override {
+    auto count = count_;
+    return MakeMapIterator(
+        [count](std::shared_ptr<RecordBatch> batch) {
+          ++*count;
+          return batch;
+        },
+        MakeVectorIterator(batches_));
+  }
+
+  int count() const { return *count_; }
+
+ private:
+  RecordBatchVector batches_;
+  std::shared_ptr<std::atomic<int>> count_ = std::make_shared<std::atomic<int>>(0);
+};
+
+TEST_F(TestAsyncScanner, LimitStopsScanning) {
+  auto generator = std::make_shared<CountingBatchGenerator>(expected_batches_);
+  auto dataset = std::make_shared<InMemoryDataset>(schema_, generator);
+  options_->limit = 150;
+
+  ctx_->use_async = false;
+  Scanner scanner{dataset, options_, ctx_};
+  ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+  ASSERT_EQ(table->num_rows(), 150);
+  ASSERT_LE(generator->count(), 3);
+
+  // At most readahead_tasks fragments are in flight when the limit is reached
+  ctx_->use_async = true;
+  ctx_->readahead_tasks = 4;
+  ASSERT_OK_AND_ASSIGN(table, scanner.ToTable());
+  ASSERT_EQ(table->num_rows(), 150);
+  ASSERT_LE(generator->count(), 3 + 2 + 4);
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     DatasetVector sources;
@@ -181,6 +447,19 @@ TEST_F(TestScannerBuilder, TestProject) {
   ASSERT_RAISES(Invalid, builder.Project({"i8", "not_found_column"}));
 }
 
+TEST_F(TestScannerBuilder, TestLimit) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.Limit(0));
+  ASSERT_OK(builder.Limit(100));
+  ASSERT_RAISES(Invalid, builder.Limit(-1));
+
+  // The limit survives the projection
+  ASSERT_OK(builder.Project({"i8"}));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_EQ(scanner->options()->limit, 100);
+}
+
 TEST_F(TestScannerBuilder, TestFilter) {
   ScannerBuilder builder(dataset_, ctx_);
 
@@ -37,6 +37,8 @@ class FileSystem;
 
 struct FileInfo;
 
+class PathForest;
+
 }  // namespace fs
 
 namespace dataset {
@@ -51,19 +53,26 @@ using FragmentVector = std::vector<std::shared_ptr<Fragment>>;
 class FileSource;
 class FileFormat;
 class FileFragment;
+class FileWriter;
 class FileSystemDataset;
+class FragmentMetadataCache;
+struct FileSystemDatasetWriteOptions;
 
 class ParquetFileFormat;
 class ParquetFileFragment;
 
 class IpcFileFormat;
 
+class OrcFileFormat;
+class OrcFileFragment;
+
 class Expression;
 using ExpressionVector = std::vector<std::shared_ptr<Expression>>;
 
 class ComparisonExpression;
 class InExpression;
 class IsValidExpression;
+class MatchSubstringExpression;
 class AndExpression;
 class OrExpression;
 class NotExpression;
@@ -19,6 +19,7 @@
 
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 #include "arrow/dbi/hiveserver2/operation.h"
+#include "arrow/dbi/hiveserver2/record_batch_reader.h"
 #include "arrow/dbi/hiveserver2/service.h"
 #include "arrow/dbi/hiveserver2/session.h"
 #include "arrow/dbi/hiveserver2/types.h"
@@ -24,11 +24,14 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/dbi/hiveserver2/record_batch_reader.h"
 #include "arrow/dbi/hiveserver2/service.h"
 #include "arrow/dbi/hiveserver2/session.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 
 namespace arrow {
@@ -279,6 +282,39 @@ TEST_F(OperationTest, TestIsNull) {
   ASSERT_OK(select_nulls_op->Close());
 }
 
+TEST_F(OperationTest, TestRecordBatchReader) {
+  CreateTestTable();
+  InsertIntoTestTable(std::vector<int>({1, 2, 3, 4, NULL_INT_VALUE}),
+                      std::vector<std::string>({"a", "NULL", "c", "d", "e"}));
+
+  std::unique_ptr<Operation> select_op;
+  ASSERT_OK(session_->ExecuteStatement("select * from " + TEST_TBL + " order by int_col",
+                                       &select_op));
+
+  // A small max_rows forces several fetches, each overlapped with a conversion.
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(MakeRecordBatchReader(select_op.get(), 2, default_memory_pool(), &reader));
+  auto expected_schema = schema({field(TEST_COL1, int32()), field(TEST_COL2, utf8())});
+  AssertSchemaEqual(*reader->schema(), *expected_schema);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_EQ(batches.size(), 3u);
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_LE(batch->num_rows(), 2);
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+  ASSERT_OK_AND_ASSIGN(table, table->CombineChunks());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3, 4, null]"),
+                    *table->column(0)->chunk(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", null, "c", "d", "e"])"),
+                    *table->column(1)->chunk(0));
+
+  ASSERT_OK(select_op->Close());
+}
+
 TEST_F(OperationTest, TestCancel) {
   CreateTestTable();
   InsertIntoTestTable(std::vector<int>({1, 2, 3, 4}),
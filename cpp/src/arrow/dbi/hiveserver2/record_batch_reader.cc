@@ -0,0 +1,356 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dbi/hiveserver2/record_batch_reader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/dbi/hiveserver2/operation.h"
+#include "arrow/dbi/hiveserver2/thrift_internal.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace hiveserver2 {
+
+Status ColumnTypeToArrowType(const ColumnType& type, std::shared_ptr<DataType>* out) {
+  switch (type.type_id()) {
+    case ColumnType::TypeId::BOOLEAN:
+      *out = boolean();
+      break;
+    case ColumnType::TypeId::TINYINT:
+      *out = int8();
+      break;
+    case ColumnType::TypeId::SMALLINT:
+      *out = int16();
+      break;
+    case ColumnType::TypeId::INT:
+      *out = int32();
+      break;
+    case ColumnType::TypeId::BIGINT:
+      *out = int64();
+      break;
+    case ColumnType::TypeId::FLOAT:
+    case ColumnType::TypeId::DOUBLE:
+      *out = float64();
+      break;
+    case ColumnType::TypeId::BINARY:
+      *out = binary();
+      break;
+    case ColumnType::TypeId::STRING:
+    case ColumnType::TypeId::TIMESTAMP:
+    case ColumnType::TypeId::DECIMAL:
+    case ColumnType::TypeId::DATE:
+    case ColumnType::TypeId::VARCHAR:
+    case ColumnType::TypeId::CHAR:
+      *out = utf8();
+      break;
+    default:
+      return Status::NotImplemented("Conversion of HiveServer2 type ",
+                                    TypeIdToString(type.type_id()),
+                                    " to Arrow is not supported");
+  }
+  return Status::OK();
+}
+
+Status ColumnDescsToSchema(const std::vector<ColumnDesc>& column_descs,
+                           std::shared_ptr<Schema>* out) {
+  std::vector<std::shared_ptr<Field>> fields;
+  fields.reserve(column_descs.size());
+  for (const ColumnDesc& column_desc : column_descs) {
+    std::shared_ptr<DataType> type;
+    RETURN_NOT_OK(ColumnTypeToArrowType(*column_desc.type(), &type));
+    fields.push_back(field(column_desc.column_name(), std::move(type)));
+  }
+  *out = schema(std::move(fields));
+  return Status::OK();
+}
+
+namespace {
+
+// HiveServer2 sets a bit for each null value, Arrow sets a bit for each valid
+// value, both in LSB order, so the validity bitmap is the byte-wise complement of
+// the null bitmap. Due to HUE-2722 the null bitmap may be shorter than the column,
+// in which case the missing trailing values are non-null.
+Status ConvertNulls(const Column& column, int64_t length, MemoryPool* pool,
+                    std::shared_ptr<Buffer>* validity, int64_t* null_count) {
+  const int64_t num_bytes = BitUtil::BytesForBits(length);
+  const int64_t num_null_bytes = std::min(num_bytes, column.nulls_size());
+  const uint8_t* nulls = column.nulls();
+
+  // Fast path: no null bit is set anywhere in the column.
+  int64_t i = 0;
+  while (i < num_null_bytes && nulls[i] == 0) {
+    ++i;
+  }
+  if (i == num_null_bytes) {
+    *validity = nullptr;
+    *null_count = 0;
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(*validity, AllocateBitmap(length, pool));
+  uint8_t* bitmap = (*validity)->mutable_data();
+  for (i = 0; i < num_null_bytes; ++i) {
+    bitmap[i] = static_cast<uint8_t>(~nulls[i]);
+  }
+  std::memset(bitmap + num_null_bytes, 0xFF,
+              static_cast<size_t>(num_bytes - num_null_bytes));
+  *null_count = length - internal::CountSetBits(bitmap, 0, length);
+  return Status::OK();
+}
+
+template <typename ColumnClass>
+Status ConvertFixedWidth(const ColumnClass& column, const std::shared_ptr<DataType>& type,
+                         MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  using CType = typename std::decay<decltype(column.data()[0])>::type;
+  const int64_t length = column.length();
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  RETURN_NOT_OK(ConvertNulls(column, length, pool, &validity, &null_count));
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                        AllocateBuffer(length * sizeof(CType), pool));
+  if (length > 0) {
+    std::memcpy(values->mutable_data(), column.data().data(), length * sizeof(CType));
+  }
+  *out = ArrayData::Make(type, length, {std::move(validity), std::move(values)},
+                         null_count);
+  return Status::OK();
+}
+
+Status ConvertBoolean(const BoolColumn& column, MemoryPool* pool,
+                      std::shared_ptr<ArrayData>* out) {
+  const int64_t length = column.length();
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  RETURN_NOT_OK(ConvertNulls(column, length, pool, &validity, &null_count));
+
+  // std::vector<bool> is itself bit-packed but exposes no raw pointer, so pack the
+  // values eight at a time.
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values, AllocateBitmap(length, pool));
+  const std::vector<bool>& data = column.data();
+  int64_t i = 0;
+  internal::GenerateBitsUnrolled(values->mutable_data(), 0, length,
+                                 [&]() -> bool { return data[i++]; });
+  *out = ArrayData::Make(boolean(), length, {std::move(validity), std::move(values)},
+                         null_count);
+  return Status::OK();
+}
+
+Status ConvertBinary(const StringColumn& column, const std::shared_ptr<DataType>& type,
+                     MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  const int64_t length = column.length();
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  RETURN_NOT_OK(ConvertNulls(column, length, pool, &validity, &null_count));
+
+  // Size the data buffer up front so every value is copied exactly once.
+  const std::vector<std::string>& data = column.data();
+  int64_t data_length = 0;
+  for (const std::string& value : data) {
+    data_length += static_cast<int64_t>(value.size());
+  }
+  if (data_length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("HiveServer2 rowset column of ", data_length,
+                                 " bytes does not fit in a single ", type->ToString(),
+                                 " array");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> offsets,
+                        AllocateBuffer((length + 1) * sizeof(int32_t), pool));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                        AllocateBuffer(data_length, pool));
+  auto raw_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+  uint8_t* raw_values = values->mutable_data();
+  int32_t offset = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    raw_offsets[i] = offset;
+    const std::string& value = data[i];
+    if (!value.empty()) {
+      std::memcpy(raw_values + offset, value.data(), value.size());
+      offset += static_cast<int32_t>(value.size());
+    }
+  }
+  raw_offsets[length] = offset;
+  *out = ArrayData::Make(type, length,
+                         {std::move(validity), std::move(offsets), std::move(values)},
+                         null_count);
+  return Status::OK();
+}
+
+Status ConvertColumn(const ColumnarRowSet& row_set, int i,
+                     const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                     std::shared_ptr<ArrayData>* out) {
+  switch (type->id()) {
+    case Type::BOOL:
+      return ConvertBoolean(*row_set.GetBoolCol(i), pool, out);
+    case Type::INT8:
+      return ConvertFixedWidth(*row_set.GetByteCol(i), type, pool, out);
+    case Type::INT16:
+      return ConvertFixedWidth(*row_set.GetInt16Col(i), type, pool, out);
+    case Type::INT32:
+      return ConvertFixedWidth(*row_set.GetInt32Col(i), type, pool, out);
+    case Type::INT64:
+      return ConvertFixedWidth(*row_set.GetInt64Col(i), type, pool, out);
+    case Type::DOUBLE:
+      return ConvertFixedWidth(*row_set.GetDoubleCol(i), type, pool, out);
+    case Type::STRING:
+      return ConvertBinary(*row_set.GetStringCol(i), type, pool, out);
+    case Type::BINARY:
+      return ConvertBinary(*row_set.GetBinaryCol(i), type, pool, out);
+    default:
+      return Status::NotImplemented("Conversion of HiveServer2 column to ",
+                                    type->ToString(), " is not supported");
+  }
+}
+
+}  // namespace
+
+Status ColumnarRowSetToRecordBatch(const ColumnarRowSet& row_set,
+                                   const std::shared_ptr<Schema>& schema,
+                                   MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<ArrayData>> columns(schema->num_fields());
+  int64_t num_rows = 0;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    RETURN_NOT_OK(ConvertColumn(row_set, i, schema->field(i)->type(), pool, &columns[i]));
+    if (i == 0) {
+      num_rows = columns[i]->length;
+    } else if (columns[i]->length != num_rows) {
+      return Status::IOError("HiveServer2 rowset column ", i, " has ",
+                             columns[i]->length, " rows, expected ", num_rows);
+    }
+  }
+  *out = RecordBatch::Make(schema, num_rows, std::move(columns));
+  return Status::OK();
+}
+
+namespace {
+
+struct FetchedRowSet {
+  std::shared_ptr<ColumnarRowSet> row_set;
+  bool has_more_rows;
+};
+
+class OperationRecordBatchReader : public RecordBatchReader {
+ public:
+  OperationRecordBatchReader(Operation* operation, int max_rows, MemoryPool* pool,
+                             std::shared_ptr<Schema> schema)
+      : operation_(operation),
+        max_rows_(max_rows),
+        pool_(pool),
+        schema_(std::move(schema)),
+        has_more_rows_(true) {}
+
+  ~OperationRecordBatchReader() override {
+    // The pending fetch refers to the operation, don't let it outlive the reader.
+    if (pending_.is_valid()) {
+      pending_.Wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    // Servers may return empty rowsets while results are still being produced, so
+    // keep fetching until a non-empty rowset or the end of the results.
+    while (true) {
+      if (!pending_.is_valid()) {
+        if (!has_more_rows_) {
+          batch->reset();
+          return Status::OK();
+        }
+        RETURN_NOT_OK(StartFetch());
+      }
+      Result<FetchedRowSet> result = std::move(pending_).result();
+      pending_ = Future<FetchedRowSet>();
+      if (!result.ok()) {
+        has_more_rows_ = false;
+        return result.status();
+      }
+      FetchedRowSet fetched = std::move(result).ValueOrDie();
+      has_more_rows_ = fetched.has_more_rows;
+
+      // Overlap the round trip for the next rowset with converting this one.
+      if (has_more_rows_) {
+        RETURN_NOT_OK(StartFetch());
+      }
+      RETURN_NOT_OK(ColumnarRowSetToRecordBatch(*fetched.row_set, schema_, pool_, batch));
+      if ((*batch)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+  }
+
+ private:
+  Status StartFetch() {
+    Operation* operation = operation_;
+    const int max_rows = max_rows_;
+    ARROW_ASSIGN_OR_RAISE(
+        pending_, io::internal::GetIOThreadPool()->Submit(
+                      [operation, max_rows]() -> Result<FetchedRowSet> {
+                        std::unique_ptr<ColumnarRowSet> row_set;
+                        FetchedRowSet fetched;
+                        RETURN_NOT_OK(operation->Fetch(max_rows, FetchOrientation::NEXT,
+                                                       &row_set, &fetched.has_more_rows));
+                        fetched.row_set = std::move(row_set);
+                        return fetched;
+                      }));
+    return Status::OK();
+  }
+
+  Operation* operation_;
+  const int max_rows_;
+  MemoryPool* pool_;
+  std::shared_ptr<Schema> schema_;
+  bool has_more_rows_;
+  Future<FetchedRowSet> pending_;
+};
+
+}  // namespace
+
+Status MakeRecordBatchReader(Operation* operation, int max_rows, MemoryPool* pool,
+                             std::shared_ptr<RecordBatchReader>* out) {
+  if (!operation->IsColumnar()) {
+    return Status::Invalid("RecordBatchReader requires a columnar result set");
+  }
+  if (max_rows <= 0) {
+    return Status::Invalid("max_rows must be positive, got ", max_rows);
+  }
+  std::vector<ColumnDesc> column_descs;
+  RETURN_NOT_OK(operation->GetResultSetMetadata(&column_descs));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(ColumnDescsToSchema(column_descs, &schema));
+  *out = std::make_shared<OperationRecordBatchReader>(operation, max_rows, pool,
+                                                      std::move(schema));
+  return Status::OK();
+}
+
+}  // namespace hiveserver2
+}  // namespace arrow
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/dbi/hiveserver2/columnar_row_set.h"
+#include "arrow/dbi/hiveserver2/types.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+class Status;
+
+namespace hiveserver2 {
+
+class Operation;
+
+// Returns the Arrow type that values of the given HiveServer2 column type are
+// converted to. Numeric and boolean types map to their Arrow counterparts (FLOAT is
+// transferred as a double by HiveServer2 and so becomes float64), BINARY maps to
+// binary, and the remaining primitive types, which HiveServer2 transfers as strings,
+// map to utf8. Nested and user-defined types return NotImplemented.
+ARROW_EXPORT Status ColumnTypeToArrowType(const ColumnType& type,
+                                          std::shared_ptr<DataType>* out);
+
+// Builds an Arrow schema from the column descriptions returned by
+// Operation::GetResultSetMetadata().
+ARROW_EXPORT Status ColumnDescsToSchema(const std::vector<ColumnDesc>& column_descs,
+                                        std::shared_ptr<Schema>* out);
+
+// Converts the columns of 'row_set' into a record batch with the given schema, which
+// is normally produced by ColumnDescsToSchema(). Values are copied in bulk: fixed
+// width columns with a single memcpy, string columns into one preallocated data
+// buffer, and the HiveServer2 null bitmap is inverted a byte at a time into an Arrow
+// validity bitmap.
+ARROW_EXPORT Status ColumnarRowSetToRecordBatch(const ColumnarRowSet& row_set,
+                                                const std::shared_ptr<Schema>& schema,
+                                                MemoryPool* pool,
+                                                std::shared_ptr<RecordBatch>* out);
+
+// Creates a RecordBatchReader that yields the results of 'operation' as Arrow record
+// batches of at most 'max_rows' rows each. While a batch is being converted, the
+// next rowset is already being fetched on the IO thread pool, so the network round
+// trip overlaps with the conversion.
+//
+// The operation must have a columnar result set, must outlive the reader, and must
+// not be used by the caller (eg. to Fetch or Close) while the reader is in use.
+//
+// Example:
+// std::shared_ptr<RecordBatchReader> reader;
+// RETURN_NOT_OK(MakeRecordBatchReader(op.get(), 1024, default_memory_pool(),
+//                                     &reader));
+// std::shared_ptr<Table> table;
+// RETURN_NOT_OK(reader->ReadAll(&table));
+ARROW_EXPORT Status MakeRecordBatchReader(Operation* operation, int max_rows,
+                                          MemoryPool* pool,
+                                          std::shared_ptr<RecordBatchReader>* out);
+
+}  // namespace hiveserver2
+}  // namespace arrow
@@ -0,0 +1,586 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/caching.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace fs {
+namespace internal {
+
+// Extension of blocks being written
+static const char kTempExtension[] = "tmp";
+// Number of hexadecimal digits of the file version hash in block names
+static constexpr size_t kBlockHashLength = 32;
+
+namespace {
+
+// Whether name[begin, end) is a non-empty run of decimal (or lowercase
+// hexadecimal) digits
+bool AllDigits(const std::string& name, size_t begin, size_t end, bool hex) {
+  if (begin >= end) {
+    return false;
+  }
+  for (size_t i = begin; i < end; ++i) {
+    const char c = name[i];
+    if (!((c >= '0' && c <= '9') || (hex && c >= 'a' && c <= 'f'))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether `name` is a block name: the hash of the file version, a dash and
+// the block index (see BlockNamePrefix()).
+bool IsBlockName(const std::string& name) {
+  return name.size() > kBlockHashLength + 1 && name[kBlockHashLength] == '-' &&
+         AllDigits(name, 0, kBlockHashLength, /*hex=*/true) &&
+         AllDigits(name, kBlockHashLength + 1, name.size(), /*hex=*/false);
+}
+
+// Whether `name` is a block being written: a block name followed by
+// ".<id>.tmp" (see BlockCache::Put()).
+bool IsTempBlockName(const std::string& name) {
+  const std::string suffix = std::string(".") + kTempExtension;
+  if (name.size() <= suffix.size() ||
+      name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+    return false;
+  }
+  const size_t id_end = name.size() - suffix.size();
+  const size_t dot = name.rfind('.', id_end - 1);
+  return dot != std::string::npos && AllDigits(name, dot + 1, id_end, /*hex=*/false) &&
+         IsBlockName(name.substr(0, dot));
+}
+
+}  // namespace
+
+// A size-bounded LRU cache of blocks persisted as files in a local directory.
+// Each block is stored under a unique name in a file of the same name.
+class BlockCache {
+ public:
+  BlockCache(std::string cache_dir, int64_t capacity)
+      : local_fs_(std::make_shared<LocalFileSystem>()),
+        cache_dir_(std::move(cache_dir)),
+        capacity_(capacity) {}
+
+  // Register the blocks persisted by a previous instance, from the least to
+  // the most recently modified, and discard leftovers of interrupted writes.
+  // Files not named like blocks are left alone.
+  Status Init() {
+    RETURN_NOT_OK(local_fs_->CreateDir(cache_dir_));
+    FileSelector select;
+    select.base_dir = cache_dir_;
+    ARROW_ASSIGN_OR_RAISE(auto infos, local_fs_->GetFileInfo(select));
+    std::sort(infos.begin(), infos.end(),
+              [](const FileInfo& left, const FileInfo& right) {
+                return left.mtime() < right.mtime();
+              });
+
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& info : infos) {
+        if (!info.IsFile()) {
+          continue;
+        }
+        const std::string name = info.base_name();
+        if (IsTempBlockName(name)) {
+          evicted.push_back(name);
+        } else if (IsBlockName(name)) {
+          Insert(name, info.size());
+        }
+      }
+      Evict(&evicted);
+    }
+    DeleteBlocks(evicted);
+    return Status::OK();
+  }
+
+  // Return the block of the given name, or null if it isn't cached.
+  Result<std::shared_ptr<Buffer>> Get(const std::string& name) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(name);
+      if (it == entries_.end()) {
+        return nullptr;
+      }
+      lru_.splice(lru_.begin(), lru_, it->second);
+    }
+    // The block may have been evicted (or removed externally) in the meantime,
+    // consider any failure to read it a miss.
+    auto maybe_block = ReadBlock(name);
+    if (!maybe_block.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Erase(name);
+      return nullptr;
+    }
+    return maybe_block;
+  }
+
+  // Persist a block under the given name, evicting older blocks as necessary.
+  Status Put(const std::string& name, const Buffer& block) {
+    std::stringstream ss;
+    ss << name << "." << next_temp_id_++ << "." << kTempExtension;
+    const std::string temp_path = BlockPath(ss.str());
+    {
+      ARROW_ASSIGN_OR_RAISE(auto out, local_fs_->OpenOutputStream(temp_path));
+      RETURN_NOT_OK(out->Write(block.data(), block.size()));
+      RETURN_NOT_OK(out->Close());
+    }
+    // Make the block visible atomically, so that concurrent readers never
+    // see a partially written block.
+    RETURN_NOT_OK(local_fs_->Move(temp_path, BlockPath(name)));
+
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Erase(name);
+      Insert(name, block.size());
+      Evict(&evicted);
+    }
+    DeleteBlocks(evicted);
+    return Status::OK();
+  }
+
+ protected:
+  struct Entry {
+    std::string name;
+    int64_t size;
+  };
+
+  std::string BlockPath(const std::string& name) const {
+    return ConcatAbstractPath(cache_dir_, name);
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadBlock(const std::string& name) {
+    ARROW_ASSIGN_OR_RAISE(auto file, local_fs_->OpenInputFile(BlockPath(name)));
+    ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+    return file->ReadAt(0, size);
+  }
+
+  // The following must be called with the mutex held
+
+  void Insert(const std::string& name, int64_t size) {
+    lru_.push_front({name, size});
+    entries_[name] = lru_.begin();
+    total_size_ += size;
+  }
+
+  void Erase(const std::string& name) {
+    auto it = entries_.find(name);
+    if (it != entries_.end()) {
+      total_size_ -= it->second->size;
+      lru_.erase(it->second);
+      entries_.erase(it);
+    }
+  }
+
+  void Evict(std::vector<std::string>* evicted) {
+    while (total_size_ > capacity_ && !lru_.empty()) {
+      const Entry& entry = lru_.back();
+      evicted->push_back(entry.name);
+      total_size_ -= entry.size;
+      entries_.erase(entry.name);
+      lru_.pop_back();
+    }
+  }
+
+  void DeleteBlocks(const std::vector<std::string>& names) {
+    for (const auto& name : names) {
+      // Failing to delete a block only wastes some disk space
+      Status st = local_fs_->DeleteFile(BlockPath(name));
+      if (!st.ok()) {
+        ARROW_LOG(DEBUG) << "Failed to delete cached block: " << st.ToString();
+      }
+    }
+  }
+
+  std::shared_ptr<LocalFileSystem> local_fs_;
+  const std::string cache_dir_;
+  const int64_t capacity_;
+
+  std::mutex mutex_;
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> entries_;
+  int64_t total_size_ = 0;
+  std::atomic<int64_t> next_temp_id_{0};
+};
+
+}  // namespace internal
+
+namespace {
+
+// Unique prefix for the block names of a given version of a file
+std::string BlockNamePrefix(const FileInfo& info) {
+  std::stringstream ss;
+  ss << info.path() << '\0' << info.mtime().time_since_epoch().count() << '\0'
+     << info.size();
+  const std::string key = ss.str();
+  const auto key_length = static_cast<int64_t>(key.size());
+  std::stringstream name;
+  name << std::hex << std::setfill('0') << std::setw(16)
+       << ::arrow::internal::ComputeStringHash<0>(key.data(), key_length)
+       << std::setw(16)
+       << ::arrow::internal::ComputeStringHash<1>(key.data(), key_length) << "-";
+  DCHECK_EQ(name.str().size(), internal::kBlockHashLength + 1);
+  return name.str();
+}
+
+// A RandomAccessFile reading through the block cache, which only opens the
+// underlying file when some blocks are missing from the cache.
+class CachedInputFile : public io::RandomAccessFile {
+ public:
+  CachedInputFile(std::shared_ptr<FileSystem> base_fs, FileInfo info,
+                  int64_t block_size, std::shared_ptr<internal::BlockCache> cache)
+      : base_fs_(std::move(base_fs)),
+        info_(std::move(info)),
+        block_size_(block_size),
+        cache_(std::move(cache)),
+        name_prefix_(BlockNamePrefix(info_)) {}
+
+  Status Close() override {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    closed_ = true;
+    if (base_file_) {
+      RETURN_NOT_OK(base_file_->Close());
+      base_file_.reset();
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return info_.size();
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "seek"));
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, info_.size() - position);
+    if (nbytes == 0) {
+      return 0;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto blocks, GetBlocks(position, nbytes));
+
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t bytes_read = 0;
+    int64_t offset = position % block_size_;
+    for (const auto& block : blocks) {
+      const int64_t to_copy = std::min(nbytes - bytes_read, block->size() - offset);
+      if (to_copy <= 0) {
+        // Short block: the file was truncated underneath us
+        break;
+      }
+      std::memcpy(out_data + bytes_read, block->data() + offset, to_copy);
+      bytes_read += to_copy;
+      offset = 0;
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, info_.size() - position);
+    const int64_t offset = position % block_size_;
+    if (nbytes > 0 && offset + nbytes <= block_size_) {
+      // Within a single block: avoid a copy
+      ARROW_ASSIGN_OR_RAISE(auto blocks, GetBlocks(position, nbytes));
+      const auto& block = blocks.front();
+      // The block may be short if the file was truncated underneath us
+      const int64_t available = std::max<int64_t>(0, block->size() - offset);
+      return SliceBuffer(block, std::min(offset, block->size()),
+                         std::min(nbytes, available));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes));
+    if (nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                            ReadAt(position, nbytes, buf->mutable_data()));
+      DCHECK_LE(bytes_read, nbytes);
+      RETURN_NOT_OK(buf->Resize(bytes_read));
+    }
+    return std::move(buf);
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return std::move(buffer);
+  }
+
+ protected:
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status CheckPosition(int64_t position, const char* action) const {
+    if (position < 0) {
+      return Status::Invalid("Cannot ", action, " from negative position");
+    }
+    if (position > info_.size()) {
+      return Status::IOError("Cannot ", action, " past end of file");
+    }
+    return Status::OK();
+  }
+
+  std::string BlockName(int64_t block_index) const {
+    return name_prefix_ + std::to_string(block_index);
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBaseFile() {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    RETURN_NOT_OK(CheckClosed());
+    if (!base_file_) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(info_));
+    }
+    return base_file_;
+  }
+
+  // Return the blocks spanning the given (non-empty) range, fetching each run
+  // of consecutive missing blocks from the underlying file in a single read.
+  Result<std::vector<std::shared_ptr<Buffer>>> GetBlocks(int64_t position,
+                                                         int64_t nbytes) {
+    const int64_t first_block = position / block_size_;
+    const int64_t last_block = (position + nbytes - 1) / block_size_;
+    std::vector<std::shared_ptr<Buffer>> blocks(last_block - first_block + 1);
+    for (int64_t i = first_block; i <= last_block; ++i) {
+      ARROW_ASSIGN_OR_RAISE(blocks[i - first_block], cache_->Get(BlockName(i)));
+    }
+
+    int64_t i = first_block;
+    while (i <= last_block) {
+      if (blocks[i - first_block]) {
+        ++i;
+        continue;
+      }
+      int64_t run_end = i + 1;
+      while (run_end <= last_block && !blocks[run_end - first_block]) {
+        ++run_end;
+      }
+      const int64_t run_start = i * block_size_;
+      const int64_t run_length =
+          std::min(run_end * block_size_, info_.size()) - run_start;
+      ARROW_ASSIGN_OR_RAISE(auto base_file, GetBaseFile());
+      ARROW_ASSIGN_OR_RAISE(auto data, base_file->ReadAt(run_start, run_length));
+
+      for (; i < run_end; ++i) {
+        const int64_t block_start = (i * block_size_) - run_start;
+        const int64_t block_length =
+            std::min(block_size_, info_.size() - i * block_size_);
+        if (block_start + block_length > data->size()) {
+          // Short read, the file was truncated underneath us: return what was
+          // read but don't cache incomplete blocks
+          const int64_t start = std::min(block_start, data->size());
+          blocks[i - first_block] = SliceBuffer(data, start, data->size() - start);
+          continue;
+        }
+        auto block = SliceBuffer(data, block_start, block_length);
+        // Failing to populate the cache shouldn't fail the read
+        Status st = cache_->Put(BlockName(i), *block);
+        if (!st.ok()) {
+          ARROW_LOG(DEBUG) << "Failed to cache block: " << st.ToString();
+        }
+        blocks[i - first_block] = std::move(block);
+      }
+    }
+    return blocks;
+  }
+
+  std::shared_ptr<FileSystem> base_fs_;
+  const FileInfo info_;
+  const int64_t block_size_;
+  std::shared_ptr<internal::BlockCache> cache_;
+  const std::string name_prefix_;
+
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+  std::atomic<bool> closed_{false};
+  int64_t pos_ = 0;
+};
+
+}  // namespace
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     BlockCacheOptions options,
+                                     std::shared_ptr<internal::BlockCache> cache)
+    : base_fs_(std::move(base_fs)),
+      options_(std::move(options)),
+      cache_(std::move(cache)) {}
+
+CachingFileSystem::~CachingFileSystem() {}
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, BlockCacheOptions options) {
+  if (options.cache_dir.empty()) {
+    return Status::Invalid("CachingFileSystem needs a cache directory");
+  }
+  if (options.block_size <= 0) {
+    return Status::Invalid("CachingFileSystem block size must be positive, got ",
+                           options.block_size);
+  }
+  if (options.capacity < 0) {
+    return Status::Invalid("CachingFileSystem capacity must be non-negative, got ",
+                           options.capacity);
+  }
+  auto cache =
+      std::make_shared<internal::BlockCache>(options.cache_dir, options.capacity);
+  RETURN_NOT_OK(cache->Init());
+  return std::shared_ptr<CachingFileSystem>(
+      new CachingFileSystem(std::move(base_fs), std::move(options), std::move(cache)));
+}
+
+Result<std::string> CachingFileSystem::NormalizePath(std::string path) {
+  return base_fs_->NormalizePath(std::move(path));
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& caching = checked_cast<const CachingFileSystem&>(other);
+  return options_.cache_dir == caching.options_.cache_dir &&
+         options_.block_size == caching.options_.block_size &&
+         base_fs_->Equals(caching.base_fs_);
+}
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<std::vector<FileInfo>> CachingFileSystem::GetFileInfo(
+    const FileSelector& select) {
+  return base_fs_->GetFileInfo(select);
+}
+
+Result<FileInfoIterator> CachingFileSystem::GetFileInfoIterator(
+    const FileSelector& select) {
+  return base_fs_->GetFileInfoIterator(select);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  return OpenInputFile(path);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  if (!info.IsFile() || info.mtime() == kNoTime || info.size() == kNoSize) {
+    // Let the underlying filesystem report errors, and don't cache files
+    // whose version can't be told apart
+    return base_fs_->OpenInputFile(info);
+  }
+  return std::make_shared<CachedInputFile>(base_fs_, info, options_.block_size, cache_);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path) {
+  return base_fs_->OpenOutputStream(path);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path) {
+  return base_fs_->OpenAppendStream(path);
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+namespace internal {
+
+class BlockCache;
+
+}  // namespace internal
+
+/// Options for the local block cache of a CachingFileSystem
+struct ARROW_EXPORT BlockCacheOptions {
+  /// Local directory where cached blocks are persisted, created if necessary.
+  ///
+  /// Blocks already present in the directory are reused, so that the cache
+  /// survives across processes; other files in it are never touched.  The
+  /// directory shouldn't be shared by several CachingFileSystem instances at
+  /// once.
+  std::string cache_dir;
+  /// Size of the cached blocks (the last block of a file may be shorter).
+  int64_t block_size = 4 * 1024 * 1024;
+  /// Size budget for the cached blocks.  The least recently used blocks are
+  /// evicted when it is exceeded.
+  int64_t capacity = 10LL * 1024 * 1024 * 1024;
+};
+
+/// \brief A FileSystem implementation that delegates to another
+/// implementation, caching the data read from input files on local disk.
+///
+/// Files are read through fixed-size blocks, which are persisted in a local
+/// directory (typically on SSD) and served from there by later reads.  Blocks
+/// are keyed by path, modification time and size, so that a file modified on
+/// the underlying filesystem is fetched again.  Files with an unknown
+/// modification time are not cached.
+///
+/// Only OpenInputFile() and OpenInputStream() go through the cache; all other
+/// operations are forwarded to the underlying filesystem.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, BlockCacheOptions options);
+
+  std::string type_name() const override { return "caching"; }
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+  const BlockCacheOptions& options() const { return options_; }
+
+  Result<std::string> NormalizePath(std::string path) override;
+
+  bool Equals(const FileSystem& other) const override;
+
+  /// \cond FALSE
+  using FileSystem::GetFileInfo;
+  /// \endcond
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  Result<FileInfoIterator> GetFileInfoIterator(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+ protected:
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs, BlockCacheOptions options,
+                    std::shared_ptr<internal::BlockCache> cache);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  BlockCacheOptions options_;
+  std::shared_ptr<internal::BlockCache> cache_;
+};
+
+}  // namespace fs
+}  // namespace arrow
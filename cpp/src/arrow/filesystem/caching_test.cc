@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/filesystem/caching.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+namespace internal {
+
+using ::arrow::internal::TemporaryDir;
+
+class TestCachingFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("test-caching-fs-"));
+    options_.cache_dir = temp_dir_->path().ToString() + "cache";
+    options_.block_size = 10;
+    options_.capacity = 1000;
+    base_fs_ = std::make_shared<MockFileSystem>(TimePoint(TimePoint::duration(42)));
+    data_ = random_string(95, /*seed=*/42);
+    ASSERT_OK(base_fs_->CreateDir("AB"));
+    CreateFile(base_fs_.get(), "AB/data", data_);
+    MakeFileSystem();
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK_AND_ASSIGN(fs_, CachingFileSystem::Make(base_fs_, options_));
+  }
+
+  // Replace the file on the base filesystem with contents of the same size.
+  // The mock filesystem keeps the same modification time, so the cached
+  // blocks are still considered valid.
+  void ClobberBaseFile() {
+    clobbered_ = std::string(data_.size(), 'x');
+    CreateFile(base_fs_.get(), "AB/data", clobbered_);
+  }
+
+  void AssertReadAt(io::RandomAccessFile* file, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(position, nbytes));
+    ASSERT_EQ(buf->ToString(), expected.substr(position, nbytes));
+    std::string out(nbytes, '\0');
+    ASSERT_OK_AND_ASSIGN(auto bytes_read, file->ReadAt(position, nbytes, &out[0]));
+    out.resize(bytes_read);
+    ASSERT_EQ(out, expected.substr(position, nbytes));
+  }
+
+  std::vector<FileInfo> CachedBlocks() {
+    LocalFileSystem local_fs;
+    FileSelector select;
+    select.base_dir = options_.cache_dir;
+    std::vector<FileInfo> infos;
+    ARROW_EXPECT_OK(local_fs.GetFileInfo(select).Value(&infos));
+    return infos;
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  BlockCacheOptions options_;
+  std::shared_ptr<MockFileSystem> base_fs_;
+  std::shared_ptr<CachingFileSystem> fs_;
+  std::string data_, clobbered_;
+};
+
+TEST_F(TestCachingFileSystem, Make) {
+  auto options = options_;
+  options.cache_dir = "";
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options));
+  options = options_;
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options));
+  options = options_;
+  options.capacity = -1;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options));
+
+  ASSERT_EQ(fs_->type_name(), "caching");
+  ASSERT_TRUE(fs_->Equals(*fs_));
+  ASSERT_FALSE(fs_->Equals(*base_fs_));
+}
+
+TEST_F(TestCachingFileSystem, ReadAt) {
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/data"));
+  ASSERT_OK_AND_EQ(95, file->GetSize());
+
+  AssertReadAt(file.get(), 0, 95, data_);
+  AssertReadAt(file.get(), 3, 4, data_);
+  AssertReadAt(file.get(), 8, 25, data_);
+  AssertReadAt(file.get(), 90, 100, data_);
+  AssertReadAt(file.get(), 95, 10, data_);
+  ASSERT_RAISES(IOError, file->ReadAt(96, 1));
+
+  // Stream reads
+  ASSERT_OK(file->Seek(5));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->Read(10));
+  ASSERT_EQ(buf->ToString(), data_.substr(5, 10));
+  ASSERT_OK_AND_EQ(15, file->Tell());
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("AB/data"));
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(100));
+  ASSERT_EQ(buf->ToString(), data_);
+
+  // Errors come from the underlying filesystem
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("AB/nonexistent"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("AB"));
+}
+
+TEST_F(TestCachingFileSystem, ServeFromCache) {
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/data"));
+  AssertReadAt(file.get(), 12, 20, data_);
+  ASSERT_EQ(CachedBlocks().size(), 3);
+
+  ClobberBaseFile();
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("AB/data"));
+  // Cached blocks are served from disk, missing ones are fetched
+  AssertReadAt(file.get(), 10, 30, data_);
+  AssertReadAt(file.get(), 30, 20, data_.substr(0, 40) + clobbered_.substr(40));
+  ASSERT_EQ(CachedBlocks().size(), 4);
+
+  // A different version of the file isn't served from the cache
+  CreateFile(base_fs_.get(), "AB/data", "some other data");
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("AB/data"));
+  AssertReadAt(file.get(), 0, 100, "some other data");
+}
+
+TEST_F(TestCachingFileSystem, Eviction) {
+  options_.capacity = 30;
+  MakeFileSystem();
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/data"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 95));
+  ASSERT_EQ(buf->ToString(), data_);
+  // The last three blocks remain (the last one is shorter)
+  auto blocks = CachedBlocks();
+  ASSERT_EQ(blocks.size(), 3);
+  int64_t total_size = 0;
+  for (const auto& block : blocks) {
+    total_size += block.size();
+  }
+  ASSERT_EQ(total_size, 25);
+
+  // Only the most recently used blocks are served from the cache
+  ClobberBaseFile();
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("AB/data"));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(60, 35));
+  ASSERT_EQ(buf->ToString(), clobbered_.substr(60, 10) + data_.substr(70));
+}
+
+TEST_F(TestCachingFileSystem, Persistence) {
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/data"));
+  AssertReadAt(file.get(), 0, 95, data_);
+  fs_.reset();
+
+  // A new instance reuses the blocks persisted on disk
+  ClobberBaseFile();
+  MakeFileSystem();
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("AB/data"));
+  AssertReadAt(file.get(), 0, 95, data_);
+
+  // ... within its own size budget
+  options_.capacity = 20;
+  MakeFileSystem();
+  ASSERT_EQ(CachedBlocks().size(), 2);
+}
+
+TEST_F(TestCachingFileSystem, IgnoreForeignFiles) {
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/data"));
+  AssertReadAt(file.get(), 0, 20, data_);
+  fs_.reset();
+
+  // Files that aren't blocks survive reloading and eviction
+  LocalFileSystem local_fs;
+  const std::vector<std::string> foreign_names = {
+      "notes.txt", "data.tmp", "0123-4", "0123456789abcdef0123456789abcdef-x"};
+  for (const auto& name : foreign_names) {
+    CreateFile(&local_fs, options_.cache_dir + "/" + name, "some foreign data");
+  }
+  options_.capacity = 0;
+  MakeFileSystem();
+  auto infos = CachedBlocks();
+  std::vector<std::string> names;
+  for (const auto& info : infos) {
+    names.push_back(info.base_name());
+  }
+  std::sort(names.begin(), names.end());
+  auto expected = foreign_names;
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(names, expected);
+}
+
+TEST_F(TestCachingFileSystem, ForwardOperations) {
+  ASSERT_OK(fs_->CreateDir("CD/EF"));
+  CreateFile(fs_.get(), "CD/EF/file", "some data");
+  ASSERT_OK(fs_->CopyFile("CD/EF/file", "CD/copy"));
+  ASSERT_OK(fs_->Move("CD/copy", "CD/moved"));
+
+  ASSERT_OK_AND_ASSIGN(auto info, fs_->GetFileInfo("CD/moved"));
+  ASSERT_EQ(info.type(), FileType::File);
+  ASSERT_EQ(info.size(), 9);
+
+  FileSelector select;
+  select.base_dir = "CD";
+  select.recursive = true;
+  ASSERT_OK_AND_ASSIGN(auto infos, fs_->GetFileInfo(select));
+  ASSERT_EQ(infos.size(), 3);
+
+  ASSERT_OK(fs_->DeleteFile("CD/moved"));
+  ASSERT_OK(fs_->DeleteDir("CD"));
+  ASSERT_OK_AND_ASSIGN(info, base_fs_->GetFileInfo("CD"));
+  ASSERT_EQ(info.type(), FileType::NotFound);
+}
+
+}  // namespace internal
+}  // namespace fs
+}  // namespace arrow
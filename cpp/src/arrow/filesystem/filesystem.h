@@ -27,6 +27,7 @@
 
 #include "arrow/type_fwd.h"
 #include "arrow/util/compare.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 #include "arrow/util/windows_fixup.h"
@@ -79,6 +80,9 @@ struct ARROW_EXPORT FileInfo : public util::EqualityComparable<FileInfo> {
   FileInfo(const FileInfo&) = default;
   FileInfo& operator=(const FileInfo&) = default;
 
+  explicit FileInfo(std::string path, FileType type = FileType::Unknown)
+      : type_(type), path_(std::move(path)) {}
+
   /// The file type
   FileType type() const { return type_; }
   void set_type(FileType type) { type_ = type; }
@@ -155,6 +159,19 @@ struct ARROW_EXPORT FileSelector {
   FileSelector() {}
 };
 
+/// \brief An iterator over batches of FileInfo, as they are discovered
+using FileInfoIterator = Iterator<std::vector<FileInfo>>;
+
+}  // namespace fs
+
+// An empty batch marks the end of a FileInfoIterator
+template <>
+struct IterationTraits<std::vector<fs::FileInfo>> {
+  static std::vector<fs::FileInfo> End() { return {}; }
+};
+
+namespace fs {
+
 /// \brief Abstract file system API
 class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem> {
  public:
@@ -190,6 +207,13 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// it exists.
   /// If it doesn't exist, see `FileSelector::allow_not_found`.
   virtual Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) = 0;
+  /// Same, yielding batches of FileInfo as the selection is walked.
+  ///
+  /// Batches are never empty and come in no particular order.  This allows
+  /// consuming the results of a large listing before it has finished.
+  /// The default implementation yields the result of GetFileInfo(select)
+  /// as a single batch.
+  virtual Result<FileInfoIterator> GetFileInfoIterator(const FileSelector& select);
 
   /// Create a directory and subdirectories.
   ///
@@ -229,10 +253,21 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// Open an input stream for sequential reading.
   virtual Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) = 0;
+  /// Same, for a file whose info is already known.
+  ///
+  /// The info is trusted to describe the file, so that implementations may skip
+  /// querying its existence or size (for example a HEAD request on S3).
+  /// The default implementation opens info.path().
+  virtual Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info);
 
   /// Open an input file for random access reading.
   virtual Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) = 0;
+  /// Same, for a file whose info is already known.
+  ///
+  /// See OpenInputStream(const FileInfo&).
+  virtual Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info);
 
   /// Open an output stream for sequential writing.
   ///
@@ -290,8 +325,11 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
 
   Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
   Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
       const std::string& path) override;
   Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
@@ -342,8 +380,11 @@ class ARROW_EXPORT SlowFileSystem : public FileSystem {
 
   Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
   Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
       const std::string& path) override;
   Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
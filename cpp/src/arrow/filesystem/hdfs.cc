@@ -257,6 +257,10 @@ void HdfsOptions::ConfigureEndPoint(const std::string& host, int port) {
   connection_config.port = port;
 }
 
+void HdfsOptions::ConfigureShortCircuitReads(const std::string& domain_socket_path) {
+  connection_config.domain_socket_path = domain_socket_path;
+}
+
 void HdfsOptions::ConfigureHdfsUser(const std::string& user_name) {
   connection_config.user = user_name;
 }
@@ -280,6 +284,8 @@ bool HdfsOptions::Equals(const HdfsOptions& other) const {
           connection_config.port == other.connection_config.port &&
           connection_config.user == other.connection_config.user &&
           connection_config.kerb_ticket == other.connection_config.kerb_ticket &&
+          connection_config.domain_socket_path ==
+              other.connection_config.domain_socket_path &&
           connection_config.extra_conf == other.connection_config.extra_conf);
 }
 
@@ -347,6 +353,12 @@ Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
     options.ConfigureHdfsUser(user);
   }
 
+  // configure short-circuit reads
+  it = options_map.find("domain_socket_path");
+  if (it != options_map.end()) {
+    options.ConfigureShortCircuitReads(it->second);
+  }
+
   return options;
 }
 
@@ -46,6 +46,9 @@ struct ARROW_EXPORT HdfsOptions {
   void ConfigureHdfsUser(const std::string& user_name);
   void ConfigureHdfsBufferSize(int32_t buffer_size);
   void ConfigureHdfsBlockSize(int64_t default_block_size);
+  /// Enable short-circuit reads of the blocks stored on the local datanode,
+  /// given the datanode's dfs.domain.socket.path
+  void ConfigureShortCircuitReads(const std::string& domain_socket_path);
 
   bool Equals(const HdfsOptions& other) const;
 
@@ -83,8 +86,10 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
 
   Status CopyFile(const std::string& src, const std::string& dest) override;
 
+  using FileSystem::OpenInputStream;
   Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) override;
+  using FileSystem::OpenInputFile;
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) override;
   Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
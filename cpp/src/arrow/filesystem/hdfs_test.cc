@@ -56,6 +56,11 @@ TEST(TestHdfsOptions, FromUri) {
   ASSERT_EQ(options.connection_config.host, "viewfs://other-nn");
   ASSERT_EQ(options.connection_config.port, 0);
   ASSERT_EQ(options.connection_config.user, "");
+  ASSERT_EQ(options.connection_config.domain_socket_path, "");
+
+  ASSERT_OK(uri.Parse("hdfs://localhost/?domain_socket_path=/var/run/dn_socket"));
+  ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
+  ASSERT_EQ(options.connection_config.domain_socket_path, "/var/run/dn_socket");
 }
 
 class TestHadoopFileSystem : public ::testing::Test {
@@ -75,8 +75,10 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
 
   Status CopyFile(const std::string& src, const std::string& dest) override;
 
+  using FileSystem::OpenInputStream;
   Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) override;
+  using FileSystem::OpenInputFile;
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) override;
   Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
@@ -20,6 +20,10 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iterator>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
@@ -41,6 +45,7 @@
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/utils/logging/ConsoleLogSystem.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/AbortMultipartUploadRequest.h>
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
@@ -70,7 +75,10 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/windows_fixup.h"
 
 namespace arrow {
@@ -97,6 +105,8 @@ const char* kS3DefaultRegion = "us-east-1";
 
 static const char kSep = '/';
 
+static const char* kAwsAllocationTag = "arrow";
+
 namespace {
 
 std::mutex aws_init_lock;
@@ -350,23 +360,67 @@ std::string FormatRange(int64_t start, int64_t length) {
   return ss.str();
 }
 
-Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t start,
-                      int64_t length, S3Model::GetObjectResult* out) {
+S3Model::GetObjectRequest MakeGetObjectRangeRequest(const S3Path& path, int64_t start,
+                                                    int64_t length) {
   S3Model::GetObjectRequest req;
   req.SetBucket(ToAwsString(path.bucket));
   req.SetKey(ToAwsString(path.key));
   req.SetRange(ToAwsString(FormatRange(start, length)));
+  return req;
+}
+
+Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t start,
+                      int64_t length, S3Model::GetObjectResult* out) {
+  auto req = MakeGetObjectRangeRequest(path, start, length);
   ARROW_AWS_ASSIGN_OR_RAISE(*out, client->GetObject(req));
   return Status::OK();
 }
 
+// A non-copying istream.
+// See https://stackoverflow.com/questions/35322033/aws-c-sdk-uploadpart-times-out
+// https://stackoverflow.com/questions/13059091/creating-an-input-stream-from-constant-memory
+
+class StringViewStream : Aws::Utils::Stream::PreallocatedStreamBuf, public std::iostream {
+ public:
+  StringViewStream(const void* data, int64_t nbytes)
+      : Aws::Utils::Stream::PreallocatedStreamBuf(
+            reinterpret_cast<unsigned char*>(const_cast<void*>(data)),
+            static_cast<size_t>(nbytes)),
+        std::iostream(this) {}
+};
+
+// A response stream factory writing the object body directly into
+// preallocated memory
+struct PreallocatedStreamFactory {
+  PreallocatedStreamFactory(void* data, int64_t nbytes) : data_(data), nbytes_(nbytes) {}
+
+  Aws::IOStream* operator()() const {
+    return Aws::New<StringViewStream>(kAwsAllocationTag, data_, nbytes_);
+  }
+
+  void* data_;
+  int64_t nbytes_;
+};
+
 // A RandomAccessFile that reads from a S3 object
+// Readahead for sequential Read() calls starts at the size of the first
+// sequential read and doubles with every further one, up to this maximum.
+static constexpr int64_t kMaximumReadahead = 64 * 1024 * 1024;
+// Number of readahead ranges kept in flight past the current read.
+static constexpr int kReadaheadRanges = 2;
+
 class ObjectInputFile : public io::RandomAccessFile {
  public:
-  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path)
-      : client_(client), path_(path) {}
+  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path, int64_t size = kNoSize)
+      : client_(client), path_(path), content_length_(size) {}
 
   Status Init() {
+    if (content_length_ != kNoSize) {
+      // The size is already known, e.g. from a listing
+      DCHECK_GE(content_length_, 0);
+      return Status::OK();
+    }
+
     // Issue a HEAD Object to get the content-length and ensure any
     // errors (e.g. file not found) don't wait until the first Read() call.
     S3Model::HeadObjectRequest req;
@@ -409,6 +463,7 @@ class ObjectInputFile : public io::RandomAccessFile {
   // RandomAccessFile APIs
 
   Status Close() override {
+    ResetReadahead();
     closed_ = true;
     return Status::OK();
   }
@@ -470,37 +525,244 @@ class ObjectInputFile : public io::RandomAccessFile {
     return std::move(buf);
   }
 
+  // Issue all ranged GetObject requests at once so that they run concurrently,
+  // then wait for them.
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadMany(
+      const std::vector<io::ReadRange>& ranges) override {
+    auto futures = ReadManyAsync(ranges);
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    buffers.reserve(futures.size());
+    Status st;
+    for (auto& fut : futures) {
+      // Wait for all requests even on error, so that none outlives the call
+      const auto& result = fut.result();
+      if (result.ok()) {
+        buffers.push_back(*result);
+      } else {
+        st &= result.status();
+      }
+    }
+    RETURN_NOT_OK(st);
+    return buffers;
+  }
+
+  // Issue the GetObject request through the AWS SDK's executor, without
+  // blocking a thread of the IO thread pool for the duration of the request.
+  Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes) override {
+    auto maybe_fut = DoReadAsync(position, nbytes);
+    if (!maybe_fut.ok()) {
+      return Future<std::shared_ptr<Buffer>>::MakeFinished(maybe_fut.status());
+    }
+    return *std::move(maybe_fut);
+  }
+
+  Result<Future<std::shared_ptr<Buffer>>> DoReadAsync(int64_t position, int64_t nbytes) {
+    using BufferFuture = Future<std::shared_ptr<Buffer>>;
+
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    // No need to allocate more than the remaining number of bytes
+    nbytes = std::min(nbytes, content_length_ - position);
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> buf,
+                          AllocateResizableBuffer(nbytes));
+    if (nbytes == 0) {
+      return BufferFuture::MakeFinished(std::shared_ptr<Buffer>(std::move(buf)));
+    }
+
+    auto req = MakeGetObjectRangeRequest(path_, position, nbytes);
+    req.SetResponseStreamFactory(PreallocatedStreamFactory(buf->mutable_data(), nbytes));
+
+    auto fut = BufferFuture::Make();
+    auto handler =
+        [fut, buf](const Aws::S3::S3Client*, const S3Model::GetObjectRequest& req,
+                   const S3Model::GetObjectOutcome& outcome,
+                   const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) mutable
+        -> void {
+      if (!outcome.IsSuccess()) {
+        fut.MarkFinished(ErrorToStatus(
+            std::forward_as_tuple("When reading from key '", req.GetKey(),
+                                  "' in bucket '", req.GetBucket(), "': "),
+            outcome.GetError()));
+        return;
+      }
+      const int64_t bytes_read = outcome.GetResult().GetContentLength();
+      DCHECK_LE(bytes_read, buf->size());
+      Status st = buf->Resize(bytes_read);
+      if (!st.ok()) {
+        fut.MarkFinished(std::move(st));
+        return;
+      }
+      fut.MarkFinished(std::shared_ptr<Buffer>(std::move(buf)));
+    };
+    client_->GetObjectAsync(req, handler);
+    return fut;
+  }
+
+  // Stream reads detect sequential access and then serve data from ranges
+  // prefetched asynchronously, growing the readahead as the access pattern
+  // persists.  Any other access pattern, including the first read, falls back
+  // to a plain ReadAt().
   Result<int64_t> Read(int64_t nbytes, void* out) override {
-    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
-    pos_ += bytes_read;
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(pos_, "read"));
+
+    nbytes = std::min(nbytes, content_length_ - pos_);
+    if (nbytes == 0) {
+      return 0;
+    }
+    if (pos_ != last_read_end_) {
+      ResetReadahead();
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+      pos_ += bytes_read;
+      last_read_end_ = pos_;
+      return bytes_read;
+    }
+
+    readahead_size_ =
+        std::min(std::max(readahead_size_ * 2, nbytes), kMaximumReadahead);
+    RETURN_NOT_OK(IssueReadahead(pos_ + nbytes));
+
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes && !readahead_.empty()) {
+      const ReadaheadRange& range = readahead_.front();
+      auto maybe_buf = range.future.result();
+      if (!maybe_buf.ok()) {
+        // Surface the error once: the stream stays at the position of this
+        // read, and retrying it issues a plain ReadAt()
+        pos_ -= bytes_read;
+        ResetReadahead();
+        return maybe_buf.status();
+      }
+      const std::shared_ptr<Buffer>& buf = *maybe_buf;
+      const int64_t offset = pos_ - range.position;
+      const int64_t to_copy = std::min(nbytes - bytes_read, buf->size() - offset);
+      if (to_copy > 0) {
+        std::memcpy(out_data + bytes_read, buf->data() + offset, to_copy);
+        bytes_read += to_copy;
+        pos_ += to_copy;
+      }
+      if (offset + to_copy >= buf->size()) {
+        if (buf->size() < range.nbytes) {
+          // Short read: the following ranges don't start where this one ends
+          readahead_.clear();
+          break;
+        }
+        readahead_.pop_front();
+      }
+    }
+    last_read_end_ = pos_;
     return bytes_read;
   }
 
   Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
-    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
-    pos_ += buffer->size();
-    return std::move(buffer);
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(pos_, "read"));
+
+    // No need to allocate more than the remaining number of bytes
+    nbytes = std::min(nbytes, content_length_ - pos_);
+
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes));
+    if (nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buf->mutable_data()));
+      DCHECK_LE(bytes_read, nbytes);
+      RETURN_NOT_OK(buf->Resize(bytes_read));
+    }
+    return std::move(buf);
   }
 
  protected:
+  struct ReadaheadRange {
+    int64_t position;
+    int64_t nbytes;
+    Future<std::shared_ptr<Buffer>> future;
+  };
+
+  void ResetReadahead() {
+    readahead_.clear();
+    readahead_size_ = 0;
+    last_read_end_ = -1;
+  }
+
+  // Issue readahead ranges covering the stream up to `end`, followed by
+  // kReadaheadRanges ranges of readahead_size_ bytes.
+  Status IssueReadahead(int64_t end) {
+    int64_t next_position =
+        readahead_.empty() ? pos_
+                           : readahead_.back().position + readahead_.back().nbytes;
+    int ranges_past_end = 0;
+    for (const auto& range : readahead_) {
+      ranges_past_end += range.position >= end;
+    }
+    while (next_position < content_length_ &&
+           (next_position < end || ranges_past_end < kReadaheadRanges)) {
+      const int64_t nbytes = std::min(std::max(readahead_size_, end - next_position),
+                                      content_length_ - next_position);
+      ARROW_ASSIGN_OR_RAISE(auto fut, DoReadAsync(next_position, nbytes));
+      readahead_.push_back({next_position, nbytes, std::move(fut)});
+      ranges_past_end += next_position >= end;
+      next_position += nbytes;
+    }
+    return Status::OK();
+  }
+
   Aws::S3::S3Client* client_;
   S3Path path_;
   bool closed_ = false;
   int64_t pos_ = 0;
-  int64_t content_length_ = -1;
-};
+  int64_t content_length_ = kNoSize;
 
-// A non-copying istream.
-// See https://stackoverflow.com/questions/35322033/aws-c-sdk-uploadpart-times-out
-// https://stackoverflow.com/questions/13059091/creating-an-input-stream-from-constant-memory
+  // Sequential stream readahead
+  std::deque<ReadaheadRange> readahead_;
+  int64_t readahead_size_ = 0;
+  // End of the last stream read, or -1 if the next read can't be sequential
+  int64_t last_read_end_ = -1;
+};
 
-class StringViewStream : Aws::Utils::Stream::PreallocatedStreamBuf, public std::iostream {
+// A queue of FileInfo batches, fed by a background walk and drained by
+// a FileInfoIterator.
+class FileInfoBatchQueue {
  public:
-  StringViewStream(const void* data, int64_t nbytes)
-      : Aws::Utils::Stream::PreallocatedStreamBuf(
-            reinterpret_cast<unsigned char*>(const_cast<void*>(data)),
-            static_cast<size_t>(nbytes)),
-        std::iostream(this) {}
+  explicit FileInfoBatchQueue(std::shared_ptr<FileSystem> filesystem)
+      : filesystem_(std::move(filesystem)) {}
+
+  void Push(std::vector<FileInfo> infos) {
+    if (infos.empty()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    batches_.push_back(std::move(infos));
+    cv_.notify_one();
+  }
+
+  void Finish(const Status& st) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    status_ = st;
+    finished_ = true;
+    cv_.notify_one();
+  }
+
+  Result<std::vector<FileInfo>> Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return finished_ || !batches_.empty(); });
+    RETURN_NOT_OK(status_);
+    if (batches_.empty()) {
+      return IterationTraits<std::vector<FileInfo>>::End();
+    }
+    auto infos = std::move(batches_.front());
+    batches_.pop_front();
+    return std::move(infos);
+  }
+
+ protected:
+  std::shared_ptr<FileSystem> filesystem_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::vector<FileInfo>> batches_;
+  bool finished_ = false;
+  Status status_;
 };
 
 // Minimum size for each part of a multipart upload, except for the last part.
@@ -702,6 +964,8 @@ class ObjectOutputStream : public io::OutputStream {
       }
     } else {
       std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      // Wait for room among the background uploads before copying the data
+      upload_state_->cv.wait(lock, [this, nbytes]() { return CanStartUpload(nbytes); });
       auto state = upload_state_;  // Keep upload state alive in closure
       auto part_number = part_number_;
 
@@ -717,7 +981,7 @@ class ObjectOutputStream : public io::OutputStream {
           std::make_shared<StringViewStream>(owned_buffer->data(), owned_buffer->size()));
 
       auto handler =
-          [state, owned_buffer, part_number](
+          [state, owned_buffer, part_number, nbytes](
               const Aws::S3::S3Client*, const S3Model::UploadPartRequest& req,
               const S3Model::UploadPartOutcome& outcome,
               const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) -> void {
@@ -727,12 +991,14 @@ class ObjectOutputStream : public io::OutputStream {
         } else {
           AddCompletedPart(state, part_number, outcome.GetResult());
         }
-        // Notify completion, regardless of success / error status
-        if (--state->parts_in_progress == 0) {
-          state->cv.notify_all();
-        }
+        // Notify completion, regardless of success / error status, to wake
+        // up both Flush() and writes waiting for room
+        --state->parts_in_progress;
+        state->bytes_in_progress -= nbytes;
+        state->cv.notify_all();
       };
       ++upload_state_->parts_in_progress;
+      upload_state_->bytes_in_progress += nbytes;
       client_->UploadPartAsync(req, handler);
     }
 
@@ -745,16 +1011,32 @@ class ObjectOutputStream : public io::OutputStream {
     // - part 200 to 299: 15MB threshold
     // ...
     // - part 9900 to 9999: 500MB threshold
+    // (with the default 5MB S3Options::part_size; larger part sizes scale these)
     // So the total size limit is 2475000MB or ~2.4TB, while keeping manageable
     // chunk sizes and avoiding too much buffering in the common case of a small-ish
     // stream.  If the limit's not enough, we can revisit.
     if (part_number_ % 100 == 0) {
-      part_upload_threshold_ += kMinimumPartUpload;
+      part_upload_threshold_ += options_.part_size;
     }
 
     return Status::OK();
   }
 
+  // Whether a part of nbytes may start uploading in the background within
+  // the S3Options bounds.  Must be called with the upload state mutex held.
+  bool CanStartUpload(int64_t nbytes) const {
+    const auto& state = *upload_state_;
+    if (state.parts_in_progress == 0) {
+      return true;
+    }
+    if (options_.max_parts_in_flight > 0 &&
+        state.parts_in_progress >= options_.max_parts_in_flight) {
+      return false;
+    }
+    return options_.max_upload_buffer_size <= 0 ||
+           state.bytes_in_progress + nbytes <= options_.max_upload_buffer_size;
+  }
+
   static void AddCompletedPart(const std::shared_ptr<UploadState>& state, int part_number,
                                const S3Model::UploadPartResult& result) {
     S3Model::CompletedPart part;
@@ -788,7 +1070,7 @@ class ObjectOutputStream : public io::OutputStream {
   int32_t part_number_ = 1;
   std::shared_ptr<io::BufferOutputStream> current_part_;
   int64_t current_part_size_ = 0;
-  int64_t part_upload_threshold_ = kMinimumPartUpload;
+  int64_t part_upload_threshold_ = options_.part_size;
 
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
@@ -797,6 +1079,7 @@ class ObjectOutputStream : public io::OutputStream {
     std::condition_variable cv;
     Aws::Vector<S3Model::CompletedPart> completed_parts;
     int64_t parts_in_progress = 0;
+    int64_t bytes_in_progress = 0;
     Status status;
 
     UploadState() : status(Status::OK()) {}
@@ -835,6 +1118,10 @@ class S3FileSystem::Impl {
   explicit Impl(S3Options options) : options_(std::move(options)) {}
 
   Status Init() {
+    if (options_.part_size < kMinimumPartUpload) {
+      return Status::Invalid("S3 part size must be at least ", kMinimumPartUpload,
+                             " bytes, got ", options_.part_size);
+    }
     credentials_ = options_.credentials_provider->GetAWSCredentials();
     client_config_.region = ToAwsString(options_.region);
     client_config_.endpointOverride = ToAwsString(options_.endpoint_override);
@@ -846,6 +1133,11 @@ class S3FileSystem::Impl {
       return Status::Invalid("Invalid S3 connection scheme '", options_.scheme, "'");
     }
     client_config_.retryStrategy = std::make_shared<ConnectRetryStrategy>();
+    // Run asynchronous requests (ReadAsync() and background part uploads)
+    // on a bounded pool rather than the SDK's default of a thread per request
+    client_config_.executor =
+        std::make_shared<Aws::Utils::Threading::PooledThreadExecutor>(
+            io::GetIOThreadPoolCapacity());
     bool use_virtual_addressing = options_.endpoint_override.empty();
     client_.reset(
         new Aws::S3::S3Client(credentials_, client_config_,
@@ -989,24 +1281,131 @@ class S3FileSystem::Impl {
     return Status::OK();
   }
 
-  // Recursive workhorse for GetTargetStats(FileSelector...)
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, std::vector<FileInfo>* out) {
-    int32_t nesting_depth = 0;
-    return Walk(select, bucket, key, nesting_depth, out);
+  using FileInfoSink = std::function<void(std::vector<FileInfo>)>;
+
+  // State shared by the listing tasks of a walk
+  struct WalkState {
+    WalkState(const FileSelector& select, FileInfoSink sink, bool concurrent)
+        : select(select),
+          sink(std::move(sink)),
+          concurrent(concurrent),
+          finished(Future<void>::Make()) {}
+
+    bool ok() {
+      std::lock_guard<std::mutex> lock(mutex);
+      return status.ok();
+    }
+
+    const FileSelector select;
+    const FileInfoSink sink;
+    // Whether the tasks run on the IO thread pool, rather than inline
+    const bool concurrent;
+    Future<void> finished;
+
+    std::mutex mutex;
+    int64_t tasks_in_progress = 0;
+    Status status;
+  };
+
+  // Workhorse for GetFileInfo(FileSelector...)
+  //
+  // If `concurrent`, each "directory" is listed by a separate task on the IO
+  // thread pool, so that the tree is walked concurrently.  Batches of FileInfo are
+  // handed to the sink as listing pages arrive, possibly from several threads at
+  // once.  The returned future finishes once all tasks are done.
+  //
+  // Otherwise the tree is walked depth-first on the calling thread, and the
+  // returned future is finished on return.
+  Future<void> Walk(const FileSelector& select, FileInfoSink sink, bool concurrent) {
+    auto state = std::make_shared<WalkState>(select, std::move(sink), concurrent);
+    // Hold a task while starting the walk, so that it can't finish early
+    state->tasks_in_progress = 1;
+    Status st = StartWalk(state);
+    FinishWalkTask(state, std::move(st));
+    return state->finished;
+  }
+
+  Status StartWalk(const std::shared_ptr<WalkState>& state) {
+    S3Path base_path;
+    RETURN_NOT_OK(S3Path::FromString(state->select.base_dir, &base_path));
+
+    if (!base_path.empty()) {
+      // Nominal case -> walk a single bucket
+      SpawnWalkTask(state, base_path.bucket, base_path.key, 0);
+      return Status::OK();
+    }
+
+    // List all buckets
+    std::vector<std::string> buckets;
+    RETURN_NOT_OK(ListBuckets(&buckets));
+    std::vector<FileInfo> infos;
+    for (const auto& bucket : buckets) {
+      FileInfo info;
+      info.set_path(bucket);
+      info.set_type(FileType::Directory);
+      infos.push_back(std::move(info));
+    }
+    state->sink(std::move(infos));
+    if (state->select.recursive) {
+      for (const auto& bucket : buckets) {
+        SpawnWalkTask(state, bucket, "", 0);
+      }
+    }
+    return Status::OK();
+  }
+
+  void SpawnWalkTask(const std::shared_ptr<WalkState>& state, const std::string& bucket,
+                     const std::string& key, int32_t nesting_depth) {
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (!state->status.ok()) {
+        return;
+      }
+      ++state->tasks_in_progress;
+    }
+    auto task = [this, state, bucket, key, nesting_depth]() {
+      Status st = Status::OK();
+      if (state->ok()) {
+        st = WalkDirectory(state, bucket, key, nesting_depth);
+      }
+      FinishWalkTask(state, std::move(st));
+    };
+    if (!state->concurrent) {
+      task();
+      return;
+    }
+    Status st = io::internal::GetIOThreadPool()->Spawn(std::move(task));
+    if (!st.ok()) {
+      FinishWalkTask(state, std::move(st));
+    }
   }
 
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, int32_t nesting_depth, std::vector<FileInfo>* out) {
+  static void FinishWalkTask(const std::shared_ptr<WalkState>& state, Status st) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->status &= st;
+    if (--state->tasks_in_progress == 0) {
+      Status final_status = state->status;
+      lock.unlock();
+      state->finished.MarkFinished(std::move(final_status));
+    }
+  }
+
+  Status WalkDirectory(const std::shared_ptr<WalkState>& state, const std::string& bucket,
+                       const std::string& key, int32_t nesting_depth) {
+    const FileSelector& select = state->select;
     if (nesting_depth >= kMaxNestingDepth) {
       return Status::IOError("S3 filesystem tree exceeds maximum nesting depth (",
                              kMaxNestingDepth, ")");
     }
 
     bool is_empty = true;
-    std::vector<std::string> child_keys;
+    const bool recurse = select.recursive && nesting_depth < select.max_recursion;
+    // Subdirectories to walk once this listing is done, when walking serially
+    std::vector<std::string> deferred_child_keys;
 
     auto handle_results = [&](const S3Model::ListObjectsV2Result& result) -> Status {
+      std::vector<FileInfo> infos;
+      std::vector<std::string> child_keys;
       // Walk "files"
       for (const auto& obj : result.GetContents()) {
         is_empty = false;
@@ -1020,7 +1419,7 @@ class S3FileSystem::Impl {
         child_path << bucket << kSep << child_key;
         info.set_path(child_path.str());
         FileObjectToInfo(obj, &info);
-        out->push_back(std::move(info));
+        infos.push_back(std::move(info));
       }
       // Walk "directories"
       for (const auto& prefix : result.GetCommonPrefixes()) {
@@ -1032,11 +1431,23 @@ class S3FileSystem::Impl {
         FileInfo info;
         info.set_path(ss.str());
         info.set_type(FileType::Directory);
-        out->push_back(std::move(info));
-        if (select.recursive) {
+        infos.push_back(std::move(info));
+        if (recurse) {
           child_keys.emplace_back(child_key);
         }
       }
+      if (!infos.empty()) {
+        state->sink(std::move(infos));
+      }
+      // When walking concurrently, recurse without waiting for the remaining
+      // pages of this listing
+      for (auto& child_key : child_keys) {
+        if (state->concurrent) {
+          SpawnWalkTask(state, bucket, child_key, nesting_depth + 1);
+        } else {
+          deferred_child_keys.push_back(std::move(child_key));
+        }
+      }
       return Status::OK();
     };
 
@@ -1052,11 +1463,8 @@ class S3FileSystem::Impl {
     RETURN_NOT_OK(
         ListObjectsV2(bucket, key, std::move(handle_results), std::move(handle_error)));
 
-    // Recurse
-    if (select.recursive && nesting_depth < select.max_recursion) {
-      for (const auto& child_key : child_keys) {
-        RETURN_NOT_OK(Walk(select, bucket, child_key, nesting_depth + 1, out));
-      }
+    for (const auto& child_key : deferred_child_keys) {
+      RETURN_NOT_OK(WalkDirectory(state, bucket, child_key, nesting_depth + 1));
     }
 
     // If no contents were found, perhaps it's an empty "directory",
@@ -1290,32 +1698,29 @@ Result<FileInfo> S3FileSystem::GetFileInfo(const std::string& s) {
 }
 
 Result<std::vector<FileInfo>> S3FileSystem::GetFileInfo(const FileSelector& select) {
-  S3Path base_path;
-  RETURN_NOT_OK(S3Path::FromString(select.base_dir, &base_path));
-
   std::vector<FileInfo> results;
-
-  if (base_path.empty()) {
-    // List all buckets
-    std::vector<std::string> buckets;
-    RETURN_NOT_OK(impl_->ListBuckets(&buckets));
-    for (const auto& bucket : buckets) {
-      FileInfo info;
-      info.set_path(bucket);
-      info.set_type(FileType::Directory);
-      results.push_back(std::move(info));
-      if (select.recursive) {
-        RETURN_NOT_OK(impl_->Walk(select, bucket, "", &results));
-      }
-    }
-    return results;
-  }
-
-  // Nominal case -> walk a single bucket
-  RETURN_NOT_OK(impl_->Walk(select, base_path.bucket, base_path.key, &results));
+  auto sink = [&](std::vector<FileInfo> infos) {
+    std::move(infos.begin(), infos.end(), std::back_inserter(results));
+  };
+  // Walk on the calling thread: waiting for IO thread pool tasks could deadlock
+  // when called from that pool
+  RETURN_NOT_OK(impl_->Walk(select, std::move(sink), /*concurrent=*/false).status());
   return results;
 }
 
+Result<FileInfoIterator> S3FileSystem::GetFileInfoIterator(const FileSelector& select) {
+  // The queue keeps the filesystem alive until the walk and the iterator are done
+  auto queue = std::make_shared<FileInfoBatchQueue>(shared_from_this());
+  auto sink = [queue](std::vector<FileInfo> infos) { queue->Push(std::move(infos)); };
+  // The iterator waits for the walk's tasks, so don't spawn any when already
+  // running on the IO thread pool
+  const bool concurrent = !io::internal::GetIOThreadPool()->OwnsThisThread();
+  impl_->Walk(select, std::move(sink), concurrent).AddCallback([queue](const Status& st) {
+    queue->Finish(st);
+  });
+  return MakeFunctionIterator([queue]() { return queue->Next(); });
+}
+
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
   S3Path path;
   RETURN_NOT_OK(S3Path::FromString(s, &path));
@@ -1475,6 +1880,30 @@ Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
   return ptr;
 }
 
+Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
+    const FileInfo& info) {
+  S3Path path;
+  RETURN_NOT_OK(S3Path::FromString(info.path(), &path));
+  RETURN_NOT_OK(ValidateFilePath(path));
+  if (info.type() == FileType::NotFound) {
+    return PathNotFound(path);
+  }
+  if (info.type() != FileType::File && info.type() != FileType::Unknown) {
+    return NotAFile(path);
+  }
+
+  // Only a regular file's size can be trusted to skip the HEAD request
+  const int64_t size = info.IsFile() ? info.size() : kNoSize;
+  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path, size);
+  RETURN_NOT_OK(ptr->Init());
+  return ptr;
+}
+
 Result<std::shared_ptr<io::OutputStream>> S3FileSystem::OpenOutputStream(
     const std::string& s) {
   S3Path path;
@@ -55,6 +55,23 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Size of the parts of an OutputStream's multipart upload (default and
+  /// minimum 5MB).  The size grows by this amount every 100 parts, since S3
+  /// allows at most 10000 parts per object.
+  int64_t part_size = 5 * 1024 * 1024;
+
+  /// Maximum number of parts of an OutputStream uploading in the background
+  /// at once; writes block until a part finishes (0 for no limit).
+  /// Uploads run on a thread pool sized like the IO thread pool when the
+  /// filesystem is created (see arrow::io::SetIOThreadPoolCapacity), so at
+  /// most that many parts are transferred concurrently.
+  int32_t max_parts_in_flight = 0;
+
+  /// Maximum number of bytes of an OutputStream held by background part
+  /// uploads; writes block until parts finish (0 for no limit).  A single
+  /// part is always allowed to upload, even if larger than this.
+  int64_t max_upload_buffer_size = 0;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -100,6 +117,7 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// \endcond
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  Result<FileInfoIterator> GetFileInfoIterator(const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -119,12 +137,19 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// a custom readahead strategy to avoid idle waits.
   Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) override;
+  /// Same, taking the object's size from info if known, instead of issuing
+  /// a HEAD request.
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
 
   /// Create a random access file for reading from a S3 object.
   ///
   /// See OpenInputStream for performance notes.
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) override;
+  /// Same, taking the object's size from info if known, instead of issuing
+  /// a HEAD request.
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
 
   /// Create a sequential output stream for writing to a S3 object.
   ///
@@ -300,6 +300,32 @@ static void ParquetRead(benchmark::State& st, S3FileSystem* fs, const std::strin
   std::cerr << "Read the file " << total_items << " times" << std::endl;
 }
 
+constexpr int64_t kWriteChunkSize = 1024 * 1024;
+
+/// Write a large object in small chunks, exercising multipart uploads.
+static void ChunkedWrite(benchmark::State& st, S3FileSystem* fs, const std::string& path,
+                         int64_t size) {
+  const std::string chunk(kWriteChunkSize, 'a');
+  int64_t total_bytes = 0;
+  int total_items = 0;
+  for (auto _ : st) {
+    std::shared_ptr<io::OutputStream> stream;
+    ASSERT_OK_AND_ASSIGN(stream, fs->OpenOutputStream(path));
+    int64_t written = 0;
+    while (written < size) {
+      const int64_t nbytes = std::min(size - written, kWriteChunkSize);
+      ASSERT_OK(stream->Write(chunk.data(), nbytes));
+      written += nbytes;
+    }
+    ASSERT_OK(stream->Close());
+    total_bytes += written;
+    total_items += 1;
+  }
+  st.SetBytesProcessed(total_bytes);
+  st.SetItemsProcessed(total_items);
+  std::cerr << "Wrote the file " << total_items << " times" << std::endl;
+}
+
 BENCHMARK_DEFINE_F(MinioFixture, ReadAll1Mib)(benchmark::State& st) {
   NaiveRead(st, fs_.get(), bucket_ + "/bytes_1mib");
 }
@@ -331,6 +357,29 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadCoalesced500Mib)(benchmark::State& st) {
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadCoalesced500Mib)->UseRealTime();
 
+BENCHMARK_DEFINE_F(MinioFixture, WriteChunked100Mib)(benchmark::State& st) {
+  ChunkedWrite(st, fs_.get(), bucket_ + "/written_100mib", 100 * 1024 * 1024);
+}
+BENCHMARK_REGISTER_F(MinioFixture, WriteChunked100Mib)->UseRealTime();
+BENCHMARK_DEFINE_F(MinioFixture, WriteChunked500Mib)(benchmark::State& st) {
+  ChunkedWrite(st, fs_.get(), bucket_ + "/written_500mib", 500 * 1024 * 1024);
+}
+BENCHMARK_REGISTER_F(MinioFixture, WriteChunked500Mib)->UseRealTime();
+
+/// Write with larger parts and a bounded number of parts in flight.
+BENCHMARK_DEFINE_F(MinioFixture, WriteChunked500MibBounded)(benchmark::State& st) {
+  options_.part_size = 16 * 1024 * 1024;
+  options_.max_parts_in_flight = static_cast<int32_t>(st.range(0));
+  options_.max_upload_buffer_size = options_.part_size * st.range(0);
+  MakeFileSystem();
+  ChunkedWrite(st, fs_.get(), bucket_ + "/written_500mib", 500 * 1024 * 1024);
+}
+BENCHMARK_REGISTER_F(MinioFixture, WriteChunked500MibBounded)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+
 BENCHMARK_DEFINE_F(MinioFixture, ReadParquet250K)(benchmark::State& st) {
   ParquetRead(st, fs_.get(), bucket_ + "/pq_c100_r250k");
 }
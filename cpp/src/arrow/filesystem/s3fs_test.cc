@@ -635,6 +635,41 @@ TEST_F(TestS3FS, OpenInputStream) {
   ASSERT_RAISES(IOError, fs_->OpenInputStream("bucket"));
 }
 
+TEST_F(TestS3FS, OpenInputStreamSequentialReadahead) {
+  std::shared_ptr<io::OutputStream> out;
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+
+  // Large enough to span several readahead ranges
+  const std::string data = random_string(7000000, /*seed =*/42);
+  ASSERT_OK_AND_ASSIGN(out, fs_->OpenOutputStream("bucket/largefile"));
+  ASSERT_OK(out->Write(data));
+  ASSERT_OK(out->Close());
+
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/largefile"));
+  int64_t position = 0;
+  for (int64_t chunk_size : {10, 1000, 100000, 300000}) {
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_OK_AND_ASSIGN(buf, file->Read(chunk_size));
+      AssertBufferEqual(*buf, data.substr(position, chunk_size));
+      position += chunk_size;
+    }
+  }
+  // Random reads don't disturb the stream position
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(12345, 100));
+  AssertBufferEqual(*buf, data.substr(12345, 100));
+  // Non-sequential access restarts the readahead
+  position = 3000000;
+  ASSERT_OK(file->Seek(position));
+  while (position < static_cast<int64_t>(data.size())) {
+    ASSERT_OK_AND_ASSIGN(buf, file->Read(1500000));
+    AssertBufferEqual(*buf, data.substr(position, 1500000));
+    position += buf->size();
+  }
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(100));
+  AssertBufferEqual(*buf, "");
+}
+
 TEST_F(TestS3FS, OpenInputFile) {
   std::shared_ptr<io::RandomAccessFile> file;
   std::shared_ptr<Buffer> buf;
@@ -677,6 +712,43 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileReadAsync) {
+  std::shared_ptr<io::OutputStream> out;
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+
+  ASSERT_OK_AND_ASSIGN(out, fs_->OpenOutputStream("bucket/asyncfile"));
+  ASSERT_OK(out->Write("some async data"));
+  ASSERT_OK(out->Close());
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/asyncfile"));
+
+  // Several requests in flight
+  auto fut1 = file->ReadAsync(0, 4);
+  auto fut2 = file->ReadAsync(5, 5);
+  auto fut3 = file->ReadAsync(11, 100);
+  ASSERT_OK_AND_ASSIGN(buf, fut1.result());
+  AssertBufferEqual(*buf, "some");
+  ASSERT_OK_AND_ASSIGN(buf, fut2.result());
+  AssertBufferEqual(*buf, "async");
+  // Reads are truncated at the end of file
+  ASSERT_OK_AND_ASSIGN(buf, fut3.result());
+  AssertBufferEqual(*buf, "data");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAsync(15, 10).result());
+  AssertBufferEqual(*buf, "");
+  // The stream position is unaffected
+  ASSERT_OK_AND_EQ(0, file->Tell());
+
+  // Reading past end of file
+  ASSERT_RAISES(IOError, file->ReadAsync(16, 10).result());
+
+  // Errors of the GetObject request are propagated
+  ASSERT_OK(fs_->DeleteFile("bucket/asyncfile"));
+  ASSERT_RAISES(IOError, file->ReadAsync(0, 4).result());
+
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAsync(0, 4).result());
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
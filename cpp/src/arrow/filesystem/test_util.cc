@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <string>
 #include <utility>
 #include <vector>
@@ -727,6 +728,55 @@ void GenericFileSystemTest::TestGetFileInfoSelectorWithRecursion(FileSystem* fs)
                          File("AA/AA.file")));
 }
 
+void GenericFileSystemTest::TestGetFileInfoIterator(FileSystem* fs) {
+  ASSERT_OK(fs->CreateDir("01/02/03"));
+  ASSERT_OK(fs->CreateDir("AA"));
+  CreateFile(fs, "00.file", "00");
+  CreateFile(fs, "01/01.file", "01");
+  CreateFile(fs, "AA/AA.file", "aa");
+  CreateFile(fs, "01/02/02.file", "02");
+  CreateFile(fs, "01/02/03/03.file", "03");
+
+  auto collect = [&](const FileSelector& s, std::vector<FileInfo>* out) {
+    ASSERT_OK_AND_ASSIGN(auto batches, fs->GetFileInfoIterator(s));
+    out->clear();
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto batch, batches.Next());
+      if (batch.empty()) {
+        break;
+      }
+      std::move(batch.begin(), batch.end(), std::back_inserter(*out));
+    }
+    SortInfos(out);
+  };
+
+  std::vector<FileInfo> infos, expected;
+  FileSelector s;
+  for (const std::string base_dir : {"", "01", "01/02/03", "AA"}) {
+    for (const bool recursive : {false, true}) {
+      SCOPED_TRACE("base_dir = '" + base_dir + "', recursive = " +
+                   std::to_string(recursive));
+      s.base_dir = base_dir;
+      s.recursive = recursive;
+      ASSERT_OK_AND_ASSIGN(expected, fs->GetFileInfo(s));
+      SortInfos(&expected);
+      collect(s, &infos);
+      ASSERT_EQ(infos, expected);
+    }
+  }
+
+  // Nonexistent base directory
+  s.base_dir = "nonexistent";
+  s.allow_not_found = true;
+  collect(s, &infos);
+  ASSERT_EQ(infos.size(), 0);
+  s.allow_not_found = false;
+  ASSERT_RAISES(IOError, [&]() -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto batches, fs->GetFileInfoIterator(s));
+    return batches.Next().status();
+  }());
+}
+
 void GenericFileSystemTest::TestOpenOutputStream(FileSystem* fs) {
   std::shared_ptr<io::OutputStream> stream;
 
@@ -818,12 +868,27 @@ void GenericFileSystemTest::TestOpenInputStream(FileSystem* fs) {
   ASSERT_OK(stream->Close());
   ASSERT_RAISES(Invalid, stream->Read(1));  // Stream is closed
 
+  // With a known FileInfo
+  ASSERT_OK_AND_ASSIGN(auto info, fs->GetFileInfo("AB/abc"));
+  ASSERT_OK_AND_ASSIGN(stream, fs->OpenInputStream(info));
+  ASSERT_OK_AND_ASSIGN(buffer, stream->Read(10));
+  AssertBufferEqual(*buffer, "some data");
+  ASSERT_OK(stream->Close());
+  ASSERT_OK_AND_ASSIGN(stream, fs->OpenInputStream(FileInfo("AB/abc")));
+  ASSERT_OK_AND_ASSIGN(buffer, stream->Read(10));
+  AssertBufferEqual(*buffer, "some data");
+  ASSERT_OK(stream->Close());
+
   // File does not exist
   ASSERT_RAISES(IOError, fs->OpenInputStream("AB/def"));
   ASSERT_RAISES(IOError, fs->OpenInputStream("def"));
+  ASSERT_OK_AND_ASSIGN(info, fs->GetFileInfo("AB/def"));
+  ASSERT_RAISES(IOError, fs->OpenInputStream(info));
 
   // Cannot open directory
   ASSERT_RAISES(IOError, fs->OpenInputStream("AB"));
+  ASSERT_OK_AND_ASSIGN(info, fs->GetFileInfo("AB"));
+  ASSERT_RAISES(IOError, fs->OpenInputStream(info));
 }
 
 void GenericFileSystemTest::TestOpenInputFile(FileSystem* fs) {
@@ -839,12 +904,27 @@ void GenericFileSystemTest::TestOpenInputFile(FileSystem* fs) {
   ASSERT_OK(file->Close());
   ASSERT_RAISES(Invalid, file->ReadAt(1, 1));  // Stream is closed
 
+  // With a known FileInfo
+  ASSERT_OK_AND_ASSIGN(auto info, fs->GetFileInfo("AB/abc"));
+  ASSERT_OK_AND_ASSIGN(file, fs->OpenInputFile(info));
+  ASSERT_OK_AND_EQ(15, file->GetSize());
+  ASSERT_OK_AND_ASSIGN(buffer, file->ReadAt(5, 6));
+  AssertBufferEqual(*buffer, "other ");
+  ASSERT_OK(file->Close());
+  ASSERT_OK_AND_ASSIGN(file, fs->OpenInputFile(FileInfo("AB/abc")));
+  ASSERT_OK_AND_EQ(15, file->GetSize());
+  ASSERT_OK(file->Close());
+
   // File does not exist
   ASSERT_RAISES(IOError, fs->OpenInputFile("AB/def"));
   ASSERT_RAISES(IOError, fs->OpenInputFile("def"));
+  ASSERT_OK_AND_ASSIGN(info, fs->GetFileInfo("AB/def"));
+  ASSERT_RAISES(IOError, fs->OpenInputFile(info));
 
   // Cannot open directory
   ASSERT_RAISES(IOError, fs->OpenInputFile("AB"));
+  ASSERT_OK_AND_ASSIGN(info, fs->GetFileInfo("AB"));
+  ASSERT_RAISES(IOError, fs->OpenInputFile(info));
 }
 
 #define GENERIC_FS_TEST_DEFINE(FUNC_NAME) \
@@ -864,6 +944,7 @@ GENERIC_FS_TEST_DEFINE(TestGetFileInfo)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoVector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelectorWithRecursion)
+GENERIC_FS_TEST_DEFINE(TestGetFileInfoIterator)
 GENERIC_FS_TEST_DEFINE(TestOpenOutputStream)
 GENERIC_FS_TEST_DEFINE(TestOpenAppendStream)
 GENERIC_FS_TEST_DEFINE(TestOpenInputStream)
@@ -20,12 +20,20 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef GRPCPP_PP_INCLUDE
 #include <grpcpp/grpcpp.h>
@@ -33,6 +41,7 @@
 #include <grpc++/grpc++.h>
 #endif
 
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
@@ -46,10 +55,12 @@
 
 #include "arrow/flight/client_auth.h"
 #include "arrow/flight/client_middleware.h"
+#include "arrow/flight/compression_internal.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/middleware_internal.h"
 #include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 namespace pb = arrow::flight::protocol;
@@ -64,6 +75,14 @@ FlightCallOptions::FlightCallOptions() : timeout(-1) {}
 
 struct ClientRpc {
   grpc::ClientContext context;
+  /// Whether record batch bodies go through shared memory
+  bool shared_memory = false;
+  /// The codec compressing record batch bodies, if any
+  std::unique_ptr<util::Codec> codec;
+  /// Whether the server compresses the bodies it sends, known with its
+  /// first message
+  bool compressed_downloads = false;
+  bool checked_compression = false;
 
   explicit ClientRpc(const FlightCallOptions& options) {
     if (options.timeout.count() >= 0) {
@@ -89,6 +108,60 @@ struct ClientRpc {
     }
     return Status::OK();
   }
+
+  /// \brief Exchange record batch bodies through shared memory in this call
+  void UseSharedMemory() {
+    shared_memory = true;
+    context.AddMetadata(internal::kGrpcSharedMemoryHeader, "1");
+  }
+
+  /// \brief Compress the uploaded record batch bodies of this call, and ask
+  /// the server to compress the ones it sends back
+  Status UseCompression(Compression::type compression) {
+    if (compression == Compression::UNCOMPRESSED) {
+      return Status::OK();
+    }
+    const std::string name = util::Codec::GetCodecAsString(compression);
+    RETURN_NOT_OK(internal::MakeBodyCodec(name, &codec));
+    context.AddMetadata(internal::kGrpcCompressionHeader, name);
+    return Status::OK();
+  }
+
+  /// \brief Prepare the body of a payload to be sent
+  Status SendBody(FlightPayload* payload) {
+    if (codec) {
+      RETURN_NOT_OK(internal::CompressBody(codec.get(), payload));
+    }
+    if (shared_memory) {
+      RETURN_NOT_OK(internal::MoveBodyToSharedMemory(payload));
+    }
+    return Status::OK();
+  }
+
+  /// \brief Release the resources of a prepared payload which couldn't be sent
+  void DiscardBody(const FlightPayload& payload) {
+    if (shared_memory) {
+      internal::DiscardSharedMemoryBody(payload);
+    }
+  }
+
+  /// \brief Restore the body of a received message
+  Status ReceiveBody(internal::FlightData* data) {
+    if (shared_memory) {
+      RETURN_NOT_OK(internal::MapBodyFromSharedMemory(data));
+    }
+    if (codec && !checked_compression) {
+      // The initial metadata of the server came with its first message
+      checked_compression = true;
+      const auto& metadata = context.GetServerInitialMetadata();
+      compressed_downloads =
+          metadata.find(internal::kGrpcCompressionHeader) != metadata.end();
+    }
+    if (compressed_downloads) {
+      RETURN_NOT_OK(internal::DecompressBody(codec.get(), data));
+    }
+    return Status::OK();
+  }
 };
 
 class GrpcAddCallHeaders : public AddCallHeaders {
@@ -176,6 +249,8 @@ class GrpcClientInterceptorAdapterFactory
       flight_method = FlightMethod::DoGet;
     } else if (method.ends_with("/DoPut")) {
       flight_method = FlightMethod::DoPut;
+    } else if (method.ends_with("/DoExchange")) {
+      flight_method = FlightMethod::DoExchange;
     } else if (method.ends_with("/DoAction")) {
       flight_method = FlightMethod::DoAction;
     } else if (method.ends_with("/ListActions")) {
@@ -243,6 +318,50 @@ class GrpcClientAuthReader : public ClientAuthReader {
       stream_;
 };
 
+using ClientPutStream = grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>;
+using ClientExchangeStream = grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>;
+
+Status SerializeDescriptor(const FlightDescriptor& descriptor,
+                           std::shared_ptr<Buffer>* out) {
+  pb::FlightDescriptor pb_descr;
+  RETURN_NOT_OK(internal::ToProto(descriptor, &pb_descr));
+  std::string str_descr;
+  if (!pb_descr.SerializeToString(&str_descr)) {
+    return Status::UnknownError("Failed to serialized Flight descriptor");
+  }
+  *out = Buffer::FromString(std::move(str_descr));
+  return Status::OK();
+}
+
+// A gRPC stream bundled with its RPC context. The call status is only
+// retrieved once from gRPC, as the read and write sides of a
+// bidirectional stream may both need it.
+template <typename Stream>
+class FinishableStream {
+ public:
+  FinishableStream(std::unique_ptr<ClientRpc> rpc, std::shared_ptr<Stream> stream)
+      : rpc_(std::move(rpc)), stream_(std::move(stream)), finished_(false) {}
+
+  ClientRpc* rpc() const { return rpc_.get(); }
+  Stream* stream() const { return stream_.get(); }
+  bool finished() const { return finished_; }
+
+  Status Finish() {
+    if (!finished_) {
+      server_status_ = internal::FromGrpcStatus(stream_->Finish(), &rpc_->context);
+      finished_ = true;
+    }
+    return server_status_;
+  }
+
+ private:
+  // The RPC context lifetime must be coupled to the stream
+  std::unique_ptr<ClientRpc> rpc_;
+  std::shared_ptr<Stream> stream_;
+  std::atomic<bool> finished_;
+  Status server_status_;
+};
+
 // The next two classes are intertwined. To get the application
 // metadata while avoiding reimplementing RecordBatchStreamReader, we
 // create an ipc::MessageReader that is tied to the
@@ -252,33 +371,88 @@ class GrpcClientAuthReader : public ClientAuthReader {
 // additional method to get both the record batch and application
 // metadata.
 
+template <typename Reader>
 class GrpcIpcMessageReader;
+
+template <typename Reader>
 class GrpcStreamReader : public FlightStreamReader {
  public:
-  GrpcStreamReader();
+  GrpcStreamReader(std::shared_ptr<FinishableStream<Reader>> stream,
+                   std::shared_ptr<std::mutex> read_mutex)
+      : stream_(std::move(stream)), read_mutex_(std::move(read_mutex)) {}
+
+  /// \brief Read the schema from the server, if not done yet.
+  ///
+  /// DoGet readers do this right away, but DoExchange readers wait until
+  /// the data is asked for, as the server may be waiting for the client's
+  /// data first. A server finishing the call without sending any data
+  /// results in an empty stream without schema.
+  Status EnsureDataStarted() {
+    if (started_) {
+      return start_status_;
+    }
+    started_ = true;
+    auto message_reader = std::unique_ptr<ipc::MessageReader>(
+        new GrpcIpcMessageReader<Reader>(this, stream_));
+    auto result = ipc::RecordBatchStreamReader::Open(std::move(message_reader));
+    if (result.ok()) {
+      batch_reader_ = std::move(result).ValueOrDie();
+    } else if (received_message_ || !stream_->Finish().ok()) {
+      start_status_ = result.status();
+    }
+    return start_status_;
+  }
 
-  static Status Open(std::unique_ptr<ClientRpc> rpc,
-                     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
-                     std::unique_ptr<GrpcStreamReader>* out);
-  std::shared_ptr<Schema> schema() const override;
-  Status Next(FlightStreamChunk* out) override;
-  void Cancel() override;
+  std::shared_ptr<Schema> schema() const override {
+    auto guard = LockRead();
+    auto self = const_cast<GrpcStreamReader*>(this);
+    if (!self->EnsureDataStarted().ok() || !batch_reader_) {
+      return nullptr;
+    }
+    return batch_reader_->schema();
+  }
+
+  Status Next(FlightStreamChunk* out) override {
+    auto guard = LockRead();
+    out->data = nullptr;
+    out->app_metadata = nullptr;
+    RETURN_NOT_OK(EnsureDataStarted());
+    if (!batch_reader_) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
+    out->app_metadata = std::move(last_app_metadata_);
+    return Status::OK();
+  }
+
+  void Cancel() override { stream_->rpc()->context.TryCancel(); }
 
  private:
+  template <typename R>
   friend class GrpcIpcMessageReader;
+
+  // Reads of a bidirectional stream are guarded against concurrent
+  // draining by the writer
+  std::unique_lock<std::mutex> LockRead() const {
+    return read_mutex_ ? std::unique_lock<std::mutex>(*read_mutex_)
+                       : std::unique_lock<std::mutex>();
+  }
+
+  std::shared_ptr<FinishableStream<Reader>> stream_;
+  std::shared_ptr<std::mutex> read_mutex_;
+  bool started_ = false;
+  bool received_message_ = false;
+  Status start_status_;
   std::shared_ptr<ipc::RecordBatchReader> batch_reader_;
   std::shared_ptr<Buffer> last_app_metadata_;
-  std::shared_ptr<ClientRpc> rpc_;
 };
 
+template <typename Reader>
 class GrpcIpcMessageReader : public ipc::MessageReader {
  public:
-  GrpcIpcMessageReader(GrpcStreamReader* reader, std::shared_ptr<ClientRpc> rpc,
-                       std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream)
-      : flight_reader_(reader),
-        rpc_(rpc),
-        stream_(std::move(stream)),
-        stream_finished_(false) {}
+  GrpcIpcMessageReader(GrpcStreamReader<Reader>* reader,
+                       std::shared_ptr<FinishableStream<Reader>> stream)
+      : flight_reader_(reader), stream_(std::move(stream)), stream_finished_(false) {}
 
   ::arrow::Result<std::unique_ptr<ipc::Message>> ReadNextMessage() override {
     std::unique_ptr<ipc::Message> out;
@@ -295,15 +469,24 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
       return Status::OK();
     }
     internal::FlightData data;
-    if (!internal::ReadPayload(stream_.get(), &data)) {
+    if (!internal::ReadPayload(stream_->stream(), &data)) {
       // Stream is completed
       stream_finished_ = true;
       *out = nullptr;
       flight_reader_->last_app_metadata_ = nullptr;
       return OverrideWithServerError(Status::OK());
     }
+    flight_reader_->received_message_ = true;
+    auto st = stream_->rpc()->ReceiveBody(&data);
+    if (!st.ok()) {
+      // Don't wait for the server to finish, it may be blocked sending
+      // more data
+      stream_->rpc()->context.TryCancel();
+      flight_reader_->last_app_metadata_ = nullptr;
+      return st;
+    }
     // Validate IPC message
-    auto st = data.OpenMessage(out);
+    st = data.OpenMessage(out);
     if (!st.ok()) {
       flight_reader_->last_app_metadata_ = nullptr;
       return OverrideWithServerError(std::move(st));
@@ -314,67 +497,56 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
 
   Status OverrideWithServerError(Status&& st) {
     // Get the gRPC status if not OK, to propagate any server error message
-    RETURN_NOT_OK(internal::FromGrpcStatus(stream_->Finish(), &rpc_->context));
+    RETURN_NOT_OK(stream_->Finish());
     return std::move(st);
   }
 
  private:
-  GrpcStreamReader* flight_reader_;
-  // The RPC context lifetime must be coupled to the ClientReader
-  std::shared_ptr<ClientRpc> rpc_;
-  std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream_;
+  GrpcStreamReader<Reader>* flight_reader_;
+  std::shared_ptr<FinishableStream<Reader>> stream_;
   bool stream_finished_;
 };
 
-GrpcStreamReader::GrpcStreamReader() {}
-
-Status GrpcStreamReader::Open(std::unique_ptr<ClientRpc> rpc,
-                              std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
-                              std::unique_ptr<GrpcStreamReader>* out) {
-  *out = std::unique_ptr<GrpcStreamReader>(new GrpcStreamReader);
-  out->get()->rpc_ = std::move(rpc);
-  auto reader = std::unique_ptr<ipc::MessageReader>(
-      new GrpcIpcMessageReader(out->get(), out->get()->rpc_, std::move(stream)));
-  ARROW_ASSIGN_OR_RAISE((*out)->batch_reader_,
-                        ipc::RecordBatchStreamReader::Open(std::move(reader)));
-  return Status::OK();
-}
-
-std::shared_ptr<Schema> GrpcStreamReader::schema() const {
-  return batch_reader_->schema();
-}
-
-Status GrpcStreamReader::Next(FlightStreamChunk* out) {
-  out->app_metadata = nullptr;
-  RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
-  out->app_metadata = std::move(last_app_metadata_);
-  return Status::OK();
-}
-
-void GrpcStreamReader::Cancel() { rpc_->context.TryCancel(); }
-
 // Similarly, the next two classes are intertwined. In order to get
 // application-specific metadata to the IpcPayloadWriter,
 // DoPutPayloadWriter takes a pointer to
 // GrpcStreamWriter. GrpcStreamWriter updates a metadata field on
 // write; DoPutPayloadWriter reads that metadata field to determine
 // what to write.
+//
+// Both are shared by DoPut and DoExchange, ProtoReadT being the type
+// of the messages sent back by the server.
 
+template <typename ProtoReadT>
 class DoPutPayloadWriter;
+
+template <typename ProtoReadT>
 class GrpcStreamWriter : public FlightStreamWriter {
  public:
-  ~GrpcStreamWriter() override = default;
+  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
 
-  explicit GrpcStreamWriter(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer)
-      : app_metadata_(nullptr), batch_writer_(nullptr), writer_(writer) {}
+  ~GrpcStreamWriter() override = default;
 
-  static Status Open(
-      const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-      std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-      std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      std::unique_ptr<FlightStreamWriter>* out);
+  GrpcStreamWriter(std::shared_ptr<FinishableStream<GrpcStream>> stream,
+                   std::shared_ptr<std::mutex> read_mutex)
+      : app_metadata_(nullptr),
+        batch_writer_(nullptr),
+        stream_(std::move(stream)),
+        read_mutex_(std::move(read_mutex)) {}
+
+  static Status Open(std::shared_ptr<Buffer> descriptor,
+                     const std::shared_ptr<Schema>& schema,
+                     std::shared_ptr<FinishableStream<GrpcStream>> stream,
+                     std::shared_ptr<std::mutex> read_mutex,
+                     std::unique_ptr<FlightStreamWriter>* out) {
+    std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(stream, read_mutex));
+    std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+        new DoPutPayloadWriter<ProtoReadT>(std::move(descriptor), stream, result.get()));
+    ARROW_ASSIGN_OR_RAISE(result->batch_writer_, ipc::internal::OpenRecordBatchWriter(
+                                                     std::move(payload_writer), schema));
+    *out = std::move(result);
+    return Status::OK();
+  }
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteWithMetadata(batch, nullptr);
@@ -389,34 +561,54 @@ class GrpcStreamWriter : public FlightStreamWriter {
       return Status::OK();
     }
     done_writing_ = true;
-    if (!writer_->WritesDone()) {
-      return Status::IOError("Could not flush pending record batches.");
+    if (stream_->finished()) {
+      // The server already ended the call
+      return Status::OK();
+    }
+    // This also sends the schema if no record batch was written
+    return batch_writer_->Close();
+  }
+  Status Close() override {
+    Status finished_writes = DoneWriting();
+    // Drain the read side to avoid hanging
+    std::unique_lock<std::mutex> guard(*read_mutex_, std::try_to_lock);
+    if (!guard.owns_lock()) {
+      return Status::IOError("Cannot close stream with pending read operation.");
+    }
+    ProtoReadT message;
+    while (!stream_->finished() && stream_->stream()->Read(&message)) {
+    }
+    RETURN_NOT_OK(stream_->Finish());
+    if (!finished_writes.ok()) {
+      return Status::UnknownError(
+          "Could not finish writing record batches before closing: ",
+          finished_writes.message());
     }
     return Status::OK();
   }
-  Status Close() override { return batch_writer_->Close(); }
 
  private:
-  friend class DoPutPayloadWriter;
+  friend class DoPutPayloadWriter<ProtoReadT>;
   std::shared_ptr<Buffer> app_metadata_;
   std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<FinishableStream<GrpcStream>> stream_;
+  std::shared_ptr<std::mutex> read_mutex_;
   bool done_writing_ = false;
 };
 
-/// A IpcPayloadWriter implementation that writes to a DoPut stream
+/// A IpcPayloadWriter implementation that writes to a DoPut or
+/// DoExchange stream. The serialized descriptor is sent along with the
+/// schema, unless it is null.
+template <typename ProtoReadT>
 class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
  public:
-  DoPutPayloadWriter(
-      const FlightDescriptor& descriptor, std::unique_ptr<ClientRpc> rpc,
-      std::unique_ptr<pb::PutResult> response, std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      GrpcStreamWriter* stream_writer)
-      : descriptor_(descriptor),
-        rpc_(std::move(rpc)),
-        response_(std::move(response)),
-        read_mutex_(read_mutex),
-        writer_(std::move(writer)),
+  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
+
+  DoPutPayloadWriter(std::shared_ptr<Buffer> descriptor,
+                     std::shared_ptr<FinishableStream<GrpcStream>> stream,
+                     GrpcStreamWriter<ProtoReadT>* stream_writer)
+      : descriptor_(std::move(descriptor)),
+        stream_(std::move(stream)),
         first_payload_(true),
         stream_writer_(stream_writer) {}
 
@@ -433,84 +625,48 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
       if (ipc_payload.type != ipc::Message::SCHEMA) {
         return Status::Invalid("First IPC message should be schema");
       }
-      std::string str_descr;
-      {
-        pb::FlightDescriptor pb_descr;
-        RETURN_NOT_OK(internal::ToProto(descriptor_, &pb_descr));
-        if (!pb_descr.SerializeToString(&str_descr)) {
-          return Status::UnknownError("Failed to serialized Flight descriptor");
-        }
-      }
-      payload.descriptor = Buffer::FromString(std::move(str_descr));
+      payload.descriptor = std::move(descriptor_);
       first_payload_ = false;
     } else if (ipc_payload.type == ipc::Message::RECORD_BATCH &&
                stream_writer_->app_metadata_) {
       payload.app_metadata = std::move(stream_writer_->app_metadata_);
     }
+    RETURN_NOT_OK(stream_->rpc()->SendBody(&payload));
 
-    if (!internal::WritePayload(payload, writer_.get())) {
-      return rpc_->IOError("Could not write record batch to stream: ");
+    if (!internal::WritePayload(payload, stream_->stream())) {
+      stream_->rpc()->DiscardBody(payload);
+      return stream_->rpc()->IOError("Could not write record batch to stream: ");
     }
     return Status::OK();
   }
 
+  // Only closes the write side of the stream, see GrpcStreamWriter::Close
   Status Close() override {
-    bool finished_writes = stream_writer_->done_writing_ ? true : writer_->WritesDone();
-    // Drain the read side to avoid hanging
-    std::unique_lock<std::mutex> guard(*read_mutex_, std::try_to_lock);
-    if (!guard.owns_lock()) {
-      return Status::IOError("Cannot close stream with pending read operation.");
-    }
-    pb::PutResult message;
-    while (writer_->Read(&message)) {
-    }
-    RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish(), &rpc_->context));
-    if (!finished_writes) {
-      return Status::UnknownError(
-          "Could not finish writing record batches before closing");
+    if (!stream_->stream()->WritesDone()) {
+      return Status::IOError("Could not flush pending record batches.");
     }
     return Status::OK();
   }
 
  protected:
-  // TODO: there isn't a way to access this as a user.
-  const FlightDescriptor descriptor_;
-  std::unique_ptr<ClientRpc> rpc_;
-  std::unique_ptr<pb::PutResult> response_;
-  std::shared_ptr<std::mutex> read_mutex_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<Buffer> descriptor_;
+  std::shared_ptr<FinishableStream<GrpcStream>> stream_;
   bool first_payload_;
-  GrpcStreamWriter* stream_writer_;
+  GrpcStreamWriter<ProtoReadT>* stream_writer_;
 };
 
-Status GrpcStreamWriter::Open(
-    const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-    std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-    std::shared_ptr<std::mutex> read_mutex,
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-    std::unique_ptr<FlightStreamWriter>* out) {
-  std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(writer));
-  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(new DoPutPayloadWriter(
-      descriptor, std::move(rpc), std::move(response), read_mutex, writer, result.get()));
-  ARROW_ASSIGN_OR_RAISE(result->batch_writer_, ipc::internal::OpenRecordBatchWriter(
-                                                   std::move(payload_writer), schema));
-  *out = std::move(result);
-  return Status::OK();
-}
-
 FlightMetadataReader::~FlightMetadataReader() = default;
 
 class GrpcMetadataReader : public FlightMetadataReader {
  public:
-  explicit GrpcMetadataReader(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> reader,
-      std::shared_ptr<std::mutex> read_mutex)
-      : reader_(reader), read_mutex_(read_mutex) {}
+  GrpcMetadataReader(std::shared_ptr<FinishableStream<ClientPutStream>> reader,
+                     std::shared_ptr<std::mutex> read_mutex)
+      : reader_(std::move(reader)), read_mutex_(std::move(read_mutex)) {}
 
   Status ReadMetadata(std::shared_ptr<Buffer>* out) override {
     std::lock_guard<std::mutex> guard(*read_mutex_);
     pb::PutResult message;
-    if (reader_->Read(&message)) {
+    if (!reader_->finished() && reader_->stream()->Read(&message)) {
       *out = Buffer::FromString(std::move(*message.mutable_app_metadata()));
     } else {
       // Stream finished
@@ -520,10 +676,231 @@ class GrpcMetadataReader : public FlightMetadataReader {
   }
 
  private:
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> reader_;
+  std::shared_ptr<FinishableStream<ClientPutStream>> reader_;
   std::shared_ptr<std::mutex> read_mutex_;
 };
 
+namespace {
+
+// The size of the buffers of an array, including its children and dictionary
+int64_t BufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += BufferSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+int64_t BufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += BufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+}  // namespace
+
+CoalescingFlightStreamWriter::CoalescingFlightStreamWriter(
+    std::unique_ptr<FlightStreamWriter> writer, int64_t target_bytes, MemoryPool* pool)
+    : writer_(std::move(writer)), target_bytes_(target_bytes), pool_(pool) {}
+
+CoalescingFlightStreamWriter::~CoalescingFlightStreamWriter() {}
+
+Status CoalescingFlightStreamWriter::WriteRecordBatch(const RecordBatch& batch) {
+  const int64_t batch_bytes = BufferSize(batch);
+  if (pending_.empty() && batch_bytes >= target_bytes_) {
+    return writer_->WriteRecordBatch(batch);
+  }
+  // The caller may destroy the batch after this returns, keep its data alive
+  pending_.push_back(RecordBatch::Make(batch.schema(), batch.num_rows(),
+                                       batch.column_data()));
+  pending_bytes_ += batch_bytes;
+  if (pending_bytes_ >= target_bytes_) {
+    return Flush();
+  }
+  return Status::OK();
+}
+
+Status CoalescingFlightStreamWriter::WriteWithMetadata(
+    const RecordBatch& batch, std::shared_ptr<Buffer> app_metadata) {
+  RETURN_NOT_OK(Flush());
+  return writer_->WriteWithMetadata(batch, std::move(app_metadata));
+}
+
+Status CoalescingFlightStreamWriter::Flush() {
+  if (pending_.empty()) {
+    return Status::OK();
+  }
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  batches.swap(pending_);
+  pending_bytes_ = 0;
+  if (batches.size() == 1) {
+    return writer_->WriteRecordBatch(*batches[0]);
+  }
+
+  const auto& schema = batches[0]->schema();
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->num_rows();
+  }
+  std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+  ArrayVector chunks(batches.size());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    for (size_t j = 0; j < batches.size(); ++j) {
+      chunks[j] = batches[j]->column(i);
+    }
+    RETURN_NOT_OK(Concatenate(chunks, pool_, &columns[i]));
+  }
+  return writer_->WriteRecordBatch(*RecordBatch::Make(schema, num_rows, columns));
+}
+
+Status CoalescingFlightStreamWriter::DoneWriting() {
+  RETURN_NOT_OK(Flush());
+  return writer_->DoneWriting();
+}
+
+Status CoalescingFlightStreamWriter::Close() {
+  Status st = Flush();
+  Status closed = writer_->Close();
+  RETURN_NOT_OK(st);
+  return closed;
+}
+
+class FlightMetadataListener::FlightMetadataListenerImpl {
+ public:
+  FlightMetadataListenerImpl(std::unique_ptr<FlightMetadataReader> reader,
+                             Callback callback)
+      : reader_(std::move(reader)), callback_(std::move(callback)) {
+    thread_ = std::thread([this] { status_ = Run(); });
+  }
+
+  ~FlightMetadataListenerImpl() { Wait(); }
+
+  Status Wait() {
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    return status_;
+  }
+
+ private:
+  Status Run() {
+    while (true) {
+      std::shared_ptr<Buffer> metadata;
+      RETURN_NOT_OK(reader_->ReadMetadata(&metadata));
+      if (metadata == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(callback_(std::move(metadata)));
+    }
+  }
+
+  std::unique_ptr<FlightMetadataReader> reader_;
+  Callback callback_;
+  Status status_;
+  std::thread thread_;
+};
+
+FlightMetadataListener::FlightMetadataListener(
+    std::unique_ptr<FlightMetadataReader> reader, Callback callback)
+    : impl_(new FlightMetadataListenerImpl(std::move(reader), std::move(callback))) {}
+
+FlightMetadataListener::~FlightMetadataListener() {}
+
+Status FlightMetadataListener::Wait() { return impl_->Wait(); }
+
+class FlightChannelPool::FlightChannelPoolImpl {
+ public:
+  std::shared_ptr<grpc::Channel> GetChannel(
+      const std::string& key,
+      const std::function<std::shared_ptr<grpc::Channel>()>& make_channel) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = channels_.find(key);
+    if (it == channels_.end()) {
+      it = channels_.emplace(key, make_channel()).first;
+    }
+    return it->second;
+  }
+
+  int64_t num_channels() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(channels_.size());
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    channels_.clear();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<grpc::Channel>> channels_;
+};
+
+FlightChannelPool::FlightChannelPool() : impl_(new FlightChannelPoolImpl) {}
+
+FlightChannelPool::~FlightChannelPool() {}
+
+std::shared_ptr<FlightChannelPool> FlightChannelPool::Make() {
+  return std::shared_ptr<FlightChannelPool>(new FlightChannelPool);
+}
+
+int64_t FlightChannelPool::num_channels() const { return impl_->num_channels(); }
+
+void FlightChannelPool::Clear() { impl_->Clear(); }
+
+namespace {
+
+// The key of the channels of a target and options in a FlightChannelPool
+std::string ChannelKey(const std::string& scheme, const std::string& target,
+                       const FlightClientOptions& options) {
+  std::stringstream key;
+  // The TLS certificates may hold any character, so separate with their size
+  key << scheme << ' ' << target << ' ' << options.tls_root_certs.size() << ' '
+      << options.tls_root_certs << options.override_hostname.size() << ' '
+      << options.override_hostname << ' ' << options.max_send_message_size << ' '
+      << options.max_receive_message_size << ' ' << options.keepalive_time_ms << ' '
+      << options.keepalive_timeout_ms << ' ' << options.keepalive_permit_without_calls
+      << ' ' << options.compression;
+  for (const auto& option : options.generic_int_options) {
+    key << ' ' << option.first.size() << ' ' << option.first << option.second;
+  }
+  for (const auto& option : options.generic_string_options) {
+    key << ' ' << option.first.size() << ' ' << option.first << option.second.size()
+        << ' ' << option.second;
+  }
+  // Channels hold the middleware, so only share them between the same factories
+  for (const auto& factory : options.middleware) {
+    key << ' ' << factory.get();
+  }
+  return key.str();
+}
+
+Status GetCompressionAlgorithm(const std::string& name,
+                               grpc_compression_algorithm* out) {
+  if (name == "identity") {
+    *out = GRPC_COMPRESS_NONE;
+  } else if (name == "deflate") {
+    *out = GRPC_COMPRESS_DEFLATE;
+  } else if (name == "gzip") {
+    *out = GRPC_COMPRESS_GZIP;
+  } else {
+    return Status::Invalid("Unknown Flight compression: ", name);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 class FlightClient::FlightClientImpl {
  public:
   Status Connect(const Location& location, const FlightClientOptions& options) {
@@ -543,9 +920,10 @@ class FlightClient::FlightClientImpl {
       } else {
         creds = grpc::InsecureChannelCredentials();
       }
-    } else if (scheme == kSchemeGrpcUnix) {
+    } else if (scheme == kSchemeGrpcUnix || scheme == kSchemeGrpcShm) {
       grpc_uri << "unix://" << location.uri_->path();
       creds = grpc::InsecureChannelCredentials();
+      shared_memory_ = scheme == kSchemeGrpcShm;
     } else {
       return Status::NotImplemented("Flight scheme " + scheme + " is not supported.");
     }
@@ -553,21 +931,47 @@ class FlightClient::FlightClientImpl {
     grpc::ChannelArguments args;
     // Try to reconnect quickly at first, in case the server is still starting up
     args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, 100);
-    // Receive messages of any size
-    args.SetMaxReceiveMessageSize(-1);
+    args.SetMaxSendMessageSize(options.max_send_message_size);
+    args.SetMaxReceiveMessageSize(options.max_receive_message_size);
+    if (options.keepalive_time_ms >= 0) {
+      args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, options.keepalive_time_ms);
+    }
+    if (options.keepalive_timeout_ms >= 0) {
+      args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, options.keepalive_timeout_ms);
+    }
+    if (options.keepalive_permit_without_calls) {
+      args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+    }
+    grpc_compression_algorithm compression;
+    RETURN_NOT_OK(GetCompressionAlgorithm(options.compression, &compression));
+    args.SetCompressionAlgorithm(compression);
 
     if (options.override_hostname != "") {
       args.SetSslTargetNameOverride(options.override_hostname);
     }
+    for (const auto& option : options.generic_int_options) {
+      args.SetInt(option.first, option.second);
+    }
+    for (const auto& option : options.generic_string_options) {
+      args.SetString(option.first, option.second);
+    }
 
-    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
-        interceptors;
-    interceptors.emplace_back(
-        new GrpcClientInterceptorAdapterFactory(std::move(options.middleware)));
-
-    stub_ = pb::FlightService::NewStub(
-        grpc::experimental::CreateCustomChannelWithInterceptors(
-            grpc_uri.str(), creds, args, std::move(interceptors)));
+    auto make_channel = [&]() {
+      std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+          interceptors;
+      interceptors.emplace_back(
+          new GrpcClientInterceptorAdapterFactory(options.middleware));
+      return grpc::experimental::CreateCustomChannelWithInterceptors(
+          grpc_uri.str(), creds, args, std::move(interceptors));
+    };
+    std::shared_ptr<grpc::Channel> channel;
+    if (options.channel_pool != nullptr) {
+      channel = options.channel_pool->impl_->GetChannel(
+          ChannelKey(scheme, grpc_uri.str(), options), make_channel);
+    } else {
+      channel = make_channel();
+    }
+    stub_ = pb::FlightService::NewStub(channel);
 
     return Status::OK();
   }
@@ -695,16 +1099,24 @@ class FlightClient::FlightClientImpl {
 
   Status DoGet(const FlightCallOptions& options, const Ticket& ticket,
                std::unique_ptr<FlightStreamReader>* out) {
+    using StreamReader = GrpcStreamReader<grpc::ClientReader<pb::FlightData>>;
     pb::Ticket pb_ticket;
     internal::ToProto(ticket, &pb_ticket);
 
     std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream(
+    if (shared_memory_) {
+      rpc->UseSharedMemory();
+    }
+    RETURN_NOT_OK(rpc->UseCompression(options.body_compression));
+    std::shared_ptr<grpc::ClientReader<pb::FlightData>> stream(
         stub_->DoGet(&rpc->context, pb_ticket));
 
-    std::unique_ptr<GrpcStreamReader> reader;
-    RETURN_NOT_OK(GrpcStreamReader::Open(std::move(rpc), std::move(stream), &reader));
+    std::unique_ptr<StreamReader> reader(new StreamReader(
+        std::make_shared<FinishableStream<grpc::ClientReader<pb::FlightData>>>(
+            std::move(rpc), std::move(stream)),
+        nullptr));
+    RETURN_NOT_OK(reader->EnsureDataStarted());
     *out = std::move(reader);
     return Status::OK();
   }
@@ -715,20 +1127,288 @@ class FlightClient::FlightClientImpl {
                std::unique_ptr<FlightMetadataReader>* reader) {
     std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<pb::PutResult> response(new pb::PutResult);
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer(
-        stub_->DoPut(&rpc->context));
+    if (shared_memory_) {
+      rpc->UseSharedMemory();
+    }
+    RETURN_NOT_OK(rpc->UseCompression(options.body_compression));
+    std::shared_ptr<ClientPutStream> grpc_stream(stub_->DoPut(&rpc->context));
+    auto stream = std::make_shared<FinishableStream<ClientPutStream>>(
+        std::move(rpc), std::move(grpc_stream));
 
+    std::shared_ptr<Buffer> pb_descriptor;
+    RETURN_NOT_OK(SerializeDescriptor(descriptor, &pb_descriptor));
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
     *reader =
-        std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(writer, read_mutex));
-    return GrpcStreamWriter::Open(descriptor, schema, std::move(rpc), std::move(response),
-                                  read_mutex, writer, out);
+        std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(stream, read_mutex));
+    return GrpcStreamWriter<pb::PutResult>::Open(std::move(pb_descriptor), schema,
+                                                 stream, read_mutex, out);
+  }
+
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
+    RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    if (shared_memory_) {
+      rpc->UseSharedMemory();
+    }
+    RETURN_NOT_OK(rpc->UseCompression(options.body_compression));
+    std::shared_ptr<ClientExchangeStream> grpc_stream(stub_->DoExchange(&rpc->context));
+    auto stream = std::make_shared<FinishableStream<ClientExchangeStream>>(
+        std::move(rpc), std::move(grpc_stream));
+
+    // Send the descriptor right away, as the server needs it to handle
+    // the call while the client may wait for the server's data first
+    FlightPayload payload;
+    RETURN_NOT_OK(SerializeDescriptor(descriptor, &payload.descriptor));
+    if (!internal::WritePayload(payload, stream->stream())) {
+      RETURN_NOT_OK(stream->Finish());
+      return stream->rpc()->IOError("Could not write descriptor to stream: ");
+    }
+
+    std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
+    // The reader is not started here, for the same reason
+    reader->reset(new GrpcStreamReader<ClientExchangeStream>(stream, read_mutex));
+    return GrpcStreamWriter<pb::FlightData>::Open(nullptr, schema, stream, read_mutex,
+                                                  writer);
   }
 
  private:
   std::unique_ptr<pb::FlightService::Stub> stub_;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
+  bool shared_memory_ = false;
+};
+
+// Reads the endpoints of a flight with a few threads, each reading one
+// endpoint at a time, and hands out their batches from a bounded buffer.
+class FlightEndpointsReader : public RecordBatchReader {
+ public:
+  FlightEndpointsReader(FlightClient* client, const FlightCallOptions& call_options,
+                        std::vector<FlightEndpoint> endpoints,
+                        const FlightEndpointReadOptions& options,
+                        std::shared_ptr<Schema> schema)
+      : client_(client),
+        call_options_(call_options),
+        endpoints_(std::move(endpoints)),
+        options_(options),
+        schema_(std::move(schema)),
+        buffers_(options.ordered ? endpoints_.size() : 1),
+        streams_(endpoints_.size(), nullptr),
+        done_(endpoints_.size(), false) {}
+
+  ~FlightEndpointsReader() override {
+    Stop(Status::OK());
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void Start() {
+    const size_t num_threads = std::min(
+        static_cast<size_t>(std::max(options_.max_concurrency, 1)), endpoints_.size());
+    for (size_t i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this] { RunWorker(); });
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      RETURN_NOT_OK(status_);
+      if (options_.ordered) {
+        // Move on to the next endpoint once all the batches of this one are consumed
+        while (current_ < endpoints_.size() && done_[current_] &&
+               buffers_[current_].empty()) {
+          ++current_;
+          cv_.notify_all();
+        }
+        if (current_ == endpoints_.size()) {
+          out->reset();
+          return Status::OK();
+        }
+      } else if (buffers_[0].empty() && num_done_ == endpoints_.size()) {
+        out->reset();
+        return Status::OK();
+      }
+      auto& buffer = buffers_[options_.ordered ? current_ : 0];
+      if (!buffer.empty()) {
+        *out = std::move(buffer.front());
+        buffer.pop_front();
+        --num_buffered_;
+        cv_.notify_all();
+        return Status::OK();
+      }
+      cv_.wait(lock);
+    }
+  }
+
+ private:
+  void RunWorker() {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_ || next_endpoint_ == endpoints_.size()) {
+          return;
+        }
+        index = next_endpoint_++;
+      }
+      std::unique_ptr<FlightStreamReader> stream;
+      Status st = ReadEndpoint(index, &stream);
+      if (!st.ok()) {
+        // Before the endpoint is marked as done, so that the consumer
+        // doesn't mistake it for the end of the stream
+        Stop(st);
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        streams_[index] = nullptr;
+        done_[index] = true;
+        ++num_done_;
+        cv_.notify_all();
+      }
+      if (!st.ok()) {
+        return;
+      }
+    }
+  }
+
+  // Stop reading, and fail the stream if the status is an error
+  void Stop(const Status& st) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return;
+    }
+    stopped_ = true;
+    status_ = st;
+    for (FlightStreamReader* stream : streams_) {
+      if (stream != nullptr) {
+        stream->Cancel();
+      }
+    }
+    cv_.notify_all();
+  }
+
+  Status ReadEndpoint(size_t index, std::unique_ptr<FlightStreamReader>* stream) {
+    FlightStreamChunk chunk;
+    RETURN_NOT_OK(OpenEndpoint(index, stream, &chunk));
+    if (!(*stream)->schema()->Equals(*schema_)) {
+      return Status::Invalid("Endpoint ", index, " of the flight has schema ",
+                             (*stream)->schema()->ToString(), ", expected ",
+                             schema_->ToString());
+    }
+    while (chunk.data != nullptr) {
+      RETURN_NOT_OK(Push(index, std::move(chunk.data)));
+      RETURN_NOT_OK((*stream)->Next(&chunk));
+    }
+    return Status::OK();
+  }
+
+  // Open the stream of an endpoint and read its first batch, trying each of
+  // its locations in turn
+  Status OpenEndpoint(size_t index, std::unique_ptr<FlightStreamReader>* stream,
+                      FlightStreamChunk* chunk) {
+    const auto& locations = endpoints_[index].locations;
+    if (locations.empty()) {
+      return OpenStream(index, client_, stream, chunk);
+    }
+    Status st;
+    for (const Location& location : locations) {
+      FlightClient* client = nullptr;
+      st = GetClient(location, &client);
+      if (st.ok()) {
+        st = OpenStream(index, client, stream, chunk);
+      }
+      if (st.ok() || IsStopped()) {
+        break;
+      }
+    }
+    return st;
+  }
+
+  Status OpenStream(size_t index, FlightClient* client,
+                    std::unique_ptr<FlightStreamReader>* stream,
+                    FlightStreamChunk* chunk) {
+    std::unique_ptr<FlightStreamReader> new_stream;
+    RETURN_NOT_OK(client->DoGet(call_options_, endpoints_[index].ticket, &new_stream));
+    {
+      // Register the stream so that Stop() can cancel it
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return Status::IOError("Reading the flight was stopped");
+      }
+      streams_[index] = new_stream.get();
+    }
+    // The stream of a previous location, if any, isn't registered anymore
+    *stream = std::move(new_stream);
+    return (*stream)->Next(chunk);
+  }
+
+  // Get the client of a location, connecting to it on first use
+  Status GetClient(const Location& location, FlightClient** out) {
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    const std::string uri = location.ToString();
+    auto it = clients_.find(uri);
+    if (it == clients_.end()) {
+      std::unique_ptr<FlightClient> client;
+      RETURN_NOT_OK(FlightClient::Connect(location, options_.client_options, &client));
+      it = clients_.emplace(uri, std::move(client)).first;
+    }
+    *out = it->second.get();
+    return Status::OK();
+  }
+
+  Status Push(size_t index, std::shared_ptr<RecordBatch> batch) {
+    auto& buffer = buffers_[options_.ordered ? index : 0];
+    std::unique_lock<std::mutex> lock(mutex_);
+    // When ordered, the endpoint being consumed has a buffer of its own, so
+    // that the readers of the following endpoints can't fill the buffer and
+    // block it
+    cv_.wait(lock, [&] {
+      return stopped_ || num_buffered_ < options_.max_buffered_batches ||
+             (options_.ordered && index == current_ &&
+              static_cast<int64_t>(buffer.size()) < options_.max_buffered_batches);
+    });
+    if (stopped_) {
+      return Status::IOError("Reading the flight was stopped");
+    }
+    buffer.push_back(std::move(batch));
+    ++num_buffered_;
+    cv_.notify_all();
+    return Status::OK();
+  }
+
+  bool IsStopped() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stopped_;
+  }
+
+  FlightClient* client_;
+  const FlightCallOptions call_options_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const FlightEndpointReadOptions options_;
+  std::shared_ptr<Schema> schema_;
+
+  std::mutex clients_mutex_;
+  std::map<std::string, std::unique_ptr<FlightClient>> clients_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  Status status_;
+  bool stopped_ = false;
+  // The next endpoint to read, and the endpoint being consumed when ordered
+  size_t next_endpoint_ = 0;
+  size_t current_ = 0;
+  size_t num_done_ = 0;
+  int64_t num_buffered_ = 0;
+  std::vector<std::deque<std::shared_ptr<RecordBatch>>> buffers_;
+  std::vector<FlightStreamReader*> streams_;
+  std::vector<bool> done_;
+
+  std::vector<std::thread> threads_;
 };
 
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
@@ -788,6 +1468,22 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGet(const FlightCallOptions& options, const FlightInfo& info,
+                           const FlightEndpointReadOptions& read_options,
+                           std::unique_ptr<RecordBatchReader>* reader) {
+  if (read_options.max_buffered_batches < 1) {
+    return Status::Invalid("max_buffered_batches must be at least 1");
+  }
+  ipc::DictionaryMemo dictionary_memo;
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(info.GetSchema(&dictionary_memo, &schema));
+  std::unique_ptr<FlightEndpointsReader> endpoints_reader(new FlightEndpointsReader(
+      this, options, info.endpoints(), read_options, std::move(schema)));
+  endpoints_reader->Start();
+  *reader = std::move(endpoints_reader);
+  return Status::OK();
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -796,5 +1492,13 @@ Status FlightClient::DoPut(const FlightCallOptions& options,
   return impl_->DoPut(options, descriptor, schema, stream, reader);
 }
 
+Status FlightClient::DoExchange(const FlightCallOptions& options,
+                                const FlightDescriptor& descriptor,
+                                const std::shared_ptr<Schema>& schema,
+                                std::unique_ptr<FlightStreamWriter>* writer,
+                                std::unique_ptr<FlightStreamReader>* reader) {
+  return impl_->DoExchange(options, descriptor, schema, writer, reader);
+}
+
 }  // namespace flight
 }  // namespace arrow
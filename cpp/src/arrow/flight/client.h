@@ -21,6 +21,8 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -28,7 +30,9 @@
 
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 #include "arrow/flight/types.h"  // IWYU pragma: keep
 #include "arrow/flight/visibility.h"
@@ -58,6 +62,44 @@ class ARROW_FLIGHT_EXPORT FlightCallOptions {
   /// mean an implementation-defined default behavior will be used
   /// instead. This is the default value.
   TimeoutDuration timeout;
+
+  /// \brief The codec compressing the record batch bodies of DoGet, DoPut
+  /// and DoExchange calls: LZ4_FRAME, ZSTD or UNCOMPRESSED (the default).
+  ///
+  /// The client compresses the bodies it uploads, so that a server not
+  /// supporting the codec fails the call.  The server compresses the bodies
+  /// it sends back if it supports the codec, and sends them uncompressed
+  /// otherwise.  Unlike FlightClientOptions::compression, which applies
+  /// deflate or gzip to all the gRPC messages of a client, this is chosen
+  /// per call.
+  Compression::type body_compression = Compression::UNCOMPRESSED;
+};
+
+/// \brief A pool of gRPC channels shared by the clients connecting with it.
+///
+/// A client connecting to a location with a pool reuses the channel of a
+/// previous client of the same location and options, if any, instead of
+/// setting up new connections (and TLS sessions). The channels stay open as
+/// long as the pool or a client using them lives.
+class ARROW_FLIGHT_EXPORT FlightChannelPool {
+ public:
+  ~FlightChannelPool();
+
+  static std::shared_ptr<FlightChannelPool> Make();
+
+  /// \brief The number of channels in the pool.
+  int64_t num_channels() const;
+
+  /// \brief Remove all the channels from the pool. The clients using them
+  /// are not affected.
+  void Clear();
+
+ private:
+  FlightChannelPool();
+  class FlightChannelPoolImpl;
+  std::unique_ptr<FlightChannelPoolImpl> impl_;
+
+  friend class FlightClient;
 };
 
 class ARROW_FLIGHT_EXPORT FlightClientOptions {
@@ -69,6 +111,44 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   std::string override_hostname;
   /// \brief A list of client middleware to apply.
   std::vector<std::shared_ptr<ClientMiddlewareFactory>> middleware;
+  /// \brief The largest message size to send, or -1 for no limit.
+  int max_send_message_size = -1;
+  /// \brief The largest message size to receive, or -1 for no limit.
+  int max_receive_message_size = -1;
+  /// \brief The interval of keepalive pings on idle connections, in
+  /// milliseconds, or -1 for the gRPC default (no pings).
+  int keepalive_time_ms = -1;
+  /// \brief How long to wait for the acknowledgement of a keepalive ping
+  /// before closing the connection, in milliseconds, or -1 for the gRPC
+  /// default.
+  int keepalive_timeout_ms = -1;
+  /// \brief Whether to send keepalive pings when there is no call.
+  bool keepalive_permit_without_calls = false;
+  /// \brief The compression of the messages sent by the calls: "identity"
+  /// (none), "deflate" or "gzip".
+  std::string compression = "identity";
+  /// \brief Other gRPC channel arguments, e.g. "grpc.http2.lookahead_bytes"
+  /// for the flow control window of the streams. They override the options
+  /// above.
+  std::map<std::string, int> generic_int_options;
+  std::map<std::string, std::string> generic_string_options;
+  /// \brief A pool of channels to reuse, if not null.
+  std::shared_ptr<FlightChannelPool> channel_pool;
+};
+
+/// \brief Options for reading all the endpoints of a flight as one stream.
+class ARROW_FLIGHT_EXPORT FlightEndpointReadOptions {
+ public:
+  /// \brief The largest number of endpoints read concurrently.
+  int max_concurrency = 4;
+  /// \brief The largest number of record batches read but not yet
+  /// consumed. The endpoints are not read while the buffer is full.
+  int64_t max_buffered_batches = 16;
+  /// \brief Whether to return the batches in the order of the endpoints,
+  /// rather than as soon as they are read.
+  bool ordered = false;
+  /// \brief Options for connecting to the locations of the endpoints.
+  FlightClientOptions client_options;
 };
 
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
@@ -113,6 +193,65 @@ class ARROW_FLIGHT_EXPORT FlightMetadataReader {
   virtual Status ReadMetadata(std::shared_ptr<Buffer>* out) = 0;
 };
 
+/// \brief A FlightStreamWriter merging small record batches before writing
+/// them to another writer, to amortize the per-message overhead.
+///
+/// Batches are buffered until their size reaches a target, and then written
+/// as a single batch. A batch with application metadata is written as is,
+/// after the buffered batches, so that the metadata stays attached to it.
+class ARROW_FLIGHT_EXPORT CoalescingFlightStreamWriter : public FlightStreamWriter {
+ public:
+  /// \param[in] writer the writer of the merged batches
+  /// \param[in] target_bytes the size of the buffers of the batches to merge
+  /// \param[in] pool the pool of the merged batches
+  CoalescingFlightStreamWriter(std::unique_ptr<FlightStreamWriter> writer,
+                               int64_t target_bytes,
+                               MemoryPool* pool = default_memory_pool());
+  ~CoalescingFlightStreamWriter() override;
+
+  Status WriteRecordBatch(const RecordBatch& batch) override;
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override;
+  /// \brief Write the buffered batches, if any.
+  Status Flush();
+  Status DoneWriting() override;
+  Status Close() override;
+
+ private:
+  std::unique_ptr<FlightStreamWriter> writer_;
+  int64_t target_bytes_;
+  MemoryPool* pool_;
+  std::vector<std::shared_ptr<RecordBatch>> pending_;
+  int64_t pending_bytes_ = 0;
+};
+
+/// \brief Read the application metadata sent back by the server during an
+/// upload on a background thread, and pass it to a callback, so that the
+/// writer never waits for the server's acknowledgements.
+///
+/// The metadata is read until the server ends the call. Since the writer
+/// can't be closed while a read is pending, finish an upload by calling
+/// DoneWriting() on the writer, then Wait(), then Close() on the writer.
+class ARROW_FLIGHT_EXPORT FlightMetadataListener {
+ public:
+  /// \brief A callback for each metadata message. An error stops reading.
+  using Callback = std::function<Status(std::shared_ptr<Buffer>)>;
+
+  /// \brief Start reading metadata on a background thread.
+  FlightMetadataListener(std::unique_ptr<FlightMetadataReader> reader,
+                         Callback callback);
+  /// \brief Wait for the background thread.
+  ~FlightMetadataListener();
+
+  /// \brief Wait for the end of the metadata stream, and return the error
+  /// of the reader or the callback, if any.
+  Status Wait();
+
+ private:
+  class FlightMetadataListenerImpl;
+  std::unique_ptr<FlightMetadataListenerImpl> impl_;
+};
+
 /// \brief Client class for Arrow Flight RPC services (gRPC-based).
 /// API experimental for now
 class ARROW_FLIGHT_EXPORT FlightClient {
@@ -217,6 +356,24 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Read all the endpoints of a flight concurrently, as a single
+  /// stream of record batches.
+  ///
+  /// An endpoint without locations is read from this client's service.
+  /// Otherwise, its locations are tried in order until one of them starts
+  /// streaming, with one connection per location shared by the endpoints.
+  /// The stream fails with the first error of an endpoint. This client must
+  /// outlive the returned reader.
+  ///
+  /// \param[in] options Per-RPC options
+  /// \param[in] info The flight to read, as returned by GetFlightInfo
+  /// \param[in] read_options Options for reading the endpoints
+  /// \param[out] reader the returned RecordBatchReader
+  /// \return Status
+  Status DoGet(const FlightCallOptions& options, const FlightInfo& info,
+               const FlightEndpointReadOptions& read_options,
+               std::unique_ptr<RecordBatchReader>* reader);
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -241,6 +398,35 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoPut({}, descriptor, schema, stream, reader);
   }
 
+  /// \brief Exchange data with a Flight service over a single
+  /// bidirectional stream. The client and the server may interleave
+  /// record batches in both directions, as the application sees fit.
+  /// The caller must call Close() on the returned writer once they are
+  /// done with the call.
+  ///
+  /// The reader and writer are linked; closing the writer will also
+  /// close the reader. Use \a DoneWriting to only close the write
+  /// side of the channel, the server's data can still be read after
+  /// that. The reader does not wait for the server's schema until it
+  /// is first used, so that the client can start writing first.
+  ///
+  /// \param[in] options Per-RPC options
+  /// \param[in] descriptor the descriptor of the exchange
+  /// \param[in] schema the schema for the data sent by the client
+  /// \param[out] writer a writer to write record batches to
+  /// \param[out] reader a reader for the record batches sent by the server
+  /// \return Status
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader);
+  Status DoExchange(const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    return DoExchange({}, descriptor, schema, writer, reader);
+  }
+
  private:
   FlightClient();
   class FlightClientImpl;
@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/flight/compression_internal.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/types.h"
+#include "arrow/ipc/options.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kBodyHeaderSize = 2 * static_cast<int64_t>(sizeof(int64_t));
+
+}  // namespace
+
+Status MakeBodyCodec(const std::string& name, std::unique_ptr<util::Codec>* out) {
+  ARROW_ASSIGN_OR_RAISE(Compression::type type, util::Codec::GetCompressionType(name));
+  RETURN_NOT_OK(ipc::internal::CheckCompressionSupported(type));
+  return util::Codec::Create(type).Value(out);
+}
+
+Status CompressBody(util::Codec* codec, FlightPayload* payload) {
+  auto& ipc_msg = payload->ipc_message;
+  int64_t body_size = 0;
+  for (const auto& buffer : ipc_msg.body_buffers) {
+    // Buffer may be null when the row length is zero, or when all
+    // entries are invalid.
+    if (!buffer) continue;
+    body_size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+  }
+  if (body_size == 0) {
+    return Status::OK();
+  }
+
+  // Lay out the buffers as in the gRPC message body
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> body, AllocateBuffer(body_size));
+  uint8_t* out = body->mutable_data();
+  for (const auto& buffer : ipc_msg.body_buffers) {
+    if (!buffer) continue;
+    const int64_t size = buffer->size();
+    const int64_t padded_size = BitUtil::RoundUpToMultipleOf8(size);
+    if (size > 0) {
+      std::memcpy(out, buffer->data(), static_cast<size_t>(size));
+    }
+    std::memset(out + size, 0, static_cast<size_t>(padded_size - size));
+    out += padded_size;
+  }
+
+  const int64_t max_length = codec->MaxCompressedLen(body_size, body->data());
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> compressed,
+                        AllocateResizableBuffer(kBodyHeaderSize + max_length));
+  ARROW_ASSIGN_OR_RAISE(
+      int64_t compressed_length,
+      codec->Compress(body_size, body->data(), max_length,
+                      compressed->mutable_data() + kBodyHeaderSize));
+  if (compressed_length >= body_size) {
+    // Send the body as is
+    RETURN_NOT_OK(compressed->Resize(kBodyHeaderSize + body_size));
+    std::memcpy(compressed->mutable_data() + kBodyHeaderSize, body->data(),
+                static_cast<size_t>(body_size));
+    compressed_length = -1;
+  } else {
+    RETURN_NOT_OK(compressed->Resize(kBodyHeaderSize + compressed_length));
+  }
+  const int64_t lengths[2] = {BitUtil::ToLittleEndian(body_size),
+                              BitUtil::ToLittleEndian(compressed_length)};
+  std::memcpy(compressed->mutable_data(), lengths, sizeof(lengths));
+
+  ipc_msg.body_buffers = {compressed};
+  ipc_msg.body_length = compressed->size();
+  return Status::OK();
+}
+
+Status DecompressBody(util::Codec* codec, FlightData* data) {
+  if (data->body == nullptr || data->body->size() == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(data->CoalesceBody());
+  const Buffer& body = *data->body;
+  if (body.size() < kBodyHeaderSize) {
+    return Status::Invalid("Compressed message body is truncated");
+  }
+  int64_t lengths[2];
+  std::memcpy(lengths, body.data(), sizeof(lengths));
+  const int64_t body_size = BitUtil::FromLittleEndian(lengths[0]);
+  const int64_t compressed_length = BitUtil::FromLittleEndian(lengths[1]);
+  // The body may be followed by padding
+  const int64_t available = body.size() - kBodyHeaderSize;
+  if (body_size < 0 || compressed_length < -1 ||
+      (compressed_length == -1 ? body_size : compressed_length) > available) {
+    return Status::Invalid("Invalid compressed message body");
+  }
+
+  if (compressed_length == -1) {
+    data->body = SliceBuffer(data->body, kBodyHeaderSize, body_size);
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> decompressed,
+                        AllocateBuffer(body_size));
+  ARROW_ASSIGN_OR_RAISE(
+      int64_t actual_size,
+      codec->Decompress(compressed_length, body.data() + kBodyHeaderSize, body_size,
+                        decompressed->mutable_data()));
+  if (actual_size != body_size) {
+    return Status::Invalid("Message body decompressed to ", actual_size,
+                           " bytes instead of ", body_size);
+  }
+  data->body = std::move(decompressed);
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
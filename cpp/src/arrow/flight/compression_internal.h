@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// Compression of IPC message bodies on the wire, negotiated per call
+// through the x-arrow-compression header.
+//
+// The client names a codec in the header of a DoGet, DoPut or DoExchange
+// call, and compresses the bodies it uploads with it.  The server, if it
+// supports the codec, echoes the header in its initial metadata and
+// compresses the bodies it sends back.  A compressed body is laid out as
+// the uncompressed and compressed lengths, as little-endian int64, then
+// the compressed bytes of the body as it would have been sent.  Bodies
+// which don't shrink are sent as is, with a compressed length of -1.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/flight/visibility.h"
+#include "arrow/status.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace flight {
+
+struct FlightPayload;
+
+namespace internal {
+
+struct FlightData;
+
+/// \brief Create the codec named by the value of a compression header.
+///
+/// Only LZ4 and ZSTD are supported, as for IPC body compression.
+ARROW_FLIGHT_EXPORT
+Status MakeBodyCodec(const std::string& name, std::unique_ptr<util::Codec>* out);
+
+/// \brief Compress the IPC body of a payload, replacing its buffers by a
+/// single compressed one.
+///
+/// Payloads without a body are left untouched.
+ARROW_FLIGHT_EXPORT
+Status CompressBody(util::Codec* codec, FlightPayload* payload);
+
+/// \brief Replace a body written by CompressBody by the original body.
+///
+/// Messages without a body are left untouched.
+ARROW_FLIGHT_EXPORT
+Status DecompressBody(util::Codec* codec, FlightData* data);
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
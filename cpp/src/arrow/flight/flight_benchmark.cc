@@ -15,10 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdint>
+#include <iomanip>
+#include <iostream>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gflags/gflags.h>
@@ -28,6 +34,7 @@
 #include "arrow/ipc/api.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/stopwatch.h"
 #include "arrow/util/thread_pool.h"
 
@@ -44,7 +51,30 @@ DEFINE_int32(num_streams, 4, "Number of streams for each server");
 DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
+DEFINE_string(data_type, "int64",
+              "The columns of the record batches: int64 (numeric) or string");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(test_exchange, false, "Test DoExchange round trips instead of DoGet");
+DEFINE_bool(test_metadata, false,
+            "Test application metadata round trips instead of DoGet: each record "
+            "batch is uploaded with DoPut along with metadata, which the server echoes "
+            "back before the next one is sent");
+DEFINE_string(server_unix, "",
+              "Domain socket path of an existing performance server to benchmark "
+              "against, instead of --server_host");
+DEFINE_bool(shared_memory, false,
+            "Exchange record batch bodies through shared memory (requires "
+            "--server_unix and a server started with --shared_memory)");
+DEFINE_bool(tls, false,
+            "Connect over TLS with the test certificates (requires ARROW_TEST_DATA and "
+            "a server started with --tls)");
+DEFINE_bool(matrix, false,
+            "Run every method with both data types, small and large batches, one and "
+            "--num_streams streams, and print a table of the results. With --tls, the "
+            "matrix is also run over TLS, against a second server on --server_port + 1");
+DEFINE_int32(small_records_per_batch, 64,
+             "Records per batch of the small batches of --matrix (the large ones have "
+             "--records_per_batch)");
 
 namespace perf = arrow::flight::perf;
 
@@ -55,9 +85,36 @@ using internal::ThreadPool;
 
 namespace flight {
 
+enum class TestMethod { DO_GET, DO_PUT, DO_EXCHANGE, METADATA };
+
+const char* TestMethodName(TestMethod method) {
+  switch (method) {
+    case TestMethod::DO_GET:
+      return "DoGet";
+    case TestMethod::DO_PUT:
+      return "DoPut";
+    case TestMethod::DO_EXCHANGE:
+      return "DoExchange";
+    case TestMethod::METADATA:
+      return "Metadata";
+  }
+  return "";
+}
+
+struct PerformanceConfig {
+  TestMethod method;
+  std::string data_type;
+  int32_t records_per_batch;
+  int32_t num_streams;
+};
+
 struct PerformanceResult {
   int64_t num_records;
   int64_t num_bytes;
+  // The latency of every record batch, in nanoseconds: the time to
+  // receive it for DoGet, to write it for DoPut, and the round trip for
+  // DoExchange and metadata
+  std::vector<int64_t> latencies;
 };
 
 struct PerformanceStats {
@@ -65,14 +122,69 @@ struct PerformanceStats {
   std::mutex mutex;
   int64_t total_records;
   int64_t total_bytes;
+  std::vector<int64_t> latencies;
 
-  void Update(const int64_t total_records, const int64_t total_bytes) {
+  void Update(const PerformanceResult& result) {
     std::lock_guard<std::mutex> lock(this->mutex);
-    this->total_records += total_records;
-    this->total_bytes += total_bytes;
+    this->total_records += result.num_records;
+    this->total_bytes += result.num_bytes;
+    this->latencies.insert(this->latencies.end(), result.latencies.begin(),
+                           result.latencies.end());
+  }
+};
+
+struct PerformanceReport {
+  int64_t num_records;
+  int64_t num_bytes;
+  int64_t elapsed_nanos;
+  // Percentiles of the record batch latencies, in microseconds
+  double p50_latency_us;
+  double p99_latency_us;
+
+  double gigabytes_per_second() const {
+    return static_cast<double>(num_bytes) / static_cast<double>(elapsed_nanos);
   }
 };
 
+// The latency at the given percentile, in microseconds, from sorted latencies
+double LatencyPercentile(const std::vector<int64_t>& sorted_nanos, double percentile) {
+  if (sorted_nanos.empty()) {
+    return 0;
+  }
+  const auto rank = static_cast<size_t>(
+      std::ceil(percentile / 100 * static_cast<double>(sorted_nanos.size())));
+  const size_t index = std::min(std::max<size_t>(rank, 1), sorted_nanos.size()) - 1;
+  return static_cast<double>(sorted_nanos[index]) / 1000;
+}
+
+// The number of bytes of the buffers of an array, including its children
+int64_t ArrayBytes(const ArrayData& data) {
+  int64_t num_bytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      num_bytes += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    num_bytes += ArrayBytes(*child);
+  }
+  return num_bytes;
+}
+
+int64_t BatchBytes(const RecordBatch& batch) {
+  int64_t num_bytes = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    num_bytes += ArrayBytes(*batch.column_data(i));
+  }
+  return num_bytes;
+}
+
+int64_t ElapsedNanos(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
 Status WaitForReady(FlightClient* client) {
   Action action{"ping", nullptr};
   for (int attempt = 0; attempt < 10; attempt++) {
@@ -87,29 +199,28 @@ Status WaitForReady(FlightClient* client) {
 
 arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
                                               const perf::Token& token,
-                                              const FlightEndpoint& endpoint) {
+                                              const FlightEndpoint& endpoint,
+                                              const std::shared_ptr<Schema>& schema) {
   std::unique_ptr<FlightStreamReader> reader;
   RETURN_NOT_OK(client->DoGet(endpoint.ticket, &reader));
 
   FlightStreamChunk batch;
 
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
-
   // This must also be set in perf_server.cc
   const bool verify = false;
 
-  int64_t num_bytes = 0;
-  int64_t num_records = 0;
+  PerformanceResult result{0, 0, {}};
   while (true) {
+    const auto start = std::chrono::steady_clock::now();
     RETURN_NOT_OK(reader->Next(&batch));
     if (!batch.data) {
       break;
     }
+    result.latencies.push_back(ElapsedNanos(start));
 
     if (verify) {
       auto values = batch.data->column_data(0)->GetValues<int64_t>(1);
-      const int64_t start = token.start() + num_records;
+      const int64_t start = token.start() + result.num_records;
       for (int64_t i = 0; i < batch.data->num_rows(); ++i) {
         if (values[i] != start + i) {
           return Status::Invalid("verification failure");
@@ -117,76 +228,150 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
       }
     }
 
-    num_records += batch.data->num_rows();
-
-    // Hard-coded
-    num_bytes += batch.data->num_rows() * bytes_per_record;
+    result.num_records += batch.data->num_rows();
+    result.num_bytes += BatchBytes(*batch.data);
   }
-  return PerformanceResult{num_records, num_bytes};
+  return result;
 }
 
-arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
-                                              const perf::Token& token,
-                                              const FlightEndpoint& endpoint) {
-  std::unique_ptr<FlightStreamWriter> writer;
-  std::unique_ptr<FlightMetadataReader> reader;
-  std::shared_ptr<Schema> schema =
-      arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                     field("d", int64())});
-  RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, schema, &writer, &reader));
-
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
-
-  int64_t num_bytes = 0;
-  int64_t num_records = 0;
-
+// Make the batch of random data uploaded by the DoPut and DoExchange tests
+Status MakeUploadBatch(const perf::Token& token, const std::shared_ptr<Schema>& schema,
+                       std::shared_ptr<RecordBatch>* out) {
   std::shared_ptr<ResizableBuffer> buffer;
   std::vector<std::shared_ptr<Array>> arrays;
 
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if (schema->field(i)->type()->id() == Type::STRING) {
+      random::RandomArrayGenerator rand(i /* seed */);
+      arrays.push_back(rand.String(length, 0, 32, /*null_probability=*/0));
+    } else {
+      RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
+                                         &buffer, static_cast<int32_t>(i) /* seed */));
+      arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+    }
     RETURN_NOT_OK(arrays.back()->Validate());
   }
 
-  std::shared_ptr<RecordBatch> batch = RecordBatch::Make(schema, length, arrays);
-
-  int records_sent = 0;
-  const int total_records = token.definition().records_per_stream();
-  while (records_sent < total_records) {
-    if (records_sent + length > total_records) {
-      const int last_length = total_records - records_sent;
-      RETURN_NOT_OK(writer->WriteRecordBatch(*(batch->Slice(0, last_length))));
-      num_records += last_length;
-      // Hard-coded
-      num_bytes += last_length * bytes_per_record;
-      records_sent += last_length;
+  *out = RecordBatch::Make(schema, length, arrays);
+  return Status::OK();
+}
+
+// Upload a stream of record batches, calling write_batch for each of them
+template <typename WriteBatch>
+arrow::Result<PerformanceResult> UploadBatches(const perf::Token& token,
+                                               const std::shared_ptr<Schema>& schema,
+                                               WriteBatch&& write_batch) {
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(MakeUploadBatch(token, schema, &batch));
+  const int32_t length = token.definition().records_per_batch();
+  const int64_t batch_bytes = BatchBytes(*batch);
+
+  PerformanceResult result{0, 0, {}};
+  const int64_t total_records = token.definition().records_per_stream();
+  int64_t index = 0;
+  while (result.num_records < total_records) {
+    const int64_t batch_length =
+        std::min<int64_t>(length, total_records - result.num_records);
+    const auto start = std::chrono::steady_clock::now();
+    if (batch_length < length) {
+      RETURN_NOT_OK(write_batch(*(batch->Slice(0, batch_length)), index));
     } else {
-      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
-      num_records += length;
-      // Hard-coded
-      num_bytes += length * bytes_per_record;
-      records_sent += length;
+      RETURN_NOT_OK(write_batch(*batch, index));
     }
+    result.latencies.push_back(ElapsedNanos(start));
+    result.num_records += batch_length;
+    result.num_bytes += batch_bytes * batch_length / length;
+    ++index;
   }
+  return result;
+}
+
+arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
+                                              const perf::Token& token,
+                                              const FlightEndpoint& endpoint,
+                                              const std::shared_ptr<Schema>& schema) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, schema, &writer, &reader));
 
+  ARROW_ASSIGN_OR_RAISE(
+      auto result,
+      UploadBatches(token, schema, [&](const RecordBatch& batch, int64_t index) {
+        return writer->WriteRecordBatch(batch);
+      }));
   RETURN_NOT_OK(writer->Close());
-  return PerformanceResult{num_records, num_bytes};
+  return result;
 }
 
-Status RunPerformanceTest(FlightClient* client, bool test_put) {
+// Send each batch to the server, which echoes it back on the same stream,
+// and wait for the echo before sending the next one
+arrow::Result<PerformanceResult> RunDoExchangeTest(
+    FlightClient* client, const perf::Token& token, const FlightEndpoint& endpoint,
+    const std::shared_ptr<Schema>& schema) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  RETURN_NOT_OK(client->DoExchange(FlightDescriptor{}, schema, &writer, &reader));
+
+  FlightStreamChunk echo;
+  ARROW_ASSIGN_OR_RAISE(
+      auto result,
+      UploadBatches(token, schema, [&](const RecordBatch& batch, int64_t index) {
+        RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+        RETURN_NOT_OK(reader->Next(&echo));
+        if (!echo.data || echo.data->num_rows() != batch.num_rows()) {
+          return Status::Invalid("Server did not echo the record batch");
+        }
+        return Status::OK();
+      }));
+  // Count both directions
+  result.num_bytes *= 2;
+
+  RETURN_NOT_OK(writer->DoneWriting());
+  RETURN_NOT_OK(reader->Next(&echo));
+  if (echo.data) {
+    return Status::Invalid("Server sent more record batches than it received");
+  }
+  RETURN_NOT_OK(writer->Close());
+  return result;
+}
+
+// Send each batch with metadata, which the server echoes back, and wait for
+// the echo before sending the next one
+arrow::Result<PerformanceResult> RunMetadataTest(FlightClient* client,
+                                                 const perf::Token& token,
+                                                 const FlightEndpoint& endpoint,
+                                                 const std::shared_ptr<Schema>& schema) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, schema, &writer, &reader));
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto result,
+      UploadBatches(token, schema, [&](const RecordBatch& batch, int64_t index) {
+        const std::string metadata = std::to_string(index);
+        RETURN_NOT_OK(writer->WriteWithMetadata(batch, Buffer::FromString(metadata)));
+        std::shared_ptr<Buffer> echo;
+        RETURN_NOT_OK(reader->ReadMetadata(&echo));
+        if (!echo || echo->ToString() != metadata) {
+          return Status::Invalid("Server did not echo the metadata");
+        }
+        return Status::OK();
+      }));
+  RETURN_NOT_OK(writer->Close());
+  return result;
+}
+
+Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& client_options,
+                          const PerformanceConfig& config, PerformanceReport* report) {
   // TODO(wesm): Multiple servers
   // std::vector<std::unique_ptr<TestServer>> servers;
 
-  // schema not needed
   perf::Perf perf;
-  perf.set_stream_count(FLAGS_num_streams);
+  perf.set_stream_count(config.num_streams);
   perf.set_records_per_stream(FLAGS_records_per_stream);
-  perf.set_records_per_batch(FLAGS_records_per_batch);
+  perf.set_records_per_batch(config.records_per_batch);
+  perf.set_data_type(config.data_type);
 
   // Plan the query
   FlightDescriptor descriptor;
@@ -202,19 +387,33 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   RETURN_NOT_OK(plan->GetSchema(&dict_memo, &schema));
 
   PerformanceStats stats;
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
-  auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
+  decltype(&RunDoGetTest) test_loop = nullptr;
+  switch (config.method) {
+    case TestMethod::DO_GET:
+      test_loop = &RunDoGetTest;
+      break;
+    case TestMethod::DO_PUT:
+      test_loop = &RunDoPutTest;
+      break;
+    case TestMethod::DO_EXCHANGE:
+      test_loop = &RunDoExchangeTest;
+      break;
+    case TestMethod::METADATA:
+      test_loop = &RunMetadataTest;
+      break;
+  }
+  auto ConsumeStream = [&](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
     std::unique_ptr<FlightClient> client;
-    RETURN_NOT_OK(FlightClient::Connect(endpoint.locations.front(), &client));
+    RETURN_NOT_OK(
+        FlightClient::Connect(endpoint.locations.front(), client_options, &client));
 
     perf::Token token;
     token.ParseFromString(endpoint.ticket.ticket);
 
-    const auto& result = test_loop(client.get(), token, endpoint);
+    const auto& result = test_loop(client.get(), token, endpoint, schema);
     if (result.ok()) {
-      const PerformanceResult& perf = result.ValueOrDie();
-      stats.Update(perf.num_records, perf.num_bytes);
+      stats.Update(result.ValueOrDie());
     }
     return result.status();
   };
@@ -239,70 +438,190 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
     RETURN_NOT_OK(task.status());
   }
 
-  // Elapsed time in seconds
-  uint64_t elapsed_nanos = timer.Stop();
-  double time_elapsed =
-      static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
-
-  constexpr double kMegabyte = static_cast<double>(1 << 20);
+  const uint64_t elapsed_nanos = timer.Stop();
 
   // Check that number of rows read / written is as expected
   if (stats.total_records != static_cast<int64_t>(plan->total_records())) {
     return Status::Invalid("Did not consume expected number of records");
   }
 
-  if (FLAGS_test_put) {
-    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
-  } else {
-    std::cout << "Bytes read: " << stats.total_bytes << std::endl;
+  std::sort(stats.latencies.begin(), stats.latencies.end());
+  report->num_records = stats.total_records;
+  report->num_bytes = stats.total_bytes;
+  report->elapsed_nanos = static_cast<int64_t>(std::max<uint64_t>(elapsed_nanos, 1));
+  report->p50_latency_us = LatencyPercentile(stats.latencies, 50);
+  report->p99_latency_us = LatencyPercentile(stats.latencies, 99);
+  return Status::OK();
+}
+
+void PrintReport(const PerformanceConfig& config, const PerformanceReport& report) {
+  switch (config.method) {
+    case TestMethod::DO_EXCHANGE:
+      std::cout << "Bytes exchanged: ";
+      break;
+    case TestMethod::DO_PUT:
+    case TestMethod::METADATA:
+      std::cout << "Bytes written: ";
+      break;
+    default:
+      std::cout << "Bytes read: ";
+      break;
   }
+  std::cout << report.num_bytes << std::endl;
 
-  std::cout << "Nanos: " << elapsed_nanos << std::endl;
+  // Elapsed time in seconds
+  const double time_elapsed = static_cast<double>(report.elapsed_nanos) / 1e9;
+  constexpr double kMegabyte = static_cast<double>(1 << 20);
+  std::cout << "Nanos: " << report.elapsed_nanos << std::endl;
   std::cout << "Speed: "
-            << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
-            << " MB/s" << std::endl;
+            << (static_cast<double>(report.num_bytes) / kMegabyte / time_elapsed)
+            << " MB/s (" << report.gigabytes_per_second() << " GB/s)" << std::endl;
+  std::cout << "Batch latency: p50 " << report.p50_latency_us << " us, p99 "
+            << report.p99_latency_us << " us" << std::endl;
+}
+
+// Run every configuration of the matrix against a server, printing a row of
+// the table for each
+Status RunPerformanceMatrix(FlightClient* client,
+                            const FlightClientOptions& client_options, bool tls) {
+  for (auto method : {TestMethod::DO_GET, TestMethod::DO_PUT, TestMethod::DO_EXCHANGE,
+                      TestMethod::METADATA}) {
+    for (const std::string data_type : {"int64", "string"}) {
+      for (int32_t records_per_batch :
+           {FLAGS_small_records_per_batch, FLAGS_records_per_batch}) {
+        for (int32_t num_streams : {1, FLAGS_num_streams}) {
+          PerformanceConfig config{method, data_type, records_per_batch, num_streams};
+          PerformanceReport report;
+          RETURN_NOT_OK(RunPerformanceTest(client, client_options, config, &report));
+          std::cout << std::left << std::setw(12) << TestMethodName(method)
+                    << std::setw(8) << data_type << std::right << std::setw(10)
+                    << records_per_batch << std::setw(9) << num_streams
+                    << std::setw(6) << (tls ? "yes" : "no") << std::fixed
+                    << std::setprecision(3) << std::setw(10)
+                    << report.gigabytes_per_second() << std::setprecision(1)
+                    << std::setw(12) << report.p50_latency_us << std::setw(12)
+                    << report.p99_latency_us << std::defaultfloat << std::endl;
+        }
+      }
+    }
+  }
   return Status::OK();
 }
 
+void PrintMatrixHeader() {
+  std::cout << std::left << std::setw(12) << "method" << std::setw(8) << "data"
+            << std::right << std::setw(10) << "rows/batch" << std::setw(9) << "streams"
+            << std::setw(6) << "tls" << std::setw(10) << "GB/s" << std::setw(12)
+            << "p50 (us)" << std::setw(12) << "p99 (us)" << std::endl;
+}
+
+// Connect to the performance server, over TLS or not
+Status ConnectPerfClient(const std::string& hostname, int port, bool tls,
+                         FlightClientOptions* options,
+                         std::unique_ptr<FlightClient>* client) {
+  Location location;
+  *options = FlightClientOptions();
+  if (tls) {
+    CertKeyPair root_cert;
+    RETURN_NOT_OK(ExampleTlsCertificateRoot(&root_cert));
+    options->tls_root_certs = root_cert.pem_cert;
+    RETURN_NOT_OK(Location::ForGrpcTls(hostname, port, &location));
+  } else if (FLAGS_server_unix == "") {
+    RETURN_NOT_OK(Location::ForGrpcTcp(hostname, port, &location));
+  } else if (FLAGS_shared_memory) {
+    RETURN_NOT_OK(Location::ForGrpcShm(FLAGS_server_unix, &location));
+  } else {
+    RETURN_NOT_OK(Location::ForGrpcUnix(FLAGS_server_unix, &location));
+  }
+  RETURN_NOT_OK(FlightClient::Connect(location, *options, client));
+  return WaitForReady(client->get());
+}
+
 }  // namespace flight
 }  // namespace arrow
 
 int main(int argc, char** argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
 
-  std::unique_ptr<arrow::flight::TestServer> server;
+  // The matrix is run over TLS against a second server
+  const bool matrix_tls = FLAGS_matrix && FLAGS_tls;
+  const int tls_port = matrix_tls ? FLAGS_server_port + 1 : FLAGS_server_port;
+
+  std::vector<std::unique_ptr<arrow::flight::TestServer>> servers;
   std::string hostname = "localhost";
-  if (FLAGS_server_host == "") {
+  if (FLAGS_server_host == "" && FLAGS_server_unix == "") {
     std::cout << "Using standalone server: false" << std::endl;
-    server.reset(
-        new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
-    server->Start();
+    if (!FLAGS_tls || matrix_tls) {
+      servers.emplace_back(
+          new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
+    }
+    if (FLAGS_tls) {
+      servers.emplace_back(new arrow::flight::TestServer("arrow-flight-perf-server",
+                                                         tls_port, {"-tls"}));
+    }
+    for (const auto& server : servers) {
+      server->Start();
+    }
   } else {
     std::cout << "Using standalone server: true" << std::endl;
     hostname = FLAGS_server_host;
   }
 
-  std::cout << "Testing method: ";
-  if (FLAGS_test_put) {
-    std::cout << "DoPut";
+  std::unique_ptr<arrow::flight::FlightClient> client;
+  arrow::flight::FlightClientOptions client_options;
+  if (FLAGS_server_unix == "" || FLAGS_tls) {
+    std::cout << "Server host: " << hostname << std::endl
+              << "Server port: " << FLAGS_server_port << std::endl
+              << "TLS: " << std::boolalpha << FLAGS_tls << std::endl;
   } else {
-    std::cout << "DoGet";
+    std::cout << "Server socket: " << FLAGS_server_unix << std::endl
+              << "Shared memory: " << std::boolalpha << FLAGS_shared_memory
+              << std::endl;
   }
-  std::cout << std::endl;
 
-  std::cout << "Server host: " << hostname << std::endl
-            << "Server port: " << FLAGS_server_port << std::endl;
-
-  std::unique_ptr<arrow::flight::FlightClient> client;
-  arrow::flight::Location location;
-  ABORT_NOT_OK(
-      arrow::flight::Location::ForGrpcTcp(hostname, FLAGS_server_port, &location));
-  ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, &client));
-  ABORT_NOT_OK(arrow::flight::WaitForReady(client.get()));
-
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), FLAGS_test_put);
+  arrow::Status s;
+  if (FLAGS_matrix) {
+    arrow::flight::PrintMatrixHeader();
+    s = arrow::flight::ConnectPerfClient(hostname, FLAGS_server_port, false,
+                                         &client_options, &client);
+    if (s.ok()) {
+      s = arrow::flight::RunPerformanceMatrix(client.get(), client_options, false);
+    }
+    if (s.ok() && FLAGS_tls) {
+      s = arrow::flight::ConnectPerfClient(hostname, tls_port, true, &client_options,
+                                           &client);
+    }
+    if (s.ok() && FLAGS_tls) {
+      s = arrow::flight::RunPerformanceMatrix(client.get(), client_options, true);
+    }
+  } else {
+    arrow::flight::PerformanceConfig config{arrow::flight::TestMethod::DO_GET,
+                                            FLAGS_data_type, FLAGS_records_per_batch,
+                                            FLAGS_num_streams};
+    if (FLAGS_test_metadata) {
+      config.method = arrow::flight::TestMethod::METADATA;
+    } else if (FLAGS_test_exchange) {
+      config.method = arrow::flight::TestMethod::DO_EXCHANGE;
+    } else if (FLAGS_test_put) {
+      config.method = arrow::flight::TestMethod::DO_PUT;
+    }
+    std::cout << "Testing method: " << arrow::flight::TestMethodName(config.method)
+              << std::endl
+              << "Data type: " << config.data_type << std::endl;
+
+    arrow::flight::PerformanceReport report;
+    s = arrow::flight::ConnectPerfClient(hostname, FLAGS_server_port, FLAGS_tls,
+                                         &client_options, &client);
+    if (s.ok()) {
+      s = arrow::flight::RunPerformanceTest(client.get(), client_options, config,
+                                            &report);
+    }
+    if (s.ok()) {
+      arrow::flight::PrintReport(config, report);
+    }
+  }
 
-  if (server) {
+  for (const auto& server : servers) {
     server->Stop();
   }
 
@@ -18,6 +18,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -35,6 +42,8 @@
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/make_unique.h"
 
 #ifdef GRPCPP_GRPCPP_H
@@ -43,6 +52,8 @@
 
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware_internal.h"
+#include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/test_util.h"
 
 namespace pb = arrow::flight::protocol;
@@ -304,6 +315,156 @@ TEST(TestFlight, BuilderHook) {
   ASSERT_OK(server->Shutdown());
 }
 
+// A reader failing after a number of batches
+class FailingBatchReader : public RecordBatchReader {
+ public:
+  FailingBatchReader(const BatchVector& batches, size_t num_good)
+      : batches_(batches), num_good_(num_good) {}
+
+  std::shared_ptr<Schema> schema() const override { return batches_[0]->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (position_ >= num_good_) {
+      return Status::IOError("Expected read failure");
+    }
+    *out = batches_[position_++];
+    return Status::OK();
+  }
+
+ private:
+  BatchVector batches_;
+  size_t num_good_;
+  size_t position_ = 0;
+};
+
+TEST(TestFlight, PrefetchingFlightDataStream) {
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  auto schema = batches[0]->schema();
+
+  for (int queue_depth : {1, 2, 8}) {
+    SCOPED_TRACE("queue_depth = " + std::to_string(queue_depth));
+    RecordBatchStream expected(std::make_shared<BatchIterator>(schema, batches));
+    PrefetchingFlightDataStream stream(
+        std::unique_ptr<FlightDataStream>(
+            new RecordBatchStream(std::make_shared<BatchIterator>(schema, batches))),
+        queue_depth);
+    AssertSchemaEqual(*schema, *stream.schema());
+
+    FlightPayload expected_payload, payload;
+    ASSERT_OK(expected.GetSchemaPayload(&expected_payload));
+    ASSERT_OK(stream.GetSchemaPayload(&payload));
+    AssertBufferEqual(*expected_payload.ipc_message.metadata,
+                      *payload.ipc_message.metadata);
+
+    // Dictionary and record batch payloads, in the same order
+    while (true) {
+      ASSERT_OK(expected.Next(&expected_payload));
+      ASSERT_OK(stream.Next(&payload));
+      if (expected_payload.ipc_message.metadata == nullptr) {
+        ASSERT_EQ(nullptr, payload.ipc_message.metadata);
+        break;
+      }
+      ASSERT_NE(nullptr, payload.ipc_message.metadata);
+      ASSERT_EQ(expected_payload.ipc_message.type, payload.ipc_message.type);
+      AssertBufferEqual(*expected_payload.ipc_message.metadata,
+                        *payload.ipc_message.metadata);
+      ASSERT_EQ(expected_payload.ipc_message.body_length,
+                payload.ipc_message.body_length);
+    }
+    // The end of the stream is sticky
+    ASSERT_OK(stream.Next(&payload));
+    ASSERT_EQ(nullptr, payload.ipc_message.metadata);
+  }
+}
+
+TEST(TestFlight, PrefetchingFlightDataStreamError) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  PrefetchingFlightDataStream stream(std::unique_ptr<FlightDataStream>(
+      new RecordBatchStream(std::make_shared<FailingBatchReader>(batches, 2))));
+  FlightPayload payload;
+  ASSERT_OK(stream.GetSchemaPayload(&payload));
+  // The payloads before the error are returned first
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK(stream.Next(&payload));
+    ASSERT_NE(nullptr, payload.ipc_message.metadata);
+  }
+  ASSERT_RAISES(IOError, stream.Next(&payload));
+
+  // Destroying a stream with outstanding payloads
+  PrefetchingFlightDataStream abandoned(std::unique_ptr<FlightDataStream>(
+      new RecordBatchStream(std::make_shared<BatchIterator>(batches[0]->schema(),
+                                                            batches))));
+  ASSERT_OK(abandoned.Next(&payload));
+}
+
+TEST(TestFlight, ScatteredBuffer) {
+  std::vector<std::shared_ptr<Buffer>> segments = {
+      Buffer::FromString("abc"), Buffer::FromString("defgh"), Buffer::FromString("ij")};
+  internal::ScatteredBuffer buffer(segments);
+  ASSERT_EQ(10, buffer.size());
+  ASSERT_FALSE(buffer.is_cpu());
+
+  // Reads within a segment are zero-copy
+  ASSERT_OK_AND_ASSIGN(auto slice, buffer.ReadAt(4, 3));
+  ASSERT_EQ(segments[1]->data() + 1, slice->data());
+  ASSERT_EQ("efg", slice->ToString());
+  // Reads straddling segments are copied to an aligned buffer
+  ASSERT_OK_AND_ASSIGN(slice, buffer.ReadAt(2, 7));
+  ASSERT_EQ("cdefghi", slice->ToString());
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(slice->data()) % 64);
+
+  // Views straddling segments are scattered
+  auto view = buffer.View(2, 7);
+  ASSERT_FALSE(view->is_cpu());
+  ASSERT_EQ(7, view->size());
+  ASSERT_OK_AND_ASSIGN(auto reader, Buffer::GetReader(view));
+  ASSERT_OK_AND_ASSIGN(slice, reader->ReadAt(1, 4));
+  ASSERT_EQ(segments[1]->data(), slice->data());
+  ASSERT_OK_AND_ASSIGN(slice, reader->Read(100));
+  ASSERT_EQ("cdefghi", slice->ToString());
+  ASSERT_OK_AND_ASSIGN(auto copy, Buffer::ViewOrCopy(view, default_cpu_memory_manager()));
+  ASSERT_TRUE(copy->is_cpu());
+  ASSERT_EQ("cdefghi", copy->ToString());
+}
+
+TEST(TestFlight, DeserializeScatteredBody) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  const auto& batch = batches[0];
+
+  // The serialized message references each body buffer in a slice of its own
+  FlightPayload payload;
+  ASSERT_OK(ipc::internal::GetRecordBatchPayload(*batch, ipc::IpcWriteOptions::Defaults(),
+                                                 &payload.ipc_message));
+  grpc::ByteBuffer serialized;
+  bool own_buffer;
+  ASSERT_TRUE(internal::FlightDataSerialize(payload, &serialized, &own_buffer).ok());
+
+  internal::FlightData data;
+  ASSERT_TRUE(internal::FlightDataDeserialize(&serialized, &data).ok());
+  ASSERT_FALSE(data.body->is_cpu());
+
+  std::unique_ptr<ipc::Message> message;
+  ASSERT_OK(data.OpenMessage(&message));
+  ASSERT_OK_AND_ASSIGN(auto result,
+                       ipc::ReadRecordBatch(*message, batch->schema(), nullptr,
+                                            ipc::IpcReadOptions::Defaults()));
+  AssertBatchesEqual(*batch, *result);
+  // Buffers were read without copying
+  ASSERT_EQ(batch->column_data(0)->buffers[1]->data(),
+            result->column_data(0)->buffers[1]->data());
+
+  ASSERT_OK(data.CoalesceBody());
+  ASSERT_TRUE(data.body->is_cpu());
+  ASSERT_OK(data.OpenMessage(&message));
+  ASSERT_OK_AND_ASSIGN(result, ipc::ReadRecordBatch(*message, batch->schema(), nullptr,
+                                                    ipc::IpcReadOptions::Defaults()));
+  AssertBatchesEqual(*batch, *result);
+}
+
 // ----------------------------------------------------------------------
 // Client tests
 
@@ -552,6 +713,139 @@ class TestDoPut : public ::testing::Test {
   DoPutTestServer* do_put_server_;
 };
 
+class DoExchangeTestServer : public FlightServerBase {
+ public:
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    const std::string& command = reader->descriptor().cmd;
+    if (command == "echo") {
+      // Send back each batch with its metadata as soon as it is received
+      RETURN_NOT_OK(writer->Begin(reader->schema()));
+      FlightStreamChunk chunk;
+      while (true) {
+        RETURN_NOT_OK(reader->Next(&chunk));
+        if (chunk.data == nullptr) break;
+        RETURN_NOT_OK(writer->WriteWithMetadata(*chunk.data, chunk.app_metadata));
+      }
+      return Status::OK();
+    } else if (command == "get") {
+      // Ignore the client's data, which is only a schema
+      BatchVector batches;
+      RETURN_NOT_OK(reader->ReadAll(&batches));
+      if (!batches.empty()) {
+        return Status::Invalid("Expected no record batches from the client");
+      }
+      RETURN_NOT_OK(ExampleIntBatches(&batches));
+      RETURN_NOT_OK(writer->Begin(batches[0]->schema()));
+      for (const auto& batch : batches) {
+        RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+      }
+      return Status::OK();
+    } else if (command == "error") {
+      return Status::NotImplemented("Expected error");
+    }
+    return Status::Invalid("Unknown command: ", command);
+  }
+};
+
+class TestDoExchange : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<DoExchangeTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+// Serves and receives data through all data-carrying RPCs
+class SharedMemoryTestServer : public DoExchangeTestServer {
+ public:
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    BatchVector batches;
+    if (request.ticket == "ints") {
+      RETURN_NOT_OK(ExampleIntBatches(&batches));
+    } else if (request.ticket == "dicts") {
+      RETURN_NOT_OK(ExampleDictBatches(&batches));
+    } else {
+      return Status::NotImplemented("no stream implemented for this ticket");
+    }
+    auto batch_reader = std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+    *data_stream = std::unique_ptr<FlightDataStream>(new RecordBatchStream(batch_reader));
+    return Status::OK();
+  }
+
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override {
+    return reader->ReadAll(&batches_);
+  }
+
+  const BatchVector& batches() const { return batches_; }
+
+ private:
+  BatchVector batches_;
+};
+
+class TestSharedMemory : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK_AND_ASSIGN(temp_dir_,
+                         arrow::internal::TemporaryDir::Make("flight-shm-test-"));
+    socket_path_ = temp_dir_->path().ToString() + "server.sock";
+
+    Location location;
+    ASSERT_OK(Location::ForGrpcShm(socket_path_, &location));
+    server_.reset(new SharedMemoryTestServer);
+    ASSERT_OK(server_->Init(FlightServerOptions(location)));
+    ASSERT_OK(FlightClient::Connect(location, &client_));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  void CheckDoGet(const std::string& ticket, const BatchVector& expected_batches) {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(Ticket{ticket}, &stream));
+    BatchVector received;
+    ASSERT_OK(stream->ReadAll(&received));
+    ASSERT_EQ(expected_batches.size(), received.size());
+    for (size_t i = 0; i < expected_batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *received[i]);
+    }
+  }
+
+  void CheckEcho(const BatchVector& batches) {
+    auto descr = FlightDescriptor::Command("echo");
+    std::unique_ptr<FlightStreamWriter> writer;
+    std::unique_ptr<FlightStreamReader> reader;
+    ASSERT_OK(client_->DoExchange(descr, batches[0]->schema(), &writer, &reader));
+    FlightStreamChunk chunk;
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+      ASSERT_OK(reader->Next(&chunk));
+      ASSERT_NE(nullptr, chunk.data);
+      ASSERT_BATCHES_EQUAL(*batch, *chunk.data);
+    }
+    ASSERT_OK(writer->DoneWriting());
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_EQ(nullptr, chunk.data);
+    ASSERT_OK(writer->Close());
+  }
+
+ protected:
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir_;
+  std::string socket_path_;
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<SharedMemoryTestServer> server_;
+};
+
 class TestTls : public ::testing::Test {
  public:
   void SetUp() {
@@ -985,6 +1279,143 @@ TEST_F(TestFlightClient, DoGetDicts) {
   CheckDoGet(descr, expected_batches, check_endpoints);
 }
 
+TEST_F(TestFlightClient, DoGetCompressed) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    FlightCallOptions options;
+    options.body_compression = codec;
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(options, Ticket{"ticket-ints-1"}, &stream));
+    BatchVector received;
+    ASSERT_OK(stream->ReadAll(&received));
+    ASSERT_EQ(expected_batches.size(), received.size());
+    for (size_t i = 0; i < expected_batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *received[i]);
+    }
+  }
+
+  // Only the codecs of IPC body compression are supported
+  FlightCallOptions options;
+  options.body_compression = Compression::GZIP;
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_RAISES(Invalid, client_->DoGet(options, Ticket{"ticket-ints-1"}, &stream));
+}
+
+TEST_F(TestFlightClient, DoGetEndpoints) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  Location server_location, unreachable_location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &server_location));
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 1, &unreachable_location));
+  const Ticket ticket{"ticket-ints-1"};
+  // This service, the server by its location, and a failover to the server
+  std::vector<FlightEndpoint> endpoints = {
+      {ticket, {}},
+      {ticket, {server_location}},
+      {ticket, {unreachable_location, server_location}}};
+  FlightInfo::Data data;
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(), FlightDescriptor::Path({"examples"}),
+                           endpoints, -1, -1, &data));
+  FlightInfo info(data);
+
+  for (bool ordered : {false, true}) {
+    FlightEndpointReadOptions read_options;
+    read_options.ordered = ordered;
+    read_options.max_concurrency = 2;
+    read_options.max_buffered_batches = 2;
+    std::unique_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->DoGet({}, info, read_options, &reader));
+    AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+
+    BatchVector batches;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      batches.push_back(batch);
+    }
+    ASSERT_EQ(endpoints.size() * expected_batches.size(), batches.size());
+    if (ordered) {
+      for (size_t i = 0; i < batches.size(); ++i) {
+        ASSERT_BATCHES_EQUAL(*expected_batches[i % expected_batches.size()],
+                             *batches[i]);
+      }
+    }
+  }
+
+  // The error of an endpoint fails the stream
+  endpoints.push_back({Ticket{"ticket-unknown"}, {}});
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(), FlightDescriptor::Path({"examples"}),
+                           endpoints, -1, -1, &data));
+  std::unique_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->DoGet({}, FlightInfo(data), {}, &reader));
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(NotImplemented, reader->ReadAll(&table));
+
+  // The reader may be dropped before the end of the stream
+  ASSERT_OK(client_->DoGet({}, info, {}, &reader));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  reader.reset();
+}
+
+TEST_F(TestFlightClient, ChannelPool) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  FlightClientOptions options;
+  options.channel_pool = FlightChannelPool::Make();
+  options.keepalive_time_ms = 10000;
+  options.compression = "gzip";
+
+  // Clients of the same location and options share a channel
+  std::unique_ptr<FlightClient> client1, client2, client3;
+  ASSERT_OK(FlightClient::Connect(location, options, &client1));
+  ASSERT_OK(FlightClient::Connect(location, options, &client2));
+  ASSERT_EQ(1, options.channel_pool->num_channels());
+  options.generic_int_options["grpc.http2.lookahead_bytes"] = 1 << 20;
+  ASSERT_OK(FlightClient::Connect(location, options, &client3));
+  ASSERT_EQ(2, options.channel_pool->num_channels());
+
+  std::vector<ActionType> actions;
+  ASSERT_OK(client1->ListActions(&actions));
+  client1.reset();
+  ASSERT_OK(client2->ListActions(&actions));
+  ASSERT_OK(client3->ListActions(&actions));
+
+  // Clients keep their channel when the pool is cleared
+  options.channel_pool->Clear();
+  ASSERT_EQ(0, options.channel_pool->num_channels());
+  ASSERT_OK(client2->ListActions(&actions));
+
+  options.compression = "lz4";
+  ASSERT_RAISES(Invalid, FlightClient::Connect(location, options, &client1));
+}
+
+TEST_F(TestFlightClient, MaxReceiveMessageSize) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  FlightClientOptions options;
+  options.max_receive_message_size = 16;
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, options, &client));
+
+  std::unique_ptr<FlightStreamReader> stream;
+  std::shared_ptr<Table> table;
+  Status st = client->DoGet(Ticket{"ticket-ints-1"}, &stream);
+  if (st.ok()) {
+    st = stream->ReadAll(&table);
+  }
+  ASSERT_RAISES(Invalid, st);
+}
+
 TEST_F(TestFlightClient, ListActions) {
   std::vector<ActionType> actions;
   ASSERT_OK(client_->ListActions(&actions));
@@ -1104,6 +1535,36 @@ TEST_F(TestDoPut, DoPutEmptyBatch) {
   CheckDoPut(descr, schema, batches);
 }
 
+TEST_F(TestDoPut, DoPutCoalescing) {
+  auto descr = FlightDescriptor::Path({"ints"});
+  auto a1 = ArrayFromJSON(int32(), "[4, 5, 6, null]");
+  auto schema = arrow::schema({field("f1", a1->type())});
+  auto batch = RecordBatch::Make(schema, a1->length(), {a1});
+  BatchVector batches(10, batch);
+
+  std::unique_ptr<FlightStreamWriter> stream;
+  std::unique_ptr<FlightMetadataReader> reader;
+  ASSERT_OK(client_->DoPut(descr, schema, &stream, &reader));
+  // Merge about 4 batches per message
+  CoalescingFlightStreamWriter writer(std::move(stream), 64);
+  for (size_t i = 0; i < batches.size(); ++i) {
+    if (i == 6) {
+      // Batches with metadata are written as is
+      ASSERT_OK(writer.WriteWithMetadata(*batches[i], Buffer::FromString("meta")));
+    } else {
+      ASSERT_OK(writer.WriteRecordBatch(*batches[i]));
+    }
+  }
+  ASSERT_OK(writer.DoneWriting());
+  ASSERT_OK(writer.Close());
+
+  ASSERT_LT(do_put_server_->batches_.size(), batches.size());
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(Table::FromRecordBatches(batches, &expected));
+  ASSERT_OK(Table::FromRecordBatches(do_put_server_->batches_, &actual));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST_F(TestDoPut, DoPutDicts) {
   auto descr = FlightDescriptor::Path({"dicts"});
   BatchVector batches;
@@ -1120,6 +1581,247 @@ TEST_F(TestDoPut, DoPutDicts) {
   CheckDoPut(descr, schema, batches);
 }
 
+TEST_F(TestDoExchange, Echo) {
+  auto descr = FlightDescriptor::Command("echo");
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(descr, batches[0]->schema(), &writer, &reader));
+
+  // Interleave writes and reads on the stream
+  FlightStreamChunk chunk;
+  for (size_t i = 0; i < batches.size(); ++i) {
+    const auto metadata = Buffer::FromString(std::to_string(i));
+    ASSERT_OK(writer->WriteWithMetadata(*batches[i], metadata));
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*batches[i], *chunk.data);
+    ASSERT_NE(nullptr, chunk.app_metadata);
+    ASSERT_EQ(std::to_string(i), chunk.app_metadata->ToString());
+  }
+  AssertSchemaEqual(*batches[0]->schema(), *reader->schema());
+  ASSERT_OK(writer->DoneWriting());
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, EchoCompressed) {
+  auto descr = FlightDescriptor::Command("echo");
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    FlightCallOptions options;
+    options.body_compression = codec;
+    std::unique_ptr<FlightStreamWriter> writer;
+    std::unique_ptr<FlightStreamReader> reader;
+    ASSERT_OK(
+        client_->DoExchange(options, descr, batches[0]->schema(), &writer, &reader));
+    FlightStreamChunk chunk;
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+      ASSERT_OK(reader->Next(&chunk));
+      ASSERT_NE(nullptr, chunk.data);
+      ASSERT_BATCHES_EQUAL(*batch, *chunk.data);
+    }
+    ASSERT_OK(writer->DoneWriting());
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_EQ(nullptr, chunk.data);
+    ASSERT_OK(writer->Close());
+  }
+}
+
+TEST_F(TestDoExchange, EchoDicts) {
+  auto descr = FlightDescriptor::Command("echo");
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(descr, batches[0]->schema(), &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->DoneWriting());
+
+  BatchVector received;
+  ASSERT_OK(reader->ReadAll(&received));
+  ASSERT_EQ(batches.size(), received.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*batches[i], *received[i]);
+  }
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, EchoNoBatches) {
+  // The schema is sent even though no batch was written
+  auto descr = FlightDescriptor::Command("echo");
+  auto schema = ExampleIntSchema();
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(descr, schema, &writer, &reader));
+  ASSERT_OK(writer->DoneWriting());
+
+  FlightStreamChunk chunk;
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  AssertSchemaEqual(*schema, *reader->schema());
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, ServerData) {
+  auto descr = FlightDescriptor::Command("get");
+  BatchVector expected;
+  ASSERT_OK(ExampleIntBatches(&expected));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(descr, ExampleIntSchema(), &writer, &reader));
+  ASSERT_OK(writer->DoneWriting());
+
+  BatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_EQ(expected.size(), batches.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected[i], *batches[i]);
+  }
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, Error) {
+  auto descr = FlightDescriptor::Command("error");
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(descr, ExampleIntSchema(), &writer, &reader));
+
+  FlightStreamChunk chunk;
+  Status status = reader->Next(&chunk);
+  ASSERT_RAISES(NotImplemented, status);
+  ASSERT_THAT(status.message(), ::testing::HasSubstr("Expected error"));
+  ASSERT_RAISES(NotImplemented, writer->Close());
+}
+
+#ifndef _WIN32
+TEST_F(TestSharedMemory, DoGetInts) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  CheckDoGet("ints", batches);
+}
+
+TEST_F(TestSharedMemory, DoGetDicts) {
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  CheckDoGet("dicts", batches);
+}
+
+TEST_F(TestSharedMemory, DoPut) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  ASSERT_OK(client_->DoPut(FlightDescriptor::Path({"ints"}), batches[0]->schema(),
+                           &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+
+  ASSERT_EQ(batches.size(), server_->batches().size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*batches[i], *server_->batches()[i]);
+  }
+}
+
+TEST_F(TestSharedMemory, DoExchangeEcho) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  CheckEcho(batches);
+}
+
+TEST_F(TestSharedMemory, DoExchangeEchoDicts) {
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  CheckEcho(batches);
+}
+
+// Build the payload of a record batch whose body goes through shared memory
+Status MakeSharedMemoryPayload(FlightPayload* payload) {
+  BatchVector batches;
+  RETURN_NOT_OK(ExampleIntBatches(&batches));
+  RETURN_NOT_OK(ipc::internal::GetRecordBatchPayload(
+      *batches[0], ipc::IpcWriteOptions::Defaults(), &payload->ipc_message));
+  return internal::MoveBodyToSharedMemory(payload);
+}
+
+std::shared_ptr<Buffer> ReferenceToSegment(const std::string& name) {
+  std::string reference("ARROWSHM");
+  const int64_t body_size = BitUtil::ToLittleEndian(static_cast<int64_t>(8));
+  reference.append(reinterpret_cast<const char*>(&body_size), sizeof(body_size));
+  reference += name;
+  return Buffer::FromString(reference);
+}
+
+TEST(SharedMemoryBody, RoundTrip) {
+  FlightPayload payload;
+  ASSERT_OK(MakeSharedMemoryPayload(&payload));
+  internal::FlightData data;
+  data.body = payload.ipc_message.body_buffers[0];
+  ASSERT_OK(internal::MapBodyFromSharedMemory(&data));
+  ASSERT_TRUE(data.body->is_cpu());
+
+  // The segment was unlinked by the receiver
+  data.body = payload.ipc_message.body_buffers[0];
+  ASSERT_RAISES(IOError, internal::MapBodyFromSharedMemory(&data));
+}
+
+TEST(SharedMemoryBody, Discard) {
+  FlightPayload payload;
+  ASSERT_OK(MakeSharedMemoryPayload(&payload));
+  internal::DiscardSharedMemoryBody(payload);
+  internal::FlightData data;
+  data.body = payload.ipc_message.body_buffers[0];
+  ASSERT_RAISES(IOError, internal::MapBodyFromSharedMemory(&data));
+}
+
+TEST(SharedMemoryBody, RejectForeignSegments) {
+  // A shared memory object not made by the sender must be left alone
+  const std::string name = "/arrow-flight-test-foreign-" + std::to_string(getpid());
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  ASSERT_NE(fd, -1);
+  ASSERT_EQ(0, ftruncate(fd, 8));
+  ASSERT_EQ(0, fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP));
+
+  internal::FlightData data;
+  for (const std::string& bad_name :
+       {std::string("/etc-passwd"), std::string("/arrow-flight-../x"),
+        std::string("/arrow-flight-"), name.substr(1)}) {
+    data.body = ReferenceToSegment(bad_name);
+    ASSERT_RAISES(Invalid, internal::MapBodyFromSharedMemory(&data));
+  }
+  // Valid name, but permissions the sender never gives
+  data.body = ReferenceToSegment(name);
+  ASSERT_RAISES(IOError, internal::MapBodyFromSharedMemory(&data));
+
+  // Still there
+  ASSERT_EQ(0, shm_unlink(name.c_str()));
+  ASSERT_EQ(0, close(fd));
+}
+
+TEST_F(TestSharedMemory, UnixClient) {
+  // A client not asking for shared memory gets the data inline
+  Location location;
+  ASSERT_OK(Location::ForGrpcUnix(socket_path_, &location));
+  ASSERT_OK(FlightClient::Connect(location, &client_));
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  CheckDoGet("ints", batches);
+  CheckEcho(batches);
+}
+#endif
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {},
@@ -1427,6 +2129,37 @@ TEST_F(TestMetadata, DoPutReadMetadata) {
   ASSERT_OK(writer->Close());
 }
 
+TEST_F(TestMetadata, DoPutMetadataListener) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  std::shared_ptr<Schema> schema = ExampleIntSchema();
+  ASSERT_OK(client_->DoPut(FlightDescriptor{}, schema, &writer, &reader));
+
+  // The acknowledgements are received in the background while writing
+  std::vector<std::string> acks;
+  FlightMetadataListener listener(std::move(reader),
+                                  [&acks](std::shared_ptr<Buffer> metadata) {
+                                    acks.push_back(metadata->ToString());
+                                    return Status::OK();
+                                  });
+
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  auto num_batches = static_cast<int>(expected_batches.size());
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_OK(writer->WriteWithMetadata(*expected_batches[i],
+                                        Buffer::FromString(std::to_string(i))));
+  }
+  ASSERT_OK(writer->DoneWriting());
+  ASSERT_OK(listener.Wait());
+  ASSERT_OK(writer->Close());
+
+  ASSERT_EQ(num_batches, static_cast<int>(acks.size()));
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_EQ(std::to_string(i), acks[i]);
+  }
+}
+
 TEST_F(TestRejectServerMiddleware, Rejected) {
   std::unique_ptr<FlightInfo> info;
   const auto& status = client_->GetFlightInfo(FlightDescriptor{}, &info);
@@ -1534,5 +2267,16 @@ TEST_F(TestPropagatingMiddleware, DoPut) {
   ValidateStatus(status, FlightMethod::DoPut);
 }
 
+TEST_F(TestPropagatingMiddleware, DoExchange) {
+  client_middleware_->Reset();
+  auto descr = FlightDescriptor::Command("exchange");
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(descr, ExampleIntSchema(), &writer, &reader));
+  const Status status = writer->Close();
+  ASSERT_RAISES(NotImplemented, status);
+  ValidateStatus(status, FlightMethod::DoExchange);
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -67,6 +67,16 @@ namespace internal {
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcAuthHeader;
 
+/// The name of the header used by clients to request that record batch
+/// bodies be exchanged through shared memory.
+ARROW_FLIGHT_EXPORT
+extern const char* kGrpcSharedMemoryHeader;
+
+/// The name of the header used by clients to request that record batch
+/// bodies be compressed, and by servers to accept it.
+ARROW_FLIGHT_EXPORT
+extern const char* kGrpcCompressionHeader;
+
 /// The name of the header used to pass the exact Arrow status code.
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcStatusCodeHeader;
@@ -40,6 +40,14 @@
 
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
+DEFINE_string(server_unix, "",
+              "Domain socket path to listen on instead of the port (leave blank to "
+              "use TCP)");
+DEFINE_bool(shared_memory, false,
+            "Exchange record batch bodies through shared memory with clients asking "
+            "for it (requires --server_unix)");
+DEFINE_bool(tls, false,
+            "Serve over TLS with the test certificates (requires ARROW_TEST_DATA)");
 
 namespace perf = arrow::flight::perf;
 namespace proto = arrow::flight::protocol;
@@ -119,19 +127,39 @@ class PerfDataStream : public FlightDataStream {
   ArrayVector arrays_;
 };
 
+// The schema of the record batches for a data type of perf.proto
+Status GetPerfSchema(const std::string& data_type, std::shared_ptr<Schema>* out) {
+  std::shared_ptr<DataType> type;
+  if (data_type.empty() || data_type == "int64") {
+    type = int64();
+  } else if (data_type == "string") {
+    type = utf8();
+  } else {
+    return Status::Invalid("Unknown perf data type: ", data_type);
+  }
+  *out = schema({field("a", type), field("b", type), field("c", type), field("d", type)});
+  return Status::OK();
+}
+
 Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& schema,
                       bool use_verifier, std::unique_ptr<FlightDataStream>* data_stream) {
   std::shared_ptr<ResizableBuffer> buffer;
   std::vector<std::shared_ptr<Array>> arrays;
 
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if (schema->field(i)->type()->id() == Type::STRING) {
+      random::RandomArrayGenerator rand(i /* seed */);
+      arrays.push_back(rand.String(length, 0, 32, /*null_probability=*/0));
+    } else {
+      RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
+                                         &buffer, static_cast<int32_t>(i) /* seed */));
+      arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+    }
     RETURN_NOT_OK(arrays.back()->Validate());
   }
+  // The verifier writes the record numbers in the first column
+  use_verifier = use_verifier && schema->field(0)->type()->id() == Type::INT64;
 
   *data_stream = std::unique_ptr<FlightDataStream>(
       new PerfDataStream(use_verifier, token.start(),
@@ -139,18 +167,31 @@ Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& s
   return Status::OK();
 }
 
+// The location of the server for the given host, from the transport flags
+Status GetPerfServerLocation(const std::string& host, Location* location) {
+  if (FLAGS_server_unix.empty()) {
+    if (FLAGS_tls) {
+      return Location::ForGrpcTls(host, FLAGS_port, location);
+    }
+    return Location::ForGrpcTcp(host, FLAGS_port, location);
+  } else if (FLAGS_shared_memory) {
+    return Location::ForGrpcShm(FLAGS_server_unix, location);
+  }
+  return Location::ForGrpcUnix(FLAGS_server_unix, location);
+}
+
 class FlightPerfServer : public FlightServerBase {
  public:
   FlightPerfServer() : location_() {
-    DCHECK_OK(Location::ForGrpcTcp(FLAGS_server_host, FLAGS_port, &location_));
-    perf_schema_ = schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                           field("d", int64())});
+    DCHECK_OK(GetPerfServerLocation(FLAGS_server_host, &location_));
   }
 
   Status GetFlightInfo(const ServerCallContext& context, const FlightDescriptor& request,
                        std::unique_ptr<FlightInfo>* info) override {
     perf::Perf perf_request;
     CHECK_PARSE(perf_request.ParseFromString(request.cmd));
+    std::shared_ptr<Schema> perf_schema;
+    RETURN_NOT_OK(GetPerfSchema(perf_request.data_type(), &perf_schema));
 
     perf::Token token;
     token.mutable_definition()->CopyFrom(perf_request);
@@ -172,7 +213,7 @@ class FlightPerfServer : public FlightServerBase {
 
     FlightInfo::Data data;
     RETURN_NOT_OK(
-        MakeFlightInfo(*perf_schema_, request, endpoints, total_records, -1, &data));
+        MakeFlightInfo(*perf_schema, request, endpoints, total_records, -1, &data));
     *info = std::unique_ptr<FlightInfo>(new FlightInfo(data));
     return Status::OK();
   }
@@ -181,7 +222,9 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
-    return GetPerfBatches(token, perf_schema_, false, data_stream);
+    std::shared_ptr<Schema> perf_schema;
+    RETURN_NOT_OK(GetPerfSchema(token.definition().data_type(), &perf_schema));
+    return GetPerfBatches(token, perf_schema, false, data_stream);
   }
 
   Status DoPut(const ServerCallContext& context,
@@ -198,6 +241,23 @@ class FlightPerfServer : public FlightServerBase {
     return Status::OK();
   }
 
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    // Echo the record batches back to the client
+    FlightStreamChunk chunk;
+    RETURN_NOT_OK(reader->Next(&chunk));
+    if (!chunk.data) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(writer->Begin(reader->schema()));
+    while (chunk.data) {
+      RETURN_NOT_OK(writer->WriteWithMetadata(*chunk.data, chunk.app_metadata));
+      RETURN_NOT_OK(reader->Next(&chunk));
+    }
+    return Status::OK();
+  }
+
   Status DoAction(const ServerCallContext& context, const Action& action,
                   std::unique_ptr<ResultStream>* result) override {
     if (action.type == "ping") {
@@ -210,7 +270,6 @@ class FlightPerfServer : public FlightServerBase {
 
  private:
   Location location_;
-  std::shared_ptr<Schema> perf_schema_;
 };
 
 }  // namespace flight
@@ -230,14 +289,18 @@ int main(int argc, char** argv) {
   g_server.reset(new arrow::flight::FlightPerfServer);
 
   arrow::flight::Location location;
-  ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
+  ARROW_CHECK_OK(arrow::flight::GetPerfServerLocation("0.0.0.0", &location));
   arrow::flight::FlightServerOptions options(location);
+  if (FLAGS_tls) {
+    ARROW_CHECK_OK(arrow::flight::ExampleTlsCertificates(&options.tls_certificates));
+  }
 
   ARROW_CHECK_OK(g_server->Init(options));
   // Exit with a clean error code (0) on SIGTERM
   ARROW_CHECK_OK(g_server->SetShutdownOnSignals({SIGTERM}));
   std::cout << "Server host: " << FLAGS_server_host << std::endl;
   std::cout << "Server port: " << FLAGS_port << std::endl;
+  std::cout << "Server location: " << location.ToString() << std::endl;
   ARROW_CHECK_OK(g_server->Serve());
   return 0;
 }
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/flight/platform.h"
@@ -66,34 +67,107 @@ using google::protobuf::internal::WireFormatLite;
 using google::protobuf::io::ArrayOutputStream;
 using google::protobuf::io::CodedInputStream;
 using google::protobuf::io::CodedOutputStream;
+using google::protobuf::io::ZeroCopyInputStream;
 
 using grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
+// ----------------------------------------------------------------------
+// FlightData deserialization
+
+// Read a length-prefixed bytes field without copying it. A field spanning
+// several slices of the message is copied into a single buffer, unless
+// 'allow_scattered' is true, in which case it is returned as a ScatteredBuffer.
+bool ReadBytesZeroCopy(const ScatteredBuffer& source_data, CodedInputStream* input,
+                       bool allow_scattered, std::shared_ptr<Buffer>* out) {
   uint32_t length;
   if (!input->ReadVarint32(&length)) {
     return false;
   }
-  *out = SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
+  const int64_t position = input->CurrentPosition();
+  if (static_cast<int64_t>(length) > source_data.size() - position) {
+    return false;
+  }
+  if (allow_scattered) {
+    *out = source_data.View(position, static_cast<int64_t>(length));
+  } else {
+    auto maybe_buffer = source_data.ReadAt(position, static_cast<int64_t>(length));
+    if (!maybe_buffer.ok()) {
+      return false;
+    }
+    *out = std::move(maybe_buffer).ValueOrDie();
+  }
   return input->Skip(static_cast<int>(length));
 }
 
+// Protobuf input stream over the slices of a gRPC ByteBuffer
+class SliceInputStream : public ZeroCopyInputStream {
+ public:
+  explicit SliceInputStream(const std::vector<std::shared_ptr<Buffer>>& slices)
+      : slices_(slices) {}
+
+  bool Next(const void** data, int* size) override {
+    if (index_ == slices_.size()) {
+      return false;
+    }
+    const auto& slice = slices_[index_++];
+    *data = slice->data() + offset_;
+    *size = static_cast<int>(slice->size() - offset_);
+    byte_count_ += *size;
+    offset_ = 0;
+    return true;
+  }
+
+  void BackUp(int count) override {
+    // Only allowed right after Next(), within the slice it returned
+    --index_;
+    offset_ = slices_[index_]->size() - count;
+    byte_count_ -= count;
+  }
+
+  bool Skip(int count) override {
+    while (count > 0 && index_ < slices_.size()) {
+      const int64_t available = slices_[index_]->size() - offset_;
+      if (count < available) {
+        offset_ += count;
+        byte_count_ += count;
+        return true;
+      }
+      count -= static_cast<int>(available);
+      byte_count_ += available;
+      offset_ = 0;
+      ++index_;
+    }
+    return count == 0;
+  }
+
+  int64_t ByteCount() const override { return byte_count_; }
+
+ private:
+  const std::vector<std::shared_ptr<Buffer>>& slices_;
+  // Next slice to return, and position to start from within it
+  size_t index_ = 0;
+  int64_t offset_ = 0;
+  int64_t byte_count_ = 0;
+};
+
 // Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
  public:
   GrpcBuffer(grpc_slice slice, bool incref)
-      : MutableBuffer(GRPC_SLICE_START_PTR(slice),
-                      static_cast<int64_t>(GRPC_SLICE_LENGTH(slice))),
-        slice_(incref ? grpc_slice_ref(slice) : slice) {}
+      : MutableBuffer(nullptr, 0), slice_(incref ? grpc_slice_ref(slice) : slice) {
+    // Point to our own copy of the slice, as small slices store their
+    // data inline
+    data_ = mutable_data_ = GRPC_SLICE_START_PTR(slice_);
+    size_ = capacity_ = static_cast<int64_t>(GRPC_SLICE_LENGTH(slice_));
+  }
 
   ~GrpcBuffer() override {
     // Decref slice
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
+  static Status Wrap(ByteBuffer* cpp_buf, std::vector<std::shared_ptr<Buffer>>* out) {
     // These types are guaranteed by static assertions in gRPC to have the same
     // in-memory representation
 
@@ -102,15 +176,18 @@ class GrpcBuffer : public MutableBuffer {
     // This part below is based on the Flatbuffers gRPC SerializationTraits in
     // flatbuffers/grpc.h
 
-    // Check if this is a single uncompressed slice.
+    out->clear();
+    // Check if this is uncompressed.
     if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
-
-      // Increment reference count so this memory remains valid
-      *out = std::make_shared<GrpcBuffer>(slice, true);
+        (buffer->data.raw.compression == GRPC_COMPRESS_NONE)) {
+      // If it is, then we can reference the `grpc_slice`s directly. Large
+      // messages are often split over several slices, which are not coalesced.
+      const grpc_slice_buffer& slice_buffer = buffer->data.raw.slice_buffer;
+      out->reserve(slice_buffer.count);
+      for (size_t i = 0; i < slice_buffer.count; ++i) {
+        // Increment reference count so this memory remains valid
+        out->push_back(std::make_shared<GrpcBuffer>(slice_buffer.slices[i], true));
+      }
     } else {
       // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
       // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
@@ -123,7 +200,7 @@ class GrpcBuffer : public MutableBuffer {
       grpc_byte_buffer_reader_destroy(&reader);
 
       // Steal the slice reference
-      *out = std::make_shared<GrpcBuffer>(slice, false);
+      out->push_back(std::make_shared<GrpcBuffer>(slice, false));
     }
 
     return Status::OK();
@@ -168,11 +245,15 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
 
   const arrow::ipc::internal::IpcPayload& ipc_msg = msg.ipc_message;
 
-  DCHECK_LT(ipc_msg.metadata->size(), kInt32Max);
-  const int32_t metadata_size = static_cast<int32_t>(ipc_msg.metadata->size());
+  // The IPC header may be missing when only sending a descriptor
+  int32_t metadata_size = 0;
+  if (ipc_msg.metadata != nullptr) {
+    DCHECK_LT(ipc_msg.metadata->size(), kInt32Max);
+    metadata_size = static_cast<int32_t>(ipc_msg.metadata->size());
 
-  // 1 byte for metadata tag
-  header_size += 1 + WireFormatLite::LengthDelimitedSize(metadata_size);
+    // 1 byte for metadata tag
+    header_size += 1 + WireFormatLite::LengthDelimitedSize(metadata_size);
+  }
 
   // App metadata tag if appropriate
   int32_t app_metadata_size = 0;
@@ -207,7 +288,10 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
 
   // Allocate and initialize slices
   std::vector<grpc::Slice> slices;
-  grpc::Slice header_slice(header_size);
+  // The header slice is always allocated out of line: an inlined slice
+  // would be copied into `slices` before the header is written
+  grpc::Slice header_slice(grpc_slice_malloc_large(header_size),
+                           grpc::Slice::STEAL_REF);
   slices.push_back(header_slice);
 
   // XXX(wesm): for debugging
@@ -227,11 +311,13 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
   }
 
   // Write header
-  WireFormatLite::WriteTag(pb::FlightData::kDataHeaderFieldNumber,
-                           WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
-  header_stream.WriteVarint32(metadata_size);
-  header_stream.WriteRawMaybeAliased(ipc_msg.metadata->data(),
-                                     static_cast<int>(ipc_msg.metadata->size()));
+  if (ipc_msg.metadata != nullptr) {
+    WireFormatLite::WriteTag(pb::FlightData::kDataHeaderFieldNumber,
+                             WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
+    header_stream.WriteVarint32(metadata_size);
+    header_stream.WriteRawMaybeAliased(ipc_msg.metadata->data(),
+                                       static_cast<int>(ipc_msg.metadata->size()));
+  }
 
   // Write app metadata
   if (app_metadata_size > 0) {
@@ -265,6 +351,8 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
     }
   }
 
+  // Flush the header before gRPC copies small slices
+  header_stream.Trim();
   DCHECK_EQ(static_cast<int>(header_size), header_stream.ByteCount());
 
   // Hand off the slices to the returned ByteBuffer
@@ -280,11 +368,13 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
     return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
   }
 
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+  std::vector<std::shared_ptr<arrow::Buffer>> slices;
+  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &slices));
+  const ScatteredBuffer wrapped_buffer(std::move(slices));
 
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
+  auto buffer_length = static_cast<int>(wrapped_buffer.size());
+  SliceInputStream slice_stream(wrapped_buffer.segments());
+  CodedInputStream pb_stream(&slice_stream);
 
   pb_stream.SetTotalBytesLimit(buffer_length);
 
@@ -314,19 +404,24 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
         out->descriptor.reset(new arrow::flight::FlightDescriptor(descriptor));
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, /*allow_scattered=*/false,
+                               &out->metadata)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData metadata");
         }
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, /*allow_scattered=*/false,
+                               &out->app_metadata)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData application metadata");
         }
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        // Record batch buffers lying within a single slice will be read
+        // without copying from a scattered body, see ScatteredBuffer
+        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, /*allow_scattered=*/true,
+                               &out->body)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData body");
         }
@@ -343,6 +438,13 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
   return grpc::Status::OK;
 }
 
+Status FlightData::CoalesceBody() {
+  if (body != nullptr && !body->is_cpu()) {
+    ARROW_ASSIGN_OR_RAISE(body, Buffer::ViewOrCopy(body, default_cpu_memory_manager()));
+  }
+  return Status::OK();
+}
+
 Status FlightData::OpenMessage(std::unique_ptr<ipc::Message>* message) {
   return ipc::Message::Open(metadata, body).Value(message);
 }
@@ -369,6 +471,20 @@ bool WritePayload(const FlightPayload& payload,
                        grpc::WriteOptions());
 }
 
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
+                       grpc::WriteOptions());
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
+                       grpc::WriteOptions());
+}
+
 bool WritePayload(const FlightPayload& payload,
                   grpc::ServerWriter<pb::FlightData>* writer) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
@@ -381,12 +497,24 @@ bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data) {
   return reader->Read(reinterpret_cast<pb::FlightData*>(data));
 }
 
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+}
+
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
                  FlightData* data) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
   return reader->Read(reinterpret_cast<pb::FlightData*>(data));
 }
 
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+}
+
 #ifndef _WIN32
 #pragma GCC diagnostic pop
 #endif
@@ -20,24 +20,29 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/types.h"
 #include "arrow/ipc/message.h"
+#include "arrow/ipc/scattered_buffer_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 
 namespace arrow {
-
-class Buffer;
-
 namespace flight {
 namespace internal {
 
+using ipc::internal::ScatteredBuffer;
+
 /// Internal, not user-visible type used for memory-efficient reads from gRPC
 /// stream
 struct FlightData {
-  /// Used only for puts, may be null
+  /// Used only for puts and exchanges, may be null
   std::unique_ptr<FlightDescriptor> descriptor;
 
   /// Non-length-prefixed Message header as described in format/Message.fbs
@@ -46,9 +51,12 @@ struct FlightData {
   /// Application-defined metadata
   std::shared_ptr<Buffer> app_metadata;
 
-  /// Message body
+  /// Message body, a ScatteredBuffer if it was received over several gRPC slices
   std::shared_ptr<Buffer> body;
 
+  /// Make the body a single contiguous CPU buffer, copying it if it is scattered
+  Status CoalesceBody();
+
   /// Open IPC message from the metadata and body
   Status OpenMessage(std::unique_ptr<ipc::Message>* message);
 };
@@ -57,14 +65,22 @@ struct FlightData {
 /// True is returned on success, false if some error occurred (connection closed?).
 bool WritePayload(const FlightPayload& payload,
                   grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer);
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer);
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer);
 bool WritePayload(const FlightPayload& payload,
                   grpc::ServerWriter<pb::FlightData>* writer);
 
 /// Read Flight message from gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if stream ended.
 bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data);
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data);
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
                  FlightData* data);
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data);
 
 }  // namespace internal
 }  // namespace flight
@@ -21,9 +21,13 @@
 #include "arrow/flight/server.h"
 
 #include <signal.h>
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -45,12 +49,15 @@
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 
+#include "arrow/flight/compression_internal.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/middleware_internal.h"
 #include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
 #include "arrow/flight/types.h"
@@ -91,16 +98,79 @@ namespace flight {
 
 namespace {
 
+using ServerPutStream = grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>;
+using ServerExchangeStream = grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>;
+
+// How the record batch bodies of a call are exchanged
+struct BodyTransport {
+  // Whether bodies go through shared memory
+  bool shared_memory = false;
+  // The codec compressing bodies, if the client asked for it
+  std::shared_ptr<util::Codec> codec;
+
+  Status Send(FlightPayload* payload) const {
+    if (codec) {
+      RETURN_NOT_OK(internal::CompressBody(codec.get(), payload));
+    }
+    if (shared_memory) {
+      RETURN_NOT_OK(internal::MoveBodyToSharedMemory(payload));
+    }
+    return Status::OK();
+  }
+
+  // Release the resources of a prepared payload which couldn't be sent
+  void Discard(const FlightPayload& payload) const {
+    if (shared_memory) {
+      internal::DiscardSharedMemoryBody(payload);
+    }
+  }
+
+  Status Receive(internal::FlightData* data) const {
+    if (shared_memory) {
+      RETURN_NOT_OK(internal::MapBodyFromSharedMemory(data));
+    }
+    if (codec) {
+      RETURN_NOT_OK(internal::DecompressBody(codec.get(), data));
+    }
+    return Status::OK();
+  }
+};
+
 // A MessageReader implementation that reads from a gRPC ServerReader
+template <typename Stream>
 class FlightIpcMessageReader : public ipc::MessageReader {
  public:
-  explicit FlightIpcMessageReader(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
-      std::shared_ptr<Buffer>* last_metadata)
-      : reader_(reader), app_metadata_(last_metadata) {}
+  FlightIpcMessageReader(Stream* reader, std::shared_ptr<Buffer>* last_metadata,
+                         BodyTransport transport)
+      : reader_(reader), app_metadata_(last_metadata), transport_(std::move(transport)) {}
 
   const FlightDescriptor& descriptor() const { return descriptor_; }
 
+  // Whether the client stream ended before any IPC message
+  bool empty() const { return stream_finished_ && !read_ipc_message_; }
+
+  // Read the first message of the stream, which carries the
+  // descriptor. It may carry no IPC message, as the client can send
+  // the descriptor ahead of the data.
+  Status ReadDescriptor() {
+    if (!first_message_) {
+      return Status::OK();
+    }
+    first_message_ = false;
+    if (!internal::ReadPayload(reader_, &first_data_)) {
+      // Stream is finished
+      stream_finished_ = true;
+      return Status::Invalid(
+          "Client provided malformed message or did not provide message");
+    }
+    if (!first_data_.descriptor) {
+      return Status::Invalid("Client stream must start with non-null descriptor");
+    }
+    descriptor_ = *first_data_.descriptor;
+    first_data_pending_ = first_data_.metadata != nullptr;
+    return Status::OK();
+  }
+
   ::arrow::Result<std::unique_ptr<ipc::Message>> ReadNextMessage() override {
     std::unique_ptr<ipc::Message> out;
     RETURN_NOT_OK(GetNextMessage(&out));
@@ -110,54 +180,47 @@ class FlightIpcMessageReader : public ipc::MessageReader {
  protected:
   Status GetNextMessage(std::unique_ptr<ipc::Message>* out) {
     // TODO: Migrate to Result APIs
-    if (stream_finished_) {
-      *out = nullptr;
-      *app_metadata_ = nullptr;
-      return Status::OK();
-    }
+    RETURN_NOT_OK(ReadDescriptor());
+    *out = nullptr;
+    *app_metadata_ = nullptr;
     internal::FlightData data;
-    if (!internal::ReadPayload(reader_, &data)) {
+    if (first_data_pending_) {
+      data = std::move(first_data_);
+      first_data_pending_ = false;
+    } else if (stream_finished_ || !internal::ReadPayload(reader_, &data)) {
       // Stream is finished
       stream_finished_ = true;
-      if (first_message_) {
-        return Status::Invalid(
-            "Client provided malformed message or did not provide message");
-      }
-      *out = nullptr;
-      *app_metadata_ = nullptr;
       return Status::OK();
     }
 
-    if (first_message_) {
-      if (!data.descriptor) {
-        return Status::Invalid("DoPut must start with non-null descriptor");
-      }
-      descriptor_ = *data.descriptor;
-      first_message_ = false;
-    }
-
+    RETURN_NOT_OK(transport_.Receive(&data));
     RETURN_NOT_OK(data.OpenMessage(out));
+    read_ipc_message_ = true;
     *app_metadata_ = std::move(data.app_metadata);
     return Status::OK();
   }
 
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
+  Stream* reader_;
   bool stream_finished_ = false;
   bool first_message_ = true;
+  bool first_data_pending_ = false;
+  bool read_ipc_message_ = false;
+  internal::FlightData first_data_;
   FlightDescriptor descriptor_;
   std::shared_ptr<Buffer>* app_metadata_;
+  BodyTransport transport_;
 };
 
+template <typename Stream>
 class FlightMessageReaderImpl : public FlightMessageReader {
  public:
-  explicit FlightMessageReaderImpl(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader)
-      : reader_(reader) {}
+  FlightMessageReaderImpl(Stream* reader, BodyTransport transport)
+      : message_reader_(new FlightIpcMessageReader<Stream>(reader, &last_metadata_,
+                                                           std::move(transport))),
+        owned_message_reader_(message_reader_) {}
 
   Status Init() {
-    message_reader_ = new FlightIpcMessageReader(reader_, &last_metadata_);
-    return ipc::RecordBatchStreamReader::Open(
-               std::unique_ptr<ipc::MessageReader>(message_reader_))
+    return ipc::RecordBatchStreamReader::Open(std::move(owned_message_reader_))
         .Value(&batch_reader_);
   }
 
@@ -174,20 +237,62 @@ class FlightMessageReaderImpl : public FlightMessageReader {
     return Status::OK();
   }
 
- private:
-  std::shared_ptr<Schema> schema_;
-  std::unique_ptr<ipc::DictionaryMemo> dictionary_memo_;
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
-  FlightIpcMessageReader* message_reader_;
+ protected:
+  FlightIpcMessageReader<Stream>* message_reader_;
+  std::unique_ptr<ipc::MessageReader> owned_message_reader_;
   std::shared_ptr<Buffer> last_metadata_;
   std::shared_ptr<RecordBatchReader> batch_reader_;
 };
 
+// The reader of a DoExchange call. The client may not send any data
+// before it has received some, so the IPC stream is only opened once
+// the application asks for the client's data.
+class FlightExchangeReaderImpl : public FlightMessageReaderImpl<ServerExchangeStream> {
+ public:
+  using FlightMessageReaderImpl::FlightMessageReaderImpl;
+
+  Status ReadDescriptor() { return message_reader_->ReadDescriptor(); }
+
+  std::shared_ptr<Schema> schema() const override {
+    auto self = const_cast<FlightExchangeReaderImpl*>(this);
+    if (!self->EnsureDataStarted().ok() || !batch_reader_) {
+      return nullptr;
+    }
+    return batch_reader_->schema();
+  }
+
+  Status Next(FlightStreamChunk* out) override {
+    RETURN_NOT_OK(EnsureDataStarted());
+    if (!batch_reader_) {
+      // The client did not send any data
+      out->data = nullptr;
+      out->app_metadata = nullptr;
+      return Status::OK();
+    }
+    return FlightMessageReaderImpl::Next(out);
+  }
+
+ private:
+  Status EnsureDataStarted() {
+    if (!started_) {
+      started_ = true;
+      start_status_ = Init();
+      if (!start_status_.ok() && message_reader_->empty()) {
+        // Not sending any data is allowed in an exchange
+        batch_reader_ = nullptr;
+        start_status_ = Status::OK();
+      }
+    }
+    return start_status_;
+  }
+
+  bool started_ = false;
+  Status start_status_;
+};
+
 class GrpcMetadataWriter : public FlightMetadataWriter {
  public:
-  explicit GrpcMetadataWriter(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* writer)
-      : writer_(writer) {}
+  explicit GrpcMetadataWriter(ServerPutStream* writer) : writer_(writer) {}
 
   Status WriteMetadata(const Buffer& buffer) override {
     pb::PutResult message{};
@@ -199,7 +304,83 @@ class GrpcMetadataWriter : public FlightMetadataWriter {
   }
 
  private:
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* writer_;
+  ServerPutStream* writer_;
+};
+
+// A IpcPayloadWriter implementation that writes to a DoExchange stream,
+// attaching the application metadata of the record batch being written
+class DoExchangePayloadWriter : public ipc::internal::IpcPayloadWriter {
+ public:
+  DoExchangePayloadWriter(ServerExchangeStream* stream,
+                          std::shared_ptr<Buffer>* app_metadata, BodyTransport transport)
+      : stream_(stream), app_metadata_(app_metadata), transport_(std::move(transport)) {}
+
+  Status Start() override { return Status::OK(); }
+
+  Status WritePayload(const ipc::internal::IpcPayload& ipc_payload) override {
+    FlightPayload payload;
+    payload.ipc_message = ipc_payload;
+    if (ipc_payload.type == ipc::Message::RECORD_BATCH && *app_metadata_) {
+      payload.app_metadata = std::move(*app_metadata_);
+    }
+    RETURN_NOT_OK(transport_.Send(&payload));
+    if (!internal::WritePayload(payload, stream_)) {
+      transport_.Discard(payload);
+      return Status::IOError("Could not write record batch to stream");
+    }
+    return Status::OK();
+  }
+
+  Status Close() override { return Status::OK(); }
+
+ private:
+  ServerExchangeStream* stream_;
+  std::shared_ptr<Buffer>* app_metadata_;
+  BodyTransport transport_;
+};
+
+class FlightMessageWriterImpl : public FlightMessageWriter {
+ public:
+  FlightMessageWriterImpl(ServerExchangeStream* stream, BodyTransport transport)
+      : stream_(stream), transport_(std::move(transport)) {}
+
+  ~FlightMessageWriterImpl() override {
+    // Send the schema if no record batch was written, the call is over
+    // anyway if this fails
+    if (batch_writer_) {
+      ARROW_UNUSED(batch_writer_->Close());
+    }
+  }
+
+  Status Begin(const std::shared_ptr<Schema>& schema) override {
+    if (batch_writer_) {
+      return Status::Invalid("This writer has already been started");
+    }
+    std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+        new DoExchangePayloadWriter(stream_, &app_metadata_, transport_));
+    ARROW_ASSIGN_OR_RAISE(batch_writer_, ipc::internal::OpenRecordBatchWriter(
+                                             std::move(payload_writer), schema));
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    return WriteWithMetadata(batch, nullptr);
+  }
+
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override {
+    if (!batch_writer_) {
+      return Status::Invalid("This writer is not started, call Begin() with a schema");
+    }
+    app_metadata_ = std::move(app_metadata);
+    return batch_writer_->WriteRecordBatch(batch);
+  }
+
+ private:
+  ServerExchangeStream* stream_;
+  BodyTransport transport_;
+  std::shared_ptr<Buffer> app_metadata_;
+  std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
 };
 
 class GrpcServerAuthReader : public ServerAuthReader {
@@ -301,8 +482,11 @@ class FlightServiceImpl : public FlightService::Service {
       std::shared_ptr<ServerAuthHandler> auth_handler,
       std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
           middleware,
-      FlightServerBase* server)
-      : auth_handler_(auth_handler), middleware_(middleware), server_(server) {}
+      FlightServerBase* server, bool shared_memory)
+      : auth_handler_(auth_handler),
+        middleware_(middleware),
+        server_(server),
+        shared_memory_(shared_memory) {}
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -344,6 +528,33 @@ class FlightServiceImpl : public FlightService::Service {
     return grpc::Status::OK;
   }
 
+  // How record batch bodies of the call are exchanged. They go through
+  // shared memory, and are compressed, if the client asked for it. If the
+  // codec isn't supported, the call fails when the client uploads bodies
+  // (which it compresses anyway), otherwise they are sent uncompressed.
+  Status GetBodyTransport(ServerContext* context, bool uploads,
+                          BodyTransport* out) const {
+    const auto& metadata = context->client_metadata();
+    out->shared_memory =
+        shared_memory_ &&
+        metadata.find(internal::kGrpcSharedMemoryHeader) != metadata.end();
+    const auto compression = metadata.find(internal::kGrpcCompressionHeader);
+    if (compression == metadata.end()) {
+      return Status::OK();
+    }
+    const std::string name(compression->second.data(), compression->second.length());
+    std::unique_ptr<util::Codec> codec;
+    Status st = internal::MakeBodyCodec(name, &codec);
+    if (!st.ok()) {
+      return uploads ? st.WithMessage("Cannot decompress record batches: ", st.message())
+                     : Status::OK();
+    }
+    out->codec = std::move(codec);
+    // Tell the client that the bodies sent back are compressed
+    context->AddInitialMetadata(internal::kGrpcCompressionHeader, name);
+    return Status::OK();
+  }
+
   // Authenticate the client (if applicable) and construct the call context
   grpc::Status CheckAuth(const FlightMethod& method, ServerContext* context,
                          GrpcServerCallContext& flight_context) {
@@ -497,6 +708,10 @@ class FlightServiceImpl : public FlightService::Service {
     Ticket ticket;
     SERVICE_RETURN_NOT_OK(flight_context, internal::FromProto(*request, &ticket));
 
+    BodyTransport transport;
+    SERVICE_RETURN_NOT_OK(flight_context,
+                          GetBodyTransport(context, /*uploads=*/false, &transport));
+
     std::unique_ptr<FlightDataStream> data_stream;
     SERVICE_RETURN_NOT_OK(flight_context,
                           server_->DoGet(flight_context, ticket, &data_stream));
@@ -518,22 +733,29 @@ class FlightServiceImpl : public FlightService::Service {
     while (true) {
       FlightPayload payload;
       SERVICE_RETURN_NOT_OK(flight_context, data_stream->Next(&payload));
-      if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
-        // No more messages to write, or connection terminated for some other
-        // reason
+      if (payload.ipc_message.metadata == nullptr) {
+        // No more messages to write
+        break;
+      }
+      SERVICE_RETURN_NOT_OK(flight_context, transport.Send(&payload));
+      if (!internal::WritePayload(payload, writer)) {
+        // Connection terminated for some other reason
+        transport.Discard(payload);
         break;
+      }
     }
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
 
-  grpc::Status DoPut(ServerContext* context,
-                     grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader) {
+  grpc::Status DoPut(ServerContext* context, ServerPutStream* reader) {
     GrpcServerCallContext flight_context(context);
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoPut, context, flight_context));
 
-    auto message_reader =
-        std::unique_ptr<FlightMessageReaderImpl>(new FlightMessageReaderImpl(reader));
+    BodyTransport transport;
+    SERVICE_RETURN_NOT_OK(flight_context,
+                          GetBodyTransport(context, /*uploads=*/true, &transport));
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<ServerPutStream>>(
+        new FlightMessageReaderImpl<ServerPutStream>(reader, std::move(transport)));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
     auto metadata_writer =
         std::unique_ptr<FlightMetadataWriter>(new GrpcMetadataWriter(reader));
@@ -542,6 +764,24 @@ class FlightServiceImpl : public FlightService::Service {
                                           std::move(metadata_writer)));
   }
 
+  grpc::Status DoExchange(ServerContext* context, ServerExchangeStream* stream) {
+    GrpcServerCallContext flight_context(context);
+    GRPC_RETURN_NOT_GRPC_OK(
+        CheckAuth(FlightMethod::DoExchange, context, flight_context));
+
+    BodyTransport transport;
+    SERVICE_RETURN_NOT_OK(flight_context,
+                          GetBodyTransport(context, /*uploads=*/true, &transport));
+    auto message_reader = std::unique_ptr<FlightExchangeReaderImpl>(
+        new FlightExchangeReaderImpl(stream, transport));
+    SERVICE_RETURN_NOT_OK(flight_context, message_reader->ReadDescriptor());
+    auto message_writer = std::unique_ptr<FlightMessageWriter>(
+        new FlightMessageWriterImpl(stream, std::move(transport)));
+    RETURN_WITH_MIDDLEWARE(flight_context,
+                           server_->DoExchange(flight_context, std::move(message_reader),
+                                               std::move(message_writer)));
+  }
+
   grpc::Status ListActions(ServerContext* context, const pb::Empty* request,
                            ServerWriter<pb::ActionType>* writer) {
     GrpcServerCallContext flight_context(context);
@@ -591,12 +831,15 @@ class FlightServiceImpl : public FlightService::Service {
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware_;
   FlightServerBase* server_;
+  bool shared_memory_;
 };
 
 }  // namespace
 
 FlightMetadataWriter::~FlightMetadataWriter() = default;
 
+FlightMessageWriter::~FlightMessageWriter() = default;
+
 //
 // gRPC server lifecycle
 //
@@ -657,7 +900,8 @@ FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
   impl_->service_.reset(
-      new FlightServiceImpl(options.auth_handler, options.middleware, this));
+      new FlightServiceImpl(options.auth_handler, options.middleware, this,
+                            options.location.scheme() == kSchemeGrpcShm));
 
   grpc::ServerBuilder builder;
   // Allow uploading messages of any length
@@ -681,7 +925,7 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
     }
 
     builder.AddListeningPort(address.str(), creds, &impl_->port_);
-  } else if (scheme == kSchemeGrpcUnix) {
+  } else if (scheme == kSchemeGrpcUnix || scheme == kSchemeGrpcShm) {
     std::stringstream address;
     address << "unix:" << location.uri_->path();
     builder.AddListeningPort(address.str(), grpc::InsecureServerCredentials());
@@ -782,6 +1026,12 @@ Status FlightServerBase::DoPut(const ServerCallContext& context,
   return Status::NotImplemented("NYI");
 }
 
+Status FlightServerBase::DoExchange(const ServerCallContext& context,
+                                    std::unique_ptr<FlightMessageReader> reader,
+                                    std::unique_ptr<FlightMessageWriter> writer) {
+  return Status::NotImplemented("NYI");
+}
+
 Status FlightServerBase::DoAction(const ServerCallContext& context, const Action& action,
                                   std::unique_ptr<ResultStream>* result) {
   return Status::NotImplemented("NYI");
@@ -901,5 +1151,122 @@ Status RecordBatchStream::GetSchemaPayload(FlightPayload* payload) {
 
 Status RecordBatchStream::Next(FlightPayload* payload) { return impl_->Next(payload); }
 
+// ----------------------------------------------------------------------
+// Implement PrefetchingFlightDataStream
+
+class PrefetchingFlightDataStream::PrefetchingFlightDataStreamImpl
+    : public std::enable_shared_from_this<PrefetchingFlightDataStreamImpl> {
+ public:
+  PrefetchingFlightDataStreamImpl(std::unique_ptr<FlightDataStream> stream,
+                                  int queue_depth)
+      : stream_(std::move(stream)), queue_depth_(std::max(queue_depth, 1)) {}
+
+  std::shared_ptr<Schema> schema() { return stream_->schema(); }
+
+  Status GetSchemaPayload(FlightPayload* payload) {
+    return stream_->GetSchemaPayload(payload);
+  }
+
+  Status Next(FlightPayload* payload) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!started_) {
+      started_ = true;
+      SpawnPullUnlocked();
+    }
+    cv_.wait(lock, [this] { return !queue_.empty() || finished_; });
+    if (queue_.empty()) {
+      // Signal that iteration is over, or report the error
+      payload->ipc_message.metadata = nullptr;
+      return status_;
+    }
+    *payload = std::move(queue_.front());
+    queue_.pop_front();
+    if (!pulling_ && !finished_) {
+      SpawnPullUnlocked();
+    }
+    return Status::OK();
+  }
+
+  void Close() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    closed_ = true;
+    cv_.wait(lock, [this] { return !pulling_; });
+  }
+
+ private:
+  void SpawnPullUnlocked() {
+    pulling_ = true;
+    auto self = shared_from_this();
+    Status st = arrow::internal::GetCpuThreadPool()->Spawn([self] { self->Pull(); });
+    if (!st.ok()) {
+      pulling_ = false;
+      FinishUnlocked(st);
+    }
+  }
+
+  // Pull payloads until the queue is full or the stream is exhausted
+  void Pull() {
+    while (true) {
+      FlightPayload payload;
+      Status st = stream_->Next(&payload);
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) {
+        pulling_ = false;
+        cv_.notify_all();
+        return;
+      }
+      if (!st.ok() || payload.ipc_message.metadata == nullptr) {
+        pulling_ = false;
+        FinishUnlocked(st);
+        return;
+      }
+      queue_.push_back(std::move(payload));
+      if (static_cast<int>(queue_.size()) >= queue_depth_) {
+        pulling_ = false;
+      }
+      cv_.notify_all();
+      if (!pulling_) {
+        return;
+      }
+    }
+  }
+
+  void FinishUnlocked(Status st) {
+    finished_ = true;
+    status_ = std::move(st);
+    cv_.notify_all();
+  }
+
+  std::unique_ptr<FlightDataStream> stream_;
+  const int queue_depth_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<FlightPayload> queue_;
+  Status status_;
+  bool started_ = false;
+  // Whether a pool task is pulling from the stream
+  bool pulling_ = false;
+  bool finished_ = false;
+  bool closed_ = false;
+};
+
+PrefetchingFlightDataStream::PrefetchingFlightDataStream(
+    std::unique_ptr<FlightDataStream> stream, int queue_depth)
+    : impl_(std::make_shared<PrefetchingFlightDataStreamImpl>(std::move(stream),
+                                                              queue_depth)) {}
+
+PrefetchingFlightDataStream::~PrefetchingFlightDataStream() { impl_->Close(); }
+
+std::shared_ptr<Schema> PrefetchingFlightDataStream::schema() { return impl_->schema(); }
+
+Status PrefetchingFlightDataStream::GetSchemaPayload(FlightPayload* payload) {
+  return impl_->GetSchemaPayload(payload);
+}
+
+Status PrefetchingFlightDataStream::Next(FlightPayload* payload) {
+  return impl_->Next(payload);
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -79,6 +79,35 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::unique_ptr<RecordBatchStreamImpl> impl_;
 };
 
+/// \brief A FlightDataStream producing the payloads of another stream ahead
+/// of time
+///
+/// After the first call to Next(), the payloads of the wrapped stream are
+/// pulled (i.e. its batches read and serialized) on the Arrow CPU thread pool,
+/// while the caller, e.g. the gRPC handler of DoGet, writes the previous ones.
+/// At most queue_depth payloads are buffered; pulling resumes when the caller
+/// takes one from a full queue, so no pool thread waits for the caller.
+///
+/// The schema payload is computed in the calling thread.  An error of the
+/// wrapped stream is returned by Next() after the payloads preceding it.
+class ARROW_FLIGHT_EXPORT PrefetchingFlightDataStream : public FlightDataStream {
+ public:
+  /// \param[in] stream the stream to pull payloads from
+  /// \param[in] queue_depth the largest number of payloads produced ahead
+  explicit PrefetchingFlightDataStream(std::unique_ptr<FlightDataStream> stream,
+                                       int queue_depth = 2);
+  /// \brief Stop pulling payloads, waiting for a running pull to finish
+  ~PrefetchingFlightDataStream() override;
+
+  std::shared_ptr<Schema> schema() override;
+  Status GetSchemaPayload(FlightPayload* payload) override;
+  Status Next(FlightPayload* payload) override;
+
+ private:
+  class PrefetchingFlightDataStreamImpl;
+  std::shared_ptr<PrefetchingFlightDataStreamImpl> impl_;
+};
+
 /// \brief A reader for IPC payloads uploaded by a client. Also allows
 /// reading application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader {
@@ -96,6 +125,25 @@ class ARROW_FLIGHT_EXPORT FlightMetadataWriter {
   virtual Status WriteMetadata(const Buffer& app_metadata) = 0;
 };
 
+/// \brief A writer for record batches sent back to the client during a
+/// DoExchange call. Also allows sending application-defined metadata
+/// along with each record batch via the Flight protocol.
+class ARROW_FLIGHT_EXPORT FlightMessageWriter {
+ public:
+  virtual ~FlightMessageWriter();
+  /// \brief Start sending record batches with the given schema.
+  ///
+  /// Must be called once before writing any record batch. A call that
+  /// never calls this sends no data to the client.
+  virtual Status Begin(const std::shared_ptr<Schema>& schema) = 0;
+  /// \brief Send a record batch to the client.
+  virtual Status WriteRecordBatch(const RecordBatch& batch) = 0;
+  /// \brief Send a record batch along with application metadata to the
+  /// client.
+  virtual Status WriteWithMetadata(const RecordBatch& batch,
+                                   std::shared_ptr<Buffer> app_metadata) = 0;
+};
+
 /// \brief Call state/contextual data.
 class ARROW_FLIGHT_EXPORT ServerCallContext {
  public:
@@ -233,6 +281,21 @@ class ARROW_FLIGHT_EXPORT FlightServerBase {
                        std::unique_ptr<FlightMessageReader> reader,
                        std::unique_ptr<FlightMetadataWriter> writer);
 
+  /// \brief Exchange record batches with a client over a single
+  /// bidirectional stream
+  ///
+  /// Data may be read and written in any order, e.g. to process each
+  /// uploaded record batch and send its results back before reading the
+  /// next one. If the client sends no data at all, the reader has a null
+  /// schema and yields no record batches.
+  /// \param[in] context The call context.
+  /// \param[in] reader a sequence of record batches uploaded by the client
+  /// \param[in] writer send record batches back to the client
+  /// \return Status
+  virtual Status DoExchange(const ServerCallContext& context,
+                            std::unique_ptr<FlightMessageReader> reader,
+                            std::unique_ptr<FlightMessageWriter> writer);
+
   /// \brief Execute an action, return stream of zero or more results
   /// \param[in] context The call context.
   /// \param[in] action the action to execute, with type and body
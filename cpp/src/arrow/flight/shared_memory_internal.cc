@@ -0,0 +1,277 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/shared_memory_internal.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/types.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+#ifdef _WIN32
+
+Status MoveBodyToSharedMemory(FlightPayload*) {
+  return Status::NotImplemented("Shared memory transport is not supported on Windows");
+}
+
+void DiscardSharedMemoryBody(const FlightPayload&) {}
+
+Status MapBodyFromSharedMemory(FlightData*) {
+  return Status::NotImplemented("Shared memory transport is not supported on Windows");
+}
+
+#else
+
+namespace {
+
+// A reference is laid out as the magic, the body length as a
+// little-endian int64, then the segment name
+constexpr char kReferenceMagic[8] = {'A', 'R', 'R', 'O', 'W', 'S', 'H', 'M'};
+constexpr int64_t kReferenceHeaderSize =
+    sizeof(kReferenceMagic) + static_cast<int64_t>(sizeof(int64_t));
+
+// Segment names are the prefix followed by the sender's pid, a counter and
+// random characters, so that they can't be guessed by other processes
+constexpr char kSegmentNamePrefix[] = "/arrow-flight-";
+constexpr size_t kSegmentNameRandomChars = 16;
+// NAME_MAX, bounding names read from a peer
+constexpr size_t kMaxSegmentNameLength = 255;
+
+std::atomic<uint64_t> segment_counter{0};
+
+std::string NewSegmentName() {
+  static const char chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  std::random_device gen;
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(sizeof(chars)) - 2);
+
+  std::stringstream ss;
+  ss << kSegmentNamePrefix << getpid() << "-" << segment_counter.fetch_add(1) << "-";
+  for (size_t i = 0; i < kSegmentNameRandomChars; ++i) {
+    ss << chars[dist(gen)];
+  }
+  return ss.str();
+}
+
+// Whether a name received from a peer is one that NewSegmentName() could
+// have made, so that no other shared memory object is opened or unlinked
+bool IsValidSegmentName(const std::string& name) {
+  const size_t prefix_length = sizeof(kSegmentNamePrefix) - 1;
+  if (name.size() <= prefix_length || name.size() > kMaxSegmentNameLength ||
+      name.compare(0, prefix_length, kSegmentNamePrefix) != 0) {
+    return false;
+  }
+  for (size_t i = prefix_length; i < name.size(); ++i) {
+    const char c = name[i];
+    if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '-')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Parse a reference written by MoveBodyToSharedMemory, returning false if
+// the buffer isn't one
+bool ParseReference(const Buffer& reference, int64_t* body_size, std::string* name) {
+  if (reference.size() <= kReferenceHeaderSize ||
+      std::memcmp(reference.data(), kReferenceMagic, sizeof(kReferenceMagic)) != 0) {
+    return false;
+  }
+  std::memcpy(body_size, reference.data() + sizeof(kReferenceMagic), sizeof(int64_t));
+  *body_size = BitUtil::FromLittleEndian(*body_size);
+  name->assign(reinterpret_cast<const char*>(reference.data()) + kReferenceHeaderSize,
+               static_cast<size_t>(reference.size() - kReferenceHeaderSize));
+  return true;
+}
+
+/// A read-only mapping of a whole shared memory segment
+class SharedMemoryBuffer : public Buffer {
+ public:
+  SharedMemoryBuffer(const uint8_t* data, int64_t size) : Buffer(data, size) {}
+
+  ~SharedMemoryBuffer() override {
+    int result = munmap(const_cast<uint8_t*>(data_), static_cast<size_t>(size_));
+    ARROW_CHECK_EQ(result, 0) << "munmap failed";
+  }
+};
+
+}  // namespace
+
+Status MoveBodyToSharedMemory(FlightPayload* payload) {
+  auto& ipc_msg = payload->ipc_message;
+  int64_t body_size = 0;
+  for (const auto& buffer : ipc_msg.body_buffers) {
+    // Buffer may be null when the row length is zero, or when all
+    // entries are invalid.
+    if (!buffer) continue;
+    body_size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+  }
+  if (body_size == 0) {
+    return Status::OK();
+  }
+
+  const std::string name = NewSegmentName();
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd == -1) {
+    return ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed to create shared memory segment '", name, "'");
+  }
+  auto fail = [&](const char* what) {
+    Status st = ::arrow::internal::IOErrorFromErrno(
+        errno, what, " shared memory segment '", name, "'");
+    close(fd);
+    shm_unlink(name.c_str());
+    return st;
+  };
+  if (ftruncate(fd, static_cast<off_t>(body_size)) == -1) {
+    return fail("Failed to resize");
+  }
+  void* mapped = mmap(nullptr, static_cast<size_t>(body_size), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+  if (mapped == MAP_FAILED) {
+    return fail("Failed to map");
+  }
+  close(fd);
+
+  // Lay out the buffers as in the gRPC message body
+  uint8_t* out = reinterpret_cast<uint8_t*>(mapped);
+  for (const auto& buffer : ipc_msg.body_buffers) {
+    if (!buffer) continue;
+    const int64_t size = buffer->size();
+    const int64_t padded_size = BitUtil::RoundUpToMultipleOf8(size);
+    if (size > 0) {
+      std::memcpy(out, buffer->data(), static_cast<size_t>(size));
+    }
+    std::memset(out + size, 0, static_cast<size_t>(padded_size - size));
+    out += padded_size;
+  }
+  if (munmap(mapped, static_cast<size_t>(body_size)) == -1) {
+    Status st = ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed to unmap shared memory segment '", name, "'");
+    shm_unlink(name.c_str());
+    return st;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<Buffer> reference,
+      AllocateBuffer(kReferenceHeaderSize + static_cast<int64_t>(name.size())));
+  uint8_t* data = reference->mutable_data();
+  std::memcpy(data, kReferenceMagic, sizeof(kReferenceMagic));
+  const int64_t body_size_le = BitUtil::ToLittleEndian(body_size);
+  std::memcpy(data + sizeof(kReferenceMagic), &body_size_le, sizeof(body_size_le));
+  std::memcpy(data + kReferenceHeaderSize, name.data(), name.size());
+
+  ipc_msg.body_buffers = {reference};
+  ipc_msg.body_length = reference->size();
+  return Status::OK();
+}
+
+void DiscardSharedMemoryBody(const FlightPayload& payload) {
+  const auto& body_buffers = payload.ipc_message.body_buffers;
+  if (body_buffers.size() != 1 || body_buffers[0] == nullptr) {
+    return;
+  }
+  int64_t body_size;
+  std::string name;
+  if (ParseReference(*body_buffers[0], &body_size, &name)) {
+    // The segment is gone already if the peer received it
+    shm_unlink(name.c_str());
+  }
+}
+
+Status MapBodyFromSharedMemory(FlightData* data) {
+  if (data->body == nullptr || data->body->size() == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(data->CoalesceBody());
+  int64_t body_size;
+  std::string name;
+  if (!ParseReference(*data->body, &body_size, &name)) {
+    return Status::Invalid("Message body is not a shared memory reference");
+  }
+  if (!IsValidSegmentName(name)) {
+    return Status::Invalid("Invalid shared memory segment name in message body");
+  }
+  if (body_size <= 0) {
+    return Status::Invalid("Invalid shared memory body size: ", body_size);
+  }
+
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd == -1) {
+    return ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed to open shared memory segment '", name, "'");
+  }
+  struct stat st;
+  if (fstat(fd, &st) == -1) {
+    Status status = ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed to stat shared memory segment '", name, "'");
+    close(fd);
+    return status;
+  }
+  // Segments are created by a peer running as the same user, with
+  // owner-only permissions: leave any other object alone
+  if (st.st_uid != geteuid() || (st.st_mode & (S_IRWXG | S_IRWXO)) != 0) {
+    close(fd);
+    return Status::IOError("Shared memory segment '", name,
+                           "' is not owned by the current user");
+  }
+  if (st.st_size < body_size) {
+    close(fd);
+    return Status::IOError("Shared memory segment '", name, "' is truncated");
+  }
+  // The mapping keeps the segment alive once unlinked
+  shm_unlink(name.c_str());
+
+  void* mapped = mmap(nullptr, static_cast<size_t>(body_size), PROT_READ, MAP_SHARED, fd,
+                      0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    return ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed to map shared memory segment '", name, "'");
+  }
+  data->body = std::make_shared<SharedMemoryBuffer>(
+      reinterpret_cast<const uint8_t*>(mapped), body_size);
+  return Status::OK();
+}
+
+#endif  // _WIN32
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
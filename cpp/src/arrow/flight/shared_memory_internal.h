@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// Transfer of IPC message bodies through POSIX shared memory, used by
+// the grpc+shm transport between co-located clients and servers.
+//
+// The sender copies a message body into a fresh shared memory segment and
+// replaces it by a small reference naming the segment.  The receiver maps
+// the segment read-only and unlinks it, so that its buffers point directly
+// at the shared pages and the segment is reclaimed once they are released.
+// The sender unlinks the segment itself if the message can't be written.
+// Segments of messages which are written but never read (e.g. because the
+// call was cancelled) are left behind until the host reboots or they are
+// removed by hand from /dev/shm.
+
+#pragma once
+
+#include "arrow/flight/visibility.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+struct FlightPayload;
+
+namespace internal {
+
+struct FlightData;
+
+/// \brief Move the IPC body of a payload to a shared memory segment,
+/// replacing it by a reference to the segment.
+///
+/// Payloads without a body are left untouched.
+ARROW_FLIGHT_EXPORT
+Status MoveBodyToSharedMemory(FlightPayload* payload);
+
+/// \brief Unlink the segment of a payload prepared by MoveBodyToSharedMemory,
+/// after failing to send it.
+///
+/// Payloads whose body isn't a shared memory reference are ignored.
+ARROW_FLIGHT_EXPORT
+void DiscardSharedMemoryBody(const FlightPayload& payload);
+
+/// \brief Replace a shared memory reference written by MoveBodyToSharedMemory
+/// by a read-only mapping of the segment.
+///
+/// Only segments named as by MoveBodyToSharedMemory and owned by the current
+/// user are opened. Messages without a body are left untouched.
+ARROW_FLIGHT_EXPORT
+Status MapBodyFromSharedMemory(FlightData* data);
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -104,9 +104,11 @@ void TestServer::Start() {
     ARROW_CHECK(st.IsNotImplemented()) << st.ToString();
   }
 
+  std::vector<std::string> args = {"-port", str_port};
+  args.insert(args.end(), extra_args_.begin(), extra_args_.end());
   try {
     server_process_ = std::make_shared<bp::child>(
-        bp::search_path(executable_name_, search_path), "-port", str_port);
+        bp::search_path(executable_name_, search_path), bp::args(args));
   } catch (...) {
     std::stringstream ss;
     ss << "Failed to launch test server '" << executable_name_ << "', looked in ";
@@ -53,6 +53,12 @@ class ARROW_FLIGHT_EXPORT TestServer {
       : executable_name_(executable_name), port_(::arrow::GetListenPort()) {}
   explicit TestServer(const std::string& executable_name, int port)
       : executable_name_(executable_name), port_(port) {}
+  /// \param[in] extra_args arguments passed to the server after the port
+  TestServer(const std::string& executable_name, int port,
+             std::vector<std::string> extra_args)
+      : executable_name_(executable_name),
+        port_(port),
+        extra_args_(std::move(extra_args)) {}
 
   void Start();
 
@@ -65,6 +71,7 @@ class ARROW_FLIGHT_EXPORT TestServer {
  private:
   std::string executable_name_;
   int port_;
+  std::vector<std::string> extra_args_;
   std::shared_ptr<::boost::process::child> server_process_;
 };
 
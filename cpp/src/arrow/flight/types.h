@@ -268,6 +268,8 @@ ARROW_FLIGHT_EXPORT
 extern const char* kSchemeGrpcUnix;
 ARROW_FLIGHT_EXPORT
 extern const char* kSchemeGrpcTls;
+ARROW_FLIGHT_EXPORT
+extern const char* kSchemeGrpcShm;
 
 /// \brief A host location (a URI)
 struct ARROW_FLIGHT_EXPORT Location {
@@ -298,6 +300,16 @@ struct ARROW_FLIGHT_EXPORT Location {
   /// \param[out] location The resulting location
   static Status ForGrpcUnix(const std::string& path, Location* location);
 
+  /// \brief Initialize a location for a domain socket-based Flight
+  /// service that exchanges record batch bodies through shared memory
+  ///
+  /// Client and server must run on the same host.  Clients connecting to
+  /// such a server through a plain grpc+unix location still work, without
+  /// shared memory.
+  /// \param[in] path The path to the domain socket
+  /// \param[out] location The resulting location
+  static Status ForGrpcShm(const std::string& path, Location* location);
+
   /// \brief Get a representation of this URI as a string.
   std::string ToString() const;
 
@@ -18,10 +18,13 @@
 #include "arrow/gpu/cuda_arrow_ipc.h"
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
@@ -34,6 +37,7 @@
 #include "generated/Message_generated.h"
 
 #include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
 #include "arrow/gpu/cuda_memory.h"
 
 namespace arrow {
@@ -82,5 +86,154 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   return ReadRecordBatch(schema, buffer, pool).Value(out);
 }
 
+// ----------------------------------------------------------------------
+// CudaRecordBatchUploader
+
+class CudaRecordBatchUploader::Impl {
+ public:
+  Impl(std::shared_ptr<RecordBatchReader> reader, std::shared_ptr<CudaContext> context,
+       std::shared_ptr<CudaHostMemoryPool> staging_pool,
+       std::shared_ptr<CudaStream> streams[2])
+      : reader_(std::move(reader)),
+        context_(std::move(context)),
+        staging_pool_(std::move(staging_pool)),
+        streams_{std::move(streams[0]), std::move(streams[1])} {}
+
+  ~Impl() {
+    // The staging buffers must outlive the copies reading them
+    if (pending_.batch) {
+      ARROW_UNUSED(pending_.stream->Synchronize());
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const { return reader_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+    if (!started_) {
+      started_ = true;
+      RETURN_NOT_OK(StartUpload(&pending_));
+    }
+    if (!pending_.batch) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    Upload current = std::move(pending_);
+    pending_ = Upload();
+    // Read and stage the next batch while the current one is transferred
+    Status next_status = StartUpload(&pending_);
+    RETURN_NOT_OK(current.stream->Synchronize());
+    RETURN_NOT_OK(next_status);
+    *out = std::move(current.batch);
+    return Status::OK();
+  }
+
+ private:
+  struct Upload {
+    // The record batch on the device, valid once the stream is synchronized
+    std::shared_ptr<RecordBatch> batch;
+    std::vector<std::shared_ptr<Buffer>> staging;
+    std::shared_ptr<CudaStream> stream;
+  };
+
+  Status StartUpload(Upload* upload) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader_->ReadNext(&batch));
+    if (!batch) {
+      return Status::OK();
+    }
+    // Alternate between the streams, so that waiting for a batch does not
+    // wait for the copies of the next one
+    upload->stream = streams_[next_stream_];
+    next_stream_ ^= 1;
+    std::vector<std::shared_ptr<ArrayData>> columns(batch->num_columns());
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(columns[i], UploadArray(*batch->column_data(i), upload));
+    }
+    upload->batch =
+        RecordBatch::Make(batch->schema(), batch->num_rows(), std::move(columns));
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<ArrayData>> UploadArray(const ArrayData& data,
+                                                 Upload* upload) {
+    auto out = data.Copy();
+    // Computing the null count later would read device memory
+    out->null_count = data.GetNullCount();
+    for (auto& buffer : out->buffers) {
+      if (buffer != nullptr && buffer->is_cpu()) {
+        ARROW_ASSIGN_OR_RAISE(buffer, UploadBuffer(*buffer, upload));
+      }
+    }
+    for (auto& child : out->child_data) {
+      ARROW_ASSIGN_OR_RAISE(child, UploadArray(*child, upload));
+    }
+    if (out->dictionary != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(auto dictionary,
+                            UploadArray(*out->dictionary->data(), upload));
+      out->dictionary = MakeArray(dictionary);
+    }
+    return out;
+  }
+
+  Result<std::shared_ptr<Buffer>> UploadBuffer(const Buffer& buffer, Upload* upload) {
+    const int64_t nbytes = buffer.size();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<CudaBuffer> device_buffer,
+                          context_->Allocate(nbytes));
+    if (nbytes == 0) {
+      return device_buffer;
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> staging,
+                          AllocateBuffer(nbytes, staging_pool_.get()));
+    std::memcpy(staging->mutable_data(), buffer.data(), static_cast<size_t>(nbytes));
+    // The driver API is used directly rather than CudaBuffer::CopyFromHostAsync,
+    // to avoid a completion callback per buffer
+    internal::ContextSaver set_temporary(*context_);
+    CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                     cuMemcpyHtoDAsync(static_cast<CUdeviceptr>(device_buffer->address()),
+                                       staging->data(), static_cast<size_t>(nbytes),
+                                       reinterpret_cast<CUstream>(
+                                           upload->stream->handle())));
+    upload->staging.push_back(std::move(staging));
+    return device_buffer;
+  }
+
+  std::shared_ptr<RecordBatchReader> reader_;
+  std::shared_ptr<CudaContext> context_;
+  std::shared_ptr<CudaHostMemoryPool> staging_pool_;
+  std::shared_ptr<CudaStream> streams_[2];
+  int next_stream_ = 0;
+  bool started_ = false;
+  Upload pending_;
+};
+
+CudaRecordBatchUploader::CudaRecordBatchUploader(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+CudaRecordBatchUploader::~CudaRecordBatchUploader() {}
+
+Result<std::shared_ptr<CudaRecordBatchUploader>> CudaRecordBatchUploader::Make(
+    std::shared_ptr<RecordBatchReader> reader, std::shared_ptr<CudaContext> context,
+    std::shared_ptr<CudaHostMemoryPool> staging_pool) {
+  if (staging_pool == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(staging_pool,
+                          CudaHostMemoryPool::Make(context->device_number()));
+  }
+  std::shared_ptr<CudaStream> streams[2];
+  ARROW_ASSIGN_OR_RAISE(streams[0], CudaStream::Make(context));
+  ARROW_ASSIGN_OR_RAISE(streams[1], CudaStream::Make(context));
+  std::unique_ptr<Impl> impl(new Impl(std::move(reader), std::move(context),
+                                      std::move(staging_pool), streams));
+  return std::shared_ptr<CudaRecordBatchUploader>(
+      new CudaRecordBatchUploader(std::move(impl)));
+}
+
+std::shared_ptr<Schema> CudaRecordBatchUploader::schema() const {
+  return impl_->schema();
+}
+
+Status CudaRecordBatchUploader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
 }  // namespace cuda
 }  // namespace arrow
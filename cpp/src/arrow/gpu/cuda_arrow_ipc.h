@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 
@@ -62,6 +63,41 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const std::shared_ptr<Schema>& schema, const std::shared_ptr<CudaBuffer>& buffer,
     MemoryPool* pool = default_memory_pool());
 
+/// \class CudaRecordBatchUploader
+/// \brief A RecordBatchReader copying the record batches of another reader to
+/// a CUDA device
+///
+/// The host buffers of each batch are staged in page-locked memory and copied
+/// to the device asynchronously.  ReadNext() reads and stages the following
+/// batch before waiting for the copy of the batch it returns, so that reading
+/// (e.g. decoding) batch N+1 overlaps with transferring batch N.  At most two
+/// batches are staged at a time.  Buffers already on a device are not copied.
+class ARROW_EXPORT CudaRecordBatchUploader : public RecordBatchReader {
+ public:
+  /// \brief Create an uploader
+  /// \param[in] reader the reader of the host record batches
+  /// \param[in] context the context to allocate device memory from
+  /// \param[in] staging_pool a pinned memory pool for the device of context;
+  /// a new one is created if null
+  static Result<std::shared_ptr<CudaRecordBatchUploader>> Make(
+      std::shared_ptr<RecordBatchReader> reader, std::shared_ptr<CudaContext> context,
+      std::shared_ptr<CudaHostMemoryPool> staging_pool = NULLPTR);
+
+  /// \brief Wait for the pending transfer, if any
+  ~CudaRecordBatchUploader() override;
+
+  std::shared_ptr<Schema> schema() const override;
+
+  /// \brief Return the next batch, with its buffers on the device
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  class Impl;
+  explicit CudaRecordBatchUploader(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
 /// @}
 
 /// \brief Write record batch message to GPU device memory
@@ -0,0 +1,718 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cuda.h>
+#include <nvrtc.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
+#include "arrow/gpu/cuda_memory.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace cuda {
+
+using ::arrow::internal::checked_cast;
+using internal::ContextSaver;
+
+namespace {
+
+// The kernels, compiled with VALUE_T (the C type of the values) and SUM_T
+// (the C type of their sum) defined.  Every kernel loops over its range with
+// a grid stride, so that any grid size covers it.
+const char kKernelSource[] = R"cuda(
+#define GET_BIT(bits, i) (((bits)[(i) >> 3] >> ((i) & 7)) & 1)
+
+#define GRID_STRIDE_LOOP(i, n)                                                 \
+  for (long long i = blockIdx.x * (long long)blockDim.x + threadIdx.x; i < (n); \
+       i += (long long)gridDim.x * blockDim.x)
+
+// op is a compute::CompareOperator.  right_stride is 0 to compare with a
+// scalar.  Each thread writes a byte of the output bitmap.
+extern "C" __global__ void arrow_compare(const VALUE_T* left, const VALUE_T* right,
+                                         long long right_stride, long long length,
+                                         int op, unsigned char* out) {
+  GRID_STRIDE_LOOP(byte, (length + 7) / 8) {
+    unsigned char bits = 0;
+    for (long long i = byte * 8; i < byte * 8 + 8 && i < length; ++i) {
+      const VALUE_T l = left[i];
+      const VALUE_T r = right[i * right_stride];
+      bool result;
+      switch (op) {
+        case 0: result = l == r; break;
+        case 1: result = l != r; break;
+        case 2: result = l > r; break;
+        case 3: result = l >= r; break;
+        case 4: result = l < r; break;
+        default: result = l <= r; break;
+      }
+      bits |= (unsigned char)result << (i & 7);
+    }
+    out[byte] = bits;
+  }
+}
+
+#define SELECTED(i)                 \
+  (GET_BIT(filter, offset + (i)) && \
+   (validity == 0 || GET_BIT(validity, offset + (i))))
+
+// The number of selected slots in each chunk of 64 filter slots
+extern "C" __global__ void arrow_filter_count(const unsigned char* filter,
+                                              const unsigned char* validity,
+                                              long long offset, long long length,
+                                              long long* counts) {
+  GRID_STRIDE_LOOP(chunk, (length + 63) / 64) {
+    const long long end = min(chunk * 64 + 64, length);
+    long long count = 0;
+    for (long long i = chunk * 64; i < end; ++i) {
+      count += SELECTED(i);
+    }
+    counts[chunk] = count;
+  }
+}
+
+// Write the selected values of each chunk from its output position, the sum of
+// the counts of the previous chunks
+extern "C" __global__ void arrow_filter_scatter(const VALUE_T* values,
+                                                const unsigned char* filter,
+                                                const unsigned char* validity,
+                                                long long offset, long long length,
+                                                const long long* positions,
+                                                VALUE_T* out) {
+  GRID_STRIDE_LOOP(chunk, (length + 63) / 64) {
+    const long long end = min(chunk * 64 + 64, length);
+    long long position = positions[chunk];
+    for (long long i = chunk * 64; i < end; ++i) {
+      if (SELECTED(i)) {
+        out[position++] = values[i];
+      }
+    }
+  }
+}
+
+#define DEFINE_TAKE(INDEX_NAME, INDEX_T)                                           \
+  extern "C" __global__ void arrow_take_##INDEX_NAME(                              \
+      const VALUE_T* values, long long values_length, const INDEX_T* indices,      \
+      long long length, VALUE_T* out, int* out_of_bounds) {                        \
+    GRID_STRIDE_LOOP(i, length) {                                                  \
+      const long long index = (long long)indices[i];                               \
+      if (index < 0 || index >= values_length) {                                   \
+        *out_of_bounds = 1;                                                        \
+      } else {                                                                     \
+        out[i] = values[index];                                                    \
+      }                                                                            \
+    }                                                                              \
+  }
+
+DEFINE_TAKE(int8, signed char)
+DEFINE_TAKE(int16, short)
+DEFINE_TAKE(int32, int)
+DEFINE_TAKE(int64, long long)
+DEFINE_TAKE(uint8, unsigned char)
+DEFINE_TAKE(uint16, unsigned short)
+DEFINE_TAKE(uint32, unsigned int)
+DEFINE_TAKE(uint64, unsigned long long)
+
+// Sum the values into a partial sum per block.  blockDim.x must be 256.
+extern "C" __global__ void arrow_sum(const VALUE_T* values, long long length,
+                                     SUM_T* partials) {
+  __shared__ SUM_T block_sums[256];
+  SUM_T sum = 0;
+  GRID_STRIDE_LOOP(i, length) {
+    sum += values[i];
+  }
+  block_sums[threadIdx.x] = sum;
+  __syncthreads();
+  for (unsigned int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+    if (threadIdx.x < stride) {
+      block_sums[threadIdx.x] += block_sums[threadIdx.x + stride];
+    }
+    __syncthreads();
+  }
+  if (threadIdx.x == 0) {
+    partials[blockIdx.x] = block_sums[0];
+  }
+}
+
+// Whether the value at index a sorts before the one at index b.  The padding
+// past the values sorts last, NaNs before it, and ties are broken by index so
+// that the sort is stable.
+__device__ bool SortsBefore(const VALUE_T* values, long long length,
+                            unsigned long long a, unsigned long long b) {
+  if (a >= (unsigned long long)length) return false;
+  if (b >= (unsigned long long)length) return true;
+  const VALUE_T x = values[a];
+  const VALUE_T y = values[b];
+  const bool x_nan = x != x;
+  const bool y_nan = y != y;
+  if (x_nan || y_nan) {
+    return y_nan && (!x_nan || a < b);
+  }
+  return x < y || (!(y < x) && a < b);
+}
+
+extern "C" __global__ void arrow_sort_init(unsigned long long* indices,
+                                           long long padded_length) {
+  GRID_STRIDE_LOOP(i, padded_length) {
+    indices[i] = i;
+  }
+}
+
+// A step of a bitonic sort of the indices
+extern "C" __global__ void arrow_sort_step(const VALUE_T* values, long long length,
+                                           unsigned long long* indices,
+                                           long long padded_length, long long j,
+                                           long long k) {
+  GRID_STRIDE_LOOP(i, padded_length) {
+    const long long partner = i ^ j;
+    if (partner > i) {
+      const unsigned long long a = indices[i];
+      const unsigned long long b = indices[partner];
+      const bool ascending = (i & k) == 0;
+      if (ascending ? SortsBefore(values, length, b, a)
+                    : SortsBefore(values, length, a, b)) {
+        indices[i] = b;
+        indices[partner] = a;
+      }
+    }
+  }
+}
+)cuda";
+
+constexpr int kThreadsPerBlock = 256;
+constexpr int64_t kMaxBlocks = 1024;
+// The number of filter slots of a chunk of arrow_filter_count
+constexpr int64_t kFilterChunkSize = 64;
+
+#define NVRTC_RETURN_NOT_OK(FUNC_NAME, STMT)                                       \
+  do {                                                                             \
+    nvrtcResult __res = (STMT);                                                    \
+    if (__res != NVRTC_SUCCESS) {                                                  \
+      return Status::IOError("NVRTC error in function '", FUNC_NAME,               \
+                             "': ", nvrtcGetErrorString(__res));                   \
+    }                                                                              \
+  } while (0)
+
+bool IsSignedInteger(Type::type type_id) {
+  return type_id == Type::INT8 || type_id == Type::INT16 || type_id == Type::INT32 ||
+         type_id == Type::INT64;
+}
+
+// The C types of the values and their sum, for the value types supported on
+// CUDA devices
+Status GetKernelTypes(const DataType& type, std::string* value_type,
+                      std::string* sum_type) {
+  switch (type.id()) {
+    case Type::INT8:
+      *value_type = "signed char";
+      break;
+    case Type::INT16:
+      *value_type = "short";
+      break;
+    case Type::INT32:
+      *value_type = "int";
+      break;
+    case Type::INT64:
+      *value_type = "long long";
+      break;
+    case Type::UINT8:
+      *value_type = "unsigned char";
+      break;
+    case Type::UINT16:
+      *value_type = "unsigned short";
+      break;
+    case Type::UINT32:
+      *value_type = "unsigned int";
+      break;
+    case Type::UINT64:
+      *value_type = "unsigned long long";
+      break;
+    case Type::FLOAT:
+      *value_type = "float";
+      break;
+    case Type::DOUBLE:
+      *value_type = "double";
+      break;
+    default:
+      return Status::NotImplemented("Compute kernels on CUDA devices for type ",
+                                    type.ToString());
+  }
+  if (is_floating(type.id())) {
+    *sum_type = "double";
+  } else if (IsSignedInteger(type.id())) {
+    *sum_type = "long long";
+  } else {
+    *sum_type = "unsigned long long";
+  }
+  return Status::OK();
+}
+
+// The module of the kernels for a value type in a context
+class KernelModule {
+ public:
+  static Result<std::unique_ptr<KernelModule>> Make(const CudaContext& context,
+                                                    const DataType& type) {
+    std::string value_type, sum_type;
+    RETURN_NOT_OK(GetKernelTypes(type, &value_type, &sum_type));
+
+    int major, minor;
+    const auto device = static_cast<CUdevice>(context.device()->handle());
+    CU_RETURN_NOT_OK("cuDeviceGetAttribute",
+                     cuDeviceGetAttribute(
+                         &major, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR, device));
+    CU_RETURN_NOT_OK("cuDeviceGetAttribute",
+                     cuDeviceGetAttribute(
+                         &minor, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR, device));
+    const std::vector<std::string> options = {
+        "--gpu-architecture=compute_" + std::to_string(major) + std::to_string(minor),
+        "-DVALUE_T=" + value_type, "-DSUM_T=" + sum_type};
+    std::vector<const char*> option_pointers;
+    for (const auto& option : options) {
+      option_pointers.push_back(option.c_str());
+    }
+
+    nvrtcProgram program;
+    NVRTC_RETURN_NOT_OK("nvrtcCreateProgram",
+                        nvrtcCreateProgram(&program, kKernelSource, "arrow_kernels.cu",
+                                           0, nullptr, nullptr));
+    std::string ptx;
+    Status status = CompileProgram(program, option_pointers, &ptx);
+    nvrtcDestroyProgram(&program);
+    RETURN_NOT_OK(status);
+
+    std::unique_ptr<KernelModule> kernels(new KernelModule());
+    ContextSaver set_temporary(context);
+    CU_RETURN_NOT_OK("cuModuleLoadData",
+                     cuModuleLoadData(&kernels->module_, ptx.c_str()));
+    return std::move(kernels);
+  }
+
+  Result<CUfunction> GetFunction(const std::string& name) {
+    CUfunction function;
+    CU_RETURN_NOT_OK("cuModuleGetFunction",
+                     cuModuleGetFunction(&function, module_, name.c_str()));
+    return function;
+  }
+
+ private:
+  KernelModule() = default;
+
+  static Status CompileProgram(nvrtcProgram program,
+                               const std::vector<const char*>& options,
+                               std::string* ptx) {
+    nvrtcResult res = nvrtcCompileProgram(program, static_cast<int>(options.size()),
+                                          options.data());
+    if (res != NVRTC_SUCCESS) {
+      size_t log_size;
+      NVRTC_RETURN_NOT_OK("nvrtcGetProgramLogSize",
+                          nvrtcGetProgramLogSize(program, &log_size));
+      std::string log(log_size, '\0');
+      NVRTC_RETURN_NOT_OK("nvrtcGetProgramLog", nvrtcGetProgramLog(program, &log[0]));
+      return Status::IOError("Failed compiling CUDA compute kernels: ",
+                             nvrtcGetErrorString(res), "\n", log);
+    }
+    size_t ptx_size;
+    NVRTC_RETURN_NOT_OK("nvrtcGetPTXSize", nvrtcGetPTXSize(program, &ptx_size));
+    ptx->resize(ptx_size);
+    NVRTC_RETURN_NOT_OK("nvrtcGetPTX", nvrtcGetPTX(program, &(*ptx)[0]));
+    return Status::OK();
+  }
+
+  CUmodule module_;
+};
+
+// Look up a kernel, compiling the kernels for the value type on first use in
+// the context.  The modules stay loaded until the process exits.
+Result<CUfunction> GetKernel(const CudaContext& context, const DataType& type,
+                             const std::string& name) {
+  static std::mutex mutex;
+  static std::map<std::pair<void*, Type::type>, std::unique_ptr<KernelModule>> modules;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& module = modules[std::make_pair(context.handle(), type.id())];
+  if (!module) {
+    ARROW_ASSIGN_OR_RAISE(module, KernelModule::Make(context, type));
+  }
+  return module->GetFunction(name);
+}
+
+// Launch a kernel with enough threads to run one per work item, up to
+// kMaxBlocks blocks
+Status LaunchKernel(const CudaContext& context, CUfunction kernel, int64_t num_items,
+                    std::initializer_list<void*> args) {
+  if (num_items == 0) {
+    return Status::OK();
+  }
+  const auto num_blocks = static_cast<unsigned int>(
+      std::min(BitUtil::CeilDiv(num_items, kThreadsPerBlock), kMaxBlocks));
+  std::vector<void*> kernel_args(args);
+  ContextSaver set_temporary(context);
+  CU_RETURN_NOT_OK("cuLaunchKernel",
+                   cuLaunchKernel(kernel, num_blocks, 1, 1, kThreadsPerBlock, 1, 1, 0,
+                                  nullptr, kernel_args.data(), nullptr));
+  return Status::OK();
+}
+
+// The CUDA context of the device holding the buffers of the arrays, or null
+// if they are on the CPU
+Result<std::shared_ptr<CudaContext>> GetDeviceContext(
+    std::initializer_list<const Array*> arrays) {
+  std::shared_ptr<Device> device;
+  for (const Array* array : arrays) {
+    for (const auto& buffer : array->data()->buffers) {
+      if (!buffer) {
+        continue;
+      }
+      if (!device) {
+        device = buffer->device();
+      } else if (!device->Equals(*buffer->device())) {
+        return Status::Invalid("Compute kernel inputs reside on different devices: ",
+                               device->ToString(), " and ",
+                               buffer->device()->ToString());
+      }
+    }
+  }
+  if (!device || device->is_cpu()) {
+    return nullptr;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto cuda_device, AsCudaDevice(device));
+  return cuda_device->GetContext();
+}
+
+// The null count isn't computed, as the validity bitmap can't be read on the
+// host
+Status CheckNoNulls(const ArrayData& data) {
+  if (data.buffers[0] && data.null_count != 0) {
+    return Status::NotImplemented("Compute kernels on CUDA devices with nulls");
+  }
+  return Status::OK();
+}
+
+// The device address of the first value of a fixed-width array
+CUdeviceptr ValuesAddress(const ArrayData& data) {
+  const int bit_width = checked_cast<const FixedWidthType&>(*data.type).bit_width();
+  return static_cast<CUdeviceptr>(data.buffers[1]->address() +
+                                  data.offset * bit_width / 8);
+}
+
+CUdeviceptr BufferAddress(const Buffer& buffer) {
+  return static_cast<CUdeviceptr>(buffer.address());
+}
+
+Result<std::shared_ptr<Array>> FilterOnDevice(const std::shared_ptr<CudaContext>& context,
+                                              const ArrayData& values,
+                                              const ArrayData& filter) {
+  if (filter.type->id() != Type::BOOL) {
+    return Status::TypeError("Filter should be a boolean array, got ",
+                             filter.type->ToString());
+  }
+  if (values.length != filter.length) {
+    return Status::Invalid("Filter is not the same size as values");
+  }
+  RETURN_NOT_OK(CheckNoNulls(values));
+  ARROW_ASSIGN_OR_RAISE(auto count_kernel,
+                        GetKernel(*context, *values.type, "arrow_filter_count"));
+  ARROW_ASSIGN_OR_RAISE(auto scatter_kernel,
+                        GetKernel(*context, *values.type, "arrow_filter_scatter"));
+
+  // Count the selected slots of each chunk, and compute the output position
+  // of each chunk on the host
+  const int64_t num_chunks = BitUtil::CeilDiv(values.length, kFilterChunkSize);
+  const int64_t positions_size = std::max<int64_t>(num_chunks, 1) * sizeof(int64_t);
+  ARROW_ASSIGN_OR_RAISE(auto positions, context->Allocate(positions_size));
+
+  CUdeviceptr values_address = ValuesAddress(values);
+  CUdeviceptr filter_address = BufferAddress(*filter.buffers[1]);
+  CUdeviceptr validity_address =
+      filter.buffers[0] && filter.null_count != 0 ? BufferAddress(*filter.buffers[0]) : 0;
+  CUdeviceptr positions_address = BufferAddress(*positions);
+  long long offset = filter.offset;  // NOLINT
+  long long length = filter.length;  // NOLINT
+  RETURN_NOT_OK(LaunchKernel(*context, count_kernel, num_chunks,
+                             {&filter_address, &validity_address, &offset, &length,
+                              &positions_address}));
+
+  std::vector<int64_t> counts(num_chunks);
+  RETURN_NOT_OK(positions->CopyToHost(0, num_chunks * sizeof(int64_t), counts.data()));
+  int64_t out_length = 0;
+  for (auto& count : counts) {
+    const int64_t position = out_length;
+    out_length += count;
+    count = position;
+  }
+  RETURN_NOT_OK(positions->CopyFromHost(0, counts.data(), num_chunks * sizeof(int64_t)));
+
+  const int bit_width = checked_cast<const FixedWidthType&>(*values.type).bit_width();
+  ARROW_ASSIGN_OR_RAISE(auto out, context->Allocate(out_length * bit_width / 8));
+  CUdeviceptr out_address = BufferAddress(*out);
+  RETURN_NOT_OK(LaunchKernel(*context, scatter_kernel, num_chunks,
+                             {&values_address, &filter_address, &validity_address,
+                              &offset, &length, &positions_address, &out_address}));
+  RETURN_NOT_OK(context->Synchronize());
+  return MakeArray(ArrayData::Make(values.type, out_length, {nullptr, out}, 0));
+}
+
+Result<std::shared_ptr<Array>> TakeOnDevice(const std::shared_ptr<CudaContext>& context,
+                                            const ArrayData& values,
+                                            const ArrayData& indices) {
+  if (!is_integer(indices.type->id())) {
+    return Status::TypeError("Indices should be integers, got ",
+                             indices.type->ToString());
+  }
+  RETURN_NOT_OK(CheckNoNulls(values));
+  RETURN_NOT_OK(CheckNoNulls(indices));
+  ARROW_ASSIGN_OR_RAISE(
+      auto kernel,
+      GetKernel(*context, *values.type, "arrow_take_" + indices.type->ToString()));
+
+  const int bit_width = checked_cast<const FixedWidthType&>(*values.type).bit_width();
+  ARROW_ASSIGN_OR_RAISE(auto out, context->Allocate(indices.length * bit_width / 8));
+  ARROW_ASSIGN_OR_RAISE(auto out_of_bounds, context->Allocate(sizeof(int32_t)));
+  const int32_t in_bounds = 0;
+  RETURN_NOT_OK(out_of_bounds->CopyFromHost(0, &in_bounds, sizeof(int32_t)));
+
+  CUdeviceptr values_address = ValuesAddress(values);
+  long long values_length = values.length;  // NOLINT
+  CUdeviceptr indices_address = ValuesAddress(indices);
+  long long length = indices.length;  // NOLINT
+  CUdeviceptr out_address = BufferAddress(*out);
+  CUdeviceptr out_of_bounds_address = BufferAddress(*out_of_bounds);
+  RETURN_NOT_OK(LaunchKernel(*context, kernel, indices.length,
+                             {&values_address, &values_length, &indices_address, &length,
+                              &out_address, &out_of_bounds_address}));
+
+  int32_t error = 0;
+  RETURN_NOT_OK(out_of_bounds->CopyToHost(0, sizeof(int32_t), &error));
+  if (error) {
+    return Status::IndexError("take index out of bounds");
+  }
+  return MakeArray(ArrayData::Make(values.type, indices.length, {nullptr, out}, 0));
+}
+
+// Compare with right values advancing by right_stride (0 for a scalar)
+Result<std::shared_ptr<Array>> CompareOnDevice(
+    const std::shared_ptr<CudaContext>& context, const ArrayData& left,
+    CUdeviceptr right_address, int64_t right_stride, compute::CompareOptions options) {
+  RETURN_NOT_OK(CheckNoNulls(left));
+  ARROW_ASSIGN_OR_RAISE(auto kernel, GetKernel(*context, *left.type, "arrow_compare"));
+
+  ARROW_ASSIGN_OR_RAISE(auto out,
+                        context->Allocate(BitUtil::BytesForBits(left.length)));
+  CUdeviceptr left_address = ValuesAddress(left);
+  long long stride = right_stride;  // NOLINT
+  long long length = left.length;   // NOLINT
+  int op = static_cast<int>(options.op);
+  CUdeviceptr out_address = BufferAddress(*out);
+  RETURN_NOT_OK(LaunchKernel(*context, kernel, BitUtil::BytesForBits(left.length),
+                             {&left_address, &right_address, &stride, &length, &op,
+                              &out_address}));
+  RETURN_NOT_OK(context->Synchronize());
+  return MakeArray(ArrayData::Make(boolean(), left.length, {nullptr, out}, 0));
+}
+
+Result<std::shared_ptr<Scalar>> SumOnDevice(const std::shared_ptr<CudaContext>& context,
+                                            const ArrayData& values) {
+  RETURN_NOT_OK(CheckNoNulls(values));
+  ARROW_ASSIGN_OR_RAISE(auto kernel, GetKernel(*context, *values.type, "arrow_sum"));
+
+  // All the sum types are 8 bytes wide
+  const int64_t num_blocks = std::min(
+      BitUtil::CeilDiv(values.length, kThreadsPerBlock), kMaxBlocks);
+  ARROW_ASSIGN_OR_RAISE(auto partials,
+                        context->Allocate(std::max<int64_t>(num_blocks, 1) * 8));
+  CUdeviceptr values_address = ValuesAddress(values);
+  long long length = values.length;  // NOLINT
+  CUdeviceptr partials_address = BufferAddress(*partials);
+  RETURN_NOT_OK(LaunchKernel(*context, kernel, values.length,
+                             {&values_address, &length, &partials_address}));
+
+  std::vector<int64_t> partial_sums(num_blocks);
+  RETURN_NOT_OK(partials->CopyToHost(0, num_blocks * 8, partial_sums.data()));
+  if (is_floating(values.type->id())) {
+    if (values.length == 0) {
+      return std::make_shared<DoubleScalar>();
+    }
+    double sum = 0;
+    for (const int64_t partial : partial_sums) {
+      sum += util::SafeCopy<double>(partial);
+    }
+    return std::make_shared<DoubleScalar>(sum);
+  }
+  // Integer sums wrap around, so unsigned partials can be added as signed ones
+  uint64_t sum = 0;
+  for (const int64_t partial : partial_sums) {
+    sum += static_cast<uint64_t>(partial);
+  }
+  if (IsSignedInteger(values.type->id())) {
+    if (values.length == 0) {
+      return std::make_shared<Int64Scalar>();
+    }
+    return std::make_shared<Int64Scalar>(static_cast<int64_t>(sum));
+  }
+  if (values.length == 0) {
+    return std::make_shared<UInt64Scalar>();
+  }
+  return std::make_shared<UInt64Scalar>(sum);
+}
+
+Result<std::shared_ptr<Array>> SortToIndicesOnDevice(
+    const std::shared_ptr<CudaContext>& context, const ArrayData& values) {
+  RETURN_NOT_OK(CheckNoNulls(values));
+  ARROW_ASSIGN_OR_RAISE(auto init_kernel,
+                        GetKernel(*context, *values.type, "arrow_sort_init"));
+  ARROW_ASSIGN_OR_RAISE(auto step_kernel,
+                        GetKernel(*context, *values.type, "arrow_sort_step"));
+
+  // A bitonic sort of the indices, padded to a power of two
+  long long padded_length =  // NOLINT
+      BitUtil::NextPower2(std::max<int64_t>(values.length, 1));
+  ARROW_ASSIGN_OR_RAISE(auto indices,
+                        context->Allocate(padded_length * sizeof(uint64_t)));
+  CUdeviceptr values_address = ValuesAddress(values);
+  long long length = values.length;  // NOLINT
+  CUdeviceptr indices_address = BufferAddress(*indices);
+  RETURN_NOT_OK(LaunchKernel(*context, init_kernel, padded_length,
+                             {&indices_address, &padded_length}));
+  for (long long k = 2; k <= padded_length; k <<= 1) {  // NOLINT
+    for (long long j = k >> 1; j > 0; j >>= 1) {        // NOLINT
+      RETURN_NOT_OK(LaunchKernel(*context, step_kernel, padded_length,
+                                 {&values_address, &length, &indices_address,
+                                  &padded_length, &j, &k}));
+    }
+  }
+  RETURN_NOT_OK(context->Synchronize());
+  return MakeArray(ArrayData::Make(uint64(), values.length, {nullptr, indices}, 0));
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Array>> Filter(const Array& values, const Array& filter) {
+  ARROW_ASSIGN_OR_RAISE(auto context, GetDeviceContext({&values, &filter}));
+  if (context) {
+    return FilterOnDevice(context, *values.data(), *filter.data());
+  }
+  compute::FunctionContext ctx;
+  compute::Datum out;
+  RETURN_NOT_OK(compute::Filter(&ctx, compute::Datum(values.data()),
+                                compute::Datum(filter.data()),
+                                compute::FilterOptions(), &out));
+  return out.make_array();
+}
+
+Result<std::shared_ptr<Array>> Take(const Array& values, const Array& indices) {
+  ARROW_ASSIGN_OR_RAISE(auto context, GetDeviceContext({&values, &indices}));
+  if (context) {
+    return TakeOnDevice(context, *values.data(), *indices.data());
+  }
+  compute::FunctionContext ctx;
+  std::shared_ptr<Array> out;
+  RETURN_NOT_OK(compute::Take(&ctx, values, indices, compute::TakeOptions(), &out));
+  return out;
+}
+
+Result<std::shared_ptr<Array>> Compare(const Array& left, const Array& right,
+                                       compute::CompareOptions options) {
+  ARROW_ASSIGN_OR_RAISE(auto context, GetDeviceContext({&left, &right}));
+  if (context) {
+    if (!left.type()->Equals(*right.type()) || left.length() != right.length()) {
+      return Status::Invalid("Compared arrays must have the same type and length");
+    }
+    RETURN_NOT_OK(CheckNoNulls(*right.data()));
+    return CompareOnDevice(context, *left.data(), ValuesAddress(*right.data()), 1,
+                           options);
+  }
+  compute::FunctionContext ctx;
+  compute::Datum out;
+  RETURN_NOT_OK(compute::Compare(&ctx, compute::Datum(left.data()),
+                                 compute::Datum(right.data()), options, &out));
+  return out.make_array();
+}
+
+Result<std::shared_ptr<Array>> Compare(const Array& left,
+                                       const std::shared_ptr<Scalar>& right,
+                                       compute::CompareOptions options) {
+  ARROW_ASSIGN_OR_RAISE(auto context, GetDeviceContext({&left}));
+  if (context) {
+    if (!left.type()->Equals(*right->type)) {
+      return Status::Invalid("Compared scalar must have the type of the array");
+    }
+    if (!right->is_valid) {
+      return Status::NotImplemented("Compute kernels on CUDA devices with nulls");
+    }
+    // Copy the scalar value to the device
+    ARROW_ASSIGN_OR_RAISE(auto host_value, MakeArrayFromScalar(*right, 1));
+    const auto& value_buffer = host_value->data()->buffers[1];
+    ARROW_ASSIGN_OR_RAISE(auto device_value, context->Allocate(value_buffer->size()));
+    RETURN_NOT_OK(
+        device_value->CopyFromHost(0, value_buffer->data(), value_buffer->size()));
+    return CompareOnDevice(context, *left.data(), BufferAddress(*device_value), 0,
+                           options);
+  }
+  compute::FunctionContext ctx;
+  compute::Datum out;
+  RETURN_NOT_OK(compute::Compare(&ctx, compute::Datum(left.data()),
+                                 compute::Datum(right), options, &out));
+  return out.make_array();
+}
+
+Result<std::shared_ptr<Scalar>> Sum(const Array& values) {
+  ARROW_ASSIGN_OR_RAISE(auto context, GetDeviceContext({&values}));
+  if (context) {
+    return SumOnDevice(context, *values.data());
+  }
+  compute::FunctionContext ctx;
+  compute::Datum out;
+  RETURN_NOT_OK(compute::Sum(&ctx, values, &out));
+  return out.scalar();
+}
+
+Result<std::shared_ptr<Array>> SortToIndices(const Array& values) {
+  ARROW_ASSIGN_OR_RAISE(auto context, GetDeviceContext({&values}));
+  if (context) {
+    return SortToIndicesOnDevice(context, *values.data());
+  }
+  compute::FunctionContext ctx;
+  std::shared_ptr<Array> out;
+  RETURN_NOT_OK(compute::SortToIndices(&ctx, values, &out));
+  return out;
+}
+
+}  // namespace cuda
+}  // namespace arrow
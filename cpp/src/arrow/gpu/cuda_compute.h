@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Compute kernels dispatching on the device of their inputs.  API should be
+// considered experimental for now
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/result.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class Scalar;
+
+namespace cuda {
+
+// The kernels below look at the devices of the buffers of their inputs (as
+// given by Buffer::device()).  Inputs residing on the CPU are handed to the
+// arrow::compute kernel of the same name.  Inputs residing on a CUDA device
+// are processed there, without copying them to the host, and the results are
+// allocated on the same device.  Inputs spread over several devices are an
+// error.
+//
+// On CUDA devices, the values must be of an integer or floating-point type
+// and have no nulls.  The kernels are compiled at runtime with NVRTC, once per
+// CUDA context and value type.
+
+/// \defgroup cuda-compute-functions Compute functions for CUDA devices
+///
+/// @{
+
+/// \brief Select the values whose slot of a boolean filter is true
+///
+/// Null filter slots are dropped, as with compute::FilterOptions::DROP.
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Filter(const Array& values, const Array& filter);
+
+/// \brief Take the values at the given integer indices
+///
+/// On CUDA devices, the indices must have no nulls.  An out of bounds index
+/// is an IndexError.
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Take(const Array& values, const Array& indices);
+
+/// \brief Compare two arrays of the same type and length element-wise
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Compare(const Array& left, const Array& right,
+                                       compute::CompareOptions options);
+
+/// \brief Compare an array with a scalar of the same type element-wise
+///
+/// The scalar resides on the host.
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Compare(const Array& left,
+                                       const std::shared_ptr<Scalar>& right,
+                                       compute::CompareOptions options);
+
+/// \brief Sum the values of a numeric array
+///
+/// The sum is returned on the host, as an int64, uint64 or double scalar like
+/// compute::Sum.  On CUDA devices, floating-point values are added in a
+/// different order than on the CPU, which may round the result differently.
+ARROW_EXPORT
+Result<std::shared_ptr<Scalar>> Sum(const Array& values);
+
+/// \brief Return the uint64 indices that would stably sort an array
+///
+/// On CUDA devices, NaNs are sorted after all the other values.
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortToIndices(const Array& values);
+
+/// @}
+
+}  // namespace cuda
+}  // namespace arrow
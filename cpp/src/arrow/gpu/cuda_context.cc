@@ -31,6 +31,7 @@
 #include "arrow/gpu/cuda_internal.h"
 #include "arrow/gpu/cuda_memory.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -697,5 +698,64 @@ Status CudaContext::GetDeviceAddress(uint8_t* addr, uint8_t** devaddr) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// CudaStream implementation
+
+namespace {
+
+// The callback of CudaStream::Completion().  CUDA stream callbacks may not
+// call the CUDA API, so the Future is marked finished from another thread.
+void CUDA_CB MarkStreamFutureFinished(CUstream stream, CUresult res, void* data) {
+  std::unique_ptr<Future<void>> future(static_cast<Future<void>*>(data));
+  Status status = internal::StatusFromCuda(res, "CUDA stream");
+  Future<void> finished = *future;
+  Status spawned = ::arrow::internal::GetCpuThreadPool()->Spawn(
+      [finished, status]() mutable { finished.MarkFinished(status); });
+  if (!spawned.ok()) {
+    // The thread pool is shutting down
+    future->MarkFinished(status);
+  }
+}
+
+}  // namespace
+
+CudaStream::CudaStream(std::shared_ptr<CudaContext> context, void* handle)
+    : context_(std::move(context)), handle_(handle) {}
+
+CudaStream::~CudaStream() {
+  // Work still enqueued is done before the stream's resources are released
+  ContextSaver set_temporary(*context_);
+  cuStreamDestroy(reinterpret_cast<CUstream>(handle_));
+}
+
+Result<std::shared_ptr<CudaStream>> CudaStream::Make(
+    std::shared_ptr<CudaContext> context) {
+  ContextSaver set_temporary(*context);
+  CUstream stream;
+  CU_RETURN_NOT_OK("cuStreamCreate", cuStreamCreate(&stream, CU_STREAM_NON_BLOCKING));
+  return std::shared_ptr<CudaStream>(new CudaStream(std::move(context), stream));
+}
+
+Future<void> CudaStream::Completion() {
+  auto future = Future<void>::Make();
+  auto callback_future = new Future<void>(future);
+  ContextSaver set_temporary(*context_);
+  CUresult res = cuStreamAddCallback(reinterpret_cast<CUstream>(handle_),
+                                     MarkStreamFutureFinished, callback_future, 0);
+  if (res != CUDA_SUCCESS) {
+    delete callback_future;
+    return Future<void>::MakeFinished(
+        internal::StatusFromCuda(res, "cuStreamAddCallback"));
+  }
+  return future;
+}
+
+Status CudaStream::Synchronize() {
+  ContextSaver set_temporary(*context_);
+  CU_RETURN_NOT_OK("cuStreamSynchronize",
+                   cuStreamSynchronize(reinterpret_cast<CUstream>(handle_)));
+  return Status::OK();
+}
+
 }  // namespace cuda
 }  // namespace arrow
@@ -23,6 +23,7 @@
 
 #include "arrow/device.h"
 #include "arrow/result.h"
+#include "arrow/util/future.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -36,6 +37,7 @@ class CudaBuffer;
 class CudaHostBuffer;
 class CudaIpcMemHandle;
 class CudaMemoryManager;
+class CudaStream;
 
 // XXX Should CudaContext be merged into CudaMemoryManager?
 
@@ -372,5 +374,40 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \endcond
 };
 
+/// \class CudaStream
+/// \brief A CUDA stream, ordering asynchronous work on a device
+///
+/// The work enqueued on a stream, e.g. asynchronous copies, runs in order,
+/// concurrently with the host and with the work enqueued on other streams.
+class ARROW_EXPORT CudaStream {
+ public:
+  ~CudaStream();
+
+  /// \brief Create a stream in the given context
+  static Result<std::shared_ptr<CudaStream>> Make(std::shared_ptr<CudaContext> context);
+
+  /// \brief Return a Future finished when the work enqueued so far is done
+  ///
+  /// The Future is marked finished from a thread of the CPU thread pool, so
+  /// its callbacks may call the CUDA API (unlike CUDA stream callbacks).
+  Future<void> Completion();
+
+  /// \brief Block until the work enqueued so far is done
+  Status Synchronize();
+
+  const std::shared_ptr<CudaContext>& context() const { return context_; }
+
+  /// \brief Expose the CUDA stream handle to other libraries
+  ///
+  /// The returned value should be interpreted as `CUstream`.
+  void* handle() const { return handle_; }
+
+ private:
+  CudaStream(std::shared_ptr<CudaContext> context, void* handle);
+
+  std::shared_ptr<CudaContext> context_;
+  void* handle_;
+};
+
 }  // namespace cuda
 }  // namespace arrow
@@ -20,9 +20,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <cuda.h>
 
@@ -30,6 +33,7 @@
 #include "arrow/io/memory.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/gpu/cuda_context.h"
@@ -188,6 +192,45 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(mutable_data_ + position, data, nbytes);
 }
 
+Future<void> CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                         void* out, CudaStream* stream) const {
+  if (nbytes > size_ - position) {
+    return Future<void>::MakeFinished(Status::Invalid("Copy would overflow buffer"));
+  }
+  if (stream->context()->handle() != context_->handle()) {
+    return Future<void>::MakeFinished(
+        Status::Invalid("Stream is not in the context of the buffer"));
+  }
+  ContextSaver set_temporary(*context_);
+  CUresult res = cuMemcpyDtoHAsync(out, address() + position, static_cast<size_t>(nbytes),
+                                   reinterpret_cast<CUstream>(stream->handle()));
+  if (res != CUDA_SUCCESS) {
+    return Future<void>::MakeFinished(
+        internal::StatusFromCuda(res, "cuMemcpyDtoHAsync"));
+  }
+  return stream->Completion();
+}
+
+Future<void> CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                           int64_t nbytes, CudaStream* stream) {
+  if (nbytes > size_ - position) {
+    return Future<void>::MakeFinished(Status::Invalid("Copy would overflow buffer"));
+  }
+  if (stream->context()->handle() != context_->handle()) {
+    return Future<void>::MakeFinished(
+        Status::Invalid("Stream is not in the context of the buffer"));
+  }
+  ContextSaver set_temporary(*context_);
+  CUresult res =
+      cuMemcpyHtoDAsync(address() + position, data, static_cast<size_t>(nbytes),
+                        reinterpret_cast<CUstream>(stream->handle()));
+  if (res != CUDA_SUCCESS) {
+    return Future<void>::MakeFinished(
+        internal::StatusFromCuda(res, "cuMemcpyHtoDAsync"));
+  }
+  return stream->Completion();
+}
+
 Status CudaBuffer::CopyFromDevice(const int64_t position, const void* data,
                                   int64_t nbytes) {
   if (nbytes > size_ - position) {
@@ -230,6 +273,156 @@ Result<uintptr_t> CudaHostBuffer::GetDeviceAddress(
   return ::arrow::cuda::GetDeviceAddress(data(), ctx);
 }
 
+// ----------------------------------------------------------------------
+// CudaHostMemoryPool
+
+namespace {
+
+// Allocations are rounded up to at least a page
+constexpr int64_t kMinHostAllocation = 4096;
+
+constexpr size_t kAlignment = 64;
+
+alignas(kAlignment) uint8_t zero_size_area[1];
+
+int64_t HostAllocationSize(int64_t size) {
+  return BitUtil::NextPower2(std::max(size, kMinHostAllocation));
+}
+
+}  // namespace
+
+constexpr int64_t CudaHostMemoryPool::kDefaultMaxCachedBytes;
+
+class CudaHostMemoryPool::CudaHostMemoryPoolImpl {
+ public:
+  CudaHostMemoryPoolImpl(std::shared_ptr<CudaDevice> device, int64_t max_cached_bytes)
+      : device_(std::move(device)), max_cached_bytes_(max_cached_bytes) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    const int64_t allocation_size = HostAllocationSize(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& free_list = free_lists_[allocation_size];
+      if (!free_list.empty()) {
+        *out = free_list.back();
+        free_list.pop_back();
+        bytes_cached_ -= allocation_size;
+        stats_.UpdateAllocatedBytes(size);
+        return Status::OK();
+      }
+    }
+    // Page-lock new memory without holding the lock
+    ARROW_ASSIGN_OR_RAISE(auto buffer, device_->AllocateHostBuffer(allocation_size));
+    std::lock_guard<std::mutex> lock(mutex_);
+    *out = buffer->mutable_data();
+    allocations_[*out] = std::move(buffer);
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (old_size > 0 && new_size > 0 &&
+        HostAllocationSize(old_size) == HostAllocationSize(new_size)) {
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (size == 0) {
+      DCHECK_EQ(buffer, zero_size_area);
+      return;
+    }
+    const int64_t allocation_size = HostAllocationSize(size);
+    std::shared_ptr<CudaHostBuffer> released;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.UpdateAllocatedBytes(-size);
+      if (bytes_cached_ + allocation_size <= max_cached_bytes_) {
+        free_lists_[allocation_size].push_back(buffer);
+        bytes_cached_ += allocation_size;
+        return;
+      }
+      auto it = allocations_.find(buffer);
+      DCHECK(it != allocations_.end());
+      released = std::move(it->second);
+      allocations_.erase(it);
+    }
+    // The memory is unlocked by the CudaHostBuffer destructor
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_cached_;
+  }
+
+ private:
+  std::shared_ptr<CudaDevice> device_;
+  const int64_t max_cached_bytes_;
+  ::arrow::internal::MemoryPoolStats stats_;
+
+  mutable std::mutex mutex_;
+  // All the page-locked allocations, by address
+  std::unordered_map<uint8_t*, std::shared_ptr<CudaHostBuffer>> allocations_;
+  // The free allocations, by size
+  std::unordered_map<int64_t, std::vector<uint8_t*>> free_lists_;
+  int64_t bytes_cached_ = 0;
+};
+
+CudaHostMemoryPool::CudaHostMemoryPool(std::unique_ptr<CudaHostMemoryPoolImpl> impl)
+    : impl_(std::move(impl)) {}
+
+CudaHostMemoryPool::~CudaHostMemoryPool() {}
+
+Result<std::shared_ptr<CudaHostMemoryPool>> CudaHostMemoryPool::Make(
+    int device_number, int64_t max_cached_bytes) {
+  ARROW_ASSIGN_OR_RAISE(auto device, CudaDevice::Make(device_number));
+  std::unique_ptr<CudaHostMemoryPoolImpl> impl(
+      new CudaHostMemoryPoolImpl(std::move(device), max_cached_bytes));
+  return std::shared_ptr<CudaHostMemoryPool>(new CudaHostMemoryPool(std::move(impl)));
+}
+
+Status CudaHostMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status CudaHostMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void CudaHostMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t CudaHostMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CudaHostMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string CudaHostMemoryPool::backend_name() const { return "cuda_host"; }
+
+int64_t CudaHostMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
 // ----------------------------------------------------------------------
 // CudaBufferReader
 
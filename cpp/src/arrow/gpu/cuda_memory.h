@@ -22,13 +22,16 @@
 
 #include "arrow/buffer.h"
 #include "arrow/io/concurrency.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 namespace cuda {
 
 class CudaContext;
 class CudaIpcMemHandle;
+class CudaStream;
 
 /// \class CudaBuffer
 /// \brief An Arrow buffer located on a GPU device
@@ -81,6 +84,32 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Enqueue a copy of memory from GPU device to CPU host on a stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream a stream of this buffer's context
+  /// \return a Future finished when the copy is done
+  ///
+  /// \note The copy only overlaps with the host's work if the host memory is
+  /// page-locked, e.g. allocated from a CudaHostMemoryPool.  The host memory
+  /// must stay valid until the copy is done.
+  Future<void> CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                               CudaStream* stream) const;
+
+  /// \brief Enqueue a copy of memory to device at position on a stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream a stream of this buffer's context
+  /// \return a Future finished when the copy is done
+  ///
+  /// \note The copy only overlaps with the host's work if the host memory is
+  /// page-locked, e.g. allocated from a CudaHostMemoryPool.  The host memory
+  /// must stay valid until the copy is done.
+  Future<void> CopyFromHostAsync(const int64_t position, const void* data,
+                                 int64_t nbytes, CudaStream* stream);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -137,6 +166,51 @@ class ARROW_EXPORT CudaHostBuffer : public MutableBuffer {
   Result<uintptr_t> GetDeviceAddress(const std::shared_ptr<CudaContext>& ctx);
 };
 
+/// \class CudaHostMemoryPool
+/// \brief A MemoryPool of page-locked host memory, reusing freed allocations
+///
+/// The memory is allocated with cuMemHostAlloc, like CudaHostBuffer, so the
+/// device can copy it asynchronously (see CudaBuffer::CopyFromHostAsync).
+/// Page-locking memory is expensive, so allocations are rounded up to a power
+/// of two and freed allocations are kept for reuse by later allocations of
+/// the same rounded size, up to max_cached_bytes in total.  Kept allocations
+/// are released when the pool is destroyed, which must outlive the buffers
+/// allocated from it.
+class ARROW_EXPORT CudaHostMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMaxCachedBytes = 256 << 20;
+
+  /// \brief Create a pool of memory with fast access to a device
+  /// \param[in] device_number the CUDA device number
+  /// \param[in] max_cached_bytes the largest number of bytes of freed
+  ///   allocations kept for reuse
+  static Result<std::shared_ptr<CudaHostMemoryPool>> Make(
+      int device_number, int64_t max_cached_bytes = kDefaultMaxCachedBytes);
+
+  ~CudaHostMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes of freed allocations kept for reuse
+  int64_t bytes_cached() const;
+
+ private:
+  class CudaHostMemoryPoolImpl;
+
+  explicit CudaHostMemoryPool(std::unique_ptr<CudaHostMemoryPoolImpl> impl);
+
+  std::unique_ptr<CudaHostMemoryPoolImpl> impl_;
+};
+
 /// \class CudaIpcHandle
 /// \brief A container for a CUDA IPC handle
 class ARROW_EXPORT CudaIpcMemHandle {
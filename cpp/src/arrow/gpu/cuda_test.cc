@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
 
@@ -29,9 +30,11 @@
 #include "arrow/ipc/test_common.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 
 #include "arrow/gpu/cuda_api.h"
+#include "arrow/gpu/cuda_compute.h"
 #include "arrow/gpu/cuda_internal.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/macros.h"
@@ -251,6 +254,31 @@ TEST_F(TestCudaBuffer, CopyFromHost) {
   AssertCudaBufferEquals(*device_buffer, *host_buffer);
 }
 
+TEST_F(TestCudaBuffer, CopyAsync) {
+  const int64_t kSize = 1000;
+  ASSERT_OK_AND_ASSIGN(auto stream, CudaStream::Make(context_));
+  ASSERT_OK_AND_ASSIGN(auto pool, CudaHostMemoryPool::Make(kGpuNumber));
+  ASSERT_OK_AND_ASSIGN(auto device_buffer, context_->Allocate(kSize));
+
+  std::shared_ptr<ResizableBuffer> host_buffer;
+  ASSERT_OK(MakeRandomByteBuffer(kSize, pool.get(), &host_buffer));
+  ASSERT_OK_AND_ASSIGN(auto result, AllocateBuffer(kSize, pool.get()));
+
+  auto copied_from = device_buffer->CopyFromHostAsync(0, host_buffer->data(), kSize,
+                                                      stream.get());
+  auto copied_to = device_buffer->CopyToHostAsync(0, kSize, result->mutable_data(),
+                                                  stream.get());
+  ASSERT_OK(copied_from.status());
+  ASSERT_OK(copied_to.status());
+  AssertBufferEqual(*result, *host_buffer);
+
+  ASSERT_OK(stream->Synchronize());
+  ASSERT_RAISES(Invalid, device_buffer
+                             ->CopyFromHostAsync(1, host_buffer->data(), kSize,
+                                                 stream.get())
+                             .status());
+}
+
 TEST_F(TestCudaBuffer, FromBuffer) {
   const int64_t kSize = 1000;
   // Initialize device buffer with random data
@@ -377,6 +405,47 @@ TEST_F(TestCudaHostBuffer, ViewOnDevice) {
   ASSERT_EQ(buffer->parent(), device_buffer);
 }
 
+TEST_F(TestCudaHostBuffer, MemoryPool) {
+  ASSERT_OK_AND_ASSIGN(auto pool, CudaHostMemoryPool::Make(kGpuNumber));
+  ASSERT_EQ(pool->backend_name(), "cuda_host");
+
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(1000, &data));
+  ASSERT_EQ(pool->bytes_allocated(), 1000);
+  // The memory is page-locked, so the device can address it
+  ASSERT_OK_AND_ASSIGN(auto device_address, context_->GetDeviceAddress(data));
+  ASSERT_NE(device_address, 0);
+
+  pool->Free(data, 1000);
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+  ASSERT_GT(pool->bytes_cached(), 0);
+
+  // An allocation of the same rounded size reuses the freed one
+  uint8_t* reused;
+  ASSERT_OK(pool->Allocate(900, &reused));
+  ASSERT_EQ(reused, data);
+  ASSERT_EQ(pool->bytes_cached(), 0);
+
+  // Reallocation preserves the contents
+  std::memset(reused, 42, 900);
+  ASSERT_OK(pool->Reallocate(900, 100000, &reused));
+  for (int i = 0; i < 900; ++i) {
+    ASSERT_EQ(reused[i], 42);
+  }
+  pool->Free(reused, 100000);
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+}
+
+TEST_F(TestCudaHostBuffer, MemoryPoolNoCache) {
+  ASSERT_OK_AND_ASSIGN(auto pool,
+                       CudaHostMemoryPool::Make(kGpuNumber, /*max_cached_bytes=*/0));
+  ASSERT_OK_AND_ASSIGN(auto buffer, AllocateBuffer(1000, pool.get()));
+  ASSERT_EQ(pool->bytes_allocated(), 1000);
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+  ASSERT_EQ(pool->bytes_cached(), 0);
+}
+
 // ------------------------------------------------------------------------
 // Test CudaBufferWriter
 
@@ -579,5 +648,184 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+TEST_F(TestCudaArrowIpc, RecordBatchUploader) {
+  std::vector<std::shared_ptr<RecordBatch>> batches(3);
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batches[0]));
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batches[1]));
+  batches[2] = batches[0]->Slice(10);
+  auto schema = batches[0]->schema();
+
+  ASSERT_OK_AND_ASSIGN(auto pool, CudaHostMemoryPool::Make(kGpuNumber));
+  ASSERT_OK_AND_ASSIGN(
+      auto uploader,
+      CudaRecordBatchUploader::Make(std::make_shared<BatchIterator>(schema, batches),
+                                    context_, pool));
+  ASSERT_EQ(uploader->schema(), schema);
+
+  for (const auto& batch : batches) {
+    std::shared_ptr<RecordBatch> device_batch;
+    ASSERT_OK(uploader->ReadNext(&device_batch));
+    ASSERT_NE(device_batch, nullptr);
+    ASSERT_EQ(device_batch->num_rows(), batch->num_rows());
+
+    std::vector<std::shared_ptr<Array>> columns;
+    for (const auto& column : device_batch->columns()) {
+      auto data = column->data()->Copy();
+      for (auto& buffer : data->buffers) {
+        if (buffer) {
+          ASSERT_FALSE(buffer->is_cpu());
+          ASSERT_OK_AND_ASSIGN(buffer, Buffer::Copy(buffer, cpu_mm_));
+        }
+      }
+      columns.push_back(MakeArray(data));
+    }
+    CompareBatch(*batch, *RecordBatch::Make(schema, batch->num_rows(), columns));
+  }
+  std::shared_ptr<RecordBatch> end;
+  ASSERT_OK(uploader->ReadNext(&end));
+  ASSERT_EQ(end, nullptr);
+  // The staging buffers were released to the pool
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+}
+
+// ------------------------------------------------------------------------
+// Test compute kernels
+
+class TestCudaCompute : public TestCudaBase {
+ protected:
+  // Copy the buffers of an array to a memory manager
+  std::shared_ptr<Array> CopyArray(const std::shared_ptr<Array>& array,
+                                   const std::shared_ptr<MemoryManager>& mm) {
+    auto data = array->data()->Copy();
+    for (auto& buffer : data->buffers) {
+      if (buffer) {
+        buffer = Buffer::Copy(buffer, mm).ValueOrDie();
+      }
+    }
+    return MakeArray(data);
+  }
+
+  std::shared_ptr<Array> ToDevice(const std::shared_ptr<Array>& array) {
+    return CopyArray(array, mm_);
+  }
+
+  // Check a result computed on the device against the one computed on the host
+  void AssertDeviceResult(const Result<std::shared_ptr<Array>>& device_result,
+                          const Result<std::shared_ptr<Array>>& host_result) {
+    ASSERT_OK_AND_ASSIGN(auto expected, host_result);
+    ASSERT_OK_AND_ASSIGN(auto actual, device_result);
+    ASSERT_TRUE(IsCudaDevice(*actual->data()->buffers[1]->device()));
+    AssertArraysEqual(*expected, *CopyArray(actual, cpu_mm_));
+  }
+};
+
+TEST_F(TestCudaCompute, Filter) {
+  auto filter = ArrayFromJSON(
+      boolean(), "[true, false, null, true, true, false, true, null, true, false]");
+  for (const auto& type : {int8(), uint16(), int32(), int64(), float64()}) {
+    SCOPED_TRACE("type = " + type->ToString());
+    auto values = ArrayFromJSON(type, "[1, 2, 3, 4, 5, 6, 7, 8, 9, 10]");
+    AssertDeviceResult(Filter(*ToDevice(values), *ToDevice(filter)),
+                       Filter(*values, *filter));
+    AssertDeviceResult(Filter(*ToDevice(values)->Slice(3), *ToDevice(filter)->Slice(3)),
+                       Filter(*values->Slice(3), *filter->Slice(3)));
+  }
+
+  // Many chunks of 64 filter slots
+  random::RandomArrayGenerator rand(0x5eed);
+  auto values = rand.Int32(10000, -100, 100);
+  auto random_filter = rand.Boolean(10000, 0.5, 0.1);
+  AssertDeviceResult(Filter(*ToDevice(values), *ToDevice(random_filter)),
+                     Filter(*values, *random_filter));
+}
+
+TEST_F(TestCudaCompute, Take) {
+  auto values = ArrayFromJSON(float64(), "[1.5, 2.5, 3.5, 4.5]");
+  for (const auto& type : {int8(), uint8(), int32(), int64(), uint64()}) {
+    SCOPED_TRACE("type = " + type->ToString());
+    auto indices = ArrayFromJSON(type, "[3, 0, 0, 2, 1, 3]");
+    AssertDeviceResult(Take(*ToDevice(values), *ToDevice(indices)),
+                       Take(*values, *indices));
+    AssertDeviceResult(Take(*ToDevice(values)->Slice(1), *ToDevice(indices)->Slice(3)),
+                       Take(*values->Slice(1), *indices->Slice(3)));
+  }
+
+  auto out_of_bounds = ArrayFromJSON(int32(), "[0, 4]");
+  ASSERT_RAISES(IndexError, Take(*ToDevice(values), *ToDevice(out_of_bounds)));
+  auto negative = ArrayFromJSON(int32(), "[-1]");
+  ASSERT_RAISES(IndexError, Take(*ToDevice(values), *ToDevice(negative)));
+}
+
+TEST_F(TestCudaCompute, Compare) {
+  auto left = ArrayFromJSON(int32(), "[1, 5, 3, 7, 3, 9, 0, -2, 4]");
+  auto right = ArrayFromJSON(int32(), "[1, 2, 3, 8, 4, 9, 1, -3, 4]");
+  auto scalar = std::make_shared<Int32Scalar>(3);
+  for (auto op : {compute::CompareOperator::EQUAL, compute::CompareOperator::NOT_EQUAL,
+                  compute::CompareOperator::GREATER,
+                  compute::CompareOperator::GREATER_EQUAL,
+                  compute::CompareOperator::LESS, compute::CompareOperator::LESS_EQUAL}) {
+    SCOPED_TRACE("op = " + std::to_string(static_cast<int>(op)));
+    compute::CompareOptions options(op);
+    AssertDeviceResult(Compare(*ToDevice(left), *ToDevice(right), options),
+                       Compare(*left, *right, options));
+    AssertDeviceResult(
+        Compare(*ToDevice(left)->Slice(2), *ToDevice(right)->Slice(2), options),
+        Compare(*left->Slice(2), *right->Slice(2), options));
+    AssertDeviceResult(Compare(*ToDevice(left), scalar, options),
+                       Compare(*left, scalar, options));
+  }
+
+  auto other_type = ArrayFromJSON(int64(), "[1, 2, 3, 8, 4, 9, 1, -3, 4]");
+  ASSERT_RAISES(Invalid, Compare(*ToDevice(left), *ToDevice(other_type),
+                                 compute::CompareOptions(compute::EQUAL)));
+}
+
+TEST_F(TestCudaCompute, Sum) {
+  random::RandomArrayGenerator rand(0x5eed);
+  for (const auto& values :
+       {rand.Int8(100000, -100, 100), rand.UInt32(100000, 0, 1 << 30),
+        rand.Int64(100000, -(1LL << 40), 1LL << 40), ArrayFromJSON(int16(), "[]")}) {
+    SCOPED_TRACE("type = " + values->type()->ToString());
+    ASSERT_OK_AND_ASSIGN(auto expected, Sum(*values));
+    ASSERT_OK_AND_ASSIGN(auto actual, Sum(*ToDevice(values)));
+    ASSERT_TRUE(expected->Equals(*actual));
+  }
+
+  auto values = rand.Float64(100000, -1000, 1000);
+  ASSERT_OK_AND_ASSIGN(auto expected, Sum(*values));
+  ASSERT_OK_AND_ASSIGN(auto actual, Sum(*ToDevice(values)));
+  ASSERT_NEAR(checked_cast<const DoubleScalar&>(*expected).value,
+              checked_cast<const DoubleScalar&>(*actual).value, 1e-6);
+}
+
+TEST_F(TestCudaCompute, SortToIndices) {
+  random::RandomArrayGenerator rand(0x5eed);
+  // Many duplicates check that the sort is stable
+  for (const auto& values :
+       {rand.Int16(1000, -50, 50), rand.UInt8(777, 0, 255),
+        rand.Float64(1025, -10, 10), ArrayFromJSON(float32(), "[]")}) {
+    SCOPED_TRACE("type = " + values->type()->ToString());
+    AssertDeviceResult(SortToIndices(*ToDevice(values)), SortToIndices(*values));
+  }
+
+  auto values = ArrayFromJSON(float64(), "[3, NaN, 1, NaN, 2]");
+  ASSERT_OK_AND_ASSIGN(auto indices, SortToIndices(*ToDevice(values)));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 4, 0, 1, 3]"),
+                    *CopyArray(indices, cpu_mm_));
+}
+
+TEST_F(TestCudaCompute, Errors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  auto filter = ArrayFromJSON(boolean(), "[true, false, true]");
+  // Inputs on different devices
+  ASSERT_RAISES(Invalid, Filter(*ToDevice(values), *filter));
+  // Nulls
+  auto with_nulls = ArrayFromJSON(int32(), "[1, null, 3]");
+  ASSERT_RAISES(NotImplemented, Sum(*ToDevice(with_nulls)));
+  // Unsupported types
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+  ASSERT_RAISES(NotImplemented, Filter(*ToDevice(strings), *ToDevice(filter)));
+}
+
 }  // namespace cuda
 }  // namespace arrow
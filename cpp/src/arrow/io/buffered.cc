@@ -287,6 +287,11 @@ class BufferedInputStream::Impl : public BufferedBase {
     if ((buffer_pos_ + bytes_buffered_) >= new_buffer_size) {
       return Status::Invalid("Cannot shrink read buffer if buffered data remains");
     }
+    if (BufferIsShared()) {
+      // Resizing may reallocate the memory sliced by Read()
+      buffer_size_ = new_buffer_size;
+      return RotateBuffer();
+    }
     return ResizeBuffer(new_buffer_size);
   }
 
@@ -301,6 +306,10 @@ class BufferedInputStream::Impl : public BufferedBase {
       RETURN_NOT_OK(BufferIfNeeded());
     }
 
+    if (nbytes > bytes_buffered_ && BufferIsShared()) {
+      // Don't overwrite data sliced by Read()
+      RETURN_NOT_OK(RotateBuffer());
+    }
     // Increase the buffer size if needed.
     if (nbytes > buffer_->size() - buffer_pos_) {
       RETURN_NOT_OK(SetBufferSize(nbytes + buffer_pos_));
@@ -340,11 +349,33 @@ class BufferedInputStream::Impl : public BufferedBase {
     buffer_pos_ = bytes_buffered_ = 0;
   }
 
+  // Whether slices of the buffer returned by Read() may still be alive, in which
+  // case the buffer must neither be overwritten nor reallocated
+  bool BufferIsShared() const { return buffer_ && buffer_.use_count() > 1; }
+
+  // Switch to a new buffer of buffer_size_ bytes, leaving the current one to
+  // the slices referencing it, and carry over the buffered bytes.  Their offset
+  // modulo 8 is preserved, as readers such as IPC rely on 8-byte alignment.
+  Status RotateBuffer() {
+    const int64_t offset = buffer_pos_ % 8;
+    std::shared_ptr<ResizableBuffer> old_buffer = std::move(buffer_);
+    ARROW_ASSIGN_OR_RAISE(buffer_,
+                          AllocateResizableBuffer(buffer_size_ + offset, pool_));
+    buffer_data_ = buffer_->mutable_data();
+    if (bytes_buffered_ > 0) {
+      memcpy(buffer_data_ + offset, old_buffer->data() + buffer_pos_, bytes_buffered_);
+    }
+    buffer_pos_ = offset;
+    return Status::OK();
+  }
+
   Status BufferIfNeeded() {
     if (bytes_buffered_ == 0) {
       // Fill buffer
       if (!buffer_) {
         RETURN_NOT_OK(ResetBuffer());
+      } else if (BufferIsShared()) {
+        RETURN_NOT_OK(RotateBuffer());
       }
 
       int64_t bytes_to_buffer = buffer_size_;
@@ -400,6 +431,18 @@ class BufferedInputStream::Impl : public BufferedBase {
   }
 
   Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+    if (nbytes > 0 && nbytes < buffer_size_) {
+      // Pre-buffer for small reads
+      RETURN_NOT_OK(BufferIfNeeded());
+    }
+    if (nbytes > 0 && nbytes <= bytes_buffered_) {
+      // Zero-copy: the buffer is rotated rather than overwritten while the slice
+      // is alive
+      auto slice = SliceBuffer(buffer_, buffer_pos_, nbytes);
+      ConsumeBuffer(nbytes);
+      return slice;
+    }
+
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
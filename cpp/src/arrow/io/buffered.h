@@ -148,7 +148,8 @@ class ARROW_EXPORT BufferedInputStream
 
   Result<int64_t> DoRead(int64_t nbytes, void* out);
 
-  /// \brief Read into buffer.
+  /// \brief Read into buffer.  Reads served from the internal buffer return
+  /// zero-copy slices of it.
   Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
 
   /// \brief Return a zero-copy string view referencing buffered data,
@@ -447,6 +447,33 @@ TEST_F(TestBufferedInputStream, SetBufferSize) {
   ASSERT_OK(buffered_->SetBufferSize(5));
 }
 
+TEST_F(TestBufferedInputStream, ReadBufferZeroCopy) {
+  MakeExample1(10);
+
+  // Small reads are slices of the internal buffer
+  ASSERT_OK_AND_ASSIGN(auto buf1, buffered_->Read(4));
+  ASSERT_OK_AND_ASSIGN(auto buf2, buffered_->Read(3));
+  ASSERT_NE(nullptr, buf1->parent());
+  ASSERT_EQ(buf1->parent(), buf2->parent());
+  ASSERT_EQ(buf1->data() + 4, buf2->data());
+  ASSERT_EQ(3, buffered_->bytes_buffered());
+
+  // Refilling, peeking and resizing don't clobber the slices
+  ASSERT_OK_AND_ASSIGN(auto peek, buffered_->Peek(6));
+  ASSERT_EQ(peek, util::string_view(test_data_).substr(7, 6));
+  ASSERT_OK_AND_ASSIGN(auto buf3, buffered_->Read(5));
+  ASSERT_OK(buffered_->SetBufferSize(20));
+  ASSERT_OK_AND_ASSIGN(auto buf4, buffered_->Read(9));
+  ASSERT_OK_AND_ASSIGN(auto buf5, buffered_->Read(15));
+
+  ASSERT_EQ(buf1->ToString(), test_data_.substr(0, 4));
+  ASSERT_EQ(buf2->ToString(), test_data_.substr(4, 3));
+  ASSERT_EQ(buf3->ToString(), test_data_.substr(7, 5));
+  ASSERT_EQ(buf4->ToString(), test_data_.substr(12, 9));
+  ASSERT_EQ(buf5->ToString(), test_data_.substr(21));
+  ASSERT_OK_AND_EQ(test_data_.size(), buffered_->Tell());
+}
+
 class TestBufferedInputStreamBound : public ::testing::Test {
  public:
   void SetUp() { CreateExample(/*bounded=*/true); }
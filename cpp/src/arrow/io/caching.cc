@@ -72,11 +72,11 @@ ReadRangeCache::~ReadRangeCache() {}
 Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
   ranges = internal::CoalesceReadRanges(std::move(ranges), impl_->hole_size_limit,
                                         impl_->range_size_limit);
+  auto futures = impl_->file->ReadManyAsync(ranges);
   std::vector<RangeCacheEntry> entries;
   entries.reserve(ranges.size());
-  for (const auto& range : ranges) {
-    auto fut = impl_->file->ReadAsync(range.offset, range.length);
-    entries.push_back({range, std::move(fut)});
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    entries.push_back({ranges[i], std::move(futures[i])});
   }
 
   impl_->AddEntries(std::move(entries));
@@ -101,6 +101,14 @@ Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
   return Status::Invalid("ReadRangeCache did not find matching cache entry");
 }
 
+Status ReadRangeCache::Wait() {
+  Status st;
+  for (const auto& entry : impl_->entries) {
+    st &= entry.future.status();
+  }
+  return st;
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
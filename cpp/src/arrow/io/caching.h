@@ -61,6 +61,11 @@ class ARROW_EXPORT ReadRangeCache {
   /// \brief Read a range previously given to Cache().
   Result<std::shared_ptr<Buffer>> Read(ReadRange range);
 
+  /// \brief Wait until all ranges given to Cache() have been read.
+  ///
+  /// Returns the first error among the reads.
+  Status Wait();
+
  protected:
   struct Impl;
   std::unique_ptr<Impl> impl_;
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,7 +30,9 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -437,5 +440,534 @@ Result<std::shared_ptr<Buffer>> CompressedInputStream::DoRead(int64_t nbytes) {
 
 std::shared_ptr<InputStream> CompressedInputStream::raw() const { return impl_->raw(); }
 
+// ----------------------------------------------------------------------
+// Parallel compressed streams
+
+namespace {
+
+using FrameFuture = Future<std::shared_ptr<Buffer>>;
+
+Status ResolveParallelOptions(const ParallelCompressionOptions& options,
+                              ::arrow::internal::ThreadPool** thread_pool,
+                              size_t* max_frames_in_flight) {
+  if (options.frame_size <= 0) {
+    return Status::Invalid("Compression frame size must be positive, got ",
+                           options.frame_size);
+  }
+  if (options.max_frames_in_flight < 0) {
+    return Status::Invalid("Maximum number of frames in flight must be positive, got ",
+                           options.max_frames_in_flight);
+  }
+  *thread_pool = options.thread_pool != NULLPTR ? options.thread_pool
+                                                : ::arrow::internal::GetCpuThreadPool();
+  *max_frames_in_flight = static_cast<size_t>(options.max_frames_in_flight > 0
+                                                  ? options.max_frames_in_flight
+                                                  : 2 * (*thread_pool)->GetCapacity());
+  return Status::OK();
+}
+
+// Compress `data` into a standalone compressed stream
+Result<std::shared_ptr<Buffer>> CompressFrame(Codec* codec,
+                                              const std::shared_ptr<Buffer>& data,
+                                              MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto compressor, codec->MakeCompressor());
+  const int64_t initial_size =
+      std::max<int64_t>(codec->MaxCompressedLen(data->size(), data->data()), 1024);
+  ARROW_ASSIGN_OR_RAISE(auto out, AllocateResizableBuffer(initial_size, pool));
+  int64_t out_pos = 0;
+
+  const uint8_t* input = data->data();
+  int64_t input_len = data->size();
+  while (input_len > 0) {
+    ARROW_ASSIGN_OR_RAISE(auto result,
+                          compressor->Compress(input_len, input, out->size() - out_pos,
+                                               out->mutable_data() + out_pos));
+    input += result.bytes_read;
+    input_len -= result.bytes_read;
+    out_pos += result.bytes_written;
+    if (result.bytes_read == 0) {
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(out->Resize(out->size() * 2));
+    }
+  }
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto result, compressor->End(out->size() - out_pos,
+                                                       out->mutable_data() + out_pos));
+    out_pos += result.bytes_written;
+    if (!result.should_retry) {
+      break;
+    }
+    // Need to enlarge output buffer
+    RETURN_NOT_OK(out->Resize(out->size() * 2));
+  }
+  RETURN_NOT_OK(out->Resize(out_pos));
+  return std::shared_ptr<Buffer>(std::move(out));
+}
+
+// Decompress a standalone compressed stream
+Result<std::shared_ptr<Buffer>> DecompressFrame(Codec* codec,
+                                                const std::shared_ptr<Buffer>& frame,
+                                                MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto decompressor, codec->MakeDecompressor());
+  const int64_t initial_size = std::max<int64_t>(frame->size() * 4, 1024);
+  ARROW_ASSIGN_OR_RAISE(auto out, AllocateResizableBuffer(initial_size, pool));
+  int64_t out_pos = 0;
+
+  const uint8_t* input = frame->data();
+  int64_t input_len = frame->size();
+  while (!decompressor->IsFinished()) {
+    if (out_pos == out->size()) {
+      RETURN_NOT_OK(out->Resize(out->size() * 2));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto result, decompressor->Decompress(input_len, input, out->size() - out_pos,
+                                              out->mutable_data() + out_pos));
+    input += result.bytes_read;
+    input_len -= result.bytes_read;
+    out_pos += result.bytes_written;
+    if (result.bytes_read == 0 && result.bytes_written == 0) {
+      if (input_len == 0) {
+        return Status::IOError("Truncated compressed frame");
+      }
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(out->Resize(out->size() * 2));
+    }
+  }
+  if (input_len != 0) {
+    return Status::IOError("Compressed frame contains trailing data");
+  }
+  RETURN_NOT_OK(out->Resize(out_pos));
+  return std::shared_ptr<Buffer>(std::move(out));
+}
+
+// Wait for a frame's (de)compression task.  On one of the pool's workers, help
+// run the pool's tasks rather than blocking: the frame's task may be queued with
+// no other worker to spare (see TaskGroup::Finish()).
+void WaitForFrame(::arrow::internal::ThreadPool* thread_pool, const FrameFuture& frame) {
+  if (!thread_pool->OwnsThisThread()) {
+    frame.Wait();
+    return;
+  }
+  while (!frame.Wait(/*seconds=*/0)) {
+    if (!thread_pool->RunPendingTask()) {
+      // Our task is running on another worker
+      frame.Wait(/*seconds=*/0.001);
+    }
+  }
+}
+
+// Wait for outstanding (de)compression tasks, which use the non-owned codec
+void DiscardFrames(::arrow::internal::ThreadPool* thread_pool,
+                   std::deque<FrameFuture>* frames) {
+  for (const auto& frame : *frames) {
+    WaitForFrame(thread_pool, frame);
+  }
+  frames->clear();
+}
+
+}  // namespace
+
+class ParallelCompressedOutputStream::Impl {
+ public:
+  Impl(Codec* codec, const std::shared_ptr<OutputStream>& raw,
+       const ParallelCompressionOptions& options, MemoryPool* pool)
+      : codec_(codec), raw_(raw), options_(options), pool_(pool) {}
+
+  ~Impl() { DiscardFrames(thread_pool_, &frames_); }
+
+  Status Init() {
+    RETURN_NOT_OK(
+        ResolveParallelOptions(options_, &thread_pool_, &max_frames_in_flight_));
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  Result<int64_t> Tell() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return total_pos_;
+  }
+
+  std::shared_ptr<OutputStream> raw() const { return raw_; }
+
+  Status Write(const void* data, int64_t nbytes) {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    auto input = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      if (!uncompressed_) {
+        ARROW_ASSIGN_OR_RAISE(uncompressed_,
+                              AllocateResizableBuffer(options_.frame_size, pool_));
+        uncompressed_pos_ = 0;
+      }
+      const int64_t chunk_size =
+          std::min(nbytes, options_.frame_size - uncompressed_pos_);
+      memcpy(uncompressed_->mutable_data() + uncompressed_pos_, input, chunk_size);
+      uncompressed_pos_ += chunk_size;
+      input += chunk_size;
+      nbytes -= chunk_size;
+      total_pos_ += chunk_size;
+      if (uncompressed_pos_ == options_.frame_size) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (uncompressed_pos_ > 0) {
+      RETURN_NOT_OK(SubmitFrame());
+    }
+    RETURN_NOT_OK(WriteFrames(0));
+    return raw_->Flush();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (is_open_) {
+      is_open_ = false;
+      // An empty stream still gets a frame, so that it can be decompressed
+      if (uncompressed_pos_ > 0 || num_frames_ == 0) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+      RETURN_NOT_OK(WriteFrames(0));
+      return raw_->Close();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  Status Abort() {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (is_open_) {
+      is_open_ = false;
+      DiscardFrames(thread_pool_, &frames_);
+      return raw_->Abort();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  bool closed() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return !is_open_;
+  }
+
+ private:
+  // Compress the buffered data as a new frame, then write out completed frames
+  // so as to respect the maximum number of frames in flight
+  Status SubmitFrame() {
+    std::shared_ptr<Buffer> data;
+    if (uncompressed_) {
+      RETURN_NOT_OK(uncompressed_->Resize(uncompressed_pos_));
+      data = std::move(uncompressed_);
+    } else {
+      data = std::make_shared<Buffer>(nullptr, 0);
+    }
+    uncompressed_pos_ = 0;
+
+    Codec* codec = codec_;
+    MemoryPool* pool = pool_;
+    frames_.push_back(thread_pool_->SubmitAsFuture(
+        [codec, data, pool]() { return CompressFrame(codec, data, pool); }));
+    ++num_frames_;
+    return WriteFrames(max_frames_in_flight_);
+  }
+
+  // Write frames in order until at most `max_pending` remain
+  Status WriteFrames(size_t max_pending) {
+    while (frames_.size() > max_pending) {
+      auto frame = std::move(frames_.front());
+      frames_.pop_front();
+      WaitForFrame(thread_pool_, frame);
+      const auto& maybe_compressed = frame.result();
+      Status st = maybe_compressed.ok() ? raw_->Write(*maybe_compressed)
+                                        : maybe_compressed.status();
+      if (!st.ok()) {
+        DiscardFrames(thread_pool_, &frames_);
+        return st;
+      }
+    }
+    return Status::OK();
+  }
+
+  Codec* codec_;
+  std::shared_ptr<OutputStream> raw_;
+  const ParallelCompressionOptions options_;
+  MemoryPool* pool_;
+  ::arrow::internal::ThreadPool* thread_pool_ = NULLPTR;
+  size_t max_frames_in_flight_ = 0;
+  bool is_open_ = false;
+
+  // Data waiting to be compressed into the next frame
+  std::shared_ptr<ResizableBuffer> uncompressed_;
+  int64_t uncompressed_pos_ = 0;
+  // Frames being compressed, in stream order
+  std::deque<FrameFuture> frames_;
+  int64_t num_frames_ = 0;
+  // Total number of bytes compressed
+  int64_t total_pos_ = 0;
+
+  mutable std::mutex lock_;
+};
+
+Result<std::shared_ptr<ParallelCompressedOutputStream>>
+ParallelCompressedOutputStream::Make(util::Codec* codec,
+                                     const std::shared_ptr<OutputStream>& raw,
+                                     const ParallelCompressionOptions& options,
+                                     MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<ParallelCompressedOutputStream> res(new ParallelCompressedOutputStream);
+  res->impl_.reset(new Impl(codec, raw, options, pool));
+  RETURN_NOT_OK(res->impl_->Init());
+  return res;
+}
+
+ParallelCompressedOutputStream::~ParallelCompressedOutputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status ParallelCompressedOutputStream::Close() { return impl_->Close(); }
+
+Status ParallelCompressedOutputStream::Abort() { return impl_->Abort(); }
+
+bool ParallelCompressedOutputStream::closed() const { return impl_->closed(); }
+
+Result<int64_t> ParallelCompressedOutputStream::Tell() const { return impl_->Tell(); }
+
+Status ParallelCompressedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+Status ParallelCompressedOutputStream::Flush() { return impl_->Flush(); }
+
+std::shared_ptr<OutputStream> ParallelCompressedOutputStream::raw() const {
+  return impl_->raw();
+}
+
+class ParallelCompressedInputStream::Impl {
+ public:
+  Impl(Codec* codec, const std::shared_ptr<InputStream>& raw,
+       const ParallelCompressionOptions& options, MemoryPool* pool)
+      : codec_(codec), raw_(raw), options_(options), pool_(pool) {}
+
+  ~Impl() { DiscardFrames(thread_pool_, &frames_); }
+
+  Status Init() {
+    RETURN_NOT_OK(
+        ResolveParallelOptions(options_, &thread_pool_, &max_frames_in_flight_));
+    // Fail early if the codec can't split frames
+    RETURN_NOT_OK(codec_->FrameSize(0, NULLPTR).status());
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (is_open_) {
+      is_open_ = false;
+      DiscardFrames(thread_pool_, &frames_);
+      return raw_->Close();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  Status Abort() {
+    if (is_open_) {
+      is_open_ = false;
+      DiscardFrames(thread_pool_, &frames_);
+      return raw_->Abort();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  bool closed() { return !is_open_; }
+
+  Result<int64_t> Tell() const { return total_pos_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+
+    int64_t total_read = 0;
+    while (total_read < nbytes) {
+      if (!decompressed_ || decompressed_pos_ == decompressed_->size()) {
+        decompressed_.reset();
+        ScheduleFrames();
+        if (frames_.empty()) {
+          // End of stream, unless the compressed data couldn't be split.  In
+          // the latter case, return the data read so far first.
+          if (total_read == 0) {
+            RETURN_NOT_OK(split_status_);
+          }
+          break;
+        }
+        auto frame = std::move(frames_.front());
+        frames_.pop_front();
+        WaitForFrame(thread_pool_, frame);
+        const auto& maybe_decompressed = frame.result();
+        if (!maybe_decompressed.ok()) {
+          DiscardFrames(thread_pool_, &frames_);
+          return maybe_decompressed.status();
+        }
+        decompressed_ = *maybe_decompressed;
+        decompressed_pos_ = 0;
+        continue;
+      }
+
+      const int64_t read_bytes =
+          std::min(nbytes - total_read, decompressed_->size() - decompressed_pos_);
+      memcpy(out_data + total_read, decompressed_->data() + decompressed_pos_,
+             read_bytes);
+      decompressed_pos_ += read_bytes;
+      total_read += read_bytes;
+    }
+
+    total_pos_ += total_read;
+    return total_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes, pool_));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    return std::move(buf);
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  // Split frames off the compressed data and decompress them ahead, up to the
+  // maximum number of frames in flight.  Errors are reported once the frames
+  // preceding them have been read.
+  void ScheduleFrames() {
+    while (split_status_.ok() && frames_.size() < max_frames_in_flight_) {
+      auto maybe_frame = NextFrame();
+      if (!maybe_frame.ok()) {
+        split_status_ = maybe_frame.status();
+        break;
+      }
+      auto frame = std::move(maybe_frame).ValueOrDie();
+      if (frame == nullptr) {
+        break;
+      }
+      Codec* codec = codec_;
+      MemoryPool* pool = pool_;
+      frames_.push_back(thread_pool_->SubmitAsFuture(
+          [codec, frame, pool]() { return DecompressFrame(codec, frame, pool); }));
+    }
+  }
+
+  // Return the next compressed frame, or null at the end of the stream
+  Result<std::shared_ptr<Buffer>> NextFrame() {
+    while (true) {
+      const int64_t available = compressed_size_ - compressed_pos_;
+      if (available > 0) {
+        const uint8_t* data = compressed_->data() + compressed_pos_;
+        ARROW_ASSIGN_OR_RAISE(int64_t frame_size, codec_->FrameSize(available, data));
+        if (frame_size > 0) {
+          ARROW_ASSIGN_OR_RAISE(auto frame, AllocateBuffer(frame_size, pool_));
+          memcpy(frame->mutable_data(), data, frame_size);
+          compressed_pos_ += frame_size;
+          return std::shared_ptr<Buffer>(std::move(frame));
+        }
+      }
+      if (raw_eof_) {
+        if (available > 0) {
+          return Status::IOError("Truncated compressed stream");
+        }
+        return nullptr;
+      }
+      RETURN_NOT_OK(ReadCompressed());
+    }
+  }
+
+  // Append a chunk of the raw stream to the unsplit compressed data
+  Status ReadCompressed() {
+    const int64_t available = compressed_size_ - compressed_pos_;
+    if (!compressed_) {
+      ARROW_ASSIGN_OR_RAISE(compressed_, AllocateResizableBuffer(kChunkSize, pool_));
+    } else if (compressed_pos_ > 0) {
+      memmove(compressed_->mutable_data(), compressed_->data() + compressed_pos_,
+              available);
+    }
+    compressed_pos_ = 0;
+    compressed_size_ = available;
+    if (compressed_->size() - compressed_size_ < kChunkSize) {
+      RETURN_NOT_OK(compressed_->Resize(compressed_size_ + kChunkSize));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t bytes_read,
+        raw_->Read(kChunkSize, compressed_->mutable_data() + compressed_size_));
+    compressed_size_ += bytes_read;
+    raw_eof_ = bytes_read == 0;
+    return Status::OK();
+  }
+
+  // Read 1 MB compressed data at a time
+  static const int64_t kChunkSize = 1024 * 1024;
+
+  Codec* codec_;
+  std::shared_ptr<InputStream> raw_;
+  const ParallelCompressionOptions options_;
+  MemoryPool* pool_;
+  ::arrow::internal::ThreadPool* thread_pool_ = NULLPTR;
+  size_t max_frames_in_flight_ = 0;
+  bool is_open_ = false;
+
+  // Compressed data not split into frames yet
+  std::shared_ptr<ResizableBuffer> compressed_;
+  int64_t compressed_pos_ = 0;
+  int64_t compressed_size_ = 0;
+  bool raw_eof_ = false;
+  Status split_status_;
+  // Frames being decompressed, in stream order
+  std::deque<FrameFuture> frames_;
+  // Decompressed frame being read
+  std::shared_ptr<Buffer> decompressed_;
+  int64_t decompressed_pos_ = 0;
+  // Total number of bytes decompressed
+  int64_t total_pos_ = 0;
+};
+
+Result<std::shared_ptr<ParallelCompressedInputStream>>
+ParallelCompressedInputStream::Make(Codec* codec, const std::shared_ptr<InputStream>& raw,
+                                    const ParallelCompressionOptions& options,
+                                    MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<ParallelCompressedInputStream> res(new ParallelCompressedInputStream);
+  res->impl_.reset(new Impl(codec, raw, options, pool));
+  RETURN_NOT_OK(res->impl_->Init());
+  return res;
+}
+
+ParallelCompressedInputStream::~ParallelCompressedInputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status ParallelCompressedInputStream::DoClose() { return impl_->Close(); }
+
+Status ParallelCompressedInputStream::DoAbort() { return impl_->Abort(); }
+
+bool ParallelCompressedInputStream::closed() const { return impl_->closed(); }
+
+Result<int64_t> ParallelCompressedInputStream::DoTell() const { return impl_->Tell(); }
+
+Result<int64_t> ParallelCompressedInputStream::DoRead(int64_t nbytes, void* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> ParallelCompressedInputStream::DoRead(int64_t nbytes) {
+  return impl_->Read(nbytes);
+}
+
+std::shared_ptr<InputStream> ParallelCompressedInputStream::raw() const {
+  return impl_->raw();
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -31,6 +32,12 @@ namespace arrow {
 class MemoryPool;
 class Status;
 
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace util {
 
 class Codec;
@@ -39,6 +46,21 @@ class Codec;
 
 namespace io {
 
+/// \brief Options for ParallelCompressedOutputStream and
+/// ParallelCompressedInputStream
+struct ARROW_EXPORT ParallelCompressionOptions {
+  /// Amount of uncompressed data compressed into each independent frame.
+  /// Larger frames compress better, smaller frames expose more parallelism.
+  int64_t frame_size = 4 * 1024 * 1024;
+  /// Maximum number of frames being compressed or decompressed at once,
+  /// which bounds memory usage.  0 means twice the thread pool's capacity.
+  int32_t max_frames_in_flight = 0;
+  /// Thread pool running the (de)compression tasks.  Null means the CPU
+  /// thread pool.  The stream's methods wait for those tasks; when called
+  /// from one of the pool's workers, they run pending tasks meanwhile.
+  ::arrow::internal::ThreadPool* thread_pool = NULLPTR;
+};
+
 class ARROW_EXPORT CompressedOutputStream : public OutputStream {
  public:
   ~CompressedOutputStream() override;
@@ -111,5 +133,93 @@ class ARROW_EXPORT CompressedInputStream
   std::unique_ptr<Impl> impl_;
 };
 
+/// \brief A compressed output stream compressing frames in parallel
+///
+/// The written data is cut into chunks of `frame_size` bytes, each compressed into
+/// an independent stream ("frame") on a thread pool, and the frames are written to
+/// the raw stream in order.  Any codec whose concatenated streams form a valid
+/// stream works (e.g. ZSTD, LZ4_FRAME, GZIP, BZ2), and the output can be read back
+/// by CompressedInputStream.  Flush() ends the current frame.
+class ARROW_EXPORT ParallelCompressedOutputStream : public OutputStream {
+ public:
+  ~ParallelCompressedOutputStream() override;
+
+  /// \brief Create a compressed output stream wrapping the given output stream.
+  static Result<std::shared_ptr<ParallelCompressedOutputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+      const ParallelCompressionOptions& options = ParallelCompressionOptions{},
+      MemoryPool* pool = default_memory_pool());
+
+  // OutputStream interface
+
+  /// \brief Close the compressed output stream.  This implicitly closes the
+  /// underlying raw output stream.
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Result<int64_t> Tell() const override;
+
+  Status Write(const void* data, int64_t nbytes) override;
+  /// \cond FALSE
+  using Writable::Write;
+  /// \endcond
+  Status Flush() override;
+
+  /// \brief Return the underlying raw output stream.
+  std::shared_ptr<OutputStream> raw() const;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ParallelCompressedOutputStream);
+
+  ParallelCompressedOutputStream() = default;
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A compressed input stream decompressing frames in parallel
+///
+/// The compressed data is split into frames without decompressing it, using
+/// Codec::FrameSize(), and the frames are decompressed ahead on a thread pool.
+/// Only codecs supporting frame splitting (ZSTD, LZ4_FRAME) can be used.  The
+/// parallelism comes from the number of frames in the stream, e.g. as written by
+/// ParallelCompressedOutputStream; `frame_size` is ignored.
+class ARROW_EXPORT ParallelCompressedInputStream
+    : public internal::InputStreamConcurrencyWrapper<ParallelCompressedInputStream> {
+ public:
+  ~ParallelCompressedInputStream() override;
+
+  /// \brief Create a compressed input stream wrapping the given input stream.
+  static Result<std::shared_ptr<ParallelCompressedInputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<InputStream>& raw,
+      const ParallelCompressionOptions& options = ParallelCompressionOptions{},
+      MemoryPool* pool = default_memory_pool());
+
+  // InputStream interface
+
+  bool closed() const override;
+
+  /// \brief Return the underlying raw input stream.
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  friend InputStreamConcurrencyWrapper<ParallelCompressedInputStream>;
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ParallelCompressedInputStream);
+
+  ParallelCompressedInputStream() = default;
+
+  /// \brief Close the compressed input stream.  This implicitly closes the
+  /// underlying raw input stream.
+  Status DoClose();
+  Status DoAbort() override;
+  Result<int64_t> DoTell() const;
+  Result<int64_t> DoRead(int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace io
 }  // namespace arrow
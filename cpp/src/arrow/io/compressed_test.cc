@@ -33,10 +33,12 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
 
+using ::arrow::internal::ThreadPool;
 using ::arrow::util::Codec;
 
 #ifdef ARROW_VALGRIND
@@ -153,6 +155,79 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
   ASSERT_EQ(decompressed, data);
 }
 
+Result<std::shared_ptr<Buffer>> RunParallelCompressedOutputStream(
+    Codec* codec, const std::vector<uint8_t>& data, bool do_flush,
+    ThreadPool* thread_pool = nullptr) {
+  ParallelCompressionOptions options;
+  // Small frames and a small pipeline, to exercise frame boundaries and waits
+  options.frame_size = 100 * 1000;
+  options.max_frames_in_flight = 3;
+  options.thread_pool = thread_pool;
+  ARROW_ASSIGN_OR_RAISE(auto buffer_writer, BufferOutputStream::Create());
+  ARROW_ASSIGN_OR_RAISE(auto stream, ParallelCompressedOutputStream::Make(
+                                         codec, buffer_writer, options));
+
+  const uint8_t* input = data.data();
+  int64_t input_len = data.size();
+  const int64_t chunk_size = 11111;
+  while (input_len > 0) {
+    int64_t nbytes = std::min(chunk_size, input_len);
+    RETURN_NOT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    if (do_flush) {
+      RETURN_NOT_OK(stream->Flush());
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto position, stream->Tell());
+  if (position != static_cast<int64_t>(data.size())) {
+    return Status::Invalid("Unexpected stream position ", position);
+  }
+  RETURN_NOT_OK(stream->Close());
+  return buffer_writer->Finish();
+}
+
+Status RunParallelCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                        std::vector<uint8_t>* out) {
+  ParallelCompressionOptions options;
+  options.max_frames_in_flight = 3;
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  ARROW_ASSIGN_OR_RAISE(auto stream, ParallelCompressedInputStream::Make(
+                                         codec, buffer_reader, options));
+
+  out->clear();
+  const int64_t chunk_size = 22222;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto buf, stream->Read(chunk_size));
+    if (buf->size() == 0) {
+      // EOF
+      break;
+    }
+    out->insert(out->end(), buf->data(), buf->data() + buf->size());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto position, stream->Tell());
+  if (position != static_cast<int64_t>(out->size())) {
+    return Status::Invalid("Unexpected stream position ", position);
+  }
+  return stream->Close();
+}
+
+void CheckParallelCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                         bool do_flush) {
+  ASSERT_OK_AND_ASSIGN(auto compressed,
+                       RunParallelCompressedOutputStream(codec, data, do_flush));
+
+  // The concatenated frames can be read by a regular compressed stream
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+
+  if (codec->FrameSize(0, nullptr).ok()) {
+    ASSERT_OK(RunParallelCompressedInputStream(codec, compressed, &decompressed));
+    ASSERT_EQ(decompressed, data);
+  }
+}
+
 class CompressedInputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -237,6 +312,81 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+class ParallelCompressedStreamTest
+    : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  Compression::type GetCompression() { return GetParam(); }
+
+  std::unique_ptr<Codec> MakeCodec() { return *Codec::Create(GetCompression()); }
+};
+
+TEST_P(ParallelCompressedStreamTest, CompressibleData) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+
+  CheckParallelCompressedOutputStream(codec.get(), data, false /* do_flush */);
+  CheckParallelCompressedOutputStream(codec.get(), data, true /* do_flush */);
+}
+
+TEST_P(ParallelCompressedStreamTest, RandomData) {
+  auto codec = MakeCodec();
+  auto data = MakeRandomData(RANDOM_DATA_SIZE);
+
+  CheckParallelCompressedOutputStream(codec.get(), data, false /* do_flush */);
+}
+
+TEST_P(ParallelCompressedStreamTest, EmptyData) {
+  auto codec = MakeCodec();
+  std::vector<uint8_t> data;
+
+  CheckParallelCompressedOutputStream(codec.get(), data, false /* do_flush */);
+}
+
+TEST_P(ParallelCompressedStreamTest, FromPoolWorker) {
+  // On the only worker of its pool, the stream must run the compression tasks
+  // rather than block waiting for them
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(1));
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&]() {
+    return RunParallelCompressedOutputStream(codec.get(), data, false, pool.get());
+  }));
+  ASSERT_OK_AND_ASSIGN(auto compressed, fut.result());
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+}
+
+TEST_P(ParallelCompressedStreamTest, TruncatedData) {
+  auto codec = MakeCodec();
+  if (!codec->FrameSize(0, nullptr).ok()) {
+    ASSERT_RAISES(NotImplemented, ParallelCompressedInputStream::Make(
+                                      codec.get(), std::make_shared<BufferReader>("")));
+    return;
+  }
+  auto data = MakeRandomData(10000);
+  ASSERT_OK_AND_ASSIGN(auto compressed,
+                       RunParallelCompressedOutputStream(codec.get(), data, false));
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() - 2);
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError,
+                RunParallelCompressedInputStream(codec.get(), truncated, &decompressed));
+}
+
+TEST(TestParallelCompressedStream, InvalidOptions) {
+  // The options are validated before the codec is used
+  Codec* codec = nullptr;
+  std::shared_ptr<OutputStream> stream = std::make_shared<MockOutputStream>();
+  ParallelCompressionOptions options;
+  options.frame_size = 0;
+  ASSERT_RAISES(Invalid, ParallelCompressedOutputStream::Make(codec, stream, options));
+  options = ParallelCompressionOptions{};
+  options.max_frames_in_flight = -1;
+  ASSERT_RAISES(Invalid, ParallelCompressedOutputStream::Make(codec, stream, options));
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -263,6 +413,8 @@ INSTANTIATE_TEST_SUITE_P(TestGZipInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::GZIP));
 INSTANTIATE_TEST_SUITE_P(TestGZipOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::GZIP));
+INSTANTIATE_TEST_SUITE_P(TestGZipParallelStream, ParallelCompressedStreamTest,
+                         ::testing::Values(Compression::GZIP));
 #endif
 
 #ifdef ARROW_WITH_BROTLI
@@ -277,6 +429,8 @@ INSTANTIATE_TEST_SUITE_P(TestLZ4InputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::LZ4_FRAME));
 INSTANTIATE_TEST_SUITE_P(TestLZ4OutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::LZ4_FRAME));
+INSTANTIATE_TEST_SUITE_P(TestLZ4ParallelStream, ParallelCompressedStreamTest,
+                         ::testing::Values(Compression::LZ4_FRAME));
 #endif
 
 #ifdef ARROW_WITH_ZSTD
@@ -284,6 +438,8 @@ INSTANTIATE_TEST_SUITE_P(TestZSTDInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::ZSTD));
 INSTANTIATE_TEST_SUITE_P(TestZSTDOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::ZSTD));
+INSTANTIATE_TEST_SUITE_P(TestZSTDParallelStream, ParallelCompressedStreamTest,
+                         ::testing::Values(Compression::ZSTD));
 #endif
 
 }  // namespace io
@@ -40,6 +40,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -54,6 +55,7 @@
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -262,6 +264,42 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return std::move(buffer);
   }
 
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadBuffersAt(
+      const std::vector<ReadRange>& ranges) {
+    RETURN_NOT_OK(CheckClosed());
+    const auto num_ranges = static_cast<int64_t>(ranges.size());
+    std::vector<std::shared_ptr<ResizableBuffer>> buffers(num_ranges);
+    std::vector<int64_t> positions(num_ranges);
+    std::vector<int64_t> lengths(num_ranges);
+    std::vector<uint8_t*> outs(num_ranges);
+    std::vector<int64_t> bytes_read(num_ranges);
+
+    for (int64_t i = 0; i < num_ranges; ++i) {
+      RETURN_NOT_OK(internal::ValidateRange(ranges[i].offset, ranges[i].length));
+      ARROW_ASSIGN_OR_RAISE(buffers[i], AllocateResizableBuffer(ranges[i].length, pool_));
+      positions[i] = ranges[i].offset;
+      lengths[i] = ranges[i].length;
+      outs[i] = buffers[i]->mutable_data();
+    }
+    // See ReadAt()
+    need_seeking_.store(true);
+
+    // NotImplemented if io_uring is not available
+    RETURN_NOT_OK(::arrow::internal::FileReadAtBatched(fd_, num_ranges, positions.data(),
+                                                       lengths.data(), outs.data(),
+                                                       bytes_read.data()));
+
+    std::vector<std::shared_ptr<Buffer>> out(num_ranges);
+    for (int64_t i = 0; i < num_ranges; ++i) {
+      if (bytes_read[i] < lengths[i]) {
+        RETURN_NOT_OK(buffers[i]->Resize(bytes_read[i]));
+        buffers[i]->ZeroPadding();
+      }
+      out[i] = std::move(buffers[i]);
+    }
+    return out;
+  }
+
  private:
   MemoryPool* pool_;
 };
@@ -311,6 +349,67 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+Result<std::vector<std::shared_ptr<Buffer>>> ReadableFile::ReadMany(
+    const std::vector<ReadRange>& ranges) {
+  {
+    auto guard = lock_.shared_guard();
+    auto maybe_buffers = impl_->ReadBuffersAt(ranges);
+    if (!maybe_buffers.status().IsNotImplemented()) {
+      return maybe_buffers;
+    }
+  }
+  return RandomAccessFile::ReadMany(ranges);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const std::vector<ReadRange>& ranges) {
+#ifdef ARROW_WITH_IO_URING
+  using BufferFuture = Future<std::shared_ptr<Buffer>>;
+
+  std::vector<BufferFuture> futures;
+  futures.reserve(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    futures.push_back(BufferFuture::Make());
+  }
+  auto self = std::static_pointer_cast<ReadableFile>(shared_from_this());
+  auto task = [self, ranges, futures]() mutable {
+    Result<std::vector<std::shared_ptr<Buffer>>> maybe_buffers;
+    {
+      auto guard = self->lock_.shared_guard();
+      maybe_buffers = self->impl_->ReadBuffersAt(ranges);
+    }
+    if (maybe_buffers.status().IsNotImplemented()) {
+      // No io_uring: spread the reads over the IO thread pool instead
+      auto range_futures = self->RandomAccessFile::ReadManyAsync(ranges);
+      for (size_t i = 0; i < futures.size(); ++i) {
+        auto fut = futures[i];
+        range_futures[i].AddCallback(
+            [fut](const Result<std::shared_ptr<Buffer>>& result) mutable {
+              fut.MarkFinished(result);
+            });
+      }
+      return;
+    }
+    for (size_t i = 0; i < futures.size(); ++i) {
+      if (maybe_buffers.ok()) {
+        futures[i].MarkFinished(std::move((*maybe_buffers)[i]));
+      } else {
+        futures[i].MarkFinished(maybe_buffers.status());
+      }
+    }
+  };
+  Status st = internal::GetIOThreadPool()->Spawn(std::move(task));
+  if (!st.ok()) {
+    for (auto& fut : futures) {
+      fut.MarkFinished(st);
+    }
+  }
+  return futures;
+#else
+  return RandomAccessFile::ReadManyAsync(ranges);
+#endif
+}
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -527,6 +626,24 @@ class MemoryMappedFile::MemoryMap
 
   std::mutex& resize_lock() { return resize_lock_; }
 
+  // Apply madvise() to a range of the map, widened to page boundaries
+  Status Advise(int64_t offset, int64_t length, int advice) {
+#ifndef _WIN32
+    offset = std::max<int64_t>(0, offset);
+    length = std::min(length, map_len_ - offset);
+    if (length <= 0) {
+      return Status::OK();
+    }
+    static const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    const int64_t begin = offset - offset % page_size;
+    if (madvise(data() + begin, static_cast<size_t>(offset + length - begin), advice) !=
+        0) {
+      return Status::IOError("madvise failed: ", ::arrow::internal::ErrnoMessage(errno));
+    }
+#endif
+    return Status::OK();
+  }
+
  private:
   // Initialize the mmap and set size, capacity and the data pointers
   Status InitMMap(int64_t initial_size, bool resize_file = false,
@@ -652,6 +769,26 @@ Result<int64_t> MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes, void*
   return nbytes;
 }
 
+Result<std::vector<std::shared_ptr<Buffer>>> MemoryMappedFile::ReadMany(
+    const std::vector<ReadRange>& ranges) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+  // See ReadAt()
+  auto guard_resize = memory_map_->writable()
+                          ? std::unique_lock<std::mutex>(memory_map_->resize_lock())
+                          : std::unique_lock<std::mutex>();
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  buffers.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto nbytes,
+        internal::ValidateReadRange(range.offset, range.length, memory_map_->size()));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, memory_map_->Slice(range.offset, nbytes));
+    buffers.push_back(std::move(buffer));
+  }
+  return buffers;
+}
+
 Result<int64_t> MemoryMappedFile::Read(int64_t nbytes, void* out) {
   RETURN_NOT_OK(memory_map_->CheckClosed());
   ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(memory_map_->position(), nbytes, out));
@@ -714,6 +851,38 @@ Status MemoryMappedFile::Resize(int64_t new_size) {
   return Status::OK();
 }
 
+Status MemoryMappedFile::Advise(MemoryAdvice advice) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+#ifndef _WIN32
+  int posix_advice = MADV_NORMAL;
+  switch (advice) {
+    case MemoryAdvice::Normal:
+      break;
+    case MemoryAdvice::Sequential:
+      posix_advice = MADV_SEQUENTIAL;
+      break;
+    case MemoryAdvice::Random:
+      posix_advice = MADV_RANDOM;
+      break;
+  }
+  std::lock_guard<std::mutex> guard(memory_map_->resize_lock());
+  return memory_map_->Advise(0, memory_map_->size(), posix_advice);
+#else
+  return Status::OK();
+#endif
+}
+
+Status MemoryMappedFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+#ifndef _WIN32
+  std::lock_guard<std::mutex> guard(memory_map_->resize_lock());
+  for (const auto& range : ranges) {
+    RETURN_NOT_OK(memory_map_->Advise(range.offset, range.length, MADV_WILLNEED));
+  }
+#endif
+  return Status::OK();
+}
+
 int MemoryMappedFile::file_descriptor() const { return memory_map_->fd(); }
 
 }  // namespace io
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -110,6 +111,21 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  /// \brief Read the ranges with batched io_uring submissions
+  ///
+  /// Falls back to one pread per range if Arrow was built without
+  /// ARROW_WITH_IO_URING or the kernel does not provide io_uring.
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadMany(
+      const std::vector<ReadRange>& ranges) override;
+
+  /// \brief Read the ranges with batched io_uring submissions on the IO
+  /// thread pool
+  ///
+  /// Falls back to one ReadAsync() per range if Arrow was built without
+  /// ARROW_WITH_IO_URING or the kernel does not provide io_uring.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const std::vector<ReadRange>& ranges) override;
+
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
 
@@ -181,6 +197,10 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   // zero copy method
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override;
 
+  // Zero-copy reads of several ranges, acquiring the reader lock only once
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadMany(
+      const std::vector<ReadRange>& ranges) override;
+
   // Synchronous ReadAsync override
   Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes) override;
 
@@ -200,6 +220,12 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   Result<int64_t> GetSize() override;
 
+  /// Advise the OS of the access pattern of the whole map. This is only a hint
+  Status Advise(MemoryAdvice advice);
+
+  /// Ask the OS to page in the given ranges ahead of their reads. This is only a hint
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
   int file_descriptor() const;
 
  private:
@@ -29,8 +29,10 @@
 #include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <random>
 #include <thread>
 #include <valarray>
+#include <vector>
 
 #ifdef _WIN32
 
@@ -288,6 +290,94 @@ static void BufferedOutputStreamLargeWritesToPipe(
   BenchmarkStreamingWrites(state, large_sizes, buffered_stream.get(), reader.get());
 }
 
+// Benchmark random reads of a local file, such as the coalesced column
+// chunk ranges a ReadRangeCache issues, with one pread per range versus
+// batched io_uring submissions.
+//
+// The file is in the page cache, so this measures the per-read syscall
+// overhead rather than the device.
+
+constexpr int64_t kRandomReadFileSize = 64 * 1024 * 1024;
+
+class RandomReadFixture {
+ public:
+  explicit RandomReadFixture(int64_t read_size) {
+    temp_dir_ = *internal::TemporaryDir::Make("file-benchmark-");
+    auto path = temp_dir_->path().ToString() + "data.bin";
+    {
+      auto stream = *io::FileOutputStream::Open(path);
+      const std::string chunk(1024 * 1024, 'x');
+      for (int64_t i = 0; i < kRandomReadFileSize; i += chunk.size()) {
+        ABORT_NOT_OK(stream->Write(chunk.data(), chunk.size()));
+      }
+      ABORT_NOT_OK(stream->Close());
+    }
+    file_ = *io::ReadableFile::Open(path);
+
+    const int64_t num_reads = 256;
+    std::default_random_engine gen(42);
+    std::uniform_int_distribution<int64_t> dist(0, kRandomReadFileSize - read_size);
+    for (int64_t i = 0; i < num_reads; ++i) {
+      positions.push_back(dist(gen));
+      lengths.push_back(read_size);
+    }
+    buffers.resize(num_reads * read_size);
+    for (int64_t i = 0; i < num_reads; ++i) {
+      outs.push_back(buffers.data() + i * read_size);
+    }
+    bytes_read.resize(num_reads);
+  }
+
+  int fd() const { return file_->file_descriptor(); }
+  int64_t num_reads() const { return static_cast<int64_t>(positions.size()); }
+
+  std::vector<int64_t> positions;
+  std::vector<int64_t> lengths;
+  std::vector<uint8_t> buffers;
+  std::vector<uint8_t*> outs;
+  std::vector<int64_t> bytes_read;
+
+ private:
+  std::unique_ptr<internal::TemporaryDir> temp_dir_;
+  std::shared_ptr<io::ReadableFile> file_;
+};
+
+static void ReadableFileRandomReadsPread(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadFixture fixture(state.range(0));
+
+  for (auto _ : state) {
+    for (int64_t i = 0; i < fixture.num_reads(); ++i) {
+      fixture.bytes_read[i] =
+          *internal::FileReadAt(fixture.fd(), fixture.outs[i], fixture.positions[i],
+                                fixture.lengths[i]);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * fixture.num_reads() * state.range(0));
+  state.SetItemsProcessed(state.iterations() * fixture.num_reads());
+}
+
+static void ReadableFileRandomReadsIoUring(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadFixture fixture(state.range(0));
+
+  for (auto _ : state) {
+    auto st = internal::FileReadAtBatched(
+        fixture.fd(), fixture.num_reads(), fixture.positions.data(),
+        fixture.lengths.data(), fixture.outs.data(), fixture.bytes_read.data());
+    if (st.IsNotImplemented()) {
+      state.SkipWithError("io_uring not available");
+      return;
+    }
+    ABORT_NOT_OK(st);
+  }
+  state.SetBytesProcessed(state.iterations() * fixture.num_reads() * state.range(0));
+  state.SetItemsProcessed(state.iterations() * fixture.num_reads());
+}
+
+BENCHMARK(ReadableFileRandomReadsPread)->Arg(4096)->Arg(65536)->UseRealTime();
+BENCHMARK(ReadableFileRandomReadsIoUring)->Arg(4096)->Arg(65536)->UseRealTime();
+
 // We use real time as we don't want to count CPU time spent in the
 // BackgroundReader thread
 
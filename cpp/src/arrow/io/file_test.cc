@@ -377,6 +377,42 @@ TEST_F(TestReadableFile, ReadAsync) {
   AssertBufferEqual(*buf2, "test");
 }
 
+TEST_F(TestReadableFile, ReadMany) {
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK_AND_ASSIGN(auto buffers, file_->ReadMany({{1, 10}, {0, 4}, {8, 0}, {4, 4}}));
+  ASSERT_EQ(buffers.size(), 4U);
+  AssertBufferEqual(*buffers[0], "estdata");
+  AssertBufferEqual(*buffers[1], "test");
+  AssertBufferEqual(*buffers[2], "");
+  AssertBufferEqual(*buffers[3], "data");
+  ASSERT_RAISES(Invalid, file_->ReadMany({{0, 4}, {-1, 4}}));
+
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadMany({{0, 4}}));
+}
+
+TEST_F(TestReadableFile, ReadManyAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto futures = file_->ReadManyAsync({{1, 10}, {0, 4}, {8, 0}, {4, 4}});
+  ASSERT_EQ(futures.size(), 4U);
+  ASSERT_OK_AND_ASSIGN(auto buf1, futures[0].result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, futures[1].result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, futures[2].result());
+  ASSERT_OK_AND_ASSIGN(auto buf4, futures[3].result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+  AssertBufferEqual(*buf3, "");
+  AssertBufferEqual(*buf4, "data");
+
+  ASSERT_OK(file_->Close());
+  futures = file_->ReadManyAsync({{0, 4}});
+  ASSERT_RAISES(Invalid, futures[0].result());
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
@@ -645,6 +681,55 @@ TEST_F(TestMemoryMappedFile, ReadAsync) {
   AssertBufferEqual(*buf2, Buffer(buffer.data() + 3, 4));
 }
 
+TEST_F(TestMemoryMappedFile, ReadMany) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(1024, 0, buffer.data());
+
+  std::string path = "io-memory-map-read-many-test";
+  ASSERT_OK_AND_ASSIGN(auto mmap, InitMemoryMap(buffer_size, path));
+  ASSERT_OK(mmap->Write(buffer.data(), buffer_size));
+
+  ASSERT_OK_AND_ASSIGN(auto buffers,
+                       mmap->ReadMany({{1, 1000}, {3, 4}, {1020, 10}, {5, 0}}));
+  ASSERT_EQ(buffers.size(), 4U);
+  AssertBufferEqual(*buffers[0], Buffer(buffer.data() + 1, 1000));
+  AssertBufferEqual(*buffers[1], Buffer(buffer.data() + 3, 4));
+  AssertBufferEqual(*buffers[2], Buffer(buffer.data() + 1020, 4));
+  ASSERT_EQ(buffers[3]->size(), 0);
+  // Zero-copy
+  ASSERT_EQ(buffers[1]->data(), buffers[0]->data() + 2);
+
+  ASSERT_RAISES(Invalid, mmap->ReadMany({{0, 4}, {-1, 4}}));
+  ASSERT_OK(mmap->Close());
+  ASSERT_RAISES(Invalid, mmap->ReadMany({{0, 4}}));
+}
+
+TEST_F(TestMemoryMappedFile, AdviseAndWillNeed) {
+  const int64_t buffer_size = 3 * 4096 + 100;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-advise-test";
+  ASSERT_OK_AND_ASSIGN(auto mmap, InitMemoryMap(buffer_size, path));
+  ASSERT_OK(mmap->Write(buffer.data(), buffer_size));
+
+  for (auto advice :
+       {MemoryAdvice::Sequential, MemoryAdvice::Random, MemoryAdvice::Normal}) {
+    ASSERT_OK(mmap->Advise(advice));
+  }
+  // Ranges needn't be page-aligned, and are clamped to the map
+  ASSERT_OK(mmap->WillNeed({{0, 10}, {4097, 5000}, {buffer_size - 1, 1000}}));
+  ASSERT_OK(mmap->WillNeed({{buffer_size + 10, 10}, {0, 0}}));
+
+  ASSERT_OK_AND_ASSIGN(auto out_buffer, mmap->ReadAt(0, buffer_size));
+  AssertBufferEqual(*out_buffer, Buffer(buffer.data(), buffer_size));
+
+  ASSERT_OK(mmap->Close());
+  ASSERT_RAISES(Invalid, mmap->Advise(MemoryAdvice::Sequential));
+  ASSERT_RAISES(Invalid, mmap->WillNeed({{0, 10}}));
+}
+
 TEST_F(TestMemoryMappedFile, InvalidReads) {
   std::string path = "io-memory-map-invalid-reads-test";
   ASSERT_OK_AND_ASSIGN(auto result, InitMemoryMap(4096, path));
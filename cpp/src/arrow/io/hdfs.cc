@@ -16,9 +16,11 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -31,6 +33,7 @@
 #include "arrow/io/hdfs.h"
 #include "arrow/io/hdfs_internal.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -64,6 +67,11 @@ std::string TranslateErrno(int error_code) {
 
 static constexpr int kDefaultHdfsBufferSize = 1 << 16;
 
+// Ranges given to HdfsReadableFile::ReadMany() are read together if they are
+// at most this many bytes apart (see ReadRangeCache)
+static constexpr int64_t kReadManyHoleSizeLimit = 8192;
+static constexpr int64_t kReadManyRangeSizeLimit = 32 * 1024 * 1024;
+
 // ----------------------------------------------------------------------
 // File reading
 
@@ -122,6 +130,27 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
  public:
   explicit HdfsReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
 
+  ~HdfsReadableFileImpl() {
+    if (rz_options_ != nullptr) {
+      driver_->RzOptionsFree(rz_options_);
+    }
+  }
+
+  // Read through hadoopReadZero(), which maps the blocks read with short-circuit
+  // local reads instead of copying them through the JVM
+  void EnableZeroCopyReads(bool skip_checksum) {
+    if (!driver_->HasReadZero()) {
+      return;
+    }
+    rz_options_ = driver_->RzOptionsAlloc();
+    if (rz_options_ == nullptr) {
+      return;
+    }
+    // Blocks are only mapped if their checksums need not be verified
+    driver_->RzOptionsSetSkipChecksum(rz_options_, skip_checksum ? 1 : 0);
+    zero_copy_ = true;
+  }
+
   Status Close() {
     if (is_open_) {
       // is_open_ must be set to false in the beginning, because the destructor
@@ -138,7 +167,7 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   bool closed() const { return !is_open_; }
 
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* buffer) {
-    if (!driver_->HasPread()) {
+    if (zero_copy_ || !driver_->HasPread()) {
       std::lock_guard<std::mutex> guard(lock_);
       RETURN_NOT_OK(Seek(position));
       return Read(nbytes, buffer);
@@ -164,6 +193,13 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Result<int64_t> Read(int64_t nbytes, void* buffer) {
+    if (zero_copy_) {
+      return ReadZeroCopy(nbytes, buffer);
+    }
+    return ReadThroughJvm(nbytes, buffer);
+  }
+
+  Result<int64_t> ReadThroughJvm(int64_t nbytes, void* buffer) {
     int64_t total_bytes = 0;
     while (total_bytes < nbytes) {
       tSize ret = driver_->Read(
@@ -188,6 +224,89 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
     return std::move(buffer);
   }
 
+  Result<int64_t> ReadZeroCopy(int64_t nbytes, void* buffer) {
+    auto out = reinterpret_cast<uint8_t*>(buffer);
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      hadoopRzBuffer* rz_buffer = driver_->ReadZero(
+          file_, rz_options_,
+          static_cast<int32_t>(std::min<int64_t>(nbytes - total_bytes,
+                                                 std::numeric_limits<int32_t>::max())));
+      if (rz_buffer == nullptr) {
+        if (errno != EOPNOTSUPP) {
+          return Status::IOError("HDFS zero-copy read failed, errno: ",
+                                 TranslateErrno(errno));
+        }
+        // The block is not local, or its checksum must be verified.  Rather
+        // than failing again on each read, read the rest of the file through
+        // the JVM (which may still use short-circuit reads).
+        zero_copy_ = false;
+        ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                              ReadThroughJvm(nbytes - total_bytes, out + total_bytes));
+        return total_bytes + bytes_read;
+      }
+      const void* data = driver_->RzBufferGet(rz_buffer);
+      const int32_t length = data == nullptr ? 0 : driver_->RzBufferLength(rz_buffer);
+      if (length > 0) {
+        std::memcpy(out + total_bytes, data, static_cast<size_t>(length));
+      }
+      driver_->RzBufferFree(file_, rz_buffer);
+      if (length == 0) {
+        // EOF
+        break;
+      }
+      total_bytes += length;
+    }
+    return total_bytes;
+  }
+
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadMany(
+      const std::vector<ReadRange>& ranges) {
+    for (const auto& range : ranges) {
+      RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+    }
+    // Each read is a JNI call, and a datanode request unless served locally,
+    // so nearby ranges are read together and sliced.  Unlike
+    // internal::CoalesceReadRanges(), overlapping ranges are allowed.
+    std::vector<size_t> order(ranges.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t left, size_t right) {
+      return ranges[left].offset < ranges[right].offset;
+    });
+
+    std::vector<std::shared_ptr<Buffer>> buffers(ranges.size());
+    size_t group_start = 0;
+    while (group_start < order.size()) {
+      const int64_t offset = ranges[order[group_start]].offset;
+      int64_t end = offset + ranges[order[group_start]].length;
+      size_t group_end = group_start + 1;
+      while (group_end < order.size()) {
+        const auto& next = ranges[order[group_end]];
+        const int64_t next_end = std::max(end, next.offset + next.length);
+        if (next.offset - end > kReadManyHoleSizeLimit ||
+            next_end - offset > kReadManyRangeSizeLimit) {
+          break;
+        }
+        end = next_end;
+        ++group_end;
+      }
+
+      ARROW_ASSIGN_OR_RAISE(auto group_buffer, ReadFullyAt(offset, end - offset));
+      for (size_t i = group_start; i < group_end; ++i) {
+        const auto& range = ranges[order[i]];
+        const int64_t slice_offset =
+            std::min(range.offset - offset, group_buffer->size());
+        const int64_t slice_length =
+            std::min(range.length, group_buffer->size() - slice_offset);
+        buffers[order[i]] = SliceBuffer(group_buffer, slice_offset, slice_length);
+      }
+      group_start = group_end;
+    }
+    return buffers;
+  }
+
   Result<int64_t> GetSize() {
     hdfsFileInfo* entry = driver_->GetPathInfo(fs_, path_.c_str());
     if (entry == nullptr) {
@@ -204,8 +323,32 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
 
  private:
+  // Unlike ReadAt(), do not return before EOF when a single pread is short,
+  // since the buffer read is sliced into several ranges
+  Result<std::shared_ptr<Buffer>> ReadFullyAt(int64_t position, int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                            ReadAt(position + total_bytes, nbytes - total_bytes,
+                                   buffer->mutable_data() + total_bytes));
+      if (bytes_read == 0) {
+        break;
+      }
+      total_bytes += bytes_read;
+    }
+    if (total_bytes < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(total_bytes));
+      buffer->ZeroPadding();
+    }
+    return std::move(buffer);
+  }
+
   MemoryPool* pool_;
   int32_t buffer_size_;
+
+  hadoopRzOptions* rz_options_ = nullptr;
+  std::atomic<bool> zero_copy_{false};
 };
 
 HdfsReadableFile::HdfsReadableFile(MemoryPool* pool) {
@@ -238,6 +381,11 @@ Result<std::shared_ptr<Buffer>> HdfsReadableFile::Read(int64_t nbytes) {
   return impl_->Read(nbytes);
 }
 
+Result<std::vector<std::shared_ptr<Buffer>>> HdfsReadableFile::ReadMany(
+    const std::vector<ReadRange>& ranges) {
+  return impl_->ReadMany(ranges);
+}
+
 Result<int64_t> HdfsReadableFile::GetSize() { return impl_->GetSize(); }
 
 Status HdfsReadableFile::Seek(int64_t position) { return impl_->Seek(position); }
@@ -347,6 +495,15 @@ class HadoopFileSystem::HadoopFileSystemImpl {
       driver_->BuilderSetKerbTicketCachePath(builder, config->kerb_ticket.c_str());
     }
 
+    // Set before extra_conf, which can override these settings
+    if (!config->domain_socket_path.empty()) {
+      int ret =
+          driver_->BuilderConfSetStr(builder, "dfs.client.read.shortcircuit", "true");
+      CHECK_FAILURE(ret, "confsetstr");
+      ret = driver_->BuilderConfSetStr(builder, "dfs.domain.socket.path",
+                                       config->domain_socket_path.c_str());
+      CHECK_FAILURE(ret, "confsetstr");
+    }
     for (auto& kv : config->extra_conf) {
       int ret = driver_->BuilderConfSetStr(builder, kv.first.c_str(), kv.second.c_str());
       CHECK_FAILURE(ret, "confsetstr");
@@ -362,6 +519,9 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     port_ = config->port;
     user_ = config->user;
     kerb_ticket_ = config->kerb_ticket;
+    short_circuit_reads_ = !config->domain_socket_path.empty();
+    auto it = config->extra_conf.find("dfs.client.read.shortcircuit.skip.checksum");
+    skip_checksum_ = it != config->extra_conf.end() && it->second == "true";
 
     return Status::OK();
   }
@@ -496,6 +656,9 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
     (*file)->impl_->set_buffer_size(buffer_size);
+    if (short_circuit_reads_) {
+      (*file)->impl_->EnableZeroCopyReads(skip_checksum_);
+    }
 
     return Status::OK();
   }
@@ -546,6 +709,8 @@ class HadoopFileSystem::HadoopFileSystemImpl {
   std::string user_;
   int port_;
   std::string kerb_ticket_;
+  bool short_circuit_reads_ = false;
+  bool skip_checksum_ = false;
 
   hdfsFS fs_;
 };
@@ -89,6 +89,9 @@ struct HdfsConnectionConfig {
   int port;
   std::string user;
   std::string kerb_ticket;
+  // If not empty, the UNIX domain socket of the local datanode, to enable
+  // short-circuit reads of local blocks (see HdfsReadableFile)
+  std::string domain_socket_path;
   std::unordered_map<std::string, std::string> extra_conf;
 };
 
@@ -209,6 +212,13 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
   ARROW_DISALLOW_COPY_AND_ASSIGN(HadoopFileSystem);
 };
 
+// When the file system was connected with a domain_socket_path, the blocks
+// stored on the local datanode are read with zero-copy reads: they are mapped
+// in memory and copied once into the returned buffers, without going through
+// the JVM.  This requires checksums to be skipped (by setting
+// dfs.client.read.shortcircuit.skip.checksum in extra_conf) or the blocks to be
+// cached by the datanode.  After the first read that cannot be done this way,
+// the file is read through the JVM as usual.
 class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
  public:
   ~HdfsReadableFile() override;
@@ -224,6 +234,10 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override;
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override;
 
+  // Ranges less than 8 KiB apart are read with a single call and sliced
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadMany(
+      const std::vector<ReadRange>& ranges) override;
+
   Status Seek(int64_t position) override;
   Result<int64_t> Tell() const override;
   Result<int64_t> GetSize() override;
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdlib>
@@ -342,6 +343,35 @@ TEST_F(TestHadoopFileSystem, ReadableMethods) {
   ASSERT_OK_AND_EQ(60, file->Tell());
 }
 
+TEST_F(TestHadoopFileSystem, ReadMany) {
+  SKIP_IF_NO_DRIVER();
+
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("test-file");
+  const int size = 100000;
+
+  std::vector<uint8_t> data = RandomData(size);
+  ASSERT_OK(this->WriteDummyFile(path, data.data(), size));
+
+  std::shared_ptr<HdfsReadableFile> file;
+  ASSERT_OK(this->client_->OpenReadable(path, &file));
+
+  // Out of order, overlapping, far apart, empty and past EOF ranges
+  std::vector<ReadRange> ranges = {
+      {50000, 100}, {10, 20}, {0, 15}, {30, 0}, {40, 8000}, {99990, 100}, {200000, 5}};
+  ASSERT_OK_AND_ASSIGN(auto buffers, file->ReadMany(ranges));
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const int64_t offset = std::min<int64_t>(ranges[i].offset, size);
+    const int64_t length = std::min<int64_t>(ranges[i].length, size - offset);
+    ASSERT_EQ(buffers[i]->size(), length);
+    ASSERT_EQ(0, std::memcmp(buffers[i]->data(), data.data() + offset, length));
+  }
+
+  ASSERT_RAISES(Invalid, file->ReadMany({{0, 4}, {-1, 4}}));
+}
+
 TEST_F(TestHadoopFileSystem, LargeFile) {
   SKIP_IF_NO_DRIVER();
 
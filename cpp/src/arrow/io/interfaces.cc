@@ -24,6 +24,7 @@
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <string>
 #include <typeinfo>
 #include <utility>
 
@@ -33,6 +34,7 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
@@ -114,6 +116,17 @@ Result<std::shared_ptr<Buffer>> RandomAccessFile::ReadAt(int64_t position,
   return Read(nbytes);
 }
 
+Result<std::vector<std::shared_ptr<Buffer>>> RandomAccessFile::ReadMany(
+    const std::vector<ReadRange>& ranges) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  buffers.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(range.offset, range.length));
+    buffers.push_back(std::move(buffer));
+  }
+  return buffers;
+}
+
 // Default ReadAsync() implementation: simply issue the read on one of the IO threads
 Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(int64_t position,
                                                             int64_t nbytes) {
@@ -127,6 +140,20 @@ Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(int64_t position,
   return *std::move(maybe_fut);
 }
 
+std::vector<Future<std::shared_ptr<Buffer>>> RandomAccessFile::ReadManyAsync(
+    const std::vector<ReadRange>& ranges) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    futures.push_back(ReadAsync(range.offset, range.length));
+  }
+  return futures;
+}
+
+Status RandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return Status::OK();
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
@@ -307,8 +334,26 @@ void SharedExclusiveChecker::UnlockExclusive() {}
 
 #endif
 
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+static int DefaultIOThreadPoolCapacity() {
+  auto result = ::arrow::internal::GetEnvVar("ARROW_IO_THREADS");
+  if (result.ok()) {
+    try {
+      auto capacity = std::stoi(*result);
+      if (capacity > 0) {
+        return capacity;
+      }
+    } catch (...) {
+    }
+    ARROW_LOG(WARNING) << "Invalid value for ARROW_IO_THREADS: '" << *result
+                       << "', using the default of " << kDefaultIOThreadPoolCapacity;
+  }
+  return kDefaultIOThreadPoolCapacity;
+}
+
 static std::shared_ptr<ThreadPool> MakeIOThreadPool() {
-  auto maybe_pool = ThreadPool::MakeEternal(/*threads=*/8);
+  auto maybe_pool = ThreadPool::MakeEternal(DefaultIOThreadPoolCapacity());
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global IO thread pool");
   }
@@ -427,5 +472,12 @@ std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
 }
 
 }  // namespace internal
+
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace io
 }  // namespace arrow
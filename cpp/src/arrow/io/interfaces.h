@@ -225,9 +225,42 @@ class ARROW_EXPORT RandomAccessFile
   /// \return A buffer containing the bytes read, or an error
   virtual Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes);
 
-  // EXPERIMENTAL
+  /// \brief Read several ranges of the file.
+  ///
+  /// Returns one buffer per range, in the same order.  As with ReadAt(), a
+  /// buffer can be shorter than its range if EOF is reached.
+  ///
+  /// The default implementation calls ReadAt() for each range; implementations
+  /// may override it with a more efficient strategy (such as batched system
+  /// calls or concurrent requests).
+  ///
+  /// \param[in] ranges The ranges to read
+  /// \return The buffers read, or an error
+  virtual Result<std::vector<std::shared_ptr<Buffer>>> ReadMany(
+      const std::vector<ReadRange>& ranges);
+
+  /// EXPERIMENTAL: Read data asynchronously from given file position.
+  ///
+  /// The default implementation issues ReadAt() on the IO thread pool
+  /// (see GetIOThreadPoolCapacity()).  Files backed by a natively
+  /// asynchronous API (such as S3) override it to avoid tying up an
+  /// IO thread for the duration of the request.
   virtual Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes);
 
+  /// EXPERIMENTAL: Read several ranges of the file asynchronously.
+  ///
+  /// Returns one future per range, in the same order.  The default
+  /// implementation calls ReadAsync() for each range; implementations
+  /// may override it to submit the reads as a batch.
+  virtual std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const std::vector<ReadRange>& ranges);
+
+  /// \brief Inform that the given ranges will be read soon.
+  ///
+  /// This is only a hint: some implementations may use it to start reading
+  /// the ranges ahead, the default implementation does nothing.
+  virtual Status WillNeed(const std::vector<ReadRange>& ranges);
+
  protected:
   RandomAccessFile();
 
@@ -259,5 +292,24 @@ ARROW_EXPORT
 Result<Iterator<std::shared_ptr<Buffer>>> MakeInputStreamIterator(
     std::shared_ptr<InputStream> stream, int64_t block_size);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks (such as RandomAccessFile::ReadAsync).
+/// This pool is distinct from the CPU thread pool, so that threads blocked
+/// on high-latency storage do not take capacity away from computation.
+///
+/// The default is 8, or the value of the ARROW_IO_THREADS environment variable
+/// if set.  You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 }  // namespace io
 }  // namespace arrow
@@ -299,6 +299,18 @@ Result<util::string_view> BufferReader::DoPeek(int64_t nbytes) {
 
 bool BufferReader::supports_zero_copy() const { return true; }
 
+Result<std::vector<std::shared_ptr<Buffer>>> BufferReader::ReadMany(
+    const std::vector<ReadRange>& ranges) {
+  auto guard = lock_.shared_guard();
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  buffers.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(range.offset, range.length));
+    buffers.push_back(std::move(buffer));
+  }
+  return buffers;
+}
+
 Future<std::shared_ptr<Buffer>> BufferReader::ReadAsync(int64_t position,
                                                         int64_t nbytes) {
   return Future<std::shared_ptr<Buffer>>::MakeFinished(DoReadAt(position, nbytes));
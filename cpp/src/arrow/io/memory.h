@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -158,6 +159,10 @@ class ARROW_EXPORT BufferReader
 
   std::shared_ptr<Buffer> buffer() const { return buffer_; }
 
+  // Zero-copy ReadMany override
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadMany(
+      const std::vector<ReadRange>& ranges) override;
+
   // Synchronous ReadAsync override
   Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes) override;
 
@@ -38,6 +38,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -219,6 +220,25 @@ TEST(TestBufferReader, ReadAsync) {
   AssertBufferEqual(*buf, "ata1");
 }
 
+TEST(TestBufferReader, ReadMany) {
+  std::string data = "data123456";
+  auto data_buffer = std::make_shared<Buffer>(data);
+  BufferReader reader(data_buffer);
+
+  ASSERT_OK_AND_ASSIGN(auto buffers, reader.ReadMany({{2, 6}, {1, 4}, {8, 10}, {3, 0}}));
+  ASSERT_EQ(buffers.size(), 4);
+  AssertBufferEqual(*buffers[0], "ta1234");
+  AssertBufferEqual(*buffers[1], "ata1");
+  AssertBufferEqual(*buffers[2], "56");
+  AssertBufferEqual(*buffers[3], "");
+  // Zero-copy
+  ASSERT_EQ(buffers[0]->data(), data_buffer->data() + 2);
+
+  ASSERT_RAISES(Invalid, reader.ReadMany({{0, 1}, {-1, 1}}));
+  ASSERT_OK(reader.Close());
+  ASSERT_RAISES(Invalid, reader.ReadMany({{0, 1}}));
+}
+
 TEST(TestBufferReader, InvalidReads) {
   std::string data = "data123456";
   BufferReader reader(std::make_shared<Buffer>(data));
@@ -478,5 +498,27 @@ TEST(RangeReadCache, Basics) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+TEST(IOThreadPool, Capacity) {
+  // Simple sanity check
+  auto pool = internal::GetIOThreadPool();
+  int capacity = pool->GetCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity);
+
+  // The I/O pool is resized independently from the CPU pool
+  int cpu_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 3));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 3);
+  ASSERT_EQ(GetCpuThreadPoolCapacity(), cpu_capacity);
+
+  // Tasks are still serviced after resizing
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([] { return 42; }));
+  ASSERT_OK_AND_EQ(42, fut.result());
+
+  ASSERT_RAISES(Invalid, SetIOThreadPoolCapacity(0));
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity);
+}
+
 }  // namespace io
 }  // namespace arrow
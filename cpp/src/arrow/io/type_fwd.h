@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace arrow {
 namespace io {
 
@@ -24,6 +26,16 @@ struct FileMode {
   enum type { READ, WRITE, READWRITE };
 };
 
+/// \brief Access patterns of a memory-mapped file, which may be advised to the OS
+enum class MemoryAdvice : int8_t {
+  /// No particular access pattern
+  Normal,
+  /// Pages are accessed in order: read them ahead aggressively
+  Sequential,
+  /// Pages are accessed in random order: don't read them ahead
+  Random
+};
+
 class FileInterface;
 class Seekable;
 class Writable;
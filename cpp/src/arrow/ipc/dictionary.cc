@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -133,11 +134,30 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+void DictionaryMemo::AddOrReplaceDictionary(int64_t id,
+                                            const std::shared_ptr<Array>& dictionary) {
+  id_to_dictionary_[id] = dictionary;
+}
+
+Status DictionaryMemo::AddDictionaryDelta(int64_t id,
+                                          const std::shared_ptr<Array>& dictionary,
+                                          MemoryPool* pool) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("No dictionary with id ", id, " to add a delta to");
+  }
+  std::shared_ptr<Array> combined;
+  RETURN_NOT_OK(Concatenate({it->second, dictionary}, pool, &combined));
+  it->second = std::move(combined);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // CollectDictionaries implementation
 
 struct DictionaryCollector {
   DictionaryMemo* dictionary_memo_;
+  DictionaryVector* dictionaries_;
 
   Status WalkChildren(const DataType& type, const Array& array) {
     for (int i = 0; i < type.num_children(); ++i) {
@@ -154,7 +174,7 @@ struct DictionaryCollector {
       auto dictionary = dict_array.dictionary();
       int64_t id = -1;
       RETURN_NOT_OK(dictionary_memo_->GetOrAssignId(field, &id));
-      RETURN_NOT_OK(dictionary_memo_->AddDictionary(id, dictionary));
+      dictionaries_->emplace_back(id, dictionary);
 
       // Traverse the dictionary to gather any nested dictionaries
       const auto& dict_type = static_cast<const DictionaryType&>(*type);
@@ -175,7 +195,18 @@ struct DictionaryCollector {
 };
 
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo) {
-  DictionaryCollector collector{memo};
+  DictionaryVector dictionaries;
+  RETURN_NOT_OK(CollectDictionaries(batch, memo, &dictionaries));
+  for (const auto& pair : dictionaries) {
+    RETURN_NOT_OK(memo->AddDictionary(pair.first, pair.second));
+  }
+  return Status::OK();
+}
+
+Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo,
+                           DictionaryVector* dictionaries) {
+  dictionaries->clear();
+  DictionaryCollector collector{memo, dictionaries};
   return collector.Collect(batch);
 }
 
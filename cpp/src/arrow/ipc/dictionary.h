@@ -22,6 +22,8 @@
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -32,11 +34,13 @@ namespace arrow {
 class Array;
 class DataType;
 class Field;
+class MemoryPool;
 class RecordBatch;
 
 namespace ipc {
 
 using DictionaryMap = std::unordered_map<int64_t, std::shared_ptr<Array>>;
+using DictionaryVector = std::vector<std::pair<int64_t, std::shared_ptr<Array>>>;
 
 /// \brief Memoization data structure for assigning id numbers to
 /// dictionaries and tracking their current state through possible
@@ -76,6 +80,15 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Add a dictionary to the memo with a particular id, replacing
+  /// any existing dictionary with that id
+  void AddOrReplaceDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
+  /// \brief Append delta values to the dictionary with a particular id.
+  /// Returns KeyError if that dictionary doesn't exist
+  Status AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& dictionary,
+                            MemoryPool* pool);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of fields tracked in the memo
@@ -99,5 +112,14 @@ class ARROW_EXPORT DictionaryMemo {
 ARROW_EXPORT
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo);
 
+/// \brief Collect the dictionaries of a record batch, including nested ones,
+/// in depth-first order of their fields
+///
+/// Ids are assigned to the dictionary fields in `memo` if necessary, but
+/// the dictionaries themselves are not added to `memo`.
+ARROW_EXPORT
+Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo,
+                           DictionaryVector* dictionaries);
+
 }  // namespace ipc
 }  // namespace arrow
@@ -383,6 +383,13 @@ class ReaderV1 : public Reader {
     return Status::OK();
   }
 
+  Status ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) override {
+    if (i < 0 || i >= schema_->num_fields()) {
+      return Status::Invalid("Field index ", i, " is out of bounds");
+    }
+    return GetColumn(i, out);
+  }
+
  private:
   std::shared_ptr<io::RandomAccessFile> source_;
   std::shared_ptr<Buffer> metadata_buffer_;
@@ -760,6 +767,18 @@ class ReaderV2 : public Reader {
     return Read(indices, out);
   }
 
+  Status ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) override {
+    if (i < 0 || i >= schema_->num_fields()) {
+      return Status::Invalid("Field index ", i, " is out of bounds");
+    }
+    // The record batches are read with only this field included, so that the
+    // buffers of the other fields are neither read nor decompressed
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(Read(std::vector<int>{i}, &table));
+    *out = table->column(0);
+    return Status::OK();
+  }
+
  private:
   std::shared_ptr<io::RandomAccessFile> source_;
   std::shared_ptr<Schema> schema_;
@@ -31,6 +31,7 @@
 
 namespace arrow {
 
+class ChunkedArray;
 class Schema;
 class Status;
 class Table;
@@ -95,6 +96,19 @@ class ARROW_EXPORT Reader {
   /// This function is zero-copy if the file source supports zero-copy reads
   virtual Status Read(const std::vector<std::string>& names,
                       std::shared_ptr<Table>* out) = 0;
+
+  /// \brief Read a single column from the file.
+  ///
+  /// \param[in] i the column index
+  /// \param[out] out the returned column
+  /// \return Status
+  ///
+  /// Only the buffers of the column are read, and decompressed in Feather V2
+  /// files written with compression, so that a few columns of a large, wide
+  /// file can be accessed without touching the others.  This function is
+  /// zero-copy if the file source supports zero-copy reads, e.g. an
+  /// io::MemoryMappedFile, and the file is not compressed.
+  virtual Status ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) = 0;
 };
 
 struct ARROW_EXPORT WriteProperties {
@@ -154,6 +154,31 @@ TEST_P(TestFeather, ReadIndicesOrNames) {
   AssertTablesEqual(*expected, *result2);
 }
 
+TEST_P(TestFeather, ReadColumn) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeStringTypesRecordBatchWithNulls(&batch));
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch}));
+
+  DoWrite(*table);
+
+  for (int i = 0; i < table->num_columns(); ++i) {
+    std::shared_ptr<ChunkedArray> column;
+    ASSERT_OK(reader_->ReadColumn(i, &column));
+    AssertChunkedEqual(*table->column(i), *column);
+
+    if (GetProperties().compression == Compression::UNCOMPRESSED) {
+      // The values are sliced from the file buffer rather than copied
+      const auto& values = column->chunk(0)->data()->buffers.back();
+      ASSERT_GE(values->data(), output_->data());
+      ASSERT_LE(values->data() + values->size(), output_->data() + output_->size());
+    }
+  }
+
+  std::shared_ptr<ChunkedArray> column;
+  ASSERT_RAISES(Invalid, reader_->ReadColumn(-1, &column));
+  ASSERT_RAISES(Invalid, reader_->ReadColumn(table->num_columns(), &column));
+}
+
 TEST_P(TestFeather, EmptyTable) {
   std::vector<std::shared_ptr<ChunkedArray>> columns;
   auto table = Table::Make(schema({}), columns, 0);
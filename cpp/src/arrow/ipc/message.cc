@@ -30,6 +30,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/options.h"
+#include "arrow/ipc/scattered_buffer_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -456,7 +457,8 @@ class MessageDecoder::MessageDecoderImpl {
         next_required_size_(initial_next_required_size),
         chunks_(),
         buffered_size_(0),
-        metadata_(nullptr) {}
+        metadata_(nullptr),
+        allow_scattered_body_(false) {}
 
   Status ConsumeData(const uint8_t* data, int64_t size) {
     if (buffered_size_ == 0) {
@@ -544,6 +546,8 @@ class MessageDecoder::MessageDecoderImpl {
 
   MessageDecoder::State state() const { return state_; }
 
+  void set_allow_scattered_body(bool allow) { allow_scattered_body_ = allow; }
+
  private:
   Status ConsumeChunks() {
     while (state_ != State::EOS) {
@@ -711,6 +715,12 @@ class MessageDecoder::MessageDecoderImpl {
       buffered_size_ -= used_size;
       return Status::OK();
     } else {
+      if (allow_scattered_body_) {
+        auto body = ConsumeScatteredChunks(next_required_size_);
+        if (body != nullptr) {
+          return ConsumeBody(&body);
+        }
+      }
       ARROW_ASSIGN_OR_RAISE(auto body, AllocateBuffer(next_required_size_, pool_));
       RETURN_NOT_OK(ConsumeDataChunks(next_required_size_, body->mutable_data()));
       std::shared_ptr<Buffer> shared_body(body.release());
@@ -771,6 +781,33 @@ class MessageDecoder::MessageDecoderImpl {
     return Status::OK();
   }
 
+  // Take the first nbytes bytes of the chunks as a ScatteredBuffer over them,
+  // without copying. Return null, leaving the chunks untouched, if any of them
+  // isn't CPU memory.
+  std::shared_ptr<Buffer> ConsumeScatteredChunks(int64_t nbytes) {
+    size_t n_used_chunks = 0;
+    int64_t used_size = 0;
+    while (used_size < nbytes) {
+      if (!chunks_[n_used_chunks]->is_cpu()) {
+        return nullptr;
+      }
+      used_size += chunks_[n_used_chunks]->size();
+      ++n_used_chunks;
+    }
+    std::vector<std::shared_ptr<Buffer>> segments(chunks_.begin(),
+                                                  chunks_.begin() + n_used_chunks);
+    chunks_.erase(chunks_.begin(), chunks_.begin() + n_used_chunks);
+    if (used_size > nbytes) {
+      // The last chunk also holds the beginning of the next message
+      auto last_chunk = std::move(segments.back());
+      const int64_t last_used_size = last_chunk->size() - (used_size - nbytes);
+      segments.back() = SliceBuffer(last_chunk, 0, last_used_size);
+      chunks_.insert(chunks_.begin(), SliceBuffer(last_chunk, last_used_size));
+    }
+    buffered_size_ -= nbytes;
+    return std::make_shared<internal::ScatteredBuffer>(std::move(segments), pool_);
+  }
+
   std::shared_ptr<MessageDecoderListener> listener_;
   MemoryPool* pool_;
   State state_;
@@ -778,6 +815,7 @@ class MessageDecoder::MessageDecoderImpl {
   std::vector<std::shared_ptr<Buffer>> chunks_;
   int64_t buffered_size_;
   std::shared_ptr<Buffer> metadata_;  // Must be CPU buffer
+  bool allow_scattered_body_;
 };
 
 MessageDecoder::MessageDecoder(std::shared_ptr<MessageDecoderListener> listener,
@@ -807,6 +845,10 @@ int64_t MessageDecoder::next_required_size() const { return impl_->next_required
 
 MessageDecoder::State MessageDecoder::state() const { return impl_->state(); }
 
+void MessageDecoder::set_allow_scattered_body(bool allow) {
+  impl_->set_allow_scattered_body(allow);
+}
+
 // ----------------------------------------------------------------------
 // Implement InputStream message reader
 
@@ -455,6 +455,21 @@ class ARROW_EXPORT MessageDecoder {
   /// \return the current state
   State state() const;
 
+  /// \brief Allow message bodies to be made of several buffers.
+  ///
+  /// By default, a message body received over several Consume() calls is
+  /// concatenated into a single buffer allocated from the decoder's pool.
+  /// If allowed, the body is instead a buffer over the received chunks,
+  /// and a body buffer lying within one chunk is then read from it as a
+  /// zero-copy slice; only the ones straddling chunks are copied.
+  ///
+  /// Such a body has no data pointer: it must be read through
+  /// Buffer::GetReader(), as the IPC readers do. Only enable this if the
+  /// listener doesn't access Message::body()->data() directly.
+  ///
+  /// \param[in] allow whether to allow scattered message bodies
+  void set_allow_scattered_body(bool allow);
+
  private:
   class MessageDecoderImpl;
   std::unique_ptr<MessageDecoderImpl> impl_;
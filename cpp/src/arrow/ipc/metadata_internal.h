@@ -67,6 +67,10 @@ using KVVector = flatbuffers::Vector<KeyValueOffset>;
 // This 0xFFFFFFFF value is the first 4 bytes of a valid IPC message
 constexpr int32_t kIpcContinuationToken = -1;
 
+// Uncompressed length prefix of a compressed body buffer signalling that the
+// buffer data that follows is stored uncompressed
+constexpr int64_t kUncompressedBufferPrefix = -1;
+
 static constexpr flatbuf::MetadataVersion kCurrentMetadataVersion =
     flatbuf::MetadataVersion::V4;
 
@@ -195,7 +199,8 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
                        io::OutputStream* out);
 
 Status WriteDictionaryMessage(
-    const int64_t id, const int64_t length, const int64_t body_length,
+    const int64_t id, const bool is_delta, const int64_t length,
+    const int64_t body_length,
     const std::shared_ptr<const KeyValueMetadata>& custom_metadata,
     const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
     std::shared_ptr<Buffer>* out);
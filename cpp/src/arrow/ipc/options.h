@@ -58,7 +58,8 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// \brief EXPERIMENTAL: Codec to use for compressing and decompressing
   /// record batch body buffers. This is not part of the Arrow IPC protocol and
   /// only for internal use (e.g. Feather files). May only be LZ4_FRAME and
-  /// ZSTD
+  /// ZSTD. Each buffer is prefixed with its uncompressed length, buffers that
+  /// don't shrink when compressed are stored as is
   Compression::type compression = Compression::UNCOMPRESSED;
   int compression_level = Compression::kUseDefaultCompressionLevel;
 
@@ -66,6 +67,15 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// like compression
   bool use_threads = true;
 
+  /// \brief Whether to emit dictionary deltas
+  ///
+  /// When a record batch written to an IPC stream has a dictionary extending
+  /// the previously written one with new values, only the new values are
+  /// written, as a delta dictionary batch.  Otherwise the whole dictionary is
+  /// written again, as a replacement.  Some readers may not support deltas.
+  /// The IPC file format supports neither deltas nor replacements.
+  bool emit_dictionary_deltas = false;
+
   static IpcWriteOptions Defaults();
 };
 
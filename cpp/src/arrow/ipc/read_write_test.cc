@@ -48,6 +48,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
@@ -525,6 +526,65 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, WriteWithCompressionNested) {
+  // Buffers of child arrays are compressed too
+  std::vector<std::shared_ptr<RecordBatch>> batches(3);
+  ASSERT_OK(MakeListRecordBatch(&batches[0]));
+  ASSERT_OK(MakeStruct(&batches[1]));
+  ASSERT_OK(MakeDeeplyNestedList(&batches[2]));
+
+  std::vector<Compression::type> codecs = {Compression::LZ4_FRAME, Compression::ZSTD};
+  for (auto codec : codecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+    write_options.compression = codec;
+    for (const auto& batch : batches) {
+      CheckRoundtrip(*batch, write_options);
+    }
+  }
+}
+
+TEST_F(TestWriteRecordBatch, WriteWithCompressionReadSubset) {
+  random::RandomArrayGenerator rg(/*seed=*/0);
+
+  // Random bytes don't compress well and are stored uncompressed, while the
+  // constant column compresses
+  int64_t length = 1000;
+  auto schema =
+      ::arrow::schema({field("f0", int8()), field("f1", utf8()), field("f2", int64())});
+  auto batch = RecordBatch::Make(
+      schema, length,
+      {rg.Int8(length, /*min=*/-128, /*max=*/127, /*null_probability=*/0),
+       rg.String(length, 0, 10, 0.1), rg.Int64(length, 7, 7, 0)});
+
+  std::vector<Compression::type> codecs = {Compression::LZ4_FRAME, Compression::ZSTD};
+  for (auto codec : codecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+    write_options.compression = codec;
+    CheckRoundtrip(*batch, write_options);
+
+    for (bool use_threads : {false, true}) {
+      IpcReadOptions read_options = IpcReadOptions::Defaults();
+      read_options.use_threads = use_threads;
+      read_options.included_fields = {0, 2};
+
+      DictionaryMemo dictionary_memo;
+      ASSERT_OK_AND_ASSIGN(
+          auto result,
+          DoStandardRoundTrip(*batch, write_options, &dictionary_memo, read_options));
+      auto ex_schema = ::arrow::schema({schema->field(0), schema->field(2)});
+      auto ex_batch =
+          RecordBatch::Make(ex_schema, length, {batch->column(0), batch->column(2)});
+      CheckReadResult(*result, *ex_batch);
+    }
+  }
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -962,6 +1022,39 @@ struct StreamDecoderLargeChunksWriterHelper : public StreamWriterHelper {
   }
 };
 
+// Feed the stream as separately allocated chunks, as received from a socket,
+// so that message bodies span several chunks
+struct StreamDecoderScatteredChunksWriterHelper : public StreamWriterHelper {
+  static constexpr int64_t kChunkSize = 64;
+
+  Status ConsumeChunks(StreamDecoder* decoder) {
+    for (int64_t offset = 0; offset < buffer_->size(); offset += kChunkSize) {
+      auto chunk_size = std::min(kChunkSize, buffer_->size() - offset);
+      ARROW_ASSIGN_OR_RAISE(auto chunk,
+                            Buffer::Copy(SliceBuffer(buffer_, offset, chunk_size),
+                                         default_cpu_memory_manager()));
+      ARROW_RETURN_NOT_OK(decoder->Consume(std::move(chunk)));
+    }
+    return Status::OK();
+  }
+
+  Status ReadBatches(const IpcReadOptions& options, BatchVector* out_batches) {
+    auto listener = std::make_shared<CollectListener>();
+    StreamDecoder decoder(listener, options);
+    ARROW_RETURN_NOT_OK(ConsumeChunks(&decoder));
+    *out_batches = listener->record_batches();
+    return Status::OK();
+  }
+
+  Status ReadSchema(std::shared_ptr<Schema>* out) {
+    auto listener = std::make_shared<CollectListener>();
+    StreamDecoder decoder(listener);
+    ARROW_RETURN_NOT_OK(ConsumeChunks(&decoder));
+    *out = listener->schema();
+    return Status::OK();
+  }
+};
+
 // Parameterized mixin with tests for stream / file writer
 
 template <class WriterHelperType>
@@ -1172,6 +1265,9 @@ class TestStreamDecoderSmallChunks
 class TestStreamDecoderLargeChunks
     : public ReaderWriterMixin<StreamDecoderLargeChunksWriterHelper>,
       public ::testing::TestWithParam<MakeRecordBatch*> {};
+class TestStreamDecoderScatteredChunks
+    : public ReaderWriterMixin<StreamDecoderScatteredChunksWriterHelper>,
+      public ::testing::TestWithParam<MakeRecordBatch*> {};
 
 TEST_P(TestFileFormat, RoundTrip) {
   TestRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
@@ -1233,6 +1329,16 @@ TEST_P(TestStreamDecoderLargeChunks, RoundTrip) {
   TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
+TEST_P(TestStreamDecoderScatteredChunks, RoundTrip) {
+  TestRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
+  TestZeroLengthRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
+
+  IpcWriteOptions options;
+  options.write_legacy_ipc_format = true;
+  TestRoundTrip(*GetParam(), options);
+  TestZeroLengthRoundTrip(*GetParam(), options);
+}
+
 INSTANTIATE_TEST_SUITE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
 INSTANTIATE_TEST_SUITE_P(FileRoundTripTests, TestFileFormat, BATCH_CASES());
 INSTANTIATE_TEST_SUITE_P(StreamRoundTripTests, TestStreamFormat, BATCH_CASES());
@@ -1244,6 +1350,8 @@ INSTANTIATE_TEST_SUITE_P(StreamDecoderSmallChunksRoundTripTests,
                          TestStreamDecoderSmallChunks, BATCH_CASES());
 INSTANTIATE_TEST_SUITE_P(StreamDecoderLargeChunksRoundTripTests,
                          TestStreamDecoderLargeChunks, BATCH_CASES());
+INSTANTIATE_TEST_SUITE_P(StreamDecoderScatteredChunksRoundTripTests,
+                         TestStreamDecoderScatteredChunks, BATCH_CASES());
 
 TEST(TestIpcFileFormat, FooterMetaData) {
   // ARROW-6837
@@ -1262,6 +1370,161 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+// A RandomAccessFile counting the bytes requested from the underlying file
+class TrackedRandomAccessFile : public io::RandomAccessFile {
+ public:
+  explicit TrackedRandomAccessFile(std::shared_ptr<io::RandomAccessFile> delegate)
+      : delegate_(std::move(delegate)) {}
+
+  Status Close() override { return delegate_->Close(); }
+  bool closed() const override { return delegate_->closed(); }
+  Result<int64_t> Tell() const override { return delegate_->Tell(); }
+  Status Seek(int64_t position) override { return delegate_->Seek(position); }
+  Result<int64_t> GetSize() override { return delegate_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read, delegate_->Read(nbytes, out));
+    bytes_read_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, delegate_->Read(nbytes));
+    bytes_read_ += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read, delegate_->ReadAt(position, nbytes, out));
+    bytes_read_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, delegate_->ReadAt(position, nbytes));
+    bytes_read_ += buffer->size();
+    return buffer;
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes) override {
+    return Future<std::shared_ptr<Buffer>>::MakeFinished(ReadAt(position, nbytes));
+  }
+
+  int64_t bytes_read() const { return bytes_read_; }
+
+ private:
+  std::shared_ptr<io::RandomAccessFile> delegate_;
+  int64_t bytes_read_ = 0;
+};
+
+TEST(TestIpcFileFormat, ReadFieldSubsetReadsOnlyIncludedBuffers) {
+  constexpr int kNumFields = 20;
+  constexpr int64_t kLength = 10000;
+
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (int i = 0; i < kNumFields; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int64()));
+    arrays.push_back(rg.Int64(kLength, 0, 1000, /*null_probability=*/0.1));
+  }
+  auto batch = RecordBatch::Make(schema(fields), kLength, arrays);
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  auto file = std::make_shared<TrackedRandomAccessFile>(
+      std::make_shared<io::BufferReader>(helper.buffer_));
+  auto options = IpcReadOptions::Defaults();
+  options.included_fields = {2, 7};
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file, options));
+  ASSERT_EQ(1, reader->num_record_batches());
+  ASSERT_OK_AND_ASSIGN(auto out_batch, reader->ReadRecordBatch(0));
+
+  auto expected = RecordBatch::Make(schema({fields[2], fields[7]}), kLength,
+                                    {arrays[2], arrays[7]});
+  AssertBatchesEqual(*expected, *out_batch);
+
+  // Only the two selected columns' buffers (plus metadata) should have been read
+  ASSERT_LT(file->bytes_read(), helper.buffer_->size() / 4);
+
+  // Out of bounds fields are still rejected
+  options.included_fields = {2, kNumFields};
+  ASSERT_RAISES(Invalid, RecordBatchFileReader::Open(file, options));
+}
+
+TEST(TestIpcFileFormat, ParallelReadWrite) {
+  constexpr int kNumBatches = 20;
+  constexpr int64_t kLength = 1000;
+
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto batch_schema = schema({field("f0", int64()), field("f1", utf8())});
+  BatchVector batches;
+  for (int i = 0; i < kNumBatches; ++i) {
+    batches.push_back(RecordBatch::Make(
+        batch_schema, kLength,
+        {rg.Int64(kLength, 0, 1000, /*null_probability=*/0.1),
+         rg.String(kLength, 0, 10, /*null_probability=*/0.1)}));
+  }
+
+  // Batches written together come out as if written one by one
+  std::vector<std::shared_ptr<Buffer>> files;
+  for (bool write_batches : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto stream, io::BufferOutputStream::Create(0));
+    ASSERT_OK_AND_ASSIGN(auto writer, NewFileWriter(stream.get(), batch_schema));
+    if (write_batches) {
+      ASSERT_OK(writer->WriteRecordBatches(batches));
+    } else {
+      for (const auto& batch : batches) {
+        ASSERT_OK(writer->WriteRecordBatch(*batch));
+      }
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(auto file, stream->Finish());
+    files.push_back(file);
+  }
+  AssertBufferEqual(*files[0], *files[1]);
+
+  for (bool use_threads : {false, true}) {
+    auto options = IpcReadOptions::Defaults();
+    options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         RecordBatchFileReader::Open(
+                             std::make_shared<io::BufferReader>(files[1]), options));
+    ASSERT_OK_AND_ASSIGN(auto read_batches, reader->ReadRecordBatches());
+    ASSERT_EQ(batches.size(), read_batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_OK(read_batches[i]->ValidateFull());
+      AssertBatchesEqual(*batches[i], *read_batches[i]);
+    }
+
+    // Selected batches in any order
+    ASSERT_OK_AND_ASSIGN(read_batches, reader->ReadRecordBatches({7, 2, 7}));
+    ASSERT_EQ(3, read_batches.size());
+    AssertBatchesEqual(*batches[7], *read_batches[0]);
+    AssertBatchesEqual(*batches[2], *read_batches[1]);
+    AssertBatchesEqual(*batches[7], *read_batches[2]);
+
+    ASSERT_RAISES(IndexError, reader->ReadRecordBatches({0, kNumBatches}));
+  }
+
+  // A field subset
+  auto options = IpcReadOptions::Defaults();
+  options.included_fields = {1};
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       RecordBatchFileReader::Open(
+                           std::make_shared<io::BufferReader>(files[1]), options));
+  ASSERT_OK_AND_ASSIGN(auto read_batches, reader->ReadRecordBatches());
+  ASSERT_EQ(batches.size(), read_batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    auto expected = RecordBatch::Make(schema({batch_schema->field(1)}), kLength,
+                                      {batches[i]->column(1)});
+    AssertBatchesEqual(*expected, *read_batches[i]);
+  }
+}
+
 // This test uses uninitialized memory
 
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
@@ -1853,6 +2116,212 @@ TEST(TestStreamDecoder, NextRequiredSize) {
   ASSERT_EQ(next_required_size - 1, decoder.next_required_size());
 }
 
+TEST(TestStreamDecoder, ScatteredBodyZeroCopy) {
+  // Several small columns, so that some of their buffers lie within a chunk
+  const int64_t length = 100;
+  auto rand = random::RandomArrayGenerator(/*seed=*/0);
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < 8; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int32(), /*nullable=*/false));
+    columns.push_back(rand.Int32(length, 0, 1000, /*null_probability=*/0));
+  }
+  auto batch = RecordBatch::Make(schema(fields), length, columns);
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, NewStreamWriter(sink.get(), batch->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto stream, sink->Finish());
+
+  // Bodies span several chunks
+  const int64_t chunk_size = 1024;
+  auto listener = std::make_shared<CollectListener>();
+  StreamDecoder decoder(listener);
+  std::vector<std::shared_ptr<Buffer>> chunks;
+  for (int64_t offset = 0; offset < stream->size(); offset += chunk_size) {
+    ASSERT_OK_AND_ASSIGN(
+        auto chunk,
+        Buffer::Copy(SliceBuffer(stream, offset, std::min(chunk_size,
+                                                           stream->size() - offset)),
+                     default_cpu_memory_manager()));
+    chunks.push_back(chunk);
+    ASSERT_OK(decoder.Consume(chunk));
+  }
+  ASSERT_GT(chunks.size(), 2);
+
+  auto IsWithinChunk = [&](const Buffer& buffer) {
+    for (const auto& chunk : chunks) {
+      if (buffer.data() >= chunk->data() &&
+          buffer.data() + buffer.size() <= chunk->data() + chunk->size()) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  const auto& batches = listener->record_batches();
+  ASSERT_EQ(2, batches.size());
+  for (const auto& decoded : batches) {
+    ASSERT_OK(decoded->ValidateFull());
+    AssertBatchesEqual(*batch, *decoded);
+    int num_zero_copy = 0;
+    for (const auto& column : decoded->columns()) {
+      const auto& values = *column->data()->buffers[1];
+      ASSERT_TRUE(values.is_cpu());
+      num_zero_copy += IsWithinChunk(values);
+    }
+    ASSERT_GT(num_zero_copy, 0);
+  }
+}
+
+class TestDictionaryDeltas : public ::testing::Test {
+ public:
+  void SetUp() override {
+    schema_ = ::arrow::schema({field("f0", dictionary(int8(), utf8()))});
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::string& dictionary_json,
+                                         const std::string& indices_json) {
+    auto array = DictArrayFromJSON(schema_->field(0)->type(), indices_json,
+                                   dictionary_json);
+    return RecordBatch::Make(schema_, array->length(), {array});
+  }
+
+  BatchVector MakeBatches() {
+    // Extend the dictionary twice, then replace it
+    return {MakeBatch(R"(["a", "b"])", "[0, 1, 1]"),
+            MakeBatch(R"(["a", "b"])", "[1, 0]"),
+            MakeBatch(R"(["a", "b", "c"])", "[2, 0]"),
+            MakeBatch(R"(["a", "b", "c", "d"])", "[3, null]"),
+            MakeBatch(R"(["x", "a"])", "[0, 1]")};
+  }
+
+  void WriteStream(const BatchVector& batches, const IpcWriteOptions& options,
+                   std::shared_ptr<Buffer>* out) {
+    ASSERT_OK_AND_ASSIGN(auto stream, io::BufferOutputStream::Create(0));
+    ASSERT_OK_AND_ASSIGN(auto writer, NewStreamWriter(stream.get(), schema_, options));
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(*out, stream->Finish());
+  }
+
+  // Return whether each dictionary batch in the stream is a delta
+  void ReadDeltaFlags(const std::shared_ptr<Buffer>& stream, std::vector<bool>* out) {
+    io::BufferReader buffer_reader(stream);
+    std::unique_ptr<MessageReader> message_reader = MessageReader::Open(&buffer_reader);
+    out->clear();
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto message, message_reader->ReadNextMessage());
+      if (!message) {
+        break;
+      }
+      if (message->type() == Message::DICTIONARY_BATCH) {
+        const flatbuf::Message* fb_message = nullptr;
+        ASSERT_OK(internal::VerifyMessage(message->metadata()->data(),
+                                          message->metadata()->size(), &fb_message));
+        out->push_back(fb_message->header_as_DictionaryBatch()->isDelta());
+      }
+    }
+  }
+
+  void CheckStreamReader(const std::shared_ptr<Buffer>& stream,
+                         const BatchVector& expected) {
+    io::BufferReader buffer_reader(stream);
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(&buffer_reader));
+    BatchVector batches;
+    ASSERT_OK(reader->ReadAll(&batches));
+    CheckBatches(expected, batches);
+  }
+
+  void CheckStreamDecoder(const std::shared_ptr<Buffer>& stream,
+                          const BatchVector& expected) {
+    auto listener = std::make_shared<CollectListener>();
+    StreamDecoder decoder(listener);
+    ASSERT_OK(decoder.Consume(stream));
+    CheckBatches(expected, listener->record_batches());
+  }
+
+  void CheckBatches(const BatchVector& expected, const BatchVector& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_OK(actual[i]->ValidateFull());
+      AssertBatchesEqual(*expected[i], *actual[i]);
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST_F(TestDictionaryDeltas, StreamDeltas) {
+  auto batches = MakeBatches();
+  auto options = IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  std::shared_ptr<Buffer> stream;
+  WriteStream(batches, options, &stream);
+
+  std::vector<bool> delta_flags;
+  ReadDeltaFlags(stream, &delta_flags);
+  ASSERT_EQ(std::vector<bool>({false, true, true, false}), delta_flags);
+
+  CheckStreamReader(stream, batches);
+  CheckStreamDecoder(stream, batches);
+}
+
+TEST_F(TestDictionaryDeltas, WriteRecordBatches) {
+  // The dictionary batches are interleaved with the record batches written
+  // together as when written one by one
+  auto batches = MakeBatches();
+  auto options = IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  std::shared_ptr<Buffer> stream;
+  WriteStream(batches, options, &stream);
+
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, NewStreamWriter(out.get(), schema_, options));
+  ASSERT_OK(writer->WriteRecordBatches(batches));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto batches_stream, out->Finish());
+  AssertBufferEqual(*stream, *batches_stream);
+}
+
+TEST_F(TestDictionaryDeltas, StreamReplacements) {
+  auto batches = MakeBatches();
+  std::shared_ptr<Buffer> stream;
+  WriteStream(batches, IpcWriteOptions::Defaults(), &stream);
+
+  std::vector<bool> delta_flags;
+  ReadDeltaFlags(stream, &delta_flags);
+  ASSERT_EQ(std::vector<bool>({false, false, false, false}), delta_flags);
+
+  CheckStreamReader(stream, batches);
+  CheckStreamDecoder(stream, batches);
+
+  // Deltas make for a smaller stream
+  auto options = IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  std::shared_ptr<Buffer> delta_stream;
+  WriteStream(batches, options, &delta_stream);
+  ASSERT_LT(delta_stream->size(), stream->size());
+}
+
+TEST_F(TestDictionaryDeltas, FileFormat) {
+  auto options = IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  auto batches = MakeBatches();
+
+  ASSERT_OK_AND_ASSIGN(auto stream, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, NewFileWriter(stream.get(), schema_, options));
+  // Unchanged dictionaries are fine
+  ASSERT_OK(writer->WriteRecordBatch(*batches[0]));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[1]));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batches[2]));
+}
+
 // ----------------------------------------------------------------------
 // DictionaryMemo miscellanea
 
@@ -1891,6 +2360,28 @@ TEST(TestDictionaryMemo, ReusedDictionaries) {
   ASSERT_EQ(0, returned_id);
 }
 
+TEST(TestDictionaryMemo, DeltasAndReplacements) {
+  DictionaryMemo memo;
+  int64_t dictionary_id = 0;
+  std::shared_ptr<Array> dict;
+
+  ASSERT_RAISES(KeyError, memo.AddDictionaryDelta(
+                              dictionary_id, ArrayFromJSON(utf8(), R"(["foo"])"),
+                              default_memory_pool()));
+
+  ASSERT_OK(memo.AddDictionary(dictionary_id, ArrayFromJSON(utf8(), R"(["foo"])")));
+  ASSERT_OK(memo.AddDictionaryDelta(dictionary_id,
+                                    ArrayFromJSON(utf8(), R"(["bar", "baz"])"),
+                                    default_memory_pool()));
+  ASSERT_OK(memo.GetDictionary(dictionary_id, &dict));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])"), *dict);
+
+  memo.AddOrReplaceDictionary(dictionary_id, ArrayFromJSON(utf8(), R"(["quux"])"));
+  ASSERT_OK(memo.GetDictionary(dictionary_id, &dict));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["quux"])"), *dict);
+  ASSERT_EQ(1, memo.num_dictionaries());
+}
+
 }  // namespace test
 }  // namespace ipc
 }  // namespace arrow
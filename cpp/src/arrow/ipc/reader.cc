@@ -30,6 +30,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/message.h"
@@ -47,6 +48,8 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/optional.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/range.h"
+#include "arrow/util/tracing.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
@@ -114,6 +117,28 @@ class ArrayLoader {
         dictionary_memo_(dictionary_memo),
         max_recursion_depth_(options.max_recursion_depth) {}
 
+  /// Read the buffers from a cache of the file containing the body, which
+  /// starts at body_offset
+  explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
+                       const DictionaryMemo* dictionary_memo,
+                       const IpcReadOptions& options, io::internal::ReadRangeCache* cache,
+                       int64_t body_offset)
+      : ArrayLoader(metadata, dictionary_memo, options,
+                    static_cast<io::RandomAccessFile*>(NULLPTR)) {
+    cache_ = cache;
+    body_offset_ = body_offset;
+  }
+
+  /// Don't read the buffers, only append their ranges in the body to read_request
+  explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
+                       const DictionaryMemo* dictionary_memo,
+                       const IpcReadOptions& options,
+                       std::vector<io::ReadRange>* read_request)
+      : ArrayLoader(metadata, dictionary_memo, options,
+                    static_cast<io::RandomAccessFile*>(NULLPTR)) {
+    read_request_ = read_request;
+  }
+
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
     if (skip_io_) {
       return Status::OK();
@@ -123,6 +148,13 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
+    if (read_request_ != NULLPTR) {
+      read_request_->push_back({offset, length});
+      return Status::OK();
+    }
+    if (cache_ != NULLPTR) {
+      return cache_->Read({body_offset_ + offset, length}).Value(out);
+    }
     return file_->ReadAt(offset, length).Value(out);
   }
 
@@ -332,6 +364,9 @@ class ArrayLoader {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  io::internal::ReadRangeCache* cache_ = NULLPTR;
+  int64_t body_offset_ = 0;
+  std::vector<io::ReadRange>* read_request_ = NULLPTR;
   const DictionaryMemo* dictionary_memo_;
   int max_recursion_depth_;
   int buffer_index_ = 0;
@@ -342,59 +377,83 @@ class ArrayLoader {
   ArrayData* out_;
 };
 
+Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>& buf,
+                                                 const IpcReadOptions& options,
+                                                 util::Codec* codec) {
+  if (buf == nullptr || buf->size() == 0) {
+    return buf;
+  }
+  if (buf->size() < 8) {
+    return Status::Invalid(
+        "Likely corrupted message, compressed buffers "
+        "are larger than 8 bytes by construction");
+  }
+  const uint8_t* data = buf->data();
+  int64_t compressed_size = buf->size() - sizeof(int64_t);
+  int64_t uncompressed_size = BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+  if (uncompressed_size == internal::kUncompressedBufferPrefix) {
+    // The buffer was not worth compressing and was written as is
+    return SliceBuffer(buf, sizeof(int64_t), compressed_size);
+  }
+  if (uncompressed_size < 0) {
+    return Status::Invalid("Likely corrupted message, invalid uncompressed length ",
+                           uncompressed_size);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto uncompressed,
+                        AllocateBuffer(uncompressed_size, options.memory_pool));
+
+  int64_t actual_decompressed;
+  ARROW_ASSIGN_OR_RAISE(
+      actual_decompressed,
+      codec->Decompress(compressed_size, data + sizeof(int64_t), uncompressed_size,
+                        uncompressed->mutable_data()));
+  if (actual_decompressed != uncompressed_size) {
+    return Status::Invalid("Failed to fully decompress buffer, expected ",
+                           uncompressed_size, " bytes but decompressed ",
+                           actual_decompressed);
+  }
+  return std::move(uncompressed);
+}
+
+// Gather the buffers of `arr` and of its children, depth-first
+void CollectBuffers(ArrayData* arr, std::vector<std::shared_ptr<Buffer>*>* out) {
+  for (auto& buffer : arr->buffers) {
+    if (buffer != nullptr && buffer->size() > 0) {
+      out->push_back(&buffer);
+    }
+  }
+  for (const auto& child : arr->child_data) {
+    CollectBuffers(child.get(), out);
+  }
+}
+
 Status DecompressBuffers(Compression::type compression, const IpcReadOptions& options,
                          std::vector<std::shared_ptr<ArrayData>>* fields) {
+  // Only the buffers of the loaded fields are decompressed, one task per
+  // buffer so that a few wide or nested fields still parallelize well
+  std::vector<std::shared_ptr<Buffer>*> buffers;
+  for (const auto& field : *fields) {
+    CollectBuffers(field.get(), &buffers);
+  }
+
   std::unique_ptr<util::Codec> codec;
   ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
 
   auto DecompressOne = [&](int i) {
-    ArrayData* arr = (*fields)[i].get();
-    for (size_t i = 0; i < arr->buffers.size(); ++i) {
-      if (arr->buffers[i] == nullptr) {
-        continue;
-      }
-      if (arr->buffers[i]->size() == 0) {
-        continue;
-      }
-      if (arr->buffers[i]->size() < 8) {
-        return Status::Invalid(
-            "Likely corrupted message, compressed buffers "
-            "are larger than 8 bytes by construction");
-      }
-      const uint8_t* data = arr->buffers[i]->data();
-      int64_t compressed_size = arr->buffers[i]->size() - sizeof(int64_t);
-      int64_t uncompressed_size =
-          BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
-
-      ARROW_ASSIGN_OR_RAISE(auto uncompressed,
-                            AllocateBuffer(uncompressed_size, options.memory_pool));
-
-      int64_t actual_decompressed;
-      ARROW_ASSIGN_OR_RAISE(
-          actual_decompressed,
-          codec->Decompress(compressed_size, data + sizeof(int64_t), uncompressed_size,
-                            uncompressed->mutable_data()));
-      if (actual_decompressed != uncompressed_size) {
-        return Status::Invalid("Failed to fully decompress buffer, expected ",
-                               uncompressed_size, " bytes but decompressed ",
-                               actual_decompressed);
-      }
-      arr->buffers[i] = std::move(uncompressed);
-    }
+    ARROW_ASSIGN_OR_RAISE(*buffers[i],
+                          DecompressBuffer(*buffers[i], options, codec.get()));
     return Status::OK();
   };
 
   return ::arrow::internal::OptionalParallelFor(
-      options.use_threads, static_cast<int>(fields->size()), DecompressOne);
+      options.use_threads, static_cast<int>(buffers.size()), DecompressOne);
 }
 
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
-    const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
-    const IpcReadOptions& options, Compression::type compression,
-    io::RandomAccessFile* file) {
-  ArrayLoader loader(metadata, dictionary_memo, options, file);
-
+    const std::vector<bool>& inclusion_mask, const IpcReadOptions& options,
+    Compression::type compression, ArrayLoader* loader) {
   std::vector<std::shared_ptr<ArrayData>> field_data;
   std::vector<std::shared_ptr<Field>> schema_fields;
 
@@ -402,7 +461,7 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     if (inclusion_mask[i]) {
       // Read field
       auto arr = std::make_shared<ArrayData>();
-      RETURN_NOT_OK(loader.Load(schema->field(i).get(), arr.get()));
+      RETURN_NOT_OK(loader->Load(schema->field(i).get(), arr.get()));
       if (metadata->length() != arr->length) {
         return Status::IOError("Array length did not match record batch length");
       }
@@ -411,7 +470,7 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     } else {
       // Skip field. This logic must be executed to advance the state of the
       // loader to the next field
-      RETURN_NOT_OK(loader.SkipField(schema->field(i).get()));
+      RETURN_NOT_OK(loader->SkipField(schema->field(i).get()));
     }
   }
 
@@ -428,12 +487,13 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, Compression::type compression,
     io::RandomAccessFile* file) {
+  ARROW_TRACE_SPAN("ipc::LoadRecordBatch");
+  ArrayLoader loader(metadata, dictionary_memo, options, file);
   if (inclusion_mask.size() > 0) {
-    return LoadRecordBatchSubset(metadata, schema, inclusion_mask, dictionary_memo,
-                                 options, compression, file);
+    return LoadRecordBatchSubset(metadata, schema, inclusion_mask, options, compression,
+                                 &loader);
   }
 
-  ArrayLoader loader(metadata, dictionary_memo, options, file);
   std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
   for (int i = 0; i < schema->num_fields(); ++i) {
     auto arr = std::make_shared<ArrayData>();
@@ -595,7 +655,11 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
   auto dictionary = batch->column(0);
-  return dictionary_memo->AddDictionary(id, dictionary);
+  if (dictionary_batch->isDelta()) {
+    return dictionary_memo->AddDictionaryDelta(id, dictionary, options.memory_pool);
+  }
+  dictionary_memo->AddOrReplaceDictionary(id, dictionary);
+  return Status::OK();
 }
 
 Status ParseDictionary(const Message& message, DictionaryMemo* dictionary_memo,
@@ -607,10 +671,10 @@ Status ParseDictionary(const Message& message, DictionaryMemo* dictionary_memo,
   return ReadDictionary(*message.metadata(), dictionary_memo, options, reader.get());
 }
 
+// Apply a dictionary delta or replacement found after the initial dictionaries
 Status UpdateDictionaries(const Message& message, DictionaryMemo* dictionary_memo,
                           const IpcReadOptions& options) {
-  // TODO(wesm): implement delta dictionaries
-  return Status::NotImplemented("Delta dictionaries not yet implemented");
+  return ParseDictionary(message, dictionary_memo, options);
 }
 
 // ----------------------------------------------------------------------
@@ -634,6 +698,7 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader {
   }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    ARROW_TRACE_SPAN("ipc::ReadNext");
     if (!have_read_initial_dictionaries_) {
       RETURN_NOT_OK(ReadInitialDictionaries());
     }
@@ -645,23 +710,26 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader {
       return Status::OK();
     }
 
-    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
-                          message_reader_->ReadNextMessage());
-    if (message == nullptr) {
-      // End of stream
-      *batch = nullptr;
-      return Status::OK();
+    // Dictionary deltas and replacements precede the record batches using them
+    std::unique_ptr<Message> message;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(message, message_reader_->ReadNextMessage());
+      if (message == nullptr) {
+        // End of stream
+        *batch = nullptr;
+        return Status::OK();
+      }
+      if (message->type() != Message::DICTIONARY_BATCH) {
+        break;
+      }
+      RETURN_NOT_OK(UpdateDictionaries(*message, &dictionary_memo_, options_));
     }
 
-    if (message->type() == Message::DICTIONARY_BATCH) {
-      return UpdateDictionaries(*message, &dictionary_memo_, options_);
-    } else {
-      CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-      return ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
-                                     &dictionary_memo_, options_, reader.get())
-          .Value(batch);
-    }
+    CHECK_HAS_BODY(*message);
+    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    return ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
+                                   &dictionary_memo_, options_, reader.get())
+        .Value(batch);
   }
 
   std::shared_ptr<Schema> schema() const override { return schema_; }
@@ -762,19 +830,39 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) override {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
+    RETURN_NOT_OK(EnsureDictionariesRead());
+    return DoReadRecordBatch(i, options_);
+  }
 
-    if (!read_dictionaries_) {
-      RETURN_NOT_OK(ReadDictionaries());
-      read_dictionaries_ = true;
+  Result<RecordBatchVector> ReadRecordBatches(const std::vector<int>& indices) override {
+    for (int i : indices) {
+      if (i < 0 || i >= num_record_batches()) {
+        return Status::IndexError("Record batch index ", i,
+                                  " out of range for file with ", num_record_batches(),
+                                  " record batches");
+      }
     }
+    // The dictionaries are shared by all batches, so they are read beforehand
+    RETURN_NOT_OK(EnsureDictionariesRead());
+
+    // Each batch is decoded by its own task, without nesting further parallel
+    // tasks such as decompression in it
+    IpcReadOptions batch_options = options_;
+    batch_options.use_threads = false;
+    RecordBatchVector batches(indices.size());
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        options_.use_threads, static_cast<int>(indices.size()), [&](int i) {
+          return DoReadRecordBatch(indices[i], batch_options).Value(&batches[i]);
+        }));
+    return batches;
+  }
+
+  Status WillNeedRecordBatch(int i) override {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
 
-    std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
-
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         options_, reader.get());
+    const FileBlock block = GetRecordBatchBlock(i);
+    return file_->WillNeed({{block.offset, block.metadata_length + block.body_length}});
   }
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
@@ -807,6 +895,33 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   std::shared_ptr<const KeyValueMetadata> metadata() const override { return metadata_; }
 
  private:
+  Status EnsureDictionariesRead() {
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+    return Status::OK();
+  }
+
+  // Read a record batch once the dictionaries are read. Safe to call
+  // concurrently, as it only reads from the file.
+  Result<std::shared_ptr<RecordBatch>> DoReadRecordBatch(int i,
+                                                         const IpcReadOptions& options) {
+    ARROW_TRACE_SPAN_DETAIL("ipc::ReadRecordBatch", "batch " + std::to_string(i));
+
+    if (!field_inclusion_mask_.empty()) {
+      return ReadRecordBatchSubset(GetRecordBatchBlock(i), options);
+    }
+
+    std::unique_ptr<Message> message;
+    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+
+    CHECK_HAS_BODY(*message);
+    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
+                                         options, reader.get());
+  }
+
   FileBlock GetRecordBatchBlock(int i) const {
     return FileBlockFromFlatbuffer(footer_->recordBatches()->Get(i));
   }
@@ -815,12 +930,18 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
-  Status ReadMessageFromBlock(const FileBlock& block, std::unique_ptr<Message>* out) {
+  static Status CheckAligned(const FileBlock& block) {
     if (!BitUtil::IsMultipleOf8(block.offset) ||
         !BitUtil::IsMultipleOf8(block.metadata_length) ||
         !BitUtil::IsMultipleOf8(block.body_length)) {
       return Status::Invalid("Unaligned block in IPC file");
     }
+    return Status::OK();
+  }
+
+  Status ReadMessageFromBlock(const FileBlock& block, std::unique_ptr<Message>* out) {
+    ARROW_TRACE_SPAN("ipc::ReadMessage");
+    RETURN_NOT_OK(CheckAligned(block));
 
     // TODO(wesm): this breaks integration tests, see ARROW-3256
     // DCHECK_EQ((*out)->body_length(), block.body_length);
@@ -828,6 +949,85 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return ReadMessage(block.offset, block.metadata_length, file_).Value(out);
   }
 
+  // Read the Flatbuffer metadata of the message of a block, but not its body
+  Result<std::shared_ptr<Buffer>> ReadMessageMetadata(const FileBlock& block) {
+    ARROW_ASSIGN_OR_RAISE(auto metadata,
+                          file_->ReadAt(block.offset, block.metadata_length));
+    if (metadata->size() < block.metadata_length || metadata->size() < 4) {
+      return Status::Invalid("Expected to read ", block.metadata_length,
+                             " metadata bytes but got ", metadata->size());
+    }
+    // The Flatbuffer size follows a continuation token, except in legacy files
+    int64_t prefix_size = 4;
+    int32_t flatbuffer_size = util::SafeLoadAs<int32_t>(metadata->data());
+    if (flatbuffer_size == internal::kIpcContinuationToken && metadata->size() >= 8) {
+      prefix_size = 8;
+      flatbuffer_size = util::SafeLoadAs<int32_t>(metadata->data() + 4);
+    }
+    if (flatbuffer_size < 0 || prefix_size + flatbuffer_size > metadata->size()) {
+      return Status::Invalid("flatbuffer size ", flatbuffer_size,
+                             " invalid. File offset: ", block.offset,
+                             ", metadata length: ", block.metadata_length);
+    }
+    return SliceBuffer(metadata, prefix_size, flatbuffer_size);
+  }
+
+  // Read a record batch of which only the included fields are loaded.  Only
+  // the byte ranges of their buffers are read, coalesced by a ReadRangeCache,
+  // which saves a lot of IO when few fields of wide batches are included.
+  Result<std::shared_ptr<RecordBatch>> ReadRecordBatchSubset(
+      const FileBlock& block, const IpcReadOptions& options) {
+    RETURN_NOT_OK(CheckAligned(block));
+    ARROW_ASSIGN_OR_RAISE(auto metadata, ReadMessageMetadata(block));
+    const flatbuf::Message* message = nullptr;
+    RETURN_NOT_OK(internal::VerifyMessage(metadata->data(), metadata->size(), &message));
+    auto batch = message->header_as_RecordBatch();
+    if (batch == nullptr) {
+      return Status::IOError(
+          "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+    }
+    Compression::type compression;
+    RETURN_NOT_OK(GetCompression(message, &compression));
+
+    std::vector<io::ReadRange> ranges;
+    ArrayLoader request_loader(batch, &dictionary_memo_, options, &ranges);
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const Field* field = schema_->field(i).get();
+      if (field_inclusion_mask_[i]) {
+        ArrayData dummy;
+        RETURN_NOT_OK(request_loader.Load(field, &dummy));
+      } else {
+        RETURN_NOT_OK(request_loader.SkipField(field));
+      }
+    }
+
+    const int64_t body_offset = block.offset + block.metadata_length;
+    for (auto& range : ranges) {
+      if (range.offset + range.length > block.body_length) {
+        return Status::IOError("Buffer of ", range.length, " bytes at offset ",
+                               range.offset, " exceeds message body of ",
+                               block.body_length, " bytes");
+      }
+      range.offset += body_offset;
+    }
+    // The cache needs shared ownership of the file, which it reads in the background
+    auto file = owned_file_ != NULLPTR
+                    ? owned_file_
+                    : std::shared_ptr<io::RandomAccessFile>(file_,
+                                                            [](io::RandomAccessFile*) {});
+    io::internal::ReadRangeCache cache(std::move(file));
+    RETURN_NOT_OK(cache.Cache(std::move(ranges)));
+
+    ArrayLoader loader(batch, &dictionary_memo_, options, &cache, body_offset);
+    auto maybe_batch = LoadRecordBatchSubset(batch, schema_, field_inclusion_mask_,
+                                             options, compression, &loader);
+    if (!maybe_batch.ok()) {
+      // Don't leave reads of the file running in the background
+      ARROW_UNUSED(cache.Wait());
+    }
+    return maybe_batch;
+  }
+
   Status ReadDictionaries() {
     // Read all the dictionaries
     for (int i = 0; i < num_dictionaries(); ++i) {
@@ -941,6 +1141,10 @@ Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
   return result;
 }
 
+Result<RecordBatchVector> RecordBatchFileReader::ReadRecordBatches() {
+  return ReadRecordBatches(::arrow::internal::Iota(num_record_batches()));
+}
+
 Status Listener::OnEOS() { return Status::OK(); }
 
 Status Listener::OnSchemaDecoded(std::shared_ptr<Schema> schema) { return Status::OK(); }
@@ -970,7 +1174,11 @@ class StreamDecoder::StreamDecoderImpl : public MessageDecoderListener {
         field_inclusion_mask_(),
         n_required_dictionaries_(0),
         dictionary_memo_(),
-        schema_() {}
+        schema_() {
+    // Record batches and dictionaries are loaded through Buffer::GetReader(),
+    // so a body received in several chunks needn't be concatenated.
+    message_decoder_.set_allow_scattered_body(true);
+  }
 
   Status OnMessageDecoded(std::unique_ptr<Message> message) override {
     switch (state_) {
@@ -194,6 +194,27 @@ class ARROW_EXPORT RecordBatchFileReader {
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
     return ReadRecordBatch(i).Value(batch);
   }
+
+  /// \brief Read the record batches of the given indices, in that order.
+  /// Unlike with ReadRecordBatch, the batches are decoded concurrently on the
+  /// CPU thread pool if IpcReadOptions::use_threads is true.
+  ///
+  /// \param[in] indices the indices of the record batches to return
+  /// \return the read batches
+  virtual Result<RecordBatchVector> ReadRecordBatches(
+      const std::vector<int>& indices) = 0;
+
+  /// \brief Read all record batches of the file, concurrently if
+  /// IpcReadOptions::use_threads is true
+  ///
+  /// \return the read batches, in file order
+  Result<RecordBatchVector> ReadRecordBatches();
+
+  /// \brief Inform the file that a particular record batch will be read soon,
+  /// see io::RandomAccessFile::WillNeed
+  ///
+  /// \param[in] i the index of the record batch
+  virtual Status WillNeedRecordBatch(int i) = 0;
 };
 
 /// \class Listener
@@ -314,6 +335,11 @@ class ARROW_EXPORT StreamDecoder {
   /// Buffer, the decoder calls listener->RecordBatchReceived() with a
   /// decoded record batch multiple times.
   ///
+  /// The Buffer isn't copied, even if a message spans several Consume()
+  /// calls: record batch buffers lying within one consumed Buffer are
+  /// zero-copy slices of it. Only the ones straddling consumed Buffers
+  /// are copied.
+  ///
   /// \param[in] buffer a Buffer to be processed.
   /// \return Status
   Status Consume(std::shared_ptr<Buffer> buffer);
@@ -353,9 +379,10 @@ class ARROW_EXPORT StreamDecoder {
   /// ~~~
   ///
   /// Users can use this method to avoid creating small chunks. Record
-  /// batch data must be contiguous data. If users pass small chunks
-  /// to the decoder, the decoder needs concatenate small chunks
-  /// internally. It causes performance overhead.
+  /// batch data needn't be contiguous, but each record batch buffer
+  /// straddling chunks is copied by the decoder. If users pass small
+  /// chunks to the decoder, most buffers straddle chunks. It causes
+  /// performance overhead.
   ///
   /// Here is an example usage to reduce small chunks:
   ///
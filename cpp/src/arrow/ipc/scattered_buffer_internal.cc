@@ -0,0 +1,284 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/scattered_buffer_internal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "arrow/device.h"
+#include "arrow/io/concurrency.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace ipc {
+namespace internal {
+
+namespace {
+
+const char kScatteredDeviceTypeName[] = "arrow::ipc::ScatteredDevice";
+
+// The segments of a ScatteredBuffer are CPU memory, but the buffer as a whole
+// is not contiguous, so it lives on a device of its own whose buffers can only
+// be read through a RandomAccessFile, or copied to the CPU.
+class ScatteredDevice : public Device {
+ public:
+  const char* type_name() const override { return kScatteredDeviceTypeName; }
+
+  std::string ToString() const override { return "ScatteredDevice()"; }
+
+  bool Equals(const Device& other) const override {
+    return other.type_name() == kScatteredDeviceTypeName;
+  }
+
+  std::shared_ptr<MemoryManager> default_memory_manager() override;
+
+  static std::shared_ptr<Device> Instance() {
+    static auto instance = std::shared_ptr<Device>(new ScatteredDevice());
+    return instance;
+  }
+};
+
+class ScatteredBufferReader
+    : public io::internal::RandomAccessFileConcurrencyWrapper<ScatteredBufferReader> {
+ public:
+  explicit ScatteredBufferReader(std::shared_ptr<ScatteredBuffer> buffer)
+      : buffer_(std::move(buffer)), size_(buffer_->size()) {}
+
+  bool closed() const override { return !is_open_; }
+
+  bool supports_zero_copy() const override { return true; }
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<ScatteredBufferReader>;
+
+  Status DoClose() {
+    is_open_ = false;
+    return Status::OK();
+  }
+
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out) {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, size_));
+    buffer_->CopyTo(position, nbytes, reinterpret_cast<uint8_t*>(out));
+    return nbytes;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, size_));
+    return buffer_->ReadAt(position, nbytes);
+  }
+
+  Result<int64_t> DoRead(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+    position_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+    position_ += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> DoTell() const {
+    RETURN_NOT_OK(CheckClosed());
+    return position_;
+  }
+
+  Status DoSeek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || position > size_) {
+      return Status::IOError("Seek out of bounds");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> DoGetSize() {
+    RETURN_NOT_OK(CheckClosed());
+    return size_;
+  }
+
+  Status CheckClosed() const {
+    if (!is_open_) {
+      return Status::Invalid("Operation forbidden on closed ScatteredBufferReader");
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<ScatteredBuffer> buffer_;
+  int64_t size_;
+  int64_t position_ = 0;
+  bool is_open_ = true;
+};
+
+class ScatteredMemoryManager : public MemoryManager {
+ public:
+  explicit ScatteredMemoryManager(MemoryPool* pool)
+      : MemoryManager(ScatteredDevice::Instance()), pool_(pool) {}
+
+  static std::shared_ptr<MemoryManager> Make(MemoryPool* pool) {
+    if (pool == default_memory_pool()) {
+      static auto instance = std::make_shared<ScatteredMemoryManager>(pool);
+      return instance;
+    }
+    return std::make_shared<ScatteredMemoryManager>(pool);
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBufferReader(
+      std::shared_ptr<Buffer> buf) override {
+    auto scattered = std::dynamic_pointer_cast<ScatteredBuffer>(buf);
+    if (scattered == nullptr) {
+      return Status::NotImplemented("Reading a slice of a ScatteredBuffer");
+    }
+    return std::make_shared<ScatteredBufferReader>(std::move(scattered));
+  }
+
+  Result<std::shared_ptr<io::OutputStream>> GetBufferWriter(
+      std::shared_ptr<Buffer> buf) override {
+    return Status::NotImplemented("ScatteredBuffer is not writable");
+  }
+
+  Result<std::shared_ptr<Buffer>> AllocateBuffer(int64_t size) override {
+    return Status::NotImplemented("Allocating a ScatteredBuffer");
+  }
+
+ protected:
+  Result<std::shared_ptr<Buffer>> CopyBufferTo(
+      const std::shared_ptr<Buffer>& buf,
+      const std::shared_ptr<MemoryManager>& to) override {
+    auto scattered = std::dynamic_pointer_cast<ScatteredBuffer>(buf);
+    if (!to->is_cpu() || scattered == nullptr) {
+      return nullptr;
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> dest, to->AllocateBuffer(buf->size()));
+    scattered->CopyTo(0, buf->size(), dest->mutable_data());
+    return dest;
+  }
+
+  Result<std::shared_ptr<Buffer>> ViewBufferTo(
+      const std::shared_ptr<Buffer>& buf,
+      const std::shared_ptr<MemoryManager>& to) override {
+    auto scattered = std::dynamic_pointer_cast<ScatteredBuffer>(buf);
+    if (!to->is_cpu() || scattered == nullptr || scattered->segments().size() != 1) {
+      return nullptr;
+    }
+    return scattered->segments()[0];
+  }
+
+  MemoryPool* pool_;
+};
+
+std::shared_ptr<MemoryManager> ScatteredDevice::default_memory_manager() {
+  return ScatteredMemoryManager::Make(default_memory_pool());
+}
+
+int64_t TotalSize(const std::vector<std::shared_ptr<Buffer>>& segments) {
+  int64_t size = 0;
+  for (const auto& segment : segments) {
+    size += segment->size();
+  }
+  return size;
+}
+
+}  // namespace
+
+ScatteredBuffer::ScatteredBuffer(std::vector<std::shared_ptr<Buffer>> segments,
+                                 MemoryPool* pool)
+    : Buffer(nullptr, TotalSize(segments), ScatteredMemoryManager::Make(pool)),
+      pool_(pool) {
+  segments_.reserve(segments.size());
+  offsets_.reserve(segments.size() + 1);
+  int64_t offset = 0;
+  for (auto& segment : segments) {
+    if (segment->size() > 0) {
+      offsets_.push_back(offset);
+      offset += segment->size();
+      segments_.push_back(std::move(segment));
+    }
+  }
+  offsets_.push_back(offset);
+}
+
+size_t ScatteredBuffer::FindSegment(int64_t position) const {
+  DCHECK(position >= 0 && position < size_);
+  auto it = std::upper_bound(offsets_.begin(), offsets_.end() - 1, position);
+  return static_cast<size_t>(it - offsets_.begin()) - 1;
+}
+
+Result<std::shared_ptr<Buffer>> ScatteredBuffer::ReadAt(int64_t position,
+                                                        int64_t nbytes) const {
+  if (nbytes == 0) {
+    return std::make_shared<Buffer>(nullptr, 0);
+  }
+  const size_t i = FindSegment(position);
+  const int64_t offset = position - offsets_[i];
+  if (offset + nbytes <= segments_[i]->size()) {
+    return SliceBuffer(segments_[i], offset, nbytes);
+  }
+  // The range straddles segments, only this part is copied
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out, AllocateBuffer(nbytes, pool_));
+  CopyTo(position, nbytes, out->mutable_data());
+  return out;
+}
+
+void ScatteredBuffer::CopyTo(int64_t position, int64_t nbytes, uint8_t* out) const {
+  if (nbytes == 0) {
+    return;
+  }
+  size_t i = FindSegment(position);
+  int64_t offset = position - offsets_[i];
+  while (nbytes > 0) {
+    const int64_t chunk = std::min(nbytes, segments_[i]->size() - offset);
+    std::memcpy(out, segments_[i]->data() + offset, static_cast<size_t>(chunk));
+    out += chunk;
+    nbytes -= chunk;
+    offset = 0;
+    ++i;
+  }
+}
+
+std::shared_ptr<Buffer> ScatteredBuffer::View(int64_t position, int64_t nbytes) const {
+  if (nbytes == 0) {
+    return std::make_shared<Buffer>(nullptr, 0);
+  }
+  size_t i = FindSegment(position);
+  int64_t offset = position - offsets_[i];
+  if (offset + nbytes <= segments_[i]->size()) {
+    return SliceBuffer(segments_[i], offset, nbytes);
+  }
+  std::vector<std::shared_ptr<Buffer>> views;
+  while (nbytes > 0) {
+    const int64_t chunk = std::min(nbytes, segments_[i]->size() - offset);
+    views.push_back(SliceBuffer(segments_[i], offset, chunk));
+    nbytes -= chunk;
+    offset = 0;
+    ++i;
+  }
+  return std::make_shared<ScatteredBuffer>(std::move(views), pool_);
+}
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
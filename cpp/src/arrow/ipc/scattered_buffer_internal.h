@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ipc {
+namespace internal {
+
+/// \brief A buffer made of several non-contiguous segments
+///
+/// A message received over the network may arrive as several pieces (gRPC
+/// slices, socket reads...). Rather than coalescing them, the message body can
+/// be kept as a ScatteredBuffer over the pieces. It is tied to a non-CPU memory
+/// manager, so it has no data pointer: its contents are read through
+/// Buffer::GetReader(), which is what the IPC reader uses to load record batch
+/// buffers. A read that falls within one segment returns a zero-copy slice of
+/// it; only reads straddling segments are copied, into a buffer allocated from
+/// the given pool (and hence 64-byte aligned).
+class ARROW_EXPORT ScatteredBuffer : public Buffer {
+ public:
+  explicit ScatteredBuffer(std::vector<std::shared_ptr<Buffer>> segments,
+                           MemoryPool* pool = default_memory_pool());
+
+  const std::vector<std::shared_ptr<Buffer>>& segments() const { return segments_; }
+
+  MemoryPool* pool() const { return pool_; }
+
+  /// \brief Return bytes [position, position + nbytes) as a single buffer
+  ///
+  /// The range must be within bounds.
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) const;
+
+  /// \brief Copy bytes [position, position + nbytes) into 'out'
+  ///
+  /// The range must be within bounds.
+  void CopyTo(int64_t position, int64_t nbytes, uint8_t* out) const;
+
+  /// \brief Return a zero-copy view of bytes [position, position + nbytes)
+  ///
+  /// The view is a slice of a segment if the range lies within one, and a
+  /// ScatteredBuffer over slices of the segments it spans otherwise. The range
+  /// must be within bounds.
+  std::shared_ptr<Buffer> View(int64_t position, int64_t nbytes) const;
+
+ private:
+  // Index of the segment containing the given position
+  size_t FindSegment(int64_t position) const;
+
+  std::vector<std::shared_ptr<Buffer>> segments_;
+  // Starting position of each segment, followed by the total size
+  std::vector<int64_t> offsets_;
+  MemoryPool* pool_;
+};
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
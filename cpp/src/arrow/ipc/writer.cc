@@ -51,6 +51,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -167,14 +168,24 @@ class RecordBatchSerializer {
   Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
                         std::shared_ptr<Buffer>* out) {
     // Convert buffer to uncompressed-length-prefixed compressed buffer
-    int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
+    int64_t maximum_length =
+        std::max(codec->MaxCompressedLen(buffer.size(), buffer.data()), buffer.size());
     ARROW_ASSIGN_OR_RAISE(auto result, AllocateBuffer(maximum_length + sizeof(int64_t)));
+    uint8_t* body = result->mutable_data() + sizeof(int64_t);
 
     int64_t actual_length;
-    ARROW_ASSIGN_OR_RAISE(actual_length,
-                          codec->Compress(buffer.size(), buffer.data(), maximum_length,
-                                          result->mutable_data() + sizeof(int64_t)));
-    *reinterpret_cast<int64_t*>(result->mutable_data()) = buffer.size();
+    ARROW_ASSIGN_OR_RAISE(actual_length, codec->Compress(buffer.size(), buffer.data(),
+                                                         maximum_length, body));
+    int64_t prefix = buffer.size();
+    if (actual_length >= buffer.size()) {
+      // Compression doesn't pay off, store the buffer as is. A length prefix
+      // of -1 tells the reader not to decompress it
+      std::memcpy(body, buffer.data(), static_cast<size_t>(buffer.size()));
+      actual_length = buffer.size();
+      prefix = internal::kUncompressedBufferPrefix;
+    }
+    prefix = BitUtil::ToLittleEndian(prefix);
+    std::memcpy(result->mutable_data(), &prefix, sizeof(int64_t));
     *out = SliceBuffer(std::move(result), /*offset=*/0, actual_length + sizeof(int64_t));
     return Status::OK();
   }
@@ -184,7 +195,6 @@ class RecordBatchSerializer {
 
     RETURN_NOT_OK(internal::CheckCompressionSupported(options_.compression));
 
-    // TODO check allowed values for compression?
     AppendCustomMetadata("ARROW:experimental_compression",
                          util::Codec::GetCodecAsString(options_.compression));
 
@@ -522,13 +532,14 @@ class RecordBatchSerializer {
 
 class DictionarySerializer : public RecordBatchSerializer {
  public:
-  DictionarySerializer(int64_t dictionary_id, int64_t buffer_start_offset,
+  DictionarySerializer(int64_t dictionary_id, bool is_delta, int64_t buffer_start_offset,
                        const IpcWriteOptions& options, IpcPayload* out)
       : RecordBatchSerializer(buffer_start_offset, options, out),
-        dictionary_id_(dictionary_id) {}
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
                                   custom_metadata_, field_nodes_, buffer_meta_,
                                   &out_->metadata);
   }
@@ -542,6 +553,7 @@ class DictionarySerializer : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options,
@@ -588,9 +600,15 @@ Status GetSchemaPayload(const Schema& schema, const IpcWriteOptions& options,
 
 Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
                             const IpcWriteOptions& options, IpcPayload* out) {
+  return GetDictionaryPayload(id, /*is_delta=*/false, dictionary, options, out);
+}
+
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcWriteOptions& options, IpcPayload* out) {
   out->type = Message::DICTIONARY_BATCH;
   // Frame of reference is 0, see ARROW-384
-  DictionarySerializer assembler(id, /*buffer_start_offset=*/0, options, out);
+  DictionarySerializer assembler(id, is_delta, /*buffer_start_offset=*/0, options, out);
   return assembler.Assemble(dictionary);
 }
 
@@ -892,6 +910,13 @@ Status GetTensorSize(const Tensor& tensor, int64_t* size) {
 
 RecordBatchWriter::~RecordBatchWriter() {}
 
+Status RecordBatchWriter::WriteRecordBatches(const RecordBatchVector& batches) {
+  for (const auto& batch : batches) {
+    RETURN_NOT_OK(WriteRecordBatch(*batch));
+  }
+  return Status::OK();
+}
+
 Status RecordBatchWriter::WriteTable(const Table& table, int64_t max_chunksize) {
   TableBatchReader reader(table);
 
@@ -899,16 +924,10 @@ Status RecordBatchWriter::WriteTable(const Table& table, int64_t max_chunksize)
     reader.set_chunksize(max_chunksize);
   }
 
-  std::shared_ptr<RecordBatch> batch;
-  while (true) {
-    RETURN_NOT_OK(reader.ReadNext(&batch));
-    if (batch == nullptr) {
-      break;
-    }
-    RETURN_NOT_OK(WriteRecordBatch(*batch));
-  }
-
-  return Status::OK();
+  // The batches are slices of the table, so collecting them is cheap
+  RecordBatchVector batches;
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+  return WriteRecordBatches(batches);
 }
 
 Status RecordBatchWriter::WriteTable(const Table& table) { return WriteTable(table, -1); }
@@ -927,11 +946,12 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   /// A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const Schema& schema, const IpcWriteOptions& options,
-                  DictionaryMemo* out_memo = nullptr)
+                  bool is_file_format = false, DictionaryMemo* out_memo = nullptr)
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
         dictionary_memo_(out_memo),
-        options_(options) {
+        options_(options),
+        is_file_format_(is_file_format) {
     if (out_memo == nullptr) {
       dictionary_memo_ = &internal_dict_memo_;
     }
@@ -940,31 +960,54 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
-                  DictionaryMemo* out_memo = nullptr)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options, out_memo) {
+                  bool is_file_format = false, DictionaryMemo* out_memo = nullptr)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format,
+                        out_memo) {
     shared_schema_ = schema;
   }
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
-    if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
-      return Status::Invalid("Tried to write record batch with different schema");
-    }
-
+    RETURN_NOT_OK(CheckSchema(batch));
     RETURN_NOT_OK(CheckStarted());
-
-    if (!wrote_dictionaries_) {
-      RETURN_NOT_OK(WriteDictionaries(batch));
-      wrote_dictionaries_ = true;
-    }
-
-    // TODO: Check for delta dictionaries. Can we scan for deltas while computing
-    // the RecordBatch payload to save time?
+    RETURN_NOT_OK(WriteDictionariesOf(batch));
 
     IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, &payload));
     return payload_writer_->WritePayload(payload);
   }
 
+  Status WriteRecordBatches(const RecordBatchVector& batches) override {
+    if (!options_.use_threads || batches.size() <= 1) {
+      return RecordBatchWriter::WriteRecordBatches(batches);
+    }
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(CheckSchema(*batch));
+    }
+    RETURN_NOT_OK(CheckStarted());
+
+    // The payloads of a window of batches are assembled concurrently, each by
+    // a single task, then written in order after the dictionaries of their
+    // batch.  The window bounds the memory held by payloads not written yet.
+    IpcWriteOptions batch_options = options_;
+    batch_options.use_threads = false;
+    const size_t window_size = static_cast<size_t>(
+        std::max(1, ::arrow::internal::GetCpuThreadPool()->GetCapacity()));
+    for (size_t start = 0; start < batches.size(); start += window_size) {
+      const size_t num_payloads = std::min(window_size, batches.size() - start);
+      std::vector<IpcPayload> payloads(num_payloads);
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          static_cast<int>(num_payloads), [&](int i) {
+            return GetRecordBatchPayload(*batches[start + i], batch_options,
+                                         &payloads[i]);
+          }));
+      for (size_t i = 0; i < num_payloads; ++i) {
+        RETURN_NOT_OK(WriteDictionariesOf(*batches[start + i]));
+        RETURN_NOT_OK(payload_writer_->WritePayload(payloads[i]));
+      }
+    }
+    return Status::OK();
+  }
+
   Status Close() override {
     RETURN_NOT_OK(CheckStarted());
     return payload_writer_->Close();
@@ -987,28 +1030,95 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  Status CheckSchema(const RecordBatch& batch) const {
+    if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
+      return Status::Invalid("Tried to write record batch with different schema");
+    }
+    return Status::OK();
+  }
+
+  // Write the dictionaries of a batch that weren't written yet
+  Status WriteDictionariesOf(const RecordBatch& batch) {
+    if (!wrote_dictionaries_) {
+      RETURN_NOT_OK(WriteDictionaries(batch));
+      wrote_dictionaries_ = true;
+      return Status::OK();
+    }
+    return WriteDictionaryUpdates(batch);
+  }
+
   Status WriteDictionaries(const RecordBatch& batch) {
-    RETURN_NOT_OK(CollectDictionaries(batch, dictionary_memo_));
+    DictionaryVector dictionaries;
+    RETURN_NOT_OK(CollectDictionaries(batch, dictionary_memo_, &dictionaries));
 
-    for (auto& pair : dictionary_memo_->id_to_dictionary()) {
-      internal::IpcPayload payload;
+    for (const auto& pair : dictionaries) {
       int64_t dictionary_id = pair.first;
       const auto& dictionary = pair.second;
+      RETURN_NOT_OK(dictionary_memo_->AddDictionary(dictionary_id, dictionary));
+      dictionary_ids_.push_back(dictionary_id);
 
+      internal::IpcPayload payload;
       RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, dictionary, options_, &payload));
       RETURN_NOT_OK(payload_writer_->WritePayload(payload));
     }
     return Status::OK();
   }
 
+  // Write the dictionaries of a subsequent batch that differ from the last ones
+  // written, as deltas if they only append values
+  Status WriteDictionaryUpdates(const RecordBatch& batch) {
+    if (dictionary_ids_.empty()) {
+      return Status::OK();
+    }
+    // The batch has the same schema, so its dictionaries are found in the
+    // same order as in the first batch
+    DictionaryMemo batch_memo;
+    DictionaryVector dictionaries;
+    RETURN_NOT_OK(CollectDictionaries(batch, &batch_memo, &dictionaries));
+    DCHECK_EQ(dictionaries.size(), dictionary_ids_.size());
+
+    for (size_t i = 0; i < dictionaries.size(); ++i) {
+      const int64_t dictionary_id = dictionary_ids_[i];
+      const auto& dictionary = dictionaries[i].second;
+      std::shared_ptr<Array> last_dictionary;
+      RETURN_NOT_OK(dictionary_memo_->GetDictionary(dictionary_id, &last_dictionary));
+
+      if (dictionary->data() == last_dictionary->data() ||
+          dictionary->Equals(*last_dictionary)) {
+        continue;
+      }
+      const int64_t last_length = last_dictionary->length();
+      const bool is_delta =
+          options_.emit_dictionary_deltas && dictionary->length() > last_length &&
+          dictionary->RangeEquals(0, last_length, 0, *last_dictionary);
+      if (is_file_format_) {
+        return Status::Invalid(
+            "Dictionary ", is_delta ? "delta" : "replacement",
+            " detected when writing IPC file format. Arrow IPC files only support "
+            "a single dictionary for a given field across all batches.");
+      }
+
+      internal::IpcPayload payload;
+      RETURN_NOT_OK(GetDictionaryPayload(
+          dictionary_id, is_delta, is_delta ? dictionary->Slice(last_length) : dictionary,
+          options_, &payload));
+      RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      dictionary_memo_->AddOrReplaceDictionary(dictionary_id, dictionary);
+    }
+    return Status::OK();
+  }
+
   std::unique_ptr<IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
   DictionaryMemo* dictionary_memo_;
   DictionaryMemo internal_dict_memo_;
+  // Dictionary ids in the order dictionaries are found in a batch
+  std::vector<int64_t> dictionary_ids_;
   bool started_ = false;
   bool wrote_dictionaries_ = false;
   IpcWriteOptions options_;
+  bool is_file_format_;
 };
 
 class StreamBookKeeper {
@@ -1178,7 +1288,7 @@ Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
                                                                   metadata, sink),
-      schema, options);
+      schema, options, /*is_file_format=*/true);
 }
 
 namespace internal {
@@ -1241,7 +1351,7 @@ Result<std::shared_ptr<Buffer>> SerializeSchema(const Schema& schema,
   auto options = IpcWriteOptions::Defaults();
   internal::IpcFormatWriter writer(
       ::arrow::internal::make_unique<internal::PayloadStreamWriter>(stream.get()), schema,
-      options, dictionary_memo);
+      options, /*is_file_format=*/false, dictionary_memo);
   // Write schema and populate fields (but not dictionaries) in dictionary_memo
   RETURN_NOT_OK(writer.Start());
   return stream->Finish();
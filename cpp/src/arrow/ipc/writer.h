@@ -63,7 +63,19 @@ class ARROW_EXPORT RecordBatchWriter {
   /// \return Status
   virtual Status WriteRecordBatch(const RecordBatch& batch) = 0;
 
-  /// \brief Write possibly-chunked table by creating sequence of record batches
+  /// \brief Write record batches to the stream, in order
+  ///
+  /// IPC writers assemble the messages of several batches concurrently on the
+  /// CPU thread pool if IpcWriteOptions::use_threads is true, while still
+  /// writing them one after another.  By default, the batches are written
+  /// with WriteRecordBatch.
+  ///
+  /// \param[in] batches the record batches to write to the stream
+  /// \return Status
+  virtual Status WriteRecordBatches(const RecordBatchVector& batches);
+
+  /// \brief Write possibly-chunked table by creating sequence of record batches,
+  /// written with WriteRecordBatches
   /// \param[in] table table to write
   /// \return Status
   Status WriteTable(const Table& table);
@@ -314,6 +326,19 @@ ARROW_EXPORT
 Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
                             const IpcWriteOptions& options, IpcPayload* payload);
 
+/// \brief Compute IpcPayload for a dictionary, or a dictionary delta
+/// \param[in] id the dictionary id
+/// \param[in] is_delta whether the values are to be appended to the
+///   previous dictionary with the same id, rather than replace it
+/// \param[in] dictionary the dictionary values
+/// \param[in] options options for serialization
+/// \param[out] payload the output IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcWriteOptions& options, IpcPayload* payload);
+
 /// \brief Compute IpcPayload for the given record batch
 /// \param[in] batch the RecordBatch that is being serialized
 /// \param[in] options options for serialization
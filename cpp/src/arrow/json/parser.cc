@@ -37,6 +37,7 @@
 #include "arrow/util/make_unique.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/trie.h"
+#include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -324,16 +325,19 @@ class RawArrayBuilder<Kind::kObject> {
   Status AppendNull(int64_t count) { return null_bitmap_builder_.Append(count, false); }
 
   std::string FieldName(int i) const {
-    for (const auto& name_index : name_to_index_) {
-      if (name_index.second == i) {
-        return name_index.first;
-      }
-    }
-    return "";
+    return i >= 0 && i < num_fields() ? field_names_[i] : "";
   }
 
-  int GetFieldIndex(const std::string& name) const {
-    auto it = name_to_index_.find(name);
+  /// \brief Look up a field by name, or return -1 if there is none
+  ///
+  /// `hint` is checked first, which avoids hashing the name when the keys
+  /// of successive objects appear in the same order (the common case for
+  /// line-delimited JSON).
+  int GetFieldIndex(string_view name, int hint) const {
+    if (hint >= 0 && hint < num_fields() && string_view(field_names_[hint]) == name) {
+      return hint;
+    }
+    auto it = name_to_index_.find(name.to_string());
     if (it == name_to_index_.end()) {
       return -1;
     }
@@ -343,6 +347,7 @@ class RawArrayBuilder<Kind::kObject> {
   int AddField(std::string name, BuilderPtr builder) {
     auto index = num_fields();
     field_builders_.push_back(builder);
+    field_names_.push_back(name);
     name_to_index_.emplace(std::move(name), index);
     return index;
   }
@@ -360,18 +365,13 @@ class RawArrayBuilder<Kind::kObject> {
     std::shared_ptr<Buffer> null_bitmap;
     RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
 
-    std::vector<string_view> field_names(num_fields());
-    for (const auto& name_index : name_to_index_) {
-      field_names[name_index.second] = name_index.first;
-    }
-
     std::vector<std::shared_ptr<Field>> fields(num_fields());
     std::vector<std::shared_ptr<ArrayData>> child_data(num_fields());
     for (int i = 0; i < num_fields(); ++i) {
       std::shared_ptr<Array> field_values;
       RETURN_NOT_OK(finish_child(field_builders_[i], &field_values));
       child_data[i] = field_values->data();
-      fields[i] = field(field_names[i].to_string(), field_values->type(),
+      fields[i] = field(field_names_[i], field_values->type(),
                         field_builders_[i].nullable, Kind::Tag(field_builders_[i].kind));
     }
 
@@ -384,6 +384,7 @@ class RawArrayBuilder<Kind::kObject> {
 
  private:
   std::vector<BuilderPtr> field_builders_;
+  std::vector<std::string> field_names_;
   std::unordered_map<std::string, int> name_to_index_;
   TypedBufferBuilder<bool> null_bitmap_builder_;
 };
@@ -702,6 +703,11 @@ class HandlerBase : public BlockParser,
 
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
+    // Validating the whole block up front is much faster than letting
+    // rapidjson validate each string (kParseValidateEncodingFlag)
+    if (ARROW_PREDICT_FALSE(!util::ValidateUTF8(json->data(), json->size()))) {
+      return ParseError("invalid UTF8 data");
+    }
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
@@ -744,7 +750,8 @@ class HandlerBase : public BlockParser,
   /// there is no field with that name
   bool SetFieldBuilder(string_view key, bool* duplicate_keys) {
     auto parent = Cast<Kind::kObject>(builder_stack_.back());
-    field_index_ = parent->GetFieldIndex(std::string(key));
+    // field_index_ still refers to the previous key of this object (or is -1)
+    field_index_ = parent->GetFieldIndex(key, field_index_ + 1);
     if (ARROW_PREDICT_FALSE(field_index_ == -1)) {
       return false;
     }
@@ -1071,6 +1078,7 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
                          std::unique_ptr<BlockParser>* out) {
   DCHECK(options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType ||
          options.explicit_schema != nullptr);
+  util::InitializeUTF8();
 
   switch (options.unexpected_field_behavior) {
     case UnexpectedFieldBehavior::Ignore: {
@@ -199,6 +199,14 @@ TEST(BlockParserWithSchema, FailOnIncompleteJson) {
   ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":0, \"b\"", &parsed));
 }
 
+TEST(BlockParser, FailOnInvalidUTF8) {
+  auto options = ParseOptions::Defaults();
+  std::shared_ptr<Array> parsed;
+  ASSERT_OK(ParseFromString(options, "{\"a\":\"\xe5\xbf\x8d\"}", &parsed));
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":\"\xe5\xbf\"}", &parsed));
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"\xff\":0}", &parsed));
+}
+
 TEST(BlockParser, Basics) {
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
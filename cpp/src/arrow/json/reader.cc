@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -165,6 +167,197 @@ class TableReaderImpl : public TableReader,
   std::shared_ptr<ChunkedArrayBuilder> builder_;
 };
 
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  // If `thread_pool` is null, blocks are parsed and converted serially
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        thread_pool_(thread_pool),
+        max_pending_blocks_(thread_pool ? std::max(1, thread_pool->GetCapacity()) : 1),
+        chunker_(MakeChunker(parse_options_)) {}
+
+  ~StreamingReaderImpl() override {
+    // In case of error or early destruction, make sure all pending tasks
+    // are finished before we start destroying members
+    for (auto& pending : pending_blocks_) {
+      ARROW_UNUSED(pending.task_group->Finish());
+    }
+  }
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    RETURN_NOT_OK(MakeReadaheadIterator(std::move(it), max_pending_blocks_)
+                      .Value(&block_iterator_));
+
+    ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    if (block_ == nullptr) {
+      return Status::Invalid("Empty JSON file");
+    }
+    partial_ = std::make_shared<Buffer>("");
+
+    // Convert the first block with type inference, then lock the inferred
+    // schema so that the following blocks can be converted independently
+    // (skipping leading blocks without any objects, which wouldn't infer anything)
+    do {
+      RETURN_NOT_OK(LaunchNextBlock());
+      ARROW_ASSIGN_OR_RAISE(first_batch_, FinishNextBlock());
+    } while (first_batch_->num_rows() == 0 && block_);
+    schema_ = first_batch_->schema();
+    parse_options_.explicit_schema = schema_;
+    if (parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    while (true) {
+      // Keep the pipeline full, so that parsing of the following blocks
+      // overlaps with consumption of the current one
+      while (block_ && static_cast<int>(pending_blocks_.size()) < max_pending_blocks_) {
+        RETURN_NOT_OK(LaunchNextBlock());
+      }
+      std::shared_ptr<RecordBatch> next;
+      if (first_batch_) {
+        next = std::move(first_batch_);
+      } else if (pending_blocks_.empty()) {
+        // EOF
+        batch->reset();
+        return Status::OK();
+      } else {
+        ARROW_ASSIGN_OR_RAISE(next, FinishNextBlock());
+      }
+      // Don't bother returning empty batches (e.g. a block of whitespace)
+      if (next->num_rows() > 0) {
+        *batch = std::move(next);
+        return Status::OK();
+      }
+    }
+  }
+
+ private:
+  // A block whose parsing and conversion has been spawned
+  struct PendingBlock {
+    std::shared_ptr<TaskGroup> task_group;
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+  };
+
+  // Chunk the current block and spawn tasks to parse and convert it
+  Status LaunchNextBlock() {
+    DCHECK_NE(block_, nullptr);
+    std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
+
+    ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &completion,
+                                                 &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+
+    PendingBlock pending;
+    pending.task_group = thread_pool_ ? TaskGroup::MakeThreaded(thread_pool_)
+                                      : TaskGroup::MakeSerial();
+    auto type = parse_options_.explicit_schema
+                    ? struct_(parse_options_.explicit_schema->fields())
+                    : struct_({});
+    auto promotion_graph =
+        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+            ? GetPromotionGraph()
+            : nullptr;
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(pending.task_group, pool_, promotion_graph,
+                                          type, &pending.builder));
+
+    // Each block gets its own builder, so it is always block #0 for it
+    auto builder = pending.builder;
+    auto partial = partial_;
+    pending.task_group->Append([this, builder, partial, completion, whole] {
+      std::shared_ptr<Array> parsed;
+      RETURN_NOT_OK(Parse(partial, completion, whole, &parsed));
+      builder->Insert(0, field("", parsed->type()), parsed);
+      return Status::OK();
+    });
+    pending_blocks_.push_back(std::move(pending));
+
+    partial_ = next_partial;
+    block_ = next_block;
+    return Status::OK();
+  }
+
+  Status Parse(const std::shared_ptr<Buffer>& partial,
+               const std::shared_ptr<Buffer>& completion,
+               const std::shared_ptr<Buffer>& whole, std::shared_ptr<Array>* out) {
+    std::unique_ptr<BlockParser> parser;
+    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
+    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                               whole->size()));
+
+    if (partial->size() != 0 || completion->size() != 0) {
+      std::shared_ptr<Buffer> straddling;
+      if (partial->size() == 0) {
+        straddling = completion;
+      } else if (completion->size() == 0) {
+        straddling = partial;
+      } else {
+        ARROW_ASSIGN_OR_RAISE(straddling,
+                              ConcatenateBuffers({partial, completion}, pool_));
+      }
+      RETURN_NOT_OK(parser->Parse(straddling));
+    }
+
+    if (whole->size() != 0) {
+      RETURN_NOT_OK(parser->Parse(whole));
+    }
+    return parser->Finish(out);
+  }
+
+  // Wait for the oldest pending block and turn it into a RecordBatch
+  Result<std::shared_ptr<RecordBatch>> FinishNextBlock() {
+    DCHECK(!pending_blocks_.empty());
+    auto pending = std::move(pending_blocks_.front());
+    pending_blocks_.pop_front();
+
+    // This waits for the block's tasks to finish
+    std::shared_ptr<ChunkedArray> chunked;
+    RETURN_NOT_OK(pending.builder->Finish(&chunked));
+    DCHECK_EQ(chunked->num_chunks(), 1);
+    ARROW_ASSIGN_OR_RAISE(auto batch, RecordBatch::FromStructArray(chunked->chunk(0)));
+    if (schema_ == nullptr) {
+      return batch;
+    }
+    DCHECK(batch->schema()->Equals(*schema_));
+    return RecordBatch::Make(schema_, batch->num_rows(), batch->columns());
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ThreadPool* thread_pool_;
+  const int max_pending_blocks_;
+
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<Chunker> chunker_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  // The next block to chunk, and the unparsed tail of the previous one
+  std::shared_ptr<Buffer> block_;
+  std::shared_ptr<Buffer> partial_;
+  std::deque<PendingBlock> pending_blocks_;
+  // Result of type inference over the first block, not yet consumed
+  std::shared_ptr<RecordBatch> first_batch_;
+};
+
 Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                          const ReadOptions& read_options,
                          const ParseOptions& parse_options,
@@ -182,6 +375,16 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return Status::OK();
 }
 
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto reader = std::make_shared<StreamingReaderImpl>(
+      pool, read_options, parse_options,
+      read_options.use_threads ? GetCpuThreadPool() : nullptr);
+  RETURN_NOT_OK(reader->Init(std::move(input)));
+  return reader;
+}
+
 Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                 std::shared_ptr<RecordBatch>* out) {
   std::unique_ptr<BlockParser> parser;
@@ -20,6 +20,8 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -55,6 +57,31 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a JSON file incrementally
+///
+/// Only a bounded number of blocks (of `ReadOptions::block_size` bytes each)
+/// are held in memory at any time, so arbitrarily large files can be read
+/// in constant memory.  If `ReadOptions::use_threads` is true, several
+/// blocks are parsed and converted in parallel ahead of the consumer.
+///
+/// Each call to ReadNext() returns the objects of one JSON block.
+///
+/// Caveat: the schema is inferred from the first block and then locked.
+/// Later blocks are converted with it as explicit schema, and fields it
+/// doesn't contain are treated as UnexpectedFieldBehavior::Error (if type
+/// inference of unexpected fields was requested) or ignored.  Values that
+/// don't fit the inferred types also make ReadNext() return an error.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  /// Create a StreamingReader instance
+  ///
+  /// This involves reading, parsing and converting the first block, so as
+  /// to determine the schema.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+      const ReadOptions& read_options, const ParseOptions& parse_options);
+};
+
 ARROW_EXPORT Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                              std::shared_ptr<RecordBatch>* out);
 
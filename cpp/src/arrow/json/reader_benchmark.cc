@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace json {
+
+// End-to-end benchmarks of TableReader::Read(), covering the chunker, parser
+// and converters.  The data holds the same values as the CSV reader
+// benchmarks' for the same parameters, so that the readers can be compared.
+
+using ColumnKind = TextDataGenerator::ColumnKind;
+
+constexpr int32_t kNumColumns = 8;
+constexpr int64_t kDataSize = 8 << 20;  // 8 MB
+
+static void BenchmarkJSONTableReading(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::vector<ColumnKind>& kinds) {
+  const auto num_threads = static_cast<int>(state.range(0));
+  const auto block_size = static_cast<int32_t>(state.range(1) << 10);
+  const double null_probability = static_cast<double>(state.range(2)) / 100.0;
+
+  auto data = TextDataGenerator::JSON(kinds, kDataSize, null_probability);
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = num_threads > 0;
+  read_options.block_size = block_size;
+  auto parse_options = ParseOptions::Defaults();
+
+  const int saved_capacity = GetCpuThreadPoolCapacity();
+  if (num_threads > 0) {
+    ABORT_NOT_OK(SetCpuThreadPoolCapacity(num_threads));
+  }
+
+  int64_t num_rows = 0;
+  for (auto _ : state) {
+    auto input = std::make_shared<io::BufferReader>(data);
+    std::shared_ptr<TableReader> reader;
+    ABORT_NOT_OK(TableReader::Make(default_memory_pool(), input, read_options,
+                                   parse_options, &reader));
+    std::shared_ptr<Table> table;
+    ABORT_NOT_OK(reader->Read(&table));
+    num_rows = table->num_rows();
+  }
+
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(saved_capacity));
+
+  state.SetBytesProcessed(state.iterations() * data->size());
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+static void ReadInt64Columns(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkJSONTableReading(
+      state, std::vector<ColumnKind>(kNumColumns, TextDataGenerator::INT64));
+}
+
+static void ReadFloat64Columns(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkJSONTableReading(
+      state, std::vector<ColumnKind>(kNumColumns, TextDataGenerator::FLOAT64));
+}
+
+static void ReadStringColumns(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkJSONTableReading(
+      state, std::vector<ColumnKind>(kNumColumns, TextDataGenerator::STRING));
+}
+
+static void ReadMixedColumns(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<ColumnKind> kinds;
+  for (int32_t i = 0; i < kNumColumns; ++i) {
+    kinds.push_back(static_cast<ColumnKind>(i % 4));
+  }
+  BenchmarkJSONTableReading(state, kinds);
+}
+
+static void ReaderSetArgs(benchmark::internal::Benchmark* bench) {
+  // Zero threads means the serial reader
+  for (const auto threads : {0, 1, 4}) {
+    for (const auto block_kb : {64, 1024}) {
+      for (const auto null_percent : {0, 10}) {
+        bench->Args({threads, block_kb, null_percent});
+      }
+    }
+  }
+  bench->ArgNames({"threads", "block_kb", "null_percent"});
+  bench->Unit(benchmark::kMillisecond);
+  bench->UseRealTime();
+}
+
+BENCHMARK(ReadInt64Columns)->Apply(ReaderSetArgs);
+BENCHMARK(ReadFloat64Columns)->Apply(ReaderSetArgs);
+BENCHMARK(ReadStringColumns)->Apply(ReaderSetArgs);
+BENCHMARK(ReadMixedColumns)->Apply(ReaderSetArgs);
+
+}  // namespace json
+}  // namespace arrow
@@ -287,5 +287,82 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ protected:
+  Result<std::shared_ptr<StreamingReader>> MakeReader(string_view src,
+                                                      int32_t block_size) {
+    std::shared_ptr<io::InputStream> input;
+    RETURN_NOT_OK(MakeStream(src, &input));
+    read_options_.use_threads = GetParam();
+    read_options_.block_size = block_size;
+    return StreamingReader::Make(default_memory_pool(), input, read_options_,
+                                 parse_options_);
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) {
+  ASSERT_RAISES(Invalid, MakeReader("", 1000));
+}
+
+TEST_P(StreamingReaderTest, Basics) {
+  std::string src;
+  for (int i = 0; i < 100; ++i) {
+    src += "{\"i\": " + std::to_string(i) + ", \"s\": \"" + std::to_string(i * 2) +
+           "\"}\n";
+  }
+  // Small blocks => many batches
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(src, 100));
+  auto expected_schema = schema({field("i", int64()), field("s", utf8())});
+  AssertSchemaEqual(*reader->schema(), *expected_schema);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_GT(batches.size(), 10);
+  int64_t expected = 0;
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    AssertSchemaEqual(*batch->schema(), *expected_schema);
+    const auto& values = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < values.length(); ++i) {
+      ASSERT_EQ(values.Value(i), expected++);
+    }
+  }
+  ASSERT_EQ(expected, 100);
+
+  // EOF is sticky
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, SchemaLockedAfterFirstBlock) {
+  std::string src = "{\"a\": 1}\n{\"a\": 2}\n";
+  const auto block_size = static_cast<int32_t>(src.size());
+  src += "{\"a\": 3, \"b\": true}\n";
+
+  // The new field in the second block isn't type-inferred
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(src, block_size));
+  AssertSchemaEqual(*reader->schema(), *schema({field("a", int64())}));
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+  ASSERT_EQ(batch->num_rows(), 2);
+  ASSERT_RAISES(Invalid, reader->Next());
+
+  // ... unless unexpected fields are ignored
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  ASSERT_OK_AND_ASSIGN(reader, MakeReader(src, block_size));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+  AssertSchemaEqual(*table->schema(), *schema({field("a", int64())}));
+  ASSERT_EQ(table->num_rows(), 3);
+}
+
 }  // namespace json
 }  // namespace arrow
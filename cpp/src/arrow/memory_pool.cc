@@ -22,10 +22,19 @@
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/macros.h"
 
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
@@ -38,6 +47,11 @@
 #include <mimalloc.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #ifdef ARROW_JEMALLOC
 
 // Compile-time configuration for jemalloc options.
@@ -538,4 +552,977 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// CachingMemoryPool implementation
+
+namespace {
+
+struct ThreadCache;
+
+// State of a CachingMemoryPool shared with the thread caches holding its
+// buffers, which may outlive it
+struct CachingPoolState {
+  CachingPoolState(MemoryPool* pool, size_t num_size_classes)
+      : pool(pool), num_size_classes(num_size_classes) {}
+
+  static int64_t ClassSize(size_t size_class) {
+    return static_cast<int64_t>((size_class + 1) * kAlignment);
+  }
+
+  // Return the cached buffers to the backing pool, with the mutex held
+  void ReleaseLocked(std::vector<std::vector<uint8_t*>>* free_lists) {
+    for (size_t i = 0; i < free_lists->size(); ++i) {
+      for (uint8_t* buffer : (*free_lists)[i]) {
+        pool->Free(buffer, ClassSize(i));
+      }
+      (*free_lists)[i].clear();
+    }
+  }
+
+  std::mutex mutex;
+  // Reset when the CachingMemoryPool is destroyed
+  MemoryPool* pool;
+  const size_t num_size_classes;
+  std::unordered_set<ThreadCache*> caches;
+};
+
+// The free lists of a thread for a given CachingMemoryPool.  They are only
+// accessed without holding the mutex by their own thread.
+struct ThreadCache {
+  explicit ThreadCache(std::shared_ptr<CachingPoolState> state)
+      : state(std::move(state)), free_lists(this->state->num_size_classes) {}
+
+  ~ThreadCache() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->pool != nullptr) {
+      state->ReleaseLocked(&free_lists);
+      state->caches.erase(this);
+    }
+  }
+
+  std::shared_ptr<CachingPoolState> state;
+  std::vector<std::vector<uint8_t*>> free_lists;
+};
+
+// The thread caches of the calling thread, by CachingMemoryPool id
+struct ThreadCaches {
+  std::unordered_map<uint64_t, std::unique_ptr<ThreadCache>> caches;
+  // The most recently used entry of `caches`
+  uint64_t last_id = 0;
+  ThreadCache* last_cache = nullptr;
+};
+
+thread_local ThreadCaches thread_caches;
+
+std::atomic<uint64_t> next_caching_pool_id(1);
+
+}  // namespace
+
+class CachingMemoryPool::CachingMemoryPoolImpl {
+ public:
+  CachingMemoryPoolImpl(MemoryPool* pool, int64_t max_cached_size,
+                        int64_t max_cached_buffers)
+      : pool_(pool),
+        max_cached_size_(max_cached_size),
+        max_cached_buffers_(
+            static_cast<size_t>(std::max<int64_t>(max_cached_buffers, 0))),
+        id_(next_caching_pool_id++) {
+    const size_t num_size_classes =
+        max_cached_size > 0 ? SizeClass(max_cached_size) + 1 : 0;
+    state_ = std::make_shared<CachingPoolState>(pool, num_size_classes);
+  }
+
+  ~CachingMemoryPoolImpl() {
+    // Thread caches of other threads outlive this pool, release their buffers
+    // now.  Their threads remove the thread caches when they next add one
+    // (ids aren't reused, so they are harmless until then).
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    for (ThreadCache* cache : state_->caches) {
+      state_->ReleaseLocked(&cache->free_lists);
+    }
+    state_->caches.clear();
+    state_->pool = nullptr;
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (!IsCached(size)) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    } else {
+      const size_t size_class = SizeClass(size);
+      auto* free_list = &GetThreadCache()->free_lists[size_class];
+      const bool hit = !free_list->empty();
+      if (hit) {
+        *out = free_list->back();
+        free_list->pop_back();
+      } else {
+        RETURN_NOT_OK(pool_->Allocate(CachingPoolState::ClassSize(size_class), out));
+      }
+      stats_.UpdateCacheHits(hit);
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (!IsCached(old_size) && !IsCached(new_size)) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (IsCached(old_size) && IsCached(new_size) &&
+        SizeClass(old_size) == SizeClass(new_size)) {
+      // The buffer is already large enough
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (!IsCached(size)) {
+      pool_->Free(buffer, size);
+    } else {
+      const size_t size_class = SizeClass(size);
+      auto* free_list = &GetThreadCache()->free_lists[size_class];
+      if (free_list->size() < max_cached_buffers_) {
+        free_list->push_back(buffer);
+      } else {
+        pool_->Free(buffer, CachingPoolState::ClassSize(size_class));
+      }
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t num_cache_hits() const { return stats_.num_cache_hits(); }
+
+  int64_t num_cache_misses() const { return stats_.num_cache_misses(); }
+
+ private:
+  bool IsCached(int64_t size) const { return size > 0 && size <= max_cached_size_; }
+
+  static size_t SizeClass(int64_t size) {
+    return static_cast<size_t>(size - 1) / kAlignment;
+  }
+
+  ThreadCache* GetThreadCache() {
+    ThreadCaches& local = thread_caches;
+    if (local.last_id != id_) {
+      auto it = local.caches.find(id_);
+      if (it == local.caches.end()) {
+        RemoveDeadThreadCaches(&local);
+        std::unique_ptr<ThreadCache> cache(new ThreadCache(state_));
+        {
+          std::lock_guard<std::mutex> lock(state_->mutex);
+          state_->caches.insert(cache.get());
+        }
+        it = local.caches.emplace(id_, std::move(cache)).first;
+      }
+      local.last_id = id_;
+      local.last_cache = it->second.get();
+    }
+    return local.last_cache;
+  }
+
+  // Remove the thread caches of destroyed pools, so that a long-lived thread
+  // keeps at most one per live pool, plus those of pools destroyed since it
+  // last started using a pool
+  static void RemoveDeadThreadCaches(ThreadCaches* local) {
+    for (auto it = local->caches.begin(); it != local->caches.end();) {
+      bool dead;
+      {
+        CachingPoolState* state = it->second->state.get();
+        std::lock_guard<std::mutex> lock(state->mutex);
+        dead = state->pool == nullptr;
+      }
+      if (dead) {
+        if (local->last_cache == it->second.get()) {
+          local->last_id = 0;
+          local->last_cache = nullptr;
+        }
+        it = local->caches.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  MemoryPool* pool_;
+  const int64_t max_cached_size_;
+  const size_t max_cached_buffers_;
+  const uint64_t id_;
+  std::shared_ptr<CachingPoolState> state_;
+  internal::MemoryPoolStats stats_;
+};
+
+CachingMemoryPool::CachingMemoryPool(MemoryPool* pool, int64_t max_cached_size,
+                                     int64_t max_cached_buffers) {
+  impl_.reset(new CachingMemoryPoolImpl(pool, max_cached_size, max_cached_buffers));
+}
+
+CachingMemoryPool::~CachingMemoryPool() {}
+
+Status CachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status CachingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void CachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t CachingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CachingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string CachingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t CachingMemoryPool::num_cache_hits() const { return impl_->num_cache_hits(); }
+
+int64_t CachingMemoryPool::num_cache_misses() const {
+  return impl_->num_cache_misses();
+}
+
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+constexpr int64_t ArenaMemoryPool::kDefaultRegionSize;
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* pool, int64_t region_size)
+      : pool_(pool),
+        region_size_(BitUtil::RoundUpToMultipleOf64(
+            std::max<int64_t>(region_size, static_cast<int64_t>(kAlignment)))) {}
+
+  ~ArenaMemoryPoolImpl() {
+    // All the buffers were freed, only the current region may be left
+    for (const auto& region : regions_) {
+      pool_->Free(region.first, region.second.size);
+    }
+  }
+
+  void set_self(const std::shared_ptr<ArenaMemoryPool>& self) { self_ = self; }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(AllocateLocked(size, out));
+    KeepAliveLocked();
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr,
+                    std::shared_ptr<ArenaMemoryPool>* released) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (*ptr == zero_size_area) {
+      RETURN_NOT_OK(AllocateLocked(new_size, ptr));
+      KeepAliveLocked();
+      return Status::OK();
+    }
+    if (new_size == 0) {
+      FreeLocked(*ptr, old_size);
+      *ptr = zero_size_area;
+      *released = ReleaseLocked();
+      return Status::OK();
+    }
+
+    const int64_t old_padded = BitUtil::RoundUpToMultipleOf64(old_size);
+    const int64_t new_padded = BitUtil::RoundUpToMultipleOf64(new_size);
+    auto it = FindRegion(*ptr);
+    Region& region = it->second;
+    const int64_t offset = *ptr - it->first;
+    if (offset + old_padded == region.used && offset + new_padded <= region.size) {
+      // The most recent allocation of its region, resize it in place
+      region.used = offset + new_padded;
+    } else if (new_padded <= old_padded) {
+      // Shrinking, the space left isn't reclaimed
+    } else if (region.num_allocations == 1 && offset == 0 && it->first != current_) {
+      // Alone in its region, resize the region
+      uint8_t* data = it->first;
+      RETURN_NOT_OK(pool_->Reallocate(region.size, new_padded, &data));
+      bytes_reserved_ += new_padded - region.size;
+      regions_.erase(it);
+      regions_.emplace(data, Region{new_padded, new_padded, 1});
+      *ptr = data;
+    } else {
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateLocked(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      FreeLocked(*ptr, old_size);
+      *ptr = out;
+      return Status::OK();
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  std::shared_ptr<ArenaMemoryPool> Free(uint8_t* buffer, int64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffer == zero_size_area) {
+      return nullptr;
+    }
+    FreeLocked(buffer, size);
+    return ReleaseLocked();
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t bytes_reserved() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_reserved_;
+  }
+
+ private:
+  struct Region {
+    int64_t size;
+    // The end of the most recent allocation
+    int64_t used;
+    int64_t num_allocations;
+  };
+
+  using RegionMap = std::map<uint8_t*, Region>;
+
+  RegionMap::iterator FindRegion(uint8_t* buffer) {
+    auto it = regions_.upper_bound(buffer);
+    DCHECK(it != regions_.begin());
+    --it;
+    DCHECK_LT(buffer - it->first, it->second.size);
+    return it;
+  }
+
+  Status AllocateLocked(int64_t size, uint8_t** out) {
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    const int64_t padded = BitUtil::RoundUpToMultipleOf64(size);
+    Region* region = nullptr;
+    if (current_ != nullptr && regions_[current_].used + padded <= region_size_) {
+      region = &regions_[current_];
+      *out = current_ + region->used;
+    } else {
+      // Larger allocations get a region of their own, and don't replace the
+      // current region
+      const bool dedicated = padded > region_size_ / 2;
+      const int64_t region_size = dedicated ? padded : region_size_;
+      uint8_t* data;
+      RETURN_NOT_OK(pool_->Allocate(region_size, &data));
+      bytes_reserved_ += region_size;
+      region = &regions_.emplace(data, Region{region_size, 0, 0}).first->second;
+      if (!dedicated) {
+        // The previous region still holds allocations, it is returned to the
+        // parent pool once they are freed
+        current_ = data;
+      }
+      *out = data;
+    }
+    region->used += padded;
+    ++region->num_allocations;
+    ++num_allocations_;
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  void FreeLocked(uint8_t* buffer, int64_t size) {
+    const int64_t padded = BitUtil::RoundUpToMultipleOf64(size);
+    auto it = FindRegion(buffer);
+    Region& region = it->second;
+    if (buffer + padded == it->first + region.used) {
+      // The most recent allocation of its region, make its space available
+      region.used -= padded;
+    }
+    --num_allocations_;
+    if (--region.num_allocations == 0) {
+      if (it->first == current_) {
+        region.used = 0;
+      } else {
+        ReturnRegionLocked(it);
+      }
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void ReturnRegionLocked(RegionMap::iterator it) {
+    pool_->Free(it->first, it->second.size);
+    bytes_reserved_ -= it->second.size;
+    regions_.erase(it);
+  }
+
+  // The arena is kept alive by its own allocations
+  void KeepAliveLocked() {
+    if (num_allocations_ > 0 && keep_alive_ == nullptr) {
+      keep_alive_ = self_.lock();
+    }
+  }
+
+  // Return the reference keeping the arena alive once its allocations are all
+  // freed, to be released by the caller after unlocking
+  std::shared_ptr<ArenaMemoryPool> ReleaseLocked() {
+    if (num_allocations_ == 0) {
+      return std::move(keep_alive_);
+    }
+    return nullptr;
+  }
+
+  MemoryPool* pool_;
+  const int64_t region_size_;
+  mutable std::mutex mutex_;
+  RegionMap regions_;
+  // The region new allocations are carved out of, if any
+  uint8_t* current_ = nullptr;
+  int64_t num_allocations_ = 0;
+  int64_t bytes_reserved_ = 0;
+  std::weak_ptr<ArenaMemoryPool> self_;
+  std::shared_ptr<ArenaMemoryPool> keep_alive_;
+  internal::MemoryPoolStats stats_;
+};
+
+std::shared_ptr<ArenaMemoryPool> ArenaMemoryPool::Make(MemoryPool* pool,
+                                                       int64_t region_size) {
+  std::shared_ptr<ArenaMemoryPool> arena(new ArenaMemoryPool(
+      std::unique_ptr<ArenaMemoryPoolImpl>(new ArenaMemoryPoolImpl(pool, region_size))));
+  arena->impl_->set_self(arena);
+  return arena;
+}
+
+ArenaMemoryPool::ArenaMemoryPool(std::unique_ptr<ArenaMemoryPoolImpl> impl)
+    : impl_(std::move(impl)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  // Freeing the last buffer may release the last reference to this arena,
+  // which must then be destroyed after returning from the implementation
+  std::shared_ptr<ArenaMemoryPool> released;
+  return impl_->Reallocate(old_size, new_size, ptr, &released);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  auto released = impl_->Free(buffer, size);
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ArenaMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+///////////////////////////////////////////////////////////////////////
+// TrackingMemoryPool implementation
+
+constexpr int64_t TrackingMemoryPool::kNoLimit;
+
+class TrackingMemoryPool::TrackingMemoryPoolImpl {
+ public:
+  TrackingMemoryPoolImpl(std::string name, MemoryPool* pool, int64_t limit,
+                         std::shared_ptr<TrackingMemoryPool> parent)
+      : name_(std::move(name)), pool_(pool), limit_(limit), parent_(std::move(parent)) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(Reserve(size));
+    Status st = pool_->Allocate(size, out);
+    if (!st.ok()) {
+      Release(size);
+      return st;
+    }
+    for (auto node = this; node != nullptr; node = node->parent_impl()) {
+      node->num_allocations_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size > old_size) {
+      RETURN_NOT_OK(Reserve(new_size - old_size));
+      Status st = pool_->Reallocate(old_size, new_size, ptr);
+      if (!st.ok()) {
+        Release(new_size - old_size);
+      }
+      return st;
+    }
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    Release(old_size - new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    Release(size);
+  }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t num_allocations() const { return num_allocations_.load(); }
+
+  const std::string& name() const { return name_; }
+
+  MemoryPool* pool() const { return pool_; }
+
+  int64_t limit() const { return limit_; }
+
+  const std::shared_ptr<TrackingMemoryPool>& parent() const { return parent_; }
+
+  void AddChild(const std::shared_ptr<TrackingMemoryPool>& child) {
+    std::lock_guard<std::mutex> lock(children_mutex_);
+    children_.erase(std::remove_if(children_.begin(), children_.end(),
+                                   [](const std::weak_ptr<TrackingMemoryPool>& child) {
+                                     return child.expired();
+                                   }),
+                    children_.end());
+    children_.push_back(child);
+  }
+
+  std::vector<std::shared_ptr<TrackingMemoryPool>> children() const {
+    std::lock_guard<std::mutex> lock(children_mutex_);
+    std::vector<std::shared_ptr<TrackingMemoryPool>> children;
+    for (const auto& weak_child : children_) {
+      auto child = weak_child.lock();
+      if (child != nullptr) {
+        children.push_back(std::move(child));
+      }
+    }
+    return children;
+  }
+
+  void Report(int depth, std::stringstream* ss) const {
+    *ss << std::string(2 * depth, ' ') << name_ << ": " << bytes_allocated()
+        << " bytes allocated, " << max_memory() << " peak, " << num_allocations()
+        << " allocations";
+    if (limit_ != kNoLimit) {
+      *ss << ", limit " << limit_;
+    }
+    *ss << "\n";
+    for (const auto& child : children()) {
+      child->impl_->Report(depth + 1, ss);
+    }
+  }
+
+ private:
+  TrackingMemoryPoolImpl* parent_impl() const {
+    return parent_ == nullptr ? nullptr : parent_->impl_.get();
+  }
+
+  // Account for `size` more bytes in this pool and its ancestors, unless it
+  // would exceed the limit of one of them.  Bytes are reserved with a CAS loop
+  // so that bytes_allocated() never exceeds the limit, even transiently.
+  Status Reserve(int64_t size) {
+    for (auto node = this; node != nullptr; node = node->parent_impl()) {
+      int64_t allocated = node->bytes_allocated_.load();
+      do {
+        if (node->limit_ != kNoLimit && allocated + size > node->limit_) {
+          for (auto undo = this; undo != node; undo = undo->parent_impl()) {
+            undo->bytes_allocated_.fetch_sub(size);
+          }
+          return Status::OutOfMemory("allocation of ", size,
+                                     " bytes would exceed the limit of ", node->limit_,
+                                     " bytes of memory pool '", node->name_, "'");
+        }
+      } while (
+          !node->bytes_allocated_.compare_exchange_weak(allocated, allocated + size));
+    }
+    // Only raise the peaks once the allocation is known to succeed
+    for (auto node = this; node != nullptr; node = node->parent_impl()) {
+      const int64_t allocated = node->bytes_allocated_.load();
+      int64_t peak = node->max_memory_.load();
+      while (allocated > peak &&
+             !node->max_memory_.compare_exchange_weak(peak, allocated)) {
+      }
+    }
+    return Status::OK();
+  }
+
+  void Release(int64_t size) {
+    for (auto node = this; node != nullptr; node = node->parent_impl()) {
+      node->bytes_allocated_.fetch_sub(size);
+    }
+  }
+
+  const std::string name_;
+  MemoryPool* pool_;
+  const int64_t limit_;
+  const std::shared_ptr<TrackingMemoryPool> parent_;
+
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+  std::atomic<int64_t> num_allocations_{0};
+
+  mutable std::mutex children_mutex_;
+  std::vector<std::weak_ptr<TrackingMemoryPool>> children_;
+};
+
+std::shared_ptr<TrackingMemoryPool> TrackingMemoryPool::Make(std::string name,
+                                                             MemoryPool* pool,
+                                                             int64_t limit) {
+  return std::shared_ptr<TrackingMemoryPool>(
+      new TrackingMemoryPool(std::unique_ptr<TrackingMemoryPoolImpl>(
+          new TrackingMemoryPoolImpl(std::move(name), pool, limit, nullptr))));
+}
+
+std::shared_ptr<TrackingMemoryPool> TrackingMemoryPool::MakeChild(std::string name,
+                                                                  int64_t limit) {
+  std::shared_ptr<TrackingMemoryPool> child(
+      new TrackingMemoryPool(std::unique_ptr<TrackingMemoryPoolImpl>(
+          new TrackingMemoryPoolImpl(std::move(name), impl_->pool(), limit,
+                                     shared_from_this()))));
+  impl_->AddChild(child);
+  return child;
+}
+
+TrackingMemoryPool::TrackingMemoryPool(std::unique_ptr<TrackingMemoryPoolImpl> impl)
+    : impl_(std::move(impl)) {}
+
+TrackingMemoryPool::~TrackingMemoryPool() {}
+
+Status TrackingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status TrackingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void TrackingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t TrackingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t TrackingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string TrackingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t TrackingMemoryPool::num_allocations() const { return impl_->num_allocations(); }
+
+const std::string& TrackingMemoryPool::name() const { return impl_->name(); }
+
+int64_t TrackingMemoryPool::limit() const { return impl_->limit(); }
+
+const std::shared_ptr<TrackingMemoryPool>& TrackingMemoryPool::parent() const {
+  return impl_->parent();
+}
+
+std::vector<std::shared_ptr<TrackingMemoryPool>> TrackingMemoryPool::children() const {
+  return impl_->children();
+}
+
+std::string TrackingMemoryPool::ToString() const {
+  std::stringstream ss;
+  impl_->Report(0, &ss);
+  return ss.str();
+}
+
+///////////////////////////////////////////////////////////////////////
+// HugePageMemoryPool implementation
+
+constexpr int64_t HugePageMemoryPool::kHugePageSize;
+
+class HugePageMemoryPool::HugePageMemoryPoolImpl {
+ public:
+  HugePageMemoryPoolImpl(MemoryPool* pool, int64_t threshold, bool prefault,
+                         bool use_hugetlb)
+      : pool_(pool),
+        threshold_(std::max<int64_t>(threshold, 1)),
+        prefault_(prefault),
+        use_hugetlb_(use_hugetlb),
+        num_huge_page_allocations_(0),
+        num_fallbacks_(0),
+        bytes_mapped_(0) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size >= threshold_) {
+      if (Map(size, out)) {
+        stats_.UpdateAllocatedBytes(size);
+        return Status::OK();
+      }
+      num_fallbacks_.fetch_add(1);
+    }
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    Mapping mapping;
+    if (old_size < threshold_ || !FindMapping(*ptr, &mapping)) {
+      // The buffer comes from the backing pool
+      uint8_t* out;
+      if (new_size < threshold_ || !Map(new_size, &out)) {
+        if (new_size >= threshold_) {
+          num_fallbacks_.fetch_add(1);
+        }
+        RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+      } else {
+        std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+        pool_->Free(*ptr, old_size);
+        *ptr = out;
+      }
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (new_size >= threshold_ && Remap(mapping, new_size, ptr)) {
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    // Move the data to the backing pool, or to a new mapping if the pages
+    // can't be remapped
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    Mapping mapping;
+    if (size >= threshold_ && TakeMapping(buffer, &mapping)) {
+      Unmap(buffer, mapping);
+    } else {
+      pool_->Free(buffer, size);
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t num_huge_page_allocations() const { return num_huge_page_allocations_.load(); }
+
+  int64_t num_fallbacks() const { return num_fallbacks_.load(); }
+
+  int64_t bytes_mapped() const { return bytes_mapped_.load(); }
+
+ private:
+  struct Mapping {
+    int64_t length;
+    bool hugetlb;
+  };
+
+  static bool MappingLength(int64_t size, int64_t* length) {
+    if (size > std::numeric_limits<int64_t>::max() - kHugePageSize) {
+      return false;
+    }
+    *length = BitUtil::RoundUp(size, kHugePageSize);
+    return true;
+  }
+
+  bool Map(int64_t size, uint8_t** out) {
+#ifdef __linux__
+    Mapping mapping{0, false};
+    if (!MappingLength(size, &mapping.length)) {
+      return false;
+    }
+    void* addr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (use_hugetlb_) {
+      // Fails unless enough huge pages are reserved in the hugetlb pool
+      addr = mmap(nullptr, static_cast<size_t>(mapping.length), PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      mapping.hugetlb = addr != MAP_FAILED;
+    }
+#endif
+    if (addr == MAP_FAILED) {
+      addr = MapAligned(mapping.length);
+      if (addr == MAP_FAILED) {
+        return false;
+      }
+#ifdef MADV_HUGEPAGE
+      // An error only means that transparent huge pages are disabled
+      madvise(addr, static_cast<size_t>(mapping.length), MADV_HUGEPAGE);
+#endif
+    }
+    *out = static_cast<uint8_t*>(addr);
+    if (prefault_) {
+      Prefault(*out, 0, mapping.length);
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      mappings_[*out] = mapping;
+    }
+    num_huge_page_allocations_.fetch_add(1);
+    bytes_mapped_.fetch_add(mapping.length);
+    return true;
+#else
+    ARROW_UNUSED(prefault_);
+    ARROW_UNUSED(use_hugetlb_);
+    return false;
+#endif
+  }
+
+#ifdef __linux__
+  // Map a region starting on a huge page boundary, so that it can be backed
+  // by transparent huge pages from its first byte
+  static void* MapAligned(int64_t length) {
+    const size_t padded_length = static_cast<size_t>(length + kHugePageSize);
+    void* addr = mmap(nullptr, padded_length, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+      return addr;
+    }
+    auto start = reinterpret_cast<uintptr_t>(addr);
+    auto aligned = static_cast<uintptr_t>(
+        BitUtil::RoundUp(static_cast<int64_t>(start), kHugePageSize));
+    if (aligned > start) {
+      munmap(addr, aligned - start);
+    }
+    const uintptr_t end = aligned + static_cast<uintptr_t>(length);
+    if (start + padded_length > end) {
+      munmap(reinterpret_cast<void*>(end), start + padded_length - end);
+    }
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  static void Prefault(uint8_t* data, int64_t begin, int64_t end) {
+    static const int64_t page_size = sysconf(_SC_PAGESIZE);
+    for (int64_t offset = begin; offset < end; offset += page_size) {
+      data[offset] = 0;
+    }
+  }
+#endif
+
+  bool Remap(const Mapping& mapping, int64_t new_size, uint8_t** ptr) {
+    int64_t new_length;
+    if (!MappingLength(new_size, &new_length)) {
+      return false;
+    }
+    if (new_length == mapping.length) {
+      return true;
+    }
+#ifdef __linux__
+    if (mapping.hugetlb) {
+      // Resizing hugetlb mappings isn't reliably supported
+      return false;
+    }
+    // The remapped region keeps the huge page advice, though it may lose
+    // huge page alignment if it moves
+    void* addr = mremap(*ptr, static_cast<size_t>(mapping.length),
+                        static_cast<size_t>(new_length), MREMAP_MAYMOVE);
+    if (addr == MAP_FAILED) {
+      return false;
+    }
+    auto out = static_cast<uint8_t*>(addr);
+    if (prefault_) {
+      Prefault(out, mapping.length, new_length);
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      mappings_.erase(*ptr);
+      mappings_[out] = Mapping{new_length, false};
+    }
+    bytes_mapped_.fetch_add(new_length - mapping.length);
+    *ptr = out;
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  void Unmap(uint8_t* buffer, const Mapping& mapping) {
+#ifdef __linux__
+    munmap(buffer, static_cast<size_t>(mapping.length));
+#endif
+    bytes_mapped_.fetch_sub(mapping.length);
+  }
+
+  bool FindMapping(uint8_t* buffer, Mapping* out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = mappings_.find(buffer);
+    if (it == mappings_.end()) {
+      return false;
+    }
+    *out = it->second;
+    return true;
+  }
+
+  bool TakeMapping(uint8_t* buffer, Mapping* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = mappings_.find(buffer);
+    if (it == mappings_.end()) {
+      return false;
+    }
+    *out = it->second;
+    mappings_.erase(it);
+    return true;
+  }
+
+  MemoryPool* pool_;
+  const int64_t threshold_;
+  const bool prefault_;
+  const bool use_hugetlb_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> num_huge_page_allocations_;
+  std::atomic<int64_t> num_fallbacks_;
+  std::atomic<int64_t> bytes_mapped_;
+
+  // The huge page allocations, by address.  Large allocations are few, so a
+  // single mutex is enough.
+  mutable std::mutex mutex_;
+  std::unordered_map<uint8_t*, Mapping> mappings_;
+};
+
+HugePageMemoryPool::HugePageMemoryPool(MemoryPool* pool, int64_t threshold,
+                                       bool prefault, bool use_hugetlb)
+    : impl_(new HugePageMemoryPoolImpl(pool, threshold, prefault, use_hugetlb)) {}
+
+HugePageMemoryPool::~HugePageMemoryPool() {}
+
+Status HugePageMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status HugePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void HugePageMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t HugePageMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t HugePageMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string HugePageMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t HugePageMemoryPool::num_huge_page_allocations() const {
+  return impl_->num_huge_page_allocations();
+}
+
+int64_t HugePageMemoryPool::num_fallbacks() const { return impl_->num_fallbacks(); }
+
+int64_t HugePageMemoryPool::bytes_mapped() const { return impl_->bytes_mapped(); }
+
 }  // namespace arrow
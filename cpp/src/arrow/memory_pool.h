@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -35,12 +36,19 @@ namespace internal {
 
 class MemoryPoolStats {
  public:
-  MemoryPoolStats() : bytes_allocated_(0), max_memory_(0) {}
+  MemoryPoolStats()
+      : bytes_allocated_(0), max_memory_(0), num_cache_hits_(0), num_cache_misses_(0) {}
 
   int64_t max_memory() const { return max_memory_.load(); }
 
   int64_t bytes_allocated() const { return bytes_allocated_.load(); }
 
+  /// The number of allocations served from a cache of freed buffers, if any
+  int64_t num_cache_hits() const { return num_cache_hits_.load(); }
+
+  /// The number of cacheable allocations that had to go to the allocator
+  int64_t num_cache_misses() const { return num_cache_misses_.load(); }
+
   inline void UpdateAllocatedBytes(int64_t diff) {
     auto allocated = bytes_allocated_.fetch_add(diff) + diff;
     // "maximum" allocated memory is ill-defined in multi-threaded code,
@@ -50,9 +58,15 @@ class MemoryPoolStats {
     }
   }
 
+  inline void UpdateCacheHits(bool hit) {
+    (hit ? num_cache_hits_ : num_cache_misses_).fetch_add(1, std::memory_order_relaxed);
+  }
+
  protected:
   std::atomic<int64_t> bytes_allocated_;
   std::atomic<int64_t> max_memory_;
+  std::atomic<int64_t> num_cache_hits_;
+  std::atomic<int64_t> num_cache_misses_;
 };
 
 }  // namespace internal
@@ -149,6 +163,241 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A MemoryPool caching small freed buffers in per-thread free lists
+///
+/// Small allocations are rounded up to a multiple of 64 bytes, and each
+/// thread keeps a free list of buffers for every such size class.  Freeing a
+/// small buffer pushes it onto the calling thread's free list, and allocating
+/// one pops it from there, so that repeatedly allocating and freeing small
+/// buffers (e.g. in builders and kernels) doesn't go to the backing pool and
+/// its locks.  Larger allocations are delegated to the backing pool.
+///
+/// Like ProxyMemoryPool, bytes_allocated() and max_memory() only track the
+/// allocations made through this pool.  Cached buffers stay allocated in the
+/// backing pool until the thread caching them exits or this pool is
+/// destroyed.  This pool must outlive the buffers allocated from it.
+class ARROW_EXPORT CachingMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] pool the backing pool
+  /// \param[in] max_cached_size the largest allocation size to cache
+  /// \param[in] max_cached_buffers the largest number of free buffers kept
+  ///   by a thread for each size class
+  explicit CachingMemoryPool(MemoryPool* pool, int64_t max_cached_size = 4096,
+                             int64_t max_cached_buffers = 64);
+  ~CachingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of small allocations served from a free list
+  int64_t num_cache_hits() const;
+
+  /// The number of small allocations delegated to the backing pool
+  int64_t num_cache_misses() const;
+
+ private:
+  class CachingMemoryPoolImpl;
+  std::unique_ptr<CachingMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool carving allocations out of large regions of a parent pool
+///
+/// Allocations are served from the current region by bumping a pointer, and
+/// the most recent allocation of a region is resized in place, so that
+/// building a batch with builders seldom copies data or goes to the parent
+/// pool.  Freeing the most recent allocation of a region makes its space
+/// available again, but the space of other freed allocations is only
+/// reclaimed when all the allocations of their region are freed and the
+/// region is returned to the parent pool.  An arena is therefore meant to
+/// hold the buffers of one batch, which are freed in bulk.
+///
+/// An arena stays alive as long as a buffer allocated from it does, even
+/// after the last reference returned by Make() is dropped, so the buffers of
+/// a batch may outlive the code that built it.  The parent pool must outlive
+/// the arena.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultRegionSize = 1 << 20;
+
+  /// \param[in] pool the parent pool
+  /// \param[in] region_size the size of the regions allocated from the parent
+  ///   pool.  Larger allocations get a region of their own.
+  static std::shared_ptr<ArenaMemoryPool> Make(
+      MemoryPool* pool = default_memory_pool(),
+      int64_t region_size = kDefaultRegionSize);
+
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes held by the arena in regions of the parent pool
+  int64_t bytes_reserved() const;
+
+ private:
+  class ArenaMemoryPoolImpl;
+
+  explicit ArenaMemoryPool(std::unique_ptr<ArenaMemoryPoolImpl> impl);
+
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool accounting for the memory used by a subsystem, in a
+/// hierarchy of such pools
+///
+/// A root pool is made with Make() on top of a backing pool, and child pools
+/// are made with MakeChild(), e.g. one per query and, within a query, one per
+/// reader or kernel.  Each pool reports the bytes currently allocated through
+/// it and its descendants, their high-water mark and the number of
+/// allocations made, so that memory usage can be attributed to subsystems.
+///
+/// A pool may be given a limit on the bytes allocated through it and its
+/// descendants.  An allocation or reallocation that would exceed the limit of
+/// a pool or of one of its ancestors fails with Status::OutOfMemory without
+/// going to the backing pool, which can serve for admission control.
+///
+/// A child pool keeps its parent alive.  Pools must outlive the buffers
+/// allocated from them, and the backing pool must outlive the root.
+class ARROW_EXPORT TrackingMemoryPool
+    : public MemoryPool,
+      public std::enable_shared_from_this<TrackingMemoryPool> {
+ public:
+  static constexpr int64_t kNoLimit = -1;
+
+  /// \brief Make a root pool
+  ///
+  /// \param[in] name the name of the pool, used in reports
+  /// \param[in] pool the backing pool
+  /// \param[in] limit the largest number of bytes allocated through the
+  ///   pool at any time, or kNoLimit
+  static std::shared_ptr<TrackingMemoryPool> Make(
+      std::string name, MemoryPool* pool = default_memory_pool(),
+      int64_t limit = kNoLimit);
+
+  /// \brief Make a child pool, allocating from the same backing pool
+  ///
+  /// \param[in] name the name of the child, used in reports
+  /// \param[in] limit the largest number of bytes allocated through the
+  ///   child at any time, or kNoLimit
+  std::shared_ptr<TrackingMemoryPool> MakeChild(std::string name,
+                                                int64_t limit = kNoLimit);
+
+  ~TrackingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// The number of bytes allocated through this pool and its descendants
+  int64_t bytes_allocated() const override;
+
+  /// The peak of bytes_allocated()
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of allocations made through this pool and its descendants
+  int64_t num_allocations() const;
+
+  const std::string& name() const;
+
+  /// The limit on bytes_allocated(), or kNoLimit
+  int64_t limit() const;
+
+  /// The parent pool, or nullptr for a root
+  const std::shared_ptr<TrackingMemoryPool>& parent() const;
+
+  /// The child pools still alive, in creation order
+  std::vector<std::shared_ptr<TrackingMemoryPool>> children() const;
+
+  /// \brief A report of the usage of this pool and its descendants, one line
+  /// per pool
+  std::string ToString() const;
+
+ private:
+  class TrackingMemoryPoolImpl;
+
+  explicit TrackingMemoryPool(std::unique_ptr<TrackingMemoryPoolImpl> impl);
+
+  std::unique_ptr<TrackingMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool serving large allocations from 2MB huge pages
+///
+/// Allocations of at least `threshold` bytes are mapped directly from the
+/// operating system and advised to be backed by transparent huge pages, or,
+/// if `use_hugetlb` is true, backed by explicit huge pages from the hugetlb
+/// pool when some are reserved.  This cuts the TLB misses and page faults
+/// incurred by large columnar buffers.  If `prefault` is true, the pages of
+/// such allocations are touched upfront rather than on first use.  Large
+/// reallocations remap the pages rather than copying the data where
+/// possible.
+///
+/// Smaller allocations, and large ones when huge pages are unavailable
+/// (e.g. the mapping fails or the platform isn't Linux), are delegated to
+/// the backing pool.  The latter are counted in num_fallbacks().
+///
+/// Like ProxyMemoryPool, bytes_allocated() and max_memory() only track the
+/// allocations made through this pool.  This pool must outlive the buffers
+/// allocated from it.
+class ARROW_EXPORT HugePageMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kHugePageSize = 1 << 21;
+
+  /// \param[in] pool the backing pool
+  /// \param[in] threshold the smallest allocation size to serve from huge
+  ///   pages
+  /// \param[in] prefault whether to touch the pages of huge page allocations
+  ///   when they are made
+  /// \param[in] use_hugetlb whether to try explicit huge pages before
+  ///   transparent huge pages
+  explicit HugePageMemoryPool(MemoryPool* pool, int64_t threshold = kHugePageSize,
+                              bool prefault = false, bool use_hugetlb = false);
+  ~HugePageMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of allocations served from huge pages
+  int64_t num_huge_page_allocations() const;
+
+  /// The number of allocations above the threshold delegated to the backing
+  /// pool because huge pages were unavailable
+  int64_t num_fallbacks() const;
+
+  /// The number of bytes currently mapped for huge page allocations
+  int64_t bytes_mapped() const;
+
+ private:
+  class HugePageMemoryPoolImpl;
+  std::unique_ptr<HugePageMemoryPoolImpl> impl_;
+};
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
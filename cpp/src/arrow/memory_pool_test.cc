@@ -16,9 +16,15 @@
 // under the License.
 
 #include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/memory_pool_test.h"
 #include "arrow/status.h"
@@ -54,6 +60,37 @@ struct MimallocMemoryPoolFactory {
 };
 #endif
 
+struct CachingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static CachingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
+struct ArenaMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static std::shared_ptr<ArenaMemoryPool> pool =
+        ArenaMemoryPool::Make(system_memory_pool());
+    return pool.get();
+  }
+};
+
+struct TrackingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static std::shared_ptr<TrackingMemoryPool> root =
+        TrackingMemoryPool::Make("root", system_memory_pool());
+    static std::shared_ptr<TrackingMemoryPool> pool = root->MakeChild("child");
+    return pool.get();
+  }
+};
+
+struct HugePageMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static HugePageMemoryPool pool(system_memory_pool(), /*threshold=*/16);
+    return &pool;
+  }
+};
+
 template <typename Factory>
 class TestMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
@@ -76,6 +113,10 @@ REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_SUITE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Caching, TestMemoryPool, CachingMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Arena, TestMemoryPool, ArenaMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Tracking, TestMemoryPool, TrackingMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(HugePage, TestMemoryPool, HugePageMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -145,6 +186,497 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(CachingMemoryPool, CacheHits) {
+  ProxyMemoryPool backing(system_memory_pool());
+  uint8_t* data;
+  uint8_t* data2;
+  {
+    CachingMemoryPool pool(&backing, /*max_cached_size=*/256);
+    ASSERT_EQ(backing.backend_name(), pool.backend_name());
+
+    ASSERT_OK(pool.Allocate(100, &data));
+    ASSERT_EQ(0, pool.num_cache_hits());
+    ASSERT_EQ(1, pool.num_cache_misses());
+    // Small allocations are rounded up to a multiple of 64 bytes
+    ASSERT_EQ(100, pool.bytes_allocated());
+    ASSERT_EQ(128, backing.bytes_allocated());
+    pool.Free(data, 100);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(128, backing.bytes_allocated());
+
+    // Same size class
+    ASSERT_OK(pool.Allocate(120, &data2));
+    ASSERT_EQ(data, data2);
+    ASSERT_EQ(1, pool.num_cache_hits());
+    ASSERT_EQ(1, pool.num_cache_misses());
+
+    // Other size class
+    ASSERT_OK(pool.Allocate(200, &data));
+    ASSERT_NE(data, data2);
+    ASSERT_EQ(1, pool.num_cache_hits());
+    ASSERT_EQ(2, pool.num_cache_misses());
+    ASSERT_EQ(320, pool.bytes_allocated());
+    pool.Free(data, 200);
+    pool.Free(data2, 120);
+
+    // Large allocations aren't cached
+    ASSERT_OK(pool.Allocate(1000, &data));
+    ASSERT_EQ(1, pool.num_cache_hits());
+    ASSERT_EQ(2, pool.num_cache_misses());
+    ASSERT_EQ(1000 + 128 + 256, backing.bytes_allocated());
+    pool.Free(data, 1000);
+    ASSERT_EQ(128 + 256, backing.bytes_allocated());
+    ASSERT_EQ(1000, pool.max_memory());
+  }
+  // Cached buffers are released along with the pool
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
+TEST(CachingMemoryPool, Reallocate) {
+  ProxyMemoryPool backing(system_memory_pool());
+  CachingMemoryPool pool(&backing, /*max_cached_size=*/256);
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(10, &data));
+  data[0] = 35;
+  data[9] = 12;
+  uint8_t* original = data;
+
+  // Within the same size class
+  ASSERT_OK(pool.Reallocate(10, 60, &data));
+  ASSERT_EQ(original, data);
+  ASSERT_EQ(60, pool.bytes_allocated());
+
+  // To another size class
+  ASSERT_OK(pool.Reallocate(60, 130, &data));
+  ASSERT_EQ(data[0], 35);
+  ASSERT_EQ(data[9], 12);
+  ASSERT_EQ(130, pool.bytes_allocated());
+  ASSERT_EQ(64 + 192, backing.bytes_allocated());
+
+  // Beyond the cached sizes, and back
+  ASSERT_OK(pool.Reallocate(130, 1000, &data));
+  ASSERT_EQ(data[9], 12);
+  ASSERT_OK(pool.Reallocate(1000, 5, &data));
+  ASSERT_EQ(data[0], 35);
+  ASSERT_EQ(5, pool.bytes_allocated());
+
+  pool.Free(data, 5);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(CachingMemoryPool, MaxCachedBuffers) {
+  ProxyMemoryPool backing(system_memory_pool());
+  CachingMemoryPool pool(&backing, /*max_cached_size=*/256, /*max_cached_buffers=*/1);
+
+  uint8_t* data;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(64, &data));
+  ASSERT_OK(pool.Allocate(64, &data2));
+  pool.Free(data, 64);
+  pool.Free(data2, 64);
+  ASSERT_EQ(64, backing.bytes_allocated());
+}
+
+TEST(CachingMemoryPool, Threads) {
+  ProxyMemoryPool backing(system_memory_pool());
+  CachingMemoryPool pool(&backing);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&pool]() {
+      for (int j = 0; j < 100; ++j) {
+        uint8_t* data;
+        ASSERT_OK(pool.Allocate(j * 8, &data));
+        pool.Free(data, j * 8);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_GT(pool.num_cache_hits(), 0);
+  // Cached buffers are released when their thread exits
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
+TEST(CachingMemoryPool, ManyPools) {
+  // A thread drops the caches of destroyed pools, but keeps those of live pools
+  ProxyMemoryPool backing(system_memory_pool());
+  CachingMemoryPool live_pool(&backing);
+  uint8_t* data;
+  ASSERT_OK(live_pool.Allocate(64, &data));
+  live_pool.Free(data, 64);
+
+  for (int i = 0; i < 1000; ++i) {
+    CachingMemoryPool pool(&backing);
+    ASSERT_OK(pool.Allocate(64, &data));
+    pool.Free(data, 64);
+  }
+  ASSERT_EQ(64, backing.bytes_allocated());
+
+  ASSERT_OK(live_pool.Allocate(64, &data));
+  ASSERT_EQ(1, live_pool.num_cache_hits());
+  live_pool.Free(data, 64);
+}
+
+TEST(ArenaMemoryPool, BumpAllocation) {
+  ProxyMemoryPool backing(system_memory_pool());
+  {
+    auto pool = ArenaMemoryPool::Make(&backing, /*region_size=*/1024);
+    ASSERT_EQ(backing.backend_name(), pool->backend_name());
+
+    uint8_t* data;
+    uint8_t* data2;
+    uint8_t* data3;
+    ASSERT_OK(pool->Allocate(100, &data));
+    ASSERT_EQ(1024, backing.bytes_allocated());
+    ASSERT_EQ(1024, pool->bytes_reserved());
+    // Allocations are padded to a multiple of 64 bytes
+    ASSERT_OK(pool->Allocate(10, &data2));
+    ASSERT_EQ(data + 128, data2);
+    ASSERT_EQ(110, pool->bytes_allocated());
+
+    // Freeing the most recent allocation makes its space available
+    pool->Free(data2, 10);
+    ASSERT_OK(pool->Allocate(64, &data2));
+    ASSERT_EQ(data + 128, data2);
+
+    // Large allocations get a region of their own
+    ASSERT_OK(pool->Allocate(1000, &data3));
+    ASSERT_EQ(1024 + 1024, backing.bytes_allocated());
+    pool->Free(data3, 1000);
+    ASSERT_EQ(1024, backing.bytes_allocated());
+
+    // A new region is started once the current one is full
+    uint8_t* data4;
+    ASSERT_OK(pool->Allocate(500, &data3));
+    ASSERT_EQ(data + 192, data3);
+    ASSERT_OK(pool->Allocate(400, &data4));
+    ASSERT_EQ(2048, backing.bytes_allocated());
+    // ... and the previous region is returned once its allocations are freed
+    pool->Free(data, 100);
+    pool->Free(data2, 64);
+    ASSERT_EQ(2048, backing.bytes_allocated());
+    pool->Free(data3, 500);
+    ASSERT_EQ(1024, backing.bytes_allocated());
+    pool->Free(data4, 400);
+    ASSERT_EQ(0, pool->bytes_allocated());
+    ASSERT_EQ(1164, pool->max_memory());
+
+    // The current region is kept for reuse
+    ASSERT_EQ(1024, backing.bytes_allocated());
+    ASSERT_OK(pool->Allocate(0, &data));
+    pool->Free(data, 0);
+  }
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, Reallocate) {
+  ProxyMemoryPool backing(system_memory_pool());
+  auto pool = ArenaMemoryPool::Make(&backing, /*region_size=*/1024);
+
+  uint8_t* data;
+  uint8_t* data2;
+  ASSERT_OK(pool->Allocate(10, &data));
+  data[0] = 35;
+  data[9] = 12;
+  uint8_t* original = data;
+
+  // The most recent allocation is resized in place
+  ASSERT_OK(pool->Reallocate(10, 200, &data));
+  ASSERT_EQ(original, data);
+  ASSERT_OK(pool->Reallocate(200, 100, &data));
+  ASSERT_EQ(original, data);
+  ASSERT_OK(pool->Allocate(10, &data2));
+  ASSERT_EQ(original + 128, data2);
+
+  // Other allocations are moved
+  ASSERT_OK(pool->Reallocate(100, 300, &data));
+  ASSERT_EQ(original + 192, data);
+  ASSERT_EQ(data[0], 35);
+  ASSERT_EQ(data[9], 12);
+  ASSERT_EQ(310, pool->bytes_allocated());
+
+  // Beyond the region size, and back
+  ASSERT_OK(pool->Reallocate(300, 5000, &data));
+  ASSERT_EQ(data[9], 12);
+  ASSERT_EQ(1024 + 5056, backing.bytes_allocated());
+  // Alone in its region, which is resized
+  ASSERT_OK(pool->Reallocate(5000, 10000, &data));
+  ASSERT_EQ(1024 + 10048, backing.bytes_allocated());
+  ASSERT_OK(pool->Reallocate(10000, 5, &data));
+  ASSERT_EQ(data[0], 35);
+  ASSERT_EQ(15, pool->bytes_allocated());
+
+  ASSERT_OK(pool->Reallocate(5, 0, &data));
+  pool->Free(data, 0);
+  pool->Free(data2, 10);
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(1024, backing.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, OutlivingBuffers) {
+  ProxyMemoryPool backing(system_memory_pool());
+  std::shared_ptr<Buffer> buffer;
+  std::weak_ptr<ArenaMemoryPool> weak_pool;
+  {
+    auto pool = ArenaMemoryPool::Make(&backing);
+    weak_pool = pool;
+    ASSERT_OK_AND_ASSIGN(buffer, AllocateBuffer(128, pool.get()));
+    std::memset(buffer->mutable_data(), 42, 128);
+  }
+  // The arena is kept alive by the buffer allocated from it
+  ASSERT_FALSE(weak_pool.expired());
+  ASSERT_EQ(128, weak_pool.lock()->bytes_allocated());
+  ASSERT_EQ(42, buffer->data()[127]);
+  buffer.reset();
+  ASSERT_TRUE(weak_pool.expired());
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, Threads) {
+  ProxyMemoryPool backing(system_memory_pool());
+  auto pool = ArenaMemoryPool::Make(&backing, /*region_size=*/4096);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&pool]() {
+      for (int j = 0; j < 100; ++j) {
+        uint8_t* data;
+        ASSERT_OK(pool->Allocate(j * 8, &data));
+        ASSERT_OK(pool->Reallocate(j * 8, j * 16, &data));
+        pool->Free(data, j * 16);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(pool->bytes_reserved(), backing.bytes_allocated());
+}
+
+TEST(TrackingMemoryPool, Hierarchy) {
+  ProxyMemoryPool backing(system_memory_pool());
+  auto root = TrackingMemoryPool::Make("query", &backing);
+  ASSERT_EQ("query", root->name());
+  ASSERT_EQ(nullptr, root->parent());
+  ASSERT_EQ(TrackingMemoryPool::kNoLimit, root->limit());
+  ASSERT_EQ(backing.backend_name(), root->backend_name());
+
+  auto reader = root->MakeChild("reader");
+  auto kernel = root->MakeChild("kernel");
+  ASSERT_EQ(root, reader->parent());
+  ASSERT_EQ(backing.backend_name(), reader->backend_name());
+  ASSERT_EQ(2, root->children().size());
+  ASSERT_EQ(reader, root->children()[0]);
+
+  uint8_t* data;
+  uint8_t* data2;
+  ASSERT_OK(reader->Allocate(100, &data));
+  ASSERT_OK(kernel->Allocate(200, &data2));
+  ASSERT_EQ(100, reader->bytes_allocated());
+  ASSERT_EQ(200, kernel->bytes_allocated());
+  ASSERT_EQ(300, root->bytes_allocated());
+  ASSERT_EQ(300, backing.bytes_allocated());
+
+  ASSERT_OK(reader->Reallocate(100, 50, &data));
+  ASSERT_EQ(50, reader->bytes_allocated());
+  ASSERT_EQ(100, reader->max_memory());
+  ASSERT_EQ(250, root->bytes_allocated());
+  ASSERT_EQ(300, root->max_memory());
+
+  reader->Free(data, 50);
+  kernel->Free(data2, 200);
+  ASSERT_EQ(0, root->bytes_allocated());
+  ASSERT_EQ(0, backing.bytes_allocated());
+  ASSERT_EQ(1, reader->num_allocations());
+  ASSERT_EQ(1, kernel->num_allocations());
+  ASSERT_EQ(2, root->num_allocations());
+
+  ASSERT_EQ(
+      "query: 0 bytes allocated, 300 peak, 2 allocations\n"
+      "  reader: 0 bytes allocated, 100 peak, 1 allocations\n"
+      "  kernel: 0 bytes allocated, 200 peak, 1 allocations\n",
+      root->ToString());
+
+  // Children are only reported while alive, and keep their parent alive
+  std::weak_ptr<TrackingMemoryPool> weak_root = root;
+  kernel.reset();
+  root.reset();
+  ASSERT_FALSE(weak_root.expired());
+  ASSERT_EQ(1, weak_root.lock()->children().size());
+  reader.reset();
+  ASSERT_TRUE(weak_root.expired());
+}
+
+TEST(TrackingMemoryPool, Limit) {
+  ProxyMemoryPool backing(system_memory_pool());
+  auto root = TrackingMemoryPool::Make("query", &backing, /*limit=*/1000);
+  auto reader = root->MakeChild("reader", /*limit=*/600);
+  auto kernel = root->MakeChild("kernel");
+  ASSERT_EQ(1000, root->limit());
+  ASSERT_EQ(600, reader->limit());
+
+  uint8_t* data;
+  uint8_t* data2;
+  uint8_t* data3;
+  ASSERT_OK(reader->Allocate(600, &data));
+  // The limit of the child is hit
+  ASSERT_RAISES(OutOfMemory, reader->Allocate(1, &data2));
+  ASSERT_RAISES(OutOfMemory, reader->Reallocate(600, 601, &data));
+  // The limit of the parent is hit, without going to the backing pool
+  ASSERT_OK(kernel->Allocate(300, &data2));
+  ASSERT_RAISES(OutOfMemory, kernel->Allocate(101, &data3));
+  ASSERT_RAISES(OutOfMemory, root->Allocate(101, &data3));
+  ASSERT_EQ(900, backing.bytes_allocated());
+  ASSERT_EQ(300, kernel->bytes_allocated());
+  ASSERT_EQ(300, kernel->max_memory());
+  ASSERT_EQ(900, root->bytes_allocated());
+  ASSERT_EQ(900, root->max_memory());
+  ASSERT_EQ(2, root->num_allocations());
+
+  // Allocations succeed again once memory is freed
+  ASSERT_OK(reader->Reallocate(600, 200, &data));
+  ASSERT_OK(kernel->Reallocate(300, 800, &data2));
+  ASSERT_EQ(1000, root->bytes_allocated());
+  ASSERT_EQ(
+      "query: 1000 bytes allocated, 1000 peak, 2 allocations, limit 1000\n"
+      "  reader: 200 bytes allocated, 600 peak, 1 allocations, limit 600\n"
+      "  kernel: 800 bytes allocated, 800 peak, 1 allocations\n",
+      root->ToString());
+
+  reader->Free(data, 200);
+  kernel->Free(data2, 800);
+  ASSERT_EQ(0, root->bytes_allocated());
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
+TEST(TrackingMemoryPool, Buffers) {
+  auto root = TrackingMemoryPool::Make("query", system_memory_pool(), /*limit=*/4096);
+  auto child = root->MakeChild("reader");
+  {
+    ASSERT_OK_AND_ASSIGN(auto buffer, AllocateResizableBuffer(1000, child.get()));
+    ASSERT_EQ(1024, child->bytes_allocated());
+    ASSERT_RAISES(OutOfMemory, buffer->Resize(5000));
+    ASSERT_OK(buffer->Resize(3000));
+    ASSERT_EQ(3008, root->bytes_allocated());
+    ASSERT_RAISES(OutOfMemory, AllocateBuffer(2000, child.get()));
+  }
+  ASSERT_EQ(0, root->bytes_allocated());
+  ASSERT_EQ(3008, root->max_memory());
+}
+
+TEST(TrackingMemoryPool, Threads) {
+  ProxyMemoryPool backing(system_memory_pool());
+  auto root = TrackingMemoryPool::Make("query", &backing, /*limit=*/4 * 1024);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&root, i]() {
+      auto pool = root->MakeChild("thread " + std::to_string(i));
+      for (int j = 0; j < 100; ++j) {
+        uint8_t* data;
+        if (pool->Allocate(j * 8, &data).ok()) {
+          if (pool->Reallocate(j * 8, j * 16, &data).ok()) {
+            pool->Free(data, j * 16);
+          } else {
+            pool->Free(data, j * 8);
+          }
+        }
+        ASSERT_LE(root->bytes_allocated(), 4 * 1024);
+      }
+      ASSERT_EQ(0, pool->bytes_allocated());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, root->bytes_allocated());
+  ASSERT_LE(root->max_memory(), 4 * 1024);
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
+TEST(HugePageMemoryPool, LargeAllocations) {
+  ProxyMemoryPool backing(system_memory_pool());
+  HugePageMemoryPool pool(&backing, /*threshold=*/1 << 20, /*prefault=*/true);
+  const int64_t huge_page_size = HugePageMemoryPool::kHugePageSize;
+
+  uint8_t* small;
+  ASSERT_OK(pool.Allocate(1000, &small));
+  ASSERT_EQ(1000, backing.bytes_allocated());
+  ASSERT_EQ(0, pool.num_huge_page_allocations());
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(3 << 20, &data));
+  ASSERT_EQ(static_cast<uintptr_t>(0), reinterpret_cast<uintptr_t>(data) % 64);
+  ASSERT_EQ(1000 + (3 << 20), pool.bytes_allocated());
+  ASSERT_EQ(1000, backing.bytes_allocated());
+  ASSERT_EQ(0, pool.num_fallbacks());
+#ifdef __linux__
+  ASSERT_EQ(1, pool.num_huge_page_allocations());
+  ASSERT_EQ(2 * huge_page_size, pool.bytes_mapped());
+#endif
+  data[0] = 35;
+  data[(3 << 20) - 1] = 12;
+
+  // Grow the mapping
+  ASSERT_OK(pool.Reallocate(3 << 20, 5 << 20, &data));
+  ASSERT_EQ(35, data[0]);
+  ASSERT_EQ(12, data[(3 << 20) - 1]);
+  data[(5 << 20) - 1] = 7;
+  ASSERT_EQ(1000 + (5 << 20), pool.bytes_allocated());
+  ASSERT_EQ(1000, backing.bytes_allocated());
+#ifdef __linux__
+  ASSERT_EQ(3 * huge_page_size, pool.bytes_mapped());
+#endif
+
+  // Shrink below the threshold: the data moves to the backing pool
+  ASSERT_OK(pool.Reallocate(5 << 20, 100, &data));
+  ASSERT_EQ(35, data[0]);
+  ASSERT_EQ(1100, backing.bytes_allocated());
+  ASSERT_EQ(0, pool.bytes_mapped());
+
+  // Grow above the threshold again
+  ASSERT_OK(pool.Reallocate(100, 2 << 20, &data));
+  ASSERT_EQ(35, data[0]);
+  ASSERT_EQ(1000, backing.bytes_allocated());
+
+  pool.Free(data, 2 << 20);
+  pool.Free(small, 1000);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(0, pool.bytes_mapped());
+  ASSERT_EQ(0, backing.bytes_allocated());
+  // Both copies of the data were allocated while moving it to the backing pool
+  ASSERT_EQ(1100 + (5 << 20), pool.max_memory());
+}
+
+TEST(HugePageMemoryPool, Fallback) {
+  ProxyMemoryPool backing(system_memory_pool());
+  HugePageMemoryPool pool(&backing, /*threshold=*/1 << 20);
+
+#ifndef ADDRESS_SANITIZER
+  // Too large to be mapped, so the allocation goes to the backing pool
+  uint8_t* data;
+  ASSERT_RAISES(OutOfMemory,
+                pool.Allocate(std::numeric_limits<int64_t>::max() - 63, &data));
+  ASSERT_EQ(1, pool.num_fallbacks());
+  ASSERT_EQ(0, pool.bytes_allocated());
+#endif
+
+  // Buffers are served transparently either way
+  {
+    ASSERT_OK_AND_ASSIGN(auto buffer, AllocateResizableBuffer(1000, &pool));
+    ASSERT_OK(buffer->Resize(4 << 20));
+    buffer->mutable_data()[(4 << 20) - 1] = 1;
+    ASSERT_OK(buffer->Resize(2000));
+  }
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
@@ -21,6 +21,7 @@
 
 #include "arrow/python/arrow_to_pandas.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
@@ -37,6 +38,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
@@ -805,6 +807,33 @@ inline void ConvertNumericNullableCast(const ChunkedArray& data, InType na_value
   }
 }
 
+// Columns are split into slices of at least this many rows to be converted in
+// parallel
+static constexpr int64_t kMinParallelSliceLength = 1 << 16;
+
+// Call convert(slice, out_values + offset) for slices of data covering it, in
+// parallel on the CPU thread pool if options.use_threads is set and data is
+// long enough, otherwise once for the whole of data
+template <typename OutType, typename ConvertFunction>
+Status ConvertSlices(const PandasOptions& options,
+                     const std::shared_ptr<ChunkedArray>& data, OutType* out_values,
+                     ConvertFunction&& convert) {
+  const int64_t length = data->length();
+  const int64_t num_slices =
+      std::min<int64_t>(internal::GetCpuThreadPool()->GetCapacity(),
+                        length / kMinParallelSliceLength);
+  if (!options.use_threads || num_slices < 2) {
+    return convert(data, out_values);
+  }
+
+  const int64_t slice_length = BitUtil::CeilDiv(length, num_slices);
+  auto ConvertSlice = [&](int i) {
+    const int64_t offset = i * slice_length;
+    return convert(data->Slice(offset, slice_length), out_values + offset);
+  };
+  return internal::ParallelFor(static_cast<int>(num_slices), ConvertSlice);
+}
+
 template <int NPY_TYPE>
 class TypedPandasWriter : public PandasWriter {
  public:
@@ -1009,6 +1038,7 @@ class IntWriter : public TypedPandasWriter<NPY_TYPE> {
  public:
   using ArrowType = typename npy_traits<NPY_TYPE>::TypeClass;
   using TypedPandasWriter<NPY_TYPE>::TypedPandasWriter;
+  using T = typename ArrowType::c_type;
 
   bool CanZeroCopy(const ChunkedArray& data) const override {
     return IsNonNullContiguous(data);
@@ -1016,9 +1046,12 @@ class IntWriter : public TypedPandasWriter<NPY_TYPE> {
 
   Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
     RETURN_NOT_OK(this->CheckTypeExact(*data->type(), ArrowType::type_id));
-    ConvertIntegerNoNullsSameType<typename ArrowType::c_type>(
-        this->options_, *data, this->GetBlockColumnStart(rel_placement));
-    return Status::OK();
+    return ConvertSlices(
+        this->options_, data, this->GetBlockColumnStart(rel_placement),
+        [this](const std::shared_ptr<ChunkedArray>& slice, T* out_values) {
+          ConvertIntegerNoNullsSameType<T>(this->options_, *slice, out_values);
+          return Status::OK();
+        });
   }
 };
 
@@ -1034,11 +1067,19 @@ class FloatWriter : public TypedPandasWriter<NPY_TYPE> {
   }
 
   Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
-    Type::type in_type = data->type()->id();
-    auto out_values = this->GetBlockColumnStart(rel_placement);
+    return ConvertSlices(
+        this->options_, data, this->GetBlockColumnStart(rel_placement),
+        [this](const std::shared_ptr<ChunkedArray>& slice, T* out_values) {
+          return CopySlice(*slice, out_values);
+        });
+  }
+
+ private:
+  Status CopySlice(const ChunkedArray& data, T* out_values) {
+    Type::type in_type = data.type()->id();
 
-#define INTEGER_CASE(IN_TYPE)                                             \
-  ConvertIntegerWithNulls<IN_TYPE, T>(this->options_, *data, out_values); \
+#define INTEGER_CASE(IN_TYPE)                                            \
+  ConvertIntegerWithNulls<IN_TYPE, T>(this->options_, data, out_values); \
   break;
 
     switch (in_type) {
@@ -1059,16 +1100,17 @@ class FloatWriter : public TypedPandasWriter<NPY_TYPE> {
       case Type::INT64:
         INTEGER_CASE(int64_t);
       case Type::HALF_FLOAT:
-        ConvertNumericNullableCast(*data, npy_traits<NPY_TYPE>::na_sentinel, out_values);
+        ConvertNumericNullableCast(data, npy_traits<NPY_TYPE>::na_sentinel, out_values);
+        break;
       case Type::FLOAT:
-        ConvertNumericNullableCast(*data, npy_traits<NPY_TYPE>::na_sentinel, out_values);
+        ConvertNumericNullableCast(data, npy_traits<NPY_TYPE>::na_sentinel, out_values);
         break;
       case Type::DOUBLE:
-        ConvertNumericNullableCast(*data, npy_traits<NPY_TYPE>::na_sentinel, out_values);
+        ConvertNumericNullableCast(data, npy_traits<NPY_TYPE>::na_sentinel, out_values);
         break;
       default:
         return Status::NotImplemented("Cannot write Arrow data of type ",
-                                      data->type()->ToString(),
+                                      data.type()->ToString(),
                                       " to a Pandas floating point block");
     }
 
@@ -1187,9 +1229,12 @@ class DatetimeWriter : public TypedPandasWriter<NPY_DATETIME> {
     const auto& ts_type = checked_cast<const TimestampType&>(*data->type());
     DCHECK_EQ(UNIT, ts_type.unit()) << "Should only call instances of this writer "
                                     << "with arrays of the correct unit";
-    ConvertNumericNullable<int64_t>(*data, kPandasTimestampNull,
-                                    this->GetBlockColumnStart(rel_placement));
-    return Status::OK();
+    return ConvertSlices(
+        this->options_, data, this->GetBlockColumnStart(rel_placement),
+        [](const std::shared_ptr<ChunkedArray>& slice, int64_t* out_values) {
+          ConvertNumericNullable<int64_t>(*slice, kPandasTimestampNull, out_values);
+          return Status::OK();
+        });
   }
 
  protected:
@@ -1209,8 +1254,19 @@ class DatetimeNanoWriter : public DatetimeWriter<TimeUnit::NANO> {
   using DatetimeWriter<TimeUnit::NANO>::DatetimeWriter;
 
   Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
-    Type::type type = data->type()->id();
-    int64_t* out_values = this->GetBlockColumnStart(rel_placement);
+    // Slices are cast independently, so that the cast of long columns is
+    // parallelized as well
+    return ConvertSlices(
+        options_, data, this->GetBlockColumnStart(rel_placement),
+        [this](const std::shared_ptr<ChunkedArray>& slice, int64_t* out_values) {
+          return CopySlice(slice, out_values);
+        });
+  }
+
+ private:
+  Status CopySlice(const std::shared_ptr<ChunkedArray>& slice, int64_t* out_values) {
+    const ChunkedArray& data = *slice;
+    Type::type type = data.type()->id();
     compute::FunctionContext ctx(options_.pool);
     compute::CastOptions options;
     if (options_.safe_cast) {
@@ -1223,20 +1279,20 @@ class DatetimeNanoWriter : public DatetimeWriter<TimeUnit::NANO> {
 
     if (type == Type::DATE32) {
       // Convert from days since epoch to datetime64[ns]
-      ConvertDatetimeLikeNanos<int32_t, kNanosecondsInDay>(*data, out_values);
+      ConvertDatetimeLikeNanos<int32_t, kNanosecondsInDay>(data, out_values);
     } else if (type == Type::DATE64) {
       // Date64Type is millisecond timestamp stored as int64_t
       // TODO(wesm): Do we want to make sure to zero out the milliseconds?
-      ConvertDatetimeLikeNanos<int64_t, 1000000L>(*data, out_values);
+      ConvertDatetimeLikeNanos<int64_t, 1000000L>(data, out_values);
     } else if (type == Type::TIMESTAMP) {
-      const auto& ts_type = checked_cast<const TimestampType&>(*data->type());
+      const auto& ts_type = checked_cast<const TimestampType&>(*data.type());
 
       if (ts_type.unit() == TimeUnit::NANO) {
-        ConvertNumericNullable<int64_t>(*data, kPandasTimestampNull, out_values);
+        ConvertNumericNullable<int64_t>(data, kPandasTimestampNull, out_values);
       } else if (ts_type.unit() == TimeUnit::MICRO || ts_type.unit() == TimeUnit::MILLI ||
                  ts_type.unit() == TimeUnit::SECOND) {
-        RETURN_NOT_OK(
-            arrow::compute::Cast(&ctx, compute::Datum(data), target_type, options, &out));
+        RETURN_NOT_OK(arrow::compute::Cast(&ctx, compute::Datum(slice), target_type,
+                                           options, &out));
         ConvertNumericNullable<int64_t>(*out.chunked_array(), kPandasTimestampNull,
                                         out_values);
       } else {
@@ -1244,7 +1300,7 @@ class DatetimeNanoWriter : public DatetimeWriter<TimeUnit::NANO> {
       }
     } else {
       return Status::NotImplemented("Cannot write Arrow data of type ",
-                                    data->type()->ToString(),
+                                    data.type()->ToString(),
                                     " to a Pandas datetime block.");
     }
     return Status::OK();
@@ -1292,9 +1348,12 @@ class TimedeltaWriter : public TypedPandasWriter<NPY_TIMEDELTA> {
     const auto& type = checked_cast<const DurationType&>(*data->type());
     DCHECK_EQ(UNIT, type.unit()) << "Should only call instances of this writer "
                                  << "with arrays of the correct unit";
-    ConvertNumericNullable<int64_t>(*data, kPandasTimestampNull,
-                                    this->GetBlockColumnStart(rel_placement));
-    return Status::OK();
+    return ConvertSlices(
+        this->options_, data, this->GetBlockColumnStart(rel_placement),
+        [](const std::shared_ptr<ChunkedArray>& slice, int64_t* out_values) {
+          ConvertNumericNullable<int64_t>(*slice, kPandasTimestampNull, out_values);
+          return Status::OK();
+        });
   }
 
  protected:
@@ -1853,7 +1912,14 @@ class ConsolidatedBlockCreator : public PandasBlockCreator {
     }
   }
 
+  // Columns are written in parallel if there are several of them, otherwise the
+  // writer parallelizes the conversion of the single column
+  bool ParallelizeColumns() const { return options_.use_threads && num_columns_ > 1; }
+
   Status CreateBlocks() {
+    PandasOptions writer_options = options_;
+    writer_options.use_threads = options_.use_threads && !ParallelizeColumns();
+
     for (int i = 0; i < num_columns_; ++i) {
       const DataType& type = *arrays_[i]->type();
       PandasWriter::type output_type;
@@ -1864,7 +1930,7 @@ class ConsolidatedBlockCreator : public PandasBlockCreator {
       if (output_type == PandasWriter::CATEGORICAL ||
           output_type == PandasWriter::DATETIME_NANO_TZ ||
           output_type == PandasWriter::EXTENSION) {
-        RETURN_NOT_OK(MakeWriter(options_, output_type, type, num_rows_,
+        RETURN_NOT_OK(MakeWriter(writer_options, output_type, type, num_rows_,
                                  /*num_columns=*/1, &writer));
         singleton_blocks_[i] = writer;
       } else {
@@ -1886,7 +1952,7 @@ class ConsolidatedBlockCreator : public PandasBlockCreator {
     for (const auto& it : this->block_sizes_) {
       PandasWriter::type output_type = static_cast<PandasWriter::type>(it.first);
       std::shared_ptr<PandasWriter> block;
-      RETURN_NOT_OK(MakeWriter(this->options_, output_type, /*unused*/ *null(), num_rows_,
+      RETURN_NOT_OK(MakeWriter(writer_options, output_type, /*unused*/ *null(), num_rows_,
                                it.second, &block));
       this->blocks_[output_type] = block;
     }
@@ -1924,7 +1990,7 @@ class ConsolidatedBlockCreator : public PandasBlockCreator {
       return block->Write(std::move(arrays_[i]), i, this->column_block_placement_[i]);
     };
 
-    return OptionalParallelFor(options_.use_threads, num_columns_, WriteColumn);
+    return OptionalParallelFor(ParallelizeColumns(), num_columns_, WriteColumn);
   }
 
  private:
@@ -50,6 +50,10 @@ struct PandasOptions {
   bool zero_copy_only = false;
   bool integer_object_nulls = false;
   bool date_as_object = false;
+
+  /// \brief If true, use the CPU thread pool: the columns of a table are
+  /// written in parallel, or, for a single column or with split_blocks, long
+  /// numeric and temporal columns are converted (and cast) in parallel slices
   bool use_threads = false;
 
   /// Coerce all date and timestamp to datetime64[ns]
@@ -1283,6 +1283,62 @@ Status ConvertToSequenceAndInferSize(PyObject* obj, PyObject** seq, int64_t* siz
   return Status::OK();
 }
 
+// Type inference stops at the first value of most kinds, but has to visit all
+// the values of a sequence of integers, as a float may follow. Such sequences
+// are instead converted in a single pass, speculating that they are int64, as
+// inferred if all the non-null values are integers. *out is set to null if
+// the speculation fails, i.e. some value isn't an integer or null (with the
+// inference's null convention) or fails to convert, or no value is an integer.
+Status ConvertIntegersSpeculatively(PyObject* seq, PyObject* mask, int64_t size,
+                                    const PyConversionOptions& options,
+                                    std::shared_ptr<ChunkedArray>* out) {
+  *out = nullptr;
+
+  std::unique_ptr<SeqConverter> converter;
+  RETURN_NOT_OK(GetConverter(int64(), options.from_pandas,
+                             /*strict_conversions=*/false, &converter));
+  std::unique_ptr<ArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(options.pool, int64(), &builder));
+  RETURN_NOT_OK(converter->Init(builder.get()));
+  RETURN_NOT_OK(builder->Reserve(size));
+
+  bool speculating = true;
+  bool has_integers = false;
+  auto Append = [&](PyObject* obj, bool masked, bool* keep_going) {
+    if (masked) {
+      return builder->AppendNull();
+    }
+    if (obj != Py_None && !(options.from_pandas && internal::PyFloat_IsNaN(obj))) {
+      if (PyBool_Check(obj) || !internal::IsPyInteger(obj)) {
+        speculating = *keep_going = false;
+        return Status::OK();
+      }
+      has_integers = true;
+    }
+    if (!converter->AppendSingleVirtual(obj).ok()) {
+      // Let the regular conversion report the error, if any
+      speculating = *keep_going = false;
+    }
+    return Status::OK();
+  };
+
+  if (mask != nullptr && mask != Py_None) {
+    RETURN_NOT_OK(internal::VisitSequenceMasked(
+        seq, mask, [&](PyObject* obj, uint8_t masked, bool* keep_going) {
+          return Append(obj, masked != 0, keep_going);
+        }));
+  } else {
+    RETURN_NOT_OK(internal::VisitSequence(seq, [&](PyObject* obj, bool* keep_going) {
+      return Append(obj, false, keep_going);
+    }));
+  }
+
+  if (speculating && has_integers) {
+    return converter->GetResult(out);
+  }
+  return Status::OK();
+}
+
 Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
                          const PyConversionOptions& options,
                          std::shared_ptr<ChunkedArray>* out) {
@@ -1303,6 +1359,10 @@ Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
   bool strict_conversions = false;
 
   if (options.type == nullptr) {
+    RETURN_NOT_OK(ConvertIntegersSpeculatively(seq, mask, size, options, out));
+    if (*out != nullptr) {
+      return Status::OK();
+    }
     RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas, &real_type));
   } else {
     real_type = options.type;
@@ -20,22 +20,30 @@
 #include <algorithm>
 #include <atomic>
 #include <cstdlib>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include "arrow/array.h"
 #include "arrow/array/validate.h"
+#include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/atomic_shared_ptr.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
 
+using internal::checked_cast;
+
 Result<std::shared_ptr<RecordBatch>> RecordBatch::AddColumn(
     int i, std::string field_name, const std::shared_ptr<Array>& column) const {
   auto field = ::arrow::field(std::move(field_name), column->type());
@@ -196,6 +204,226 @@ Result<std::shared_ptr<Array>> RecordBatch::ToStructArray() const {
   return StructArray::Make(columns(), schema()->fields());
 }
 
+namespace {
+
+// The type of the tensor of a batch, see RecordBatch::ToTensor()
+Result<std::shared_ptr<DataType>> TensorType(const RecordBatch& batch, bool has_nulls) {
+  const auto& first_type = batch.column_data(0)->type;
+  bool all_same = true;
+  bool any_floating = false;
+  bool all_small = true;
+  int signed_bits = 0;
+  int unsigned_bits = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    const auto& type = batch.column_data(i)->type;
+    if (!is_integer(type->id()) &&
+        (!is_floating(type->id()) || type->id() == Type::HALF_FLOAT)) {
+      return Status::TypeError("Can only convert record batches of integer or ",
+                               "floating point columns to a tensor, got ", *type);
+    }
+    const int bits = checked_cast<const FixedWidthType&>(*type).bit_width();
+    if (is_floating(type->id())) {
+      any_floating = true;
+    } else if (checked_cast<const IntegerType&>(*type).is_signed()) {
+      signed_bits = std::max(signed_bits, bits);
+    } else {
+      unsigned_bits = std::max(unsigned_bits, bits);
+    }
+    all_same &= type->Equals(*first_type);
+    // float32 represents all values of integers up to 16 bits
+    all_small &= type->id() == Type::FLOAT || (!is_floating(type->id()) && bits <= 16);
+  }
+
+  if (all_same && (!has_nulls || is_floating(first_type->id()))) {
+    return first_type;
+  }
+  if (any_floating || has_nulls) {
+    return all_small ? float32() : float64();
+  }
+  // A signed type holding all the unsigned values needs twice their width
+  const int bits = signed_bits == 0 ? unsigned_bits
+                                    : std::max(signed_bits, 2 * unsigned_bits);
+  switch (bits) {
+    case 8:
+      return signed_bits == 0 ? uint8() : int8();
+    case 16:
+      return signed_bits == 0 ? uint16() : int16();
+    case 32:
+      return signed_bits == 0 ? uint32() : int32();
+    case 64:
+      return signed_bits == 0 ? uint64() : int64();
+    default:
+      return float64();
+  }
+}
+
+// Whether the values of the columns, of the same type and without nulls, lie
+// one after the other in a single buffer.  If so, that buffer is returned.
+std::shared_ptr<Buffer> ContiguousColumnsBuffer(const RecordBatch& batch,
+                                                int64_t byte_width) {
+  auto root_of = [](std::shared_ptr<Buffer> buffer) {
+    while (buffer->parent() != nullptr) {
+      buffer = buffer->parent();
+    }
+    return buffer;
+  };
+  auto values_of = [&](const ArrayData& column) {
+    return column.buffers[1]->data() + column.offset * byte_width;
+  };
+
+  const ArrayData& first = *batch.column_data(0);
+  const auto root = root_of(first.buffers[1]);
+  const uint8_t* start = values_of(first);
+  const int64_t column_size = batch.num_rows() * byte_width;
+  for (int i = 1; i < batch.num_columns(); ++i) {
+    const ArrayData& column = *batch.column_data(i);
+    if (root_of(column.buffers[1]) != root ||
+        values_of(column) != start + i * column_size) {
+      return nullptr;
+    }
+  }
+  if (start < root->data() ||
+      start + batch.num_columns() * column_size > root->data() + root->size()) {
+    return nullptr;
+  }
+  return SliceBuffer(root, start - root->data(), batch.num_columns() * column_size);
+}
+
+// Copy rows [begin, end) of a column into a column of a row-major tensor
+template <typename OutType, typename InType>
+void CopyColumnRows(const ArrayData& column, int64_t begin, int64_t end,
+                    int64_t row_stride, typename OutType::c_type* out) {
+  using OutCType = typename OutType::c_type;
+  const auto* values = column.GetValues<typename InType::c_type>(1);
+  out += begin * row_stride;
+  if (column.GetNullCount() == 0) {
+    for (int64_t i = begin; i < end; ++i, out += row_stride) {
+      *out = static_cast<OutCType>(values[i]);
+    }
+  } else {
+    // Only the floating point tensors of null_to_nan have nulls
+    internal::BitmapReader valid(column.buffers[0]->data(), column.offset + begin,
+                                 end - begin);
+    for (int64_t i = begin; i < end; ++i, out += row_stride) {
+      *out = valid.IsSet() ? static_cast<OutCType>(values[i])
+                           : std::numeric_limits<OutCType>::quiet_NaN();
+      valid.Next();
+    }
+  }
+}
+
+template <typename OutType>
+void CopyRows(const RecordBatch& batch, int64_t begin, int64_t end,
+              typename OutType::c_type* out) {
+  const int64_t row_stride = batch.num_columns();
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    const ArrayData& column = *batch.column_data(i);
+    auto column_out = out + i;
+
+#define COPY_COLUMN_CASE(InType)                                                 \
+  case InType::type_id:                                                          \
+    CopyColumnRows<OutType, InType>(column, begin, end, row_stride, column_out); \
+    break;
+
+    switch (column.type->id()) {
+      COPY_COLUMN_CASE(Int8Type)
+      COPY_COLUMN_CASE(Int16Type)
+      COPY_COLUMN_CASE(Int32Type)
+      COPY_COLUMN_CASE(Int64Type)
+      COPY_COLUMN_CASE(UInt8Type)
+      COPY_COLUMN_CASE(UInt16Type)
+      COPY_COLUMN_CASE(UInt32Type)
+      COPY_COLUMN_CASE(UInt64Type)
+      COPY_COLUMN_CASE(FloatType)
+      COPY_COLUMN_CASE(DoubleType)
+      default:
+        DCHECK(false) << "Unexpected column type " << *column.type;
+    }
+
+#undef COPY_COLUMN_CASE
+  }
+}
+
+// Size of the blocks of rows copied at once: each column writes into the
+// block, which stays in cache until all columns are written
+constexpr int64_t kTensorBlockBytes = 256 * 1024;
+
+template <typename OutType>
+Status CopyToRowMajor(const RecordBatch& batch, bool use_threads, uint8_t* data) {
+  auto out = reinterpret_cast<typename OutType::c_type*>(data);
+  const int64_t row_size = batch.num_columns() * sizeof(typename OutType::c_type);
+  const int64_t block_rows = std::max<int64_t>(1, kTensorBlockBytes / row_size);
+  const int64_t num_blocks = BitUtil::CeilDiv(batch.num_rows(), block_rows);
+  return internal::OptionalParallelFor(
+      use_threads && num_blocks > 1, static_cast<int>(num_blocks), [&](int block) {
+        const int64_t begin = block * block_rows;
+        CopyRows<OutType>(batch, begin, std::min(begin + block_rows, batch.num_rows()),
+                          out);
+        return Status::OK();
+      });
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor(bool null_to_nan, bool use_threads,
+                                                      MemoryPool* pool) const {
+  if (num_columns() == 0) {
+    return Status::TypeError("Cannot convert a record batch without columns to a tensor");
+  }
+  bool has_nulls = false;
+  for (int i = 0; i < num_columns(); ++i) {
+    has_nulls |= column_data(i)->GetNullCount() > 0;
+  }
+  if (has_nulls && !null_to_nan) {
+    return Status::Invalid("Cannot convert a record batch with nulls to a tensor ",
+                           "unless they are converted to NaN");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto type, TensorType(*this, has_nulls));
+  const int64_t byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const std::vector<int64_t> shape = {num_rows(), num_columns()};
+
+  bool all_same = !has_nulls;
+  for (int i = 0; i < num_columns() && all_same; ++i) {
+    all_same = column_data(i)->type->Equals(*type);
+  }
+  if (all_same && num_rows() > 0) {
+    auto data = ContiguousColumnsBuffer(*this, byte_width);
+    if (data != nullptr) {
+      return Tensor::Make(type, std::move(data), shape,
+                          {byte_width, num_rows() * byte_width});
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> data,
+                        AllocateBuffer(num_rows() * num_columns() * byte_width, pool));
+
+#define COPY_TO_ROW_MAJOR_CASE(OutType)                                     \
+  case OutType::type_id:                                                    \
+    RETURN_NOT_OK(                                                          \
+        CopyToRowMajor<OutType>(*this, use_threads, data->mutable_data())); \
+    break;
+
+  switch (type->id()) {
+    COPY_TO_ROW_MAJOR_CASE(Int8Type)
+    COPY_TO_ROW_MAJOR_CASE(Int16Type)
+    COPY_TO_ROW_MAJOR_CASE(Int32Type)
+    COPY_TO_ROW_MAJOR_CASE(Int64Type)
+    COPY_TO_ROW_MAJOR_CASE(UInt8Type)
+    COPY_TO_ROW_MAJOR_CASE(UInt16Type)
+    COPY_TO_ROW_MAJOR_CASE(UInt32Type)
+    COPY_TO_ROW_MAJOR_CASE(UInt64Type)
+    COPY_TO_ROW_MAJOR_CASE(FloatType)
+    COPY_TO_ROW_MAJOR_CASE(DoubleType)
+    default:
+      return Status::TypeError("Cannot convert a record batch of ", *type,
+                               " columns to a tensor");
+  }
+
+#undef COPY_TO_ROW_MAJOR_CASE
+
+  return Tensor::Make(type, std::move(data), shape);
+}
+
 std::vector<std::shared_ptr<Array>> RecordBatch::columns() const {
   std::vector<std::shared_ptr<Array>> children(num_columns());
   for (int i = 0; i < num_columns(); ++i) {
@@ -266,11 +494,9 @@ Status RecordBatch::Validate() const {
 
 Status RecordBatch::ValidateFull() const {
   RETURN_NOT_OK(Validate());
-  for (int i = 0; i < num_columns(); ++i) {
-    const auto& array = *this->column(i);
-    RETURN_NOT_OK(internal::ValidateArrayData(array));
-  }
-  return Status::OK();
+  return internal::OptionalParallelFor(
+      internal::ValidateInParallel(num_columns(), num_rows()), num_columns(),
+      [&](int i) { return internal::ValidateArrayData(*column(i)); });
 }
 
 // ----------------------------------------------------------------------
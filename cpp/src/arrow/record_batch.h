@@ -82,6 +82,28 @@ class ARROW_EXPORT RecordBatch {
   static Status FromStructArray(const std::shared_ptr<Array>& array,
                                 std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Convert record batch to a 2-dimensional tensor of shape
+  /// (num_rows, num_columns)
+  ///
+  /// The columns must be of integer or floating point types.  When they all
+  /// have the same type, no nulls and their values lie one after the other in
+  /// a single buffer (e.g. as read from an IPC message), the tensor is a
+  /// column-major view of that buffer.  Otherwise the values are copied into a
+  /// row-major tensor, one cache-sized block of rows at a time.
+  ///
+  /// The tensor has the type of the columns if they are all the same.
+  /// Otherwise integer columns are promoted to the smallest integer type
+  /// holding all their values, and to float32 or float64 when there are
+  /// floating point columns, nulls or no such integer type.
+  ///
+  /// \param[in] null_to_nan whether nulls are converted to NaN.  Otherwise a
+  ///            batch with nulls can't be converted.
+  /// \param[in] use_threads whether blocks of rows are copied in parallel
+  /// \param[in] pool the memory pool to allocate the tensor from
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      bool null_to_nan = false, bool use_threads = true,
+      MemoryPool* pool = default_memory_pool()) const;
+
   /// \brief Determine if two record batches are exactly equal
   ///
   /// \param[in] other the RecordBatch to compare with
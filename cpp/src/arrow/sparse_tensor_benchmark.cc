@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/buffer.h"
+#include "arrow/sparse_tensor.h"
+#include "arrow/tensor.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+constexpr int64_t kRows = 4096;
+constexpr int64_t kColumns = 1024;
+
+// A dense float64 matrix with about one non-zero in ten
+static std::shared_ptr<Tensor> MakeDenseMatrix() {
+  std::shared_ptr<Buffer> buffer = *AllocateBuffer(kRows * kColumns * sizeof(double));
+  auto values = reinterpret_cast<double*>(buffer->mutable_data());
+  std::default_random_engine gen(42);
+  std::uniform_real_distribution<double> dist(0, 1);
+  for (int64_t i = 0; i < kRows * kColumns; ++i) {
+    values[i] = dist(gen) < 0.1 ? dist(gen) : 0;
+  }
+  std::vector<int64_t> shape = {kRows, kColumns};
+  return std::make_shared<Tensor>(float64(), std::move(buffer), shape);
+}
+
+// state.range(0) is the CPU thread pool capacity: with a single thread, the
+// tensor is converted serially as before parallel conversion was added
+template <typename SparseTensorType>
+static void DenseToSparse(benchmark::State& state) {  // NOLINT non-const reference
+  static const std::shared_ptr<Tensor> tensor = MakeDenseMatrix();
+  const int capacity = GetCpuThreadPoolCapacity();
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(static_cast<int>(state.range(0))));
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseTensorType::Make(*tensor, int64()).status());
+  }
+  state.SetBytesProcessed(state.iterations() * tensor->size() * sizeof(double));
+
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(capacity));
+}
+
+static void DenseToSparseArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("threads")->UseRealTime();
+  for (int threads : {1, 2, 4, 8}) {
+    bench->Arg(threads);
+  }
+}
+
+BENCHMARK_TEMPLATE(DenseToSparse, SparseCOOTensor)->Apply(DenseToSparseArgs);
+BENCHMARK_TEMPLATE(DenseToSparse, SparseCSRMatrix)->Apply(DenseToSparseArgs);
+BENCHMARK_TEMPLATE(DenseToSparse, SparseCSCMatrix)->Apply(DenseToSparseArgs);
+BENCHMARK_TEMPLATE(DenseToSparse, SparseCSFTensor)->Apply(DenseToSparseArgs);
+
+}  // namespace arrow
@@ -17,8 +17,10 @@
 
 // Unit tests for DataType (and subclasses), Field, and Schema
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -31,6 +33,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/util/sort.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -1495,4 +1498,70 @@ INSTANTIATE_TYPED_TEST_SUITE_P(TestInt64, TestSparseCSFTensorForIndexValueType,
                                Int64Type);
 INSTANTIATE_TYPED_TEST_SUITE_P(TestUInt64, TestSparseCSFTensorForIndexValueType,
                                UInt64Type);
+
+// Tensors large enough to be converted in parallel (see tensor/converter.h)
+// must give the same results as when converted by a single thread
+class TestParallelSparseTensorConversion : public ::testing::Test {
+ public:
+  void SetUp() { capacity_ = GetCpuThreadPoolCapacity(); }
+  void TearDown() { ASSERT_OK(SetCpuThreadPoolCapacity(capacity_)); }
+
+  std::shared_ptr<Buffer> RandomSparseData(int64_t size) {
+    auto buffer = *AllocateBuffer(size * sizeof(int64_t));
+    auto values = reinterpret_cast<int64_t*>(buffer->mutable_data());
+    std::fill(values, values + size, 0);
+    std::default_random_engine gen(42);
+    std::uniform_int_distribution<int64_t> dist(0, 99);
+    for (int64_t i = 0; i < size; ++i) {
+      // Denser in the first eighth, so that blocks have different counts
+      const int64_t percent_nonzero = i < size / 8 ? 30 : 2;
+      if (dist(gen) < percent_nonzero) {
+        values[i] = dist(gen) + 1;
+      }
+    }
+    return std::move(buffer);
+  }
+
+  template <typename SparseTensorType>
+  void CheckConversion(const Tensor& tensor) {
+    ASSERT_OK(SetCpuThreadPoolCapacity(std::max(capacity_, 4)));
+    ASSERT_OK_AND_ASSIGN(auto parallel, SparseTensorType::Make(tensor, int32()));
+    ASSERT_OK(SetCpuThreadPoolCapacity(1));
+    ASSERT_OK_AND_ASSIGN(auto serial, SparseTensorType::Make(tensor, int32()));
+
+    ASSERT_GT(serial->non_zero_length(), 0);
+    ASSERT_TRUE(parallel->Equals(*serial));
+    std::shared_ptr<Tensor> dense;
+    ASSERT_OK(parallel->ToTensor(&dense));
+    ASSERT_TRUE(dense->Equals(tensor));
+  }
+
+ protected:
+  int capacity_;
+};
+
+TEST_F(TestParallelSparseTensorConversion, COO) {
+  std::vector<int64_t> shape = {64, 130, 128};
+  Tensor tensor(int64(), RandomSparseData(64 * 130 * 128), shape);
+  CheckConversion<SparseCOOTensor>(tensor);
+
+  // Column-major
+  std::vector<int64_t> strides = {8, 64 * 8, 64 * 130 * 8};
+  Tensor column_major(int64(), tensor.data(), shape, strides);
+  CheckConversion<SparseCOOTensor>(column_major);
+}
+
+TEST_F(TestParallelSparseTensorConversion, CSRAndCSC) {
+  std::vector<int64_t> shape = {1030, 1024};
+  Tensor tensor(int64(), RandomSparseData(1030 * 1024), shape);
+  CheckConversion<SparseCSRMatrix>(tensor);
+  CheckConversion<SparseCSCMatrix>(tensor);
+
+  // Column-major
+  std::vector<int64_t> strides = {8, 1030 * 8};
+  Tensor column_major(int64(), tensor.data(), shape, strides);
+  CheckConversion<SparseCSRMatrix>(column_major);
+  CheckConversion<SparseCSCMatrix>(column_major);
+}
+
 }  // namespace arrow
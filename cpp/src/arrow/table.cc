@@ -32,6 +32,7 @@
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -391,16 +392,17 @@ class SimpleTable : public Table {
 
   Status ValidateFull() const override {
     RETURN_NOT_OK(ValidateMeta());
-    for (int i = 0; i < num_columns(); ++i) {
-      const ChunkedArray* col = columns_[i].get();
-      Status st = col->ValidateFull();
-      if (!st.ok()) {
-        std::stringstream ss;
-        ss << "Column " << i << ": " << st.message();
-        return st.WithMessage(ss.str());
-      }
-    }
-    return Status::OK();
+    return internal::OptionalParallelFor(
+        internal::ValidateInParallel(num_columns(), num_rows()), num_columns(),
+        [&](int i) {
+          Status st = columns_[i]->ValidateFull();
+          if (!st.ok()) {
+            std::stringstream ss;
+            ss << "Column " << i << ": " << st.message();
+            return st.WithMessage(ss.str());
+          }
+          return st;
+        });
   }
 
  protected:
@@ -745,19 +747,34 @@ bool Table::Equals(const Table& other, bool check_metadata) const {
   return true;
 }
 
-Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
+Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool,
+                                                    bool use_threads) const {
   const int ncolumns = num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
+  std::vector<int> chunked_columns;
   for (int i = 0; i < ncolumns; ++i) {
-    auto col = column(i);
-    if (col->num_chunks() <= 1) {
-      compacted_columns[i] = col;
+    if (column(i)->num_chunks() <= 1) {
+      compacted_columns[i] = column(i);
     } else {
-      std::shared_ptr<Array> compacted;
-      RETURN_NOT_OK(Concatenate(col->chunks(), pool, &compacted));
-      compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
-    }
-  }
+      chunked_columns.push_back(i);
+    }
+  }
+
+  // Concatenate the columns in parallel if there are enough of them to keep
+  // the thread pool busy, otherwise the chunks of each column in parallel
+  // (not both, since a task of the thread pool must not wait for others)
+  const bool parallel_columns =
+      use_threads && static_cast<int>(chunked_columns.size()) >=
+                         internal::GetCpuThreadPool()->GetCapacity();
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      parallel_columns, static_cast<int>(chunked_columns.size()), [&](int j) {
+        const int i = chunked_columns[j];
+        std::shared_ptr<Array> compacted;
+        RETURN_NOT_OK(Concatenate(column(i)->chunks(), pool,
+                                  use_threads && !parallel_columns, &compacted));
+        compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
+        return Status::OK();
+      }));
   return Table::Make(schema(), std::move(compacted_columns));
 }
 
@@ -402,8 +402,10 @@ class ARROW_EXPORT Table {
   /// concatenated into zero or one chunk.
   ///
   /// \param[in] pool The pool for buffer allocations
-  Result<std::shared_ptr<Table>> CombineChunks(
-      MemoryPool* pool = default_memory_pool()) const;
+  /// \param[in] use_threads Whether to concatenate the columns, or their
+  /// chunks, in parallel on the CPU thread pool
+  Result<std::shared_ptr<Table>> CombineChunks(MemoryPool* pool = default_memory_pool(),
+                                               bool use_threads = false) const;
 
   ARROW_DEPRECATED("Use Result-returning version")
   Status CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const;
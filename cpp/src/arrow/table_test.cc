@@ -15,8 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cmath>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -26,15 +28,21 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
 class TestChunkedArray : public TestBase {
  protected:
   virtual void Construct() {
@@ -413,6 +421,44 @@ TEST_F(TestTable, CombineChunks) {
   }
 }
 
+TEST_F(TestTable, CombineChunksUseThreads) {
+  // Both few columns, whose chunks are concatenated in parallel, and more
+  // columns than threads, which are concatenated in parallel
+  for (int num_columns : {3, 2 * internal::GetCpuThreadPool()->GetCapacity()}) {
+    FieldVector fields;
+    for (int i = 0; i < num_columns; ++i) {
+      fields.push_back(field("f" + std::to_string(i), i % 2 ? utf8() : int32()));
+    }
+    auto schema = ::arrow::schema(fields);
+
+    random::RandomArrayGenerator rng(42);
+    RecordBatchVector batches;
+    for (int j = 0; j < 20; ++j) {
+      const int64_t length = 1000 + j;
+      ArrayVector columns;
+      for (int i = 0; i < num_columns; ++i) {
+        if (i % 2) {
+          columns.push_back(rng.String(length, /*min_length=*/0, /*max_length=*/10,
+                                       /*null_probability=*/0.1));
+        } else {
+          columns.push_back(rng.Int32(length, /*min=*/0, /*max=*/100,
+                                      /*null_probability=*/0.1));
+        }
+      }
+      batches.push_back(RecordBatch::Make(schema, length, columns));
+    }
+    ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+
+    ASSERT_OK_AND_ASSIGN(auto compacted, table->CombineChunks(default_memory_pool(),
+                                                              /*use_threads=*/true));
+    ASSERT_OK(compacted->ValidateFull());
+    EXPECT_TRUE(compacted->Equals(*table));
+    for (int i = 0; i < compacted->num_columns(); ++i) {
+      EXPECT_EQ(1, compacted->column(i)->num_chunks());
+    }
+  }
+}
+
 TEST_F(TestTable, ConcatenateTables) {
   const int64_t length = 10;
 
@@ -763,7 +809,10 @@ TEST_F(TestTable, AddColumn) {
   ASSERT_TRUE(result->Equals(*expected));
 }
 
-class TestRecordBatch : public TestBase {};
+class TestRecordBatch : public TestBase {
+ protected:
+  random::RandomArrayGenerator rand_{0x9e3ab1};
+};
 
 TEST_F(TestRecordBatch, Equals) {
   const int length = 10;
@@ -824,6 +873,85 @@ TEST_F(TestRecordBatch, Validate) {
   ASSERT_RAISES(Invalid, b3->ValidateFull());
 }
 
+TEST_F(TestRecordBatch, ValidateFullLarge) {
+  // Large enough for the columns to be validated in parallel, in several
+  // blocks each
+  const int64_t length = 20000;
+  random::RandomArrayGenerator rng(42);
+
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+  auto indices = rng.Int32(length, 0, 2, /*null_probability=*/0.1);
+  auto dict_type = dictionary(int32(), utf8());
+  auto schema = ::arrow::schema({field("f0", utf8()), field("f1", utf8()),
+                                 field("f2", dict_type), field("f3", utf8())});
+  ArrayVector columns = {rng.String(length, 0, 10, 0.1), rng.String(length, 0, 10, 0.1),
+                         std::make_shared<DictionaryArray>(dict_type, indices, dict),
+                         rng.String(length, 0, 10, 0.1)};
+  ASSERT_OK(RecordBatch::Make(schema, length, columns)->ValidateFull());
+
+  auto with_column = [&](int i, std::shared_ptr<Array> column) {
+    ArrayVector new_columns = columns;
+    new_columns[i] = std::move(column);
+    return RecordBatch::Make(schema, length, new_columns);
+  };
+  // Copy the data buffer of an array, to corrupt it
+  auto copy_buffer = [](const Array& array, int i) {
+    auto data = array.data()->Copy();
+    data->buffers[i] = *data->buffers[i]->CopySlice(0, data->buffers[i]->size());
+    return data;
+  };
+
+  auto data = copy_buffer(*columns[1], 1);
+  auto offsets = data->GetMutableValues<int32_t>(1);
+  offsets[1500] = offsets[1499] - 1;
+  auto non_monotonic = MakeArray(data);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("non-monotonic offset at slot 1500"),
+      with_column(1, non_monotonic)->ValidateFull());
+
+  data = copy_buffer(*columns[3], 1);
+  offsets = data->GetMutableValues<int32_t>(1);
+  offsets[length] = static_cast<int32_t>(data->buffers[2]->size()) + 1;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("offset for slot 20000 out of bounds"),
+      with_column(3, MakeArray(data))->ValidateFull());
+
+  // Out of bounds values in null slots are ignored
+  data = copy_buffer(*indices, 1);
+  auto values = data->GetMutableValues<int32_t>(1);
+  int64_t null_index = 0;
+  while (indices->IsValid(null_index)) {
+    ++null_index;
+  }
+  values[null_index] = 100;
+  auto batch = with_column(
+      2, std::make_shared<DictionaryArray>(dict_type, MakeArray(data), dict));
+  ASSERT_OK(batch->ValidateFull());
+
+  int64_t valid_index = 5000;
+  while (indices->IsNull(valid_index)) {
+    ++valid_index;
+  }
+  values[valid_index] = 3;
+  batch = with_column(
+      2, std::make_shared<DictionaryArray>(dict_type, MakeArray(data), dict));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid,
+      ::testing::HasSubstr("Value at position " + std::to_string(valid_index) +
+                           " out of bounds: 3"),
+      batch->ValidateFull());
+
+  // With errors in several columns, the first one is reported
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Column 2: "),
+                                  table->ValidateFull());
+  ASSERT_OK_AND_ASSIGN(table, table->SetColumn(1, schema->field(1),
+                                               std::make_shared<ChunkedArray>(
+                                                   non_monotonic)));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Column 1: "),
+                                  table->ValidateFull());
+}
+
 TEST_F(TestRecordBatch, Slice) {
   const int length = 10;
 
@@ -950,6 +1078,107 @@ TEST_F(TestRecordBatch, RemoveColumnEmpty) {
   AssertBatchesEqual(*added, *batch1);
 }
 
+template <typename TensorType, typename ArrayType>
+void AssertTensorColumn(const Tensor& tensor, int column, const ArrayType& array) {
+  ASSERT_EQ(tensor.shape()[0], array.length());
+  for (int64_t i = 0; i < array.length(); ++i) {
+    const auto value = tensor.Value<TensorType>({i, column});
+    if (array.IsNull(i)) {
+      ASSERT_TRUE(std::isnan(static_cast<double>(value)));
+    } else {
+      ASSERT_EQ(static_cast<typename TensorType::c_type>(array.Value(i)), value);
+    }
+  }
+}
+
+TEST_F(TestRecordBatch, ToTensorZeroCopy) {
+  const int64_t length = 100;
+  auto values = checked_pointer_cast<Int32Array>(rand_.Int32(3 * length, -100, 100));
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < 3; ++i) {
+    columns.push_back(values->Slice(i * length, length));
+  }
+  auto schema = ::arrow::schema(
+      {field("a", int32()), field("b", int32()), field("c", int32())});
+  auto batch = RecordBatch::Make(schema, length, columns);
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+  ASSERT_EQ(tensor->type_id(), Type::INT32);
+  ASSERT_EQ(tensor->shape(), std::vector<int64_t>({length, 3}));
+  ASSERT_TRUE(tensor->is_column_major());
+  ASSERT_EQ(tensor->raw_data(), reinterpret_cast<const uint8_t*>(values->raw_values()));
+  for (int i = 0; i < 3; ++i) {
+    AssertTensorColumn<Int32Type>(*tensor, i,
+                                  checked_cast<const Int32Array&>(*columns[i]));
+  }
+
+  // Columns out of order are copied
+  batch = RecordBatch::Make(schema, length, {columns[1], columns[0], columns[2]});
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor());
+  ASSERT_TRUE(tensor->is_row_major());
+  AssertTensorColumn<Int32Type>(*tensor, 0, checked_cast<const Int32Array&>(*columns[1]));
+}
+
+TEST_F(TestRecordBatch, ToTensorPromotion) {
+  const int64_t length = 1000;
+  auto a = checked_pointer_cast<Int8Array>(rand_.Int8(length, -100, 100));
+  auto b = checked_pointer_cast<UInt16Array>(rand_.UInt16(length, 0, 60000));
+  auto c = checked_pointer_cast<Int16Array>(rand_.Int16(length, -1000, 1000));
+  auto schema = ::arrow::schema(
+      {field("a", int8()), field("b", uint16()), field("c", int16())});
+  auto batch = RecordBatch::Make(schema, length, {a, b, c});
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+  ASSERT_EQ(tensor->type_id(), Type::INT32);
+  ASSERT_TRUE(tensor->is_row_major());
+  AssertTensorColumn<Int32Type>(*tensor, 0, *a);
+  AssertTensorColumn<Int32Type>(*tensor, 1, *b);
+  AssertTensorColumn<Int32Type>(*tensor, 2, *c);
+
+  // Integers with floating point values or nulls become floating point
+  auto d = checked_pointer_cast<FloatArray>(rand_.Float32(length, -1, 1, 0.1));
+  batch = RecordBatch::Make(::arrow::schema({field("a", int8()), field("d", float32())}),
+                            length, {a, d});
+  ASSERT_RAISES(Invalid, batch->ToTensor());
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(/*null_to_nan=*/true));
+  ASSERT_EQ(tensor->type_id(), Type::FLOAT);
+  AssertTensorColumn<FloatType>(*tensor, 0, *a);
+  AssertTensorColumn<FloatType>(*tensor, 1, *d);
+
+  auto e = checked_pointer_cast<Int32Array>(rand_.Int32(length, -100, 100, 0.1));
+  batch = RecordBatch::Make(::arrow::schema({field("e", int32())}), length, {e});
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(/*null_to_nan=*/true));
+  ASSERT_EQ(tensor->type_id(), Type::DOUBLE);
+  AssertTensorColumn<DoubleType>(*tensor, 0, *e);
+
+  batch = RecordBatch::Make(
+      ::arrow::schema({field("a", int8()), field("f", utf8())}), length,
+      {a, rand_.String(length, 0, 4)});
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+}
+
+TEST_F(TestRecordBatch, ToTensorBlocks) {
+  // Spans several blocks of rows, copied on several threads
+  const int64_t length = 50000;
+  std::vector<std::shared_ptr<Array>> columns;
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < 4; ++i) {
+    columns.push_back(rand_.Float64(length, -1, 1, 0.05));
+    fields.push_back(field("f" + std::to_string(i), float64()));
+  }
+  auto batch = RecordBatch::Make(::arrow::schema(fields), length, columns)->Slice(7);
+
+  for (bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto tensor,
+                         batch->ToTensor(/*null_to_nan=*/true, use_threads));
+    ASSERT_EQ(tensor->shape(), std::vector<int64_t>({length - 7, 4}));
+    for (int i = 0; i < 4; ++i) {
+      AssertTensorColumn<DoubleType>(*tensor, i,
+                                     checked_cast<const DoubleArray&>(*batch->column(i)));
+    }
+  }
+}
+
 class TestTableBatchReader : public TestBase {};
 
 TEST_F(TestTableBatchReader, ReadNext) {
@@ -19,11 +19,38 @@
 
 #include "arrow/sparse_tensor.h"  // IWYU pragma: export
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <vector>
+
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace internal {
 
+// Dense tensors with at least this many elements are converted in parallel on
+// the CPU thread pool.  The outer dimension is split in blocks whose non-zeros
+// are counted, then written at the offsets given by the prefix sum of the
+// counts, so that the output buffers are allocated once.
+constexpr int64_t kParallelConversionMinSize = 1 << 20;
+
+// Return the boundaries of the blocks [0, length) is split into for converting
+// a tensor of the given size: a single block unless it is converted in parallel
+inline std::vector<int64_t> SplitConversionBlocks(int64_t length, int64_t tensor_size) {
+  int64_t num_blocks = 1;
+  const int capacity = GetCpuThreadPoolCapacity();
+  if (tensor_size >= kParallelConversionMinSize && capacity > 1) {
+    // Several blocks per thread, to balance uneven densities
+    num_blocks = std::max<int64_t>(1, std::min<int64_t>(length, 4 * capacity));
+  }
+  std::vector<int64_t> boundaries(num_blocks + 1);
+  for (int64_t i = 0; i <= num_blocks; ++i) {
+    boundaries[i] = length * i / num_blocks;
+  }
+  return boundaries;
+}
+
 Status MakeSparseCOOTensorFromTensor(const Tensor& tensor,
                                      const std::shared_ptr<DataType>& index_value_type,
                                      MemoryPool* pool,
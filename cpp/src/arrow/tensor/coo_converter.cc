@@ -19,12 +19,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -34,16 +36,55 @@ class MemoryPool;
 namespace internal {
 namespace {
 
-inline void IncrementIndex(std::vector<int64_t>& coord,
-                           const std::vector<int64_t>& shape) {
-  const int64_t ndim = shape.size();
-  ++coord[ndim - 1];
-  if (coord[ndim - 1] == shape[ndim - 1]) {
-    int64_t d = ndim - 1;
-    while (d > 0 && coord[d] == shape[d]) {
-      coord[d] = 0;
-      ++coord[d - 1];
-      --d;
+// Call visit(coord, value) on the elements of a tensor whose coordinate along
+// the first dimension is in [row_begin, row_end), in row-major order.  A 0-d
+// tensor has a single row.
+template <typename value_type, typename Visitor>
+void VisitRowMajor(const Tensor& tensor, int64_t row_begin, int64_t row_end,
+                   Visitor&& visit) {
+  const int ndim = tensor.ndim();
+  const std::vector<int64_t>& shape = tensor.shape();
+  const std::vector<int64_t>& strides = tensor.strides();
+  std::vector<int64_t> coord(ndim, 0);
+  if (ndim == 0) {
+    if (row_begin < row_end) {
+      visit(coord, *reinterpret_cast<const value_type*>(tensor.raw_data()));
+    }
+    return;
+  }
+  if (row_begin >= row_end || tensor.size() == 0) {
+    return;
+  }
+
+  const int last = ndim - 1;
+  const int64_t inner_begin = ndim == 1 ? row_begin : 0;
+  const int64_t inner_end = ndim == 1 ? row_end : shape[last];
+  const int64_t inner_stride = strides[last];
+  const uint8_t* data = tensor.raw_data();
+  if (ndim > 1) {
+    coord[0] = row_begin;
+    data += row_begin * strides[0];
+  }
+  while (true) {
+    for (int64_t i = inner_begin; i < inner_end; ++i) {
+      coord[last] = i;
+      visit(coord, *reinterpret_cast<const value_type*>(data + i * inner_stride));
+    }
+    // Advance to the next innermost row, as in an odometer
+    int d = last - 1;
+    for (; d >= 0; --d) {
+      ++coord[d];
+      data += strides[d];
+      if (coord[d] < (d == 0 ? row_end : shape[d])) {
+        break;
+      }
+      if (d > 0) {
+        data -= shape[d] * strides[d];
+        coord[d] = 0;
+      }
+    }
+    if (d < 0) {
+      return;
     }
   }
 }
@@ -68,8 +109,22 @@ class SparseCOOTensorConverter {
     const int64_t indices_elsize = sizeof(c_index_value_type);
 
     const int64_t ndim = tensor_.ndim();
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
+    const int64_t num_rows = ndim == 0 ? 1 : tensor_.shape()[0];
+    const std::vector<int64_t> blocks = SplitConversionBlocks(num_rows, tensor_.size());
+    const int num_blocks = static_cast<int>(blocks.size()) - 1;
+
+    // Count the non-zeros of each block of rows
+    std::vector<int64_t> block_offsets(num_blocks + 1, 0);
+    RETURN_NOT_OK(OptionalParallelFor(num_blocks > 1, num_blocks, [&](int b) {
+      int64_t count = 0;
+      VisitRowMajor<value_type>(
+          tensor_, blocks[b], blocks[b + 1],
+          [&](const std::vector<int64_t>&, value_type x) { count += x != 0; });
+      block_offsets[b + 1] = count;
+      return Status::OK();
+    }));
+    std::partial_sum(block_offsets.begin(), block_offsets.end(), block_offsets.begin());
+    const int64_t nonzero_count = block_offsets[num_blocks];
 
     ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
                           AllocateBuffer(indices_elsize * ndim * nonzero_count, pool_));
@@ -80,31 +135,23 @@ class SparseCOOTensorConverter {
                           AllocateBuffer(sizeof(value_type) * nonzero_count, pool_));
     value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
 
-    if (ndim <= 1) {
-      const value_type* data = reinterpret_cast<const value_type*>(tensor_.raw_data());
-      const int64_t count = ndim == 0 ? 1 : tensor_.shape()[0];
-      for (int64_t i = 0; i < count; ++i, ++data) {
-        if (*data != 0) {
-          *indices++ = static_cast<c_index_value_type>(i);
-          *values++ = *data;
-        }
-      }
-    } else {
-      const std::vector<int64_t>& shape = tensor_.shape();
-      std::vector<int64_t> coord(ndim, 0);  // The current logical coordinates
-
-      for (int64_t n = tensor_.size(); n > 0; n--) {
-        const value_type x = tensor_.Value(coord);
-        if (tensor_.Value(coord) != 0) {
-          *values++ = x;
-          // Write indices in row-major order.
-          for (int64_t i = 0; i < ndim; ++i) {
-            *indices++ = static_cast<c_index_value_type>(coord[i]);
-          }
-        }
-        IncrementIndex(coord, shape);
-      }
-    }
+    // Write the non-zeros of each block after those of the previous blocks
+    RETURN_NOT_OK(OptionalParallelFor(num_blocks > 1, num_blocks, [&](int b) {
+      value_type* block_values = values + block_offsets[b];
+      c_index_value_type* block_indices = indices + block_offsets[b] * ndim;
+      VisitRowMajor<value_type>(
+          tensor_, blocks[b], blocks[b + 1],
+          [&](const std::vector<int64_t>& coord, value_type x) {
+            if (x != 0) {
+              *block_values++ = x;
+              // Write indices in row-major order.  A 0-d tensor has no index.
+              for (int64_t i = 0; i < ndim; ++i) {
+                *block_indices++ = static_cast<c_index_value_type>(coord[i]);
+              }
+            }
+          });
+      return Status::OK();
+    }));
 
     // make results
     const std::vector<int64_t> indices_shape = {nonzero_count, ndim};
@@ -26,6 +26,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -61,45 +62,73 @@ class SparseCSCMatrixConverter {
       return Status::Invalid("Invalid tensor dimension");
       // LCOV_EXCL_STOP
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
     const int64_t nr = tensor_.shape()[0];
     const int64_t nc = tensor_.shape()[1];
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
+    const int64_t row_stride = tensor_.strides()[0];
+    const int64_t column_stride = tensor_.strides()[1];
+    const uint8_t* raw_data = tensor_.raw_data();
+    auto element = [&](int64_t i, int64_t j) {
+      return *reinterpret_cast<const value_type*>(raw_data + i * row_stride +
+                                                  j * column_stride);
+    };
 
     std::shared_ptr<Buffer> indptr_buffer;
     std::shared_ptr<Buffer> indices_buffer;
+    std::shared_ptr<Buffer> values_buffer;
+    int64_t nonzero_count = 0;
+
+    // Each block of columns is scanned row by row, which follows the memory
+    // layout of row-major tensors better than scanning each column in turn
+    const std::vector<int64_t> blocks = SplitConversionBlocks(nc, tensor_.size());
+    const int num_blocks = static_cast<int>(blocks.size()) - 1;
+
+    ARROW_ASSIGN_OR_RAISE(indptr_buffer,
+                          AllocateBuffer(indices_elsize * (nc + 1), pool_));
+    auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
+
+    // Count the non-zeros of each column, in parallel over blocks of columns
+    std::vector<int64_t> cursors(nc, 0);
+    RETURN_NOT_OK(OptionalParallelFor(num_blocks > 1, num_blocks, [&](int b) {
+      for (int64_t i = 0; i < nr; ++i) {
+        for (int64_t j = blocks[b]; j < blocks[b + 1]; ++j) {
+          cursors[j] += element(i, j) != 0;
+        }
+      }
+      return Status::OK();
+    }));
+    indptr[0] = 0;
+    for (int64_t j = 0; j < nc; ++j) {
+      const int64_t count = cursors[j];
+      // The non-zeros of column j are written from cursors[j] on
+      cursors[j] = nonzero_count;
+      nonzero_count += count;
+      indptr[j + 1] = static_cast<c_index_value_type>(nonzero_count);
+    }
 
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+    ARROW_ASSIGN_OR_RAISE(values_buffer,
                           AllocateBuffer(sizeof(value_type) * nonzero_count, pool_));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(indices_elsize * (nc + 1), pool_));
-      auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(indices_elsize * nonzero_count, pool_));
-      auto* indices =
-          reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
-
-      c_index_value_type k = 0;
-      *indptr++ = 0;
-      for (int64_t j = 0; j < nc; ++j) {
-        for (int64_t i = 0; i < nr; ++i) {
-          const value_type x = tensor_.Value({i, j});
+    auto* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
+    ARROW_ASSIGN_OR_RAISE(indices_buffer,
+                          AllocateBuffer(indices_elsize * nonzero_count, pool_));
+    auto* indices = reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
+
+    RETURN_NOT_OK(OptionalParallelFor(num_blocks > 1, num_blocks, [&](int b) {
+      for (int64_t i = 0; i < nr; ++i) {
+        for (int64_t j = blocks[b]; j < blocks[b + 1]; ++j) {
+          const value_type x = element(i, j);
           if (x != 0) {
-            *values++ = x;
-            *indices++ = static_cast<c_index_value_type>(i);
-            k++;
+            const int64_t k = cursors[j]++;
+            values[k] = x;
+            indices[k] = static_cast<c_index_value_type>(i);
           }
         }
-        *indptr++ = k;
       }
-    }
+      return Status::OK();
+    }));
 
     std::vector<int64_t> indptr_shape({nc + 1});
     std::shared_ptr<Tensor> indptr_tensor =
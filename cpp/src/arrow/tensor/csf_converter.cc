@@ -93,6 +93,15 @@ class SparseCSFTensorConverter {
     if (ndim <= 1) {
       return Status::NotImplemented("TODO for ndim <= 1");
     } else {
+      // No level has more than nonzero_count nodes: reserve the builders once
+      // rather than growing them while scanning
+      for (auto& builder : indptr_buffer_builders) {
+        RETURN_NOT_OK(builder.Reserve(nonzero_count + 1));
+      }
+      for (auto& builder : indices_buffer_builders) {
+        RETURN_NOT_OK(builder.Reserve(nonzero_count));
+      }
+
       const std::vector<int64_t>& shape = tensor_.shape();
       for (int64_t n = tensor_.size(); n > 0; n--) {
         const value_type x = tensor_.Value(coord);
@@ -107,11 +116,11 @@ class SparseCSFTensorConverter {
             tree_split = tree_split || (coord[dimension] != previous_coord[dimension]);
             if (tree_split) {
               if (i < ndim - 1) {
-                RETURN_NOT_OK(indptr_buffer_builders[i].Append(
-                    static_cast<c_index_value_type>(counts[i + 1])));
+                indptr_buffer_builders[i].UnsafeAppend(
+                    static_cast<c_index_value_type>(counts[i + 1]));
               }
-              RETURN_NOT_OK(indices_buffer_builders[i].Append(
-                  static_cast<c_index_value_type>(coord[dimension])));
+              indices_buffer_builders[i].UnsafeAppend(
+                  static_cast<c_index_value_type>(coord[dimension]));
               ++counts[i];
             }
           }
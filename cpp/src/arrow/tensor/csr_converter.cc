@@ -26,6 +26,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -61,45 +62,71 @@ class SparseCSRMatrixConverter {
       return Status::Invalid("Invalid tensor dimension");
       // LCOV_EXCL_STOP
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
     const int64_t nr = tensor_.shape()[0];
     const int64_t nc = tensor_.shape()[1];
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
+    const int64_t row_stride = tensor_.strides()[0];
+    const int64_t column_stride = tensor_.strides()[1];
+    const uint8_t* raw_data = tensor_.raw_data();
+    auto element = [&](int64_t i, int64_t j) {
+      return *reinterpret_cast<const value_type*>(raw_data + i * row_stride +
+                                                  j * column_stride);
+    };
 
     std::shared_ptr<Buffer> indptr_buffer;
     std::shared_ptr<Buffer> indices_buffer;
+    std::shared_ptr<Buffer> values_buffer;
+    int64_t nonzero_count = 0;
 
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(sizeof(value_type) * nonzero_count, pool_));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
+    const std::vector<int64_t> blocks = SplitConversionBlocks(nr, tensor_.size());
+    const int num_blocks = static_cast<int>(blocks.size()) - 1;
 
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(indices_elsize * (nr + 1), pool_));
-      auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(indices_elsize * nonzero_count, pool_));
-      auto* indices =
-          reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
-
-      c_index_value_type k = 0;
-      *indptr++ = 0;
-      for (int64_t i = 0; i < nr; ++i) {
+    ARROW_ASSIGN_OR_RAISE(indptr_buffer,
+                          AllocateBuffer(indices_elsize * (nr + 1), pool_));
+    auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
+
+    // Count the non-zeros of each row, in parallel over blocks of rows
+    indptr[0] = 0;
+    RETURN_NOT_OK(OptionalParallelFor(num_blocks > 1, num_blocks, [&](int b) {
+      for (int64_t i = blocks[b]; i < blocks[b + 1]; ++i) {
+        int64_t count = 0;
         for (int64_t j = 0; j < nc; ++j) {
-          const value_type x = tensor_.Value({i, j});
+          count += element(i, j) != 0;
+        }
+        indptr[i + 1] = static_cast<c_index_value_type>(count);
+      }
+      return Status::OK();
+    }));
+    for (int64_t i = 0; i < nr; ++i) {
+      nonzero_count += indptr[i + 1];
+      indptr[i + 1] = static_cast<c_index_value_type>(nonzero_count);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(values_buffer,
+                          AllocateBuffer(sizeof(value_type) * nonzero_count, pool_));
+    auto* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
+    ARROW_ASSIGN_OR_RAISE(indices_buffer,
+                          AllocateBuffer(indices_elsize * nonzero_count, pool_));
+    auto* indices = reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
+
+    // Write the non-zeros of each block of rows from its first indptr
+    RETURN_NOT_OK(OptionalParallelFor(num_blocks > 1, num_blocks, [&](int b) {
+      int64_t k = static_cast<int64_t>(indptr[blocks[b]]);
+      for (int64_t i = blocks[b]; i < blocks[b + 1]; ++i) {
+        for (int64_t j = 0; j < nc; ++j) {
+          const value_type x = element(i, j);
           if (x != 0) {
-            *values++ = x;
-            *indices++ = static_cast<c_index_value_type>(j);
-            k++;
+            values[k] = x;
+            indices[k] = static_cast<c_index_value_type>(j);
+            ++k;
           }
         }
-        *indptr++ = k;
       }
-    }
+      return Status::OK();
+    }));
 
     std::vector<int64_t> indptr_shape({nr + 1});
     std::shared_ptr<Tensor> indptr_tensor =
@@ -18,8 +18,10 @@
 #include "arrow/testing/generator.h"
 
 #include <algorithm>
+#include <cstdio>
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -95,4 +97,100 @@ std::shared_ptr<arrow::Array> ConstantArrayGenerator::String(int64_t size,
   return ConstantArray<StringType>(size, value);
 }
 
+namespace {
+
+constexpr int kTextDataSeed = 0x5ca1ab1e;
+
+void AppendTextValue(TextDataGenerator::ColumnKind kind,
+                     std::default_random_engine& engine, std::string* out) {
+  char buf[32];
+  switch (kind) {
+    case TextDataGenerator::INT64: {
+      std::uniform_int_distribution<int64_t> dist(-1000000000LL, 1000000000LL);
+      snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(dist(engine)));  // NOLINT
+      *out += buf;
+      break;
+    }
+    case TextDataGenerator::FLOAT64: {
+      std::uniform_real_distribution<double> dist(-1e6, 1e6);
+      snprintf(buf, sizeof(buf), "%.6f", dist(engine));
+      *out += buf;
+      break;
+    }
+    case TextDataGenerator::STRING: {
+      std::uniform_int_distribution<int> length_dist(1, 16);
+      std::uniform_int_distribution<int> char_dist('a', 'z');
+      const int length = length_dist(engine);
+      for (int i = 0; i < length; ++i) {
+        out->push_back(static_cast<char>(char_dist(engine)));
+      }
+      break;
+    }
+    case TextDataGenerator::BOOLEAN: {
+      std::bernoulli_distribution dist(0.5);
+      *out += dist(engine) ? "true" : "false";
+      break;
+    }
+  }
+}
+
+// Generate rows until the data reaches `size` bytes, CSV if `json` is false
+std::shared_ptr<Buffer> GenerateText(
+    const std::vector<TextDataGenerator::ColumnKind>& kinds, int64_t size,
+    double null_probability, bool json, bool quoted) {
+  std::default_random_engine engine(kTextDataSeed);
+  std::bernoulli_distribution null_dist(null_probability);
+
+  std::string text;
+  text.reserve(static_cast<size_t>(size + 1024));
+  if (!json) {
+    for (size_t i = 0; i < kinds.size(); ++i) {
+      text += (i == 0 ? "c" : ",c") + std::to_string(i);
+    }
+    text += "\n";
+  }
+  while (static_cast<int64_t>(text.size()) < size) {
+    if (json) {
+      text += "{";
+    }
+    for (size_t i = 0; i < kinds.size(); ++i) {
+      if (i > 0) {
+        text += ",";
+      }
+      if (json) {
+        text += "\"c" + std::to_string(i) + "\":";
+      }
+      if (null_dist(engine)) {
+        if (json) {
+          text += "null";
+        }
+        continue;
+      }
+      const bool quote = json ? kinds[i] == TextDataGenerator::STRING : quoted;
+      if (quote) {
+        text += "\"";
+      }
+      AppendTextValue(kinds[i], engine, &text);
+      if (quote) {
+        text += "\"";
+      }
+    }
+    text += json ? "}\n" : "\n";
+  }
+  return Buffer::FromString(std::move(text));
+}
+
+}  // namespace
+
+std::shared_ptr<Buffer> TextDataGenerator::CSV(const std::vector<ColumnKind>& kinds,
+                                               int64_t size, double null_probability,
+                                               bool quoted) {
+  return GenerateText(kinds, size, null_probability, /*json=*/false, quoted);
+}
+
+std::shared_ptr<Buffer> TextDataGenerator::JSON(const std::vector<ColumnKind>& kinds,
+                                                int64_t size, double null_probability) {
+  return GenerateText(kinds, size, null_probability, /*json=*/true, /*quoted=*/false);
+}
+
 }  // namespace arrow
@@ -240,4 +240,36 @@ class ARROW_EXPORT ConstantArrayGenerator {
   }
 };
 
+/// \brief Generates CSV or JSON text data with columns of the given kinds
+///
+/// The data is generated from a fixed seed, such that it is the same between
+/// runs (of e.g. a benchmark).  The columns are named "c0", "c1"...
+class ARROW_EXPORT TextDataGenerator {
+ public:
+  enum ColumnKind { INT64, FLOAT64, STRING, BOOLEAN };
+
+  /// \brief Generates CSV data with a header row
+  ///
+  /// \param[in] kinds the kind of each column
+  /// \param[in] size the approximate size of the data in bytes
+  /// \param[in] null_probability the probability of each value being null (empty)
+  /// \param[in] quoted whether non-null values are quoted
+  ///
+  /// \return a Buffer holding the data
+  static std::shared_ptr<Buffer> CSV(const std::vector<ColumnKind>& kinds, int64_t size,
+                                     double null_probability, bool quoted = false);
+
+  /// \brief Generates line-delimited JSON data, one object per row
+  ///
+  /// The rows hold the same values as CSV() with the same arguments.
+  ///
+  /// \param[in] kinds the kind of each column
+  /// \param[in] size the approximate size of the data in bytes
+  /// \param[in] null_probability the probability of each value being null
+  ///
+  /// \return a Buffer holding the data
+  static std::shared_ptr<Buffer> JSON(const std::vector<ColumnKind>& kinds, int64_t size,
+                                      double null_probability);
+};
+
 }  // namespace arrow
@@ -38,7 +38,12 @@
 #include "arrow/status.h"
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bit_util_avx2.h"
+#endif
 
 namespace arrow {
 
@@ -72,6 +77,84 @@ Result<std::shared_ptr<Buffer>> BytesToBits(const std::vector<uint8_t>& bytes,
 
 namespace internal {
 
+namespace {
+
+// Pack eight bytes into a byte, with a bit set for each non-zero byte
+inline uint8_t PackEightBytes(const uint8_t* bytes) {
+  // Byte k of the word is the k-th byte, whatever the endianness
+  auto word = BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(bytes));
+  // Reduce each byte to 0x01 if it is non-zero, 0x00 otherwise
+  word = ((((word & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | word) &
+          0x8080808080808080ULL) >>
+         7;
+  // Gather the low bit of byte k into bit 56 + k: the partial products don't
+  // overlap below the top byte, so no carry disturbs it
+  return static_cast<uint8_t>((word * 0x0102040810204080ULL) >> 56);
+}
+
+// Load the 64 bits starting `shift` (0 to 7) bits into `data`.  The byte
+// after the first eight is only read if `shift` is non-zero, in which case
+// it holds some of the bits.
+inline uint64_t LoadShiftedWord(const uint8_t* data, int shift) {
+  auto word = BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(data));
+  if (shift > 0) {
+    word = (word >> shift) | (static_cast<uint64_t>(data[8]) << (64 - shift));
+  }
+  return word;
+}
+
+inline void StoreWord(uint8_t* out, uint64_t word) {
+  word = BitUtil::ToLittleEndian(word);
+  std::memcpy(out, &word, sizeof(word));
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+// Bitmaps shorter than this are not worth a CPU feature check
+static constexpr int64_t kBitmapAvx2MinBytes = 64;
+
+inline bool UseBitmapAvx2(int64_t nbytes) {
+  static const bool use_avx2 = CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2);
+  return use_avx2 && nbytes >= kBitmapAvx2MinBytes;
+}
+#endif
+
+}  // namespace
+
+int64_t PackBytesToBitmap(const uint8_t* bytes, int64_t length, uint8_t* bitmap,
+                          int64_t offset) {
+  int64_t num_set = 0;
+  int64_t i = 0;
+  for (; i < length && (offset + i) % 8 != 0; ++i) {
+    const bool value = bytes[i] != 0;
+    BitUtil::SetBitTo(bitmap, offset + i, value);
+    num_set += value;
+  }
+
+  uint8_t* out = bitmap + (offset + i) / 8;
+  for (; i + 64 <= length; i += 64) {
+    uint64_t bits = 0;
+    for (int k = 0; k < 8; ++k) {
+      bits |= static_cast<uint64_t>(PackEightBytes(bytes + i + 8 * k)) << (8 * k);
+    }
+    num_set += BitUtil::PopCount(bits);
+    bits = BitUtil::ToLittleEndian(bits);
+    std::memcpy(out, &bits, sizeof(bits));
+    out += sizeof(bits);
+  }
+  for (; i + 8 <= length; i += 8) {
+    const uint8_t packed = PackEightBytes(bytes + i);
+    *out++ = packed;
+    num_set += BitUtil::PopCount(packed);
+  }
+
+  for (; i < length; ++i) {
+    const bool value = bytes[i] != 0;
+    BitUtil::SetBitTo(bitmap, offset + i, value);
+    num_set += value;
+  }
+  return num_set;
+}
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
   DCHECK_GE(bit_offset, 0);
@@ -118,10 +201,13 @@ void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
   dest += dest_byte_offset;
 
   if (dest_bit_offset > 0) {
-    internal::BitmapReader valid_reader(data, offset, length);
-    internal::BitmapWriter valid_writer(dest, dest_bit_offset, length);
+    // Transfer the leading bits one at a time until the destination is
+    // byte-aligned, then the remaining bits a byte at a time
+    const int64_t leading_bits = std::min<int64_t>(length, 8 - dest_bit_offset);
+    internal::BitmapReader valid_reader(data, offset, leading_bits);
+    internal::BitmapWriter valid_writer(dest, dest_bit_offset, leading_bits);
 
-    for (int64_t i = 0; i < length; i++) {
+    for (int64_t i = 0; i < leading_bits; i++) {
       if (invert_bits ^ valid_reader.IsSet()) {
         valid_writer.Set();
       } else {
@@ -131,6 +217,11 @@ void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
       valid_writer.Next();
     }
     valid_writer.Finish();
+
+    if (length > leading_bits) {
+      TransferBitmap<invert_bits, restore_trailing_bits>(
+          data, offset + leading_bits, length - leading_bits, 0, dest + 1);
+    }
   } else {
     // Take care of the trailing bits in the last byte
     int64_t trailing_bits = num_bytes * 8 - length;
@@ -140,25 +231,27 @@ void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
     }
 
     if (bit_offset > 0) {
-      uint8_t carry_mask = BitUtil::kPrecedingBitmask[bit_offset];
-      uint8_t carry_shift = static_cast<uint8_t>(8U - static_cast<uint8_t>(bit_offset));
-
-      uint8_t carry = 0U;
-      if (BitUtil::BytesForBits(length + bit_offset) > num_bytes) {
-        carry = static_cast<uint8_t>((data[byte_offset + num_bytes] & carry_mask)
-                                     << carry_shift);
+      // Shift the source a word at a time, then a byte at a time
+      const uint8_t* src = data + byte_offset;
+      const int shift = static_cast<int>(bit_offset);
+      const int64_t src_bytes = BitUtil::BytesForBits(length + bit_offset);
+      int64_t i = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      if (UseBitmapAvx2(num_bytes)) {
+        i = invert_bits ? InvertBitmapAvx2(src, shift, num_bytes, dest)
+                        : CopyBitmapAvx2(src, shift, num_bytes, dest);
       }
-
-      int64_t i = num_bytes - 1;
-      while (i + 1 > 0) {
-        uint8_t cur_byte = data[byte_offset + i];
-        if (invert_bits) {
-          dest[i] = static_cast<uint8_t>(~((cur_byte >> bit_offset) | carry));
-        } else {
-          dest[i] = static_cast<uint8_t>((cur_byte >> bit_offset) | carry);
+#endif
+      for (; i + 9 <= src_bytes && i + 8 <= num_bytes; i += 8) {
+        const uint64_t word = LoadShiftedWord(src + i, shift);
+        StoreWord(dest + i, invert_bits ? ~word : word);
+      }
+      for (; i < num_bytes; ++i) {
+        uint8_t byte = static_cast<uint8_t>(src[i] >> shift);
+        if (i + 1 < src_bytes) {
+          byte = static_cast<uint8_t>(byte | (src[i + 1] << (8 - shift)));
         }
-        carry = static_cast<uint8_t>((cur_byte & carry_mask) << carry_shift);
-        --i;
+        dest[i] = invert_bits ? static_cast<uint8_t>(~byte) : byte;
       }
     } else {
       if (invert_bits) {
@@ -221,8 +314,7 @@ Result<std::shared_ptr<Buffer>> CopyBitmap(MemoryPool* pool, const uint8_t* data
 }
 
 Result<std::shared_ptr<Buffer>> InvertBitmap(MemoryPool* pool, const uint8_t* data,
-                                             int64_t offset, int64_t length,
-                                             std::shared_ptr<Buffer>* out) {
+                                             int64_t offset, int64_t length) {
   return TransferBitmap<true>(pool, data, offset, length);
 }
 
@@ -256,33 +348,76 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
 
 namespace {
 
+struct BitmapAndOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left & right);
+  }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static int64_t CallAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                          int right_shift, int64_t nbytes, uint8_t* out) {
+    return BitmapAndAvx2(left, left_shift, right, right_shift, nbytes, out);
+  }
+#endif
+};
+
+struct BitmapOrOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left | right);
+  }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static int64_t CallAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                          int right_shift, int64_t nbytes, uint8_t* out) {
+    return BitmapOrAvx2(left, left_shift, right, right_shift, nbytes, out);
+  }
+#endif
+};
+
+struct BitmapXorOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left ^ right);
+  }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static int64_t CallAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                          int right_shift, int64_t nbytes, uint8_t* out) {
+    return BitmapXorAvx2(left, left_shift, right, right_shift, nbytes, out);
+  }
+#endif
+};
+
 template <typename Op>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
                      int64_t length) {
-  Op op;
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
-  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset);
+  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset % 8);
   left += left_offset / 8;
   right += right_offset / 8;
   out += out_offset / 8;
-  for (int64_t i = 0; i < nbytes; ++i) {
-    out[i] = op(left[i], right[i]);
+  int64_t i = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (UseBitmapAvx2(nbytes)) {
+    i = Op::CallAvx2(left, 0, right, 0, nbytes, out);
+  }
+#endif
+  for (; i < nbytes; ++i) {
+    out[i] = Op::Call(left[i], right[i]);
   }
 }
 
 template <typename Op>
-void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
-                       int64_t right_offset, uint8_t* out, int64_t out_offset,
-                       int64_t length) {
-  Op op;
+void BitwiseBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                     int64_t right_offset, uint8_t* out, int64_t out_offset,
+                     int64_t length) {
   auto left_reader = internal::BitmapReader(left, left_offset, length);
   auto right_reader = internal::BitmapReader(right, right_offset, length);
   auto writer = internal::BitmapWriter(out, out_offset, length);
   for (int64_t i = 0; i < length; ++i) {
-    if (op(left_reader.IsSet(), right_reader.IsSet())) {
+    if (Op::Call(left_reader.IsSet(), right_reader.IsSet())) {
       writer.Set();
     } else {
       writer.Clear();
@@ -294,29 +429,65 @@ void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t*
   writer.Finish();
 }
 
-template <typename BitOp, typename LogicalOp>
+template <typename Op>
+void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                       int64_t right_offset, uint8_t* out, int64_t out_offset,
+                       int64_t length) {
+  // Process the leading bits one at a time until the output is byte-aligned
+  const int64_t leading_bits = std::min(length, (8 - out_offset % 8) % 8);
+  BitwiseBitmapOp<Op>(left, left_offset, right, right_offset, out, out_offset,
+                      leading_bits);
+  left_offset += leading_bits;
+  right_offset += leading_bits;
+  out_offset += leading_bits;
+  length -= leading_bits;
+
+  // Then whole words, shifting each input to the output alignment
+  const uint8_t* left_data = left + left_offset / 8;
+  const uint8_t* right_data = right + right_offset / 8;
+  const int left_shift = static_cast<int>(left_offset % 8);
+  const int right_shift = static_cast<int>(right_offset % 8);
+  uint8_t* out_data = out + out_offset / 8;
+  const int64_t nbytes = length / 8;
+  int64_t i = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (UseBitmapAvx2(nbytes)) {
+    i = Op::CallAvx2(left_data, left_shift, right_data, right_shift, nbytes, out_data);
+  }
+#endif
+  for (; i + 8 <= nbytes; i += 8) {
+    StoreWord(out_data + i, Op::Call(LoadShiftedWord(left_data + i, left_shift),
+                                     LoadShiftedWord(right_data + i, right_shift)));
+  }
+
+  // And the trailing bits one at a time
+  BitwiseBitmapOp<Op>(left, left_offset + i * 8, right, right_offset + i * 8, out,
+                      out_offset + i * 8, length - i * 8);
+}
+
+template <typename Op>
 void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
   if ((out_offset % 8 == left_offset % 8) && (out_offset % 8 == right_offset % 8)) {
     // Fast case: can use bytewise AND
-    AlignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
-                           length);
+    AlignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset,
+                        length);
   } else {
     // Unaligned
-    UnalignedBitmapOp<LogicalOp>(left, left_offset, right, right_offset, dest, out_offset,
-                                 length);
+    UnalignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset,
+                          length);
   }
 }
 
-template <typename BitOp, typename LogicalOp>
+template <typename Op>
 Result<std::shared_ptr<Buffer>> BitmapOp(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
                                          int64_t out_offset) {
   const int64_t phys_bits = length + out_offset;
   ARROW_ASSIGN_OR_RAISE(auto out_buffer, AllocateEmptyBitmap(phys_bits, pool));
-  BitmapOp<BitOp, LogicalOp>(left, left_offset, right, right_offset, length, out_offset,
-                             out_buffer->mutable_data());
+  BitmapOp<Op>(left, left_offset, right, right_offset, length, out_offset,
+               out_buffer->mutable_data());
   return out_buffer;
 }
 
@@ -357,42 +528,39 @@ Result<std::shared_ptr<Buffer>> BitmapAnd(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset);
+  return BitmapOp<BitmapAndOp>(pool, left, left_offset, right, right_offset, length,
+                               out_offset);
 }
 
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<BitmapAndOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Result<std::shared_ptr<Buffer>> BitmapOr(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
                                          int64_t out_offset) {
-  return BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset);
+  return BitmapOp<BitmapOrOp>(pool, left, left_offset, right, right_offset, length,
+                              out_offset);
 }
 
 void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<BitmapOrOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Result<std::shared_ptr<Buffer>> BitmapXor(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset);
+  return BitmapOp<BitmapXorOp>(pool, left, left_offset, right, right_offset, length,
+                               out_offset);
 }
 
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<BitmapXorOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Result<std::shared_ptr<Buffer>> BitmapAllButOne(MemoryPool* pool, int64_t length,
@@ -300,6 +300,21 @@ static inline int CountTrailingZeros(uint64_t value) {
 #endif
 }
 
+// Returns the number of set bits in a 64-bit word
+static inline int PopCount(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_popcountll(value);
+#elif defined(_MSC_VER)
+  return static_cast<int>(__popcnt64(value));
+#else
+  int count = 0;
+  for (int i = 0; i < 8; ++i) {
+    count += kBytePopcount[(value >> (i * 8)) & 0xFF];
+  }
+  return count;
+#endif
+}
+
 // Returns the minimum number of bits needed to represent an unsigned value
 static inline int NumRequiredBits(uint64_t x) { return 64 - CountLeadingZeros(x); }
 
@@ -492,6 +507,41 @@ static inline void SetBitsTo(uint8_t* bits, int64_t start_offset, int64_t length
   bits[bytes_end - 1] |= static_cast<uint8_t>(fill_byte & ~last_byte_mask);
 }
 
+/// \brief Write the `length` (at most 32) low-order bits of `word` to a bitmap
+///
+/// Bits preceding `start_offset` are preserved, the remaining bits of the last
+/// byte written are cleared.
+static inline void SetBitsFromWord(uint8_t* bits, int64_t start_offset, uint32_t word,
+                                   int length) {
+  if (length == 0) return;
+
+  uint8_t* cur = bits + start_offset / 8;
+  const int bit_offset = static_cast<int>(start_offset % 8);
+  const uint64_t masked_word =
+      static_cast<uint64_t>(word) & ((static_cast<uint64_t>(1) << length) - 1);
+  const uint64_t preceding_bits = *cur & kPrecedingBitmask[bit_offset];
+  const uint64_t out = ToLittleEndian((masked_word << bit_offset) | preceding_bits);
+  std::memcpy(cur, &out, static_cast<size_t>(BytesForBits(bit_offset + length)));
+}
+
+/// \brief Read the `length` (at most 64) bits of a bitmap from `start_offset`
+/// as the low-order bits of a word, the other bits being cleared
+static inline uint64_t GetBitsAsWord(const uint8_t* bits, int64_t start_offset,
+                                     int length) {
+  if (length == 0) return 0;
+
+  const uint8_t* cur = bits + start_offset / 8;
+  const int bit_offset = static_cast<int>(start_offset % 8);
+  const int64_t num_bytes = BytesForBits(bit_offset + length);
+  uint64_t word = 0;
+  std::memcpy(&word, cur, static_cast<size_t>(std::min<int64_t>(num_bytes, 8)));
+  word = FromLittleEndian(word) >> bit_offset;
+  if (num_bytes > 8) {
+    word |= static_cast<uint64_t>(cur[8]) << (64 - bit_offset);
+  }
+  return length == 64 ? word : word & ((static_cast<uint64_t>(1) << length) - 1);
+}
+
 /// \brief Convert vector of bytes to bitmap buffer
 ARROW_EXPORT
 Result<std::shared_ptr<Buffer>> BytesToBits(const std::vector<uint8_t>&,
@@ -844,6 +894,23 @@ Result<std::shared_ptr<Buffer>> InvertBitmap(MemoryPool* pool, const uint8_t* bi
 ARROW_EXPORT
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length);
 
+/// Pack bytes into a bitmap, setting a bit for each non-zero byte and clearing
+/// it for each zero byte
+///
+/// Once the destination is byte-aligned, eight bytes are packed at a time with
+/// word arithmetic rather than bit by bit.
+///
+/// \param[in] bytes the source bytes
+/// \param[in] length the number of bytes to pack
+/// \param[out] bitmap the destination, must have space for at least
+/// (offset + length) bits
+/// \param[in] offset bit offset into the destination
+///
+/// \return The number of non-zero bytes
+ARROW_EXPORT
+int64_t PackBytesToBitmap(const uint8_t* bytes, int64_t length, uint8_t* bitmap,
+                          int64_t offset);
+
 class ARROW_EXPORT Bitmap : public util::ToStringOstreamable<Bitmap>,
                             public util::EqualityComparable<Bitmap> {
  public:
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/util/bit_util_avx2.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Bitmaps are little-endian within bytes and the 64-bit lanes are
+// little-endian too, so the 256 bits starting `shift` bits into `data` are
+// the lanes loaded at `data` shifted right by `shift`, ORed with the lanes
+// loaded one byte further shifted left by `8 - shift`: both loads put the
+// same bits at the same positions, except for the top `shift` bits of each
+// lane, which only the second one has.
+class ShiftedLoader {
+ public:
+  explicit ShiftedLoader(int shift)
+      : right_(_mm_cvtsi32_si128(shift)), left_(_mm_cvtsi32_si128(8 - shift)) {}
+
+  __m256i Load(const uint8_t* data) const {
+    const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i high =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 1));
+    return _mm256_or_si256(_mm256_srl_epi64(low, right_), _mm256_sll_epi64(high, left_));
+  }
+
+ private:
+  const __m128i right_;
+  const __m128i left_;
+};
+
+struct AndOp {
+  static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_and_si256(left, right);
+  }
+};
+
+struct OrOp {
+  static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_or_si256(left, right);
+  }
+};
+
+struct XorOp {
+  static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_xor_si256(left, right);
+  }
+};
+
+template <typename Op>
+int64_t BinaryBitmapOpAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                           int right_shift, int64_t nbytes, uint8_t* out) {
+  const ShiftedLoader left_loader(left_shift);
+  const ShiftedLoader right_loader(right_shift);
+  int64_t i = 0;
+  for (; i + 32 < nbytes; i += 32) {
+    const __m256i result =
+        Op::Call(left_loader.Load(left + i), right_loader.Load(right + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), result);
+  }
+  return i;
+}
+
+int64_t TransferBitmapAvx2(const uint8_t* data, int shift, __m256i xor_mask,
+                           int64_t nbytes, uint8_t* out) {
+  const ShiftedLoader loader(shift);
+  int64_t i = 0;
+  for (; i + 32 < nbytes; i += 32) {
+    const __m256i result = _mm256_xor_si256(loader.Load(data + i), xor_mask);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), result);
+  }
+  return i;
+}
+
+}  // namespace
+
+int64_t BitmapAndAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                      int right_shift, int64_t nbytes, uint8_t* out) {
+  return BinaryBitmapOpAvx2<AndOp>(left, left_shift, right, right_shift, nbytes, out);
+}
+
+int64_t BitmapOrAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                     int right_shift, int64_t nbytes, uint8_t* out) {
+  return BinaryBitmapOpAvx2<OrOp>(left, left_shift, right, right_shift, nbytes, out);
+}
+
+int64_t BitmapXorAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                      int right_shift, int64_t nbytes, uint8_t* out) {
+  return BinaryBitmapOpAvx2<XorOp>(left, left_shift, right, right_shift, nbytes, out);
+}
+
+int64_t CopyBitmapAvx2(const uint8_t* data, int shift, int64_t nbytes, uint8_t* out) {
+  return TransferBitmapAvx2(data, shift, _mm256_setzero_si256(), nbytes, out);
+}
+
+int64_t InvertBitmapAvx2(const uint8_t* data, int shift, int64_t nbytes, uint8_t* out) {
+  return TransferBitmapAvx2(data, shift, _mm256_set1_epi8(-1), nbytes, out);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief AVX2 implementations of the inner loops of BitmapAnd(), BitmapOr(),
+/// BitmapXor(), CopyBitmap() and InvertBitmap()
+///
+/// The output starts at a byte boundary of `out`, while each input starts
+/// `shift` (0 to 7) bits into its first byte.  `nbytes` whole output bytes
+/// are wanted, but the kernels only write whole 32-byte blocks and read one
+/// input byte past each block, so they stop at least one byte short of
+/// `nbytes`.  They return the number of output bytes written; the caller
+/// finishes the rest.
+///
+/// Only available if ARROW_HAVE_RUNTIME_AVX2 is defined.  The caller must
+/// check that the running CPU supports AVX2.
+ARROW_EXPORT
+int64_t BitmapAndAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                      int right_shift, int64_t nbytes, uint8_t* out);
+
+ARROW_EXPORT
+int64_t BitmapOrAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                     int right_shift, int64_t nbytes, uint8_t* out);
+
+ARROW_EXPORT
+int64_t BitmapXorAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                      int right_shift, int64_t nbytes, uint8_t* out);
+
+ARROW_EXPORT
+int64_t CopyBitmapAvx2(const uint8_t* data, int shift, int64_t nbytes, uint8_t* out);
+
+ARROW_EXPORT
+int64_t InvertBitmapAvx2(const uint8_t* data, int shift, int64_t nbytes, uint8_t* out);
+
+}  // namespace internal
+}  // namespace arrow
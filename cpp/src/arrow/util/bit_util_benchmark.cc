@@ -28,6 +28,14 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/cpu_info.h"
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bpacking_avx2.h"
+#endif
+#if defined(ARROW_HAVE_NEON)
+#include "arrow/util/bpacking_neon.h"
+#endif
 
 namespace arrow {
 
@@ -128,6 +136,14 @@ static void BenchmarkBitmapAnd(benchmark::State& state) {
   });
 }
 
+static void BenchmarkBitmapOr(benchmark::State& state) {
+  BenchmarkAndImpl(state, [](const internal::Bitmap(&bitmaps)[2], internal::Bitmap* out) {
+    internal::BitmapOr(bitmaps[0].buffer()->data(), bitmaps[0].offset(),
+                       bitmaps[1].buffer()->data(), bitmaps[1].offset(),
+                       bitmaps[0].length(), 0, out->buffer()->mutable_data());
+  });
+}
+
 static void BenchmarkBitmapVisitBitsetAnd(benchmark::State& state) {
   BenchmarkAndImpl(state, [](const internal::Bitmap(&bitmaps)[2], internal::Bitmap* out) {
     int64_t i = 0;
@@ -324,7 +340,25 @@ static void VisitBitsUnrolled(benchmark::State& state) {
 
 constexpr int64_t kBufferSize = 1024 * 8;
 
-template <int64_t Offset = 0>
+// state.range(0) is the number of bytes to pack, e.g. valid_bytes
+static void PackBytesToBitmap(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(nbytes);
+  std::vector<uint8_t> bytes(buffer->data(), buffer->data() + nbytes);
+  for (auto& byte : bytes) {
+    byte &= 1;
+  }
+  auto bitmap = *AllocateEmptyBitmap(nbytes);
+
+  for (auto _ : state) {
+    auto num_set = internal::PackBytesToBitmap(bytes.data(), nbytes,
+                                               bitmap->mutable_data(), 0);
+    benchmark::DoNotOptimize(num_set);
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+}
+
+template <int64_t Offset = 0, int64_t DestOffset = 0>
 static void CopyBitmap(benchmark::State& state) {  // NOLINT non-const reference
   const int64_t buffer_size = state.range(0);
   const int64_t bits_size = buffer_size * 8;
@@ -334,10 +368,10 @@ static void CopyBitmap(benchmark::State& state) {  // NOLINT non-const reference
   const int64_t offset = Offset;
   const int64_t length = bits_size - offset;
 
-  auto copy = *AllocateEmptyBitmap(length);
+  auto copy = *AllocateEmptyBitmap(length + DestOffset);
 
   for (auto _ : state) {
-    internal::CopyBitmap(src, offset, length, copy->mutable_data(), 0, false);
+    internal::CopyBitmap(src, offset, length, copy->mutable_data(), DestOffset, false);
   }
 
   state.SetBytesProcessed(state.iterations() * buffer_size);
@@ -353,6 +387,12 @@ static void CopyBitmapWithOffset(benchmark::State& state) {  // NOLINT non-const
   CopyBitmap<4>(state);
 }
 
+// Source and destination offsets are not byte aligned the same way
+static void CopyBitmapWithOffsets(
+    benchmark::State& state) {  // NOLINT non-const reference
+  CopyBitmap<4, 3>(state);
+}
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 static void ReferenceNaiveBitmapReader(benchmark::State& state) {
   BenchmarkBitmapReader<NaiveBitmapReader>(state, state.range(0));
@@ -377,18 +417,70 @@ BENCHMARK(BitmapWriter)->Arg(kBufferSize);
 BENCHMARK(FirstTimeBitmapWriter)->Arg(kBufferSize);
 BENCHMARK(GenerateBits)->Arg(kBufferSize);
 BENCHMARK(GenerateBitsUnrolled)->Arg(kBufferSize);
+BENCHMARK(PackBytesToBitmap)->Arg(kBufferSize);
 
 BENCHMARK(CopyBitmapWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffset)->Arg(kBufferSize);
+BENCHMARK(CopyBitmapWithOffsets)->Arg(kBufferSize);
 
 #define AND_BENCHMARK_RANGES                      \
   {                                               \
     {kBufferSize * 4, kBufferSize * 16}, { 0, 2 } \
   }
 BENCHMARK(BenchmarkBitmapAnd)->Ranges(AND_BENCHMARK_RANGES);
+BENCHMARK(BenchmarkBitmapOr)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitBitsetAnd)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt8And)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt64And)->Ranges(AND_BENCHMARK_RANGES);
 
+using Unpack32Func = int (*)(const uint32_t*, uint32_t*, int, int);
+
+// state.range(0) is the bit width of the unpacked values
+static void BenchmarkUnpack32(benchmark::State& state, Unpack32Func unpack) {
+  constexpr int kNumValues = 32 * 1024;
+  const int num_bits = static_cast<int>(state.range(0));
+  std::vector<uint32_t> packed(kNumValues);
+  random_bytes(packed.size() * sizeof(uint32_t), 0,
+               reinterpret_cast<uint8_t*>(packed.data()));
+  std::vector<uint32_t> unpacked(kNumValues);
+
+  for (auto _ : state) {
+    unpack(packed.data(), unpacked.data(), kNumValues, num_bits);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void Unpack32(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, internal::unpack32);
+}
+
+static void Unpack32Default(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, internal::unpack32_default);
+}
+
+BENCHMARK(Unpack32)->DenseRange(1, 32, 1);
+BENCHMARK(Unpack32Default)->DenseRange(1, 32, 1);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+static void Unpack32Avx2(benchmark::State& state) {  // NOLINT non-const reference
+  if (!internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2)) {
+    state.SkipWithError("AVX2 not supported");
+    return;
+  }
+  BenchmarkUnpack32(state, internal::unpack32_avx2);
+}
+
+BENCHMARK(Unpack32Avx2)->DenseRange(1, 32, 1);
+#endif
+
+#if defined(ARROW_HAVE_NEON)
+static void Unpack32Neon(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, internal::unpack32_neon);
+}
+
+BENCHMARK(Unpack32Neon)->DenseRange(1, 32, 1);
+#endif
+
 }  // namespace BitUtil
 }  // namespace arrow
@@ -34,7 +34,14 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
 #include "arrow/util/cpu_info.h"
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bpacking_avx2.h"
+#endif
+#if defined(ARROW_HAVE_NEON)
+#include "arrow/util/bpacking_neon.h"
+#endif
 
 namespace arrow {
 
@@ -629,6 +636,43 @@ class BitmapOp : public TestBase {
       }
     }
   }
+
+  // Bitmaps long enough to go through the word-at-a-time (and SIMD) loops
+  void TestRandom(const BitmapOperation& op, std::function<bool(bool, bool)> expected) {
+    const int64_t kNumBytes = 1000;
+    std::vector<uint8_t> left(kNumBytes), right(kNumBytes), out(kNumBytes);
+    random_bytes(kNumBytes, 0, left.data());
+    random_bytes(kNumBytes, 1, right.data());
+
+    for (int64_t length : {63, 64, 65, 300, 7777}) {
+      for (int64_t left_offset : {0, 3, 8, 77}) {
+        for (int64_t right_offset : {0, 5, 8, 101}) {
+          for (int64_t out_offset : {0, 3, 13}) {
+            random_bytes(kNumBytes, 2, out.data());
+            const std::vector<uint8_t> orig_out = out;
+            ASSERT_OK(op.Call(left.data(), left_offset, right.data(), right_offset,
+                              length, out_offset, out.data()));
+            for (int64_t i = 0; i < length; ++i) {
+              ASSERT_EQ(BitUtil::GetBit(out.data(), out_offset + i),
+                        expected(BitUtil::GetBit(left.data(), left_offset + i),
+                                 BitUtil::GetBit(right.data(), right_offset + i)))
+                  << "length " << length << ", offsets " << left_offset << " "
+                  << right_offset << " " << out_offset << ", bit " << i;
+            }
+            if (left_offset % 8 != out_offset % 8 || right_offset % 8 != out_offset % 8) {
+              // The unaligned case leaves the bits around the output range alone
+              for (int64_t i = 0; i < kNumBytes * 8; ++i) {
+                if (i < out_offset || i >= out_offset + length) {
+                  ASSERT_EQ(BitUtil::GetBit(out.data(), i),
+                            BitUtil::GetBit(orig_out.data(), i));
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
 };
 
 TEST_F(BitmapOp, And) {
@@ -661,6 +705,18 @@ TEST_F(BitmapOp, Xor) {
   TestUnaligned(op, left, right, result);
 }
 
+TEST_F(BitmapOp, RandomAnd) {
+  TestRandom(BitmapAndOp(), [](bool left, bool right) { return left && right; });
+}
+
+TEST_F(BitmapOp, RandomOr) {
+  TestRandom(BitmapOrOp(), [](bool left, bool right) { return left || right; });
+}
+
+TEST_F(BitmapOp, RandomXor) {
+  TestRandom(BitmapXorOp(), [](bool left, bool right) { return left != right; });
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -694,6 +750,33 @@ TEST(BitUtilTests, TestCountSetBits) {
   }
 }
 
+TEST(BitUtilTests, TestPackBytesToBitmap) {
+  const int kNumBytes = 1000;
+  std::vector<uint8_t> bytes(kNumBytes);
+  random_bytes(kNumBytes, 0, bytes.data());
+  // Mostly zeros and ones, as produced by valid_bytes, but any non-zero byte is set
+  for (int i = 0; i < kNumBytes; ++i) {
+    bytes[i] = bytes[i] < 96 ? 0 : (bytes[i] < 224 ? 1 : bytes[i]);
+  }
+
+  for (const int64_t offset : {0, 1, 7, 8, 13, 64}) {
+    for (const int64_t length : {0, 1, 7, 8, 9, 63, 64, 65, kNumBytes - 1}) {
+      // The bits outside [offset, offset + length) must be preserved
+      std::vector<uint8_t> bitmap(BitUtil::BytesForBits(offset + length + 8), 0xa5);
+      std::vector<uint8_t> expected = bitmap;
+      int64_t expected_num_set = 0;
+      for (int64_t i = 0; i < length; ++i) {
+        BitUtil::SetBitTo(expected.data(), offset + i, bytes[i] != 0);
+        expected_num_set += bytes[i] != 0;
+      }
+
+      ASSERT_EQ(expected_num_set,
+                internal::PackBytesToBitmap(bytes.data(), length, bitmap.data(), offset));
+      ASSERT_EQ(expected, bitmap) << "offset " << offset << ", length " << length;
+    }
+  }
+}
+
 TEST(BitUtilTests, TestSetBitsTo) {
   using BitUtil::SetBitsTo;
   for (const auto fill_byte_int : {0x00, 0xff}) {
@@ -1064,6 +1147,96 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
+TEST(BitStreamUtil, ZigZagEncodedValues) {
+  // Signed values are mapped to unsigned ones as 0, -1, 1, -2, 2...
+  for (int32_t v : {0, -1, 1, -2, 2, -64}) {
+    uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLength] = {};
+    BitUtil::BitWriter writer(buffer, sizeof(buffer));
+    writer.PutZigZagVlqInt(v);
+    writer.Flush();
+    EXPECT_EQ(v < 0 ? -2 * v - 1 : 2 * v, buffer[0]);
+    EXPECT_EQ(1, writer.bytes_written());
+  }
+  for (int64_t v : {0, -1, 1, -2, 2, -64}) {
+    uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+    BitUtil::BitWriter writer(buffer, sizeof(buffer));
+    writer.PutZigZagVlqInt(v);
+    writer.Flush();
+    EXPECT_EQ(v < 0 ? -2 * v - 1 : 2 * v, buffer[0]);
+    EXPECT_EQ(1, writer.bytes_written());
+  }
+}
+
+using Unpack32Func = int (*)(const uint32_t*, uint32_t*, int, int);
+
+static void TestUnpack32(Unpack32Func unpack) {
+  constexpr int kNumValues = 32 * 5;
+  // Unpacking reads whole 32-bit words, and the input may not be aligned
+  std::vector<uint8_t> packed(kNumValues * sizeof(uint32_t) + 1);
+  random_bytes(packed.size(), 0, packed.data());
+  const auto in = reinterpret_cast<const uint32_t*>(packed.data() + 1);
+
+  for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+    SCOPED_TRACE("num_bits = " + std::to_string(num_bits));
+    std::vector<uint32_t> out(kNumValues);
+    // The batch size is rounded down to a multiple of 32
+    ASSERT_EQ(kNumValues, unpack(in, out.data(), kNumValues + 31, num_bits));
+
+    BitUtil::BitReader reader(packed.data() + 1, kNumValues * num_bits / 8);
+    for (int i = 0; i < kNumValues; ++i) {
+      uint32_t expected = 0;
+      // BitReader::GetValue() only reads up to 32 bits, in two parts
+      if (num_bits > 0) {
+        uint32_t low = 0, high = 0;
+        const int low_bits = std::min(num_bits, 16);
+        ASSERT_TRUE(reader.GetValue(low_bits, &low));
+        if (num_bits > low_bits) {
+          ASSERT_TRUE(reader.GetValue(num_bits - low_bits, &high));
+        }
+        expected = low | (high << low_bits);
+      }
+      ASSERT_EQ(expected, out[i]) << "at index " << i;
+    }
+  }
+}
+
+TEST(BitStreamUtil, Unpack32) { TestUnpack32(internal::unpack32); }
+
+TEST(BitStreamUtil, Unpack32Default) { TestUnpack32(internal::unpack32_default); }
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+TEST(BitStreamUtil, Unpack32Avx2) {
+  if (!internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2)) {
+    return;
+  }
+  TestUnpack32(internal::unpack32_avx2);
+}
+#endif
+
+#if defined(ARROW_HAVE_NEON)
+TEST(BitStreamUtil, Unpack32Neon) { TestUnpack32(internal::unpack32_neon); }
+#endif
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
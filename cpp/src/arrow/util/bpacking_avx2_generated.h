@@ -0,0 +1,1907 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+//
+// Automatically generated file; DO NOT EDIT.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace internal {
+namespace avx2 {
+
+inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {
+  memset(out, 0x0, 32 * sizeof(*out));
+
+  return in;
+}
+
+inline const uint32_t* unpack1_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x1);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(15, 14, 13, 12, 11, 10, 9, 8));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(23, 22, 21, 20, 19, 18, 17, 16));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(31, 30, 29, 28, 27, 26, 25, 24));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 1;
+}
+
+inline const uint32_t* unpack2_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x3);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(14, 12, 10, 8, 6, 4, 2, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(30, 28, 26, 24, 22, 20, 18, 16));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(14, 12, 10, 8, 6, 4, 2, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(30, 28, 26, 24, 22, 20, 18, 16));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 2;
+}
+
+inline const uint32_t* unpack3_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x7);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(21, 18, 15, 12, 9, 6, 3, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(13, 10, 7, 4, 1, 30, 27, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 32, 32, 2, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(5, 2, 31, 28, 25, 22, 19, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 0, 0, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 1, 32, 32, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(29, 26, 23, 20, 17, 14, 11, 8));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 3;
+}
+
+inline const uint32_t* unpack4_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0xf);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(28, 24, 20, 16, 12, 8, 4, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(28, 24, 20, 16, 12, 8, 4, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(28, 24, 20, 16, 12, 8, 4, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(28, 24, 20, 16, 12, 8, 4, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 4;
+}
+
+inline const uint32_t* unpack5_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x1f);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 0, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(3, 30, 25, 20, 15, 10, 5, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 0, 0, 0, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 2, 32, 32, 32, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(11, 6, 1, 28, 23, 18, 13, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 0, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 4, 32, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(19, 14, 9, 4, 31, 26, 21, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 32, 1, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(27, 22, 17, 12, 7, 2, 29, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 1, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 32, 32, 32, 3, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 5;
+}
+
+inline const uint32_t* unpack6_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x3f);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(10, 4, 30, 24, 18, 12, 6, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 0, 0, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 2, 32, 32, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(26, 20, 14, 8, 2, 28, 22, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 32, 32, 4, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 0, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(10, 4, 30, 24, 18, 12, 6, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 0, 0, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 2, 32, 32, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(26, 20, 14, 8, 2, 28, 22, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 32, 32, 4, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 6;
+}
+
+inline const uint32_t* unpack7_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x7f);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 0, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(17, 10, 3, 28, 21, 14, 7, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 0, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 4, 32, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 1, 1, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(9, 2, 27, 20, 13, 6, 31, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 1, 1, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 5, 32, 32, 32, 1, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 1, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(1, 26, 19, 12, 5, 30, 23, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 1, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 6, 32, 32, 32, 2, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(25, 18, 11, 4, 29, 22, 15, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 32, 3, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 7;
+}
+
+inline const uint32_t* unpack8_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0xff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(24, 16, 8, 0, 24, 16, 8, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(24, 16, 8, 0, 24, 16, 8, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(24, 16, 8, 0, 24, 16, 8, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(24, 16, 8, 0, 24, 16, 8, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 8;
+}
+
+inline const uint32_t* unpack9_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x1ff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(31, 22, 13, 4, 27, 18, 9, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(1, 32, 32, 32, 5, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 1, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(7, 30, 21, 12, 3, 26, 17, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 1, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 2, 32, 32, 32, 6, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 1, 1, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(15, 6, 29, 20, 11, 2, 25, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 1, 1, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 3, 32, 32, 32, 7, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 2, 1, 1, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(23, 14, 5, 28, 19, 10, 1, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 2, 1, 1, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 4, 32, 32, 32, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 9;
+}
+
+inline const uint32_t* unpack10_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x3ff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(6, 28, 18, 8, 30, 20, 10, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 1, 1, 1, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 4, 32, 32, 2, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 2, 1, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(22, 12, 2, 24, 14, 4, 26, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 2, 1, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 8, 32, 32, 6, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 1, 1, 1, 0, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(6, 28, 18, 8, 30, 20, 10, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 1, 1, 1, 0, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 4, 32, 32, 2, 32, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 2, 1, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(22, 12, 2, 24, 14, 4, 26, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 2, 1, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 32, 8, 32, 32, 6, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 10;
+}
+
+inline const uint32_t* unpack11_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x7ff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(13, 2, 23, 12, 1, 22, 11, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 9, 32, 32, 10, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 2),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 2, 2, 2, 1, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(5, 26, 15, 4, 25, 14, 3, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 2, 2, 2, 1, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 6, 32, 32, 7, 32, 32, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 2, 1, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(29, 18, 7, 28, 17, 6, 27, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 2, 1, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(3, 32, 32, 4, 32, 32, 5, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(21, 10, 31, 20, 9, 30, 19, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 9),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 1, 32, 32, 2, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 11;
+}
+
+inline const uint32_t* unpack12_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0xfff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(20, 8, 28, 16, 4, 24, 12, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 4, 32, 32, 8, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(20, 8, 28, 16, 4, 24, 12, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 4, 32, 32, 8, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(20, 8, 28, 16, 4, 24, 12, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 4, 32, 32, 8, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 9),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(20, 8, 28, 16, 4, 24, 12, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 10),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 1, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 4, 32, 32, 8, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 12;
+}
+
+inline const uint32_t* unpack13_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x1fff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(2, 2, 2, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(27, 14, 1, 20, 7, 26, 13, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(2, 2, 2, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(5, 32, 32, 12, 32, 6, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 2, 2, 1, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(3, 22, 9, 28, 15, 2, 21, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 2, 2, 1, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 10, 32, 4, 32, 32, 11, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 2, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(11, 30, 17, 4, 23, 10, 29, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 2, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 2, 32, 32, 9, 32, 3, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 9),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(19, 6, 25, 12, 31, 18, 5, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 10),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 7, 32, 1, 32, 32, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 13;
+}
+
+inline const uint32_t* unpack14_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x3fff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 2, 2, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(2, 20, 6, 24, 10, 28, 14, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 2, 2, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 12, 32, 8, 32, 4, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(18, 4, 22, 8, 26, 12, 30, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 10, 32, 6, 32, 2, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 2, 2, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(2, 20, 6, 24, 10, 28, 14, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 2, 2, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 12, 32, 8, 32, 4, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 10),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(18, 4, 22, 8, 26, 12, 30, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 11),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 10, 32, 6, 32, 2, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 14;
+}
+
+inline const uint32_t* unpack15_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x7fff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 2, 2, 1, 1, 0, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(9, 26, 11, 28, 13, 30, 15, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 2, 2, 1, 1, 0, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 6, 32, 4, 32, 2, 32, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 3),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(1, 18, 3, 20, 5, 22, 7, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 14, 32, 12, 32, 10, 32, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(25, 10, 27, 12, 29, 14, 31, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(7, 32, 5, 32, 3, 32, 1, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 11),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(17, 2, 19, 4, 21, 6, 23, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 12),
+                                 _mm256_set_epi32(0, 0, 0, 0, 0, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 32, 13, 32, 11, 32, 9, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 15;
+}
+
+inline const uint32_t* unpack16_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0xffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(16, 0, 16, 0, 16, 0, 16, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(16, 0, 16, 0, 16, 0, 16, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(16, 0, 16, 0, 16, 0, 16, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 12),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(16, 0, 16, 0, 16, 0, 16, 0));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 16;
+}
+
+inline const uint32_t* unpack17_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x1ffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(23, 6, 21, 4, 19, 2, 17, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(9, 32, 11, 32, 13, 32, 15, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(31, 14, 29, 12, 27, 10, 25, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(1, 32, 3, 32, 5, 32, 7, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(7, 22, 5, 20, 3, 18, 1, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 9),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 10, 32, 12, 32, 14, 32, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 12),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(15, 30, 13, 28, 11, 26, 9, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 13),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 2, 32, 4, 32, 6, 32, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 17;
+}
+
+inline const uint32_t* unpack18_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x3ffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(30, 12, 26, 8, 22, 4, 18, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(2, 32, 6, 32, 10, 32, 14, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(14, 28, 10, 24, 6, 20, 2, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 4, 32, 8, 32, 12, 32, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 9),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(30, 12, 26, 8, 22, 4, 18, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 10),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(2, 32, 6, 32, 10, 32, 14, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 13),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(14, 28, 10, 24, 6, 20, 2, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 14),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 4, 32, 8, 32, 12, 32, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 18;
+}
+
+inline const uint32_t* unpack19_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x7ffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 2, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(5, 18, 31, 12, 25, 6, 19, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 2, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 14, 1, 32, 7, 32, 13, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 4),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 4, 3, 3, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(29, 10, 23, 4, 17, 30, 11, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 4, 3, 3, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(3, 32, 9, 32, 15, 2, 32, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 9),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 4, 3, 2, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(21, 2, 15, 28, 9, 22, 3, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 10),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 4, 3, 2, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(11, 32, 17, 4, 32, 10, 32, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 14),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(13, 26, 7, 20, 1, 14, 27, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 15),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 6, 32, 12, 32, 18, 5, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 19;
+}
+
+inline const uint32_t* unpack20_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0xfffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(12, 24, 4, 16, 28, 8, 20, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 8, 32, 16, 4, 32, 12, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(12, 24, 4, 16, 28, 8, 20, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 8, 32, 16, 4, 32, 12, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 10),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(12, 24, 4, 16, 28, 8, 20, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 11),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 8, 32, 16, 4, 32, 12, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 15),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(12, 24, 4, 16, 28, 8, 20, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 16),
+                                 _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 8, 32, 16, 4, 32, 12, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 20;
+}
+
+inline const uint32_t* unpack21_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x1fffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(19, 30, 9, 20, 31, 10, 21, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 3, 3, 2, 1, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(13, 2, 32, 12, 1, 32, 11, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 4, 3, 2, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(27, 6, 17, 28, 7, 18, 29, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 4, 3, 2, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(5, 32, 15, 4, 32, 14, 3, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 10),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(3, 14, 25, 4, 15, 26, 5, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 11),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 18, 7, 32, 17, 6, 32, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 15),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 4, 3, 2, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(11, 22, 1, 12, 23, 2, 13, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 16),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 4, 3, 2, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 10, 32, 20, 9, 32, 19, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 21;
+}
+
+inline const uint32_t* unpack22_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x3fffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 4, 3, 2, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(26, 4, 14, 24, 2, 12, 22, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 4, 3, 2, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(6, 32, 18, 8, 32, 20, 10, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(10, 20, 30, 8, 18, 28, 6, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 12, 2, 32, 14, 4, 32, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 11),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(4, 4, 3, 2, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(26, 4, 14, 24, 2, 12, 22, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 12),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(4, 4, 3, 2, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(6, 32, 18, 8, 32, 20, 10, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 16),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(10, 20, 30, 8, 18, 28, 6, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 17),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 12, 2, 32, 14, 4, 32, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 22;
+}
+
+inline const uint32_t* unpack23_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x7fffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 2, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(1, 10, 19, 28, 5, 14, 23, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 2, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 22, 13, 4, 32, 18, 9, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 5),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 5, 4, 3, 2, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(25, 2, 11, 20, 29, 6, 15, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 5, 4, 3, 2, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(7, 32, 21, 12, 3, 32, 17, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 11),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 4, 3, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(17, 26, 3, 12, 21, 30, 7, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 12),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 4, 3, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(15, 6, 32, 20, 11, 2, 32, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 17),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(9, 18, 27, 4, 13, 22, 31, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 18),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 14, 5, 32, 19, 10, 1, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 23;
+}
+
+inline const uint32_t* unpack24_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0xffffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(8, 16, 24, 0, 8, 16, 24, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 16, 8, 32, 32, 16, 8, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(8, 16, 24, 0, 8, 16, 24, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 16, 8, 32, 32, 16, 8, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 12),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(8, 16, 24, 0, 8, 16, 24, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 13),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 16, 8, 32, 32, 16, 8, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 18),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(8, 16, 24, 0, 8, 16, 24, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 19),
+                                 _mm256_set_epi32(0, 0, 0, -1, -1, 0, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 16, 8, 32, 32, 16, 8, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 24;
+}
+
+inline const uint32_t* unpack25_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x1ffffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(15, 22, 29, 4, 11, 18, 25, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 3, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(17, 10, 3, 32, 21, 14, 7, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 4, 3, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(23, 30, 5, 12, 19, 26, 1, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 4, 3, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(9, 2, 32, 20, 13, 6, 32, 24));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 12),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 5, 4, 3, 2, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(31, 6, 13, 20, 27, 2, 9, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 13),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 5, 4, 3, 2, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(1, 32, 19, 12, 5, 32, 23, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 18),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(7, 14, 21, 28, 3, 10, 17, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 19),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 18, 11, 4, 32, 22, 15, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 25;
+}
+
+inline const uint32_t* unpack26_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x3ffffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(22, 28, 2, 8, 14, 20, 26, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(10, 4, 32, 24, 18, 12, 6, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(6, 12, 18, 24, 30, 4, 10, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 20, 14, 8, 2, 32, 22, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 13),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 4, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(22, 28, 2, 8, 14, 20, 26, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 14),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 4, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(10, 4, 32, 24, 18, 12, 6, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 19),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(6, 12, 18, 24, 30, 4, 10, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 20),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 20, 14, 8, 2, 32, 22, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 26;
+}
+
+inline const uint32_t* unpack27_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x7ffffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(5, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(29, 2, 7, 12, 17, 22, 27, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(5, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(3, 32, 25, 20, 15, 10, 5, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 6),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 4, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(21, 26, 31, 4, 9, 14, 19, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 4, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(11, 6, 1, 32, 23, 18, 13, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 13),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(13, 18, 23, 28, 1, 6, 11, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 14),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(19, 14, 9, 4, 32, 26, 21, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 20),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(5, 10, 15, 20, 25, 30, 3, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 21),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 22, 17, 12, 7, 2, 32, 24));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 27;
+}
+
+inline const uint32_t* unpack28_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0xfffffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(4, 8, 12, 16, 20, 24, 28, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 24, 20, 16, 12, 8, 4, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(4, 8, 12, 16, 20, 24, 28, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 24, 20, 16, 12, 8, 4, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 14),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(4, 8, 12, 16, 20, 24, 28, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 15),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 24, 20, 16, 12, 8, 4, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 21),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(4, 8, 12, 16, 20, 24, 28, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 22),
+                                 _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 24, 20, 16, 12, 8, 4, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 28;
+}
+
+inline const uint32_t* unpack29_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x1fffffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(11, 14, 17, 20, 23, 26, 29, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(21, 18, 15, 12, 9, 6, 3, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(19, 22, 25, 28, 31, 2, 5, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(13, 10, 7, 4, 1, 32, 27, 24));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 14),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 5, 4, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(27, 30, 1, 4, 7, 10, 13, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 15),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 5, 4, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(5, 2, 32, 28, 25, 22, 19, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 21),
+                                 _mm256_set_epi32(-1, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(3, 6, 9, 12, 15, 18, 21, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 22),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 26, 23, 20, 17, 14, 11, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 29;
+}
+
+inline const uint32_t* unpack30_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x3fffffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(18, 20, 22, 24, 26, 28, 30, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(14, 12, 10, 8, 6, 4, 2, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(-1, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(2, 4, 6, 8, 10, 12, 14, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 28, 26, 24, 22, 20, 18, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 15),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(18, 20, 22, 24, 26, 28, 30, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 16),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(14, 12, 10, 8, 6, 4, 2, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 22),
+                                 _mm256_set_epi32(-1, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(2, 4, 6, 8, 10, 12, 14, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 23),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 28, 26, 24, 22, 20, 18, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 30;
+}
+
+inline const uint32_t* unpack31_32(const uint32_t* in, uint32_t* out) {
+  __m256i reg_lo, reg_hi, reg_masks;
+
+  reg_masks = _mm256_set1_epi32(0x7fffffff);
+
+  // outs 0 to 7
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 0),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(25, 26, 27, 28, 29, 30, 31, 0));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 1),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 32));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 8 to 15
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 7),
+                                 _mm256_set_epi32(-1, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(17, 18, 19, 20, 21, 22, 23, 24));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 8),
+                                 _mm256_set_epi32(-1, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(15, 14, 13, 12, 11, 10, 9, 8));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 16 to 23
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 15),
+                                 _mm256_set_epi32(-1, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(9, 10, 11, 12, 13, 14, 15, 16));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 16),
+                                 _mm256_set_epi32(-1, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(23, 22, 21, 20, 19, 18, 17, 16));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  // outs 24 to 31
+  reg_lo = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 23),
+                                 _mm256_set_epi32(-1, -1, -1, -1, -1, -1, -1, -1));
+  reg_lo = _mm256_permutevar8x32_epi32(reg_lo, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_lo = _mm256_srlv_epi32(reg_lo, _mm256_set_epi32(1, 2, 3, 4, 5, 6, 7, 8));
+  reg_hi = _mm256_maskload_epi32(reinterpret_cast<const int*>(in + 24),
+                                 _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1));
+  reg_hi = _mm256_permutevar8x32_epi32(reg_hi, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  reg_hi = _mm256_sllv_epi32(reg_hi, _mm256_set_epi32(32, 30, 29, 28, 27, 26, 25, 24));
+  reg_lo = _mm256_or_si256(reg_lo, reg_hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24),
+                      _mm256_and_si256(reg_lo, reg_masks));
+
+  return in + 31;
+}
+
+inline const uint32_t* unpack32_32(const uint32_t* in, uint32_t* out) {
+  memcpy(out, in, 32 * sizeof(*out));
+  in += 32;
+
+  return in;
+}
+
+inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  int num_loops = batch_size / 32;
+
+  switch (num_bits) {
+    case 0:
+      for (int i = 0; i < num_loops; ++i) in = nullunpacker32(in, out + i * 32);
+      break;
+    case 1:
+      for (int i = 0; i < num_loops; ++i) in = unpack1_32(in, out + i * 32);
+      break;
+    case 2:
+      for (int i = 0; i < num_loops; ++i) in = unpack2_32(in, out + i * 32);
+      break;
+    case 3:
+      for (int i = 0; i < num_loops; ++i) in = unpack3_32(in, out + i * 32);
+      break;
+    case 4:
+      for (int i = 0; i < num_loops; ++i) in = unpack4_32(in, out + i * 32);
+      break;
+    case 5:
+      for (int i = 0; i < num_loops; ++i) in = unpack5_32(in, out + i * 32);
+      break;
+    case 6:
+      for (int i = 0; i < num_loops; ++i) in = unpack6_32(in, out + i * 32);
+      break;
+    case 7:
+      for (int i = 0; i < num_loops; ++i) in = unpack7_32(in, out + i * 32);
+      break;
+    case 8:
+      for (int i = 0; i < num_loops; ++i) in = unpack8_32(in, out + i * 32);
+      break;
+    case 9:
+      for (int i = 0; i < num_loops; ++i) in = unpack9_32(in, out + i * 32);
+      break;
+    case 10:
+      for (int i = 0; i < num_loops; ++i) in = unpack10_32(in, out + i * 32);
+      break;
+    case 11:
+      for (int i = 0; i < num_loops; ++i) in = unpack11_32(in, out + i * 32);
+      break;
+    case 12:
+      for (int i = 0; i < num_loops; ++i) in = unpack12_32(in, out + i * 32);
+      break;
+    case 13:
+      for (int i = 0; i < num_loops; ++i) in = unpack13_32(in, out + i * 32);
+      break;
+    case 14:
+      for (int i = 0; i < num_loops; ++i) in = unpack14_32(in, out + i * 32);
+      break;
+    case 15:
+      for (int i = 0; i < num_loops; ++i) in = unpack15_32(in, out + i * 32);
+      break;
+    case 16:
+      for (int i = 0; i < num_loops; ++i) in = unpack16_32(in, out + i * 32);
+      break;
+    case 17:
+      for (int i = 0; i < num_loops; ++i) in = unpack17_32(in, out + i * 32);
+      break;
+    case 18:
+      for (int i = 0; i < num_loops; ++i) in = unpack18_32(in, out + i * 32);
+      break;
+    case 19:
+      for (int i = 0; i < num_loops; ++i) in = unpack19_32(in, out + i * 32);
+      break;
+    case 20:
+      for (int i = 0; i < num_loops; ++i) in = unpack20_32(in, out + i * 32);
+      break;
+    case 21:
+      for (int i = 0; i < num_loops; ++i) in = unpack21_32(in, out + i * 32);
+      break;
+    case 22:
+      for (int i = 0; i < num_loops; ++i) in = unpack22_32(in, out + i * 32);
+      break;
+    case 23:
+      for (int i = 0; i < num_loops; ++i) in = unpack23_32(in, out + i * 32);
+      break;
+    case 24:
+      for (int i = 0; i < num_loops; ++i) in = unpack24_32(in, out + i * 32);
+      break;
+    case 25:
+      for (int i = 0; i < num_loops; ++i) in = unpack25_32(in, out + i * 32);
+      break;
+    case 26:
+      for (int i = 0; i < num_loops; ++i) in = unpack26_32(in, out + i * 32);
+      break;
+    case 27:
+      for (int i = 0; i < num_loops; ++i) in = unpack27_32(in, out + i * 32);
+      break;
+    case 28:
+      for (int i = 0; i < num_loops; ++i) in = unpack28_32(in, out + i * 32);
+      break;
+    case 29:
+      for (int i = 0; i < num_loops; ++i) in = unpack29_32(in, out + i * 32);
+      break;
+    case 30:
+      for (int i = 0; i < num_loops; ++i) in = unpack30_32(in, out + i * 32);
+      break;
+    case 31:
+      for (int i = 0; i < num_loops; ++i) in = unpack31_32(in, out + i * 32);
+      break;
+    case 32:
+      for (int i = 0; i < num_loops; ++i) in = unpack32_32(in, out + i * 32);
+      break;
+    default:
+      return 0;
+  }
+
+  return batch_size;
+}
+
+}  // namespace avx2
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,3597 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+//
+// Automatically generated file; DO NOT EDIT.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include <arm_neon.h>
+
+namespace arrow {
+namespace internal {
+namespace neon {
+
+inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {
+  memset(out, 0x0, 32 * sizeof(*out));
+
+  return in;
+}
+
+inline const uint32_t* unpack1_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x1);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -1, -2, -3};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_4[4] = {-4, -5, -6, -7};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_8[4] = {-8, -9, -10, -11};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_12[4] = {-12, -13, -14, -15};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_16[4] = {-16, -17, -18, -19};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_20[4] = {-20, -21, -22, -23};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_24[4] = {-24, -25, -26, -27};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_28[4] = {-28, -29, -30, -31};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 1;
+}
+
+inline const uint32_t* unpack2_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x3);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -2, -4, -6};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_4[4] = {-8, -10, -12, -14};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_8[4] = {-16, -18, -20, -22};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_12[4] = {-24, -26, -28, -30};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_16[4] = {0, -2, -4, -6};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_20[4] = {-8, -10, -12, -14};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_24[4] = {-16, -18, -20, -22};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_28[4] = {-24, -26, -28, -30};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 2;
+}
+
+inline const uint32_t* unpack3_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x7);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -3, -6, -9};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_4[4] = {-12, -15, -18, -21};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-24, -27, -30, -1};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 32, 2, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_12[4] = {-4, -7, -10, -13};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_16[4] = {-16, -19, -22, -25};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-28, -31, -2, -5};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 1, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 2);
+  const int32_t shifts_lo_24[4] = {-8, -11, -14, -17};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 2);
+  const int32_t shifts_lo_28[4] = {-20, -23, -26, -29};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 3;
+}
+
+inline const uint32_t* unpack4_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_masks;
+
+  reg_masks = vdupq_n_u32(0xf);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -4, -8, -12};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_4[4] = {-16, -20, -24, -28};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_8[4] = {0, -4, -8, -12};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_12[4] = {-16, -20, -24, -28};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 2);
+  const int32_t shifts_lo_16[4] = {0, -4, -8, -12};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 2);
+  const int32_t shifts_lo_20[4] = {-16, -20, -24, -28};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 3);
+  const int32_t shifts_lo_24[4] = {0, -4, -8, -12};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 3);
+  const int32_t shifts_lo_28[4] = {-16, -20, -24, -28};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 4;
+}
+
+inline const uint32_t* unpack5_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x1f);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -5, -10, -15};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-20, -25, -30, -3};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 32, 2, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_8[4] = {-8, -13, -18, -23};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-28, -1, -6, -11};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 2);
+  const int32_t shifts_hi_12[4] = {4, 32, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 2);
+  const int32_t shifts_lo_16[4] = {-16, -21, -26, -31};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 32, 32, 1};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 3);
+  const int32_t shifts_lo_20[4] = {-4, -9, -14, -19};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-24, -29, -2, -7};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 3, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 4);
+  const int32_t shifts_lo_28[4] = {-12, -17, -22, -27};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 5;
+}
+
+inline const uint32_t* unpack6_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x3f);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -6, -12, -18};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-24, -30, -4, -10};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 2, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-16, -22, -28, -2};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 32, 4, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 2);
+  const int32_t shifts_lo_12[4] = {-8, -14, -20, -26};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 3);
+  const int32_t shifts_lo_16[4] = {0, -6, -12, -18};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-24, -30, -4, -10};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 2, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-16, -22, -28, -2};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 32, 4, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 5);
+  const int32_t shifts_lo_28[4] = {-8, -14, -20, -26};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 6;
+}
+
+inline const uint32_t* unpack7_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x7f);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -7, -14, -21};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-28, -3, -10, -17};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 1);
+  const int32_t shifts_hi_4[4] = {4, 32, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-24, -31, -6, -13};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 1, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-20, -27, -2, -9};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 5, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -23, -30, -5};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 32, 2, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-12, -19, -26, -1};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 32, 6, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 5);
+  const int32_t shifts_lo_24[4] = {-8, -15, -22, -29};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 32, 32, 3};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 6);
+  const int32_t shifts_lo_28[4] = {-4, -11, -18, -25};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 7;
+}
+
+inline const uint32_t* unpack8_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_masks;
+
+  reg_masks = vdupq_n_u32(0xff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -8, -16, -24};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_4[4] = {0, -8, -16, -24};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 2);
+  const int32_t shifts_lo_8[4] = {0, -8, -16, -24};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 3);
+  const int32_t shifts_lo_12[4] = {0, -8, -16, -24};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 4);
+  const int32_t shifts_lo_16[4] = {0, -8, -16, -24};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 5);
+  const int32_t shifts_lo_20[4] = {0, -8, -16, -24};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 6);
+  const int32_t shifts_lo_24[4] = {0, -8, -16, -24};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 7);
+  const int32_t shifts_lo_28[4] = {0, -8, -16, -24};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 8;
+}
+
+inline const uint32_t* unpack9_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x1ff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -9, -18, -27};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 32, 32, 5};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 1);
+  const int32_t shifts_lo_4[4] = {-4, -13, -22, -31};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 32, 32, 1};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-8, -17, -26, -3};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 32, 6, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-12, -21, -30, -7};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 32, 2, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -25, -2, -11};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 7, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 5);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-20, -29, -6, -15};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 3, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-24, -1, -10, -19};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 7);
+  const int32_t shifts_hi_24[4] = {8, 32, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-28, -5, -14, -23};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 8);
+  const int32_t shifts_hi_28[4] = {4, 32, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 9;
+}
+
+inline const uint32_t* unpack10_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x3ff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  const int32_t shifts_lo_0[4] = {0, -10, -20, -30};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 32, 32, 2};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-8, -18, -28, -6};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 32, 4, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-16, -26, -4, -14};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 6, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-24, -2, -12, -22};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 4);
+  const int32_t shifts_hi_12[4] = {8, 32, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 5);
+  const int32_t shifts_lo_16[4] = {0, -10, -20, -30};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 32, 32, 2};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-8, -18, -28, -6};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 6);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 32, 4, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-16, -26, -4, -14};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 6, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 8);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-24, -2, -12, -22};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 9);
+  const int32_t shifts_hi_28[4] = {8, 32, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 10;
+}
+
+inline const uint32_t* unpack11_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x7ff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -11, -22, -1};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 32, 10, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-12, -23, -2, -13};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 9, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-24, -3, -14, -25};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {8, 32, 32, 7};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-4, -15, -26, -5};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 32, 6, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 5);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -27, -6, -17};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 5, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-28, -7, -18, -29};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {4, 32, 32, 3};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 8);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-8, -19, -30, -9};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 8);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 32, 2, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-20, -31, -10, -21};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 9);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {32, 1, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 11;
+}
+
+inline const uint32_t* unpack12_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0xfff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -12, -24, -4};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 32, 8, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-16, -28, -8, -20};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 4, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {0, -12, -24, -4};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 32, 8, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-16, -28, -8, -20};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 4, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -12, -24, -4};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 6);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 32, 8, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-16, -28, -8, -20};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 4, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {0, -12, -24, -4};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 9);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 32, 8, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-16, -28, -8, -20};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 10);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {32, 4, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 12;
+}
+
+inline const uint32_t* unpack13_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x1fff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -13, -26, -7};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 32, 6, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-20, -1, -14, -27};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {12, 32, 32, 5};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-8, -21, -2, -15};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 11, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-28, -9, -22, -3};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {4, 32, 10, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -29, -10, -23};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 6);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 3, 32, 9};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 8);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-4, -17, -30, -11};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 8);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 32, 2, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-24, -5, -18, -31};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 10);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {8, 32, 32, 1};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 11);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-12, -25, -6, -19};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 11);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {32, 7, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 13;
+}
+
+inline const uint32_t* unpack14_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x3fff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -14, -28, -10};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 32, 4, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-24, -6, -20, -2};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {8, 32, 12, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-16, -30, -12, -26};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 2, 32, 6};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 5);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-8, -22, -4, -18};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 10, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -14, -28, -10};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 32, 4, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 8);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-24, -6, -20, -2};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 9);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {8, 32, 12, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-16, -30, -12, -26};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 10);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 2, 32, 6};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 12);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-8, -22, -4, -18};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 12);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {32, 10, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 14;
+}
+
+inline const uint32_t* unpack15_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x7fff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -15, -30, -13};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 32, 2, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-28, -11, -26, -9};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {4, 32, 6, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-24, -7, -22, -5};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {8, 32, 10, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 5);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-20, -3, -18, -1};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 6);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {12, 32, 14, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -31, -14, -29};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 1, 32, 3};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-12, -27, -10, -25};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 9);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 5, 32, 7};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 11);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-8, -23, -6, -21};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 11);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 9, 32, 11};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 13);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-4, -19, -2, -17};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 13);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {32, 13, 32, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 15;
+}
+
+inline const uint32_t* unpack16_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_masks;
+
+  reg_masks = vdupq_n_u32(0xffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -16, 0, -16};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {0, -16, 0, -16};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {0, -16, 0, -16};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {0, -16, 0, -16};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 8);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -16, 0, -16};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {0, -16, 0, -16};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 12);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {0, -16, 0, -16};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 14);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {0, -16, 0, -16};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 16;
+}
+
+inline const uint32_t* unpack17_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x1ffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -17, -2, -19};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 15, 32, 13};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-4, -21, -6, -23};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 11, 32, 9};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-8, -25, -10, -27};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 7, 32, 5};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-12, -29, -14, -31};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 6);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 3, 32, 1};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 8);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -1, -18, -3};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 9);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {16, 32, 14, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-20, -5, -22, -7};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 11);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {12, 32, 10, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 12);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-24, -9, -26, -11};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 13);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {8, 32, 6, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 14);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-28, -13, -30, -15};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 15);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {4, 32, 2, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 17;
+}
+
+inline const uint32_t* unpack18_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x3ffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -18, -4, -22};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 14, 32, 10};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-8, -26, -12, -30};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 6, 32, 2};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-16, -2, -20, -6};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {16, 32, 12, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-24, -10, -28, -14};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {8, 32, 4, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -18, -4, -22};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 9);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 14, 32, 10};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 11);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-8, -26, -12, -30};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 11);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 6, 32, 2};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 13);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-16, -2, -20, -6};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 14);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {16, 32, 12, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 15);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-24, -10, -28, -14};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 16);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {8, 32, 4, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 18;
+}
+
+inline const uint32_t* unpack19_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x7ffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -19, -6, -25};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 13, 32, 7};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-12, -31, -18, -5};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 1, 14, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 4);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-24, -11, -30, -17};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {8, 32, 2, 15};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-4, -23, -10, -29};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 9, 32, 3};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -3, -22, -9};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 10);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {16, 32, 10, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 11);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-28, -15, -2, -21};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 12);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {4, 17, 32, 11};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 14);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-8, -27, -14, -1};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 14);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 5, 18, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 16);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-20, -7, -26, -13};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 17);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {12, 32, 6, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 19;
+}
+
+inline const uint32_t* unpack20_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0xfffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -20, -8, -28};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 12, 32, 4};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-16, -4, -24, -12};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {16, 32, 8, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 5);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {0, -20, -8, -28};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 12, 32, 4};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-16, -4, -24, -12};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 8);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {16, 32, 8, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -20, -8, -28};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 10);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 12, 32, 4};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 12);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-16, -4, -24, -12};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 13);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {16, 32, 8, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 15);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {0, -20, -8, -28};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 15);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 12, 32, 4};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 17);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-16, -4, -24, -12};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 18);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {16, 32, 8, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 20;
+}
+
+inline const uint32_t* unpack21_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x1fffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -21, -10, -31};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 11, 32, 1};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-20, -9, -30, -19};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {12, 32, 2, 13};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 5);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-8, -29, -18, -7};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 5);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 3, 14, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-28, -17, -6, -27};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 8);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {4, 15, 32, 5};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -5, -26, -15};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 11);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {16, 32, 6, 17};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 13);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-4, -25, -14, -3};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 13);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 7, 18, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 15);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-24, -13, -2, -23};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 16);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {8, 19, 32, 9};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 18);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-12, -1, -22, -11};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 19);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {20, 32, 10, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 21;
+}
+
+inline const uint32_t* unpack22_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x3fffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -22, -12, -2};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 10, 20, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-24, -14, -4, -26};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {8, 18, 32, 6};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 5);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-16, -6, -28, -18};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 6);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {16, 32, 4, 14};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 8);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-8, -30, -20, -10};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 8);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 2, 12, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 11);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -22, -12, -2};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 11);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 10, 20, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 13);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-24, -14, -4, -26};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 14);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {8, 18, 32, 6};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 16);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-16, -6, -28, -18};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 17);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {16, 32, 4, 14};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 19);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-8, -30, -20, -10};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 19);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {32, 2, 12, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 22;
+}
+
+inline const uint32_t* unpack23_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x7fffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -23, -14, -5};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 9, 18, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 2);
+  reg_lo = vld1q_lane_u32(in + 3, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-28, -19, -10, -1};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {4, 13, 22, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 5);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-24, -15, -6, -29};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 6);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {8, 17, 32, 3};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 8);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-20, -11, -2, -25};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 9);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {12, 21, 32, 7};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 11);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -7, -30, -21};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 12);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {16, 32, 2, 11};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 14);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-12, -3, -26, -17};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 15);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {20, 32, 6, 15};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 17);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-8, -31, -22, -13};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 17);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 1, 10, 19};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 20);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 22, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-4, -27, -18, -9};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 20);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 22, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 22, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {32, 5, 14, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 23;
+}
+
+inline const uint32_t* unpack24_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0xffffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -24, -16, -8};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 8, 16, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {0, -24, -16, -8};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 8, 16, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {0, -24, -16, -8};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 6);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 8, 16, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {0, -24, -16, -8};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 9);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 8, 16, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 12);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -24, -16, -8};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 12);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 8, 16, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 15);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {0, -24, -16, -8};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 15);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {32, 8, 16, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 18);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {0, -24, -16, -8};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 18);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 8, 16, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 21);
+  reg_lo = vld1q_lane_u32(in + 22, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 23, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {0, -24, -16, -8};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 21);
+  reg_hi = vld1q_lane_u32(in + 22, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 23, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 23, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {32, 8, 16, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 24;
+}
+
+inline const uint32_t* unpack25_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x1ffffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -25, -18, -11};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 7, 14, 21};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-4, -29, -22, -15};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 3);
+  reg_hi = vld1q_lane_u32(in + 4, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {32, 3, 10, 17};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-8, -1, -26, -19};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {24, 32, 6, 13};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-12, -5, -30, -23};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 10);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {20, 32, 2, 9};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 12);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -9, -2, -27};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 13);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {16, 23, 32, 5};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 15);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-20, -13, -6, -31};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 16);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {12, 19, 32, 1};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 18);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-24, -17, -10, -3};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 19);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {8, 15, 22, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 21);
+  reg_lo = vld1q_lane_u32(in + 22, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 23, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 24, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-28, -21, -14, -7};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 22);
+  reg_hi = vld1q_lane_u32(in + 23, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 24, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 24, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {4, 11, 18, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 25;
+}
+
+inline const uint32_t* unpack26_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x3ffffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -26, -20, -14};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 6, 12, 18};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-8, -2, -28, -22};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {24, 32, 4, 10};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-16, -10, -4, -30};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {16, 22, 32, 2};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 9);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-24, -18, -12, -6};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 10);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {8, 14, 20, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 13);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -26, -20, -14};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 13);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 6, 12, 18};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 16);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-8, -2, -28, -22};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 17);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {24, 32, 4, 10};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 19);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-16, -10, -4, -30};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 20);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 22, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {16, 22, 32, 2};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 22);
+  reg_lo = vld1q_lane_u32(in + 23, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 24, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 25, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-24, -18, -12, -6};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 23);
+  reg_hi = vld1q_lane_u32(in + 24, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 25, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 25, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {8, 14, 20, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 26;
+}
+
+inline const uint32_t* unpack27_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x7ffffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -27, -22, -17};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 5, 10, 15};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-12, -7, -2, -29};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {20, 25, 32, 3};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 6);
+  reg_lo = vld1q_lane_u32(in + 7, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-24, -19, -14, -9};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {8, 13, 18, 23};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-4, -31, -26, -21};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 10);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {32, 1, 6, 11};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 13);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -11, -6, -1};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 14);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {16, 21, 26, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 16);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-28, -23, -18, -13};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 17);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {4, 9, 14, 19};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 20);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 22, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-8, -3, -30, -25};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 21);
+  reg_hi = vld1q_lane_u32(in + 22, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 23, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {24, 32, 2, 7};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 23);
+  reg_lo = vld1q_lane_u32(in + 24, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 25, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 26, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-20, -15, -10, -5};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 24);
+  reg_hi = vld1q_lane_u32(in + 25, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 26, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 26, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {12, 17, 22, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 27;
+}
+
+inline const uint32_t* unpack28_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0xfffffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -28, -24, -20};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 4, 8, 12};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-16, -12, -8, -4};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {16, 20, 24, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {0, -28, -24, -20};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 7);
+  reg_hi = vld1q_lane_u32(in + 8, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {32, 4, 8, 12};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-16, -12, -8, -4};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 11);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {16, 20, 24, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 14);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -28, -24, -20};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 14);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 4, 8, 12};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 17);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-16, -12, -8, -4};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 18);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {16, 20, 24, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 21);
+  reg_lo = vld1q_lane_u32(in + 22, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 23, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {0, -28, -24, -20};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 21);
+  reg_hi = vld1q_lane_u32(in + 22, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 23, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 24, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {32, 4, 8, 12};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 24);
+  reg_lo = vld1q_lane_u32(in + 25, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 26, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 27, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-16, -12, -8, -4};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 25);
+  reg_hi = vld1q_lane_u32(in + 26, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 27, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 27, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {16, 20, 24, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 28;
+}
+
+inline const uint32_t* unpack29_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x1fffffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -29, -26, -23};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 3, 6, 9};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-20, -17, -14, -11};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {12, 15, 18, 21};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-8, -5, -2, -31};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 8);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {24, 27, 32, 1};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 10);
+  reg_lo = vld1q_lane_u32(in + 11, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-28, -25, -22, -19};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 11);
+  reg_hi = vld1q_lane_u32(in + 12, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {4, 7, 10, 13};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 14);
+  reg_lo = vld1q_lane_u32(in + 15, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -13, -10, -7};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 15);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {16, 19, 22, 25};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 18);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-4, -1, -30, -27};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 19);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {28, 32, 2, 5};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 21);
+  reg_lo = vld1q_lane_u32(in + 22, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 23, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 24, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-24, -21, -18, -15};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 22);
+  reg_hi = vld1q_lane_u32(in + 23, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 24, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 25, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {8, 11, 14, 17};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 25);
+  reg_lo = vld1q_lane_u32(in + 26, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 27, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 28, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-12, -9, -6, -3};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 26);
+  reg_hi = vld1q_lane_u32(in + 27, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 28, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 28, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {20, 23, 26, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 29;
+}
+
+inline const uint32_t* unpack30_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x3fffffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -30, -28, -26};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 2, 4, 6};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-24, -22, -20, -18};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {8, 10, 12, 14};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-16, -14, -12, -10};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 8);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {16, 18, 20, 22};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 11);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-8, -6, -4, -2};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 12);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {24, 26, 28, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 15);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {0, -30, -28, -26};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 15);
+  reg_hi = vld1q_lane_u32(in + 16, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {32, 2, 4, 6};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 18);
+  reg_lo = vld1q_lane_u32(in + 19, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-24, -22, -20, -18};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 19);
+  reg_hi = vld1q_lane_u32(in + 20, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 22, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {8, 10, 12, 14};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 22);
+  reg_lo = vld1q_lane_u32(in + 23, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 24, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 25, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-16, -14, -12, -10};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 23);
+  reg_hi = vld1q_lane_u32(in + 24, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 25, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 26, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {16, 18, 20, 22};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 26);
+  reg_lo = vld1q_lane_u32(in + 27, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 28, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 29, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-8, -6, -4, -2};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 27);
+  reg_hi = vld1q_lane_u32(in + 28, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 29, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 29, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {24, 26, 28, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 30;
+}
+
+inline const uint32_t* unpack31_32(const uint32_t* in, uint32_t* out) {
+  uint32x4_t reg_lo, reg_hi, reg_masks;
+
+  reg_masks = vdupq_n_u32(0x7fffffff);
+
+  // outs 0 to 3
+  reg_lo = vld1q_dup_u32(in + 0);
+  reg_lo = vld1q_lane_u32(in + 1, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 2, reg_lo, 3);
+  const int32_t shifts_lo_0[4] = {0, -31, -30, -29};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_0));
+  reg_hi = vld1q_dup_u32(in + 0);
+  reg_hi = vld1q_lane_u32(in + 1, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 2, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 3, reg_hi, 3);
+  const int32_t shifts_hi_0[4] = {32, 1, 2, 3};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_0));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 0, vandq_u32(reg_lo, reg_masks));
+
+  // outs 4 to 7
+  reg_lo = vld1q_dup_u32(in + 3);
+  reg_lo = vld1q_lane_u32(in + 4, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 5, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 6, reg_lo, 3);
+  const int32_t shifts_lo_4[4] = {-28, -27, -26, -25};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_4));
+  reg_hi = vld1q_dup_u32(in + 4);
+  reg_hi = vld1q_lane_u32(in + 5, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 6, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 7, reg_hi, 3);
+  const int32_t shifts_hi_4[4] = {4, 5, 6, 7};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_4));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 4, vandq_u32(reg_lo, reg_masks));
+
+  // outs 8 to 11
+  reg_lo = vld1q_dup_u32(in + 7);
+  reg_lo = vld1q_lane_u32(in + 8, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 9, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 10, reg_lo, 3);
+  const int32_t shifts_lo_8[4] = {-24, -23, -22, -21};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_8));
+  reg_hi = vld1q_dup_u32(in + 8);
+  reg_hi = vld1q_lane_u32(in + 9, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 10, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 11, reg_hi, 3);
+  const int32_t shifts_hi_8[4] = {8, 9, 10, 11};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_8));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 8, vandq_u32(reg_lo, reg_masks));
+
+  // outs 12 to 15
+  reg_lo = vld1q_dup_u32(in + 11);
+  reg_lo = vld1q_lane_u32(in + 12, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 13, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 14, reg_lo, 3);
+  const int32_t shifts_lo_12[4] = {-20, -19, -18, -17};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_12));
+  reg_hi = vld1q_dup_u32(in + 12);
+  reg_hi = vld1q_lane_u32(in + 13, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 14, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 15, reg_hi, 3);
+  const int32_t shifts_hi_12[4] = {12, 13, 14, 15};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_12));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 12, vandq_u32(reg_lo, reg_masks));
+
+  // outs 16 to 19
+  reg_lo = vld1q_dup_u32(in + 15);
+  reg_lo = vld1q_lane_u32(in + 16, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 17, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 18, reg_lo, 3);
+  const int32_t shifts_lo_16[4] = {-16, -15, -14, -13};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_16));
+  reg_hi = vld1q_dup_u32(in + 16);
+  reg_hi = vld1q_lane_u32(in + 17, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 18, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 19, reg_hi, 3);
+  const int32_t shifts_hi_16[4] = {16, 17, 18, 19};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_16));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 16, vandq_u32(reg_lo, reg_masks));
+
+  // outs 20 to 23
+  reg_lo = vld1q_dup_u32(in + 19);
+  reg_lo = vld1q_lane_u32(in + 20, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 21, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 22, reg_lo, 3);
+  const int32_t shifts_lo_20[4] = {-12, -11, -10, -9};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_20));
+  reg_hi = vld1q_dup_u32(in + 20);
+  reg_hi = vld1q_lane_u32(in + 21, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 22, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 23, reg_hi, 3);
+  const int32_t shifts_hi_20[4] = {20, 21, 22, 23};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_20));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 20, vandq_u32(reg_lo, reg_masks));
+
+  // outs 24 to 27
+  reg_lo = vld1q_dup_u32(in + 23);
+  reg_lo = vld1q_lane_u32(in + 24, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 25, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 26, reg_lo, 3);
+  const int32_t shifts_lo_24[4] = {-8, -7, -6, -5};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_24));
+  reg_hi = vld1q_dup_u32(in + 24);
+  reg_hi = vld1q_lane_u32(in + 25, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 26, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 27, reg_hi, 3);
+  const int32_t shifts_hi_24[4] = {24, 25, 26, 27};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_24));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 24, vandq_u32(reg_lo, reg_masks));
+
+  // outs 28 to 31
+  reg_lo = vld1q_dup_u32(in + 27);
+  reg_lo = vld1q_lane_u32(in + 28, reg_lo, 1);
+  reg_lo = vld1q_lane_u32(in + 29, reg_lo, 2);
+  reg_lo = vld1q_lane_u32(in + 30, reg_lo, 3);
+  const int32_t shifts_lo_28[4] = {-4, -3, -2, -1};
+  reg_lo = vshlq_u32(reg_lo, vld1q_s32(shifts_lo_28));
+  reg_hi = vld1q_dup_u32(in + 28);
+  reg_hi = vld1q_lane_u32(in + 29, reg_hi, 1);
+  reg_hi = vld1q_lane_u32(in + 30, reg_hi, 2);
+  reg_hi = vld1q_lane_u32(in + 30, reg_hi, 3);
+  const int32_t shifts_hi_28[4] = {28, 29, 30, 32};
+  reg_hi = vshlq_u32(reg_hi, vld1q_s32(shifts_hi_28));
+  reg_lo = vorrq_u32(reg_lo, reg_hi);
+  vst1q_u32(out + 28, vandq_u32(reg_lo, reg_masks));
+
+  return in + 31;
+}
+
+inline const uint32_t* unpack32_32(const uint32_t* in, uint32_t* out) {
+  memcpy(out, in, 32 * sizeof(*out));
+  in += 32;
+
+  return in;
+}
+
+inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  int num_loops = batch_size / 32;
+
+  switch (num_bits) {
+    case 0:
+      for (int i = 0; i < num_loops; ++i) in = nullunpacker32(in, out + i * 32);
+      break;
+    case 1:
+      for (int i = 0; i < num_loops; ++i) in = unpack1_32(in, out + i * 32);
+      break;
+    case 2:
+      for (int i = 0; i < num_loops; ++i) in = unpack2_32(in, out + i * 32);
+      break;
+    case 3:
+      for (int i = 0; i < num_loops; ++i) in = unpack3_32(in, out + i * 32);
+      break;
+    case 4:
+      for (int i = 0; i < num_loops; ++i) in = unpack4_32(in, out + i * 32);
+      break;
+    case 5:
+      for (int i = 0; i < num_loops; ++i) in = unpack5_32(in, out + i * 32);
+      break;
+    case 6:
+      for (int i = 0; i < num_loops; ++i) in = unpack6_32(in, out + i * 32);
+      break;
+    case 7:
+      for (int i = 0; i < num_loops; ++i) in = unpack7_32(in, out + i * 32);
+      break;
+    case 8:
+      for (int i = 0; i < num_loops; ++i) in = unpack8_32(in, out + i * 32);
+      break;
+    case 9:
+      for (int i = 0; i < num_loops; ++i) in = unpack9_32(in, out + i * 32);
+      break;
+    case 10:
+      for (int i = 0; i < num_loops; ++i) in = unpack10_32(in, out + i * 32);
+      break;
+    case 11:
+      for (int i = 0; i < num_loops; ++i) in = unpack11_32(in, out + i * 32);
+      break;
+    case 12:
+      for (int i = 0; i < num_loops; ++i) in = unpack12_32(in, out + i * 32);
+      break;
+    case 13:
+      for (int i = 0; i < num_loops; ++i) in = unpack13_32(in, out + i * 32);
+      break;
+    case 14:
+      for (int i = 0; i < num_loops; ++i) in = unpack14_32(in, out + i * 32);
+      break;
+    case 15:
+      for (int i = 0; i < num_loops; ++i) in = unpack15_32(in, out + i * 32);
+      break;
+    case 16:
+      for (int i = 0; i < num_loops; ++i) in = unpack16_32(in, out + i * 32);
+      break;
+    case 17:
+      for (int i = 0; i < num_loops; ++i) in = unpack17_32(in, out + i * 32);
+      break;
+    case 18:
+      for (int i = 0; i < num_loops; ++i) in = unpack18_32(in, out + i * 32);
+      break;
+    case 19:
+      for (int i = 0; i < num_loops; ++i) in = unpack19_32(in, out + i * 32);
+      break;
+    case 20:
+      for (int i = 0; i < num_loops; ++i) in = unpack20_32(in, out + i * 32);
+      break;
+    case 21:
+      for (int i = 0; i < num_loops; ++i) in = unpack21_32(in, out + i * 32);
+      break;
+    case 22:
+      for (int i = 0; i < num_loops; ++i) in = unpack22_32(in, out + i * 32);
+      break;
+    case 23:
+      for (int i = 0; i < num_loops; ++i) in = unpack23_32(in, out + i * 32);
+      break;
+    case 24:
+      for (int i = 0; i < num_loops; ++i) in = unpack24_32(in, out + i * 32);
+      break;
+    case 25:
+      for (int i = 0; i < num_loops; ++i) in = unpack25_32(in, out + i * 32);
+      break;
+    case 26:
+      for (int i = 0; i < num_loops; ++i) in = unpack26_32(in, out + i * 32);
+      break;
+    case 27:
+      for (int i = 0; i < num_loops; ++i) in = unpack27_32(in, out + i * 32);
+      break;
+    case 28:
+      for (int i = 0; i < num_loops; ++i) in = unpack28_32(in, out + i * 32);
+      break;
+    case 29:
+      for (int i = 0; i < num_loops; ++i) in = unpack29_32(in, out + i * 32);
+      break;
+    case 30:
+      for (int i = 0; i < num_loops; ++i) in = unpack30_32(in, out + i * 32);
+      break;
+    case 31:
+      for (int i = 0; i < num_loops; ++i) in = unpack31_32(in, out + i * 32);
+      break;
+    case 32:
+      for (int i = 0; i < num_loops; ++i) in = unpack32_32(in, out + i * 32);
+      break;
+    default:
+      return 0;
+  }
+
+  return batch_size;
+}
+
+}  // namespace neon
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,246 @@
+#!/bin/python
+
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+# Usage:
+#   python bpacking_simd_codegen.py avx2 > bpacking_avx2_generated.h
+#   python bpacking_simd_codegen.py neon > bpacking_neon_generated.h
+#
+# Output value `j` of width `bit` starts at bit `j * bit` of the input, and
+# is computed one register of values at a time as
+#   ((in[lo] >> shift) | (in[lo + 1] << (32 - shift))) & mask
+# where the second term is only needed by values crossing a word boundary.
+# The variable shifts of both AVX2 and NEON yield zero for a shift of 32, which
+# is used for lanes that don't cross a boundary.  Only the input words that
+# hold packed values are read.
+
+import sys
+
+
+class Avx2:
+    name = "avx2"
+    include = "immintrin.h"
+    lanes = 8
+
+    def _set(self, values):
+        # _mm256_set_epi32 takes its arguments from the highest lane down
+        return "_mm256_set_epi32(%s)" % ", ".join(str(v) for v in reversed(values))
+
+    def declare_registers(self, need_hi):
+        return ["__m256i reg_lo, %sreg_masks;" % ("reg_hi, " if need_hi else "")]
+
+    def set_masks(self, mask):
+        return [f"reg_masks = _mm256_set1_epi32(0x{mask:x});"]
+
+    def _load(self, reg, first_word, indices, words):
+        # Masked out lanes are not read, so as not to read past the input
+        lane_mask = [-1 if lane in words else 0 for lane in range(self.lanes)]
+        return [f"{reg} = _mm256_maskload_epi32(reinterpret_cast<const int*>("
+                f"in + {first_word}),",
+                f"                               {self._set(lane_mask)});",
+                f"{reg} = _mm256_permutevar8x32_epi32({reg}, {self._set(indices)});"]
+
+    def unpack(self, out_index, first_word, indices, shifts, crossing):
+        lines = self._load("reg_lo", first_word, indices, set(indices))
+        lines.append(f"reg_lo = _mm256_srlv_epi32(reg_lo, {self._set(shifts)});")
+        if any(crossing):
+            hi_words = set(i for i, cross in zip(indices, crossing) if cross)
+            hi_shifts = [32 - shift if cross else 32
+                         for shift, cross in zip(shifts, crossing)]
+            lines += self._load("reg_hi", first_word + 1, indices, hi_words)
+            lines.append(f"reg_hi = _mm256_sllv_epi32(reg_hi, {self._set(hi_shifts)});")
+            lines.append("reg_lo = _mm256_or_si256(reg_lo, reg_hi);")
+        lines.append(f"_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + {out_index}),")
+        lines.append("                    _mm256_and_si256(reg_lo, reg_masks));")
+        return lines
+
+
+class Neon:
+    name = "neon"
+    include = "arm_neon.h"
+    lanes = 4
+
+    def declare_registers(self, need_hi):
+        return ["uint32x4_t reg_lo, %sreg_masks;" % ("reg_hi, " if need_hi else "")]
+
+    def set_masks(self, mask):
+        return [f"reg_masks = vdupq_n_u32(0x{mask:x});"]
+
+    def _load(self, reg, words):
+        lines = [f"{reg} = vld1q_dup_u32(in + {words[0]});"]
+        for lane in range(1, self.lanes):
+            if words[lane] != words[0]:
+                lines.append(f"{reg} = vld1q_lane_u32(in + {words[lane]}, {reg}, {lane});")
+        return lines
+
+    def _shift(self, reg, name, shifts):
+        # vshlq_u32 shifts right by negative amounts
+        values = ", ".join(str(shift) for shift in shifts)
+        return [f"const int32_t {name}[{self.lanes}] = {{{values}}};",
+                f"{reg} = vshlq_u32({reg}, vld1q_s32({name}));"]
+
+    def unpack(self, out_index, first_word, indices, shifts, crossing):
+        words = [first_word + i for i in indices]
+        lines = self._load("reg_lo", words)
+        lines += self._shift("reg_lo", f"shifts_lo_{out_index}", [-shift for shift in shifts])
+        if any(crossing):
+            # Lanes that don't cross a word boundary reload their own word,
+            # which is then shifted out entirely
+            hi_words = [word + 1 if cross else word
+                        for word, cross in zip(words, crossing)]
+            hi_shifts = [32 - shift if cross else 32
+                         for shift, cross in zip(shifts, crossing)]
+            lines += self._load("reg_hi", hi_words)
+            lines += self._shift("reg_hi", f"shifts_hi_{out_index}", hi_shifts)
+            lines.append("reg_lo = vorrq_u32(reg_lo, reg_hi);")
+        lines.append(f"vst1q_u32(out + {out_index}, vandq_u32(reg_lo, reg_masks));")
+        return lines
+
+
+def print_unpack_bit_func(simd, bit):
+    groups = []
+    for begin in range(0, 32, simd.lanes):
+        first_word = begin * bit // 32
+        indices = []
+        shifts = []
+        crossing = []
+        for value in range(begin, begin + simd.lanes):
+            offset = value * bit - first_word * 32
+            indices.append(offset // 32)
+            shifts.append(offset % 32)
+            crossing.append(offset % 32 + bit > 32)
+        groups.append((begin, first_word, indices, shifts, crossing))
+    need_hi = any(any(group[4]) for group in groups)
+
+    print(f"inline const uint32_t* unpack{bit}_32(const uint32_t* in, uint32_t* out) {{")
+    for line in simd.declare_registers(need_hi):
+        print("  " + line)
+    print("")
+    for line in simd.set_masks((1 << bit) - 1):
+        print("  " + line)
+    for group in groups:
+        begin = group[0]
+        print("")
+        print(f"  // outs {begin} to {begin + simd.lanes - 1}")
+        for line in simd.unpack(*group):
+            print("  " + line)
+    print("")
+    print(f"  return in + {bit};")
+    print("}")
+
+
+def print_unpack_bit0_func():
+    print(
+        "inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {")
+    print("  memset(out, 0x0, 32 * sizeof(*out));")
+    print("")
+    print("  return in;")
+    print("}")
+
+
+def print_unpack_bit32_func():
+    print(
+        "inline const uint32_t* unpack32_32(const uint32_t* in, uint32_t* out) {")
+    print("  memcpy(out, in, 32 * sizeof(*out));")
+    print("  in += 32;")
+    print("")
+    print("  return in;")
+    print("}")
+
+
+def print_unpack32_func():
+    print("inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, "
+          "int num_bits) {")
+    print("  batch_size = batch_size / 32 * 32;")
+    print("  int num_loops = batch_size / 32;")
+    print("")
+    print("  switch (num_bits) {")
+    print("    case 0:")
+    print("      for (int i = 0; i < num_loops; ++i) in = nullunpacker32(in, out + i * 32);")
+    print("      break;")
+    for bit in range(1, 33):
+        print(f"    case {bit}:")
+        print(f"      for (int i = 0; i < num_loops; ++i) in = unpack{bit}_32(in, out + i * 32);")
+        print("      break;")
+    print("    default:")
+    print("      return 0;")
+    print("  }")
+    print("")
+    print("  return batch_size;")
+    print("}")
+
+
+def print_copyright():
+    print(
+        """// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.""")
+
+
+def print_note():
+    print("//")
+    print("// Automatically generated file; DO NOT EDIT.")
+
+
+def main(simd):
+    print_copyright()
+    print_note()
+    print("")
+    print("#pragma once")
+    print("")
+    print("#include <cstdint>")
+    print("#include <cstring>")
+    print("")
+    print(f"#include <{simd.include}>")
+    print("")
+    print("namespace arrow {")
+    print("namespace internal {")
+    print(f"namespace {simd.name} {{")
+    print("")
+    print_unpack_bit0_func()
+    print("")
+    for i in range(1, 32):
+        print_unpack_bit_func(simd, i)
+        print("")
+    print_unpack_bit32_func()
+    print("")
+    print_unpack32_func()
+    print("")
+    print(f"}}  // namespace {simd.name}")
+    print("}  // namespace internal")
+    print("}  // namespace arrow")
+
+
+if __name__ == '__main__':
+    simds = {"avx2": Avx2(), "neon": Neon()}
+    if len(sys.argv) != 2 or sys.argv[1] not in simds:
+        sys.exit(f"Usage: {sys.argv[0]} [{'|'.join(simds)}]")
+    main(simds[sys.argv[1]])
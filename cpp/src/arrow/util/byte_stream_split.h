@@ -18,8 +18,11 @@
 #ifndef ARROW_UTIL_BYTE_STREAM_SPLIT_H
 #define ARROW_UTIL_BYTE_STREAM_SPLIT_H
 
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/neon_util.h"
 #include "arrow/util/sse_util.h"
 #include "arrow/util/ubsan.h"
+#include "arrow/util/visibility.h"
 
 #include <stdint.h>
 #include <algorithm>
@@ -171,6 +174,134 @@ void ByteStreamSplitEncodeSSE2(const uint8_t* raw_values, const size_t num_value
 
 #endif
 
+#if defined(ARROW_HAVE_NEON)
+
+template <typename T>
+void ByteStreamSplitDecodeNeon(const uint8_t* data, int64_t num_values, int64_t stride,
+                               T* out) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
+
+  const int64_t size = num_values * sizeof(T);
+  const int64_t block_size = sizeof(uint8x16_t) * kNumStreams;
+  const int64_t num_blocks = size / block_size;
+  uint8_t* output_data = reinterpret_cast<uint8_t*>(out);
+
+  const int64_t num_processed_elements = (num_blocks * block_size) / kNumStreams;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    uint8_t gathered_byte_data[kNumStreams];
+    for (size_t b = 0; b < kNumStreams; ++b) {
+      const size_t byte_index = b * stride + i;
+      gathered_byte_data[b] = data[byte_index];
+    }
+    out[i] = arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]);
+  }
+
+  // Same hierarchical interleaving as the SSE2 version, vzip1q/vzip2q being
+  // the NEON equivalents of the unpacklo/unpackhi intrinsics.
+  uint8x16_t stage[kNumStreamsLog2 + 1U][kNumStreams];
+  const size_t half = kNumStreams / 2U;
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = vld1q_u8(&data[i * sizeof(uint8x16_t) + j * stride]);
+    }
+    for (size_t step = 0; step < kNumStreamsLog2; ++step) {
+      for (size_t j = 0; j < half; ++j) {
+        stage[step + 1U][j * 2] = vzip1q_u8(stage[step][j], stage[step][half + j]);
+        stage[step + 1U][j * 2 + 1U] = vzip2q_u8(stage[step][j], stage[step][half + j]);
+      }
+    }
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      vst1q_u8(&output_data[(i * kNumStreams + j) * sizeof(uint8x16_t)],
+               stage[kNumStreamsLog2][j]);
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitEncodeNeon(const uint8_t* raw_values, const size_t num_values,
+                               uint8_t* output_buffer_raw) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
+
+  const size_t size = num_values * sizeof(T);
+  const size_t block_size = sizeof(uint8x16_t) * kNumStreams;
+  const size_t num_blocks = size / block_size;
+
+  const size_t num_processed_elements = (num_blocks * block_size) / sizeof(T);
+  for (size_t i = num_processed_elements; i < num_values; ++i) {
+    for (size_t j = 0U; j < kNumStreams; ++j) {
+      const uint8_t byte_in_value = raw_values[i * kNumStreams + j];
+      output_buffer_raw[j * num_values + i] = byte_in_value;
+    }
+  }
+
+  // The inverse of the decoding: every step separates the even and the odd
+  // bytes of two vectors, so after log2(kNumStreams) steps vector j holds
+  // byte j of 16 consecutive values.
+  // Example with four streams:
+  // Stage 0: ABCD ABCD ABCD ABCD
+  // Stage 1: ACAC ACAC BDBD BDBD
+  // Stage 2: AAAA BBBB CCCC DDDD
+  uint8x16_t stage[kNumStreamsLog2 + 1U][kNumStreams];
+  const size_t half = kNumStreams / 2U;
+
+  for (size_t block_index = 0; block_index < num_blocks; ++block_index) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      stage[0][j] =
+          vld1q_u8(&raw_values[(block_index * kNumStreams + j) * sizeof(uint8x16_t)]);
+    }
+    for (size_t step = 0; step < kNumStreamsLog2; ++step) {
+      for (size_t j = 0; j < half; ++j) {
+        stage[step + 1U][j] = vuzp1q_u8(stage[step][j * 2], stage[step][j * 2 + 1U]);
+        stage[step + 1U][half + j] =
+            vuzp2q_u8(stage[step][j * 2], stage[step][j * 2 + 1U]);
+      }
+    }
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      vst1q_u8(&output_buffer_raw[j * num_values + block_index * sizeof(uint8x16_t)],
+               stage[kNumStreamsLog2][j]);
+    }
+  }
+}
+
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+
+/// \brief AVX2 implementations of the byte stream split kernels
+///
+/// Only available if ARROW_HAVE_RUNTIME_AVX2 is defined.  The caller must
+/// check that the running CPU supports AVX2.
+template <typename T>
+void ByteStreamSplitDecodeAvx2(const uint8_t* data, int64_t num_values, int64_t stride,
+                               T* out);
+template <typename T>
+void ByteStreamSplitEncodeAvx2(const uint8_t* raw_values, const size_t num_values,
+                               uint8_t* output_buffer_raw);
+
+template <>
+ARROW_EXPORT void ByteStreamSplitDecodeAvx2<float>(const uint8_t* data,
+                                                   int64_t num_values, int64_t stride,
+                                                   float* out);
+template <>
+ARROW_EXPORT void ByteStreamSplitDecodeAvx2<double>(const uint8_t* data,
+                                                    int64_t num_values, int64_t stride,
+                                                    double* out);
+template <>
+ARROW_EXPORT void ByteStreamSplitEncodeAvx2<float>(const uint8_t* raw_values,
+                                                   const size_t num_values,
+                                                   uint8_t* output_buffer_raw);
+template <>
+ARROW_EXPORT void ByteStreamSplitEncodeAvx2<double>(const uint8_t* raw_values,
+                                                    const size_t num_values,
+                                                    uint8_t* output_buffer_raw);
+
+#endif
+
 template <typename T>
 void ByteStreamSplitEncodeScalar(const uint8_t* raw_values, const size_t num_values,
                                  uint8_t* output_buffer_raw) {
@@ -198,6 +329,53 @@ void ByteStreamSplitDecodeScalar(const uint8_t* data, int64_t num_values, int64_
   }
 }
 
+/// \brief Decode byte stream split data with the fastest kernel for this CPU
+template <typename T>
+void ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
+                           T* out) {
+#if defined(ARROW_HAVE_NEON)
+  // NEON is a mandatory part of AArch64
+  ByteStreamSplitDecodeNeon<T>(data, num_values, stride, out);
+#else
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static const bool use_avx2 = ::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+      ::arrow::internal::CpuInfo::AVX2);
+  if (use_avx2) {
+    ByteStreamSplitDecodeAvx2<T>(data, num_values, stride, out);
+    return;
+  }
+#endif
+#if defined(ARROW_HAVE_SSE4_2)
+  ByteStreamSplitDecodeSSE2<T>(data, num_values, stride, out);
+#else
+  ByteStreamSplitDecodeScalar<T>(data, num_values, stride, out);
+#endif
+#endif
+}
+
+/// \brief Encode values as byte stream split with the fastest kernel for this CPU
+template <typename T>
+void ByteStreamSplitEncode(const uint8_t* raw_values, const size_t num_values,
+                           uint8_t* output_buffer_raw) {
+#if defined(ARROW_HAVE_NEON)
+  ByteStreamSplitEncodeNeon<T>(raw_values, num_values, output_buffer_raw);
+#else
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static const bool use_avx2 = ::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+      ::arrow::internal::CpuInfo::AVX2);
+  if (use_avx2) {
+    ByteStreamSplitEncodeAvx2<T>(raw_values, num_values, output_buffer_raw);
+    return;
+  }
+#endif
+#if defined(ARROW_HAVE_SSE4_2)
+  ByteStreamSplitEncodeSSE2<T>(raw_values, num_values, output_buffer_raw);
+#else
+  ByteStreamSplitEncodeScalar<T>(raw_values, num_values, output_buffer_raw);
+#endif
+#endif
+}
+
 }  // namespace internal
 }  // namespace util
 }  // namespace arrow
@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/util/byte_stream_split.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+// The AVX2 unpack intrinsics work within each 128-bit lane, so a block is
+// processed as two SSE2 blocks side by side: the low lanes carry the first
+// 16 values of every stream and the high lanes the next 16.
+
+template <typename T>
+void DecodeAvx2(const uint8_t* data, int64_t num_values, int64_t stride, T* out) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
+
+  const int64_t size = num_values * sizeof(T);
+  const int64_t block_size = sizeof(__m256i) * kNumStreams;
+  const int64_t num_blocks = size / block_size;
+  uint8_t* output_data = reinterpret_cast<uint8_t*>(out);
+
+  const int64_t num_processed_elements = (num_blocks * block_size) / kNumStreams;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    uint8_t gathered_byte_data[kNumStreams];
+    for (size_t b = 0; b < kNumStreams; ++b) {
+      const size_t byte_index = b * stride + i;
+      gathered_byte_data[b] = data[byte_index];
+    }
+    out[i] = arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]);
+  }
+
+  __m256i stage[kNumStreamsLog2 + 1U][kNumStreams];
+  const size_t half = kNumStreams / 2U;
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(&data[i * sizeof(__m256i) + j * stride]));
+    }
+    for (size_t step = 0; step < kNumStreamsLog2; ++step) {
+      for (size_t j = 0; j < half; ++j) {
+        stage[step + 1U][j * 2] =
+            _mm256_unpacklo_epi8(stage[step][j], stage[step][half + j]);
+        stage[step + 1U][j * 2 + 1U] =
+            _mm256_unpackhi_epi8(stage[step][j], stage[step][half + j]);
+      }
+    }
+    // The low lanes hold the first half of the decoded block, the high lanes
+    // the second half.
+    __m256i* output = reinterpret_cast<__m256i*>(&output_data[i * block_size]);
+    for (size_t j = 0; j < half; ++j) {
+      const __m256i even = stage[kNumStreamsLog2][j * 2];
+      const __m256i odd = stage[kNumStreamsLog2][j * 2 + 1U];
+      _mm256_storeu_si256(&output[j], _mm256_permute2x128_si256(even, odd, 0x20));
+      _mm256_storeu_si256(&output[half + j], _mm256_permute2x128_si256(even, odd, 0x31));
+    }
+  }
+}
+
+template <typename T>
+void EncodeAvx2(const uint8_t* raw_values, const size_t num_values,
+                uint8_t* output_buffer_raw) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  __m256i stage[3][kNumStreams];
+  __m256i final_result[kNumStreams];
+
+  const size_t size = num_values * sizeof(T);
+  const size_t block_size = sizeof(__m256i) * kNumStreams;
+  const size_t num_blocks = size / block_size;
+  const __m256i* raw_values_avx = reinterpret_cast<const __m256i*>(raw_values);
+  __m256i* output_buffer_streams[kNumStreams];
+  for (size_t i = 0; i < kNumStreams; ++i) {
+    output_buffer_streams[i] =
+        reinterpret_cast<__m256i*>(&output_buffer_raw[num_values * i]);
+  }
+
+  const size_t num_processed_elements = (num_blocks * block_size) / sizeof(T);
+  for (size_t i = num_processed_elements; i < num_values; ++i) {
+    for (size_t j = 0U; j < kNumStreams; ++j) {
+      const uint8_t byte_in_value = raw_values[i * kNumStreams + j];
+      output_buffer_raw[j * num_values + i] = byte_in_value;
+    }
+  }
+
+  const size_t half = kNumStreams / 2U;
+  for (size_t block_index = 0; block_index < num_blocks; ++block_index) {
+    // Gather the first half of the block into the low lanes and the second
+    // half into the high lanes, then shuffle as in the SSE2 version.
+    const __m256i* block = &raw_values_avx[block_index * kNumStreams];
+    for (size_t i = 0; i < half; ++i) {
+      const __m256i lo = _mm256_loadu_si256(&block[i]);
+      const __m256i hi = _mm256_loadu_si256(&block[half + i]);
+      stage[0][i * 2] = _mm256_permute2x128_si256(lo, hi, 0x20);
+      stage[0][i * 2 + 1] = _mm256_permute2x128_si256(lo, hi, 0x31);
+    }
+
+    for (size_t stage_lvl = 0; stage_lvl < 2U; ++stage_lvl) {
+      for (size_t i = 0; i < kNumStreams / 2U; ++i) {
+        stage[stage_lvl + 1][i * 2] =
+            _mm256_unpacklo_epi8(stage[stage_lvl][i * 2], stage[stage_lvl][i * 2 + 1]);
+        stage[stage_lvl + 1][i * 2 + 1] =
+            _mm256_unpackhi_epi8(stage[stage_lvl][i * 2], stage[stage_lvl][i * 2 + 1]);
+      }
+    }
+    if (kNumStreams == 8U) {
+      // This is the path for double.
+      __m256i tmp[8];
+      for (size_t i = 0; i < 4; ++i) {
+        tmp[i * 2] = _mm256_unpacklo_epi32(stage[2][i], stage[2][i + 4]);
+        tmp[i * 2 + 1] = _mm256_unpackhi_epi32(stage[2][i], stage[2][i + 4]);
+      }
+      for (size_t i = 0; i < 4; ++i) {
+        final_result[i * 2] = _mm256_unpacklo_epi32(tmp[i], tmp[i + 4]);
+        final_result[i * 2 + 1] = _mm256_unpackhi_epi32(tmp[i], tmp[i + 4]);
+      }
+    } else {
+      // This is the path for float.
+      __m256i tmp[4];
+      for (size_t i = 0; i < 2; ++i) {
+        tmp[i * 2] = _mm256_unpacklo_epi8(stage[2][i * 2], stage[2][i * 2 + 1]);
+        tmp[i * 2 + 1] = _mm256_unpackhi_epi8(stage[2][i * 2], stage[2][i * 2 + 1]);
+      }
+      for (size_t i = 0; i < 2; ++i) {
+        final_result[i * 2] = _mm256_unpacklo_epi64(tmp[i], tmp[i + 2]);
+        final_result[i * 2 + 1] = _mm256_unpackhi_epi64(tmp[i], tmp[i + 2]);
+      }
+    }
+    for (size_t i = 0; i < kNumStreams; ++i) {
+      _mm256_storeu_si256(&output_buffer_streams[i][block_index], final_result[i]);
+    }
+  }
+}
+
+}  // namespace
+
+template <>
+void ByteStreamSplitDecodeAvx2<float>(const uint8_t* data, int64_t num_values,
+                                      int64_t stride, float* out) {
+  DecodeAvx2<float>(data, num_values, stride, out);
+}
+
+template <>
+void ByteStreamSplitDecodeAvx2<double>(const uint8_t* data, int64_t num_values,
+                                       int64_t stride, double* out) {
+  DecodeAvx2<double>(data, num_values, stride, out);
+}
+
+template <>
+void ByteStreamSplitEncodeAvx2<float>(const uint8_t* raw_values, const size_t num_values,
+                                      uint8_t* output_buffer_raw) {
+  EncodeAvx2<float>(raw_values, num_values, output_buffer_raw);
+}
+
+template <>
+void ByteStreamSplitEncodeAvx2<double>(const uint8_t* raw_values, const size_t num_values,
+                                       uint8_t* output_buffer_raw) {
+  EncodeAvx2<double>(raw_values, num_values, output_buffer_raw);
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -21,9 +21,11 @@
 #include <string>
 #include <utility>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/compression_internal.h"
+#include "arrow/util/macros.h"
 
 namespace arrow {
 namespace util {
@@ -38,6 +40,16 @@ int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
 
+Status Codec::SetDictionary(std::shared_ptr<Buffer> ARROW_ARG_UNUSED(dictionary)) {
+  return Status::NotImplemented("Dictionaries are not supported by ", name(), " codec");
+}
+
+Result<int64_t> Codec::FrameSize(int64_t ARROW_ARG_UNUSED(input_len),
+                                 const uint8_t* ARROW_ARG_UNUSED(input)) {
+  return Status::NotImplemented("Splitting into frames is not supported by ", name(),
+                                " codec");
+}
+
 std::string Codec::GetCodecAsString(Compression::type t) {
   switch (t) {
     case Compression::UNCOMPRESSED:
@@ -168,6 +180,44 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
   return std::move(codec);
 }
 
+Result<std::unique_ptr<Codec>> Codec::CreateWithDictionary(
+    Compression::type codec_type, std::shared_ptr<Buffer> dictionary,
+    int compression_level) {
+  std::unique_ptr<Codec> codec;
+  switch (codec_type) {
+    case Compression::ZSTD:
+#ifdef ARROW_WITH_ZSTD
+      codec = internal::MakeZSTDCodec(compression_level);
+      break;
+#else
+      return Status::NotImplemented("ZSTD codec support not built");
+#endif
+    default:
+      return Status::NotImplemented("Dictionaries are not supported by ",
+                                    GetCodecAsString(codec_type), " codec");
+  }
+
+  RETURN_NOT_OK(codec->SetDictionary(std::move(dictionary)));
+  RETURN_NOT_OK(codec->Init());
+  return std::move(codec);
+}
+
+Result<std::shared_ptr<Buffer>> Codec::TrainDictionary(
+    Compression::type codec_type, const std::vector<std::shared_ptr<Buffer>>& samples,
+    int64_t dictionary_size) {
+  switch (codec_type) {
+    case Compression::ZSTD:
+#ifdef ARROW_WITH_ZSTD
+      return internal::TrainZSTDDictionary(samples, dictionary_size);
+#else
+      return Status::NotImplemented("ZSTD codec support not built");
+#endif
+    default:
+      return Status::NotImplemented("Dictionaries are not supported by ",
+                                    GetCodecAsString(codec_type), " codec");
+  }
+}
+
 bool Codec::IsAvailable(Compression::type codec_type) {
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
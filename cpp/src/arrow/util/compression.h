@@ -21,6 +21,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -28,6 +29,8 @@
 
 namespace arrow {
 
+class Buffer;
+
 struct Compression {
   /// \brief Compression algorithm
   enum type { UNCOMPRESSED, SNAPPY, GZIP, BROTLI, ZSTD, LZ4, LZ4_FRAME, LZO, BZ2 };
@@ -133,6 +136,32 @@ class ARROW_EXPORT Codec {
   static Result<std::unique_ptr<Codec>> Create(
       Compression::type codec, int compression_level = kUseDefaultCompressionLevel);
 
+  /// \brief Create a codec compressing with a dictionary
+  ///
+  /// Data compressed with a dictionary can only be decompressed by a codec
+  /// created with the same dictionary.  A dictionary trained on samples of
+  /// small inputs, such as data pages or IPC buffers, greatly improves their
+  /// compression ratio and speed.  Only ZSTD supports dictionaries.
+  ///
+  /// \param[in] codec the compression algorithm
+  /// \param[in] dictionary the dictionary, e.g. from TrainDictionary()
+  /// \param[in] compression_level the compression level
+  static Result<std::unique_ptr<Codec>> CreateWithDictionary(
+      Compression::type codec, std::shared_ptr<Buffer> dictionary,
+      int compression_level = kUseDefaultCompressionLevel);
+
+  /// \brief Train a compression dictionary on samples of the inputs to compress
+  ///
+  /// Training needs many samples, e.g. a hundred or more, totalling several
+  /// times the dictionary size.  Only ZSTD supports dictionaries.
+  ///
+  /// \param[in] codec the compression algorithm
+  /// \param[in] samples sample inputs
+  /// \param[in] dictionary_size the maximum size of the dictionary, e.g. 64 KiB
+  static Result<std::shared_ptr<Buffer>> TrainDictionary(
+      Compression::type codec, const std::vector<std::shared_ptr<Buffer>>& samples,
+      int64_t dictionary_size);
+
   /// \brief Return true if support for indicated codec has been enabled
   static bool IsAvailable(Compression::type codec);
 
@@ -161,6 +190,14 @@ class ARROW_EXPORT Codec {
 
   virtual int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) = 0;
 
+  /// \brief Return the size of the compressed frame at the start of `input`
+  ///
+  /// Streams made of self-delimited frames (ZSTD, LZ4_FRAME) can be split into
+  /// independently decompressible frames without decompressing them.  0 is
+  /// returned if `input` doesn't contain a whole frame yet.  Returns
+  /// NotImplemented if the codec's format can't be split this way.
+  virtual Result<int64_t> FrameSize(int64_t input_len, const uint8_t* input);
+
   /// \brief Create a streaming compressor instance
   virtual Result<std::shared_ptr<Compressor>> MakeCompressor() = 0;
 
@@ -172,6 +209,9 @@ class ARROW_EXPORT Codec {
  private:
   /// \brief Initializes the codec's resources.
   virtual Status Init();
+
+  /// \brief Set the dictionary to compress with, before Init()
+  virtual Status SetDictionary(std::shared_ptr<Buffer> dictionary);
 };
 
 }  // namespace util
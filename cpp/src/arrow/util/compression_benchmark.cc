@@ -23,8 +23,12 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
 #include "arrow/result.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
@@ -175,9 +179,203 @@ static void ReferenceStreamingDecompression(
   StreamingDecompression(COMPRESSION, data, state);
 }
 
+// Write `data` through a (parallel) compressed output stream
+static std::shared_ptr<Buffer> CompressWithStream(Codec* codec,
+                                                  const std::vector<uint8_t>& data,
+                                                  bool parallel) {
+  auto sink = *io::BufferOutputStream::Create();
+  std::shared_ptr<io::OutputStream> stream;
+  if (parallel) {
+    stream = *io::ParallelCompressedOutputStream::Make(codec, sink);
+  } else {
+    stream = *io::CompressedOutputStream::Make(codec, sink);
+  }
+  const int64_t chunk_size = 64 * 1024;
+  for (int64_t pos = 0; pos < static_cast<int64_t>(data.size()); pos += chunk_size) {
+    const int64_t nbytes = std::min<int64_t>(chunk_size, data.size() - pos);
+    ARROW_CHECK_OK(stream->Write(data.data() + pos, nbytes));
+  }
+  ARROW_CHECK_OK(stream->Close());
+  return *sink->Finish();
+}
+
+static void StreamCompression(Compression::type compression, bool parallel,
+                              benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(64 * 1024 * 1024);  // 64 MB
+  auto codec = *Codec::Create(compression);
+
+  while (state.KeepRunning()) {
+    auto compressed = CompressWithStream(codec.get(), data, parallel);
+    state.counters["ratio"] =
+        static_cast<double>(data.size()) / static_cast<double>(compressed->size());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void StreamDecompression(Compression::type compression, bool parallel,
+                                benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(64 * 1024 * 1024);  // 64 MB
+  auto codec = *Codec::Create(compression);
+  // Compress into independent frames in both cases, for a fair comparison
+  auto compressed = CompressWithStream(codec.get(), data, /*parallel=*/true);
+
+  while (state.KeepRunning()) {
+    auto source = std::make_shared<io::BufferReader>(compressed);
+    std::shared_ptr<io::InputStream> stream;
+    if (parallel) {
+      stream = *io::ParallelCompressedInputStream::Make(codec.get(), source);
+    } else {
+      stream = *io::CompressedInputStream::Make(codec.get(), source);
+    }
+    int64_t decompressed_size = 0;
+    while (true) {
+      auto buf = *stream->Read(1 << 20);
+      if (buf->size() == 0) {
+        break;
+      }
+      decompressed_size += buf->size();
+    }
+    ARROW_CHECK(decompressed_size == static_cast<int64_t>(data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceCompressedOutputStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  StreamCompression(COMPRESSION, /*parallel=*/false, state);
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceParallelCompressedOutputStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  StreamCompression(COMPRESSION, /*parallel=*/true, state);
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceCompressedInputStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  StreamDecompression(COMPRESSION, /*parallel=*/false, state);
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceParallelCompressedInputStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  StreamDecompression(COMPRESSION, /*parallel=*/true, state);
+}
+
+// One-shot compression of independent blocks, as of data pages or IPC body
+// buffers, where per-call setup costs are significant
+static std::vector<std::vector<uint8_t>> SmallBlockCompress(
+    Codec* codec, const std::vector<uint8_t>& data, int64_t block_size) {
+  std::vector<std::vector<uint8_t>> blocks;
+  for (int64_t pos = 0; pos < static_cast<int64_t>(data.size()); pos += block_size) {
+    const int64_t nbytes = std::min<int64_t>(block_size, data.size() - pos);
+    std::vector<uint8_t> block(codec->MaxCompressedLen(nbytes, data.data() + pos));
+    auto compressed_size =
+        *codec->Compress(nbytes, data.data() + pos, block.size(), block.data());
+    block.resize(compressed_size);
+    blocks.push_back(std::move(block));
+  }
+  return blocks;
+}
+
+static std::shared_ptr<Buffer> TrainDictionary(Compression::type compression,
+                                               const std::vector<uint8_t>& data,
+                                               int64_t block_size) {
+  // Train on every 16th block
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int64_t pos = 0; pos + block_size <= static_cast<int64_t>(data.size());
+       pos += 16 * block_size) {
+    samples.push_back(std::make_shared<Buffer>(data.data() + pos, block_size));
+  }
+  return *Codec::TrainDictionary(compression, samples, 16 * 1024);
+}
+
+static std::unique_ptr<Codec> MakeSmallBlockCodec(Compression::type compression,
+                                                  bool use_dictionary,
+                                                  const std::vector<uint8_t>& data,
+                                                  int64_t block_size) {
+  if (use_dictionary) {
+    return *Codec::CreateWithDictionary(compression,
+                                        TrainDictionary(compression, data, block_size));
+  }
+  return *Codec::Create(compression);
+}
+
+static void SmallBlockCompression(
+    Compression::type compression, bool use_dictionary,
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(8 * 1024 * 1024);  // 8 MB
+  const int64_t block_size = state.range(0);
+  auto codec = MakeSmallBlockCodec(compression, use_dictionary, data, block_size);
+
+  while (state.KeepRunning()) {
+    auto blocks = SmallBlockCompress(codec.get(), data, block_size);
+    int64_t compressed_size = 0;
+    for (const auto& block : blocks) {
+      compressed_size += block.size();
+    }
+    state.counters["ratio"] =
+        static_cast<double>(data.size()) / static_cast<double>(compressed_size);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void SmallBlockDecompression(
+    Compression::type compression, bool use_dictionary,
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(8 * 1024 * 1024);  // 8 MB
+  const int64_t block_size = state.range(0);
+  auto codec = MakeSmallBlockCodec(compression, use_dictionary, data, block_size);
+  auto blocks = SmallBlockCompress(codec.get(), data, block_size);
+
+  std::vector<uint8_t> output_buffer(block_size);
+  while (state.KeepRunning()) {
+    int64_t decompressed_size = 0;
+    for (const auto& block : blocks) {
+      decompressed_size += *codec->Decompress(block.size(), block.data(),
+                                              output_buffer.size(), output_buffer.data());
+    }
+    ARROW_CHECK(decompressed_size == static_cast<int64_t>(data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceSmallBlockCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  SmallBlockCompression(COMPRESSION, /*use_dictionary=*/false, state);
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceSmallBlockDecompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  SmallBlockDecompression(COMPRESSION, /*use_dictionary=*/false, state);
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceSmallBlockDictionaryCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  SmallBlockCompression(COMPRESSION, /*use_dictionary=*/true, state);
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceSmallBlockDictionaryDecompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  SmallBlockDecompression(COMPRESSION, /*use_dictionary=*/true, state);
+}
+
+static void SmallBlockArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("block_size")->Arg(1024)->Arg(4096)->Arg(16 * 1024);
+}
+
 #ifdef ARROW_WITH_ZLIB
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::GZIP);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::GZIP);
+BENCHMARK_TEMPLATE(ReferenceCompressedOutputStream, Compression::GZIP)->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceParallelCompressedOutputStream, Compression::GZIP)
+    ->UseRealTime();
 #endif
 
 #ifdef ARROW_WITH_BROTLI
@@ -188,11 +386,37 @@ BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::BROTLI);
 #ifdef ARROW_WITH_ZSTD
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::ZSTD);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::ZSTD);
+BENCHMARK_TEMPLATE(ReferenceCompressedOutputStream, Compression::ZSTD)->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceParallelCompressedOutputStream, Compression::ZSTD)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceCompressedInputStream, Compression::ZSTD)->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceParallelCompressedInputStream, Compression::ZSTD)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceSmallBlockCompression, Compression::ZSTD)
+    ->Apply(SmallBlockArgs);
+BENCHMARK_TEMPLATE(ReferenceSmallBlockDecompression, Compression::ZSTD)
+    ->Apply(SmallBlockArgs);
+BENCHMARK_TEMPLATE(ReferenceSmallBlockDictionaryCompression, Compression::ZSTD)
+    ->Apply(SmallBlockArgs);
+BENCHMARK_TEMPLATE(ReferenceSmallBlockDictionaryDecompression, Compression::ZSTD)
+    ->Apply(SmallBlockArgs);
 #endif
 
 #ifdef ARROW_WITH_LZ4
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::LZ4_FRAME);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::LZ4_FRAME);
+BENCHMARK_TEMPLATE(ReferenceCompressedOutputStream, Compression::LZ4_FRAME)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceParallelCompressedOutputStream, Compression::LZ4_FRAME)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceCompressedInputStream, Compression::LZ4_FRAME)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceParallelCompressedInputStream, Compression::LZ4_FRAME)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ReferenceSmallBlockCompression, Compression::LZ4_FRAME)
+    ->Apply(SmallBlockArgs);
+BENCHMARK_TEMPLATE(ReferenceSmallBlockDecompression, Compression::LZ4_FRAME)
+    ->Apply(SmallBlockArgs);
 #endif
 
 #endif
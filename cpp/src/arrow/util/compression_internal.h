@@ -18,6 +18,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "arrow/util/compression.h"  // IWYU pragma: export
 
@@ -29,6 +31,69 @@ namespace util {
 
 namespace internal {
 
+// A pool of compression library contexts, reused by the one-shot calls of a
+// codec rather than allocating a context per call.  A caller takes a context
+// for the duration of its call, so that threads sharing a codec each end up
+// with their own.  Traits must define:
+//   using Context = ...;
+//   static Context* Create();  // null on failure
+//   static void Free(Context*);
+template <typename Traits>
+class ContextPool {
+ public:
+  using Context = typename Traits::Context;
+
+  // A context taken from the pool, returned to it on destruction
+  class Lease {
+   public:
+    Lease(ContextPool* pool, Context* context) : pool_(pool), context_(context) {}
+    Lease(Lease&& other) : pool_(other.pool_), context_(other.context_) {
+      other.context_ = nullptr;
+    }
+    ~Lease() {
+      if (context_ != nullptr) {
+        pool_->Release(context_);
+      }
+    }
+
+    Context* get() const { return context_; }
+
+   private:
+    ContextPool* pool_;
+    Context* context_;
+  };
+
+  ContextPool() = default;
+  ~ContextPool() {
+    for (Context* context : free_) {
+      Traits::Free(context);
+    }
+  }
+
+  // Take a free context, creating one if none is.  The context of the lease is
+  // null if it couldn't be created.
+  Lease Acquire() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_.empty()) {
+        Context* context = free_.back();
+        free_.pop_back();
+        return Lease(this, context);
+      }
+    }
+    return Lease(this, Traits::Create());
+  }
+
+ private:
+  void Release(Context* context) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(context);
+  }
+
+  std::mutex mutex_;
+  std::vector<Context*> free_;
+};
+
 // Brotli compression quality is max (11) by default, which is slow.
 // We use 8 as a default as it is the best trade-off for Parquet workload.
 constexpr int kBrotliDefaultCompressionLevel = 8;
@@ -72,6 +137,9 @@ constexpr int kZSTDDefaultCompressionLevel = 1;
 std::unique_ptr<Codec> MakeZSTDCodec(
     int compression_level = kZSTDDefaultCompressionLevel);
 
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t dictionary_size);
+
 }  // namespace internal
 }  // namespace util
 }  // namespace arrow
@@ -26,8 +26,11 @@
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/compression_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/ubsan.h"
 
 #ifndef LZ4F_HEADER_SIZE_MAX
 #define LZ4F_HEADER_SIZE_MAX 19
@@ -233,9 +236,89 @@ class LZ4Compressor : public Compressor {
   bool first_time_;
 };
 
+// Return the size of the LZ4 (or skippable) frame at the start of `input`, or 0 if it
+// is incomplete, by walking the frame and block headers as laid out in the LZ4 frame
+// format description.
+static Result<int64_t> Lz4FrameSize(int64_t input_len, const uint8_t* input) {
+  constexpr uint32_t kFrameMagic = 0x184D2204U;
+  constexpr uint32_t kSkippableFrameMagic = 0x184D2A50U;
+  auto load_u32 = [input](int64_t pos) {
+    return BitUtil::FromLittleEndian(SafeLoadAs<uint32_t>(input + pos));
+  };
+
+  if (input_len < 8) {
+    return 0;
+  }
+  const uint32_t magic = load_u32(0);
+  if ((magic & 0xFFFFFFF0U) == kSkippableFrameMagic) {
+    const int64_t frame_size = 8 + static_cast<int64_t>(load_u32(4));
+    return frame_size <= input_len ? frame_size : 0;
+  }
+  if (magic != kFrameMagic) {
+    return Status::IOError("Invalid LZ4 frame: unknown magic number");
+  }
+
+  // Frame descriptor: FLG, BD, optional content size and dictionary id, checksum
+  const uint8_t flags = input[4];
+  if ((flags >> 6) != 1) {
+    return Status::IOError("Invalid LZ4 frame: unsupported version");
+  }
+  const bool has_block_checksum = (flags & 0x10) != 0;
+  const bool has_content_size = (flags & 0x08) != 0;
+  const bool has_content_checksum = (flags & 0x04) != 0;
+  const bool has_dict_id = (flags & 0x01) != 0;
+  int64_t pos = 7 + (has_content_size ? 8 : 0) + (has_dict_id ? 4 : 0);
+
+  // Data blocks, up to the end mark
+  while (true) {
+    if (pos + 4 > input_len) {
+      return 0;
+    }
+    const uint32_t block_size = load_u32(pos);
+    pos += 4;
+    if (block_size == 0) {
+      break;
+    }
+    // The highest bit flags uncompressed blocks
+    pos += (block_size & 0x7FFFFFFFU) + (has_block_checksum ? 4 : 0);
+  }
+  pos += has_content_checksum ? 4 : 0;
+  return pos <= input_len ? pos : 0;
+}
+
+struct CCtxTraits {
+  using Context = LZ4F_cctx;
+  static Context* Create() {
+    Context* context = nullptr;
+    if (LZ4F_isError(LZ4F_createCompressionContext(&context, LZ4F_VERSION))) {
+      return nullptr;
+    }
+    return context;
+  }
+  static void Free(Context* context) {
+    ARROW_UNUSED(LZ4F_freeCompressionContext(context));
+  }
+};
+
+struct DCtxTraits {
+  using Context = LZ4F_dctx;
+  static Context* Create() {
+    Context* context = nullptr;
+    if (LZ4F_isError(LZ4F_createDecompressionContext(&context, LZ4F_VERSION))) {
+      return nullptr;
+    }
+    return context;
+  }
+  static void Free(Context* context) {
+    ARROW_UNUSED(LZ4F_freeDecompressionContext(context));
+  }
+};
+
 // ----------------------------------------------------------------------
 // Lz4 frame codec implementation
 
+// One-shot calls reuse pooled contexts rather than creating one per call as
+// LZ4F_compressFrame() does, which is most of the cost for small inputs.
 class Lz4FrameCodec : public Codec {
  public:
   Lz4FrameCodec() : prefs_(DefaultPreferences()) {}
@@ -248,17 +331,80 @@ class Lz4FrameCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    auto output_len =
-        LZ4F_compressFrame(output_buffer, static_cast<size_t>(output_buffer_len), input,
-                           static_cast<size_t>(input_len), &prefs_);
-    if (LZ4F_isError(output_len)) {
-      return LZ4Error(output_len, "Lz4 compression failure: ");
+    auto context = compression_contexts_.Acquire();
+    if (context.get() == nullptr) {
+      return Status::OutOfMemory("Lz4 compression context creation failed");
+    }
+    // The same preferences as LZ4F_compressFrame(), so that the output is the
+    // same and fits in LZ4F_compressFrameBound()
+    LZ4F_preferences_t prefs = prefs_;
+    prefs.autoFlush = 1;
+    if (input_len <= 64 * 1024) {
+      prefs.frameInfo.blockMode = LZ4F_blockIndependent;
+    }
+
+    auto dst = output_buffer;
+    auto dst_capacity = static_cast<size_t>(output_buffer_len);
+    size_t ret = LZ4F_compressBegin(context.get(), dst, dst_capacity, &prefs);
+    if (LZ4F_isError(ret)) {
+      return LZ4Error(ret, "Lz4 compression failure: ");
+    }
+    dst += ret;
+    dst_capacity -= ret;
+    ret = LZ4F_compressUpdate(context.get(), dst, dst_capacity, input,
+                              static_cast<size_t>(input_len), nullptr /* options */);
+    if (LZ4F_isError(ret)) {
+      return LZ4Error(ret, "Lz4 compression failure: ");
     }
-    return static_cast<int64_t>(output_len);
+    dst += ret;
+    dst_capacity -= ret;
+    ret = LZ4F_compressEnd(context.get(), dst, dst_capacity, nullptr /* options */);
+    if (LZ4F_isError(ret)) {
+      return LZ4Error(ret, "Lz4 compression failure: ");
+    }
+    dst += ret;
+    return static_cast<int64_t>(dst - output_buffer);
   }
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
+#if defined(LZ4_VERSION_NUMBER) && LZ4_VERSION_NUMBER >= 10800
+    auto context = decompression_contexts_.Acquire();
+    if (context.get() == nullptr) {
+      return Status::OutOfMemory("Lz4 decompression context creation failed");
+    }
+    // A failed call may have left the context in the middle of a frame
+    LZ4F_resetDecompressionContext(context.get());
+
+    int64_t total_bytes_written = 0;
+    bool finished = false;
+    while (!finished && input_len != 0) {
+      auto src_size = static_cast<size_t>(input_len);
+      auto dst_capacity = static_cast<size_t>(output_buffer_len);
+      size_t ret = LZ4F_decompress(context.get(), output_buffer, &dst_capacity, input,
+                                   &src_size, nullptr /* options */);
+      if (LZ4F_isError(ret)) {
+        return LZ4Error(ret, "LZ4 decompress failed: ");
+      }
+      finished = (ret == 0);
+      input += src_size;
+      input_len -= static_cast<int64_t>(src_size);
+      output_buffer += dst_capacity;
+      output_buffer_len -= static_cast<int64_t>(dst_capacity);
+      total_bytes_written += static_cast<int64_t>(dst_capacity);
+      if (src_size == 0 && dst_capacity == 0) {
+        return Status::IOError("Lz4 decompression buffer too small");
+      }
+    }
+    if (!finished) {
+      return Status::IOError("Lz4 compressed input contains less than one frame");
+    }
+    if (input_len != 0) {
+      return Status::IOError("Lz4 compressed input contains more than one frame");
+    }
+    return total_bytes_written;
+#else
+    // Contexts can't be reset before 1.8.0
     ARROW_ASSIGN_OR_RAISE(auto decomp, MakeDecompressor());
 
     int64_t total_bytes_written = 0;
@@ -282,6 +428,7 @@ class Lz4FrameCodec : public Codec {
       return Status::IOError("Lz4 compressed input contains more than one frame");
     }
     return total_bytes_written;
+#endif
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
@@ -296,10 +443,16 @@ class Lz4FrameCodec : public Codec {
     return ptr;
   }
 
+  Result<int64_t> FrameSize(int64_t input_len, const uint8_t* input) override {
+    return Lz4FrameSize(input_len, input);
+  }
+
   const char* name() const override { return "lz4"; }
 
  protected:
   LZ4F_preferences_t prefs_;
+  internal::ContextPool<CCtxTraits> compression_contexts_;
+  internal::ContextPool<DCtxTraits> decompression_contexts_;
 };
 
 // ----------------------------------------------------------------------
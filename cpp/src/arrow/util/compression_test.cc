@@ -22,10 +22,12 @@
 #include <ostream>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -53,6 +55,19 @@ std::vector<uint8_t> MakeCompressibleData(int data_size) {
   return data;
 }
 
+// Small records sharing most of their bytes, as the values of a data page
+std::vector<uint8_t> MakeRecordData(int num_records, int seed) {
+  std::default_random_engine engine(seed);
+  std::uniform_int_distribution<int> dist(0, 99999);
+  std::string data;
+  for (int i = 0; i < num_records; ++i) {
+    data += "{\"id\": " + std::to_string(dist(engine)) + ", \"name\": \"user" +
+            std::to_string(dist(engine)) + "\", \"status\": \"active\", \"score\": " +
+            std::to_string(dist(engine)) + "}\n";
+  }
+  return std::vector<uint8_t>(data.begin(), data.end());
+}
+
 // Check roundtrip of one-shot compression and decompression functions.
 void CheckCodecRoundtrip(std::unique_ptr<Codec>& c1, std::unique_ptr<Codec>& c2,
                          const std::vector<uint8_t>& data) {
@@ -523,6 +538,81 @@ TEST_P(CodecTest, StreamingDecompressorReuse) {
   CheckStreamingRoundtrip(compressor, decompressor, data);
 }
 
+TEST_P(CodecTest, ConcurrentRoundtrip) {
+  if (GetCompression() == Compression::BZ2) {
+    // SKIP: BZ2 doesn't support one-shot compression
+    return;
+  }
+
+  // Codecs may pool their contexts, which must not be shared between calls
+  auto codec = MakeCodec();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&codec, i]() {
+      for (int data_size : {100, 1000, 10000}) {
+        std::vector<uint8_t> data = MakeRecordData(data_size / 50, i);
+        CheckCodecRoundtrip(codec, codec, data);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST_P(CodecTest, DictionaryUnsupported) {
+  if (GetCompression() == Compression::ZSTD) {
+    return;
+  }
+
+  auto dictionary = std::make_shared<Buffer>("dictionary");
+  ASSERT_RAISES(NotImplemented,
+                Codec::CreateWithDictionary(GetCompression(), dictionary));
+  ASSERT_RAISES(NotImplemented,
+                Codec::TrainDictionary(GetCompression(), {dictionary}, 1024));
+}
+
+#ifdef ARROW_WITH_ZSTD
+TEST(TestCodecMisc, ZSTDDictionary) {
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < 1000; ++i) {
+    std::vector<uint8_t> sample = MakeRecordData(4, i);
+    samples.push_back(Buffer::FromString(std::string(sample.begin(), sample.end())));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       Codec::TrainDictionary(Compression::ZSTD, samples, 4096));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 4096);
+
+  std::unique_ptr<Codec> c1, c2, plain;
+  ASSERT_OK_AND_ASSIGN(c1, Codec::CreateWithDictionary(Compression::ZSTD, dictionary));
+  ASSERT_OK_AND_ASSIGN(c2, Codec::CreateWithDictionary(Compression::ZSTD, dictionary));
+  ASSERT_OK_AND_ASSIGN(plain, Codec::Create(Compression::ZSTD));
+
+  for (int num_records : {0, 1, 4, 100}) {
+    std::vector<uint8_t> data = MakeRecordData(num_records, 12345);
+    CheckCodecRoundtrip(c1, c2, data);
+    CheckStreamingRoundtrip(c1.get(), data);
+  }
+
+  // Small inputs compress better with the dictionary, which is needed to
+  // decompress them
+  std::vector<uint8_t> data = MakeRecordData(4, 12345);
+  std::vector<uint8_t> compressed(c1->MaxCompressedLen(data.size(), data.data()));
+  std::vector<uint8_t> plain_compressed(compressed.size());
+  std::vector<uint8_t> decompressed(data.size());
+  ASSERT_OK_AND_ASSIGN(
+      int64_t compressed_size,
+      c1->Compress(data.size(), data.data(), compressed.size(), compressed.data()));
+  ASSERT_OK_AND_ASSIGN(int64_t plain_compressed_size,
+                       plain->Compress(data.size(), data.data(), plain_compressed.size(),
+                                       plain_compressed.data()));
+  ASSERT_LT(compressed_size, plain_compressed_size);
+  ASSERT_RAISES(IOError, plain->Decompress(compressed_size, compressed.data(),
+                                           decompressed.size(), decompressed.data()));
+}
+#endif
+
 #ifdef ARROW_WITH_ZLIB
 INSTANTIATE_TEST_SUITE_P(TestGZip, CodecTest, ::testing::Values(Compression::GZIP));
 #endif
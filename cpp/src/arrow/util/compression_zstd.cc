@@ -19,10 +19,15 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -40,12 +45,25 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+struct CCtxTraits {
+  using Context = ZSTD_CCtx;
+  static Context* Create() { return ZSTD_createCCtx(); }
+  static void Free(Context* context) { ZSTD_freeCCtx(context); }
+};
+
+struct DCtxTraits {
+  using Context = ZSTD_DCtx;
+  static Context* Create() { return ZSTD_createDCtx(); }
+  static void Free(Context* context) { ZSTD_freeDCtx(context); }
+};
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(const ZSTD_DDict* dictionary)
+      : stream_(ZSTD_createDStream()), dictionary_(dictionary) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
@@ -54,9 +72,16 @@ class ZSTDDecompressor : public Decompressor {
     size_t ret = ZSTD_initDStream(stream_);
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
-    } else {
-      return Status::OK();
     }
+#if ZSTD_VERSION_NUMBER >= 10400
+    if (dictionary_ != nullptr) {
+      ret = ZSTD_DCtx_refDDict(stream_, dictionary_);
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD init failed: ");
+      }
+    }
+#endif
+    return Status::OK();
   }
 
   Result<DecompressResult> Decompress(int64_t input_len, const uint8_t* input,
@@ -88,6 +113,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  const ZSTD_DDict* dictionary_;
   bool finished_;
 };
 
@@ -96,8 +122,10 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  ZSTDCompressor(int compression_level, const ZSTD_CDict* dictionary)
+      : stream_(ZSTD_createCStream()),
+        compression_level_(compression_level),
+        dictionary_(dictionary) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
@@ -105,9 +133,17 @@ class ZSTDCompressor : public Compressor {
     size_t ret = ZSTD_initCStream(stream_, compression_level_);
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
-    } else {
-      return Status::OK();
     }
+#if ZSTD_VERSION_NUMBER >= 10400
+    if (dictionary_ != nullptr) {
+      // The compression level is the dictionary's
+      ret = ZSTD_CCtx_refCDict(stream_, dictionary_);
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD init failed: ");
+      }
+    }
+#endif
+    return Status::OK();
   }
 
   Result<CompressResult> Compress(int64_t input_len, const uint8_t* input,
@@ -166,11 +202,15 @@ class ZSTDCompressor : public Compressor {
 
  private:
   int compression_level_;
+  const ZSTD_CDict* dictionary_;
 };
 
 // ----------------------------------------------------------------------
 // ZSTD codec implementation
 
+// One-shot calls reuse pooled contexts: ZSTD_compress() and ZSTD_decompress()
+// allocate and initialize a context of several hundred kilobytes per call,
+// which dominates the cost of compressing small inputs such as data pages.
 class ZSTDCodec : public Codec {
  public:
   explicit ZSTDCodec(int compression_level) {
@@ -179,6 +219,23 @@ class ZSTDCodec : public Codec {
                              : compression_level;
   }
 
+  ~ZSTDCodec() override {
+    ZSTD_freeCDict(compression_dictionary_);
+    ZSTD_freeDDict(decompression_dictionary_);
+  }
+
+  Status SetDictionary(std::shared_ptr<Buffer> dictionary) override {
+    compression_dictionary_ =
+        ZSTD_createCDict(dictionary->data(), static_cast<size_t>(dictionary->size()),
+                         compression_level_);
+    decompression_dictionary_ =
+        ZSTD_createDDict(dictionary->data(), static_cast<size_t>(dictionary->size()));
+    if (compression_dictionary_ == nullptr || decompression_dictionary_ == nullptr) {
+      return Status::IOError("ZSTD dictionary creation failed");
+    }
+    return Status::OK();
+  }
+
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
     if (output_buffer == nullptr) {
@@ -189,8 +246,20 @@ class ZSTDCodec : public Codec {
       output_buffer = empty_buffer;
     }
 
-    size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len));
+    auto context = decompression_contexts_.Acquire();
+    if (context.get() == nullptr) {
+      return Status::OutOfMemory("ZSTD decompression context creation failed");
+    }
+    size_t ret;
+    if (decompression_dictionary_ != nullptr) {
+      ret = ZSTD_decompress_usingDDict(
+          context.get(), output_buffer, static_cast<size_t>(output_buffer_len), input,
+          static_cast<size_t>(input_len), decompression_dictionary_);
+    } else {
+      ret = ZSTD_decompressDCtx(context.get(), output_buffer,
+                                static_cast<size_t>(output_buffer_len), input,
+                                static_cast<size_t>(input_len));
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD decompression failed: ");
     }
@@ -208,22 +277,54 @@ class ZSTDCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len), compression_level_);
+    auto context = compression_contexts_.Acquire();
+    if (context.get() == nullptr) {
+      return Status::OutOfMemory("ZSTD compression context creation failed");
+    }
+    size_t ret;
+    if (compression_dictionary_ != nullptr) {
+      ret = ZSTD_compress_usingCDict(
+          context.get(), output_buffer, static_cast<size_t>(output_buffer_len), input,
+          static_cast<size_t>(input_len), compression_dictionary_);
+    } else {
+      ret = ZSTD_compressCCtx(context.get(), output_buffer,
+                              static_cast<size_t>(output_buffer_len), input,
+                              static_cast<size_t>(input_len), compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD compression failed: ");
     }
     return static_cast<int64_t>(ret);
   }
 
+  Result<int64_t> FrameSize(int64_t input_len, const uint8_t* input) override {
+#if ZSTD_VERSION_NUMBER >= 10400
+    // This only walks the block headers
+    size_t ret = ZSTD_findFrameCompressedSize(input, static_cast<size_t>(input_len));
+    if (ZSTD_isError(ret)) {
+      if (ZSTD_getErrorCode(ret) == ZSTD_error_srcSize_wrong) {
+        // Incomplete frame
+        return 0;
+      }
+      return ZSTDError(ret, "Invalid ZSTD frame: ");
+    }
+    return static_cast<int64_t>(ret);
+#else
+    return Codec::FrameSize(input_len, input);
+#endif
+  }
+
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
-    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+    RETURN_NOT_OK(CheckStreamingDictionary());
+    auto ptr =
+        std::make_shared<ZSTDCompressor>(compression_level_, compression_dictionary_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
-    auto ptr = std::make_shared<ZSTDDecompressor>();
+    RETURN_NOT_OK(CheckStreamingDictionary());
+    auto ptr = std::make_shared<ZSTDDecompressor>(decompression_dictionary_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -231,7 +332,21 @@ class ZSTDCodec : public Codec {
   const char* name() const override { return "zstd"; }
 
  private:
+  Status CheckStreamingDictionary() const {
+#if ZSTD_VERSION_NUMBER < 10400
+    if (compression_dictionary_ != nullptr) {
+      return Status::NotImplemented(
+          "Streaming with a dictionary needs ZSTD 1.4.0 or later");
+    }
+#endif
+    return Status::OK();
+  }
+
   int compression_level_;
+  ZSTD_CDict* compression_dictionary_ = nullptr;
+  ZSTD_DDict* decompression_dictionary_ = nullptr;
+  ContextPool<CCtxTraits> compression_contexts_;
+  ContextPool<DCtxTraits> decompression_contexts_;
 };
 
 }  // namespace
@@ -240,6 +355,34 @@ std::unique_ptr<Codec> MakeZSTDCodec(int compression_level) {
   return std::unique_ptr<Codec>(new ZSTDCodec(compression_level));
 }
 
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t dictionary_size) {
+  // ZDICT_trainFromBuffer() takes the samples concatenated
+  std::vector<size_t> sample_sizes;
+  int64_t total_size = 0;
+  for (const auto& sample : samples) {
+    sample_sizes.push_back(static_cast<size_t>(sample->size()));
+    total_size += sample->size();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto concatenated, AllocateBuffer(total_size));
+  uint8_t* out = concatenated->mutable_data();
+  for (const auto& sample : samples) {
+    std::memcpy(out, sample->data(), static_cast<size_t>(sample->size()));
+    out += sample->size();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto dictionary, AllocateResizableBuffer(dictionary_size));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(dictionary_size),
+      concatenated->data(), sample_sizes.data(), static_cast<unsigned>(samples.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ",
+                           ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  return std::shared_ptr<Buffer>(std::move(dictionary));
+}
+
 }  // namespace internal
 }  // namespace util
 }  // namespace arrow
@@ -125,6 +125,7 @@ static struct {
 #if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
     {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2}, {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
 #endif
 #if defined(__aarch64__)
     {"asimd", CpuInfo::ASIMD},
@@ -203,9 +204,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
     return false;
   }
   const int register_ECX_id = 1;
+  const int extended_features_id = 7;
   int highest_valid_id = 0;
   int highest_extended_valid_id = 0;
   std::bitset<32> features_ECX;
+  std::bitset<32> extended_features_EBX;
   std::array<int, 4> cpu_info;
 
   // Get highest valid id
@@ -217,6 +220,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   __cpuidex(cpu_info.data(), register_ECX_id, 0);
   features_ECX = cpu_info[2];
 
+  if (highest_valid_id >= extended_features_id) {
+    __cpuidex(cpu_info.data(), extended_features_id, 0);
+    extended_features_EBX = cpu_info[1];
+  }
+
   // Get highest extended id
   __cpuid(cpu_info.data(), 0x80000000);
   highest_extended_valid_id = cpu_info[0];
@@ -235,6 +243,7 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+  if (extended_features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
   return true;
 }
 #endif
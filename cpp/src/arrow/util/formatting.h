@@ -182,18 +182,17 @@ class StringFormatter<UInt64Type> : public IntToStringFormatterMixin<UInt64Type>
 /////////////////////////////////////////////////////////////////////////
 // Floating-point formatting
 
+// Values are formatted with the shortest representation that parses back to
+// the same value, in plain notation for decimal exponents in [-6, 10) and in
+// scientific notation otherwise (e.g. "0.5", "1234.5", "1e+20", "1.5e-7").
 class ARROW_EXPORT FloatToStringFormatter {
  public:
-  FloatToStringFormatter();
-  ~FloatToStringFormatter();
+  // The largest number of characters written for a value
+  static constexpr int kMaxLength = 32;
 
   // Returns the number of characters written
   int FormatFloat(float v, char* out_buffer, int out_size);
   int FormatFloat(double v, char* out_buffer, int out_size);
-
- protected:
-  struct Impl;
-  std::unique_ptr<Impl> impl_;
 };
 
 template <typename ARROW_TYPE>
@@ -201,7 +200,7 @@ class FloatToStringFormatterMixin : public FloatToStringFormatter {
  public:
   using value_type = typename ARROW_TYPE::c_type;
 
-  static constexpr int buffer_size = 50;
+  static constexpr int buffer_size = kMaxLength;
 
   explicit FloatToStringFormatterMixin(const std::shared_ptr<DataType>& = NULLPTR) {}
 
@@ -225,5 +224,14 @@ class StringFormatter<DoubleType> : public FloatToStringFormatterMixin<DoubleTyp
   using FloatToStringFormatterMixin::FloatToStringFormatterMixin;
 };
 
+// Append the representations of the values of `array`, as formatted by
+// StringFormatter, to `builder`, and nulls for its nulls.  This is faster than
+// formatting and appending values one at a time, since the builder space is
+// reserved in bulk and values are appended without further checks.
+ARROW_EXPORT Status FormatFloats(const FloatArray& array, StringBuilder* builder);
+ARROW_EXPORT Status FormatFloats(const DoubleArray& array, StringBuilder* builder);
+ARROW_EXPORT Status FormatFloats(const FloatArray& array, LargeStringBuilder* builder);
+ARROW_EXPORT Status FormatFloats(const DoubleArray& array, LargeStringBuilder* builder);
+
 }  // namespace internal
 }  // namespace arrow
@@ -16,19 +16,26 @@
 // under the License.
 
 #include <cmath>
+#include <cstdlib>
+#include <limits>
 #include <locale>
+#include <memory>
 #include <stdexcept>
 #include <string>
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/formatting.h"
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::StringFormatter;
 
 class StringAppender {
@@ -277,6 +284,78 @@ TEST(Formatting, Double) {
   AssertFormatting(formatter, std::nan(""), "nan");
   AssertFormatting(formatter, HUGE_VAL, "inf");
   AssertFormatting(formatter, -HUGE_VAL, "-inf");
+
+  // Shortest round-trip representations
+  AssertFormatting(formatter, 0.1, "0.1");
+  AssertFormatting(formatter, 0.3, "0.3");
+  AssertFormatting(formatter, 0.1 + 0.2, "0.30000000000000004");
+  AssertFormatting(formatter, 1.0 / 3, "0.3333333333333333");
+  AssertFormatting(formatter, 123456789.125, "123456789.125");
+  AssertFormatting(formatter, -1.5e-300, "-1.5e-300");
+  AssertFormatting(formatter, 9007199254740993.0, "9.007199254740992e+15");
+  AssertFormatting(formatter, std::numeric_limits<double>::max(),
+                   "1.7976931348623157e+308");
+  AssertFormatting(formatter, std::numeric_limits<double>::min(),
+                   "2.2250738585072014e-308");
+  AssertFormatting(formatter, std::numeric_limits<double>::denorm_min(), "5e-324");
+}
+
+TEST(Formatting, FloatRoundTrip) {
+  StringFormatter<FloatType> float_formatter;
+  StringFormatter<DoubleType> double_formatter;
+
+  auto check_round_trip = [&](double value) {
+    StringAppender appender;
+    ASSERT_OK(double_formatter(value, appender));
+    const std::string formatted = appender.string();
+    ASSERT_EQ(value, std::strtod(formatted.c_str(), nullptr)) << formatted;
+
+    const auto float_value = static_cast<float>(value);
+    StringAppender float_appender;
+    ASSERT_OK(float_formatter(float_value, float_appender));
+    ASSERT_EQ(float_value, std::strtof(float_appender.string().c_str(), nullptr))
+        << float_appender.string();
+  };
+  for (int exponent = -1074; exponent <= 1023; ++exponent) {
+    const double value = std::ldexp(1.0, exponent);
+    check_round_trip(value);
+    check_round_trip(std::nextafter(value, 0.0));
+    check_round_trip(-std::nextafter(value, HUGE_VAL));
+  }
+  for (int i = 1; i < 100000; i += 7) {
+    check_round_trip(i / 1000.0);
+    check_round_trip(i * 1.1e15);
+  }
+}
+
+TEST(Formatting, FormatFloats) {
+  auto array = ArrayFromJSON(float64(), "[0.5, null, 1e20, -0.0001, NaN, 123.25]");
+  StringBuilder builder;
+  ASSERT_OK(internal::FormatFloats(checked_cast<const DoubleArray&>(*array), &builder));
+  ASSERT_OK(builder.Append("x"));
+  std::shared_ptr<Array> strings;
+  ASSERT_OK(builder.Finish(&strings));
+  auto expected =
+      ArrayFromJSON(utf8(), R"(["0.5", null, "1e+20", "-0.0001", "nan", "123.25", "x"])");
+  AssertArraysEqual(*expected, *strings);
+
+  // Several chunks of values
+  FloatBuilder float_builder;
+  for (int i = 0; i < 3000; ++i) {
+    ASSERT_OK(float_builder.Append(static_cast<float>(i) / 4));
+  }
+  std::shared_ptr<Array> floats;
+  ASSERT_OK(float_builder.Finish(&floats));
+  LargeStringBuilder large_builder;
+  ASSERT_OK(internal::FormatFloats(checked_cast<const FloatArray&>(*floats),
+                                   &large_builder));
+  std::shared_ptr<Array> large_strings;
+  ASSERT_OK(large_builder.Finish(&large_strings));
+  const auto& large_string_array = checked_cast<const LargeStringArray&>(*large_strings);
+  ASSERT_EQ(3000, large_string_array.length());
+  ASSERT_EQ("0", large_string_array.GetString(0));
+  ASSERT_EQ("0.25", large_string_array.GetString(1));
+  ASSERT_EQ("749.75", large_string_array.GetString(2999));
 }
 
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -54,6 +55,8 @@ class ARROW_EXPORT FutureImpl {
   static std::unique_ptr<FutureImpl> Make();
 
  protected:
+  using Callback = std::function<void()>;
+
   FutureImpl();
   ARROW_DISALLOW_COPY_AND_ASSIGN(FutureImpl);
 
@@ -62,6 +65,8 @@ class ARROW_EXPORT FutureImpl {
   void MarkFailed();
   void Wait();
   bool Wait(double seconds);
+  // Run the callback once the future is finished (immediately if it already is)
+  void AddCallback(Callback callback);
 
   // Waiter API
   inline FutureState SetWaiter(FutureWaiter* w, int future_num);
@@ -154,6 +159,8 @@ class FutureStorage : public FutureStorageBase {
 
   Status status() const { return result_.status(); }
 
+  const Result<T>& outcome() const { return result_; }
+
   template <typename U>
   void MarkFinished(U&& value) {
     result_ = std::forward<U>(value);
@@ -174,8 +181,8 @@ class FutureStorage : public FutureStorageBase {
   friend class Future<T>;
 };
 
-// A Future<void> just stores a Status (always ok for now, but that could change
-// if we implement cancellation).
+// A Future<void> just stores a Status (which can only be an error if one was
+// propagated to it, e.g. by Future::Then()).
 template <>
 class FutureStorage<void> : public FutureStorageBase {
  public:
@@ -183,9 +190,15 @@ class FutureStorage<void> : public FutureStorageBase {
 
   Status status() const { return status_; }
 
+  const Status& outcome() const { return status_; }
+
   void MarkFinished(Status st = Status::OK()) {
     status_ = std::move(st);
-    impl_->MarkFinished();
+    if (ARROW_PREDICT_TRUE(status_.ok())) {
+      impl_->MarkFinished();
+    } else {
+      impl_->MarkFailed();
+    }
   }
 
   template <typename Func>
@@ -206,6 +219,8 @@ class FutureStorage<Status> : public FutureStorageBase {
 
   Status status() const { return status_; }
 
+  const Status& outcome() const { return status_; }
+
   void MarkFinished(Status st) {
     status_ = std::move(st);
     if (ARROW_PREDICT_TRUE(status_.ok())) {
@@ -224,6 +239,131 @@ class FutureStorage<Status> : public FutureStorageBase {
   Status status_;
 };
 
+// ---------------------------------------------------------------------
+// Helpers for Future::Then()
+
+namespace detail {
+
+// The type returned by calling the success continuation of a Future<T>
+template <typename OnSuccess, typename T, bool HasValue = FutureStorage<T>::HasValue>
+struct ContinueResultOf {
+  using type = typename std::result_of<OnSuccess && (const T&)>::type;
+};
+
+template <typename OnSuccess, typename T>
+struct ContinueResultOf<OnSuccess, T, false> {
+  using type = typename std::result_of<OnSuccess && ()>::type;
+};
+
+// Mark the Future returned by Then() with the value returned by a continuation.
+// A continuation may return `V`, `Result<V>`, `Status`, `void` or `Future<V>`.
+template <typename ContinueResult>
+struct ContinueFuture {
+  using FutureType = Future<ContinueResult>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& f, Args&&... a) {
+    next.MarkFinished(std::forward<ContinueFunc>(f)(std::forward<Args>(a)...));
+  }
+};
+
+template <typename T>
+struct ContinueFuture<Result<T>> {
+  using FutureType = Future<T>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& f, Args&&... a) {
+    next.MarkFinished(std::forward<ContinueFunc>(f)(std::forward<Args>(a)...));
+  }
+};
+
+template <>
+struct ContinueFuture<void> {
+  using FutureType = Future<void>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& f, Args&&... a) {
+    std::forward<ContinueFunc>(f)(std::forward<Args>(a)...);
+    next.MarkFinished();
+  }
+};
+
+// Callback marking a Future with the outcome of another one
+template <typename FutureType>
+struct MarkNextFinished {
+  template <typename Outcome>
+  void operator()(const Outcome& outcome) {
+    next.MarkFinished(outcome);
+  }
+
+  FutureType next;
+};
+
+template <typename T>
+struct ContinueFuture<Future<T>> {
+  using FutureType = Future<T>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& f, Args&&... a) {
+    auto inner = std::forward<ContinueFunc>(f)(std::forward<Args>(a)...);
+    inner.AddCallback(MarkNextFinished<NextFuture>{std::move(next)});
+  }
+};
+
+// The default failure continuation: forward the error to the next Future
+struct PassthruOnFailure {};
+
+template <typename T, typename OnSuccess, typename OnFailure, typename NextFuture,
+          bool HasValue = FutureStorage<T>::HasValue>
+struct ThenCallback {
+  using ContinueResult = typename ContinueResultOf<OnSuccess, T>::type;
+
+  void operator()(const Result<T>& result) {
+    if (ARROW_PREDICT_TRUE(result.ok())) {
+      ContinueFuture<ContinueResult>::Run(next, on_success, result.ValueUnsafe());
+    } else {
+      OnError(result.status(), std::is_same<OnFailure, PassthruOnFailure>());
+    }
+  }
+
+  void OnError(const Status& st, std::true_type) { next.MarkFinished(st); }
+
+  void OnError(const Status& st, std::false_type) {
+    using FailureResult = typename std::result_of<OnFailure && (const Status&)>::type;
+    ContinueFuture<FailureResult>::Run(next, on_failure, st);
+  }
+
+  OnSuccess on_success;
+  OnFailure on_failure;
+  NextFuture next;
+};
+
+template <typename T, typename OnSuccess, typename OnFailure, typename NextFuture>
+struct ThenCallback<T, OnSuccess, OnFailure, NextFuture, false> {
+  using ContinueResult = typename ContinueResultOf<OnSuccess, T>::type;
+
+  void operator()(const Status& st) {
+    if (ARROW_PREDICT_TRUE(st.ok())) {
+      ContinueFuture<ContinueResult>::Run(next, on_success);
+    } else {
+      OnError(st, std::is_same<OnFailure, PassthruOnFailure>());
+    }
+  }
+
+  void OnError(const Status& st, std::true_type) { next.MarkFinished(st); }
+
+  void OnError(const Status& st, std::false_type) {
+    using FailureResult = typename std::result_of<OnFailure && (const Status&)>::type;
+    ContinueFuture<FailureResult>::Run(next, on_failure, st);
+  }
+
+  OnSuccess on_success;
+  OnFailure on_failure;
+  NextFuture next;
+};
+
+}  // namespace detail
+
 // ---------------------------------------------------------------------
 // Public API
 
@@ -237,7 +377,9 @@ class FutureStorage<Status> : public FutureStorageBase {
 ///
 /// The consumer API allows querying a Future's current state, wait for it
 /// to complete, or wait on multiple Futures at once (using WaitForAll,
-/// WaitForAny or AsCompletedIterator).
+/// WaitForAny or AsCompletedIterator).  It also allows composing Futures
+/// without blocking, by registering callbacks (AddCallback), chaining
+/// continuations (Then), or combining several Futures (All, AllComplete, Any).
 template <typename T>
 class Future {
   static constexpr bool HasValue = FutureStorage<T>::HasValue;
@@ -311,6 +453,51 @@ class Future {
     return impl_->Wait(seconds);
   }
 
+  /// \brief Consumer API: run a callback when the Future completes
+  ///
+  /// The callback is called with the Future's result (`const Result<T>&`),
+  /// or with its status (`const Status&`) for Future<void> and Future<Status>.
+  /// If the Future is already finished, the callback is run immediately in
+  /// the calling thread.  Otherwise it is run in the thread which marks the
+  /// Future finished, so it should not block; see ThreadPool::Transfer()
+  /// to run it on an executor instead.
+  ///
+  /// The callback must be copyable.
+  template <typename OnComplete>
+  void AddCallback(OnComplete on_complete) const {
+    CheckValid();
+    // The storage is kept alive by whoever marks the Future finished
+    auto storage = storage_.get();
+    impl_->AddCallback(
+        [storage, on_complete]() mutable { on_complete(storage->outcome()); });
+  }
+
+  /// \brief Consumer API: chain a continuation to run when the Future completes
+  ///
+  /// Return a new Future which is finished with the return value of
+  /// `on_success` (called with `const T&`, or without arguments for
+  /// Future<void> and Future<Status>) if this Future succeeds, or of
+  /// `on_failure` (called with `const Status&`) if it fails.  By default, a
+  /// failure is forwarded as is to the returned Future.
+  ///
+  /// The continuations can return `V` or `Result<V>` (giving a Future<V>),
+  /// `Status` (giving a Future<Status>), `void` (giving a Future<void>), or
+  /// `Future<V>`, in which case the returned Future is finished once that
+  /// Future completes.  `on_failure` should return the same type as `on_success`.
+  ///
+  /// Continuations are run as callbacks; see AddCallback().
+  template <typename OnSuccess, typename OnFailure = detail::PassthruOnFailure,
+            typename ContinueResult =
+                typename detail::ContinueResultOf<OnSuccess, T>::type,
+            typename NextFuture =
+                typename detail::ContinueFuture<ContinueResult>::FutureType>
+  NextFuture Then(OnSuccess on_success, OnFailure on_failure = OnFailure()) const {
+    auto next = NextFuture::Make();
+    AddCallback(detail::ThenCallback<T, OnSuccess, OnFailure, NextFuture>{
+        std::move(on_success), std::move(on_failure), next});
+    return next;
+  }
+
   // Producer API
 
   /// \brief Producer API: execute function and mark Future finished
@@ -419,6 +606,128 @@ inline std::vector<int> WaitForAny(const std::vector<Future<T>*>& futures,
   return waiter->MoveFinishedFutures();
 }
 
+namespace detail {
+
+template <typename T>
+struct AllCompleteCallback {
+  struct State {
+    explicit State(std::vector<Future<T>> fs)
+        : futures(std::move(fs)), n_remaining(futures.size()) {}
+
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> n_remaining;
+  };
+
+  template <typename Outcome>
+  void operator()(const Outcome&) {
+    if (state->n_remaining.fetch_sub(1) != 1) {
+      return;
+    }
+    // All futures are finished, report the first error if any
+    for (const auto& future : state->futures) {
+      Status st = future.status();
+      if (!st.ok()) {
+        out.MarkFinished(std::move(st));
+        return;
+      }
+    }
+    out.MarkFinished(Status::OK());
+  }
+
+  std::shared_ptr<State> state;
+  Future<Status> out;
+};
+
+template <typename T>
+struct AnyCallback {
+  template <typename Outcome>
+  void operator()(const Outcome& outcome) {
+    if (!claimed->exchange(true)) {
+      out.MarkFinished(outcome);
+    }
+  }
+
+  std::shared_ptr<std::atomic<bool>> claimed;
+  Future<T> out;
+};
+
+}  // namespace detail
+
+/// \brief Create a Future which completes when all of `futures` complete.
+///
+/// The Future's result is a vector of the results of `futures`, in the same
+/// order.  It is never failed: failed results are stored in the vector
+/// alongside successful results.
+template <typename T>
+Future<std::vector<Result<T>>> All(std::vector<Future<T>> futures) {
+  struct State {
+    explicit State(std::vector<Future<T>> fs)
+        : futures(std::move(fs)), n_remaining(futures.size()) {}
+
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> n_remaining;
+  };
+
+  auto out = Future<std::vector<Result<T>>>::Make();
+  if (futures.empty()) {
+    out.MarkFinished(std::vector<Result<T>>{});
+    return out;
+  }
+  auto state = std::make_shared<State>(std::move(futures));
+  for (const auto& future : state->futures) {
+    future.AddCallback([state, out](const Result<T>&) mutable {
+      if (state->n_remaining.fetch_sub(1) != 1) {
+        return;
+      }
+      std::vector<Result<T>> results;
+      results.reserve(state->futures.size());
+      for (const auto& future : state->futures) {
+        results.push_back(future.result());
+      }
+      out.MarkFinished(std::move(results));
+    });
+  }
+  return out;
+}
+
+/// \brief Create a Future which completes when all of `futures` complete.
+///
+/// The Future fails with the first error (in the order of `futures`) if any
+/// of them failed, and succeeds otherwise.
+template <typename T>
+Future<Status> AllComplete(std::vector<Future<T>> futures) {
+  auto out = Future<Status>::Make();
+  if (futures.empty()) {
+    out.MarkFinished(Status::OK());
+    return out;
+  }
+  using Callback = detail::AllCompleteCallback<T>;
+  auto state = std::make_shared<typename Callback::State>(std::move(futures));
+  for (const auto& future : state->futures) {
+    future.AddCallback(Callback{state, out});
+  }
+  return out;
+}
+
+/// \brief Create a Future which completes when any of `futures` completes.
+///
+/// The Future is finished with the outcome of the first of `futures` to
+/// complete, whether successful or not.  If `futures` is empty, the Future
+/// fails immediately.
+template <typename T>
+Future<T> Any(const std::vector<Future<T>>& futures) {
+  auto out = Future<T>::Make();
+  if (futures.empty()) {
+    out.MarkFinished(Status::Invalid("Any() called on an empty vector of futures"));
+    return out;
+  }
+  auto claimed = std::make_shared<std::atomic<bool>>(false);
+  for (const auto& future : futures) {
+    future.AddCallback(detail::AnyCallback<T>{claimed, out});
+  }
+  return out;
+}
+
 #define ARROW_ASSIGN_OR_RETURN_FUTURE_IMPL(result_name, lhs, T, rexpr) \
   auto result_name = (rexpr);                                          \
   if (ARROW_PREDICT_FALSE(!(result_name).ok())) {                      \
@@ -358,6 +358,224 @@ TEST(FutureSyncTest, Status) {
   }
 }
 
+// --------------------------------------------------------------------
+// Continuation tests
+
+TEST(FutureCallbackTest, AddCallback) {
+  {
+    // Callback added before completion
+    auto fut = Future<int>::Make();
+    int called = 0;
+    fut.AddCallback([&](const Result<int>& res) {
+      ASSERT_OK_AND_EQ(42, res);
+      ++called;
+    });
+    ASSERT_EQ(called, 0);
+    fut.MarkFinished(42);
+    ASSERT_EQ(called, 1);
+  }
+  {
+    // Callback added after completion runs immediately
+    auto fut = Future<int>::MakeFinished(Status::IOError("xxx"));
+    int called = 0;
+    fut.AddCallback([&](const Result<int>& res) {
+      ASSERT_RAISES(IOError, res);
+      ++called;
+    });
+    ASSERT_EQ(called, 1);
+  }
+  {
+    // Several callbacks, on a Future<Status>
+    auto fut = Future<Status>::Make();
+    std::vector<int> order;
+    fut.AddCallback([&](const Status& st) {
+      ASSERT_RAISES(Invalid, st);
+      order.push_back(1);
+    });
+    fut.AddCallback([&](const Status& st) { order.push_back(2); });
+    fut.MarkFinished(Status::Invalid("xxx"));
+    ASSERT_EQ(order, std::vector<int>({1, 2}));
+  }
+  {
+    auto fut = Future<void>::Make();
+    int called = 0;
+    fut.AddCallback([&](const Status& st) {
+      ASSERT_OK(st);
+      ++called;
+    });
+    fut.MarkFinished();
+    ASSERT_EQ(called, 1);
+  }
+}
+
+TEST(FutureCallbackTest, Then) {
+  {
+    // Returning a value
+    auto fut = Future<int>::Make();
+    Future<std::string> next = fut.Then([](const int& x) { return std::to_string(x); });
+    AssertNotFinished(next);
+    fut.MarkFinished(42);
+    ASSERT_OK_AND_EQ("42", next.result());
+  }
+  {
+    // Returning a Result, on a Future of a move-only type
+    auto fut = Future<MoveOnlyDataType>::Make();
+    Future<int> next = fut.Then([](const MoveOnlyDataType& x) -> Result<int> {
+      if (x.ToInt() < 0) {
+        return Status::Invalid("negative");
+      }
+      return x.ToInt() + 1;
+    });
+    fut.MarkFinished(MoveOnlyDataType(-1));
+    ASSERT_RAISES(Invalid, next.result());
+  }
+  {
+    // Failures are forwarded by default
+    auto fut = Future<int>::Make();
+    int called = 0;
+    Future<int> next = fut.Then([&](const int& x) {
+      ++called;
+      return x;
+    });
+    fut.MarkFinished(Status::IOError("xxx"));
+    ASSERT_RAISES(IOError, next.result());
+    ASSERT_EQ(called, 0);
+  }
+  {
+    // Failures can be handled
+    auto fut = Future<int>::Make();
+    Future<int> next =
+        fut.Then([](const int& x) { return x; }, [](const Status&) { return -1; });
+    fut.MarkFinished(Status::IOError("xxx"));
+    ASSERT_OK_AND_EQ(-1, next.result());
+  }
+  {
+    // Returning Status or void
+    auto fut = Future<int>::Make();
+    Future<Status> next_status =
+        fut.Then([](const int& x) { return Status::Invalid("got ", x); });
+    int called = 0;
+    Future<void> next_void = fut.Then([&](const int& x) { called += x; });
+    fut.MarkFinished(3);
+    ASSERT_RAISES(Invalid, next_status.status());
+    AssertSuccessful(next_void);
+    ASSERT_EQ(called, 3);
+  }
+  {
+    // A Future<void> with a forwarded failure
+    auto fut = Future<Status>::Make();
+    Future<void> next = fut.Then([] {});
+    fut.MarkFinished(Status::IOError("xxx"));
+    AssertFailed(next);
+    ASSERT_RAISES(IOError, next.status());
+  }
+  {
+    // Returning a Future
+    auto fut = Future<void>::Make();
+    auto inner = Future<int>::Make();
+    Future<int> next = fut.Then([&] { return inner; });
+    fut.MarkFinished();
+    AssertNotFinished(next);
+    inner.MarkFinished(5);
+    ASSERT_OK_AND_EQ(5, next.result());
+  }
+  {
+    // Chaining
+    auto fut = Future<int>::Make();
+    auto next = fut.Then([](const int& x) { return x * 2; })
+                    .Then([](const int& x) { return Foo(x + 1); })
+                    .Then([](const Foo& x) { return x.ToInt(); });
+    fut.MarkFinished(20);
+    ASSERT_OK_AND_EQ(41, next.result());
+  }
+}
+
+TEST(FutureCallbackTest, All) {
+  std::vector<Future<int>> futures = {Future<int>::Make(), Future<int>::Make(),
+                                      Future<int>::Make()};
+  auto all = All(futures);
+  futures[2].MarkFinished(2);
+  futures[0].MarkFinished(Status::IOError("xxx"));
+  AssertNotFinished(all);
+  futures[1].MarkFinished(1);
+  ASSERT_OK_AND_ASSIGN(auto results, all.result());
+  ASSERT_EQ(results.size(), 3);
+  ASSERT_RAISES(IOError, results[0]);
+  ASSERT_OK_AND_EQ(1, results[1]);
+  ASSERT_OK_AND_EQ(2, results[2]);
+
+  ASSERT_OK_AND_ASSIGN(results, All(std::vector<Future<int>>{}).result());
+  ASSERT_EQ(results.size(), 0);
+}
+
+TEST(FutureCallbackTest, AllComplete) {
+  {
+    std::vector<Future<void>> futures = {Future<void>::Make(), Future<void>::Make()};
+    auto all = AllComplete(futures);
+    futures[1].MarkFinished();
+    AssertNotFinished(all);
+    futures[0].MarkFinished();
+    AssertSuccessful(all);
+  }
+  {
+    std::vector<Future<int>> futures = {Future<int>::Make(), Future<int>::Make()};
+    auto all = AllComplete(futures);
+    futures[1].MarkFinished(Status::IOError("xxx"));
+    AssertNotFinished(all);
+    futures[0].MarkFinished(Status::Invalid("xxx"));
+    // The error of the first future is reported
+    ASSERT_RAISES(Invalid, all.status());
+  }
+  AssertSuccessful(AllComplete(std::vector<Future<Status>>{}));
+}
+
+TEST(FutureCallbackTest, Any) {
+  std::vector<Future<int>> futures = {Future<int>::Make(), Future<int>::Make()};
+  auto any = Any(futures);
+  AssertNotFinished(any);
+  futures[1].MarkFinished(Status::IOError("xxx"));
+  futures[0].MarkFinished(0);
+  ASSERT_RAISES(IOError, any.result());
+
+  ASSERT_RAISES(Invalid, Any(std::vector<Future<int>>{}).status());
+}
+
+TEST(FutureCallbackTest, Transfer) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/2));
+  auto fut = Future<int>::Make();
+  auto transferred = pool->Transfer(fut);
+  auto callback_thread = Future<std::thread::id>::Make();
+  transferred.AddCallback([callback_thread](const Result<int>& res) mutable {
+    callback_thread.MarkFinished(std::this_thread::get_id());
+  });
+  fut.MarkFinished(42);
+  ASSERT_OK_AND_EQ(42, transferred.result());
+  ASSERT_OK_AND_ASSIGN(auto thread_id, callback_thread.result());
+  ASSERT_NE(thread_id, std::this_thread::get_id());
+
+  // Transferring to a shut down pool fails
+  ASSERT_OK(pool->Shutdown());
+  transferred = pool->Transfer(Future<int>::MakeFinished(42));
+  ASSERT_RAISES(Invalid, transferred.result());
+}
+
+TEST(FutureCallbackTest, StressThen) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/4));
+  const int n_futures = 1000;
+  std::vector<Future<int>> chained;
+  for (int i = 0; i < n_futures; ++i) {
+    auto fut = pool->SubmitAsFuture([i] { return i; });
+    chained.push_back(fut.Then([pool](const int& x) {
+      return pool->SubmitAsFuture([x] { return x * 2; });
+    }));
+  }
+  ASSERT_OK_AND_ASSIGN(auto results, All(chained).result());
+  for (int i = 0; i < n_futures; ++i) {
+    ASSERT_OK_AND_EQ(i * 2, results[i]);
+  }
+  ASSERT_OK(AllComplete(chained).status());
+}
+
 // --------------------------------------------------------------------
 // Tests with an executor
 
@@ -253,6 +253,13 @@ class HashTable {
 
   uint64_t size() const { return size_; }
 
+  uint64_t capacity() const { return capacity_; }
+
+  // Prefetch the slot where the probe sequence of hash `h` starts
+  void Prefetch(hash_t h) const {
+    ARROW_PREFETCH(&entries_[FixHash(h) & capacity_mask_]);
+  }
+
   // Visit all non-empty entries in the table
   // The visit_func should have signature void(const Entry*)
   template <typename VisitFunc>
@@ -595,6 +602,13 @@ template <typename BinaryBuilderT>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
+
+  // The number of values whose slots GetOrInsertBatch() prefetches at once
+  static constexpr int64_t kBatchSize = 16;
+  // The number of hash table slots from which GetOrInsertBatch() prefetches:
+  // smaller tables stay in cache, where prefetching only costs
+  static constexpr uint64_t kPrefetchMinCapacity = 1 << 14;
+
   explicit BinaryMemoTable(MemoryPool* pool, int64_t entries = 0,
                            int64_t values_size = -1)
       : hash_table_(pool, static_cast<uint64_t>(entries)), binary_builder_(pool) {
@@ -621,23 +635,8 @@ class BinaryMemoTable : public MemoTable {
   Status GetOrInsert(const void* data, builder_offset_type length, Func1&& on_found,
                      Func2&& on_not_found, int32_t* out_memo_index) {
     hash_t h = ComputeStringHash<0>(data, length);
-    auto p = Lookup(h, data, length);
-    int32_t memo_index;
-    if (p.second) {
-      memo_index = p.first->payload.memo_index;
-      on_found(memo_index);
-    } else {
-      memo_index = size();
-      // Insert string value
-      RETURN_NOT_OK(binary_builder_.Append(static_cast<const char*>(data), length));
-      // Insert hash entry
-      RETURN_NOT_OK(
-          hash_table_.Insert(const_cast<HashTableEntry*>(p.first), h, {memo_index}));
-
-      on_not_found(memo_index);
-    }
-    *out_memo_index = memo_index;
-    return Status::OK();
+    return GetOrInsertHashed(h, data, length, std::forward<Func1>(on_found),
+                             std::forward<Func2>(on_not_found), out_memo_index);
   }
 
   template <typename Func1, typename Func2>
@@ -659,6 +658,50 @@ class BinaryMemoTable : public MemoTable {
                        out_memo_index);
   }
 
+  // Look up or insert the non-null values get_value(0), ..., get_value(n - 1),
+  // writing their memo indices to `out_memo_indices`.  The get_value function
+  // should have the signature `util::string_view(int64_t)`.
+  //
+  // Once the hash table outgrows the caches, values are hashed kBatchSize at a
+  // time and the slots where their probes start are prefetched before any of
+  // them is probed, so that the cache misses of the probes overlap rather than
+  // follow each other.
+  template <typename GetValue, typename Func1, typename Func2>
+  Status GetOrInsertBatch(int64_t n, GetValue&& get_value, Func1&& on_found,
+                          Func2&& on_not_found, int32_t* out_memo_indices) {
+    hash_t hashes[kBatchSize];
+    for (int64_t start = 0; start < n; start += kBatchSize) {
+      const int64_t batch_size = std::min(kBatchSize, n - start);
+      if (hash_table_.capacity() < kPrefetchMinCapacity) {
+        for (int64_t i = start; i < start + batch_size; ++i) {
+          RETURN_NOT_OK(
+              GetOrInsert(get_value(i), on_found, on_not_found, out_memo_indices + i));
+        }
+        continue;
+      }
+      for (int64_t i = 0; i < batch_size; ++i) {
+        const util::string_view value = get_value(start + i);
+        hashes[i] =
+            ComputeStringHash<0>(value.data(), static_cast<int64_t>(value.size()));
+        hash_table_.Prefetch(hashes[i]);
+      }
+      for (int64_t i = 0; i < batch_size; ++i) {
+        const util::string_view value = get_value(start + i);
+        RETURN_NOT_OK(GetOrInsertHashed(
+            hashes[i], value.data(), static_cast<builder_offset_type>(value.size()),
+            on_found, on_not_found, out_memo_indices + start + i));
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename GetValue>
+  Status GetOrInsertBatch(int64_t n, GetValue&& get_value, int32_t* out_memo_indices) {
+    return GetOrInsertBatch(
+        n, std::forward<GetValue>(get_value), [](int32_t i) {}, [](int32_t i) {},
+        out_memo_indices);
+  }
+
   int32_t GetNull() const { return null_index_; }
 
   template <typename Func1, typename Func2>
@@ -816,8 +859,36 @@ class BinaryMemoTable : public MemoTable {
     };
     return hash_table_.Lookup(h, cmp_func);
   }
+
+  template <typename Func1, typename Func2>
+  Status GetOrInsertHashed(hash_t h, const void* data, builder_offset_type length,
+                           Func1&& on_found, Func2&& on_not_found,
+                           int32_t* out_memo_index) {
+    auto p = Lookup(h, data, length);
+    int32_t memo_index;
+    if (p.second) {
+      memo_index = p.first->payload.memo_index;
+      on_found(memo_index);
+    } else {
+      memo_index = size();
+      // Insert string value
+      RETURN_NOT_OK(binary_builder_.Append(static_cast<const char*>(data), length));
+      // Insert hash entry
+      RETURN_NOT_OK(
+          hash_table_.Insert(const_cast<HashTableEntry*>(p.first), h, {memo_index}));
+
+      on_not_found(memo_index);
+    }
+    *out_memo_index = memo_index;
+    return Status::OK();
+  }
 };
 
+template <typename BinaryBuilderT>
+constexpr int64_t BinaryMemoTable<BinaryBuilderT>::kBatchSize;
+template <typename BinaryBuilderT>
+constexpr uint64_t BinaryMemoTable<BinaryBuilderT>::kPrefetchMinCapacity;
+
 template <typename T, typename Enable = void>
 struct HashTraits {};
 
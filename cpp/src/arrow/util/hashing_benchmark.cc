@@ -111,6 +111,69 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// Memoize values drawn from a smaller set of distinct values, as when
+// dictionary-encoding or grouping
+static std::vector<std::string> MakeRepeatedStrings(int32_t n_values,
+                                                    int32_t n_distinct,
+                                                    int32_t min_length,
+                                                    int32_t max_length) {
+  const std::vector<std::string> distinct =
+      MakeStrings(n_distinct, min_length, max_length);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int32_t> index_dist(0, n_distinct - 1);
+  std::vector<std::string> values(n_values);
+  std::generate(values.begin(), values.end(),
+                [&]() { return distinct[index_dist(gen)]; });
+  return values;
+}
+
+static void BenchmarkMemoTable(benchmark::State& state,  // NOLINT non-const reference
+                               const std::vector<std::string>& values, bool batch) {
+  std::vector<int32_t> memo_indices(values.size());
+  while (state.KeepRunning()) {
+    BinaryMemoTable<BinaryBuilder> table(default_memory_pool(), 0);
+    if (batch) {
+      ABORT_NOT_OK(table.GetOrInsertBatch(
+          static_cast<int64_t>(values.size()),
+          [&](int64_t i) { return util::string_view(values[i]); }, memo_indices.data()));
+    } else {
+      for (size_t i = 0; i < values.size(); ++i) {
+        ABORT_NOT_OK(table.GetOrInsert(values[i], &memo_indices[i]));
+      }
+    }
+    benchmark::DoNotOptimize(memo_indices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void MemoTableSmallStrings(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = MakeRepeatedStrings(100000, static_cast<int32_t>(state.range(0)),
+                                          2, 16);
+  BenchmarkMemoTable(state, values, /*batch=*/false);
+}
+
+static void MemoTableSmallStringsBatch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = MakeRepeatedStrings(100000, static_cast<int32_t>(state.range(0)),
+                                          2, 16);
+  BenchmarkMemoTable(state, values, /*batch=*/true);
+}
+
+static void MemoTableMediumStrings(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = MakeRepeatedStrings(100000, static_cast<int32_t>(state.range(0)),
+                                          20, 120);
+  BenchmarkMemoTable(state, values, /*batch=*/false);
+}
+
+static void MemoTableMediumStringsBatch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = MakeRepeatedStrings(100000, static_cast<int32_t>(state.range(0)),
+                                          20, 120);
+  BenchmarkMemoTable(state, values, /*batch=*/true);
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -118,6 +181,11 @@ BENCHMARK(HashIntegers);
 BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
+// Number of distinct values: fits in L1, L2, and main memory
+BENCHMARK(MemoTableSmallStrings)->Arg(100)->Arg(10000)->Arg(100000);
+BENCHMARK(MemoTableSmallStringsBatch)->Arg(100)->Arg(10000)->Arg(100000);
+BENCHMARK(MemoTableMediumStrings)->Arg(100)->Arg(10000)->Arg(100000);
+BENCHMARK(MemoTableMediumStringsBatch)->Arg(100)->Arg(10000)->Arg(100000);
 
 }  // namespace internal
 }  // namespace arrow
@@ -478,5 +478,46 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, GetOrInsertBatch) {
+  // Enough distinct values to resize the table in the middle of batches
+  const int32_t n_values = 20000;
+  const auto distinct_values = MakeDistinctStrings(n_values);
+  std::vector<std::string> values(distinct_values.begin(), distinct_values.end());
+  for (int32_t i = 0; i < n_values; i += 3) {
+    values[i] += std::string(40, 'z');
+  }
+  std::vector<std::string> input;
+  for (int32_t i = 0; i < 3 * n_values; ++i) {
+    input.push_back(values[(i * 7) % n_values]);
+  }
+
+  BinaryMemoTable<BinaryBuilder> expected_table(default_memory_pool(), 0);
+  std::vector<int32_t> expected(input.size());
+  for (size_t i = 0; i < input.size(); ++i) {
+    ASSERT_OK(expected_table.GetOrInsert(input[i], &expected[i]));
+  }
+
+  // Starting with a small table, which only prefetches once grown, and with
+  // a large one
+  for (int64_t entries : {0, 1 << 14}) {
+    BinaryMemoTable<BinaryBuilder> table(default_memory_pool(), entries);
+    std::vector<int32_t> actual(input.size());
+    int32_t n_found = 0, n_not_found = 0;
+    // In two calls, the first not a multiple of the batch size
+    const int64_t split = 3 * BinaryMemoTable<BinaryBuilder>::kBatchSize + 5;
+    auto get_value = [&](int64_t i) { return util::string_view(input[i]); };
+    ASSERT_OK(table.GetOrInsertBatch(
+        split, get_value, [&](int32_t) { ++n_found; }, [&](int32_t) { ++n_not_found; },
+        actual.data()));
+    ASSERT_OK(table.GetOrInsertBatch(
+        static_cast<int64_t>(input.size()) - split,
+        [&](int64_t i) { return util::string_view(input[split + i]); },
+        actual.data() + split));
+    ASSERT_EQ(actual, expected);
+    ASSERT_EQ(table.size(), n_values);
+    ASSERT_EQ(n_found + n_not_found, split);
+  }
+}
+
 }  // namespace internal
 }  // namespace arrow
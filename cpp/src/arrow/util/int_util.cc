@@ -21,6 +21,10 @@
 #include <cstring>
 #include <limits>
 
+#if defined(ARROW_HAVE_SSE4_2)
+#include <nmmintrin.h>
+#endif
+
 #include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
@@ -35,9 +39,16 @@ static constexpr uint64_t max_uint32 =
     static_cast<uint64_t>(std::numeric_limits<uint32_t>::max());
 static constexpr uint64_t max_uint64 = std::numeric_limits<uint64_t>::max();
 
-static constexpr uint64_t mask_uint8 = ~0xffULL;
-static constexpr uint64_t mask_uint16 = ~0xffffULL;
-static constexpr uint64_t mask_uint32 = ~0xffffffffULL;
+// Width detection reduces blocks of values to a single bitwise OR with
+// branch-free loops, which the compiler vectorizes, and only tests the width
+// once per block.  Several accumulators are used so that the reduction isn't
+// bound by the latency of a single dependency chain.
+static constexpr int64_t kWidthBlockSize = 256;
+
+// Null slots may hold any value, but are usually zeroed by the producer.  The
+// masked reduction is therefore only run if the unmasked one finds a block too
+// wide for the current width.
+#define VALID_MASK(b, i) (0 - static_cast<uint64_t>(b[i] != 0))
 
 //
 // Unsigned integer width detection
@@ -63,50 +74,43 @@ inline uint8_t ExpandedUIntWidth(uint64_t val, uint8_t current_width) {
   }
 }
 
+inline uint64_t OrUInts(const uint64_t* p, int64_t length) {
+  uint64_t u = 0, v = 0, w = 0, x = 0;
+  int64_t i = 0;
+  for (; i <= length - 4; i += 4) {
+    u |= p[i];
+    v |= p[i + 1];
+    w |= p[i + 2];
+    x |= p[i + 3];
+  }
+  for (; i < length; ++i) {
+    u |= p[i];
+  }
+  return u | v | w | x;
+}
+
+inline uint64_t OrValidUInts(const uint64_t* p, const uint8_t* b, int64_t length) {
+  uint64_t u = 0, v = 0, w = 0, x = 0;
+  int64_t i = 0;
+  for (; i <= length - 4; i += 4) {
+    u |= p[i] & VALID_MASK(b, i);
+    v |= p[i + 1] & VALID_MASK(b, i + 1);
+    w |= p[i + 2] & VALID_MASK(b, i + 2);
+    x |= p[i + 3] & VALID_MASK(b, i + 3);
+  }
+  for (; i < length; ++i) {
+    u |= p[i] & VALID_MASK(b, i);
+  }
+  return u | v | w | x;
+}
+
 uint8_t DetectUIntWidth(const uint64_t* values, int64_t length, uint8_t min_width) {
   uint8_t width = min_width;
-  if (min_width < 8) {
-    auto p = values;
-    const auto end = p + length;
-    while (p <= end - 16) {
-      // This is probably SIMD-izable
-      auto u = p[0];
-      auto v = p[1];
-      auto w = p[2];
-      auto x = p[3];
-      u |= p[4];
-      v |= p[5];
-      w |= p[6];
-      x |= p[7];
-      u |= p[8];
-      v |= p[9];
-      w |= p[10];
-      x |= p[11];
-      u |= p[12];
-      v |= p[13];
-      w |= p[14];
-      x |= p[15];
-      p += 16;
-      width = ExpandedUIntWidth(u | v | w | x, width);
-      if (ARROW_PREDICT_FALSE(width == 8)) {
-        break;
-      }
-    }
-    if (p <= end - 8) {
-      auto u = p[0];
-      auto v = p[1];
-      auto w = p[2];
-      auto x = p[3];
-      u |= p[4];
-      v |= p[5];
-      w |= p[6];
-      x |= p[7];
-      p += 8;
-      width = ExpandedUIntWidth(u | v | w | x, width);
-    }
-    while (p < end) {
-      width = ExpandedUIntWidth(*p++, width);
-    }
+  while (width < 8 && length > 0) {
+    const int64_t block_size = std::min(length, kWidthBlockSize);
+    width = ExpandedUIntWidth(OrUInts(values, block_size), width);
+    values += block_size;
+    length -= block_size;
   }
   return width;
 }
@@ -117,39 +121,16 @@ uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
     return DetectUIntWidth(values, length, min_width);
   }
   uint8_t width = min_width;
-  if (min_width < 8) {
-    auto p = values;
-    const auto end = p + length;
-    auto b = valid_bytes;
-
-#define MASK(p, b, i) p[i] * (b[i] != 0)
-
-    while (p <= end - 8) {
-      // This is probably be SIMD-izable
-      auto u = MASK(p, b, 0);
-      auto v = MASK(p, b, 1);
-      auto w = MASK(p, b, 2);
-      auto x = MASK(p, b, 3);
-      u |= MASK(p, b, 4);
-      v |= MASK(p, b, 5);
-      w |= MASK(p, b, 6);
-      x |= MASK(p, b, 7);
-      b += 8;
-      p += 8;
-      width = ExpandedUIntWidth(u | v | w | x, width);
-      if (ARROW_PREDICT_FALSE(width == 8)) {
-        break;
-      }
-    }
-    uint64_t mask = 0;
-    while (p < end) {
-      mask |= MASK(p, b, 0);
-      ++b;
-      ++p;
+  while (width < 8 && length > 0) {
+    const int64_t block_size = std::min(length, kWidthBlockSize);
+    uint64_t mask = OrUInts(values, block_size);
+    if (mask > max_uints[width]) {
+      mask = OrValidUInts(values, valid_bytes, block_size);
     }
     width = ExpandedUIntWidth(mask, width);
-
-#undef MASK
+    values += block_size;
+    valid_bytes += block_size;
+    length -= block_size;
   }
   return width;
 }
@@ -158,95 +139,60 @@ uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
 // Signed integer width detection
 //
 
-uint8_t DetectIntWidth(const int64_t* values, int64_t length, uint8_t min_width) {
-  if (min_width == 8) {
-    return min_width;
+// Strategy: to determine whether `x` is between -0x80 and 0x7f, we determine
+// whether `x + 0x80` is between 0x00 and 0xff.  The latter can be done with a
+// simple AND mask with ~0xff and, more importantly, can be computed over the
+// OR of a whole block of biased values.  This is cheaper to vectorize than a
+// minimum and maximum, since SSE has no 64-bit min/max instructions.  A block
+// that doesn't fit is tested again at the next width.
+static const uint64_t int_addends[] = {0, 0x80ULL, 0x8000ULL, 0, 0x80000000ULL};
+static const uint64_t int_test_masks[] = {0, ~max_uint8, ~max_uint16, 0, ~max_uint32};
+
+inline uint64_t OrBiasedInts(const uint64_t* p, uint64_t addend, int64_t length) {
+  uint64_t u = 0, v = 0, w = 0, x = 0;
+  int64_t i = 0;
+  for (; i <= length - 4; i += 4) {
+    u |= p[i] + addend;
+    v |= p[i + 1] + addend;
+    w |= p[i + 2] + addend;
+    x |= p[i + 3] + addend;
   }
-  uint8_t width = min_width;
-
-  auto p = values;
-  const auto end = p + length;
-  // Strategy: to determine whether `x` is between -0x80 and 0x7f,
-  // we determine whether `x + 0x80` is between 0x00 and 0xff.  The
-  // latter can be done with a simple AND mask with ~0xff and, more
-  // importantly, can be computed in a single step over multiple ORed
-  // values (so we can branch once every N items instead of once every item).
-  // This strategy could probably lend itself to explicit SIMD-ization,
-  // if more performance is needed.
-  constexpr uint64_t addend8 = 0x80ULL;
-  constexpr uint64_t addend16 = 0x8000ULL;
-  constexpr uint64_t addend32 = 0x80000000ULL;
-
-  auto test_one_item = [&](uint64_t addend, uint64_t test_mask) -> bool {
-    auto v = *p++;
-    if (ARROW_PREDICT_FALSE(((v + addend) & test_mask) != 0)) {
-      --p;
-      return false;
-    } else {
-      return true;
-    }
-  };
-
-  auto test_four_items = [&](uint64_t addend, uint64_t test_mask) -> bool {
-    auto mask = (p[0] + addend) | (p[1] + addend) | (p[2] + addend) | (p[3] + addend);
-    p += 4;
-    if (ARROW_PREDICT_FALSE((mask & test_mask) != 0)) {
-      p -= 4;
-      return false;
-    } else {
-      return true;
-    }
-  };
+  for (; i < length; ++i) {
+    u |= p[i] + addend;
+  }
+  return u | v | w | x;
+}
 
-  if (width == 1) {
-    while (p <= end - 4) {
-      if (!test_four_items(addend8, mask_uint8)) {
-        width = 2;
-        goto width2;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend8, mask_uint8)) {
-        width = 2;
-        goto width2;
-      }
-    }
-    return 1;
+inline uint64_t OrValidBiasedInts(const uint64_t* p, const uint8_t* b, uint64_t addend,
+                                  int64_t length) {
+  uint64_t u = 0, v = 0, w = 0, x = 0;
+  int64_t i = 0;
+  for (; i <= length - 4; i += 4) {
+    u |= (p[i] + addend) & VALID_MASK(b, i);
+    v |= (p[i + 1] + addend) & VALID_MASK(b, i + 1);
+    w |= (p[i + 2] + addend) & VALID_MASK(b, i + 2);
+    x |= (p[i + 3] + addend) & VALID_MASK(b, i + 3);
   }
-width2:
-  if (width == 2) {
-    while (p <= end - 4) {
-      if (!test_four_items(addend16, mask_uint16)) {
-        width = 4;
-        goto width4;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend16, mask_uint16)) {
-        width = 4;
-        goto width4;
-      }
-    }
-    return 2;
+  for (; i < length; ++i) {
+    u |= (p[i] + addend) & VALID_MASK(b, i);
   }
-width4:
-  if (width == 4) {
-    while (p <= end - 4) {
-      if (!test_four_items(addend32, mask_uint32)) {
-        width = 8;
-        goto width8;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend32, mask_uint32)) {
-        width = 8;
-        goto width8;
-      }
+  return u | v | w | x;
+}
+
+uint8_t DetectIntWidth(const int64_t* values, int64_t length, uint8_t min_width) {
+  auto p = reinterpret_cast<const uint64_t*>(values);
+  uint8_t width = min_width;
+  while (width < 8 && length > 0) {
+    const int64_t block_size = std::min(length, kWidthBlockSize);
+    const uint64_t mask = OrBiasedInts(p, int_addends[width], block_size);
+    if (ARROW_PREDICT_FALSE((mask & int_test_masks[width]) != 0)) {
+      width *= 2;
+      continue;
     }
-    return 4;
+    p += block_size;
+    length -= block_size;
   }
-width8:
-  return 8;
+  return width;
 }
 
 uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
@@ -254,107 +200,90 @@ uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes, int64_
   if (valid_bytes == nullptr) {
     return DetectIntWidth(values, length, min_width);
   }
-
-  if (min_width == 8) {
-    return min_width;
-  }
+  auto p = reinterpret_cast<const uint64_t*>(values);
   uint8_t width = min_width;
-
-  auto p = values;
-  const auto end = p + length;
-  auto b = valid_bytes;
-  // Strategy is similar to the no-nulls case above, but we also
-  // have to zero any incoming items that have a zero validity byte.
-  constexpr uint64_t addend8 = 0x80ULL;
-  constexpr uint64_t addend16 = 0x8000ULL;
-  constexpr uint64_t addend32 = 0x80000000ULL;
-
-#define MASK(p, b, addend, i) (p[i] + addend) * (b[i] != 0)
-
-  auto test_one_item = [&](uint64_t addend, uint64_t test_mask) -> bool {
-    auto v = MASK(p, b, addend, 0);
-    ++b;
-    ++p;
-    if (ARROW_PREDICT_FALSE((v & test_mask) != 0)) {
-      --b;
-      --p;
-      return false;
-    } else {
-      return true;
-    }
-  };
-
-  auto test_eight_items = [&](uint64_t addend, uint64_t test_mask) -> bool {
-    auto mask1 = MASK(p, b, addend, 0) | MASK(p, b, addend, 1) | MASK(p, b, addend, 2) |
-                 MASK(p, b, addend, 3);
-    auto mask2 = MASK(p, b, addend, 4) | MASK(p, b, addend, 5) | MASK(p, b, addend, 6) |
-                 MASK(p, b, addend, 7);
-    b += 8;
-    p += 8;
-    if (ARROW_PREDICT_FALSE(((mask1 | mask2) & test_mask) != 0)) {
-      b -= 8;
-      p -= 8;
-      return false;
-    } else {
-      return true;
-    }
-  };
-
-#undef MASK
-
-  if (width == 1) {
-    while (p <= end - 8) {
-      if (!test_eight_items(addend8, mask_uint8)) {
-        width = 2;
-        goto width2;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend8, mask_uint8)) {
-        width = 2;
-        goto width2;
-      }
-    }
-    return 1;
-  }
-width2:
-  if (width == 2) {
-    while (p <= end - 8) {
-      if (!test_eight_items(addend16, mask_uint16)) {
-        width = 4;
-        goto width4;
+  while (width < 8 && length > 0) {
+    const int64_t block_size = std::min(length, kWidthBlockSize);
+    const uint64_t addend = int_addends[width];
+    uint64_t mask = OrBiasedInts(p, addend, block_size);
+    if ((mask & int_test_masks[width]) != 0) {
+      mask = OrValidBiasedInts(p, valid_bytes, addend, block_size);
+      if (ARROW_PREDICT_FALSE((mask & int_test_masks[width]) != 0)) {
+        width *= 2;
+        continue;
       }
     }
-    while (p < end) {
-      if (!test_one_item(addend16, mask_uint16)) {
-        width = 4;
-        goto width4;
-      }
-    }
-    return 2;
+    p += block_size;
+    valid_bytes += block_size;
+    length -= block_size;
   }
-width4:
-  if (width == 4) {
-    while (p <= end - 8) {
-      if (!test_eight_items(addend32, mask_uint32)) {
-        width = 8;
-        goto width8;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend32, mask_uint32)) {
-        width = 8;
-        goto width8;
-      }
+  return width;
+}
+
+#undef VALID_MASK
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+// Narrowing stores of 64-bit integers known to fit the destination width.  The
+// low half of each lane is kept at every step, and masking it before the
+// unsigned saturating pack makes the pack exact, for signed and unsigned values
+// alike.  Each function returns the number of values stored, leaving the
+// remainder to the scalar loop.
+
+// Narrow 4 values to 32 bits
+inline __m128i NarrowTo32(const __m128i* src) {
+  return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(_mm_loadu_si128(src)),
+                                         _mm_castsi128_ps(_mm_loadu_si128(src + 1)),
+                                         _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+// Narrow 8 values to 16 bits
+inline __m128i NarrowTo16(const __m128i* src) {
+  const __m128i mask = _mm_set1_epi32(0xffff);
+  return _mm_packus_epi32(_mm_and_si128(NarrowTo32(src), mask),
+                          _mm_and_si128(NarrowTo32(src + 2), mask));
+}
+
+// Narrow 16 values to 8 bits
+inline __m128i NarrowTo8(const __m128i* src) {
+  const __m128i mask = _mm_set1_epi16(0xff);
+  return _mm_packus_epi16(_mm_and_si128(NarrowTo16(src), mask),
+                          _mm_and_si128(NarrowTo16(src + 4), mask));
+}
+
+template <typename Dest>
+int64_t DowncastIntsSSE(const void* source, Dest* dest, int64_t length) {
+  constexpr int64_t kValuesPerStore = sizeof(__m128i) / sizeof(Dest);
+  auto src = reinterpret_cast<const __m128i*>(source);
+  auto out = reinterpret_cast<__m128i*>(dest);
+  int64_t i = 0;
+  for (; i + kValuesPerStore <= length; i += kValuesPerStore) {
+    switch (sizeof(Dest)) {
+      case 1:
+        _mm_storeu_si128(out++, NarrowTo8(src));
+        break;
+      case 2:
+        _mm_storeu_si128(out++, NarrowTo16(src));
+        break;
+      default:
+        _mm_storeu_si128(out++, NarrowTo32(src));
+        break;
     }
-    return 4;
+    src += kValuesPerStore / 2;
   }
-width8:
-  return 8;
+  return i;
 }
 
+#endif  // ARROW_HAVE_SSE4_2
+
 template <typename Source, typename Dest>
 inline void DowncastIntsInternal(const Source* src, Dest* dest, int64_t length) {
+#if defined(ARROW_HAVE_SSE4_2)
+  const int64_t stored = DowncastIntsSSE(src, dest, length);
+  src += stored;
+  dest += stored;
+  length -= stored;
+#endif
   while (length >= 4) {
     dest[0] = static_cast<Dest>(src[0]);
     dest[1] = static_cast<Dest>(src[1]);
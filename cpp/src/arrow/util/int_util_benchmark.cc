@@ -95,10 +95,37 @@ static void DetectIntWidthNulls(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(uint64_t));
 }
 
+template <typename Dest>
+static void DowncastIntsBenchmark(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = GetIntSequence(0x12345, -0x1234);
+  std::vector<Dest> dest(values.size());
+
+  while (state.KeepRunning()) {
+    DowncastInts(values.data(), dest.data(), static_cast<int64_t>(values.size()));
+    benchmark::DoNotOptimize(dest.data());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+}
+
+static void DowncastIntsToInt8(benchmark::State& state) {  // NOLINT non-const reference
+  DowncastIntsBenchmark<int8_t>(state);
+}
+
+static void DowncastIntsToInt16(benchmark::State& state) {  // NOLINT non-const reference
+  DowncastIntsBenchmark<int16_t>(state);
+}
+
+static void DowncastIntsToInt32(benchmark::State& state) {  // NOLINT non-const reference
+  DowncastIntsBenchmark<int32_t>(state);
+}
+
 BENCHMARK(DetectUIntWidthNoNulls);
 BENCHMARK(DetectUIntWidthNulls);
 BENCHMARK(DetectIntWidthNoNulls);
 BENCHMARK(DetectIntWidthNulls);
+BENCHMARK(DowncastIntsToInt8);
+BENCHMARK(DowncastIntsToInt16);
+BENCHMARK(DowncastIntsToInt32);
 
 }  // namespace internal
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <utility>
 #include <vector>
@@ -373,6 +374,68 @@ TEST(IntWidth, NullsMany) {
   }
 }
 
+TEST(UIntWidth, ManyBlocks) {
+  // Enough values to span several detection blocks
+  constexpr int N = 1000;
+  for (const int pos : {0, 255, 256, 511, 999}) {
+    std::vector<uint64_t> values(N, 0x7f);
+    std::vector<uint8_t> valid_bytes(N, 1);
+    values[pos] = 0x10000;
+    CheckUIntWidth(values, 4);
+    CheckUIntWidth(values, valid_bytes, 4);
+    valid_bytes[pos] = 0;
+    CheckUIntWidth(values, valid_bytes, 1);
+  }
+}
+
+TEST(IntWidth, ManyBlocks) {
+  // Enough values to span several detection blocks
+  constexpr int N = 1000;
+  for (const int pos : {0, 255, 256, 511, 999}) {
+    std::vector<int64_t> values(N, -0x80);
+    std::vector<uint8_t> valid_bytes(N, 1);
+    values[pos] = -0x8001;
+    CheckIntWidth(values, 4);
+    CheckIntWidth(values, valid_bytes, 4);
+    valid_bytes[pos] = 0;
+    CheckIntWidth(values, valid_bytes, 1);
+  }
+}
+
+template <typename Source, typename Dest>
+void CheckDowncastInts(void (*downcast)(const Source*, Dest*, int64_t)) {
+  // Cover the vectorized loop as well as the remainders of every length
+  for (int length = 0; length < 40; ++length) {
+    std::vector<Source> values(length);
+    std::vector<Dest> expected(length);
+    for (int i = 0; i < length; ++i) {
+      expected[i] = static_cast<Dest>(i % 2 == 0 ? std::numeric_limits<Dest>::max() - i
+                                                 : std::numeric_limits<Dest>::min() + i);
+      values[i] = static_cast<Source>(expected[i]);
+    }
+    // Trailing sentinel, which must not be overwritten
+    std::vector<Dest> dest(length + 1, 42);
+    downcast(values.data(), dest.data(), length);
+    ASSERT_EQ(dest.back(), 42);
+    dest.pop_back();
+    ASSERT_EQ(dest, expected);
+  }
+}
+
+TEST(DowncastInts, Widths) {
+  CheckDowncastInts<int64_t, int8_t>(DowncastInts);
+  CheckDowncastInts<int64_t, int16_t>(DowncastInts);
+  CheckDowncastInts<int64_t, int32_t>(DowncastInts);
+  CheckDowncastInts<int64_t, int64_t>(DowncastInts);
+}
+
+TEST(DowncastUInts, Widths) {
+  CheckDowncastInts<uint64_t, uint8_t>(DowncastUInts);
+  CheckDowncastInts<uint64_t, uint16_t>(DowncastUInts);
+  CheckDowncastInts<uint64_t, uint32_t>(DowncastUInts);
+  CheckDowncastInts<uint64_t, uint64_t>(DowncastUInts);
+}
+
 TEST(TransposeInts, Int8ToInt64) {
   std::vector<int8_t> src = {1, 3, 5, 0, 3, 2};
   std::vector<int32_t> transpose_map = {1111, 2222, 3333, 4444, 5555, 6666, 7777};
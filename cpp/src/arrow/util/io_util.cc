@@ -69,6 +69,13 @@
 #include <unistd.h>
 #endif
 
+#if defined(ARROW_WITH_IO_URING) && defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#define ARROW_HAVE_IO_URING
+#endif
+
 // define max read/write count
 #ifdef _WIN32
 #define ARROW_MAX_IO_CHUNKSIZE INT32_MAX
@@ -1153,6 +1160,262 @@ Result<int64_t> FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nb
   return bytes_read;
 }
 
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+// A minimal io_uring instance driven through the raw system calls, so
+// that no liburing dependency is needed.  Not thread-safe: each thread
+// uses its own ring (see GetThreadIoUring()).
+class IoUring {
+ public:
+  static constexpr unsigned kQueueDepth = 64;
+
+  IoUring() = default;
+  ~IoUring() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) {
+      munmap(cq_ptr_, cq_size_);
+    }
+    if (sq_ptr_ != nullptr) {
+      munmap(sq_ptr_, sq_size_);
+    }
+    if (ring_fd_ >= 0) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init() {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, kQueueDepth, &params));
+    if (ring_fd_ < 0) {
+      return Status::NotImplemented("io_uring is not available: ", ErrnoMessage(errno));
+    }
+    sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+    }
+    RETURN_NOT_OK(Map(sq_size_, IORING_OFF_SQ_RING, &sq_ptr_));
+    if (single_mmap) {
+      cq_ptr_ = sq_ptr_;
+    } else {
+      RETURN_NOT_OK(Map(cq_size_, IORING_OFF_CQ_RING, &cq_ptr_));
+    }
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    void* sqes;
+    RETURN_NOT_OK(Map(sqes_size_, IORING_OFF_SQES, &sqes));
+    sqes_ = reinterpret_cast<struct io_uring_sqe*>(sqes);
+
+    auto sq = reinterpret_cast<uint8_t*>(sq_ptr_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto cq = reinterpret_cast<uint8_t*>(cq_ptr_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    return Status::OK();
+  }
+
+  // Queue a vectored read; at most kQueueDepth reads may be in flight.
+  void PrepareRead(int fd, const struct iovec* iov, int64_t position,
+                   uint64_t user_data) {
+    const unsigned tail = *sq_tail_;
+    const unsigned index = tail & sq_mask_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(iov);
+    sqe->len = 1;
+    sqe->off = static_cast<uint64_t>(position);
+    sqe->user_data = user_data;
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+  }
+
+  // Submit up to `to_submit` queued reads and wait for at least one
+  // completion.  The kernel may take fewer entries than asked for (e.g.
+  // when the completion queue is full); the rest stay queued and
+  // `*submitted` tells how many were taken.  With `to_submit` == 0 this
+  // only waits for completions.
+  Status SubmitAndWait(unsigned to_submit, unsigned* submitted) {
+    while (true) {
+      const long ret = syscall(__NR_io_uring_enter, ring_fd_, to_submit, 1,  // NOLINT
+                               IORING_ENTER_GETEVENTS, nullptr, 0);
+      if (ret >= 0) {
+        *submitted = static_cast<unsigned>(ret);
+        return Status::OK();
+      }
+      // An error is only reported when nothing was submitted
+      if (errno == EAGAIN || errno == EBUSY) {
+        *submitted = 0;
+        return Status::OK();
+      }
+      if (errno != EINTR) {
+        *submitted = 0;
+        return IOErrorFromErrno(errno, "Error submitting io_uring reads");
+      }
+    }
+  }
+
+  bool PopCompletion(uint64_t* user_data, int32_t* res) {
+    const unsigned head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+      return false;
+    }
+    const struct io_uring_cqe* cqe = &cqes_[head & cq_mask_];
+    *user_data = cqe->user_data;
+    *res = cqe->res;
+    __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+ private:
+  Status Map(size_t size, off_t offset, void** out) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     ring_fd_, offset);
+    if (ptr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Cannot map io_uring queue");
+    }
+    *out = ptr;
+    return Status::OK();
+  }
+
+  int ring_fd_ = -1;
+  void* sq_ptr_ = nullptr;
+  void* cq_ptr_ = nullptr;
+  size_t sq_size_ = 0;
+  size_t cq_size_ = 0;
+  size_t sqes_size_ = 0;
+  struct io_uring_sqe* sqes_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+};
+
+constexpr unsigned IoUring::kQueueDepth;
+
+// Each thread uses its own ring.  A failed setup is remembered so that
+// unsupported kernels (or sandboxes denying the system calls) are only
+// probed once per thread.
+thread_local std::unique_ptr<IoUring> thread_io_uring;
+thread_local Status thread_io_uring_status;
+
+Result<IoUring*> GetThreadIoUring() {
+  if (thread_io_uring == nullptr && thread_io_uring_status.ok()) {
+    std::unique_ptr<IoUring> ring(new IoUring());
+    thread_io_uring_status = ring->Init();
+    if (thread_io_uring_status.ok()) {
+      thread_io_uring = std::move(ring);
+    }
+  }
+  RETURN_NOT_OK(thread_io_uring_status);
+  return thread_io_uring.get();
+}
+
+}  // namespace
+
+Status FileReadAtBatched(int fd, int64_t num_regions, const int64_t* positions,
+                         const int64_t* nbytes, uint8_t* const* buffers,
+                         int64_t* bytes_read) {
+  ARROW_ASSIGN_OR_RAISE(auto ring, GetThreadIoUring());
+
+  std::vector<struct iovec> iovs(num_regions);
+  // Regions with bytes left to read.  A region is queued again after a
+  // short read, which also splits reads larger than ARROW_MAX_IO_CHUNKSIZE.
+  std::vector<int64_t> pending;
+  pending.reserve(num_regions);
+  for (int64_t i = num_regions - 1; i >= 0; --i) {
+    bytes_read[i] = 0;
+    if (nbytes[i] > 0) {
+      pending.push_back(i);
+    }
+  }
+
+  // After an error no more reads are submitted, but reads already in
+  // flight write into the caller's buffers so they must complete before
+  // returning.
+  Status st;
+  // Reads prepared in the submission queue but not yet taken by the kernel
+  unsigned queued = 0;
+  unsigned in_flight = 0;
+  while (in_flight > 0 || (st.ok() && (!pending.empty() || queued > 0))) {
+    while (st.ok() && !pending.empty() && queued + in_flight < IoUring::kQueueDepth) {
+      const int64_t i = pending.back();
+      pending.pop_back();
+      const int64_t chunksize = std::min(static_cast<int64_t>(ARROW_MAX_IO_CHUNKSIZE),
+                                         nbytes[i] - bytes_read[i]);
+      iovs[i].iov_base = buffers[i] + bytes_read[i];
+      iovs[i].iov_len = static_cast<size_t>(chunksize);
+      ring->PrepareRead(fd, &iovs[i], positions[i] + bytes_read[i],
+                        static_cast<uint64_t>(i));
+      ++queued;
+    }
+    const unsigned to_submit = st.ok() ? queued : 0;
+    unsigned submitted = 0;
+    Status submit_st = ring->SubmitAndWait(to_submit, &submitted);
+    if (!submit_st.ok()) {
+      if (to_submit == 0) {
+        // Nothing more can be waited for, yet the kernel may still write
+        // into the caller's buffers
+        ARROW_LOG(FATAL) << "Cannot wait for in-flight io_uring reads: " << submit_st;
+      }
+      st &= submit_st;
+      pending.clear();
+    } else if (submitted == 0 && to_submit > 0 && in_flight == 0) {
+      st &= Status::IOError("io_uring did not accept any read");
+    }
+    queued -= submitted;
+    in_flight += submitted;
+
+    uint64_t user_data;
+    int32_t res;
+    while (ring->PopCompletion(&user_data, &res)) {
+      --in_flight;
+      const auto i = static_cast<int64_t>(user_data);
+      if (res == -EINTR || res == -EAGAIN) {
+        pending.push_back(i);
+      } else if (res < 0) {
+        st &= IOErrorFromErrno(-res, "Error reading bytes from file");
+        pending.clear();
+      } else if (res > 0) {
+        bytes_read[i] += res;
+        if (bytes_read[i] < nbytes[i]) {
+          pending.push_back(i);
+        }
+      }
+      // res == 0: EOF
+    }
+  }
+  if (queued > 0) {
+    // Drop the ring so that reads left in the submission queue are not
+    // submitted by a later call.
+    thread_io_uring.reset();
+  }
+  return st;
+}
+
+#else
+
+Status FileReadAtBatched(int fd, int64_t num_regions, const int64_t* positions,
+                         const int64_t* nbytes, uint8_t* const* buffers,
+                         int64_t* bytes_read) {
+  return Status::NotImplemented("Arrow was built without io_uring support");
+}
+
+#endif  // ARROW_HAVE_IO_URING
+
 //
 // Writing data
 //
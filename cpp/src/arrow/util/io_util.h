@@ -198,6 +198,17 @@ Result<int64_t> FileRead(int fd, uint8_t* buffer, int64_t nbytes);
 /// Read from given file position.  Return number of bytes read.
 ARROW_EXPORT
 Result<int64_t> FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes);
+/// \brief Read several regions of a file with batched io_uring submissions.
+///
+/// Region i of nbytes[i] bytes at positions[i] is read into buffers[i], and
+/// the number of bytes actually read (less at end of file) is stored into
+/// bytes_read[i].  Returns NotImplemented if Arrow was built without
+/// ARROW_WITH_IO_URING or the kernel does not provide io_uring, in which
+/// case callers should fall back to FileReadAt().
+ARROW_EXPORT
+Status FileReadAtBatched(int fd, int64_t num_regions, const int64_t* positions,
+                         const int64_t* nbytes, uint8_t* const* buffers,
+                         int64_t* bytes_read);
 
 ARROW_EXPORT
 Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes);
@@ -18,8 +18,11 @@
 #pragma once
 
 #include <cassert>
+#include <condition_variable>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -31,6 +34,7 @@
 #include "arrow/util/functional.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -526,4 +530,189 @@ Result<Iterator<T>> MakeReadaheadIterator(Iterator<T> it, int readahead_queue_si
   return ReadaheadIterator<T>::Make(std::move(it), readahead_queue_size);
 }
 
+/// \brief Options of MakeParallelMapIterator()
+struct ParallelMapOptions {
+  /// The maximum number of items being mapped or awaiting consumption at a
+  /// time.  If not positive, the capacity of the thread pool.
+  int max_in_flight = 0;
+  /// If positive, no new item is submitted while the mapped items awaiting
+  /// consumption weigh at least this many bytes, as measured by the
+  /// `item_size` function given to MakeParallelMapIterator().
+  int64_t max_bytes = 0;
+  /// Whether items are yielded in input order, rather than as soon as they
+  /// are mapped.
+  bool ordered = true;
+  /// The thread pool mapping the items, or null for the CPU thread pool.
+  internal::ThreadPool* thread_pool = NULLPTR;
+};
+
+/// \brief Iterator mapping the items of an underlying iterator on a thread
+/// pool, with a bounded number of items in flight.
+///
+/// Items are pulled from the underlying iterator by the consumer thread, in
+/// Next(), as the bounds allow.  An error, from the underlying iterator or
+/// from the map function, is yielded at its position and ends the iteration.
+/// The destructor waits for the items being mapped.
+template <typename Fn, typename From, typename To>
+class ParallelMapIterator {
+ public:
+  ParallelMapIterator(Fn map, Iterator<From> it, const ParallelMapOptions& options,
+                      std::function<int64_t(const To&)> item_size)
+      : state_(std::make_shared<State>(std::move(map), std::move(it), options,
+                                       std::move(item_size))) {}
+
+  ParallelMapIterator(ParallelMapIterator&&) = default;
+  ParallelMapIterator& operator=(ParallelMapIterator&&) = default;
+
+  ~ParallelMapIterator() {
+    if (state_ != NULLPTR) {
+      state_->Stop();
+    }
+  }
+
+  Result<To> Next() { return state_->Next(); }
+
+ private:
+  struct Mapped {
+    Result<To> value;
+    int64_t size;
+  };
+
+  struct State : public std::enable_shared_from_this<State> {
+    State(Fn map, Iterator<From> it, const ParallelMapOptions& options,
+          std::function<int64_t(const To&)> item_size)
+        : map(std::move(map)),
+          it(std::move(it)),
+          thread_pool(options.thread_pool != NULLPTR ? options.thread_pool
+                                                     : internal::GetCpuThreadPool()),
+          max_in_flight(options.max_in_flight > 0 ? options.max_in_flight
+                                                  : thread_pool->GetCapacity()),
+          max_bytes(options.max_bytes),
+          ordered(options.ordered),
+          item_size(std::move(item_size)) {}
+
+    Result<To> Next() {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (!finished) {
+        Submit(&lock);
+        auto next = ordered ? mapped.find(next_yielded) : mapped.begin();
+        if (next != mapped.end()) {
+          Result<To> out = std::move(next->second.value);
+          bytes_mapped -= next->second.size;
+          mapped.erase(next);
+          ++next_yielded;
+          --in_flight;
+          finished = !out.ok();
+          return out;
+        }
+        if (in_flight == 0 && exhausted) {
+          finished = true;
+          break;
+        }
+        // Some item is being mapped: wait for it
+        cv.wait(lock);
+      }
+      return IterationTraits<To>::End();
+    }
+
+    // Pull items from the underlying iterator and spawn their mapping, as
+    // permitted by the bounds.  The underlying iterator is only accessed
+    // from the consumer thread, without holding the mutex.
+    void Submit(std::unique_lock<std::mutex>* lock) {
+      while (!exhausted && in_flight < max_in_flight &&
+             (max_bytes <= 0 || bytes_mapped < max_bytes)) {
+        lock->unlock();
+        auto maybe_item = it.Next();
+        lock->lock();
+        if (!maybe_item.ok()) {
+          exhausted = true;
+          ++in_flight;
+          mapped.emplace(num_submitted++, Mapped{maybe_item.status(), 0});
+          break;
+        }
+        auto item = std::make_shared<From>(std::move(maybe_item).ValueOrDie());
+        if (*item == IterationTraits<From>::End()) {
+          exhausted = true;
+          break;
+        }
+        const int64_t index = num_submitted++;
+        ++in_flight;
+        ++running;
+        auto self = this->shared_from_this();
+        Status st = thread_pool->Spawn([self, index, item] {
+          self->Finish(index, self->map(std::move(*item)));
+        });
+        if (!st.ok()) {
+          --running;
+          mapped.emplace(index, Mapped{std::move(st), 0});
+        }
+      }
+    }
+
+    void Finish(int64_t index, Result<To> out) {
+      const int64_t size = (out.ok() && item_size) ? item_size(out.ValueOrDie()) : 0;
+      std::lock_guard<std::mutex> lock(mutex);
+      bytes_mapped += size;
+      mapped.emplace(index, Mapped{std::move(out), size});
+      --running;
+      cv.notify_all();
+    }
+
+    // Wait for the items being mapped, as the map function may reference
+    // state the caller destroys after this iterator
+    void Stop() {
+      std::unique_lock<std::mutex> lock(mutex);
+      finished = true;
+      cv.wait(lock, [this] { return running == 0; });
+    }
+
+    Fn map;
+    Iterator<From> it;
+    internal::ThreadPool* thread_pool;
+    const int max_in_flight;
+    const int64_t max_bytes;
+    const bool ordered;
+    std::function<int64_t(const To&)> item_size;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    // Mapped items awaiting consumption, by input position
+    std::map<int64_t, Mapped> mapped;
+    int64_t num_submitted = 0;
+    int64_t next_yielded = 0;
+    int64_t bytes_mapped = 0;
+    int in_flight = 0;
+    int running = 0;
+    bool exhausted = false;
+    bool finished = false;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+/// \brief Map the items of an iterator on a thread pool, with up to
+/// `options.max_in_flight` items being mapped or awaiting consumption.
+///
+/// The map function returns a Result<To> and may be called concurrently.
+/// `item_size`, which is only needed to bound the buffered bytes with
+/// `options.max_bytes`, returns the size of a mapped item as an int64_t.
+template <typename Fn, typename SizeFn,
+          typename From = internal::call_traits::argument_type<0, Fn>,
+          typename To = typename internal::call_traits::return_type<Fn>::ValueType>
+Iterator<To> MakeParallelMapIterator(Fn map, Iterator<From> it,
+                                     const ParallelMapOptions& options,
+                                     SizeFn item_size) {
+  return Iterator<To>(ParallelMapIterator<Fn, From, To>(
+      std::move(map), std::move(it), options,
+      std::function<int64_t(const To&)>(std::move(item_size))));
+}
+
+template <typename Fn, typename From = internal::call_traits::argument_type<0, Fn>,
+          typename To = typename internal::call_traits::return_type<Fn>::ValueType>
+Iterator<To> MakeParallelMapIterator(
+    Fn map, Iterator<From> it, const ParallelMapOptions& options = ParallelMapOptions()) {
+  return Iterator<To>(ParallelMapIterator<Fn, From, To>(
+      std::move(map), std::move(it), options, std::function<int64_t(const To&)>()));
+}
+
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/util/iterator.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <memory>
@@ -388,4 +389,152 @@ TEST(ReadaheadIterator, NextError) {
   AssertIteratorExhausted(it);
 }
 
+// Lets items complete out of order
+auto Double = [](TestInt i) -> Result<TestInt> {
+  SleepABit((i.value % 3) * 1e-4);
+  return TestInt(2 * i.value);
+};
+
+class TestParallelMapIterator : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(thread_pool_, internal::ThreadPool::Make(4));
+    options_.thread_pool = thread_pool_.get();
+  }
+
+ protected:
+  // An iterator over [0, n) counting the items pulled
+  Iterator<TestInt> CountingIt(int n) {
+    pulled_ = 0;
+    return MakeFunctionIterator([this, n]() -> Result<TestInt> {
+      if (pulled_ == n) {
+        return IterationTraits<TestInt>::End();
+      }
+      return TestInt(pulled_++);
+    });
+  }
+
+  std::shared_ptr<internal::ThreadPool> thread_pool_;
+  ParallelMapOptions options_;
+  int pulled_ = 0;
+};
+
+TEST_F(TestParallelMapIterator, Empty) {
+  AssertIteratorMatch({}, MakeParallelMapIterator(Double, VectorIt({}), options_));
+}
+
+TEST_F(TestParallelMapIterator, Ordered) {
+  std::vector<TestInt> expected;
+  for (int i = 0; i < 100; ++i) {
+    expected.emplace_back(2 * i);
+  }
+  for (int max_in_flight : {0, 1, 3, 16}) {
+    options_.max_in_flight = max_in_flight;
+    AssertIteratorMatch(expected,
+                        MakeParallelMapIterator(Double, CountingIt(100), options_));
+  }
+}
+
+TEST_F(TestParallelMapIterator, Unordered) {
+  options_.ordered = false;
+  options_.max_in_flight = 8;
+  ASSERT_OK_AND_ASSIGN(
+      auto values,
+      MakeParallelMapIterator(Double, CountingIt(100), options_).ToVector());
+  ASSERT_EQ(values.size(), 100);
+  std::vector<int> sorted;
+  for (const auto& value : values) {
+    sorted.push_back(value.value);
+  }
+  std::sort(sorted.begin(), sorted.end());
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(sorted[i], 2 * i);
+  }
+}
+
+TEST_F(TestParallelMapIterator, MaxInFlight) {
+  std::atomic<int> running(0), max_running(0);
+  auto map = [&](TestInt i) -> Result<TestInt> {
+    int now = ++running;
+    int prev = max_running.load();
+    while (now > prev && !max_running.compare_exchange_weak(prev, now)) {
+    }
+    SleepABit();
+    --running;
+    return i;
+  };
+  options_.max_in_flight = 3;
+  auto it = MakeParallelMapIterator(map, CountingIt(20), options_);
+  for (int i = 0; i < 20; ++i) {
+    AssertIteratorNext({i}, it);
+    // Items are only pulled as earlier ones are consumed
+    ASSERT_LE(pulled_, i + 1 + options_.max_in_flight);
+  }
+  AssertIteratorExhausted(it);
+  ASSERT_LE(max_running.load(), options_.max_in_flight);
+}
+
+TEST_F(TestParallelMapIterator, MaxBytes) {
+  options_.max_in_flight = 4;
+  options_.max_bytes = 1;
+  auto map = [](TestInt i) -> Result<TestInt> {
+    SleepABit();
+    return i;
+  };
+  auto it = MakeParallelMapIterator(map, CountingIt(20), options_,
+                                    [](const TestInt&) -> int64_t { return 1; });
+  AssertIteratorNext({0}, it);
+  SleepABit(1e-2);
+  const int pulled = pulled_;
+  ASSERT_LE(pulled, 4);
+  // While mapped items are buffered, no new item is pulled
+  for (int i = 1; i < pulled; ++i) {
+    AssertIteratorNext({i}, it);
+    ASSERT_EQ(pulled_, pulled);
+  }
+  AssertIteratorNext({pulled}, it);
+  ASSERT_GT(pulled_, pulled);
+}
+
+TEST_F(TestParallelMapIterator, MapError) {
+  auto map = [](TestInt i) -> Result<TestInt> {
+    if (i.value == 3) {
+      return Status::IOError("xxx");
+    }
+    return i;
+  };
+  options_.max_in_flight = 2;
+  auto it = MakeParallelMapIterator(map, CountingIt(10), options_);
+  AssertIteratorNext({0}, it);
+  AssertIteratorNext({1}, it);
+  AssertIteratorNext({2}, it);
+  ASSERT_RAISES(IOError, it.Next());
+  AssertIteratorExhausted(it);
+}
+
+TEST_F(TestParallelMapIterator, NextError) {
+  TracingIterator<TestInt> tracing_it((VectorIt({1, 2, 3})));
+  tracing_it.state()->InsertFailure(Status::IOError("xxx"));
+  auto it = MakeParallelMapIterator(Double, Iterator<TestInt>(std::move(tracing_it)),
+                                    options_);
+  ASSERT_RAISES(IOError, it.Next());
+  AssertIteratorExhausted(it);
+}
+
+TEST_F(TestParallelMapIterator, NotExhausted) {
+  std::atomic<int> mapped(0);
+  {
+    auto map = [&](TestInt i) -> Result<TestInt> {
+      SleepABit();
+      ++mapped;
+      return i;
+    };
+    options_.max_in_flight = 4;
+    auto it = MakeParallelMapIterator(map, CountingIt(10), options_);
+    AssertIteratorNext({0}, it);
+  }
+  // The destructor waited for the items being mapped
+  ASSERT_EQ(mapped.load(), pulled_);
+}
+
 }  // namespace arrow
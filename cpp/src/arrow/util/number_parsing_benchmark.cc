@@ -18,13 +18,18 @@
 #include "benchmark/benchmark.h"
 
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/formatting.h"
 #include "arrow/util/parsing.h"
 
@@ -49,6 +54,21 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Integers with many digits, e.g. identifiers or nanosecond timestamps
+template <typename c_int>
+static std::vector<std::string> MakeLongIntStrings(int32_t num_items) {
+  using c_int_limits = std::numeric_limits<c_int>;
+  std::vector<std::string> base_strings = {
+      "12345678", "987654321", "1234567890123", "1589932850000000000",
+      c_int_limits::is_signed ? "-42424242424242" : "42424242424242",
+      std::to_string(c_int_limits::max())};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"0.0",         "5",        "-12.3",
                                            "98765430000", "3456.789", "0.0012345",
@@ -60,6 +80,17 @@ static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   return strings;
 }
 
+// Decimal numbers as commonly found in CSV files (prices, measurements...)
+static std::vector<std::string> MakeDecimalFloatStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"0.5",     "12.99",     "-3.25",   "1024",
+                                           "0.00125", "123456.78", "-47.123", "6.02e23"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"2018-11-13 17:11:10", "2018-11-13 11:22:33",
                                            "2016-02-29 11:22:33"};
@@ -98,8 +129,9 @@ static std::vector<c_float> MakeFloats(int32_t num_items) {
 }
 
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
-static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
-  auto strings = MakeIntStrings<C_TYPE>(1000);
+static void BenchmarkIntegerParsing(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::vector<std::string>& strings) {
   StringConverter<ARROW_TYPE> converter;
 
   while (state.KeepRunning()) {
@@ -118,8 +150,18 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
 }
 
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
-static void FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
-  auto strings = MakeFloatStrings(1000);
+static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkIntegerParsing<ARROW_TYPE>(state, MakeIntStrings<C_TYPE>(1000));
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void LongIntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkIntegerParsing<ARROW_TYPE>(state, MakeLongIntStrings<C_TYPE>(1000));
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void BenchmarkFloatParsing(benchmark::State& state,  // NOLINT non-const reference
+                                  const std::vector<std::string>& strings) {
   StringConverter<ARROW_TYPE> converter;
 
   while (state.KeepRunning()) {
@@ -137,6 +179,16 @@ static void FloatParsing(benchmark::State& state) {  // NOLINT non-const referen
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE>
+static void FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFloatParsing<ARROW_TYPE>(state, MakeFloatStrings(1000));
+}
+
+template <typename ARROW_TYPE>
+static void DecimalFloatParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFloatParsing<ARROW_TYPE>(state, MakeDecimalFloatStrings(1000));
+}
+
 template <TimeUnit::type UNIT>
 static void TimestampParsing(benchmark::State& state) {  // NOLINT non-const reference
   using c_type = TimestampType::c_type;
@@ -203,6 +255,22 @@ static void FloatFormatting(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * values.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void BulkFloatFormatting(benchmark::State& state) {  // NOLINT non-const reference
+  using ArrayType = typename TypeTraits<ARROW_TYPE>::ArrayType;
+  std::vector<C_TYPE> values = MakeFloats<C_TYPE>(1000);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<ARROW_TYPE>(values, &array);
+  const auto& float_array = checked_cast<const ArrayType&>(*array);
+
+  while (state.KeepRunning()) {
+    StringBuilder builder;
+    ABORT_NOT_OK(FormatFloats(float_array, &builder));
+    benchmark::DoNotOptimize(builder.value_data_length());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
 BENCHMARK_TEMPLATE(IntegerParsing, Int8Type);
 BENCHMARK_TEMPLATE(IntegerParsing, Int16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, Int32Type);
@@ -212,8 +280,13 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(FloatParsing, FloatType);
 BENCHMARK_TEMPLATE(FloatParsing, DoubleType);
+BENCHMARK_TEMPLATE(DecimalFloatParsing, FloatType);
+BENCHMARK_TEMPLATE(DecimalFloatParsing, DoubleType);
 
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::SECOND);
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::MILLI);
@@ -232,5 +305,8 @@ BENCHMARK_TEMPLATE(IntegerFormatting, UInt64Type);
 BENCHMARK_TEMPLATE(FloatFormatting, FloatType);
 BENCHMARK_TEMPLATE(FloatFormatting, DoubleType);
 
+BENCHMARK_TEMPLATE(BulkFloatFormatting, FloatType);
+BENCHMARK_TEMPLATE(BulkFloatFormatting, DoubleType);
+
 }  // namespace internal
 }  // namespace arrow
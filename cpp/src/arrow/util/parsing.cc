@@ -16,11 +16,137 @@
 // under the License.
 
 #include "arrow/util/parsing.h"
+
+#include <cfloat>
+
 #include "arrow/util/double_conversion.h"
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+// Clinger's fast path: if the decimal mantissa and the power of ten are both
+// exactly representable, a single correctly rounded multiplication or division
+// gives the correctly rounded result.  This requires floating-point operations
+// to be evaluated in the precision of their type (i.e. no x87 extended precision).
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#define ARROW_FAST_FLOAT_PARSING 1
+#endif
+
+template <typename T>
+struct FastFloatTraits;
+
+template <>
+struct FastFloatTraits<double> {
+  static constexpr uint64_t kMaxMantissa = uint64_t(1) << 53;
+  static constexpr int32_t kMaxExponent = 22;
+  static double PowerOfTen(int32_t exponent) {
+    static constexpr double kPowers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                         1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                         1e18, 1e19, 1e20, 1e21, 1e22};
+    return kPowers[exponent];
+  }
+};
+
+template <>
+struct FastFloatTraits<float> {
+  static constexpr uint64_t kMaxMantissa = uint64_t(1) << 24;
+  static constexpr int32_t kMaxExponent = 10;
+  static float PowerOfTen(int32_t exponent) {
+    static constexpr float kPowers[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                        1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    return kPowers[exponent];
+  }
+};
+
+inline bool IsDecimalDigit(char c) { return static_cast<uint8_t>(c - '0') <= 9; }
+
+// Decompose a plain decimal number such as "-123.45e6" into its sign, integer
+// mantissa and decimal exponent.  Anything else (including special values,
+// incomplete forms such as ".5" and mantissas of more than 19 digits) is
+// rejected, and left to the fallback parser.
+bool ParseDecimalComponents(const char* s, size_t length, bool* negative,
+                            uint64_t* mantissa, int32_t* exponent) {
+  const char* end = s + length;
+  *negative = (s != end && *s == '-');
+  s += *negative;
+
+  uint64_t value = 0;
+  const char* digits_start = s;
+  while (s != end && IsDecimalDigit(*s)) {
+    value = value * 10 + static_cast<uint64_t>(*s++ - '0');
+  }
+  int64_t num_digits = s - digits_start;
+  if (num_digits == 0) {
+    return false;
+  }
+  int32_t exp = 0;
+  if (s != end && *s == '.') {
+    const char* fraction_start = ++s;
+    while (s != end && IsDecimalDigit(*s)) {
+      value = value * 10 + static_cast<uint64_t>(*s++ - '0');
+    }
+    if (s == fraction_start) {
+      return false;
+    }
+    num_digits += s - fraction_start;
+    exp = -static_cast<int32_t>(s - fraction_start);
+  }
+  if (num_digits > 19) {
+    // Mantissa may have overflowed
+    return false;
+  }
+  if (s != end && (*s == 'e' || *s == 'E')) {
+    ++s;
+    const bool negative_exp = (s != end && *s == '-');
+    s += (s != end && (*s == '-' || *s == '+'));
+    const char* exp_start = s;
+    int32_t exp_value = 0;
+    while (s != end && IsDecimalDigit(*s) && s - exp_start < 4) {
+      exp_value = exp_value * 10 + (*s++ - '0');
+    }
+    if (s == exp_start) {
+      return false;
+    }
+    exp += negative_exp ? -exp_value : exp_value;
+  }
+  if (s != end) {
+    return false;
+  }
+  *mantissa = value;
+  *exponent = exp;
+  return true;
+}
+
+template <typename T>
+bool FastStringToFloat(const char* s, size_t length, T* out) {
+#ifdef ARROW_FAST_FLOAT_PARSING
+  using Traits = FastFloatTraits<T>;
+  bool negative;
+  uint64_t mantissa;
+  int32_t exponent;
+  if (!ParseDecimalComponents(s, length, &negative, &mantissa, &exponent) ||
+      mantissa > Traits::kMaxMantissa || exponent > Traits::kMaxExponent ||
+      exponent < -Traits::kMaxExponent) {
+    return false;
+  }
+  T value = static_cast<T>(mantissa);
+  if (exponent < 0) {
+    value /= Traits::PowerOfTen(-exponent);
+  } else {
+    value *= Traits::PowerOfTen(exponent);
+  }
+  *out = negative ? -value : value;
+  return true;
+#else
+  return false;
+#endif
+}
+
+}  // namespace
+
 struct StringToFloatConverter::Impl {
   Impl()
       : main_converter_(flags_, main_junk_value_, main_junk_value_, "inf", "nan"),
@@ -48,6 +174,9 @@ StringToFloatConverter::StringToFloatConverter() : impl_(new Impl()) {}
 StringToFloatConverter::~StringToFloatConverter() {}
 
 bool StringToFloatConverter::StringToFloat(const char* s, size_t length, float* out) {
+  if (FastStringToFloat(s, length, out)) {
+    return true;
+  }
   int processed_length;
   float v;
   v = impl_->main_converter_.StringToFloat(s, static_cast<int>(length),
@@ -64,6 +193,9 @@ bool StringToFloatConverter::StringToFloat(const char* s, size_t length, float*
 }
 
 bool StringToFloatConverter::StringToFloat(const char* s, size_t length, double* out) {
+  if (FastStringToFloat(s, length, out)) {
+    return true;
+  }
   int processed_length;
   double v;
   v = impl_->main_converter_.StringToDouble(s, static_cast<int>(length),
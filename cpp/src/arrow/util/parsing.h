@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -28,6 +29,7 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
 #include "arrow/vendored/datetime.h"
@@ -88,6 +90,10 @@ class StringConverter<BooleanType> {
 // - http://rapidjson.org/md_doc_internals.html#ParsingDouble
 // - https://github.com/google/double-conversion [used here]
 // - https://github.com/achan001/dtoa-fast
+//
+// Plain decimal numbers whose value is exactly computable from an integer
+// mantissa and a small power of ten (Clinger's fast path) are handled directly,
+// other inputs are delegated to double-conversion.
 
 class ARROW_EXPORT StringToFloatConverter {
  public:
@@ -130,6 +136,30 @@ namespace detail {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// Parse exactly 8 decimal digits at once, using SWAR arithmetic on a 64-bit word
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t chunk;
+  memcpy(&chunk, s, sizeof(chunk));
+  // The first character is in the low byte
+  chunk = BitUtil::FromLittleEndian(chunk);
+  const uint64_t digits = chunk - 0x3030303030303030ULL;
+  // A byte below '0' sets its high bit in `digits`, a byte above '9' sets
+  // its high bit in `chunk + 0x46...`
+  if (ARROW_PREDICT_FALSE(((chunk | digits | (chunk + 0x4646464646464646ULL)) &
+                           0x8080808080808080ULL) != 0)) {
+    /* Non-digit */
+    return false;
+  }
+  // Combine adjacent digits into 2-digit values (in even bytes)...
+  uint64_t value = digits * 10 + (digits >> 8);
+  // ... then combine the four 2-digit values in the upper 32 bits
+  value = ((value & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)) +
+           ((value >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32))) >>
+          32;
+  *out = static_cast<uint32_t>(value);
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -191,49 +221,63 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
   uint32_t result = 0;
 
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-
-  PARSE_UNSIGNED_ITERATION_LAST(uint32_t);
+  if (length >= 8) {
+    // 8 digits at once, then at most 2 (10 digits max)
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &result))) {
+      return false;
+    }
+    s += 8;
+    length -= 8;
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+    PARSE_UNSIGNED_ITERATION_LAST(uint32_t);
+  } else {
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+  }
   *out = result;
   return true;
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   uint64_t result = 0;
+  uint32_t block;
 
+  if (length >= 8) {
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &block))) {
+      return false;
+    }
+    s += 8;
+    length -= 8;
+    result = block;
+    if (length >= 8) {
+      // 16 digits in two steps, then at most 4 (20 digits max)
+      if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &block))) {
+        return false;
+      }
+      s += 8;
+      length -= 8;
+      result = result * 100000000U + block;
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION_LAST(uint64_t);
+      *out = result;
+      return true;
+    }
+  }
+  // At most 15 digits in total, so no overflow is possible
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION_LAST(uint64_t);
   *out = result;
   return true;
 }
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <limits>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -63,9 +64,19 @@ TEST(StringConversion, ToFloat) {
   // XXX ASSERT_EQ doesn't distinguish signed zeros
   AssertConversion(converter, "-0.0", -0.0f);
   AssertConversion(converter, "-1e20", -1e20f);
+  AssertConversion(converter, "0.1", 0.1f);
+  AssertConversion(converter, "-12.625e-3", -12.625e-3f);
+  AssertConversion(converter, "1.5E+2", 150.0f);
+  AssertConversion(converter, "16777217", 16777216.0f);
+  AssertConversion(converter, "3.4028235e38", 3.4028235e38f);
+  AssertConversion(converter, ".5", 0.5f);
+  AssertConversion(converter, "inf", std::numeric_limits<float>::infinity());
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "e");
+  AssertConversionFails(converter, "1.5x");
+  AssertConversionFails(converter, "1e");
+  AssertConversionFails(converter, "--1");
 }
 
 TEST(StringConversion, ToDouble) {
@@ -76,9 +87,21 @@ TEST(StringConversion, ToDouble) {
   // XXX ASSERT_EQ doesn't distinguish signed zeros
   AssertConversion(converter, "-0.0", -0.0);
   AssertConversion(converter, "-1e100", -1e100);
+  AssertConversion(converter, "0.1", 0.1);
+  AssertConversion(converter, "-12.625e-3", -12.625e-3);
+  AssertConversion(converter, "1.5E+2", 150.0);
+  AssertConversion(converter, "3456.789", 3456.789);
+  AssertConversion(converter, "9007199254740993", 9007199254740992.0);
+  AssertConversion(converter, "1.7976931348623157e308", 1.7976931348623157e308);
+  AssertConversion(converter, "0.000000000000000000000000001", 1e-27);
+  AssertConversion(converter, ".5", 0.5);
+  AssertConversion(converter, "inf", std::numeric_limits<double>::infinity());
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "e");
+  AssertConversionFails(converter, "1.5x");
+  AssertConversionFails(converter, "1e");
+  AssertConversionFails(converter, "--1");
 }
 
 #if !defined(_WIN32) || defined(NDEBUG)
@@ -204,12 +227,19 @@ TEST(StringConversion, ToUInt32) {
   AssertConversion(converter, "432198765", 432198765UL);
   AssertConversion(converter, "4294967295", 4294967295UL);
   AssertConversion(converter, "04294967295", 4294967295UL);
+  AssertConversion(converter, "12345678", 12345678UL);
+  AssertConversion(converter, "987654321", 987654321UL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "4294967296");
   AssertConversionFails(converter, "12345678901");
 
+  // Non-digits in a block of 8 digits
+  AssertConversionFails(converter, "1234/678");
+  AssertConversionFails(converter, "1234567:");
+  AssertConversionFails(converter, "12345678.");
+
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
   AssertConversionFails(converter, "0.0");
@@ -240,10 +270,18 @@ TEST(StringConversion, ToUInt64) {
 
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
+  AssertConversion(converter, "123456789012345", 123456789012345ULL);
+  AssertConversion(converter, "1234567890123456", 1234567890123456ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
+  AssertConversionFails(converter, "99999999999999999999");
+  AssertConversionFails(converter, "123456789012345678901");
+
+  // Non-digits in a block of 8 digits
+  AssertConversionFails(converter, "123456789012345 ");
+  AssertConversionFails(converter, "123456789012345\xb5");
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
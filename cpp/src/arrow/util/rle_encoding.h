@@ -121,6 +121,12 @@ class RleDecoder {
   int GetBatchSpaced(int batch_size, int null_count, const uint8_t* valid_bits,
                      int64_t valid_bits_offset, T* out);
 
+  /// Like GetBatch but for a bit width of 1, the values are written as the bits
+  /// of a bitmap starting at `bitmap_offset`. The number of zero values read
+  /// is added to `zero_count`.
+  int GetBatchBitmap(int batch_size, uint8_t* bitmap, int64_t bitmap_offset,
+                     int64_t* zero_count);
+
   /// Like GetBatch but the values are then decoded using the provided dictionary
   template <typename T>
   int GetBatchWithDict(const T* dictionary, int32_t dictionary_length, T* values,
@@ -325,6 +331,45 @@ inline int RleDecoder::GetBatch(T* values, int batch_size) {
   return values_read;
 }
 
+inline int RleDecoder::GetBatchBitmap(int batch_size, uint8_t* bitmap,
+                                      int64_t bitmap_offset, int64_t* zero_count) {
+  DCHECK_EQ(bit_width_, 1);
+  int values_read = 0;
+
+  while (values_read < batch_size) {
+    int remaining = batch_size - values_read;
+
+    if (repeat_count_ > 0) {
+      int repeat_batch = std::min(remaining, repeat_count_);
+      BitUtil::SetBitsTo(bitmap, bitmap_offset + values_read, repeat_batch,
+                         current_value_ != 0);
+      if (current_value_ == 0) {
+        *zero_count += repeat_batch;
+      }
+
+      repeat_count_ -= repeat_batch;
+      values_read += repeat_batch;
+    } else if (literal_count_ > 0) {
+      // With a bit width of 1 the literal values already are bitmap bits, so
+      // they are copied a word at a time
+      int literal_batch = std::min(std::min(remaining, literal_count_), 32);
+      uint32_t word = 0;
+      if (!bit_reader_.GetValue(literal_batch, &word)) {
+        return values_read;
+      }
+      BitUtil::SetBitsFromWord(bitmap, bitmap_offset + values_read, word, literal_batch);
+      *zero_count += literal_batch - BitUtil::PopCount(word);
+
+      literal_count_ -= literal_batch;
+      values_read += literal_batch;
+    } else {
+      if (!NextCounts<uint8_t>()) return values_read;
+    }
+  }
+
+  return values_read;
+}
+
 template <typename T>
 inline int RleDecoder::GetBatchSpaced(int batch_size, int null_count,
                                       const uint8_t* valid_bits,
@@ -475,95 +520,52 @@ inline int RleDecoder::GetBatchWithDictSpaced(const T* dictionary,
                                               const uint8_t* valid_bits,
                                               int64_t valid_bits_offset) {
   DCHECK_GE(bit_width_, 0);
-  int values_read = 0;
-  int remaining_nulls = null_count;
-  T zero = {};
-
-  arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, batch_size);
-
-  while (values_read < batch_size) {
-    DCHECK_LT(bit_reader.position(), batch_size);
-    bool is_valid = bit_reader.IsSet();
-    bit_reader.Next();
-
-    if (is_valid) {
-      if ((repeat_count_ == 0) && (literal_count_ == 0)) {
-        if (!NextCounts<T>()) return values_read;
-      }
-      if (repeat_count_ > 0) {
-        auto idx = static_cast<int32_t>(current_value_);
-        if (ARROW_PREDICT_FALSE(!IndexInRange(idx, dictionary_length))) {
-          return values_read;
-        }
-        T value = dictionary[idx];
-        // The current index is already valid, we don't need to check that again
-        int repeat_batch = 1;
-        repeat_count_--;
-
-        while (repeat_count_ > 0 && (values_read + repeat_batch) < batch_size) {
-          DCHECK_LT(bit_reader.position(), batch_size);
-          if (bit_reader.IsSet()) {
-            repeat_count_--;
-          } else {
-            remaining_nulls--;
-          }
-          repeat_batch++;
-
-          bit_reader.Next();
-        }
-        std::fill(out, out + repeat_batch, value);
-        out += repeat_batch;
-        values_read += repeat_batch;
-      } else if (literal_count_ > 0) {
-        int literal_batch =
-            std::min(batch_size - values_read - remaining_nulls, literal_count_);
-
-        // Decode the literals
-        constexpr int kBufferSize = 1024;
-        int indices[kBufferSize];
-        literal_batch = std::min(literal_batch, kBufferSize);
-        int actual_read = bit_reader_.GetBatch(bit_width_, &indices[0], literal_batch);
-        if (actual_read != literal_batch) return values_read;
-
-        int skipped = 0;
-        int literals_read = 1;
-
-        int first_idx = indices[0];
-        if (ARROW_PREDICT_FALSE(!IndexInRange(first_idx, dictionary_length))) {
-          return values_read;
-        }
-        *out++ = dictionary[first_idx];
+  DCHECK_LE(null_count, batch_size);
+  // The valid values are decoded at the front of out, as by GetBatchWithDict,
+  // then moved to their slots
+  const int num_valid = batch_size - null_count;
+  const int decoded = GetBatchWithDict(dictionary, dictionary_length, out, num_valid);
+  if (ARROW_PREDICT_FALSE(decoded != num_valid)) {
+    return decoded;
+  }
+  if (null_count == 0) {
+    return batch_size;
+  }
 
-        // Read the first bitset to the end
-        while (literals_read < literal_batch) {
-          DCHECK_LT(bit_reader.position(), batch_size);
-          if (bit_reader.IsSet()) {
-            int idx = indices[literals_read];
-            if (ARROW_PREDICT_FALSE(!IndexInRange(idx, dictionary_length))) {
-              return values_read;
-            }
-            *out = dictionary[idx];
-            literals_read++;
-          } else {
-            *out = zero;
-            skipped++;
-          }
-          ++out;
-          bit_reader.Next();
-        }
-        literal_count_ -= literal_batch;
-        values_read += literal_batch + skipped;
-        remaining_nulls -= skipped;
-      }
-    } else {
-      *out = zero;
-      ++out;
-      values_read++;
-      remaining_nulls--;
+  // The values are moved from the back, so that none is overwritten before it
+  // is moved.  The validity bitmap is read 64 bits at a time, each run of valid
+  // values being moved at once and each run of nulls zeroed.
+  const T zero = {};
+  int src = num_valid;
+  int block_end = batch_size;
+  while (block_end > 0) {
+    const int block_length = std::min(64, block_end);
+    const int block_start = block_end - block_length;
+    // The block's bits are moved to the top of the word, so that its last one
+    // is the most significant
+    uint64_t valid =
+        BitUtil::GetBitsAsWord(valid_bits, valid_bits_offset + block_start, block_length)
+        << (64 - block_length);
+    int end = block_start + block_length;
+    while (end > block_start) {
+      const int num_nulls =
+          valid == 0 ? end - block_start : BitUtil::CountLeadingZeros(valid);
+      std::fill(out + end - num_nulls, out + end, zero);
+      end -= num_nulls;
+      if (end == block_start) break;
+      valid <<= num_nulls;
+
+      const int run_length = BitUtil::CountLeadingZeros(~valid);
+      std::copy_backward(out + src - run_length, out + src, out + end);
+      src -= run_length;
+      end -= run_length;
+      valid = run_length == 64 ? 0 : valid << run_length;
     }
+    block_end = block_start;
   }
+  DCHECK_EQ(src, 0);
 
-  return values_read;
+  return batch_size;
 }
 
 template <typename T>
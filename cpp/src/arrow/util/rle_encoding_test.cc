@@ -531,5 +531,128 @@ TEST(RleDecoder, GetBatchSpaced) {
   }
 }
 
+TEST(RleDecoder, GetBatchWithDictSpaced) {
+  uint32_t kSeed = 1337;
+  ::arrow::random::RandomArrayGenerator rand(kSeed);
+
+  const int32_t dictionary_length = 100;
+  std::vector<double> dictionary(dictionary_length);
+  for (int32_t i = 0; i < dictionary_length; ++i) {
+    dictionary[i] = i * 1.5;
+  }
+
+  // Small and large maximum indices give both repeated and literal runs
+  for (int32_t max_index : {1, 99}) {
+    for (double null_probability : {0.0, 0.01, 0.5, 0.99}) {
+      auto arr = std::static_pointer_cast<Int32Array>(
+          rand.Int32(10000, /*min=*/0, max_index, null_probability)->Slice(3));
+      const int num_values = static_cast<int>(arr->length());
+      const int bit_width = 7;
+      const int buffer_size = RleEncoder::MaxBufferSize(bit_width, num_values);
+      std::vector<uint8_t> buffer(buffer_size);
+      RleEncoder encoder(buffer.data(), buffer_size, bit_width);
+      for (int i = 0; i < num_values; ++i) {
+        if (arr->IsValid(i)) {
+          ASSERT_TRUE(encoder.Put(arr->Value(i)));
+        }
+      }
+      int encoded_size = encoder.Flush();
+
+      // Batches which don't line up with the runs nor with the bitmap's words
+      RleDecoder decoder(buffer.data(), encoded_size, bit_width);
+      std::vector<double> values(num_values, -1);
+      int values_read = 0;
+      while (values_read < num_values) {
+        const int batch_size = std::min(333, num_values - values_read);
+        const int64_t null_count =
+            arr->null_count() == 0
+                ? 0
+                : batch_size - ::arrow::internal::CountSetBits(
+                                   arr->null_bitmap_data(), arr->offset() + values_read,
+                                   batch_size);
+        ASSERT_EQ(batch_size, decoder.GetBatchWithDictSpaced(
+                                  dictionary.data(), dictionary_length,
+                                  values.data() + values_read, batch_size,
+                                  static_cast<int>(null_count), arr->null_bitmap_data(),
+                                  arr->offset() + values_read));
+        values_read += batch_size;
+      }
+      for (int i = 0; i < num_values; ++i) {
+        const double expected = arr->IsValid(i) ? dictionary[arr->Value(i)] : 0;
+        ASSERT_EQ(expected, values[i]) << "at index " << i;
+      }
+    }
+  }
+}
+
+TEST(RleDecoder, GetBatchWithDictOutOfRange) {
+  const int bit_width = 4;
+  const std::vector<int> indices = {0, 1, 2, 3, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+  std::vector<uint8_t> buffer(RleEncoder::MinBufferSize(bit_width) +
+                              RleEncoder::MaxBufferSize(bit_width, 14));
+  RleEncoder encoder(buffer.data(), static_cast<int>(buffer.size()), bit_width);
+  for (int index : indices) {
+    ASSERT_TRUE(encoder.Put(index));
+  }
+  int encoded_size = encoder.Flush();
+
+  const std::vector<int64_t> dictionary = {10, 11, 12, 13};
+  std::vector<int64_t> values(indices.size());
+  RleDecoder decoder(buffer.data(), encoded_size, bit_width);
+  ASSERT_LT(decoder.GetBatchWithDict(dictionary.data(), 4, values.data(), 14), 14);
+
+  const std::vector<uint8_t> valid_bits = {0xFF, 0x3F};
+  RleDecoder spaced_decoder(buffer.data(), encoded_size, bit_width);
+  ASSERT_LT(spaced_decoder.GetBatchWithDictSpaced(dictionary.data(), 4, values.data(),
+                                                  16, 2, valid_bits.data(), 0),
+            16);
+}
+
+TEST(RleDecoder, GetBatchBitmap) {
+  uint32_t kSeed = 1337;
+  ::arrow::random::RandomArrayGenerator rand(kSeed);
+
+  // Sparse and dense values give both repeated and literal runs
+  for (double probability : {0.001, 0.1, 0.5}) {
+    auto arr = std::static_pointer_cast<BooleanArray>(
+        rand.Boolean(10000, probability, /*null_probability=*/0));
+    std::vector<int> values(arr->length());
+    int64_t expected_zero_count = 0;
+    for (int64_t i = 0; i < arr->length(); ++i) {
+      values[i] = arr->Value(i);
+      expected_zero_count += !arr->Value(i);
+    }
+    const int num_values = static_cast<int>(values.size());
+    const int buffer_size = RleEncoder::MaxBufferSize(1, num_values);
+    std::vector<uint8_t> buffer(buffer_size);
+    RleEncoder encoder(buffer.data(), buffer_size, 1);
+    for (int value : values) {
+      ASSERT_TRUE(encoder.Put(value));
+    }
+    int encoded_size = encoder.Flush();
+
+    RleDecoder decoder(buffer.data(), encoded_size, 1);
+    const int64_t offset = 5;
+    std::vector<uint8_t> bitmap(BitUtil::BytesForBits(offset + num_values), 0xFF);
+    int64_t zero_count = 0;
+    int values_read = 0;
+    while (values_read < num_values) {
+      int batch = decoder.GetBatchBitmap(std::min(333, num_values - values_read),
+                                         bitmap.data(), offset + values_read,
+                                         &zero_count);
+      ASSERT_GT(batch, 0);
+      values_read += batch;
+    }
+    ASSERT_EQ(expected_zero_count, zero_count);
+    for (int64_t i = 0; i < offset; ++i) {
+      ASSERT_TRUE(BitUtil::GetBit(bitmap.data(), i));
+    }
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_EQ(values[i] != 0, BitUtil::GetBit(bitmap.data(), offset + i))
+          << "at index " << i;
+    }
+  }
+}
+
 }  // namespace util
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/util/task_group.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <mutex>
@@ -75,8 +76,10 @@ class SerialTaskGroup : public TaskGroup {
 
 class ThreadedTaskGroup : public TaskGroup {
  public:
-  explicit ThreadedTaskGroup(ThreadPool* thread_pool)
-      : thread_pool_(thread_pool), nremaining_(0), ok_(true) {}
+  ThreadedTaskGroup(ThreadPool* thread_pool, int32_t priority)
+      : thread_pool_(thread_pool), nremaining_(0), ok_(true) {
+    hints_.priority = priority;
+  }
 
   ~ThreadedTaskGroup() override {
     // Make sure all pending tasks are finished, so that dangling references
@@ -91,7 +94,7 @@ class ThreadedTaskGroup : public TaskGroup {
       nremaining_.fetch_add(1, std::memory_order_acquire);
 
       auto self = checked_pointer_cast<ThreadedTaskGroup>(shared_from_this());
-      Status st = thread_pool_->Spawn([self, task]() {
+      Status st = thread_pool_->Spawn(hints_, [self, task]() {
         if (self->ok_.load(std::memory_order_acquire)) {
           // XXX what about exceptions?
           Status st = task();
@@ -113,7 +116,26 @@ class ThreadedTaskGroup : public TaskGroup {
   Status Finish() override {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!finished_) {
-      cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      if (thread_pool_->OwnsThisThread()) {
+        // Help run the pool's tasks, among which ours, rather than blocking a
+        // worker.  When there are none, our remaining tasks are running on other
+        // workers, but they may spawn new tasks: check again periodically.
+        while (nremaining_.load() != 0) {
+          lock.unlock();
+          const bool ran_task = thread_pool_->RunPendingTask();
+          lock.lock();
+          if (!ran_task) {
+            cv_.wait_for(lock, std::chrono::milliseconds(1),
+                         [&]() { return nremaining_.load() == 0; });
+          }
+        }
+        if (finished_) {
+          // Finished concurrently while the lock was released
+          return status_;
+        }
+      } else {
+        cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      }
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
       if (parent_) {
@@ -127,7 +149,7 @@ class ThreadedTaskGroup : public TaskGroup {
 
   std::shared_ptr<TaskGroup> MakeSubGroup() override {
     std::lock_guard<std::mutex> lock(mutex_);
-    auto child = new ThreadedTaskGroup(thread_pool_);
+    auto child = new ThreadedTaskGroup(thread_pool_, hints_.priority);
     child->parent_ = this;
     nremaining_.fetch_add(1, std::memory_order_acquire);
     return std::shared_ptr<TaskGroup>(child);
@@ -157,6 +179,7 @@ class ThreadedTaskGroup : public TaskGroup {
 
   // These members are usable unlocked
   ThreadPool* thread_pool_;
+  TaskHints hints_;
   std::atomic<int32_t> nremaining_;
   std::atomic<bool> ok_;
 
@@ -172,8 +195,9 @@ std::shared_ptr<TaskGroup> TaskGroup::MakeSerial() {
   return std::shared_ptr<TaskGroup>(new SerialTaskGroup);
 }
 
-std::shared_ptr<TaskGroup> TaskGroup::MakeThreaded(ThreadPool* thread_pool) {
-  return std::shared_ptr<TaskGroup>(new ThreadedTaskGroup(thread_pool));
+std::shared_ptr<TaskGroup> TaskGroup::MakeThreaded(ThreadPool* thread_pool,
+                                                   int32_t priority) {
+  return std::shared_ptr<TaskGroup>(new ThreadedTaskGroup(thread_pool, priority));
 }
 
 }  // namespace internal
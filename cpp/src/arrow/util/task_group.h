@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -52,6 +53,11 @@ class ARROW_EXPORT TaskGroup : public std::enable_shared_from_this<TaskGroup> {
   /// or for at least one task (or subgroup) to error out.
   /// The returned Status propagates the error status of the first failing
   /// task (or subgroup).
+  ///
+  /// When called from a worker of the group's thread pool, e.g. by a task
+  /// which runs a nested TaskGroup, the worker runs pending tasks of the pool
+  /// while waiting instead of blocking, so that nested parallelism neither
+  /// leaves workers idle nor deadlocks a pool whose workers are all waiting.
   virtual Status Finish() = 0;
 
   /// The current aggregate error Status.  Non-blocking, useful for stopping early.
@@ -73,7 +79,12 @@ class ARROW_EXPORT TaskGroup : public std::enable_shared_from_this<TaskGroup> {
   virtual std::shared_ptr<TaskGroup> MakeSubGroup() = 0;
 
   static std::shared_ptr<TaskGroup> MakeSerial();
-  static std::shared_ptr<TaskGroup> MakeThreaded(internal::ThreadPool*);
+  /// Create a TaskGroup running its tasks on the given thread pool.  The tasks
+  /// of the group and of its subgroups are spawned with the given priority, see
+  /// TaskHints::priority: e.g. interactive work can be given precedence over
+  /// bulk work sharing the CPU thread pool.
+  static std::shared_ptr<TaskGroup> MakeThreaded(internal::ThreadPool*,
+                                                 int32_t priority = 0);
 
   virtual ~TaskGroup() = default;
 
@@ -20,7 +20,9 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <random>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -276,6 +278,33 @@ void StressFailingTaskGroupLifetime(std::function<std::shared_ptr<TaskGroup>()>
   }
 }
 
+// Tasks of a group run nested groups on the same thread pool, waiting for
+// them in Finish().  With as many outer tasks as workers, this can only
+// complete if waiting workers run the nested tasks themselves.
+void TestNestedTaskGroups(ThreadPool* thread_pool) {
+  const int kOuterTasks = thread_pool->GetCapacity();
+  const int kInnerTasks = 20;
+
+  std::atomic<int> count(0);
+  auto outer_group = TaskGroup::MakeThreaded(thread_pool);
+  for (int i = 0; i < kOuterTasks; ++i) {
+    outer_group->Append([&]() {
+      auto inner_group = TaskGroup::MakeThreaded(thread_pool);
+      for (int j = 0; j < kInnerTasks; ++j) {
+        inner_group->Append([&]() {
+          SleepFor(1e-4);
+          count++;
+          return Status::OK();
+        });
+      }
+      return inner_group->Finish();
+    });
+  }
+
+  ASSERT_OK(outer_group->Finish());
+  ASSERT_EQ(count.load(), kOuterTasks * kInnerTasks);
+}
+
 TEST(SerialTaskGroup, Success) { TestTaskGroupSuccess(TaskGroup::MakeSerial()); }
 
 TEST(SerialTaskGroup, Errors) { TestTaskGroupErrors(TaskGroup::MakeSerial()); }
@@ -323,6 +352,55 @@ TEST(ThreadedTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeThreaded(thread_pool.get()));
 }
 
+TEST(ThreadedTaskGroup, NestedTaskGroups) {
+  for (int threads : {1, 3}) {
+    std::shared_ptr<ThreadPool> thread_pool;
+    ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(threads));
+    TestNestedTaskGroups(thread_pool.get());
+
+    ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::MakeWorkStealing(threads));
+    TestNestedTaskGroups(thread_pool.get());
+  }
+}
+
+TEST(ThreadedTaskGroup, Priority) {
+  std::shared_ptr<ThreadPool> thread_pool;
+  ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(1));
+
+  // Keep the only worker busy while the tasks are queued
+  std::atomic<bool> release(false);
+  ASSERT_OK(thread_pool->Spawn([&] {
+    while (!release.load()) {
+      SleepFor(1e-3);
+    }
+  }));
+
+  std::mutex mutex;
+  std::vector<std::string> order;
+  auto append = [&](const std::shared_ptr<TaskGroup>& group, std::string name) {
+    group->Append([&, name] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(name);
+      return Status::OK();
+    });
+  };
+  auto bulk = TaskGroup::MakeThreaded(thread_pool.get());
+  auto interactive = TaskGroup::MakeThreaded(thread_pool.get(), /*priority=*/1);
+  auto interactive_sub = interactive->MakeSubGroup();
+  append(bulk, "bulk1");
+  append(bulk, "bulk2");
+  append(interactive, "interactive1");
+  append(interactive_sub, "interactive_sub");
+  append(interactive, "interactive2");
+  release = true;
+
+  ASSERT_OK(interactive_sub->Finish());
+  ASSERT_OK(interactive->Finish());
+  ASSERT_OK(bulk->Finish());
+  ASSERT_EQ(order, std::vector<std::string>({"interactive1", "interactive_sub",
+                                             "interactive2", "bulk1", "bulk2"}));
+}
+
 TEST(ThreadedTaskGroup, StressTaskGroupLifetime) {
   std::shared_ptr<ThreadPool> thread_pool;
   ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(16));
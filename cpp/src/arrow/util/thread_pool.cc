@@ -18,9 +18,12 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <list>
+#include <map>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -28,16 +31,77 @@
 
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+// The pending tasks of a FIFO pool, by decreasing priority then in spawn order
+class PendingTasks {
+ public:
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  void Push(int32_t priority, std::function<void()> task) {
+    queues_[priority].push_back(std::move(task));
+    ++size_;
+  }
+
+  std::function<void()> Pop() {
+    DCHECK(!empty());
+    // Empty queues are erased, so the first queue is that of the highest
+    // pending priority
+    auto it = queues_.begin();
+    std::function<void()> task = std::move(it->second.front());
+    it->second.pop_front();
+    if (it->second.empty()) {
+      queues_.erase(it);
+    }
+    --size_;
+    return task;
+  }
+
+  void clear() {
+    queues_.clear();
+    size_ = 0;
+  }
+
+ private:
+  std::map<int32_t, std::deque<std::function<void()>>, std::greater<int32_t>> queues_;
+  size_t size_ = 0;
+};
+
+}  // namespace
+
 struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+  State()
+      : desired_capacity_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false),
+        num_queued_tasks_(0),
+        num_idle_workers_(0),
+        next_queue_(0),
+        num_launched_workers_(0),
+        capacity_decreased_(false) {}
 
   // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
   // such as https://github.com/cameron314/concurrentqueue
 
+  struct WorkerQueue {
+    std::mutex mutex_;
+    std::deque<std::function<void()>> tasks_;
+  };
+
+  void MakeWorkerQueues(size_t num_queues) {
+    for (size_t i = 0; i < num_queues; ++i) {
+      worker_queues_.emplace_back(new WorkerQueue);
+    }
+  }
+
+  bool work_stealing() const { return !worker_queues_.empty(); }
+
   std::mutex mutex_;
   std::condition_variable cv_;
   std::condition_variable cv_shutdown_;
@@ -45,19 +109,45 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<std::function<void()>> pending_tasks_;
+  PendingTasks pending_tasks_;
 
   // Desired number of threads
   int desired_capacity_;
-  // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  // Are we shutting down?  (atomic as work-stealing workers and spawners check
+  // these without holding the mutex; spawners check please_shutdown_ under the
+  // lock of the queue they push to, see Shutdown())
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
+
+  // In work-stealing mode, pending tasks are queued in worker_queues_ rather
+  // than pending_tasks_: each worker owns one queue and runs the tasks it
+  // spawns itself in LIFO order, stealing from the front of other queues when
+  // its own is empty.  There may be more workers than queues after the
+  // capacity was increased, in which case some queues are shared.
+  std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+  // Total number of tasks in worker_queues_
+  std::atomic<int64_t> num_queued_tasks_;
+  // Number of workers waiting on cv_ for tasks to be queued
+  std::atomic<int> num_idle_workers_;
+  // Queue of the next task spawned from outside of the pool
+  std::atomic<size_t> next_queue_;
+  // Queue of the next launched worker
+  size_t num_launched_workers_;
+  // Raised when the capacity was decreased, so that workers check whether
+  // to secede after finishing their current task
+  std::atomic<bool> capacity_decreased_;
 };
 
+// The pool whose worker is running on this thread, if any
+static thread_local ThreadPool::State* current_worker_state = nullptr;
+// In work-stealing mode, the queue owned by the worker running on this thread
+static thread_local size_t current_worker_queue = 0;
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
                        std::list<std::thread>::iterator it) {
+  current_worker_state = state.get();
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
@@ -82,8 +172,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
         break;
       }
       {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
+        std::function<void()> task = state->pending_tasks_.Pop();
         lock.unlock();
         task();
       }
@@ -97,6 +186,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     state->cv_.wait(lock);
   }
 
+  current_worker_state = nullptr;
   // We're done.  Move our thread object to the trashcan of finished
   // workers.  This has two motivations:
   // 1) the thread object doesn't get destroyed before this function finishes
@@ -113,6 +203,83 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   }
 }
 
+// Pop the latest task of the worker's own queue, or else steal the oldest task
+// of another queue
+static bool TakeQueuedTask(ThreadPool::State* state, size_t own_queue,
+                           std::function<void()>* out) {
+  const auto& queues = state->worker_queues_;
+  for (size_t i = 0; i < queues.size() && state->num_queued_tasks_ > 0; ++i) {
+    auto& queue = *queues[(own_queue + i) % queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex_);
+    if (queue.tasks_.empty()) {
+      continue;
+    }
+    if (i == 0) {
+      *out = std::move(queue.tasks_.back());
+      queue.tasks_.pop_back();
+    } else {
+      *out = std::move(queue.tasks_.front());
+      queue.tasks_.pop_front();
+    }
+    --state->num_queued_tasks_;
+    return true;
+  }
+  return false;
+}
+
+static void WorkStealingWorkerLoop(std::shared_ptr<ThreadPool::State> state,
+                                   std::list<std::thread>::iterator it,
+                                   size_t own_queue) {
+  current_worker_state = state.get();
+  current_worker_queue = own_queue;
+
+  std::unique_lock<std::mutex> lock(state->mutex_);
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+
+  const auto should_secede = [&]() -> bool {
+    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
+  };
+
+  while (true) {
+    // Run tasks without holding the mutex until none can be found
+    lock.unlock();
+    std::function<void()> task;
+    while (!state->quick_shutdown_ && !state->capacity_decreased_ &&
+           TakeQueuedTask(state.get(), own_queue, &task)) {
+      task();
+      task = nullptr;
+    }
+    lock.lock();
+
+    if (state->quick_shutdown_ || should_secede()) {
+      break;
+    }
+    // No more surplus workers
+    state->capacity_decreased_ = false;
+    if (state->num_queued_tasks_ > 0) {
+      continue;
+    }
+    if (state->please_shutdown_) {
+      break;
+    }
+    // Spawners only notify cv_ if they see an idle worker, so announce
+    // ourselves before checking for tasks a last time
+    ++state->num_idle_workers_;
+    if (state->num_queued_tasks_ == 0) {
+      state->cv_.wait(lock);
+    }
+    --state->num_idle_workers_;
+  }
+
+  current_worker_state = nullptr;
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  state->finished_workers_.push_back(std::move(*it));
+  state->workers_.erase(it);
+  if (state->please_shutdown_) {
+    state->cv_shutdown_.notify_one();
+  }
+}
+
 ThreadPool::ThreadPool()
     : sp_state_(std::make_shared<ThreadPool::State>()),
       state_(sp_state_.get()),
@@ -139,8 +306,9 @@ void ThreadPool::ProtectAgainstFork() {
     int capacity = state_->desired_capacity_;
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
+    new_state->quick_shutdown_ = state_->quick_shutdown_.load();
+    new_state->MakeWorkerQueues(state_->worker_queues_.size());
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -171,6 +339,7 @@ Status ThreadPool::SetCapacity(int threads) {
     LaunchWorkersUnlocked(diff);
   } else if (diff < 0) {
     // Wake threads to ask them to stop
+    state_->capacity_decreased_ = true;
     state_->cv_.notify_all();
   }
   return Status::OK();
@@ -197,6 +366,12 @@ Status ThreadPool::Shutdown(bool wait) {
   }
   state_->please_shutdown_ = true;
   state_->quick_shutdown_ = !wait;
+  // Work-stealing spawners check please_shutdown_ under a queue lock: once
+  // every queue lock was taken, the tasks they accepted are all queued and
+  // counted, and the workers run them before exiting
+  for (auto& queue : state_->worker_queues_) {
+    std::lock_guard<std::mutex> queue_lock(queue->mutex_);
+  }
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
@@ -204,6 +379,12 @@ Status ThreadPool::Shutdown(bool wait) {
   } else {
     state_->pending_tasks_.clear();
   }
+  // Tasks may be left in work-stealing queues after a quick shutdown
+  for (auto& queue : state_->worker_queues_) {
+    std::lock_guard<std::mutex> queue_lock(queue->mutex_);
+    state_->num_queued_tasks_ -= static_cast<int64_t>(queue->tasks_.size());
+    queue->tasks_.clear();
+  }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
 }
@@ -222,11 +403,57 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    if (state_->work_stealing()) {
+      size_t own_queue = state_->num_launched_workers_++ % state_->worker_queues_.size();
+      *it = std::thread(
+          [state, it, own_queue] { WorkStealingWorkerLoop(state, it, own_queue); });
+    } else {
+      *it = std::thread([state, it] { WorkerLoop(state, it); });
+    }
+  }
+}
+
+bool ThreadPool::OwnsThisThread() {
+  ProtectAgainstFork();
+  return current_worker_state == state_;
+}
+
+bool ThreadPool::RunPendingTask() {
+  ProtectAgainstFork();
+  std::function<void()> task;
+  if (state_->work_stealing()) {
+    // A worker takes the latest task of its own queue first, which is likely
+    // one it has just spawned
+    const size_t own_queue = current_worker_state == state_ ? current_worker_queue : 0;
+    if (state_->quick_shutdown_ || !TakeQueuedTask(state_, own_queue, &task)) {
+      return false;
+    }
+  } else {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (state_->pending_tasks_.empty() || state_->quick_shutdown_) {
+      return false;
+    }
+    task = state_->pending_tasks_.Pop();
   }
+  task();
+  return true;
 }
 
-Status ThreadPool::SpawnReal(std::function<void()> task) {
+Status ThreadPool::SpawnReal(TaskHints hints, std::function<void()> task) {
+#ifdef ARROW_WITH_TRACING
+  // Attribute the spans of the task to the task spawning it
+  const int64_t trace_task_id = ::arrow::util::tracing::CurrentTaskId();
+  if (trace_task_id != 0) {
+    std::function<void()> inner = std::move(task);
+    task = [trace_task_id, inner]() {
+      ARROW_TRACE_TASK(trace_task_id);
+      inner();
+    };
+  }
+#endif
+  if (state_->work_stealing()) {
+    return SpawnWorkStealing(std::move(task));
+  }
   {
     ProtectAgainstFork();
     std::lock_guard<std::mutex> lock(state_->mutex_);
@@ -234,18 +461,53 @@ Status ThreadPool::SpawnReal(std::function<void()> task) {
       return Status::Invalid("operation forbidden during or after shutdown");
     }
     CollectFinishedWorkersUnlocked();
-    state_->pending_tasks_.push_back(std::move(task));
+    state_->pending_tasks_.Push(hints.priority, std::move(task));
   }
   state_->cv_.notify_one();
   return Status::OK();
 }
 
+Status ThreadPool::SpawnWorkStealing(std::function<void()> task) {
+  ProtectAgainstFork();
+  // Tasks spawned by a worker go to its own queue, other tasks are
+  // distributed round-robin
+  const auto& queues = state_->worker_queues_;
+  size_t index = current_worker_state == state_
+                     ? current_worker_queue
+                     : state_->next_queue_++ % queues.size();
+  {
+    // Check for shutdown under the queue lock, so that Shutdown() cannot miss
+    // a task accepted here
+    std::lock_guard<std::mutex> lock(queues[index]->mutex_);
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    queues[index]->tasks_.push_back(std::move(task));
+    ++state_->num_queued_tasks_;
+  }
+  if (state_->num_idle_workers_ > 0) {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    state_->cv_.notify_one();
+  }
+  return Status::OK();
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
   auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
   RETURN_NOT_OK(pool->SetCapacity(threads));
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeWorkStealing(int threads) {
+  if (threads <= 0) {
+    return Status::Invalid("ThreadPool capacity must be > 0");
+  }
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  pool->state_->MakeWorkerQueues(static_cast<size_t>(threads));
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
   // On Windows, the ThreadPool destructor may be called after non-main threads
@@ -21,6 +21,7 @@
 #include <unistd.h>
 #endif
 
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <memory>
@@ -60,6 +61,8 @@ ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
 namespace internal {
 
+class ThreadPool;
+
 namespace detail {
 
 // Make sure that both functions returning T and Result<T> can be called
@@ -74,13 +77,40 @@ struct ThreadPoolResultTraits<Result<T>> {
   using ValueType = T;
 };
 
+template <typename T>
+struct TransferCallback {
+  template <typename Outcome>
+  void operator()(const Outcome& outcome);
+
+  ThreadPool* pool;
+  Future<T> transferred;
+};
+
 }  // namespace detail
 
+// Scheduling hints given when spawning a task.
+struct TaskHints {
+  // Pending tasks with a higher priority are started before pending tasks with
+  // a lower priority, tasks of equal priority in the order they were spawned.
+  // Running tasks are not interrupted, so latency-sensitive work spawned with a
+  // high priority overtakes bulk work at task boundaries.  Only honored by
+  // pools created by Make() and MakeEternal(), e.g. the CPU thread pool.
+  int32_t priority = 0;
+};
+
 class ARROW_EXPORT ThreadPool {
  public:
   // Construct a thread pool with the given number of worker threads
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
 
+  // Like Make(), but the returned ThreadPool schedules tasks by work stealing:
+  // each worker has its own queue, in which the tasks it spawns are pushed and
+  // run last-in first-out.  Idle workers steal the oldest tasks of other
+  // queues, and tasks spawned outside of the pool are distributed round-robin.
+  // This avoids contending on a single queue when tasks are small and spawn
+  // further tasks, at the expense of FIFO ordering.
+  static Result<std::shared_ptr<ThreadPool>> MakeWorkStealing(int threads);
+
   // Like Make(), but takes care that the returned ThreadPool is compatible
   // with destruction late at process exit.
   static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
@@ -109,10 +139,25 @@ class ARROW_EXPORT ThreadPool {
   // tasks are finished.
   Status Shutdown(bool wait = true);
 
+  // Whether the calling thread is one of this pool's workers.
+  bool OwnsThisThread();
+
+  // Run one pending task on the calling thread, if any, and return whether a
+  // task was run.  A worker which must wait for tasks it spawned can run them
+  // (or other pending tasks) this way, rather than blocking while the pool may
+  // have no other worker to spare; see TaskGroup::Finish().
+  bool RunPendingTask();
+
   // Spawn a fire-and-forget task on one of the workers.
   template <typename Function>
   Status Spawn(Function&& func) {
-    return SpawnReal(std::forward<Function>(func));
+    return SpawnReal(TaskHints{}, std::forward<Function>(func));
+  }
+
+  // Spawn a fire-and-forget task with the given scheduling hints.
+  template <typename Function>
+  Status Spawn(TaskHints hints, Function&& func) {
+    return SpawnReal(hints, std::forward<Function>(func));
   }
 
   // Submit a callable and arguments for execution.  Return a future that
@@ -135,7 +180,7 @@ class ARROW_EXPORT ThreadPool {
       void operator()() { future.ExecuteAndMarkFinished(std::move(bound_func)); }
     };
     auto future = Future<ValueType>::Make();
-    ARROW_RETURN_NOT_OK(SpawnReal(Task{std::move(bound_func), future}));
+    ARROW_RETURN_NOT_OK(SpawnReal(TaskHints{}, Task{std::move(bound_func), future}));
     return future;
   }
 
@@ -152,10 +197,24 @@ class ARROW_EXPORT ThreadPool {
     return future;
   }
 
+  // Return a Future which completes with the same outcome as `future`, but
+  // from one of the workers.  Callbacks and continuations added to the
+  // returned Future therefore run on this pool rather than in the thread
+  // that completed `future`.  If the transfer cannot be spawned (e.g. the
+  // pool is shut down), the returned Future fails with the spawn error.
+  // The outcome of `future` is copied.
+  template <typename T>
+  Future<T> Transfer(Future<T> future) {
+    auto transferred = Future<T>::Make();
+    future.AddCallback(detail::TransferCallback<T>{this, transferred});
+    return transferred;
+  }
+
   struct State;
 
  protected:
   FRIEND_TEST(TestThreadPool, SetCapacity);
+  FRIEND_TEST(TestWorkStealingThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
@@ -163,7 +222,8 @@ class ARROW_EXPORT ThreadPool {
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
-  Status SpawnReal(std::function<void()> task);
+  Status SpawnReal(TaskHints hints, std::function<void()> task);
+  Status SpawnWorkStealing(std::function<void()> task);
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
   // Launch a given number of additional workers
@@ -183,6 +243,23 @@ class ARROW_EXPORT ThreadPool {
 #endif
 };
 
+namespace detail {
+
+template <typename T>
+template <typename Outcome>
+void TransferCallback<T>::operator()(const Outcome& outcome) {
+  auto transferred = this->transferred;
+  Outcome outcome_copy = outcome;
+  Status st = pool->Spawn([transferred, outcome_copy]() mutable {
+    transferred.MarkFinished(std::move(outcome_copy));
+  });
+  if (!st.ok()) {
+    this->transferred.MarkFinished(std::move(st));
+  }
+}
+
+}  // namespace detail
+
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
@@ -18,6 +18,7 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
@@ -25,6 +26,7 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "arrow/status.h"
@@ -73,7 +75,10 @@ struct Task {
   Workload workload_;
 };
 
+using ThreadPoolFactory = Result<std::shared_ptr<ThreadPool>> (*)(int);
+
 // Benchmark ThreadPool::Spawn
+template <ThreadPoolFactory MakePool>
 static void ThreadPoolSpawn(benchmark::State& state) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
@@ -86,7 +91,7 @@ static void ThreadPoolSpawn(benchmark::State& state) {
   for (auto _ : state) {
     state.PauseTiming();
     std::shared_ptr<ThreadPool> pool;
-    pool = *ThreadPool::Make(nthreads);
+    pool = *MakePool(nthreads);
     state.ResumeTiming();
 
     for (int32_t i = 0; i < nspawns; ++i) {
@@ -103,6 +108,47 @@ static void ThreadPoolSpawn(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark ThreadPool::Spawn from within the pool's tasks: each of nthreads
+// root tasks spawns a share of the tasks, as when a scan fans out into
+// per-batch tasks
+template <ThreadPoolFactory MakePool>
+static void ThreadPoolNestedSpawn(benchmark::State& state) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  const int32_t nspawns = 200000000 / workload_size + 1;
+  const int32_t nspawns_per_root = nspawns / nthreads + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<ThreadPool> pool;
+    pool = *MakePool(nthreads);
+    std::atomic<int> roots_done(0);
+    state.ResumeTiming();
+
+    for (int i = 0; i < nthreads; ++i) {
+      ABORT_NOT_OK(pool->Spawn([&] {
+        for (int32_t j = 0; j < nspawns_per_root; ++j) {
+          ABORT_NOT_OK(pool->Spawn(std::ref(workload)));
+        }
+        ++roots_done;
+      }));
+    }
+
+    // Tasks can't be spawned after Shutdown() was called
+    while (roots_done.load() < nthreads) {
+      std::this_thread::yield();
+    }
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nspawns_per_root * nthreads);
+}
+
 // Benchmark serial TaskGroup
 static void SerialTaskGroup(benchmark::State& state) {
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -123,12 +169,13 @@ static void SerialTaskGroup(benchmark::State& state) {
 }
 
 // Benchmark threaded TaskGroup
+template <ThreadPoolFactory MakePool>
 static void ThreadedTaskGroup(benchmark::State& state) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
 
   std::shared_ptr<ThreadPool> pool;
-  pool = *ThreadPool::Make(nthreads);
+  pool = *MakePool(nthreads);
 
   Task task(workload_size);
 
@@ -188,8 +235,17 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 #endif
 
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
-BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
-BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_TEMPLATE(ThreadPoolSpawn, ThreadPool::Make)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_TEMPLATE(ThreadPoolSpawn, ThreadPool::MakeWorkStealing)
+    ->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_TEMPLATE(ThreadPoolNestedSpawn, ThreadPool::Make)
+    ->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_TEMPLATE(ThreadPoolNestedSpawn, ThreadPool::MakeWorkStealing)
+    ->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_TEMPLATE(ThreadedTaskGroup, ThreadPool::Make)
+    ->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_TEMPLATE(ThreadedTaskGroup, ThreadPool::MakeWorkStealing)
+    ->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
 }  // namespace arrow
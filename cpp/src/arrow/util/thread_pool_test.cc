@@ -21,12 +21,14 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -135,7 +137,7 @@ class TestThreadPool : public ::testing::Test {
 
   std::shared_ptr<ThreadPool> MakeThreadPool() { return MakeThreadPool(4); }
 
-  std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
+  virtual std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
     return *ThreadPool::Make(threads);
   }
 
@@ -165,6 +167,31 @@ class TestThreadPool : public ::testing::Test {
       add_tester.CheckResults();
     }
   }
+
+  void CheckRunPendingTask() {
+    auto pool = this->MakeThreadPool(1);
+    ASSERT_FALSE(pool->OwnsThisThread());
+    ASSERT_FALSE(pool->RunPendingTask());
+
+    // Keep the only worker busy, so that the next task stays pending
+    std::atomic<bool> started(false), release(false);
+    ASSERT_OK(pool->Spawn([&] {
+      started = true;
+      busy_wait(5, [&] { return release.load(); });
+    }));
+    busy_wait(5, [&] { return started.load(); });
+    int x = 0;
+    ASSERT_OK(pool->Spawn([&] { x = 42; }));
+    ASSERT_TRUE(pool->RunPendingTask());
+    ASSERT_EQ(x, 42);
+    ASSERT_FALSE(pool->RunPendingTask());
+    release = true;
+
+    ASSERT_OK_AND_ASSIGN(auto owns,
+                         pool->Submit([&] { return pool->OwnsThisThread(); }));
+    ASSERT_OK_AND_EQ(true, owns.result());
+    ASSERT_OK(pool->Shutdown());
+  }
 };
 
 TEST_F(TestThreadPool, ConstructDestruct) {
@@ -295,6 +322,38 @@ TEST_F(TestThreadPool, Submit) {
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
       defined(THREAD_SANITIZER))
+TEST_F(TestThreadPool, RunPendingTask) { CheckRunPendingTask(); }
+
+TEST_F(TestThreadPool, Priorities) {
+  auto pool = this->MakeThreadPool(1);
+
+  // Keep the only worker busy while the tasks are queued
+  std::atomic<bool> release(false);
+  ASSERT_OK(pool->Spawn([&] { busy_wait(5, [&] { return release.load(); }); }));
+
+  std::mutex mutex;
+  std::vector<int> order;
+  auto spawn = [&](int32_t priority, int id) {
+    TaskHints hints;
+    hints.priority = priority;
+    ASSERT_OK(pool->Spawn(hints, [&, id] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(id);
+    }));
+  };
+  spawn(0, 1);
+  spawn(5, 2);
+  spawn(0, 3);
+  spawn(-1, 4);
+  spawn(5, 5);
+  spawn(1, 6);
+  release = true;
+  ASSERT_OK(pool->Shutdown());
+
+  // By decreasing priority, then in spawn order
+  ASSERT_EQ(order, std::vector<int>({2, 5, 6, 1, 3, 4}));
+}
+
 TEST_F(TestThreadPool, ForkSafety) {
   pid_t child_pid;
   int child_status;
@@ -351,6 +410,120 @@ TEST_F(TestThreadPool, ForkSafety) {
 }
 #endif
 
+// Work-stealing scheduling
+
+class TestWorkStealingThreadPool : public TestThreadPool {
+ public:
+  std::shared_ptr<ThreadPool> MakeThreadPool(int threads) override {
+    return *ThreadPool::MakeWorkStealing(threads);
+  }
+};
+
+TEST_F(TestWorkStealingThreadPool, ConstructDestruct) {
+  for (int threads : {1, 2, 3, 8, 32, 70}) {
+    auto pool = this->MakeThreadPool(threads);
+  }
+  ASSERT_RAISES(Invalid, ThreadPool::MakeWorkStealing(0));
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawn) {
+  auto pool = this->MakeThreadPool(30);
+  SpawnAdds(pool.get(), 1000, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawnSlowThreaded) {
+  auto pool = this->MakeThreadPool(30);
+  SpawnAddsThreaded(pool.get(), 20, 100, [](int x, int y, int* out) {
+    return task_slow_add(0.002 /* seconds */, x, y, out);
+  });
+}
+
+TEST_F(TestWorkStealingThreadPool, NestedSpawn) {
+  // Tasks spawned from a worker are queued locally, the other workers must
+  // steal them
+  auto pool = this->MakeThreadPool(4);
+  constexpr int kFanOut = 200;
+  std::atomic<int> count(0);
+  ASSERT_OK(pool->Spawn([&] {
+    for (int i = 0; i < kFanOut; ++i) {
+      ASSERT_OK(pool->Spawn([&] {
+        SleepFor(0.001);
+        ++count;
+      }));
+    }
+  }));
+  busy_wait(5, [&] { return count == kFanOut; });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(count, kFanOut);
+}
+
+TEST_F(TestWorkStealingThreadPool, RunPendingTask) { CheckRunPendingTask(); }
+
+TEST_F(TestWorkStealingThreadPool, SpawnDuringShutdown) {
+  // Every task accepted while the pool shuts down must run
+  for (int repeat = 0; repeat < 20; ++repeat) {
+    auto pool = this->MakeThreadPool(4);
+    std::atomic<int> accepted(0), run(0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+      threads.emplace_back([&] {
+        while (pool->Spawn([&] { ++run; }).ok()) {
+          ++accepted;
+        }
+      });
+    }
+    busy_wait(5, [&] { return accepted > 100; });
+    ASSERT_OK(pool->Shutdown());
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(run, accepted);
+  }
+}
+
+TEST_F(TestWorkStealingThreadPool, QuickShutdown) {
+  AddTester add_tester(100);
+  {
+    auto pool = this->MakeThreadPool(3);
+    add_tester.SpawnTasks(pool.get(), [](int x, int y, int* out) {
+      return task_slow_add(0.02 /* seconds */, x, y, out);
+    });
+    ASSERT_OK(pool->Shutdown(false /* wait */));
+    add_tester.CheckNotAllComputed();
+  }
+  add_tester.CheckNotAllComputed();
+}
+
+TEST_F(TestWorkStealingThreadPool, SetCapacity) {
+  auto pool = this->MakeThreadPool(3);
+  ASSERT_OK(pool->SetCapacity(5));
+  ASSERT_EQ(pool->GetCapacity(), 5);
+  ASSERT_EQ(pool->GetActualCapacity(), 5);
+
+  // Downsize while tasks are pending
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(pool->Spawn(std::bind(SleepFor, 0.01 /* seconds */)));
+  }
+  ASSERT_OK(pool->SetCapacity(2));
+  ASSERT_EQ(pool->GetCapacity(), 2);
+  busy_wait(0.5, [&] { return pool->GetActualCapacity() == 2; });
+  ASSERT_EQ(pool->GetActualCapacity(), 2);
+
+  // Queues are shared by the workers in excess of the initial capacity
+  ASSERT_OK(pool->SetCapacity(8));
+  SpawnAdds(pool.get(), 1000, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, Submit) {
+  auto pool = this->MakeThreadPool(3);
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(slow_add<int>, 0.01 /* seconds */, 4, 5));
+  ASSERT_OK_AND_EQ(9, fut.result());
+  ASSERT_OK_AND_ASSIGN(auto nested, pool->Submit([&] {
+    return *pool->SubmitAsFuture(add<int>, 1, 2).result();
+  }));
+  ASSERT_OK_AND_EQ(3, nested.result());
+}
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
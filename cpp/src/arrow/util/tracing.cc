@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+
+#include "arrow/util/string.h"
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+namespace {
+
+// The sink is read by every span, but rarely written: a flag tells spans
+// whether to bother taking the lock.
+std::atomic<bool> tracing_enabled{false};
+std::mutex sink_mutex;
+std::shared_ptr<TraceSink> global_sink;
+
+std::atomic<int64_t> next_task_id{1};
+std::atomic<int64_t> next_thread_id{1};
+
+thread_local int64_t current_task_id = 0;
+thread_local int64_t current_thread_id = 0;
+thread_local int32_t current_depth = 0;
+
+int64_t NowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+void SetTraceSink(std::shared_ptr<TraceSink> sink) {
+  std::lock_guard<std::mutex> lock(sink_mutex);
+  tracing_enabled.store(sink != nullptr);
+  global_sink = std::move(sink);
+}
+
+std::shared_ptr<TraceSink> GetTraceSink() {
+  if (!tracing_enabled.load(std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(sink_mutex);
+  return global_sink;
+}
+
+int64_t NewTaskId() { return next_task_id.fetch_add(1); }
+
+int64_t CurrentTaskId() { return current_task_id; }
+
+int64_t CurrentThreadId() {
+  if (current_thread_id == 0) {
+    current_thread_id = next_thread_id.fetch_add(1);
+  }
+  return current_thread_id;
+}
+
+TaskScope::TaskScope(int64_t task_id) : previous_task_id_(current_task_id) {
+  current_task_id = task_id;
+}
+
+TaskScope::~TaskScope() { current_task_id = previous_task_id_; }
+
+ScopedSpan::ScopedSpan(const char* name) : sink_(GetTraceSink()), name_(name) {
+  if (sink_ != nullptr) {
+    ++current_depth;
+    start_ns_ = NowNanos();
+  }
+}
+
+ScopedSpan::~ScopedSpan() {
+  if (sink_ != nullptr) {
+    const int64_t end_ns = NowNanos();
+    --current_depth;
+    sink_->Record(SpanRecord{name_, std::move(detail_), start_ns_, end_ns - start_ns_,
+                             CurrentThreadId(), current_task_id, current_depth});
+  }
+}
+
+void ChromeTraceSink::Record(SpanRecord span) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  spans_.push_back(std::move(span));
+}
+
+std::vector<SpanRecord> ChromeTraceSink::spans() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return spans_;
+}
+
+void ChromeTraceSink::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  spans_.clear();
+}
+
+std::string ChromeTraceSink::ToJSON() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // One "complete" event per span, with times in microseconds
+  std::stringstream ss;
+  ss << "{\"traceEvents\":[";
+  for (size_t i = 0; i < spans_.size(); ++i) {
+    const SpanRecord& span = spans_[i];
+    if (i > 0) {
+      ss << ",";
+    }
+    ss << "{\"name\":\"" << Escape(span.name) << "\",\"cat\":\"arrow\",\"ph\":\"X\""
+       << ",\"ts\":" << span.start_ns / 1000 << "." << span.start_ns % 1000 / 100
+       << ",\"dur\":" << span.duration_ns / 1000 << "." << span.duration_ns % 1000 / 100
+       << ",\"pid\":1,\"tid\":" << span.thread_id << ",\"args\":{\"task\":"
+       << span.task_id;
+    if (!span.detail.empty()) {
+      ss << ",\"detail\":\"" << Escape(span.detail) << "\"";
+    }
+    ss << "}}";
+  }
+  ss << "],\"displayTimeUnit\":\"ns\"}";
+  return ss.str();
+}
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,191 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Lightweight tracing of where time goes in readers, kernels and scans.
+//
+// A span measures the wall time of a scope.  When it ends, it is handed to
+// the TraceSink installed with SetTraceSink(), together with the thread it
+// ran on, the task it belongs to (see TaskScope) and its nesting depth on that
+// thread.  Without a sink, spans are not recorded and cost an atomic load.
+//
+// Arrow's own readers and kernels open spans through the ARROW_TRACE_*
+// macros, which only expand to code when Arrow is built with
+// ARROW_WITH_TRACING=ON, so that default builds pay nothing for them.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+/// \brief A finished span
+///
+/// The fields map onto an OpenTelemetry span (name, start and end time,
+/// attributes) as well as onto a Chrome trace "complete" event.
+struct ARROW_EXPORT SpanRecord {
+  /// Name of the span, such as "csv::ParseBlock".  Must be a string literal.
+  const char* name;
+  /// Optional free-form detail, such as a column or row group
+  std::string detail;
+  /// Start of the span, in nanoseconds since an unspecified steady epoch
+  int64_t start_ns;
+  /// Duration of the span, in nanoseconds
+  int64_t duration_ns;
+  /// Small positive integer identifying the thread the span ran on
+  int64_t thread_id;
+  /// Task the span belongs to, or 0 outside of any task
+  int64_t task_id;
+  /// Number of spans enclosing this one on its thread
+  int32_t depth;
+};
+
+/// \brief Destination of finished spans
+///
+/// Record() is called on the thread that ran the span, possibly from several
+/// threads at once.  Implementations can keep the spans in memory, write them
+/// out or forward them to an OpenTelemetry exporter.
+class ARROW_EXPORT TraceSink {
+ public:
+  virtual ~TraceSink() = default;
+
+  virtual void Record(SpanRecord span) = 0;
+};
+
+/// \brief A TraceSink keeping spans in memory, to be written out in the
+/// Chrome trace event format (chrome://tracing, Perfetto)
+class ARROW_EXPORT ChromeTraceSink : public TraceSink {
+ public:
+  void Record(SpanRecord span) override;
+
+  /// \brief The spans recorded so far, in the order they ended
+  std::vector<SpanRecord> spans() const;
+
+  /// \brief Forget the spans recorded so far
+  void Clear();
+
+  /// \brief The spans recorded so far as a JSON trace
+  std::string ToJSON() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<SpanRecord> spans_;
+};
+
+/// \brief Install the sink receiving the spans of all threads
+///
+/// Pass nullptr to stop tracing.  Spans started before the call are still
+/// handed to the sink that was installed when they started.
+ARROW_EXPORT void SetTraceSink(std::shared_ptr<TraceSink> sink);
+
+/// \brief The sink receiving spans, or nullptr if tracing is off
+ARROW_EXPORT std::shared_ptr<TraceSink> GetTraceSink();
+
+/// \brief Return a new task ID, unique in the process
+ARROW_EXPORT int64_t NewTaskId();
+
+/// \brief The task ID set by the innermost TaskScope of the calling thread,
+/// or 0
+ARROW_EXPORT int64_t CurrentTaskId();
+
+/// \brief The thread ID used in the spans of the calling thread
+ARROW_EXPORT int64_t CurrentThreadId();
+
+/// \brief Attribute the spans of the calling thread to a task, for the
+/// duration of a scope
+///
+/// Use it at the start of work items submitted to a thread pool, so that the
+/// spans of one logical task can be grouped across threads.
+class ARROW_EXPORT TaskScope {
+ public:
+  explicit TaskScope(int64_t task_id);
+  ~TaskScope();
+
+ private:
+  int64_t previous_task_id_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TaskScope);
+};
+
+/// \brief Measure the wall time of a scope
+class ARROW_EXPORT ScopedSpan {
+ public:
+  /// \param[in] name the name of the span, must be a string literal
+  explicit ScopedSpan(const char* name);
+  ~ScopedSpan();
+
+  /// \brief Whether the span is recorded
+  ///
+  /// Details are costly to format; only set them on active spans.
+  bool active() const { return sink_ != NULLPTR; }
+
+  void set_detail(std::string detail) { detail_ = std::move(detail); }
+
+ private:
+  std::shared_ptr<TraceSink> sink_;
+  const char* name_;
+  std::string detail_;
+  int64_t start_ns_ = 0;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScopedSpan);
+};
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
+
+#define ARROW_TRACE_SPAN_VAR(line) ARROW_CONCAT(arrow_trace_span_, line)
+#define ARROW_TRACE_TASK_VAR(line) ARROW_CONCAT(arrow_trace_task_, line)
+
+#ifdef ARROW_WITH_TRACING
+
+/// \brief Open a span lasting until the end of the enclosing scope
+#define ARROW_TRACE_SPAN(name) \
+  ::arrow::util::tracing::ScopedSpan ARROW_TRACE_SPAN_VAR(__LINE__)(name)
+
+/// \brief Open a span with a detail, only evaluated if the span is recorded
+#define ARROW_TRACE_SPAN_DETAIL(name, detail)  \
+  ARROW_TRACE_SPAN(name);                      \
+  if (ARROW_TRACE_SPAN_VAR(__LINE__).active()) \
+  ARROW_TRACE_SPAN_VAR(__LINE__).set_detail((detail))
+
+/// \brief Attribute the spans of the enclosing scope to a task
+#define ARROW_TRACE_TASK(task_id) \
+  ::arrow::util::tracing::TaskScope ARROW_TRACE_TASK_VAR(__LINE__)(task_id)
+
+#else
+
+#define ARROW_TRACE_SPAN(name) \
+  do {                         \
+  } while (false)
+#define ARROW_TRACE_SPAN_DETAIL(name, detail) \
+  do {                                        \
+  } while (false)
+#define ARROW_TRACE_TASK(task_id) \
+  do {                            \
+  } while (false)
+
+#endif  // ARROW_WITH_TRACING
@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+class TestTracing : public ::testing::Test {
+ public:
+  void SetUp() override {
+    sink_ = std::make_shared<ChromeTraceSink>();
+    SetTraceSink(sink_);
+  }
+
+  void TearDown() override { SetTraceSink(nullptr); }
+
+ protected:
+  std::shared_ptr<ChromeTraceSink> sink_;
+};
+
+TEST_F(TestTracing, NoSink) {
+  SetTraceSink(nullptr);
+  ASSERT_EQ(GetTraceSink(), nullptr);
+  {
+    ScopedSpan span("test::Span");
+    ASSERT_FALSE(span.active());
+  }
+  ASSERT_EQ(sink_->spans().size(), 0);
+}
+
+TEST_F(TestTracing, NestedSpans) {
+  {
+    ScopedSpan outer("test::Outer");
+    ASSERT_TRUE(outer.active());
+    {
+      ScopedSpan inner("test::Inner");
+      inner.set_detail("column 3");
+    }
+  }
+  auto spans = sink_->spans();
+  ASSERT_EQ(spans.size(), 2);
+  ASSERT_EQ(std::string(spans[0].name), "test::Inner");
+  ASSERT_EQ(spans[0].detail, "column 3");
+  ASSERT_EQ(spans[0].depth, 1);
+  ASSERT_EQ(std::string(spans[1].name), "test::Outer");
+  ASSERT_EQ(spans[1].detail, "");
+  ASSERT_EQ(spans[1].depth, 0);
+
+  // The inner span lies within the outer one
+  ASSERT_GE(spans[0].start_ns, spans[1].start_ns);
+  ASSERT_LE(spans[0].start_ns + spans[0].duration_ns,
+            spans[1].start_ns + spans[1].duration_ns);
+  ASSERT_EQ(spans[0].thread_id, CurrentThreadId());
+  ASSERT_EQ(spans[1].thread_id, CurrentThreadId());
+}
+
+TEST_F(TestTracing, Tasks) {
+  const int64_t task_id = NewTaskId();
+  ASSERT_NE(task_id, 0);
+  ASSERT_NE(NewTaskId(), task_id);
+  ASSERT_EQ(CurrentTaskId(), 0);
+  {
+    TaskScope task(task_id);
+    ASSERT_EQ(CurrentTaskId(), task_id);
+    ScopedSpan span("test::InTask");
+  }
+  ASSERT_EQ(CurrentTaskId(), 0);
+  { ScopedSpan span("test::OutOfTask"); }
+
+  auto spans = sink_->spans();
+  ASSERT_EQ(spans.size(), 2);
+  ASSERT_EQ(spans[0].task_id, task_id);
+  ASSERT_EQ(spans[1].task_id, 0);
+}
+
+TEST_F(TestTracing, Threads) {
+  const int kNumThreads = 4;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([] { ScopedSpan span("test::Thread"); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto spans = sink_->spans();
+  ASSERT_EQ(spans.size(), kNumThreads);
+  for (int i = 0; i < kNumThreads; ++i) {
+    ASSERT_GT(spans[i].thread_id, 0);
+    ASSERT_NE(spans[i].thread_id, CurrentThreadId());
+    for (int j = 0; j < i; ++j) {
+      ASSERT_NE(spans[i].thread_id, spans[j].thread_id);
+    }
+  }
+}
+
+TEST_F(TestTracing, ChromeTraceJSON) {
+  ASSERT_EQ(sink_->ToJSON(), "{\"traceEvents\":[],\"displayTimeUnit\":\"ns\"}");
+
+  sink_->Record(SpanRecord{"test::Span", "file \"a\"", 1234567, 2500, 3, 7, 0});
+  sink_->Record(SpanRecord{"test::Other", "", 2000000, 100, 4, 0, 1});
+  ASSERT_EQ(sink_->ToJSON(),
+            "{\"traceEvents\":["
+            "{\"name\":\"test::Span\",\"cat\":\"arrow\",\"ph\":\"X\",\"ts\":1234.5,"
+            "\"dur\":2.5,\"pid\":1,\"tid\":3,\"args\":{\"task\":7,"
+            "\"detail\":\"file \\\"a\\\"\"}},"
+            "{\"name\":\"test::Other\",\"cat\":\"arrow\",\"ph\":\"X\",\"ts\":2000.0,"
+            "\"dur\":0.1,\"pid\":1,\"tid\":4,\"args\":{\"task\":0}}"
+            "],\"displayTimeUnit\":\"ns\"}");
+
+  sink_->Clear();
+  ASSERT_EQ(sink_->spans().size(), 0);
+}
+
+#ifdef ARROW_WITH_TRACING
+TEST_F(TestTracing, Macros) {
+  {
+    ARROW_TRACE_TASK(42);
+    ARROW_TRACE_SPAN("test::Macro");
+    ARROW_TRACE_SPAN_DETAIL("test::MacroDetail", std::to_string(5));
+  }
+  auto spans = sink_->spans();
+  ASSERT_EQ(spans.size(), 2);
+  ASSERT_EQ(std::string(spans[0].name), "test::MacroDetail");
+  ASSERT_EQ(spans[0].detail, "5");
+  ASSERT_EQ(spans[0].task_id, 42);
+  ASSERT_EQ(std::string(spans[1].name), "test::Macro");
+}
+
+TEST_F(TestTracing, ThreadPoolInheritsTask) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ::arrow::internal::ThreadPool::Make(2));
+  const int64_t task_id = NewTaskId();
+  Future<int64_t> fut;
+  {
+    TaskScope task(task_id);
+    ASSERT_OK_AND_ASSIGN(fut, pool->Submit(CurrentTaskId));
+  }
+  ASSERT_OK_AND_ASSIGN(auto pool_task_id, fut.result());
+  ASSERT_EQ(pool_task_id, task_id);
+}
+#endif
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
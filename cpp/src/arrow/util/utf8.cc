@@ -16,14 +16,19 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <mutex>
 #include <stdexcept>
 #include <utility>
 
 #include "arrow/result.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/neon_util.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/util/utf8.h"
+#include "arrow/util/utf8_internal.h"
 #include "arrow/vendored/utf8cpp/checked.h"
 
 namespace arrow {
@@ -75,6 +80,175 @@ ARROW_EXPORT void CheckUTF8Initialized() {
       << "InitializeUTF8() must be called before calling UTF8 routines";
 }
 
+// See utf8_internal.h for a description of the algorithm
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+namespace {
+
+class UTF8ValidatorSse42 {
+ public:
+  UTF8ValidatorSse42()
+      : byte_1_high_(Load(kUTF8Byte1High)),
+        byte_1_low_(Load(kUTF8Byte1Low)),
+        byte_2_high_(Load(kUTF8Byte2High)),
+        max_value_(_mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                 static_cast<char>(kUTF8MaxLast3[0]),
+                                 static_cast<char>(kUTF8MaxLast3[1]),
+                                 static_cast<char>(kUTF8MaxLast3[2]))),
+        error_(_mm_setzero_si128()),
+        prev_input_(_mm_setzero_si128()),
+        prev_incomplete_(_mm_setzero_si128()) {}
+
+  static __m128i Load(const uint8_t* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  }
+
+  void CheckBlock(__m128i input) {
+    if (_mm_movemask_epi8(input) == 0) {
+      // All ASCII: only a character truncated by the previous block is an error
+      error_ = _mm_or_si128(error_, prev_incomplete_);
+      prev_incomplete_ = _mm_setzero_si128();
+    } else {
+      const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+      const __m128i prev1 = _mm_alignr_epi8(input, prev_input_, 15);
+      const __m128i prev2 = _mm_alignr_epi8(input, prev_input_, 14);
+      const __m128i prev3 = _mm_alignr_epi8(input, prev_input_, 13);
+      const __m128i prev1_high = _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask);
+      const __m128i prev1_low = _mm_and_si128(prev1, nibble_mask);
+      const __m128i input_high = _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask);
+      const __m128i special =
+          _mm_and_si128(_mm_and_si128(_mm_shuffle_epi8(byte_1_high_, prev1_high),
+                                      _mm_shuffle_epi8(byte_1_low_, prev1_low)),
+                        _mm_shuffle_epi8(byte_2_high_, input_high));
+      // Only 111_____ and 1111____ respectively end up >= 0x80
+      const __m128i must_be_continuation =
+          _mm_and_si128(_mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0x60)),
+                                     _mm_subs_epu8(prev3, _mm_set1_epi8(0x70))),
+                        _mm_set1_epi8(static_cast<char>(0x80)));
+      error_ = _mm_or_si128(error_, _mm_xor_si128(must_be_continuation, special));
+      prev_incomplete_ = _mm_subs_epu8(input, max_value_);
+    }
+    prev_input_ = input;
+  }
+
+  bool Validate(const uint8_t* data, int64_t size) {
+    for (; size >= 16; data += 16, size -= 16) {
+      CheckBlock(Load(data));
+    }
+    if (size > 0) {
+      // Pad the tail with ASCII zeros
+      alignas(16) uint8_t tail[16] = {0};
+      memcpy(tail, data, static_cast<size_t>(size));
+      CheckBlock(Load(tail));
+    }
+    error_ = _mm_or_si128(error_, prev_incomplete_);
+    return _mm_testz_si128(error_, error_) != 0;
+  }
+
+ private:
+  const __m128i byte_1_high_, byte_1_low_, byte_2_high_, max_value_;
+  __m128i error_, prev_input_, prev_incomplete_;
+};
+
+}  // namespace
+
+bool ValidateUTF8Sse42(const uint8_t* data, int64_t size) {
+  return UTF8ValidatorSse42().Validate(data, size);
+}
+
+#endif  // ARROW_HAVE_SSE4_2
+
+#if defined(ARROW_HAVE_NEON)
+
+namespace {
+
+class UTF8ValidatorNeon {
+ public:
+  UTF8ValidatorNeon()
+      : byte_1_high_(vld1q_u8(kUTF8Byte1High)),
+        byte_1_low_(vld1q_u8(kUTF8Byte1Low)),
+        byte_2_high_(vld1q_u8(kUTF8Byte2High)),
+        error_(vdupq_n_u8(0)),
+        prev_input_(vdupq_n_u8(0)),
+        prev_incomplete_(vdupq_n_u8(0)) {
+    uint8_t max_value[16];
+    memset(max_value, 0xff, 13);
+    memcpy(max_value + 13, kUTF8MaxLast3, 3);
+    max_value_ = vld1q_u8(max_value);
+  }
+
+  void CheckBlock(uint8x16_t input) {
+    if (vmaxvq_u8(input) < 0x80) {
+      // All ASCII: only a character truncated by the previous block is an error
+      error_ = vorrq_u8(error_, prev_incomplete_);
+      prev_incomplete_ = vdupq_n_u8(0);
+    } else {
+      const uint8x16_t prev1 = vextq_u8(prev_input_, input, 15);
+      const uint8x16_t prev2 = vextq_u8(prev_input_, input, 14);
+      const uint8x16_t prev3 = vextq_u8(prev_input_, input, 13);
+      const uint8x16_t special =
+          vandq_u8(vandq_u8(vqtbl1q_u8(byte_1_high_, vshrq_n_u8(prev1, 4)),
+                            vqtbl1q_u8(byte_1_low_, vandq_u8(prev1, vdupq_n_u8(0x0f)))),
+                   vqtbl1q_u8(byte_2_high_, vshrq_n_u8(input, 4)));
+      // Only 111_____ and 1111____ respectively end up >= 0x80
+      const uint8x16_t must_be_continuation =
+          vandq_u8(vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0x60)),
+                            vqsubq_u8(prev3, vdupq_n_u8(0x70))),
+                   vdupq_n_u8(0x80));
+      error_ = vorrq_u8(error_, veorq_u8(must_be_continuation, special));
+      prev_incomplete_ = vqsubq_u8(input, max_value_);
+    }
+    prev_input_ = input;
+  }
+
+  bool Validate(const uint8_t* data, int64_t size) {
+    for (; size >= 16; data += 16, size -= 16) {
+      CheckBlock(vld1q_u8(data));
+    }
+    if (size > 0) {
+      // Pad the tail with ASCII zeros
+      uint8_t tail[16] = {0};
+      memcpy(tail, data, static_cast<size_t>(size));
+      CheckBlock(vld1q_u8(tail));
+    }
+    error_ = vorrq_u8(error_, prev_incomplete_);
+    return vmaxvq_u8(error_) == 0;
+  }
+
+ private:
+  const uint8x16_t byte_1_high_, byte_1_low_, byte_2_high_;
+  uint8x16_t max_value_, error_, prev_input_, prev_incomplete_;
+};
+
+}  // namespace
+
+bool ValidateUTF8Neon(const uint8_t* data, int64_t size) {
+  return UTF8ValidatorNeon().Validate(data, size);
+}
+
+#endif  // ARROW_HAVE_NEON
+
+bool ValidateUTF8Simd(const uint8_t* data, int64_t size) {
+  using ValidateFunc = bool (*)(const uint8_t*, int64_t);
+  static const ValidateFunc validate = []() -> ValidateFunc {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+    if (::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+            ::arrow::internal::CpuInfo::AVX2)) {
+      return &ValidateUTF8Avx2;
+    }
+#endif
+#if defined(ARROW_HAVE_SSE4_2)
+    return &ValidateUTF8Sse42;
+#elif defined(ARROW_HAVE_NEON)
+    return &ValidateUTF8Neon;
+#else
+    return &ValidateUTF8Scalar;
+#endif
+  }();
+  return validate(data, size);
+}
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
@@ -79,12 +79,22 @@ static inline uint16_t ValidateOneUTF8Byte(uint8_t byte, uint16_t state) {
 
 ARROW_EXPORT void CheckUTF8Initialized();
 
+// Inputs at least this large are validated with SIMD instructions, when
+// available
+static constexpr int64_t kUTF8SimdMinSize = 64;
+
+// Validate UTF8 with the widest SIMD instruction set supported by the
+// running CPU, or with ValidateUTF8Scalar() if there is none
+ARROW_EXPORT bool ValidateUTF8Simd(const uint8_t* data, int64_t size);
+
 }  // namespace internal
 
 // This function needs to be called before doing UTF8 validation.
 ARROW_EXPORT void InitializeUTF8();
 
-inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+namespace internal {
+
+inline bool ValidateUTF8Scalar(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   // For some reason, defining this variable outside the loop helps clang
   uint64_t mask;
@@ -164,6 +174,15 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   return ARROW_PREDICT_TRUE(state == internal::kUTF8ValidateAccept);
 }
 
+}  // namespace internal
+
+inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+  if (size >= internal::kUTF8SimdMinSize) {
+    return internal::ValidateUTF8Simd(data, size);
+  }
+  return internal::ValidateUTF8Scalar(data, size);
+}
+
 inline bool ValidateUTF8(const util::string_view& str) {
   const uint8_t* data = reinterpret_cast<const uint8_t*>(str.data());
   const size_t length = str.size();
@@ -171,6 +190,25 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+/// \brief Validate a sequence of contiguous UTF8 strings
+///
+/// The i-th string spans data[offsets[i], offsets[i + 1]).  All strings are
+/// validated in a single pass over data[offsets[0], offsets[length]), which
+/// is much faster than validating them one by one when they are short.
+template <typename OffsetType>
+bool ValidateUTF8Strings(const uint8_t* data, const OffsetType* offsets,
+                         int64_t length) {
+  // The strings are valid if their concatenation is and none of them starts
+  // with a continuation byte, i.e. none of them splits a character.
+  bool splits_character = false;
+  for (int64_t i = 0; i < length; ++i) {
+    splits_character |=
+        offsets[i] < offsets[i + 1] && (data[offsets[i]] & 0xc0) == 0x80;
+  }
+  return !splits_character &&
+         ValidateUTF8(data + offsets[0], offsets[length] - offsets[0]);
+}
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size);
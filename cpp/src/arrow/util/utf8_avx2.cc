@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "arrow/util/utf8_internal.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+// See utf8_internal.h for a description of the algorithm.  The lookup tables
+// are broadcast to both 128-bit lanes, as the AVX2 shuffles work within each
+// lane.
+
+class UTF8ValidatorAvx2 {
+ public:
+  UTF8ValidatorAvx2()
+      : byte_1_high_(LoadTable(kUTF8Byte1High)),
+        byte_1_low_(LoadTable(kUTF8Byte1Low)),
+        byte_2_high_(LoadTable(kUTF8Byte2High)),
+        max_value_(_mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                    -1, -1, -1, static_cast<char>(kUTF8MaxLast3[0]),
+                                    static_cast<char>(kUTF8MaxLast3[1]),
+                                    static_cast<char>(kUTF8MaxLast3[2]))),
+        error_(_mm256_setzero_si256()),
+        prev_input_(_mm256_setzero_si256()),
+        prev_incomplete_(_mm256_setzero_si256()) {}
+
+  static __m256i LoadTable(const uint8_t* table) {
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+  }
+
+  static __m256i Load(const uint8_t* data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  }
+
+  // The bytes of the input shifted right by N positions, with the last N
+  // bytes of the previous input shifted in
+  template <int N>
+  __m256i Prev(__m256i input) const {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input_, input, 0x21),
+                              16 - N);
+  }
+
+  void CheckBlock(__m256i input) {
+    if (_mm256_movemask_epi8(input) == 0) {
+      // All ASCII: only a character truncated by the previous block is an error
+      error_ = _mm256_or_si256(error_, prev_incomplete_);
+      prev_incomplete_ = _mm256_setzero_si256();
+    } else {
+      const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+      const __m256i prev1 = Prev<1>(input);
+      const __m256i prev1_high =
+          _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask);
+      const __m256i prev1_low = _mm256_and_si256(prev1, nibble_mask);
+      const __m256i input_high =
+          _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask);
+      const __m256i special =
+          _mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(byte_1_high_, prev1_high),
+                                            _mm256_shuffle_epi8(byte_1_low_, prev1_low)),
+                           _mm256_shuffle_epi8(byte_2_high_, input_high));
+      // Only 111_____ and 1111____ respectively end up >= 0x80
+      const __m256i must_be_continuation = _mm256_and_si256(
+          _mm256_or_si256(_mm256_subs_epu8(Prev<2>(input), _mm256_set1_epi8(0x60)),
+                          _mm256_subs_epu8(Prev<3>(input), _mm256_set1_epi8(0x70))),
+          _mm256_set1_epi8(static_cast<char>(0x80)));
+      error_ = _mm256_or_si256(error_, _mm256_xor_si256(must_be_continuation, special));
+      prev_incomplete_ = _mm256_subs_epu8(input, max_value_);
+    }
+    prev_input_ = input;
+  }
+
+  bool Validate(const uint8_t* data, int64_t size) {
+    for (; size >= 32; data += 32, size -= 32) {
+      CheckBlock(Load(data));
+    }
+    if (size > 0) {
+      // Pad the tail with ASCII zeros
+      alignas(32) uint8_t tail[32] = {0};
+      memcpy(tail, data, static_cast<size_t>(size));
+      CheckBlock(Load(tail));
+    }
+    error_ = _mm256_or_si256(error_, prev_incomplete_);
+    return _mm256_testz_si256(error_, error_) != 0;
+  }
+
+ private:
+  const __m256i byte_1_high_, byte_1_low_, byte_2_high_, max_value_;
+  __m256i error_, prev_input_, prev_incomplete_;
+};
+
+}  // namespace
+
+bool ValidateUTF8Avx2(const uint8_t* data, int64_t size) {
+  return UTF8ValidatorAvx2().Validate(data, size);
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// SIMD UTF8 validation, after the "lookup" algorithm of simdjson:
+// John Keiser, Daniel Lemire, "Validating UTF-8 In Less Than One Instruction
+// Per Byte", Software: Practice and Experience 51 (5), 2021.
+//
+// Each byte is classified together with the byte preceding it, using three
+// 16-entry tables indexed by the high nibble of the previous byte, the low
+// nibble of the previous byte and the high nibble of the current byte.  The
+// AND of the three lookups has a bit set for each error the pair of bytes
+// exhibits (a continuation byte where none is expected, an overlong
+// encoding, a surrogate...).  The only rule not checked on pairs is that the
+// second continuation byte of 3- and 4-byte characters and the third one of
+// 4-byte characters are continuation bytes; it is checked by looking at the
+// bytes 2 and 3 positions before.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+// Error bits set by the lookup tables
+static constexpr uint8_t kUTF8TooShort = 1 << 0;     // 11______ 0_______
+                                                     // 11______ 11______
+static constexpr uint8_t kUTF8TooLong = 1 << 1;      // 0_______ 10______
+static constexpr uint8_t kUTF8Overlong3 = 1 << 2;    // 11100000 100_____
+static constexpr uint8_t kUTF8TooLarge = 1 << 3;     // 11110100 1001____
+                                                     // 11110100 101_____
+                                                     // 11110101 1_______ and above
+static constexpr uint8_t kUTF8Surrogate = 1 << 4;    // 11101101 101_____
+static constexpr uint8_t kUTF8Overlong2 = 1 << 5;    // 1100000_ 10______
+static constexpr uint8_t kUTF8TooLarge1000 = 1 << 6;  // 11110101 1000____ and above
+static constexpr uint8_t kUTF8Overlong4 = 1 << 6;    // 11110000 1000____
+static constexpr uint8_t kUTF8TwoConts = 1 << 7;     // 10______ 10______
+static constexpr uint8_t kUTF8Carry = kUTF8TooShort | kUTF8TooLong | kUTF8TwoConts;
+
+// Indexed by the high nibble of the previous byte
+alignas(16) static constexpr uint8_t kUTF8Byte1High[16] = {
+    // 0_______ ________ (ASCII)
+    kUTF8TooLong, kUTF8TooLong, kUTF8TooLong, kUTF8TooLong, kUTF8TooLong, kUTF8TooLong,
+    kUTF8TooLong, kUTF8TooLong,
+    // 10______ ________ (continuation)
+    kUTF8TwoConts, kUTF8TwoConts, kUTF8TwoConts, kUTF8TwoConts,
+    // 1100____ ________ (2-byte lead)
+    kUTF8TooShort | kUTF8Overlong2,
+    // 1101____ ________ (2-byte lead)
+    kUTF8TooShort,
+    // 1110____ ________ (3-byte lead)
+    kUTF8TooShort | kUTF8Overlong3 | kUTF8Surrogate,
+    // 1111____ ________ (4-byte lead)
+    kUTF8TooShort | kUTF8TooLarge | kUTF8TooLarge1000 | kUTF8Overlong4};
+
+// Indexed by the low nibble of the previous byte
+alignas(16) static constexpr uint8_t kUTF8Byte1Low[16] = {
+    // ____0000 ________
+    kUTF8Carry | kUTF8Overlong3 | kUTF8Overlong2 | kUTF8Overlong4,
+    // ____0001 ________
+    kUTF8Carry | kUTF8Overlong2,
+    // ____001_ ________
+    kUTF8Carry, kUTF8Carry,
+    // ____0100 ________
+    kUTF8Carry | kUTF8TooLarge,
+    // ____0101 ________ to ____1100 ________
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    // ____1101 ________
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000 | kUTF8Surrogate,
+    // ____111_ ________
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000};
+
+// Indexed by the high nibble of the current byte
+alignas(16) static constexpr uint8_t kUTF8Byte2High[16] = {
+    // ________ 0_______ (ASCII)
+    kUTF8TooShort, kUTF8TooShort, kUTF8TooShort, kUTF8TooShort, kUTF8TooShort,
+    kUTF8TooShort, kUTF8TooShort, kUTF8TooShort,
+    // ________ 1000____
+    kUTF8TooLong | kUTF8Overlong2 | kUTF8TwoConts | kUTF8Overlong3 | kUTF8TooLarge1000 |
+        kUTF8Overlong4,
+    // ________ 1001____
+    kUTF8TooLong | kUTF8Overlong2 | kUTF8TwoConts | kUTF8Overlong3 | kUTF8TooLarge,
+    // ________ 101_____
+    kUTF8TooLong | kUTF8Overlong2 | kUTF8TwoConts | kUTF8Surrogate | kUTF8TooLarge,
+    kUTF8TooLong | kUTF8Overlong2 | kUTF8TwoConts | kUTF8Surrogate | kUTF8TooLarge,
+    // ________ 11______ (lead)
+    kUTF8TooShort, kUTF8TooShort, kUTF8TooShort, kUTF8TooShort};
+
+// The largest values of the last 3 bytes of a block not starting a character
+// that continues in the next block
+static constexpr uint8_t kUTF8MaxLast3[3] = {0xf0 - 1, 0xe0 - 1, 0xc0 - 1};
+
+// SIMD implementations of ValidateUTF8(), available for the instruction sets
+// enabled at compile time
+
+#if defined(ARROW_HAVE_SSE4_2)
+ARROW_EXPORT bool ValidateUTF8Sse42(const uint8_t* data, int64_t size);
+#endif
+
+#if defined(ARROW_HAVE_NEON)
+ARROW_EXPORT bool ValidateUTF8Neon(const uint8_t* data, int64_t size);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+/// \brief AVX2 implementation of ValidateUTF8()
+///
+/// Only available if ARROW_HAVE_RUNTIME_AVX2 is defined.  The caller must
+/// check that the running CPU supports AVX2.
+ARROW_EXPORT bool ValidateUTF8Avx2(const uint8_t* data, int64_t size);
+#endif
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
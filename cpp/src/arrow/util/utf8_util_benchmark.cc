@@ -22,7 +22,9 @@
 #include <vector>
 
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/utf8.h"
+#include "arrow/util/utf8_internal.h"
 
 namespace arrow {
 namespace util {
@@ -50,21 +52,24 @@ static std::string MakeLargeString(const std::string& base, int64_t nbytes) {
   return s;
 }
 
+using ValidateUTF8Func = bool (*)(const uint8_t*, int64_t);
+
 static void BenchmarkUTF8Validation(
     benchmark::State& state,  // NOLINT non-const reference
-    const std::string& s, bool expected) {
+    const std::string& s, bool expected,
+    ValidateUTF8Func validate = static_cast<ValidateUTF8Func>(&ValidateUTF8)) {
   auto data = reinterpret_cast<const uint8_t*>(s.data());
   auto data_size = static_cast<int64_t>(s.size());
 
   InitializeUTF8();
-  bool b = ValidateUTF8(data, data_size);
+  bool b = validate(data, data_size);
   if (b != expected) {
     std::cerr << "Unexpected validation result" << std::endl;
     std::abort();
   }
 
   while (state.KeepRunning()) {
-    bool b = ValidateUTF8(data, data_size);
+    bool b = validate(data, data_size);
     benchmark::DoNotOptimize(b);
   }
   state.SetBytesProcessed(state.iterations() * s.size());
@@ -109,6 +114,83 @@ static void ValidateLargeNonAscii(
   BenchmarkUTF8Validation(state, s, true);
 }
 
+// Large strings validated by each implementation, the result of
+// ValidateUTF8() above depending on the running CPU
+
+static void ValidateLargeImpl(benchmark::State& state,  // NOLINT non-const reference
+                              ValidateUTF8Func validate) {
+  static const char* bases[] = {valid_ascii, valid_almost_ascii, valid_non_ascii};
+  auto s = MakeLargeString(bases[state.range(0)], 100000);
+  BenchmarkUTF8Validation(state, s, true, validate);
+}
+
+static void ValidateLargeScalar(benchmark::State& state) {  // NOLINT non-const reference
+  ValidateLargeImpl(state, &internal::ValidateUTF8Scalar);
+}
+
+#if defined(ARROW_HAVE_SSE4_2)
+static void ValidateLargeSse42(benchmark::State& state) {  // NOLINT non-const reference
+  ValidateLargeImpl(state, &internal::ValidateUTF8Sse42);
+}
+#endif
+
+#if defined(ARROW_HAVE_NEON)
+static void ValidateLargeNeon(benchmark::State& state) {  // NOLINT non-const reference
+  ValidateLargeImpl(state, &internal::ValidateUTF8Neon);
+}
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+static void ValidateLargeAvx2(benchmark::State& state) {  // NOLINT non-const reference
+  if (!::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+          ::arrow::internal::CpuInfo::AVX2)) {
+    state.SkipWithError("AVX2 not supported");
+  }
+  ValidateLargeImpl(state, &internal::ValidateUTF8Avx2);
+}
+#endif
+
+// Many short strings, as in a string column, validated one by one or at once
+
+static void BenchmarkStringsValidation(
+    benchmark::State& state,  // NOLINT non-const reference
+    bool at_once) {
+  const std::vector<std::string> words = {"characters", "caractères", "文字", "a", ""};
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (int i = 0; i < 10000; ++i) {
+    data += words[i % words.size()];
+    offsets.push_back(static_cast<int32_t>(data.size()));
+  }
+  auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+  const auto length = static_cast<int64_t>(offsets.size()) - 1;
+
+  InitializeUTF8();
+  while (state.KeepRunning()) {
+    bool b = true;
+    if (at_once) {
+      b = ValidateUTF8Strings(raw_data, offsets.data(), length);
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        b &= ValidateUTF8(raw_data + offsets[i], offsets[i + 1] - offsets[i]);
+      }
+    }
+    benchmark::DoNotOptimize(b);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+static void ValidateStringsOneByOne(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkStringsValidation(state, false);
+}
+
+static void ValidateStringsAtOnce(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkStringsValidation(state, true);
+}
+
 BENCHMARK(ValidateTinyAscii);
 BENCHMARK(ValidateTinyNonAscii);
 BENCHMARK(ValidateSmallAscii);
@@ -118,5 +200,19 @@ BENCHMARK(ValidateLargeAscii);
 BENCHMARK(ValidateLargeAlmostAscii);
 BENCHMARK(ValidateLargeNonAscii);
 
+// Argument: 0 = ASCII, 1 = almost ASCII, 2 = non-ASCII
+BENCHMARK(ValidateLargeScalar)->DenseRange(0, 2);
+#if defined(ARROW_HAVE_SSE4_2)
+BENCHMARK(ValidateLargeSse42)->DenseRange(0, 2);
+#endif
+#if defined(ARROW_HAVE_NEON)
+BENCHMARK(ValidateLargeNeon)->DenseRange(0, 2);
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+BENCHMARK(ValidateLargeAvx2)->DenseRange(0, 2);
+#endif
+BENCHMARK(ValidateStringsOneByOne);
+BENCHMARK(ValidateStringsAtOnce);
+
 }  // namespace util
 }  // namespace arrow
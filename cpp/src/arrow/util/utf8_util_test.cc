@@ -18,13 +18,16 @@
 #include <cstdint>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/string.h"
 #include "arrow/util/utf8.h"
+#include "arrow/util/utf8_internal.h"
 
 namespace arrow {
 namespace util {
@@ -251,6 +254,96 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+using ValidateUTF8Func = bool (*)(const uint8_t*, int64_t);
+
+// The implementations of UTF8 validation supported by the running CPU
+std::vector<std::pair<std::string, ValidateUTF8Func>> UTF8Validators() {
+  std::vector<std::pair<std::string, ValidateUTF8Func>> validators = {
+      {"Scalar", &internal::ValidateUTF8Scalar}};
+#if defined(ARROW_HAVE_SSE4_2)
+  validators.emplace_back("Sse42", &internal::ValidateUTF8Sse42);
+#endif
+#if defined(ARROW_HAVE_NEON)
+  validators.emplace_back("Neon", &internal::ValidateUTF8Neon);
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+          ::arrow::internal::CpuInfo::AVX2)) {
+    validators.emplace_back("Avx2", &internal::ValidateUTF8Avx2);
+  }
+#endif
+  return validators;
+}
+
+TEST_F(UTF8ValidationTest, AllImplementations) {
+  // Put each sequence at every position around the 16- and 32-byte blocks of
+  // the SIMD implementations, after ASCII or 3-byte characters
+  std::vector<std::pair<std::string, bool>> sequences;
+  for (const auto& s : all_valid_sequences) {
+    sequences.emplace_back(s, true);
+    if (s.size() > 1) {
+      sequences.emplace_back(s.substr(0, s.size() - 1), false);
+    }
+  }
+  for (const auto& s : all_invalid_sequences) {
+    sequences.emplace_back(s, false);
+  }
+
+  for (const auto& validator : UTF8Validators()) {
+    SCOPED_TRACE(validator.first);
+    for (const std::string filler : {"a", "\xe8\x9d\xa5"}) {
+      for (int prefix_size = 0; prefix_size < 70; ++prefix_size) {
+        std::string prefix;
+        while (static_cast<int>(prefix.size() + filler.size()) <= prefix_size) {
+          prefix += filler;
+        }
+        prefix.resize(prefix_size, 'a');
+        for (const auto& sequence : sequences) {
+          for (const std::string suffix : {"", "bcdefghijklmnopqrstuvwxyz"}) {
+            const std::string s = prefix + sequence.first + suffix;
+            ASSERT_EQ(validator.second(reinterpret_cast<const uint8_t*>(s.data()),
+                                       static_cast<int64_t>(s.size())),
+                      sequence.second)
+                << HexEncode(s);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(UTF8ValidationTest, Strings) {
+  auto validate = [](const std::string& data, const std::vector<int32_t>& offsets) {
+    return ValidateUTF8Strings(reinterpret_cast<const uint8_t*>(data.data()),
+                               offsets.data(),
+                               static_cast<int64_t>(offsets.size()) - 1);
+  };
+  ASSERT_TRUE(validate("", {0}));
+  ASSERT_TRUE(validate("", {0, 0, 0}));
+  ASSERT_TRUE(validate("ab\xc3\xa9", {0, 1, 4}));
+  ASSERT_TRUE(validate("ab\xc3\xa9", {0, 2, 2, 4}));
+  // Only the strings between the first and last offsets are validated
+  ASSERT_TRUE(validate("\xff" "ab\xc3\xa9\xff", {1, 2, 5}));
+  // Each string must be valid on its own, not only their concatenation
+  ASSERT_FALSE(validate("ab\xc3\xa9", {0, 3, 4}));
+  ASSERT_FALSE(validate("ab\xc3\xa9", {0, 3, 3, 4}));
+  ASSERT_FALSE(validate("\xe8\x9d\xa5", {0, 1, 3}));
+  ASSERT_FALSE(validate("ab\xc3", {0, 1, 3}));
+  ASSERT_FALSE(validate("a\xff" "b", {0, 1, 3}));
+
+  std::string long_string(100, 'a');
+  std::vector<int64_t> offsets = {0, 50, 100};
+  auto validate_long = [&]() {
+    return ValidateUTF8Strings(reinterpret_cast<const uint8_t*>(long_string.data()),
+                               offsets.data(), 2);
+  };
+  ASSERT_TRUE(validate_long());
+  long_string.replace(49, 2, "\xc3\xa9");
+  ASSERT_FALSE(validate_long());
+  offsets[1] = 51;
+  ASSERT_TRUE(validate_long());
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
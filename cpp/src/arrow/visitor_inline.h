@@ -142,7 +142,7 @@ struct ArrayDataInlineVisitor<T, enable_if_has_c_type<T>> {
   static Status VisitStatus(const ArrayData& arr, VisitFunc&& func) {
     const c_type* data = arr.GetValues<c_type>(1);
 
-    if (arr.null_count != 0) {
+    if (arr.GetNullCount() != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
         const bool is_null = valid_reader.IsNotSet();
@@ -166,7 +166,7 @@ struct ArrayDataInlineVisitor<T, enable_if_has_c_type<T>> {
     using c_type = typename T::c_type;
     const c_type* data = arr.GetValues<c_type>(1);
 
-    if (arr.null_count != 0) {
+    if (arr.GetNullCount() != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
         const bool is_null = valid_reader.IsNotSet();
@@ -192,7 +192,7 @@ struct ArrayDataInlineVisitor<BooleanType> {
 
   template <typename VisitFunc>
   static Status VisitStatus(const ArrayData& arr, VisitFunc&& func) {
-    if (arr.null_count != 0) {
+    if (arr.GetNullCount() != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       internal::BitmapReader value_reader(arr.buffers[1]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
@@ -217,7 +217,7 @@ struct ArrayDataInlineVisitor<BooleanType> {
 
   template <typename VisitFunc>
   static void VisitVoid(const ArrayData& arr, VisitFunc&& func) {
-    if (arr.null_count != 0) {
+    if (arr.GetNullCount() != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       internal::BitmapReader value_reader(arr.buffers[1]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
@@ -260,7 +260,7 @@ struct ArrayDataInlineVisitor<T, enable_if_base_binary<T>> {
       data = arr.GetValues<uint8_t>(2, /*absolute_offset=*/0);
     }
 
-    if (arr.null_count != 0) {
+    if (arr.GetNullCount() != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
         const bool is_null = valid_reader.IsNotSet();
@@ -298,7 +298,7 @@ struct ArrayDataInlineVisitor<T, enable_if_base_binary<T>> {
       data = arr.GetValues<uint8_t>(2, /*absolute_offset=*/0);
     }
 
-    if (arr.null_count != 0) {
+    if (arr.GetNullCount() != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
         const bool is_null = valid_reader.IsNotSet();
@@ -335,7 +335,7 @@ struct ArrayDataInlineVisitor<T, enable_if_fixed_size_binary<T>> {
         arr.GetValues<uint8_t>(1,
                                /*absolute_offset=*/arr.offset * byte_width);
 
-    if (arr.null_count != 0) {
+    if (arr.GetNullCount() != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
         const bool is_null = valid_reader.IsNotSet();
@@ -367,7 +367,7 @@ struct ArrayDataInlineVisitor<T, enable_if_fixed_size_binary<T>> {
         arr.GetValues<uint8_t>(1,
                                /*absolute_offset=*/arr.offset * byte_width);
 
-    if (arr.null_count != 0) {
+    if (arr.GetNullCount() != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
         const bool is_null = valid_reader.IsNotSet();
@@ -42,6 +42,12 @@ FieldDescriptorPtr Annotator::AddOutputFieldDescriptor(FieldPtr field) {
   return desc;
 }
 
+FieldDescriptorPtr Annotator::AddIntermediateFieldDescriptor(FieldPtr field) {
+  auto desc = AddOutputFieldDescriptor(field);
+  in_name_to_desc_[field->name()] = desc;
+  return desc;
+}
+
 FieldDescriptorPtr Annotator::MakeDesc(FieldPtr field, bool is_output) {
   int data_idx = buffer_count_++;
   int validity_idx = buffer_count_++;
@@ -43,6 +43,11 @@ class GANDIVA_EXPORT Annotator {
   /// Add an annotated field descriptor for an output field.
   FieldDescriptorPtr AddOutputFieldDescriptor(FieldPtr field);
 
+  /// Add an annotated field descriptor for an intermediate field, that is output by
+  /// one expression and read by others.  It is both an output field, whose array
+  /// is passed to PrepareEvalBatch before the other outputs, and an input field.
+  FieldDescriptorPtr AddIntermediateFieldDescriptor(FieldPtr field);
+
   /// Add a local bitmap (for saving validity bits of an intermediate node).
   /// Returns the index of the bitmap in the list of local bitmaps.
   int AddLocalBitMap() { return local_bitmap_count_++; }
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/cache.h"
+
+#include <string>
+
+#include "arrow/result.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace gandiva {
+
+static constexpr int64_t kDefaultCacheCapacity = 250;
+
+// Read a non-negative integer from an environment variable, or return -1
+static int64_t ParseCacheEnvVar(const char* name) {
+  auto result = ::arrow::internal::GetEnvVar(name);
+  if (!result.ok()) {
+    return -1;
+  }
+  try {
+    auto value = std::stoll(*result);
+    if (value >= 0) {
+      return value;
+    }
+  } catch (...) {
+  }
+  ARROW_LOG(WARNING) << "Invalid value for " << name << ": '" << *result
+                     << "', using the default";
+  return -1;
+}
+
+size_t GetCacheCapacity() {
+  static const int64_t capacity = [] {
+    auto value = ParseCacheEnvVar("GANDIVA_CACHE_SIZE");
+    return value > 0 ? value : kDefaultCacheCapacity;
+  }();
+  return static_cast<size_t>(capacity);
+}
+
+int64_t GetCacheMaxSize() {
+  static const int64_t max_size = ParseCacheEnvVar("GANDIVA_CACHE_MAX_BYTES");
+  return max_size;
+}
+
+}  // namespace gandiva
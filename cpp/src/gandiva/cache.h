@@ -17,33 +17,115 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "gandiva/lru_cache.h"
+#include "gandiva/visibility.h"
 
 namespace gandiva {
 
+/// \brief Statistics of a module cache
+struct GANDIVA_EXPORT CacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+  /// Number of cached modules
+  int64_t entries = 0;
+  /// Total size of the cached modules, in bytes (as estimated by the caller)
+  int64_t size = 0;
+};
+
+/// \brief Maximum number of modules in each cache
+///
+/// Defaults to 250, and can be changed with the GANDIVA_CACHE_SIZE
+/// environment variable.
+GANDIVA_EXPORT size_t GetCacheCapacity();
+
+/// \brief Maximum total size in bytes of the modules in each cache
+///
+/// Unbounded (-1) by default, can be set with the GANDIVA_CACHE_MAX_BYTES
+/// environment variable.
+GANDIVA_EXPORT int64_t GetCacheMaxSize();
+
+/// A thread-safe LRU cache of modules.
+///
+/// Keys are spread over several independently locked shards, so that concurrent
+/// lookups rarely contend.  Each shard holds its share of the capacity and of
+/// the size bound, and evicts its own least recently used modules.
 template <class KeyType, typename ValueType>
 class Cache {
  public:
-  explicit Cache(size_t capacity = CACHE_SIZE) : cache_(capacity) {}
-  ValueType GetModule(KeyType cache_key) {
+  explicit Cache(size_t capacity = GetCacheCapacity(),
+                 int64_t max_size = GetCacheMaxSize()) {
+    const size_t num_shards = std::max<size_t>(1, std::min(kMaxShards, capacity / 16));
+    const size_t shard_capacity = (capacity + num_shards - 1) / num_shards;
+    const int64_t shard_max_size =
+        max_size < 0 ? max_size : max_size / static_cast<int64_t>(num_shards);
+    for (size_t i = 0; i < num_shards; ++i) {
+      shards_.emplace_back(new Shard(shard_capacity, shard_max_size));
+    }
+  }
+
+  ValueType GetModule(const KeyType& cache_key) {
     arrow::util::optional<ValueType> result;
-    mtx_.lock();
-    result = cache_.get(cache_key);
-    mtx_.unlock();
-    return result != arrow::util::nullopt ? *result : nullptr;
+    {
+      Shard& shard = ShardFor(cache_key);
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result = shard.cache.get(cache_key);
+    }
+    if (result == arrow::util::nullopt) {
+      misses_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return *result;
+  }
+
+  /// Insert a module, whose size is estimated by `size` bytes
+  void PutModule(const KeyType& cache_key, ValueType module, int64_t size = 0) {
+    Shard& shard = ShardFor(cache_key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.cache.insert(cache_key, module, size);
   }
 
-  void PutModule(KeyType cache_key, ValueType module) {
-    mtx_.lock();
-    cache_.insert(cache_key, module);
-    mtx_.unlock();
+  CacheStats stats() {
+    CacheStats stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      stats.evictions += shard->cache.evictions();
+      stats.entries += static_cast<int64_t>(shard->cache.size());
+      stats.size += shard->cache.total_size();
+    }
+    return stats;
   }
 
  private:
-  LruCache<KeyType, ValueType> cache_;
-  static const int CACHE_SIZE = 250;
-  std::mutex mtx_;
+  static constexpr size_t kMaxShards = 16;
+
+  struct Shard {
+    Shard(size_t capacity, int64_t max_size) : cache(capacity, max_size) {}
+
+    std::mutex mutex;
+    LruCache<KeyType, ValueType> cache;
+  };
+
+  Shard& ShardFor(const KeyType& cache_key) {
+    return *shards_[cache_key.Hash() % shards_.size()];
+  }
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
 };
+
+template <class KeyType, typename ValueType>
+constexpr size_t Cache<KeyType, ValueType>::kMaxShards;
+
 }  // namespace gandiva
@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/common_subexpr.h"
+
+#include <memory>
+#include <string>
+
+#include "gandiva/node.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+constexpr const char* CommonSubexprEliminator::kFieldPrefix;
+
+namespace {
+
+// Return true if the node can be replaced by an intermediate field.
+bool IsEligible(const Node& node) {
+  auto function = dynamic_cast<const FunctionNode*>(&node);
+  if (function == nullptr || !arrow::is_primitive(node.return_type()->id())) {
+    return false;
+  }
+  // Each call returns a different value
+  const std::string& name = function->descriptor()->name();
+  return name != "random" && name != "rand";
+}
+
+// Return the children of the node that are evaluated for every row.
+NodeVector AlwaysEvaluatedChildren(const Node& node) {
+  if (auto function = dynamic_cast<const FunctionNode*>(&node)) {
+    return function->children();
+  }
+  if (auto if_node = dynamic_cast<const IfNode*>(&node)) {
+    return {if_node->condition()};
+  }
+  if (auto boolean = dynamic_cast<const BooleanNode*>(&node)) {
+    return {boolean->children().front()};
+  }
+  // Fields, literals and in expressions
+  return {};
+}
+
+}  // namespace
+
+void CommonSubexprEliminator::Rewrite(const ExpressionVector& exprs,
+                                      ExpressionVector* intermediates,
+                                      ExpressionVector* rewritten) {
+  CommonSubexprEliminator eliminator;
+  for (auto& expr : exprs) {
+    eliminator.CountOccurrences(expr->root());
+  }
+  for (auto& expr : exprs) {
+    eliminator.CountUses(expr->root());
+  }
+
+  rewritten->clear();
+  for (auto& expr : exprs) {
+    auto root = eliminator.RewriteNode(expr->root());
+    if (root == expr->root()) {
+      rewritten->push_back(expr);
+    } else {
+      rewritten->push_back(std::make_shared<Expression>(root, expr->result()));
+    }
+  }
+  *intermediates = std::move(eliminator.intermediates_);
+}
+
+void CommonSubexprEliminator::CountOccurrences(const NodePtr& node) {
+  if (IsEligible(*node)) {
+    ++occurrences_[node->ToString()];
+  }
+  for (auto& child : AlwaysEvaluatedChildren(*node)) {
+    CountOccurrences(child);
+  }
+}
+
+void CommonSubexprEliminator::CountUses(const NodePtr& node) {
+  if (IsEligible(*node)) {
+    auto key = node->ToString();
+    if (occurrences_[key] > 1 && ++uses_[key] > 1) {
+      // Computed once, so the subtree is only visited for the first use
+      return;
+    }
+  }
+  for (auto& child : AlwaysEvaluatedChildren(*node)) {
+    CountUses(child);
+  }
+}
+
+NodePtr CommonSubexprEliminator::RewriteNode(const NodePtr& node) {
+  if (!IsEligible(*node)) {
+    return RewriteChildren(node);
+  }
+  auto key = node->ToString();
+  auto uses = uses_.find(key);
+  if (uses == uses_.end() || uses->second < 2) {
+    return RewriteChildren(node);
+  }
+
+  auto found = fields_.find(key);
+  if (found == fields_.end()) {
+    // The subtree itself may use other intermediates, which are added first
+    auto root = RewriteChildren(node);
+    auto field = arrow::field(kFieldPrefix + std::to_string(intermediates_.size()),
+                              node->return_type());
+    intermediates_.push_back(std::make_shared<Expression>(root, field));
+    found = fields_.emplace(key, field).first;
+  }
+  return TreeExprBuilder::MakeField(found->second);
+}
+
+NodePtr CommonSubexprEliminator::RewriteChildren(const NodePtr& node) {
+  if (auto function = dynamic_cast<const FunctionNode*>(node.get())) {
+    NodeVector children;
+    bool changed = false;
+    for (auto& child : function->children()) {
+      children.push_back(RewriteNode(child));
+      changed |= children.back() != child;
+    }
+    if (!changed) {
+      return node;
+    }
+    return TreeExprBuilder::MakeFunction(function->descriptor()->name(), children,
+                                         function->return_type());
+  }
+  if (auto if_node = dynamic_cast<const IfNode*>(node.get())) {
+    auto condition = RewriteNode(if_node->condition());
+    if (condition == if_node->condition()) {
+      return node;
+    }
+    return TreeExprBuilder::MakeIf(condition, if_node->then_node(),
+                                   if_node->else_node(), if_node->return_type());
+  }
+  if (auto boolean = dynamic_cast<const BooleanNode*>(node.get())) {
+    NodeVector children = boolean->children();
+    auto first = RewriteNode(children.front());
+    if (first == children.front()) {
+      return node;
+    }
+    children.front() = first;
+    return boolean->expr_type() == BooleanNode::AND ? TreeExprBuilder::MakeAnd(children)
+                                                    : TreeExprBuilder::MakeOr(children);
+  }
+  return node;
+}
+
+}  // namespace gandiva
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "gandiva/expression.h"
+#include "gandiva/gandiva_aliases.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Find the subtrees shared by several expressions (or repeated in one
+/// expression), so that they are computed only once per batch.
+///
+/// A shared subtree is replaced by a reference to an intermediate field, which is
+/// computed by a separate expression.  Only function calls with a fixed-width
+/// result are replaced, and only where they are always evaluated: not in the
+/// branches of an if-else, nor after the first operand of and/or, so that no error
+/// is raised for rows that would not have evaluated the subtree.
+class GANDIVA_EXPORT CommonSubexprEliminator {
+ public:
+  /// \brief Rewrite the expressions.
+  ///
+  /// \param[in] exprs the expressions to rewrite
+  /// \param[out] intermediates the expressions computing the intermediate fields, in
+  ///             an order where each one only depends on the preceding ones
+  /// \param[out] rewritten the rewritten expressions, in the order of 'exprs'
+  static void Rewrite(const ExpressionVector& exprs, ExpressionVector* intermediates,
+                      ExpressionVector* rewritten);
+
+  /// Prefix of the names of the intermediate fields.
+  static constexpr const char* kFieldPrefix = "__gandiva_subexpr_";
+
+ private:
+  CommonSubexprEliminator() = default;
+
+  void CountOccurrences(const NodePtr& node);
+  void CountUses(const NodePtr& node);
+  NodePtr RewriteNode(const NodePtr& node);
+  NodePtr RewriteChildren(const NodePtr& node);
+
+  // Number of times each eligible subtree appears, by string representation
+  std::unordered_map<std::string, int> occurrences_;
+  // Number of times each eligible subtree would be used if shared subtrees were
+  // computed once, i.e. not counting the occurrences in their own subtrees
+  std::unordered_map<std::string, int> uses_;
+  // Intermediate field of each replaced subtree
+  std::unordered_map<std::string, FieldPtr> fields_;
+  ExpressionVector intermediates_;
+};
+
+}  // namespace gandiva
@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/common_subexpr.h"
+
+#include <gtest/gtest.h>
+#include "gandiva/node.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::field;
+using arrow::int32;
+
+class TestCommonSubexpr : public ::testing::Test {
+ public:
+  void SetUp() {
+    a_ = TreeExprBuilder::MakeField(field("a", int32()));
+    b_ = TreeExprBuilder::MakeField(field("b", int32()));
+  }
+
+ protected:
+  NodePtr Add(NodePtr left, NodePtr right) {
+    return TreeExprBuilder::MakeFunction("add", {left, right}, int32());
+  }
+
+  ExpressionPtr Expr(NodePtr root, const std::string& name) {
+    return TreeExprBuilder::MakeExpression(root, field(name, root->return_type()));
+  }
+
+  NodePtr a_;
+  NodePtr b_;
+};
+
+TEST_F(TestCommonSubexpr, TestNothingShared) {
+  ExpressionVector exprs = {Expr(Add(a_, b_), "r0"), Expr(Add(b_, a_), "r1")};
+
+  ExpressionVector intermediates, rewritten;
+  CommonSubexprEliminator::Rewrite(exprs, &intermediates, &rewritten);
+
+  EXPECT_TRUE(intermediates.empty());
+  ASSERT_EQ(rewritten.size(), 2);
+  EXPECT_EQ(rewritten[0], exprs[0]);
+  EXPECT_EQ(rewritten[1], exprs[1]);
+}
+
+TEST_F(TestCommonSubexpr, TestSharedAcrossExpressions) {
+  // r0 = (a + b) + a, r1 = (a + b) + b
+  ExpressionVector exprs = {Expr(Add(Add(a_, b_), a_), "r0"),
+                            Expr(Add(Add(a_, b_), b_), "r1")};
+
+  ExpressionVector intermediates, rewritten;
+  CommonSubexprEliminator::Rewrite(exprs, &intermediates, &rewritten);
+
+  ASSERT_EQ(intermediates.size(), 1);
+  auto field_name = intermediates[0]->result()->name();
+  EXPECT_EQ(field_name, std::string(CommonSubexprEliminator::kFieldPrefix) + "0");
+  EXPECT_EQ(intermediates[0]->root()->ToString(), Add(a_, b_)->ToString());
+
+  auto shared = TreeExprBuilder::MakeField(field(field_name, int32()));
+  ASSERT_EQ(rewritten.size(), 2);
+  EXPECT_EQ(rewritten[0]->root()->ToString(), Add(shared, a_)->ToString());
+  EXPECT_EQ(rewritten[1]->root()->ToString(), Add(shared, b_)->ToString());
+  EXPECT_EQ(rewritten[0]->result(), exprs[0]->result());
+}
+
+TEST_F(TestCommonSubexpr, TestNestedShared) {
+  // Both (a + b) and ((a + b) + a) are shared, the inner one is also used by r2
+  auto inner = Add(a_, b_);
+  auto outer = Add(inner, a_);
+  ExpressionVector exprs = {Expr(Add(outer, b_), "r0"), Expr(Add(outer, a_), "r1"),
+                            Expr(Add(inner, inner), "r2")};
+
+  ExpressionVector intermediates, rewritten;
+  CommonSubexprEliminator::Rewrite(exprs, &intermediates, &rewritten);
+
+  // The inner subtree is computed before the outer one, which uses it
+  ASSERT_EQ(intermediates.size(), 2);
+  auto inner_field = TreeExprBuilder::MakeField(intermediates[0]->result());
+  auto outer_field = TreeExprBuilder::MakeField(intermediates[1]->result());
+  EXPECT_EQ(intermediates[0]->root()->ToString(), inner->ToString());
+  EXPECT_EQ(intermediates[1]->root()->ToString(), Add(inner_field, a_)->ToString());
+
+  ASSERT_EQ(rewritten.size(), 3);
+  EXPECT_EQ(rewritten[0]->root()->ToString(), Add(outer_field, b_)->ToString());
+  EXPECT_EQ(rewritten[1]->root()->ToString(), Add(outer_field, a_)->ToString());
+  EXPECT_EQ(rewritten[2]->root()->ToString(),
+            Add(inner_field, inner_field)->ToString());
+}
+
+TEST_F(TestCommonSubexpr, TestConditionalNotShared) {
+  // The subtree in the branches of the if-else is only evaluated for some rows
+  auto cond = TreeExprBuilder::MakeFunction("greater_than", {a_, b_}, boolean());
+  auto shared = Add(a_, b_);
+  auto if_node = TreeExprBuilder::MakeIf(cond, shared, a_, int32());
+  ExpressionVector exprs = {Expr(if_node, "r0"), Expr(shared, "r1")};
+
+  ExpressionVector intermediates, rewritten;
+  CommonSubexprEliminator::Rewrite(exprs, &intermediates, &rewritten);
+
+  EXPECT_TRUE(intermediates.empty());
+  EXPECT_EQ(rewritten[0], exprs[0]);
+  EXPECT_EQ(rewritten[1], exprs[1]);
+}
+
+TEST_F(TestCommonSubexpr, TestRandomNotShared) {
+  auto rand = TreeExprBuilder::MakeFunction("random", {}, arrow::float64());
+  ExpressionVector exprs = {Expr(rand, "r0"), Expr(rand, "r1")};
+
+  ExpressionVector intermediates, rewritten;
+  CommonSubexprEliminator::Rewrite(exprs, &intermediates, &rewritten);
+
+  EXPECT_TRUE(intermediates.empty());
+}
+
+}  // namespace gandiva
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Time spent in each phase of building a projector or filter, in
+/// nanoseconds.
+struct GANDIVA_EXPORT CompileStats {
+  /// Lookup in the cache of built projectors or filters
+  uint64_t cache_lookup = 0;
+  /// Creation of the LLVM engine, including loading the pre-compiled functions
+  uint64_t engine_setup = 0;
+  /// Decomposition of the expressions into values and validities
+  uint64_t decomposition = 0;
+  /// Generation of the IR functions
+  uint64_t ir_generation = 0;
+  /// Linking of the used pre-compiled functions and optimisation passes
+  uint64_t optimization = 0;
+  /// Generation of the machine code, or loading it from the object cache
+  uint64_t codegen = 0;
+  /// Whether the machine code was loaded from the on-disk object cache
+  bool object_cache_hit = false;
+
+  uint64_t total() const {
+    return cache_lookup + engine_setup + decomposition + ir_generation + optimization +
+           codegen;
+  }
+
+  std::string ToString() const;
+};
+
+}  // namespace gandiva
@@ -25,11 +25,18 @@ const std::shared_ptr<Configuration> ConfigurationBuilder::default_configuration
     InitDefaultConfig();
 
 std::size_t Configuration::Hash() const {
-  return 0;  // dummy for now, no configuration properties yet
+  static constexpr size_t kHashSeed = 0;
+  size_t result = kHashSeed;
+  boost::hash_combine(result, optimize_);
+  boost::hash_combine(result, background_optimize_);
+  boost::hash_combine(result, object_cache_dir_);
+  return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return true;  // always true, no configuration properties yet
+  return optimize_ == other.optimize_ &&
+         background_optimize_ == other.background_optimize_ &&
+         object_cache_dir_ == other.object_cache_dir_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
@@ -42,8 +42,27 @@ class GANDIVA_EXPORT Configuration {
   bool optimize() const { return optimize_; }
   void set_optimize(bool optimize) { optimize_ = optimize; }
 
+  /// If true (and `optimize` is true), Projector::Make and Filter::Make return
+  /// after a quick unoptimised compile, which lowers the latency of the first
+  /// batches.  The module is then optimised and compiled again on the CPU thread
+  /// pool, and evaluation switches to it once it is ready.
+  bool background_optimize() const { return background_optimize_; }
+  void set_background_optimize(bool background_optimize) {
+    background_optimize_ = background_optimize;
+  }
+
+  /// Directory of the on-disk cache of compiled object code, shared between
+  /// processes.  If empty (the default), modules are always compiled.
+  ///
+  /// Modules that embed pointers to process-local state (e.g. string literals,
+  /// or function holders for like() or in()) are never cached on disk.
+  const std::string& object_cache_dir() const { return object_cache_dir_; }
+  void set_object_cache_dir(const std::string& dir) { object_cache_dir_ = dir; }
+
  private:
   bool optimize_ = true;
+  bool background_optimize_ = false;
+  std::string object_cache_dir_;
 };
 
 /// \brief configuration builder for gandiva
@@ -0,0 +1,300 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/dictionary_projector.h"
+
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+
+#include "gandiva/node.h"
+#include "gandiva/node_visitor.h"
+
+namespace gandiva {
+
+namespace {
+
+// Collect the fields referenced by an expression, and whether it calls a function
+// which may return different values for the same input.
+class FieldCollector : public NodeVisitor {
+ public:
+  Status Visit(const FieldNode& node) override {
+    names_.insert(node.field()->name());
+    return Status::OK();
+  }
+
+  Status Visit(const FunctionNode& node) override {
+    const auto& name = node.descriptor()->name();
+    if (name == "random" || name == "rand") {
+      non_deterministic_ = true;
+    }
+    for (auto& child : node.children()) {
+      ARROW_RETURN_NOT_OK(child->Accept(*this));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const IfNode& node) override {
+    ARROW_RETURN_NOT_OK(node.condition()->Accept(*this));
+    ARROW_RETURN_NOT_OK(node.then_node()->Accept(*this));
+    return node.else_node()->Accept(*this);
+  }
+
+  Status Visit(const LiteralNode& node) override { return Status::OK(); }
+
+  Status Visit(const BooleanNode& node) override {
+    for (auto& child : node.children()) {
+      ARROW_RETURN_NOT_OK(child->Accept(*this));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const InExpressionNode<int32_t>& node) override {
+    return node.eval_expr()->Accept(*this);
+  }
+  Status Visit(const InExpressionNode<int64_t>& node) override {
+    return node.eval_expr()->Accept(*this);
+  }
+  Status Visit(const InExpressionNode<std::string>& node) override {
+    return node.eval_expr()->Accept(*this);
+  }
+
+  const std::set<std::string>& names() const { return names_; }
+  bool non_deterministic() const { return non_deterministic_; }
+
+ private:
+  std::set<std::string> names_;
+  bool non_deterministic_ = false;
+};
+
+FieldPtr DecodedField(const FieldPtr& field) {
+  if (field->type()->id() != arrow::Type::DICTIONARY) {
+    return field;
+  }
+  const auto& dict_type = static_cast<const arrow::DictionaryType&>(*field->type());
+  return field->WithType(dict_type.value_type());
+}
+
+// Evaluate the expressions on a single null value, and return the indices of
+// those that return null.
+Status NullPropagating(const FieldPtr& field, const ExpressionVector& exprs,
+                       std::shared_ptr<Configuration> configuration,
+                       std::vector<size_t>* out) {
+  auto schema = arrow::schema({field});
+  std::shared_ptr<Projector> projector;
+  ARROW_RETURN_NOT_OK(Projector::Make(schema, exprs, configuration, &projector));
+  ARROW_ASSIGN_OR_RAISE(auto nulls, arrow::MakeArrayOfNull(field->type(), 1));
+  arrow::ArrayVector results;
+  ARROW_RETURN_NOT_OK(projector->Evaluate(*arrow::RecordBatch::Make(schema, 1, {nulls}),
+                                          arrow::default_memory_pool(), &results));
+  out->clear();
+  for (size_t i = 0; i < results.size(); ++i) {
+    if (results[i]->IsNull(0)) {
+      out->push_back(i);
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status DictionaryProjector::Make(SchemaPtr schema, const ExpressionVector& exprs,
+                                 std::shared_ptr<DictionaryProjector>* projector) {
+  return Make(schema, exprs, ConfigurationBuilder::DefaultConfiguration(),
+              /*dictionary_outputs=*/false, projector);
+}
+
+Status DictionaryProjector::Make(SchemaPtr schema, const ExpressionVector& exprs,
+                                 std::shared_ptr<Configuration> configuration,
+                                 bool dictionary_outputs,
+                                 std::shared_ptr<DictionaryProjector>* projector) {
+  ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
+  ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
+  ARROW_RETURN_IF(configuration == nullptr,
+                  Status::Invalid("Configuration cannot be null"));
+
+  std::shared_ptr<DictionaryProjector> result(
+      new DictionaryProjector(schema, dictionary_outputs, exprs.size()));
+
+  // Find the candidates for evaluation on the dictionary, by column
+  std::vector<std::set<std::string>> referenced(exprs.size());
+  std::vector<std::vector<size_t>> candidates(schema->num_fields());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    FieldCollector collector;
+    ARROW_RETURN_NOT_OK(exprs[i]->root()->Accept(collector));
+    referenced[i] = collector.names();
+    if (collector.non_deterministic() || referenced[i].size() != 1) {
+      continue;
+    }
+    const int field_index = schema->GetFieldIndex(*referenced[i].begin());
+    if (field_index >= 0 &&
+        schema->field(field_index)->type()->id() == arrow::Type::DICTIONARY) {
+      candidates[field_index].push_back(i);
+    }
+  }
+
+  for (int field_index = 0; field_index < schema->num_fields(); ++field_index) {
+    if (candidates[field_index].empty()) {
+      continue;
+    }
+    auto field = DecodedField(schema->field(field_index));
+    ExpressionVector group_exprs;
+    for (size_t i : candidates[field_index]) {
+      group_exprs.push_back(exprs[i]);
+    }
+
+    // A null index must give a null result, since the dictionary has no slot for it
+    std::vector<size_t> null_propagating;
+    ARROW_RETURN_NOT_OK(
+        NullPropagating(field, group_exprs, configuration, &null_propagating));
+    if (null_propagating.empty()) {
+      continue;
+    }
+
+    DictionaryGroup group;
+    group.field_index = field_index;
+    group.schema = arrow::schema({field});
+    ExpressionVector eligible_exprs;
+    for (size_t i : null_propagating) {
+      group.expr_indices.push_back(candidates[field_index][i]);
+      group.result_types.push_back(group_exprs[i]->result()->type());
+      eligible_exprs.push_back(group_exprs[i]);
+      result->on_dictionary_[candidates[field_index][i]] = true;
+    }
+    ARROW_RETURN_NOT_OK(
+        Projector::Make(group.schema, eligible_exprs, configuration, &group.projector));
+    result->groups_.push_back(std::move(group));
+  }
+
+  // The other expressions are evaluated on the (decoded) columns they reference
+  ExpressionVector decoded_exprs;
+  std::set<std::string> decoded_names;
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    if (!result->on_dictionary_[i]) {
+      result->decoded_expr_indices_.push_back(i);
+      decoded_exprs.push_back(exprs[i]);
+      decoded_names.insert(referenced[i].begin(), referenced[i].end());
+    }
+  }
+  if (!decoded_exprs.empty()) {
+    FieldVector decoded_fields;
+    for (int field_index = 0; field_index < schema->num_fields(); ++field_index) {
+      if (decoded_names.count(schema->field(field_index)->name()) > 0) {
+        result->decoded_field_indices_.push_back(field_index);
+        decoded_fields.push_back(DecodedField(schema->field(field_index)));
+      }
+    }
+    result->decoded_schema_ = arrow::schema(decoded_fields);
+    ARROW_RETURN_NOT_OK(Projector::Make(result->decoded_schema_, decoded_exprs,
+                                        configuration, &result->decoded_projector_));
+  }
+
+  *projector = std::move(result);
+  return Status::OK();
+}
+
+Status DictionaryProjector::Evaluate(const arrow::RecordBatch& batch,
+                                     arrow::MemoryPool* pool,
+                                     arrow::ArrayVector* output) {
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in RecordBatch must match schema in Make()"));
+  ARROW_RETURN_IF(batch.num_rows() == 0,
+                  Status::Invalid("RecordBatch must be non-empty."));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  output->assign(on_dictionary_.size(), nullptr);
+  for (auto& group : groups_) {
+    ARROW_RETURN_NOT_OK(EvaluateGroup(group, batch, pool, output));
+  }
+  if (decoded_projector_ != nullptr) {
+    ARROW_RETURN_NOT_OK(EvaluateDecoded(batch, pool, output));
+  }
+  return Status::OK();
+}
+
+Status DictionaryProjector::EvaluateGroup(const DictionaryGroup& group,
+                                          const arrow::RecordBatch& batch,
+                                          arrow::MemoryPool* pool,
+                                          arrow::ArrayVector* output) {
+  const auto& column =
+      static_cast<const arrow::DictionaryArray&>(*batch.column(group.field_index));
+  const auto& dictionary = column.dictionary();
+  const auto& indices = column.indices();
+  const auto& index_type =
+      static_cast<const arrow::DictionaryType&>(*column.type()).index_type();
+
+  // Evaluate on the dictionary values once for the whole batch
+  arrow::ArrayVector results;
+  if (dictionary->length() > 0) {
+    auto dictionary_batch = arrow::RecordBatch::Make(
+        group.schema, dictionary->length(), {dictionary});
+    ARROW_RETURN_NOT_OK(group.projector->Evaluate(*dictionary_batch, pool, &results));
+  } else {
+    // All the indices are null
+    results.resize(group.expr_indices.size());
+  }
+
+  arrow::compute::FunctionContext ctx(pool);
+  for (size_t j = 0; j < group.expr_indices.size(); ++j) {
+    const auto& result_type = group.result_types[j];
+    auto& out = (*output)[group.expr_indices[j]];
+    if (results[j] == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(results[j], arrow::MakeArrayOfNull(result_type, 0, pool));
+    }
+    if (dictionary_outputs_) {
+      out = std::make_shared<arrow::DictionaryArray>(
+          arrow::dictionary(index_type, result_type), indices, results[j]);
+    } else {
+      ARROW_RETURN_NOT_OK(arrow::compute::Take(&ctx, *results[j], *indices,
+                                               arrow::compute::TakeOptions(), &out));
+    }
+  }
+  return Status::OK();
+}
+
+Status DictionaryProjector::EvaluateDecoded(const arrow::RecordBatch& batch,
+                                            arrow::MemoryPool* pool,
+                                            arrow::ArrayVector* output) {
+  arrow::compute::FunctionContext ctx(pool);
+  arrow::ArrayVector columns;
+  for (int field_index : decoded_field_indices_) {
+    auto column = batch.column(field_index);
+    if (column->type_id() == arrow::Type::DICTIONARY) {
+      const auto& dict_column = static_cast<const arrow::DictionaryArray&>(*column);
+      ARROW_RETURN_NOT_OK(arrow::compute::Take(&ctx, *dict_column.dictionary(),
+                                               *dict_column.indices(),
+                                               arrow::compute::TakeOptions(), &column));
+    }
+    columns.push_back(std::move(column));
+  }
+
+  auto decoded_batch =
+      arrow::RecordBatch::Make(decoded_schema_, batch.num_rows(), std::move(columns));
+  arrow::ArrayVector results;
+  ARROW_RETURN_NOT_OK(decoded_projector_->Evaluate(*decoded_batch, pool, &results));
+  for (size_t j = 0; j < decoded_expr_indices_.size(); ++j) {
+    (*output)[decoded_expr_indices_[j]] = std::move(results[j]);
+  }
+  return Status::OK();
+}
+
+}  // namespace gandiva
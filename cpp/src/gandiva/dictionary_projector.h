@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/projector.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Projection of record batches with dictionary-encoded columns.
+///
+/// Expressions refer to a dictionary-encoded column by its value type, e.g. a
+/// column of type dictionary(int32(), utf8()) is referenced as a utf8 field.
+///
+/// An expression whose only input is a single dictionary-encoded column is
+/// evaluated once per batch on the dictionary values, and the result of each
+/// row is then looked up by its index, if the expression is deterministic and
+/// returns null for a null input.  Such results may also be returned
+/// dictionary-encoded, with the indices of the input column.  Other
+/// expressions are evaluated on the decoded columns.
+///
+/// Since all the dictionary values are evaluated, including those not used
+/// by any row of the batch, an error raised for an unused value (e.g. by an
+/// invalid cast) fails the evaluation.
+class GANDIVA_EXPORT DictionaryProjector {
+ public:
+  /// Build a projector with the default configuration, returning decoded outputs.
+  ///
+  /// \param[in] schema schema for the record batches.
+  /// \param[in] exprs vector of expressions.
+  /// \param[out] projector the returned projector object
+  static Status Make(SchemaPtr schema, const ExpressionVector& exprs,
+                     std::shared_ptr<DictionaryProjector>* projector);
+
+  /// Build a projector.
+  ///
+  /// \param[in] schema schema for the record batches.
+  /// \param[in] exprs vector of expressions.
+  /// \param[in] configuration run time configuration.
+  /// \param[in] dictionary_outputs whether the results of the expressions evaluated
+  ///            on the dictionary values are returned dictionary-encoded.
+  /// \param[out] projector the returned projector object
+  static Status Make(SchemaPtr schema, const ExpressionVector& exprs,
+                     std::shared_ptr<Configuration> configuration,
+                     bool dictionary_outputs,
+                     std::shared_ptr<DictionaryProjector>* projector);
+
+  /// Evaluate the specified record batch, and return the output arrays allocated
+  /// from the memory pool 'pool', in the order of the expressions.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays.
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
+  /// Return true if the i-th expression is evaluated on the dictionary values.
+  bool EvaluatesOnDictionary(size_t i) const { return on_dictionary_[i]; }
+
+ private:
+  // Expressions evaluated on the dictionary of the same column
+  struct DictionaryGroup {
+    int field_index;
+    // Schema of the decoded column alone
+    SchemaPtr schema;
+    std::shared_ptr<Projector> projector;
+    std::vector<size_t> expr_indices;
+    std::vector<DataTypePtr> result_types;
+  };
+
+  DictionaryProjector(SchemaPtr schema, bool dictionary_outputs, size_t num_exprs)
+      : schema_(std::move(schema)),
+        dictionary_outputs_(dictionary_outputs),
+        on_dictionary_(num_exprs, false) {}
+
+  Status EvaluateGroup(const DictionaryGroup& group, const arrow::RecordBatch& batch,
+                       arrow::MemoryPool* pool, arrow::ArrayVector* output);
+
+  Status EvaluateDecoded(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                         arrow::ArrayVector* output);
+
+  SchemaPtr schema_;
+  bool dictionary_outputs_;
+  std::vector<bool> on_dictionary_;
+  std::vector<DictionaryGroup> groups_;
+
+  // Projector of the other expressions, on the columns they reference (decoded)
+  std::shared_ptr<Projector> decoded_projector_;
+  SchemaPtr decoded_schema_;
+  std::vector<int> decoded_field_indices_;
+  std::vector<size_t> decoded_expr_indices_;
+};
+
+}  // namespace gandiva
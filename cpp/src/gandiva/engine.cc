@@ -23,6 +23,7 @@
 
 #include "gandiva/engine.h"
 
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -71,6 +72,7 @@
 #include "gandiva/exported_funcs_registry.h"
 
 #include "arrow/util/make_unique.h"
+#include "arrow/util/stopwatch.h"
 
 namespace gandiva {
 
@@ -100,7 +102,8 @@ Engine::Engine(const std::shared_ptr<Configuration>& conf,
       ir_builder_(arrow::internal::make_unique<llvm::IRBuilder<>>(*context_)),
       module_(module),
       types_(*context_),
-      optimize_(conf->optimize()) {}
+      optimize_(conf->optimize()),
+      object_cache_dir_(conf->object_cache_dir()) {}
 
 Status Engine::Init() {
   // Add mappings for functions that can be accessed from LLVM/IR module.
@@ -151,6 +154,10 @@ Status Engine::Make(const std::shared_ptr<Configuration>& conf,
 }
 
 // Handling for pre-compiled IR libraries.
+//
+// The bitcode is parsed lazily: only the declarations of the pre-compiled functions
+// are added to the module, so that the generated code can call them.  The bodies of
+// the functions actually called are materialized and linked in FinalizeModule().
 Status Engine::LoadPreCompiledIR() {
   auto bitcode = llvm::StringRef(reinterpret_cast<const char*>(kPrecompiledBitcode),
                                  kPrecompiledBitcodeSize);
@@ -176,13 +183,44 @@ Status Engine::LoadPreCompiledIR() {
     stream << module_or_error.takeError();
     return Status::CodeGenError(stream.str());
   }
-  std::unique_ptr<llvm::Module> ir_module = move(module_or_error.get());
+  precompiled_module_ = move(module_or_error.get());
 
-  ARROW_RETURN_IF(llvm::verifyModule(*ir_module, &llvm::errs()),
+  ARROW_RETURN_IF(llvm::verifyModule(*precompiled_module_, &llvm::errs()),
                   Status::CodeGenError("verify of IR Module failed"));
-  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, move(ir_module)),
-                  Status::CodeGenError("failed to link IR Modules"));
 
+  for (auto& fn : *precompiled_module_) {
+    if (fn.hasLocalLinkage() || fn.isIntrinsic() ||
+        module_->getNamedValue(fn.getName()) != nullptr) {
+      continue;
+    }
+    auto decl = llvm::Function::Create(fn.getFunctionType(),
+                                       llvm::GlobalValue::ExternalLinkage,
+                                       fn.getName(), module_);
+    decl->copyAttributesFrom(&fn);
+  }
+  return Status::OK();
+}
+
+// Link the pre-compiled functions called by the module, and those they call.
+Status Engine::LinkPreCompiledIR() {
+  // The linker imports the definition of every declaration in the module, so drop
+  // the declarations of the pre-compiled functions that are not called.
+  std::vector<llvm::Function*> unused;
+  for (auto& fn : *module_) {
+    if (fn.isDeclaration() && fn.use_empty()) {
+      auto source = precompiled_module_->getFunction(fn.getName());
+      if (source != nullptr && !source->isDeclaration()) {
+        unused.push_back(&fn);
+      }
+    }
+  }
+  for (auto fn : unused) {
+    fn->eraseFromParent();
+  }
+
+  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, move(precompiled_module_),
+                                            llvm::Linker::Flags::LinkOnlyNeeded),
+                  Status::CodeGenError("failed to link IR Modules"));
   return Status::OK();
 }
 
@@ -210,11 +248,38 @@ Status Engine::RemoveUnusedFunctions() {
   return Status::OK();
 }
 
+// The object code also depends on the pre-compiled IR that was linked in,
+// which may differ between gandiva builds.
+static const std::string& PrecompiledIRHash() {
+  static const std::string hash = std::to_string(std::hash<std::string>()(
+      std::string(reinterpret_cast<const char*>(kPrecompiledBitcode),
+                  kPrecompiledBitcodeSize)));
+  return hash;
+}
+
 // Optimise and compile the module.
 Status Engine::FinalizeModule() {
+  arrow::internal::StopWatch timer;
+  timer.Start();
+  ARROW_RETURN_NOT_OK(LinkPreCompiledIR());
   ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
 
-  if (optimize_) {
+  if (!object_cache_dir_.empty() && !object_cache_key_.empty() &&
+      !object_cache_disabled_) {
+    std::string key = "precompiled " + PrecompiledIRHash() +
+                      (optimize_ ? "; optimized\n" : "; unoptimized\n") +
+                      object_cache_key_;
+    object_cache_.reset(new ObjectCache(object_cache_dir_, key));
+  } else {
+    // Only record the size of the object code
+    object_cache_.reset(new ObjectCache("", ""));
+  }
+  execution_engine_->setObjectCache(object_cache_.get());
+  // MCJIT loads the cached object instead of compiling the module, so the
+  // optimisation passes below would be wasted.
+  const bool cached = object_cache_->HasObject();
+
+  if (optimize_ && !cached) {
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
@@ -241,9 +306,13 @@ Status Engine::FinalizeModule() {
 
   ARROW_RETURN_IF(llvm::verifyModule(*module_, &llvm::errs()),
                   Status::CodeGenError("Module verification failed after optimizer"));
+  optimization_time_ = timer.Stop();
 
   // do the compilation
+  timer.Start();
   execution_engine_->finalizeObject();
+  codegen_time_ = timer.Stop();
+  object_cache_hit_ = cached;
   module_finalized_ = true;
 
   return Status::OK();
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -28,6 +29,7 @@
 #include "gandiva/llvm_includes.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/logging.h"
+#include "gandiva/object_cache.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
@@ -54,9 +56,38 @@ class GANDIVA_EXPORT Engine {
     functions_to_compile_.push_back(fname);
   }
 
-  /// Optimise and compile the module.
+  /// Set the key of the module in the on-disk object cache, if the configuration
+  /// has one.  The key must identify the generated IR, e.g. the expressions and
+  /// the schema they are built for.
+  void SetObjectCacheKey(const std::string& key) {
+    DCHECK(!module_finalized_);
+    object_cache_key_ = key;
+  }
+
+  /// Never cache the module on disk.  Required when the generated code embeds
+  /// pointers or other state that is only valid in the current process.
+  void DisableObjectCache() { object_cache_disabled_ = true; }
+
+  /// Optimise and compile the module, or load its object code from the
+  /// on-disk cache.
   Status FinalizeModule();
 
+  /// Size of the compiled object code, in bytes.
+  int64_t object_code_size() const {
+    DCHECK(module_finalized_);
+    return object_cache_->object_size();
+  }
+
+  /// Time spent linking and optimising the module in FinalizeModule(), in nanoseconds.
+  uint64_t optimization_time() const { return optimization_time_; }
+
+  /// Time spent generating the machine code (or loading it from the object cache)
+  /// in FinalizeModule(), in nanoseconds.
+  uint64_t codegen_time() const { return codegen_time_; }
+
+  /// Whether the machine code was loaded from the on-disk object cache.
+  bool object_cache_hit() const { return object_cache_hit_; }
+
   /// Get the compiled function corresponding to the irfunction.
   void* CompiledFunction(llvm::Function* irFunction);
 
@@ -79,26 +110,41 @@ class GANDIVA_EXPORT Engine {
 
   llvm::ExecutionEngine& execution_engine() { return *execution_engine_; }
 
-  /// load pre-compiled IR modules from precompiled_bitcode.cc and merge them into
-  /// the main module.
+  /// load pre-compiled IR modules from precompiled_bitcode.cc and declare their
+  /// functions in the main module.
   Status LoadPreCompiledIR();
 
+  /// link the pre-compiled functions used by the main module into it.
+  Status LinkPreCompiledIR();
+
   // Create and add mappings for cpp functions that can be accessed from LLVM.
   void AddGlobalMappings();
 
   // Remove unused functions to reduce compile time.
   Status RemoveUnusedFunctions();
 
+  // Declared first, so that it outlives the execution engine
+  std::unique_ptr<ObjectCache> object_cache_;
   std::unique_ptr<llvm::LLVMContext> context_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
   llvm::Module* module_;
+  // Lazily loaded pre-compiled functions, until linked into module_
+  std::unique_ptr<llvm::Module> precompiled_module_;
   LLVMTypes types_;
 
   std::vector<std::string> functions_to_compile_;
 
   bool optimize_ = true;
   bool module_finalized_ = false;
+
+  std::string object_cache_dir_;
+  std::string object_cache_key_;
+  bool object_cache_disabled_ = false;
+
+  uint64_t optimization_time_ = 0;
+  uint64_t codegen_time_ = 0;
+  bool object_cache_hit_ = false;
 };
 
 }  // namespace gandiva
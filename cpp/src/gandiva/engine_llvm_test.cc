@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 #include <functional>
+#include "arrow/util/io_util.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/tests/test_util.h"
 
@@ -128,4 +129,55 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+TEST_F(TestEngine, TestLinksOnlyUsedPreCompiledFunctions) {
+  BuildEngine();
+
+  // The pre-compiled functions are declared, but not yet loaded
+  auto length_fn = engine->module()->getFunction("octet_length_utf8");
+  ASSERT_NE(length_fn, nullptr);
+  EXPECT_TRUE(length_fn->isDeclaration());
+  ASSERT_NE(engine->module()->getFunction("upper_utf8"), nullptr);
+
+  // int32_t call_length(int32_t length) { return octet_length_utf8("", length); }
+  auto types = engine->types();
+  llvm::IRBuilder<>* builder = engine->ir_builder();
+  std::string func_name = "call_length";
+  engine->AddFunctionToCompile(func_name);
+  llvm::FunctionType* prototype =
+      llvm::FunctionType::get(types->i32_type(), {types->i32_type()}, false);
+  llvm::Function* fn = llvm::Function::Create(
+      prototype, llvm::GlobalValue::ExternalLinkage, func_name, engine->module());
+  builder->SetInsertPoint(llvm::BasicBlock::Create(*engine->context(), "entry", fn));
+  llvm::Value* input = llvm::ConstantPointerNull::get(
+      llvm::cast<llvm::PointerType>(length_fn->getFunctionType()->getParamType(0)));
+  builder->CreateRet(builder->CreateCall(length_fn, {input, &*fn->arg_begin()}));
+
+  ASSERT_OK(engine->FinalizeModule());
+  EXPECT_EQ(engine->module()->getFunction("upper_utf8"), nullptr);
+
+  auto call_length = reinterpret_cast<int32_t (*)(int32_t)>(engine->CompiledFunction(fn));
+  EXPECT_EQ(call_length(7), 7);
+}
+
+TEST_F(TestEngine, TestObjectCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       arrow::internal::TemporaryDir::Make("gandiva-object-cache-"));
+  configuration->set_object_cache_dir(temp_dir->path().ToString());
+  int64_t my_array[] = {1, 3, -5, 8, 10};
+
+  for (int i = 0; i < 2; ++i) {
+    // The first engine compiles and stores the object, the second one loads it
+    ASSERT_OK(Engine::Make(configuration, &engine));
+    llvm::Function* ir_func = BuildVecAdd(engine.get());
+    engine->SetObjectCacheKey("add_longs");
+    ASSERT_OK(engine->FinalizeModule());
+    auto add_func =
+        reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+    EXPECT_EQ(add_func(my_array, 5), 17);
+  }
+
+  ObjectCache other_key(temp_dir->path().ToString(), "add_ints");
+  ASSERT_FALSE(other_key.HasObject());
+}
+
 }  // namespace gandiva
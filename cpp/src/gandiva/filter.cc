@@ -17,10 +17,16 @@
 
 #include "gandiva/filter.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/stopwatch.h"
+
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/cache.h"
 #include "gandiva/condition.h"
@@ -39,6 +45,13 @@ Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
 
 Filter::~Filter() {}
 
+static Cache<FilterCacheKey, std::shared_ptr<Filter>>& GetFilterCache() {
+  static Cache<FilterCacheKey, std::shared_ptr<Filter>> cache;
+  return cache;
+}
+
+CacheStats Filter::GetCacheStats() { return GetFilterCache().stats(); }
+
 Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
                     std::shared_ptr<Configuration> configuration,
                     std::shared_ptr<Filter>* filter) {
@@ -47,33 +60,77 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
-  static Cache<FilterCacheKey, std::shared_ptr<Filter>> cache;
+  arrow::internal::StopWatch timer;
+  timer.Start();
+  auto& cache = GetFilterCache();
   FilterCacheKey cache_key(schema, configuration, *(condition.get()));
   auto cachedFilter = cache.GetModule(cache_key);
+  const uint64_t cache_lookup_time = timer.Stop();
   if (cachedFilter != nullptr) {
     *filter = cachedFilter;
     return Status::OK();
   }
 
+  // With background optimisation, start with a quick unoptimised compile
+  const bool optimize_in_background =
+      configuration->optimize() && configuration->background_optimize();
+  auto build_configuration = configuration;
+  if (optimize_in_background) {
+    build_configuration = std::make_shared<Configuration>(*configuration);
+    build_configuration->set_optimize(false);
+  }
+
   // Build LLVM generator, and generate code for the specified expression
   std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(build_configuration, &llvm_gen));
 
   // Run the validation on the expression.
   // Return if the expression is invalid since we will not be able to process further.
   ExprValidator expr_validator(llvm_gen->types(), schema);
   ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+  const std::string object_cache_key = "filter " + cache_key.ToString();
+  llvm_gen->SetObjectCacheKey(object_cache_key);
   ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}, SelectionVector::Mode::MODE_NONE));
 
   // Instantiate the filter with the completely built llvm generator
+  const int64_t object_code_size = llvm_gen->object_code_size();
+  CompileStats compile_stats = llvm_gen->compile_stats();
+  compile_stats.cache_lookup = cache_lookup_time;
   *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
-  cache.PutModule(cache_key, *filter);
+  (*filter)->compile_stats_ = compile_stats;
+
+  if (optimize_in_background) {
+    std::weak_ptr<Filter> weak_filter = *filter;
+    ARROW_RETURN_NOT_OK(LLVMGenerator::BuildInBackground(
+        configuration, {condition}, SelectionVector::Mode::MODE_NONE, object_cache_key,
+        [weak_filter](std::unique_ptr<LLVMGenerator> optimized_gen) {
+          auto filter = weak_filter.lock();
+          if (filter != nullptr) {
+            filter->SetLLVMGenerator(std::move(optimized_gen));
+          }
+        }));
+  }
+  cache.PutModule(cache_key, *filter, object_code_size);
 
   return Status::OK();
 }
 
 Status Filter::Evaluate(const arrow::RecordBatch& batch,
                         std::shared_ptr<SelectionVector> out_selection) {
+  return EvaluateMorsels(batch, std::move(out_selection), /*morsel_size=*/0);
+}
+
+Status Filter::ParallelEvaluate(const arrow::RecordBatch& batch,
+                                std::shared_ptr<SelectionVector> out_selection,
+                                int64_t morsel_size) {
+  ARROW_RETURN_IF(morsel_size <= 0, Status::Invalid("Morsel size must be positive."));
+  return EvaluateMorsels(batch, std::move(out_selection),
+                         arrow::BitUtil::RoundUpToMultipleOf64(morsel_size));
+}
+
+Status Filter::EvaluateMorsels(const arrow::RecordBatch& batch,
+                               std::shared_ptr<SelectionVector> out_selection,
+                               int64_t morsel_size) {
   const auto num_rows = batch.num_rows();
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("RecordBatch schema must expected filter schema"));
@@ -88,12 +145,34 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   LocalBitMapsHolder bitmaps(num_rows, 3 /*local_bitmaps*/);
   int64_t bitmap_size = bitmaps.GetLocalBitMapSize();
 
-  auto validity = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size);
-  auto value = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(1), bitmap_size);
-  auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
-
-  // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  auto llvm_gen = llvm_generator();
+  if (morsel_size == 0 || num_rows <= morsel_size || !llvm_gen->thread_safe()) {
+    auto validity =
+        std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size);
+    auto value = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(1), bitmap_size);
+    auto array_data =
+        arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
+
+    // Execute the expression(s).
+    ARROW_RETURN_NOT_OK(llvm_gen->Execute(batch, {array_data}));
+  } else {
+    // Execute the expression(s) on each morsel, writing to the corresponding bits of
+    // the local bitmaps.  Morsels start on 64-bit boundaries, so that they never
+    // write to the same bitmap words.
+    const int num_morsels = static_cast<int>((num_rows + morsel_size - 1) / morsel_size);
+    ARROW_RETURN_NOT_OK(arrow::internal::ParallelFor(num_morsels, [&](int morsel) {
+      const int64_t offset = morsel * morsel_size;
+      const int64_t length = std::min(morsel_size, num_rows - offset);
+      const int64_t size = arrow::BitUtil::BytesForBits(length);
+      auto validity =
+          std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0) + offset / 8, size);
+      auto value =
+          std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(1) + offset / 8, size);
+      auto array_data =
+          arrow::ArrayData::Make(arrow::boolean(), length, {validity, value});
+      return llvm_gen->Execute(*batch.Slice(offset, length), {array_data});
+    }));
+  }
 
   // Compute the intersection of the value and validity.
   auto result = bitmaps.GetLocalBitMap(2);
@@ -103,6 +182,13 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   return out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
 }
 
-std::string Filter::DumpIR() { return llvm_generator_->DumpIR(); }
+void Filter::SetLLVMGenerator(std::unique_ptr<LLVMGenerator> llvm_generator) {
+  std::shared_ptr<LLVMGenerator> shared(std::move(llvm_generator));
+  std::atomic_store(&llvm_generator_, shared);
+}
+
+constexpr int64_t Filter::kDefaultMorselSize;
+
+std::string Filter::DumpIR() { return llvm_generator()->DumpIR(); }
 
 }  // namespace gandiva
@@ -25,7 +25,9 @@
 #include "arrow/status.h"
 
 #include "gandiva/arrow.h"
+#include "gandiva/cache.h"
 #include "gandiva/condition.h"
+#include "gandiva/compile_stats.h"
 #include "gandiva/configuration.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/visibility.h"
@@ -76,12 +78,56 @@ class GANDIVA_EXPORT Filter {
   Status Evaluate(const arrow::RecordBatch& batch,
                   std::shared_ptr<SelectionVector> out_selection);
 
+  /// Default number of rows evaluated by each task in ParallelEvaluate.
+  static constexpr int64_t kDefaultMorselSize = 16384;
+
+  /// Evaluate the specified record batch like Evaluate, splitting it into morsels of
+  /// 'morsel_size' rows (rounded up to a multiple of 64) that are evaluated in
+  /// parallel on the CPU thread pool.
+  ///
+  /// Small batches, and conditions that use functions with non thread-safe state
+  /// (such as random()), are evaluated serially.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in,out] out_selection the selection array with indices of rows that match
+  ///                the condition.
+  /// \param[in] morsel_size the number of rows evaluated by each task.
+  Status ParallelEvaluate(const arrow::RecordBatch& batch,
+                          std::shared_ptr<SelectionVector> out_selection,
+                          int64_t morsel_size = kDefaultMorselSize);
+
+  /// \brief Time spent in each phase of building this filter
+  ///
+  /// Filters returned from the cache report the build which compiled them.  With
+  /// background optimisation, these are the phases of the quick unoptimised build.
+  const CompileStats& compile_stats() const { return compile_stats_; }
+
   std::string DumpIR();
 
+  /// \brief Statistics of the process-wide cache of built filters
+  ///
+  /// The cache capacity is set with the GANDIVA_CACHE_SIZE environment variable,
+  /// and an optional bound on the total object code size with
+  /// GANDIVA_CACHE_MAX_BYTES.
+  static CacheStats GetCacheStats();
+
  private:
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  // The generator is replaced once background optimisation finishes, and
+  // evaluations in progress keep a reference to the previous one.
+  std::shared_ptr<LLVMGenerator> llvm_generator() const {
+    return std::atomic_load(&llvm_generator_);
+  }
+  void SetLLVMGenerator(std::unique_ptr<LLVMGenerator> llvm_generator);
+
+  // Evaluate in morsels of 'morsel_size' rows, or in one go if it is zero.
+  Status EvaluateMorsels(const arrow::RecordBatch& batch,
+                         std::shared_ptr<SelectionVector> out_selection,
+                         int64_t morsel_size);
+
+  std::shared_ptr<LLVMGenerator> llvm_generator_;
   SchemaPtr schema_;
   std::shared_ptr<Configuration> configuration_;
+  CompileStats compile_stats_;
 };
 
 }  // namespace gandiva
@@ -27,6 +27,10 @@ namespace gandiva {
 class GANDIVA_EXPORT FunctionHolder {
  public:
   virtual ~FunctionHolder() = default;
+
+  /// Whether the holder can be used from several threads at once, e.g. when
+  /// the parts of a batch are evaluated in parallel.
+  virtual bool IsThreadSafe() const { return true; }
 };
 
 using FunctionHolderPtr = std::shared_ptr<FunctionHolder>;
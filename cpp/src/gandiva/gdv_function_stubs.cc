@@ -34,7 +34,7 @@ extern "C" {
 bool gdv_fn_like_utf8_utf8(int64_t ptr, const char* data, int data_len,
                            const char* pattern, int pattern_len) {
   gandiva::LikeHolder* holder = reinterpret_cast<gandiva::LikeHolder*>(ptr);
-  return (*holder)(std::string(data, data_len));
+  return (*holder)(re2::StringPiece(data, data_len));
 }
 
 double gdv_fn_random(int64_t ptr) {
@@ -17,43 +17,79 @@
 
 #include "gandiva/like_holder.h"
 
-#include <regex>
+#include <string>
+
 #include "gandiva/node.h"
 #include "gandiva/regex_util.h"
 
 namespace gandiva {
 
-RE2 LikeHolder::starts_with_regex_(R"((\w|\s)*\.\*)");
-RE2 LikeHolder::ends_with_regex_(R"(\.\*(\w|\s)*)");
-RE2 LikeHolder::is_substr_regex_(R"(\.\*(\w|\s)*\.\*)");
+namespace {
+
+// Kind of a 'like' pattern that needs no regex : a literal string, optionally
+// preceded and/or followed by '%'.
+enum class SimplePattern { kNone, kEquals, kStartsWith, kEndsWith, kContains };
+
+SimplePattern ClassifyPattern(const std::string& sql_pattern, std::string* literal) {
+  auto begin = sql_pattern.find_first_not_of('%');
+  if (begin == std::string::npos) {
+    // Only '%'s, or empty
+    literal->clear();
+    return sql_pattern.empty() ? SimplePattern::kEquals : SimplePattern::kContains;
+  }
+  auto end = sql_pattern.find_last_not_of('%') + 1;
+  *literal = sql_pattern.substr(begin, end - begin);
+  if (literal->find_first_of("%_") != std::string::npos) {
+    return SimplePattern::kNone;
+  }
+
+  bool leading = begin > 0;
+  bool trailing = end < sql_pattern.size();
+  if (leading && trailing) {
+    return SimplePattern::kContains;
+  } else if (leading) {
+    return SimplePattern::kEndsWith;
+  } else if (trailing) {
+    return SimplePattern::kStartsWith;
+  }
+  return SimplePattern::kEquals;
+}
+
+}  // namespace
 
 // Short-circuit pattern matches for the following common sub cases :
-// - starts_with, ends_with and is_substr
+// - equal, starts_with, ends_with and is_substr
+// These are evaluated by the pre-compiled string functions, without a regex.
 const FunctionNode LikeHolder::TryOptimize(const FunctionNode& node) {
   std::shared_ptr<LikeHolder> holder;
   auto status = Make(node, &holder);
   if (status.ok()) {
-    std::string& pattern = holder->pattern_;
-    auto literal_type = node.children().at(1)->return_type();
-
-    if (RE2::FullMatch(pattern, starts_with_regex_)) {
-      auto prefix = pattern.substr(0, pattern.length() - 2);  // trim .*
-      auto prefix_node =
-          std::make_shared<LiteralNode>(literal_type, LiteralHolder(prefix), false);
-      return FunctionNode("starts_with", {node.children().at(0), prefix_node},
-                          node.return_type());
-    } else if (RE2::FullMatch(pattern, ends_with_regex_)) {
-      auto suffix = pattern.substr(2);  // skip .*
-      auto suffix_node =
-          std::make_shared<LiteralNode>(literal_type, LiteralHolder(suffix), false);
-      return FunctionNode("ends_with", {node.children().at(0), suffix_node},
-                          node.return_type());
-    } else if (RE2::FullMatch(pattern, is_substr_regex_)) {
-      auto substr =
-          pattern.substr(2, pattern.length() - 4);  // trim starting and ending .*
-      auto substr_node =
-          std::make_shared<LiteralNode>(literal_type, LiteralHolder(substr), false);
-      return FunctionNode("is_substr", {node.children().at(0), substr_node},
+    auto literal_node = dynamic_cast<LiteralNode*>(node.children().at(1).get());
+    const auto& sql_pattern = arrow::util::get<std::string>(literal_node->holder());
+    auto literal_type = literal_node->return_type();
+
+    std::string literal;
+    const char* function_name = nullptr;
+    switch (ClassifyPattern(sql_pattern, &literal)) {
+      case SimplePattern::kEquals:
+        function_name = "equal";
+        break;
+      case SimplePattern::kStartsWith:
+        function_name = "starts_with";
+        break;
+      case SimplePattern::kEndsWith:
+        function_name = "ends_with";
+        break;
+      case SimplePattern::kContains:
+        function_name = "is_substr";
+        break;
+      case SimplePattern::kNone:
+        break;
+    }
+    if (function_name != nullptr) {
+      auto arg_node =
+          std::make_shared<LiteralNode>(literal_type, LiteralHolder(literal), false);
+      return FunctionNode(function_name, {node.children().at(0), arg_node},
                           node.return_type());
     }
   }
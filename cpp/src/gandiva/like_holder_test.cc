@@ -110,6 +110,24 @@ TEST_F(TestLikeHolder, TestOptimise) {
   EXPECT_EQ(fnode.descriptor()->name(), "is_substr");
   EXPECT_EQ(fnode.ToString(), "bool is_substr((string) in, (const string) abc)");
 
+  // optimise for 'equal'
+  fnode = LikeHolder::TryOptimize(BuildLike("xyz"));
+  EXPECT_EQ(fnode.descriptor()->name(), "equal");
+  EXPECT_EQ(fnode.ToString(), "bool equal((string) in, (const string) xyz)");
+
+  // non-word chars do not need a regex either
+  fnode = LikeHolder::TryOptimize(BuildLike("%a.b-c*%"));
+  EXPECT_EQ(fnode.descriptor()->name(), "is_substr");
+  EXPECT_EQ(fnode.ToString(), "bool is_substr((string) in, (const string) a.b-c*)");
+
+  fnode = LikeHolder::TryOptimize(BuildLike("%%abc%%"));
+  EXPECT_EQ(fnode.descriptor()->name(), "is_substr");
+  EXPECT_EQ(fnode.ToString(), "bool is_substr((string) in, (const string) abc)");
+
+  fnode = LikeHolder::TryOptimize(BuildLike("%"));
+  EXPECT_EQ(fnode.descriptor()->name(), "is_substr");
+  EXPECT_EQ(fnode.ToString(), "bool is_substr((string) in, (const string) )");
+
   // no optimisation for others.
   fnode = LikeHolder::TryOptimize(BuildLike("xyz_"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
@@ -125,6 +143,9 @@ TEST_F(TestLikeHolder, TestOptimise) {
 
   fnode = LikeHolder::TryOptimize(BuildLike("x_yz%"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
+
+  fnode = LikeHolder::TryOptimize(BuildLike("%x%yz%"));
+  EXPECT_EQ(fnode.descriptor()->name(), "like");
 }
 
 }  // namespace gandiva
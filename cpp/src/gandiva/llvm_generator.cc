@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "gandiva/bitmap_accumulator.h"
+#include "gandiva/common_subexpr.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/dex.h"
 #include "gandiva/expr_decomposer.h"
@@ -32,6 +33,9 @@
 #include "gandiva/function_registry.h"
 #include "gandiva/lvalue.h"
 
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/thread_pool.h"
+
 namespace gandiva {
 
 #define ADD_TRACE(...)     \
@@ -45,7 +49,10 @@ Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
                            std::unique_ptr<LLVMGenerator>* llvm_generator) {
   std::unique_ptr<LLVMGenerator> llvmgen_obj(new LLVMGenerator());
 
+  arrow::internal::StopWatch timer;
+  timer.Start();
   ARROW_RETURN_NOT_OK(Engine::Make(config, &(llvmgen_obj->engine_)));
+  llvmgen_obj->engine_setup_time_ = timer.Stop();
   *llvm_generator = std::move(llvmgen_obj);
 
   return Status::OK();
@@ -54,15 +61,20 @@ Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
 Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output) {
   int idx = static_cast<int>(compiled_exprs_.size());
   // decompose the expression to separate out value and validities.
+  arrow::internal::StopWatch timer;
+  timer.Start();
   ExprDecomposer decomposer(function_registry_, annotator_);
   ValueValidityPairPtr value_validity;
   ARROW_RETURN_NOT_OK(decomposer.Decompose(*expr->root(), &value_validity));
+  decomposition_time_ += timer.Stop();
   // Generate the IR function for the decomposed expression.
+  timer.Start();
   std::unique_ptr<CompiledExpr> compiled_expr(new CompiledExpr(value_validity, output));
   llvm::Function* ir_function = nullptr;
   ARROW_RETURN_NOT_OK(CodeGenExprValue(value_validity->value_expr(),
                                        annotator_.buffer_count(), output, idx,
                                        &ir_function, selection_vector_mode_));
+  ir_generation_time_ += timer.Stop();
   compiled_expr->SetIRFunction(selection_vector_mode_, ir_function);
 
   compiled_exprs_.push_back(std::move(compiled_expr));
@@ -72,7 +84,24 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
 /// Build and optimise module for projection expression.
 Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode mode) {
   selection_vector_mode_ = mode;
-  for (auto& expr : exprs) {
+
+  // Compute the subtrees shared by several expressions only once, into intermediate
+  // arrays.  With a selection vector, outputs are only written at the selected
+  // positions, so they cannot be read back as inputs.
+  ExpressionVector intermediates;
+  ExpressionVector rewritten_exprs;
+  if (mode == SelectionVector::Mode::MODE_NONE) {
+    CommonSubexprEliminator::Rewrite(exprs, &intermediates, &rewritten_exprs);
+  } else {
+    rewritten_exprs = exprs;
+  }
+  for (auto& expr : intermediates) {
+    auto output = annotator_.AddIntermediateFieldDescriptor(expr->result());
+    ARROW_RETURN_NOT_OK(Add(expr, output));
+    intermediate_fields_.push_back(expr->result());
+  }
+
+  for (auto& expr : rewritten_exprs) {
     auto output = annotator_.AddOutputFieldDescriptor(expr->result());
     ARROW_RETURN_NOT_OK(Add(expr, output));
   }
@@ -90,6 +119,48 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode
   return Status::OK();
 }
 
+Status LLVMGenerator::BuildInBackground(
+    std::shared_ptr<Configuration> config, ExpressionVector exprs,
+    SelectionVector::Mode mode, std::string object_cache_key,
+    std::function<void(std::unique_ptr<LLVMGenerator>)> on_built) {
+  return arrow::internal::GetCpuThreadPool()->Spawn([=]() {
+    std::unique_ptr<LLVMGenerator> llvm_gen;
+    if (!LLVMGenerator::Make(config, &llvm_gen).ok()) {
+      return;
+    }
+    llvm_gen->SetObjectCacheKey(object_cache_key);
+    if (!llvm_gen->Build(exprs, mode).ok()) {
+      return;
+    }
+    on_built(std::move(llvm_gen));
+  });
+}
+
+CompileStats LLVMGenerator::compile_stats() const {
+  CompileStats stats;
+  stats.engine_setup = engine_setup_time_;
+  stats.decomposition = decomposition_time_;
+  stats.ir_generation = ir_generation_time_;
+  stats.optimization = engine_->optimization_time();
+  stats.codegen = engine_->codegen_time();
+  stats.object_cache_hit = engine_->object_cache_hit();
+  return stats;
+}
+
+// Allocate the array of an intermediate (fixed-width) field.
+static Status AllocIntermediate(const DataTypePtr& type, int64_t num_records,
+                                ArrayDataPtr* out) {
+  auto pool = arrow::default_memory_pool();
+  const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*type);
+  const int64_t bitmap_size = arrow::BitUtil::BytesForBits(num_records);
+  const int64_t data_size =
+      arrow::BitUtil::BytesForBits(num_records * fw_type.bit_width());
+  ARROW_ASSIGN_OR_RAISE(auto bitmap, arrow::AllocateBuffer(bitmap_size, pool));
+  ARROW_ASSIGN_OR_RAISE(auto data, arrow::AllocateBuffer(data_size, pool));
+  *out = arrow::ArrayData::Make(type, num_records, {std::move(bitmap), std::move(data)});
+  return Status::OK();
+}
+
 /// Execute the compiled module against the provided vectors.
 Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) {
@@ -103,7 +174,19 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) {
   DCHECK_GT(record_batch.num_rows(), 0);
 
-  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
+  // The intermediate arrays come first, in the order of their descriptors.
+  ArrayDataVector all_outputs;
+  if (!intermediate_fields_.empty()) {
+    for (auto& field : intermediate_fields_) {
+      ArrayDataPtr array_data;
+      ARROW_RETURN_NOT_OK(
+          AllocIntermediate(field->type(), record_batch.num_rows(), &array_data));
+      all_outputs.push_back(std::move(array_data));
+    }
+    all_outputs.insert(all_outputs.end(), output_vector.begin(), output_vector.end());
+  }
+  auto eval_batch = annotator_.PrepareEvalBatch(
+      record_batch, intermediate_fields_.empty() ? output_vector : all_outputs);
   DCHECK_GT(eval_batch->GetNumBuffers(), 0);
 
   auto mode = SelectionVector::MODE_NONE;
@@ -686,6 +769,7 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = arrow::util::get<std::string>(dex.holder());
 
+      generator_->engine_->DisableObjectCache();
       llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
       value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
       len = types->i32_constant(static_cast<int32_t>(str.length()));
@@ -1042,6 +1126,7 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
 
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
+  generator_->engine_->DisableObjectCache();
   llvm::Constant* ptr_int_cast =
       types->i64_constant((int64_t)(dex_instance.in_holder().get()));
   params.push_back(ptr_int_cast);
@@ -1209,6 +1294,11 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
+    // the pointer is only valid in this process
+    generator_->engine_->DisableObjectCache();
+    if (!holder->IsThreadSafe()) {
+      generator_->thread_safe_ = false;
+    }
     auto ptr = types->i64_constant((int64_t)holder);
     params.push_back(ptr);
   }
@@ -1355,6 +1445,7 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
 
   // cast this to an llvm pointer.
   const char* str = trace_strings_.back().c_str();
+  engine_->DisableObjectCache();
   llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
   llvm::Constant* str_ptr_cast =
       llvm::ConstantExpr::getIntToPtr(str_int_cast, types()->i8_ptr_type());
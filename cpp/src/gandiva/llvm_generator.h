@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -25,6 +26,7 @@
 #include "arrow/util/macros.h"
 
 #include "gandiva/annotator.h"
+#include "gandiva/compile_stats.h"
 #include "gandiva/compiled_expr.h"
 #include "gandiva/configuration.h"
 #include "gandiva/dex_visitor.h"
@@ -53,6 +55,13 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs, SelectionVector::Mode mode);
 
+  /// \brief Make and build a generator on the CPU thread pool, then pass it to
+  /// `on_built`.  If building fails, `on_built` is not called.
+  static Status BuildInBackground(
+      std::shared_ptr<Configuration> config, ExpressionVector exprs,
+      SelectionVector::Mode mode, std::string object_cache_key,
+      std::function<void(std::unique_ptr<LLVMGenerator>)> on_built);
+
   /// \brief Build the code for the expression trees for default mode. Each
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs) {
@@ -70,6 +79,21 @@ class GANDIVA_EXPORT LLVMGenerator {
                  const SelectionVector* selection_vector,
                  const ArrayDataVector& output_vector);
 
+  /// \brief Set the key of the generated module in the on-disk object cache,
+  /// if the configuration has one.  Must be called before Build().
+  void SetObjectCacheKey(const std::string& key) { engine_->SetObjectCacheKey(key); }
+
+  /// \brief Whether Execute() can be called concurrently on different parts of a
+  /// batch.
+  bool thread_safe() const { return thread_safe_; }
+
+  /// \brief Time spent in each phase of building the generator (the cache lookup
+  /// is left to the caller).
+  CompileStats compile_stats() const;
+
+  /// \brief Size of the compiled object code, in bytes.
+  int64_t object_code_size() const { return engine_->object_code_size(); }
+
   SelectionVector::Mode selection_vector_mode() { return selection_vector_mode_; }
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
@@ -241,6 +265,13 @@ class GANDIVA_EXPORT LLVMGenerator {
   FunctionRegistry function_registry_;
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
+  bool thread_safe_ = true;
+  // Fields computed once for several expressions, see CommonSubexprEliminator
+  FieldVector intermediate_fields_;
+
+  uint64_t engine_setup_time_ = 0;
+  uint64_t decomposition_time_ = 0;
+  uint64_t ir_generation_time_ = 0;
 
   // used for debug
   bool enable_ir_traces_;
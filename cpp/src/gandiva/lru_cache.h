@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <unordered_map>
 #include <utility>
@@ -26,7 +27,11 @@
 // modified from boost LRU cache -> the boost cache supported only an
 // ordered map.
 namespace gandiva {
-// a cache which evicts the least recently used item when it is full
+// a cache which evicts the least recently used item when it is full.
+//
+// Optionally, items are given a size when inserted, and the cache also evicts
+// items when their total size exceeds `max_size` (a negative `max_size` means
+// no bound).  The most recently inserted item is never evicted.
 template <class Key, class Value>
 class LruCache {
  public:
@@ -39,11 +44,15 @@ class LruCache {
       return i.Hash();
     }
   };
-  using map_type =
-      std::unordered_map<key_type, std::pair<value_type, typename list_type::iterator>,
-                         hasher>;
+  struct entry_type {
+    value_type value;
+    int64_t size;
+    typename list_type::iterator position_in_lru_list;
+  };
+  using map_type = std::unordered_map<key_type, entry_type, hasher>;
 
-  explicit LruCache(size_t capacity) : cache_capacity_(capacity) {}
+  explicit LruCache(size_t capacity, int64_t max_size = -1)
+      : cache_capacity_(capacity), max_size_(max_size) {}
 
   ~LruCache() {}
 
@@ -51,22 +60,34 @@ class LruCache {
 
   size_t capacity() const { return cache_capacity_; }
 
+  // total size of the items, as given to insert()
+  int64_t total_size() const { return total_size_; }
+
+  // number of items evicted so far
+  uint64_t evictions() const { return evictions_; }
+
   bool empty() const { return map_.empty(); }
 
   bool contains(const key_type& key) { return map_.find(key) != map_.end(); }
 
-  void insert(const key_type& key, const value_type& value) {
+  void insert(const key_type& key, const value_type& value, int64_t item_size = 0) {
     typename map_type::iterator i = map_.find(key);
     if (i == map_.end()) {
       // insert item into the cache, but first check if it is full
-      if (size() >= cache_capacity_) {
+      if (size() >= cache_capacity_ && !map_.empty()) {
         // cache is full, evict the least recently used item
         evict();
       }
 
       // insert the new item
       lru_list_.push_front(key);
-      map_[key] = std::make_pair(value, lru_list_.begin());
+      map_.emplace(key, entry_type{value, item_size, lru_list_.begin()});
+      total_size_ += item_size;
+
+      // then evict older items until the size bound is satisfied
+      while (max_size_ >= 0 && total_size_ > max_size_ && size() > 1) {
+        evict();
+      }
     }
   }
 
@@ -78,44 +99,39 @@ class LruCache {
       return arrow::util::nullopt;
     }
 
-    // return the value, but first update its place in the most
-    // recently used list
-    typename list_type::iterator position_in_lru_list = value_for_key->second.second;
+    // return the value, but first move the item to the front of the most
+    // recently used list (splicing keeps the iterator in the map valid)
+    typename list_type::iterator position_in_lru_list =
+        value_for_key->second.position_in_lru_list;
     if (position_in_lru_list != lru_list_.begin()) {
-      // move item to the front of the most recently used list
-      lru_list_.erase(position_in_lru_list);
-      lru_list_.push_front(key);
-
-      // update iterator in map
-      position_in_lru_list = lru_list_.begin();
-      const value_type& value = value_for_key->second.first;
-      map_[key] = std::make_pair(value, position_in_lru_list);
-
-      // return the value
-      return value;
-    } else {
-      // the item is already at the front of the most recently
-      // used list so just return it
-      return value_for_key->second.first;
+      lru_list_.splice(lru_list_.begin(), lru_list_, position_in_lru_list);
     }
+    return value_for_key->second.value;
   }
 
   void clear() {
     map_.clear();
     lru_list_.clear();
+    total_size_ = 0;
   }
 
  private:
   void evict() {
     // evict item from the end of most recently used list
     typename list_type::iterator i = --lru_list_.end();
-    map_.erase(*i);
+    typename map_type::iterator entry = map_.find(*i);
+    total_size_ -= entry->second.size;
+    map_.erase(entry);
     lru_list_.erase(i);
+    ++evictions_;
   }
 
  private:
   map_type map_;
   list_type lru_list_;
   size_t cache_capacity_;
+  int64_t max_size_;
+  int64_t total_size_ = 0;
+  uint64_t evictions_ = 0;
 };
 }  // namespace gandiva
@@ -18,11 +18,14 @@
 #include "gandiva/lru_cache.h"
 
 #include <map>
+#include <memory>
 #include <string>
 #include <typeinfo>
 
 #include <gtest/gtest.h>
 
+#include "gandiva/cache.h"
+
 namespace gandiva {
 
 class TestCacheKey {
@@ -61,4 +64,38 @@ TEST_F(TestLruCache, TestLruBehavior) {
   // should have evicted key 2.
   ASSERT_EQ(*cache_.get(TestCacheKey(1)), "hello");
 }
+
+TEST_F(TestLruCache, TestSizeBound) {
+  LruCache<TestCacheKey, std::string> cache(10, /*max_size=*/100);
+  cache.insert(TestCacheKey(1), "a", 40);
+  cache.insert(TestCacheKey(2), "b", 40);
+  cache.get(TestCacheKey(1));
+  cache.insert(TestCacheKey(3), "c", 40);
+  // should have evicted key 2 to stay within the size bound
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(80, cache.total_size());
+  ASSERT_EQ(1, cache.evictions());
+  ASSERT_EQ(cache.get(TestCacheKey(2)), arrow::util::nullopt);
+
+  // an item larger than the bound evicts everything else
+  cache.insert(TestCacheKey(4), "d", 200);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(*cache.get(TestCacheKey(4)), "d");
+}
+
+TEST(TestCache, TestStats) {
+  Cache<TestCacheKey, std::shared_ptr<std::string>> cache(64);
+  for (int i = 0; i < 100; ++i) {
+    cache.PutModule(TestCacheKey(i), std::make_shared<std::string>("hello"), 10);
+  }
+  ASSERT_EQ(*cache.GetModule(TestCacheKey(99)), "hello");
+  ASSERT_EQ(cache.GetModule(TestCacheKey(1000)), nullptr);
+
+  auto stats = cache.stats();
+  ASSERT_EQ(1, stats.hits);
+  ASSERT_EQ(1, stats.misses);
+  ASSERT_EQ(100, stats.entries + static_cast<int64_t>(stats.evictions));
+  ASSERT_LE(stats.entries, 64);
+  ASSERT_EQ(stats.entries * 10, stats.size);
+}
 }  // namespace gandiva
@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace gandiva {
+
+namespace {
+
+// Describe what the generated object code depends on, besides the module itself.
+std::string TargetDescription() {
+  std::stringstream ss;
+  ss << "llvm " << LLVM_VERSION_STRING << "; cpu " << llvm::sys::getHostCPUName().str()
+     << ";";
+
+  llvm::StringMap<bool> features_map;
+  if (llvm::sys::getHostCPUFeatures(features_map)) {
+    std::vector<std::string> features;
+    for (auto& entry : features_map) {
+      features.push_back((entry.getValue() ? "+" : "-") + entry.getKey().str());
+    }
+    std::sort(features.begin(), features.end());
+    for (auto& feature : features) {
+      ss << " " << feature;
+    }
+  }
+  return ss.str();
+}
+
+const std::string& CachedTargetDescription() {
+  static const std::string description = TargetDescription();
+  return description;
+}
+
+}  // namespace
+
+ObjectCache::ObjectCache(const std::string& directory, const std::string& module_key)
+    : directory_(directory) {
+  if (directory_.empty()) {
+    return;
+  }
+  key_ = CachedTargetDescription() + "\n" + module_key;
+  // The terminating NUL separates the key from the object code in the file
+  key_.push_back('\0');
+
+  char name[32];
+  snprintf(name, sizeof(name), "gandiva-%016llx.o",
+           static_cast<unsigned long long>(std::hash<std::string>()(key_)));  // NOLINT
+  llvm::SmallString<256> path(directory_);
+  llvm::sys::path::append(path, name);
+  path_ = path.str().str();
+}
+
+bool ObjectCache::HasObject() {
+  if (looked_up_) {
+    return object_ != nullptr;
+  }
+  looked_up_ = true;
+  if (directory_.empty()) {
+    return false;
+  }
+
+  auto file_or_error = llvm::MemoryBuffer::getFile(path_);
+  if (!file_or_error) {
+    return false;
+  }
+  llvm::StringRef contents = file_or_error.get()->getBuffer();
+  if (!contents.startswith(key_) || contents.size() == key_.size()) {
+    // Collision or corrupt entry, it will be overwritten after compiling
+    return false;
+  }
+  object_ = llvm::MemoryBuffer::getMemBufferCopy(contents.substr(key_.size()), path_);
+  return true;
+}
+
+void ObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                       llvm::MemoryBufferRef object) {
+  object_size_ = static_cast<int64_t>(object.getBufferSize());
+  if (directory_.empty() || object_ != nullptr) {
+    // Loaded from the cache, nothing new to store
+    return;
+  }
+  if (llvm::sys::fs::create_directories(directory_)) {
+    return;
+  }
+
+  // Write to a unique temporary file then rename it, so that concurrent
+  // readers and writers never see a partial entry.
+  int fd;
+  llvm::SmallString<256> temp_path;
+  if (llvm::sys::fs::createUniqueFile(path_ + ".tmp-%%%%%%%%", fd, temp_path)) {
+    return;
+  }
+  bool ok;
+  {
+    llvm::raw_fd_ostream stream(fd, /*shouldClose=*/true);
+    stream << key_ << object.getBuffer();
+    stream.close();
+    ok = !stream.has_error();
+    stream.clear_error();
+  }
+  if (!ok || llvm::sys::fs::rename(temp_path, path_)) {
+    llvm::sys::fs::remove(temp_path);
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> ObjectCache::getObject(const llvm::Module* module) {
+  if (!HasObject()) {
+    return nullptr;
+  }
+  object_size_ = static_cast<int64_t>(object_->getBufferSize());
+  // MCJIT takes ownership of the returned buffer, keep our own copy in case
+  // the same module is compiled again.
+  return llvm::MemoryBuffer::getMemBufferCopy(object_->getBuffer(),
+                                              object_->getBufferIdentifier());
+}
+
+}  // namespace gandiva
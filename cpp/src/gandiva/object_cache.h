@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief On-disk cache of the object code generated for a module.
+///
+/// Each entry is a file in the cache directory, named after a hash of the
+/// module key.  The key is extended with the LLVM version and the host CPU
+/// name and features, since the object code is only valid for those.  The
+/// full key is stored at the start of the file and checked on lookup, so that
+/// hash collisions and stale entries are treated as misses.
+///
+/// I/O errors are never fatal: a failed lookup is a miss, and a failed store
+/// only means the module is compiled again next time.
+///
+/// If `directory` is empty, nothing is cached and the object only records the
+/// size of the generated object code.
+class GANDIVA_EXPORT ObjectCache : public llvm::ObjectCache {
+ public:
+  ObjectCache(const std::string& directory, const std::string& module_key);
+
+  /// Return true if a valid object exists for the module key.  The object is
+  /// loaded and kept for getObject(), so that optimizing the IR can be skipped.
+  bool HasObject();
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+  /// Size of the object code compiled or loaded for the module, in bytes
+  int64_t object_size() const { return object_size_; }
+
+ private:
+  std::string directory_;
+  std::string key_;
+  std::string path_;
+  bool looked_up_ = false;
+  int64_t object_size_ = 0;
+  std::unique_ptr<llvm::MemoryBuffer> object_;
+};
+
+}  // namespace gandiva
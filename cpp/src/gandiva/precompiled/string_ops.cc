@@ -99,10 +99,26 @@ bool ends_with_utf8_utf8(const char* data, gdv_int32 data_len, const char* suffi
 FORCE_INLINE
 bool is_substr_utf8_utf8(const char* data, int32_t data_len, const char* substr,
                          int32_t substr_len) {
-  for (int32_t i = 0; i <= data_len - substr_len; ++i) {
-    if (memcmp(data + i, substr, substr_len) == 0) {
+  if (substr_len == 0) {
+    return true;
+  }
+  if (data_len < substr_len) {
+    return false;
+  }
+  // Scan for the first char of substr with memchr (which is vectorised in libc), and
+  // only compare the rest at those positions.
+  const char* candidate = data;
+  const char* last_candidate = data + data_len - substr_len;
+  while (candidate <= last_candidate) {
+    candidate = static_cast<const char*>(
+        memchr(candidate, substr[0], last_candidate - candidate + 1));
+    if (candidate == nullptr) {
+      return false;
+    }
+    if (memcmp(candidate + 1, substr + 1, substr_len - 1) == 0) {
       return true;
     }
+    ++candidate;
   }
   return false;
 }
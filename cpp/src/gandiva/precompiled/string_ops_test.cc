@@ -62,6 +62,11 @@ TEST(TestStringOps, TestIsSubstr) {
   EXPECT_FALSE(is_substr_utf8_utf8("hel", 3, "hello", 5));
   EXPECT_TRUE(is_substr_utf8_utf8("hello", 5, "hello", 5));
   EXPECT_TRUE(is_substr_utf8_utf8("hello world", 11, "", 0));
+  EXPECT_TRUE(is_substr_utf8_utf8("hhhello", 7, "hhe", 3));
+  EXPECT_TRUE(is_substr_utf8_utf8("hello world", 11, "d", 1));
+  EXPECT_FALSE(is_substr_utf8_utf8("hello world", 11, "dx", 2));
+  EXPECT_FALSE(is_substr_utf8_utf8("hello world", 10, "world", 5));
+  EXPECT_FALSE(is_substr_utf8_utf8("", 0, "a", 1));
 }
 
 TEST(TestStringOps, TestCharLength) {
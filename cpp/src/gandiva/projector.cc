@@ -17,10 +17,17 @@
 
 #include "gandiva/projector.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/stopwatch.h"
+
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
@@ -38,6 +45,13 @@ Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr sc
 
 Projector::~Projector() {}
 
+static Cache<ProjectorCacheKey, std::shared_ptr<Projector>>& GetProjectorCache() {
+  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
+  return cache;
+}
+
+CacheStats Projector::GetCacheStats() { return GetProjectorCache().stats(); }
+
 Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                        std::shared_ptr<Projector>* projector) {
   return Projector::Make(schema, exprs, SelectionVector::Mode::MODE_NONE,
@@ -61,17 +75,29 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                   Status::Invalid("Configuration cannot be null"));
 
   // see if equivalent projector was already built
-  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
+  arrow::internal::StopWatch timer;
+  timer.Start();
+  auto& cache = GetProjectorCache();
   ProjectorCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
   std::shared_ptr<Projector> cached_projector = cache.GetModule(cache_key);
+  const uint64_t cache_lookup_time = timer.Stop();
   if (cached_projector != nullptr) {
     *projector = cached_projector;
     return Status::OK();
   }
 
+  // With background optimisation, start with a quick unoptimised compile
+  const bool optimize_in_background =
+      configuration->optimize() && configuration->background_optimize();
+  auto build_configuration = configuration;
+  if (optimize_in_background) {
+    build_configuration = std::make_shared<Configuration>(*configuration);
+    build_configuration->set_optimize(false);
+  }
+
   // Build LLVM generator, and generate code for the specified expressions
   std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(build_configuration, &llvm_gen));
 
   // Run the validation on the expressions.
   // Return if any of the expression is invalid since
@@ -81,6 +107,10 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
   }
 
+  const std::string object_cache_key = "projector " +
+                                       std::to_string(selection_vector_mode) + " " +
+                                       cache_key.ToString();
+  llvm_gen->SetObjectCacheKey(object_cache_key);
   ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
 
   // save the output field types. Used for validation at Evaluate() time.
@@ -91,9 +121,25 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
   }
 
   // Instantiate the projector with the completely built llvm generator
+  const int64_t object_code_size = llvm_gen->object_code_size();
+  CompileStats compile_stats = llvm_gen->compile_stats();
+  compile_stats.cache_lookup = cache_lookup_time;
   *projector = std::shared_ptr<Projector>(
       new Projector(std::move(llvm_gen), schema, output_fields, configuration));
-  cache.PutModule(cache_key, *projector);
+  (*projector)->compile_stats_ = compile_stats;
+
+  if (optimize_in_background) {
+    std::weak_ptr<Projector> weak_projector = *projector;
+    ARROW_RETURN_NOT_OK(LLVMGenerator::BuildInBackground(
+        configuration, exprs, selection_vector_mode, object_cache_key,
+        [weak_projector](std::unique_ptr<LLVMGenerator> optimized_gen) {
+          auto projector = weak_projector.lock();
+          if (projector != nullptr) {
+            projector->SetLLVMGenerator(std::move(optimized_gen));
+          }
+        }));
+  }
+  cache.PutModule(cache_key, *projector, object_code_size);
 
   return Status::OK();
 }
@@ -130,7 +176,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
         ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
     ++idx;
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  return llvm_generator()->Execute(batch, selection_vector, output_data_vecs);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -158,7 +204,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 
   // Execute the expression(s).
   ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+      llvm_generator()->Execute(batch, selection_vector, output_data_vecs));
 
   // Create and return array arrays.
   output->clear();
@@ -168,6 +214,91 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   return Status::OK();
 }
 
+constexpr int64_t Projector::kDefaultMorselSize;
+
+// View rows [offset, offset + length) of a fixed-width output array as a separate
+// array starting at offset zero.  'offset' must be a multiple of 64, so that the
+// generated code for different morsels never writes to the same bitmap words.
+static ArrayDataPtr SliceFixedWidthOutput(const arrow::ArrayData& array_data,
+                                          int64_t offset, int64_t length) {
+  DCHECK_EQ(offset % 64, 0);
+  const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*array_data.type);
+  const int64_t bit_width = fw_type.bit_width();
+  auto bitmap = arrow::SliceMutableBuffer(array_data.buffers[0], offset / 8,
+                                          arrow::BitUtil::BytesForBits(length));
+  auto data = arrow::SliceMutableBuffer(
+      array_data.buffers[1], offset * bit_width / 8,
+      arrow::BitUtil::BytesForBits(length * bit_width));
+  return arrow::ArrayData::Make(array_data.type, length, {bitmap, data});
+}
+
+Status Projector::ParallelEvaluate(const arrow::RecordBatch& batch,
+                                   arrow::MemoryPool* pool, arrow::ArrayVector* output,
+                                   int64_t morsel_size) {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+  ARROW_RETURN_IF(morsel_size <= 0, Status::Invalid("Morsel size must be positive."));
+
+  morsel_size = arrow::BitUtil::RoundUpToMultipleOf64(morsel_size);
+  const int64_t num_rows = batch.num_rows();
+  // Keep the same generator for all morsels, even if an optimised one is swapped in
+  auto llvm_gen = llvm_generator();
+  if (num_rows <= morsel_size || !llvm_gen->thread_safe()) {
+    return Evaluate(batch, pool, output);
+  }
+  const int num_morsels = static_cast<int>((num_rows + morsel_size - 1) / morsel_size);
+
+  // Allocate the fixed-width outputs for the whole batch, and make room for the
+  // var-len output chunks.
+  const size_t num_outputs = output_fields_.size();
+  ArrayDataVector whole_outputs(num_outputs);
+  std::vector<arrow::ArrayVector> output_chunks(num_outputs);
+  for (size_t i = 0; i < num_outputs; ++i) {
+    const auto& type = output_fields_[i]->type();
+    if (arrow::is_binary_like(type->id())) {
+      output_chunks[i].resize(num_morsels);
+    } else {
+      ARROW_RETURN_NOT_OK(AllocArrayData(type, num_rows, pool, &whole_outputs[i]));
+    }
+  }
+
+  ARROW_RETURN_NOT_OK(arrow::internal::ParallelFor(num_morsels, [&](int morsel) {
+    const int64_t offset = morsel * morsel_size;
+    const int64_t length = std::min(morsel_size, num_rows - offset);
+
+    ArrayDataVector morsel_outputs(num_outputs);
+    for (size_t i = 0; i < num_outputs; ++i) {
+      if (whole_outputs[i] != nullptr) {
+        morsel_outputs[i] = SliceFixedWidthOutput(*whole_outputs[i], offset, length);
+      } else {
+        ARROW_RETURN_NOT_OK(AllocArrayData(output_fields_[i]->type(), length, pool,
+                                           &morsel_outputs[i]));
+      }
+    }
+    ARROW_RETURN_NOT_OK(llvm_gen->Execute(*batch.Slice(offset, length), morsel_outputs));
+
+    for (size_t i = 0; i < num_outputs; ++i) {
+      if (whole_outputs[i] == nullptr) {
+        output_chunks[i][morsel] = arrow::MakeArray(morsel_outputs[i]);
+      }
+    }
+    return Status::OK();
+  }));
+
+  output->clear();
+  for (size_t i = 0; i < num_outputs; ++i) {
+    if (whole_outputs[i] != nullptr) {
+      output->push_back(arrow::MakeArray(whole_outputs[i]));
+    } else {
+      std::shared_ptr<arrow::Array> concatenated;
+      ARROW_RETURN_NOT_OK(arrow::Concatenate(output_chunks[i], pool, &concatenated));
+      output->push_back(std::move(concatenated));
+    }
+  }
+  return Status::OK();
+}
+
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
@@ -264,6 +395,11 @@ Status Projector::ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
   return Status::OK();
 }
 
-std::string Projector::DumpIR() { return llvm_generator_->DumpIR(); }
+void Projector::SetLLVMGenerator(std::unique_ptr<LLVMGenerator> llvm_generator) {
+  std::shared_ptr<LLVMGenerator> shared(std::move(llvm_generator));
+  std::atomic_store(&llvm_generator_, shared);
+}
+
+std::string Projector::DumpIR() { return llvm_generator()->DumpIR(); }
 
 }  // namespace gandiva
@@ -25,6 +25,8 @@
 #include "arrow/status.h"
 
 #include "gandiva/arrow.h"
+#include "gandiva/cache.h"
+#include "gandiva/compile_stats.h"
 #include "gandiva/configuration.h"
 #include "gandiva/expression.h"
 #include "gandiva/selection_vector.h"
@@ -117,8 +119,41 @@ class GANDIVA_EXPORT Projector {
   Status Evaluate(const arrow::RecordBatch& batch,
                   const SelectionVector* selection_vector, const ArrayDataVector& output);
 
+  /// Default number of rows evaluated by each task in ParallelEvaluate.
+  static constexpr int64_t kDefaultMorselSize = 16384;
+
+  /// Evaluate the specified record batch like Evaluate, splitting it into morsels of
+  /// 'morsel_size' rows (rounded up to a multiple of 64) that are evaluated in
+  /// parallel on the CPU thread pool.
+  ///
+  /// Fixed-width outputs are written in place into arrays allocated for the whole
+  /// batch. Var-len outputs are built for each morsel, then concatenated. Small
+  /// batches, and expressions that use functions with non thread-safe state (such
+  /// as random()), are evaluated serially.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays.
+  /// \param[out] output the vector of allocated/populated arrays.
+  /// \param[in] morsel_size the number of rows evaluated by each task.
+  Status ParallelEvaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                          arrow::ArrayVector* output,
+                          int64_t morsel_size = kDefaultMorselSize);
+
+  /// \brief Time spent in each phase of building this projector
+  ///
+  /// Projectors returned from the cache report the build which compiled them.  With
+  /// background optimisation, these are the phases of the quick unoptimised build.
+  const CompileStats& compile_stats() const { return compile_stats_; }
+
   std::string DumpIR();
 
+  /// \brief Statistics of the process-wide cache of built projectors
+  ///
+  /// The cache capacity is set with the GANDIVA_CACHE_SIZE environment variable,
+  /// and an optional bound on the total object code size with
+  /// GANDIVA_CACHE_MAX_BYTES.
+  static CacheStats GetCacheStats();
+
  private:
   Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
             const FieldVector& output_fields, std::shared_ptr<Configuration>);
@@ -134,10 +169,18 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  // The generator is replaced once background optimisation finishes, and
+  // evaluations in progress keep a reference to the previous one.
+  std::shared_ptr<LLVMGenerator> llvm_generator() const {
+    return std::atomic_load(&llvm_generator_);
+  }
+  void SetLLVMGenerator(std::unique_ptr<LLVMGenerator> llvm_generator);
+
+  std::shared_ptr<LLVMGenerator> llvm_generator_;
   SchemaPtr schema_;
   FieldVector output_fields_;
   std::shared_ptr<Configuration> configuration_;
+  CompileStats compile_stats_;
 };
 
 }  // namespace gandiva
@@ -38,6 +38,10 @@ class GANDIVA_EXPORT RandomGeneratorHolder : public FunctionHolder {
 
   double operator()() { return distribution_(generator_); }
 
+  // The generator state is updated on each call, and seeded sequences must
+  // be produced in row order.
+  bool IsThreadSafe() const override { return false; }
+
  private:
   explicit RandomGeneratorHolder(int seed) : distribution_(0, 1) {
     int64_t seed64 = static_cast<int64_t>(seed);
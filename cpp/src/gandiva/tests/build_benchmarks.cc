@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "benchmark/benchmark.h"
+#include "gandiva/projector.h"
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tests/timed_evaluate.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::float64;
+using arrow::int32;
+using arrow::int64;
+using arrow::utf8;
+
+static DataTypePtr BuildBenchmarkType(int64_t index) {
+  static const DataTypeVector types{int32(), int64(), float64()};
+  return types[index];
+}
+
+// Time Projector::Make for the sum of state.range(0) fields of type
+// BuildBenchmarkType(state.range(1)), and report the time of each phase.
+static void TimedBuildSum(benchmark::State& state) {
+  const int64_t num_fields = state.range(0);
+  auto type = BuildBenchmarkType(state.range(1));
+  state.SetLabel(type->ToString());
+
+  FieldVector fields;
+  for (int64_t i = 0; i < num_fields; ++i) {
+    fields.push_back(field("f" + std::to_string(i), type));
+  }
+  auto sum = TreeExprBuilder::MakeField(fields[0]);
+  for (int64_t i = 1; i < num_fields; ++i) {
+    sum = TreeExprBuilder::MakeFunction(
+        "add", {sum, TreeExprBuilder::MakeField(fields[i])}, type);
+  }
+  auto expr = TreeExprBuilder::MakeExpression(sum, field("sum", type));
+
+  CompileStats totals;
+  int64_t num_builds = 0;
+  for (auto _ : state) {
+    // A field unused by the expression makes each schema unique, so that the
+    // projectors are built rather than found in the cache
+    state.PauseTiming();
+    auto schema_fields = fields;
+    schema_fields.push_back(field("build_" + std::to_string(num_builds++), type));
+    auto schema = arrow::schema(schema_fields);
+    state.ResumeTiming();
+
+    std::shared_ptr<Projector> projector;
+    auto status = Projector::Make(schema, {expr}, TestConfiguration(), &projector);
+    if (!status.ok()) {
+      state.SkipWithError(status.ToString().c_str());
+      return;
+    }
+    const auto& stats = projector->compile_stats();
+    totals.cache_lookup += stats.cache_lookup;
+    totals.engine_setup += stats.engine_setup;
+    totals.decomposition += stats.decomposition;
+    totals.ir_generation += stats.ir_generation;
+    totals.optimization += stats.optimization;
+    totals.codegen += stats.codegen;
+  }
+
+  // Average time of each phase, in microseconds
+  auto counter = [](uint64_t nanos) {
+    return benchmark::Counter(static_cast<double>(nanos) / 1000,
+                              benchmark::Counter::kAvgIterations);
+  };
+  state.counters["cache_lookup_us"] = counter(totals.cache_lookup);
+  state.counters["engine_setup_us"] = counter(totals.engine_setup);
+  state.counters["decomposition_us"] = counter(totals.decomposition);
+  state.counters["ir_generation_us"] = counter(totals.ir_generation);
+  state.counters["optimization_us"] = counter(totals.optimization);
+  state.counters["codegen_us"] = counter(totals.codegen);
+}
+
+static void BuildSumArguments(benchmark::internal::Benchmark* bench) {
+  for (int64_t type_index = 0; type_index < 3; ++type_index) {
+    for (int64_t num_fields : {1, 4, 16, 64}) {
+      bench->Args({num_fields, type_index});
+    }
+  }
+}
+
+// Evaluate a function of 'arity' fields of type 'TYPE', reporting the rows
+// evaluated per second.
+template <typename TYPE, typename C_TYPE>
+static void TimedEvaluateFunction(benchmark::State& state, const std::string& function,
+                                  DataTypePtr input_type, int arity,
+                                  DataTypePtr return_type,
+                                  DataGenerator<C_TYPE>* data_generator) {
+  FieldVector fields;
+  for (int i = 0; i < arity; ++i) {
+    fields.push_back(field("f" + std::to_string(i), input_type));
+  }
+  auto schema = arrow::schema(fields);
+  auto expr =
+      TreeExprBuilder::MakeExpression(function, fields, field("res", return_type));
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {expr}, TestConfiguration(), &projector));
+  ProjectEvaluator evaluator(projector);
+
+  constexpr int kNumRecords = 1 * MILLION;
+  Status status =
+      TimedEvaluate<TYPE, C_TYPE>(schema, evaluator, *data_generator,
+                                  arrow::default_memory_pool(), kNumRecords,
+                                  16 * THOUSAND, state);
+  ASSERT_OK(status);
+  state.SetItemsProcessed(state.iterations() * kNumRecords);
+}
+
+static void TimedEvaluateInt32(benchmark::State& state, const std::string& function,
+                               int arity, DataTypePtr return_type) {
+  Int32DataGenerator data_generator;
+  TimedEvaluateFunction<arrow::Int32Type, int32_t>(state, function, int32(), arity,
+                                                   return_type, &data_generator);
+}
+
+static void TimedEvaluateInt64(benchmark::State& state, const std::string& function,
+                               int arity, DataTypePtr return_type) {
+  Int64DataGenerator data_generator;
+  TimedEvaluateFunction<arrow::Int64Type, int64_t>(state, function, int64(), arity,
+                                                   return_type, &data_generator);
+}
+
+static void TimedEvaluateUtf8(benchmark::State& state, const std::string& function,
+                              int arity, DataTypePtr return_type) {
+  FastUtf8DataGenerator data_generator(16);
+  TimedEvaluateFunction<arrow::StringType, std::string>(state, function, utf8(), arity,
+                                                        return_type, &data_generator);
+}
+
+BENCHMARK(TimedBuildSum)->Apply(BuildSumArguments)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(TimedEvaluateInt32, add, "add", 2, int32())
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(TimedEvaluateInt32, multiply, "multiply", 2, int32())
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(TimedEvaluateInt64, add, "add", 2, int64())
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(TimedEvaluateInt64, less_than, "less_than", 2, boolean())
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(TimedEvaluateInt64, castFLOAT8, "castFLOAT8", 1, float64())
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(TimedEvaluateUtf8, octet_length, "octet_length", 1, int32())
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(TimedEvaluateUtf8, upper, "upper", 1, utf8())
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(TimedEvaluateUtf8, equal, "equal", 2, boolean())
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace gandiva
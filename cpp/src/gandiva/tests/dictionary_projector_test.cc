@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/memory_pool.h"
+
+#include "gandiva/dictionary_projector.h"
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::int32;
+using arrow::utf8;
+
+class TestDictionaryProjector : public ::testing::Test {
+ public:
+  void SetUp() {
+    pool_ = arrow::default_memory_pool();
+
+    // dictionary ["apple", "banana", "cherry"], indices [2, 0, null, 1, 0]
+    auto dict_type = arrow::dictionary(int32(), utf8());
+    auto dictionary = MakeArrowArrayUtf8({"apple", "banana", "cherry"});
+    auto indices = MakeArrowArrayInt32({2, 0, 0, 1, 0}, {true, true, false, true, true});
+    dict_array_ =
+        std::make_shared<arrow::DictionaryArray>(dict_type, indices, dictionary);
+    decoded_array_ = MakeArrowArrayUtf8({"cherry", "apple", "", "banana", "apple"},
+                                        {true, true, false, true, true});
+
+    schema_ = arrow::schema({field("s", dict_type), field("i", int32())});
+    batch_ = arrow::RecordBatch::Make(
+        schema_, 5, {dict_array_, MakeArrowArrayInt32({1, 2, 3, 4, 5})});
+  }
+
+ protected:
+  arrow::MemoryPool* pool_;
+  ArrayPtr dict_array_;
+  ArrayPtr decoded_array_;
+  SchemaPtr schema_;
+  std::shared_ptr<arrow::RecordBatch> batch_;
+  // Expressions refer to the dictionary column by its value type
+  FieldPtr field_s_ = field("s", utf8());
+  FieldPtr field_i_ = field("i", int32());
+};
+
+TEST_F(TestDictionaryProjector, TestEvaluateOnDictionary) {
+  auto upper = TreeExprBuilder::MakeExpression("upper", {field_s_}, field("up", utf8()));
+  auto length = TreeExprBuilder::MakeExpression("octet_length", {field_s_},
+                                                field("len", int32()));
+  // Not eligible: returns a value for null inputs
+  auto is_null =
+      TreeExprBuilder::MakeExpression("isnull", {field_s_}, field("null", boolean()));
+  // Not eligible: references another column
+  auto node_s = TreeExprBuilder::MakeField(field_s_);
+  auto node_i = TreeExprBuilder::MakeField(field_i_);
+  auto len_plus_i = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction(
+          "add",
+          {TreeExprBuilder::MakeFunction("octet_length", {node_s}, int32()), node_i},
+          int32()),
+      field("len_plus_i", int32()));
+
+  std::shared_ptr<DictionaryProjector> projector;
+  ASSERT_OK(DictionaryProjector::Make(schema_, {upper, length, is_null, len_plus_i},
+                                      TestConfiguration(), false, &projector));
+  EXPECT_TRUE(projector->EvaluatesOnDictionary(0));
+  EXPECT_TRUE(projector->EvaluatesOnDictionary(1));
+  EXPECT_FALSE(projector->EvaluatesOnDictionary(2));
+  EXPECT_FALSE(projector->EvaluatesOnDictionary(3));
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*batch_, pool_, &outputs));
+
+  auto exp_upper = MakeArrowArrayUtf8({"CHERRY", "APPLE", "", "BANANA", "APPLE"},
+                                      {true, true, false, true, true});
+  auto exp_length = MakeArrowArrayInt32({6, 5, 0, 6, 5}, {true, true, false, true, true});
+  auto exp_is_null = MakeArrowArrayBool({false, false, true, false, false},
+                                        {true, true, true, true, true});
+  auto exp_len_plus_i =
+      MakeArrowArrayInt32({7, 7, 0, 10, 10}, {true, true, false, true, true});
+  EXPECT_ARROW_ARRAY_EQUALS(exp_upper, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_length, outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_is_null, outputs.at(2));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_len_plus_i, outputs.at(3));
+}
+
+TEST_F(TestDictionaryProjector, TestDictionaryOutputs) {
+  auto upper = TreeExprBuilder::MakeExpression("upper", {field_s_}, field("up", utf8()));
+
+  std::shared_ptr<DictionaryProjector> projector;
+  ASSERT_OK(DictionaryProjector::Make(schema_, {upper}, TestConfiguration(), true,
+                                      &projector));
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*batch_, pool_, &outputs));
+
+  // The indices are shared with the input, only the dictionary is evaluated
+  const auto& in = static_cast<const arrow::DictionaryArray&>(*dict_array_);
+  ASSERT_EQ(outputs.at(0)->type_id(), arrow::Type::DICTIONARY);
+  const auto& out = static_cast<const arrow::DictionaryArray&>(*outputs.at(0));
+  EXPECT_EQ(out.indices(), in.indices());
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUtf8({"APPLE", "BANANA", "CHERRY"}),
+                            out.dictionary());
+}
+
+TEST_F(TestDictionaryProjector, TestOnlyDecodedColumns) {
+  auto add = TreeExprBuilder::MakeExpression("add", {field_i_, field_i_},
+                                             field("twice", int32()));
+
+  std::shared_ptr<DictionaryProjector> projector;
+  ASSERT_OK(DictionaryProjector::Make(schema_, {add}, &projector));
+  EXPECT_FALSE(projector->EvaluatesOnDictionary(0));
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*batch_, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt32({2, 4, 6, 8, 10}), outputs.at(0));
+}
+
+}  // namespace gandiva
@@ -123,6 +123,42 @@ TEST_F(TestFilter, TestSimple) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestParallelEvaluate) {
+  auto field0 = field("f0", int32());
+  auto schema = arrow::schema({field0});
+
+  // Build condition f0 < 300
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto literal_300 = TreeExprBuilder::MakeLiteral((int32_t)300);
+  auto less_than_300 = TreeExprBuilder::MakeFunction("less_than", {node_f0, literal_300},
+                                                     arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_300);
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, TestConfiguration(), &filter));
+
+  int num_records = 1000;
+  std::vector<int32_t> values;
+  std::vector<bool> validity;
+  for (int i = 0; i < num_records; ++i) {
+    values.push_back(i % 500);
+    validity.push_back(i % 7 != 0);
+  }
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records,
+                                           {MakeArrowArrayInt32(values, validity)});
+
+  std::shared_ptr<SelectionVector> expected;
+  ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &expected));
+  ASSERT_OK(filter->Evaluate(*in_batch, expected));
+
+  for (int64_t morsel_size : {1, 100, 128, 999, 4096}) {
+    std::shared_ptr<SelectionVector> selection_vector;
+    ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &selection_vector));
+    ASSERT_OK(filter->ParallelEvaluate(*in_batch, selection_vector, morsel_size));
+    EXPECT_ARROW_ARRAY_EQUALS(expected->ToArray(), selection_vector->ToArray());
+  }
+}
+
 TEST_F(TestFilter, TestSimpleCustomConfig) {
   // schema for input fields
   auto field0 = field("f0", int32());
@@ -16,6 +16,8 @@
 // under the License.
 
 #include <cmath>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -90,6 +92,30 @@ TEST_F(TestProjector, TestProjectCache) {
   EXPECT_EQ(cached_projector, projector);
 }
 
+TEST_F(TestProjector, TestCompileStats) {
+  auto field0 = field("stats_f0", int32());
+  auto field1 = field("stats_f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto sum_expr =
+      TreeExprBuilder::MakeExpression("add", {field0, field1}, field("add", int32()));
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector));
+  const auto& stats = projector->compile_stats();
+  EXPECT_GT(stats.engine_setup, 0u);
+  EXPECT_GT(stats.ir_generation, 0u);
+  EXPECT_GT(stats.codegen, 0u);
+  EXPECT_FALSE(stats.object_cache_hit);
+  EXPECT_EQ(stats.total(), stats.cache_lookup + stats.engine_setup +
+                               stats.decomposition + stats.ir_generation +
+                               stats.optimization + stats.codegen);
+
+  // A cached projector reports the build which compiled it
+  std::shared_ptr<Projector> cached_projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, TestConfiguration(), &cached_projector));
+  EXPECT_EQ(cached_projector->compile_stats().total(), stats.total());
+}
+
 TEST_F(TestProjector, TestProjectCacheFieldNames) {
   // schema for input fields
   auto field0 = field("f0", int32());
@@ -248,6 +274,32 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestBackgroundOptimize) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f2", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sum = field("add", int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto configuration = ConfigurationBuilder().build();
+  configuration->set_background_optimize(true);
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &projector));
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 0, 0}, {true, true, false, false});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // The results are the same before and after the optimised module is swapped in
+  for (int i = 0; i < 100; ++i) {
+    arrow::ArrayVector outputs;
+    ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+    EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  }
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
@@ -729,6 +781,45 @@ TEST_F(TestProjector, TestConcat) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_concat, outputs.at(0));
 }
 
+TEST_F(TestProjector, TestParallelEvaluate) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", arrow::utf8());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sum = field("sum", int32());
+  auto field_concat = field("concat", arrow::utf8());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field0}, field_sum);
+  auto concat_expr =
+      TreeExprBuilder::MakeExpression("concat", {field1, field1}, field_concat);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr, concat_expr}, TestConfiguration(),
+                            &projector));
+
+  // Several morsels, the last one partial
+  int num_records = 1000;
+  std::vector<int32_t> ints;
+  std::vector<std::string> strings;
+  std::vector<bool> validity;
+  for (int i = 0; i < num_records; ++i) {
+    ints.push_back(i);
+    strings.push_back(std::to_string(i));
+    validity.push_back(i % 7 != 0);
+  }
+  auto in_batch = arrow::RecordBatch::Make(
+      schema, num_records,
+      {MakeArrowArrayInt32(ints, validity), MakeArrowArrayUtf8(strings, validity)});
+
+  arrow::ArrayVector expected;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &expected));
+  for (int64_t morsel_size : {1, 100, 128, 999, 4096}) {
+    arrow::ArrayVector outputs;
+    ASSERT_OK(projector->ParallelEvaluate(*in_batch, pool_, &outputs, morsel_size));
+    ASSERT_EQ(outputs.size(), 2);
+    EXPECT_ARROW_ARRAY_EQUALS(expected.at(0), outputs.at(0));
+    EXPECT_ARROW_ARRAY_EQUALS(expected.at(1), outputs.at(1));
+  }
+}
+
 TEST_F(TestProjector, TestOffset) {
   // schema for input fields
   auto field0 = field("f0", arrow::int32());
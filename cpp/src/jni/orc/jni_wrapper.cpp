@@ -15,17 +15,23 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <cassert>
 #include <iostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <arrow/adapters/orc/adapter.h>
 #include <arrow/array.h>
 #include <arrow/buffer.h>
 #include <arrow/io/api.h>
 #include <arrow/ipc/api.h>
+#include <arrow/record_batch.h>
 #include <arrow/util/checked_cast.h>
+#include <arrow/util/future.h>
 #include <arrow/util/logging.h>
+#include <arrow/util/thread_pool.h>
 
 #include "org_apache_arrow_adapter_orc_OrcMemoryJniWrapper.h"
 #include "org_apache_arrow_adapter_orc_OrcReaderJniWrapper.h"
@@ -34,7 +40,9 @@
 #include "./concurrent_map.h"
 
 using ORCFileReader = arrow::adapters::orc::ORCFileReader;
+using RecordBatch = arrow::RecordBatch;
 using RecordBatchReader = arrow::RecordBatchReader;
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
 
 static jclass io_exception_class;
 static jclass illegal_access_exception_class;
@@ -54,9 +62,119 @@ static jint JNI_VERSION = JNI_VERSION_1_6;
 using arrow::internal::checked_cast;
 using arrow::jni::ConcurrentMap;
 
-static ConcurrentMap<std::shared_ptr<arrow::Buffer>> buffer_holder_;
+// A record batch whose buffers are exported to Java by address. It is retained
+// once for all its buffers, until Java has released each of them.
+struct ExportedBatch {
+  ExportedBatch(std::shared_ptr<RecordBatch> batch, int64_t num_buffers)
+      : batch(std::move(batch)), num_unreleased_buffers(num_buffers) {}
+
+  std::shared_ptr<RecordBatch> batch;
+  std::atomic<int64_t> num_unreleased_buffers;
+};
+
+// Iterates over the batches of a stripe which was read ahead of time
+class PrefetchedStripeReader : public RecordBatchReader {
+ public:
+  PrefetchedStripeReader(std::shared_ptr<arrow::Schema> schema,
+                         RecordBatchVector batches)
+      : schema_(std::move(schema)), batches_(std::move(batches)) {}
+
+  std::shared_ptr<arrow::Schema> schema() const override { return schema_; }
+
+  arrow::Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (position_ == batches_.size()) {
+      out->reset();
+    } else {
+      // Drop our reference, so the batch only lives as long as Java needs it
+      *out = std::move(batches_[position_++]);
+    }
+    return arrow::Status::OK();
+  }
+
+ private:
+  std::shared_ptr<arrow::Schema> schema_;
+  RecordBatchVector batches_;
+  size_t position_ = 0;
+};
+
+// An ORC file reader opened from Java.
+//
+// In prefetching mode, each stripe is read in full before its reader is returned,
+// and the following stripe is then read on the CPU thread pool while Java
+// consumes it. The prefetched stripe keeps the batch size that was asked for
+// along with the stripe before it.
+class OrcReaderState {
+ public:
+  OrcReaderState(std::shared_ptr<ORCFileReader> reader, bool prefetch_stripes)
+      : reader_(std::move(reader)), prefetch_stripes_(prefetch_stripes) {}
+
+  ~OrcReaderState() { DiscardPrefetchedStripe(); }
+
+  int64_t NumberOfStripes() { return reader_->NumberOfStripes(); }
+
+  arrow::Status Seek(int64_t row_number) {
+    // The prefetched stripe was read from the position before seeking
+    DiscardPrefetchedStripe();
+    return reader_->Seek(row_number);
+  }
+
+  arrow::Status NextStripeReader(int64_t batch_size,
+                                 std::shared_ptr<RecordBatchReader>* out) {
+    if (!prefetch_stripes_) {
+      return reader_->NextStripeReader(batch_size, out);
+    }
+    std::shared_ptr<RecordBatchReader> stripe_reader;
+    if (prefetched_stripe_.is_valid()) {
+      auto result = std::move(prefetched_stripe_).result();
+      prefetched_stripe_ = arrow::Future<std::shared_ptr<RecordBatchReader>>();
+      ARROW_ASSIGN_OR_RAISE(stripe_reader, std::move(result));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(stripe_reader, ReadNextStripe(reader_.get(), batch_size));
+    }
+    if (stripe_reader) {
+      // Read the following stripe while Java consumes this one
+      auto reader = reader_;
+      ARROW_ASSIGN_OR_RAISE(prefetched_stripe_,
+                            arrow::internal::GetCpuThreadPool()->Submit(
+                                [reader, batch_size]() {
+                                  return ReadNextStripe(reader.get(), batch_size);
+                                }));
+    }
+    *out = std::move(stripe_reader);
+    return arrow::Status::OK();
+  }
+
+ private:
+  // Read all the batches of the stripe at the current row, or return null at
+  // the end of the file
+  static arrow::Result<std::shared_ptr<RecordBatchReader>> ReadNextStripe(
+      ORCFileReader* reader, int64_t batch_size) {
+    std::shared_ptr<RecordBatchReader> stripe_reader;
+    RETURN_NOT_OK(reader->NextStripeReader(batch_size, &stripe_reader));
+    if (!stripe_reader) {
+      return nullptr;
+    }
+    RecordBatchVector batches;
+    RETURN_NOT_OK(stripe_reader->ReadAll(&batches));
+    return std::make_shared<PrefetchedStripeReader>(stripe_reader->schema(),
+                                                    std::move(batches));
+  }
+
+  void DiscardPrefetchedStripe() {
+    if (prefetched_stripe_.is_valid()) {
+      prefetched_stripe_.Wait();
+      prefetched_stripe_ = arrow::Future<std::shared_ptr<RecordBatchReader>>();
+    }
+  }
+
+  std::shared_ptr<ORCFileReader> reader_;
+  const bool prefetch_stripes_;
+  arrow::Future<std::shared_ptr<RecordBatchReader>> prefetched_stripe_;
+};
+
+static ConcurrentMap<std::shared_ptr<ExportedBatch>> batch_holder_;
 static ConcurrentMap<std::shared_ptr<RecordBatchReader>> orc_stripe_reader_holder_;
-static ConcurrentMap<std::shared_ptr<ORCFileReader>> orc_reader_holder_;
+static ConcurrentMap<std::shared_ptr<OrcReaderState>> orc_reader_holder_;
 
 jclass CreateGlobalClassReference(JNIEnv* env, const char* class_name) {
   jclass local_class = env->FindClass(class_name);
@@ -85,7 +203,7 @@ std::string JStringToCString(JNIEnv* env, jstring string) {
   return std::string(buffer.data(), clen);
 }
 
-std::shared_ptr<ORCFileReader> GetFileReader(JNIEnv* env, jlong id) {
+std::shared_ptr<OrcReaderState> GetFileReader(JNIEnv* env, jlong id) {
   auto reader = orc_reader_holder_.Lookup(id);
   if (!reader) {
     std::string error_message = "invalid reader id " + std::to_string(id);
@@ -105,6 +223,18 @@ std::shared_ptr<RecordBatchReader> GetStripeReader(JNIEnv* env, jlong id) {
   return reader;
 }
 
+// Collect the field nodes and buffers of an array and its children, in the
+// pre-order the Java record batch loader expects
+void FlattenArrayData(const arrow::ArrayData& data,
+                      std::vector<const arrow::ArrayData*>* nodes,
+                      std::vector<std::shared_ptr<arrow::Buffer>>* buffers) {
+  nodes->push_back(&data);
+  buffers->insert(buffers->end(), data.buffers.begin(), data.buffers.end());
+  for (const auto& child : data.child_data) {
+    FlattenArrayData(*child, nodes, buffers);
+  }
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -151,13 +281,13 @@ void JNI_OnUnload(JavaVM* vm, void* reserved) {
   env->DeleteGlobalRef(orc_memory_class);
   env->DeleteGlobalRef(record_batch_class);
 
-  buffer_holder_.Clear();
+  batch_holder_.Clear();
   orc_stripe_reader_holder_.Clear();
   orc_reader_holder_.Clear();
 }
 
 JNIEXPORT jlong JNICALL Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_open(
-    JNIEnv* env, jobject this_obj, jstring file_path) {
+    JNIEnv* env, jobject this_obj, jstring file_path, jboolean prefetch_stripes) {
   std::string path = JStringToCString(env, file_path);
 
   if (path.find("hdfs://") == 0) {
@@ -175,7 +305,8 @@ JNIEXPORT jlong JNICALL Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_op
   if (!ret.ok()) {
     env->ThrowNew(io_exception_class, std::string("Failed open file" + path).c_str());
   }
-  return orc_reader_holder_.Insert(std::shared_ptr<ORCFileReader>(reader.release()));
+  return orc_reader_holder_.Insert(std::make_shared<OrcReaderState>(
+      std::shared_ptr<ORCFileReader>(reader.release()), prefetch_stripes));
 }
 
 JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_close(
@@ -205,7 +336,8 @@ Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_nextStripeReader(JNIEnv* e
   auto reader = GetFileReader(env, id);
 
   std::shared_ptr<RecordBatchReader> stripe_reader;
-  auto status = reader->NextStripeReader(batch_size, &stripe_reader);
+  auto status =
+      reader->NextStripeReader(static_cast<int64_t>(batch_size), &stripe_reader);
 
   if (!status.ok()) {
     return static_cast<jlong>(status.code()) * -1;
@@ -250,36 +382,43 @@ Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_next(JNIEnv* env,
     return nullptr;
   }
 
-  auto schema = stripe_reader->schema();
+  std::vector<const arrow::ArrayData*> nodes;
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+  for (int i = 0; i < record_batch->num_columns(); ++i) {
+    FlattenArrayData(*record_batch->column_data(i), &nodes, &buffers);
+  }
 
   // TODO: ARROW-4714 Ensure JVM has sufficient capacity to create local references
   // create OrcFieldNode[]
-  jobjectArray field_array =
-      env->NewObjectArray(schema->num_fields(), orc_field_node_class, nullptr);
-
-  std::vector<std::shared_ptr<arrow::Buffer>> buffers;
-  for (int i = 0; i < schema->num_fields(); ++i) {
-    auto column = record_batch->column(i);
-    auto dataArray = column->data();
-    jobject field = env->NewObject(orc_field_node_class, orc_field_node_constructor,
-                                   column->length(), column->null_count());
-    env->SetObjectArrayElement(field_array, i, field);
-
-    for (auto& buffer : dataArray->buffers) {
-      buffers.push_back(buffer);
-    }
+  jobjectArray field_array = env->NewObjectArray(static_cast<jsize>(nodes.size()),
+                                                 orc_field_node_class, nullptr);
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    jobject field =
+        env->NewObject(orc_field_node_class, orc_field_node_constructor,
+                       static_cast<jint>(nodes[i]->length),
+                       static_cast<jint>(nodes[i]->GetNullCount()));
+    env->SetObjectArrayElement(field_array, static_cast<jsize>(i), field);
   }
 
-  // create OrcMemoryJniWrapper[]
-  jobjectArray memory_array =
-      env->NewObjectArray(buffers.size(), orc_memory_class, nullptr);
-
+  // create OrcMemoryJniWrapper[]. The buffers are handed to Java by address, and
+  // the batch is retained once for all of them, see OrcMemoryJniWrapper.release.
+  // Absent buffers (e.g. the validity bitmap of a column without nulls) are
+  // exported as empty.
+  jlong batch_id = 0;
+  if (!buffers.empty()) {
+    batch_id = batch_holder_.Insert(std::make_shared<ExportedBatch>(
+        record_batch, static_cast<int64_t>(buffers.size())));
+  }
+  jobjectArray memory_array = env->NewObjectArray(static_cast<jsize>(buffers.size()),
+                                                  orc_memory_class, nullptr);
   for (size_t j = 0; j < buffers.size(); ++j) {
-    auto buffer = buffers[j];
-    jobject memory = env->NewObject(orc_memory_class, orc_memory_constructor,
-                                    buffer_holder_.Insert(buffer), buffer->data(),
-                                    buffer->size(), buffer->capacity());
-    env->SetObjectArrayElement(memory_array, j, memory);
+    const auto& buffer = buffers[j];
+    jlong address = buffer ? reinterpret_cast<jlong>(buffer->data()) : 0;
+    jlong size = buffer ? buffer->size() : 0;
+    jlong capacity = buffer ? buffer->capacity() : 0;
+    jobject memory = env->NewObject(orc_memory_class, orc_memory_constructor, batch_id,
+                                    address, size, capacity);
+    env->SetObjectArrayElement(memory_array, static_cast<jsize>(j), memory);
   }
 
   // create OrcRecordBatch
@@ -296,7 +435,10 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapp
 
 JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcMemoryJniWrapper_release(
     JNIEnv* env, jobject this_obj, jlong id) {
-  buffer_holder_.Erase(id);
+  auto exported = batch_holder_.Lookup(id);
+  if (exported && --exported->num_unreleased_buffers == 0) {
+    batch_holder_.Erase(id);
+  }
 }
 
 #ifdef __cplusplus
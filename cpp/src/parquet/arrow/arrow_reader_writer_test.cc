@@ -50,6 +50,7 @@
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/test_util.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_writer.h"
 #include "parquet/test_util.h"
@@ -1876,6 +1877,106 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> doubles;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &doubles));
+
+  // A nested column between flat ones spans several leaf columns
+  auto nested_type =
+      ::arrow::struct_({::arrow::field("a", ::arrow::int32()),
+                        ::arrow::field("b", ::arrow::list(::arrow::utf8()))});
+  ::arrow::Int32Builder a_builder;
+  ::arrow::ListBuilder b_builder(::arrow::default_memory_pool(),
+                                 std::make_shared<::arrow::StringBuilder>());
+  auto b_values = static_cast<::arrow::StringBuilder*>(b_builder.value_builder());
+  for (int i = 0; i < num_rows; i++) {
+    ASSERT_OK(a_builder.Append(i));
+    ASSERT_OK(b_builder.Append());
+    for (int j = 0; j < i % 3; j++) {
+      ASSERT_OK(b_values->Append(std::to_string(i)));
+    }
+  }
+  std::shared_ptr<Array> a, b;
+  ASSERT_OK(a_builder.Finish(&a));
+  ASSERT_OK(b_builder.Finish(&b));
+  auto nested = std::make_shared<::arrow::StructArray>(nested_type, num_rows,
+                                                       ::arrow::ArrayVector{a, b});
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       doubles->AddColumn(num_columns / 2,
+                                          ::arrow::field("nested", nested_type, false),
+                                          std::make_shared<ChunkedArray>(nested)));
+
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  // Several row groups
+  ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, num_rows / 3, arrow_properties));
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatches) {
+  const int num_columns = 10;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  auto write_props = WriterProperties::Builder().max_row_group_length(300)->build();
+  for (bool use_threads : {false, true}) {
+    auto arrow_properties =
+        ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+    auto sink = CreateOutputStream();
+    std::unique_ptr<FileWriter> writer;
+    ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), ::arrow::default_memory_pool(),
+                                        sink, write_props, arrow_properties, &writer));
+
+    // Many small batches are buffered into few row groups
+    ::arrow::TableBatchReader batch_reader(*table);
+    batch_reader.set_chunksize(7);
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(batch_reader.ReadNext(&batch));
+      if (batch == nullptr) break;
+      ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK_NO_THROW(writer->Close());
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    auto metadata = reader->parquet_reader()->metadata();
+    ASSERT_EQ(4, metadata->num_row_groups());
+    ASSERT_EQ(300, metadata->RowGroup(0)->num_rows());
+    ASSERT_EQ(100, metadata->RowGroup(3)->num_rows());
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+}
+
+TEST(TestArrowReadWrite, InvalidMaxRowGroupLength) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(/*num_columns=*/2, /*num_rows=*/10, 1, &table));
+  ::arrow::TableBatchReader batch_reader(*table);
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  ASSERT_OK(batch_reader.ReadNext(&batch));
+
+  for (int64_t max_row_group_length : {0, -1}) {
+    auto write_props =
+        WriterProperties::Builder().max_row_group_length(max_row_group_length)->build();
+    auto sink = CreateOutputStream();
+    std::unique_ptr<FileWriter> writer;
+    ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), ::arrow::default_memory_pool(),
+                                        sink, write_props,
+                                        default_arrow_writer_properties(), &writer));
+    ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+    ASSERT_RAISES(Invalid, writer->WriteTable(*table, 5));
+    ASSERT_OK_NO_THROW(writer->Close());
+  }
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -1972,44 +2073,314 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
                                              default_arrow_writer_properties(), &buffer));
 
-  ArrowReaderProperties properties = default_arrow_reader_properties();
-  properties.set_batch_size(batch_size);
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_batch_size(batch_size);
+    properties.set_use_threads(use_threads);
 
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    // Read the whole file, one batch at a time.
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+    std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
+    ::arrow::TableBatchReader table_reader(*table);
+    table_reader.set_chunksize(batch_size);
+
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+      ASSERT_OK(table_reader.ReadNext(&expected_batch));
+      ASSERT_NO_FATAL_FAILURE(
+          ::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+    }
+
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_EQ(nullptr, actual_batch);
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_EQ(nullptr, actual_batch);
+
+    // ARROW-6005: Read just the second row group
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({1}, &rb_reader));
+    std::shared_ptr<Table> second_rowgroup = table->Slice(num_rows / 2);
+    ::arrow::TableBatchReader second_table_reader(*second_rowgroup);
+    second_table_reader.set_chunksize(batch_size);
+
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+      ASSERT_OK(second_table_reader.ReadNext(&expected_batch));
+      ASSERT_NO_FATAL_FAILURE(
+          ::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+    }
+
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_EQ(nullptr, actual_batch);
+
+    // Destroying a reader part way through, while the next batch may still be
+    // decoding
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    rb_reader.reset();
+  }
+}
+
+TEST(TestArrowReadWrite, PreBuffer) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_pre_buffer(true);
+    properties.set_use_threads(use_threads);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+    // Column subset of a single row group
+    std::vector<int> column_subset = {1, 4, 5, 19};
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({1}, column_subset, &actual));
+    std::vector<std::shared_ptr<::arrow::ChunkedArray>> ex_columns;
+    std::vector<std::shared_ptr<::arrow::Field>> ex_fields;
+    for (int i : column_subset) {
+      ex_columns.push_back(table->column(i)->Slice(num_rows / 2));
+      ex_fields.push_back(table->field(i));
+    }
+    auto expected = Table::Make(::arrow::schema(ex_fields), ex_columns);
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    // Through a RecordBatchReader
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+    std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+    ASSERT_OK(rb_reader->ReadAll(&batches));
+    ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(batches));
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+    ASSERT_RAISES(Invalid, reader->ReadRowGroups({2}, column_subset, &actual));
+  }
+}
+
+// A RandomAccessFile counting the positioned reads issued on a buffer
+class ReadAtCountingFile : public ::arrow::io::RandomAccessFile {
+ public:
+  explicit ReadAtCountingFile(std::shared_ptr<Buffer> buffer)
+      : reader_(std::make_shared<BufferReader>(std::move(buffer))) {}
+
+  Status Close() override { return reader_->Close(); }
+  bool closed() const override { return reader_->closed(); }
+  Status Seek(int64_t position) override { return reader_->Seek(position); }
+  ::arrow::Result<int64_t> Tell() const override { return reader_->Tell(); }
+  ::arrow::Result<int64_t> GetSize() override { return reader_->GetSize(); }
+
+  ::arrow::Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return reader_->Read(nbytes, out);
+  }
+  ::arrow::Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return reader_->Read(nbytes);
+  }
+
+  ::arrow::Result<int64_t> ReadAt(int64_t position, int64_t nbytes,
+                                  void* out) override {
+    ++num_reads;
+    return reader_->ReadAt(position, nbytes, out);
+  }
+  ::arrow::Result<std::shared_ptr<Buffer>> ReadAt(int64_t position,
+                                                  int64_t nbytes) override {
+    ++num_reads;
+    return reader_->ReadAt(position, nbytes);
+  }
+
+  std::atomic<int> num_reads{0};
+
+ private:
+  std::shared_ptr<BufferReader> reader_;
+};
+
+TEST(TestArrowReadWrite, PreBufferPageIndex) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder().enable_write_page_index()->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / 2, write_props));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_pre_buffer(true);
+  auto source = std::make_shared<ReadAtCountingFile>(buffer);
   std::unique_ptr<FileReader> reader;
   FileReaderBuilder builder;
-  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.Open(source));
   ASSERT_OK(builder.properties(properties)->Build(&reader));
 
-  // Read the whole file, one batch at a time.
-  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
-  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
-  std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
-  ::arrow::TableBatchReader table_reader(*table);
-  table_reader.set_chunksize(batch_size);
+  // The offset indexes are read along with the column chunks, rather than
+  // one at a time
+  source->num_reads = 0;
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+  ASSERT_LT(source->num_reads.load(), num_columns);
+}
 
-  for (int i = 0; i < 10; ++i) {
-    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
-    ASSERT_OK(table_reader.ReadNext(&expected_batch));
-    ASSERT_NO_FATAL_FAILURE(::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+TEST(TestArrowReadWrite, PrefetchRowGroups) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 10,
+                                             default_arrow_writer_properties(), &buffer));
+
+  const std::vector<int> all_row_groups = ::arrow::internal::Iota(10);
+  for (bool use_threads : {false, true}) {
+    for (int depth : {1, 3, 20}) {
+      SCOPED_TRACE(::testing::Message()
+                   << "use_threads = " << use_threads << ", depth = " << depth);
+      ArrowReaderProperties properties = default_arrow_reader_properties();
+      properties.set_row_group_prefetch_depth(depth);
+      properties.set_use_threads(use_threads);
+      properties.set_batch_size(64);
+
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+      std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+      std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+      std::shared_ptr<Table> actual;
+      ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(all_row_groups, &rb_reader));
+      ASSERT_OK(rb_reader->ReadAll(&batches));
+      ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(batches));
+      AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+      // Column subset, with a repeated column, of some row groups out of order
+      std::vector<int> column_subset = {1, 4, 4, 19};
+      ASSERT_OK_NO_THROW(
+          reader->GetRecordBatchReader({7, 2, 3}, column_subset, &rb_reader));
+      ASSERT_OK(rb_reader->ReadAll(&batches));
+      ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(batches));
+      std::vector<std::shared_ptr<::arrow::ChunkedArray>> ex_columns;
+      std::vector<std::shared_ptr<::arrow::Field>> ex_fields;
+      for (int i : {1, 4, 19}) {
+        ::arrow::ArrayVector chunks;
+        for (int row_group : {7, 2, 3}) {
+          auto slice = table->column(i)->Slice(row_group * num_rows / 10, num_rows / 10);
+          chunks.insert(chunks.end(), slice->chunks().begin(), slice->chunks().end());
+        }
+        ex_columns.push_back(std::make_shared<::arrow::ChunkedArray>(chunks));
+        ex_fields.push_back(table->field(i));
+      }
+      auto expected = Table::Make(::arrow::schema(ex_fields), ex_columns);
+      AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+      // Destroying a reader part way through drops the row groups fetched ahead
+      ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(all_row_groups, &rb_reader));
+      std::shared_ptr<::arrow::RecordBatch> batch;
+      ASSERT_OK(rb_reader->ReadNext(&batch));
+      rb_reader.reset();
+
+      ASSERT_RAISES(Invalid,
+                    reader->GetRecordBatchReader({0}, {num_columns}, &rb_reader));
+    }
   }
+}
 
-  ASSERT_OK(rb_reader->ReadNext(&actual_batch));
-  ASSERT_EQ(nullptr, actual_batch);
+TEST(TestArrowReadWrite, ZeroCopyPages) {
+  const int num_rows = 2000;
+  const int num_row_groups = 2;
 
-  // ARROW-6005: Read just the second row group
-  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({1}, &rb_reader));
-  std::shared_ptr<Table> second_rowgroup = table->Slice(num_rows / 2);
-  ::arrow::TableBatchReader second_table_reader(*second_rowgroup);
-  second_table_reader.set_chunksize(batch_size);
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto schema = ::arrow::schema({::arrow::field("longs", ::arrow::int64(), false),
+                                 ::arrow::field("doubles", ::arrow::float64(), false),
+                                 ::arrow::field("ints", ::arrow::int32())});
+  auto table = Table::Make(schema, {rag.Int64(num_rows, -1000, 1000, 0),
+                                    rag.Float64(num_rows, -1, 1, 0),
+                                    rag.Int32(num_rows, -1000, 1000, 0.1)});
+
+  // Many small PLAIN-encoded, uncompressed data pages
+  auto write_props = WriterProperties::Builder()
+                         .disable_dictionary()
+                         ->data_pagesize(512)
+                         ->write_batch_size(32)
+                         ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / num_row_groups, write_props,
+                                default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
 
-  for (int i = 0; i < 5; ++i) {
-    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
-    ASSERT_OK(second_table_reader.ReadNext(&expected_batch));
-    ASSERT_NO_FATAL_FAILURE(::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+  // Only the pages whose values are suitably aligned are referenced
+  std::vector<int64_t> aligned_pages(schema->num_fields(), 0);
+  auto file_reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  for (int column = 0; column < 2; ++column) {
+    for (int row_group = 0; row_group < num_row_groups; ++row_group) {
+      auto pager = file_reader->RowGroup(row_group)->GetColumnPageReader(column);
+      while (auto page = pager->NextPage()) {
+        if (page->type() == PageType::DATA_PAGE &&
+            reinterpret_cast<uintptr_t>(page->data()) % 8 == 0) {
+          ++aligned_pages[column];
+        }
+      }
+    }
   }
+  auto num_referenced_chunks = [&](const ChunkedArray& column) {
+    int64_t num_referenced = 0;
+    for (const auto& chunk : column.chunks()) {
+      const uint8_t* values = chunk->data()->buffers[1]->data();
+      if (values >= buffer->data() && values < buffer->data() + buffer->size()) {
+        ++num_referenced;
+      }
+    }
+    return num_referenced;
+  };
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_zero_copy_pages(true);
+    properties.set_use_threads(use_threads);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
 
-  ASSERT_OK(rb_reader->ReadNext(&actual_batch));
-  ASSERT_EQ(nullptr, actual_batch);
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+    for (int column = 0; column < schema->num_fields(); ++column) {
+      ASSERT_EQ(aligned_pages[column], num_referenced_chunks(*actual->column(column)));
+    }
+
+    // Batches spanning several pages are concatenated
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+    std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+    ASSERT_OK(rb_reader->ReadAll(&batches));
+    ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(batches));
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+  }
 }
 
 TEST(TestArrowReadWrite, ScanContents) {
@@ -3051,6 +3422,110 @@ INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+template <typename ArrowType>
+void AsDictionary32Encoded(const Array& arr, std::shared_ptr<Array>* out) {
+  ::arrow::Dictionary32Builder<ArrowType> builder(arr.type(), default_memory_pool());
+  ASSERT_OK(builder.AppendArray(arr));
+  ASSERT_OK(builder.Finish(out));
+}
+
+class TestArrowReadDictionaryTypes : public ::testing::Test {
+ public:
+  static constexpr int64_t kNumRows = 1000;
+  static constexpr int64_t kRowGroupSize = 500;
+
+  void SetUp() override {
+    ::arrow::random::RandomArrayGenerator rag(0);
+    auto ints = rag.Int32(kNumRows, 0, 9, /*null_probability=*/0.1);
+    auto longs = rag.Int64(kNumRows, -5, 5, /*null_probability=*/0.1);
+
+    ::arrow::FixedSizeBinaryBuilder fsb_builder(::arrow::fixed_size_binary(3));
+    for (int64_t i = 0; i < kNumRows; ++i) {
+      if (i % 7 == 0) {
+        ASSERT_OK(fsb_builder.AppendNull());
+      } else {
+        ASSERT_OK(fsb_builder.Append("ab" + std::to_string(i % 4)));
+      }
+    }
+    std::shared_ptr<Array> fsb;
+    ASSERT_OK(fsb_builder.Finish(&fsb));
+
+    std::shared_ptr<Array> unique;
+    ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(
+        ::arrow::internal::Iota<int64_t>(kNumRows), &unique);
+
+    table_ = Table::Make(::arrow::schema({::arrow::field("i32", ::arrow::int32()),
+                                          ::arrow::field("i64", ::arrow::int64()),
+                                          ::arrow::field("fsb", fsb->type()),
+                                          ::arrow::field("unique", ::arrow::int64())}),
+                         {ints, longs, fsb, unique});
+
+    auto sink = CreateOutputStream();
+    // The unique column falls back to plain encoding after its first batch
+    auto write_props = WriterProperties::Builder()
+                           .dictionary_pagesize_limit(512)
+                           ->write_batch_size(100)
+                           ->build();
+    ASSERT_OK_NO_THROW(WriteTable(*table_, ::arrow::default_memory_pool(), sink,
+                                  kRowGroupSize, write_props,
+                                  default_arrow_writer_properties()));
+    ASSERT_OK_AND_ASSIGN(buffer_, sink->Finish());
+  }
+
+  // The dictionaries are per row group
+  template <typename ArrowType>
+  void CheckDictionaryColumn(int i, const ChunkedArray& actual) {
+    const auto& dense = table_->column(i)->chunk(0);
+    std::vector<std::shared_ptr<Array>> chunks;
+    for (int64_t offset = 0; offset < kNumRows; offset += kRowGroupSize) {
+      std::shared_ptr<Array> chunk;
+      AsDictionary32Encoded<ArrowType>(*dense->Slice(offset, kRowGroupSize), &chunk);
+      chunks.push_back(chunk);
+    }
+    ::arrow::AssertChunkedEqual(ChunkedArray(chunks), actual);
+  }
+
+  void ReadTable(const ArrowReaderProperties& properties, std::shared_ptr<Table>* out) {
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer_)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+    ASSERT_OK_NO_THROW(reader->ReadTable(out));
+  }
+
+ protected:
+  std::shared_ptr<Table> table_;
+  std::shared_ptr<Buffer> buffer_;
+};
+
+TEST_F(TestArrowReadDictionaryTypes, ReadDictionary) {
+  auto properties = default_arrow_reader_properties();
+  for (int i = 0; i < 3; ++i) {
+    properties.set_read_dictionary(i, true);
+  }
+  std::shared_ptr<Table> actual;
+  ASSERT_NO_FATAL_FAILURE(ReadTable(properties, &actual));
+
+  CheckDictionaryColumn<::arrow::Int32Type>(0, *actual->column(0));
+  CheckDictionaryColumn<::arrow::Int64Type>(1, *actual->column(1));
+  CheckDictionaryColumn<::arrow::FixedSizeBinaryType>(2, *actual->column(2));
+  ::arrow::AssertChunkedEqual(*table_->column(3), *actual->column(3));
+}
+
+TEST_F(TestArrowReadDictionaryTypes, ReadDictionaryIfEncoded) {
+  auto properties = default_arrow_reader_properties();
+  properties.set_read_dictionary_if_encoded(true);
+  std::shared_ptr<Table> actual;
+  ASSERT_NO_FATAL_FAILURE(ReadTable(properties, &actual));
+
+  CheckDictionaryColumn<::arrow::Int32Type>(0, *actual->column(0));
+  CheckDictionaryColumn<::arrow::Int64Type>(1, *actual->column(1));
+  CheckDictionaryColumn<::arrow::FixedSizeBinaryType>(2, *actual->column(2));
+  // The unique column fell back to plain encoding
+  ASSERT_TRUE(actual->schema()->field(3)->type()->Equals(::arrow::int64()));
+  ::arrow::AssertChunkedEqual(*table_->column(3), *actual->column(3));
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -3103,6 +3578,98 @@ TEST(TestArrowWriteDictionaries, AutoReadAsDictionary) {
   ::arrow::AssertTablesEqual(*expected_dense, *actual_dense);
 }
 
+TEST(TestArrowWriteDictionaries, WriteDictionaryDirectly) {
+  // The dictionaries of these types are written as the Parquet dictionary
+  // and the indices straight through, as long as the dictionary doesn't change
+  auto indices0 = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 1, null, 2]");
+  auto indices1 = ::arrow::ArrayFromJSON(::arrow::int32(), "[2, 2, 1, null, 0]");
+  std::vector<std::shared_ptr<Array>> dictionaries = {
+      ::arrow::ArrayFromJSON(::arrow::int32(), "[10, 20, 30]"),
+      ::arrow::ArrayFromJSON(::arrow::int64(), "[-1, 7, 3]"),
+      ::arrow::ArrayFromJSON(::arrow::fixed_size_binary(2), R"(["ab", "cd", "ef"])")};
+
+  std::vector<std::shared_ptr<::arrow::Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (const auto& dictionary : dictionaries) {
+    auto dict_type = ::arrow::dictionary(::arrow::int32(), dictionary->type());
+    ::arrow::ArrayVector chunks;
+    for (const auto& indices : {indices0, indices1}) {
+      ASSERT_OK_AND_ASSIGN(auto chunk, ::arrow::DictionaryArray::FromArrays(
+                                           dict_type, indices, dictionary));
+      chunks.push_back(chunk);
+    }
+    fields.push_back(::arrow::field(dictionary->type()->ToString(), dict_type));
+    columns.push_back(std::make_shared<ChunkedArray>(chunks));
+  }
+  auto table = Table::Make(::arrow::schema(fields), columns);
+
+  auto sink = CreateOutputStream();
+  auto props_store_schema = ArrowWriterProperties::Builder().store_schema()->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                table->num_rows(), default_writer_properties(),
+                                props_store_schema));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  auto row_group = reader->parquet_reader()->metadata()->RowGroup(0);
+  for (int i = 0; i < table->num_columns(); ++i) {
+    for (const auto& stats : row_group->ColumnChunk(i)->encoding_stats()) {
+      ASSERT_NE(Encoding::PLAIN, stats.encoding);
+    }
+  }
+
+  // The file dictionaries are the ones written, so the indices round trip too
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ::arrow::AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowWriteDictionaries, BloomFilterFromDictionary) {
+  // Dictionaries written directly feed the Bloom filters too
+  auto indices = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 1, null, 2]");
+  std::vector<std::shared_ptr<Array>> dictionaries = {
+      ::arrow::ArrayFromJSON(::arrow::int32(), "[10, 20, 30]"),
+      ::arrow::ArrayFromJSON(::arrow::int64(), "[-1, 7, 3]"),
+      ::arrow::ArrayFromJSON(::arrow::fixed_size_binary(2), R"(["ab", "cd", "ef"])")};
+
+  std::vector<std::shared_ptr<::arrow::Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (const auto& dictionary : dictionaries) {
+    auto dict_type = ::arrow::dictionary(::arrow::int32(), dictionary->type());
+    ASSERT_OK_AND_ASSIGN(auto column, ::arrow::DictionaryArray::FromArrays(
+                                          dict_type, indices, dictionary));
+    fields.push_back(::arrow::field(dictionary->type()->ToString(), dict_type));
+    columns.push_back(column);
+  }
+  auto table = Table::Make(::arrow::schema(fields), columns);
+
+  auto sink = CreateOutputStream();
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                table->num_rows(), properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  auto row_group = reader->RowGroup(0);
+  std::vector<std::unique_ptr<BloomFilter>> filters;
+  for (int i = 0; i < table->num_columns(); ++i) {
+    filters.push_back(row_group->GetColumnBloomFilter(i));
+    ASSERT_NE(nullptr, filters.back());
+  }
+  for (int32_t value : {10, 20, 30}) {
+    ASSERT_TRUE(filters[0]->FindHash(filters[0]->Hash(value)));
+  }
+  for (int64_t value : {-1, 7, 3}) {
+    ASSERT_TRUE(filters[1]->FindHash(filters[1]->Hash(value)));
+  }
+  for (std::string value : {"ab", "cd", "ef"}) {
+    const FLBA flba(reinterpret_cast<const uint8_t*>(value.data()));
+    ASSERT_TRUE(filters[2]->FindHash(filters[2]->Hash(&flba, 2)));
+  }
+}
+
 TEST(TestArrowWriteDictionaries, NestedSubfield) {
   // ARROW-3246: Automatic decoding of dictionary subfields left as followup
   // work
@@ -19,11 +19,13 @@
 
 #include <algorithm>
 #include <cstring>
+#include <mutex>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
@@ -32,6 +34,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
@@ -96,6 +99,137 @@ std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
   return result;
 }
 
+// Whether all the data pages of a column chunk are dictionary-encoded
+bool IsFullyDictionaryEncoded(const ColumnChunkMetaData& column) {
+  const std::vector<PageEncodingStats>& encoding_stats = column.encoding_stats();
+  if (!column.has_dictionary_page() || encoding_stats.empty()) {
+    // Without the encoding stats, the encodings don't tell whether the
+    // writer fell back to plain encoding
+    return false;
+  }
+  for (const PageEncodingStats& stats : encoding_stats) {
+    if (stats.page_type != PageType::DICTIONARY_PAGE &&
+        stats.encoding != Encoding::PLAIN_DICTIONARY &&
+        stats.encoding != Encoding::RLE_DICTIONARY) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SetReadDictionaryIfEncoded(const FileMetaData& metadata,
+                                ArrowReaderProperties* properties) {
+  if (metadata.num_row_groups() == 0) {
+    return;
+  }
+  for (int i = 0; i < metadata.num_columns(); ++i) {
+    switch (metadata.schema()->Column(i)->physical_type()) {
+      case Type::BYTE_ARRAY:
+      case Type::FIXED_LEN_BYTE_ARRAY:
+      case Type::INT32:
+      case Type::INT64:
+        break;
+      default:
+        continue;
+    }
+    bool fully_encoded = true;
+    for (int j = 0; j < metadata.num_row_groups() && fully_encoded; ++j) {
+      fully_encoded = IsFullyDictionaryEncoded(*metadata.RowGroup(j)->ColumnChunk(i));
+    }
+    if (fully_encoded) {
+      properties->set_read_dictionary(i, true);
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// Row group prefetching
+
+// Pre-buffers the column chunks of the row groups of a record batch reader
+// ahead of those being decoded, and drops them once every column iterator has
+// opened its chunk of them.  The iterators of columns decoded in parallel call
+// it from several threads.
+class RowGroupPrefetcher {
+ public:
+  RowGroupPrefetcher(ParquetFileReader* reader, std::vector<int> row_groups,
+                     std::vector<int> column_indices, int depth)
+      : reader_(reader),
+        row_groups_(std::move(row_groups)),
+        column_indices_(std::move(column_indices)),
+        depth_(static_cast<size_t>(depth)),
+        num_opened_(row_groups_.size(), 0),
+        prefetched_end_(0) {}
+
+  ~RowGroupPrefetcher() {
+    // Drop the buffers of the row groups which were not read to the end
+    std::vector<int> unreleased;
+    for (size_t i = 0; i < prefetched_end_; ++i) {
+      if (num_opened_[i] < column_indices_.size()) {
+        unreleased.push_back(row_groups_[i]);
+      }
+    }
+    reader_->ReleaseRowGroups(unreleased);
+  }
+
+  // Called before a column chunk of the row group at the given position is
+  // opened, to fetch the row groups up to depth positions beyond it
+  void WillOpen(size_t position) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t end = std::min(row_groups_.size(), position + 1 + depth_);
+    if (end <= prefetched_end_) {
+      return;
+    }
+    std::vector<int> row_groups(row_groups_.begin() + prefetched_end_,
+                                row_groups_.begin() + end);
+    prefetched_end_ = end;
+    reader_->PrefetchRowGroups(row_groups, column_indices_);
+  }
+
+  // Called once a column chunk of the row group at the given position is open
+  void Opened(size_t position) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (++num_opened_[position] == column_indices_.size()) {
+      reader_->ReleaseRowGroups({row_groups_[position]});
+    }
+  }
+
+ private:
+  ParquetFileReader* reader_;
+  const std::vector<int> row_groups_;
+  const std::vector<int> column_indices_;
+  const size_t depth_;
+  std::mutex mutex_;
+  // Number of column chunks opened, by position in row_groups_
+  std::vector<size_t> num_opened_;
+  // Position in row_groups_ of the first row group not prefetched yet
+  size_t prefetched_end_;
+};
+
+class PrefetchingFileColumnIterator : public FileColumnIterator {
+ public:
+  PrefetchingFileColumnIterator(int column_index, ParquetFileReader* reader,
+                                std::vector<int> row_groups,
+                                std::shared_ptr<RowGroupPrefetcher> prefetcher)
+      : FileColumnIterator(column_index, reader, std::move(row_groups)),
+        prefetcher_(std::move(prefetcher)),
+        position_(0) {}
+
+  std::unique_ptr<::parquet::PageReader> NextChunk() override {
+    if (row_groups_.empty()) {
+      return nullptr;
+    }
+    const size_t position = position_++;
+    prefetcher_->WillOpen(position);
+    auto page_reader = FileColumnIterator::NextChunk();
+    prefetcher_->Opened(position);
+    return page_reader;
+  }
+
+ private:
+  std::shared_ptr<RowGroupPrefetcher> prefetcher_;
+  size_t position_;
+};
+
 // ----------------------------------------------------------------------
 // FileReaderImpl forward declaration
 
@@ -106,6 +240,9 @@ class FileReaderImpl : public FileReader {
       : pool_(pool), reader_(std::move(reader)), reader_properties_(properties) {}
 
   Status Init() {
+    if (reader_properties_.read_dictionary_if_encoded()) {
+      SetReadDictionaryIfEncoded(*reader_->metadata(), &reader_properties_);
+    }
     return SchemaManifest::Make(reader_->metadata()->schema(),
                                 reader_->metadata()->key_value_metadata(),
                                 reader_properties_, &manifest_);
@@ -117,6 +254,20 @@ class FileReaderImpl : public FileReader {
     };
   }
 
+  // Iterators over the given row groups prefetching them as they go, which are
+  // to be created for each of the given leaf columns
+  FileColumnIteratorFactory PrefetchingRowGroupsFactory(
+      std::vector<int> row_groups, const std::unordered_set<int>& column_indices,
+      int depth) {
+    std::vector<int> sorted_columns(column_indices.begin(), column_indices.end());
+    std::sort(sorted_columns.begin(), sorted_columns.end());
+    auto prefetcher = std::make_shared<RowGroupPrefetcher>(
+        reader_.get(), row_groups, std::move(sorted_columns), depth);
+    return [row_groups, prefetcher](int i, ParquetFileReader* reader) {
+      return new PrefetchingFileColumnIterator(i, reader, row_groups, prefetcher);
+    };
+  }
+
   FileColumnIteratorFactory AllRowGroupsFactory() {
     return SomeRowGroupsFactory(Iota(reader_->metadata()->num_row_groups()));
   }
@@ -164,12 +315,20 @@ class FileReaderImpl : public FileReader {
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
                         std::unique_ptr<ColumnReaderImpl>* out) {
+    return GetFieldReader(i, included_leaves, SomeRowGroupsFactory(row_groups), out);
+  }
+
+  Status GetFieldReader(int i,
+                        const std::shared_ptr<std::unordered_set<int>>& included_leaves,
+                        FileColumnIteratorFactory iterator_factory,
+                        std::unique_ptr<ColumnReaderImpl>* out) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = std::move(iterator_factory);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
+    ctx->zero_copy_pages = reader_properties_.zero_copy_pages();
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
@@ -182,6 +341,7 @@ class FileReaderImpl : public FileReader {
                          std::shared_ptr<Field>* out_field,
                          std::shared_ptr<ChunkedArray>* out) {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
+    ARROW_TRACE_SPAN_DETAIL("parquet::ReadColumn", "field " + std::to_string(i));
     std::unique_ptr<ColumnReaderImpl> reader;
     RETURN_NOT_OK(GetFieldReader(i, included_leaves, row_groups, &reader));
 
@@ -264,12 +424,21 @@ class FileReaderImpl : public FileReader {
                               const std::vector<int>& column_indices,
                               std::unique_ptr<RecordBatchReader>* out) override;
 
+  // Pre-buffer the given column chunks if ArrowReaderProperties::pre_buffer()
+  Status PreBuffer(const std::vector<int>& row_groups,
+                   const std::vector<int>& column_indices);
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               std::unique_ptr<RecordBatchReader>* out) override {
     return GetRecordBatchReader(row_group_indices,
                                 Iota(reader_->metadata()->num_columns()), out);
   }
 
+  Status GetFieldReaders(const std::vector<int>& row_group_indices,
+                         const std::vector<int>& column_indices,
+                         std::vector<std::shared_ptr<ColumnReader>>* out,
+                         std::shared_ptr<::arrow::Schema>* out_schema) override;
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -298,12 +467,19 @@ class FileReaderImpl : public FileReader {
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   RowGroupRecordBatchReader(std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers,
-                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size)
+                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size,
+                            bool use_threads, bool zero_copy_pages, MemoryPool* pool)
       : field_readers_(std::move(field_readers)),
         schema_(std::move(schema)),
-        batch_size_(batch_size) {}
-
-  ~RowGroupRecordBatchReader() override {}
+        batch_size_(batch_size),
+        use_threads_(use_threads),
+        zero_copy_pages_(zero_copy_pages),
+        pool_(pool) {}
+
+  ~RowGroupRecordBatchReader() override {
+    // The decode tasks of a batch read ahead reference the field readers
+    ARROW_UNUSED(FinishBatch());
+  }
 
   std::shared_ptr<::arrow::Schema> schema() const override { return schema_; }
 
@@ -319,24 +495,55 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
     std::vector<std::shared_ptr<Field>> fields;
 
     auto included_leaves = VectorToSharedSet(column_indices);
+    const int prefetch_depth = reader->reader_properties_.row_group_prefetch_depth();
+    // The iterators of all columns share the prefetcher
+    FileColumnIteratorFactory iterator_factory =
+        prefetch_depth > 0 ? reader->PrefetchingRowGroupsFactory(
+                                 row_groups, *included_leaves, prefetch_depth)
+                           : reader->SomeRowGroupsFactory(row_groups);
     for (size_t i = 0; i < field_indices.size(); ++i) {
-      RETURN_NOT_OK(reader->GetFieldReader(field_indices[i], included_leaves, row_groups,
-                                           &field_readers[i]));
+      RETURN_NOT_OK(reader->GetFieldReader(field_indices[i], included_leaves,
+                                           iterator_factory, &field_readers[i]));
       fields.push_back(field_readers[i]->field());
     }
-    out->reset(new RowGroupRecordBatchReader(std::move(field_readers),
-                                             ::arrow::schema(fields), batch_size));
+    out->reset(new RowGroupRecordBatchReader(
+        std::move(field_readers), ::arrow::schema(fields), batch_size,
+        reader->reader_properties_.use_threads(),
+        reader->reader_properties_.zero_copy_pages(), reader->pool_));
     return Status::OK();
   }
 
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
-    // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
-    // does not currently honor the use_threads option.
-    std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
-    for (size_t i = 0; i < field_readers_.size(); ++i) {
-      RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
-      if (columns[i]->num_chunks() > 1) {
-        return Status::NotImplemented("This class cannot yet iterate chunked arrays");
+    ARROW_TRACE_SPAN("parquet::ReadBatch");
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    if (use_threads_) {
+      // Each column of a batch is decoded by its own task on the CPU thread pool.
+      // Once a batch is complete the next one is started, so that it is decoded
+      // while the caller consumes this one.
+      if (pending_batch_.empty()) {
+        RETURN_NOT_OK(StartBatch());
+      }
+      RETURN_NOT_OK(FinishBatch());
+      columns = std::move(next_columns_);
+      if (!columns.empty() && columns[0]->length() > 0) {
+        RETURN_NOT_OK(StartBatch());
+      }
+    } else {
+      columns.resize(field_readers_.size());
+      for (size_t i = 0; i < field_readers_.size(); ++i) {
+        RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
+      }
+    }
+
+    for (auto& column : columns) {
+      if (column->num_chunks() > 1) {
+        // Columns referencing several data pages come out chunked
+        if (!zero_copy_pages_) {
+          return Status::NotImplemented("This class cannot yet iterate chunked arrays");
+        }
+        std::shared_ptr<Array> array;
+        RETURN_NOT_OK(::arrow::Concatenate(column->chunks(), pool_, &array));
+        column = std::make_shared<ChunkedArray>(std::move(array));
       }
     }
 
@@ -349,9 +556,41 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
   }
 
  private:
+  Status StartBatch() {
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    next_columns_.resize(field_readers_.size());
+    for (size_t i = 0; i < field_readers_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto fut, pool->Submit([this, i] {
+        return field_readers_[i]->NextBatch(batch_size_, &next_columns_[i]);
+      }));
+      pending_batch_.push_back(std::move(fut));
+    }
+    return Status::OK();
+  }
+
+  // Wait for all decode tasks of the pending batch, returning the first error
+  Status FinishBatch() {
+    Status final_status = Status::OK();
+    for (auto& fut : pending_batch_) {
+      Status st = fut.status();
+      if (!st.ok() && final_status.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    pending_batch_.clear();
+    return final_status;
+  }
+
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+  bool use_threads_;
+  bool zero_copy_pages_;
+  MemoryPool* pool_;
+
+  // Decode tasks of the batch read ahead, and the columns they fill in
+  std::vector<Future<Status>> pending_batch_;
+  std::vector<std::shared_ptr<ChunkedArray>> next_columns_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -404,6 +643,10 @@ class LeafReader : public ColumnReaderImpl {
         descr_(input_->descr()) {
     record_reader_ = RecordReader::Make(
         descr_, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+    // Only parent struct and list readers ask for the definition levels, so a
+    // top-level column can decode them straight into the validity bitmap
+    record_reader_->set_def_levels_to_bitmap(descr_->path()->ToDotVector().size() == 1);
+    record_reader_->set_zero_copy_values(ctx_->zero_copy_pages && IsZeroCopyLeaf());
     NextRowGroup();
   }
 
@@ -421,6 +664,7 @@ class LeafReader : public ColumnReaderImpl {
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
+    ARROW_TRACE_SPAN_DETAIL("parquet::DecodeColumn", descr_->path()->ToDotString());
 
     // Pre-allocation gives much better performance for flat columns
     record_reader_->Reserve(records_to_read);
@@ -442,12 +686,62 @@ class LeafReader : public ColumnReaderImpl {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  Status Skip(int64_t num_records) override {
+    if (descr_->max_repetition_level() > 0) {
+      std::shared_ptr<ChunkedArray> unused;
+      return NextBatch(num_records, &unused);
+    }
+
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    while (num_records > 0) {
+      if (!record_reader_->HasMoreData()) {
+        break;
+      }
+      int64_t records_skipped = record_reader_->SkipRecords(num_records);
+      num_records -= records_skipped;
+      if (records_skipped == 0) {
+        NextRowGroup();
+      }
+    }
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
   const ColumnDescriptor* descr() const override { return descr_; }
 
   ReaderType type() const override { return PRIMITIVE; }
 
  private:
+  // Whether the values of the column may be transferred as they are stored,
+  // so that they can reference the data pages: a required, non-nested column
+  // of the physical types PLAIN-encoded as in an Arrow array
+  bool IsZeroCopyLeaf() const {
+    if (descr_->max_definition_level() > 0 || descr_->max_repetition_level() > 0 ||
+        descr_->path()->ToDotVector().size() != 1) {
+      return false;
+    }
+    switch (descr_->physical_type()) {
+      case ::parquet::Type::INT32:
+      case ::parquet::Type::INT64:
+      case ::parquet::Type::FLOAT:
+      case ::parquet::Type::DOUBLE:
+        break;
+      default:
+        return false;
+    }
+    switch (field_->type()->id()) {
+      case ::arrow::Type::INT32:
+      case ::arrow::Type::INT64:
+      case ::arrow::Type::FLOAT:
+      case ::arrow::Type::DOUBLE:
+      case ::arrow::Type::TIMESTAMP:
+        return true;
+      default:
+        return false;
+    }
+  }
+
   void NextRowGroup() {
     std::unique_ptr<PageReader> page_reader = input_->NextChunk();
     record_reader_->SetPageReader(std::move(page_reader));
@@ -506,6 +800,12 @@ class NestedListReader : public ColumnReaderImpl {
     return Status::OK();
   }
 
+  Status Skip(int64_t num_records) override {
+    // Records can only be delimited by decoding the repetition levels
+    std::shared_ptr<ChunkedArray> unused;
+    return NextBatch(num_records, &unused);
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
 
   const ColumnDescriptor* descr() const override { return nullptr; }
@@ -533,6 +833,7 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
         children_(std::move(children)) {}
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
+  Status Skip(int64_t num_records) override;
   Status GetDefLevels(const int16_t** data, int64_t* length) override;
   Status GetRepLevels(const int16_t** data, int64_t* length) override;
   const std::shared_ptr<Field> field() override { return filtered_field_; }
@@ -657,6 +958,15 @@ Status StructReader::GetRepLevels(const int16_t** data, int64_t* length) {
   return Status::NotImplemented("GetRepLevels is not implemented for struct");
 }
 
+Status StructReader::Skip(int64_t num_records) {
+  // The struct validity is derived from the children levels of each batch, so
+  // the children can be skipped independently
+  for (auto& child : children_) {
+    RETURN_NOT_OK(child->Skip(num_records));
+  }
+  return Status::OK();
+}
+
 Status StructReader::NextBatch(int64_t records_to_read,
                                std::shared_ptr<ChunkedArray>* out) {
   std::vector<std::shared_ptr<Array>> children_arrays;
@@ -773,10 +1083,63 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_in
   for (auto row_group_index : row_group_indices) {
     RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
   }
+  if (reader_properties_.row_group_prefetch_depth() > 0) {
+    // The row groups are pre-buffered as they are read
+    for (auto column_index : column_indices) {
+      RETURN_NOT_OK(BoundsCheckColumn(column_index));
+    }
+  } else {
+    RETURN_NOT_OK(PreBuffer(row_group_indices, column_indices));
+  }
   return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
                                          reader_properties_.batch_size(), out);
 }
 
+Status FileReaderImpl::GetFieldReaders(const std::vector<int>& row_group_indices,
+                                       const std::vector<int>& column_indices,
+                                       std::vector<std::shared_ptr<ColumnReader>>* out,
+                                       std::shared_ptr<::arrow::Schema>* out_schema) {
+  for (auto row_group_index : row_group_indices) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
+  }
+  std::vector<int> field_indices;
+  if (!manifest_.GetFieldIndices(column_indices, &field_indices)) {
+    return Status::Invalid("Invalid column index");
+  }
+  RETURN_NOT_OK(PreBuffer(row_group_indices, column_indices));
+
+  auto included_leaves = VectorToSharedSet(column_indices);
+  std::vector<std::shared_ptr<ColumnReader>> field_readers;
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int field_index : field_indices) {
+    std::unique_ptr<ColumnReaderImpl> field_reader;
+    RETURN_NOT_OK(
+        GetFieldReader(field_index, included_leaves, row_group_indices, &field_reader));
+    fields.push_back(field_reader->field());
+    field_readers.push_back(std::move(field_reader));
+  }
+  *out = std::move(field_readers);
+  *out_schema = ::arrow::schema(std::move(fields));
+  return Status::OK();
+}
+
+Status FileReaderImpl::PreBuffer(const std::vector<int>& row_groups,
+                                 const std::vector<int>& column_indices) {
+  if (!reader_properties_.pre_buffer()) {
+    return Status::OK();
+  }
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (auto row_group_index : row_groups) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
+  }
+  for (auto column_index : column_indices) {
+    RETURN_NOT_OK(BoundsCheckColumn(column_index));
+  }
+  reader_->PreBuffer(row_groups, column_indices);
+  return Status::OK();
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
                                  std::unique_ptr<ColumnReader>* out) {
   RETURN_NOT_OK(BoundsCheckColumn(i));
@@ -785,6 +1148,7 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx->pool = pool_;
   ctx->iterator_factory = iterator_factory;
   ctx->filter_leaves = false;
+  ctx->zero_copy_pages = reader_properties_.zero_copy_pages();
   std::unique_ptr<ColumnReaderImpl> result;
   RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, &result));
   out->reset(result.release());
@@ -795,6 +1159,9 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
                                      const std::vector<int>& indices,
                                      std::shared_ptr<Table>* out) {
   BEGIN_PARQUET_CATCH_EXCEPTIONS
+  ARROW_TRACE_SPAN_DETAIL("parquet::ReadRowGroups",
+                          std::to_string(row_groups.size()) + " row groups, " +
+                              std::to_string(indices.size()) + " columns");
 
   // We only need to read schema fields which have columns indicated
   // in the indices vector
@@ -803,6 +1170,9 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return Status::Invalid("Invalid column index");
   }
 
+  // Issue coalesced reads for all the selected column chunks upfront
+  RETURN_NOT_OK(PreBuffer(row_groups, indices));
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Field>> fields(num_fields);
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
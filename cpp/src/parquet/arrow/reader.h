@@ -172,6 +172,21 @@ class PARQUET_EXPORT FileReader {
                                        const std::vector<int>& column_indices,
                                        std::shared_ptr<::arrow::RecordBatchReader>* out);
 
+  /// \brief Return a reader for each top level schema field having leaves in
+  ///     column_indices, restricted to those leaves and to the row groups
+  ///     selected from row_group_indices, along with the schema of the fields.
+  ///
+  /// Unlike a RecordBatchReader, the field readers can be advanced
+  /// independently, e.g. to only read the rows of some columns for which a
+  /// predicate evaluated on other columns holds. The readers must not outlive
+  /// the FileReader.
+  /// \returns error Status if either row_group_indices or column_indices
+  ///    contains invalid index
+  virtual ::arrow::Status GetFieldReaders(
+      const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+      std::vector<std::shared_ptr<ColumnReader>>* out,
+      std::shared_ptr<::arrow::Schema>* out_schema) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
@@ -253,6 +268,14 @@ class PARQUET_EXPORT ColumnReader {
   // the data available in the file.
   virtual ::arrow::Status NextBatch(int64_t batch_size,
                                     std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
+
+  // Advance past the next num_records records without materializing them,
+  // as far as the column structure allows. Flat columns skip undecoded data
+  // pages entirely; nested columns are decoded and discarded.
+  //
+  // Returns Status::OK if the data in the file is exhausted before
+  // num_records records were skipped.
+  virtual ::arrow::Status Skip(int64_t num_records) = 0;
 };
 
 /// \brief Experimental helper class for bindings (like Python) that struggle
@@ -335,8 +335,18 @@ struct SchemaTreeContext {
 };
 
 bool IsDictionaryReadSupported(const DataType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+  // Only supported currently for types stored without conversion as BYTE_ARRAY,
+  // FIXED_LEN_BYTE_ARRAY, INT32 or INT64
+  switch (type.id()) {
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+      return true;
+    default:
+      return false;
+  }
 }
 
 Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_node,
@@ -809,13 +819,25 @@ Status TransferInt(RecordReader* reader, MemoryPool* pool,
   return Status::OK();
 }
 
-std::shared_ptr<Array> TransferZeroCopy(RecordReader* reader,
-                                        const std::shared_ptr<DataType>& type) {
-  std::vector<std::shared_ptr<Buffer>> buffers = {reader->ReleaseIsValid(),
-                                                  reader->ReleaseValues()};
-  auto data = std::make_shared<::arrow::ArrayData>(type, reader->values_written(),
-                                                   buffers, reader->null_count());
-  return ::arrow::MakeArray(data);
+Datum TransferZeroCopy(RecordReader* reader, const std::shared_ptr<DataType>& type) {
+  std::vector<std::shared_ptr<Buffer>> values = reader->ReleaseValueChunks();
+  if (values.size() == 1) {
+    std::vector<std::shared_ptr<Buffer>> buffers = {reader->ReleaseIsValid(),
+                                                    std::move(values[0])};
+    auto data = std::make_shared<::arrow::ArrayData>(type, reader->values_written(),
+                                                     buffers, reader->null_count());
+    return ::arrow::MakeArray(data);
+  }
+  // Values referencing several data pages, only of required columns
+  const int64_t byte_width =
+      checked_cast<const ::arrow::FixedWidthType&>(*type).bit_width() / 8;
+  ::arrow::ArrayVector chunks;
+  for (auto& buffer : values) {
+    const int64_t length = buffer->size() / byte_width;
+    chunks.push_back(::arrow::MakeArray(::arrow::ArrayData::Make(
+        type, length, {nullptr, std::move(buffer)}, /*null_count=*/0)));
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), type);
 }
 
 Status TransferBool(RecordReader* reader, MemoryPool* pool, Datum* out) {
@@ -22,11 +22,13 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/tracing.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
@@ -71,11 +73,14 @@ class FileColumnIterator {
 
   virtual ~FileColumnIterator() {}
 
-  std::unique_ptr<::parquet::PageReader> NextChunk() {
+  virtual std::unique_ptr<::parquet::PageReader> NextChunk() {
     if (row_groups_.empty()) {
       return nullptr;
     }
 
+    ARROW_TRACE_SPAN_DETAIL("parquet::OpenColumnChunk",
+                            "row group " + std::to_string(row_groups_.front()) +
+                                ", column " + std::to_string(column_index_));
     auto row_group_reader = reader_->RowGroup(row_groups_.front());
     row_groups_.pop_front();
     return row_group_reader->GetColumnPageReader(column_index_);
@@ -117,6 +122,7 @@ struct ReaderContext {
   FileColumnIteratorFactory iterator_factory;
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
+  bool zero_copy_pages = false;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
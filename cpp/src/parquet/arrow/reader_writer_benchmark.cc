@@ -28,6 +28,7 @@
 #include "parquet/platform.h"
 
 #include "arrow/api.h"
+#include "arrow/testing/random.h"
 
 using arrow::BooleanBuilder;
 using arrow::NumericBuilder;
@@ -164,6 +165,47 @@ BENCHMARK_TEMPLATE2(BM_WriteColumn, true, DoubleType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, false, BooleanType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, true, BooleanType);
 
+// A list<struct<a: int32, b: int64>> column of BENCHMARK_SIZE values in lists of
+// 8 entries on average, some of them empty, where the structs and leaves have
+// the given percentage of nulls
+std::shared_ptr<::arrow::Table> ListOfStructTable(int64_t null_percent) {
+  const double null_probability = static_cast<double>(null_percent) / 100;
+  const int64_t num_lists = BENCHMARK_SIZE / 8;
+  ::arrow::random::RandomArrayGenerator rand(/*seed=*/0x5eed);
+
+  auto a = rand.Int32(BENCHMARK_SIZE, 0, 1000, null_probability);
+  auto b = rand.Int64(BENCHMARK_SIZE, 0, 1000, null_probability);
+  // Only the validity bitmap of this is used
+  auto struct_validity = rand.Int8(BENCHMARK_SIZE, 0, 0, null_probability);
+
+  std::shared_ptr<::arrow::Array> structs =
+      ::arrow::StructArray::Make({a, b}, std::vector<std::string>{"a", "b"},
+                                 struct_validity->null_bitmap(),
+                                 struct_validity->null_count())
+          .ValueOrDie();
+  auto offsets = rand.Offsets(num_lists + 1, 0, static_cast<int32_t>(BENCHMARK_SIZE));
+  auto values_field = ::arrow::field("item", structs->type());
+  auto lists = std::make_shared<::arrow::ListArray>(
+      ::arrow::list(values_field), num_lists, offsets->data()->buffers[1], structs);
+
+  auto field = ::arrow::field("column", lists->type(), /*nullable=*/false);
+  return ::arrow::Table::Make(::arrow::schema({field}), {lists});
+}
+
+static void BM_WriteListOfStructColumn(::benchmark::State& state) {
+  std::shared_ptr<::arrow::Table> table = ListOfStructTable(state.range(0));
+
+  while (state.KeepRunning()) {
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(
+        WriteTable(*table, ::arrow::default_memory_pool(), output, BENCHMARK_SIZE));
+  }
+  state.SetBytesProcessed(state.iterations() * BENCHMARK_SIZE *
+                          (sizeof(int32_t) + sizeof(int64_t)));
+}
+
+BENCHMARK(BM_WriteListOfStructColumn)->Arg(0)->Arg(1)->Arg(50);
+
 template <bool nullable, typename ParquetType>
 static void BM_ReadColumn(::benchmark::State& state) {
   using T = typename ParquetType::c_type;
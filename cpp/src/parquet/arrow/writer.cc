@@ -28,10 +28,12 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/extension_type.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 #include "parquet/arrow/path_internal.h"
 #include "parquet/arrow/reader_internal.h"
@@ -57,6 +59,7 @@ using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
 using arrow::Table;
@@ -348,21 +351,31 @@ class ArrowColumnWriterV2 {
   // A ChunkedArray).
   // level_builders should contain one MultipathLevelBuilder per chunk of the
   // Arrow-column to write.
+  // first_leaf is the index of the first leaf column in a buffered row group,
+  // or -1 if the leaf columns are obtained through NextColumn().
   ArrowColumnWriterV2(std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders,
-                      int leaf_count, RowGroupWriter* row_group_writer)
+                      int leaf_count, RowGroupWriter* row_group_writer,
+                      int first_leaf = -1)
       : level_builders_(std::move(level_builders)),
         leaf_count_(leaf_count),
-        row_group_writer_(row_group_writer) {}
+        row_group_writer_(row_group_writer),
+        first_leaf_(first_leaf) {}
 
   // Writes out all leaf parquet columns to the RowGroupWriter that this
   // object was constructed with.  Each leaf column is written fully before
-  // the next column is written (i.e. no buffering is assumed).
+  // the next column is written (i.e. no buffering is assumed), unless the
+  // row group is buffered.
   //
   // Columns are written in DFS order.
   Status Write(ArrowWriteContext* ctx) {
     for (int leaf_idx = 0; leaf_idx < leaf_count_; leaf_idx++) {
       ColumnWriter* column_writer;
-      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      if (first_leaf_ < 0) {
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      } else {
+        PARQUET_CATCH_NOT_OK(column_writer =
+                                 row_group_writer_->column(first_leaf_ + leaf_idx));
+      }
       for (auto& level_builder : level_builders_) {
         RETURN_NOT_OK(level_builder->Write(
             leaf_idx, ctx, [&](const MultipathLevelBuilderResult& result) {
@@ -382,7 +395,10 @@ class ArrowColumnWriterV2 {
             }));
       }
 
-      PARQUET_CATCH_NOT_OK(column_writer->Close());
+      // The columns of a buffered row group are closed with it, in order
+      if (first_leaf_ < 0) {
+        PARQUET_CATCH_NOT_OK(column_writer->Close());
+      }
     }
 
     return Status::OK();
@@ -398,14 +414,15 @@ class ArrowColumnWriterV2 {
   // RowGroupWriters (we could construct each builder on demand in that case).
   static ::arrow::Result<std::unique_ptr<ArrowColumnWriterV2>> Make(
       const ChunkedArray& data, int64_t offset, const int64_t size,
-      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer) {
+      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer,
+      int first_leaf = -1) {
     int64_t absolute_position = 0;
     int chunk_index = 0;
     int64_t chunk_offset = 0;
     if (data.length() == 0) {
       return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
           std::vector<std::unique_ptr<MultipathLevelBuilder>>{},
-          CalculateLeafCount(*data.type()), row_group_writer);
+          CalculateLeafCount(*data.type()), row_group_writer, first_leaf);
     }
     while (chunk_index < data.num_chunks() && absolute_position < offset) {
       const int64_t chunk_length = data.chunk(chunk_index)->length();
@@ -430,7 +447,8 @@ class ArrowColumnWriterV2 {
     bool is_nullable = false;
     // The row_group_writer hasn't been advanced yet so add 1 to the current
     // which is the one this instance will start writing for.
-    int column_index = row_group_writer->current_column() + 1;
+    int column_index =
+        first_leaf < 0 ? row_group_writer->current_column() + 1 : first_leaf;
     for (int leaf_offset = 0; leaf_offset < leaf_count; ++leaf_offset) {
       const SchemaField* schema_field = nullptr;
       RETURN_NOT_OK(
@@ -477,7 +495,7 @@ class ArrowColumnWriterV2 {
       values_written += chunk_write_size;
     }
     return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
-        std::move(builders), leaf_count, row_group_writer);
+        std::move(builders), leaf_count, row_group_writer, first_leaf);
   }
 
  private:
@@ -485,6 +503,7 @@ class ArrowColumnWriterV2 {
   std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders_;
   int leaf_count_;
   RowGroupWriter* row_group_writer_;
+  int first_leaf_;
 };
 
 class ArrowColumnWriter {
@@ -598,6 +617,7 @@ class FileWriterImpl : public FileWriter {
       : schema_(std::move(schema)),
         writer_(std::move(writer)),
         row_group_writer_(nullptr),
+        row_group_buffered_(false),
         column_write_context_(pool, arrow_properties.get()),
         arrow_properties_(std::move(arrow_properties)),
         closed_(false) {}
@@ -612,6 +632,7 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    row_group_buffered_ = false;
     return Status::OK();
   }
 
@@ -669,6 +690,8 @@ class FileWriterImpl : public FileWriter {
 
     if (chunk_size <= 0 && table.num_rows() > 0) {
       return Status::Invalid("chunk size per row_group must be greater than 0");
+    } else if (this->properties().max_row_group_length() <= 0) {
+      return Status::Invalid("max_row_group_length must be greater than 0");
     } else if (!table.schema()->Equals(*schema_, false)) {
       return Status::Invalid("table schema does not match this writer's. table:'",
                              table.schema()->ToString(), "' this:'", schema_->ToString(),
@@ -678,6 +701,9 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (arrow_properties_->use_threads()) {
+        return WriteBufferedRowGroup(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -700,8 +726,129 @@ class FileWriterImpl : public FileWriter {
     return Status::OK();
   }
 
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    RETURN_NOT_OK(batch.Validate());
+    if (properties().max_row_group_length() <= 0) {
+      return Status::Invalid("max_row_group_length must be greater than 0");
+    } else if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("record batch schema does not match this writer's. batch:'",
+                             batch.schema()->ToString(), "' this:'", schema_->ToString(),
+                             "'");
+    }
+
+    ::arrow::ChunkedArrayVector columns;
+    columns.reserve(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); i++) {
+      columns.push_back(std::make_shared<ChunkedArray>(batch.column(i)));
+    }
+
+    const int64_t max_rows = properties().max_row_group_length();
+    const int64_t max_bytes = properties().max_row_group_bytes();
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (row_group_writer_ == nullptr || !row_group_buffered_) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+      }
+      int64_t rows_in_group;
+      PARQUET_CATCH_NOT_OK(rows_in_group = row_group_writer_->num_rows());
+      const int64_t size =
+          std::min(max_rows - rows_in_group, batch.num_rows() - offset);
+      RETURN_NOT_OK_ELSE(WriteBufferedColumns(columns, offset, size),
+                         PARQUET_IGNORE_NOT_OK(Close()));
+      offset += size;
+
+      // The next batch starts a new row group once this one is full
+      int64_t buffered_bytes;
+      PARQUET_CATCH_NOT_OK(buffered_bytes = row_group_writer_->total_bytes_written() +
+                                            row_group_writer_->total_compressed_bytes());
+      if (rows_in_group + size >= max_rows || buffered_bytes >= max_bytes) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        row_group_writer_ = nullptr;
+      }
+    }
+    return Status::OK();
+  }
+
   const WriterProperties& properties() const { return *writer_->properties(); }
 
+  Status NewBufferedRowGroup() {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    row_group_buffered_ = true;
+    return Status::OK();
+  }
+
+  Status WriteBufferedRowGroup(const Table& table, int64_t offset, int64_t size) {
+    RETURN_NOT_OK(NewBufferedRowGroup());
+    return WriteBufferedColumns(table.columns(), offset, size);
+  }
+
+  // Appends a slice of every column to the open buffered row group. With
+  // use_threads, each column chunk is encoded and compressed into its own
+  // in-memory sink as a separate task; closing the row group then writes
+  // the column chunks out in schema order.
+  Status WriteBufferedColumns(const ::arrow::ChunkedArrayVector& columns, int64_t offset,
+                              int64_t size) {
+    const int num_columns = static_cast<int>(columns.size());
+    std::vector<int> first_leaves(num_columns);
+    int num_leaves = 0;
+    for (int i = 0; i < num_columns; i++) {
+      first_leaves[i] = num_leaves;
+      num_leaves += CalculateLeafCount(*columns[i]->type());
+    }
+
+    if (!arrow_properties_->use_threads()) {
+      for (int i = 0; i < num_columns; i++) {
+        RETURN_NOT_OK(WriteBufferedColumnChunk(*columns[i], offset, size,
+                                               first_leaves[i], &column_write_context_));
+      }
+      return Status::OK();
+    }
+
+    auto WriteColumnFunc = [&](int i) {
+      // The scratch buffers of the write context can't be shared across tasks
+      ArrowWriteContext ctx(memory_pool(), arrow_properties_.get());
+      return WriteBufferedColumnChunk(*columns[i], offset, size, first_leaves[i], &ctx);
+    };
+
+    std::vector<::arrow::Future<Status>> futures(num_columns);
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    for (int i = 0; i < num_columns; i++) {
+      ARROW_ASSIGN_OR_RAISE(futures[i], pool->Submit(WriteColumnFunc, i));
+    }
+    Status final_status = Status::OK();
+    for (auto& fut : futures) {
+      Status st = fut.status();
+      if (!st.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    return final_status;
+  }
+
+  Status WriteBufferedColumnChunk(const ChunkedArray& data, int64_t offset, int64_t size,
+                                  int first_leaf, ArrowWriteContext* ctx) {
+    if (arrow_properties_->engine_version() == ArrowWriterProperties::V1) {
+      ColumnWriter* column_writer;
+      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(first_leaf));
+
+      const SchemaField* schema_field = nullptr;
+      RETURN_NOT_OK(schema_manifest_.GetColumnField(first_leaf, &schema_field));
+
+      ArrowColumnWriter arrow_writer(ctx, column_writer, schema_field, &schema_manifest_);
+      return arrow_writer.Write(data, offset, size);
+    } else if (arrow_properties_->engine_version() == ArrowWriterProperties::V2) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<ArrowColumnWriterV2> writer,
+          ArrowColumnWriterV2::Make(data, offset, size, schema_manifest_,
+                                    row_group_writer_, first_leaf));
+      return writer->Write(ctx);
+    }
+    return Status::NotImplemented("Unknown engine version.");
+  }
+
   ::arrow::MemoryPool* memory_pool() const override {
     return column_write_context_.memory_pool;
   }
@@ -719,6 +866,7 @@ class FileWriterImpl : public FileWriter {
 
   std::unique_ptr<ParquetFileWriter> writer_;
   RowGroupWriter* row_group_writer_;
+  bool row_group_buffered_;
   ArrowWriteContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
   bool closed_;
@@ -27,6 +27,7 @@ namespace arrow {
 
 class Array;
 class ChunkedArray;
+class RecordBatch;
 class Schema;
 class Table;
 
@@ -76,6 +77,15 @@ class PARQUET_EXPORT FileWriter {
 
   virtual ::arrow::Status WriteColumnChunk(
       const std::shared_ptr<::arrow::ChunkedArray>& data) = 0;
+
+  /// \brief Append a RecordBatch to the buffered row group, starting a new one
+  /// if none is open.
+  ///
+  /// The row group is written out once it reaches max_row_group_length rows
+  /// or max_row_group_bytes encoded bytes, so many small batches end up in few
+  /// row groups without first being concatenated into a Table.
+  virtual ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch) = 0;
+
   virtual ::arrow::Status Close() = 0;
   virtual ~FileWriter();
 
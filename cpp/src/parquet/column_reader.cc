@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -129,6 +130,32 @@ int LevelDecoder::Decode(int batch_size, int16_t* levels) {
   return num_decoded;
 }
 
+int LevelDecoder::DecodeValidityBitmap(int batch_size, uint8_t* valid_bits,
+                                       int64_t valid_bits_offset, int64_t* null_count) {
+  DCHECK_EQ(bit_width_, 1);
+  int num_decoded = 0;
+
+  int num_values = std::min(num_values_remaining_, batch_size);
+  if (encoding_ == Encoding::RLE) {
+    num_decoded = rle_decoder_->GetBatchBitmap(num_values, valid_bits,
+                                               valid_bits_offset, null_count);
+  } else {
+    // Bit-packed levels of width 1 are the bitmap bits, copy them a word at a time
+    while (num_decoded < num_values) {
+      const int batch = std::min(num_values - num_decoded, 32);
+      uint32_t word = 0;
+      if (!bit_packed_decoder_->GetValue(batch, &word)) {
+        break;
+      }
+      BitUtil::SetBitsFromWord(valid_bits, valid_bits_offset + num_decoded, word, batch);
+      *null_count += batch - BitUtil::PopCount(word);
+      num_decoded += batch;
+    }
+  }
+  num_values_remaining_ -= num_decoded;
+  return num_decoded;
+}
+
 ReaderProperties default_reader_properties() {
   static ReaderProperties default_reader_properties;
   return default_reader_properties;
@@ -171,7 +198,10 @@ class SerializedPageReader : public PageReader {
                        const CryptoContext* crypto_ctx)
       : stream_(std::move(stream)),
         decompression_buffer_(AllocateBuffer(pool, 0)),
+        compressed_buffer_(AllocateBuffer(pool, 0)),
+        page_buffer_limit_(DEFAULT_PAGE_BUFFER_LIMIT),
         page_ordinal_(0),
+        next_data_page_(0),
         seen_num_rows_(0),
         total_num_rows_(total_num_rows),
         decryption_buffer_(AllocateBuffer(pool, 0)) {
@@ -188,6 +218,19 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  void set_page_buffer_limit(int64_t limit) override { page_buffer_limit_ = limit; }
+
+  void set_page_locations(std::vector<PageLocation> page_locations) override {
+    page_locations_ = std::move(page_locations);
+  }
+
+  int64_t SkipDataPages(int64_t num_rows) override;
+
+  bool zero_copy_data_pages() const override {
+    return decompressor_ == nullptr && crypto_ctx_.data_decryptor == nullptr &&
+           stream_->supports_zero_copy();
+  }
+
  private:
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         const std::string& page_aad);
@@ -197,6 +240,10 @@ class SerializedPageReader : public PageReader {
   std::shared_ptr<Buffer> DecompressPage(int compressed_len, int uncompressed_len,
                                          const uint8_t* page_buffer);
 
+  // Size a scratch buffer for the current page. It only grows, unless it
+  // has grown past page_buffer_limit_.
+  void ResizeScratchBuffer(ResizableBuffer* buffer, int64_t size);
+
   std::shared_ptr<ArrowInputStream> stream_;
 
   format::PageHeader current_page_header_;
@@ -205,6 +252,10 @@ class SerializedPageReader : public PageReader {
   // Compression codec to use.
   std::unique_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
+  // Holds the compressed or encrypted bytes of a page read from a stream that
+  // can't hand them out without copying, as they are consumed right away
+  std::shared_ptr<ResizableBuffer> compressed_buffer_;
+  int64_t page_buffer_limit_;
 
   // The fields below are used for calculation of AAD (additional authenticated data)
   // suffix which is part of the Parquet Modular Encryption.
@@ -218,6 +269,12 @@ class SerializedPageReader : public PageReader {
   CryptoContext crypto_ctx_;
   int16_t page_ordinal_;  // page ordinal does not count the dictionary page
 
+  // The locations of the data pages if known, and the index of the next one
+  std::vector<PageLocation> page_locations_;
+  int next_data_page_;
+  // A dictionary page read by SkipDataPages, to be returned by NextPage
+  std::shared_ptr<Page> dictionary_page_;
+
   // Maximum allowed page size
   uint32_t max_page_header_size_;
 
@@ -269,6 +326,10 @@ void SerializedPageReader::UpdateDecryption(const std::shared_ptr<Decryptor>& de
 }
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (dictionary_page_ != nullptr) {
+    return std::move(dictionary_page_);
+  }
+
   // Loop here because there may be unhandled page types that we skip until
   // finding a page that we do know what to do with
 
@@ -316,7 +377,17 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
                        data_page_aad_);
     }
     // Read the compressed data page.
-    PARQUET_ASSIGN_OR_THROW(auto page_buffer, stream_->Read(compressed_len));
+    std::shared_ptr<Buffer> page_buffer;
+    if ((decompressor_ != nullptr || crypto_ctx_.data_decryptor != nullptr) &&
+        !stream_->supports_zero_copy()) {
+      ResizeScratchBuffer(compressed_buffer_.get(), compressed_len);
+      PARQUET_ASSIGN_OR_THROW(
+          int64_t bytes_read,
+          stream_->Read(compressed_len, compressed_buffer_->mutable_data()));
+      page_buffer = SliceBuffer(compressed_buffer_, 0, bytes_read);
+    } else {
+      PARQUET_ASSIGN_OR_THROW(page_buffer, stream_->Read(compressed_len));
+    }
     if (page_buffer->size() != compressed_len) {
       std::stringstream ss;
       ss << "Page was smaller (" << page_buffer->size() << ") than expected ("
@@ -326,12 +397,13 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     // Decrypt it if we need to
     if (crypto_ctx_.data_decryptor != nullptr) {
-      PARQUET_THROW_NOT_OK(decryption_buffer_->Resize(
-          compressed_len - crypto_ctx_.data_decryptor->CiphertextSizeDelta(), false));
+      ResizeScratchBuffer(
+          decryption_buffer_.get(),
+          compressed_len - crypto_ctx_.data_decryptor->CiphertextSizeDelta());
       compressed_len = crypto_ctx_.data_decryptor->Decrypt(
           page_buffer->data(), compressed_len, decryption_buffer_->mutable_data());
 
-      page_buffer = decryption_buffer_;
+      page_buffer = SliceBuffer(decryption_buffer_, 0, compressed_len);
     }
     // Uncompress it if we need to
     if (decompressor_ != nullptr) {
@@ -355,6 +427,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
                                               is_sorted);
     } else if (page_type == PageType::DATA_PAGE) {
       ++page_ordinal_;
+      ++next_data_page_;
       const format::DataPageHeader& header = current_page_header_.data_page_header;
 
       if (header.num_values < 0) {
@@ -370,6 +443,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
                                           uncompressed_len, page_statistics);
     } else if (page_type == PageType::DATA_PAGE_V2) {
       ++page_ordinal_;
+      ++next_data_page_;
       const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
 
       if (header.num_values < 0) {
@@ -397,13 +471,53 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
   return std::shared_ptr<Page>(nullptr);
 }
 
+int64_t SerializedPageReader::SkipDataPages(int64_t num_rows) {
+  // The page ordinals of encrypted pages are part of their AAD, don't bother
+  if (page_locations_.empty() || crypto_ctx_.data_decryptor != nullptr) {
+    return 0;
+  }
+  const int num_pages = static_cast<int>(page_locations_.size());
+
+  int64_t rows_skipped = 0;
+  while (next_data_page_ < num_pages) {
+    const PageLocation& location = page_locations_[next_data_page_];
+    const int64_t page_num_rows =
+        next_data_page_ + 1 < num_pages
+            ? page_locations_[next_data_page_ + 1].first_row_index -
+                  location.first_row_index
+            : total_num_rows_ - seen_num_rows_;
+    if (page_num_rows > num_rows - rows_skipped) {
+      break;
+    }
+
+    PARQUET_ASSIGN_OR_THROW(int64_t position, stream_->Tell());
+    if (position < location.offset && next_data_page_ == 0) {
+      // The dictionary page precedes the first data page and is never skipped
+      dictionary_page_ = NextPage();
+      if (dictionary_page_ == nullptr ||
+          dictionary_page_->type() != PageType::DICTIONARY_PAGE) {
+        throw ParquetException("Column chunk doesn't match its OffsetIndex");
+      }
+      PARQUET_ASSIGN_OR_THROW(position, stream_->Tell());
+    }
+    if (position != location.offset) {
+      // Stop skipping if the stream and the index disagree
+      break;
+    }
+
+    PARQUET_THROW_NOT_OK(stream_->Advance(location.compressed_page_size));
+    ++page_ordinal_;
+    ++next_data_page_;
+    seen_num_rows_ += page_num_rows;
+    rows_skipped += page_num_rows;
+  }
+  return rows_skipped;
+}
+
 std::shared_ptr<Buffer> SerializedPageReader::DecompressPage(int compressed_len,
                                                              int uncompressed_len,
                                                              const uint8_t* page_buffer) {
-  // Grow the uncompressed buffer if we need to.
-  if (uncompressed_len > static_cast<int>(decompression_buffer_->size())) {
-    PARQUET_THROW_NOT_OK(decompression_buffer_->Resize(uncompressed_len, false));
-  }
+  ResizeScratchBuffer(decompression_buffer_.get(), uncompressed_len);
 
   if (current_page_header_.type != format::PageType::DATA_PAGE_V2) {
     PARQUET_THROW_NOT_OK(
@@ -425,7 +539,14 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressPage(int compressed_len,
                                   uncompressed_len - levels_length, decompressed));
   }
 
-  return decompression_buffer_;
+  return SliceBuffer(decompression_buffer_, 0, uncompressed_len);
+}
+
+void SerializedPageReader::ResizeScratchBuffer(ResizableBuffer* buffer, int64_t size) {
+  const bool shrink_to_fit = buffer->capacity() > page_buffer_limit_;
+  if (size > buffer->size() || shrink_to_fit) {
+    PARQUET_THROW_NOT_OK(buffer->Resize(size, shrink_to_fit));
+  }
 }
 
 std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
@@ -457,6 +578,7 @@ class ColumnReaderImplBase {
         max_rep_level_(descr->max_repetition_level()),
         num_buffered_values_(0),
         num_decoded_values_(0),
+        data_offset_(0),
         pool_(pool),
         current_decoder_(nullptr),
         current_encoding_(Encoding::UNKNOWN) {}
@@ -495,6 +617,17 @@ class ColumnReaderImplBase {
     return definition_level_decoder_.Decode(static_cast<int>(batch_size), levels);
   }
 
+  // Read the definition levels of a column with a max definition level of 1
+  // directly into a validity bitmap
+  //
+  // Returns the number of decoded definition levels
+  int64_t ReadDefinitionLevelsBitmap(int64_t batch_size, uint8_t* valid_bits,
+                                     int64_t valid_bits_offset, int64_t* null_count) {
+    DCHECK_EQ(max_def_level_, 1);
+    return definition_level_decoder_.DecodeValidityBitmap(
+        static_cast<int>(batch_size), valid_bits, valid_bits_offset, null_count);
+  }
+
   bool HasNextInternal() {
     // Either there is no data page available yet, or the data page has been
     // exhausted
@@ -691,8 +824,11 @@ class ColumnReaderImplBase {
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
         }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -700,16 +836,12 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
     }
     current_encoding_ = encoding;
+    data_offset_ = levels_byte_size;
     current_decoder_->SetData(static_cast<int>(num_buffered_values_), buffer,
                               static_cast<int>(data_size));
   }
@@ -739,6 +871,9 @@ class ColumnReaderImplBase {
   // into memory
   int64_t num_decoded_values_;
 
+  // The offset of the encoded values in the current data page
+  int64_t data_offset_;
+
   ::arrow::MemoryPool* pool_;
 
   using DecoderType = TypedDecoder<DType>;
@@ -1036,6 +1171,11 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
       records_read += ReadRecordData(num_records);
     }
 
+    if (def_levels_to_bitmap_ && this->max_def_level_ == 1 &&
+        this->max_rep_level_ == 0) {
+      return records_read + ReadOptionalRecords(num_records - records_read);
+    }
+
     int64_t level_batch_size = std::max(kMinLevelBatchSize, num_records);
 
     // If we are in the middle of a record, we continue until reaching the
@@ -1097,6 +1237,49 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->max_rep_level_ > 0) {
+      throw ParquetException("Skipping records of repeated columns is not supported");
+    }
+
+    // Levels decoded by a previous ReadRecords call but not consumed yet
+    int64_t records_skipped = SkipDecodedLevels(num_records);
+
+    while (records_skipped < num_records) {
+      if (available_values_current_page() == 0) {
+        // Pages lying entirely within the skipped records aren't even read
+        records_skipped += this->pager_->SkipDataPages(num_records - records_skipped);
+        if (records_skipped == num_records || !this->HasNextInternal()) {
+          break;
+        }
+      }
+      const int64_t to_skip = num_records - records_skipped;
+      const int64_t available = available_values_current_page();
+      if (to_skip >= available) {
+        // The rest of the page is skipped, don't bother decoding it
+        this->ConsumeBufferedValues(available);
+        records_skipped += available;
+      } else if (this->max_def_level_ > 0) {
+        ReserveLevels(to_skip);
+        int64_t levels_read =
+            this->ReadDefinitionLevels(to_skip, this->def_levels() + levels_written_);
+        if (levels_read == 0) {
+          break;
+        }
+        levels_written_ += levels_read;
+        records_skipped += SkipDecodedLevels(levels_read);
+      } else {
+        SkipValues(to_skip);
+        this->ConsumeBufferedValues(to_skip);
+        records_skipped += to_skip;
+      }
+    }
+
+    // Drop the skipped levels as well as any previously consumed ones
+    Reset();
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1104,7 +1287,7 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   std::shared_ptr<ResizableBuffer> ReleaseValues() override {
     if (uses_values_) {
       auto result = values_;
-      PARQUET_THROW_NOT_OK(result->Resize(bytes_for_values(values_written_), true));
+      PARQUET_THROW_NOT_OK(result->Resize(bytes_for_values(values_buffered()), true));
       values_ = AllocateBuffer(this->pool_);
       return result;
     } else {
@@ -1112,6 +1295,31 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     }
   }
 
+  std::vector<std::shared_ptr<Buffer>> ReleaseValueChunks() override {
+    const int64_t num_buffered = values_buffered();
+    std::shared_ptr<Buffer> buffered = ReleaseValues();
+    if (value_slices_.empty()) {
+      return {std::move(buffered)};
+    }
+    // Interleave the referenced slices with the runs of copied values
+    std::vector<std::shared_ptr<Buffer>> chunks;
+    int64_t position = 0;
+    for (const ValueSlice& slice : value_slices_) {
+      if (slice.values_before > position) {
+        chunks.push_back(SliceBuffer(buffered, bytes_for_values(position),
+                                     bytes_for_values(slice.values_before - position)));
+        position = slice.values_before;
+      }
+      chunks.push_back(SliceBuffer(slice.page, slice.offset, slice.length));
+    }
+    if (num_buffered > position) {
+      chunks.push_back(SliceBuffer(buffered, bytes_for_values(position),
+                                   bytes_for_values(num_buffered - position)));
+    }
+    value_slices_.clear();
+    return chunks;
+  }
+
   std::shared_ptr<ResizableBuffer> ReleaseIsValid() override {
     if (nullable_values_) {
       auto result = valid_bits_;
@@ -1171,7 +1379,9 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
 
   void Reserve(int64_t capacity) override {
     ReserveLevels(capacity);
-    ReserveValues(capacity);
+    if (!zero_copy_column()) {
+      ReserveValues(capacity);
+    }
   }
 
   void ReserveLevels(int64_t capacity) {
@@ -1191,9 +1401,10 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   }
 
   void ReserveValues(int64_t capacity) {
-    if (values_written_ + capacity > values_capacity_) {
+    const int64_t num_buffered = values_buffered();
+    if (num_buffered + capacity > values_capacity_) {
       int64_t new_values_capacity = BitUtil::NextPower2(values_capacity_ + 1);
-      while (values_written_ + capacity > new_values_capacity) {
+      while (num_buffered + capacity > new_values_capacity) {
         new_values_capacity = BitUtil::NextPower2(new_values_capacity + 1);
       }
 
@@ -1271,17 +1482,65 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   }
 
   virtual void ReadValuesDense(int64_t values_to_read) {
+    if (ReferenceValues(values_to_read)) {
+      return;
+    }
+    ReserveValues(values_to_read);
     int64_t num_decoded =
         this->current_decoder_->Decode(ValuesHead<T>(), static_cast<int>(values_to_read));
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
+  // Reference the next num_values values of the current data page rather than
+  // decode them, if they are PLAIN-encoded in a zero-copy page at an offset
+  // suitably aligned for T
+  //
+  // \return Whether the values were referenced
+  bool ReferenceValues(int64_t num_values) {
+    if (!zero_copy_column() || num_values == 0 ||
+        this->current_encoding_ != Encoding::PLAIN ||
+        !this->pager_->zero_copy_data_pages()) {
+      return false;
+    }
+    // Every level of a required, non-nested column is a value
+    const Page& page = *this->current_page_;
+    const int64_t offset =
+        this->data_offset_ + this->num_decoded_values_ * static_cast<int64_t>(sizeof(T));
+    const int64_t length = num_values * static_cast<int64_t>(sizeof(T));
+    if (offset + length > page.size() ||
+        reinterpret_cast<uintptr_t>(page.data() + offset) % alignof(T) != 0) {
+      return false;
+    }
+    // Move the decoder past the referenced values
+    const int64_t end = offset + length;
+    this->current_decoder_->SetData(
+        static_cast<int>(available_values_current_page() - num_values),
+        page.data() + end, static_cast<int>(page.size() - end));
+
+    const int64_t num_buffered = values_buffered();
+    if (!value_slices_.empty()) {
+      ValueSlice& last = value_slices_.back();
+      if (last.values_before == num_buffered && last.page.get() == page.buffer().get() &&
+          last.offset + last.length == offset) {
+        last.length += length;
+        values_referenced_ += num_values;
+        return true;
+      }
+    }
+    value_slices_.push_back({num_buffered, page.buffer(), offset, length});
+    values_referenced_ += num_values;
+    return true;
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(int64_t num_records) {
     // Conservative upper bound
     const int64_t possible_num_values =
         std::max(num_records, levels_written_ - levels_position_);
-    ReserveValues(possible_num_values);
+    // Values referencing the data pages need no space
+    if (!zero_copy_column()) {
+      ReserveValues(possible_num_values);
+    }
 
     const int64_t start_levels_position = levels_position_;
 
@@ -1328,6 +1587,73 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  // Read the records of a flat optional column, decoding the definition
+  // levels straight into the validity bitmap rather than through def_levels()
+  //
+  // \return Number of records read
+  int64_t ReadOptionalRecords(int64_t num_records) {
+    int64_t records_read = 0;
+    while (records_read < num_records && this->HasNextInternal()) {
+      const int64_t batch_size =
+          std::min(num_records - records_read, available_values_current_page());
+      ReserveValues(batch_size);
+
+      int64_t null_count = 0;
+      const int64_t levels_read = this->ReadDefinitionLevelsBitmap(
+          batch_size, valid_bits_->mutable_data(), values_written_, &null_count);
+      if (levels_read == 0) {
+        break;
+      }
+      ReadValuesSpaced(levels_read, null_count);
+      this->ConsumeBufferedValues(levels_read);
+
+      values_written_ += levels_read;
+      null_count_ += null_count;
+      records_read += levels_read;
+    }
+    return records_read;
+  }
+
+  // Skip up to num_records of the decoded but not yet consumed levels of a
+  // non-repeated column, along with their values
+  //
+  // \return Number of records skipped
+  int64_t SkipDecodedLevels(int64_t num_records) {
+    const int64_t records_skipped =
+        std::min(levels_written_ - levels_position_, num_records);
+    const int16_t* def_levels = this->def_levels() + levels_position_;
+    int64_t values_to_skip = 0;
+    for (int64_t i = 0; i < records_skipped; ++i) {
+      if (def_levels[i] == this->max_def_level_) {
+        ++values_to_skip;
+      }
+    }
+    SkipValues(values_to_skip);
+    levels_position_ += records_skipped;
+    this->ConsumeBufferedValues(records_skipped);
+    return records_skipped;
+  }
+
+  // Decode and discard values from the current data page
+  void SkipValues(int64_t num_values) {
+    constexpr int64_t kSkipBatchSize = 1024;
+    if (num_values == 0) {
+      return;
+    }
+    if (skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_, kSkipBatchSize * sizeof(T));
+    }
+    T* scratch = reinterpret_cast<T*>(skip_scratch_->mutable_data());
+    while (num_values > 0) {
+      int64_t values_read =
+          this->ReadValues(std::min(kSkipBatchSize, num_values), scratch);
+      if (values_read == 0) {
+        throw ParquetException("Column chunk ended while skipping values");
+      }
+      num_values -= values_read;
+    }
+  }
+
   void DebugPrintState() override {
     const int16_t* def_levels = this->def_levels();
     const int16_t* rep_levels = this->rep_levels();
@@ -1348,7 +1674,7 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     std::cout << std::endl;
 
     std::cout << "values: ";
-    for (int64_t i = 0; i < this->values_written(); ++i) {
+    for (int64_t i = 0; i < values_buffered(); ++i) {
       std::cout << vals[i] << " ";
     }
     std::cout << std::endl;
@@ -1364,14 +1690,45 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
       values_written_ = 0;
       values_capacity_ = 0;
       null_count_ = 0;
+      values_referenced_ = 0;
+      value_slices_.clear();
     }
   }
 
  protected:
   template <typename T>
   T* ValuesHead() {
-    return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
+    return reinterpret_cast<T*>(values_->mutable_data()) + values_buffered();
   }
+
+  // The number of values written to values_, rather than referenced
+  int64_t values_buffered() const { return values_written_ - values_referenced_; }
+
+  // Whether values may reference the data pages, see set_zero_copy_values
+  bool zero_copy_column() const {
+    return zero_copy_values_ && kPlainIsArrowLayout && this->max_def_level_ == 0 &&
+           this->max_rep_level_ == 0;
+  }
+
+  // PLAIN encoding lays out the values of these types as in an Arrow array
+  static constexpr bool kPlainIsArrowLayout =
+      DType::type_num == Type::INT32 || DType::type_num == Type::INT64 ||
+      DType::type_num == Type::FLOAT || DType::type_num == Type::DOUBLE;
+
+  // A run of values referenced in a data page, preceded by values_before of
+  // the values written to values_
+  struct ValueSlice {
+    int64_t values_before;
+    std::shared_ptr<Buffer> page;
+    int64_t offset;
+    int64_t length;
+  };
+
+  int64_t values_referenced_ = 0;
+  std::vector<ValueSlice> value_slices_;
+
+  // Scratch space for the values decoded and discarded by SkipRecords
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1467,13 +1824,32 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+std::shared_ptr<::arrow::DataType> DictionaryValueType(const ColumnDescriptor* descr) {
+  switch (descr->physical_type()) {
+    case Type::INT32:
+      return ::arrow::int32();
+    case Type::INT64:
+      return ::arrow::int64();
+    case Type::BYTE_ARRAY:
+      return ::arrow::binary();
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return ::arrow::fixed_size_binary(descr->type_length());
+    default:
+      throw ParquetException("Cannot read " + TypeToString(descr->physical_type()) +
+                             " column directly as dictionary");
+  }
+}
+
+template <typename DType>
+class DictionaryRecordReaderImpl : public TypedRecordReader<DType>,
+                                   virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
+  DictionaryRecordReaderImpl(const ColumnDescriptor* descr, ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, pool),
+        builder_(DictionaryValueType(descr), pool) {
     this->read_dictionary_ = true;
+    // The values are decoded straight into the builder
+    this->uses_values_ = false;
   }
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
@@ -1500,7 +1876,7 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       /// insert the new dictionary values
       FlushBuilder();
       builder_.ResetFull();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       decoder->InsertDictionary(&builder_);
       this->new_dictionary_ = false;
     }
@@ -1508,43 +1884,41 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
-
-  ::arrow::BinaryDictionary32Builder builder_;
+  typename EncodingTraits<DType>::DictAccumulator builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -1562,12 +1936,23 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
                                                         ::arrow::MemoryPool* pool,
                                                         bool read_dictionary) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
+    return std::make_shared<DictionaryRecordReaderImpl<ByteArrayType>>(descr, pool);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
   }
 }
 
+template <typename DType>
+std::shared_ptr<RecordReader> MakeTypedRecordReader(const ColumnDescriptor* descr,
+                                                    ::arrow::MemoryPool* pool,
+                                                    bool read_dictionary) {
+  if (read_dictionary) {
+    return std::make_shared<DictionaryRecordReaderImpl<DType>>(descr, pool);
+  } else {
+    return std::make_shared<TypedRecordReader<DType>>(descr, pool);
+  }
+}
+
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  MemoryPool* pool,
                                                  const bool read_dictionary) {
@@ -1575,9 +1960,9 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
     case Type::INT32:
-      return std::make_shared<TypedRecordReader<Int32Type>>(descr, pool);
+      return MakeTypedRecordReader<Int32Type>(descr, pool, read_dictionary);
     case Type::INT64:
-      return std::make_shared<TypedRecordReader<Int64Type>>(descr, pool);
+      return MakeTypedRecordReader<Int64Type>(descr, pool, read_dictionary);
     case Type::INT96:
       return std::make_shared<TypedRecordReader<Int96Type>>(descr, pool);
     case Type::FLOAT:
@@ -1587,6 +1972,9 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::BYTE_ARRAY:
       return MakeByteArrayRecordReader(descr, pool, read_dictionary);
     case Type::FIXED_LEN_BYTE_ARRAY:
+      if (read_dictionary) {
+        return std::make_shared<DictionaryRecordReaderImpl<FLBAType>>(descr, pool);
+      }
       return std::make_shared<FLBARecordReader>(descr, pool);
     default: {
       // PARQUET-1481: This can occur if the file is corrupt
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "parquet/exception.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -69,6 +70,12 @@ class PARQUET_EXPORT LevelDecoder {
   // Decodes a batch of levels into an array and returns the number of levels decoded
   int Decode(int batch_size, int16_t* levels);
 
+  // Decodes a batch of levels with a max level of 1 as the bits of a validity
+  // bitmap, adds the number of null (zero) levels to null_count and returns
+  // the number of levels decoded
+  int DecodeValidityBitmap(int batch_size, uint8_t* valid_bits, int64_t valid_bits_offset,
+                           int64_t* null_count);
+
  private:
   int bit_width_;
   int num_values_remaining_;
@@ -110,6 +117,27 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  // Bound the capacity of the scratch buffers kept between pages, see
+  // ReaderProperties::page_buffer_limit
+  virtual void set_page_buffer_limit(int64_t limit) {}
+
+  // Set the locations of the data pages, taken from the OffsetIndex of the
+  // column chunk, relative to the start of the stream. They let SkipDataPages
+  // skip pages without reading them.
+  virtual void set_page_locations(std::vector<PageLocation> page_locations) {}
+
+  // Skip the next data pages of a non-repeated column as long as all their
+  // rows are among the next num_rows rows, without reading or decompressing
+  // them. Only whole pages are skipped, and only if their locations are known.
+  // @returns: the number of rows skipped
+  virtual int64_t SkipDataPages(int64_t num_rows) { return 0; }
+
+  // Whether the buffers of the data pages returned by NextPage are zero-copy
+  // slices of the input, neither decompressed nor decrypted into scratch
+  // space, so that they stay valid once the next page is read and decoded
+  // values may reference them
+  virtual bool zero_copy_data_pages() const { return false; }
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -218,6 +246,14 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Attempt to skip indicated number of records from column chunk
+  /// without materializing their values. The values of data pages lying
+  /// entirely within the skipped records are not decoded. Only supported for
+  /// non-repeated columns.
+  /// Records consumed by a previous ReadRecords call are discarded.
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
@@ -229,6 +265,11 @@ class RecordReader {
   /// allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseValues() = 0;
 
+  /// \brief Transfer the values to caller as consecutive buffers, some of
+  /// which may be slices of the data pages if set_zero_copy_values was
+  /// enabled; otherwise as the single buffer returned by ReleaseValues
+  virtual std::vector<std::shared_ptr<Buffer>> ReleaseValueChunks() = 0;
+
   /// \brief Transfer filled validity bitmap buffer to caller. A new one will
   /// be allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseIsValid() = 0;
@@ -276,6 +317,20 @@ class RecordReader {
   /// \brief True if reading directly as Arrow dictionary-encoded
   bool read_dictionary() const { return read_dictionary_; }
 
+  /// \brief Decode the definition levels of a flat optional column (max
+  /// definition level of 1, no repetition) directly into the validity bitmap.
+  /// The levels are then not available from def_levels(); has no effect on
+  /// other columns. Must be set before reading.
+  void set_def_levels_to_bitmap(bool value) { def_levels_to_bitmap_ = value; }
+
+  /// \brief Reference the values of the PLAIN-encoded data pages of a
+  /// required, non-nested INT32, INT64, FLOAT or DOUBLE column rather than
+  /// copy them, if the page reader has zero_copy_data_pages() and the values are
+  /// suitably aligned. values() then only holds the copied values, and all of
+  /// them must be obtained from ReleaseValueChunks. Has no effect on other
+  /// columns. Must be set before reading.
+  void set_zero_copy_values(bool value) { zero_copy_values_ = value; }
+
  protected:
   bool nullable_values_;
 
@@ -300,6 +355,8 @@ class RecordReader {
   std::shared_ptr<::arrow::ResizableBuffer> rep_levels_;
 
   bool read_dictionary_ = false;
+  bool def_levels_to_bitmap_ = false;
+  bool zero_copy_values_ = false;
 };
 
 class BinaryRecordReader : virtual public RecordReader {
@@ -308,7 +365,8 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Only valid for BYTE_ARRAY, FIXED_LEN_BYTE_ARRAY, INT32 and INT64
+/// columns
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
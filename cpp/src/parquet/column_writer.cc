@@ -20,9 +20,11 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -33,15 +35,19 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/murmur3.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -567,12 +573,34 @@ class ColumnWriterImpl {
       compressor_temp_buffer_ =
           std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(allocator_, 0));
     }
+    // Bloom filters are not encrypted, so don't leak values of encrypted files
+    if (properties->bloom_filter_enabled(descr_->path()) &&
+        descr_->physical_type() != Type::BOOLEAN &&
+        properties->file_encryption_properties() == nullptr) {
+      const double fpp = properties->bloom_filter_fpp(descr_->path());
+      if (!(fpp > 0.0 && fpp < 1.0)) {
+        throw ParquetException(
+            "Bloom filter false positive probability must be in (0, 1)");
+      }
+      bloom_filter_hashes_.reset(new std::unordered_set<uint64_t>());
+    }
+    // Pages of repeated columns don't start on record boundaries; the page
+    // index is not encrypted
+    page_index_enabled_ = properties->page_index_enabled(descr_->path()) &&
+                          descr_->max_repetition_level() == 0 &&
+                          properties->file_encryption_properties() == nullptr;
   }
 
   virtual ~ColumnWriterImpl() = default;
 
   int64_t Close();
 
+  std::unique_ptr<BloomFilter> ReleaseBloomFilter() { return std::move(bloom_filter_); }
+
+  std::unique_ptr<ColumnIndex> ReleaseColumnIndex() { return std::move(column_index_); }
+
+  std::unique_ptr<OffsetIndex> ReleaseOffsetIndex() { return std::move(offset_index_); }
+
  protected:
   virtual std::shared_ptr<Buffer> GetValuesBuffer() = 0;
 
@@ -601,9 +629,24 @@ class ColumnWriterImpl {
 
   // Serializes Data Pages
   void WriteDataPage(const DataPage& page) {
-    total_bytes_written_ += pager_->WriteDataPage(page);
+    const int64_t bytes_written = pager_->WriteDataPage(page);
+    if (page_index_enabled_) {
+      page_sizes_.push_back(bytes_written);
+    }
+    total_bytes_written_ += bytes_written;
   }
 
+  // Records the statistics of the data page being built for the page index
+  void AddPageToIndex(const EncodedStatistics& page_stats) {
+    if (page_index_enabled_) {
+      page_num_values_.push_back(num_buffered_values_);
+      page_statistics_index_.push_back(page_stats);
+    }
+  }
+
+  // Assembles the page index once the data pages have been written
+  void BuildPageIndex();
+
   // Write multiple definition levels
   void WriteDefinitionLevels(int64_t num_levels, const int16_t* levels) {
     DCHECK(!closed_);
@@ -676,6 +719,23 @@ class ColumnWriterImpl {
 
   std::vector<std::unique_ptr<DataPage>> data_pages_;
 
+  // The hashes of the distinct values written, from which a Bloom filter
+  // sized for the column chunk is built on Close().  Null if Bloom filters
+  // are disabled for the column.
+  std::unique_ptr<std::unordered_set<uint64_t>> bloom_filter_hashes_;
+  MurmurHash3 bloom_filter_hasher_;
+  std::unique_ptr<BloomFilter> bloom_filter_;
+
+  // The number of values, statistics and serialized size of each data page, in
+  // the order they are built and written, from which the page index of the
+  // column chunk is assembled on Close()
+  bool page_index_enabled_;
+  std::vector<int64_t> page_num_values_;
+  std::vector<EncodedStatistics> page_statistics_index_;
+  std::vector<int64_t> page_sizes_;
+  std::unique_ptr<ColumnIndex> column_index_;
+  std::unique_ptr<OffsetIndex> offset_index_;
+
  private:
   void InitSinks() {
     definition_levels_sink_.Rewind(0);
@@ -774,6 +834,7 @@ void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
   page_stats.ApplyStatSizeLimits(properties_->max_statistics_size(descr_->path()));
   page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
   ResetPageStatistics();
+  AddPageToIndex(page_stats);
 
   std::shared_ptr<Buffer> compressed_data;
   if (pager_->has_compressor()) {
@@ -829,6 +890,7 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
   page_stats.ApplyStatSizeLimits(properties_->max_statistics_size(descr_->path()));
   page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
   ResetPageStatistics();
+  AddPageToIndex(page_stats);
 
   int32_t num_values = static_cast<int32_t>(num_buffered_values_);
   int32_t null_count = static_cast<int32_t>(page_stats.null_count);
@@ -870,12 +932,69 @@ int64_t ColumnWriterImpl::Close() {
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
       metadata_->SetStatistics(chunk_statistics);
     }
+
+    if (bloom_filter_hashes_ != nullptr) {
+      const auto num_distinct = static_cast<uint32_t>(std::min<size_t>(
+          bloom_filter_hashes_->size(), std::numeric_limits<uint32_t>::max()));
+      const double fpp = properties_->bloom_filter_fpp(descr_->path());
+      std::unique_ptr<BlockSplitBloomFilter> bloom_filter(new BlockSplitBloomFilter());
+      bloom_filter->Init(BlockSplitBloomFilter::OptimalNumOfBits(num_distinct, fpp) / 8);
+      for (uint64_t hash : *bloom_filter_hashes_) {
+        bloom_filter->InsertHash(hash);
+      }
+      bloom_filter_ = std::move(bloom_filter);
+      bloom_filter_hashes_.reset();
+    }
     pager_->Close(has_dictionary_, fallback_);
+    if (page_index_enabled_ && rows_written_ > 0) {
+      BuildPageIndex();
+    }
   }
 
   return total_bytes_written_;
 }
 
+void ColumnWriterImpl::BuildPageIndex() {
+  DCHECK_EQ(page_sizes_.size(), page_num_values_.size());
+
+  // The data pages follow each other from the first one, and each holds one
+  // row per value as the column isn't repeated
+  std::vector<PageLocation> page_locations;
+  int64_t offset = metadata_->data_page_offset();
+  int64_t first_row_index = 0;
+  for (size_t i = 0; i < page_sizes_.size(); ++i) {
+    page_locations.push_back(
+        {offset, static_cast<int32_t>(page_sizes_[i]), first_row_index});
+    offset += page_sizes_[i];
+    first_row_index += page_num_values_[i];
+  }
+  offset_index_.reset(new OffsetIndex(std::move(page_locations)));
+
+  // A ColumnIndex needs the bounds of every page which holds a value
+  const size_t num_pages = page_statistics_index_.size();
+  std::vector<bool> null_pages(num_pages);
+  std::vector<std::string> min_values(num_pages), max_values(num_pages);
+  std::vector<int64_t> null_counts(num_pages);
+  for (size_t i = 0; i < num_pages; ++i) {
+    const EncodedStatistics& page_stats = page_statistics_index_[i];
+    if (!page_stats.has_null_count) {
+      return;
+    }
+    null_pages[i] = page_stats.null_count == page_num_values_[i];
+    if (!null_pages[i]) {
+      if (!page_stats.has_min || !page_stats.has_max) {
+        return;
+      }
+      min_values[i] = page_stats.min();
+      max_values[i] = page_stats.max();
+    }
+    null_counts[i] = page_stats.null_count;
+  }
+  column_index_.reset(new ColumnIndex(descr_, std::move(null_pages),
+                                      std::move(min_values), std::move(max_values),
+                                      std::move(null_counts)));
+}
+
 void ColumnWriterImpl::FlushBufferedDataPages() {
   // Write all outstanding data to a new page
   if (num_buffered_values_ > 0) {
@@ -903,12 +1022,30 @@ inline void DoInBatches(int64_t total, int64_t batch_size, Action&& action) {
   }
 }
 
-bool DictionaryDirectWriteSupported(const ::arrow::Array& array) {
+// Whether the dictionary values are stored as the physical type without any
+// conversion, so that they can be put into the Parquet dictionary as is
+bool DictionaryDirectWriteSupported(const ::arrow::Array& array,
+                                    Type::type physical_type) {
   DCHECK_EQ(array.type_id(), ::arrow::Type::DICTIONARY);
   const ::arrow::DictionaryType& dict_type =
       static_cast<const ::arrow::DictionaryType&>(*array.type());
-  auto id = dict_type.value_type()->id();
-  return id == ::arrow::Type::BINARY || id == ::arrow::Type::STRING;
+  switch (dict_type.value_type()->id()) {
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+      return physical_type == Type::BYTE_ARRAY;
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      return physical_type == Type::FIXED_LEN_BYTE_ARRAY;
+    case ::arrow::Type::INT32:
+      return physical_type == Type::INT32;
+    case ::arrow::Type::INT64:
+      return physical_type == Type::INT64;
+    case ::arrow::Type::FLOAT:
+      return physical_type == Type::FLOAT;
+    case ::arrow::Type::DOUBLE:
+      return physical_type == Type::DOUBLE;
+    default:
+      return false;
+  }
 }
 
 Status ConvertDictionaryToDense(const ::arrow::Array& array, MemoryPool* pool,
@@ -935,6 +1072,35 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Hash a value from its plain encoding, as inserted into Bloom filters
+
+template <typename T>
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor*,
+                                const T& value) {
+  return hasher.Hash(value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor*,
+                                const bool& value) {
+  // Not reached: Bloom filters are not written for BOOLEAN columns
+  return hasher.Hash(static_cast<int32_t>(value));
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor*,
+                                const Int96& value) {
+  return hasher.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor*,
+                                const ByteArray& value) {
+  return hasher.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor* descr,
+                                const FixedLenByteArray& value) {
+  return hasher.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -957,6 +1123,18 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
 
+  std::unique_ptr<BloomFilter> ReleaseBloomFilter() override {
+    return ColumnWriterImpl::ReleaseBloomFilter();
+  }
+
+  std::unique_ptr<ColumnIndex> ReleaseColumnIndex() override {
+    return ColumnWriterImpl::ReleaseColumnIndex();
+  }
+
+  std::unique_ptr<OffsetIndex> ReleaseOffsetIndex() override {
+    return ColumnWriterImpl::ReleaseOffsetIndex();
+  }
+
   void WriteBatch(int64_t num_values, const int16_t* def_levels,
                   const int16_t* rep_levels, const T* values) override {
     // We check for DataPage limits only after we have inserted the values. If a user
@@ -1192,10 +1370,13 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       // Serialize the buffered Dictionary Indices
       FlushBufferedDataPages();
       fallback_ = true;
-      // Only PLAIN encoding is supported for fallback in V1
-      current_encoder_ = MakeEncoder(DType::type_num, Encoding::PLAIN, false, descr_,
+      // Only PLAIN encoding is supported for fallback in V1, V2 falls back to
+      // the column's configured encoding (e.g. DELTA_BYTE_ARRAY)
+      encoding_ = properties_->version() == ParquetVersion::PARQUET_1_0
+                      ? Encoding::PLAIN
+                      : properties_->encoding(descr_->path());
+      current_encoder_ = MakeEncoder(DType::type_num, encoding_, false, descr_,
                                      properties_->memory_pool());
-      encoding_ = Encoding::PLAIN;
     }
   }
 
@@ -1220,12 +1401,47 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  void UpdateBloomFilter(const T* values, int64_t num_values) {
+    if (bloom_filter_hashes_ == nullptr) {
+      return;
+    }
+    for (int64_t i = 0; i < num_values; ++i) {
+      bloom_filter_hashes_->insert(
+          BloomFilterHash(bloom_filter_hasher_, descr_, values[i]));
+    }
+  }
+
+  void UpdateBloomFilterSpaced(const T* values, int64_t num_spaced_values,
+                               const uint8_t* valid_bits, int64_t valid_bits_offset) {
+    if (bloom_filter_hashes_ == nullptr) {
+      return;
+    }
+    ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                      num_spaced_values);
+    for (int64_t i = 0; i < num_spaced_values; ++i) {
+      if (valid_bits_reader.IsSet()) {
+        bloom_filter_hashes_->insert(
+            BloomFilterHash(bloom_filter_hasher_, descr_, values[i]));
+      }
+      valid_bits_reader.Next();
+    }
+  }
+
+  // Update the Bloom filter with the non-null values of an Arrow array laid
+  // out like the physical type
+  void UpdateBloomFilter(const ::arrow::Array& values);
+
+  // Update the statistics and the Bloom filter with the values of a
+  // dictionary that is written directly
+  void UpdateForDictionary(const ::arrow::Array& dictionary);
+
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
     dynamic_cast<ValueEncoderType*>(current_encoder_.get())
         ->Put(values, static_cast<int>(num_values));
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    UpdateBloomFilter(values, num_values);
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1234,9 +1450,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       dynamic_cast<ValueEncoderType*>(current_encoder_.get())
           ->PutSpaced(values, static_cast<int>(num_spaced_values), valid_bits,
                       valid_bits_offset);
+      UpdateBloomFilterSpaced(values, num_spaced_values, valid_bits, valid_bits_offset);
     } else {
       dynamic_cast<ValueEncoderType*>(current_encoder_.get())
           ->Put(values, static_cast<int>(num_values));
+      UpdateBloomFilter(values, num_values);
     }
     if (page_statistics_ != nullptr) {
       const int64_t num_nulls = num_spaced_values - num_values;
@@ -1246,6 +1464,103 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   }
 };
 
+template <typename DType>
+void TypedColumnWriterImpl<DType>::UpdateBloomFilter(const ::arrow::Array& values) {
+  if (bloom_filter_hashes_ == nullptr) {
+    return;
+  }
+  const auto* fixed_width_type =
+      dynamic_cast<const ::arrow::FixedWidthType*>(values.type().get());
+  if (fixed_width_type == nullptr || values.type_id() == ::arrow::Type::DICTIONARY ||
+      fixed_width_type->bit_width() != static_cast<int>(sizeof(T) * 8)) {
+    throw ParquetException("Cannot update the Bloom filter of a " +
+                           TypeToString(DType::type_num) +
+                           " column from an Arrow array of type " +
+                           values.type()->ToString());
+  }
+  const T* raw_values = values.data()->GetValues<T>(1);
+  if (values.null_count() == 0) {
+    UpdateBloomFilter(raw_values, values.length());
+  } else {
+    UpdateBloomFilterSpaced(raw_values, values.length(), values.null_bitmap_data(),
+                            values.offset());
+  }
+}
+
+template <>
+void TypedColumnWriterImpl<ByteArrayType>::UpdateBloomFilter(
+    const ::arrow::Array& values) {
+  if (bloom_filter_hashes_ == nullptr) {
+    return;
+  }
+  const auto& binary_values = checked_cast<const ::arrow::BinaryArray&>(values);
+  for (int64_t i = 0; i < binary_values.length(); ++i) {
+    if (binary_values.IsValid(i)) {
+      const auto view = binary_values.GetView(i);
+      const ByteArray value(static_cast<uint32_t>(view.size()),
+                            reinterpret_cast<const uint8_t*>(view.data()));
+      bloom_filter_hashes_->insert(BloomFilterHash(bloom_filter_hasher_, descr_, value));
+    }
+  }
+}
+
+template <>
+void TypedColumnWriterImpl<FLBAType>::UpdateBloomFilter(const ::arrow::Array& values) {
+  if (bloom_filter_hashes_ == nullptr) {
+    return;
+  }
+  if (values.type_id() != ::arrow::Type::FIXED_SIZE_BINARY &&
+      values.type_id() != ::arrow::Type::DECIMAL) {
+    throw ParquetException(
+        "Cannot update the Bloom filter of a FIXED_LEN_BYTE_ARRAY column from an "
+        "Arrow array of type " +
+        values.type()->ToString());
+  }
+  const auto& fixed_size_values =
+      checked_cast<const ::arrow::FixedSizeBinaryArray&>(values);
+  for (int64_t i = 0; i < fixed_size_values.length(); ++i) {
+    if (fixed_size_values.IsValid(i)) {
+      bloom_filter_hashes_->insert(BloomFilterHash(bloom_filter_hasher_, descr_,
+                                                   FLBA(fixed_size_values.GetValue(i))));
+    }
+  }
+}
+
+template <typename DType>
+void TypedColumnWriterImpl<DType>::UpdateForDictionary(const ::arrow::Array& dictionary) {
+  // The dictionary values have no nulls and are laid out like T, see
+  // DictionaryDirectWriteSupported
+  const T* values = dictionary.data()->GetValues<T>(1);
+  if (page_statistics_ != nullptr) {
+    page_statistics_->Update(values, dictionary.length(), /*num_null=*/0);
+  }
+  UpdateBloomFilter(dictionary);
+}
+
+template <>
+void TypedColumnWriterImpl<ByteArrayType>::UpdateForDictionary(
+    const ::arrow::Array& dictionary) {
+  if (page_statistics_ != nullptr) {
+    page_statistics_->Update(dictionary);
+  }
+  UpdateBloomFilter(dictionary);
+}
+
+template <>
+void TypedColumnWriterImpl<FLBAType>::UpdateForDictionary(
+    const ::arrow::Array& dictionary) {
+  const auto& fixed_size_values =
+      checked_cast<const ::arrow::FixedSizeBinaryArray&>(dictionary);
+  std::vector<FLBA> values(static_cast<size_t>(dictionary.length()));
+  for (int64_t i = 0; i < dictionary.length(); ++i) {
+    values[i] = FLBA(fixed_size_values.GetValue(i));
+  }
+  if (page_statistics_ != nullptr) {
+    page_statistics_->Update(values.data(), dictionary.length(), /*num_null=*/0);
+  }
+  UpdateBloomFilter(values.data(), dictionary.length());
+}
+
 template <typename DType>
 Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_levels,
                                                           const int16_t* rep_levels,
@@ -1275,7 +1590,7 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
   };
 
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array, descr_->physical_type())) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
@@ -1309,9 +1624,8 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
 
     // TODO(wesm): If some dictionary values are unobserved, then the
     // statistics will be inaccurate. Do we care enough to fix it?
-    if (page_statistics_ != nullptr) {
-      PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
-    }
+    // Likewise, the Bloom filter may have false positives for unobserved values
+    PARQUET_CATCH_NOT_OK(UpdateForDictionary(*dictionary));
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
@@ -1726,6 +2040,7 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    UpdateBloomFilter(*data_slice);
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -42,11 +42,14 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
 class ColumnDescriptor;
+class ColumnIndex;
 class DataPage;
 class DictionaryPage;
 class ColumnChunkMetaDataBuilder;
 class Encryptor;
+class OffsetIndex;
 class WriterProperties;
 
 class PARQUET_EXPORT LevelEncoder {
@@ -139,6 +142,25 @@ class PARQUET_EXPORT ColumnWriter {
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
+  /// \brief Take the Bloom filter of the values written to the column chunk
+  ///
+  /// Only available after Close(), and if Bloom filters are enabled for the
+  /// column in the WriterProperties; null otherwise.
+  virtual std::unique_ptr<BloomFilter> ReleaseBloomFilter() = 0;
+
+  /// \brief Take the ColumnIndex (page statistics) of the column chunk
+  ///
+  /// Only available after Close(), and if the page index is enabled for the
+  /// column in the WriterProperties and every data page has min/max
+  /// statistics; null otherwise.
+  virtual std::unique_ptr<ColumnIndex> ReleaseColumnIndex() = 0;
+
+  /// \brief Take the OffsetIndex (page locations) of the column chunk
+  ///
+  /// Only available after Close(), and if the page index is enabled for the
+  /// column in the WriterProperties; null otherwise.
+  virtual std::unique_ptr<OffsetIndex> ReleaseOffsetIndex() = 0;
+
   /// \brief Write Apache Arrow columnar data directly to ColumnWriter. Returns
   /// error status if the array data type is not compatible with the concrete
   /// writer type
@@ -416,22 +416,30 @@ TYPED_TEST(TestPrimitiveWriter, RequiredBitPacked) {
   this->TestRequiredWithEncoding(Encoding::BIT_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaBinaryPacked) {
+TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
+  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+}
+*/
+
+using TestInt32ValuesWriter = TestPrimitiveWriter<Int32Type>;
+using TestInt64ValuesWriter = TestPrimitiveWriter<Int64Type>;
+using TestByteArrayValuesWriter = TestPrimitiveWriter<ByteArrayType>;
+
+TEST_F(TestInt32ValuesWriter, RequiredDeltaBinaryPacked) {
   this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaLengthByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+TEST_F(TestInt64ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
-  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
 }
-*/
 
 TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithStats) {
   this->TestRequiredWithSettings(Encoding::PLAIN, Compression::UNCOMPRESSED, false, true,
@@ -653,7 +661,6 @@ TEST_F(TestBooleanValuesWriter, AlternateBooleanValues) {
 
 // PARQUET-979
 // Prevent writing large MIN, MAX stats
-using TestByteArrayValuesWriter = TestPrimitiveWriter<ByteArrayType>;
 TEST_F(TestByteArrayValuesWriter, OmitStats) {
   int min_len = 1024 * 4;
   int max_len = 1024 * 8;
@@ -926,6 +933,51 @@ TEST(TestLevels, TestLevelsDecodeMultipleSetData) {
   }
 }
 
+// Test decoding levels with a max level of 1 into a validity bitmap
+TEST(TestLevels, TestLevelsDecodeValidityBitmap) {
+  // Runs of nulls and non-nulls, then alternating levels encoded as literals
+  std::vector<int16_t> input_levels;
+  GenerateLevels(/*min_repeat_factor=*/3, /*max_repeat_factor=*/7, /*max_level=*/1,
+                 input_levels);
+  for (int i = 0; i < 301; ++i) {
+    input_levels.push_back(static_cast<int16_t>(i % 3 != 0));
+  }
+  const int num_levels = static_cast<int>(input_levels.size());
+  const int64_t expected_null_count =
+      std::count(input_levels.begin(), input_levels.end(), 0);
+
+  for (auto encoding : {Encoding::RLE, Encoding::BIT_PACKED}) {
+    std::vector<uint8_t> bytes;
+    ASSERT_NO_FATAL_FAILURE(
+        EncodeLevels(encoding, 1, num_levels, input_levels.data(), bytes));
+
+    LevelDecoder decoder;
+    decoder.SetData(encoding, 1, num_levels, bytes.data(),
+                    static_cast<int32_t>(bytes.size()));
+
+    // Decode in odd-sized batches behind a preceding set bit
+    const int64_t offset = 3;
+    std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(offset + num_levels), 0);
+    BitUtil::SetBit(valid_bits.data(), 0);
+    int64_t null_count = 0;
+    int levels_decoded = 0;
+    while (levels_decoded < num_levels) {
+      const int levels_count = decoder.DecodeValidityBitmap(
+          37, valid_bits.data(), offset + levels_decoded, &null_count);
+      ASSERT_GT(levels_count, 0);
+      levels_decoded += levels_count;
+    }
+    ASSERT_EQ(num_levels, levels_decoded);
+    ASSERT_EQ(expected_null_count, null_count);
+    ASSERT_TRUE(BitUtil::GetBit(valid_bits.data(), 0));
+    for (int i = 0; i < num_levels; i++) {
+      ASSERT_EQ(input_levels[i] == 1, BitUtil::GetBit(valid_bits.data(), offset + i))
+          << "at level " << i;
+    }
+    ASSERT_EQ(0, decoder.DecodeValidityBitmap(1, valid_bits.data(), 0, &null_count));
+  }
+}
+
 TEST(TestLevelEncoder, MinimumBufferSize) {
   // PARQUET-676, PARQUET-698
   const int kNumToEncode = 1024;
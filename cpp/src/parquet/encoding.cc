@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -861,13 +863,8 @@ std::shared_ptr<Buffer> ByteStreamSplitEncoder<DType>::FlushValues() {
   uint8_t* output_buffer_raw = output_buffer->mutable_data();
   const size_t num_values = values_.length();
   const uint8_t* raw_values = reinterpret_cast<const uint8_t*>(values_.data());
-#if defined(ARROW_HAVE_SSE4_2)
-  arrow::util::internal::ByteStreamSplitEncodeSSE2<T>(raw_values, num_values,
-                                                      output_buffer_raw);
-#else
-  arrow::util::internal::ByteStreamSplitEncodeScalar<T>(raw_values, num_values,
-                                                        output_buffer_raw);
-#endif
+  arrow::util::internal::ByteStreamSplitEncode<T>(raw_values, num_values,
+                                                  output_buffer_raw);
   values_.Reset();
   return std::move(output_buffer);
 }
@@ -913,6 +910,437 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   Put(data, num_valid_values);
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+/// DELTA_BINARY_PACKED encoder for INT32 and INT64 values.
+///
+/// Values are written in blocks of kValuesPerBlock deltas, each block being
+/// split in kMiniBlocksPerBlock miniblocks which are bit-packed with their own
+/// bit width, after subtracting the block's minimum delta from all deltas.
+/// The page header, which holds the total value count, is only known once
+/// all values have been put, so blocks are buffered until FlushValues().
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  // Deltas are computed with wrapping arithmetic, as required by the spec
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        total_value_count_(0),
+        first_value_(0),
+        current_value_(0),
+        values_current_block_(0),
+        deltas_(kValuesPerBlock),
+        block_buffer_(AllocateBuffer(pool, kMaxBlockSize)),
+        block_writer_(block_buffer_->mutable_data(), kMaxBlockSize),
+        sink_(pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderSize + sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(
+        auto buffer, arrow::AllocateBuffer(num_values * sizeof(T), this->memory_pool()));
+    int32_t num_valid_values = 0;
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        data[num_valid_values++] = src[i];
+      }
+      valid_bits_reader.Next();
+    }
+    Put(data, num_valid_values);
+  }
+
+ private:
+  static constexpr uint32_t kValuesPerBlock = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+  // Block size, number of miniblocks and total value count as VLQ ints, followed
+  // by the first value as a zigzag VLQ int
+  static constexpr int kMaxHeaderSize =
+      3 * arrow::BitUtil::BitReader::kMaxVlqByteLength +
+      arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64;
+  // Minimum delta as a zigzag VLQ int, one bit width per miniblock and the
+  // bit-packed deltas
+  static constexpr int kMaxBlockSize =
+      arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64 + kMiniBlocksPerBlock +
+      kValuesPerBlock * sizeof(T);
+
+  void FlushBlock();
+
+  void PutPackedValue(UT value, int num_bits) {
+    // BitWriter only packs up to 32 bits at a time
+    if (sizeof(T) > 4 && num_bits > 32) {
+      block_writer_.PutValue(static_cast<uint32_t>(value), 32);
+      block_writer_.PutValue(static_cast<uint64_t>(value) >> 32, num_bits - 32);
+    } else {
+      block_writer_.PutValue(static_cast<uint64_t>(value), num_bits);
+    }
+  }
+
+  uint32_t total_value_count_;
+  T first_value_;
+  UT current_value_;
+  uint32_t values_current_block_;
+  std::vector<UT> deltas_;
+  std::shared_ptr<ResizableBuffer> block_buffer_;
+  arrow::BitUtil::BitWriter block_writer_;
+  arrow::BufferBuilder sink_;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  if (ARROW_PREDICT_FALSE(static_cast<int64_t>(total_value_count_) + num_values >
+                          std::numeric_limits<int32_t>::max())) {
+    throw ParquetException("Too many values for DELTA_BINARY_PACKED encoding");
+  }
+
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = src[0];
+    current_value_ = static_cast<UT>(src[0]);
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+
+  for (; idx < num_values; idx++) {
+    const UT value = static_cast<UT>(src[idx]);
+    deltas_[values_current_block_++] = value - current_value_;
+    current_value_ = value;
+    if (values_current_block_ == kValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (values_current_block_ == 0) {
+    return;
+  }
+
+  // The minimum delta is the block's frame of reference: subtracting it makes
+  // all deltas non-negative
+  const T min_delta = static_cast<T>(*std::min_element(
+      deltas_.begin(), deltas_.begin() + values_current_block_,
+      [](UT a, UT b) { return static_cast<T>(a) < static_cast<T>(b); }));
+  block_writer_.PutZigZagVlqInt(min_delta);
+
+  uint8_t* bit_widths = block_writer_.GetNextBytePtr(kMiniBlocksPerBlock);
+  DCHECK(bit_widths != nullptr);
+
+  for (uint32_t i = 0; i < kMiniBlocksPerBlock; i++) {
+    const uint32_t start = i * kValuesPerMiniBlock;
+    if (start >= values_current_block_) {
+      // Unused miniblocks of the last block get a zero bit width and no data
+      bit_widths[i] = 0;
+      continue;
+    }
+    const uint32_t end = std::min(start + kValuesPerMiniBlock, values_current_block_);
+
+    UT max_delta = 0;
+    for (uint32_t j = start; j < end; j++) {
+      deltas_[j] -= static_cast<UT>(min_delta);
+      max_delta = std::max(max_delta, deltas_[j]);
+    }
+    const int num_bits = arrow::BitUtil::NumRequiredBits(max_delta);
+    bit_widths[i] = static_cast<uint8_t>(num_bits);
+    if (num_bits == 0) {
+      continue;
+    }
+
+    for (uint32_t j = start; j < end; j++) {
+      PutPackedValue(deltas_[j], num_bits);
+    }
+    // A partial miniblock is padded to its full size
+    for (uint32_t j = end; j < start + kValuesPerMiniBlock; j++) {
+      PutPackedValue(0, num_bits);
+    }
+  }
+
+  block_writer_.Flush();
+  PARQUET_THROW_NOT_OK(
+      sink_.Append(block_writer_.buffer(), block_writer_.bytes_written()));
+  block_writer_.Clear();
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header[kMaxHeaderSize];
+  arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderSize);
+  header_writer.PutVlqInt(kValuesPerBlock);
+  header_writer.PutVlqInt(kMiniBlocksPerBlock);
+  header_writer.PutVlqInt(total_value_count_);
+  header_writer.PutZigZagVlqInt(first_value_);
+  header_writer.Flush();
+  const int header_size = header_writer.bytes_written();
+
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_size + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_size);
+  memcpy(buffer->mutable_data() + header_size, sink_.data(), sink_.length());
+
+  sink_.Reset();
+  total_value_count_ = 0;
+  first_value_ = 0;
+  current_value_ = 0;
+  return std::move(buffer);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const arrow::Array& values) {
+  ParquetException::NYI("direct put of " + values.type()->ToString());
+}
+
+template <typename ArrayType, typename EncoderType>
+void DeltaBitPackPutImpl(const arrow::Array& values, EncoderType* encoder) {
+  if (values.type_id() != ArrayType::TypeClass::type_id) {
+    std::string type_name = ArrayType::TypeClass::type_name();
+    throw ParquetException("direct put to " + type_name + " from " +
+                           values.type()->ToString() + " not supported");
+  }
+  if (values.length() > std::numeric_limits<int32_t>::max()) {
+    throw ParquetException("direct put of more than INT32_MAX values not supported");
+  }
+
+  auto raw_values = checked_cast<const ArrayType&>(values).raw_values();
+  const int num_values = static_cast<int>(values.length());
+  if (values.null_count() == 0) {
+    encoder->Put(raw_values, num_values);
+  } else {
+    encoder->PutSpaced(raw_values, num_values, values.null_bitmap_data(),
+                       values.offset());
+  }
+}
+
+template <>
+void DeltaBitPackEncoder<Int32Type>::Put(const arrow::Array& values) {
+  DeltaBitPackPutImpl<arrow::Int32Array>(values, this);
+}
+
+template <>
+void DeltaBitPackEncoder<Int64Type>::Put(const arrow::Array& values) {
+  DeltaBitPackPutImpl<arrow::Int64Array>(values, this);
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+/// DELTA_LENGTH_BYTE_ARRAY encoder: the DELTA_BINARY_PACKED encoded lengths of
+/// all values, followed by the concatenated value bytes.
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using T = ByteArray;
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + length_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> encoded_lengths = length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> data;
+    PARQUET_THROW_NOT_OK(sink_.Finish(&data));
+
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), encoded_lengths->size() + data->size());
+    memcpy(buffer->mutable_data(), encoded_lengths->data(), encoded_lengths->size());
+    memcpy(buffer->mutable_data() + encoded_lengths->size(), data->data(),
+           data->size());
+    return std::move(buffer);
+  }
+
+  void Put(const T* src, int num_values) override {
+    if (num_values == 0) {
+      return;
+    }
+    ArrowPoolVector<int32_t> lengths(num_values, ::arrow::stl::allocator<int32_t>(pool_));
+    int64_t total_length = 0;
+    for (int i = 0; i < num_values; i++) {
+      if (ARROW_PREDICT_FALSE(src[i].len > static_cast<uint32_t>(
+                                               std::numeric_limits<int32_t>::max()))) {
+        throw ParquetException("Byte array value too large for DELTA_LENGTH_BYTE_ARRAY");
+      }
+      lengths[i] = static_cast<int32_t>(src[i].len);
+      total_length += src[i].len;
+    }
+    length_encoder_.Put(lengths.data(), num_values);
+
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_length));
+    for (int i = 0; i < num_values; i++) {
+      sink_.UnsafeAppend(src[i].ptr, src[i].len);
+    }
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    std::vector<ByteArray> byte_arrays;
+    byte_arrays.reserve(data.length() - data.null_count());
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        byte_arrays.emplace_back(data.GetView(i));
+      }
+    }
+    Put(byte_arrays.data(), static_cast<int>(byte_arrays.size()));
+  }
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(
+        auto buffer, arrow::AllocateBuffer(num_values * sizeof(T), this->memory_pool()));
+    int32_t num_valid_values = 0;
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        data[num_valid_values++] = src[i];
+      }
+      valid_bits_reader.Next();
+    }
+    Put(data, num_valid_values);
+  }
+
+ private:
+  arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+/// DELTA_BYTE_ARRAY encoder (a.k.a. incremental encoding): the length of the
+/// prefix each value shares with the previous one, DELTA_BINARY_PACKED
+/// encoded, followed by the remaining suffixes, DELTA_LENGTH_BYTE_ARRAY
+/// encoded.  Effective on sorted or clustered strings.
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using T = ByteArray;
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> encoded_prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> encoded_suffixes = suffix_encoder_.FlushValues();
+    // Each page is decoded independently
+    last_value_.clear();
+
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(),
+                       encoded_prefix_lengths->size() + encoded_suffixes->size());
+    memcpy(buffer->mutable_data(), encoded_prefix_lengths->data(),
+           encoded_prefix_lengths->size());
+    memcpy(buffer->mutable_data() + encoded_prefix_lengths->size(),
+           encoded_suffixes->data(), encoded_suffixes->size());
+    return std::move(buffer);
+  }
+
+  void Put(const T* src, int num_values) override {
+    if (num_values == 0) {
+      return;
+    }
+    ArrowPoolVector<int32_t> prefix_lengths(num_values,
+                                            ::arrow::stl::allocator<int32_t>(pool_));
+    ArrowPoolVector<ByteArray> suffixes(num_values,
+                                        ::arrow::stl::allocator<ByteArray>(pool_));
+
+    arrow::util::string_view previous(last_value_);
+    for (int i = 0; i < num_values; i++) {
+      const arrow::util::string_view value(reinterpret_cast<const char*>(src[i].ptr),
+                                           src[i].len);
+      const size_t max_prefix = std::min(previous.size(), value.size());
+      size_t prefix = 0;
+      while (prefix < max_prefix && previous[prefix] == value[prefix]) {
+        ++prefix;
+      }
+      prefix_lengths[i] = static_cast<int32_t>(prefix);
+      suffixes[i] = ByteArray(src[i].len - static_cast<uint32_t>(prefix),
+                              src[i].ptr + prefix);
+      previous = value;
+    }
+    prefix_length_encoder_.Put(prefix_lengths.data(), num_values);
+    suffix_encoder_.Put(suffixes.data(), num_values);
+    // The source values don't outlive this call
+    last_value_.assign(previous.data(), previous.size());
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    std::vector<ByteArray> byte_arrays;
+    byte_arrays.reserve(data.length() - data.null_count());
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        byte_arrays.emplace_back(data.GetView(i));
+      }
+    }
+    Put(byte_arrays.data(), static_cast<int>(byte_arrays.size()));
+  }
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(
+        auto buffer, arrow::AllocateBuffer(num_values * sizeof(T), this->memory_pool()));
+    int32_t num_valid_values = 0;
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        data[num_valid_values++] = src[i];
+      }
+      valid_bits_reader.Next();
+    }
+    Put(data, num_valid_values);
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -1550,9 +1978,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendIndices(builder, indices_buffer, num_values, valid_bytes.data());
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1572,13 +1998,16 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendIndices(builder, indices_buffer, num_values);
     num_values_ -= num_values;
     return num_values;
   }
 
  protected:
+  // Append the decoded indices to the Dictionary32Builder of this type
+  void AppendIndices(arrow::ArrayBuilder* builder, const int32_t* indices,
+                     int64_t length, const uint8_t* valid_bytes = NULLPTR);
+
   Status IndexInBounds(int32_t index) {
     if (ARROW_PREDICT_TRUE(0 <= index && index < dictionary_length_)) {
       return Status::OK();
@@ -1611,7 +2040,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   std::shared_ptr<ResizableBuffer> byte_array_offsets_;
 
   // Reusable buffer for decoding dictionary indices to be appended to a
-  // BinaryDictionary32Builder
+  // Dictionary32Builder
   std::shared_ptr<ResizableBuffer> indices_scratch_space_;
 
   arrow::util::RleDecoder idx_decoder_;
@@ -1834,9 +2263,59 @@ int DictDecoderImpl<Type>::DecodeArrow(
   return num_values - null_count;
 }
 
+template <typename Type>
+void DictDecoderImpl<Type>::AppendIndices(arrow::ArrayBuilder* builder,
+                                          const int32_t* indices, int64_t length,
+                                          const uint8_t* valid_bytes) {
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::AppendIndices(arrow::ArrayBuilder* builder,
+                                                 const int32_t* indices, int64_t length,
+                                                 const uint8_t* valid_bytes) {
+  ParquetException::NYI("No dictionary encoding for BooleanType");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::AppendIndices(arrow::ArrayBuilder* builder,
+                                               const int32_t* indices, int64_t length,
+                                               const uint8_t* valid_bytes) {
+  ParquetException::NYI("DecodeIndices to Int96Type");
+}
+
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+  using ArrowType = typename EncodingTraits<Type>::ArrowType;
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+
+  // Make an array referencing the internal dictionary data
+  arrow::NumericArray<ArrowType> arr(dictionary_length_, dictionary_);
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(arr));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("No dictionary encoding for BooleanType");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("InsertDictionary to Int96Type");
+}
+
+template <>
+void DictDecoderImpl<FLBAType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  auto fixed_size_builder =
+      checked_cast<typename EncodingTraits<FLBAType>::DictAccumulator*>(builder);
+
+  // Make a FixedSizeBinaryArray referencing the internal dictionary data
+  arrow::FixedSizeBinaryArray arr(arrow::fixed_size_binary(descr_->type_length()),
+                                  dictionary_length_, byte_array_data_);
+  PARQUET_THROW_NOT_OK(fixed_size_builder->InsertMemoValues(arr));
 }
 
 template <>
@@ -1890,6 +2369,8 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
     int32_t indices[kBufferSize];
 
     ArrowBinaryHelper helper(out);
+    RETURN_NOT_OK(helper.builder->Reserve(num_values));
+    RETURN_NOT_OK(helper.builder->ReserveEstimatedData(num_values));
 
     arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
 
@@ -1953,6 +2434,8 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
     int values_decoded = 0;
 
     ArrowBinaryHelper helper(out);
+    RETURN_NOT_OK(helper.builder->Reserve(num_values));
+    RETURN_NOT_OK(helper.builder->ReserveEstimatedData(num_values));
     auto dict_values = reinterpret_cast<const ByteArray*>(dictionary_->data());
 
     while (values_decoded < num_values) {
@@ -2064,10 +2547,14 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  // Values are reconstructed with wrapping arithmetic, as required by the spec
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
-      : DecoderImpl(descr, Encoding::DELTA_BINARY_PACKED), pool_(pool) {
+      : DecoderImpl(descr, Encoding::DELTA_BINARY_PACKED),
+        pool_(pool),
+        delta_bit_widths_(AllocateBuffer(pool, 0)) {
     if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
       throw ParquetException("Delta bit pack encoding should only be for integer data.");
     }
@@ -2076,10 +2563,17 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   void SetData(int num_values, const uint8_t* data, int len) override {
     this->num_values_ = num_values;
     decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
+  // The number of encoded values, which is less than the number of values in
+  // the page if it has nulls.
+  int ValidValuesCount() const { return static_cast<int>(total_value_count_); }
+
+  // The number of bytes following the encoded values.  Only valid once all
+  // values have been decoded.
+  int BytesLeft() { return decoder_.bytes_left(); }
+
   int Decode(T* buffer, int max_values) override {
     return GetInternal(buffer, max_values);
   }
@@ -2087,100 +2581,266 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int values_decoded = GetInternal(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    int value_idx = 0;
+    VisitNullBitmapInline(valid_bits, valid_bits_offset, num_values, null_count,
+                          [&](bool is_valid) {
+                            if (is_valid) {
+                              out->UnsafeAppend(values[value_idx++]);
+                            } else {
+                              out->UnsafeAppendNull();
+                            }
+                          });
+    return values_decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int values_decoded = GetInternal(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
+
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
+    int value_idx = 0;
+    PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count, [&](bool is_valid) {
+          return is_valid ? out->Append(values[value_idx++]) : out->AppendNull();
+        }));
+    return values_decoded;
   }
 
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  static constexpr int kMaxDeltaBitWidth = static_cast<int>(sizeof(T) * 8);
+
+  void InitHeader() {
+    uint32_t values_per_block;
+    T first_value;
+    if (!decoder_.GetVlqInt(&values_per_block) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_value_count_) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    if (mini_blocks_per_block_ == 0) {
+      throw ParquetException("Delta bit pack block must have at least one miniblock");
+    }
+    values_per_mini_block_ = values_per_block / mini_blocks_per_block_;
+    if (values_per_mini_block_ == 0 || values_per_mini_block_ % 32 != 0) {
+      throw ParquetException(
+          "Delta bit pack miniblock size must be a non-zero multiple of 32, got " +
+          std::to_string(values_per_mini_block_));
+    }
+    PARQUET_THROW_NOT_OK(delta_bit_widths_->Resize(mini_blocks_per_block_, false));
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    last_value_ = static_cast<UT>(first_value);
+    total_values_remaining_ = total_value_count_;
+    first_value_decoded_ = false;
+    block_initialized_ = false;
+    values_remaining_current_mini_block_ = 0;
+  }
 
+  void InitBlock() {
     if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
+
+    // Bit widths of unused miniblocks may hold arbitrary values, so they
+    // are only validated when the miniblock is reached
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
+    block_initialized_ = true;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
-    values_current_mini_block_ = values_per_mini_block_;
+    InitMiniBlock(bit_width_data[0]);
+  }
+
+  void InitMiniBlock(int bit_width) {
+    if (ARROW_PREDICT_FALSE(bit_width > kMaxDeltaBitWidth)) {
+      throw ParquetException("Delta bit width " + std::to_string(bit_width) +
+                             " larger than integer bit width " +
+                             std::to_string(kMaxDeltaBitWidth));
+    }
+    delta_bit_width_ = bit_width;
+    values_remaining_current_mini_block_ = values_per_mini_block_;
+  }
+
+  bool GetPackedValue(UT* value) {
+    // BitReader only unpacks up to 32 bits at a time
+    if (sizeof(T) > 4 && delta_bit_width_ > 32) {
+      uint32_t low_bits;
+      uint64_t high_bits;
+      if (!decoder_.GetValue(32, &low_bits) ||
+          !decoder_.GetValue(delta_bit_width_ - 32, &high_bits)) {
+        return false;
+      }
+      *value = static_cast<UT>(low_bits | (high_bits << 32));
+      return true;
+    }
+    return decoder_.GetValue(delta_bit_width_, value);
+  }
+
+  void DecodeDeltas(T* out, int num_values) {
+    const UT min_delta = static_cast<UT>(min_delta_);
+    if (delta_bit_width_ == 0) {
+      for (int i = 0; i < num_values; ++i) {
+        last_value_ += min_delta;
+        out[i] = static_cast<T>(last_value_);
+      }
+      return;
+    }
+
+    UT* deltas = reinterpret_cast<UT*>(out);
+    if (sizeof(T) == 4 || delta_bit_width_ <= 32) {
+      if (decoder_.GetBatch(delta_bit_width_, deltas, num_values) != num_values) {
+        ParquetException::EofException();
+      }
+    } else {
+      for (int i = 0; i < num_values; ++i) {
+        if (!GetPackedValue(deltas + i)) ParquetException::EofException();
+      }
+    }
+    for (int i = 0; i < num_values; ++i) {
+      last_value_ += min_delta + deltas[i];
+      out[i] = static_cast<T>(last_value_);
+    }
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
     max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
+    max_values = static_cast<int>(
+        std::min<uint32_t>(static_cast<uint32_t>(max_values), total_values_remaining_));
+    if (max_values == 0) {
+      return 0;
+    }
+
+    int i = 0;
+    if (ARROW_PREDICT_FALSE(!first_value_decoded_)) {
+      // The first value is stored in the header
+      buffer[i++] = static_cast<T>(last_value_);
+      first_value_decoded_ = true;
+    }
+    while (i < max_values) {
+      if (ARROW_PREDICT_FALSE(values_remaining_current_mini_block_ == 0)) {
+        if (ARROW_PREDICT_FALSE(!block_initialized_) ||
+            ++mini_block_idx_ == mini_blocks_per_block_) {
           InitBlock();
-          buffer[i] = last_value_;
-          continue;
+        } else {
+          InitMiniBlock(delta_bit_widths_->data()[mini_block_idx_]);
         }
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int values_decode =
+          static_cast<int>(std::min<uint64_t>(values_remaining_current_mini_block_,
+                                              static_cast<uint64_t>(max_values - i)));
+      DecodeDeltas(buffer + i, values_decode);
+      values_remaining_current_mini_block_ -= values_decode;
+      i += values_decode;
     }
+
+    total_values_remaining_ -= max_values;
     this->num_values_ -= max_values;
+    if (ARROW_PREDICT_FALSE(total_values_remaining_ == 0)) {
+      // Skip the padding of the last miniblock, so that BytesLeft() is exact
+      UT padding;
+      for (; values_remaining_current_mini_block_ > 0 && delta_bit_width_ > 0;
+           --values_remaining_current_mini_block_) {
+        if (!GetPackedValue(&padding)) ParquetException::EofException();
+      }
+      values_remaining_current_mini_block_ = 0;
+    }
     return max_values;
   }
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
+  uint32_t mini_blocks_per_block_;
   uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
+  uint32_t total_value_count_;
 
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  uint32_t total_values_remaining_;
+  bool first_value_decoded_;
+  bool block_initialized_;
+  T min_delta_;
+  uint32_t mini_block_idx_;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
   int delta_bit_width_;
+  uint64_t values_remaining_current_mini_block_;
 
-  int32_t last_value_;
+  UT last_value_;
 };
 
+// ----------------------------------------------------------------------
+// DecodeArrow for decoders which first decode ByteArray values
+
+template <typename ByteArrayDecoderType>
+int DecodeByteArraysArrowDense(ByteArrayDecoderType* decoder, int num_values,
+                               int null_count, const uint8_t* valid_bits,
+                               int64_t valid_bits_offset,
+                               typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int values_decoded = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+
+  int64_t data_length = 0;
+  for (const ByteArray& value : values) {
+    data_length += value.len;
+  }
+
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  PARQUET_THROW_NOT_OK(helper.builder->ReserveData(
+      std::min<int64_t>(data_length, helper.chunk_space_remaining)));
+  int value_idx = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count, [&](bool is_valid) {
+        if (!is_valid) {
+          return helper.AppendNull();
+        }
+        const ByteArray& value = values[value_idx++];
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(value.len))) {
+          // This element would exceed the capacity of a chunk
+          RETURN_NOT_OK(helper.PushChunk());
+        }
+        return helper.Append(value.ptr, static_cast<int32_t>(value.len));
+      }));
+  return values_decoded;
+}
+
+template <typename ByteArrayDecoderType>
+int DecodeByteArraysArrowDict(
+    ByteArrayDecoderType* decoder, int num_values, int null_count,
+    const uint8_t* valid_bits, int64_t valid_bits_offset,
+    typename EncodingTraits<ByteArrayType>::DictAccumulator* builder) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int values_decoded = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+  int value_idx = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count, [&](bool is_valid) {
+        if (!is_valid) {
+          return builder->AppendNull();
+        }
+        const ByteArray& value = values[value_idx++];
+        return builder->Append(value.ptr, static_cast<int32_t>(value.len));
+      }));
+  return values_decoded;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2191,48 +2851,72 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        buffered_length_(AllocateBuffer(pool, 0)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    len_decoder_.SetData(num_values, data, len);
+
+    // Decode all lengths upfront, the value bytes follow them
+    num_valid_values_ = len_decoder_.ValidValuesCount();
+    PARQUET_THROW_NOT_OK(
+        buffered_length_->Resize(num_valid_values_ * sizeof(int32_t), false));
+    auto lengths = reinterpret_cast<int32_t*>(buffered_length_->mutable_data());
+    if (len_decoder_.Decode(lengths, num_valid_values_) != num_valid_values_) {
+      ParquetException::EofException();
+    }
+    length_idx_ = 0;
+
+    const int lengths_size = len - len_decoder_.BytesLeft();
+    data_ = data + lengths_size;
+    len_ = len - lengths_size;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
-    max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    max_values = std::min(max_values, num_valid_values_ - length_idx_);
+    const int32_t* lengths =
+        reinterpret_cast<const int32_t*>(buffered_length_->data()) + length_idx_;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(lengths[i] < 0)) {
+        throw ParquetException("Negative DELTA_LENGTH_BYTE_ARRAY value length");
+      }
+      data_size += lengths[i];
+    }
+    if (ARROW_PREDICT_FALSE(data_size > len_)) {
+      ParquetException::EofException();
+    }
+
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      buffer[i].len = static_cast<uint32_t>(lengths[i]);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += lengths[i];
     }
-    this->num_values_ -= max_values;
+    len_ -= static_cast<int>(data_size);
+    length_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrowDense(this, num_values, null_count, valid_bits,
+                                      valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrowDict(this, num_values, null_count, valid_bits,
+                                     valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  int num_valid_values_;
+  int length_idx_;
+  std::shared_ptr<ResizableBuffer> buffered_length_;
 };
 
 // ----------------------------------------------------------------------
@@ -2244,47 +2928,105 @@ class DeltaByteArrayDecoder : public DecoderImpl,
   explicit DeltaByteArrayDecoder(const ColumnDescriptor* descr,
                                  MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
+        pool_(pool),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        buffered_prefix_length_(AllocateBuffer(pool, 0)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
+  void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+    prefix_len_decoder_.SetData(num_values, data, len);
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+    // Decode all prefix lengths upfront, the suffixes follow them
+    num_valid_values_ = prefix_len_decoder_.ValidValuesCount();
+    PARQUET_THROW_NOT_OK(
+        buffered_prefix_length_->Resize(num_valid_values_ * sizeof(int32_t), false));
+    auto prefix_lengths =
+        reinterpret_cast<int32_t*>(buffered_prefix_length_->mutable_data());
+    if (prefix_len_decoder_.Decode(prefix_lengths, num_valid_values_) !=
+        num_valid_values_) {
+      ParquetException::EofException();
+    }
+    prefix_len_idx_ = 0;
+
+    const int prefix_lengths_size = len - prefix_len_decoder_.BytesLeft();
+    suffix_decoder_.SetData(num_valid_values_, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+
+    // Values decoded from the previous page are released
+    decoded_values_.clear();
+    last_value_ = ByteArray();
+  }
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_valid_values_ - prefix_len_idx_);
+    if (max_values == 0) {
+      return 0;
     }
-    this->num_values_ -= max_values;
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
+
+    const int32_t* prefix_lengths =
+        reinterpret_cast<const int32_t*>(buffered_prefix_length_->data()) +
+        prefix_len_idx_;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(prefix_lengths[i] < 0)) {
+        throw ParquetException("Negative DELTA_BYTE_ARRAY prefix length");
+      }
+      data_size += prefix_lengths[i] + buffer[i].len;
+    }
+
+    // Values are reconstructed in a buffer which lives as long as the page
+    std::shared_ptr<ResizableBuffer> decoded = AllocateBuffer(pool_, data_size);
+    uint8_t* out = decoded->mutable_data();
+    ByteArray previous = last_value_;
+    for (int i = 0; i < max_values; ++i) {
+      const uint32_t prefix_len = static_cast<uint32_t>(prefix_lengths[i]);
+      if (ARROW_PREDICT_FALSE(prefix_len > previous.len)) {
+        throw ParquetException("DELTA_BYTE_ARRAY prefix longer than the previous value");
+      }
+      if (prefix_len > 0) {
+        memcpy(out, previous.ptr, prefix_len);
+      }
+      if (buffer[i].len > 0) {
+        memcpy(out + prefix_len, buffer[i].ptr, buffer[i].len);
+      }
+      buffer[i] = ByteArray(prefix_len + buffer[i].len, out);
+      out += buffer[i].len;
+      previous = buffer[i];
+    }
+    last_value_ = previous;
+    decoded_values_.push_back(std::move(decoded));
+
+    prefix_len_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysArrowDense(this, num_values, null_count, valid_bits,
+                                      valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysArrowDict(this, num_values, null_count, valid_bits,
+                                     valid_bits_offset, out);
+  }
+
  private:
+  MemoryPool* pool_;
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
+  int num_valid_values_;
+  int prefix_len_idx_;
+  std::shared_ptr<ResizableBuffer> buffered_prefix_length_;
+  std::vector<std::shared_ptr<ResizableBuffer>> decoded_values_;
   ByteArray last_value_;
 };
 
@@ -2344,13 +3086,8 @@ int ByteStreamSplitDecoder<DType>::Decode(T* buffer, int max_values) {
   const int num_decoded_previously = num_values_in_buffer_ - num_values_;
   const uint8_t* data = data_ + num_decoded_previously;
 
-#if defined(ARROW_HAVE_SSE4_2)
-  arrow::util::internal::ByteStreamSplitDecodeSSE2<T>(data, values_to_decode,
-                                                      num_values_in_buffer_, buffer);
-#else
-  arrow::util::internal::ByteStreamSplitDecodeScalar<T>(data, values_to_decode,
-                                                        num_values_in_buffer_, buffer);
-#endif
+  arrow::util::internal::ByteStreamSplitDecode<T>(data, values_to_decode,
+                                                  num_values_in_buffer_, buffer);
   num_values_ -= values_to_decode;
   len_ -= sizeof(T) * values_to_decode;
   return values_to_decode;
@@ -2372,12 +3109,11 @@ int ByteStreamSplitDecoder<DType>::DecodeArrow(
   const uint8_t* data = data_ + num_decoded_previously;
   int offset = 0;
 
-#if defined(ARROW_HAVE_SSE4_2)
   // Use fast decoding into intermediate buffer.  This will also decode
   // some null values, but it's fast enough that we don't care.
   T* decode_out = EnsureDecodeBuffer(values_decoded);
-  arrow::util::internal::ByteStreamSplitDecodeSSE2<T>(data, values_decoded,
-                                                      num_values_in_buffer_, decode_out);
+  arrow::util::internal::ByteStreamSplitDecode<T>(data, values_decoded,
+                                                  num_values_in_buffer_, decode_out);
 
   // XXX If null_count is 0, we could even append in bulk or decode directly into
   // builder
@@ -2392,24 +3128,6 @@ int ByteStreamSplitDecoder<DType>::DecodeArrow(
 
   VisitNullBitmapInline(valid_bits, valid_bits_offset, num_values, null_count,
                         std::move(decode_value));
-#else
-  auto decode_value = [&](bool is_valid) {
-    if (is_valid) {
-      uint8_t gathered_byte_data[kNumStreams];
-      for (size_t b = 0; b < kNumStreams; ++b) {
-        const size_t byte_index = b * num_values_in_buffer_ + offset;
-        gathered_byte_data[b] = data[byte_index];
-      }
-      builder->UnsafeAppend(arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]));
-      ++offset;
-    } else {
-      builder->UnsafeAppendNull();
-    }
-  };
-
-  VisitNullBitmapInline(valid_bits, valid_bits_offset, num_values, null_count,
-                        std::move(decode_value));
-#endif
 
   num_values_ -= values_decoded;
   len_ -= sizeof(T) * values_decoded;
@@ -2483,6 +3201,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2523,6 +3261,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
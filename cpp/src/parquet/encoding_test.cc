@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -931,6 +932,55 @@ TEST_F(DictEncoding, CheckDecodeIndicesNoNulls) {
   CheckDict(actual_num_values, *builder);
 }
 
+template <Encoding::type kEncoding>
+class DeltaByteArrayEncodings : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    delta_decoder_ = MakeTypedDecoder<ByteArrayType>(kEncoding);
+    decoder_ = delta_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+
+ protected:
+  std::unique_ptr<ByteArrayDecoder> delta_decoder_;
+};
+
+using DeltaLengthByteArrayEncoding =
+    DeltaByteArrayEncodings<Encoding::DELTA_LENGTH_BYTE_ARRAY>;
+using DeltaByteArrayEncoding = DeltaByteArrayEncodings<Encoding::DELTA_BYTE_ARRAY>;
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
 // ----------------------------------------------------------------------
 // BYTE_STREAM_SPLIT encode/decode tests.
 
@@ -1101,7 +1151,9 @@ TYPED_TEST(TestByteStreamSplitEncoding, BasicRoundTrip) {
   // Exercise both.
   ASSERT_NO_FATAL_FAILURE(this->Execute(1337, 1));
 
-  for (int values = 0; values < 32; ++values) {
+  // Cover a few SIMD blocks with every suffix length (AVX2 processes blocks
+  // of 32 values, SSE2 and NEON blocks of 16).
+  for (int values = 0; values < 72; ++values) {
     ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
   }
 }
@@ -1146,5 +1198,215 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY
+// encode/decode tests.
+
+template <typename Type>
+class TestDeltaEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder = MakeTypedEncoder<Type>(encoding_, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(encoding_, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+      ASSERT_EQ(0, decoder->values_left());
+    }
+
+    {
+      // Try again but with a step that doesn't line up with blocks or miniblocks
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int step = 41;
+      int remaining = num_values_;
+      for (int i = 0; i < num_values_; i += step) {
+        int num_decoded = decoder->Decode(decode_buf_, step);
+        ASSERT_EQ(num_decoded, std::min(step, remaining));
+        ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, &draws_[i], num_decoded));
+        remaining -= num_decoded;
+      }
+    }
+
+    {
+      std::vector<uint8_t> valid_bits(arrow::BitUtil::BytesForBits(num_values_), 0);
+      std::vector<T> expected_filtered_output;
+      const int every_nth = 3;
+      expected_filtered_output.reserve((num_values_ + every_nth - 1) / every_nth);
+      arrow::internal::BitmapWriter writer{valid_bits.data(), 0, num_values_};
+      for (int i = 0; i < num_values_; ++i) {
+        if (i % every_nth == 0) {
+          writer.Set();
+          expected_filtered_output.push_back(draws_[i]);
+        }
+        writer.Next();
+      }
+      writer.Finish();
+      const int expected_size = static_cast<int>(expected_filtered_output.size());
+      ASSERT_NO_THROW(encoder->PutSpaced(draws_, num_values_, valid_bits.data(), 0));
+      encode_buffer_ = encoder->FlushValues();
+
+      decoder->SetData(expected_size, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(expected_size, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(
+          VerifyResults<T>(decode_buf_, expected_filtered_output.data(), expected_size));
+    }
+  }
+
+  void ExecuteWithEncoding(Encoding::type encoding, int nvalues, int repeats) {
+    encoding_ = encoding;
+    this->Execute(nvalues, repeats);
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+  Encoding::type encoding_ = Encoding::DELTA_BINARY_PACKED;
+};
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestDeltaEncoding<Type> {
+ public:
+  typedef typename Type::c_type T;
+
+  void CheckEncode(const std::vector<T>& values, const std::vector<uint8_t>& expected) {
+    auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    auto encoded = encoder->FlushValues();
+    ASSERT_TRUE(encoded->Equals(Buffer(expected.data(), expected.size())));
+
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), encoded->data(),
+                     static_cast<int>(encoded->size()));
+    std::vector<T> decoded(values.size());
+    ASSERT_EQ(static_cast<int>(values.size()),
+              decoder->Decode(decoded.data(), static_cast<int>(values.size())));
+    ASSERT_EQ(values, decoded);
+  }
+
+  void CheckRoundtripValues(const std::vector<T>& values) {
+    auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    auto encoded = encoder->FlushValues();
+
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), encoded->data(),
+                     static_cast<int>(encoded->size()));
+    std::vector<T> decoded(values.size());
+    ASSERT_EQ(static_cast<int>(values.size()),
+              decoder->Decode(decoded.data(), static_cast<int>(values.size())));
+    ASSERT_EQ(values, decoded);
+  }
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Sizes around the block (128 values) and miniblock (32 values) boundaries
+  for (int values : {0, 1, 2, 31, 32, 33, 127, 128, 129, 1000, 4097}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1000, 4));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, CheckEncode) {
+  // Examples from the Parquet format specification
+  ASSERT_NO_FATAL_FAILURE(this->CheckEncode(
+      {1, 2, 3, 4, 5}, {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00}));
+  ASSERT_NO_FATAL_FAILURE(
+      this->CheckEncode({7, 5, 3, 1, 2, 3, 4, 5},
+                        {0x80, 0x01, 0x04, 0x08, 0x0E, 0x03, 0x02, 0x00, 0x00,
+                         0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, ExtremeValues) {
+  using T = typename TypeParam::c_type;
+  const T min = std::numeric_limits<T>::min();
+  const T max = std::numeric_limits<T>::max();
+  // Deltas overflow and must wrap around
+  ASSERT_NO_FATAL_FAILURE(this->CheckRoundtripValues({min, max, min, 0, max, -1, 1}));
+
+  std::vector<T> values(300);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = (i % 2 == 0) ? min : max;
+  }
+  ASSERT_NO_FATAL_FAILURE(this->CheckRoundtripValues(values));
+}
+
+using TestDeltaByteArrayEncoding = TestDeltaEncoding<ByteArrayType>;
+
+TEST_F(TestDeltaByteArrayEncoding, DeltaLengthByteArrayRoundTrip) {
+  for (int values : {0, 1, 129, 2500}) {
+    ASSERT_NO_FATAL_FAILURE(
+        this->ExecuteWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY, values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(
+      this->ExecuteWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY, 1000, 3));
+}
+
+TEST_F(TestDeltaByteArrayEncoding, DeltaByteArrayRoundTrip) {
+  for (int values : {0, 1, 129, 2500}) {
+    ASSERT_NO_FATAL_FAILURE(
+        this->ExecuteWithEncoding(Encoding::DELTA_BYTE_ARRAY, values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteWithEncoding(Encoding::DELTA_BYTE_ARRAY, 1000, 3));
+}
+
+TEST(DeltaByteArrayEncodeDecode, SharedPrefixes) {
+  std::vector<std::string> strings = {"", "apple", "applesauce", "apply", "banana",
+                                      "banana", "", "b"};
+  std::vector<ByteArray> values;
+  for (const auto& s : strings) {
+    values.push_back(ByteArray(static_cast<uint32_t>(s.size()),
+                               reinterpret_cast<const uint8_t*>(s.data())));
+  }
+  const int num_values = static_cast<int>(values.size());
+
+  auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  encoder->Put(values.data(), num_values);
+  auto encoded = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  decoder->SetData(num_values, encoded->data(), static_cast<int>(encoded->size()));
+  std::vector<ByteArray> decoded(num_values);
+  ASSERT_EQ(num_values, decoder->Decode(decoded.data(), num_values));
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(strings[i], std::string(reinterpret_cast<const char*>(decoded[i].ptr),
+                                      decoded[i].len));
+  }
+}
+
+TEST(DeltaEncodeDecode, InvalidDataTypes) {
+  for (auto encoding : {Encoding::DELTA_BINARY_PACKED}) {
+    ASSERT_THROW(MakeTypedEncoder<BooleanType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<Int96Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FloatType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<DoubleType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FLBAType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<BooleanType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<ByteArrayType>(encoding), ParquetException);
+  }
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_THROW(MakeTypedEncoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<Int64Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<DoubleType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FLBAType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<FLBAType>(encoding), ParquetException);
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/io/memory.h"
+#include "arrow/testing/random.h"
+
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/encryption.h"
+#include "parquet/encryption_internal.h"
+#include "parquet/file_reader.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+namespace benchmark {
+
+const char kFooterKey[] = "0123456789012345";
+const char kAad[] = "benchmark aad";
+
+// ----------------------------------------------------------------------
+// Encryption of single modules, as of pages
+
+static void BM_AesModule(::benchmark::State& state, ParquetCipher::type cipher,
+                         bool decrypt) {
+  const int plaintext_len = static_cast<int>(state.range(0));
+  const int key_len = static_cast<int>(sizeof(kFooterKey) - 1);
+  const auto key = reinterpret_cast<const uint8_t*>(kFooterKey);
+  const auto aad = reinterpret_cast<const uint8_t*>(kAad);
+  const int aad_len = static_cast<int>(sizeof(kAad) - 1);
+
+  std::unique_ptr<encryption::AesEncryptor> encryptor(
+      encryption::AesEncryptor::Make(cipher, key_len, false, nullptr));
+  std::unique_ptr<encryption::AesDecryptor> decryptor(
+      encryption::AesDecryptor::Make(cipher, key_len, false, nullptr));
+
+  std::vector<uint8_t> plaintext(plaintext_len, 42);
+  std::vector<uint8_t> ciphertext(plaintext_len + encryptor->CiphertextSizeDelta());
+  const int ciphertext_len = encryptor->Encrypt(plaintext.data(), plaintext_len, key,
+                                                key_len, aad, aad_len, ciphertext.data());
+
+  for (auto _ : state) {
+    if (decrypt) {
+      ::benchmark::DoNotOptimize(decryptor->Decrypt(ciphertext.data(), ciphertext_len,
+                                                    key, key_len, aad, aad_len,
+                                                    plaintext.data()));
+    } else {
+      ::benchmark::DoNotOptimize(encryptor->Encrypt(plaintext.data(), plaintext_len, key,
+                                                    key_len, aad, aad_len,
+                                                    ciphertext.data()));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * plaintext_len);
+}
+
+static void BM_AesGcmEncrypt(::benchmark::State& state) {
+  BM_AesModule(state, ParquetCipher::AES_GCM_V1, false);
+}
+
+static void BM_AesGcmDecrypt(::benchmark::State& state) {
+  BM_AesModule(state, ParquetCipher::AES_GCM_V1, true);
+}
+
+static void BM_AesCtrEncrypt(::benchmark::State& state) {
+  BM_AesModule(state, ParquetCipher::AES_GCM_CTR_V1, false);
+}
+
+static void BM_AesCtrDecrypt(::benchmark::State& state) {
+  BM_AesModule(state, ParquetCipher::AES_GCM_CTR_V1, true);
+}
+
+BENCHMARK(BM_AesGcmEncrypt)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK(BM_AesGcmDecrypt)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK(BM_AesCtrEncrypt)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK(BM_AesCtrDecrypt)->RangeMultiplier(8)->Range(64, 64 * 1024);
+
+// ----------------------------------------------------------------------
+// Reads of encrypted versus plain files
+
+constexpr int kNumColumns = 8;
+constexpr int64_t kNumRows = 1 << 20;
+// Small pages, for which the per-module cost of encryption matters most
+constexpr int64_t kPageSize = 8 * 1024;
+
+static std::shared_ptr<Buffer> WriteFile(bool encrypted) {
+  ::arrow::random::RandomArrayGenerator rand(/*seed=*/42);
+  std::vector<std::shared_ptr<::arrow::Field>> fields;
+  std::vector<std::shared_ptr<::arrow::Array>> columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(::arrow::field("c" + std::to_string(i), ::arrow::int64()));
+    columns.push_back(rand.Int64(kNumRows, 0, 1 << 20, /*null_probability=*/0));
+  }
+  auto table = ::arrow::Table::Make(::arrow::schema(fields), columns);
+
+  WriterProperties::Builder builder;
+  builder.data_pagesize(kPageSize);
+  if (encrypted) {
+    builder.encryption(FileEncryptionProperties::Builder(kFooterKey).build());
+  }
+  auto sink = CreateOutputStream();
+  PARQUET_THROW_NOT_OK(arrow::WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                         kNumRows, builder.build()));
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+static void BM_ReadFile(::benchmark::State& state, bool encrypted) {
+  const bool use_threads = state.range(0) != 0;
+  auto buffer = WriteFile(encrypted);
+
+  for (auto _ : state) {
+    ReaderProperties properties = default_reader_properties();
+    if (encrypted) {
+      // Decryption properties with explicit keys can't be reused across files
+      FileDecryptionProperties::Builder builder;
+      properties.file_decryption_properties(builder.footer_key(kFooterKey)->build());
+    }
+    auto reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), properties);
+    std::unique_ptr<arrow::FileReader> arrow_reader;
+    PARQUET_THROW_NOT_OK(arrow::FileReader::Make(::arrow::default_memory_pool(),
+                                                 std::move(reader),
+                                                 ArrowReaderProperties(use_threads),
+                                                 &arrow_reader));
+    std::shared_ptr<::arrow::Table> table;
+    PARQUET_THROW_NOT_OK(arrow_reader->ReadTable(&table));
+  }
+  state.SetBytesProcessed(state.iterations() * kNumColumns * kNumRows *
+                          static_cast<int64_t>(sizeof(int64_t)));
+}
+
+static void BM_ReadPlainFile(::benchmark::State& state) { BM_ReadFile(state, false); }
+
+static void BM_ReadEncryptedFile(::benchmark::State& state) {
+  BM_ReadFile(state, true);
+}
+
+BENCHMARK(BM_ReadPlainFile)->ArgName("use_threads")->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(BM_ReadEncryptedFile)->ArgName("use_threads")->Arg(0)->Arg(1)->UseRealTime();
+
+}  // namespace benchmark
+}  // namespace parquet
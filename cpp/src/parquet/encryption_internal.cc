@@ -17,14 +17,17 @@
 
 #include "parquet/encryption_internal.h"
 #include <openssl/aes.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "parquet/exception.h"
@@ -39,44 +42,170 @@ constexpr int kCtrMode = 1;
 constexpr int kCtrIvLength = 16;
 constexpr int kBufferSizeLength = 4;
 
-#define ENCRYPT_INIT(CTX, ALG)                                        \
-  if (1 != EVP_EncryptInit_ex(CTX, ALG, nullptr, nullptr, nullptr)) { \
-    throw ParquetException("Couldn't init ALG encryption");           \
+static const EVP_CIPHER* AesCipher(int aes_mode, int key_len) {
+  if (kGcmMode == aes_mode) {
+    if (16 == key_len) return EVP_aes_128_gcm();
+    if (24 == key_len) return EVP_aes_192_gcm();
+    return EVP_aes_256_gcm();
   }
+  if (16 == key_len) return EVP_aes_128_ctr();
+  if (24 == key_len) return EVP_aes_192_ctr();
+  return EVP_aes_256_ctr();
+}
 
-#define DECRYPT_INIT(CTX, ALG)                                        \
-  if (1 != EVP_DecryptInit_ex(CTX, ALG, nullptr, nullptr, nullptr)) { \
-    throw ParquetException("Couldn't init ALG decryption");           \
+// Wipe a copy of a key from memory
+static void SecureClear(std::string* key) {
+  if (!key->empty()) {
+    OPENSSL_cleanse(&(*key)[0], key->size());
   }
+  key->clear();
+}
 
-class AesEncryptor::AesEncryptorImpl {
+// Cipher contexts are kept initialized with the key they were last used with,
+// so that the key schedule is only computed again when modules of another key
+// are processed, and only the IV (nonce) is set for each module.  Each
+// context is leased to one thread at a time, so that an encryptor or a
+// decryptor can be shared by the threads processing the columns of a file.
+class CipherContextPool {
  public:
-  explicit AesEncryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
+  CipherContextPool(const EVP_CIPHER* cipher, bool encrypt)
+      : cipher_(cipher), encrypt_(encrypt) {}
+
+  ~CipherContextPool() { WipeOut(); }
+
+  class Lease {
+   public:
+    Lease(CipherContextPool* pool, EVP_CIPHER_CTX* ctx, std::string key, bool new_key)
+        : pool_(pool), ctx_(ctx), key_(std::move(key)), new_key_(new_key) {}
+
+    Lease(Lease&& other)
+        : pool_(other.pool_),
+          ctx_(other.ctx_),
+          key_(std::move(other.key_)),
+          new_key_(other.new_key_) {
+      other.ctx_ = nullptr;
+    }
+
+    ~Lease() {
+      if (nullptr == ctx_) {
+        return;
+      }
+      if (new_key_) {
+        // The context may be half-initialized with the key
+        EVP_CIPHER_CTX_free(ctx_);
+        SecureClear(&key_);
+      } else {
+        pool_->Release(ctx_, std::move(key_));
+      }
+    }
 
-  ~AesEncryptorImpl() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
+    EVP_CIPHER_CTX* get() const { return ctx_; }
+
+    // Set the IV, along with the key if the context wasn't initialized with it
+    bool Init(const uint8_t* iv) {
+      const uint8_t* key =
+          new_key_ ? reinterpret_cast<const uint8_t*>(key_.data()) : nullptr;
+      if (1 != EVP_CipherInit_ex(ctx_, nullptr, nullptr, key, iv, /*enc=*/-1)) {
+        return false;
+      }
+      new_key_ = false;
+      return true;
     }
+
+   private:
+    CipherContextPool* pool_;
+    EVP_CIPHER_CTX* ctx_;
+    std::string key_;
+    // Whether the context wasn't initialized with the key yet.  Such contexts
+    // are discarded rather than returned to the pool.
+    bool new_key_;
+  };
+
+  Lease Acquire(const uint8_t* key, int key_len) {
+    std::string key_str(reinterpret_cast<const char*>(key), key_len);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Prefer the most recently used context having the key
+      for (auto it = free_.rbegin(); it != free_.rend(); ++it) {
+        if (it->key == key_str) {
+          EVP_CIPHER_CTX* ctx = it->ctx;
+          SecureClear(&it->key);
+          free_.erase(std::next(it).base());
+          return Lease(this, ctx, std::move(key_str), false);
+        }
+      }
+      if (!free_.empty()) {
+        EVP_CIPHER_CTX* ctx = free_.back().ctx;
+        SecureClear(&free_.back().key);
+        free_.pop_back();
+        return Lease(this, ctx, std::move(key_str), true);
+      }
+    }
+
+    EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+    if (nullptr == ctx) {
+      throw ParquetException("Couldn't init cipher context");
+    }
+    if (1 != EVP_CipherInit_ex(ctx, cipher_, nullptr, nullptr, nullptr, encrypt_)) {
+      EVP_CIPHER_CTX_free(ctx);
+      SecureClear(&key_str);
+      throw ParquetException(encrypt_ ? "Couldn't init AES encryption"
+                                      : "Couldn't init AES decryption");
+    }
+    return Lease(this, ctx, std::move(key_str), true);
   }
 
+  void WipeOut() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& entry : free_) {
+      EVP_CIPHER_CTX_free(entry.ctx);
+      SecureClear(&entry.key);
+    }
+    free_.clear();
+  }
+
+ private:
+  struct Entry {
+    EVP_CIPHER_CTX* ctx;
+    std::string key;
+  };
+
+  // Enough for the column keys being processed at once by a few threads
+  static constexpr size_t kMaxFreeContexts = 32;
+
+  void Release(EVP_CIPHER_CTX* ctx, std::string key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.size() >= kMaxFreeContexts) {
+      EVP_CIPHER_CTX_free(free_.front().ctx);
+      SecureClear(&free_.front().key);
+      free_.erase(free_.begin());
+    }
+    free_.push_back(Entry{ctx, std::move(key)});
+  }
+
+  const EVP_CIPHER* cipher_;
+  const int encrypt_;
+  std::mutex mutex_;
+  // Least recently used first
+  std::vector<Entry> free_;
+};
+
+class AesEncryptor::AesEncryptorImpl {
+ public:
+  explicit AesEncryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
+
   int Encrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* ciphertext);
 
   int SignedFooterEncrypt(const uint8_t* footer, int footer_len, const uint8_t* key,
                           int key_len, const uint8_t* aad, int aad_len,
                           const uint8_t* nonce, uint8_t* encrypted_footer);
-  void WipeOut() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
+  void WipeOut() { contexts_->WipeOut(); }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
-  EVP_CIPHER_CTX* ctx_;
+  std::unique_ptr<CipherContextPool> contexts_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
@@ -91,8 +220,6 @@ class AesEncryptor::AesEncryptorImpl {
 
 AesEncryptor::AesEncryptorImpl::AesEncryptorImpl(ParquetCipher::type alg_id, int key_len,
                                                  bool metadata) {
-  ctx_ = nullptr;
-
   ciphertext_size_delta_ = kBufferSizeLength + kNonceLength;
   if (metadata || (ParquetCipher::AES_GCM_V1 == alg_id)) {
     aes_mode_ = kGcmMode;
@@ -108,31 +235,7 @@ AesEncryptor::AesEncryptorImpl::AesEncryptorImpl(ParquetCipher::type alg_id, int
   }
 
   key_length_ = key_len;
-
-  ctx_ = EVP_CIPHER_CTX_new();
-  if (nullptr == ctx_) {
-    throw ParquetException("Couldn't init cipher context");
-  }
-
-  if (kGcmMode == aes_mode_) {
-    // Init AES-GCM with specified key length
-    if (16 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_128_gcm());
-    } else if (24 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_192_gcm());
-    } else if (32 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_256_gcm());
-    }
-  } else {
-    // Init AES-CTR with specified key length
-    if (16 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_128_ctr());
-    } else if (24 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_192_ctr());
-    } else if (32 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_256_ctr());
-    }
-  }
+  contexts_.reset(new CipherContextPool(AesCipher(aes_mode_, key_len), /*encrypt=*/true));
 }
 
 int AesEncryptor::AesEncryptorImpl::SignedFooterEncrypt(
@@ -186,18 +289,21 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   uint8_t tag[kGcmTagLength];
   memset(tag, 0, kGcmTagLength);
 
+  auto lease = contexts_->Acquire(key, key_len);
+  EVP_CIPHER_CTX* ctx = lease.get();
+
   // Setting key and IV (nonce)
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
+  if (!lease.Init(nonce)) {
     throw ParquetException("Couldn't set key and nonce");
   }
 
   // Setting additional authenticated data
-  if ((nullptr != aad) && (1 != EVP_EncryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
+  if ((nullptr != aad) && (1 != EVP_EncryptUpdate(ctx, nullptr, &len, aad, aad_len))) {
     throw ParquetException("Couldn't set AAD");
   }
 
   // Encryption
-  if (1 != EVP_EncryptUpdate(ctx_, ciphertext + kBufferSizeLength + kNonceLength, &len,
+  if (1 != EVP_EncryptUpdate(ctx, ciphertext + kBufferSizeLength + kNonceLength, &len,
                              plaintext, plaintext_len)) {
     throw ParquetException("Failed encryption update");
   }
@@ -205,7 +311,7 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   ciphertext_len = len;
 
   // Finalization
-  if (1 != EVP_EncryptFinal_ex(ctx_, ciphertext + kBufferSizeLength + kNonceLength + len,
+  if (1 != EVP_EncryptFinal_ex(ctx, ciphertext + kBufferSizeLength + kNonceLength + len,
                                &len)) {
     throw ParquetException("Failed encryption finalization");
   }
@@ -213,7 +319,7 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   ciphertext_len += len;
 
   // Getting the tag
-  if (1 != EVP_CIPHER_CTX_ctrl(ctx_, EVP_CTRL_GCM_GET_TAG, kGcmTagLength, tag)) {
+  if (1 != EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, kGcmTagLength, tag)) {
     throw ParquetException("Couldn't get AES-GCM tag");
   }
 
@@ -246,13 +352,16 @@ int AesEncryptor::AesEncryptorImpl::CtrEncrypt(const uint8_t* plaintext,
   std::copy(nonce, nonce + kNonceLength, iv);
   iv[kCtrIvLength - 1] = 1;
 
+  auto lease = contexts_->Acquire(key, key_len);
+  EVP_CIPHER_CTX* ctx = lease.get();
+
   // Setting key and IV
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
+  if (!lease.Init(iv)) {
     throw ParquetException("Couldn't set key and IV");
   }
 
   // Encryption
-  if (1 != EVP_EncryptUpdate(ctx_, ciphertext + kBufferSizeLength + kNonceLength, &len,
+  if (1 != EVP_EncryptUpdate(ctx, ciphertext + kBufferSizeLength + kNonceLength, &len,
                              plaintext, plaintext_len)) {
     throw ParquetException("Failed encryption update");
   }
@@ -260,7 +369,7 @@ int AesEncryptor::AesEncryptorImpl::CtrEncrypt(const uint8_t* plaintext,
   ciphertext_len = len;
 
   // Finalization
-  if (1 != EVP_EncryptFinal_ex(ctx_, ciphertext + kBufferSizeLength + kNonceLength + len,
+  if (1 != EVP_EncryptFinal_ex(ctx, ciphertext + kBufferSizeLength + kNonceLength + len,
                                &len)) {
     throw ParquetException("Failed encryption finalization");
   }
@@ -306,27 +415,15 @@ class AesDecryptor::AesDecryptorImpl {
  public:
   explicit AesDecryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
 
-  ~AesDecryptorImpl() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
-
   int Decrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
-  void WipeOut() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
+  void WipeOut() { contexts_->WipeOut(); }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
-  EVP_CIPHER_CTX* ctx_;
+  std::unique_ptr<CipherContextPool> contexts_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
@@ -349,8 +446,6 @@ AesDecryptor::~AesDecryptor() {}
 
 AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int key_len,
                                                  bool metadata) {
-  ctx_ = nullptr;
-
   ciphertext_size_delta_ = kBufferSizeLength + kNonceLength;
   if (metadata || (ParquetCipher::AES_GCM_V1 == alg_id)) {
     aes_mode_ = kGcmMode;
@@ -366,31 +461,8 @@ AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int
   }
 
   key_length_ = key_len;
-
-  ctx_ = EVP_CIPHER_CTX_new();
-  if (nullptr == ctx_) {
-    throw ParquetException("Couldn't init cipher context");
-  }
-
-  if (kGcmMode == aes_mode_) {
-    // Init AES-GCM with specified key length
-    if (16 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_128_gcm());
-    } else if (24 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_192_gcm());
-    } else if (32 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_256_gcm());
-    }
-  } else {
-    // Init AES-CTR with specified key length
-    if (16 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_128_ctr());
-    } else if (24 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_192_ctr());
-    } else if (32 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_256_ctr());
-    }
-  }
+  contexts_.reset(
+      new CipherContextPool(AesCipher(aes_mode_, key_len), /*encrypt=*/false));
 }
 
 AesEncryptor* AesEncryptor::Make(ParquetCipher::type alg_id, int key_len, bool metadata,
@@ -456,19 +528,22 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   std::copy(ciphertext + ciphertext_len - kGcmTagLength, ciphertext + ciphertext_len,
             tag);
 
+  auto lease = contexts_->Acquire(key, key_len);
+  EVP_CIPHER_CTX* ctx = lease.get();
+
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
+  if (!lease.Init(nonce)) {
     throw ParquetException("Couldn't set key and IV");
   }
 
   // Setting additional authenticated data
-  if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
+  if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx, nullptr, &len, aad, aad_len))) {
     throw ParquetException("Couldn't set AAD");
   }
 
   // Decryption
   if (!EVP_DecryptUpdate(
-          ctx_, plaintext, &len, ciphertext + kBufferSizeLength + kNonceLength,
+          ctx, plaintext, &len, ciphertext + kBufferSizeLength + kNonceLength,
           ciphertext_len - kBufferSizeLength - kNonceLength - kGcmTagLength)) {
     throw ParquetException("Failed decryption update");
   }
@@ -476,12 +551,12 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   plaintext_len = len;
 
   // Checking the tag (authentication)
-  if (!EVP_CIPHER_CTX_ctrl(ctx_, EVP_CTRL_GCM_SET_TAG, kGcmTagLength, tag)) {
+  if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, kGcmTagLength, tag)) {
     throw ParquetException("Failed authentication");
   }
 
   // Finalization
-  if (1 != EVP_DecryptFinal_ex(ctx_, plaintext + len, &len)) {
+  if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
 
@@ -518,13 +593,16 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   // is set to 1.
   iv[kCtrIvLength - 1] = 1;
 
+  auto lease = contexts_->Acquire(key, key_len);
+  EVP_CIPHER_CTX* ctx = lease.get();
+
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
+  if (!lease.Init(iv)) {
     throw ParquetException("Couldn't set key and IV");
   }
 
   // Decryption
-  if (!EVP_DecryptUpdate(ctx_, plaintext, &len,
+  if (!EVP_DecryptUpdate(ctx, plaintext, &len,
                          ciphertext + kBufferSizeLength + kNonceLength,
                          ciphertext_len - kNonceLength)) {
     throw ParquetException("Failed decryption update");
@@ -533,7 +611,7 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   plaintext_len = len;
 
   // Finalization
-  if (1 != EVP_DecryptFinal_ex(ctx_, plaintext + len, &len)) {
+  if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
 
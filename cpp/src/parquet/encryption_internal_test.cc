@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "parquet/encryption_internal.h"
+#include "parquet/exception.h"
+
+namespace parquet {
+namespace encryption {
+namespace test {
+
+class TestAesEncryption : public ::testing::TestWithParam<ParquetCipher::type> {
+ protected:
+  void SetUp() override {
+    for (int key_len : {16, 24, 32}) {
+      encryptors_.emplace_back(AesEncryptor::Make(GetParam(), key_len, false, nullptr));
+      decryptors_.emplace_back(AesDecryptor::Make(GetParam(), key_len, false, nullptr));
+    }
+  }
+
+  AesEncryptor* encryptor(const std::string& key) {
+    return encryptors_[key.size() / 8 - 2].get();
+  }
+
+  AesDecryptor* decryptor(const std::string& key) {
+    return decryptors_[key.size() / 8 - 2].get();
+  }
+
+  std::vector<uint8_t> Encrypt(const std::string& plaintext, const std::string& key,
+                               const std::string& aad) {
+    AesEncryptor* aes = encryptor(key);
+    std::vector<uint8_t> ciphertext(plaintext.size() + aes->CiphertextSizeDelta());
+    int ciphertext_len =
+        aes->Encrypt(Bytes(plaintext), static_cast<int>(plaintext.size()), Bytes(key),
+                     static_cast<int>(key.size()), Bytes(aad),
+                     static_cast<int>(aad.size()), ciphertext.data());
+    EXPECT_EQ(static_cast<int>(ciphertext.size()), ciphertext_len);
+    return ciphertext;
+  }
+
+  std::string Decrypt(const std::vector<uint8_t>& ciphertext, const std::string& key,
+                      const std::string& aad) {
+    AesDecryptor* aes = decryptor(key);
+    std::string plaintext(ciphertext.size() - aes->CiphertextSizeDelta(), '\0');
+    int plaintext_len = aes->Decrypt(
+        ciphertext.data(), static_cast<int>(ciphertext.size()), Bytes(key),
+        static_cast<int>(key.size()), Bytes(aad), static_cast<int>(aad.size()),
+        reinterpret_cast<uint8_t*>(&plaintext[0]));
+    EXPECT_EQ(static_cast<int>(plaintext.size()), plaintext_len);
+    return plaintext;
+  }
+
+  static const uint8_t* Bytes(const std::string& str) {
+    return reinterpret_cast<const uint8_t*>(str.data());
+  }
+
+  std::vector<std::unique_ptr<AesEncryptor>> encryptors_;
+  std::vector<std::unique_ptr<AesDecryptor>> decryptors_;
+};
+
+TEST_P(TestAesEncryption, RoundtripAlternatingKeys) {
+  // Contexts initialized with a key must not be reused with another one
+  const std::vector<std::string> keys = {"0123456789012345", "abcdefghijklmnop",
+                                         "0123456789012345abcdefgh",
+                                         "0123456789012345abcdefghijklmnop"};
+  const std::string aad = "module aad";
+  for (int i = 0; i < 20; ++i) {
+    const std::string& key = keys[i % keys.size()];
+    const std::string plaintext = "page " + std::to_string(i) + std::string(i * 7, 'x');
+    auto ciphertext = Encrypt(plaintext, key, aad);
+    ASSERT_EQ(plaintext, Decrypt(ciphertext, key, aad));
+  }
+}
+
+TEST_P(TestAesEncryption, NonceIsNotReused) {
+  const std::string key = "0123456789012345";
+  auto ciphertext1 = Encrypt("plaintext", key, "aad");
+  auto ciphertext2 = Encrypt("plaintext", key, "aad");
+  ASSERT_NE(ciphertext1, ciphertext2);
+}
+
+TEST_P(TestAesEncryption, DecryptAfterFailure) {
+  const std::string key = "0123456789012345";
+  const std::string other_key = "abcdefghijklmnop";
+  const std::string plaintext = "some plaintext to authenticate";
+  auto ciphertext = Encrypt(plaintext, key, "aad");
+  if (GetParam() == ParquetCipher::AES_GCM_V1) {
+    // The tag doesn't match
+    ASSERT_THROW(Decrypt(ciphertext, other_key, "aad"), ParquetException);
+    ASSERT_THROW(Decrypt(ciphertext, key, "other aad"), ParquetException);
+  }
+  ASSERT_EQ(plaintext, Decrypt(ciphertext, key, "aad"));
+}
+
+TEST_P(TestAesEncryption, Concurrent) {
+  std::vector<std::thread> threads;
+  std::vector<int> mismatches(8, 0);
+  for (int t = 0; t < static_cast<int>(mismatches.size()); ++t) {
+    threads.emplace_back([this, t, &mismatches]() {
+      // Half of the threads share a key
+      const std::string key = t % 2 == 0 ? "0123456789012345"
+                                         : "key of thread " + std::to_string(t) + "!";
+      for (int i = 0; i < 200; ++i) {
+        const std::string plaintext = std::to_string(t) + std::string(i, 'y');
+        auto ciphertext = Encrypt(plaintext, key, "aad");
+        mismatches[t] += Decrypt(ciphertext, key, "aad") != plaintext;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int count : mismatches) {
+    ASSERT_EQ(0, count);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AesCiphers, TestAesEncryption,
+                         ::testing::Values(ParquetCipher::AES_GCM_V1,
+                                           ParquetCipher::AES_GCM_CTR_V1));
+
+}  // namespace test
+}  // namespace encryption
+}  // namespace parquet
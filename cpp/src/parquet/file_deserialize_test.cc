@@ -30,6 +30,7 @@
 #include "parquet/thrift_internal.h"
 #include "parquet/types.h"
 
+#include "arrow/io/buffered.h"
 #include "arrow/io/memory.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
@@ -234,7 +235,7 @@ TEST_F(TestPageSerde, TestFailLargePageHeaders) {
   ASSERT_THROW(page_reader_->NextPage(), ParquetException);
 }
 
-TEST_F(TestPageSerde, Compression) {
+std::vector<Compression::type> GetTestCodecTypes() {
   std::vector<Compression::type> codec_types;
 
 #ifdef ARROW_WITH_SNAPPY
@@ -257,6 +258,12 @@ TEST_F(TestPageSerde, Compression) {
   codec_types.push_back(Compression::ZSTD);
 #endif
 
+  return codec_types;
+}
+
+TEST_F(TestPageSerde, Compression) {
+  std::vector<Compression::type> codec_types = GetTestCodecTypes();
+
   const int32_t num_rows = 32;  // dummy value
   data_page_header_.num_values = num_rows;
 
@@ -305,6 +312,59 @@ TEST_F(TestPageSerde, Compression) {
   }
 }  // namespace parquet
 
+TEST_F(TestPageSerde, CompressionPageBufferReuse) {
+  const int32_t num_rows = 32;  // dummy value
+  data_page_header_.num_values = num_rows;
+
+  const int num_pages = 10;
+  std::vector<std::vector<uint8_t>> faux_data(num_pages);
+  for (int i = 0; i < num_pages; ++i) {
+    // The pages keep getting smaller, so that the scratch buffers are reused
+    test::random_bytes((num_pages - i) * 64, 0, &faux_data[i]);
+  }
+  for (auto codec_type : GetTestCodecTypes()) {
+    auto codec = GetCodec(codec_type);
+
+    std::vector<uint8_t> buffer;
+    for (int i = 0; i < num_pages; ++i) {
+      const uint8_t* data = faux_data[i].data();
+      int data_size = static_cast<int>(faux_data[i].size());
+
+      int64_t max_compressed_size = codec->MaxCompressedLen(data_size, data);
+      buffer.resize(max_compressed_size);
+
+      int64_t actual_size;
+      ASSERT_OK_AND_ASSIGN(
+          actual_size, codec->Compress(data_size, data, max_compressed_size, &buffer[0]));
+
+      ASSERT_NO_FATAL_FAILURE(
+          WriteDataPageHeader(1024, data_size, static_cast<int32_t>(actual_size)));
+      ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
+    }
+    EndStream();
+
+    for (int64_t page_buffer_limit : {int64_t(0), DEFAULT_PAGE_BUFFER_LIMIT}) {
+      // A buffered stream can't hand out the compressed pages without copying
+      ASSERT_OK_AND_ASSIGN(
+          auto stream, ::arrow::io::BufferedInputStream::Create(
+                           64, ::arrow::default_memory_pool(),
+                           std::make_shared<BufferReader>(out_buffer_)));
+      page_reader_ = PageReader::Open(stream, num_rows * num_pages, codec_type);
+      page_reader_->set_page_buffer_limit(page_buffer_limit);
+
+      for (int i = 0; i < num_pages; ++i) {
+        int data_size = static_cast<int>(faux_data[i].size());
+        std::shared_ptr<Page> page = page_reader_->NextPage();
+        ASSERT_NE(nullptr, page);
+        ASSERT_EQ(data_size, page->size());
+        ASSERT_EQ(0, memcmp(faux_data[i].data(), page->data(), data_size));
+      }
+    }
+
+    ResetStream();
+  }
+}
+
 TEST_F(TestPageSerde, LZONotSupported) {
   // Must await PARQUET-530
   int data_size = 1024;
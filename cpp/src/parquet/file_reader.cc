@@ -21,13 +21,19 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -36,6 +42,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -53,6 +60,18 @@ static constexpr int64_t kMaxDictHeaderSize = 100;
 // ----------------------------------------------------------------------
 // RowGroupReader public API
 
+std::unique_ptr<BloomFilter> RowGroupReader::Contents::GetColumnBloomFilter(int i) {
+  return NULLPTR;
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::Contents::GetColumnIndex(int i) {
+  return NULLPTR;
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::Contents::GetOffsetIndex(int i) {
+  return NULLPTR;
+}
+
 RowGroupReader::RowGroupReader(std::unique_ptr<Contents> contents)
     : contents_(std::move(contents)) {}
 
@@ -75,23 +94,105 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnBloomFilter(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
+namespace {
+
+// The byte range of a column chunk in the file
+::arrow::io::ReadRange ComputeColumnChunkRange(FileMetaData* file_metadata,
+                                               int64_t source_size, int row_group_index,
+                                               int column_index) {
+  auto row_group_metadata = file_metadata->RowGroup(row_group_index);
+  auto column_metadata = row_group_metadata->ColumnChunk(column_index);
+
+  int64_t col_start = column_metadata->data_page_offset();
+  if (column_metadata->has_dictionary_page() &&
+      column_metadata->dictionary_page_offset() > 0 &&
+      col_start > column_metadata->dictionary_page_offset()) {
+    col_start = column_metadata->dictionary_page_offset();
+  }
+
+  int64_t col_length = column_metadata->total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata->writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    int64_t bytes_remaining = source_size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+
+  return {col_start, col_length};
+}
+
+// ReadRangeCache requires non-overlapping ranges, but column chunk ranges
+// can overlap because of the PARQUET-816 padding.
+std::vector<::arrow::io::ReadRange> MergeOverlappingRanges(
+    std::vector<::arrow::io::ReadRange> ranges) {
+  std::sort(ranges.begin(), ranges.end(),
+            [](const ::arrow::io::ReadRange& a, const ::arrow::io::ReadRange& b) {
+              return a.offset < b.offset;
+            });
+  std::vector<::arrow::io::ReadRange> merged;
+  for (const auto& range : ranges) {
+    if (!merged.empty() &&
+        range.offset < merged.back().offset + merged.back().length) {
+      auto& last = merged.back();
+      last.length = std::max(last.offset + last.length, range.offset + range.length) -
+                    last.offset;
+    } else {
+      merged.push_back(range);
+    }
+  }
+  return merged;
+}
+
+}  // namespace
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
-  SerializedRowGroup(std::shared_ptr<ArrowInputFile> source, int64_t source_size,
+  SerializedRowGroup(std::shared_ptr<ArrowInputFile> source,
+                     std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source,
+                     std::vector<bool> prebuffered_columns, int64_t source_size,
                      FileMetaData* file_metadata, int row_group_number,
                      const ReaderProperties& props,
                      std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr)
       : source_(std::move(source)),
+        cached_source_(std::move(cached_source)),
+        prebuffered_columns_(std::move(prebuffered_columns)),
         source_size_(source_size),
         file_metadata_(file_metadata),
         properties_(props),
         row_group_ordinal_(row_group_number),
         file_decryptor_(file_decryptor) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
+    prebuffered_columns_.resize(row_group_metadata_->num_columns(), false);
   }
 
   const RowGroupMetaData* metadata() const override { return row_group_metadata_.get(); }
@@ -102,34 +203,26 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
 
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
-    }
-
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t bytes_remaining = source_size_ - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
+    std::shared_ptr<ArrowInputStream> stream;
+    if (cached_source_ && prebuffered_columns_[i]) {
+      // The column chunk was pre-buffered by a coalesced read
+      PARQUET_ASSIGN_OR_THROW(auto buffer, cached_source_->Read(col_range));
+      stream = std::make_shared<::arrow::io::BufferReader>(buffer);
+    } else {
+      stream = properties_.GetStream(source_, col_range.offset, col_range.length);
     }
 
-    std::shared_ptr<ArrowInputStream> stream =
-        properties_.GetStream(source_, col_start, col_length);
-
     std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
 
     // Column is encrypted only if crypto_metadata exists.
     if (!crypto_metadata) {
-      return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool());
+      auto page_reader = PageReader::Open(stream, col->num_values(), col->compression(),
+                                          properties_.memory_pool());
+      page_reader->set_page_buffer_limit(properties_.page_buffer_limit());
+      SetPageLocations(i, col_range.offset, page_reader.get());
+      return page_reader;
     }
 
     if (file_decryptor_ == nullptr) {
@@ -145,8 +238,10 @@ class SerializedRowGroup : public RowGroupReader::Contents {
       data_decryptor = file_decryptor_->GetFooterDecryptorForColumnData();
       CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                         static_cast<int16_t>(i), meta_decryptor, data_decryptor);
-      return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool(), &ctx);
+      auto page_reader = PageReader::Open(stream, col->num_values(), col->compression(),
+                                          properties_.memory_pool(), &ctx);
+      page_reader->set_page_buffer_limit(properties_.page_buffer_limit());
+      return page_reader;
     }
 
     // The column is encrypted with its own key
@@ -160,12 +255,105 @@ class SerializedRowGroup : public RowGroupReader::Contents {
 
     CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                       static_cast<int16_t>(i), meta_decryptor, data_decryptor);
-    return PageReader::Open(stream, col->num_values(), col->compression(),
-                            properties_.memory_pool(), &ctx);
+    auto page_reader = PageReader::Open(stream, col->num_values(), col->compression(),
+                                        properties_.memory_pool(), &ctx);
+    page_reader->set_page_buffer_limit(properties_.page_buffer_limit());
+    return page_reader;
+  }
+
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+
+    // The serialized filter is its bitset length, hash strategy and algorithm,
+    // each as a 4-byte integer, followed by the bitset
+    constexpr int64_t kBloomFilterHeaderSize = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    if (offset < 0 || offset + kBloomFilterHeaderSize > source_size_) {
+      throw ParquetException("Invalid Bloom filter offset");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto header,
+                            source_->ReadAt(offset, kBloomFilterHeaderSize));
+    if (header->size() != kBloomFilterHeaderSize) {
+      throw ParquetException("Failed to read Bloom filter header");
+    }
+    const auto num_bytes = ::arrow::util::SafeLoadAs<uint32_t>(header->data());
+    if (num_bytes > source_size_ - offset - kBloomFilterHeaderSize) {
+      throw ParquetException("Invalid Bloom filter size");
+    }
+
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            source_->ReadAt(offset, kBloomFilterHeaderSize + num_bytes));
+    ::arrow::io::BufferReader stream(buffer);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index()) {
+      return nullptr;
+    }
+    auto buffer = ReadPageIndex(col->column_index_offset(), col->column_index_length());
+    return ColumnIndex::Make(file_metadata_->schema()->Column(i), buffer->data(),
+                             static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    // The offset indexes of pre-buffered column chunks are pre-buffered too
+    auto buffer = ReadPageIndex(col->offset_index_offset(), col->offset_index_length(),
+                                /*maybe_cached=*/prebuffered_columns_[i]);
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
   }
 
  private:
+  // Let the page reader skip data pages, if the column chunk has an OffsetIndex
+  void SetPageLocations(int i, int64_t col_start, PageReader* page_reader) {
+    std::unique_ptr<OffsetIndex> offset_index;
+    try {
+      offset_index = GetOffsetIndex(i);
+    } catch (const ParquetException&) {
+      // The pages can still be read one after the other
+    }
+    if (offset_index == nullptr) {
+      return;
+    }
+    std::vector<PageLocation> page_locations = offset_index->page_locations();
+    for (auto& location : page_locations) {
+      location.offset -= col_start;
+    }
+    page_reader->set_page_locations(std::move(page_locations));
+  }
+
+  std::shared_ptr<Buffer> ReadPageIndex(int64_t offset, int32_t length,
+                                        bool maybe_cached = false) {
+    if (offset < 0 || length < 0 || offset + length > source_size_) {
+      throw ParquetException("Invalid page index location");
+    }
+    if (cached_source_ && maybe_cached) {
+      auto maybe_buffer = cached_source_->Read({offset, length});
+      if (maybe_buffer.ok()) {
+        return *std::move(maybe_buffer);
+      }
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(offset, length));
+    if (buffer->size() != length) {
+      throw ParquetException("Failed to read page index");
+    }
+    return buffer;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
+  // Only set if PreBuffer() was called
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
+  // Whether each column chunk of this row group is in cached_source_
+  std::vector<bool> prebuffered_columns_;
   int64_t source_size_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
@@ -200,12 +388,50 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, source_size_, file_metadata_.get(),
-                               static_cast<int16_t>(i), properties_, file_decryptor_));
+    PreBufferedRowGroup prebuffered;
+    {
+      std::lock_guard<std::mutex> lock(prebuffered_mutex_);
+      auto it = prebuffered_row_groups_.find(i);
+      if (it != prebuffered_row_groups_.end()) {
+        prebuffered = it->second;
+      }
+    }
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, std::move(prebuffered.cache), std::move(prebuffered.columns),
+        source_size_, file_metadata_.get(), static_cast<int16_t>(i), properties_,
+        file_decryptor_));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices) override {
+    std::lock_guard<std::mutex> lock(prebuffered_mutex_);
+    // Replace any previous cache
+    prebuffered_row_groups_.clear();
+    PreBufferUnlocked(row_groups, column_indices);
+  }
+
+  void PrefetchRowGroups(const std::vector<int>& row_groups,
+                         const std::vector<int>& column_indices) override {
+    std::lock_guard<std::mutex> lock(prebuffered_mutex_);
+    std::vector<int> new_row_groups;
+    for (int row : row_groups) {
+      if (prebuffered_row_groups_.find(row) == prebuffered_row_groups_.end()) {
+        new_row_groups.push_back(row);
+      }
+    }
+    if (!new_row_groups.empty()) {
+      PreBufferUnlocked(new_row_groups, column_indices);
+    }
+  }
+
+  void ReleaseRowGroups(const std::vector<int>& row_groups) override {
+    std::lock_guard<std::mutex> lock(prebuffered_mutex_);
+    for (int row : row_groups) {
+      prebuffered_row_groups_.erase(row);
+    }
+  }
+
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
   void set_metadata(std::shared_ptr<FileMetaData> metadata) {
@@ -263,6 +489,46 @@ class SerializedFile : public ParquetFileReader::Contents {
 
  private:
   std::shared_ptr<ArrowInputFile> source_;
+  // The column chunks (and their offset indexes) of the row groups given to
+  // one call of PreBuffer() or PrefetchRowGroups() are read through the same
+  // cache, so that adjacent ones are coalesced
+  struct PreBufferedRowGroup {
+    std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache;
+    // Whether each column chunk is in the cache
+    std::vector<bool> columns;
+  };
+
+  void PreBufferUnlocked(const std::vector<int>& row_groups,
+                         const std::vector<int>& column_indices) {
+    auto cache = std::make_shared<::arrow::io::internal::ReadRangeCache>(source_);
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int row : row_groups) {
+      PreBufferedRowGroup& prebuffered = prebuffered_row_groups_[row];
+      prebuffered.cache = cache;
+      prebuffered.columns.resize(file_metadata_->num_columns(), false);
+      auto row_group_metadata = file_metadata_->RowGroup(row);
+      for (int col : column_indices) {
+        prebuffered.columns[col] = true;
+        ranges.push_back(
+            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+        // The column chunk's offset index is read before its pages
+        auto col_metadata = row_group_metadata->ColumnChunk(col);
+        if (col_metadata->has_offset_index()) {
+          const int64_t offset = col_metadata->offset_index_offset();
+          const int64_t length = col_metadata->offset_index_length();
+          if (offset >= 0 && length > 0 && offset + length <= source_size_) {
+            ranges.push_back({offset, length});
+          }
+        }
+      }
+    }
+    PARQUET_THROW_NOT_OK(cache->Cache(MergeOverlappingRanges(std::move(ranges))));
+  }
+
+  // Guards prebuffered_row_groups_, as the row groups of columns decoded in
+  // parallel are opened and prefetched from several threads
+  std::mutex prebuffered_mutex_;
+  std::unordered_map<int, PreBufferedRowGroup> prebuffered_row_groups_;
   int64_t source_size_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
@@ -315,7 +581,8 @@ void SerializedFile::ParseUnencryptedFileMetadata(
   }
 
   *read_metadata_len = *metadata_len;
-  file_metadata_ = FileMetaData::Make((*metadata_buffer)->data(), read_metadata_len);
+  file_metadata_ =
+      FileMetaData::Make((*metadata_buffer)->data(), read_metadata_len, properties_);
 }
 
 void SerializedFile::ParseMetaDataOfEncryptedFileWithEncryptedFooter(
@@ -370,8 +637,8 @@ void SerializedFile::ParseMetaDataOfEncryptedFileWithEncryptedFooter(
                            std::to_string(metadata_buffer->size()) + " bytes)");
   }
 
-  file_metadata_ =
-      FileMetaData::Make(metadata_buffer->data(), &metadata_len, file_decryptor_);
+  file_metadata_ = FileMetaData::Make(metadata_buffer->data(), &metadata_len,
+                                      properties_, file_decryptor_);
 }
 
 void SerializedFile::ParseMetaDataOfEncryptedFileWithPlaintextFooter(
@@ -528,6 +795,20 @@ std::shared_ptr<FileMetaData> ParquetFileReader::metadata() const {
   return contents_->metadata();
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices) {
+  contents_->PreBuffer(row_groups, column_indices);
+}
+
+void ParquetFileReader::PrefetchRowGroups(const std::vector<int>& row_groups,
+                                          const std::vector<int>& column_indices) {
+  contents_->PrefetchRowGroups(row_groups, column_indices);
+}
+
+void ParquetFileReader::ReleaseRowGroups(const std::vector<int>& row_groups) {
+  contents_->ReleaseRowGroups(row_groups);
+}
+
 std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   DCHECK(i < metadata()->num_row_groups())
       << "The file only has " << metadata()->num_row_groups()
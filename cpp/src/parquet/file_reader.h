@@ -28,8 +28,11 @@
 
 namespace parquet {
 
+class BloomFilter;
+class ColumnIndex;
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageReader;
 class RandomAccessSource;
 class RowGroupMetaData;
@@ -44,6 +47,11 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    // Reading Bloom filters is optional: by default, none are found
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+    // Reading the page index is optional too
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -57,6 +65,18 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the Bloom filter of the indicated row group-relative column, or
+  // return null if the column chunk has none.
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  // Read the ColumnIndex (page statistics) of the indicated row group-relative
+  // column, or return null if the column chunk has none.
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  // Read the OffsetIndex (page locations) of the indicated row group-relative
+  // column, or return null if the column chunk has none.
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -78,6 +98,12 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    // Pre-buffering is an optimization: by default, it does nothing
+    virtual void PreBuffer(const std::vector<int>& row_groups,
+                           const std::vector<int>& column_indices) {}
+    virtual void PrefetchRowGroups(const std::vector<int>& row_groups,
+                                   const std::vector<int>& column_indices) {}
+    virtual void ReleaseRowGroups(const std::vector<int>& row_groups) {}
   };
 
   ParquetFileReader();
@@ -117,6 +143,34 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// Pre-buffer the given columns of the given row groups.
+  ///
+  /// The byte ranges of the given column chunks are coalesced and read
+  /// in the background on the I/O thread pool (see
+  /// ::arrow::io::internal::ReadRangeCache).  Readers of these column chunks
+  /// subsequently obtained through RowGroup() get their data from these
+  /// buffers instead of issuing one read per column chunk.  This is useful
+  /// on high-latency filesystems such as S3.
+  ///
+  /// Each call replaces the buffers of the previous call.  Only row group
+  /// readers obtained after the call benefit from it.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices);
+
+  /// Pre-buffer the given columns of the given row groups, like PreBuffer(),
+  /// but in addition to the row groups pre-buffered before.
+  ///
+  /// Row groups already pre-buffered are left as they are.  The buffers of a
+  /// row group are held until ReleaseRowGroups() or the next PreBuffer(), so
+  /// that row groups can be fetched ahead of the one being decoded.
+  void PrefetchRowGroups(const std::vector<int>& row_groups,
+                         const std::vector<int>& column_indices);
+
+  /// Drop the buffers of the given pre-buffered row groups.
+  ///
+  /// Readers of their column chunks already obtained keep the data they need.
+  void ReleaseRowGroups(const std::vector<int>& row_groups);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -19,11 +19,14 @@
 
 #include "arrow/testing/gtest_compat.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
+#include "parquet/statistics.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
 
@@ -35,6 +38,27 @@ using schema::PrimitiveNode;
 
 namespace test {
 
+template <typename T>
+uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                         const T& value) {
+  return filter.Hash(value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                         const Int96& value) {
+  return filter.Hash(&value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                         const ByteArray& value) {
+  return filter.Hash(&value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor* descr,
+                         const FLBA& value) {
+  return filter.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
 template <typename TestType>
 class TestSerialize : public PrimitiveTypedTest<TestType> {
  public:
@@ -229,6 +253,78 @@ class TestSerialize : public PrimitiveTypedTest<TestType> {
     }
   }
 
+  void BloomFilterRoundTrip() {
+    auto sink = CreateOutputStream();
+    auto gnode = std::static_pointer_cast<GroupNode>(this->node_);
+
+    // Bloom filters for the first column only
+    auto writer_properties = WriterProperties::Builder()
+                                 .enable_bloom_filter(this->schema_.Column(0)->path())
+                                 ->build();
+    auto file_writer = ParquetFileWriter::Open(sink, gnode, writer_properties);
+    this->GenerateData(rows_per_rowgroup_);
+
+    RowGroupWriter* row_group_writer = file_writer->AppendRowGroup();
+    for (int col = 0; col < num_columns_; ++col) {
+      auto column_writer =
+          static_cast<TypedColumnWriter<TestType>*>(row_group_writer->NextColumn());
+      column_writer->WriteBatch(rows_per_rowgroup_, this->def_levels_.data(), nullptr,
+                                this->values_ptr_);
+    }
+    row_group_writer->Close();
+
+    row_group_writer = file_writer->AppendBufferedRowGroup();
+    for (int col = 0; col < num_columns_; ++col) {
+      auto column_writer =
+          static_cast<TypedColumnWriter<TestType>*>(row_group_writer->column(col));
+      column_writer->WriteBatch(rows_per_rowgroup_, this->def_levels_.data(), nullptr,
+                                this->values_ptr_);
+    }
+    row_group_writer->Close();
+    file_writer->Close();
+
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+    auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+    auto file_reader = ParquetFileReader::Open(source);
+    ASSERT_EQ(2, file_reader->metadata()->num_row_groups());
+
+    const ColumnDescriptor* descr = this->schema_.Column(0);
+    for (int rg = 0; rg < 2; ++rg) {
+      auto rg_reader = file_reader->RowGroup(rg);
+      for (int i = 1; i < num_columns_; ++i) {
+        ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(i)->has_bloom_filter());
+        ASSERT_EQ(nullptr, rg_reader->GetColumnBloomFilter(i));
+      }
+
+      // The Bloom filters don't get in the way of reading the column chunks
+      for (int i = 0; i < num_columns_; ++i) {
+        int64_t values_read;
+        std::vector<int16_t> def_levels_out(rows_per_rowgroup_);
+        auto col_reader =
+            std::static_pointer_cast<TypedColumnReader<TestType>>(rg_reader->Column(i));
+        this->SetupValuesOut(rows_per_rowgroup_);
+        col_reader->ReadBatch(rows_per_rowgroup_, def_levels_out.data(), nullptr,
+                              this->values_out_ptr_, &values_read);
+        this->SyncValuesOut();
+        ASSERT_EQ(rows_per_rowgroup_, values_read);
+        ASSERT_EQ(this->values_, this->values_out_);
+      }
+
+      auto bloom_filter = rg_reader->GetColumnBloomFilter(0);
+      if (TestType::type_num == Type::BOOLEAN) {
+        // Not supported for BOOLEAN
+        ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+        ASSERT_EQ(nullptr, bloom_filter);
+        continue;
+      }
+      ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+      ASSERT_NE(nullptr, bloom_filter);
+      for (const auto& value : this->values_) {
+        ASSERT_TRUE(bloom_filter->FindHash(BloomFilterHash(*bloom_filter, descr, value)));
+      }
+    }
+  }
+
   void ZeroRowsRowGroup() {
     auto sink = CreateOutputStream();
     auto gnode = std::static_pointer_cast<GroupNode>(this->node_);
@@ -283,6 +379,10 @@ TYPED_TEST(TestSerialize, TooManyRows) {
 
 TYPED_TEST(TestSerialize, ZeroRows) { ASSERT_NO_THROW(this->ZeroRowsRowGroup()); }
 
+TYPED_TEST(TestSerialize, BloomFilter) {
+  ASSERT_NO_FATAL_FAILURE(this->BloomFilterRoundTrip());
+}
+
 TYPED_TEST(TestSerialize, RepeatedTooFewRows) {
   ASSERT_THROW(this->RepeatedUnequalRows(), ParquetException);
 }
@@ -398,6 +498,76 @@ TEST(TestBufferedRowGroupWriter, MultiPageDisabledDictionary) {
   }
 }
 
+// With and without dictionary encoding
+class TestPageIndex : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestPageIndex, RoundTripAndSkipPages) {
+  const int VALUE_COUNT = 10000;
+  auto sink = CreateOutputStream();
+  WriterProperties::Builder builder;
+  builder.data_pagesize(1024)->enable_write_page_index();
+  if (!GetParam()) {
+    builder.disable_dictionary();
+  }
+  schema::NodeVector fields;
+  fields.push_back(
+      PrimitiveNode::Make("col", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = parquet::ParquetFileWriter::Open(sink, schema, builder.build());
+  auto col_writer =
+      static_cast<Int32Writer*>(file_writer->AppendRowGroup()->NextColumn());
+  std::vector<int32_t> values_in;
+  for (int i = 0; i < VALUE_COUNT; ++i) {
+    values_in.push_back(i);
+  }
+  col_writer->WriteBatch(VALUE_COUNT, nullptr, nullptr, values_in.data());
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+  auto file_reader = ParquetFileReader::Open(source);
+  auto rg_reader = file_reader->RowGroup(0);
+  ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_column_index());
+  ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_offset_index());
+
+  auto offset_index = rg_reader->GetOffsetIndex(0);
+  auto column_index = rg_reader->GetColumnIndex(0);
+  ASSERT_NE(nullptr, offset_index);
+  ASSERT_NE(nullptr, column_index);
+  ASSERT_GT(offset_index->num_pages(), 2);
+  ASSERT_EQ(offset_index->num_pages(), column_index->num_pages());
+
+  // The values are sorted: the bounds of each page are the values of its rows
+  for (int i = 0; i < offset_index->num_pages(); ++i) {
+    const int64_t first_row = offset_index->page_locations()[i].first_row_index;
+    const int64_t num_rows = offset_index->page_num_rows(i, VALUE_COUNT);
+    auto stats = std::static_pointer_cast<Int32Statistics>(
+        column_index->page_statistics(i, num_rows));
+    ASSERT_FALSE(column_index->null_pages()[i]);
+    ASSERT_EQ(first_row, stats->min());
+    ASSERT_EQ(first_row + num_rows - 1, stats->max());
+  }
+
+  // Skip whole pages, and parts of pages, around the reads
+  auto record_reader =
+      internal::RecordReader::Make(file_reader->metadata()->schema()->Column(0));
+  record_reader->SetPageReader(rg_reader->GetColumnPageReader(0));
+  ASSERT_EQ(5000, record_reader->SkipRecords(5000));
+  ASSERT_EQ(10, record_reader->ReadRecords(10));
+  auto values = reinterpret_cast<const int32_t*>(record_reader->values());
+  ASSERT_EQ(std::vector<int32_t>(values_in.begin() + 5000, values_in.begin() + 5010),
+            std::vector<int32_t>(values, values + 10));
+  ASSERT_EQ(4980, record_reader->SkipRecords(4980));
+  ASSERT_EQ(10, record_reader->ReadRecords(10));
+  values = reinterpret_cast<const int32_t*>(record_reader->values());
+  ASSERT_EQ(std::vector<int32_t>(values_in.end() - 10, values_in.end()),
+            std::vector<int32_t>(values, values + 10));
+  ASSERT_EQ(0, record_reader->SkipRecords(1));
+}
+
+INSTANTIATE_TEST_SUITE_P(DictionaryEncoding, TestPageIndex, ::testing::Bool());
+
 }  // namespace test
 
 }  // namespace parquet
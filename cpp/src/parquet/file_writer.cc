@@ -23,11 +23,13 @@
 #include <utility>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -98,6 +100,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       InitColumns();
     } else {
       column_writers_.push_back(nullptr);
+      column_metadata_.push_back(nullptr);
     }
   }
 
@@ -123,7 +126,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     auto col_meta = metadata_->NextColumnChunk();
 
     if (column_writers_[0]) {
-      total_bytes_written_ += column_writers_[0]->Close();
+      total_bytes_written_ += CloseColumn(0);
     }
 
     ++next_column_index_;
@@ -140,6 +143,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
         properties_->memory_pool(), false, meta_encryptor, data_encryptor);
     column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+    column_metadata_[0] = col_meta;
     return column_writers_[0].get();
   }
 
@@ -184,12 +188,16 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
 
       for (size_t i = 0; i < column_writers_.size(); i++) {
         if (column_writers_[i]) {
-          total_bytes_written_ += column_writers_[i]->Close();
+          total_bytes_written_ += CloseColumn(i);
           column_writers_[i].reset();
         }
       }
 
       column_writers_.clear();
+      column_metadata_.clear();
+
+      WriteBloomFilters();
+      WritePageIndexes();
 
       // Ensures all columns have been written
       metadata_->set_num_rows(num_rows_);
@@ -208,6 +216,62 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  // The Bloom filters of the closed column chunks, written after all of them
+  std::vector<std::pair<ColumnChunkMetaDataBuilder*, std::unique_ptr<BloomFilter>>>
+      bloom_filters_;
+  // The page indexes of the closed column chunks, written after all of them
+  struct ColumnPageIndex {
+    ColumnChunkMetaDataBuilder* metadata;
+    std::unique_ptr<ColumnIndex> column_index;
+    std::unique_ptr<OffsetIndex> offset_index;
+  };
+  std::vector<ColumnPageIndex> page_indexes_;
+
+  int64_t CloseColumn(size_t i) {
+    int64_t bytes_written = column_writers_[i]->Close();
+    auto bloom_filter = column_writers_[i]->ReleaseBloomFilter();
+    if (bloom_filter != nullptr) {
+      bloom_filters_.emplace_back(column_metadata_[i], std::move(bloom_filter));
+    }
+    auto offset_index = column_writers_[i]->ReleaseOffsetIndex();
+    if (offset_index != nullptr) {
+      page_indexes_.push_back({column_metadata_[i],
+                               column_writers_[i]->ReleaseColumnIndex(),
+                               std::move(offset_index)});
+    }
+    return bytes_written;
+  }
+
+  void WriteBloomFilters() {
+    for (const auto& column_bloom_filter : bloom_filters_) {
+      PARQUET_ASSIGN_OR_THROW(int64_t position, sink_->Tell());
+      column_bloom_filter.second->WriteTo(sink_.get());
+      column_bloom_filter.first->set_bloom_filter_offset(position);
+    }
+    bloom_filters_.clear();
+  }
+
+  // As the format recommends, the ColumnIndexes precede the OffsetIndexes
+  void WritePageIndexes() {
+    for (const auto& page_index : page_indexes_) {
+      if (page_index.column_index == nullptr) {
+        continue;
+      }
+      PARQUET_ASSIGN_OR_THROW(int64_t start, sink_->Tell());
+      page_index.column_index->WriteTo(sink_.get());
+      PARQUET_ASSIGN_OR_THROW(int64_t end, sink_->Tell());
+      page_index.metadata->set_column_index_location(start,
+                                                      static_cast<int32_t>(end - start));
+    }
+    for (const auto& page_index : page_indexes_) {
+      PARQUET_ASSIGN_OR_THROW(int64_t start, sink_->Tell());
+      page_index.offset_index->WriteTo(sink_.get());
+      PARQUET_ASSIGN_OR_THROW(int64_t end, sink_->Tell());
+      page_index.metadata->set_offset_index_location(start,
+                                                      static_cast<int32_t>(end - start));
+    }
+    page_indexes_.clear();
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -248,10 +312,12 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
           buffered_row_group_, meta_encryptor, data_encryptor);
       column_writers_.push_back(
           ColumnWriter::Make(col_meta, std::move(pager), properties_));
+      column_metadata_.push_back(col_meta);
     }
   }
 
   std::vector<std::shared_ptr<ColumnWriter>> column_writers_;
+  std::vector<ColumnChunkMetaDataBuilder*> column_metadata_;
 };
 
 // ----------------------------------------------------------------------
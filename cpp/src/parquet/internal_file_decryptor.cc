@@ -59,6 +59,7 @@ InternalFileDecryptor::InternalFileDecryptor(FileDecryptionProperties* propertie
 }
 
 void InternalFileDecryptor::WipeOutDecryptionKeys() {
+  std::lock_guard<std::mutex> lock(mutex_);
   properties_->WipeOutDecryptionKeys();
   for (auto const& i : all_decryptors_) {
     i->WipeOut();
@@ -104,12 +105,19 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptorForColumnDat
   return GetFooterDecryptor(aad, false);
 }
 
+// Decryptors are returned as copies of the cached ones, since the page readers
+// of the column chunks, which may be read in parallel, update their AAD
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptor(
     const std::string& aad, bool metadata) {
+  std::lock_guard<std::mutex> lock(mutex_);
   if (metadata) {
-    if (footer_metadata_decryptor_ != nullptr) return footer_metadata_decryptor_;
+    if (footer_metadata_decryptor_ != nullptr) {
+      return std::make_shared<Decryptor>(*footer_metadata_decryptor_);
+    }
   } else {
-    if (footer_data_decryptor_ != nullptr) return footer_data_decryptor_;
+    if (footer_data_decryptor_ != nullptr) {
+      return std::make_shared<Decryptor>(*footer_data_decryptor_);
+    }
   }
 
   std::string footer_key = properties_->footer_key();
@@ -142,8 +150,8 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptor(
   footer_data_decryptor_ =
       std::make_shared<Decryptor>(aes_data_decryptor, footer_key, file_aad_, aad, pool_);
 
-  if (metadata) return footer_metadata_decryptor_;
-  return footer_data_decryptor_;
+  if (metadata) return std::make_shared<Decryptor>(*footer_metadata_decryptor_);
+  return std::make_shared<Decryptor>(*footer_data_decryptor_);
 }
 
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnMetaDecryptor(
@@ -161,17 +169,18 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDataDecryptor(
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
     const std::string& column_path, const std::string& column_key_metadata,
     const std::string& aad, bool metadata) {
+  std::lock_guard<std::mutex> lock(mutex_);
   std::string column_key;
   // first look if we already got the decryptor from before
   if (metadata) {
     if (column_metadata_map_.find(column_path) != column_metadata_map_.end()) {
-      auto res(column_metadata_map_.at(column_path));
+      auto res = std::make_shared<Decryptor>(*column_metadata_map_.at(column_path));
       res->UpdateAad(aad);
       return res;
     }
   } else {
     if (column_data_map_.find(column_path) != column_data_map_.end()) {
-      auto res(column_data_map_.at(column_path));
+      auto res = std::make_shared<Decryptor>(*column_data_map_.at(column_path));
       res->UpdateAad(aad);
       return res;
     }
@@ -203,8 +212,8 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
   column_data_map_[column_path] =
       std::make_shared<Decryptor>(aes_data_decryptor, column_key, file_aad_, aad, pool_);
 
-  if (metadata) return column_metadata_map_[column_path];
-  return column_data_map_[column_path];
+  if (metadata) return std::make_shared<Decryptor>(*column_metadata_map_[column_path]);
+  return std::make_shared<Decryptor>(*column_data_map_[column_path]);
 }
 
 int InternalFileDecryptor::MapKeyLenToDecryptorArrayIndex(int key_len) {
@@ -19,6 +19,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -98,6 +99,8 @@ class InternalFileDecryptor {
   ParquetCipher::type algorithm_;
   std::string footer_key_metadata_;
   std::vector<encryption::AesDecryptor*> all_decryptors_;
+  // Guards the decryptors, which column chunks read in parallel look up
+  std::mutex mutex_;
 
   /// Key must be 16, 24 or 32 bytes in length. Thus there could be up to three
   // types of meta_decryptors and data_decryptors.
@@ -20,6 +20,8 @@
 #include <inttypes.h>
 
 #include <algorithm>
+#include <cstring>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -306,6 +308,30 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
 
   inline int64_t index_page_offset() const { return column_metadata_->index_page_offset; }
 
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
+  inline bool has_column_index() const {
+    return column_->__isset.column_index_offset && column_->__isset.column_index_length;
+  }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const {
+    return column_->__isset.offset_index_offset && column_->__isset.offset_index_length;
+  }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
   inline int64_t total_compressed_size() const {
     return column_metadata_->total_compressed_size;
   }
@@ -389,6 +415,32 @@ int64_t ColumnChunkMetaData::index_page_offset() const {
   return impl_->index_page_offset();
 }
 
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
 Compression::type ColumnChunkMetaData::compression() const {
   return impl_->compression();
 }
@@ -417,6 +469,63 @@ std::unique_ptr<ColumnCryptoMetaData> ColumnChunkMetaData::crypto_metadata() con
   return impl_->crypto_metadata();
 }
 
+// The ids of the fields of lists deserialized lazily
+constexpr int16_t kFileMetaDataRowGroupsFieldId = 4;
+constexpr int16_t kRowGroupColumnsFieldId = 1;
+
+// A row group of a footer deserialized lazily.  Its fields other than its
+// column chunks are deserialized on construction, and each of its column
+// chunks on first access.
+class LazyRowGroup {
+ public:
+  // The row group serialized in the given range of the footer
+  LazyRowGroup(std::shared_ptr<Buffer> footer, ThriftRange range)
+      : footer_(std::move(footer)), data_(footer_->data() + range.offset) {
+    uint32_t len = range.length;
+    std::string stripped;
+    SplitThriftStructList(data_, &len, kRowGroupColumnsFieldId, &column_ranges_,
+                          &stripped);
+    uint32_t stripped_len = static_cast<uint32_t>(stripped.size());
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(stripped.data()),
+                         &stripped_len, &row_group_);
+    columns_.resize(column_ranges_.size());
+  }
+
+  // The row group without its column chunks
+  const format::RowGroup& row_group() const { return row_group_; }
+
+  int num_columns() const { return static_cast<int>(column_ranges_.size()); }
+
+  const format::ColumnChunk& column(int i) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (columns_[i] == nullptr) {
+      std::unique_ptr<format::ColumnChunk> column(new format::ColumnChunk);
+      uint32_t len = column_ranges_[i].length;
+      DeserializeThriftMsg(data_ + column_ranges_[i].offset, &len, column.get());
+      columns_[i] = std::move(column);
+    }
+    return *columns_[i];
+  }
+
+  // A copy of the row group with all of its column chunks
+  format::RowGroup Materialize() const {
+    format::RowGroup row_group = row_group_;
+    row_group.columns.reserve(column_ranges_.size());
+    for (int i = 0; i < num_columns(); ++i) {
+      row_group.columns.push_back(column(i));
+    }
+    return row_group;
+  }
+
+ private:
+  std::shared_ptr<Buffer> footer_;
+  const uint8_t* data_;
+  format::RowGroup row_group_;
+  std::vector<ThriftRange> column_ranges_;
+  mutable std::mutex mutex_;
+  mutable std::vector<std::unique_ptr<format::ColumnChunk>> columns_;
+};
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
@@ -429,7 +538,20 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
         writer_version_(writer_version),
         file_decryptor_(file_decryptor) {}
 
-  inline int num_columns() const { return static_cast<int>(row_group_->columns.size()); }
+  explicit RowGroupMetaDataImpl(std::shared_ptr<LazyRowGroup> lazy_row_group,
+                                const SchemaDescriptor* schema,
+                                const ApplicationVersion* writer_version,
+                                std::shared_ptr<InternalFileDecryptor> file_decryptor)
+      : row_group_(&lazy_row_group->row_group()),
+        lazy_row_group_(std::move(lazy_row_group)),
+        schema_(schema),
+        writer_version_(writer_version),
+        file_decryptor_(file_decryptor) {}
+
+  inline int num_columns() const {
+    return lazy_row_group_ != nullptr ? lazy_row_group_->num_columns()
+                                      : static_cast<int>(row_group_->columns.size());
+  }
 
   inline int64_t num_rows() const { return row_group_->num_rows; }
 
@@ -450,13 +572,18 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
          << " columns, requested metadata for column: " << i;
       throw ParquetException(ss.str());
     }
-    return ColumnChunkMetaData::Make(&row_group_->columns[i], schema_->Column(i),
-                                     writer_version_, row_group_->ordinal, (int16_t)i,
-                                     file_decryptor_);
+    const format::ColumnChunk* column = lazy_row_group_ != nullptr
+                                            ? &lazy_row_group_->column(i)
+                                            : &row_group_->columns[i];
+    return ColumnChunkMetaData::Make(column, schema_->Column(i), writer_version_,
+                                     row_group_->ordinal, (int16_t)i, file_decryptor_);
   }
 
  private:
   const format::RowGroup* row_group_;
+  // Set if the column chunks are deserialized lazily, in which case
+  // row_group_ has none
+  std::shared_ptr<LazyRowGroup> lazy_row_group_;
   const SchemaDescriptor* schema_;
   const ApplicationVersion* writer_version_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
@@ -477,6 +604,9 @@ RowGroupMetaData::RowGroupMetaData(const void* metadata, const SchemaDescriptor*
           new RowGroupMetaDataImpl(reinterpret_cast<const format::RowGroup*>(metadata),
                                    schema, writer_version, file_decryptor))} {}
 
+RowGroupMetaData::RowGroupMetaData(std::unique_ptr<RowGroupMetaDataImpl> impl)
+    : impl_(std::move(impl)) {}
+
 RowGroupMetaData::~RowGroupMetaData() {}
 
 int RowGroupMetaData::num_columns() const { return impl_->num_columns(); }
@@ -508,15 +638,20 @@ class FileMetaData::FileMetaDataImpl {
 
   explicit FileMetaDataImpl(
       const void* metadata, uint32_t* metadata_len,
-      std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr)
+      std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr, bool lazy = false)
       : metadata_len_(0), file_decryptor_(file_decryptor) {
     metadata_.reset(new format::FileMetaData);
 
     auto footer_decryptor =
         file_decryptor_ != nullptr ? file_decryptor->GetFooterDecryptor() : nullptr;
 
-    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(metadata), metadata_len,
-                         metadata_.get(), footer_decryptor);
+    if (lazy) {
+      DeserializeLazily(reinterpret_cast<const uint8_t*>(metadata), metadata_len,
+                        footer_decryptor);
+    } else {
+      DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(metadata), metadata_len,
+                           metadata_.get(), footer_decryptor);
+    }
     metadata_len_ = *metadata_len;
 
     if (metadata_->__isset.created_by) {
@@ -536,10 +671,17 @@ class FileMetaData::FileMetaDataImpl {
       throw ParquetException("Decryption not set properly. cannot verify signature");
     }
     // serialize the footer
-    uint8_t* serialized_data;
+    const uint8_t* serialized_data;
     uint32_t serialized_len = metadata_len_;
     ThriftSerializer serializer;
-    serializer.SerializeToBuffer(metadata_.get(), &serialized_len, &serialized_data);
+    if (footer_ != nullptr) {
+      // The row groups were not deserialized: use the footer as read
+      serialized_data = footer_->data();
+    } else {
+      uint8_t* data;
+      serializer.SerializeToBuffer(metadata_.get(), &serialized_len, &data);
+      serialized_data = data;
+    }
 
     // encrypt with nonce
     uint8_t* nonce = const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(signature));
@@ -571,7 +713,8 @@ class FileMetaData::FileMetaDataImpl {
   inline int num_columns() const { return schema_.num_columns(); }
   inline int64_t num_rows() const { return metadata_->num_rows; }
   inline int num_row_groups() const {
-    return static_cast<int>(metadata_->row_groups.size());
+    return footer_ != nullptr ? static_cast<int>(row_group_ranges_.size())
+                              : static_cast<int>(metadata_->row_groups.size());
   }
   inline int32_t version() const { return metadata_->version; }
   inline const std::string& created_by() const { return metadata_->created_by; }
@@ -593,13 +736,20 @@ class FileMetaData::FileMetaDataImpl {
 
   void WriteTo(::arrow::io::OutputStream* dst,
                const std::shared_ptr<Encryptor>& encryptor) const {
+    const format::FileMetaData* metadata = metadata_.get();
+    format::FileMetaData materialized;
+    if (footer_ != nullptr) {
+      materialized = *metadata_;
+      materialized.row_groups = MaterializedRowGroups();
+      metadata = &materialized;
+    }
     ThriftSerializer serializer;
     // Only in encrypted files with plaintext footers the
     // encryption_algorithm is set in footer
     if (is_encryption_algorithm_set()) {
       uint8_t* serialized_data;
       uint32_t serialized_len;
-      serializer.SerializeToBuffer(metadata_.get(), &serialized_len, &serialized_data);
+      serializer.SerializeToBuffer(metadata, &serialized_len, &serialized_data);
 
       // encrypt the footer key
       std::vector<uint8_t> encrypted_data(encryptor->CiphertextSizeDelta() +
@@ -617,7 +767,7 @@ class FileMetaData::FileMetaDataImpl {
                      encryption::kGcmTagLength));
     } else {  // either plaintext file (when encryptor is null)
       // or encrypted file with encrypted footer
-      serializer.Serialize(metadata_.get(), dst, encryptor);
+      serializer.Serialize(metadata, dst, encryptor);
     }
   }
 
@@ -628,6 +778,12 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
+    if (footer_ != nullptr) {
+      return std::unique_ptr<RowGroupMetaData>(
+          new RowGroupMetaData(std::unique_ptr<RowGroupMetaData::RowGroupMetaDataImpl>(
+              new RowGroupMetaData::RowGroupMetaDataImpl(
+                  GetLazyRowGroup(i), &schema_, &writer_version_, file_decryptor_))));
+    }
     return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, &writer_version_,
                                   file_decryptor_);
   }
@@ -639,6 +795,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void set_file_path(const std::string& path) {
+    MaterializeRowGroups();
     for (format::RowGroup& row_group : metadata_->row_groups) {
       for (format::ColumnChunk& chunk : row_group.columns) {
         chunk.__set_file_path(path);
@@ -647,11 +804,13 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   format::RowGroup& row_group(int i) {
+    MaterializeRowGroups();
     DCHECK_LT(i, num_row_groups());
     return metadata_->row_groups[i];
   }
 
   void AppendRowGroups(const std::unique_ptr<FileMetaDataImpl>& other) {
+    MaterializeRowGroups();
     format::RowGroup other_rg;
     for (int i = 0; i < other->num_row_groups(); i++) {
       other_rg = other->row_group(i);
@@ -673,6 +832,70 @@ class FileMetaData::FileMetaDataImpl {
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
 
+  // Set if the row groups are deserialized lazily, in which case metadata_
+  // has none: the footer, as decrypted if need be, and the range of each row
+  // group in it
+  std::shared_ptr<Buffer> footer_;
+  std::vector<ThriftRange> row_group_ranges_;
+  // The row groups accessed so far
+  mutable std::mutex lazy_mutex_;
+  mutable std::vector<std::shared_ptr<LazyRowGroup>> lazy_row_groups_;
+
+  // Deserialize the footer but for its row groups, of which the ranges in a
+  // copy of the footer are kept instead
+  void DeserializeLazily(const uint8_t* metadata, uint32_t* metadata_len,
+                         const std::shared_ptr<Decryptor>& footer_decryptor) {
+    std::shared_ptr<Buffer> footer;
+    uint32_t footer_len = *metadata_len;
+    if (footer_decryptor != nullptr) {
+      footer = DecryptThriftMsg(metadata, metadata_len, footer_decryptor, &footer_len);
+      metadata = footer->data();
+    }
+    std::string stripped;
+    SplitThriftStructList(metadata, &footer_len, kFileMetaDataRowGroupsFieldId,
+                          &row_group_ranges_, &stripped);
+    if (footer == nullptr) {
+      *metadata_len = footer_len;
+      std::shared_ptr<ResizableBuffer> copy = AllocateBuffer(
+          ::arrow::default_memory_pool(), static_cast<int64_t>(footer_len));
+      std::memcpy(copy->mutable_data(), metadata, footer_len);
+      footer = std::move(copy);
+    }
+    uint32_t stripped_len = static_cast<uint32_t>(stripped.size());
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(stripped.data()),
+                         &stripped_len, metadata_.get());
+    footer_ = std::move(footer);
+    lazy_row_groups_.resize(row_group_ranges_.size());
+  }
+
+  std::shared_ptr<LazyRowGroup> GetLazyRowGroup(int i) const {
+    std::lock_guard<std::mutex> lock(lazy_mutex_);
+    if (lazy_row_groups_[i] == nullptr) {
+      lazy_row_groups_[i] = std::make_shared<LazyRowGroup>(footer_, row_group_ranges_[i]);
+    }
+    return lazy_row_groups_[i];
+  }
+
+  std::vector<format::RowGroup> MaterializedRowGroups() const {
+    std::vector<format::RowGroup> row_groups;
+    row_groups.reserve(row_group_ranges_.size());
+    for (int i = 0; i < num_row_groups(); ++i) {
+      row_groups.push_back(GetLazyRowGroup(i)->Materialize());
+    }
+    return row_groups;
+  }
+
+  // Deserialize the row groups not deserialized yet, before modifying them
+  void MaterializeRowGroups() {
+    if (footer_ == nullptr) {
+      return;
+    }
+    metadata_->row_groups = MaterializedRowGroups();
+    footer_.reset();
+    row_group_ranges_.clear();
+    lazy_row_groups_.clear();
+  }
+
   void InitSchema() {
     if (metadata_->schema.empty()) {
       throw ParquetException("Empty file schema (no root)");
@@ -719,10 +942,18 @@ std::shared_ptr<FileMetaData> FileMetaData::Make(
       new FileMetaData(metadata, metadata_len, file_decryptor));
 }
 
+std::shared_ptr<FileMetaData> FileMetaData::Make(
+    const void* metadata, uint32_t* metadata_len, const ReaderProperties& properties,
+    std::shared_ptr<InternalFileDecryptor> file_decryptor) {
+  return std::shared_ptr<FileMetaData>(new FileMetaData(
+      metadata, metadata_len, file_decryptor, properties.is_lazy_metadata_enabled()));
+}
+
 FileMetaData::FileMetaData(const void* metadata, uint32_t* metadata_len,
-                           std::shared_ptr<InternalFileDecryptor> file_decryptor)
+                           std::shared_ptr<InternalFileDecryptor> file_decryptor,
+                           bool lazy)
     : impl_{std::unique_ptr<FileMetaDataImpl>(
-          new FileMetaDataImpl(metadata, metadata_len, file_decryptor))} {}
+          new FileMetaDataImpl(metadata, metadata_len, file_decryptor, lazy))} {}
 
 FileMetaData::FileMetaData()
     : impl_{std::unique_ptr<FileMetaDataImpl>(new FileMetaDataImpl())} {}
@@ -1005,6 +1236,20 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(ToThrift(val));
   }
 
+  void set_bloom_filter_offset(int64_t offset) {
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+  }
+
+  void set_column_index_location(int64_t offset, int32_t length) {
+    column_chunk_->__set_column_index_offset(offset);
+    column_chunk_->__set_column_index_length(length);
+  }
+
+  void set_offset_index_location(int64_t offset, int32_t length) {
+    column_chunk_->__set_offset_index_offset(offset);
+    column_chunk_->__set_offset_index_length(length);
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -1130,6 +1375,8 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     return column_chunk_->meta_data.total_compressed_size;
   }
 
+  int64_t data_page_offset() const { return column_chunk_->meta_data.data_page_offset; }
+
  private:
   void Init(format::ColumnChunk* column_chunk) {
     column_chunk_ = column_chunk;
@@ -1204,10 +1451,28 @@ void ColumnChunkMetaDataBuilder::SetStatistics(const EncodedStatistics& result)
   impl_->SetStatistics(result);
 }
 
+void ColumnChunkMetaDataBuilder::set_bloom_filter_offset(int64_t offset) {
+  impl_->set_bloom_filter_offset(offset);
+}
+
+void ColumnChunkMetaDataBuilder::set_column_index_location(int64_t offset,
+                                                           int32_t length) {
+  impl_->set_column_index_location(offset, length);
+}
+
+void ColumnChunkMetaDataBuilder::set_offset_index_location(int64_t offset,
+                                                           int32_t length) {
+  impl_->set_offset_index_location(offset, length);
+}
+
 int64_t ColumnChunkMetaDataBuilder::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
 
+int64_t ColumnChunkMetaDataBuilder::data_page_offset() const {
+  return impl_->data_page_offset();
+}
+
 class RowGroupMetaDataBuilder::RowGroupMetaDataBuilderImpl {
  public:
   explicit RowGroupMetaDataBuilderImpl(std::shared_ptr<WriterProperties> props,
@@ -164,6 +164,14 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t data_page_offset() const;
   bool has_index_page() const;
   int64_t index_page_offset() const;
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
@@ -207,6 +215,10 @@ class PARQUET_EXPORT RowGroupMetaData {
   // PIMPL Idiom
   class RowGroupMetaDataImpl;
   std::unique_ptr<RowGroupMetaDataImpl> impl_;
+
+  // For the row groups of FileMetaData deserialized lazily
+  friend class FileMetaData;
+  explicit RowGroupMetaData(std::unique_ptr<RowGroupMetaDataImpl> impl);
 };
 
 class FileMetaDataBuilder;
@@ -219,6 +231,13 @@ class PARQUET_EXPORT FileMetaData {
       const void* serialized_metadata, uint32_t* inout_metadata_len,
       std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
 
+  /// \brief Deserialize the metadata lazily if enabled by the given properties
+  /// (see ReaderProperties::enable_lazy_metadata())
+  static std::shared_ptr<FileMetaData> Make(
+      const void* serialized_metadata, uint32_t* inout_metadata_len,
+      const ReaderProperties& properties,
+      std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
+
   ~FileMetaData();
 
   /// Verify signature of FileMetadata when file is encrypted but footer is not encrypted
@@ -269,7 +288,8 @@ class PARQUET_EXPORT FileMetaData {
   friend class SerializedFile;
 
   explicit FileMetaData(const void* serialized_metadata, uint32_t* metadata_len,
-                        std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
+                        std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR,
+                        bool lazy = false);
 
   void set_file_decryptor(std::shared_ptr<InternalFileDecryptor> file_decryptor);
 
@@ -319,10 +339,17 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // file offset of the serialized Bloom filter of the column chunk
+  void set_bloom_filter_offset(int64_t offset);
+  // file location of the serialized ColumnIndex and OffsetIndex of the column chunk
+  void set_column_index_location(int64_t offset, int32_t length);
+  void set_offset_index_location(int64_t offset, int32_t length);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
 
   int64_t total_compressed_size() const;
+  // file offset of the first data page, set by Finish()
+  int64_t data_page_offset() const;
   // commit the metadata
 
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
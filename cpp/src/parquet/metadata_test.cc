@@ -214,6 +214,91 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_EQ(3, f_accessor->num_schema_elements());
 }
 
+TEST(Metadata, TestLazyDeserialization) {
+  parquet::schema::NodeVector fields;
+  parquet::SchemaDescriptor schema;
+  std::shared_ptr<WriterProperties> props =
+      WriterProperties::Builder().version(ParquetVersion::PARQUET_2_0)->build();
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+
+  const int64_t nrows = 1000;
+  int32_t int_min = 100, int_max = 200;
+  EncodedStatistics stats_int;
+  stats_int.set_null_count(0)
+      .set_min(std::string(reinterpret_cast<const char*>(&int_min), 4))
+      .set_max(std::string(reinterpret_cast<const char*>(&int_max), 4));
+  EncodedStatistics stats_float;
+  float float_min = 100.100f, float_max = 200.200f;
+  stats_float.set_null_count(0)
+      .set_min(std::string(reinterpret_cast<const char*>(&float_min), 4))
+      .set_max(std::string(reinterpret_cast<const char*>(&float_max), 4));
+  auto f_accessor = GenerateTableMetaData(schema, props, nrows, stats_int, stats_float);
+  const std::string serialized = f_accessor->SerializeToString();
+
+  ReaderProperties lazy_properties;
+  lazy_properties.enable_lazy_metadata();
+  // Trailing bytes, such as those of a footer signature, are not consumed
+  const std::string with_trailer = serialized + std::string(28, '\xff');
+  uint32_t eager_len = static_cast<uint32_t>(with_trailer.size());
+  uint32_t lazy_len = eager_len;
+  auto eager = FileMetaData::Make(with_trailer.data(), &eager_len);
+  auto lazy = FileMetaData::Make(with_trailer.data(), &lazy_len, lazy_properties);
+  ASSERT_EQ(serialized.size(), eager_len);
+  ASSERT_EQ(serialized.size(), lazy_len);
+
+  ASSERT_EQ(nrows, lazy->num_rows());
+  ASSERT_EQ(2, lazy->num_row_groups());
+  ASSERT_EQ(2, lazy->num_columns());
+  ASSERT_EQ(3, lazy->num_schema_elements());
+  ASSERT_EQ(DEFAULT_CREATED_BY, lazy->created_by());
+  ASSERT_TRUE(lazy->schema()->Equals(*eager->schema()));
+
+  // Row groups and column chunks accessed out of order
+  for (int i : {1, 0}) {
+    auto eager_rg = eager->RowGroup(i);
+    auto lazy_rg = lazy->RowGroup(i);
+    ASSERT_EQ(eager_rg->num_columns(), lazy_rg->num_columns());
+    ASSERT_EQ(eager_rg->num_rows(), lazy_rg->num_rows());
+    ASSERT_EQ(eager_rg->total_byte_size(), lazy_rg->total_byte_size());
+    for (int j : {1, 0, 1}) {
+      auto eager_column = eager_rg->ColumnChunk(j);
+      auto lazy_column = lazy_rg->ColumnChunk(j);
+      ASSERT_TRUE(lazy_column->is_stats_set());
+      ASSERT_EQ(eager_column->statistics()->EncodeMin(),
+                lazy_column->statistics()->EncodeMin());
+      ASSERT_EQ(eager_column->statistics()->EncodeMax(),
+                lazy_column->statistics()->EncodeMax());
+      ASSERT_EQ(eager_column->num_values(), lazy_column->num_values());
+      ASSERT_EQ(eager_column->dictionary_page_offset(),
+                lazy_column->dictionary_page_offset());
+      ASSERT_EQ(eager_column->data_page_offset(), lazy_column->data_page_offset());
+      ASSERT_EQ(eager_column->encodings(), lazy_column->encodings());
+      ASSERT_EQ(eager_column->total_compressed_size(),
+                lazy_column->total_compressed_size());
+    }
+    ASSERT_THROW(lazy_rg->ColumnChunk(2), ParquetException);
+  }
+  ASSERT_THROW(lazy->RowGroup(2), ParquetException);
+
+  // Serializing deserializes the rest
+  ASSERT_EQ(serialized, lazy->SerializeToString());
+
+  lazy->set_file_path("/foo/bar/bar.parquet");
+  ASSERT_EQ("/foo/bar/bar.parquet", lazy->RowGroup(1)->ColumnChunk(0)->file_path());
+  lazy->AppendRowGroups(*eager);
+  ASSERT_EQ(4, lazy->num_row_groups());
+  ASSERT_EQ(nrows * 2, lazy->num_rows());
+  ASSERT_EQ(eager->RowGroup(1)->ColumnChunk(1)->data_page_offset(),
+            lazy->RowGroup(3)->ColumnChunk(1)->data_page_offset());
+
+  // A truncated footer is detected on opening
+  uint32_t truncated_len = static_cast<uint32_t>(serialized.size() / 2);
+  ASSERT_THROW(FileMetaData::Make(serialized.data(), &truncated_len, lazy_properties),
+               ParquetException);
+}
+
 TEST(Metadata, TestV1Version) {
   // PARQUET-839
   parquet::schema::NodeVector fields;
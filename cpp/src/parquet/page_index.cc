@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// OffsetIndex
+
+OffsetIndex::OffsetIndex(std::vector<PageLocation> page_locations)
+    : page_locations_(std::move(page_locations)) {}
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+
+  std::vector<PageLocation> page_locations;
+  page_locations.reserve(offset_index.page_locations.size());
+  for (const auto& location : offset_index.page_locations) {
+    if (location.offset < 0 || location.compressed_page_size < 0 ||
+        location.first_row_index < 0 ||
+        (!page_locations.empty() &&
+         location.first_row_index <= page_locations.back().first_row_index)) {
+      throw ParquetException("Invalid OffsetIndex page location");
+    }
+    page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(std::move(page_locations)));
+}
+
+int64_t OffsetIndex::page_num_rows(int i, int64_t row_group_num_rows) const {
+  DCHECK_LT(i, num_pages());
+  const int64_t next_first_row_index =
+      i + 1 < num_pages() ? page_locations_[i + 1].first_row_index : row_group_num_rows;
+  return next_first_row_index - page_locations_[i].first_row_index;
+}
+
+void OffsetIndex::WriteTo(ArrowOutputStream* sink) const {
+  format::OffsetIndex offset_index;
+  std::vector<format::PageLocation> page_locations(page_locations_.size());
+  for (size_t i = 0; i < page_locations_.size(); ++i) {
+    page_locations[i].__set_offset(page_locations_[i].offset);
+    page_locations[i].__set_compressed_page_size(
+        page_locations_[i].compressed_page_size);
+    page_locations[i].__set_first_row_index(page_locations_[i].first_row_index);
+  }
+  offset_index.__set_page_locations(page_locations);
+
+  ThriftSerializer serializer;
+  serializer.Serialize(&offset_index, sink);
+}
+
+// ----------------------------------------------------------------------
+// ColumnIndex
+
+ColumnIndex::ColumnIndex(const ColumnDescriptor* descr, std::vector<bool> null_pages,
+                         std::vector<std::string> encoded_min_values,
+                         std::vector<std::string> encoded_max_values,
+                         std::vector<int64_t> null_counts)
+    : descr_(descr),
+      null_pages_(std::move(null_pages)),
+      encoded_min_values_(std::move(encoded_min_values)),
+      encoded_max_values_(std::move(encoded_max_values)),
+      null_counts_(std::move(null_counts)) {
+  DCHECK_EQ(null_pages_.size(), encoded_min_values_.size());
+  DCHECK_EQ(null_pages_.size(), encoded_max_values_.size());
+  DCHECK(null_counts_.empty() || null_counts_.size() == null_pages_.size());
+}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+
+  const size_t num_pages = column_index.null_pages.size();
+  if (column_index.min_values.size() != num_pages ||
+      column_index.max_values.size() != num_pages ||
+      (column_index.__isset.null_counts &&
+       column_index.null_counts.size() != num_pages)) {
+    throw ParquetException("Invalid ColumnIndex: inconsistent number of pages");
+  }
+  std::vector<int64_t> null_counts;
+  if (column_index.__isset.null_counts) {
+    null_counts = std::move(column_index.null_counts);
+  }
+  return std::unique_ptr<ColumnIndex>(
+      new ColumnIndex(descr, std::move(column_index.null_pages),
+                      std::move(column_index.min_values),
+                      std::move(column_index.max_values), std::move(null_counts)));
+}
+
+std::shared_ptr<Statistics> ColumnIndex::page_statistics(int i, int64_t num_values,
+                                                         ::arrow::MemoryPool* pool) const {
+  DCHECK_LT(i, num_pages());
+  const int64_t null_count = has_null_counts() ? null_counts_[i]
+                             : null_pages_[i]  ? num_values
+                                               : 0;
+  return Statistics::Make(descr_, encoded_min_values_[i], encoded_max_values_[i],
+                          num_values - null_count, null_count, /*distinct_count=*/0,
+                          /*has_min_max=*/!null_pages_[i], pool);
+}
+
+void ColumnIndex::WriteTo(ArrowOutputStream* sink) const {
+  format::ColumnIndex column_index;
+  column_index.__set_null_pages(null_pages_);
+  column_index.__set_min_values(encoded_min_values_);
+  column_index.__set_max_values(encoded_max_values_);
+  column_index.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+  if (has_null_counts()) {
+    column_index.__set_null_counts(null_counts_);
+  }
+
+  ThriftSerializer serializer;
+  serializer.Serialize(&column_index, sink);
+}
+
+}  // namespace parquet
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class Statistics;
+
+/// \brief The location of a data page in a file
+struct PARQUET_EXPORT PageLocation {
+  /// The file offset of the page header
+  int64_t offset;
+  /// The size of the page header and of the compressed page
+  int32_t compressed_page_size;
+  /// The index of the first row of the page in its row group
+  int64_t first_row_index;
+};
+
+/// \brief The OffsetIndex of a column chunk: the location of each of its data
+/// pages, in file order.
+///
+/// With it, a reader can find the pages holding a given range of rows without
+/// reading the page headers of the column chunk.
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  explicit OffsetIndex(std::vector<PageLocation> page_locations);
+
+  /// \brief Deserialize an OffsetIndex written by WriteTo()
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  /// \brief The number of rows of the i-th page, given the number of rows of
+  /// the row group
+  int64_t page_num_rows(int i, int64_t row_group_num_rows) const;
+
+  void WriteTo(ArrowOutputStream* sink) const;
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+/// \brief The ColumnIndex of a column chunk: the min/max statistics of each of
+/// its data pages, in the same order as the OffsetIndex.
+///
+/// The bounds are plain-encoded like those of Statistics and compare in the
+/// sort order of the column.  Pages holding only nulls have no bounds.
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  ColumnIndex(const ColumnDescriptor* descr, std::vector<bool> null_pages,
+              std::vector<std::string> encoded_min_values,
+              std::vector<std::string> encoded_max_values,
+              std::vector<int64_t> null_counts);
+
+  /// \brief Deserialize the ColumnIndex of a column described by descr
+  static std::unique_ptr<ColumnIndex> Make(const ColumnDescriptor* descr,
+                                           const void* serialized_index,
+                                           uint32_t index_len);
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  /// \brief Whether each page holds only nulls
+  const std::vector<bool>& null_pages() const { return null_pages_; }
+
+  const std::vector<std::string>& encoded_min_values() const {
+    return encoded_min_values_;
+  }
+
+  const std::vector<std::string>& encoded_max_values() const {
+    return encoded_max_values_;
+  }
+
+  /// \brief Whether the number of nulls of each page is known
+  bool has_null_counts() const { return !null_counts_.empty(); }
+
+  const std::vector<int64_t>& null_counts() const { return null_counts_; }
+
+  /// \brief The decoded statistics of the i-th page
+  ///
+  /// \param[in] i the page
+  /// \param[in] num_values the number of values of the page, nulls included
+  std::shared_ptr<Statistics> page_statistics(
+      int i, int64_t num_values,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool()) const;
+
+  void WriteTo(ArrowOutputStream* sink) const;
+
+ private:
+  const ColumnDescriptor* descr_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> encoded_min_values_;
+  std::vector<std::string> encoded_max_values_;
+  std::vector<int64_t> null_counts_;
+};
+
+}  // namespace parquet
@@ -40,6 +40,8 @@ struct ParquetVersion {
 
 static int64_t DEFAULT_BUFFER_SIZE = 1024;
 static bool DEFAULT_USE_BUFFERED_STREAM = false;
+static int64_t DEFAULT_PAGE_BUFFER_LIMIT = 16 * 1024 * 1024;
+static bool DEFAULT_USE_LAZY_METADATA = false;
 
 class PARQUET_EXPORT ReaderProperties {
  public:
@@ -47,6 +49,8 @@ class PARQUET_EXPORT ReaderProperties {
       : pool_(pool) {
     buffered_stream_enabled_ = DEFAULT_USE_BUFFERED_STREAM;
     buffer_size_ = DEFAULT_BUFFER_SIZE;
+    page_buffer_limit_ = DEFAULT_PAGE_BUFFER_LIMIT;
+    lazy_metadata_enabled_ = DEFAULT_USE_LAZY_METADATA;
   }
 
   MemoryPool* memory_pool() const { return pool_; }
@@ -64,6 +68,25 @@ class PARQUET_EXPORT ReaderProperties {
 
   int64_t buffer_size() const { return buffer_size_; }
 
+  /// The column readers reuse their page decompression buffers from one page
+  /// to the next. A buffer that an unusually large page grew past this many
+  /// bytes is released again by the next page that fits in less.
+  void set_page_buffer_limit(int64_t limit) { page_buffer_limit_ = limit; }
+
+  int64_t page_buffer_limit() const { return page_buffer_limit_; }
+
+  /// Deserialize the metadata of the row groups and column chunks in the file
+  /// footer lazily.  When opening a file, the Thrift-encoded row groups are
+  /// skipped over rather than deserialized, and a row group and each of its
+  /// column chunks are only deserialized on first access.  This makes opening
+  /// a file with a wide schema much cheaper when only a few of its columns or
+  /// row groups are read.
+  bool is_lazy_metadata_enabled() const { return lazy_metadata_enabled_; }
+
+  void enable_lazy_metadata() { lazy_metadata_enabled_ = true; }
+
+  void disable_lazy_metadata() { lazy_metadata_enabled_ = false; }
+
   void file_decryption_properties(std::shared_ptr<FileDecryptionProperties> decryption) {
     file_decryption_properties_ = std::move(decryption);
   }
@@ -75,7 +98,9 @@ class PARQUET_EXPORT ReaderProperties {
  private:
   MemoryPool* pool_;
   int64_t buffer_size_;
+  int64_t page_buffer_limit_;
   bool buffered_stream_enabled_;
+  bool lazy_metadata_enabled_;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
 };
 
@@ -86,6 +111,7 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES = 128 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
@@ -93,6 +119,9 @@ static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.01;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
 
 class PARQUET_EXPORT ColumnProperties {
  public:
@@ -106,7 +135,10 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP),
+        page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -128,6 +160,18 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_fpp(double bloom_filter_fpp) {
+    bloom_filter_fpp_ = bloom_filter_fpp;
+  }
+
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -140,6 +184,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
+  bool page_index_enabled() const { return page_index_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -147,6 +197,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  double bloom_filter_fpp_;
+  bool page_index_enabled_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -158,6 +211,7 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES),
           pagesize_(kDefaultDataPageSize),
           version_(DEFAULT_WRITER_VERSION),
           created_by_(DEFAULT_CREATED_BY) {}
@@ -211,6 +265,13 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief The encoded size past which a row group buffered by the arrow
+    /// FileWriter::WriteRecordBatch is written out.
+    Builder* max_row_group_bytes(int64_t max_row_group_bytes) {
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     Builder* data_pagesize(int64_t pg_size) {
       pagesize_ = pg_size;
       return this;
@@ -230,7 +291,11 @@ class PARQUET_EXPORT WriterProperties {
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
      * This either apply if dictionary encoding is disabled or if we fallback
-     * as the dictionary grew too large.
+     * as the dictionary grew too large (Parquet 2.0 files only, Parquet 1.0
+     * files always fall back to PLAIN).
+     *
+     * DELTA_BINARY_PACKED applies to INT32 and INT64 columns, and
+     * DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY to BYTE_ARRAY columns.
      */
     Builder* encoding(Encoding::type encoding_type) {
       if (encoding_type == Encoding::PLAIN_DICTIONARY ||
@@ -246,7 +311,11 @@ class PARQUET_EXPORT WriterProperties {
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
      * This either apply if dictionary encoding is disabled or if we fallback
-     * as the dictionary grew too large.
+     * as the dictionary grew too large (Parquet 2.0 files only, Parquet 1.0
+     * files always fall back to PLAIN).
+     *
+     * DELTA_BINARY_PACKED applies to INT32 and INT64 columns, and
+     * DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY to BYTE_ARRAY columns.
      */
     Builder* encoding(const std::string& path, Encoding::type encoding_type) {
       if (encoding_type == Encoding::PLAIN_DICTIONARY ||
@@ -262,7 +331,11 @@ class PARQUET_EXPORT WriterProperties {
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
      * This either apply if dictionary encoding is disabled or if we fallback
-     * as the dictionary grew too large.
+     * as the dictionary grew too large (Parquet 2.0 files only, Parquet 1.0
+     * files always fall back to PLAIN).
+     *
+     * DELTA_BINARY_PACKED applies to INT32 and INT64 columns, and
+     * DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY to BYTE_ARRAY columns.
      */
     Builder* encoding(const std::shared_ptr<schema::ColumnPath>& path,
                       Encoding::type encoding_type) {
@@ -372,6 +445,93 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// \brief Write a Bloom filter of the values of each column chunk, for
+    /// every column.
+    ///
+    /// Bloom filters let readers skip row groups which cannot contain a
+    /// given value, which min/max statistics cannot do for high-cardinality
+    /// columns.  Each filter is sized for the number of distinct values of
+    /// its column chunk and the false positive probability set by
+    /// bloom_filter_fpp(); the hashes of the distinct values are kept in
+    /// memory until the row group is closed.
+    ///
+    /// Bloom filters are not written for BOOLEAN columns nor in encrypted
+    /// files.
+    Builder* enable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(true);
+      return this;
+    }
+
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(false);
+      return this;
+    }
+
+    /// \brief Write Bloom filters for the column described by path.
+    Builder* enable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_bloom_filter(path->ToDotString());
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// \brief Specify the false positive probability of Bloom filters, which
+    /// must be in (0, 1).  Default 0.01.
+    Builder* bloom_filter_fpp(double fpp) {
+      default_column_properties_.set_bloom_filter_fpp(fpp);
+      return this;
+    }
+
+    /// \brief Write the page index (ColumnIndex and OffsetIndex) of each
+    /// column chunk, for every column.
+    ///
+    /// The page index holds the min/max statistics and the file location of
+    /// every data page, which lets readers skip the pages of a column chunk
+    /// that a filter or a row range rules out instead of decoding the whole
+    /// chunk.
+    ///
+    /// The page index is not written for repeated columns nor in encrypted
+    /// files.
+    Builder* enable_write_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    /// \brief Write the page index of the column described by path.
+    Builder* enable_write_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_write_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_write_page_index(path->ToDotString());
+    }
+
+    Builder* disable_write_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_write_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_write_page_index(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -390,11 +550,16 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties));
+          max_row_group_bytes_, pagesize_, version_, created_by_,
+          std::move(file_encryption_properties_), default_column_properties_,
+          column_properties));
     }
 
    private:
@@ -402,6 +567,7 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_bytes_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     std::string created_by_;
@@ -415,6 +581,8 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -425,6 +593,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetVersion::type version() const { return parquet_version_; }
@@ -478,6 +648,18 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  double bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_fpp();
+  }
+
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -494,7 +676,8 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
+      int64_t max_row_group_length, int64_t max_row_group_bytes, int64_t pagesize,
+      ParquetVersion::type version,
       const std::string& created_by,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
@@ -503,6 +686,7 @@ class PARQUET_EXPORT WriterProperties {
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_bytes_(max_row_group_bytes),
         pagesize_(pagesize),
         parquet_version_(version),
         parquet_created_by_(created_by),
@@ -514,6 +698,7 @@ class PARQUET_EXPORT WriterProperties {
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_bytes_;
   int64_t pagesize_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
@@ -540,7 +725,11 @@ class PARQUET_EXPORT ArrowReaderProperties {
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
-        batch_size_(kArrowDefaultBatchSize) {}
+        read_dictionary_if_encoded_(false),
+        batch_size_(kArrowDefaultBatchSize),
+        pre_buffer_(false),
+        row_group_prefetch_depth_(0),
+        zero_copy_pages_(false) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
@@ -561,14 +750,67 @@ class PARQUET_EXPORT ArrowReaderProperties {
     }
   }
 
+  /// Read every BYTE_ARRAY, FIXED_LEN_BYTE_ARRAY, INT32 or INT64 column whose
+  /// column chunks are dictionary-encoded in all row groups, according to
+  /// their page encoding stats, directly as dictionary, in addition to the
+  /// columns set with set_read_dictionary.
+  void set_read_dictionary_if_encoded(bool read_dict) {
+    read_dictionary_if_encoded_ = read_dict;
+  }
+
+  bool read_dictionary_if_encoded() const { return read_dictionary_if_encoded_; }
+
   void set_batch_size(int64_t batch_size) { batch_size_ = batch_size; }
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// Enable read coalescing.
+  ///
+  /// When enabled, the Arrow reader will pre-buffer the column chunks of
+  /// the selected row groups and columns before decoding, issuing coalesced
+  /// reads in parallel (see ParquetFileReader::PreBuffer()).  This trades
+  /// memory for fewer, larger reads, which helps on high-latency
+  /// filesystems such as S3.  The reads are issued on the I/O thread pool
+  /// (see ::arrow::io::SetIOThreadPoolCapacity()), while decoding happens
+  /// on the CPU thread pool if use_threads() is true.
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
+  /// Set the number of row groups to fetch ahead when reading batches.
+  ///
+  /// When positive, the record batch readers of the Arrow reader pre-buffer
+  /// the selected column chunks of the next `depth` row groups while the
+  /// current one is decoded, rather than those of all row groups up front as
+  /// with pre_buffer(), and drop the buffers of a row group once all of its
+  /// column chunks are opened.  This overlaps I/O with decoding while bounding
+  /// memory to about depth + 1 row groups.  The reads are coalesced and issued
+  /// on the I/O thread pool as with pre_buffer().  When positive, it takes
+  /// precedence over pre_buffer() for record batch readers.
+  void set_row_group_prefetch_depth(int depth) { row_group_prefetch_depth_ = depth; }
+
+  int row_group_prefetch_depth() const { return row_group_prefetch_depth_; }
+
+  /// Let the arrays of required, non-nested integer, floating point and
+  /// timestamp columns reference the data pages they are read from rather than
+  /// copy their values, for the PLAIN-encoded pages of uncompressed and
+  /// unencrypted column chunks.  With a memory-mapped file or a BufferReader,
+  /// the data buffers are then slices of the file; pages whose values aren't
+  /// suitably aligned are still copied.  As each page becomes a separate
+  /// chunk, such columns may come out as several chunks per row group, and
+  /// record batches spanning several pages are concatenated.
+  void set_zero_copy_pages(bool zero_copy) { zero_copy_pages_ = zero_copy; }
+
+  bool zero_copy_pages() const { return zero_copy_pages_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
+  bool read_dictionary_if_encoded_;
   int64_t batch_size_;
+  bool pre_buffer_;
+  int row_group_prefetch_depth_;
+  bool zero_copy_pages_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -591,7 +833,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
           store_schema_(false),
           // TODO: At some point we should flip this.
           compliant_nested_types_(false),
-          engine_version_(V2) {}
+          engine_version_(V2),
+          use_threads_(kArrowDefaultUseThreads) {}
     virtual ~Builder() = default;
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -643,11 +886,21 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of a row group in
+    /// parallel on the CPU thread pool, then write them out in schema order.
+    ///
+    /// Each column chunk is buffered in memory until the row group is
+    /// complete.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
           truncated_timestamps_allowed_, store_schema_, compliant_nested_types_,
-          engine_version_));
+          engine_version_, use_threads_));
     }
 
    private:
@@ -660,6 +913,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool store_schema_;
     bool compliant_nested_types_;
     EngineVersion engine_version_;
+    bool use_threads_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -686,20 +940,24 @@ class PARQUET_EXPORT ArrowWriterProperties {
   /// place in case there are bugs detected in V2.
   EngineVersion engine_version() const { return engine_version_; }
 
+  /// \brief Whether the column chunks of a row group are written in parallel.
+  bool use_threads() const { return use_threads_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
                                  bool truncated_timestamps_allowed, bool store_schema,
                                  bool compliant_nested_types,
-                                 EngineVersion engine_version)
+                                 EngineVersion engine_version, bool use_threads)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
         store_schema_(store_schema),
         compliant_nested_types_(compliant_nested_types),
-        engine_version_(engine_version) {}
+        engine_version_(engine_version),
+        use_threads_(use_threads) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
@@ -708,6 +966,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
   const bool store_schema_;
   const bool compliant_nested_types_;
   const EngineVersion engine_version_;
+  const bool use_threads_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
@@ -717,7 +976,8 @@ struct ArrowWriteContext {
       : memory_pool(memory_pool),
         properties(properties),
         data_buffer(AllocateBuffer(memory_pool)),
-        def_levels_buffer(AllocateBuffer(memory_pool)) {}
+        def_levels_buffer(AllocateBuffer(memory_pool)),
+        rep_levels_buffer(AllocateBuffer(memory_pool)) {}
 
   template <typename T>
   ::arrow::Status GetScratchData(const int64_t num_values, T** out) {
@@ -735,6 +995,10 @@ struct ArrowWriteContext {
 
   // We use the shared ownership of this buffer
   std::shared_ptr<ResizableBuffer> def_levels_buffer;
+
+  // Reused across leaves and batches like def_levels_buffer, so that nested
+  // columns don't allocate and grow new repetition levels for every write
+  std::shared_ptr<ResizableBuffer> rep_levels_buffer;
 };
 
 PARQUET_EXPORT
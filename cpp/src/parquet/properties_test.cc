@@ -36,6 +36,7 @@ TEST(TestReaderProperties, Basics) {
 
   ASSERT_EQ(DEFAULT_BUFFER_SIZE, props.buffer_size());
   ASSERT_EQ(DEFAULT_USE_BUFFERED_STREAM, props.is_buffered_stream_enabled());
+  ASSERT_EQ(DEFAULT_PAGE_BUFFER_LIMIT, props.page_buffer_limit());
 }
 
 TEST(TestWriterProperties, Basics) {
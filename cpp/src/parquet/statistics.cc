@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <cstring>
 #include <limits>
@@ -25,6 +26,7 @@
 #include "arrow/array.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/optional.h"
@@ -174,10 +176,17 @@ struct BinaryLikeCompareHelperBase {
   static int value_length(int type_length, const FLBA& value) { return type_length; }
 
   static inline bool Compare(int type_length, const T& a, const T& b) {
+    const int a_length = value_length(type_length, a);
+    const int b_length = value_length(type_length, b);
+    if (!is_signed) {
+      // memcmp orders unsigned bytes lexicographically, and is vectorized
+      const int common_length = std::min(a_length, b_length);
+      const int cmp = common_length == 0 ? 0 : std::memcmp(a.ptr, b.ptr, common_length);
+      return cmp < 0 || (cmp == 0 && a_length < b_length);
+    }
     const auto* aptr = reinterpret_cast<const PtrType*>(a.ptr);
     const auto* bptr = reinterpret_cast<const PtrType*>(b.ptr);
-    return std::lexicographical_compare(aptr, aptr + value_length(type_length, a), bptr,
-                                        bptr + value_length(type_length, b));
+    return std::lexicographical_compare(aptr, aptr + a_length, bptr, bptr + b_length);
   }
 
   static T Min(int type_length, const T& a, const T& b) {
@@ -257,11 +266,151 @@ optional<std::pair<ByteArray, ByteArray>> CleanStatistic(
   return min_max;
 }
 
+// ----------------------------------------------------------------------
+// Vectorized min/max of numeric values
+
+// Unsigned integers are ordered as the signed integers of the same bits with
+// their sign bit flipped, which flipping it again gives back
+template <typename T, bool is_signed>
+struct SortKey {
+  static T Flip(T value) { return value; }
+};
+
+template <typename T>
+struct SortKey<T, false> {
+  using UCType = typename std::make_unsigned<T>::type;
+
+  static T Flip(T value) {
+    return static_cast<T>(static_cast<UCType>(value) ^
+                          (static_cast<UCType>(1) << (sizeof(T) * CHAR_BIT - 1)));
+  }
+};
+
+// Running min and max of numeric values, in lanes of independent accumulators
+// so that the loops over the values are vectorized.  NaNs are ignored, as
+// comparisons with them are false.
+template <typename T, bool is_signed>
+class NumericMinMax {
+ public:
+  // Independent accumulators, so that consecutive comparisons don't depend on
+  // each other and the inner loop maps onto vector min/max instructions
+  static constexpr int kLanes = 4;
+
+  NumericMinMax() {
+    std::fill(mins_, mins_ + kLanes, std::numeric_limits<T>::max());
+    std::fill(maxs_, maxs_ + kLanes, std::numeric_limits<T>::lowest());
+  }
+
+  void Update(const T* values, int64_t length) {
+    // Local accumulators, which the values can't alias
+    T mins[kLanes];
+    T maxs[kLanes];
+    std::copy(mins_, mins_ + kLanes, mins);
+    std::copy(maxs_, maxs_ + kLanes, maxs);
+    int64_t i = 0;
+    for (; i + kLanes <= length; i += kLanes) {
+      for (int j = 0; j < kLanes; ++j) {
+        const T value = Key::Flip(values[i + j]);
+        mins[j] = value < mins[j] ? value : mins[j];
+        maxs[j] = maxs[j] < value ? value : maxs[j];
+      }
+    }
+    for (; i < length; ++i) {
+      const T value = Key::Flip(values[i]);
+      mins[0] = value < mins[0] ? value : mins[0];
+      maxs[0] = maxs[0] < value ? value : maxs[0];
+    }
+    std::copy(mins, mins + kLanes, mins_);
+    std::copy(maxs, maxs + kLanes, maxs_);
+  }
+
+  // Update with those of the first length (at most 64) values whose bit is set
+  // in valid
+  void UpdateMasked(const T* values, uint64_t valid, int64_t length) {
+    T mins[kLanes];
+    T maxs[kLanes];
+    std::copy(mins_, mins_ + kLanes, mins);
+    std::copy(maxs_, maxs_ + kLanes, maxs);
+    int64_t i = 0;
+    for (; i + kLanes <= length; i += kLanes) {
+      for (int j = 0; j < kLanes; ++j) {
+        // Null slots are replaced with values which leave the min and max as is
+        const bool is_valid = (valid >> (i + j)) & 1;
+        const T value = Key::Flip(values[i + j]);
+        const T min_value = is_valid ? value : std::numeric_limits<T>::max();
+        const T max_value = is_valid ? value : std::numeric_limits<T>::lowest();
+        mins[j] = min_value < mins[j] ? min_value : mins[j];
+        maxs[j] = maxs[j] < max_value ? max_value : maxs[j];
+      }
+    }
+    for (; i < length; ++i) {
+      if ((valid >> i) & 1) {
+        const T value = Key::Flip(values[i]);
+        mins[0] = value < mins[0] ? value : mins[0];
+        maxs[0] = maxs[0] < value ? value : maxs[0];
+      }
+    }
+    std::copy(mins, mins + kLanes, mins_);
+    std::copy(maxs, maxs + kLanes, maxs_);
+  }
+
+  // The min and max, which are the extremes of T in reverse if all values were
+  // null or NaN, as for CompareHelper::DefaultMin() and DefaultMax()
+  std::pair<T, T> Finish() const {
+    T min = mins_[0];
+    T max = maxs_[0];
+    for (int j = 1; j < kLanes; ++j) {
+      min = mins_[j] < min ? mins_[j] : min;
+      max = max < maxs_[j] ? maxs_[j] : max;
+    }
+    return {Key::Flip(min), Key::Flip(max)};
+  }
+
+ private:
+  using Key = SortKey<T, is_signed>;
+
+  T mins_[kLanes];
+  T maxs_[kLanes];
+};
+
+template <typename T, bool is_signed>
+std::pair<T, T> GetNumericMinMax(const T* values, int64_t length) {
+  NumericMinMax<T, is_signed> min_max;
+  min_max.Update(values, length);
+  return min_max.Finish();
+}
+
+template <typename T, bool is_signed>
+std::pair<T, T> GetNumericMinMaxSpaced(const T* values, int64_t length,
+                                       const uint8_t* valid_bits,
+                                       int64_t valid_bits_offset) {
+  // The values are visited in blocks of 64, those of which all or none are
+  // valid being the most common
+  NumericMinMax<T, is_signed> min_max;
+  for (int64_t i = 0; i < length; i += 64) {
+    const int block_length = static_cast<int>(std::min<int64_t>(64, length - i));
+    const uint64_t valid = ::arrow::BitUtil::GetBitsAsWord(
+        valid_bits, valid_bits_offset + i, block_length);
+    const uint64_t all_valid = block_length == 64
+                                   ? ~static_cast<uint64_t>(0)
+                                   : (static_cast<uint64_t>(1) << block_length) - 1;
+    if (valid == all_valid) {
+      min_max.Update(values + i, block_length);
+    } else if (valid != 0) {
+      min_max.UpdateMasked(values + i, valid, block_length);
+    }
+  }
+  return min_max.Finish();
+}
+
 template <bool is_signed, typename DType>
 class TypedComparatorImpl : virtual public TypedComparator<DType> {
  public:
   using T = typename DType::c_type;
   using Helper = CompareHelper<DType, is_signed>;
+  // Whether the values are numbers, of which the min and max are vectorized
+  using IsNumeric = std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                                     !std::is_same<T, bool>::value>;
 
   explicit TypedComparatorImpl(int type_length = -1) : type_length_(type_length) {}
 
@@ -273,7 +422,31 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
 
   std::pair<T, T> GetMinMax(const T* values, int64_t length) override {
     DCHECK_GT(length, 0);
+    return GetMinMax(values, length, IsNumeric());
+  }
+
+  std::pair<T, T> GetMinMaxSpaced(const T* values, int64_t length,
+                                  const uint8_t* valid_bits,
+                                  int64_t valid_bits_offset) override {
+    DCHECK_GT(length, 0);
+    return GetMinMaxSpaced(values, length, valid_bits, valid_bits_offset, IsNumeric());
+  }
 
+  std::pair<T, T> GetMinMax(const ::arrow::Array& values) override;
+
+ private:
+  std::pair<T, T> GetMinMax(const T* values, int64_t length, std::true_type) {
+    return GetNumericMinMax<T, is_signed>(values, length);
+  }
+
+  std::pair<T, T> GetMinMaxSpaced(const T* values, int64_t length,
+                                  const uint8_t* valid_bits, int64_t valid_bits_offset,
+                                  std::true_type) {
+    return GetNumericMinMaxSpaced<T, is_signed>(values, length, valid_bits,
+                                                valid_bits_offset);
+  }
+
+  std::pair<T, T> GetMinMax(const T* values, int64_t length, std::false_type) {
     T min = Helper::DefaultMin();
     T max = Helper::DefaultMax();
 
@@ -287,10 +460,8 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
   }
 
   std::pair<T, T> GetMinMaxSpaced(const T* values, int64_t length,
-                                  const uint8_t* valid_bits,
-                                  int64_t valid_bits_offset) override {
-    DCHECK_GT(length, 0);
-
+                                  const uint8_t* valid_bits, int64_t valid_bits_offset,
+                                  std::false_type) {
     T min = Helper::DefaultMin();
     T max = Helper::DefaultMax();
 
@@ -306,9 +477,6 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
     return {min, max};
   }
 
-  std::pair<T, T> GetMinMax(const ::arrow::Array& values) override;
-
- private:
   int type_length_;
 };
 
@@ -24,9 +24,12 @@
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/bit_util.h"
 
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
@@ -247,6 +250,140 @@ TEST(Comparison, UnknownSortOrder) {
   ASSERT_THROW(Comparator::Make(&descr), ParquetException);
 }
 
+// The min and max of the values whose bit is set, found with Compare()
+template <typename DType>
+std::pair<typename DType::c_type, typename DType::c_type> NaiveMinMax(
+    TypedComparator<DType>* comparator, const std::vector<typename DType::c_type>& values,
+    const std::vector<bool>& is_valid) {
+  using T = typename DType::c_type;
+  bool found = false;
+  T min{}, max{};
+  for (size_t i = 0; i < values.size(); ++i) {
+    const T value = values[i];
+    if (!is_valid[i] || value != value) {
+      continue;
+    }
+    if (!found || comparator->Compare(value, min)) {
+      min = value;
+    }
+    if (!found || comparator->Compare(max, value)) {
+      max = value;
+    }
+    found = true;
+  }
+  return {min, max};
+}
+
+template <typename DType>
+void CheckNumericMinMax(TypedComparator<DType>* comparator,
+                        std::vector<typename DType::c_type> values) {
+  using T = typename DType::c_type;
+  const int64_t length = static_cast<int64_t>(values.size());
+
+  const std::vector<bool> all_valid(values.size(), true);
+  auto expected = NaiveMinMax(comparator, values, all_valid);
+  auto actual = comparator->GetMinMax(values.data(), length);
+  ASSERT_EQ(expected.first, actual.first);
+  ASSERT_EQ(expected.second, actual.second);
+
+  // Nulls at a bit offset, in blocks of 64 values with all, some and none valid
+  for (int64_t offset : {0, 3, 67}) {
+    SCOPED_TRACE(::testing::Message() << "offset " << offset);
+    std::vector<uint8_t> valid_bits(
+        static_cast<size_t>(::arrow::BitUtil::BytesForBits(offset + length)), 0);
+    std::vector<bool> is_valid(values.size());
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t block = i / 64;
+      is_valid[i] = block % 3 == 0 || (block % 3 == 1 && (i * 7) % 5 < 2) || i == 0;
+      if (is_valid[i]) {
+        ::arrow::BitUtil::SetBit(valid_bits.data(), offset + i);
+      } else {
+        // Null slots may hold anything
+        values[i] = std::numeric_limits<T>::lowest();
+      }
+    }
+    expected = NaiveMinMax(comparator, values, is_valid);
+    actual =
+        comparator->GetMinMaxSpaced(values.data(), length, valid_bits.data(), offset);
+    ASSERT_EQ(expected.first, actual.first);
+    ASSERT_EQ(expected.second, actual.second);
+  }
+}
+
+template <typename DType>
+void CheckNumericMinMax(const ColumnDescriptor* descr) {
+  using T = typename DType::c_type;
+  auto comparator = MakeComparator<DType>(descr);
+  for (int length : {1, 3, 63, 64, 65, 200, 1000}) {
+    SCOPED_TRACE(::testing::Message() << "length " << length);
+    std::vector<T> values(length);
+    random_numbers(length, length, std::numeric_limits<T>::lowest() / 2,
+                   std::numeric_limits<T>::max() / 2, values.data());
+    // Values of the opposite sign for unsigned sort orders
+    values[length / 2] = std::numeric_limits<T>::lowest();
+    values[length - 1] = static_cast<T>(-1);
+    CheckNumericMinMax(comparator.get(), values);
+  }
+}
+
+TEST(Comparison, NumericMinMax) {
+  ColumnDescriptor int32(
+      PrimitiveNode::Make("int32", Repetition::OPTIONAL, Type::INT32), 1, 0);
+  ColumnDescriptor uint32(PrimitiveNode::Make("uint32", Repetition::OPTIONAL,
+                                              Type::INT32, ConvertedType::UINT_32),
+                          1, 0);
+  ColumnDescriptor int64(
+      PrimitiveNode::Make("int64", Repetition::OPTIONAL, Type::INT64), 1, 0);
+  ColumnDescriptor uint64(PrimitiveNode::Make("uint64", Repetition::OPTIONAL,
+                                              Type::INT64, ConvertedType::UINT_64),
+                          1, 0);
+  ColumnDescriptor float_descr(
+      PrimitiveNode::Make("float", Repetition::OPTIONAL, Type::FLOAT), 1, 0);
+  ColumnDescriptor double_descr(
+      PrimitiveNode::Make("double", Repetition::OPTIONAL, Type::DOUBLE), 1, 0);
+
+  CheckNumericMinMax<Int32Type>(&int32);
+  CheckNumericMinMax<Int32Type>(&uint32);
+  CheckNumericMinMax<Int64Type>(&int64);
+  CheckNumericMinMax<Int64Type>(&uint64);
+  CheckNumericMinMax<FloatType>(&float_descr);
+  CheckNumericMinMax<DoubleType>(&double_descr);
+}
+
+TEST(Comparison, NumericMinMaxIgnoresNaN) {
+  ColumnDescriptor descr(
+      PrimitiveNode::Make("double", Repetition::OPTIONAL, Type::DOUBLE), 1, 0);
+  auto comparator = MakeComparator<DoubleType>(&descr);
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  std::vector<double> values(100, nan);
+  values[0] = 5;
+  values[37] = -2;
+  values[99] = 8;
+  CheckNumericMinMax(comparator.get(), values);
+  auto min_max = comparator->GetMinMax(values.data(), 100);
+  ASSERT_EQ(-2, min_max.first);
+  ASSERT_EQ(8, min_max.second);
+}
+
+TEST(Comparison, UnsignedByteArrayMinMax) {
+  auto comparator = MakeComparator<ByteArrayType>(Type::BYTE_ARRAY, SortOrder::UNSIGNED);
+  const std::vector<std::string> strings = {"abc", "ab", "", u8"ü", "abcd", "b"};
+  std::vector<ByteArray> values;
+  for (const auto& s : strings) {
+    values.push_back(ByteArrayFromString(s));
+  }
+  auto min_max =
+      comparator->GetMinMax(values.data(), static_cast<int64_t>(values.size()));
+  ASSERT_EQ("", std::string(reinterpret_cast<const char*>(min_max.first.ptr),
+                            min_max.first.len));
+  ASSERT_EQ(u8"ü", std::string(reinterpret_cast<const char*>(min_max.second.ptr),
+                                   min_max.second.len));
+  ASSERT_TRUE(comparator->Compare(values[1], values[0]));
+  ASSERT_FALSE(comparator->Compare(values[0], values[1]));
+  ASSERT_FALSE(comparator->Compare(values[0], values[0]));
+}
+
 // ----------------------------------------------------------------------
 
 template <typename TestType>
@@ -17,12 +17,13 @@
 
 #include "parquet/stream_reader.h"
 
+#include <algorithm>
 #include <set>
 #include <utility>
 
 namespace parquet {
 
-constexpr int64_t StreamReader::kBatchSizeOne;
+constexpr int64_t StreamReader::kReadBatchSize;
 
 // The converted type expected by the stream reader does not always
 // exactly match with the schema in the Parquet file.  The following
@@ -284,66 +285,42 @@ void StreamReader::ReadFixedLength(char* ptr, int len) {
 
 void StreamReader::Read(ByteArray* v) {
   const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  auto value = NextValue<ByteArrayReader>();
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read != 1) {
+  if (value == nullptr) {
     ThrowReadFailedException(node);
   }
+  *v = *value;
 }
 
 bool StreamReader::ReadOptional(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  auto value = NextValue<ByteArrayReader>();
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  if (value == nullptr) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = *value;
+  return true;
 }
 
 void StreamReader::Read(FixedLenByteArray* v) {
   const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+  auto value = NextValue<FixedLenByteArrayReader>();
 
-  if (values_read != 1) {
+  if (value == nullptr) {
     ThrowReadFailedException(node);
   }
+  *v = *value;
 }
 
 bool StreamReader::ReadOptional(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+  auto value = NextValue<FixedLenByteArrayReader>();
 
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  if (value == nullptr) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = *value;
+  return true;
 }
 
 void StreamReader::EndRow() {
@@ -357,11 +334,16 @@ void StreamReader::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (!column_readers_[0]->HasNext()) {
+  if (!HasRowsInRowGroup()) {
     NextRowGroup();
   }
 }
 
+bool StreamReader::HasRowsInRowGroup() const {
+  const auto& buffer = column_buffers_[0];
+  return buffer.level_position < buffer.num_levels || column_readers_[0]->HasNext();
+}
+
 void StreamReader::NextRowGroup() {
   // Find next none-empty row group
   while (row_group_index_ < file_metadata_->num_row_groups()) {
@@ -369,9 +351,16 @@ void StreamReader::NextRowGroup() {
     ++row_group_index_;
 
     column_readers_.resize(file_metadata_->num_columns());
+    column_buffers_.resize(file_metadata_->num_columns());
 
     for (int i = 0; i < file_metadata_->num_columns(); ++i) {
       column_readers_[i] = row_group_reader_->Column(i);
+
+      auto& buffer = column_buffers_[i];
+      buffer.def_levels.resize(kReadBatchSize);
+      buffer.num_levels = 0;
+      buffer.level_position = 0;
+      buffer.value_position = 0;
     }
     if (column_readers_[0]->HasNext()) {
       row_group_row_offset_ = current_row_;
@@ -389,6 +378,7 @@ void StreamReader::SetEof() {
   file_reader_.reset();
   row_group_reader_.reset();
   column_readers_.clear();
+  column_buffers_.clear();
   nodes_.clear();
 }
 
@@ -404,8 +394,8 @@ int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
         num_rows_in_row_group - current_row_ - row_group_row_offset_;
 
     if (num_rows_remaining_in_row_group > num_rows_remaining_to_skip) {
-      for (auto reader : column_readers_) {
-        SkipRowsInColumn(reader.get(), num_rows_remaining_to_skip);
+      for (int i = 0; i < static_cast<int>(column_readers_.size()); ++i) {
+        SkipRowsInColumn(i, num_rows_remaining_to_skip);
       }
       current_row_ += num_rows_remaining_to_skip;
       num_rows_remaining_to_skip = 0;
@@ -425,16 +415,36 @@ int64_t StreamReader::SkipColumns(int64_t num_columns_to_skip) {
     for (; (num_columns_to_skip > num_columns_skipped) &&
            static_cast<std::size_t>(column_index_) < nodes_.size();
          ++column_index_) {
-      SkipRowsInColumn(column_readers_[column_index_].get(), 1);
+      SkipRowsInColumn(column_index_, 1);
       ++num_columns_skipped;
     }
   }
   return num_columns_skipped;
 }
 
-void StreamReader::SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip) {
-  int64_t num_skipped = 0;
+void StreamReader::SkipRowsInColumn(int column_index, int64_t num_rows_to_skip) {
+  auto& buffer = column_buffers_[column_index];
+  auto reader = column_readers_[column_index].get();
+
+  // Skip the rows already read ahead before skipping in the reader.
+  int64_t num_skipped =
+      std::min(num_rows_to_skip, buffer.num_levels - buffer.level_position);
+
+  if (nodes_[column_index]->is_optional()) {
+    for (int64_t i = 0; i < num_skipped; ++i) {
+      if (buffer.def_levels[buffer.level_position + i] != 0) {
+        ++buffer.value_position;
+      }
+    }
+  } else {
+    buffer.value_position += num_skipped;
+  }
+  buffer.level_position += num_skipped;
+  num_rows_to_skip -= num_skipped;
 
+  if (num_rows_to_skip == 0) {
+    return;
+  }
   switch (reader->type()) {
     case Type::BOOLEAN:
       num_skipped = static_cast<BoolReader*>(reader)->Skip(num_rows_to_skip);
@@ -53,6 +53,9 @@ namespace parquet {
 /// However, if the value is not present then a ParquetException will
 /// be raised.
 ///
+/// Levels and values are read ahead from the column readers in
+/// batches of kReadBatchSize and returned one at a time.
+///
 /// Currently there is no support for repeated fields.
 ///
 class PARQUET_EXPORT StreamReader {
@@ -205,56 +208,70 @@ class PARQUET_EXPORT StreamReader {
   [[noreturn]] void ThrowReadFailedException(
       const std::shared_ptr<schema::PrimitiveNode>& node);
 
-  template <typename ReaderType, typename T>
-  void Read(T* v) {
+  /// \brief Return the next value of the current column and advance
+  /// to the next column, or return nullptr if the value is null.
+  /// The returned pointer is valid until the column is read again.
+  template <typename ReaderType>
+  const typename ReaderType::T* NextValue() {
+    using ValueType = typename ReaderType::T;
+    auto& buffer = column_buffers_[column_index_];
     const auto& node = nodes_[column_index_];
     auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    int64_t values_read;
 
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+    if (buffer.level_position == buffer.num_levels) {
+      int64_t values_read;
+
+      buffer.values.resize(kReadBatchSize * sizeof(ValueType));
+      buffer.num_levels = reader->ReadBatch(
+          kReadBatchSize, buffer.def_levels.data(), nullptr,
+          reinterpret_cast<ValueType*>(buffer.values.data()), &values_read);
+      buffer.level_position = 0;
+      buffer.value_position = 0;
+
+      if (buffer.num_levels == 0) {
+        ThrowReadFailedException(node);
+      }
+    }
+    if (node->is_optional() && buffer.def_levels[buffer.level_position++] == 0) {
+      return NULLPTR;
+    }
+    if (node->is_required()) {
+      ++buffer.level_position;
+    }
+    return reinterpret_cast<const ValueType*>(buffer.values.data()) +
+           buffer.value_position++;
+  }
+
+  template <typename ReaderType, typename T>
+  void Read(T* v) {
+    const auto& node = nodes_[column_index_];
+    auto value = NextValue<ReaderType>();
 
-    if (values_read != 1) {
+    if (value == NULLPTR) {
       ThrowReadFailedException(node);
     }
+    *v = *value;
   }
 
   template <typename ReaderType, typename ReadType, typename T>
   void Read(T* v) {
     const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
+    auto value = NextValue<ReaderType>();
 
-    if (values_read == 1) {
-      *v = tmp;
-    } else {
+    if (value == NULLPTR) {
       ThrowReadFailedException(node);
     }
+    *v = static_cast<ReadType>(*value);
   }
 
   template <typename ReaderType, typename ReadType = typename ReaderType::T, typename T>
   void ReadOptional(optional<T>* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
+    auto value = NextValue<ReaderType>();
 
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
-
-    if (values_read == 1) {
-      *v = T(tmp);
-    } else if ((values_read == 0) && (def_level == 0)) {
-      v->reset();
+    if (value != NULLPTR) {
+      *v = T(static_cast<ReadType>(*value));
     } else {
-      ThrowReadFailedException(node);
+      v->reset();
     }
   }
 
@@ -273,16 +290,30 @@ class PARQUET_EXPORT StreamReader {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = 0);
 
-  void SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip);
+  void SkipRowsInColumn(int column_index, int64_t num_rows_to_skip);
+
+  bool HasRowsInRowGroup() const;
 
   void SetEof();
 
  private:
+  // Levels and values read ahead from a column reader.  Only the
+  // non-null values are stored, so value_position trails
+  // level_position for optional columns.
+  struct ColumnBuffer {
+    std::vector<int16_t> def_levels;
+    std::vector<uint8_t> values;
+    int64_t num_levels{0};
+    int64_t level_position{0};
+    int64_t value_position{0};
+  };
+
   std::unique_ptr<ParquetFileReader> file_reader_;
   std::shared_ptr<FileMetaData> file_metadata_;
   std::shared_ptr<RowGroupReader> row_group_reader_;
   std::vector<std::shared_ptr<ColumnReader>> column_readers_;
   std::vector<std::shared_ptr<schema::PrimitiveNode>> nodes_;
+  std::vector<ColumnBuffer> column_buffers_;
 
   bool eof_{true};
   int row_group_index_{0};
@@ -290,7 +321,7 @@ class PARQUET_EXPORT StreamReader {
   int64_t current_row_{0};
   int64_t row_group_row_offset_{0};
 
-  static constexpr int64_t kBatchSizeOne = 1;
+  static constexpr int64_t kReadBatchSize = 1024;
 };  // namespace parquet
 
 PARQUET_EXPORT
@@ -583,6 +583,75 @@ TEST_F(TestStreamReader, SkipColumns) {
   EXPECT_EQ(0, reader_.SkipColumns(100));
 }
 
+TEST(TestStreamBatching, RoundTripAcrossBatches) {
+  schema::NodeVector fields;
+
+  fields.push_back(schema::PrimitiveNode::Make("int32_field", Repetition::OPTIONAL,
+                                               Type::INT32, ConvertedType::INT_32));
+
+  fields.push_back(schema::PrimitiveNode::Make("string_field", Repetition::OPTIONAL,
+                                               Type::BYTE_ARRAY, ConvertedType::UTF8));
+
+  fields.push_back(schema::PrimitiveNode::Make("char[4]_field", Repetition::REQUIRED,
+                                               Type::FIXED_LEN_BYTE_ARRAY,
+                                               ConvertedType::NONE, 4));
+
+  auto schema = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  // A write batch size which does not divide the row group sizes, so
+  // rows are still buffered when each row group ends.
+  auto properties = WriterProperties::Builder().write_batch_size(7)->build();
+  const int num_rows_in_first_row_group = 1001;
+
+  PARQUET_ASSIGN_OR_THROW(auto sink, arrow::io::BufferOutputStream::Create());
+  {
+    StreamWriter os{ParquetFileWriter::Open(sink, schema, properties)};
+    os.SetMaxRowGroupSize(0);
+
+    for (int i = 0; i < TestData::num_rows; ++i) {
+      if (i == num_rows_in_first_row_group) {
+        os << EndRowGroup;
+      }
+      os << TestData::GetOptInt32(i) << TestData::GetOptString(i)
+         << TestData::GetCharArray(i) << EndRow;
+    }
+  }
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<arrow::io::BufferReader>(buffer));
+  ASSERT_EQ(2, file_reader->metadata()->num_row_groups());
+  ASSERT_EQ(num_rows_in_first_row_group,
+            file_reader->metadata()->RowGroup(0)->num_rows());
+
+  StreamReader is{std::move(file_reader)};
+  optional<int32_t> int32;
+  optional<std::string> str;
+  std::array<char, 4> char_array;
+
+  // Skip over part of the rows read ahead as well as rows not yet read.
+  int i = 0;
+  for (; i < 100; ++i) {
+    is >> int32 >> str >> char_array >> EndRow;
+    EXPECT_EQ(int32, TestData::GetOptInt32(i)) << "index: " << i;
+  }
+  EXPECT_EQ(1, is.SkipColumns(1));
+  is >> str >> char_array >> EndRow;
+  EXPECT_EQ(str, TestData::GetOptString(i)) << "index: " << i;
+  EXPECT_EQ(500, is.SkipRows(500));
+  i += 501;
+
+  for (; !is.eof(); ++i) {
+    EXPECT_EQ(i, is.current_row());
+    is >> int32 >> str >> char_array >> EndRow;
+    EXPECT_EQ(int32, TestData::GetOptInt32(i)) << "index: " << i;
+    EXPECT_EQ(str, TestData::GetOptString(i)) << "index: " << i;
+    EXPECT_EQ(char_array, TestData::GetCharArray(i)) << "index: " << i;
+  }
+  EXPECT_EQ(TestData::num_rows, i);
+}
+
 class TestOptionalFields : public ::testing::Test {
  public:
   TestOptionalFields() { createTestFile(); }
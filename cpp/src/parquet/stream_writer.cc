@@ -17,6 +17,7 @@
 
 #include "parquet/stream_writer.h"
 
+#include <exception>
 #include <utility>
 
 namespace parquet {
@@ -25,8 +26,20 @@ int64_t StreamWriter::default_row_group_size_{512 * 1024 * 1024};  // 512MB
 
 constexpr int16_t StreamWriter::kDefLevelZero;
 constexpr int16_t StreamWriter::kDefLevelOne;
-constexpr int16_t StreamWriter::kRepLevelZero;
-constexpr int64_t StreamWriter::kBatchSizeOne;
+
+namespace {
+
+// Returns the estimated size of the values buffered by the writer.
+template <typename WriterType>
+int64_t WriteFixedWidthValues(ColumnWriter* writer, int64_t num_levels,
+                              const int16_t* def_levels, const uint8_t* values) {
+  auto typed_writer = static_cast<WriterType*>(writer);
+  typed_writer->WriteBatch(num_levels, def_levels, nullptr,
+                           reinterpret_cast<const typename WriterType::T*>(values));
+  return typed_writer->EstimatedBufferedValueBytes();
+}
+
+}  // namespace
 
 StreamWriter::FixedStringView::FixedStringView(const char* data_ptr)
     : data{data_ptr}, size{std::strlen(data_ptr)} {}
@@ -40,13 +53,48 @@ StreamWriter::StreamWriter(std::unique_ptr<ParquetFileWriter> writer)
   auto schema = file_writer_->schema();
   auto group_node = schema->group_node();
 
+  write_batch_size_ = file_writer_->properties()->write_batch_size();
   nodes_.resize(schema->num_columns());
+  column_buffers_.resize(schema->num_columns());
 
   for (auto i = 0; i < schema->num_columns(); ++i) {
     nodes_[i] = std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(i));
   }
 }
 
+StreamWriter::~StreamWriter() {
+  // The file is closed by the ParquetFileWriter destructor, which
+  // also has no way to report a failure.
+  if (file_writer_) {
+    try {
+      WriteBufferedRows();
+    } catch (const std::exception&) {
+    }
+  }
+}
+
+StreamWriter& StreamWriter::operator=(StreamWriter&& other) {
+  if (this != &other) {
+    // The rows buffered here must be written before the file writer is
+    // replaced and closed.
+    if (file_writer_) {
+      WriteBufferedRows();
+    }
+    column_index_ = other.column_index_;
+    current_row_ = other.current_row_;
+    row_group_size_ = other.row_group_size_;
+    max_row_group_size_ = other.max_row_group_size_;
+    buffered_rows_ = other.buffered_rows_;
+    buffered_bytes_ = other.buffered_bytes_;
+    write_batch_size_ = other.write_batch_size_;
+    file_writer_ = std::move(other.file_writer_);
+    row_group_writer_ = std::move(other.row_group_writer_);
+    nodes_ = std::move(other.nodes_);
+    column_buffers_ = std::move(other.column_buffers_);
+  }
+  return *this;
+}
+
 void StreamWriter::SetDefaultMaxRowGroupSize(int64_t max_size) {
   default_row_group_size_ = max_size;
 }
@@ -59,67 +107,67 @@ int StreamWriter::num_columns() const { return static_cast<int>(nodes_.size());
 
 StreamWriter& StreamWriter::operator<<(bool v) {
   CheckColumn(Type::BOOLEAN, ConvertedType::NONE);
-  return Write<BoolWriter>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(int8_t v) {
   CheckColumn(Type::INT32, ConvertedType::INT_8);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(uint8_t v) {
   CheckColumn(Type::INT32, ConvertedType::UINT_8);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(int16_t v) {
   CheckColumn(Type::INT32, ConvertedType::INT_16);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(uint16_t v) {
   CheckColumn(Type::INT32, ConvertedType::UINT_16);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(int32_t v) {
   CheckColumn(Type::INT32, ConvertedType::INT_32);
-  return Write<Int32Writer>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(uint32_t v) {
   CheckColumn(Type::INT32, ConvertedType::UINT_32);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(int64_t v) {
   CheckColumn(Type::INT64, ConvertedType::INT_64);
-  return Write<Int64Writer>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(uint64_t v) {
   CheckColumn(Type::INT64, ConvertedType::UINT_64);
-  return Write<Int64Writer>(static_cast<int64_t>(v));
+  return Write(static_cast<int64_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(const std::chrono::milliseconds& v) {
   CheckColumn(Type::INT64, ConvertedType::TIMESTAMP_MILLIS);
-  return Write<Int64Writer>(static_cast<int64_t>(v.count()));
+  return Write(static_cast<int64_t>(v.count()));
 }
 
 StreamWriter& StreamWriter::operator<<(const std::chrono::microseconds& v) {
   CheckColumn(Type::INT64, ConvertedType::TIMESTAMP_MICROS);
-  return Write<Int64Writer>(static_cast<int64_t>(v.count()));
+  return Write(static_cast<int64_t>(v.count()));
 }
 
 StreamWriter& StreamWriter::operator<<(float v) {
   CheckColumn(Type::FLOAT, ConvertedType::NONE);
-  return Write<FloatWriter>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(double v) {
   CheckColumn(Type::DOUBLE, ConvertedType::NONE);
-  return Write<DoubleWriter>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(char v) { return WriteFixedLength(&v, 1); }
@@ -144,21 +192,16 @@ StreamWriter& StreamWriter::WriteVariableLength(const char* data_ptr,
                                                 std::size_t data_len) {
   CheckColumn(Type::BYTE_ARRAY, ConvertedType::UTF8);
 
-  auto writer = static_cast<ByteArrayWriter*>(row_group_writer_->column(column_index_++));
-
-  if (data_ptr != nullptr) {
-    ByteArray ba_value;
-
-    ba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-    ba_value.len = static_cast<uint32_t>(data_len);
-
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &ba_value);
-  } else {
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-  }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->EstimatedBufferedValueBytes();
+  if (data_ptr == nullptr) {
+    WriteNullValue();
+    return *this;
   }
+  auto& buffer = column_buffers_[column_index_++];
+
+  buffer.def_levels.push_back(kDefLevelOne);
+  buffer.values.insert(buffer.values.end(), data_ptr, data_ptr + data_len);
+  buffer.lengths.push_back(static_cast<uint32_t>(data_len));
+  buffered_bytes_ += static_cast<int64_t>(data_len);
   return *this;
 }
 
@@ -166,20 +209,15 @@ StreamWriter& StreamWriter::WriteFixedLength(const char* data_ptr, std::size_t d
   CheckColumn(Type::FIXED_LEN_BYTE_ARRAY, ConvertedType::NONE,
               static_cast<int>(data_len));
 
-  auto writer =
-      static_cast<FixedLenByteArrayWriter*>(row_group_writer_->column(column_index_++));
-
-  if (data_ptr != nullptr) {
-    FixedLenByteArray flba_value;
-
-    flba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &flba_value);
-  } else {
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-  }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->EstimatedBufferedValueBytes();
+  if (data_ptr == nullptr) {
+    WriteNullValue();
+    return *this;
   }
+  auto& buffer = column_buffers_[column_index_++];
+
+  buffer.def_levels.push_back(kDefLevelOne);
+  buffer.values.insert(buffer.values.end(), data_ptr, data_ptr + data_len);
+  buffered_bytes_ += static_cast<int64_t>(data_len);
   return *this;
 }
 
@@ -226,47 +264,94 @@ int64_t StreamWriter::SkipColumns(int num_columns_to_skip) {
       throw ParquetException("Cannot skip column '" + node->name() +
                              "' as it is required.");
     }
-    auto writer = row_group_writer_->column(column_index_++);
-
-    WriteNullValue(writer);
+    WriteNullValue();
   }
   return num_columns_skipped;
 }
 
-void StreamWriter::WriteNullValue(ColumnWriter* writer) {
-  switch (writer->type()) {
-    case Type::BOOLEAN:
-      static_cast<BoolWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                   &kRepLevelZero, nullptr);
-      break;
-    case Type::INT32:
-      static_cast<Int32Writer*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::INT64:
-      static_cast<Int64Writer*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::BYTE_ARRAY:
-      static_cast<ByteArrayWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                        &kRepLevelZero, nullptr);
-      break;
-    case Type::FIXED_LEN_BYTE_ARRAY:
-      static_cast<FixedLenByteArrayWriter*>(writer)->WriteBatch(
-          kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-      break;
-    case Type::FLOAT:
-      static_cast<FloatWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::DOUBLE:
-      static_cast<DoubleWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                     &kRepLevelZero, nullptr);
-      break;
-    case Type::INT96:
-    case Type::UNDEFINED:
-      throw ParquetException("Unexpected type: " + TypeToString(writer->type()));
-      break;
+void StreamWriter::WriteNullValue() {
+  column_buffers_[column_index_++].def_levels.push_back(kDefLevelZero);
+}
+
+void StreamWriter::WriteBufferedRows() {
+  std::vector<ByteArray> ba_values;
+  std::vector<FixedLenByteArray> flba_values;
+  int64_t buffered_value_bytes = 0;
+
+  for (std::size_t i = 0; i < column_buffers_.size(); ++i) {
+    auto& buffer = column_buffers_[i];
+    if (buffer.def_levels.empty()) {
+      continue;
+    }
+    auto writer = row_group_writer_->column(static_cast<int>(i));
+    const auto num_levels = static_cast<int64_t>(buffer.def_levels.size());
+    const int16_t* def_levels = buffer.def_levels.data();
+    const uint8_t* values = buffer.values.data();
+
+    switch (writer->type()) {
+      case Type::BOOLEAN:
+        buffered_value_bytes +=
+            WriteFixedWidthValues<BoolWriter>(writer, num_levels, def_levels, values);
+        break;
+      case Type::INT32:
+        buffered_value_bytes +=
+            WriteFixedWidthValues<Int32Writer>(writer, num_levels, def_levels, values);
+        break;
+      case Type::INT64:
+        buffered_value_bytes +=
+            WriteFixedWidthValues<Int64Writer>(writer, num_levels, def_levels, values);
+        break;
+      case Type::FLOAT:
+        buffered_value_bytes +=
+            WriteFixedWidthValues<FloatWriter>(writer, num_levels, def_levels, values);
+        break;
+      case Type::DOUBLE:
+        buffered_value_bytes +=
+            WriteFixedWidthValues<DoubleWriter>(writer, num_levels, def_levels, values);
+        break;
+      case Type::BYTE_ARRAY: {
+        ba_values.resize(buffer.lengths.size());
+        for (std::size_t j = 0; j < buffer.lengths.size(); ++j) {
+          ba_values[j].ptr = values;
+          ba_values[j].len = buffer.lengths[j];
+          values += buffer.lengths[j];
+        }
+        auto typed_writer = static_cast<ByteArrayWriter*>(writer);
+        typed_writer->WriteBatch(num_levels, def_levels, nullptr, ba_values.data());
+        buffered_value_bytes += typed_writer->EstimatedBufferedValueBytes();
+        break;
+      }
+      case Type::FIXED_LEN_BYTE_ARRAY: {
+        const int type_length = nodes_[i]->type_length();
+        flba_values.resize(buffer.values.size() / type_length);
+        for (auto& flba_value : flba_values) {
+          flba_value.ptr = values;
+          values += type_length;
+        }
+        auto typed_writer = static_cast<FixedLenByteArrayWriter*>(writer);
+        typed_writer->WriteBatch(num_levels, def_levels, nullptr, flba_values.data());
+        buffered_value_bytes += typed_writer->EstimatedBufferedValueBytes();
+        break;
+      }
+      case Type::INT96:
+      case Type::UNDEFINED:
+        throw ParquetException("Unexpected type: " + TypeToString(writer->type()));
+        break;
+    }
+    buffer.def_levels.clear();
+    buffer.values.clear();
+    buffer.lengths.clear();
+  }
+  buffered_rows_ = 0;
+  buffered_bytes_ = 0;
+
+  if (max_row_group_size_ > 0) {
+    // Size already written (compressed + uncompressed) plus the values
+    // held by the column writers.
+    //
+    row_group_size_ = row_group_writer_->total_bytes_written() +
+                      row_group_writer_->total_compressed_bytes() +
+                      buffered_value_bytes;
   }
 }
 
@@ -288,15 +373,12 @@ void StreamWriter::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (max_row_group_size_ > 0) {
-    if (row_group_size_ > max_row_group_size_) {
-      EndRowGroup();
-    }
-    // Initialize for each row with size already written
-    // (compressed + uncompressed).
-    //
-    row_group_size_ = row_group_writer_->total_bytes_written() +
-                      row_group_writer_->total_compressed_bytes();
+  if (++buffered_rows_ >= write_batch_size_) {
+    WriteBufferedRows();
+  }
+  if (max_row_group_size_ > 0 &&
+      row_group_size_ + buffered_bytes_ > max_row_group_size_) {
+    EndRowGroup();
   }
 }
 
@@ -304,10 +386,13 @@ void StreamWriter::EndRowGroup() {
   if (!file_writer_) {
     throw ParquetException("StreamWriter not initialized");
   }
+  WriteBufferedRows();
+
   // Avoid creating empty row groups.
   if (row_group_writer_->num_rows() > 0) {
     row_group_writer_->Close();
     row_group_writer_.reset(file_writer_->AppendBufferedRowGroup());
+    row_group_size_ = 0;
   }
 }
 
@@ -57,6 +57,11 @@ namespace parquet {
 /// have a value (i.e. it is nullopt) then a ParquetException will be
 /// raised.
 ///
+/// Values are buffered per column and handed to the column writers
+/// in batches of WriterProperties::write_batch_size() rows.  The
+/// buffered rows are written when the batch is full, when the row
+/// group ends and when the StreamWriter is destroyed.
+///
 /// Currently there is no support for repeated fields.
 ///
 class PARQUET_EXPORT StreamWriter {
@@ -71,7 +76,7 @@ class PARQUET_EXPORT StreamWriter {
 
   explicit StreamWriter(std::unique_ptr<ParquetFileWriter> writer);
 
-  ~StreamWriter() = default;
+  ~StreamWriter();
 
   static void SetDefaultMaxRowGroupSize(int64_t max_size);
 
@@ -85,7 +90,7 @@ class PARQUET_EXPORT StreamWriter {
 
   // Moving is possible.
   StreamWriter(StreamWriter&&) = default;
-  StreamWriter& operator=(StreamWriter&&) = default;
+  StreamWriter& operator=(StreamWriter&&);
 
   // Copying is not allowed.
   StreamWriter(const StreamWriter&) = delete;
@@ -178,15 +183,14 @@ class PARQUET_EXPORT StreamWriter {
   void EndRowGroup();
 
  protected:
-  template <typename WriterType, typename T>
+  template <typename T>
   StreamWriter& Write(const T v) {
-    auto writer = static_cast<WriterType*>(row_group_writer_->column(column_index_++));
+    auto& buffer = column_buffers_[column_index_++];
+    auto bytes = reinterpret_cast<const uint8_t*>(&v);
 
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &v);
-
-    if (max_row_group_size_ > 0) {
-      row_group_size_ += writer->EstimatedBufferedValueBytes();
-    }
+    buffer.def_levels.push_back(kDefLevelOne);
+    buffer.values.insert(buffer.values.end(), bytes, bytes + sizeof(T));
+    buffered_bytes_ += sizeof(T);
     return *this;
   }
 
@@ -202,7 +206,10 @@ class PARQUET_EXPORT StreamWriter {
   /// not optional.
   void SkipOptionalColumn();
 
-  void WriteNullValue(ColumnWriter* writer);
+  void WriteNullValue();
+
+  /// \brief Write the buffered rows to the column writers.
+  void WriteBufferedRows();
 
  private:
   using node_ptr_type = std::shared_ptr<schema::PrimitiveNode>;
@@ -211,19 +218,30 @@ class PARQUET_EXPORT StreamWriter {
     void operator()(void*) {}
   };
 
+  // Levels and values of a column not yet given to its column writer.
+  // Variable length values are stored back to back in values with
+  // their lengths in lengths.
+  struct ColumnBuffer {
+    std::vector<int16_t> def_levels;
+    std::vector<uint8_t> values;
+    std::vector<uint32_t> lengths;
+  };
+
   int32_t column_index_{0};
   int64_t current_row_{0};
   int64_t row_group_size_{0};
   int64_t max_row_group_size_{default_row_group_size_};
+  int64_t buffered_rows_{0};
+  int64_t buffered_bytes_{0};
+  int64_t write_batch_size_{0};
 
   std::unique_ptr<ParquetFileWriter> file_writer_;
   std::unique_ptr<RowGroupWriter, null_deleter> row_group_writer_;
   std::vector<node_ptr_type> nodes_;
+  std::vector<ColumnBuffer> column_buffers_;
 
   static constexpr int16_t kDefLevelZero = 0;
   static constexpr int16_t kDefLevelOne = 1;
-  static constexpr int16_t kRepLevelZero = 0;
-  static constexpr int64_t kBatchSizeOne = 1;
 
   static int64_t default_row_group_size_;
 };
@@ -377,6 +377,30 @@ inline void DeserializeThriftUnencryptedMsg(const uint8_t* buf, uint32_t* len,
   *len = *len - bytes_left;
 }
 
+// Decrypt the encrypted thrift message in buf/len.  On return, len will be set
+// to the length of the encrypted message and decrypted_len to the length of
+// the decrypted message at the start of the returned buffer.
+inline std::shared_ptr<ResizableBuffer> DecryptThriftMsg(
+    const uint8_t* buf, uint32_t* len, const std::shared_ptr<Decryptor>& decryptor,
+    uint32_t* decrypted_len) {
+  uint32_t clen;
+  clen = *len;
+  // decrypt
+  std::shared_ptr<ResizableBuffer> decrypted_buffer =
+      std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(
+          decryptor->pool(),
+          static_cast<int64_t>(clen - decryptor->CiphertextSizeDelta())));
+  const uint8_t* cipher_buf = buf;
+  uint32_t decrypted_buffer_len =
+      decryptor->Decrypt(cipher_buf, 0, decrypted_buffer->mutable_data());
+  if (decrypted_buffer_len <= 0) {
+    throw ParquetException("Couldn't decrypt buffer\n");
+  }
+  *len = decrypted_buffer_len + decryptor->CiphertextSizeDelta();
+  *decrypted_len = decrypted_buffer_len;
+  return decrypted_buffer;
+}
+
 // Deserialize a thrift message from buf/len.  buf/len must at least contain
 // all the bytes needed to store the thrift message.  On return, len will be
 // set to the actual length of the header.
@@ -387,25 +411,103 @@ inline void DeserializeThriftMsg(const uint8_t* buf, uint32_t* len, T* deseriali
   if (decryptor == NULLPTR) {
     DeserializeThriftUnencryptedMsg(buf, len, deserialized_msg);
   } else {  // thrift message is encrypted
-    uint32_t clen;
-    clen = *len;
-    // decrypt
+    uint32_t decrypted_buffer_len;
     std::shared_ptr<ResizableBuffer> decrypted_buffer =
-        std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(
-            decryptor->pool(),
-            static_cast<int64_t>(clen - decryptor->CiphertextSizeDelta())));
-    const uint8_t* cipher_buf = buf;
-    uint32_t decrypted_buffer_len =
-        decryptor->Decrypt(cipher_buf, 0, decrypted_buffer->mutable_data());
-    if (decrypted_buffer_len <= 0) {
-      throw ParquetException("Couldn't decrypt buffer\n");
-    }
-    *len = decrypted_buffer_len + decryptor->CiphertextSizeDelta();
+        DecryptThriftMsg(buf, len, decryptor, &decrypted_buffer_len);
     DeserializeThriftMsg(decrypted_buffer->data(), &decrypted_buffer_len,
                          deserialized_msg);
   }
 }
 
+// Byte range of a value within a serialized thrift message
+struct ThriftRange {
+  uint32_t offset;
+  uint32_t length;
+};
+
+// Locate the elements of the list of structs with the given field id of the
+// thrift struct serialized in buf/len, skipping over them rather than
+// deserializing them, and set stripped to the serialization of the struct with
+// that list emptied, to be deserialized instead.  The offsets of the elements
+// are relative to buf.  buf/len must at least contain all the bytes needed to
+// store the struct.  On return, len will be set to the actual length of the
+// struct.
+inline void SplitThriftStructList(const uint8_t* buf, uint32_t* len, int16_t field_id,
+                                  std::vector<ThriftRange>* elements,
+                                  std::string* stripped) {
+  using apache::thrift::protocol::TType;
+  shared_ptr<ThriftBuffer> tmem_transport(
+      new ThriftBuffer(const_cast<uint8_t*>(buf), *len));
+  apache::thrift::protocol::TCompactProtocolFactoryT<ThriftBuffer> tproto_factory;
+  // Protect against CPU and memory bombs
+  tproto_factory.setStringSizeLimit(10 * 1000 * 1000);
+  tproto_factory.setContainerSizeLimit(10 * 1000 * 1000);
+  shared_ptr<apache::thrift::protocol::TProtocol> tproto =  //
+      tproto_factory.getProtocol(tmem_transport);
+  auto position = [&]() { return *len - tmem_transport->available_read(); };
+
+  elements->clear();
+  bool found = false;
+  uint32_t list_start = 0;
+  uint32_t list_end = 0;
+  try {
+    std::string name;
+    TType field_type;
+    int16_t id;
+    tproto->readStructBegin(name);
+    while (true) {
+      tproto->readFieldBegin(name, field_type, id);
+      if (field_type == apache::thrift::protocol::T_STOP) {
+        break;
+      }
+      if (id == field_id && field_type == apache::thrift::protocol::T_LIST && !found) {
+        list_start = position();
+        TType element_type;
+        uint32_t size;
+        tproto->readListBegin(element_type, size);
+        if (element_type != apache::thrift::protocol::T_STRUCT) {
+          throw ParquetException("Couldn't deserialize thrift: field " +
+                                 std::to_string(id) + " is not a list of structs");
+        }
+        elements->reserve(size);
+        for (uint32_t i = 0; i < size; ++i) {
+          const uint32_t element_start = position();
+          tproto->skip(element_type);
+          elements->push_back({element_start, position() - element_start});
+        }
+        tproto->readListEnd();
+        list_end = position();
+        found = true;
+      } else {
+        tproto->skip(field_type);
+      }
+      tproto->readFieldEnd();
+    }
+    tproto->readStructEnd();
+  } catch (ParquetException&) {
+    throw;
+  } catch (std::exception& e) {
+    std::stringstream ss;
+    ss << "Couldn't deserialize thrift: " << e.what() << "\n";
+    throw ParquetException(ss.str());
+  }
+  *len = position();
+
+  const char* chars = reinterpret_cast<const char*>(buf);
+  if (!found) {
+    stripped->assign(chars, *len);
+    return;
+  }
+  // In the compact protocol, the header of an empty list is a single byte
+  // holding its element type
+  const char kEmptyStructListHeader = 0x0C;
+  stripped->clear();
+  stripped->reserve(list_start + 1 + (*len - list_end));
+  stripped->append(chars, list_start);
+  stripped->push_back(kEmptyStructListHeader);
+  stripped->append(chars + list_end, *len - list_end);
+}
+
 /// Utility class to serialize thrift objects to a binary format.  This object
 /// should be reused if possible to reuse the underlying memory.
 /// Note: thrift will encode NULLs into the serialized buffer so it is not valid
@@ -45,6 +45,11 @@
 #include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/util/thread_pool.h"
 
 #include "plasma/common.h"
@@ -166,6 +171,9 @@ struct ObjectInUseEntry {
   PlasmaObject object;
   /// A flag representing whether the object has been sealed.
   bool is_sealed;
+  /// Whether the count has reached zero but the release request was not sent
+  /// yet, see PlasmaClient::Impl::FlushReleases.
+  bool release_pending;
 };
 
 class ClientMmapTableEntry {
@@ -236,6 +244,12 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
                             const std::vector<std::string>& metadata,
                             bool evict_if_full = true);
 
+  Status CreateBatch(const std::vector<ObjectID>& object_ids,
+                     const std::vector<int64_t>& data_sizes,
+                     const std::vector<std::string>& metadata,
+                     std::vector<std::shared_ptr<Buffer>>* data, bool contiguous,
+                     bool evict_if_full);
+
   Status Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
              std::vector<ObjectBuffer>* object_buffers);
 
@@ -246,12 +260,16 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Contains(const ObjectID& object_id, bool* has_object);
 
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   Status List(ObjectTable* objects);
 
   Status Abort(const ObjectID& object_id);
 
   Status Seal(const ObjectID& object_id);
 
+  Status SealBatch(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
@@ -273,6 +291,8 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   std::string DebugString();
 
+  Status GetMetrics(PlasmaMetrics* metrics);
+
   bool IsInUse(const ObjectID& object_id);
 
   int64_t store_capacity() { return store_capacity_; }
@@ -292,6 +312,14 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// \return The return status.
   Status MarkObjectUnused(const ObjectID& object_id);
 
+  /// Send the release requests of the objects that were released and not used
+  /// again since. Called when enough releases are pending and before the
+  /// requests whose result may depend on them (e.g. creations, which may need
+  /// to evict the objects).
+  ///
+  /// \return The return status.
+  Status FlushReleases();
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
                     const std::function<std::shared_ptr<Buffer>(
@@ -326,6 +354,12 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// information to make sure that it does not delay in releasing so much
   /// memory that the store is unable to evict enough objects to free up space.
   int64_t store_capacity_;
+  /// The number of released objects whose release request may be delayed.
+  int release_delay_;
+  /// The objects whose release request was delayed, in the order of release.
+  std::vector<ObjectID> pending_releases_;
+  /// The total size of the objects in pending_releases_.
+  int64_t pending_release_bytes_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
   /// A queue of notification
@@ -341,7 +375,8 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() : store_conn_(0), store_capacity_(0) {
+PlasmaClient::Impl::Impl()
+    : store_conn_(0), store_capacity_(0), release_delay_(0), pending_release_bytes_(0) {
 #ifdef PLASMA_CUDA
   auto maybe_manager = CudaDeviceManager::Instance();
   DCHECK_OK(maybe_manager.status());
@@ -377,7 +412,7 @@ bool PlasmaClient::Impl::IsInUse(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
   const auto elem = objects_in_use_.find(object_id);
-  return (elem != objects_in_use_.end());
+  return (elem != objects_in_use_.end() && elem->second->count > 0);
 }
 
 int PlasmaClient::Impl::GetStoreFd(int store_fd) {
@@ -405,10 +440,13 @@ void PlasmaClient::Impl::IncrementObjectCount(const ObjectID& object_id,
     objects_in_use_[object_id]->object = *object;
     objects_in_use_[object_id]->count = 0;
     objects_in_use_[object_id]->is_sealed = is_sealed;
+    objects_in_use_[object_id]->release_pending = false;
     object_entry = objects_in_use_[object_id].get();
   } else {
     object_entry = elem->second.get();
-    ARROW_CHECK(object_entry->count > 0);
+    // The object may be used again before its delayed release is sent.
+    ARROW_CHECK(object_entry->count > 0 || object_entry->release_pending);
+    object_entry->release_pending = false;
   }
   // Increment the count of the number of instances of this object that are
   // being used by this client. The corresponding decrement should happen in
@@ -424,6 +462,7 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
 
   ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
                    << data_size << " and metadata size " << metadata_size;
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendCreateRequest(store_conn_, object_id, evict_if_full, data_size,
                                   metadata_size, device_num));
   std::vector<uint8_t> buffer;
@@ -493,6 +532,7 @@ Status PlasmaClient::Impl::CreateAndSeal(const ObjectID& object_id,
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
   ARROW_LOG(DEBUG) << "called CreateAndSeal on conn " << store_conn_;
+  RETURN_NOT_OK(FlushReleases());
   // Compute the object hash.
   static unsigned char digest[kDigestSize];
   uint64_t hash = ComputeObjectHashCPU(
@@ -528,6 +568,7 @@ Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& objec
     digests.push_back(digest);
   }
 
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendCreateAndSealBatchRequest(store_conn_, object_ids, evict_if_full,
                                               data, metadata, digests));
   std::vector<uint8_t> buffer;
@@ -538,6 +579,61 @@ Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& objec
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::CreateBatch(const std::vector<ObjectID>& object_ids,
+                                       const std::vector<int64_t>& data_sizes,
+                                       const std::vector<std::string>& metadata,
+                                       std::vector<std::shared_ptr<Buffer>>* data,
+                                       bool contiguous, bool evict_if_full) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  ARROW_LOG(DEBUG) << "called CreateBatch on conn " << store_conn_ << " for "
+                   << object_ids.size() << " objects";
+  if (data_sizes.size() != object_ids.size() ||
+      (!metadata.empty() && metadata.size() != object_ids.size())) {
+    return Status::Invalid("CreateBatch sizes or metadata do not match the object ids");
+  }
+  std::vector<int64_t> metadata_sizes(object_ids.size(), 0);
+  for (size_t i = 0; i < metadata.size(); i++) {
+    metadata_sizes[i] = static_cast<int64_t>(metadata[i].size());
+  }
+
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendCreateBatchRequest(store_conn_, object_ids, evict_if_full,
+                                       data_sizes, metadata_sizes, contiguous));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateBatchReply, &buffer));
+  std::vector<ObjectID> ids;
+  std::vector<PlasmaObject> objects;
+  std::vector<int> store_fds;
+  std::vector<int64_t> mmap_sizes;
+  // If the reply included an error, then the store will not send file
+  // descriptors.
+  RETURN_NOT_OK(ReadCreateBatchReply(buffer.data(), buffer.size(), &ids, &objects,
+                                     &store_fds, &mmap_sizes));
+  for (size_t i = 0; i < store_fds.size(); i++) {
+    int fd = GetStoreFd(store_fds[i]);
+    LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
+  }
+
+  data->clear();
+  data->reserve(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    PlasmaObject& object = objects[i];
+    ARROW_CHECK(object.data_size == data_sizes[i]);
+    ARROW_CHECK(object.metadata_offset == object.data_offset + data_sizes[i]);
+    uint8_t* pointer = LookupMmappedFile(object.store_fd) + object.data_offset;
+    if (metadata_sizes[i] > 0) {
+      memcpy(pointer + object.data_size, metadata[i].data(), metadata_sizes[i]);
+    }
+    data->push_back(std::make_shared<PlasmaMutableBuffer>(shared_from_this(), pointer,
+                                                          data_sizes[i]));
+    // As in Create, the second reference is released by Seal.
+    IncrementObjectCount(object_ids[i], &object, false);
+    IncrementObjectCount(object_ids[i], &object, false);
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::GetBuffers(
     const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
     const std::function<std::shared_ptr<Buffer>(
@@ -596,6 +692,7 @@ Status PlasmaClient::Impl::GetBuffers(
 
   // If we get here, then the objects aren't all currently in use by this
   // client, so we need to send a request to the plasma store.
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
@@ -731,7 +828,22 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   object_entry->second->count -= 1;
   ARROW_CHECK(object_entry->second->count >= 0);
   // Check if the client is no longer using this object.
-  if (object_entry->second->count == 0) {
+  if (object_entry->second->count == 0 && release_delay_ > 0 &&
+      object_entry->second->object.device_num == 0 &&
+      deletion_cache_.count(object_id) == 0) {
+    // Keep the entry, so that getting the object again needs no request, and
+    // tell the store later.
+    const auto& object = object_entry->second->object;
+    object_entry->second->release_pending = true;
+    pending_releases_.push_back(object_id);
+    pending_release_bytes_ += object.data_size + object.metadata_size;
+    // Don't keep so much memory that the store is unable to evict enough
+    // objects to free up space.
+    if (static_cast<int>(pending_releases_.size()) >= release_delay_ ||
+        pending_release_bytes_ > store_capacity_ / 10) {
+      return FlushReleases();
+    }
+  } else if (object_entry->second->count == 0) {
     // Tell the store that the client no longer needs the object.
     RETURN_NOT_OK(MarkObjectUnused(object_id));
     RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
@@ -744,6 +856,28 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::FlushReleases() {
+  if (pending_releases_.empty()) {
+    return Status::OK();
+  }
+  std::vector<ObjectID> released_ids;
+  for (const auto& object_id : pending_releases_) {
+    auto object_entry = objects_in_use_.find(object_id);
+    // Skip the objects that were used again, or released twice since the
+    // last flush.
+    if (object_entry != objects_in_use_.end() && object_entry->second->release_pending) {
+      RETURN_NOT_OK(MarkObjectUnused(object_id));
+      released_ids.push_back(object_id);
+    }
+  }
+  pending_releases_.clear();
+  pending_release_bytes_ = 0;
+  if (released_ids.empty()) {
+    return Status::OK();
+  }
+  return SendReleaseRequests(store_conn_, released_ids);
+}
+
 // This method is used to query whether the plasma store contains an object.
 Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
@@ -765,6 +899,15 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::Prefetch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // A get request which does not wait starts restoring the evicted objects.
+  // The buffers of the present objects are released right away.
+  std::vector<ObjectBuffer> object_buffers;
+  return Get(object_ids, 0, &object_buffers);
+}
+
 Status PlasmaClient::Impl::List(ObjectTable* objects) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   RETURN_NOT_OK(SendListRequest(store_conn_));
@@ -878,6 +1021,42 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::SealBatch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // Check all the objects before sealing any of them.
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNotFound,
+                             "SealBatch() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectAlreadySealed,
+                             "SealBatch() called on an already sealed object");
+    }
+  }
+
+  std::vector<std::string> digests;
+  for (const auto& object_id : object_ids) {
+    objects_in_use_[object_id]->is_sealed = true;
+    std::vector<uint8_t> digest(kDigestSize);
+    RETURN_NOT_OK(Hash(object_id, &digest[0]));
+    digests.emplace_back(digest.begin(), digest.end());
+  }
+  RETURN_NOT_OK(SendSealBatchRequest(store_conn_, object_ids, digests));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSealBatchReply, &buffer));
+  std::vector<ObjectID> sealed_ids;
+  RETURN_NOT_OK(ReadSealBatchReply(buffer.data(), buffer.size(), &sealed_ids));
+  ARROW_CHECK(sealed_ids.size() == object_ids.size());
+  // Release the references taken by Create or CreateBatch, as in Seal.
+  for (const auto& object_id : object_ids) {
+    RETURN_NOT_OK(Release(object_id));
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   auto object_entry = objects_in_use_.find(object_id);
@@ -920,6 +1099,7 @@ Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
 Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
+  RETURN_NOT_OK(FlushReleases());
   std::vector<ObjectID> not_in_use_ids;
   for (auto& object_id : object_ids) {
     // If the object is in used, skip it.
@@ -946,6 +1126,7 @@ Status PlasmaClient::Impl::Evict(int64_t num_bytes, int64_t& num_bytes_evicted)
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
   // Send a request to the store to evict objects.
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendEvictRequest(store_conn_, num_bytes));
   // Wait for a response with the number of bytes actually evicted.
   std::vector<uint8_t> buffer;
@@ -1065,10 +1246,10 @@ Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
   if (manager_socket_name != "") {
     return Status::NotImplemented("plasma manager is no longer supported");
   }
-  if (release_delay != 0) {
-    ARROW_LOG(WARNING) << "The release_delay parameter in PlasmaClient::Connect "
-                       << "is deprecated";
+  if (release_delay < 0) {
+    return Status::Invalid("release_delay must not be negative");
   }
+  release_delay_ = release_delay;
   // Send a ConnectRequest to the store to get its memory capacity.
   RETURN_NOT_OK(SendConnectRequest(store_conn_));
   std::vector<uint8_t> buffer;
@@ -1095,6 +1276,8 @@ Status PlasmaClient::Impl::Disconnect() {
 
   // Close the connections to Plasma. The Plasma store will release the objects
   // that were in use by us when handling the SIGPIPE.
+  pending_releases_.clear();
+  pending_release_bytes_ = 0;
   close(store_conn_);
   store_conn_ = -1;
   return Status::OK();
@@ -1116,6 +1299,14 @@ std::string PlasmaClient::Impl::DebugString() {
   return debug_string;
 }
 
+Status PlasmaClient::Impl::GetMetrics(PlasmaMetrics* metrics) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  RETURN_NOT_OK(SendGetMetricsRequest(store_conn_));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetMetricsReply, &buffer));
+  return ReadGetMetricsReply(buffer.data(), buffer.size(), metrics);
+}
+
 // ----------------------------------------------------------------------
 // PlasmaClient
 
@@ -1155,6 +1346,97 @@ Status PlasmaClient::CreateAndSealBatch(const std::vector<ObjectID>& object_ids,
   return impl_->CreateAndSealBatch(object_ids, data, metadata, evict_if_full);
 }
 
+namespace {
+
+// Write record batches in the IPC stream format.
+Status WriteRecordBatchStream(const std::shared_ptr<arrow::Schema>& schema,
+                              const std::vector<const arrow::RecordBatch*>& batches,
+                              arrow::io::OutputStream* sink) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, arrow::ipc::NewStreamWriter(sink, schema));
+  for (const auto& batch : batches) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+// Create and seal an object holding record batches in the IPC stream format.
+// The stream is first written to a mock stream to size the object, which
+// copies no data.
+Status PutRecordBatchStream(PlasmaClient* client, const ObjectID& object_id,
+                            const std::shared_ptr<arrow::Schema>& schema,
+                            const std::vector<const arrow::RecordBatch*>& batches,
+                            bool evict_if_full) {
+  arrow::io::MockOutputStream mock;
+  RETURN_NOT_OK(WriteRecordBatchStream(schema, batches, &mock));
+  ARROW_ASSIGN_OR_RAISE(int64_t size, mock.Tell());
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(client->Create(object_id, size, nullptr, 0, &data, /*device_num=*/0,
+                               evict_if_full));
+  Status status;
+  {
+    arrow::io::FixedSizeBufferWriter stream(data);
+    status = WriteRecordBatchStream(schema, batches, &stream);
+  }
+  data.reset();
+  if (!status.ok()) {
+    ARROW_UNUSED(client->Abort(object_id));
+    return status;
+  }
+  RETURN_NOT_OK(client->Seal(object_id));
+  return client->Release(object_id);
+}
+
+// Open the IPC stream held by an object, whose buffer is kept alive by the
+// arrays read from it.
+Status OpenRecordBatchStream(PlasmaClient* client, const ObjectID& object_id,
+                             int64_t timeout_ms,
+                             std::shared_ptr<arrow::RecordBatchReader>* reader) {
+  std::vector<ObjectBuffer> object_buffers;
+  RETURN_NOT_OK(client->Get({object_id}, timeout_ms, &object_buffers));
+  const auto& data = object_buffers[0].data;
+  if (data == nullptr) {
+    return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNotFound,
+                           "object " + object_id.hex() + " not found");
+  }
+  if (object_buffers[0].device_num != 0) {
+    return Status::NotImplemented("reading record batches from GPU objects");
+  }
+  auto stream = std::make_shared<arrow::io::BufferReader>(data);
+  return arrow::ipc::RecordBatchStreamReader::Open(stream).Value(reader);
+}
+
+}  // namespace
+
+Status PlasmaClient::PutRecordBatch(const ObjectID& object_id,
+                                    const arrow::RecordBatch& batch,
+                                    bool evict_if_full) {
+  return PutRecordBatchStream(this, object_id, batch.schema(), {&batch},
+                              evict_if_full);
+}
+
+Status PlasmaClient::PutTable(const ObjectID& object_id, const arrow::Table& table,
+                              bool evict_if_full) {
+  arrow::TableBatchReader reader(table);
+  arrow::RecordBatchVector batches;
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+  std::vector<const arrow::RecordBatch*> batch_ptrs;
+  for (const auto& batch : batches) {
+    batch_ptrs.push_back(batch.get());
+  }
+  return PutRecordBatchStream(this, object_id, table.schema(), batch_ptrs,
+                              evict_if_full);
+}
+
+Status PlasmaClient::CreateBatch(const std::vector<ObjectID>& object_ids,
+                                 const std::vector<int64_t>& data_sizes,
+                                 const std::vector<std::string>& metadata,
+                                 std::vector<std::shared_ptr<Buffer>>* data,
+                                 bool contiguous, bool evict_if_full) {
+  return impl_->CreateBatch(object_ids, data_sizes, metadata, data, contiguous,
+                            evict_if_full);
+}
+
 Status PlasmaClient::Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
                          std::vector<ObjectBuffer>* object_buffers) {
   return impl_->Get(object_ids, timeout_ms, object_buffers);
@@ -1165,6 +1447,31 @@ Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
   return impl_->Get(object_ids, num_objects, timeout_ms, object_buffers);
 }
 
+Status PlasmaClient::GetRecordBatch(const ObjectID& object_id, int64_t timeout_ms,
+                                    std::shared_ptr<arrow::RecordBatch>* batch) {
+  std::shared_ptr<arrow::RecordBatchReader> reader;
+  RETURN_NOT_OK(OpenRecordBatchStream(this, object_id, timeout_ms, &reader));
+  RETURN_NOT_OK(reader->ReadNext(batch));
+  if (*batch == nullptr) {
+    return Status::Invalid("object ", object_id.hex(), " holds no record batch");
+  }
+  std::shared_ptr<arrow::RecordBatch> next;
+  RETURN_NOT_OK(reader->ReadNext(&next));
+  if (next != nullptr) {
+    batch->reset();
+    return Status::Invalid("object ", object_id.hex(),
+                           " holds more than one record batch, use GetTable");
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::GetTable(const ObjectID& object_id, int64_t timeout_ms,
+                              std::shared_ptr<arrow::Table>* table) {
+  std::shared_ptr<arrow::RecordBatchReader> reader;
+  RETURN_NOT_OK(OpenRecordBatchStream(this, object_id, timeout_ms, &reader));
+  return reader->ReadAll(table);
+}
+
 Status PlasmaClient::Release(const ObjectID& object_id) {
   return impl_->Release(object_id);
 }
@@ -1173,12 +1480,20 @@ Status PlasmaClient::Contains(const ObjectID& object_id, bool* has_object) {
   return impl_->Contains(object_id, has_object);
 }
 
+Status PlasmaClient::Prefetch(const std::vector<ObjectID>& object_ids) {
+  return impl_->Prefetch(object_ids);
+}
+
 Status PlasmaClient::List(ObjectTable* objects) { return impl_->List(objects); }
 
 Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(object_id); }
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::SealBatch(const std::vector<ObjectID>& object_ids) {
+  return impl_->SealBatch(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
@@ -1217,6 +1532,10 @@ Status PlasmaClient::Disconnect() { return impl_->Disconnect(); }
 
 std::string PlasmaClient::DebugString() { return impl_->DebugString(); }
 
+Status PlasmaClient::GetMetrics(PlasmaMetrics* metrics) {
+  return impl_->GetMetrics(metrics);
+}
+
 bool PlasmaClient::IsInUse(const ObjectID& object_id) {
   return impl_->IsInUse(object_id);
 }
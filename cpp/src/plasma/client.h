@@ -24,9 +24,11 @@
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 #include "plasma/common.h"
+#include "plasma/metrics.h"
 
 using arrow::Buffer;
 using arrow::Status;
@@ -57,7 +59,10 @@ class ARROW_EXPORT PlasmaClient {
   ///        function will not connect to a manager.
   ///        Note that plasma manager is no longer supported, this function
   ///        will return failure if this is not "".
-  /// \param release_delay Deprecated (not used).
+  /// \param release_delay The number of released objects whose release is
+  ///        delayed, so that their release requests are sent to the store
+  ///        together and that getting them again needs no request. 0 (the
+  ///        default) sends each release request immediately.
   /// \param num_retries number of attempts to connect to IPC socket, default 50
   /// \return The return status.
   Status Connect(const std::string& store_socket_name,
@@ -126,6 +131,51 @@ class ARROW_EXPORT PlasmaClient {
                             const std::vector<std::string>& metadata,
                             bool evict_if_full = true);
 
+  /// Create multiple objects in the object store with a single request, like
+  /// Create() on the host. Either all of them are created, or none. The
+  /// objects must be sealed, e.g. with SealBatch(), and then released, or
+  /// released and aborted.
+  ///
+  /// \param object_ids The vector of IDs of the objects to create.
+  /// \param data_sizes The sizes in bytes of the data of the objects.
+  /// \param metadata The vector of metadata for the objects to create, or
+  ///        an empty vector for no metadata.
+  /// \param[out] data The buffers of the objects data, to be written.
+  /// \param contiguous Whether to allocate the objects in a single region of
+  ///        memory, which is cheaper for many small objects. The memory of the
+  ///        region is only freed once all the objects are deleted or evicted.
+  /// \param evict_if_full Whether to evict other objects to make space for
+  ///        these objects.
+  /// \return The return status.
+  Status CreateBatch(const std::vector<ObjectID>& object_ids,
+                     const std::vector<int64_t>& data_sizes,
+                     const std::vector<std::string>& metadata,
+                     std::vector<std::shared_ptr<Buffer>>* data, bool contiguous = false,
+                     bool evict_if_full = true);
+
+  /// Create and seal an object holding a record batch, in the Arrow IPC stream
+  /// format and without metadata. The batch is serialized directly into the
+  /// memory of the object.
+  ///
+  /// \param object_id The ID of the object to create.
+  /// \param batch The record batch.
+  /// \param evict_if_full Whether to evict other objects to make space for
+  ///        this object.
+  /// \return The return status.
+  Status PutRecordBatch(const ObjectID& object_id, const arrow::RecordBatch& batch,
+                        bool evict_if_full = true);
+
+  /// Create and seal an object holding the record batches of a table, like
+  /// PutRecordBatch().
+  ///
+  /// \param object_id The ID of the object to create.
+  /// \param table The table.
+  /// \param evict_if_full Whether to evict other objects to make space for
+  ///        this object.
+  /// \return The return status.
+  Status PutTable(const ObjectID& object_id, const arrow::Table& table,
+                  bool evict_if_full = true);
+
   /// Get some objects from the Plasma Store. This function will block until the
   /// objects have all been created and sealed in the Plasma Store or the
   /// timeout expires.
@@ -158,6 +208,31 @@ class ARROW_EXPORT PlasmaClient {
   Status Get(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
              ObjectBuffer* object_buffers);
 
+  /// Get an object created by PutRecordBatch(). The arrays of the batch point
+  /// to the memory of the object, which is released when they are all
+  /// destroyed.
+  ///
+  /// \param object_id The ID of the object to get.
+  /// \param timeout_ms The amount of time in milliseconds to wait for the
+  ///        object. If this value is -1, then no timeout is set.
+  /// \param[out] batch The record batch.
+  /// \return The return status, PlasmaObjectNotFound if the object is not
+  ///         available before the timeout.
+  Status GetRecordBatch(const ObjectID& object_id, int64_t timeout_ms,
+                        std::shared_ptr<arrow::RecordBatch>* batch);
+
+  /// Get an object created by PutTable() or PutRecordBatch(), like
+  /// GetRecordBatch().
+  ///
+  /// \param object_id The ID of the object to get.
+  /// \param timeout_ms The amount of time in milliseconds to wait for the
+  ///        object. If this value is -1, then no timeout is set.
+  /// \param[out] table The table.
+  /// \return The return status, PlasmaObjectNotFound if the object is not
+  ///         available before the timeout.
+  Status GetTable(const ObjectID& object_id, int64_t timeout_ms,
+                  std::shared_ptr<arrow::Table>* table);
+
   /// Tell Plasma that the client no longer needs the object. This should be
   /// called after Get() or Create() when the client is done with the object.
   /// After this call, the buffer returned by Get() is no longer valid.
@@ -178,6 +253,14 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Contains(const ObjectID& object_id, bool* has_object);
 
+  /// Tell the store that objects will be needed soon, without waiting for them.
+  /// The objects evicted to an external store start to be restored, so that a
+  /// later Get does not wait for the external store.
+  ///
+  /// \param object_ids The IDs of the objects to prefetch.
+  /// \return The return status.
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   /// List all the objects in the object store.
   ///
   /// This API is experimental and might change in the future.
@@ -210,6 +293,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal multiple objects in the object store with a single request, like
+  /// Seal().
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \return The return status.
+  Status SealBatch(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -288,6 +378,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The debug string.
   std::string DebugString();
 
+  /// Get the metrics of the plasma store server: request latencies, memory
+  /// usage and evictions.
+  ///
+  /// \param[out] metrics The metrics of the store.
+  /// \return The return status.
+  Status GetMetrics(PlasmaMetrics* metrics);
+
   /// Get the memory capacity of the store.
   ///
   /// \return Memory capacity of the store in bytes.
@@ -299,6 +396,8 @@ class ARROW_EXPORT PlasmaClient {
   FRIEND_TEST(TestPlasmaStore, GetTest);
   FRIEND_TEST(TestPlasmaStore, LegacyGetTest);
   FRIEND_TEST(TestPlasmaStore, AbortTest);
+  FRIEND_TEST(TestPlasmaStore, PutAndGetRecordBatchTest);
+  FRIEND_TEST(TestPlasmaStore, PutAndGetTableTest);
 
   bool IsInUse(const ObjectID& object_id);
 
@@ -123,6 +123,8 @@ struct ObjectTableEntry {
   int64_t create_time;
   /// How long creation of this object took.
   int64_t construct_duration;
+  /// NUMA node of the memory of the object, or -1 if unknown.
+  int numa_node;
 
   /// The state of the object, e.g., whether it is open or sealed.
   ObjectState state;
@@ -24,9 +24,13 @@
 #include <string.h>
 #include <sys/mman.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 #include <cerrno>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "plasma/common.h"
@@ -45,6 +49,7 @@ int fake_munmap(void*, int64_t);
 #define HAVE_MORECORE 0
 #define DEFAULT_MMAP_THRESHOLD MAX_SIZE_T
 #define DEFAULT_GRANULARITY ((size_t)128U * 1024U)
+#define MSPACES 1
 
 #include "plasma/thirdparty/dlmalloc.c"  // NOLINT
 
@@ -55,6 +60,7 @@ int fake_munmap(void*, int64_t);
 #undef USE_DL_PREFIX
 #undef HAVE_MORECORE
 #undef DEFAULT_GRANULARITY
+#undef MSPACES
 
 // dlmalloc.c defined DEBUG which will conflict with ARROW_LOG(DEBUG).
 #ifdef DEBUG
@@ -67,6 +73,29 @@ static void* pointer_advance(void* p, ptrdiff_t n) { return (unsigned char*)p +
 
 static void* pointer_retreat(void* p, ptrdiff_t n) { return (unsigned char*)p - n; }
 
+// The arenas of the NUMA nodes, created on first use.
+static std::unordered_map<int, mspace> numa_arenas;
+
+// The NUMA node the segments mapped by fake_mmap are bound to, or -1 for the
+// default arena.
+static int mmap_numa_node = -1;
+
+// Ask the kernel to place the pages of a segment on a NUMA node, falling back
+// to other nodes if it is full.
+static void BindToNumaNode(void* pointer, size_t size, int node) {
+#ifdef __linux__
+  constexpr int kMpolPreferred = 1;
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+  std::vector<unsigned long> mask(node / kBitsPerWord + 1, 0);  // NOLINT
+  mask[node / kBitsPerWord] |= 1UL << (node % kBitsPerWord);
+  if (syscall(SYS_mbind, pointer, size, kMpolPreferred, mask.data(),
+              mask.size() * kBitsPerWord + 1, 0) != 0) {
+    ARROW_LOG(WARNING) << "mbind to NUMA node " << node
+                       << " failed with error: " << std::strerror(errno);
+  }
+#endif
+}
+
 // Create a buffer. This is creating a temporary file and then
 // immediately unlinking it so we do not leave traces in the system.
 int create_buffer(int64_t size) {
@@ -129,9 +158,14 @@ void* fake_mmap(size_t size) {
   // Increase dlmalloc's allocation granularity directly.
   mparams.granularity *= GRANULARITY_MULTIPLIER;
 
+  if (mmap_numa_node >= 0) {
+    BindToNumaNode(pointer, size, mmap_numa_node);
+  }
+
   MmapRecord& record = mmap_records[pointer];
   record.fd = fd;
   record.size = size;
+  record.numa_node = mmap_numa_node;
 
   // We lie to dlmalloc about where mapped memory actually lives.
   pointer = pointer_advance(pointer, kMmapRegionsGap);
@@ -161,6 +195,42 @@ int fake_munmap(void* addr, int64_t size) {
   return r;
 }
 
+void* NumaMemalign(int node, size_t alignment, size_t bytes) {
+  // The segments mapped while allocating belong to the arena of the node
+  mmap_numa_node = node;
+  auto it = numa_arenas.find(node);
+  if (it == numa_arenas.end()) {
+    mspace arena = create_mspace(0, 0);
+    if (arena == nullptr) {
+      mmap_numa_node = -1;
+      return nullptr;
+    }
+    it = numa_arenas.emplace(node, arena).first;
+  }
+  void* mem = mspace_memalign(it->second, alignment, bytes);
+  mmap_numa_node = -1;
+  return mem;
+}
+
+void NumaFree(int node, void* mem) {
+  auto it = numa_arenas.find(node);
+  ARROW_CHECK(it != numa_arenas.end()) << "no arena for NUMA node " << node;
+  mspace_free(it->second, mem);
+}
+
+void GetMallocStats(int64_t* footprint, int64_t* free_bytes, int64_t* free_chunks) {
+  struct mallinfo info = dlmallinfo();
+  *footprint = dlmalloc_footprint();
+  *free_bytes = info.fordblks;
+  *free_chunks = info.ordblks;
+  for (const auto& arena : numa_arenas) {
+    info = mspace_mallinfo(arena.second);
+    *footprint += mspace_footprint(arena.second);
+    *free_bytes += info.fordblks;
+    *free_chunks += info.ordblks;
+  }
+}
+
 void SetMallocGranularity(int value) { change_mparam(M_GRANULARITY, value); }
 
 }  // namespace plasma
@@ -20,6 +20,8 @@
 #include <utility>
 
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 extern "C" {
 #include "plasma/thirdparty/ae/ae.h"
@@ -45,7 +47,15 @@ int EventLoop::TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* con
 
 constexpr int kInitialEventLoopSize = 1024;
 
-EventLoop::EventLoop() { loop_ = aeCreateEventLoop(kInitialEventLoopSize); }
+EventLoop::EventLoop() : thread_id_(std::this_thread::get_id()) {
+  loop_ = aeCreateEventLoop(kInitialEventLoopSize);
+  if (pipe(wakeup_fds_) == 0) {
+    fcntl(wakeup_fds_[0], F_SETFL, O_NONBLOCK);
+    fcntl(wakeup_fds_[1], F_SETFL, O_NONBLOCK);
+    AddFileEvent(wakeup_fds_[0], kEventLoopRead,
+                 [this](int events) { RunPostedCallbacks(); });
+  }
+}
 
 bool EventLoop::AddFileEvent(int fd, int events, const FileCallback& callback) {
   if (file_callbacks_.find(fd) != file_callbacks_.end()) {
@@ -76,7 +86,46 @@ void EventLoop::RemoveFileEvent(int fd) {
   file_callbacks_.erase(fd);
 }
 
-void EventLoop::Start() { aeMain(loop_); }
+void EventLoop::Post(const std::function<void()>& callback) {
+  {
+    std::lock_guard<std::mutex> lock(posted_mutex_);
+    posted_callbacks_.push_back(callback);
+  }
+  // A write fails if the pipe is full, in which case the loop is already due
+  // to wake up.
+  char byte = 0;
+  while (write(wakeup_fds_[1], &byte, 1) < 0 && errno == EINTR) {
+  }
+}
+
+void EventLoop::RunInLoop(const std::function<void()>& callback) {
+  if (std::this_thread::get_id() == thread_id_.load()) {
+    callback();
+  } else {
+    Post(callback);
+  }
+}
+
+void EventLoop::RunPostedCallbacks() {
+  // Drain the pipe before taking the callbacks, so that a callback posted
+  // afterwards wakes the loop up again.
+  char buffer[64];
+  while (read(wakeup_fds_[0], buffer, sizeof(buffer)) > 0) {
+  }
+  std::vector<std::function<void()>> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(posted_mutex_);
+    callbacks.swap(posted_callbacks_);
+  }
+  for (const auto& callback : callbacks) {
+    callback();
+  }
+}
+
+void EventLoop::Start() {
+  thread_id_ = std::this_thread::get_id();
+  aeMain(loop_);
+}
 
 void EventLoop::Stop() { aeStop(loop_); }
 
@@ -85,6 +134,12 @@ void EventLoop::Shutdown() {
     aeDeleteEventLoop(loop_);
     loop_ = nullptr;
   }
+  for (int& fd : wakeup_fds_) {
+    if (fd >= 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
 }
 
 EventLoop::~EventLoop() { Shutdown(); }
@@ -17,9 +17,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 struct aeEventLoop;
 
@@ -87,6 +91,18 @@ class EventLoop {
   /// \return The ae.c error code. TODO(pcm): needs to be standardized
   int RemoveTimer(int64_t timer_id);
 
+  /// Run a callback on the thread running the event loop, on its next iteration.
+  /// This is the only method that may be called from other threads.
+  ///
+  /// \param callback The callback to run.
+  void Post(const std::function<void()>& callback);
+
+  /// Run a callback on the thread running the event loop: immediately if called
+  /// from that thread, else as by Post().
+  ///
+  /// \param callback The callback to run.
+  void RunInLoop(const std::function<void()>& callback);
+
   /// \brief Run the event loop.
   void Start();
 
@@ -100,9 +116,18 @@ class EventLoop {
 
   static int TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* context);
 
+  void RunPostedCallbacks();
+
   aeEventLoop* loop_;
   std::unordered_map<int, std::unique_ptr<FileCallback>> file_callbacks_;
   std::unordered_map<int64_t, std::unique_ptr<TimerCallback>> timer_callbacks_;
+
+  /// The thread running the loop (or which created it, until it is started).
+  std::atomic<std::thread::id> thread_id_;
+  /// Pipe written by Post() to wake the loop up.
+  int wakeup_fds_[2] = {-1, -1};
+  std::mutex posted_mutex_;
+  std::vector<std::function<void()>> posted_callbacks_;
 };
 
 }  // namespace plasma
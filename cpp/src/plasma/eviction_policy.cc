@@ -17,6 +17,8 @@
 
 #include "plasma/eviction_policy.h"
 #include "plasma/plasma_allocator.h"
+#include "plasma/quota_aware_policy.h"
+#include "plasma/size_frequency_policy.h"
 
 #include <algorithm>
 #include <sstream>
@@ -172,4 +174,15 @@ int64_t EvictionPolicy::GetObjectSize(const ObjectID& object_id) const {
 
 std::string EvictionPolicy::DebugString() const { return cache_.DebugString(); }
 
+std::unique_ptr<EvictionPolicy> MakeEvictionPolicy(const std::string& name,
+                                                   PlasmaStoreInfo* store_info,
+                                                   int64_t max_size) {
+  if (name == "lru") {
+    return std::unique_ptr<EvictionPolicy>(new QuotaAwarePolicy(store_info, max_size));
+  } else if (name == "size_frequency") {
+    return std::unique_ptr<EvictionPolicy>(new SizeFrequencyPolicy(store_info, max_size));
+  }
+  return nullptr;
+}
+
 }  // namespace plasma
@@ -19,6 +19,7 @@
 
 #include <functional>
 #include <list>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -206,4 +207,18 @@ class EvictionPolicy {
   LRUCache cache_;
 };
 
+/// Create the eviction policy of the given name, or return nullptr if there is
+/// none: "lru" for an LRU policy with client quotas (QuotaAwarePolicy) or
+/// "size_frequency" for a policy keeping small, frequently used objects
+/// (SizeFrequencyPolicy).
+///
+/// \param name The name of the eviction policy.
+/// \param store_info Information about the Plasma store that is exposed
+///        to the eviction policy.
+/// \param max_size Max size in bytes total of objects to store.
+/// \return The eviction policy.
+std::unique_ptr<EvictionPolicy> MakeEvictionPolicy(const std::string& name,
+                                                   PlasmaStoreInfo* store_info,
+                                                   int64_t max_size);
+
 }  // namespace plasma
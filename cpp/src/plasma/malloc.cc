@@ -57,6 +57,15 @@ void GetMallocMapinfo(void* addr, int* fd, int64_t* map_size, ptrdiff_t* offset)
   *offset = 0;
 }
 
+int GetMallocNumaNode(void* addr) {
+  for (const auto& entry : mmap_records) {
+    if (addr >= entry.first && addr < pointer_advance(entry.first, entry.second.size)) {
+      return entry.second.numa_node;
+    }
+  }
+  return -1;
+}
+
 int64_t GetMmapSize(int fd) {
   for (const auto& entry : mmap_records) {
     if (entry.second.fd == fd) {
@@ -32,6 +32,35 @@ constexpr int64_t kMmapRegionsGap = sizeof(size_t);
 
 void GetMallocMapinfo(void* addr, int* fd, int64_t* map_length, ptrdiff_t* offset);
 
+/// Get the NUMA node of the arena a pointer was allocated from.
+///
+/// \param addr The pointer, returned by NumaMemalign() or dlmemalign().
+/// \return The NUMA node, or -1 if the pointer is not in a NUMA arena.
+int GetMallocNumaNode(void* addr);
+
+/// Allocate memory from the arena of a NUMA node, whose memory is preferably
+/// placed on that node. The arena is created on first use.
+///
+/// \param node The NUMA node.
+/// \param alignment Memory alignment, a power of two.
+/// \param bytes Number of bytes.
+/// \return Pointer to the allocated memory, or nullptr.
+void* NumaMemalign(int node, size_t alignment, size_t bytes);
+
+/// Free memory returned by NumaMemalign().
+///
+/// \param node The NUMA node the memory was allocated for.
+/// \param mem Pointer to the memory.
+void NumaFree(int node, void* mem);
+
+/// Get statistics of the allocator, over all its arenas. This walks all the
+/// chunks of memory, so it should not be called for every allocation.
+///
+/// \param[out] footprint The memory mapped by the allocator.
+/// \param[out] free_bytes The memory mapped but not allocated.
+/// \param[out] free_chunks The number of chunks of free memory.
+void GetMallocStats(int64_t* footprint, int64_t* free_bytes, int64_t* free_chunks);
+
 /// Get the mmap size corresponding to a specific file descriptor.
 ///
 /// \param fd The file descriptor to look up.
@@ -41,6 +70,8 @@ int64_t GetMmapSize(int fd);
 struct MmapRecord {
   int fd;
   int64_t size;
+  /// NUMA node of the arena the segment belongs to, or -1.
+  int numa_node = -1;
 };
 
 /// Hashtable that contains one entry per segment that we got from the OS
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "arrow/util/bit_util.h"
+
+namespace plasma {
+
+constexpr int LatencyHistogram::kNumBuckets;
+
+void LatencyHistogram::Record(int64_t latency_us) {
+  latency_us = std::max<int64_t>(latency_us, 0);
+  const int bucket = std::min(
+      arrow::BitUtil::NumRequiredBits(static_cast<uint64_t>(latency_us)),
+      kNumBuckets - 1);
+  buckets[bucket]++;
+  count++;
+  total_us += latency_us;
+  max_us = std::max(max_us, latency_us);
+}
+
+int64_t LatencyHistogram::Percentile(double percentile) const {
+  if (count == 0) {
+    return 0;
+  }
+  const int64_t rank = std::max<int64_t>(
+      1, static_cast<int64_t>(std::ceil(count * std::min(percentile, 100.0) / 100)));
+  int64_t seen = 0;
+  for (int i = 0; i < kNumBuckets - 1; ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      return std::min(int64_t(1) << i, max_us);
+    }
+  }
+  return max_us;
+}
+
+std::string LatencyHistogram::ToString() const {
+  std::stringstream result;
+  result << "count " << count << ", mean " << Mean() << "us, p50 " << Percentile(50)
+         << "us, p99 " << Percentile(99) << "us, max " << max_us << "us";
+  return result.str();
+}
+
+std::string PlasmaMetrics::ToString() const {
+  std::stringstream result;
+  result << "bytes allocated: " << bytes_allocated << "\n";
+  result << "bytes in use: " << bytes_in_use << "\n";
+  result << "evictions: " << num_evictions << ", objects evicted: " << objects_evicted
+         << ", bytes evicted: " << bytes_evicted << "\n";
+  result << "arena footprint: " << arena_footprint << ", free bytes: " << arena_free_bytes
+         << " in " << arena_free_chunks << " chunks\n";
+  for (const auto& latencies : request_latencies) {
+    result << latencies.first << ": " << latencies.second.ToString() << "\n";
+  }
+  if (external_store_put.count > 0 || external_store_get.count > 0) {
+    result << "external store put: " << external_store_put.ToString() << "\n";
+    result << "external store get: " << external_store_get.ToString() << "\n";
+  }
+  return result.str();
+}
+
+}  // namespace plasma
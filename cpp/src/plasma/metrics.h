@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace plasma {
+
+/// A histogram of latencies in microseconds. Bucket 0 counts the latencies
+/// below 1us, and bucket i > 0 those in [2^(i-1), 2^i) us; the last bucket
+/// also counts all the larger latencies.
+struct ARROW_EXPORT LatencyHistogram {
+  static constexpr int kNumBuckets = 32;
+
+  LatencyHistogram() : buckets(kNumBuckets, 0) {}
+
+  /// Add a measurement.
+  void Record(int64_t latency_us);
+
+  /// Get an upper bound of a percentile of the latencies, from the buckets.
+  ///
+  /// \param percentile The percentile, between 0 and 100.
+  /// \return The upper bound of the bucket of the percentile, or 0 if there is
+  ///         no measurement.
+  int64_t Percentile(double percentile) const;
+
+  /// Get the mean of the latencies, or 0 if there is no measurement.
+  double Mean() const { return count > 0 ? static_cast<double>(total_us) / count : 0; }
+
+  std::string ToString() const;
+
+  int64_t count = 0;
+  int64_t total_us = 0;
+  int64_t max_us = 0;
+  std::vector<int64_t> buckets;
+};
+
+/// Metrics of a Plasma store, to tune its memory size and eviction policy.
+struct ARROW_EXPORT PlasmaMetrics {
+  /// The latencies of the requests, from the time they are read until they
+  /// are processed, by message type (e.g. "PlasmaCreateRequest").
+  std::map<std::string, LatencyHistogram> request_latencies;
+  /// The total number of bytes allocated for objects since the store started,
+  /// including the objects restored from the external store.
+  int64_t bytes_allocated = 0;
+  /// The number of bytes currently allocated for objects.
+  int64_t bytes_in_use = 0;
+  /// The number of times objects were evicted to make room for others.
+  int64_t num_evictions = 0;
+  /// The total number of objects and bytes evicted.
+  int64_t objects_evicted = 0;
+  int64_t bytes_evicted = 0;
+  /// The memory mapped by the allocator, and how much of it is free. The
+  /// free memory may be fragmented in many chunks too small for new objects.
+  int64_t arena_footprint = 0;
+  int64_t arena_free_bytes = 0;
+  int64_t arena_free_chunks = 0;
+  /// The latencies of the writes and reads of evicted objects to and from the
+  /// external store, if any.
+  LatencyHistogram external_store_put;
+  LatencyHistogram external_store_get;
+
+  std::string ToString() const;
+};
+
+}  // namespace plasma
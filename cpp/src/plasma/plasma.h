@@ -49,6 +49,8 @@ namespace flatbuf {
 struct ObjectInfoT;
 }  // namespace flatbuf
 
+class EventLoop;
+
 #define HANDLE_SIGPIPE(s, fd_)                                              \
   do {                                                                      \
     Status _s = (s);                                                        \
@@ -87,6 +89,13 @@ struct Client {
   int notification_fd;
 
   std::string name = "anonymous_client";
+
+  /// The event loop handling the requests of the client.
+  EventLoop* loop = nullptr;
+
+  /// The NUMA node the client runs on, on which the objects it creates are
+  /// allocated, or -1 for no particular node.
+  int numa_node = -1;
 };
 
 // TODO(pcm): Replace this by the flatbuffers message PlasmaObjectSpec.
@@ -139,6 +148,8 @@ struct PlasmaStoreInfo {
   bool hugepages_enabled;
   /// A (platform-dependent) directory where to create the memory-backed file.
   std::string directory;
+  /// Whether objects are allocated on the NUMA node of the client creating them.
+  bool numa_aware = false;
 };
 
 /// Get an entry from the object table and return NULL if the object_id
@@ -29,19 +29,32 @@ void dlfree(void* mem);
 
 int64_t PlasmaAllocator::footprint_limit_ = 0;
 int64_t PlasmaAllocator::allocated_ = 0;
+bool PlasmaAllocator::numa_arenas_used_ = false;
 
-void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
+void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes, int numa_node) {
   if (allocated_ + static_cast<int64_t>(bytes) > footprint_limit_) {
     return nullptr;
   }
-  void* mem = dlmemalign(alignment, bytes);
+  void* mem;
+  if (numa_node >= 0) {
+    mem = NumaMemalign(numa_node, alignment, bytes);
+    numa_arenas_used_ = true;
+  } else {
+    mem = dlmemalign(alignment, bytes);
+  }
   ARROW_CHECK(mem);
   allocated_ += bytes;
   return mem;
 }
 
 void PlasmaAllocator::Free(void* mem, size_t bytes) {
-  dlfree(mem);
+  // Only look up the arena of the memory if there is more than one
+  int numa_node = numa_arenas_used_ ? GetMallocNumaNode(mem) : -1;
+  if (numa_node >= 0) {
+    NumaFree(numa_node, mem);
+  } else {
+    dlfree(mem);
+  }
   allocated_ -= bytes;
 }
 
@@ -29,11 +29,13 @@ class PlasmaAllocator {
   ///
   /// \param alignment Memory alignment.
   /// \param bytes Number of bytes.
+  /// \param numa_node NUMA node to place the memory on, from an arena of its
+  ///        own, or -1 for the default arena.
   /// \return Pointer to allocated memory.
-  static void* Memalign(size_t alignment, size_t bytes);
+  static void* Memalign(size_t alignment, size_t bytes, int numa_node = -1);
 
   /// Frees the memory space pointed to by mem, which must have been returned by
-  /// a previous call to Memalign()
+  /// a previous call to Memalign(), whatever its NUMA node
   ///
   /// \param mem Pointer to memory to free.
   /// \param bytes Number of bytes to be freed.
@@ -56,6 +58,8 @@ class PlasmaAllocator {
  private:
   static int64_t allocated_;
   static int64_t footprint_limit_;
+  /// Whether memory was allocated from the arena of a NUMA node.
+  static bool numa_arenas_used_;
 };
 
 }  // namespace plasma
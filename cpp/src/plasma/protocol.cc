@@ -181,6 +181,71 @@ Status ReadGetDebugStringReply(const uint8_t* data, size_t size,
   return Status::OK();
 }
 
+// Get metrics messages.
+
+namespace {
+
+flatbuffers::Offset<fb::LatencyHistogramSpec> ToFlatbuffer(
+    flatbuffers::FlatBufferBuilder* fbb, const std::string& name,
+    const LatencyHistogram& histogram) {
+  return fb::CreateLatencyHistogramSpec(*fbb, fbb->CreateString(name), histogram.count,
+                                        histogram.total_us, histogram.max_us,
+                                        fbb->CreateVector(histogram.buckets));
+}
+
+void FromFlatbuffer(const fb::LatencyHistogramSpec* spec, LatencyHistogram* histogram) {
+  histogram->count = spec->count();
+  histogram->total_us = spec->total_us();
+  histogram->max_us = spec->max_us();
+  histogram->buckets.assign(spec->buckets()->begin(), spec->buckets()->end());
+  histogram->buckets.resize(LatencyHistogram::kNumBuckets, 0);
+}
+
+}  // namespace
+
+Status SendGetMetricsRequest(int sock) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaGetMetricsRequest(fbb);
+  return PlasmaSend(sock, MessageType::PlasmaGetMetricsRequest, &fbb, message);
+}
+
+Status SendGetMetricsReply(int sock, const PlasmaMetrics& metrics) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<fb::LatencyHistogramSpec>> request_latencies;
+  for (const auto& latencies : metrics.request_latencies) {
+    request_latencies.push_back(ToFlatbuffer(&fbb, latencies.first, latencies.second));
+  }
+  auto message = fb::CreatePlasmaGetMetricsReply(
+      fbb, fbb.CreateVector(request_latencies), metrics.bytes_allocated,
+      metrics.bytes_in_use, metrics.num_evictions, metrics.objects_evicted,
+      metrics.bytes_evicted, metrics.arena_footprint, metrics.arena_free_bytes,
+      metrics.arena_free_chunks,
+      ToFlatbuffer(&fbb, "external_store_put", metrics.external_store_put),
+      ToFlatbuffer(&fbb, "external_store_get", metrics.external_store_get));
+  return PlasmaSend(sock, MessageType::PlasmaGetMetricsReply, &fbb, message);
+}
+
+Status ReadGetMetricsReply(const uint8_t* data, size_t size, PlasmaMetrics* metrics) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaGetMetricsReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  metrics->request_latencies.clear();
+  for (const auto spec : *message->request_latencies()) {
+    FromFlatbuffer(spec, &metrics->request_latencies[spec->name()->str()]);
+  }
+  metrics->bytes_allocated = message->bytes_allocated();
+  metrics->bytes_in_use = message->bytes_in_use();
+  metrics->num_evictions = message->num_evictions();
+  metrics->objects_evicted = message->objects_evicted();
+  metrics->bytes_evicted = message->bytes_evicted();
+  metrics->arena_footprint = message->arena_footprint();
+  metrics->arena_free_bytes = message->arena_free_bytes();
+  metrics->arena_free_chunks = message->arena_free_chunks();
+  FromFlatbuffer(message->external_store_put(), &metrics->external_store_put);
+  FromFlatbuffer(message->external_store_get(), &metrics->external_store_get);
+  return Status::OK();
+}
+
 // Create messages.
 
 Status SendCreateRequest(int sock, ObjectID object_id, bool evict_if_full,
@@ -362,6 +427,88 @@ Status ReadCreateAndSealBatchReply(const uint8_t* data, size_t size) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendCreateBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                              bool evict_if_full, const std::vector<int64_t>& data_sizes,
+                              const std::vector<int64_t>& metadata_sizes,
+                              bool contiguous) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaCreateBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()), evict_if_full,
+      ToFlatbuffer(&fbb, data_sizes), ToFlatbuffer(&fbb, metadata_sizes), contiguous);
+  return PlasmaSend(sock, MessageType::PlasmaCreateBatchRequest, &fbb, message);
+}
+
+Status ReadCreateBatchRequest(const uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids, bool* evict_if_full,
+                              std::vector<int64_t>* data_sizes,
+                              std::vector<int64_t>* metadata_sizes, bool* contiguous) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  *evict_if_full = message->evict_if_full();
+  data_sizes->assign(message->data_sizes()->begin(), message->data_sizes()->end());
+  metadata_sizes->assign(message->metadata_sizes()->begin(),
+                         message->metadata_sizes()->end());
+  *contiguous = message->contiguous();
+  if (data_sizes->size() != object_ids->size() ||
+      metadata_sizes->size() != object_ids->size()) {
+    return Status::Invalid("object sizes do not match the object ids");
+  }
+  return Status::OK();
+}
+
+Status SendCreateBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<PlasmaObject>& objects, PlasmaError error,
+                            const std::vector<int>& store_fds,
+                            const std::vector<int64_t>& mmap_sizes) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<PlasmaObjectSpec> specs;
+  for (const auto& object : objects) {
+    specs.push_back(PlasmaObjectSpec(object.store_fd, object.data_offset,
+                                     object.data_size, object.metadata_offset,
+                                     object.metadata_size, object.device_num));
+  }
+  auto message = fb::CreatePlasmaCreateBatchReply(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVectorOfStructs(arrow::util::MakeNonNull(specs.data()), specs.size()),
+      error,
+      fbb.CreateVector(arrow::util::MakeNonNull(store_fds.data()), store_fds.size()),
+      ToFlatbuffer(&fbb, mmap_sizes));
+  return PlasmaSend(sock, MessageType::PlasmaCreateBatchReply, &fbb, message);
+}
+
+Status ReadCreateBatchReply(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<PlasmaObject>* objects,
+                            std::vector<int>* store_fds,
+                            std::vector<int64_t>* mmap_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  ConvertToVector(message->plasma_objects(), objects,
+                  [](const PlasmaObjectSpec& spec) {
+                    PlasmaObject object = {};
+                    object.store_fd = spec.segment_index();
+                    object.data_offset = spec.data_offset();
+                    object.data_size = spec.data_size();
+                    object.metadata_offset = spec.metadata_offset();
+                    object.metadata_size = spec.metadata_size();
+                    object.device_num = spec.device_num();
+                    return object;
+                  });
+  store_fds->assign(message->store_fds()->begin(), message->store_fds()->end());
+  mmap_sizes->assign(message->mmap_sizes()->begin(), message->mmap_sizes()->end());
+  return PlasmaErrorStatus(message->error());
+}
+
 Status SendAbortRequest(int sock, ObjectID object_id) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = fb::CreatePlasmaAbortRequest(fbb, fbb.CreateString(object_id.binary()));
@@ -425,6 +572,56 @@ Status ReadSealReply(const uint8_t* data, size_t size, ObjectID* object_id) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      ToFlatbuffer(&fbb, digests));
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchRequest, &fbb, message);
+}
+
+Status ReadSealBatchRequest(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  ConvertToVector(message->digests(), digests,
+                  [](const flatbuffers::String& element) { return element.str(); });
+  if (digests->size() != object_ids->size()) {
+    return Status::Invalid("object digests do not match the object ids");
+  }
+  for (const auto& digest : *digests) {
+    ARROW_CHECK_EQ(digest.size(), kDigestSize);
+  }
+  return Status::OK();
+}
+
+Status SendSealBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                          PlasmaError error) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealBatchReply(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()), error);
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchReply, &fbb, message);
+}
+
+Status ReadSealBatchReply(const uint8_t* data, size_t size,
+                          std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  return PlasmaErrorStatus(message->error());
+}
+
 // Release messages.
 
 Status SendReleaseRequest(int sock, ObjectID object_id) {
@@ -434,6 +631,23 @@ Status SendReleaseRequest(int sock, ObjectID object_id) {
   return PlasmaSend(sock, MessageType::PlasmaReleaseRequest, &fbb, message);
 }
 
+Status SendReleaseRequests(int sock, const std::vector<ObjectID>& object_ids) {
+  // The messages are framed as by WriteMessage, the store reads them one by one.
+  std::vector<uint8_t> output;
+  for (const auto& object_id : object_ids) {
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.Finish(fb::CreatePlasmaReleaseRequest(fbb, fbb.CreateString(object_id.binary())));
+    const int64_t header[] = {kPlasmaProtocolVersion,
+                              static_cast<int64_t>(MessageType::PlasmaReleaseRequest),
+                              static_cast<int64_t>(fbb.GetSize())};
+    const auto header_bytes = reinterpret_cast<const uint8_t*>(header);
+    output.insert(output.end(), header_bytes, header_bytes + sizeof(header));
+    output.insert(output.end(), fbb.GetBufferPointer(),
+                  fbb.GetBufferPointer() + fbb.GetSize());
+  }
+  return WriteBytes(sock, output.data(), output.size());
+}
+
 Status ReadReleaseRequest(const uint8_t* data, size_t size, ObjectID* object_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaReleaseRequest>(data);
@@ -568,7 +782,8 @@ Status SendListReply(int sock, const ObjectTable& objects) {
     auto info = fb::CreateObjectInfo(fbb, fbb.CreateString(entry.first.binary()),
                                      entry.second->data_size, entry.second->metadata_size,
                                      entry.second->ref_count, entry.second->create_time,
-                                     entry.second->construct_duration, digest);
+                                     entry.second->construct_duration, digest,
+                                     /*is_deletion=*/false, entry.second->numa_node);
     object_infos.push_back(info);
   }
   auto message = fb::CreatePlasmaListReply(
@@ -589,6 +804,7 @@ Status ReadListReply(const uint8_t* data, size_t size, ObjectTable* objects) {
     entry->ref_count = object->ref_count();
     entry->create_time = object->create_time();
     entry->construct_duration = object->construct_duration();
+    entry->numa_node = object->numa_node();
     entry->state = object->digest()->size() == 0 ? ObjectState::PLASMA_CREATED
                                                  : ObjectState::PLASMA_SEALED;
     (*objects)[object_id] = std::move(entry);
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "plasma/metrics.h"
 #include "plasma/plasma.h"
 #include "plasma/plasma_generated.h"
 
@@ -75,6 +76,14 @@ Status SendGetDebugStringReply(int sock, const std::string& debug_string);
 Status ReadGetDebugStringReply(const uint8_t* data, size_t size,
                                std::string* debug_string);
 
+/* Metrics messages. */
+
+Status SendGetMetricsRequest(int sock);
+
+Status SendGetMetricsReply(int sock, const PlasmaMetrics& metrics);
+
+Status ReadGetMetricsReply(const uint8_t* data, size_t size, PlasmaMetrics* metrics);
+
 /* Plasma Create message functions. */
 
 Status SendCreateRequest(int sock, ObjectID object_id, bool evict_if_full,
@@ -119,6 +128,27 @@ Status SendCreateAndSealBatchReply(int sock, PlasmaError error);
 
 Status ReadCreateAndSealBatchReply(const uint8_t* data, size_t size);
 
+Status SendCreateBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                              bool evict_if_full, const std::vector<int64_t>& data_sizes,
+                              const std::vector<int64_t>& metadata_sizes,
+                              bool contiguous);
+
+Status ReadCreateBatchRequest(const uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids, bool* evict_if_full,
+                              std::vector<int64_t>* data_sizes,
+                              std::vector<int64_t>* metadata_sizes, bool* contiguous);
+
+Status SendCreateBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<PlasmaObject>& objects, PlasmaError error,
+                            const std::vector<int>& store_fds,
+                            const std::vector<int64_t>& mmap_sizes);
+
+Status ReadCreateBatchReply(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<PlasmaObject>* objects,
+                            std::vector<int>* store_fds,
+                            std::vector<int64_t>* mmap_sizes);
+
 Status SendAbortRequest(int sock, ObjectID object_id);
 
 Status ReadAbortRequest(const uint8_t* data, size_t size, ObjectID* object_id);
@@ -138,6 +168,19 @@ Status SendSealReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadSealReply(const uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests);
+
+Status ReadSealBatchRequest(const uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids,
+                           std::vector<std::string>* digests);
+
+Status SendSealBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                          PlasmaError error);
+
+Status ReadSealBatchReply(const uint8_t* data, size_t size,
+                          std::vector<ObjectID>* object_ids);
+
 /* Plasma Get message functions. */
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
@@ -159,6 +202,9 @@ Status ReadGetReply(const uint8_t* data, size_t size, ObjectID object_ids[],
 
 Status SendReleaseRequest(int sock, ObjectID object_id);
 
+/// Send a release request for each object with a single write.
+Status SendReleaseRequests(int sock, const std::vector<ObjectID>& object_ids);
+
 Status ReadReleaseRequest(const uint8_t* data, size_t size, ObjectID* object_id);
 
 Status SendReleaseReply(int sock, ObjectID object_id, PlasmaError error);
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/size_frequency_policy.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace plasma {
+
+SizeFrequencyPolicy::SizeFrequencyPolicy(PlasmaStoreInfo* store_info, int64_t max_size)
+    : EvictionPolicy(store_info, max_size),
+      inflation_(0),
+      evictable_bytes_(0),
+      num_evictions_total_(0),
+      bytes_evicted_total_(0) {}
+
+void SizeFrequencyPolicy::MakeEvictable(Entry* entry, const ObjectID& object_id) {
+  ARROW_CHECK(!entry->evictable);
+  // Empty objects are given the priority of one byte objects
+  const double size = static_cast<double>(std::max<int64_t>(entry->size, 1));
+  const double priority = inflation_ + entry->frequency / size;
+  entry->position = priorities_.emplace(priority, object_id);
+  entry->evictable = true;
+  evictable_bytes_ += entry->size;
+}
+
+void SizeFrequencyPolicy::MakeUnevictable(Entry* entry) {
+  if (entry->evictable) {
+    priorities_.erase(entry->position);
+    entry->evictable = false;
+    evictable_bytes_ -= entry->size;
+  }
+}
+
+void SizeFrequencyPolicy::ObjectCreated(const ObjectID& object_id, Client* client,
+                                        bool is_create) {
+  ARROW_CHECK(entries_.find(object_id) == entries_.end());
+  Entry& entry = entries_[object_id];
+  entry.size = GetObjectSize(object_id);
+  entry.frequency = 1;
+  entry.evictable = false;
+  MakeEvictable(&entry, object_id);
+}
+
+int64_t SizeFrequencyPolicy::ChooseObjectsToEvict(
+    int64_t num_bytes_required, std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  while (bytes_evicted < num_bytes_required && !priorities_.empty()) {
+    auto it = priorities_.begin();
+    const ObjectID object_id = it->second;
+    inflation_ = it->first;
+    auto entry = entries_.find(object_id);
+    bytes_evicted += entry->second.size;
+    MakeUnevictable(&entry->second);
+    entries_.erase(entry);
+    objects_to_evict->push_back(object_id);
+    num_evictions_total_ += 1;
+  }
+  bytes_evicted_total_ += bytes_evicted;
+  return bytes_evicted;
+}
+
+void SizeFrequencyPolicy::BeginObjectAccess(const ObjectID& object_id) {
+  auto entry = entries_.find(object_id);
+  ARROW_CHECK(entry != entries_.end());
+  MakeUnevictable(&entry->second);
+  entry->second.frequency += 1;
+  pinned_memory_bytes_ += entry->second.size;
+}
+
+void SizeFrequencyPolicy::EndObjectAccess(const ObjectID& object_id) {
+  auto entry = entries_.find(object_id);
+  ARROW_CHECK(entry != entries_.end());
+  MakeEvictable(&entry->second, object_id);
+  pinned_memory_bytes_ -= entry->second.size;
+}
+
+void SizeFrequencyPolicy::RemoveObject(const ObjectID& object_id) {
+  auto entry = entries_.find(object_id);
+  if (entry != entries_.end()) {
+    MakeUnevictable(&entry->second);
+    entries_.erase(entry);
+  }
+}
+
+void SizeFrequencyPolicy::RefreshObjects(const std::vector<ObjectID>& object_ids) {
+  for (const auto& object_id : object_ids) {
+    auto entry = entries_.find(object_id);
+    if (entry != entries_.end() && entry->second.evictable) {
+      MakeUnevictable(&entry->second);
+      entry->second.frequency += 1;
+      MakeEvictable(&entry->second, object_id);
+    }
+  }
+}
+
+std::string SizeFrequencyPolicy::DebugString() const {
+  std::stringstream result;
+  result << "\n(size frequency) num objects: " << entries_.size();
+  result << "\n(size frequency) evictable objects: " << priorities_.size();
+  result << "\n(size frequency) evictable bytes: " << evictable_bytes_;
+  result << "\n(size frequency) num evictions: " << num_evictions_total_;
+  result << "\n(size frequency) bytes evicted: " << bytes_evicted_total_;
+  result << "\npinned bytes: " << pinned_memory_bytes_;
+  return result.str();
+}
+
+}  // namespace plasma
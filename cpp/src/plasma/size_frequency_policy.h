@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "plasma/common.h"
+#include "plasma/eviction_policy.h"
+#include "plasma/plasma.h"
+
+namespace plasma {
+
+/// An eviction policy which keeps small, frequently used objects over large or
+/// rarely used ones (GreedyDual-Size-Frequency).
+///
+/// Each unused object has the priority L + frequency / size, where frequency is
+/// the number of times the object started to be used or was refreshed, and L
+/// is the priority of the last evicted object. Objects are evicted in the order
+/// of increasing priority, so that a large object read once is evicted before a
+/// small one read often, while L ages out objects which are no longer used.
+///
+/// Client quotas are not supported.
+class SizeFrequencyPolicy : public EvictionPolicy {
+ public:
+  explicit SizeFrequencyPolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+  void ObjectCreated(const ObjectID& object_id, Client* client, bool is_create) override;
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+  void BeginObjectAccess(const ObjectID& object_id) override;
+  void EndObjectAccess(const ObjectID& object_id) override;
+  void RemoveObject(const ObjectID& object_id) override;
+  void RefreshObjects(const std::vector<ObjectID>& object_ids) override;
+  std::string DebugString() const override;
+
+ private:
+  /// The unused objects by priority.
+  typedef std::multimap<double, ObjectID> PriorityMap;
+
+  struct Entry {
+    int64_t size;
+    int64_t frequency;
+    /// Whether the object is unused, and so in priorities_.
+    bool evictable;
+    PriorityMap::iterator position;
+  };
+
+  /// Insert an unused object in priorities_.
+  void MakeEvictable(Entry* entry, const ObjectID& object_id);
+
+  /// Remove an object from priorities_, if it is there.
+  void MakeUnevictable(Entry* entry);
+
+  std::unordered_map<ObjectID, Entry> entries_;
+  PriorityMap priorities_;
+  /// The priority of the last evicted object.
+  double inflation_;
+  /// The number of bytes of the unused objects.
+  int64_t evictable_bytes_;
+  /// The number of objects evicted.
+  int64_t num_evictions_total_;
+  /// The number of bytes evicted.
+  int64_t bytes_evicted_total_;
+};
+
+}  // namespace plasma
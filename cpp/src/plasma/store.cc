@@ -18,10 +18,13 @@
 // PLASMA STORE: This is a simple object store server process
 //
 // It accepts incoming client connections on a unix domain socket
-// (name passed in via the -s option of the executable) and uses a
-// single thread to serve the clients. Each client establishes a
-// connection and can create objects, wait for objects and seal
-// objects through that connection.
+// (name passed in via the -s option of the executable) and serves the
+// clients with one or more threads (-t option), each running an event
+// loop. Each client establishes a connection and can create objects,
+// wait for objects and seal objects through that connection. Unused
+// objects are evicted by an LRU policy, or by the policy named by the -p
+// option (see MakeEvictionPolicy). With the -n option, objects are allocated
+// on the NUMA node the creating client runs on.
 //
 // It keeps a hash table that maps object_ids (which are 20 byte long,
 // just enough to store and SHA1 hash) to memory mapped files.
@@ -29,6 +32,7 @@
 #include "plasma/store.h"
 
 #include <assert.h>
+#include <dirent.h>
 #include <fcntl.h>
 #include <getopt.h>
 #include <limits.h>
@@ -43,16 +47,24 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <ctime>
 #include <deque>
+#include <fstream>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/thread_pool.h"
 
 #include "plasma/common.h"
 #include "plasma/common_generated.h"
@@ -83,6 +95,8 @@ struct GetRequest {
   GetRequest(Client* client, const std::vector<ObjectID>& object_ids);
   /// The client that called get.
   Client* client;
+  /// Identifies the request in the timer callback, see timed_get_requests_.
+  int64_t id;
   /// The ID of the timer that will time out and cause this wait to return to
   ///  the client if it hasn't already returned.
   int64_t timer;
@@ -100,6 +114,7 @@ struct GetRequest {
 
 GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
     : client(client),
+      id(-1),
       timer(-1),
       object_ids(object_ids.begin(), object_ids.end()),
       objects(object_ids.size()),
@@ -110,14 +125,94 @@ GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
 
 Client::Client(int fd) : fd(fd), notification_fd(-1) {}
 
+static int64_t MicrosecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// Records the latency of a request in a histogram when it goes out of scope,
+// however the request returns.
+class RequestTimer {
+ public:
+  RequestTimer(std::chrono::steady_clock::time_point start, LatencyHistogram* histogram)
+      : start_(start), histogram_(histogram) {}
+
+  ~RequestTimer() {
+    if (histogram_ != nullptr) {
+      histogram_->Record(MicrosecondsSince(start_));
+    }
+  }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+  LatencyHistogram* histogram_;
+};
+
+// Get the NUMA node of the CPU the process at the other end of a unix domain
+// socket last ran on, 0 if the system has no NUMA nodes, or -1 if unknown.
+static int GetPeerNumaNode(int fd) {
+#ifdef __linux__
+  struct ucred credentials;
+  socklen_t length = sizeof(credentials);
+  if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) != 0) {
+    return -1;
+  }
+  // The CPU is the 39th field of /proc/<pid>/stat, the 2nd (the command
+  // name, in parentheses) may contain spaces.
+  std::ifstream stat_file("/proc/" + std::to_string(credentials.pid) + "/stat");
+  std::string stat;
+  std::getline(stat_file, stat);
+  auto end_of_name = stat.rfind(')');
+  if (end_of_name == std::string::npos) {
+    return -1;
+  }
+  std::istringstream fields(stat.substr(end_of_name + 1));
+  std::string field;
+  for (int i = 3; i <= 39 && fields >> field; ++i) {
+  }
+  int cpu;
+  if (!fields || sscanf(field.c_str(), "%d", &cpu) != 1) {
+    return -1;
+  }
+  // The node of the CPU is the "node<N>" entry of its sysfs directory
+  std::string cpu_directory = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+  DIR* directory = opendir(cpu_directory.c_str());
+  if (directory == nullptr) {
+    return -1;
+  }
+  int node = 0;
+  while (struct dirent* entry = readdir(directory)) {
+    if (sscanf(entry->d_name, "node%d", &node) == 1) {
+      break;
+    }
+  }
+  closedir(directory);
+  return node;
+#else
+  return -1;
+#endif
+}
+
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
-                         std::shared_ptr<ExternalStore> external_store)
+                         std::shared_ptr<ExternalStore> external_store,
+                         const std::string& eviction_policy, bool numa_aware)
     : loop_(loop),
-      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
-      external_store_(external_store) {
+      client_loops_{loop},
+      eviction_policy_(MakeEvictionPolicy(eviction_policy, &store_info_,
+                                          PlasmaAllocator::GetFootprintLimit())),
+      external_store_(external_store),
+      max_spilling_bytes_(PlasmaAllocator::GetFootprintLimit() / 4),
+      request_latencies_(static_cast<size_t>(fb::MessageType::MAX) + 1) {
+  ARROW_CHECK(eviction_policy_ != nullptr)
+      << "unknown eviction policy \"" << eviction_policy << "\"";
+  if (external_store_) {
+    ARROW_CHECK_OK(arrow::internal::ThreadPool::Make(1).Value(&external_store_pool_));
+  }
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
+  store_info_.numa_aware = numa_aware;
 #ifdef PLASMA_CUDA
   auto maybe_manager = CudaDeviceManager::Instance();
   DCHECK_OK(maybe_manager.status());
@@ -126,10 +221,20 @@ PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  // Finish writing the evicted objects to the external store
+  if (external_store_pool_) {
+    ARROW_CHECK_OK(external_store_pool_->Shutdown(/*wait=*/true));
+  }
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
+void PlasmaStore::AddEventLoop(EventLoop* loop) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  client_loops_.push_back(loop);
+}
+
 // If this client is not already using the object, add the client to the
 // object's list of clients, otherwise do nothing.
 void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
@@ -142,7 +247,7 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
   // that the object is being used.
   if (entry->ref_count == 0) {
     // Tell the eviction policy that this object is being used.
-    eviction_policy_.BeginObjectAccess(object_id);
+    eviction_policy_->BeginObjectAccess(object_id);
   }
   // Increase reference count.
   entry->ref_count++;
@@ -158,7 +263,7 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
   // First free up space from the client's LRU queue if quota enforcement is on.
   if (evict_if_full) {
     std::vector<ObjectID> client_objects_to_evict;
-    bool quota_ok = eviction_policy_.EnforcePerClientQuota(client, size, is_create,
+    bool quota_ok = eviction_policy_->EnforcePerClientQuota(client, size, is_create,
                                                            &client_objects_to_evict);
     if (!quota_ok) {
       return nullptr;
@@ -176,7 +281,8 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
     // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
     // it is not guaranteed that the corresponding pointer in the client will be
     // 64-byte aligned, but in practice it often will be.
-    pointer = reinterpret_cast<uint8_t*>(PlasmaAllocator::Memalign(kBlockSize, size));
+    pointer = reinterpret_cast<uint8_t*>(PlasmaAllocator::Memalign(
+        kBlockSize, size, client != nullptr ? client->numa_node : -1));
     if (pointer || !evict_if_full) {
       // If we manage to allocate the memory, return the pointer. If we cannot
       // allocate the space, but we are also not allowed to evict anything to
@@ -185,7 +291,7 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
     }
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
-    bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
+    bool success = eviction_policy_->RequireSpace(size, &objects_to_evict);
     EvictObjects(objects_to_evict);
     // Return an error to the client if not enough space could be freed to
     // create the object.
@@ -197,6 +303,7 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
   if (pointer != nullptr) {
     GetMallocMapinfo(pointer, fd, map_size, offset);
     ARROW_CHECK(*fd != -1);
+    metrics_.bytes_allocated += size;
   }
   return pointer;
 }
@@ -266,8 +373,82 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
 #endif
   }
 
+  AddCreatedObject(object_id, data_size, metadata_size, device_num, pointer, fd, map_size,
+                   offset, client, result);
+  return PlasmaError::OK;
+}
+
+PlasmaError PlasmaStore::CreateObjectBatch(const std::vector<ObjectID>& object_ids,
+                                           bool evict_if_full,
+                                           const std::vector<int64_t>& data_sizes,
+                                           const std::vector<int64_t>& metadata_sizes,
+                                           bool contiguous, Client* client,
+                                           std::vector<PlasmaObject>* results) {
+  results->assign(object_ids.size(), PlasmaObject());
+  if (!contiguous) {
+    PlasmaError error_code = PlasmaError::OK;
+    size_t i;
+    for (i = 0; i < object_ids.size(); i++) {
+      error_code = CreateObject(object_ids[i], evict_if_full, data_sizes[i],
+                                metadata_sizes[i], /*device_num=*/0, client,
+                                &(*results)[i]);
+      if (error_code != PlasmaError::OK) {
+        break;
+      }
+    }
+    // Abort the objects created before the error
+    if (error_code != PlasmaError::OK) {
+      for (size_t j = 0; j < i; j++) {
+        AbortObject(object_ids[j], client);
+      }
+    }
+    return error_code;
+  }
+
+  // Lay the objects out in one region, each aligned like separate allocations
+  std::unordered_set<ObjectID> unique_ids;
+  std::vector<int64_t> offsets;
+  int64_t total_size = 0;
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    if (GetObjectTableEntry(&store_info_, object_ids[i]) != nullptr ||
+        !unique_ids.insert(object_ids[i]).second) {
+      return PlasmaError::ObjectExists;
+    }
+    offsets.push_back(total_size);
+    total_size += arrow::BitUtil::RoundUp(data_sizes[i] + metadata_sizes[i], kBlockSize);
+  }
+  if (object_ids.empty()) {
+    return PlasmaError::OK;
+  }
+
+  int fd = -1;
+  int64_t map_size = 0;
+  ptrdiff_t offset = 0;
+  uint8_t* pointer =
+      AllocateMemory(total_size, evict_if_full, &fd, &map_size, &offset, client, true);
+  if (!pointer) {
+    ARROW_LOG(ERROR) << "Not enough memory to create a batch of " << object_ids.size()
+                     << " objects of " << total_size << " bytes";
+    return PlasmaError::OutOfMemory;
+  }
+  contiguous_regions_[pointer] = {total_size, object_ids.size()};
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    AddCreatedObject(object_ids[i], data_sizes[i], metadata_sizes[i], /*device_num=*/0,
+                     pointer + offsets[i], fd, map_size, offset + offsets[i], client,
+                     &(*results)[i]);
+    object_regions_[object_ids[i]] = pointer;
+  }
+  return PlasmaError::OK;
+}
+
+void PlasmaStore::AddCreatedObject(const ObjectID& object_id, int64_t data_size,
+                                   int64_t metadata_size, int device_num,
+                                   uint8_t* pointer, int fd, int64_t map_size,
+                                   ptrdiff_t offset, Client* client,
+                                   PlasmaObject* result) {
   auto ptr = std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry());
-  entry = store_info_.objects.emplace(object_id, std::move(ptr)).first->second.get();
+  auto entry =
+      store_info_.objects.emplace(object_id, std::move(ptr)).first->second.get();
   entry->data_size = data_size;
   entry->metadata_size = metadata_size;
   entry->pointer = pointer;
@@ -277,6 +458,7 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
   entry->offset = offset;
   entry->state = ObjectState::PLASMA_CREATED;
   entry->device_num = device_num;
+  entry->numa_node = device_num == 0 ? GetMallocNumaNode(pointer) : -1;
   entry->create_time = std::time(nullptr);
   entry->construct_duration = -1;
 
@@ -293,10 +475,9 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
   // Notify the eviction policy that this object was created. This must be done
   // immediately before the call to AddToClientObjectIds so that the
   // eviction policy does not have an opportunity to evict the object.
-  eviction_policy_.ObjectCreated(object_id, client, true);
+  eviction_policy_->ObjectCreated(object_id, client, true);
   // Record that this client is using this object.
-  AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
-  return PlasmaError::OK;
+  AddToClientObjectIds(object_id, entry, client);
 }
 
 void PlasmaObject_init(PlasmaObject* object, ObjectTableEntry* entry) {
@@ -335,9 +516,13 @@ void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
       }
     }
   }
-  // Remove the get request.
+  // Remove the get request. The timer is on the loop of the client, which may be
+  // run by another thread, in which case it may fire before it is removed.
   if (get_request->timer != -1) {
-    ARROW_CHECK(loop_->RemoveTimer(get_request->timer) == kEventLoopOk);
+    timed_get_requests_.erase(get_request->id);
+    EventLoop* loop = get_request->client->loop;
+    int64_t timer = get_request->timer;
+    loop->RunInLoop([loop, timer]() { loop->RemoveTimer(timer); });
   }
   delete get_request;
 }
@@ -448,8 +633,8 @@ void PlasmaStore::ProcessGetRequest(Client* client,
                                     int64_t timeout_ms) {
   // Create a get request for this object.
   auto get_req = new GetRequest(client, object_ids);
-  std::vector<ObjectID> evicted_ids;
-  std::vector<ObjectTableEntry*> evicted_entries;
+  std::vector<ObjectID> restore_ids;
+  std::vector<ObjectTableEntry*> restore_entries;
   for (auto object_id : object_ids) {
     // Check if this object is already present locally. If so, record that the
     // object is being used and mark it as accounted for.
@@ -461,27 +646,23 @@ void PlasmaStore::ProcessGetRequest(Client* client,
       // If necessary, record that this client is using this object. In the case
       // where entry == NULL, this will be called from SealObject.
       AddToClientObjectIds(object_id, entry, client);
-    } else if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
-      // Make sure the object pointer is not already allocated
-      ARROW_CHECK(!entry->pointer);
-
-      entry->pointer =
-          AllocateMemory(entry->data_size + entry->metadata_size, /*evict=*/true,
-                         &entry->fd, &entry->map_size, &entry->offset, client, false);
-      if (entry->pointer) {
-        entry->state = ObjectState::PLASMA_CREATED;
-        entry->create_time = std::time(nullptr);
-        eviction_policy_.ObjectCreated(object_id, client, false);
-        AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
-        evicted_ids.push_back(object_id);
-        evicted_entries.push_back(entry);
+    } else if (entry && entry->state == ObjectState::PLASMA_EVICTED &&
+               spilling_objects_.count(object_id) > 0) {
+      // The object is still being written to the external store, restore it
+      // from its copy.
+      if (RestoreObject(object_id, entry, *spilling_objects_[object_id])) {
+        PlasmaObject_init(&get_req->objects[object_id], entry);
+        get_req->num_satisfied += 1;
+        AddToClientObjectIds(object_id, entry, client);
       } else {
-        // We are out of memory and cannot allocate memory for this object.
-        // Change the state of the object back to PLASMA_EVICTED so some
-        // other request can try again.
-        entry->state = ObjectState::PLASMA_EVICTED;
+        get_req->objects[object_id].data_size = -1;
       }
     } else {
+      if (entry && entry->state == ObjectState::PLASMA_EVICTED &&
+          restoring_objects_.count(object_id) == 0) {
+        restore_ids.push_back(object_id);
+        restore_entries.push_back(entry);
+      }
       // Add a placeholder plasma object to the get request to indicate that the
       // object is not present. This will be parsed by the client. We set the
       // data size to -1 to indicate that the object is not present.
@@ -491,31 +672,8 @@ void PlasmaStore::ProcessGetRequest(Client* client,
     }
   }
 
-  if (!evicted_ids.empty()) {
-    unsigned char digest[kDigestSize];
-    std::vector<std::shared_ptr<Buffer>> buffers;
-    for (size_t i = 0; i < evicted_ids.size(); ++i) {
-      ARROW_CHECK(evicted_entries[i]->pointer != nullptr);
-      buffers.emplace_back(new arrow::MutableBuffer(evicted_entries[i]->pointer,
-                                                    evicted_entries[i]->data_size));
-    }
-    if (external_store_->Get(evicted_ids, buffers).ok()) {
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_SEALED;
-        std::memcpy(&evicted_entries[i]->digest[0], &digest[0], kDigestSize);
-        evicted_entries[i]->construct_duration =
-            std::time(nullptr) - evicted_entries[i]->create_time;
-        PlasmaObject_init(&get_req->objects[evicted_ids[i]], evicted_entries[i]);
-        get_req->num_satisfied += 1;
-      }
-    } else {
-      // We tried to get the objects from the external store, but could not get them.
-      // Set the state of these objects back to PLASMA_EVICTED so some other request
-      // can try again.
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_EVICTED;
-      }
-    }
+  if (!restore_ids.empty()) {
+    StartRestoringObjects(restore_ids, restore_entries);
   }
 
   // If all of the objects are present already or if the timeout is 0, return to
@@ -525,10 +683,18 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   } else if (timeout_ms != -1) {
     // Set a timer that will cause the get request to return to the client. Note
     // that a timeout of -1 is used to indicate that no timer should be set.
-    get_req->timer = loop_->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
-      ReturnFromGet(get_req);
-      return kEventLoopTimerDone;
-    });
+    get_req->id = next_get_request_id_++;
+    const int64_t request_id = get_req->id;
+    get_req->timer =
+        client->loop->AddTimer(timeout_ms, [this, request_id](int64_t timer_id) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          auto it = timed_get_requests_.find(request_id);
+          if (it != timed_get_requests_.end()) {
+            ReturnFromGet(it->second);
+          }
+          return kEventLoopTimerDone;
+        });
+    timed_get_requests_[request_id] = get_req;
   }
 }
 
@@ -545,7 +711,7 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
     if (entry->ref_count == 0) {
       if (deletion_cache_.count(object_id) == 0) {
         // Tell the eviction policy that this object is no longer being used.
-        eviction_policy_.EndObjectAccess(object_id);
+        eviction_policy_->EndObjectAccess(object_id);
       } else {
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
@@ -563,17 +729,36 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
 
 void PlasmaStore::EraseFromObjectTable(const ObjectID& object_id) {
   auto& object = store_info_.objects[object_id];
-  auto buff_size = object->data_size + object->metadata_size;
   if (object->device_num == 0) {
-    PlasmaAllocator::Free(object->pointer, buff_size);
+    FreeObjectMemory(object_id, object.get());
   } else {
 #ifdef PLASMA_CUDA
+    auto buff_size = object->data_size + object->metadata_size;
     ARROW_CHECK_OK(FreeCudaMemory(object->device_num, buff_size, object->pointer));
 #endif
   }
   store_info_.objects.erase(object_id);
 }
 
+void PlasmaStore::FreeObjectMemory(const ObjectID& object_id, ObjectTableEntry* entry) {
+  if (entry->pointer == nullptr) {
+    // The object was evicted to the external store
+    return;
+  }
+  auto it = object_regions_.find(object_id);
+  if (it == object_regions_.end()) {
+    PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+    return;
+  }
+  auto region = contiguous_regions_.find(it->second);
+  ARROW_CHECK(region != contiguous_regions_.end());
+  object_regions_.erase(it);
+  if (--region->second.num_objects == 0) {
+    PlasmaAllocator::Free(region->first, region->second.size);
+    contiguous_regions_.erase(region);
+  }
+}
+
 void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   ARROW_CHECK(entry != nullptr);
@@ -663,7 +848,7 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
     return PlasmaError::ObjectInUse;
   }
 
-  eviction_policy_.RemoveObject(object_id);
+  eviction_policy_->RemoveObject(object_id);
   EraseFromObjectTable(object_id);
   // Inform all subscribers that the object has been deleted.
   fb::ObjectInfoT notification;
@@ -678,9 +863,14 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
   if (object_ids.size() == 0) {
     return;
   }
-
-  std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
-  std::vector<ObjectTableEntry*> evicted_entries;
+  metrics_.num_evictions++;
+  metrics_.objects_evicted += object_ids.size();
+
+  std::vector<ObjectID> staged_object_ids;
+  std::vector<std::shared_ptr<arrow::Buffer>> staged_object_data;
+  std::vector<ObjectID> unstaged_object_ids;
+  std::vector<std::shared_ptr<arrow::Buffer>> unstaged_object_data;
+  int64_t staged_bytes = 0;
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "evicting object " << object_id.hex();
     auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -692,14 +882,31 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
         << "To evict an object it must have been sealed.";
     ARROW_CHECK(entry->ref_count == 0)
         << "To evict an object, there must be no clients currently using it.";
+    metrics_.bytes_evicted += entry->data_size + entry->metadata_size;
 
-    // If there is a backing external store, then mark object for eviction to
-    // external store, free the object data pointer and keep a placeholder
-    // entry in ObjectTable
+    // If there is a backing external store, then copy the object to the
+    // staging area if it has room left, free the object data pointer and keep
+    // a placeholder entry in ObjectTable.  Objects not fitting in the staging
+    // area are written to the external store from the object memory before
+    // it is freed.
     if (external_store_) {
-      evicted_object_data.push_back(std::make_shared<arrow::Buffer>(
-          entry->pointer, entry->data_size + entry->metadata_size));
-      evicted_entries.push_back(entry);
+      const int64_t size = entry->data_size + entry->metadata_size;
+      if (spilling_bytes_ + size <= max_spilling_bytes_) {
+        std::shared_ptr<Buffer> staging;
+        ARROW_CHECK_OK(arrow::AllocateBuffer(size).Value(&staging));
+        std::memcpy(staging->mutable_data(), entry->pointer, size);
+        FreeObjectMemory(object_id, entry);
+        entry->pointer = nullptr;
+        entry->state = ObjectState::PLASMA_EVICTED;
+        spilling_objects_[object_id] = staging;
+        spilling_bytes_ += size;
+        staged_bytes += size;
+        staged_object_ids.push_back(object_id);
+        staged_object_data.push_back(std::move(staging));
+      } else {
+        unstaged_object_ids.push_back(object_id);
+        unstaged_object_data.push_back(std::make_shared<Buffer>(entry->pointer, size));
+      }
     } else {
       // If there is no backing external store, just erase the object entry
       // and send a deletion notification.
@@ -712,29 +919,138 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     }
   }
 
-  if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
-    for (auto entry : evicted_entries) {
-      PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+  if (!staged_object_ids.empty()) {
+    auto external_store = external_store_;
+    ARROW_CHECK_OK(external_store_pool_->Spawn([this, external_store, staged_object_ids,
+                                                staged_object_data, staged_bytes]() {
+      const auto start = std::chrono::steady_clock::now();
+      ARROW_CHECK_OK(external_store->Put(staged_object_ids, staged_object_data));
+      const int64_t latency_us = MicrosecondsSince(start);
+      loop_->Post([this, staged_object_ids, staged_object_data, staged_bytes,
+                   latency_us]() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        metrics_.external_store_put.Record(latency_us);
+        spilling_bytes_ -= staged_bytes;
+        for (size_t i = 0; i < staged_object_ids.size(); ++i) {
+          // The object may have been restored and evicted again since
+          auto it = spilling_objects_.find(staged_object_ids[i]);
+          if (it != spilling_objects_.end() && it->second == staged_object_data[i]) {
+            spilling_objects_.erase(it);
+          }
+        }
+      });
+    }));
+  }
+
+  if (!unstaged_object_ids.empty()) {
+    // The staging area is full: write the objects synchronously, after the
+    // pending writes as the external store is only used by its pool's thread
+    auto external_store = external_store_;
+    const auto start = std::chrono::steady_clock::now();
+    arrow::Future<Status> put;
+    ARROW_CHECK_OK(external_store_pool_
+                       ->Submit([external_store, unstaged_object_ids,
+                                 unstaged_object_data]() {
+                         return external_store->Put(unstaged_object_ids,
+                                                    unstaged_object_data);
+                       })
+                       .Value(&put));
+    ARROW_CHECK_OK(put.status());
+    metrics_.external_store_put.Record(MicrosecondsSince(start));
+    for (const auto& object_id : unstaged_object_ids) {
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      FreeObjectMemory(object_id, entry);
       entry->pointer = nullptr;
       entry->state = ObjectState::PLASMA_EVICTED;
     }
   }
 }
 
+bool PlasmaStore::RestoreObject(const ObjectID& object_id, ObjectTableEntry* entry,
+                                const Buffer& data) {
+  // Make sure the object pointer is not already allocated
+  ARROW_CHECK(!entry->pointer);
+  const int64_t size = entry->data_size + entry->metadata_size;
+  ARROW_CHECK(data.size() == size);
+  entry->pointer = AllocateMemory(size, /*evict=*/true, &entry->fd, &entry->map_size,
+                                  &entry->offset, nullptr, false);
+  if (!entry->pointer) {
+    // We are out of memory and cannot allocate memory for this object. Keep the
+    // object evicted so some other request can try again.
+    ARROW_LOG(WARNING) << "Not enough memory to restore the object " << object_id.hex();
+    return false;
+  }
+  std::memcpy(entry->pointer, data.data(), size);
+  entry->state = ObjectState::PLASMA_SEALED;
+  entry->create_time = std::time(nullptr);
+  entry->construct_duration = 0;
+  entry->numa_node = -1;
+  eviction_policy_->ObjectCreated(object_id, nullptr, false);
+  return true;
+}
+
+void PlasmaStore::StartRestoringObjects(const std::vector<ObjectID>& object_ids,
+                                        const std::vector<ObjectTableEntry*>& entries) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    std::shared_ptr<Buffer> buffer;
+    ARROW_CHECK_OK(
+        arrow::AllocateBuffer(entries[i]->data_size + entries[i]->metadata_size)
+            .Value(&buffer));
+    buffers.push_back(std::move(buffer));
+    restoring_objects_.insert(object_ids[i]);
+  }
+  auto external_store = external_store_;
+  ARROW_CHECK_OK(external_store_pool_->Spawn([this, external_store, object_ids,
+                                              buffers]() {
+    const auto start = std::chrono::steady_clock::now();
+    Status status = external_store->Get(object_ids, buffers);
+    const int64_t latency_us = MicrosecondsSince(start);
+    loop_->Post([this, object_ids, buffers, status, latency_us]() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      metrics_.external_store_get.Record(latency_us);
+      for (size_t i = 0; i < object_ids.size(); ++i) {
+        restoring_objects_.erase(object_ids[i]);
+        if (!status.ok()) {
+          // Keep the objects evicted so some other request can try again
+          ARROW_LOG(WARNING) << "Failed to restore the object " << object_ids[i].hex()
+                             << " from the external store: " << status.ToString();
+          continue;
+        }
+        // The object may have been deleted, or restored from its copy, since
+        auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
+        if (entry != nullptr && entry->state == ObjectState::PLASMA_EVICTED &&
+            RestoreObject(object_ids[i], entry, *buffers[i])) {
+          UpdateObjectGetRequests(object_ids[i]);
+        }
+      }
+    });
+  }));
+}
+
 void PlasmaStore::ConnectClient(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
+  std::lock_guard<std::mutex> lock(mutex_);
   Client* client = new Client(client_fd);
   connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  if (store_info_.numa_aware) {
+    client->numa_node = GetPeerNumaNode(client_fd);
+  }
+
+  // Spread the clients over the event loops, round robin.
+  EventLoop* loop = client_loops_[next_client_loop_++ % client_loops_.size()];
+  client->loop = loop;
 
   // Add a callback to handle events on this socket.
   // TODO(pcm): Check return value.
-  loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
-    Status s = ProcessMessage(client);
-    if (!s.ok()) {
-      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
-    }
+  loop->RunInLoop([this, loop, client, client_fd]() {
+    loop->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
+      Status s = ProcessMessage(client);
+      if (!s.ok()) {
+        ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+      }
+    });
   });
   ARROW_LOG(DEBUG) << "New connection with fd " << client_fd;
 }
@@ -743,13 +1059,14 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   ARROW_CHECK(client_fd > 0);
   auto it = connected_clients_.find(client_fd);
   ARROW_CHECK(it != connected_clients_.end());
-  loop_->RemoveFileEvent(client_fd);
+  // Called from the client's own loop, in ProcessMessage.
+  it->second->loop->RemoveFileEvent(client_fd);
   // Close the socket.
   close(client_fd);
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
   // Release all the objects that the client was using.
   auto client = it->second.get();
-  eviction_policy_.ClientDisconnected(client);
+  eviction_policy_->ClientDisconnected(client);
   std::unordered_map<ObjectID, ObjectTableEntry*> sealed_objects;
   for (const auto& object_id : client->object_ids) {
     auto it = store_info_.objects.find(object_id);
@@ -778,7 +1095,7 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   if (client->notification_fd > 0) {
     // This client has subscribed for notifications.
     auto notify_fd = client->notification_fd;
-    loop_->RemoveFileEvent(notify_fd);
+    client->loop->RemoveFileEvent(notify_fd);
     // Close socket.
     close(notify_fd);
     // Remove notification queue for this fd from global map.
@@ -821,15 +1138,12 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
                (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
       ARROW_LOG(DEBUG) << "The socket's send buffer is full, so we are caching this "
                           "notification and will send it later.";
-      // Add a callback to the event loop to send queued notifications whenever
-      // there is room in the socket's send buffer. Callbacks can be added
-      // more than once here and will be overwritten. The callback is removed
-      // at the end of the method.
-      // TODO(pcm): Introduce status codes and check in case the file descriptor
-      // is added twice.
-      loop_->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
-        SendNotifications(pending_notifications_.find(client_fd));
-      });
+      // Send queued notifications whenever there is room in the socket's send
+      // buffer. The callback is removed at the end of the method.
+      if (!it->second.watching) {
+        it->second.watching = true;
+        WatchNotificationSocket(it->second.loop, client_fd, true);
+      }
       break;
     } else {
       ARROW_LOG(WARNING) << "Failed to send notification to client on fd " << client_fd;
@@ -844,8 +1158,9 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   notifications.erase(notifications.begin(), notifications.begin() + num_processed);
 
   // If we have sent all notifications, remove the fd from the event loop.
-  if (notifications.empty()) {
-    loop_->RemoveFileEvent(client_fd);
+  if (notifications.empty() && it->second.watching) {
+    it->second.watching = false;
+    WatchNotificationSocket(it->second.loop, client_fd, false);
   }
 
   // Stop sending notifications if the pipe was broken.
@@ -857,6 +1172,29 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   }
 }
 
+void PlasmaStore::WatchNotificationSocket(EventLoop* loop, int fd, bool watch) {
+  // Posted rather than run inline, since the caller holds the store mutex. The
+  // subscriber may have disconnected (and the fd been reused) in the meantime.
+  loop->Post([this, loop, fd, watch]() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = pending_notifications_.find(fd);
+    if (it == pending_notifications_.end() || it->second.loop != loop) {
+      return;
+    }
+    if (watch) {
+      loop->AddFileEvent(fd, kEventLoopWrite, [this, fd](int events) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pending_notifications_.find(fd);
+        if (it != pending_notifications_.end()) {
+          SendNotifications(it);
+        }
+      });
+    } else {
+      loop->RemoveFileEvent(fd);
+    }
+  });
+}
+
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
   auto it = pending_notifications_.begin();
   while (it != pending_notifications_.end()) {
@@ -907,7 +1245,7 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
   }
 
   // Add this fd to global map, which is needed for this client to receive notifications.
-  pending_notifications_[fd];
+  pending_notifications_[fd].loop = client->loop;
   client->notification_fd = fd;
 
   // Push notifications to the new subscriber about existing sealed objects.
@@ -925,12 +1263,22 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
 }
 
 Status PlasmaStore::ProcessMessage(Client* client) {
+  // The message is read outside of the store mutex, so that the event loops
+  // receive messages in parallel. The buffer is allocated only once per thread
+  // to avoid mallocs for every message.
+  static thread_local std::vector<uint8_t> input_buffer;
   fb::MessageType type;
-  Status s = ReadMessage(client->fd, &type, &input_buffer_);
+  Status s = ReadMessage(client->fd, &type, &input_buffer);
   ARROW_CHECK(s.ok() || s.IsIOError());
 
-  uint8_t* input = input_buffer_.data();
-  size_t input_size = input_buffer_.size();
+  const auto start = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto type_index = static_cast<size_t>(type);
+  RequestTimer timer(start, type_index < request_latencies_.size()
+                                ? &request_latencies_[type_index]
+                                : nullptr);
+  uint8_t* input = input_buffer.data();
+  size_t input_size = input_buffer.size();
   ObjectID object_id;
   PlasmaObject object = {};
 
@@ -1044,6 +1392,41 @@ Status PlasmaStore::ProcessMessage(Client* client) {
 
       HANDLE_SIGPIPE(SendCreateAndSealBatchReply(client->fd, error_code), client->fd);
     } break;
+    case fb::MessageType::PlasmaCreateBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      bool evict_if_full;
+      std::vector<int64_t> data_sizes;
+      std::vector<int64_t> metadata_sizes;
+      bool contiguous;
+      RETURN_NOT_OK(ReadCreateBatchRequest(input, input_size, &object_ids,
+                                           &evict_if_full, &data_sizes, &metadata_sizes,
+                                           &contiguous));
+      std::vector<PlasmaObject> objects;
+      PlasmaError error_code =
+          CreateObjectBatch(object_ids, evict_if_full, data_sizes, metadata_sizes,
+                            contiguous, client, &objects);
+      // Figure out which file descriptors to send, as in ReturnFromGet
+      std::vector<int> store_fds;
+      std::vector<int64_t> mmap_sizes;
+      if (error_code == PlasmaError::OK) {
+        std::unordered_set<int> fds_to_send;
+        for (const auto& object : objects) {
+          if (fds_to_send.insert(object.store_fd).second) {
+            store_fds.push_back(object.store_fd);
+            mmap_sizes.push_back(GetMmapSize(object.store_fd));
+          }
+        }
+      }
+      HANDLE_SIGPIPE(SendCreateBatchReply(client->fd, object_ids, objects, error_code,
+                                          store_fds, mmap_sizes),
+                     client->fd);
+      for (int store_fd : store_fds) {
+        if (client->used_fds.find(store_fd) == client->used_fds.end()) {
+          WarnIfSigpipe(send_fd(client->fd, store_fd), client->fd);
+          client->used_fds.insert(store_fd);
+        }
+      }
+    } break;
     case fb::MessageType::PlasmaAbortRequest: {
       RETURN_NOT_OK(ReadAbortRequest(input, input_size, &object_id));
       ARROW_CHECK(AbortObject(object_id, client) == 1) << "To abort an object, the only "
@@ -1089,20 +1472,28 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       SealObjects({object_id}, {digest});
       HANDLE_SIGPIPE(SendSealReply(client->fd, object_id, PlasmaError::OK), client->fd);
     } break;
+    case fb::MessageType::PlasmaSealBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<std::string> digests;
+      RETURN_NOT_OK(ReadSealBatchRequest(input, input_size, &object_ids, &digests));
+      SealObjects(object_ids, digests);
+      HANDLE_SIGPIPE(SendSealBatchReply(client->fd, object_ids, PlasmaError::OK),
+                     client->fd);
+    } break;
     case fb::MessageType::PlasmaEvictRequest: {
       // This code path should only be used for testing.
       int64_t num_bytes;
       RETURN_NOT_OK(ReadEvictRequest(input, input_size, &num_bytes));
       std::vector<ObjectID> objects_to_evict;
       int64_t num_bytes_evicted =
-          eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+          eviction_policy_->ChooseObjectsToEvict(num_bytes, &objects_to_evict);
       EvictObjects(objects_to_evict);
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
     case fb::MessageType::PlasmaRefreshLRURequest: {
       std::vector<ObjectID> object_ids;
       RETURN_NOT_OK(ReadRefreshLRURequest(input, input_size, &object_ids));
-      eviction_policy_.RefreshObjects(object_ids);
+      eviction_policy_->RefreshObjects(object_ids);
       HANDLE_SIGPIPE(SendRefreshLRUReply(client->fd), client->fd);
     } break;
     case fb::MessageType::PlasmaSubscribeRequest:
@@ -1122,15 +1513,18 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(
           ReadSetOptionsRequest(input, input_size, &client_name, &output_memory_quota));
       client->name = client_name;
-      bool success = eviction_policy_.SetClientQuota(client, output_memory_quota);
+      bool success = eviction_policy_->SetClientQuota(client, output_memory_quota);
       HANDLE_SIGPIPE(SendSetOptionsReply(client->fd, success ? PlasmaError::OK
                                                              : PlasmaError::OutOfMemory),
                      client->fd);
     } break;
     case fb::MessageType::PlasmaGetDebugStringRequest: {
-      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, eviction_policy_.DebugString()),
+      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, eviction_policy_->DebugString()),
                      client->fd);
     } break;
+    case fb::MessageType::PlasmaGetMetricsRequest: {
+      HANDLE_SIGPIPE(SendGetMetricsReply(client->fd, GetMetrics()), client->fd);
+    } break;
     default:
       // This code should be unreachable.
       ARROW_CHECK(0);
@@ -1138,17 +1532,48 @@ Status PlasmaStore::ProcessMessage(Client* client) {
   return Status::OK();
 }
 
+PlasmaMetrics PlasmaStore::GetMetrics() {
+  PlasmaMetrics metrics = metrics_;
+  for (size_t i = 0; i < request_latencies_.size(); ++i) {
+    if (request_latencies_[i].count > 0) {
+      metrics.request_latencies[fb::EnumNameMessageType(
+          static_cast<fb::MessageType>(i))] = request_latencies_[i];
+    }
+  }
+  metrics.bytes_in_use = PlasmaAllocator::Allocated();
+  GetMallocStats(&metrics.arena_footprint, &metrics.arena_free_bytes,
+                 &metrics.arena_free_chunks);
+  return metrics;
+}
+
+void PlasmaStore::LogMetricsPeriodically(int64_t interval_ms) {
+  loop_->AddTimer(interval_ms, [this, interval_ms](int64_t timer_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ARROW_LOG(INFO) << "Plasma store metrics:\n" << GetMetrics().ToString();
+    return static_cast<int>(interval_ms);
+  });
+}
+
 class PlasmaStoreRunner {
  public:
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
-    // Create the event loop.
+             std::shared_ptr<ExternalStore> external_store, int num_threads,
+             const std::string& eviction_policy, bool numa_aware,
+             int64_t metrics_interval_ms) {
+    // Create the event loops.
     loop_.reset(new EventLoop);
     store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
+                                 external_store, eviction_policy, numa_aware));
     plasma_config = store_->GetPlasmaStoreInfo();
+    for (int i = 1; i < num_threads; ++i) {
+      client_loops_.emplace_back(new EventLoop);
+      store_->AddEventLoop(client_loops_.back().get());
+    }
+    if (metrics_interval_ms > 0) {
+      store_->LogMetricsPeriodically(metrics_interval_ms);
+    }
 
     // We are using a single memory-mapped file by mallocing and freeing a single
     // large amount of space up front. According to the documentation,
@@ -1166,23 +1591,46 @@ class PlasmaStoreRunner {
     // TODO(pcm): Check return value.
     ARROW_CHECK(socket >= 0);
 
+    for (auto& client_loop : client_loops_) {
+      EventLoop* loop = client_loop.get();
+      client_threads_.emplace_back([loop]() { loop->Start(); });
+    }
+
     loop_->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
       this->store_->ConnectClient(socket);
     });
     loop_->Start();
+
+    // The main loop was stopped, stop the other loops too.
+    for (auto& client_loop : client_loops_) {
+      EventLoop* loop = client_loop.get();
+      loop->Post([loop]() { loop->Stop(); });
+    }
+    for (auto& thread : client_threads_) {
+      thread.join();
+    }
+    client_threads_.clear();
   }
 
   void Stop() { loop_->Stop(); }
 
   void Shutdown() {
+    // The store waits for its background tasks, which post to the loops
+    store_ = nullptr;
+    for (auto& client_loop : client_loops_) {
+      client_loop->Shutdown();
+    }
     loop_->Shutdown();
     loop_ = nullptr;
-    store_ = nullptr;
+    client_loops_.clear();
   }
 
  private:
   std::unique_ptr<EventLoop> loop_;
   std::unique_ptr<PlasmaStore> store_;
+  /// Additional event loops serving clients, and the threads running them.
+  std::vector<std::unique_ptr<EventLoop>> client_loops_;
+  std::vector<std::thread> client_threads_;
 };
 
 static std::unique_ptr<PlasmaStoreRunner> g_runner = nullptr;
@@ -1197,14 +1645,17 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store, int num_threads,
+                 const std::string& eviction_policy, bool numa_aware,
+                 int64_t metrics_interval_ms) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  num_threads, eviction_policy, numa_aware, metrics_interval_ms);
 }
 
 }  // namespace plasma
@@ -1217,9 +1668,13 @@ int main(int argc, char* argv[]) {
   std::string plasma_directory;
   std::string external_store_endpoint;
   bool hugepages_enabled = false;
+  bool numa_aware = false;
   int64_t system_memory = -1;
+  int num_threads = 1;
+  std::string eviction_policy = "lru";
+  int64_t metrics_interval_s = 0;
   int c;
-  while ((c = getopt(argc, argv, "s:m:d:e:h")) != -1) {
+  while ((c = getopt(argc, argv, "s:m:d:e:hl:np:t:")) != -1) {
     switch (c) {
       case 'd':
         plasma_directory = std::string(optarg);
@@ -1230,9 +1685,30 @@ int main(int argc, char* argv[]) {
       case 'h':
         hugepages_enabled = true;
         break;
+      case 'l': {
+        char extra;
+        int scanned = sscanf(optarg, "%" SCNd64 "%c", &metrics_interval_s, &extra);
+        ARROW_CHECK(scanned == 1 && metrics_interval_s > 0)
+            << "the interval between metrics logs (-l) must be a positive number of "
+               "seconds";
+        break;
+      }
+      case 'n':
+        numa_aware = true;
+        break;
+      case 'p':
+        eviction_policy = std::string(optarg);
+        break;
       case 's':
         socket_name = optarg;
         break;
+      case 't': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &num_threads, &extra);
+        ARROW_CHECK(scanned == 1 && num_threads > 0)
+            << "the number of threads (-t) must be a positive integer";
+        break;
+      }
       case 'm': {
         char extra;
         int scanned = sscanf(optarg, "%" SCNd64 "%c", &system_memory, &extra);
@@ -1311,7 +1787,9 @@ int main(int argc, char* argv[]) {
     ARROW_CHECK_OK(external_store->Connect(external_store_endpoint));
   }
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      num_threads, eviction_policy, numa_aware,
+                      metrics_interval_s * 1000);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -19,6 +19,7 @@
 
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -26,13 +27,17 @@
 
 #include "plasma/common.h"
 #include "plasma/events.h"
+#include "plasma/eviction_policy.h"
 #include "plasma/external_store.h"
+#include "plasma/metrics.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
-#include "plasma/quota_aware_policy.h"
 
 namespace arrow {
 class Status;
+namespace internal {
+class ThreadPool;
+}  // namespace internal
 }  // namespace arrow
 
 namespace plasma {
@@ -51,8 +56,19 @@ struct NotificationQueue {
   /// The object notifications for clients. We notify the client about the
   /// objects in the order that the objects were sealed or deleted.
   std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
+  /// The event loop of the subscriber, which watches the socket when its send
+  /// buffer is full.
+  EventLoop* loop = nullptr;
+  /// Whether the socket is watched for room in its send buffer.
+  bool watching = false;
 };
 
+/// The object store.
+///
+/// Clients are served by one or more event loops, each run by its own thread.
+/// Requests are read from the client sockets in parallel, then processed under
+/// a single store mutex, since nearly every request updates the allocator or
+/// the eviction policy shared by all the objects.
 class PlasmaStore {
  public:
   using NotificationMap = std::unordered_map<int, NotificationQueue>;
@@ -60,13 +76,20 @@ class PlasmaStore {
   // TODO: PascalCase PlasmaStore methods.
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
-              std::shared_ptr<ExternalStore> external_store);
+              std::shared_ptr<ExternalStore> external_store,
+              const std::string& eviction_policy = "lru", bool numa_aware = false);
 
   ~PlasmaStore();
 
   /// Get a const pointer to the internal PlasmaStoreInfo object.
   const PlasmaStoreInfo* GetPlasmaStoreInfo();
 
+  /// Serve some of the clients with another event loop, run by another thread.
+  /// New clients are assigned to the event loops round robin.
+  ///
+  /// \param loop The event loop, which must outlive the store.
+  void AddEventLoop(EventLoop* loop);
+
   /// Create a new object. The client must do a call to release_object to tell
   /// the store when it is done with the object.
   ///
@@ -96,6 +119,26 @@ class PlasmaStore {
                            int64_t data_size, int64_t metadata_size, int device_num,
                            Client* client, PlasmaObject* result);
 
+  /// Create a batch of objects on the host, like CreateObject(). Either all of
+  /// them are created, or none.
+  ///
+  /// \param object_ids Object IDs of the objects to be created.
+  /// \param evict_if_full Whether to evict objects when the store is full.
+  /// \param data_sizes Sizes in bytes of the objects to be created.
+  /// \param metadata_sizes Sizes in bytes of the objects metadata.
+  /// \param contiguous Whether to allocate all the objects with a single
+  ///        allocation, in one contiguous region of memory. The region is
+  ///        only freed once all the objects are deleted or evicted.
+  /// \param client The client that created the objects.
+  /// \param results The objects that have been created.
+  /// \return The error codes of CreateObject().
+  PlasmaError CreateObjectBatch(const std::vector<ObjectID>& object_ids,
+                                bool evict_if_full,
+                                const std::vector<int64_t>& data_sizes,
+                                const std::vector<int64_t>& metadata_sizes,
+                                bool contiguous, Client* client,
+                                std::vector<PlasmaObject>* results);
+
   /// Abort a created but unsealed object. If the client is not the
   /// creator, then the abort will fail.
   ///
@@ -116,6 +159,11 @@ class PlasmaStore {
 
   /// Evict objects returned by the eviction policy.
   ///
+  /// With an external store, the objects are copied to a staging area, their
+  /// memory is freed and they are written to the external store in the
+  /// background.  Once the staging area is full, the objects are written to
+  /// the external store synchronously instead.
+  ///
   /// \param object_ids Object IDs of the objects to be evicted.
   void EvictObjects(const std::vector<ObjectID>& object_ids);
 
@@ -127,6 +175,9 @@ class PlasmaStore {
   /// For each object, the client must do a call to release_object to tell the
   /// store when it is done with the object.
   ///
+  /// Objects evicted to the external store are read from it in the background,
+  /// and the request waits for them as for unsealed objects.
+  ///
   /// \param client The client making this request.
   /// \param object_ids Object IDs of the objects to be gotten.
   /// \param timeout_ms The timeout for the get request in milliseconds.
@@ -172,6 +223,14 @@ class PlasmaStore {
 
   NotificationMap::iterator SendNotifications(NotificationMap::iterator it);
 
+  /// Get the metrics of the store.
+  PlasmaMetrics GetMetrics();
+
+  /// Log the metrics of the store periodically, from its event loop.
+  ///
+  /// \param interval_ms The interval between two logs, in milliseconds.
+  void LogMetricsPeriodically(int64_t interval_ms);
+
   arrow::Status ProcessMessage(Client* client);
 
  private:
@@ -181,6 +240,10 @@ class PlasmaStore {
 
   void PushNotification(ObjectInfoT* object_notification, int client_fd);
 
+  /// Start or stop watching a notification socket for room in its send buffer,
+  /// on the event loop of its subscriber.
+  void WatchNotificationSocket(EventLoop* loop, int fd, bool watch);
+
   void AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                             Client* client);
 
@@ -203,6 +266,28 @@ class PlasmaStore {
 
   void EraseFromObjectTable(const ObjectID& object_id);
 
+  /// Add an object whose memory is allocated to the object table, as created
+  /// by the client.
+  void AddCreatedObject(const ObjectID& object_id, int64_t data_size,
+                        int64_t metadata_size, int device_num, uint8_t* pointer, int fd,
+                        int64_t map_size, ptrdiff_t offset, Client* client,
+                        PlasmaObject* result);
+
+  /// Free the host memory of an object, or release its share of a contiguous
+  /// region allocated by CreateObjectBatch().
+  void FreeObjectMemory(const ObjectID& object_id, ObjectTableEntry* entry);
+
+  /// Copy the data of an evicted object back to the store and seal it.
+  ///
+  /// \return False if there is not enough memory for the object.
+  bool RestoreObject(const ObjectID& object_id, ObjectTableEntry* entry,
+                     const Buffer& data);
+
+  /// Read evicted objects from the external store in the background, then
+  /// restore them and satisfy the get requests waiting for them.
+  void StartRestoringObjects(const std::vector<ObjectID>& object_ids,
+                             const std::vector<ObjectTableEntry*>& entries);
+
   uint8_t* AllocateMemory(size_t size, bool evict_if_full, int* fd, int64_t* map_size,
                           ptrdiff_t* offset, Client* client, bool is_create);
 #ifdef PLASMA_CUDA
@@ -212,19 +297,24 @@ class PlasmaStore {
   Status FreeCudaMemory(int device_num, int64_t size, uint8_t* out_pointer);
 #endif
 
-  /// Event loop of the plasma store.
+  /// Event loop of the plasma store, which accepts the connections.
   EventLoop* loop_;
+  /// Event loops serving the clients, including loop_.
+  std::vector<EventLoop*> client_loops_;
+  size_t next_client_loop_ = 0;
+  /// Protects the state of the store below, shared by the event loops.
+  std::mutex mutex_;
   /// The plasma store information, including the object tables, that is exposed
   /// to the eviction policy.
   PlasmaStoreInfo store_info_;
   /// The state that is managed by the eviction policy.
-  QuotaAwarePolicy eviction_policy_;
-  /// Input buffer. This is allocated only once to avoid mallocs for every
-  /// call to process_message.
-  std::vector<uint8_t> input_buffer_;
+  std::unique_ptr<EvictionPolicy> eviction_policy_;
   /// A hash table mapping object IDs to a vector of the get requests that are
   /// waiting for the object to arrive.
   std::unordered_map<ObjectID, std::vector<GetRequest*>> object_get_requests_;
+  /// The get requests with a timeout, by ID.
+  std::unordered_map<int64_t, GetRequest*> timed_get_requests_;
+  int64_t next_get_request_id_ = 0;
   /// The pending notifications that have not been sent to subscribers because
   /// the socket send buffers were full. This is a hash table from client file
   /// descriptor to an array of object_ids to send to that client.
@@ -239,6 +329,33 @@ class PlasmaStore {
   /// Manages worker threads for handling asynchronous/multi-threaded requests
   /// for reading/writing data to/from external store.
   std::shared_ptr<ExternalStore> external_store_;
+  /// Runs the calls to the external store in the background. It has a single
+  /// thread, so that external stores need not be thread-safe.
+  std::shared_ptr<arrow::internal::ThreadPool> external_store_pool_;
+  /// Copies of the evicted objects which are being written to the external
+  /// store. Objects are restored from them until the write is done.
+  std::unordered_map<ObjectID, std::shared_ptr<Buffer>> spilling_objects_;
+  /// Total size of the staging copies being written to the external store.
+  int64_t spilling_bytes_ = 0;
+  /// Size of the staging area: a quarter of the store capacity.
+  const int64_t max_spilling_bytes_;
+  /// The evicted objects which are being read from the external store.
+  std::unordered_set<ObjectID> restoring_objects_;
+
+  struct ContiguousRegion {
+    int64_t size;
+    /// The number of objects still allocated in the region.
+    size_t num_objects;
+  };
+  /// The contiguous regions allocated for batches of objects, by address.
+  std::unordered_map<uint8_t*, ContiguousRegion> contiguous_regions_;
+  /// The address of the contiguous region of each object allocated in one.
+  std::unordered_map<ObjectID, uint8_t*> object_regions_;
+
+  /// The latencies of the requests, indexed by message type.
+  std::vector<LatencyHistogram> request_latencies_;
+  /// The other metrics, which are updated as they happen.
+  PlasmaMetrics metrics_;
 #ifdef PLASMA_CUDA
   arrow::cuda::CudaDeviceManager* manager_;
 #endif
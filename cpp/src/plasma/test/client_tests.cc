@@ -22,12 +22,18 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/io_util.h"
 
 #include "plasma/client.h"
@@ -61,7 +67,8 @@ class TestPlasmaStore : public ::testing::Test {
     std::string plasma_directory =
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command =
-        plasma_directory + "/plasma-store-server -m 10000000 -s " + store_socket_name_ +
+        plasma_directory + "/plasma-store-server -m 10000000 " + store_options_ + "-s " +
+        store_socket_name_ +
         " 1> /dev/null 2> /dev/null & " + "echo $! > " + store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
@@ -105,6 +112,14 @@ class TestPlasmaStore : public ::testing::Test {
   PlasmaClient client2_;
   std::unique_ptr<TemporaryDir> temp_dir_;
   std::string store_socket_name_;
+  // Additional command line options of the store
+  std::string store_options_;
+};
+
+// client_ and client2_ are served by different threads of the store.
+class TestPlasmaStoreThreads : public TestPlasmaStore {
+ public:
+  TestPlasmaStoreThreads() { store_options_ = "-t 4 "; }
 };
 
 TEST_F(TestPlasmaStore, NewSubscriberTest) {
@@ -500,6 +515,33 @@ TEST_F(TestPlasmaStore, RefreshLRUTest) {
   ASSERT_FALSE(has_object);
 }
 
+TEST_F(TestPlasmaStore, MetricsTest) {
+  std::vector<uint8_t> small_data(1 * 1000 * 1000, 0);
+  // The eleventh object evicts two others (20% of the store)
+  for (int i = 0; i < 11; ++i) {
+    CreateObject(client_, random_object_id(), {}, small_data, true);
+  }
+
+  PlasmaMetrics metrics;
+  ARROW_CHECK_OK(client_.GetMetrics(&metrics));
+  ASSERT_EQ(metrics.request_latencies["PlasmaCreateRequest"].count, 11);
+  ASSERT_EQ(metrics.request_latencies["PlasmaSealRequest"].count, 11);
+  ASSERT_EQ(metrics.request_latencies.count("PlasmaGetMetricsRequest"), 0);
+  ASSERT_EQ(metrics.bytes_allocated, 11 * 1000 * 1000);
+  ASSERT_EQ(metrics.bytes_in_use, 9 * 1000 * 1000);
+  ASSERT_EQ(metrics.num_evictions, 1);
+  ASSERT_EQ(metrics.objects_evicted, 2);
+  ASSERT_EQ(metrics.bytes_evicted, 2 * 1000 * 1000);
+  ASSERT_GE(metrics.arena_footprint, metrics.bytes_in_use);
+  ASSERT_GT(metrics.arena_free_bytes, 0);
+  ASSERT_GT(metrics.arena_free_chunks, 0);
+  ASSERT_EQ(metrics.external_store_put.count, 0);
+
+  // The previous request is now measured too
+  ARROW_CHECK_OK(client_.GetMetrics(&metrics));
+  ASSERT_EQ(metrics.request_latencies["PlasmaGetMetricsRequest"].count, 1);
+}
+
 TEST_F(TestPlasmaStore, DeleteTest) {
   ObjectID object_id = random_object_id();
 
@@ -626,6 +668,67 @@ TEST_F(TestPlasmaStore, GetTest) {
   EXPECT_FALSE(client_.IsInUse(object_id));
 }
 
+std::shared_ptr<arrow::RecordBatch> MakeRecordBatch(int64_t offset) {
+  std::vector<int64_t> ints = {offset, offset + 1, offset + 2};
+  std::vector<std::string> strings = {"a", "bc", std::to_string(offset)};
+  std::shared_ptr<arrow::Array> int_array, string_array;
+  arrow::ArrayFromVector<arrow::Int64Type>(ints, &int_array);
+  arrow::ArrayFromVector<arrow::StringType>(strings, &string_array);
+  auto schema = arrow::schema(
+      {arrow::field("ints", arrow::int64()), arrow::field("strings", arrow::utf8())});
+  return arrow::RecordBatch::Make(schema, 3, {int_array, string_array});
+}
+
+TEST_F(TestPlasmaStore, PutAndGetRecordBatchTest) {
+  ObjectID object_id = random_object_id();
+  auto batch = MakeRecordBatch(0);
+  ARROW_CHECK_OK(client_.PutRecordBatch(object_id, *batch));
+  EXPECT_FALSE(client_.IsInUse(object_id));
+
+  std::shared_ptr<arrow::RecordBatch> result;
+  ARROW_CHECK_OK(client2_.GetRecordBatch(object_id, -1, &result));
+  arrow::AssertBatchesEqual(*batch, *result);
+
+  // The arrays point to the memory of the object, and keep it in use
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({object_id}, -1, &object_buffers));
+  const uint8_t* begin = object_buffers[0].data->data();
+  const uint8_t* end = begin + object_buffers[0].data->size();
+  object_buffers.clear();
+  auto values = result->column(0)->data()->buffers[1];
+  ASSERT_GE(values->data(), begin);
+  ASSERT_LE(values->data() + values->size(), end);
+  auto column = result->column(1);
+  result.reset();
+  EXPECT_TRUE(client2_.IsInUse(object_id));
+  column.reset();
+  values.reset();
+  EXPECT_FALSE(client2_.IsInUse(object_id));
+
+  // A missing object
+  Status status = client2_.GetRecordBatch(random_object_id(), 0, &result);
+  ASSERT_TRUE(IsPlasmaObjectNotFound(status));
+}
+
+TEST_F(TestPlasmaStore, PutAndGetTableTest) {
+  ObjectID object_id = random_object_id();
+  std::shared_ptr<arrow::Table> table;
+  ARROW_CHECK_OK(
+      arrow::Table::FromRecordBatches({MakeRecordBatch(0), MakeRecordBatch(3)})
+          .Value(&table));
+  ARROW_CHECK_OK(client_.PutTable(object_id, *table));
+
+  std::shared_ptr<arrow::Table> result;
+  ARROW_CHECK_OK(client2_.GetTable(object_id, -1, &result));
+  arrow::AssertTablesEqual(*table, *result);
+  result.reset();
+  EXPECT_FALSE(client2_.IsInUse(object_id));
+
+  // The object holds two batches
+  std::shared_ptr<arrow::RecordBatch> batch;
+  ASSERT_RAISES(Invalid, client2_.GetRecordBatch(object_id, -1, &batch));
+}
+
 TEST_F(TestPlasmaStore, LegacyGetTest) {
   // Test for old non-releasing Get() variant
   ObjectID object_id = random_object_id();
@@ -699,6 +802,104 @@ TEST_F(TestPlasmaStore, BatchCreateTest) {
   ASSERT_STREQ(out2.c_str(), "world");
 }
 
+TEST_F(TestPlasmaStore, CreateBatchTest) {
+  for (bool contiguous : {false, true}) {
+    const int num_objects = 20;
+    std::vector<ObjectID> object_ids;
+    std::vector<int64_t> data_sizes;
+    std::vector<std::string> metadata;
+    for (int i = 0; i < num_objects; i++) {
+      object_ids.push_back(random_object_id());
+      data_sizes.push_back(i + 1);
+      metadata.push_back(std::to_string(i));
+    }
+
+    std::vector<std::shared_ptr<Buffer>> data;
+    ARROW_CHECK_OK(
+        client_.CreateBatch(object_ids, data_sizes, metadata, &data, contiguous));
+    ASSERT_EQ(data.size(), object_ids.size());
+    for (int i = 0; i < num_objects; i++) {
+      ASSERT_EQ(data[i]->size(), data_sizes[i]);
+      memset(data[i]->mutable_data(), i, data_sizes[i]);
+    }
+    if (contiguous) {
+      // The objects are laid out one after the other in a single allocation
+      for (int i = 1; i < num_objects; i++) {
+        ASSERT_EQ(data[i]->data() - data[i - 1]->data(),
+                  arrow::BitUtil::RoundUp(data_sizes[i - 1] + metadata[i - 1].size(),
+                                          kBlockSize));
+      }
+    }
+    ARROW_CHECK_OK(client_.SealBatch(object_ids));
+    data.clear();
+    for (const auto& object_id : object_ids) {
+      ARROW_CHECK_OK(client_.Release(object_id));
+    }
+
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+    for (int i = 0; i < num_objects; i++) {
+      AssertObjectBufferEqual(
+          object_buffers[i], std::vector<uint8_t>(metadata[i].begin(), metadata[i].end()),
+          std::vector<uint8_t>(data_sizes[i], static_cast<uint8_t>(i)));
+    }
+  }
+}
+
+TEST_F(TestPlasmaStore, CreateBatchExistingObjectTest) {
+  ObjectID existing_id = random_object_id();
+  CreateObject(client_, existing_id, {}, {1, 2, 3});
+
+  for (bool contiguous : {false, true}) {
+    ObjectID new_id = random_object_id();
+    std::vector<std::shared_ptr<Buffer>> data;
+    Status s = client_.CreateBatch({new_id, existing_id}, {4, 4}, {"", ""}, &data,
+                                   contiguous);
+    ASSERT_TRUE(IsPlasmaObjectExists(s));
+    ASSERT_TRUE(data.empty());
+
+    // None of the objects of the batch is created
+    bool has_object;
+    ARROW_CHECK_OK(client_.Contains(new_id, &has_object));
+    ASSERT_FALSE(has_object);
+    CreateObject(client_, new_id, {}, {1, 2, 3, 4});
+  }
+}
+
+TEST_F(TestPlasmaStore, CreateBatchContiguousFreeTest) {
+  // Objects of a contiguous batch which together use most of the store
+  const int num_objects = 4;
+  const int64_t object_size = 2000000;
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < num_objects; i++) {
+    object_ids.push_back(random_object_id());
+  }
+  std::vector<std::shared_ptr<Buffer>> data;
+  ARROW_CHECK_OK(client_.CreateBatch(
+      object_ids, std::vector<int64_t>(num_objects, object_size),
+      std::vector<std::string>(num_objects), &data, /*contiguous=*/true));
+  ARROW_CHECK_OK(client_.SealBatch(object_ids));
+  data.clear();
+  for (const auto& object_id : object_ids) {
+    ARROW_CHECK_OK(client_.Release(object_id));
+  }
+
+  // The allocation is only freed with the last of its objects
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({object_ids.back()}, -1, &object_buffers));
+  ARROW_CHECK_OK(client_.Delete(
+      std::vector<ObjectID>(object_ids.begin(), object_ids.end() - 1)));
+  ObjectID big_id = random_object_id();
+  std::shared_ptr<Buffer> big;
+  Status s = client_.Create(big_id, num_objects * object_size, nullptr, 0, &big);
+  ASSERT_TRUE(IsPlasmaStoreFull(s));
+
+  object_buffers.clear();
+  ARROW_CHECK_OK(client2_.Delete(object_ids.back()));
+  ARROW_CHECK_OK(client_.Create(big_id, num_objects * object_size, nullptr, 0, &big));
+  ARROW_CHECK_OK(client_.Seal(big_id));
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
@@ -864,6 +1065,183 @@ TEST_F(TestPlasmaStore, ManyObjectTest) {
   }
 }
 
+TEST_F(TestPlasmaStore, DelayedReleaseTest) {
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", /*release_delay=*/3));
+  ObjectID object_id = random_object_id();
+  std::vector<uint8_t> data = {3, 5, 6, 7, 9};
+  CreateObject(client, object_id, {42}, data);
+
+  // The release is not sent yet, so the deletion waits for it
+  ARROW_CHECK_OK(client2_.Delete(object_id));
+  bool has_object = false;
+  ARROW_CHECK_OK(client2_.Contains(object_id, &has_object));
+  ASSERT_TRUE(has_object);
+
+  // The object can be used again without a request to the store
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client.Get({object_id}, 0, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], {42}, data);
+  object_buffers.clear();
+
+  // Creations send the pending releases, as they may need to evict the objects
+  ObjectID object_id2 = random_object_id();
+  CreateObject(client, object_id2, {42}, data);
+  ARROW_CHECK_OK(client2_.Contains(object_id, &has_object));
+  ASSERT_FALSE(has_object);
+
+  // So does reaching the delay
+  ARROW_CHECK_OK(client2_.Delete(object_id2));
+  for (int i = 0; i < 3; ++i) {
+    ARROW_CHECK_OK(client.Get({object_id2}, 0, &object_buffers));
+    object_buffers.clear();
+  }
+  ARROW_CHECK_OK(client2_.Contains(object_id2, &has_object));
+  ASSERT_FALSE(has_object);
+
+  // Deletions by the releasing client are not delayed
+  ObjectID object_id3 = random_object_id();
+  CreateObject(client, object_id3, {42}, data);
+  ARROW_CHECK_OK(client.Delete(object_id3));
+  ARROW_CHECK_OK(client2_.Contains(object_id3, &has_object));
+  ASSERT_FALSE(has_object);
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+class TestPlasmaStoreSizeFrequency : public TestPlasmaStore {
+ public:
+  TestPlasmaStoreSizeFrequency() { store_options_ = "-p size_frequency "; }
+};
+
+TEST_F(TestPlasmaStoreSizeFrequency, KeepsSmallHotObjectsTest) {
+  ObjectID hot_id = random_object_id();
+  std::vector<uint8_t> data(1000, 7);
+  CreateObject(client_, hot_id, {42}, data);
+  for (int i = 0; i < 10; ++i) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client2_.Get({hot_id}, 0, &object_buffers));
+  }
+
+  // Large objects, read once, fill the store several times. An LRU policy
+  // would evict the hot object first.
+  std::vector<uint8_t> large_data(1500000, 1);
+  for (int i = 0; i < 20; ++i) {
+    CreateObject(client_, random_object_id(), {42}, large_data);
+  }
+  bool has_object = false;
+  ARROW_CHECK_OK(client_.Contains(hot_id, &has_object));
+  ASSERT_TRUE(has_object);
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({hot_id}, 0, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], {42}, data);
+}
+
+class TestPlasmaStoreNuma : public TestPlasmaStore {
+ public:
+  TestPlasmaStoreNuma() { store_options_ = "-n "; }
+};
+
+TEST_F(TestPlasmaStoreNuma, ListReportsNumaNodeTest) {
+  // Freed memory is reused from the arena of the node
+  std::vector<uint8_t> data(1500000, 3);
+  for (int i = 0; i < 20; ++i) {
+    ObjectID object_id = random_object_id();
+    CreateObject(client_, object_id, {42}, data);
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client2_.Get({object_id}, 0, &object_buffers));
+    AssertObjectBufferEqual(object_buffers[0], {42}, data);
+    object_buffers.clear();
+    ARROW_CHECK_OK(client_.Delete(object_id));
+  }
+
+  ObjectID object_id = random_object_id();
+  CreateObject(client_, object_id, {42}, data);
+  ObjectTable objects;
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects.size(), 1);
+  ASSERT_GE(objects[object_id]->numa_node, 0);
+}
+
+TEST_F(TestPlasmaStore, ListReportsNoNumaNodeTest) {
+  ObjectID object_id = random_object_id();
+  CreateObject(client_, object_id, {42}, {1, 2, 3});
+  ObjectTable objects;
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects[object_id]->numa_node, -1);
+}
+
+TEST_F(TestPlasmaStoreThreads, ConcurrentClientsTest) {
+  constexpr int kNumThreads = 8;
+  constexpr int kNumObjects = 50;
+  std::vector<std::vector<ObjectID>> object_ids(kNumThreads);
+  for (auto& ids : object_ids) {
+    for (int i = 0; i < kNumObjects; ++i) {
+      ids.push_back(random_object_id());
+    }
+  }
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([this, t, &object_ids]() {
+      PlasmaClient client;
+      ARROW_CHECK_OK(client.Connect(store_socket_name_, ""));
+      for (int i = 0; i < kNumObjects; ++i) {
+        std::vector<uint8_t> data = {static_cast<uint8_t>(t), static_cast<uint8_t>(i)};
+        CreateObject(client, object_ids[t][i], {42}, data);
+        std::vector<ObjectBuffer> object_buffers;
+        ARROW_CHECK_OK(client.Get({object_ids[t][i]}, -1, &object_buffers));
+        AssertObjectBufferEqual(object_buffers[0], {42}, data);
+      }
+      ARROW_CHECK_OK(client.Disconnect());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // All the objects are visible from any client
+  for (int t = 0; t < kNumThreads; ++t) {
+    bool has_object;
+    ARROW_CHECK_OK(client_.Contains(object_ids[t].back(), &has_object));
+    ASSERT_TRUE(has_object);
+  }
+}
+
+TEST_F(TestPlasmaStoreThreads, GetWaitsForOtherThreadTest) {
+  ObjectID object_id = random_object_id();
+  std::vector<uint8_t> data = {3, 5, 6, 7, 9};
+
+  // The get request of client_ is completed by the seal of client2_
+  std::vector<ObjectBuffer> object_buffers;
+  std::thread getter([this, &object_id, &object_buffers]() {
+    ARROW_CHECK_OK(client_.Get({object_id}, -1, &object_buffers));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  CreateObject(client2_, object_id, {42}, data);
+  getter.join();
+  ASSERT_EQ(object_buffers.size(), 1);
+  AssertObjectBufferEqual(object_buffers[0], {42}, data);
+
+  // A get request still times out on the loop of its client
+  object_buffers.clear();
+  ARROW_CHECK_OK(client_.Get({random_object_id()}, 50, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 1);
+  ASSERT_FALSE(object_buffers[0].data);
+
+  // Notifications of a seal on another thread reach the subscriber
+  int fd = -1;
+  ARROW_CHECK_OK(client_.Subscribe(&fd));
+  ObjectID sealed_id = random_object_id();
+  CreateObject(client2_, sealed_id, {42}, data);
+  ObjectID notified_id;
+  int64_t data_size;
+  int64_t metadata_size;
+  do {
+    ARROW_CHECK_OK(client_.GetNotification(fd, &notified_id, &data_size, &metadata_size));
+  } while (!(notified_id == sealed_id));
+  ASSERT_EQ(data_size, static_cast<int64_t>(data.size()));
+}
+
 #ifdef PLASMA_CUDA
 using arrow::cuda::CudaBuffer;
 using arrow::cuda::CudaBufferReader;
@@ -22,8 +22,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -132,6 +135,67 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].device_num, 0);
   ASSERT_EQ(object_buffers[0].data, nullptr);
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
+
+  // The evicted objects are written to the external store in the background
+  PlasmaMetrics metrics;
+  for (int i = 0; i < 100; i++) {
+    ARROW_CHECK_OK(client_.GetMetrics(&metrics));
+    if (metrics.external_store_put.count > 0) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_GT(metrics.num_evictions, 0);
+  ASSERT_GT(metrics.objects_evicted, 0);
+  ASSERT_GT(metrics.external_store_put.count, 0);
+}
+
+TEST_F(TestPlasmaStoreWithExternal, PrefetchTest) {
+  std::vector<ObjectID> object_ids;
+  std::string data(100 * 1024, 'x');
+  std::string metadata;
+  for (int i = 0; i < 20; i++) {
+    object_ids.push_back(random_object_id());
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_ids.back(), data, metadata));
+  }
+
+  // The first object was evicted, it is restored in the background
+  ARROW_CHECK_OK(client_.Prefetch({object_ids[0]}));
+  std::vector<ObjectBuffer> object_buffers;
+  for (int i = 0; i < 100; i++) {
+    ARROW_CHECK_OK(client_.Get({object_ids[0]}, 0, &object_buffers));
+    if (object_buffers[0].data) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_TRUE(object_buffers[0].data);
+  AssertObjectBufferEqual(object_buffers[0], metadata, data);
+}
+
+TEST_F(TestPlasmaStoreWithExternal, EvictionLargerThanStagingTest) {
+  // The objects don't fit in the staging area (a quarter of the store
+  // capacity), they are written to the external store synchronously
+  std::vector<ObjectID> object_ids;
+  std::string data(300 * 1024, 'y');
+  std::string metadata = "meta";
+  for (int i = 0; i < 10; i++) {
+    object_ids.push_back(random_object_id());
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_ids.back(), data, metadata));
+  }
+
+  PlasmaMetrics metrics;
+  ARROW_CHECK_OK(client_.GetMetrics(&metrics));
+  ASSERT_GT(metrics.num_evictions, 0);
+  // Each eviction was written before returning
+  ASSERT_EQ(metrics.num_evictions, metrics.external_store_put.count);
+
+  for (const auto& object_id : object_ids) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_id}, -1, &object_buffers));
+    ASSERT_TRUE(object_buffers[0].data);
+    AssertObjectBufferEqual(object_buffers[0], metadata, data);
+  }
 }
 
 }  // namespace plasma
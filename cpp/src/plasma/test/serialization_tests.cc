@@ -27,6 +27,7 @@
 
 #include "plasma/common.h"
 #include "plasma/io.h"
+#include "plasma/metrics.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 #include "plasma/test_util.h"
@@ -330,4 +331,54 @@ TEST_F(TestPlasmaSerialization, DataReply) {
   ASSERT_EQ(metadata_size1, metadata_size2);
 }
 
+TEST_F(TestPlasmaSerialization, GetMetricsReply) {
+  int fd = CreateTemporaryFile();
+  PlasmaMetrics metrics1;
+  metrics1.request_latencies["PlasmaCreateRequest"].Record(3);
+  metrics1.request_latencies["PlasmaCreateRequest"].Record(100);
+  metrics1.request_latencies["PlasmaGetRequest"].Record(7);
+  metrics1.bytes_allocated = 1000;
+  metrics1.bytes_in_use = 600;
+  metrics1.num_evictions = 2;
+  metrics1.objects_evicted = 3;
+  metrics1.bytes_evicted = 400;
+  metrics1.arena_footprint = 4096;
+  metrics1.arena_free_bytes = 3496;
+  metrics1.arena_free_chunks = 5;
+  metrics1.external_store_put.Record(12345);
+  ASSERT_OK(SendGetMetricsReply(fd, metrics1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaGetMetricsReply);
+  PlasmaMetrics metrics2;
+  ASSERT_OK(ReadGetMetricsReply(data.data(), data.size(), &metrics2));
+  ASSERT_EQ(metrics1.ToString(), metrics2.ToString());
+  const auto& latencies = metrics2.request_latencies["PlasmaCreateRequest"];
+  ASSERT_EQ(latencies.buckets, metrics1.request_latencies["PlasmaCreateRequest"].buckets);
+  ASSERT_EQ(latencies.count, 2);
+  ASSERT_EQ(latencies.total_us, 103);
+  ASSERT_EQ(latencies.max_us, 100);
+  ASSERT_EQ(metrics2.external_store_put.count, 1);
+  ASSERT_EQ(metrics2.external_store_get.count, 0);
+  close(fd);
+}
+
+TEST(LatencyHistogram, Percentiles) {
+  LatencyHistogram histogram;
+  ASSERT_EQ(histogram.Percentile(50), 0);
+  for (int64_t latency = 0; latency < 100; ++latency) {
+    histogram.Record(latency);
+  }
+  ASSERT_EQ(histogram.count, 100);
+  ASSERT_EQ(histogram.max_us, 99);
+  ASSERT_DOUBLE_EQ(histogram.Mean(), 49.5);
+  // The percentiles are the upper bounds of the power-of-two buckets
+  ASSERT_EQ(histogram.Percentile(1), 1);
+  ASSERT_EQ(histogram.Percentile(50), 64);
+  ASSERT_EQ(histogram.Percentile(99), 99);
+
+  histogram.Record(int64_t(1) << 40);
+  ASSERT_EQ(histogram.buckets[LatencyHistogram::kNumBuckets - 1], 1);
+  ASSERT_EQ(histogram.Percentile(100), int64_t(1) << 40);
+}
+
 }  // namespace plasma
@@ -19,6 +19,8 @@ package org.apache.arrow.adapter.orc;
 
 /**
  * Wrapper for orc memory allocated by native code.
+ * The memory is that of a native record batch, which is retained until every
+ * buffer of the batch has been closed.
  */
 class OrcMemoryJniWrapper implements AutoCloseable {
 
@@ -32,7 +34,7 @@ class OrcMemoryJniWrapper implements AutoCloseable {
 
   /**
    * Construct a new instance.
-   * @param nativeInstanceId unique id of the underlying memory.
+   * @param nativeInstanceId id of the native record batch owning the memory.
    * @param memoryAddress starting memory address of the underlying memory.
    * @param size size of the valid data.
    * @param capacity allocated memory size.
@@ -44,9 +44,27 @@ public class OrcReader implements AutoCloseable {
    * @throws IOException throws exception in case of file not found
    */
   public OrcReader(String filePath, BufferAllocator allocator) throws IOException, IllegalAccessException {
+    this(filePath, allocator, false);
+  }
+
+  /**
+   * Create an OrcReader that iterate over orc stripes.
+   *
+   * <p>When prefetching, each stripe is read in full by nextStripeReader(), and
+   * the following stripe is then read on a native thread while the current one
+   * is consumed. A prefetched stripe uses the batch size given along with the
+   * stripe before it, so the batch size should be kept the same across calls.
+   *
+   * @param filePath file path to target file, currently only support local file.
+   * @param allocator allocator provided to ArrowReader.
+   * @param prefetchStripes whether to read the next stripe ahead of time.
+   * @throws IOException throws exception in case of file not found
+   */
+  public OrcReader(String filePath, BufferAllocator allocator, boolean prefetchStripes)
+      throws IOException, IllegalAccessException {
     this.allocator = allocator;
     this.jniWrapper = OrcReaderJniWrapper.getInstance();
-    this.nativeInstanceId = jniWrapper.open(filePath);
+    this.nativeInstanceId = jniWrapper.open(filePath, prefetchStripes);
   }
 
   /**
@@ -42,10 +42,12 @@ class OrcReaderJniWrapper {
   /**
    * Construct a orc file reader over the target file.
    * @param fileName absolute file path of target file
+   * @param prefetchStripes whether to read the next stripe on a native thread
+   *     while the current one is consumed, see {@link OrcReader}
    * @return id of the orc reader instance if file opened successfully,
    *     otherwise return error code * -1.
    */
-  native long open(String fileName);
+  native long open(String fileName, boolean prefetchStripes);
 
   /**
    * Release resources associated with designated reader instance.
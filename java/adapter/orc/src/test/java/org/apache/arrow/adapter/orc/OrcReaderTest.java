@@ -62,6 +62,15 @@ public class OrcReaderTest {
 
   @Test
   public void testOrcJniReader() throws Exception {
+    checkOrcJniReader(false);
+  }
+
+  @Test
+  public void testOrcJniReaderPrefetchStripes() throws Exception {
+    checkOrcJniReader(true);
+  }
+
+  private void checkOrcJniReader(boolean prefetchStripes) throws Exception {
     TypeDescription schema = TypeDescription.fromString("struct<x:int,y:string>");
     File testFile = new File(testFolder.getRoot(), "test-orc");
 
@@ -79,7 +88,7 @@ public class OrcReaderTest {
     writer.addRowBatch(batch);
     writer.close();
 
-    OrcReader reader = new OrcReader(testFile.getAbsolutePath(), allocator);
+    OrcReader reader = new OrcReader(testFile.getAbsolutePath(), allocator, prefetchStripes);
     assertEquals(1, reader.getNumberOfStripes());
 
     ArrowReader stripeReader = reader.nextStripeReader(1024);
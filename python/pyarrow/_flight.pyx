@@ -325,6 +325,7 @@ class FlightMethod(enum.Enum):
     DO_PUT = 6
     DO_ACTION = 7
     LIST_ACTIONS = 8
+    DO_EXCHANGE = 9
 
 
 cdef wrap_flight_method(CFlightMethod method):
@@ -344,6 +345,8 @@ cdef wrap_flight_method(CFlightMethod method):
         return FlightMethod.DO_ACTION
     elif method == CFlightMethodListActions:
         return FlightMethod.LIST_ACTIONS
+    elif method == CFlightMethodDoExchange:
+        return FlightMethod.DO_EXCHANGE
     return FlightMethod.INVALID
 
 
@@ -81,6 +81,7 @@ cdef extern from "plasma/common.h" nogil:
         int ref_count
         int64_t create_time
         int64_t construct_duration
+        int numa_node
         CObjectState state
         shared_ptr[CCudaIpcPlaceholder] ipc_handle
 
@@ -786,6 +787,10 @@ cdef class PlasmaClient:
             construct_duration
               Time the creation of the object took in seconds
 
+            numa_node
+              NUMA node of the object memory, or -1 if unknown (only
+              known when the store was started with -n)
+
             state
               "created" if the object is still being created and
               "sealed" if it is already sealed
@@ -810,6 +815,7 @@ cdef class PlasmaClient:
                 "ref_count": entry.ref_count,
                 "create_time": entry.create_time,
                 "construct_duration": entry.construct_duration,
+                "numa_node": entry.numa_node,
                 "state": state
             }
             inc(it)
@@ -226,6 +226,8 @@ cdef extern from "arrow/flight/api.h" namespace "arrow" nogil:
         " arrow::flight::FlightMethod::DoAction"
     CFlightMethod CFlightMethodListActions\
         " arrow::flight::FlightMethod::ListActions"
+    CFlightMethod CFlightMethodDoExchange\
+        " arrow::flight::FlightMethod::DoExchange"
 
     cdef cppclass CCallInfo" arrow::flight::CallInfo":
         CFlightMethod method
@@ -338,6 +338,32 @@ def test_sequence_integer_inferred(seq):
     assert arr.to_pylist() == expected
 
 
+@parametrize_with_iterable_types
+def test_sequence_integer_inferred_then_other_kinds(seq):
+    # Sequences of integers are converted speculatively, which must not
+    # change the inferred type if values of other kinds follow
+    arr = pa.array(seq([1, None, 3, 4.5]))
+    assert arr.type == pa.float64()
+    assert arr.to_pylist() == [1.0, None, 3.0, 4.5]
+
+    arr = pa.array(seq([None, 1, np.nan]), from_pandas=True)
+    assert arr.type == pa.int64()
+    assert arr.to_pylist() == [None, 1, None]
+
+    with pytest.raises((pa.ArrowInvalid, pa.ArrowTypeError)):
+        pa.array(seq([1, 2, 'a']))
+
+
+def test_convert_integers_inferred_with_mask():
+    data = np.array([1, 'a', 3, 4.5], dtype=object)
+
+    result = pa.array(data, mask=np.array([False, True, False, True]))
+    assert result.equals(pa.array([1, None, 3, None]))
+
+    result = pa.array(data, mask=np.array([False, True, False, False]))
+    assert result.equals(pa.array([1.0, None, 3.0, 4.5]))
+
+
 @parametrize_with_iterable_types
 @pytest.mark.parametrize("np_scalar_pa_type", int_type_pairs)
 def test_sequence_numpy_integer(seq, np_scalar_pa_type):
@@ -3165,6 +3165,39 @@ def test_to_pandas_split_blocks():
     _check_to_pandas_memory_unchanged(t, split_blocks=True)
 
 
+def test_to_pandas_threaded_long_columns():
+    # Long columns are converted in parallel slices, which cross the
+    # boundaries of the chunks
+    n = 300000
+    values = np.arange(n, dtype=np.int64)
+    mask = values % 7 == 0
+    chunks = [slice(0, 100001), slice(100001, 250000), slice(250000, n)]
+
+    def chunked(arr):
+        return pa.chunked_array([pa.array(arr[s], mask=mask[s])
+                                 for s in chunks])
+
+    t = pa.table([
+        chunked(values),
+        chunked(values.astype('f8')),
+        chunked(values.astype('datetime64[ms]')),
+        chunked(values.astype('timedelta64[ns]')),
+    ], ['i8', 'f8', 'ts', 'dur'])
+
+    for split_blocks in [False, True]:
+        expected = t.to_pandas(use_threads=False, split_blocks=split_blocks)
+        for i in range(t.num_columns):
+            result = t.column(i).to_pandas(use_threads=True)
+            tm.assert_series_equal(result, expected.iloc[:, i],
+                                   check_names=False)
+        result = t.to_pandas(use_threads=True, split_blocks=split_blocks)
+        tm.assert_frame_equal(result, expected)
+        # A single column is converted in parallel slices as well
+        result = pa.table([t.column('ts')], ['ts']).to_pandas(
+            use_threads=True, split_blocks=split_blocks)
+        tm.assert_frame_equal(result, expected[['ts']])
+
+
 def _check_blocks_created(t, number):
     x = t.to_pandas(split_blocks=True)
     assert len(x._data.blocks) == number